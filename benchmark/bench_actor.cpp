@@ -6,13 +6,20 @@
 //
 #include "td/actor/actor.h"
 #include "td/actor/ConcurrentScheduler.h"
+#include "td/actor/MultiPromise.h"
 #include "td/actor/PromiseFuture.h"
 
+#include "td/utils/algorithm.h"
 #include "td/utils/benchmark.h"
 #include "td/utils/common.h"
 #include "td/utils/crypto.h"
+#include "td/utils/format.h"
 #include "td/utils/logging.h"
 #include "td/utils/SliceBuilder.h"
+#include "td/utils/Time.h"
+
+#include <algorithm>
+#include <atomic>
 
 #if TD_MSVC
 #pragma comment(linker, "/STACK:16777216")
@@ -319,9 +326,446 @@ class QueryBench final : public td::Benchmark {
   td::ActorOwn<ServerActor> server_;
 };
 
+// latencies of the last run of a benchmark, collected separately by every actor to avoid synchronization
+class LatencyStats {
+ public:
+  void reset(size_t actor_n) {
+    latencies_.clear();
+    latencies_.resize(actor_n);
+  }
+
+  td::vector<double> *get_actor_latencies(size_t actor_id) {
+    return &latencies_[actor_id];
+  }
+
+  void report(const td::string &description, bool with_histogram) const {
+    td::vector<double> latencies;
+    for (auto &actor_latencies : latencies_) {
+      td::append(latencies, actor_latencies);
+    }
+    if (latencies.empty()) {
+      return;
+    }
+    std::sort(latencies.begin(), latencies.end());
+    auto get_quantile = [&](double quantile) {
+      auto index = static_cast<size_t>(static_cast<double>(latencies.size()) * quantile);
+      return latencies[td::min(index, latencies.size() - 1)];
+    };
+    LOG(ERROR) << "Latency [" << description << "]: p50 = " << td::format::as_time(get_quantile(0.5))
+               << ", p90 = " << td::format::as_time(get_quantile(0.9))
+               << ", p99 = " << td::format::as_time(get_quantile(0.99))
+               << ", max = " << td::format::as_time(latencies.back()) << ", count = " << latencies.size();
+    if (!with_histogram) {
+      return;
+    }
+
+    // bucket i contains latencies from [2^(i-1), 2^i) microseconds
+    td::vector<size_t> histogram;
+    for (auto latency : latencies) {
+      size_t bucket = 0;
+      while (static_cast<double>(static_cast<td::uint64>(1) << bucket) <= latency * 1e6 && bucket < 40) {
+        bucket++;
+      }
+      if (bucket >= histogram.size()) {
+        histogram.resize(bucket + 1);
+      }
+      histogram[bucket]++;
+    }
+    td::string histogram_str;
+    for (size_t i = 0; i < histogram.size(); i++) {
+      if (histogram[i] != 0) {
+        histogram_str += PSTRING() << " <" << (static_cast<td::uint64>(1) << i) << "us: " << histogram[i];
+      }
+    }
+    LOG(ERROR) << "Histogram [" << description << "]:" << histogram_str;
+  }
+
+ private:
+  td::vector<td::vector<double>> latencies_;
+};
+
+// N pairs of actors on different schedulers send requests to each other
+class PingPongBench final : public td::Benchmark {
+ public:
+  PingPongBench(int pair_n, int thread_n) : pair_n_(pair_n), thread_n_(thread_n) {
+  }
+
+  td::string get_description() const final {
+    return PSTRING() << "PingPong (pairs_n = " << pair_n_ << ") (threads_n = " << thread_n_ << ")";
+  }
+
+  void report_latency() const {
+    latency_stats_.report(get_description(), false);
+  }
+
+  struct PingActor;
+
+  struct PongActor final : public td::Actor {
+    void ping(td::ActorId<PingActor> ping_actor, double sent_at) {
+      send_closure(ping_actor, &PingActor::pong, sent_at);
+    }
+  };
+
+  struct PingActor final : public td::Actor {
+    td::ActorId<PongActor> pong_actor;
+    td::vector<double> *latencies = nullptr;
+    std::atomic<int> *active_pair_count = nullptr;
+    int left_n = 0;
+
+    void run(int n) {
+      left_n = n;
+      send_ping();
+    }
+
+    void send_ping() {
+      send_closure(pong_actor, &PongActor::ping, actor_id(this), td::Time::now());
+    }
+
+    void pong(double sent_at) {
+      latencies->push_back(td::Time::now() - sent_at);
+      if (--left_n == 0) {
+        if (active_pair_count->fetch_sub(1) == 1) {
+          td::Scheduler::instance()->finish();
+        }
+        return;
+      }
+      send_ping();
+    }
+  };
+
+  void start_up() final {
+    scheduler_ = td::make_unique<td::ConcurrentScheduler>();
+    scheduler_->init(thread_n_);
+    latency_stats_.reset(pair_n_);
+
+    ping_actors_.clear();
+    for (int i = 0; i < pair_n_; i++) {
+      auto pong_actor =
+          scheduler_->create_actor_unsafe<PongActor>((i + 1) % (thread_n_ + 1), "PongActor").release();
+      auto ping_actor = scheduler_->create_actor_unsafe<PingActor>(i % (thread_n_ + 1), "PingActor").release();
+      auto *ping = ping_actor.get_actor_unsafe();
+      ping->pong_actor = pong_actor;
+      ping->latencies = latency_stats_.get_actor_latencies(i);
+      ping->active_pair_count = &active_pair_count_;
+      ping_actors_.push_back(ping_actor);
+    }
+    scheduler_->start();
+  }
+
+  void run(int n) final {
+    active_pair_count_ = pair_n_;
+    {
+      auto guard = scheduler_->get_main_guard();
+      for (auto &ping_actor : ping_actors_) {
+        send_closure(ping_actor, &PingActor::run, td::max(n / pair_n_, 1));
+      }
+    }
+    while (scheduler_->run_main(10)) {
+      // empty
+    }
+  }
+
+  void tear_down() final {
+    scheduler_->finish();
+    scheduler_.reset();
+  }
+
+ private:
+  int pair_n_;
+  int thread_n_;
+  td::unique_ptr<td::ConcurrentScheduler> scheduler_;
+  td::vector<td::ActorId<PingActor>> ping_actors_;
+  std::atomic<int> active_pair_count_{0};
+  LatencyStats latency_stats_;
+};
+
+// one actor sends a request to many workers and waits for all of them using MultiPromiseActor
+class FanOutBench final : public td::Benchmark {
+ public:
+  FanOutBench(int worker_n, int thread_n) : worker_n_(worker_n), thread_n_(thread_n) {
+  }
+
+  td::string get_description() const final {
+    return PSTRING() << "FanOut (workers_n = " << worker_n_ << ") (threads_n = " << thread_n_ << ")";
+  }
+
+  void report_latency() const {
+    latency_stats_.report(get_description(), false);
+  }
+
+  struct WorkerActor final : public td::Actor {
+    void query(td::Promise<td::Unit> promise) {
+      promise.set_value(td::Unit());
+    }
+  };
+
+  struct MasterActor final : public td::Actor {
+    td::vector<td::ActorId<WorkerActor>> workers;
+    td::vector<double> *latencies = nullptr;
+    int left_n = 0;
+    double round_start_time = 0.0;
+
+    void run(int n) {
+      left_n = n;
+      start_round();
+    }
+
+    void start_round() {
+      round_start_time = td::Time::now();
+      td::MultiPromiseActorSafe multi_promise{"FanOutMultiPromise"};
+      multi_promise.add_promise(td::PromiseCreator::lambda(
+          [actor_id = actor_id(this)](td::Unit) { send_closure(actor_id, &MasterActor::on_round_finished); }));
+      for (auto &worker : workers) {
+        send_closure(worker, &WorkerActor::query, multi_promise.get_promise());
+      }
+    }
+
+    void on_round_finished() {
+      latencies->push_back(td::Time::now() - round_start_time);
+      if (--left_n == 0) {
+        td::Scheduler::instance()->finish();
+        return;
+      }
+      start_round();
+    }
+  };
+
+  void start_up() final {
+    scheduler_ = td::make_unique<td::ConcurrentScheduler>();
+    scheduler_->init(thread_n_);
+    latency_stats_.reset(1);
+
+    td::vector<td::ActorId<WorkerActor>> workers;
+    for (int i = 0; i < worker_n_; i++) {
+      workers.push_back(
+          scheduler_->create_actor_unsafe<WorkerActor>(thread_n_ == 0 ? 0 : i % thread_n_ + 1, "WorkerActor")
+              .release());
+    }
+    master_ = scheduler_->create_actor_unsafe<MasterActor>(0, "MasterActor").release();
+    master_.get_actor_unsafe()->workers = std::move(workers);
+    master_.get_actor_unsafe()->latencies = latency_stats_.get_actor_latencies(0);
+    scheduler_->start();
+  }
+
+  void run(int n) final {
+    {
+      auto guard = scheduler_->get_main_guard();
+      send_closure(master_, &MasterActor::run, n);
+    }
+    while (scheduler_->run_main(10)) {
+      // empty
+    }
+  }
+
+  void tear_down() final {
+    scheduler_->finish();
+    scheduler_.reset();
+  }
+
+ private:
+  int worker_n_;
+  int thread_n_;
+  td::unique_ptr<td::ConcurrentScheduler> scheduler_;
+  td::ActorId<MasterActor> master_;
+  LatencyStats latency_stats_;
+};
+
+// measures time between sending of an event and its handling for bursts of events
+template <bool is_later>
+class SendLatencyBench final : public td::Benchmark {
+ public:
+  explicit SendLatencyBench(int thread_n) : thread_n_(thread_n) {
+  }
+
+  td::string get_description() const final {
+    return PSTRING() << "SendLatency (send_closure" << (is_later ? "_later" : "") << ") (threads_n = " << thread_n_
+                     << ")";
+  }
+
+  void report_latency() const {
+    latency_stats_.report(get_description(), true);
+  }
+
+  static constexpr int BURST_SIZE = 16;
+
+  struct SenderActor;
+
+  struct ReceiverActor final : public td::Actor {
+    td::ActorId<SenderActor> sender;
+    td::vector<double> *latencies = nullptr;
+
+    void receive(double sent_at, bool is_last) {
+      latencies->push_back(td::Time::now() - sent_at);
+      if (is_last) {
+        send_closure(sender, &SenderActor::on_burst_received);
+      }
+    }
+  };
+
+  struct SenderActor final : public td::Actor {
+    td::ActorId<ReceiverActor> receiver;
+    int left_n = 0;
+
+    void run(int n) {
+      left_n = n;
+      send_burst();
+    }
+
+    void send_burst() {
+      for (int i = 0; i < BURST_SIZE; i++) {
+        if (is_later) {
+          send_closure_later(receiver, &ReceiverActor::receive, td::Time::now(), i + 1 == BURST_SIZE);
+        } else {
+          send_closure(receiver, &ReceiverActor::receive, td::Time::now(), i + 1 == BURST_SIZE);
+        }
+      }
+    }
+
+    void on_burst_received() {
+      left_n -= BURST_SIZE;
+      if (left_n <= 0) {
+        td::Scheduler::instance()->finish();
+        return;
+      }
+      send_burst();
+    }
+  };
+
+  void start_up() final {
+    scheduler_ = td::make_unique<td::ConcurrentScheduler>();
+    scheduler_->init(thread_n_);
+    latency_stats_.reset(1);
+
+    receiver_ = scheduler_->create_actor_unsafe<ReceiverActor>(thread_n_, "ReceiverActor").release();
+    sender_ = scheduler_->create_actor_unsafe<SenderActor>(0, "SenderActor").release();
+    sender_.get_actor_unsafe()->receiver = receiver_;
+    receiver_.get_actor_unsafe()->sender = sender_;
+    receiver_.get_actor_unsafe()->latencies = latency_stats_.get_actor_latencies(0);
+    scheduler_->start();
+  }
+
+  void run(int n) final {
+    {
+      auto guard = scheduler_->get_main_guard();
+      send_closure(sender_, &SenderActor::run, n);
+    }
+    while (scheduler_->run_main(10)) {
+      // empty
+    }
+  }
+
+  void tear_down() final {
+    scheduler_->finish();
+    scheduler_.reset();
+  }
+
+ private:
+  int thread_n_;
+  td::unique_ptr<td::ConcurrentScheduler> scheduler_;
+  td::ActorId<SenderActor> sender_;
+  td::ActorId<ReceiverActor> receiver_;
+  LatencyStats latency_stats_;
+};
+
+// many actors simultaneously migrate to the next scheduler after every received event
+class MigrationStormBench final : public td::Benchmark {
+ public:
+  MigrationStormBench(int actor_n, int thread_n) : actor_n_(actor_n), thread_n_(thread_n) {
+  }
+
+  td::string get_description() const final {
+    return PSTRING() << "MigrationStorm (actors_n = " << actor_n_ << ") (threads_n = " << thread_n_ << ")";
+  }
+
+  void report_latency() const {
+    latency_stats_.report(get_description(), false);
+  }
+
+  struct MigratingActor final : public td::Actor {
+    td::vector<double> *latencies = nullptr;
+    std::atomic<int> *active_actor_count = nullptr;
+    int sched_n = 0;
+
+    void hop(int left_n, double sent_at) {
+      latencies->push_back(td::Time::now() - sent_at);
+      if (left_n == 0) {
+        if (active_actor_count->fetch_sub(1) == 1) {
+          td::Scheduler::instance()->finish();
+        }
+        return;
+      }
+      migrate((td::Scheduler::instance()->sched_id() + 1) % sched_n);
+      send_closure_later(actor_id(this), &MigratingActor::hop, left_n - 1, td::Time::now());
+    }
+  };
+
+  void start_up() final {
+    scheduler_ = td::make_unique<td::ConcurrentScheduler>();
+    scheduler_->init(thread_n_);
+    latency_stats_.reset(actor_n_);
+
+    actors_.clear();
+    for (int i = 0; i < actor_n_; i++) {
+      auto actor_id =
+          scheduler_->create_actor_unsafe<MigratingActor>(i % (thread_n_ + 1), "MigratingActor").release();
+      auto *actor = actor_id.get_actor_unsafe();
+      actor->latencies = latency_stats_.get_actor_latencies(i);
+      actor->active_actor_count = &active_actor_count_;
+      actor->sched_n = thread_n_ + 1;
+      actors_.push_back(actor_id);
+    }
+    scheduler_->start();
+  }
+
+  void run(int n) final {
+    active_actor_count_ = actor_n_;
+    {
+      auto guard = scheduler_->get_main_guard();
+      for (auto &actor : actors_) {
+        send_closure_later(actor, &MigratingActor::hop, td::max(n / actor_n_, 1), td::Time::now());
+      }
+    }
+    while (scheduler_->run_main(10)) {
+      // empty
+    }
+  }
+
+  void tear_down() final {
+    scheduler_->finish();
+    scheduler_.reset();
+  }
+
+ private:
+  int actor_n_;
+  int thread_n_;
+  td::unique_ptr<td::ConcurrentScheduler> scheduler_;
+  td::vector<td::ActorId<MigratingActor>> actors_;
+  std::atomic<int> active_actor_count_{0};
+  LatencyStats latency_stats_;
+};
+
+template <class BenchT>
+static void bench_latency(BenchT &&b) {
+  bench(b);
+  b.report_latency();
+}
+
 int main() {
+  SET_VERBOSITY_LEVEL(VERBOSITY_NAME(ERROR));
   td::init_openssl_threads();
 
+  bench_latency(PingPongBench(1, 1));
+  bench_latency(PingPongBench(16, 1));
+  bench_latency(PingPongBench(16, 4));
+  bench_latency(FanOutBench(16, 0));
+  bench_latency(FanOutBench(16, 4));
+  bench_latency(SendLatencyBench<false>(0));
+  bench_latency(SendLatencyBench<true>(0));
+  bench_latency(SendLatencyBench<false>(1));
+  bench_latency(SendLatencyBench<true>(1));
+  bench_latency(MigrationStormBench(16, 2));
+  bench_latency(MigrationStormBench(256, 4));
+
   bench(CreateActorBench());
   bench(RingBench<4>(504, 0));
   bench(RingBench<3>(504, 0));
@@ -0,0 +1,77 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2022
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// replaces global operator new and operator delete to count memory allocations made by a benchmark executable
+// the file must be linked to the executable; td::bench will report the number of allocations per operation then
+
+#include "td/utils/benchmark.h"
+#include "td/utils/common.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+static std::atomic<td::uint64> allocation_count{0};
+
+static td::uint64 get_allocation_count() {
+  return allocation_count.load(std::memory_order_relaxed);
+}
+
+static struct AllocationCounterInitializer {
+  AllocationCounterInitializer() {
+    td::get_benchmark_allocation_counter() = &get_allocation_count;
+  }
+} allocation_counter_initializer;
+
+static void *allocate(std::size_t size) noexcept {
+  allocation_count.fetch_add(1, std::memory_order_relaxed);
+  return std::malloc(size == 0 ? 1 : size);
+}
+
+void *operator new(std::size_t size) {
+  auto result = allocate(size);
+  if (result == nullptr) {
+    throw std::bad_alloc();
+  }
+  return result;
+}
+
+void *operator new[](std::size_t size) {
+  return operator new(size);
+}
+
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept {
+  return allocate(size);
+}
+
+void *operator new[](std::size_t size, const std::nothrow_t &) noexcept {
+  return allocate(size);
+}
+
+void operator delete(void *ptr) noexcept {
+  std::free(ptr);
+}
+
+void operator delete[](void *ptr) noexcept {
+  std::free(ptr);
+}
+
+void operator delete(void *ptr, const std::nothrow_t &) noexcept {
+  std::free(ptr);
+}
+
+void operator delete[](void *ptr, const std::nothrow_t &) noexcept {
+  std::free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept {
+  std::free(ptr);
+}
+
+void operator delete[](void *ptr, std::size_t) noexcept {
+  std::free(ptr);
+}
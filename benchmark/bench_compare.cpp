@@ -0,0 +1,166 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2022
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "td/utils/common.h"
+#include "td/utils/filesystem.h"
+#include "td/utils/JsonBuilder.h"
+#include "td/utils/logging.h"
+#include "td/utils/misc.h"
+#include "td/utils/OptionParser.h"
+#include "td/utils/Slice.h"
+#include "td/utils/SliceBuilder.h"
+#include "td/utils/Status.h"
+#include "td/utils/StringBuilder.h"
+
+#include <cmath>
+#include <map>
+
+struct BenchmarkResult {
+  td::string name;
+  td::int32 pass_count = 0;
+  double average = 0.0;
+  double stddev = 0.0;
+  double allocations_per_op = -1.0;
+};
+
+// reads results, which are written by td::bench to the file specified in TD_BENCHMARK_OUTPUT
+static td::Result<std::map<td::string, BenchmarkResult>> load_benchmark_results(td::CSlice path) {
+  TRY_RESULT(content, td::read_file_str(path));
+  std::map<td::string, BenchmarkResult> results;
+  for (auto line : td::full_split(td::Slice(content), '\n')) {
+    line = td::trim(line);
+    if (line.empty()) {
+      continue;
+    }
+    auto line_str = line.str();
+    TRY_RESULT(value, td::json_decode(line_str));
+    if (value.type() != td::JsonValue::Type::Object) {
+      return td::Status::Error(PSLICE() << "Expected an object in " << path);
+    }
+    auto &object = value.get_object();
+    TRY_RESULT(executable, td::get_json_object_string_field(object, "executable"));
+    TRY_RESULT(description, td::get_json_object_string_field(object, "description", false));
+
+    BenchmarkResult result;
+    result.name = executable.empty() ? description : PSTRING() << executable << ": " << description;
+    TRY_RESULT_ASSIGN(result.pass_count, td::get_json_object_int_field(object, "pass_count", true, 1));
+    TRY_RESULT_ASSIGN(result.average, td::get_json_object_double_field(object, "average", false));
+    TRY_RESULT_ASSIGN(result.stddev, td::get_json_object_double_field(object, "stddev"));
+    TRY_RESULT_ASSIGN(result.allocations_per_op,
+                      td::get_json_object_double_field(object, "allocations_per_op", true, -1.0));
+    if (result.pass_count <= 0 || result.average <= 0) {
+      return td::Status::Error(PSLICE() << "Invalid result of \"" << result.name << "\" in " << path);
+    }
+    // if a benchmark was run several times, then only the last result is used
+    auto name = result.name;
+    results[name] = std::move(result);
+  }
+  return std::move(results);
+}
+
+int main(int argc, char **argv) {
+  SET_VERBOSITY_LEVEL(VERBOSITY_NAME(WARNING));
+
+  double threshold = 0.05;
+  double sigma_count = 3.0;
+  auto parse_double = [](double &value) {
+    return [&value](td::Slice parameter) {
+      value = td::to_double(parameter);
+      if (!(value >= 0)) {
+        return td::Status::Error("Value must be non-negative");
+      }
+      return td::Status::OK();
+    };
+  };
+
+  td::OptionParser options;
+  options.set_description(
+      "Compares results of benchmarks with the baseline. A benchmark has regressed if its throughput has decreased "
+      "more than by the relative threshold and the decrease exceeds the specified number of standard errors, or "
+      "if it makes noticeably more memory allocations per operation. Exits with code 1 if there are regressions.");
+  options.add_checked_option('t', "threshold", "Set relative threshold; default is 0.05", parse_double(threshold));
+  options.add_checked_option('s', "sigma", "Set number of standard errors; default is 3", parse_double(sigma_count));
+  auto r_non_options = options.run(argc, argv, 2);
+  if (r_non_options.is_error()) {
+    LOG(PLAIN) << argv[0] << ": " << r_non_options.error().message();
+    LOG(PLAIN) << options;
+    return 2;
+  }
+  auto non_options = r_non_options.move_as_ok();
+
+  auto r_baseline = load_benchmark_results(td::CSlice(non_options[0]));
+  if (r_baseline.is_error()) {
+    LOG(PLAIN) << "Can't load baseline: " << r_baseline.error();
+    return 2;
+  }
+  auto r_current = load_benchmark_results(td::CSlice(non_options[1]));
+  if (r_current.is_error()) {
+    LOG(PLAIN) << "Can't load results: " << r_current.error();
+    return 2;
+  }
+  auto baseline = r_baseline.move_as_ok();
+  auto current = r_current.move_as_ok();
+
+  td::vector<td::string> regressions;
+  for (auto &it : current) {
+    auto &result = it.second;
+    auto baseline_it = baseline.find(it.first);
+    if (baseline_it == baseline.end()) {
+      LOG(PLAIN) << "[new]         " << result.name << ": " << td::StringBuilder::FixedDouble(result.average, 3)
+                 << " ops/sec";
+      continue;
+    }
+    auto &old_result = baseline_it->second;
+
+    auto difference = result.average - old_result.average;
+    auto relative_difference = difference / old_result.average;
+    auto standard_error = std::sqrt(old_result.stddev * old_result.stddev / old_result.pass_count +
+                                    result.stddev * result.stddev / result.pass_count);
+    auto is_significant =
+        std::abs(relative_difference) > threshold && std::abs(difference) > sigma_count * standard_error;
+
+    td::string allocations;
+    bool has_more_allocations = false;
+    if (result.allocations_per_op >= 0 && old_result.allocations_per_op >= 0) {
+      auto allocation_difference = result.allocations_per_op - old_result.allocations_per_op;
+      has_more_allocations = allocation_difference > td::max(old_result.allocations_per_op * threshold, 0.05);
+      allocations = PSTRING() << ", allocations per op "
+                              << td::StringBuilder::FixedDouble(old_result.allocations_per_op, 3) << " -> "
+                              << td::StringBuilder::FixedDouble(result.allocations_per_op, 3);
+    }
+
+    auto is_regression = (is_significant && difference < 0) || has_more_allocations;
+    td::Slice status("[same]        ");
+    if (is_regression) {
+      status = td::Slice("[regression]  ");
+    } else if (is_significant) {
+      status = td::Slice("[improvement] ");
+    }
+    auto message = PSTRING() << status << result.name << ": " << td::StringBuilder::FixedDouble(old_result.average, 3)
+                             << " -> " << td::StringBuilder::FixedDouble(result.average, 3) << " ops/sec ("
+                             << (difference >= 0 ? "+" : "")
+                             << td::StringBuilder::FixedDouble(relative_difference * 100, 2) << "%)" << allocations;
+    LOG(PLAIN) << message;
+    if (is_regression) {
+      regressions.push_back(std::move(message));
+    }
+  }
+  for (auto &it : baseline) {
+    if (current.count(it.first) == 0) {
+      LOG(PLAIN) << "[missing]     " << it.first;
+    }
+  }
+
+  if (regressions.empty()) {
+    LOG(PLAIN) << "No regressions found";
+    return 0;
+  }
+  LOG(PLAIN) << "Found " << regressions.size() << " regressions:";
+  for (auto &regression : regressions) {
+    LOG(PLAIN) << regression;
+  }
+  return 1;
+}
@@ -367,6 +367,29 @@ class Crc32Bench final : public td::Benchmark {
   }
 };
 
+#if TD_HAVE_CRC32C
+class Crc32cBench final : public td::Benchmark {
+ public:
+  alignas(64) unsigned char data[DATA_SIZE];
+
+  std::string get_description() const final {
+    return PSTRING() << "Crc32c [" << (DATA_SIZE >> 10) << "KB]";
+  }
+
+  void start_up() final {
+    std::fill(std::begin(data), std::end(data), static_cast<unsigned char>(123));
+  }
+
+  void run(int n) final {
+    td::uint64 res = 0;
+    for (int i = 0; i < n; i++) {
+      res += td::crc32c(td::Slice(data, DATA_SIZE));
+    }
+    td::do_not_optimize_away(res);
+  }
+};
+#endif
+
 class Crc64Bench final : public td::Benchmark {
  public:
   alignas(64) unsigned char data[DATA_SIZE];
@@ -416,5 +439,8 @@ int main() {
   td::bench(SHA1Bench());
 #endif
   td::bench(Crc32Bench());
+#if TD_HAVE_CRC32C
+  td::bench(Crc32cBench());
+#endif
   td::bench(Crc64Bench());
 }
@@ -4,11 +4,13 @@
 // Distributed under the Boost Software License, Version 1.0. (See accompanying
 // file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 //
+#include "td/net/HttpChunkedByteFlow.h"
 #include "td/net/HttpQuery.h"
 #include "td/net/HttpReader.h"
 
 #include "td/utils/benchmark.h"
 #include "td/utils/buffer.h"
+#include "td/utils/ByteFlow.h"
 #include "td/utils/common.h"
 #include "td/utils/find_boundary.h"
 #include "td/utils/logging.h"
@@ -47,11 +49,115 @@ class HttpReaderBench final : public td::Benchmark {
   td::HttpReader http_reader_;
 
   void start_up() final {
+    writer_ = td::ChainBufferWriter();
     reader_ = writer_.extract_reader();
     http_reader_.init(&reader_, 10000, 0);
   }
 };
 
+// a typical webhook request with several headers and a JSON body
+static std::string webhook_query =
+    "POST /webhook/123456789:AAHdqTcvCH1vGWJxfSeofSAs0K5PALDsaw HTTP/1.1\r\n"
+    "Host: example.com\r\n"
+    "Content-Type: application/json\r\n"
+    "Content-Length: 325\r\n"
+    "Connection: keep-alive\r\n"
+    "Accept-Encoding: gzip, deflate\r\n"
+    "User-Agent: Mozilla/5.0 (X11; Linux x86_64)\r\n"
+    "X-Forwarded-For: 149.154.167.220\r\n"
+    "X-Request-Id: 6b0c3f3e-8c5a-4b21-9a55-0d6b2e3f7a10\r\n"
+    "\r\n"
+    "{\"update_id\":10000,\"message\":{\"message_id\":1365,\"date\":1441645532,\"chat\":{\"id\":1111111,"
+    "\"type\":\"private\",\"first_name\":\"Test\",\"last_name\":\"Lastname\",\"username\":\"Test\"},"
+    "\"from\":{\"id\":1111111,\"is_bot\":false,\"first_name\":\"Test\",\"last_name\":\"Lastname\","
+    "\"username\":\"Test\"},\"text\":\"/start The quick brown fox jumps over the lazy dog\"}}";
+
+class HttpReaderWebhookBench final : public td::Benchmark {
+  std::string get_description() const final {
+    return "HttpReaderWebhookBench";
+  }
+
+  void run(int n) final {
+    // requests are appended in blocks, so some of them are split between chunks
+    constexpr int BLOCK_QUERY_COUNT = 7;
+    td::HttpQuery q;
+    int parsed = 0;
+    int sent = 0;
+    for (int i = 0; i < n; i += BLOCK_QUERY_COUNT) {
+      for (int j = 0; j < BLOCK_QUERY_COUNT; j++) {
+        writer_.append(webhook_query);
+        sent++;
+      }
+      reader_.sync_with_writer();
+      while (true) {
+        auto wait = http_reader_.read_next(&q).ok();
+        if (wait != 0) {
+          break;
+        }
+        CHECK(q.headers_.size() == 8);
+        parsed++;
+      }
+    }
+    CHECK(parsed == sent);
+  }
+  td::ChainBufferWriter writer_;
+  td::ChainBufferReader reader_;
+  td::HttpReader http_reader_;
+
+  void start_up() final {
+    writer_ = td::ChainBufferWriter();
+    reader_ = writer_.extract_reader();
+    http_reader_.init(&reader_, 10000, 0);
+  }
+};
+
+// a big response body in chunks of 16 KB, which is received by 64 KB reads
+class HttpChunkedByteFlowBench final : public td::Benchmark {
+  std::string get_description() const final {
+    return "HttpChunkedByteFlowBench";
+  }
+
+  static constexpr int BLOCK_CHUNK_COUNT = 4;
+  static constexpr int BODY_CHUNK_COUNT = 1 << 12;  // total body size must not exceed the limit
+  static constexpr size_t CHUNK_SIZE = 1 << 14;
+
+  void run(int n) final {
+    size_t received_size = 0;
+    size_t sent_size = 0;
+    for (int i = 0; i < n;) {
+      td::ChainBufferWriter input_writer;
+      auto input = input_writer.extract_reader();
+      td::ByteFlowSource source(&input);
+      td::HttpChunkedByteFlow chunked_flow;
+      td::ByteFlowSink sink;
+      source >> chunked_flow >> sink;
+
+      for (int j = 0; j < BODY_CHUNK_COUNT && i < n; j += BLOCK_CHUNK_COUNT, i += BLOCK_CHUNK_COUNT) {
+        sent_size += CHUNK_SIZE * BLOCK_CHUNK_COUNT;
+        auto dest = input_writer.prepare_append_at_least(block_.size());
+        dest.copy_from(block_);
+        input_writer.confirm_append(block_.size());
+        source.wakeup();
+        auto *output = sink.get_output();
+        received_size += output->size();
+        output->advance(output->size());
+      }
+    }
+    CHECK(received_size == sent_size);
+  }
+
+  void start_up() final {
+    block_.clear();
+    for (int i = 0; i < BLOCK_CHUNK_COUNT; i++) {
+      block_ += "4000\r\n";
+      block_ += std::string(CHUNK_SIZE, 'a');
+      block_ += "\r\n";
+    }
+  }
+
+  std::string block_;
+};
+
 class BufferBench final : public td::Benchmark {
   std::string get_description() const final {
     return "BufferBench";
@@ -74,6 +180,7 @@ class BufferBench final : public td::Benchmark {
   td::HttpReader http_reader_;
 
   void start_up() final {
+    writer_ = td::ChainBufferWriter();
     reader_ = writer_.extract_reader();
   }
 };
@@ -104,6 +211,7 @@ class FindBoundaryBench final : public td::Benchmark {
   td::HttpReader http_reader_;
 
   void start_up() final {
+    writer_ = td::ChainBufferWriter();
     reader_ = writer_.extract_reader();
   }
 };
@@ -113,4 +221,6 @@ int main() {
   td::bench(BufferBench());
   td::bench(FindBoundaryBench());
   td::bench(HttpReaderBench());
+  td::bench(HttpReaderWebhookBench());
+  td::bench(HttpChunkedByteFlowBench());
 }
@@ -83,25 +83,53 @@ class HttpEchoConnection final : public td::Actor {
 };
 
 const int N = 8;
-class Server final : public td::TcpListener::Callback {
+
+// connections are accepted and processed on the same scheduler, if the listener is sharded
+class Acceptor final : public td::TcpListener::Callback {
  public:
-  void start_up() final {
-    listener_ =
-        td::create_actor<td::TcpListener>("Listener", 8082, td::ActorOwn<td::TcpListener::Callback>(actor_id(this)));
+  explicit Acceptor(bool is_sharded) : is_sharded_(is_sharded) {
   }
+
   void accept(td::SocketFd fd) final {
+    if (is_sharded_) {
+      td::create_actor<HttpEchoConnection>("HttpEchoConnection", std::move(fd)).release();
+      return;
+    }
     pos_++;
     auto scheduler_id = pos_ % (N != 0 ? N : 1) + (N != 0);
     td::create_actor_on_scheduler<HttpEchoConnection>("HttpEchoConnection", scheduler_id, std::move(fd)).release();
   }
+
+ private:
+  bool is_sharded_;
+  int pos_{0};
+};
+
+class Server final : public td::Actor {
+ public:
+  void start_up() final {
+    auto is_sharded = N != 0 && td::ShardedTcpListener::is_supported();
+    td::vector<td::int32> scheduler_ids;
+    if (is_sharded) {
+      for (int i = 1; i <= N; i++) {
+        scheduler_ids.push_back(i);
+      }
+    } else {
+      scheduler_ids.push_back(0);
+    }
+    listener_ = td::create_actor<td::ShardedTcpListener>(
+        "Listener", 8082, std::move(scheduler_ids), [is_sharded](td::int32 scheduler_id) {
+          return td::ActorOwn<td::TcpListener::Callback>(
+              td::create_actor_on_scheduler<Acceptor>("Acceptor", scheduler_id, is_sharded));
+        });
+  }
   void hangup() final {
     LOG(ERROR) << "Hanging up..";
     stop();
   }
 
  private:
-  td::ActorOwn<td::TcpListener> listener_;
-  int pos_{0};
+  td::ActorOwn<td::ShardedTcpListener> listener_;
 };
 
 int main() {
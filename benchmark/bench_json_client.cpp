@@ -0,0 +1,175 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2022
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "td/telegram/td_json_client.h"
+
+#include "td/utils/benchmark.h"
+#include "td/utils/common.h"
+#include "td/utils/logging.h"
+#include "td/utils/misc.h"
+#include "td/utils/Slice.h"
+#include "td/utils/SliceBuilder.h"
+#include "td/utils/Time.h"
+
+#include <algorithm>
+#include <cstring>
+
+// returns identifier from "@extra" of the response or 0 for updates
+static td::uint64 get_response_extra(const char *response) {
+  static const td::CSlice EXTRA_KEY("\"@extra\":");
+  auto extra = std::strstr(response, EXTRA_KEY.c_str());
+  if (extra == nullptr) {
+    return 0;
+  }
+  extra += EXTRA_KEY.size();
+  size_t length = 0;
+  while (td::is_digit(extra[length])) {
+    length++;
+  }
+  return td::to_integer<td::uint64>(td::Slice(extra, length));
+}
+
+class TdJsonExecuteBench final : public td::Benchmark {
+ public:
+  td::string get_description() const final {
+    return "td_execute(getTextEntities)";
+  }
+
+  void run(int n) final {
+    for (int i = 0; i < n; i++) {
+      auto result = td_execute(
+          "{\"@type\":\"getTextEntities\",\"text\":\"@telegram /test_command https://telegram.org telegram.me\"}");
+      CHECK(result != nullptr);
+    }
+  }
+};
+
+// measures the full path of a request to Td and back through the JSON interface:
+// td_send -> from_json -> Td::on_request -> send_result -> to_json -> td_receive
+// the requested methods are offline, so Td answers them without network and database
+class TdJsonRequestBench final : public td::Benchmark {
+ public:
+  explicit TdJsonRequestBench(td::string request_type) : request_type_(std::move(request_type)) {
+  }
+
+  td::string get_description() const final {
+    return PSTRING() << "td_send/td_receive(" << request_type_ << ")";
+  }
+
+  void start_up() final {
+    client_id_ = td_create_client_id();
+    latencies_.clear();
+    // the client is created only after the first request is sent
+    send_request(0, "getOption", "\"name\":\"version\"");
+    wait_for_responses(1);
+  }
+
+  void run(int n) final {
+    constexpr int MAX_PENDING_REQUESTS = 1000;
+    send_times_.assign(static_cast<size_t>(n) + 1, 0.0);
+    int sent_count = 0;
+    received_count_ = 0;
+    while (received_count_ < n) {
+      while (sent_count < n && sent_count - received_count_ < MAX_PENDING_REQUESTS) {
+        sent_count++;
+        send_times_[sent_count] = td::Time::now();
+        send_request(static_cast<td::uint64>(sent_count), request_type_, get_request_arguments());
+      }
+      receive_responses();
+    }
+  }
+
+  void tear_down() final {
+    send_request(0, "close", td::Slice());
+    while (!is_closed_) {
+      receive_responses();
+    }
+    is_closed_ = false;
+
+    if (latencies_.empty()) {
+      return;
+    }
+    std::sort(latencies_.begin(), latencies_.end());
+    auto get_quantile = [&](double quantile) {
+      return latencies_[static_cast<size_t>(static_cast<double>(latencies_.size() - 1) * quantile)] * 1e6;
+    };
+    LOG(WARNING) << get_description() << " latency in microseconds: p50 " << get_quantile(0.5) << " p90 "
+                 << get_quantile(0.9) << " p99 " << get_quantile(0.99) << " max " << get_quantile(1.0);
+  }
+
+ private:
+  td::string request_type_;
+  int client_id_ = 0;
+  int received_count_ = 0;
+  bool is_closed_ = false;
+  td::vector<double> send_times_;
+  td::vector<double> latencies_;
+
+  td::Slice get_request_arguments() const {
+    if (request_type_ == "getOption") {
+      return td::Slice("\"name\":\"version\"");
+    }
+    if (request_type_ == "testSquareInt") {
+      return td::Slice("\"x\":12345");
+    }
+    if (request_type_ == "testCallString") {
+      return td::Slice("\"x\":\"The quick brown fox jumps over the lazy dog\"");
+    }
+    if (request_type_ == "testCallVectorStringObject") {
+      return td::Slice("\"x\":[{\"value\":\"a\"},{\"value\":\"bb\"},{\"value\":\"ccc\"}]");
+    }
+    return td::Slice();
+  }
+
+  void send_request(td::uint64 extra, td::Slice type, td::Slice arguments) {
+    td::string request = PSTRING() << "{\"@type\":\"" << type << "\",\"@extra\":" << extra
+                                   << (arguments.empty() ? "" : ",") << arguments << '}';
+    td_send(client_id_, request.c_str());
+  }
+
+  void wait_for_responses(int count) {
+    received_count_ = 0;
+    while (received_count_ < count) {
+      receive_responses();
+    }
+  }
+
+  void receive_responses() {
+    int response_count = 0;
+    const int *response_offsets = nullptr;
+    auto buffer = td_receive_batch(10.0, 1000, &response_count, &response_offsets);
+    auto now = td::Time::now();
+    for (int i = 0; i < response_count; i++) {
+      const char *response = buffer + response_offsets[i];
+      auto extra = get_response_extra(response);
+      if (extra == 0) {
+        if (std::strstr(response, "authorizationStateClosed") != nullptr) {
+          is_closed_ = true;
+        }
+        if (std::strstr(response, "\"@type\":\"update") == nullptr) {
+          // the response to the initial request or to close
+          received_count_++;
+        }
+        continue;
+      }
+      if (extra < send_times_.size()) {
+        latencies_.push_back(now - send_times_[extra]);
+      }
+      received_count_++;
+    }
+  }
+};
+
+int main() {
+  SET_VERBOSITY_LEVEL(VERBOSITY_NAME(WARNING));
+  td_execute("{\"@type\":\"setLogVerbosityLevel\",\"new_verbosity_level\":1}");
+  td::bench(TdJsonExecuteBench());
+  td::bench(TdJsonRequestBench("testCallEmpty"));
+  td::bench(TdJsonRequestBench("testSquareInt"));
+  td::bench(TdJsonRequestBench("testCallString"));
+  td::bench(TdJsonRequestBench("testCallVectorStringObject"));
+  td::bench(TdJsonRequestBench("getOption"));
+}
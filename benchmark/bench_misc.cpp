@@ -7,6 +7,7 @@
 #include "td/telegram/telegram_api.h"
 #include "td/telegram/telegram_api.hpp"
 
+#include "td/utils/base64.h"
 #include "td/utils/benchmark.h"
 #include "td/utils/common.h"
 #include "td/utils/format.h"
@@ -22,6 +23,7 @@
 #include "td/utils/SliceBuilder.h"
 #include "td/utils/Status.h"
 #include "td/utils/ThreadSafeCounter.h"
+#include "td/utils/utf8.h"
 
 #if !TD_WINDOWS
 #include <unistd.h>
@@ -37,6 +39,7 @@
 #include <atomic>
 #include <cstdint>
 #include <set>
+#include <utility>
 
 class F {
   td::uint32 &sum;
@@ -424,6 +427,60 @@ std::atomic<td::int64> AtomicCounterBench<StrictOrder>::counter_;
 
 #endif
 
+template <bool IsScalar>
+class Utf8Bench final : public td::Benchmark {
+  td::string name_;
+  td::string text_;
+
+  td::string get_description() const final {
+    return PSTRING() << "Utf8" << (IsScalar ? "Scalar" : "") << '[' << name_ << ']';
+  }
+  void run(int n) final {
+    td::size_t result = 0;
+    for (int i = 0; i < n; i++) {
+      if (IsScalar) {
+        result += td::check_utf8_scalar(text_) + td::utf8_length_scalar(text_) + td::utf8_utf16_length_scalar(text_);
+      } else {
+        result += td::check_utf8(text_) + td::utf8_length(text_) + td::utf8_utf16_length(text_);
+      }
+    }
+    td::do_not_optimize_away(result);
+  }
+
+ public:
+  Utf8Bench(td::string name, const td::string &word) : name_(std::move(name)) {
+    // a typical channel message size
+    while (text_.size() < 4000) {
+      text_ += word;
+      text_ += ' ';
+    }
+  }
+};
+
+class Base64Bench final : public td::Benchmark {
+  td::string data_;
+  td::string encoded_;
+
+  td::string get_description() const final {
+    return PSTRING() << "Base64[" << data_.size() << ']';
+  }
+  void run(int n) final {
+    td::size_t result = 0;
+    for (int i = 0; i < n; i++) {
+      result += td::base64url_encode(data_).size() + td::base64_decode(encoded_).ok().size();
+    }
+    td::do_not_optimize_away(result);
+  }
+
+ public:
+  explicit Base64Bench(td::size_t size) : data_(size, 'a') {
+    for (td::size_t i = 0; i < size; i++) {
+      data_[i] = static_cast<char>(i * 37 + 11);
+    }
+    encoded_ = td::base64_encode(data_);
+  }
+};
+
 class IdDuplicateCheckerOld {
  public:
   static td::string get_description() {
@@ -652,6 +709,15 @@ class DuplicateCheckerBenchEvenOdd final : public td::Benchmark {
 int main() {
   SET_VERBOSITY_LEVEL(VERBOSITY_NAME(DEBUG));
 
+  td::bench(Base64Bench(72));
+  td::bench(Base64Bench(1 << 16));
+  td::bench(Utf8Bench<true>("ascii", "message"));
+  td::bench(Utf8Bench<false>("ascii", "message"));
+  td::bench(Utf8Bench<true>("cyrillic", "сообщение"));
+  td::bench(Utf8Bench<false>("cyrillic", "сообщение"));
+  td::bench(Utf8Bench<true>("emoji", "😀😁"));
+  td::bench(Utf8Bench<false>("emoji", "😀😁"));
+
   td::bench(DuplicateCheckerBenchEvenOdd<IdDuplicateCheckerNew<1000>>());
   td::bench(DuplicateCheckerBenchEvenOdd<IdDuplicateCheckerNew<300>>());
   td::bench(DuplicateCheckerBenchEvenOdd<IdDuplicateCheckerArray<1000>>());
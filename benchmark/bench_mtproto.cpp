@@ -0,0 +1,230 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2022
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "td/mtproto/AuthKey.h"
+#include "td/mtproto/IStreamTransport.h"
+#include "td/mtproto/PacketInfo.h"
+#include "td/mtproto/ProxySecret.h"
+#include "td/mtproto/TlsReaderByteFlow.h"
+#include "td/mtproto/Transport.h"
+#include "td/mtproto/TransportType.h"
+
+#include "td/utils/benchmark.h"
+#include "td/utils/buffer.h"
+#include "td/utils/ByteFlow.h"
+#include "td/utils/common.h"
+#include "td/utils/logging.h"
+#include "td/utils/Random.h"
+#include "td/utils/Slice.h"
+#include "td/utils/SliceBuilder.h"
+#include "td/utils/Storer.h"
+
+static td::mtproto::AuthKey create_auth_key() {
+  td::string key(2048 / 8, '\0');
+  td::Random::secure_bytes(key);
+  return td::mtproto::AuthKey(td::Random::secure_uint64(), std::move(key));
+}
+
+static td::mtproto::PacketInfo create_packet_info() {
+  td::mtproto::PacketInfo info;
+  info.version = 2;
+  info.salt = td::Random::secure_uint64();
+  info.session_id = td::Random::secure_uint64();
+  return info;
+}
+
+// payload size must be divisible by 4 as all MTProto messages are
+static td::string create_payload(size_t size) {
+  CHECK(size % 4 == 0);
+  td::string payload(size, '\0');
+  td::Random::secure_bytes(payload);
+  return payload;
+}
+
+class MtprotoWriteBench final : public td::Benchmark {
+ public:
+  explicit MtprotoWriteBench(size_t packet_size) : packet_size_(packet_size) {
+  }
+
+  td::string get_description() const final {
+    return PSTRING() << "mtproto::Transport::write [size = " << packet_size_ << "]";
+  }
+
+  void start_up() final {
+    auth_key_ = create_auth_key();
+    payload_ = create_payload(packet_size_);
+    auto info = create_packet_info();
+    buffer_ = td::BufferSlice(td::mtproto::Transport::write(td::create_storer(payload_), auth_key_, &info));
+  }
+
+  void run(int n) final {
+    auto storer = td::create_storer(payload_);
+    for (int i = 0; i < n; i++) {
+      auto info = create_packet_info();
+      auto size = td::mtproto::Transport::write(storer, auth_key_, &info, buffer_.as_slice());
+      CHECK(size <= buffer_.size());
+    }
+  }
+
+ private:
+  size_t packet_size_;
+  td::mtproto::AuthKey auth_key_;
+  td::string payload_;
+  td::BufferSlice buffer_;
+};
+
+class MtprotoReadBench final : public td::Benchmark {
+ public:
+  explicit MtprotoReadBench(size_t packet_size) : packet_size_(packet_size) {
+  }
+
+  td::string get_description() const final {
+    return PSTRING() << "mtproto::Transport::read [size = " << packet_size_ << "]";
+  }
+
+  void start_up() final {
+    auth_key_ = create_auth_key();
+    auto payload = create_payload(packet_size_);
+    auto storer = td::create_storer(payload);
+    auto info = create_packet_info();
+    packet_ = td::BufferSlice(td::mtproto::Transport::write(storer, auth_key_, &info));
+    td::mtproto::Transport::write(storer, auth_key_, &info, packet_.as_slice());
+    buffer_ = td::BufferSlice(packet_.size());
+  }
+
+  void run(int n) final {
+    for (int i = 0; i < n; i++) {
+      // the packet is decrypted inplace, so it must be restored before each read
+      buffer_.as_slice().copy_from(packet_.as_slice());
+      auto info = create_packet_info();
+      auto r_result = td::mtproto::Transport::read(buffer_.as_slice(), auth_key_, &info);
+      CHECK(r_result.is_ok());
+      CHECK(r_result.ok().type() == td::mtproto::Transport::ReadResult::Packet);
+    }
+  }
+
+ private:
+  size_t packet_size_;
+  td::mtproto::AuthKey auth_key_;
+  td::BufferSlice packet_;
+  td::BufferSlice buffer_;
+};
+
+// measures framing, padding and obfuscation of packets, which are sent to a TCP connection
+class StreamTransportWriteBench final : public td::Benchmark {
+ public:
+  StreamTransportWriteBench(td::string name, td::mtproto::TransportType type, size_t packet_size)
+      : name_(std::move(name)), type_(std::move(type)), packet_size_(packet_size) {
+  }
+
+  td::string get_description() const final {
+    return PSTRING() << "IStreamTransport::write [type = " << name_ << "] [size = " << packet_size_ << "]";
+  }
+
+  void start_up() final {
+    payload_ = create_payload(packet_size_);
+    input_reader_ = input_writer_.extract_reader();
+    output_reader_ = output_writer_.extract_reader();
+    transport_ = td::mtproto::create_transport(type_);
+    transport_->init(&input_reader_, &output_writer_);
+  }
+
+  void run(int n) final {
+    for (int i = 0; i < n; i++) {
+      td::BufferWriter message(payload_, transport_->max_prepend_size(), transport_->max_append_size());
+      transport_->write(std::move(message), false);
+      output_reader_.sync_with_writer();
+      output_reader_.advance(output_reader_.size());
+    }
+  }
+
+  void tear_down() final {
+    transport_.reset();
+  }
+
+ private:
+  td::string name_;
+  td::mtproto::TransportType type_;
+  size_t packet_size_;
+  td::string payload_;
+  td::ChainBufferWriter input_writer_;
+  td::ChainBufferReader input_reader_;
+  td::ChainBufferWriter output_writer_;
+  td::ChainBufferReader output_reader_;
+  td::unique_ptr<td::mtproto::IStreamTransport> transport_;
+};
+
+// measures extraction of data from fake-TLS records, which are received from a TCP connection
+class TlsReaderByteFlowBench final : public td::Benchmark {
+ public:
+  explicit TlsReaderByteFlowBench(size_t record_size) : record_size_(record_size) {
+  }
+
+  td::string get_description() const final {
+    return PSTRING() << "TlsReaderByteFlow [record size = " << record_size_ << "]";
+  }
+
+  void start_up() final {
+    CHECK(record_size_ < (1 << 16));
+    record_ = "\x17\x03\x03";
+    record_ += static_cast<char>(record_size_ >> 8);
+    record_ += static_cast<char>(record_size_ & 255);
+    record_ += create_payload(record_size_);
+  }
+
+  void run(int n) final {
+    td::ChainBufferWriter input_writer;
+    auto input = input_writer.extract_reader();
+    td::ByteFlowSource source(&input);
+    td::mtproto::TlsReaderByteFlow tls_reader;
+    td::ByteFlowSink sink;
+    source >> tls_reader >> sink;
+
+    for (int i = 0; i < n; i++) {
+      input_writer.append(record_);
+      source.wakeup();
+      auto *output = sink.get_output();
+      output->advance(output->size());
+    }
+  }
+
+ private:
+  size_t record_size_;
+  td::string record_;
+};
+
+int main() {
+  SET_VERBOSITY_LEVEL(VERBOSITY_NAME(WARNING));
+  const size_t packet_sizes[] = {64, 1024, 16384, 131072};
+  for (auto packet_size : packet_sizes) {
+    td::bench(MtprotoWriteBench(packet_size));
+    td::bench(MtprotoReadBench(packet_size));
+  }
+
+  td::string secret(16, 'a');
+  for (auto packet_size : packet_sizes) {
+    td::bench(StreamTransportWriteBench("plain", td::mtproto::TransportType(), packet_size));
+    td::bench(StreamTransportWriteBench(
+        "obfuscated intermediate",
+        td::mtproto::TransportType{td::mtproto::TransportType::ObfuscatedTcp, 2,
+                                   td::mtproto::ProxySecret::from_raw(secret)},
+        packet_size));
+    td::bench(StreamTransportWriteBench(
+        "obfuscated padded",
+        td::mtproto::TransportType{td::mtproto::TransportType::ObfuscatedTcp, 2,
+                                   td::mtproto::ProxySecret::from_raw("\xdd" + secret)},
+        packet_size));
+    td::bench(StreamTransportWriteBench(
+        "fake-TLS",
+        td::mtproto::TransportType{td::mtproto::TransportType::ObfuscatedTcp, 2,
+                                   td::mtproto::ProxySecret::from_raw("\xee" + secret + "google.com")},
+        packet_size));
+  }
+
+  for (size_t record_size : {1024, 2878, 16384}) {
+    td::bench(TlsReaderByteFlowBench(record_size));
+  }
+}
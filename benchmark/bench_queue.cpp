@@ -7,15 +7,19 @@
 #include "td/utils/benchmark.h"
 #include "td/utils/common.h"
 #include "td/utils/logging.h"
+#include "td/utils/MpmcQueue.h"
+#include "td/utils/MpmcWaiter.h"
 #include "td/utils/MpscPollableQueue.h"
 #include "td/utils/port/sleep.h"
 #include "td/utils/port/thread.h"
 #include "td/utils/queue.h"
 #include "td/utils/Random.h"
+#include "td/utils/SliceBuilder.h"
 
 // TODO: check system calls
 // TODO: all return values must be checked
 
+#include <algorithm>
 #include <atomic>
 
 #if TD_PORT_POSIX
@@ -847,6 +851,150 @@ class RingBenchmark final : public td::Benchmark {
 };
 #endif
 
+#if !TD_THREAD_UNSUPPORTED
+// MPMC queues with a common batch interface; values are never 0, 0 is reserved for the stop sentinel
+template <class QueueT>
+class MpmcUnboundedQueueAdapter {
+ public:
+  explicit MpmcUnboundedQueueAdapter(size_t threads_n) : queue_(1024, threads_n) {
+  }
+
+  void push(qvalue_t *values, size_t count, size_t thread_id) {
+    for (size_t i = 0; i < count; i++) {
+      queue_.push(values[i], thread_id);
+    }
+  }
+
+  size_t try_pop(qvalue_t *values, size_t max_count, size_t thread_id) {
+    return queue_.try_pop(values[0], thread_id) ? 1 : 0;
+  }
+
+ private:
+  QueueT queue_;
+};
+
+template <size_t BatchSize>
+class MpmcBoundedQueueAdapter {
+ public:
+  explicit MpmcBoundedQueueAdapter(size_t threads_n) : queue_(4096) {
+  }
+
+  void push(qvalue_t *values, size_t count, size_t thread_id) {
+    while (count > 0) {
+      auto pushed = queue_.try_push_batch(values, std::min(count, BatchSize));
+      if (pushed == 0) {
+        td::this_thread::yield();
+      }
+      values += pushed;
+      count -= pushed;
+    }
+  }
+
+  size_t try_pop(qvalue_t *values, size_t max_count, size_t thread_id) {
+    return queue_.try_pop_batch(values, std::min(max_count, BatchSize));
+  }
+
+ private:
+  td::MpmcBoundedQueue<qvalue_t> queue_;
+};
+
+// producers_n producers hand off values to consumers_n consumers, which wait for them using WaiterT
+template <class QueueT, class WaiterT>
+class MpmcQueueBenchmark final : public td::Benchmark {
+  static constexpr size_t BATCH_SIZE = 16;
+
+  size_t producers_n_;
+  size_t consumers_n_;
+  td::string name_;
+  td::unique_ptr<QueueT> queue_;
+  td::unique_ptr<WaiterT> waiter_;
+  std::atomic<td::int64> popped_count_{0};
+
+ public:
+  MpmcQueueBenchmark(size_t threads_n, td::string name)
+      : producers_n_(threads_n), consumers_n_(threads_n), name_(std::move(name)) {
+  }
+
+  td::string get_description() const final {
+    return PSTRING() << name_ << '(' << producers_n_ << 'x' << consumers_n_ << ')';
+  }
+
+  void start_up() final {
+    queue_ = td::make_unique<QueueT>(producers_n_ + consumers_n_ + 1);
+    waiter_ = td::make_unique<WaiterT>();
+    popped_count_ = 0;
+  }
+
+  void tear_down() final {
+    waiter_->close();
+    waiter_ = nullptr;
+    queue_ = nullptr;
+  }
+
+  void run(int n) final {
+    auto per_producer = static_cast<size_t>(n) / producers_n_ + 1;
+    td::vector<td::thread> consumers;
+    for (size_t i = 0; i < consumers_n_; i++) {
+      consumers.emplace_back([&, thread_id = i] {
+        typename WaiterT::Slot slot;
+        WaiterT::init_slot(slot, static_cast<td::int32>(thread_id));
+        qvalue_t values[BATCH_SIZE];
+        td::int64 popped_count = 0;
+        while (true) {
+          auto count = queue_->try_pop(values, BATCH_SIZE, thread_id);
+          if (count == 0) {
+            waiter_->wait(slot);
+            continue;
+          }
+          waiter_->stop_wait(slot);
+          auto end = std::find(values, values + count, 0);
+          popped_count += end - values;
+          if (end != values + count) {
+            // return extra sentinels to the queue for other consumers
+            auto extra = static_cast<size_t>(values + count - end - 1);
+            if (extra != 0) {
+              queue_->push(end + 1, extra, thread_id);
+              waiter_->notify();
+            }
+            break;
+          }
+        }
+        popped_count_ += popped_count;
+      });
+    }
+
+    td::vector<td::thread> producers;
+    for (size_t i = 0; i < producers_n_; i++) {
+      producers.emplace_back([&, thread_id = consumers_n_ + i] {
+        qvalue_t values[BATCH_SIZE];
+        for (size_t pos = 0; pos < per_producer; pos += BATCH_SIZE) {
+          auto count = std::min(BATCH_SIZE, per_producer - pos);
+          for (size_t j = 0; j < count; j++) {
+            values[j] = static_cast<qvalue_t>(pos + j + 1);
+          }
+          queue_->push(values, count, thread_id);
+          waiter_->notify();
+        }
+      });
+    }
+    for (auto &producer : producers) {
+      producer.join();
+    }
+
+    auto thread_id = producers_n_ + consumers_n_;
+    for (size_t i = 0; i < consumers_n_; i++) {
+      qvalue_t sentinel = 0;
+      queue_->push(&sentinel, 1, thread_id);
+      waiter_->notify();
+    }
+    for (auto &consumer : consumers) {
+      consumer.join();
+    }
+    CHECK(popped_count_ == static_cast<td::int64>(per_producer * producers_n_));
+  }
+};
+#endif
+
 /*
 #if !TD_THREAD_UNSUPPORTED && !TD_EVENTFD_UNSUPPORTED
 static void test_queue() {
@@ -887,6 +1035,18 @@ int main() {
   // test_queue();
 #endif
 
+#if !TD_THREAD_UNSUPPORTED
+#define BENCH_MPMC(Q, W, N) td::bench(MpmcQueueBenchmark<Q, W>(N, #Q "+" #W))
+  for (size_t threads_n : {1, 2, 4, 8, 16, 32}) {
+    BENCH_MPMC(MpmcUnboundedQueueAdapter<td::MpmcQueue<qvalue_t>>, td::MpmcSleepyWaiter, threads_n);
+    BENCH_MPMC(MpmcUnboundedQueueAdapter<td::MpmcQueueOld<qvalue_t>>, td::MpmcSleepyWaiter, threads_n);
+    BENCH_MPMC(MpmcBoundedQueueAdapter<1>, td::MpmcSleepyWaiter, threads_n);
+    BENCH_MPMC(MpmcBoundedQueueAdapter<1>, td::MpmcFutexWaiter, threads_n);
+    BENCH_MPMC(MpmcBoundedQueueAdapter<16>, td::MpmcFutexWaiter, threads_n);
+    BENCH_MPMC(MpmcUnboundedQueueAdapter<td::MpmcQueue<qvalue_t>>, td::MpmcFutexWaiter, threads_n);
+  }
+#endif
+
 #if TD_PORT_POSIX
   // TODO: yield makes it extremely slow. Yet some backoff may be necessary.
   // td::bench(RingBenchmark<SemQueue>());
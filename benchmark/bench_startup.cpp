@@ -0,0 +1,187 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2022
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "td/telegram/Client.h"
+#include "td/telegram/td_api.h"
+
+#include "td/utils/common.h"
+#include "td/utils/logging.h"
+#include "td/utils/misc.h"
+#include "td/utils/OptionParser.h"
+#include "td/utils/Slice.h"
+#include "td/utils/Status.h"
+#include "td/utils/Time.h"
+
+#include <cstdlib>
+#include <utility>
+
+struct StartupParameters {
+  td::string database_directory;
+  td::int32 api_id = 0;
+  td::string api_hash;
+  td::string encryption_key;
+  bool disable_network = false;
+};
+
+static td::td_api::object_ptr<td::td_api::setTdlibParameters> get_set_tdlib_parameters(
+    const StartupParameters &parameters) {
+  auto tdlib_parameters = td::td_api::make_object<td::td_api::tdlibParameters>();
+  tdlib_parameters->database_directory_ = parameters.database_directory;
+  tdlib_parameters->use_file_database_ = true;
+  tdlib_parameters->use_chat_info_database_ = true;
+  tdlib_parameters->use_message_database_ = true;
+  tdlib_parameters->use_secret_chats_ = true;
+  tdlib_parameters->api_id_ = parameters.api_id;
+  tdlib_parameters->api_hash_ = parameters.api_hash;
+  tdlib_parameters->system_language_code_ = "en";
+  tdlib_parameters->device_model_ = "Desktop";
+  tdlib_parameters->application_version_ = "1.0";
+  return td::td_api::make_object<td::td_api::setTdlibParameters>(std::move(tdlib_parameters));
+}
+
+// opens the database, waits for authorizationStateReady and the first chat list and closes the client
+// returns an error if the database doesn't belong to an authorized user
+static td::Status run_startup(td::ClientManager &client_manager, const StartupParameters &parameters,
+                              td::Slice run_name) {
+  auto start_time = td::Time::now();
+  auto client_id = client_manager.create_client_id();
+  td::uint64 last_request_id = 0;
+  auto send_request = [&](td::td_api::object_ptr<td::td_api::Function> function) {
+    client_manager.send(client_id, ++last_request_id, std::move(function));
+    return last_request_id;
+  };
+
+  // the client is created only after the first request is sent
+  if (parameters.disable_network) {
+    send_request(td::td_api::make_object<td::td_api::setNetworkType>(
+        td::td_api::make_object<td::td_api::networkTypeNone>()));
+  } else {
+    send_request(td::td_api::make_object<td::td_api::getOption>("version"));
+  }
+
+  td::Status result;
+  double ready_time = 0.0;
+  double chats_time = 0.0;
+  td::uint64 get_chats_request_id = 0;
+  td::uint64 get_statistics_request_id = 0;
+  bool is_closed = false;
+  while (!is_closed) {
+    auto response = client_manager.receive(100.0);
+    if (response.object == nullptr) {
+      return td::Status::Error("Receive timeout expired");
+    }
+    if (response.client_id != client_id) {
+      continue;
+    }
+    if (response.request_id == 0) {
+      if (response.object->get_id() != td::td_api::updateAuthorizationState::ID) {
+        continue;
+      }
+      auto &authorization_state =
+          static_cast<const td::td_api::updateAuthorizationState &>(*response.object).authorization_state_;
+      switch (authorization_state->get_id()) {
+        case td::td_api::authorizationStateWaitTdlibParameters::ID:
+          send_request(get_set_tdlib_parameters(parameters));
+          break;
+        case td::td_api::authorizationStateWaitEncryptionKey::ID:
+          send_request(td::td_api::make_object<td::td_api::checkDatabaseEncryptionKey>(parameters.encryption_key));
+          break;
+        case td::td_api::authorizationStateReady::ID:
+          ready_time = td::Time::now();
+          get_chats_request_id = send_request(td::td_api::make_object<td::td_api::getChats>(
+              td::td_api::make_object<td::td_api::chatListMain>(), 100));
+          break;
+        case td::td_api::authorizationStateLoggingOut::ID:
+        case td::td_api::authorizationStateClosing::ID:
+          break;
+        case td::td_api::authorizationStateClosed::ID:
+          is_closed = true;
+          break;
+        default:
+          result = td::Status::Error("The database doesn't belong to an authorized user");
+          send_request(td::td_api::make_object<td::td_api::close>());
+          break;
+      }
+      continue;
+    }
+
+    if (response.object->get_id() == td::td_api::error::ID) {
+      LOG(ERROR) << "Receive error for request " << response.request_id << ": " << to_string(response.object);
+    }
+    if (response.request_id == get_chats_request_id) {
+      chats_time = td::Time::now();
+      get_statistics_request_id = send_request(td::td_api::make_object<td::td_api::getStartupStatistics>());
+    } else if (response.request_id == get_statistics_request_id) {
+      if (response.object->get_id() == td::td_api::text::ID) {
+        LOG(WARNING) << run_name << " start " << static_cast<const td::td_api::text &>(*response.object).text_;
+      }
+      send_request(td::td_api::make_object<td::td_api::close>());
+    }
+  }
+  TRY_STATUS(std::move(result));
+
+  LOG(WARNING) << run_name << " start: authorizationStateReady after " << ready_time - start_time
+               << " seconds, the first chat list after " << chats_time - start_time << " seconds, closed after "
+               << td::Time::now() - start_time << " seconds";
+  return td::Status::OK();
+}
+
+int main(int argc, char **argv) {
+  SET_VERBOSITY_LEVEL(VERBOSITY_NAME(WARNING));
+
+  StartupParameters parameters;
+  parameters.api_id = [](auto x) -> td::int32 {
+    if (x) {
+      return td::to_integer<td::int32>(td::Slice(x));
+    }
+    return 0;
+  }(std::getenv("TD_API_ID"));
+  parameters.api_hash = [](auto x) -> td::string {
+    if (x) {
+      return x;
+    }
+    return td::string();
+  }(std::getenv("TD_API_HASH"));
+  int run_count = 3;
+
+  td::OptionParser options;
+  options.set_description(
+      "Measures TDLib cold and warm start time with the specified database directory of an authorized user. "
+      "The first run is a cold start of TDLib in the process; drop OS file caches before running the benchmark to "
+      "measure a cold start from disk. The database is modified, so a copy of a prepared database should be used.");
+  options.add_checked_option('\0', "api-id", "Set Telegram API ID", td::OptionParser::parse_integer(parameters.api_id));
+  options.add_option('\0', "api-hash", "Set Telegram API hash", td::OptionParser::parse_string(parameters.api_hash));
+  options.add_option('k', "key", "Set database encryption key",
+                     td::OptionParser::parse_string(parameters.encryption_key));
+  options.add_checked_option('r', "runs", "Set number of runs; default is 3",
+                             td::OptionParser::parse_integer(run_count));
+  options.add_option('n', "disable-network", "Disable network", [&] { parameters.disable_network = true; });
+  options.add_check([&] {
+    if (parameters.api_id == 0 || parameters.api_hash.empty()) {
+      return td::Status::Error("You must provide valid api-id and api-hash obtained at https://my.telegram.org");
+    }
+    if (run_count <= 0) {
+      return td::Status::Error("Number of runs must be positive");
+    }
+    return td::Status::OK();
+  });
+  auto r_non_options = options.run(argc, argv, 1);
+  if (r_non_options.is_error()) {
+    LOG(PLAIN) << argv[0] << ": " << r_non_options.error().message();
+    LOG(PLAIN) << options;
+    return 1;
+  }
+  parameters.database_directory = r_non_options.ok()[0];
+
+  td::ClientManager client_manager;
+  for (int i = 0; i < run_count; i++) {
+    auto status = run_startup(client_manager, parameters, i == 0 ? td::Slice("Cold") : td::Slice("Warm"));
+    if (status.is_error()) {
+      LOG(ERROR) << status;
+      return 1;
+    }
+  }
+}
@@ -6,6 +6,7 @@
 //
 #include "td/telegram/DialogId.h"
 #include "td/telegram/MessageId.h"
+#include "td/telegram/MessageSearchFilter.h"
 #include "td/telegram/MessagesDb.h"
 #include "td/telegram/NotificationId.h"
 #include "td/telegram/ServerMessageId.h"
@@ -22,9 +23,13 @@
 #include "td/utils/buffer.h"
 #include "td/utils/common.h"
 #include "td/utils/logging.h"
+#include "td/utils/misc.h"
 #include "td/utils/Random.h"
 #include "td/utils/Status.h"
+#include "td/utils/Time.h"
 
+#include <algorithm>
+#include <cstring>
 #include <memory>
 
 static td::Status init_db(td::SqliteDb &db) {
@@ -108,7 +113,286 @@ class MessagesDbBench final : public td::Benchmark {
   }
 };
 
-int main() {
+// replays a mix of typical MessagesDb requests over a prefilled database and reports latencies of each request type
+class MessagesDbWorkload {
+ public:
+  MessagesDbWorkload(bool is_encrypted, int message_count) : is_encrypted_(is_encrypted), message_count_(message_count) {
+  }
+
+  void run(int operation_count) {
+    scheduler_ = td::make_unique<td::ConcurrentScheduler>();
+    scheduler_->init(1);
+    {
+      auto guard = scheduler_->get_main_guard();
+      init().ensure();
+      fill().ensure();
+      for (int i = 0; i < operation_count; i++) {
+        run_operation().ensure();
+      }
+      report();
+
+      messages_db_sync_safe_.reset();
+      sql_connection_->close_and_destroy();
+      sql_connection_.reset();
+    }
+    scheduler_->finish();
+    scheduler_.reset();
+  }
+
+ private:
+  static constexpr int DIALOG_COUNT = 100;
+  static constexpr int SENDER_COUNT = 1000;
+  static constexpr int MESSAGE_DATE_STEP = 600;
+  static constexpr int MAX_EXPIRATION_TIME = 1000000;
+
+  enum Operation : size_t {
+    History,
+    Search,
+    Calendar,
+    SparsePositions,
+    DeleteBySender,
+    Expiring,
+    Insert,
+    OperationCount
+  };
+
+  bool is_encrypted_;
+  int message_count_;
+  td::unique_ptr<td::ConcurrentScheduler> scheduler_;
+  std::shared_ptr<td::SqliteConnectionSafe> sql_connection_;
+  std::shared_ptr<td::MessagesDbSyncSafeInterface> messages_db_sync_safe_;
+  td::vector<td::int32> last_server_message_ids_ = td::vector<td::int32>(DIALOG_COUNT, 0);
+  td::int32 last_unique_message_id_ = 0;
+  td::vector<td::vector<double>> latencies_ = td::vector<td::vector<double>>(OperationCount);
+
+  static td::Slice get_operation_name(size_t operation) {
+    switch (operation) {
+      case History:
+        return td::Slice("history");
+      case Search:
+        return td::Slice("search");
+      case Calendar:
+        return td::Slice("calendar");
+      case SparsePositions:
+        return td::Slice("sparse_positions");
+      case DeleteBySender:
+        return td::Slice("delete_by_sender");
+      case Expiring:
+        return td::Slice("expiring");
+      case Insert:
+        return td::Slice("insert");
+      default:
+        UNREACHABLE();
+        return td::Slice();
+    }
+  }
+
+  static td::Slice get_random_word() {
+    static const td::Slice words[] = {"hello", "world", "meeting", "today", "tomorrow", "photo", "video", "link",
+                                      "thanks", "please", "where", "when", "home", "work", "coffee", "weekend",
+                                      "project", "release", "bug", "review", "call", "later", "great", "sorry"};
+    return words[td::Random::fast(0, static_cast<int>(sizeof(words) / sizeof(words[0])) - 1)];
+  }
+
+  static td::DialogId get_dialog_id(int dialog_index) {
+    return td::DialogId(td::UserId(static_cast<td::int64>(dialog_index + 1)));
+  }
+
+  static td::DialogId get_random_sender_dialog_id() {
+    return td::DialogId(td::UserId(static_cast<td::int64>(td::Random::fast(1, SENDER_COUNT))));
+  }
+
+  // serializes the beginning of a message the same way as MessagesManager does to allow the database to find its date
+  static td::BufferSlice create_message_data(td::MessageId message_id, td::int32 date) {
+    td::BufferSlice data(static_cast<size_t>(td::Random::fast(100, 299)));
+    td::int32 flags = 0;
+    auto message_id_raw = message_id.get();
+    auto ptr = data.as_slice().begin();
+    std::memcpy(ptr, &flags, sizeof(flags));
+    std::memcpy(ptr + sizeof(flags), &message_id_raw, sizeof(message_id_raw));
+    std::memcpy(ptr + sizeof(flags) + sizeof(message_id_raw), &date, sizeof(date));
+    return data;
+  }
+
+  td::Status init() {
+    td::string sql_db_name = is_encrypted_ ? "workload_encrypted.sqlite" : "workload.sqlite";
+    td::SqliteDb::destroy(sql_db_name).ignore();
+    sql_connection_ = std::make_shared<td::SqliteConnectionSafe>(
+        sql_db_name, is_encrypted_ ? td::DbKey::password("password") : td::DbKey::empty());
+    auto &db = sql_connection_->get();
+    TRY_STATUS(init_db(db));
+
+    TRY_STATUS(db.exec("BEGIN TRANSACTION"));
+    TRY_STATUS(init_messages_db(db, 0));
+    TRY_STATUS(db.exec("COMMIT TRANSACTION"));
+
+    messages_db_sync_safe_ = td::create_messages_db_sync(sql_connection_);
+    return td::Status::OK();
+  }
+
+  td::Status add_message(int dialog_index) {
+    auto server_message_id = ++last_server_message_ids_[dialog_index];
+    auto message_id = td::MessageId(td::ServerMessageId(server_message_id));
+    auto date = server_message_id * MESSAGE_DATE_STEP;
+    auto unique_message_id = td::ServerMessageId(++last_unique_message_id_);
+    auto ttl_expires_at = td::Random::fast(0, 9) == 0 ? td::Random::fast(1, MAX_EXPIRATION_TIME) : 0;
+    auto index_mask =
+        td::Random::fast(0, 4) == 0 ? td::message_search_filter_index_mask(td::MessageSearchFilter::Photo) : 0;
+    td::string text;
+    td::int64 search_id = 0;
+    if (td::Random::fast(0, 1) == 0) {
+      auto word_count = td::Random::fast(3, 15);
+      for (int i = 0; i < word_count; i++) {
+        if (i != 0) {
+          text += ' ';
+        }
+        text += get_random_word().str();
+      }
+      search_id = last_unique_message_id_;
+    }
+    return messages_db_sync_safe_->get().add_message(
+        {get_dialog_id(dialog_index), message_id}, unique_message_id, get_random_sender_dialog_id(), 0, ttl_expires_at,
+        index_mask, search_id, std::move(text), td::NotificationId(), td::MessageId(),
+        create_message_data(message_id, date));
+  }
+
+  td::Status fill() {
+    constexpr int MESSAGES_PER_TRANSACTION = 1000;
+    auto &messages_db = messages_db_sync_safe_->get();
+    auto start_time = td::Time::now();
+    for (int i = 0; i < message_count_; i += MESSAGES_PER_TRANSACTION) {
+      TRY_STATUS(messages_db.begin_write_transaction());
+      for (int j = i; j < message_count_ && j < i + MESSAGES_PER_TRANSACTION; j++) {
+        TRY_STATUS(add_message(td::Random::fast(0, DIALOG_COUNT - 1)));
+      }
+      TRY_STATUS(messages_db.commit_transaction());
+    }
+    LOG(WARNING) << "Added " << message_count_ << " messages in " << td::Time::now() - start_time << " seconds";
+    return td::Status::OK();
+  }
+
+  td::MessageId get_random_message_id(int dialog_index) const {
+    auto last_server_message_id = td::max(last_server_message_ids_[dialog_index], 1);
+    return td::MessageId(td::ServerMessageId(td::Random::fast(1, last_server_message_id)));
+  }
+
+  td::Status run_operation() {
+    auto &messages_db = messages_db_sync_safe_->get();
+    auto dialog_index = td::Random::fast(0, DIALOG_COUNT - 1);
+    auto dialog_id = get_dialog_id(dialog_index);
+
+    // the mix of requests roughly follows their frequency in applications
+    auto choice = td::Random::fast(0, 99);
+    Operation operation;
+    if (choice < 40) {
+      operation = History;
+    } else if (choice < 50) {
+      operation = Search;
+    } else if (choice < 55) {
+      operation = Calendar;
+    } else if (choice < 60) {
+      operation = SparsePositions;
+    } else if (choice < 62) {
+      operation = DeleteBySender;
+    } else if (choice < 70) {
+      operation = Expiring;
+    } else {
+      operation = Insert;
+    }
+
+    auto start_time = td::Time::now();
+    switch (operation) {
+      case History: {
+        td::MessagesDbMessagesQuery query;
+        query.dialog_id = dialog_id;
+        query.from_message_id = get_random_message_id(dialog_index);
+        query.offset = td::Random::fast(0, 1) == 0 ? 0 : -10;
+        query.limit = 50;
+        TRY_STATUS(messages_db.get_messages(std::move(query)));
+        break;
+      }
+      case Search: {
+        td::MessagesDbFtsQuery query;
+        query.query = get_random_word().str();
+        if (td::Random::fast(0, 1) == 0) {
+          query.dialog_id = dialog_id;
+        }
+        query.limit = 100;
+        TRY_STATUS(messages_db.get_messages_fts(std::move(query)));
+        break;
+      }
+      case Calendar: {
+        td::MessagesDbDialogCalendarQuery query;
+        query.dialog_id = dialog_id;
+        query.filter = td::MessageSearchFilter::Photo;
+        query.from_message_id = td::MessageId::max();
+        TRY_STATUS(messages_db.get_dialog_message_calendar(std::move(query)));
+        break;
+      }
+      case SparsePositions: {
+        td::MessagesDbGetDialogSparseMessagePositionsQuery query;
+        query.dialog_id = dialog_id;
+        query.filter = td::MessageSearchFilter::Photo;
+        query.from_message_id = td::MessageId::max();
+        query.limit = 100;
+        TRY_STATUS(messages_db.get_dialog_sparse_message_positions(std::move(query)));
+        break;
+      }
+      case DeleteBySender:
+        TRY_STATUS(messages_db.begin_write_transaction());
+        TRY_STATUS(messages_db.delete_dialog_messages_by_sender(dialog_id, get_random_sender_dialog_id()));
+        TRY_STATUS(messages_db.commit_transaction());
+        break;
+      case Expiring: {
+        auto expires_from = td::Random::fast(0, MAX_EXPIRATION_TIME);
+        TRY_STATUS(messages_db.get_expiring_messages(expires_from, expires_from + 1000, 100));
+        break;
+      }
+      case Insert: {
+        // messages often arrive in bursts, which are written in a single transaction
+        auto burst_size = td::Random::fast(0, 9) == 0 ? td::Random::fast(10, 100) : 1;
+        TRY_STATUS(messages_db.begin_write_transaction());
+        for (int i = 0; i < burst_size; i++) {
+          TRY_STATUS(add_message(dialog_index));
+        }
+        TRY_STATUS(messages_db.commit_transaction());
+        break;
+      }
+      default:
+        UNREACHABLE();
+    }
+    latencies_[operation].push_back(td::Time::now() - start_time);
+    return td::Status::OK();
+  }
+
+  static double get_quantile(const td::vector<double> &sorted_values, double quantile) {
+    auto pos = static_cast<size_t>(static_cast<double>(sorted_values.size() - 1) * quantile);
+    return sorted_values[pos] * 1e6;
+  }
+
+  void report() {
+    LOG(WARNING) << "MessagesDb workload" << (is_encrypted_ ? " with encryption" : "") << " over " << message_count_
+                 << " messages, latencies in microseconds:";
+    for (size_t operation = 0; operation < OperationCount; operation++) {
+      auto &values = latencies_[operation];
+      if (values.empty()) {
+        continue;
+      }
+      std::sort(values.begin(), values.end());
+      LOG(WARNING) << td::rpad(get_operation_name(operation).str(), 16, ' ') << " count " << values.size() << " p50 "
+                   << get_quantile(values, 0.5) << " p90 " << get_quantile(values, 0.9) << " p99 "
+                   << get_quantile(values, 0.99) << " max " << get_quantile(values, 1.0);
+    }
+  }
+};
+
+int main(int argc, char *argv[]) {
   SET_VERBOSITY_LEVEL(VERBOSITY_NAME(WARNING));
   td::bench(MessagesDbBench());
+
+  int message_count = argc > 1 ? td::to_integer<int>(td::Slice(argv[1])) : 100000;
+  int operation_count = argc > 2 ? td::to_integer<int>(td::Slice(argv[2])) : 10000;
+  for (auto is_encrypted : {false, true}) {
+    MessagesDbWorkload(is_encrypted, message_count).run(operation_count);
+  }
 }
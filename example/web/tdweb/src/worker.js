@@ -643,6 +643,9 @@ class TdClient {
     };
     //this.onFS(this.TdModule.FS);
     this.FS = this.TdModule.FS;
+    this.TdModule['onMainThreadEvent'] = () => {
+      this.scheduleReceiveSoon();
+    };
     this.TdModule['websocket']['on']('error', error => {
       this.scheduleReceiveSoon();
     });
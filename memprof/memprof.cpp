@@ -129,6 +129,32 @@ struct malloc_info {
   std::int32_t ht_pos;
 };
 
+static constexpr std::int32_t NOT_SAMPLED_HT_POS = -1;
+
+static std::atomic<std::size_t> sample_rate{1};
+
+void set_memprof_sample_rate(std::size_t new_sample_rate) {
+  sample_rate.store(new_sample_rate, std::memory_order_relaxed);
+}
+
+std::size_t get_memprof_sample_rate() {
+  return sample_rate.load(std::memory_order_relaxed);
+}
+
+static bool need_sample(std::size_t size) {
+  static __thread std::size_t bytes_until_sample;  // static zero-initialized
+  auto rate = sample_rate.load(std::memory_order_relaxed);
+  if (rate == 0) {
+    return false;
+  }
+  if (rate > 1 && bytes_until_sample > size) {
+    bytes_until_sample -= size;
+    return false;
+  }
+  bytes_until_sample = rate;
+  return true;
+}
+
 static std::uint64_t get_hash(const Backtrace &bt) {
   std::uint64_t h = 7;
   for (std::size_t i = 0; i < bt.size() && i < BACKTRACE_HASHED_LENGTH; i++) {
@@ -141,6 +167,7 @@ struct HashtableNode {
   std::atomic<std::uint64_t> hash;
   Backtrace backtrace;
   std::atomic<std::size_t> size;
+  std::atomic<std::size_t> count;
 };
 
 static constexpr std::size_t HT_MAX_SIZE = 1000000;
@@ -196,23 +223,29 @@ void dump_alloc(const std::function<void(const AllocInfo &)> &func) {
     if (size == 0) {
       continue;
     }
-    func(AllocInfo{node.backtrace, size});
+    func(AllocInfo{node.backtrace, size, node.count.load(std::memory_order_relaxed)});
   }
 }
 
 void register_xalloc(malloc_info *info, std::int32_t diff) {
   my_assert(info->size >= 0);
+  if (info->ht_pos == NOT_SAMPLED_HT_POS) {
+    return;
+  }
+  auto &node = ht[info->ht_pos];
   if (diff > 0) {
-    ht[info->ht_pos].size.fetch_add(info->size, std::memory_order_relaxed);
+    node.size.fetch_add(info->size, std::memory_order_relaxed);
+    node.count.fetch_add(1, std::memory_order_relaxed);
   } else {
-    auto old_value = ht[info->ht_pos].size.fetch_sub(info->size, std::memory_order_relaxed);
+    auto old_value = node.size.fetch_sub(info->size, std::memory_order_relaxed);
     my_assert(old_value >= static_cast<std::size_t>(info->size));
+    node.count.fetch_sub(1, std::memory_order_relaxed);
   }
 }
 
 extern "C" {
 
-static void *malloc_with_frame(std::size_t size, const Backtrace &frame) {
+static void *malloc_with_frame(std::size_t size, const Backtrace *frame) {
   static_assert(RESERVED_SIZE % alignof(std::max_align_t) == 0, "fail");
   static_assert(RESERVED_SIZE >= sizeof(malloc_info), "fail");
 #if TD_DARWIN
@@ -227,7 +260,7 @@ static void *malloc_with_frame(std::size_t size, const Backtrace &frame) {
 
   info->magic = MALLOC_INFO_MAGIC;
   info->size = static_cast<std::int32_t>(size);
-  info->ht_pos = get_ht_pos(frame);
+  info->ht_pos = frame == nullptr ? NOT_SAMPLED_HT_POS : get_ht_pos(*frame);
 
   register_xalloc(info, +1);
 
@@ -245,8 +278,17 @@ static malloc_info *get_info(void *data_void) {
   return info;
 }
 
+// must be inlined to keep the number of stack frames skipped by get_backtrace
+static inline __attribute__((always_inline)) void *malloc_with_sampled_frame(std::size_t size) {
+  if (!need_sample(size)) {
+    return malloc_with_frame(size, nullptr);
+  }
+  auto frame = get_backtrace();
+  return malloc_with_frame(size, &frame);
+}
+
 void *malloc(std::size_t size) {
-  return malloc_with_frame(size, get_backtrace());
+  return malloc_with_sampled_frame(size);
 }
 
 void free(void *data_void) {
@@ -267,16 +309,16 @@ void free(void *data_void) {
 }
 void *calloc(std::size_t size_a, std::size_t size_b) {
   auto size = size_a * size_b;
-  void *res = malloc_with_frame(size, get_backtrace());
+  void *res = malloc_with_sampled_frame(size);
   std::memset(res, 0, size);
   return res;
 }
 void *realloc(void *ptr, std::size_t size) {
   if (ptr == nullptr) {
-    return malloc_with_frame(size, get_backtrace());
+    return malloc_with_sampled_frame(size);
   }
   auto *info = get_info(ptr);
-  auto *new_ptr = malloc_with_frame(size, get_backtrace());
+  auto *new_ptr = malloc_with_sampled_frame(size);
   auto to_copy = std::min(static_cast<std::int32_t>(size), info->size);
   std::memcpy(new_ptr, ptr, to_copy);
   free(ptr);
@@ -290,7 +332,7 @@ void *memalign(std::size_t aligment, std::size_t size) {
 
 // c++14 guarantees that it is enough to override these two operators.
 void *operator new(std::size_t count) {
-  return malloc_with_frame(count, get_backtrace());
+  return malloc_with_sampled_frame(count);
 }
 void operator delete(void *ptr) noexcept(true) {
   free(ptr);
@@ -316,6 +358,11 @@ double get_fast_backtrace_success_rate() {
 std::size_t get_ht_size() {
   return 0;
 }
+void set_memprof_sample_rate(std::size_t sample_rate) {
+}
+std::size_t get_memprof_sample_rate() {
+  return 0;
+}
 #endif
 
 std::size_t get_used_memory_size() {
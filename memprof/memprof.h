@@ -18,6 +18,7 @@ using Backtrace = std::array<void *, BACKTRACE_LENGTH>;
 struct AllocInfo {
   Backtrace backtrace;
   std::size_t size;
+  std::size_t count;
 };
 
 bool is_memprof_on();
@@ -25,3 +26,8 @@ std::size_t get_ht_size();
 double get_fast_backtrace_success_rate();
 void dump_alloc(const std::function<void(const AllocInfo &)> &func);
 std::size_t get_used_memory_size();
+
+// only allocations, which are sampled, are tracked; approximately one allocation is sampled per sample_rate bytes
+// 1 means that all allocations are tracked, 0 means that new allocations aren't tracked at all
+void set_memprof_sample_rate(std::size_t sample_rate);
+std::size_t get_memprof_sample_rate();
@@ -0,0 +1,965 @@
+#pragma once
+
+/**
+ * \file
+ * Contains downcast_call methods for calling a function object on downcasted to
+ * the most derived class TDLib API object.
+ */
+#include "secret_api.h"
+
+namespace td {
+namespace secret_api {
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(Object &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch ((static_cast<std::uint32_t>(constructor) * 3054660601u) >> 24) {
+    case 11:
+      if (constructor == decryptedMessageMediaVideo8::ID) {
+        func(static_cast<decryptedMessageMediaVideo8 &>(obj));
+        return true;
+      }
+      break;
+    case 20:
+      if (constructor == decryptedMessage46::ID) {
+        func(static_cast<decryptedMessage46 &>(obj));
+        return true;
+      }
+      break;
+    case 22:
+      if (constructor == decryptedMessageService::ID) {
+        func(static_cast<decryptedMessageService &>(obj));
+        return true;
+      }
+      break;
+    case 23:
+      if (constructor == decryptedMessageMediaEmpty::ID) {
+        func(static_cast<decryptedMessageMediaEmpty &>(obj));
+        return true;
+      }
+      break;
+    case 24:
+      if (constructor == decryptedMessageLayer::ID) {
+        func(static_cast<decryptedMessageLayer &>(obj));
+        return true;
+      }
+      break;
+    case 31:
+      if (constructor == decryptedMessageActionSetMessageTTL::ID) {
+        func(static_cast<decryptedMessageActionSetMessageTTL &>(obj));
+        return true;
+      }
+      break;
+    case 33:
+      if (constructor == sendMessageUploadAudioAction::ID) {
+        func(static_cast<sendMessageUploadAudioAction &>(obj));
+        return true;
+      }
+      break;
+    case 36:
+      if (constructor == messageEntityPre::ID) {
+        func(static_cast<messageEntityPre &>(obj));
+        return true;
+      }
+      break;
+    case 38:
+      if (constructor == decryptedMessageActionAbortKey::ID) {
+        func(static_cast<decryptedMessageActionAbortKey &>(obj));
+        return true;
+      }
+      break;
+    case 42:
+      if (constructor == decryptedMessageMediaPhoto23::ID) {
+        func(static_cast<decryptedMessageMediaPhoto23 &>(obj));
+        return true;
+      }
+      break;
+    case 43:
+      if (constructor == documentAttributeAudio::ID) {
+        func(static_cast<documentAttributeAudio &>(obj));
+        return true;
+      }
+      break;
+    case 49:
+      if (constructor == decryptedMessageMediaDocument23::ID) {
+        func(static_cast<decryptedMessageMediaDocument23 &>(obj));
+        return true;
+      }
+      break;
+    case 50:
+      if (constructor == sendMessageRecordRoundAction::ID) {
+        func(static_cast<sendMessageRecordRoundAction &>(obj));
+        return true;
+      }
+      break;
+    case 53:
+      if (constructor == messageEntityUrl::ID) {
+        func(static_cast<messageEntityUrl &>(obj));
+        return true;
+      }
+      break;
+    case 55:
+      if (constructor == decryptedMessageActionTyping::ID) {
+        func(static_cast<decryptedMessageActionTyping &>(obj));
+        return true;
+      }
+      break;
+    case 56:
+      if (constructor == decryptedMessageService8::ID) {
+        func(static_cast<decryptedMessageService8 &>(obj));
+        return true;
+      }
+      break;
+    case 60:
+      if (constructor == sendMessageUploadDocumentAction::ID) {
+        func(static_cast<sendMessageUploadDocumentAction &>(obj));
+        return true;
+      }
+      break;
+    case 65:
+      if (constructor == photoSizeEmpty::ID) {
+        func(static_cast<photoSizeEmpty &>(obj));
+        return true;
+      }
+      break;
+    case 69:
+      if (constructor == documentAttributeAnimated::ID) {
+        func(static_cast<documentAttributeAnimated &>(obj));
+        return true;
+      }
+      break;
+    case 70:
+      if (constructor == fileLocation::ID) {
+        func(static_cast<fileLocation &>(obj));
+        return true;
+      }
+      break;
+    case 71:
+      if (constructor == decryptedMessageActionResend::ID) {
+        func(static_cast<decryptedMessageActionResend &>(obj));
+        return true;
+      }
+      break;
+    case 72:
+      if (constructor == decryptedMessageMediaVenue::ID) {
+        func(static_cast<decryptedMessageMediaVenue &>(obj));
+        return true;
+      }
+      break;
+    case 75:
+      if (constructor == decryptedMessage8::ID) {
+        func(static_cast<decryptedMessage8 &>(obj));
+        return true;
+      }
+      break;
+    case 79:
+      if (constructor == messageEntityBotCommand::ID) {
+        func(static_cast<messageEntityBotCommand &>(obj));
+        return true;
+      }
+      break;
+    case 80:
+      if (constructor == decryptedMessageActionRequestKey::ID) {
+        func(static_cast<decryptedMessageActionRequestKey &>(obj));
+        return true;
+      }
+      break;
+    case 85:
+      if (constructor == inputStickerSetShortName::ID) {
+        func(static_cast<inputStickerSetShortName &>(obj));
+        return true;
+      }
+      break;
+    case 88:
+      if (constructor == decryptedMessageMediaPhoto::ID) {
+        func(static_cast<decryptedMessageMediaPhoto &>(obj));
+        return true;
+      }
+      break;
+    case 89:
+      if (constructor == documentAttributeAudio23::ID) {
+        func(static_cast<documentAttributeAudio23 &>(obj));
+        return true;
+      }
+      break;
+    case 90:
+      if (constructor == documentAttributeSticker23::ID) {
+        func(static_cast<documentAttributeSticker23 &>(obj));
+        return true;
+      }
+      break;
+    case 94:
+      if (constructor == sendMessageCancelAction::ID) {
+        func(static_cast<sendMessageCancelAction &>(obj));
+        return true;
+      }
+      break;
+    case 95:
+      if (constructor == documentAttributeVideo::ID) {
+        func(static_cast<documentAttributeVideo &>(obj));
+        return true;
+      }
+      break;
+    case 102:
+      if (constructor == decryptedMessageActionScreenshotMessages::ID) {
+        func(static_cast<decryptedMessageActionScreenshotMessages &>(obj));
+        return true;
+      }
+      break;
+    case 117:
+      if (constructor == decryptedMessageMediaDocument::ID) {
+        func(static_cast<decryptedMessageMediaDocument &>(obj));
+        return true;
+      }
+      break;
+    case 124:
+      if (constructor == decryptedMessageMediaAudio8::ID) {
+        func(static_cast<decryptedMessageMediaAudio8 &>(obj));
+        return true;
+      }
+      break;
+    case 125:
+      if (constructor == messageEntityBold::ID) {
+        func(static_cast<messageEntityBold &>(obj));
+        return true;
+      }
+      break;
+    case 131:
+      if (constructor == messageEntityHashtag::ID) {
+        func(static_cast<messageEntityHashtag &>(obj));
+        return true;
+      }
+      break;
+    case 138:
+      if (constructor == documentAttributeAudio45::ID) {
+        func(static_cast<documentAttributeAudio45 &>(obj));
+        return true;
+      }
+      if (constructor == messageEntityItalic::ID) {
+        func(static_cast<messageEntityItalic &>(obj));
+        return true;
+      }
+      break;
+    case 139:
+      if (constructor == decryptedMessageActionNoop::ID) {
+        func(static_cast<decryptedMessageActionNoop &>(obj));
+        return true;
+      }
+      break;
+    case 143:
+      if (constructor == messageEntityUnderline::ID) {
+        func(static_cast<messageEntityUnderline &>(obj));
+        return true;
+      }
+      break;
+    case 144:
+      if (constructor == documentAttributeImageSize::ID) {
+        func(static_cast<documentAttributeImageSize &>(obj));
+        return true;
+      }
+      break;
+    case 145:
+      if (constructor == decryptedMessageActionFlushHistory::ID) {
+        func(static_cast<decryptedMessageActionFlushHistory &>(obj));
+        return true;
+      }
+      break;
+    case 150:
+      if (constructor == documentAttributeVideo66::ID) {
+        func(static_cast<documentAttributeVideo66 &>(obj));
+        return true;
+      }
+      break;
+    case 151:
+      if (constructor == messageEntityBankCard::ID) {
+        func(static_cast<messageEntityBankCard &>(obj));
+        return true;
+      }
+      break;
+    case 154:
+      if (constructor == photoSize::ID) {
+        func(static_cast<photoSize &>(obj));
+        return true;
+      }
+      break;
+    case 156:
+      if (constructor == photoCachedSize::ID) {
+        func(static_cast<photoCachedSize &>(obj));
+        return true;
+      }
+      break;
+    case 157:
+      if (constructor == decryptedMessage::ID) {
+        func(static_cast<decryptedMessage &>(obj));
+        return true;
+      }
+      break;
+    case 161:
+      if (constructor == fileLocationUnavailable::ID) {
+        func(static_cast<fileLocationUnavailable &>(obj));
+        return true;
+      }
+      break;
+    case 162:
+      if (constructor == decryptedMessageMediaAudio::ID) {
+        func(static_cast<decryptedMessageMediaAudio &>(obj));
+        return true;
+      }
+      break;
+    case 167:
+      if (constructor == messageEntityMentionName::ID) {
+        func(static_cast<messageEntityMentionName &>(obj));
+        return true;
+      }
+      break;
+    case 170:
+      if (constructor == messageEntityStrike::ID) {
+        func(static_cast<messageEntityStrike &>(obj));
+        return true;
+      }
+      break;
+    case 177:
+      if (constructor == decryptedMessageMediaWebPage::ID) {
+        func(static_cast<decryptedMessageMediaWebPage &>(obj));
+        return true;
+      }
+      break;
+    case 178:
+      if (constructor == sendMessageGeoLocationAction::ID) {
+        func(static_cast<sendMessageGeoLocationAction &>(obj));
+        return true;
+      }
+      break;
+    case 181:
+      if (constructor == messageEntityTextUrl::ID) {
+        func(static_cast<messageEntityTextUrl &>(obj));
+        return true;
+      }
+      break;
+    case 185:
+      if (constructor == messageEntityPhone::ID) {
+        func(static_cast<messageEntityPhone &>(obj));
+        return true;
+      }
+      break;
+    case 186:
+      if (constructor == decryptedMessageActionReadMessages::ID) {
+        func(static_cast<decryptedMessageActionReadMessages &>(obj));
+        return true;
+      }
+      break;
+    case 191:
+      if (constructor == sendMessageUploadVideoAction::ID) {
+        func(static_cast<sendMessageUploadVideoAction &>(obj));
+        return true;
+      }
+      break;
+    case 197:
+      if (constructor == messageEntityMention::ID) {
+        func(static_cast<messageEntityMention &>(obj));
+        return true;
+      }
+      break;
+    case 199:
+      if (constructor == sendMessageTypingAction::ID) {
+        func(static_cast<sendMessageTypingAction &>(obj));
+        return true;
+      }
+      break;
+    case 202:
+      if (constructor == decryptedMessageMediaVideo23::ID) {
+        func(static_cast<decryptedMessageMediaVideo23 &>(obj));
+        return true;
+      }
+      break;
+    case 203:
+      if (constructor == sendMessageUploadRoundAction::ID) {
+        func(static_cast<sendMessageUploadRoundAction &>(obj));
+        return true;
+      }
+      break;
+    case 207:
+      if (constructor == documentAttributeSticker::ID) {
+        func(static_cast<documentAttributeSticker &>(obj));
+        return true;
+      }
+      break;
+    case 208:
+      if (constructor == decryptedMessageActionDeleteMessages::ID) {
+        func(static_cast<decryptedMessageActionDeleteMessages &>(obj));
+        return true;
+      }
+      break;
+    case 210:
+      if (constructor == messageEntityUnknown::ID) {
+        func(static_cast<messageEntityUnknown &>(obj));
+        return true;
+      }
+      break;
+    case 211:
+      if (constructor == messageEntityEmail::ID) {
+        func(static_cast<messageEntityEmail &>(obj));
+        return true;
+      }
+      break;
+    case 215:
+      if (constructor == sendMessageUploadPhotoAction::ID) {
+        func(static_cast<sendMessageUploadPhotoAction &>(obj));
+        return true;
+      }
+      if (constructor == sendMessageChooseContactAction::ID) {
+        func(static_cast<sendMessageChooseContactAction &>(obj));
+        return true;
+      }
+      break;
+    case 218:
+      if (constructor == decryptedMessageMediaExternalDocument::ID) {
+        func(static_cast<decryptedMessageMediaExternalDocument &>(obj));
+        return true;
+      }
+      if (constructor == inputStickerSetEmpty::ID) {
+        func(static_cast<inputStickerSetEmpty &>(obj));
+        return true;
+      }
+      break;
+    case 219:
+      if (constructor == decryptedMessageActionAcceptKey::ID) {
+        func(static_cast<decryptedMessageActionAcceptKey &>(obj));
+        return true;
+      }
+      break;
+    case 225:
+      if (constructor == sendMessageRecordVideoAction::ID) {
+        func(static_cast<sendMessageRecordVideoAction &>(obj));
+        return true;
+      }
+      break;
+    case 233:
+      if (constructor == decryptedMessageMediaContact::ID) {
+        func(static_cast<decryptedMessageMediaContact &>(obj));
+        return true;
+      }
+      break;
+    case 238:
+      if (constructor == documentAttributeFilename::ID) {
+        func(static_cast<documentAttributeFilename &>(obj));
+        return true;
+      }
+      break;
+    case 239:
+      if (constructor == decryptedMessageMediaGeoPoint::ID) {
+        func(static_cast<decryptedMessageMediaGeoPoint &>(obj));
+        return true;
+      }
+      break;
+    case 241:
+      if (constructor == sendMessageRecordAudioAction::ID) {
+        func(static_cast<sendMessageRecordAudioAction &>(obj));
+        return true;
+      }
+      break;
+    case 245:
+      if (constructor == messageEntityCode::ID) {
+        func(static_cast<messageEntityCode &>(obj));
+        return true;
+      }
+      break;
+    case 246:
+      if (constructor == decryptedMessageMediaVideo::ID) {
+        func(static_cast<decryptedMessageMediaVideo &>(obj));
+        return true;
+      }
+      break;
+    case 249:
+      if (constructor == messageEntityCashtag::ID) {
+        func(static_cast<messageEntityCashtag &>(obj));
+        return true;
+      }
+      break;
+    case 250:
+      if (constructor == decryptedMessage23::ID) {
+        func(static_cast<decryptedMessage23 &>(obj));
+        return true;
+      }
+      if (constructor == decryptedMessageActionCommitKey::ID) {
+        func(static_cast<decryptedMessageActionCommitKey &>(obj));
+        return true;
+      }
+      break;
+    case 253:
+      if (constructor == messageEntityBlockquote::ID) {
+        func(static_cast<messageEntityBlockquote &>(obj));
+        return true;
+      }
+      break;
+    case 255:
+      if (constructor == decryptedMessageActionNotifyLayer::ID) {
+        func(static_cast<decryptedMessageActionNotifyLayer &>(obj));
+        return true;
+      }
+      break;
+    default:
+      break;
+  }
+  return false;
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(Function &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case test_dummyFunction::ID:
+      func(static_cast<test_dummyFunction &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(DecryptedMessage &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case decryptedMessage8::ID:
+      func(static_cast<decryptedMessage8 &>(obj));
+      return true;
+    case decryptedMessageService8::ID:
+      func(static_cast<decryptedMessageService8 &>(obj));
+      return true;
+    case decryptedMessage23::ID:
+      func(static_cast<decryptedMessage23 &>(obj));
+      return true;
+    case decryptedMessageService::ID:
+      func(static_cast<decryptedMessageService &>(obj));
+      return true;
+    case decryptedMessage46::ID:
+      func(static_cast<decryptedMessage46 &>(obj));
+      return true;
+    case decryptedMessage::ID:
+      func(static_cast<decryptedMessage &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(DecryptedMessageAction &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case decryptedMessageActionSetMessageTTL::ID:
+      func(static_cast<decryptedMessageActionSetMessageTTL &>(obj));
+      return true;
+    case decryptedMessageActionReadMessages::ID:
+      func(static_cast<decryptedMessageActionReadMessages &>(obj));
+      return true;
+    case decryptedMessageActionDeleteMessages::ID:
+      func(static_cast<decryptedMessageActionDeleteMessages &>(obj));
+      return true;
+    case decryptedMessageActionScreenshotMessages::ID:
+      func(static_cast<decryptedMessageActionScreenshotMessages &>(obj));
+      return true;
+    case decryptedMessageActionFlushHistory::ID:
+      func(static_cast<decryptedMessageActionFlushHistory &>(obj));
+      return true;
+    case decryptedMessageActionResend::ID:
+      func(static_cast<decryptedMessageActionResend &>(obj));
+      return true;
+    case decryptedMessageActionNotifyLayer::ID:
+      func(static_cast<decryptedMessageActionNotifyLayer &>(obj));
+      return true;
+    case decryptedMessageActionTyping::ID:
+      func(static_cast<decryptedMessageActionTyping &>(obj));
+      return true;
+    case decryptedMessageActionRequestKey::ID:
+      func(static_cast<decryptedMessageActionRequestKey &>(obj));
+      return true;
+    case decryptedMessageActionAcceptKey::ID:
+      func(static_cast<decryptedMessageActionAcceptKey &>(obj));
+      return true;
+    case decryptedMessageActionAbortKey::ID:
+      func(static_cast<decryptedMessageActionAbortKey &>(obj));
+      return true;
+    case decryptedMessageActionCommitKey::ID:
+      func(static_cast<decryptedMessageActionCommitKey &>(obj));
+      return true;
+    case decryptedMessageActionNoop::ID:
+      func(static_cast<decryptedMessageActionNoop &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(DecryptedMessageMedia &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case decryptedMessageMediaEmpty::ID:
+      func(static_cast<decryptedMessageMediaEmpty &>(obj));
+      return true;
+    case decryptedMessageMediaPhoto23::ID:
+      func(static_cast<decryptedMessageMediaPhoto23 &>(obj));
+      return true;
+    case decryptedMessageMediaVideo8::ID:
+      func(static_cast<decryptedMessageMediaVideo8 &>(obj));
+      return true;
+    case decryptedMessageMediaGeoPoint::ID:
+      func(static_cast<decryptedMessageMediaGeoPoint &>(obj));
+      return true;
+    case decryptedMessageMediaContact::ID:
+      func(static_cast<decryptedMessageMediaContact &>(obj));
+      return true;
+    case decryptedMessageMediaDocument23::ID:
+      func(static_cast<decryptedMessageMediaDocument23 &>(obj));
+      return true;
+    case decryptedMessageMediaAudio8::ID:
+      func(static_cast<decryptedMessageMediaAudio8 &>(obj));
+      return true;
+    case decryptedMessageMediaVideo23::ID:
+      func(static_cast<decryptedMessageMediaVideo23 &>(obj));
+      return true;
+    case decryptedMessageMediaAudio::ID:
+      func(static_cast<decryptedMessageMediaAudio &>(obj));
+      return true;
+    case decryptedMessageMediaExternalDocument::ID:
+      func(static_cast<decryptedMessageMediaExternalDocument &>(obj));
+      return true;
+    case decryptedMessageMediaPhoto::ID:
+      func(static_cast<decryptedMessageMediaPhoto &>(obj));
+      return true;
+    case decryptedMessageMediaVideo::ID:
+      func(static_cast<decryptedMessageMediaVideo &>(obj));
+      return true;
+    case decryptedMessageMediaDocument::ID:
+      func(static_cast<decryptedMessageMediaDocument &>(obj));
+      return true;
+    case decryptedMessageMediaVenue::ID:
+      func(static_cast<decryptedMessageMediaVenue &>(obj));
+      return true;
+    case decryptedMessageMediaWebPage::ID:
+      func(static_cast<decryptedMessageMediaWebPage &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(DocumentAttribute &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case documentAttributeImageSize::ID:
+      func(static_cast<documentAttributeImageSize &>(obj));
+      return true;
+    case documentAttributeAnimated::ID:
+      func(static_cast<documentAttributeAnimated &>(obj));
+      return true;
+    case documentAttributeSticker23::ID:
+      func(static_cast<documentAttributeSticker23 &>(obj));
+      return true;
+    case documentAttributeVideo::ID:
+      func(static_cast<documentAttributeVideo &>(obj));
+      return true;
+    case documentAttributeAudio23::ID:
+      func(static_cast<documentAttributeAudio23 &>(obj));
+      return true;
+    case documentAttributeFilename::ID:
+      func(static_cast<documentAttributeFilename &>(obj));
+      return true;
+    case documentAttributeAudio45::ID:
+      func(static_cast<documentAttributeAudio45 &>(obj));
+      return true;
+    case documentAttributeSticker::ID:
+      func(static_cast<documentAttributeSticker &>(obj));
+      return true;
+    case documentAttributeAudio::ID:
+      func(static_cast<documentAttributeAudio &>(obj));
+      return true;
+    case documentAttributeVideo66::ID:
+      func(static_cast<documentAttributeVideo66 &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(FileLocation &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case fileLocationUnavailable::ID:
+      func(static_cast<fileLocationUnavailable &>(obj));
+      return true;
+    case fileLocation::ID:
+      func(static_cast<fileLocation &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(InputStickerSet &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case inputStickerSetShortName::ID:
+      func(static_cast<inputStickerSetShortName &>(obj));
+      return true;
+    case inputStickerSetEmpty::ID:
+      func(static_cast<inputStickerSetEmpty &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(MessageEntity &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch ((static_cast<std::uint32_t>(constructor) * 2603464913u) >> 26) {
+    case 0:
+      if (constructor == messageEntityCode::ID) {
+        func(static_cast<messageEntityCode &>(obj));
+        return true;
+      }
+      break;
+    case 1:
+      if (constructor == messageEntityStrike::ID) {
+        func(static_cast<messageEntityStrike &>(obj));
+        return true;
+      }
+      break;
+    case 8:
+      if (constructor == messageEntityBold::ID) {
+        func(static_cast<messageEntityBold &>(obj));
+        return true;
+      }
+      break;
+    case 11:
+      if (constructor == messageEntityMentionName::ID) {
+        func(static_cast<messageEntityMentionName &>(obj));
+        return true;
+      }
+      break;
+    case 14:
+      if (constructor == messageEntityHashtag::ID) {
+        func(static_cast<messageEntityHashtag &>(obj));
+        return true;
+      }
+      break;
+    case 16:
+      if (constructor == messageEntityCashtag::ID) {
+        func(static_cast<messageEntityCashtag &>(obj));
+        return true;
+      }
+      break;
+    case 18:
+      if (constructor == messageEntityItalic::ID) {
+        func(static_cast<messageEntityItalic &>(obj));
+        return true;
+      }
+      break;
+    case 22:
+      if (constructor == messageEntityPhone::ID) {
+        func(static_cast<messageEntityPhone &>(obj));
+        return true;
+      }
+      break;
+    case 27:
+      if (constructor == messageEntityUnderline::ID) {
+        func(static_cast<messageEntityUnderline &>(obj));
+        return true;
+      }
+      break;
+    case 29:
+      if (constructor == messageEntityPre::ID) {
+        func(static_cast<messageEntityPre &>(obj));
+        return true;
+      }
+      break;
+    case 32:
+      if (constructor == messageEntityTextUrl::ID) {
+        func(static_cast<messageEntityTextUrl &>(obj));
+        return true;
+      }
+      break;
+    case 33:
+      if (constructor == messageEntityUrl::ID) {
+        func(static_cast<messageEntityUrl &>(obj));
+        return true;
+      }
+      break;
+    case 39:
+      if (constructor == messageEntityUnknown::ID) {
+        func(static_cast<messageEntityUnknown &>(obj));
+        return true;
+      }
+      break;
+    case 44:
+      if (constructor == messageEntityMention::ID) {
+        func(static_cast<messageEntityMention &>(obj));
+        return true;
+      }
+      break;
+    case 47:
+      if (constructor == messageEntityEmail::ID) {
+        func(static_cast<messageEntityEmail &>(obj));
+        return true;
+      }
+      break;
+    case 53:
+      if (constructor == messageEntityBankCard::ID) {
+        func(static_cast<messageEntityBankCard &>(obj));
+        return true;
+      }
+      break;
+    case 54:
+      if (constructor == messageEntityBlockquote::ID) {
+        func(static_cast<messageEntityBlockquote &>(obj));
+        return true;
+      }
+      break;
+    case 63:
+      if (constructor == messageEntityBotCommand::ID) {
+        func(static_cast<messageEntityBotCommand &>(obj));
+        return true;
+      }
+      break;
+    default:
+      break;
+  }
+  return false;
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(PhotoSize &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case photoSizeEmpty::ID:
+      func(static_cast<photoSizeEmpty &>(obj));
+      return true;
+    case photoSize::ID:
+      func(static_cast<photoSize &>(obj));
+      return true;
+    case photoCachedSize::ID:
+      func(static_cast<photoCachedSize &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(SendMessageAction &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case sendMessageTypingAction::ID:
+      func(static_cast<sendMessageTypingAction &>(obj));
+      return true;
+    case sendMessageCancelAction::ID:
+      func(static_cast<sendMessageCancelAction &>(obj));
+      return true;
+    case sendMessageRecordVideoAction::ID:
+      func(static_cast<sendMessageRecordVideoAction &>(obj));
+      return true;
+    case sendMessageUploadVideoAction::ID:
+      func(static_cast<sendMessageUploadVideoAction &>(obj));
+      return true;
+    case sendMessageRecordAudioAction::ID:
+      func(static_cast<sendMessageRecordAudioAction &>(obj));
+      return true;
+    case sendMessageUploadAudioAction::ID:
+      func(static_cast<sendMessageUploadAudioAction &>(obj));
+      return true;
+    case sendMessageUploadPhotoAction::ID:
+      func(static_cast<sendMessageUploadPhotoAction &>(obj));
+      return true;
+    case sendMessageUploadDocumentAction::ID:
+      func(static_cast<sendMessageUploadDocumentAction &>(obj));
+      return true;
+    case sendMessageGeoLocationAction::ID:
+      func(static_cast<sendMessageGeoLocationAction &>(obj));
+      return true;
+    case sendMessageChooseContactAction::ID:
+      func(static_cast<sendMessageChooseContactAction &>(obj));
+      return true;
+    case sendMessageRecordRoundAction::ID:
+      func(static_cast<sendMessageRecordRoundAction &>(obj));
+      return true;
+    case sendMessageUploadRoundAction::ID:
+      func(static_cast<sendMessageUploadRoundAction &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+}  // namespace secret_api
+}  // namespace td
@@ -0,0 +1,12797 @@
+#pragma once
+
+/**
+ * \file
+ * Contains downcast_call methods for calling a function object on downcasted to
+ * the most derived class TDLib API object.
+ */
+#include "td_api.h"
+
+namespace td {
+namespace td_api {
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(Object &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch ((static_cast<std::uint32_t>(constructor) * 2506608297u) >> 21) {
+    case 0:
+      if (constructor == tMeUrlTypeChatInvite::ID) {
+        func(static_cast<tMeUrlTypeChatInvite &>(obj));
+        return true;
+      }
+      break;
+    case 4:
+      if (constructor == tMeUrl::ID) {
+        func(static_cast<tMeUrl &>(obj));
+        return true;
+      }
+      break;
+    case 12:
+      if (constructor == resetPasswordResultDeclined::ID) {
+        func(static_cast<resetPasswordResultDeclined &>(obj));
+        return true;
+      }
+      break;
+    case 15:
+      if (constructor == chatMember::ID) {
+        func(static_cast<chatMember &>(obj));
+        return true;
+      }
+      break;
+    case 19:
+      if (constructor == notification::ID) {
+        func(static_cast<notification &>(obj));
+        return true;
+      }
+      break;
+    case 22:
+      if (constructor == backgroundFillSolid::ID) {
+        func(static_cast<backgroundFillSolid &>(obj));
+        return true;
+      }
+      break;
+    case 33:
+      if (constructor == updateConnectionState::ID) {
+        func(static_cast<updateConnectionState &>(obj));
+        return true;
+      }
+      break;
+    case 34:
+      if (constructor == inputFileRemote::ID) {
+        func(static_cast<inputFileRemote &>(obj));
+        return true;
+      }
+      break;
+    case 43:
+      if (constructor == chatEventMemberPromoted::ID) {
+        func(static_cast<chatEventMemberPromoted &>(obj));
+        return true;
+      }
+      if (constructor == updateInstalledStickerSets::ID) {
+        func(static_cast<updateInstalledStickerSets &>(obj));
+        return true;
+      }
+      break;
+    case 46:
+      if (constructor == updateNewShippingQuery::ID) {
+        func(static_cast<updateNewShippingQuery &>(obj));
+        return true;
+      }
+      break;
+    case 48:
+      if (constructor == pushMessageContentContact::ID) {
+        func(static_cast<pushMessageContentContact &>(obj));
+        return true;
+      }
+      if (constructor == pushMessageContentGameScore::ID) {
+        func(static_cast<pushMessageContentGameScore &>(obj));
+        return true;
+      }
+      break;
+    case 50:
+      if (constructor == optionValueString::ID) {
+        func(static_cast<optionValueString &>(obj));
+        return true;
+      }
+      break;
+    case 56:
+      if (constructor == pageBlockMap::ID) {
+        func(static_cast<pageBlockMap &>(obj));
+        return true;
+      }
+      break;
+    case 59:
+      if (constructor == updateAnimationSearchParameters::ID) {
+        func(static_cast<updateAnimationSearchParameters &>(obj));
+        return true;
+      }
+      break;
+    case 60:
+      if (constructor == inputInlineQueryResultContact::ID) {
+        func(static_cast<inputInlineQueryResultContact &>(obj));
+        return true;
+      }
+      break;
+    case 62:
+      if (constructor == authenticationCodeInfo::ID) {
+        func(static_cast<authenticationCodeInfo &>(obj));
+        return true;
+      }
+      break;
+    case 64:
+      if (constructor == call::ID) {
+        func(static_cast<call &>(obj));
+        return true;
+      }
+      if (constructor == networkTypeNone::ID) {
+        func(static_cast<networkTypeNone &>(obj));
+        return true;
+      }
+      break;
+    case 67:
+      if (constructor == updateBasicGroup::ID) {
+        func(static_cast<updateBasicGroup &>(obj));
+        return true;
+      }
+      break;
+    case 68:
+      if (constructor == inputMessageForwarded::ID) {
+        func(static_cast<inputMessageForwarded &>(obj));
+        return true;
+      }
+      break;
+    case 70:
+      if (constructor == fileTypeVoiceNote::ID) {
+        func(static_cast<fileTypeVoiceNote &>(obj));
+        return true;
+      }
+      if (constructor == groupCallVideoQualityMedium::ID) {
+        func(static_cast<groupCallVideoQualityMedium &>(obj));
+        return true;
+      }
+      break;
+    case 71:
+      if (constructor == pushMessageContentChatChangePhoto::ID) {
+        func(static_cast<pushMessageContentChatChangePhoto &>(obj));
+        return true;
+      }
+      break;
+    case 74:
+      if (constructor == inputMessageVideoNote::ID) {
+        func(static_cast<inputMessageVideoNote &>(obj));
+        return true;
+      }
+      break;
+    case 77:
+      if (constructor == chatEventLinkedChatChanged::ID) {
+        func(static_cast<chatEventLinkedChatChanged &>(obj));
+        return true;
+      }
+      break;
+    case 80:
+      if (constructor == pushReceiverId::ID) {
+        func(static_cast<pushReceiverId &>(obj));
+        return true;
+      }
+      break;
+    case 81:
+      if (constructor == checkChatUsernameResultPublicGroupsUnavailable::ID) {
+        func(static_cast<checkChatUsernameResultPublicGroupsUnavailable &>(obj));
+        return true;
+      }
+      break;
+    case 91:
+      if (constructor == messageLinkInfo::ID) {
+        func(static_cast<messageLinkInfo &>(obj));
+        return true;
+      }
+      break;
+    case 94:
+      if (constructor == chatEventVideoChatCreated::ID) {
+        func(static_cast<chatEventVideoChatCreated &>(obj));
+        return true;
+      }
+      break;
+    case 96:
+      if (constructor == userPrivacySettingAllowCalls::ID) {
+        func(static_cast<userPrivacySettingAllowCalls &>(obj));
+        return true;
+      }
+      break;
+    case 99:
+      if (constructor == fileTypeSticker::ID) {
+        func(static_cast<fileTypeSticker &>(obj));
+        return true;
+      }
+      if (constructor == reaction::ID) {
+        func(static_cast<reaction &>(obj));
+        return true;
+      }
+      break;
+    case 103:
+      if (constructor == internalLinkTypeBackground::ID) {
+        func(static_cast<internalLinkTypeBackground &>(obj));
+        return true;
+      }
+      break;
+    case 113:
+      if (constructor == topChatCategoryInlineBots::ID) {
+        func(static_cast<topChatCategoryInlineBots &>(obj));
+        return true;
+      }
+      break;
+    case 115:
+      if (constructor == languagePackString::ID) {
+        func(static_cast<languagePackString &>(obj));
+        return true;
+      }
+      break;
+    case 117:
+      if (constructor == userPrivacySettingRuleRestrictChatMembers::ID) {
+        func(static_cast<userPrivacySettingRuleRestrictChatMembers &>(obj));
+        return true;
+      }
+      break;
+    case 118:
+      if (constructor == textEntityTypeBold::ID) {
+        func(static_cast<textEntityTypeBold &>(obj));
+        return true;
+      }
+      break;
+    case 124:
+      if (constructor == userPrivacySettingRules::ID) {
+        func(static_cast<userPrivacySettingRules &>(obj));
+        return true;
+      }
+      break;
+    case 125:
+      if (constructor == updateNewPreCheckoutQuery::ID) {
+        func(static_cast<updateNewPreCheckoutQuery &>(obj));
+        return true;
+      }
+      break;
+    case 130:
+      if (constructor == message::ID) {
+        func(static_cast<message &>(obj));
+        return true;
+      }
+      break;
+    case 131:
+      if (constructor == inputPassportElementPhoneNumber::ID) {
+        func(static_cast<inputPassportElementPhoneNumber &>(obj));
+        return true;
+      }
+      break;
+    case 132:
+      if (constructor == countries::ID) {
+        func(static_cast<countries &>(obj));
+        return true;
+      }
+      if (constructor == pageBlockParagraph::ID) {
+        func(static_cast<pageBlockParagraph &>(obj));
+        return true;
+      }
+      break;
+    case 133:
+      if (constructor == chatActionChoosingSticker::ID) {
+        func(static_cast<chatActionChoosingSticker &>(obj));
+        return true;
+      }
+      break;
+    case 135:
+      if (constructor == updateMessageSendAcknowledged::ID) {
+        func(static_cast<updateMessageSendAcknowledged &>(obj));
+        return true;
+      }
+      if (constructor == user::ID) {
+        func(static_cast<user &>(obj));
+        return true;
+      }
+      break;
+    case 137:
+      if (constructor == chatReportReasonViolence::ID) {
+        func(static_cast<chatReportReasonViolence &>(obj));
+        return true;
+      }
+      break;
+    case 139:
+      if (constructor == callProblemDropped::ID) {
+        func(static_cast<callProblemDropped &>(obj));
+        return true;
+      }
+      break;
+    case 141:
+      if (constructor == chatStatisticsChannel::ID) {
+        func(static_cast<chatStatisticsChannel &>(obj));
+        return true;
+      }
+      break;
+    case 144:
+      if (constructor == notificationTypeNewCall::ID) {
+        func(static_cast<notificationTypeNewCall &>(obj));
+        return true;
+      }
+      break;
+    case 145:
+      if (constructor == networkStatisticsEntryFile::ID) {
+        func(static_cast<networkStatisticsEntryFile &>(obj));
+        return true;
+      }
+      break;
+    case 147:
+      if (constructor == internalLinkTypePhoneNumberConfirmation::ID) {
+        func(static_cast<internalLinkTypePhoneNumberConfirmation &>(obj));
+        return true;
+      }
+      break;
+    case 149:
+      if (constructor == languagePackInfo::ID) {
+        func(static_cast<languagePackInfo &>(obj));
+        return true;
+      }
+      break;
+    case 151:
+      if (constructor == richTextIcon::ID) {
+        func(static_cast<richTextIcon &>(obj));
+        return true;
+      }
+      break;
+    case 154:
+      if (constructor == animatedEmoji::ID) {
+        func(static_cast<animatedEmoji &>(obj));
+        return true;
+      }
+      break;
+    case 155:
+      if (constructor == inputFileGenerated::ID) {
+        func(static_cast<inputFileGenerated &>(obj));
+        return true;
+      }
+      break;
+    case 160:
+      if (constructor == passportElementPassportRegistration::ID) {
+        func(static_cast<passportElementPassportRegistration &>(obj));
+        return true;
+      }
+      break;
+    case 164:
+      if (constructor == chatEventMemberRestricted::ID) {
+        func(static_cast<chatEventMemberRestricted &>(obj));
+        return true;
+      }
+      break;
+    case 174:
+      if (constructor == internalLinkTypeMessageDraft::ID) {
+        func(static_cast<internalLinkTypeMessageDraft &>(obj));
+        return true;
+      }
+      break;
+    case 175:
+      if (constructor == chatTypeSupergroup::ID) {
+        func(static_cast<chatTypeSupergroup &>(obj));
+        return true;
+      }
+      if (constructor == emailAddressAuthenticationCodeInfo::ID) {
+        func(static_cast<emailAddressAuthenticationCodeInfo &>(obj));
+        return true;
+      }
+      if (constructor == passportElementRentalAgreement::ID) {
+        func(static_cast<passportElementRentalAgreement &>(obj));
+        return true;
+      }
+      break;
+    case 179:
+      if (constructor == inputPassportElementErrorSourceFile::ID) {
+        func(static_cast<inputPassportElementErrorSourceFile &>(obj));
+        return true;
+      }
+      if (constructor == keyboardButtonTypeRequestLocation::ID) {
+        func(static_cast<keyboardButtonTypeRequestLocation &>(obj));
+        return true;
+      }
+      break;
+    case 180:
+      if (constructor == secretChatStateClosed::ID) {
+        func(static_cast<secretChatStateClosed &>(obj));
+        return true;
+      }
+      break;
+    case 182:
+      if (constructor == tMeUrlTypeSupergroup::ID) {
+        func(static_cast<tMeUrlTypeSupergroup &>(obj));
+        return true;
+      }
+      break;
+    case 184:
+      if (constructor == inputFileId::ID) {
+        func(static_cast<inputFileId &>(obj));
+        return true;
+      }
+      break;
+    case 189:
+      if (constructor == pageBlockVerticalAlignmentTop::ID) {
+        func(static_cast<pageBlockVerticalAlignmentTop &>(obj));
+        return true;
+      }
+      break;
+    case 190:
+      if (constructor == logStreamFile::ID) {
+        func(static_cast<logStreamFile &>(obj));
+        return true;
+      }
+      break;
+    case 191:
+      if (constructor == address::ID) {
+        func(static_cast<address &>(obj));
+        return true;
+      }
+      break;
+    case 194:
+      if (constructor == phoneNumberAuthenticationSettings::ID) {
+        func(static_cast<phoneNumberAuthenticationSettings &>(obj));
+        return true;
+      }
+      break;
+    case 196:
+      if (constructor == pushMessageContentAudio::ID) {
+        func(static_cast<pushMessageContentAudio &>(obj));
+        return true;
+      }
+      if (constructor == text::ID) {
+        func(static_cast<text &>(obj));
+        return true;
+      }
+      break;
+    case 198:
+      if (constructor == notificationTypeNewSecretChat::ID) {
+        func(static_cast<notificationTypeNewSecretChat &>(obj));
+        return true;
+      }
+      break;
+    case 199:
+      if (constructor == inputPassportElementDriverLicense::ID) {
+        func(static_cast<inputPassportElementDriverLicense &>(obj));
+        return true;
+      }
+      break;
+    case 201:
+      if (constructor == chatEventLocationChanged::ID) {
+        func(static_cast<chatEventLocationChanged &>(obj));
+        return true;
+      }
+      if (constructor == count::ID) {
+        func(static_cast<count &>(obj));
+        return true;
+      }
+      break;
+    case 202:
+      if (constructor == backgroundFillFreeformGradient::ID) {
+        func(static_cast<backgroundFillFreeformGradient &>(obj));
+        return true;
+      }
+      break;
+    case 207:
+      if (constructor == updateChatPermissions::ID) {
+        func(static_cast<updateChatPermissions &>(obj));
+        return true;
+      }
+      break;
+    case 208:
+      if (constructor == messageSendingStatePending::ID) {
+        func(static_cast<messageSendingStatePending &>(obj));
+        return true;
+      }
+      break;
+    case 210:
+      if (constructor == chatSourcePublicServiceAnnouncement::ID) {
+        func(static_cast<chatSourcePublicServiceAnnouncement &>(obj));
+        return true;
+      }
+      break;
+    case 212:
+      if (constructor == chatTheme::ID) {
+        func(static_cast<chatTheme &>(obj));
+        return true;
+      }
+      break;
+    case 214:
+      if (constructor == inputPassportElementErrorSourceTranslationFiles::ID) {
+        func(static_cast<inputPassportElementErrorSourceTranslationFiles &>(obj));
+        return true;
+      }
+      break;
+    case 218:
+      if (constructor == languagePackStrings::ID) {
+        func(static_cast<languagePackStrings &>(obj));
+        return true;
+      }
+      break;
+    case 221:
+      if (constructor == internalLinkTypeActiveSessions::ID) {
+        func(static_cast<internalLinkTypeActiveSessions &>(obj));
+        return true;
+      }
+      break;
+    case 224:
+      if (constructor == messageVideoChatStarted::ID) {
+        func(static_cast<messageVideoChatStarted &>(obj));
+        return true;
+      }
+      break;
+    case 226:
+      if (constructor == groupCallVideoQualityFull::ID) {
+        func(static_cast<groupCallVideoQualityFull &>(obj));
+        return true;
+      }
+      if (constructor == tdlibParameters::ID) {
+        func(static_cast<tdlibParameters &>(obj));
+        return true;
+      }
+      break;
+    case 227:
+      if (constructor == logTags::ID) {
+        func(static_cast<logTags &>(obj));
+        return true;
+      }
+      break;
+    case 228:
+      if (constructor == pageBlockRelatedArticles::ID) {
+        func(static_cast<pageBlockRelatedArticles &>(obj));
+        return true;
+      }
+      break;
+    case 229:
+      if (constructor == passportElementErrorSourceTranslationFile::ID) {
+        func(static_cast<passportElementErrorSourceTranslationFile &>(obj));
+        return true;
+      }
+      break;
+    case 232:
+      if (constructor == userTypeDeleted::ID) {
+        func(static_cast<userTypeDeleted &>(obj));
+        return true;
+      }
+      break;
+    case 233:
+      if (constructor == thumbnailFormatPng::ID) {
+        func(static_cast<thumbnailFormatPng &>(obj));
+        return true;
+      }
+      break;
+    case 234:
+      if (constructor == updateHavePendingNotifications::ID) {
+        func(static_cast<updateHavePendingNotifications &>(obj));
+        return true;
+      }
+      break;
+    case 238:
+      if (constructor == chatTypePrivate::ID) {
+        func(static_cast<chatTypePrivate &>(obj));
+        return true;
+      }
+      break;
+    case 239:
+      if (constructor == maskPointForehead::ID) {
+        func(static_cast<maskPointForehead &>(obj));
+        return true;
+      }
+      if (constructor == shippingOption::ID) {
+        func(static_cast<shippingOption &>(obj));
+        return true;
+      }
+      break;
+    case 243:
+      if (constructor == thumbnail::ID) {
+        func(static_cast<thumbnail &>(obj));
+        return true;
+      }
+      break;
+    case 244:
+      if (constructor == logStreamDefault::ID) {
+        func(static_cast<logStreamDefault &>(obj));
+        return true;
+      }
+      break;
+    case 245:
+      if (constructor == updateActiveNotifications::ID) {
+        func(static_cast<updateActiveNotifications &>(obj));
+        return true;
+      }
+      break;
+    case 246:
+      if (constructor == bankCardActionOpenUrl::ID) {
+        func(static_cast<bankCardActionOpenUrl &>(obj));
+        return true;
+      }
+      if (constructor == resetPasswordResultPending::ID) {
+        func(static_cast<resetPasswordResultPending &>(obj));
+        return true;
+      }
+      break;
+    case 258:
+      if (constructor == secretChatStateReady::ID) {
+        func(static_cast<secretChatStateReady &>(obj));
+        return true;
+      }
+      break;
+    case 262:
+      if (constructor == updateStickerSet::ID) {
+        func(static_cast<updateStickerSet &>(obj));
+        return true;
+      }
+      break;
+    case 265:
+      if (constructor == testVectorStringObject::ID) {
+        func(static_cast<testVectorStringObject &>(obj));
+        return true;
+      }
+      break;
+    case 268:
+      if (constructor == chatActionWatchingAnimations::ID) {
+        func(static_cast<chatActionWatchingAnimations &>(obj));
+        return true;
+      }
+      break;
+    case 275:
+      if (constructor == stickerSet::ID) {
+        func(static_cast<stickerSet &>(obj));
+        return true;
+      }
+      if (constructor == textEntityTypeHashtag::ID) {
+        func(static_cast<textEntityTypeHashtag &>(obj));
+        return true;
+      }
+      break;
+    case 277:
+      if (constructor == keyboardButtonTypeText::ID) {
+        func(static_cast<keyboardButtonTypeText &>(obj));
+        return true;
+      }
+      break;
+    case 279:
+      if (constructor == file::ID) {
+        func(static_cast<file &>(obj));
+        return true;
+      }
+      break;
+    case 286:
+      if (constructor == chatEventVideoChatEnded::ID) {
+        func(static_cast<chatEventVideoChatEnded &>(obj));
+        return true;
+      }
+      break;
+    case 287:
+      if (constructor == authenticationCodeTypeSms::ID) {
+        func(static_cast<authenticationCodeTypeSms &>(obj));
+        return true;
+      }
+      if (constructor == userPrivacySettingShowLinkInForwardedMessages::ID) {
+        func(static_cast<userPrivacySettingShowLinkInForwardedMessages &>(obj));
+        return true;
+      }
+      break;
+    case 290:
+      if (constructor == inputInlineQueryResultVideo::ID) {
+        func(static_cast<inputInlineQueryResultVideo &>(obj));
+        return true;
+      }
+      if (constructor == internalLinkTypeProxy::ID) {
+        func(static_cast<internalLinkTypeProxy &>(obj));
+        return true;
+      }
+      break;
+    case 293:
+      if (constructor == pageBlockHorizontalAlignmentCenter::ID) {
+        func(static_cast<pageBlockHorizontalAlignmentCenter &>(obj));
+        return true;
+      }
+      break;
+    case 295:
+      if (constructor == topChatCategoryForwardChats::ID) {
+        func(static_cast<topChatCategoryForwardChats &>(obj));
+        return true;
+      }
+      break;
+    case 297:
+      if (constructor == passportRequiredElement::ID) {
+        func(static_cast<passportRequiredElement &>(obj));
+        return true;
+      }
+      break;
+    case 300:
+      if (constructor == stickerSetInfo::ID) {
+        func(static_cast<stickerSetInfo &>(obj));
+        return true;
+      }
+      break;
+    case 302:
+      if (constructor == messageContact::ID) {
+        func(static_cast<messageContact &>(obj));
+        return true;
+      }
+      break;
+    case 303:
+      if (constructor == logStreamEmpty::ID) {
+        func(static_cast<logStreamEmpty &>(obj));
+        return true;
+      }
+      break;
+    case 304:
+      if (constructor == inputPassportElementInternalPassport::ID) {
+        func(static_cast<inputPassportElementInternalPassport &>(obj));
+        return true;
+      }
+      break;
+    case 308:
+      if (constructor == messageChatSetTheme::ID) {
+        func(static_cast<messageChatSetTheme &>(obj));
+        return true;
+      }
+      break;
+    case 309:
+      if (constructor == pushMessageContentAnimation::ID) {
+        func(static_cast<pushMessageContentAnimation &>(obj));
+        return true;
+      }
+      break;
+    case 310:
+      if (constructor == chatEventAvailableReactionsChanged::ID) {
+        func(static_cast<chatEventAvailableReactionsChanged &>(obj));
+        return true;
+      }
+      break;
+    case 311:
+      if (constructor == chatEventMemberJoined::ID) {
+        func(static_cast<chatEventMemberJoined &>(obj));
+        return true;
+      }
+      break;
+    case 319:
+      if (constructor == inlineKeyboardButtonTypeLoginUrl::ID) {
+        func(static_cast<inlineKeyboardButtonTypeLoginUrl &>(obj));
+        return true;
+      }
+      if (constructor == passportElementErrorSourceFrontSide::ID) {
+        func(static_cast<passportElementErrorSourceFrontSide &>(obj));
+        return true;
+      }
+      break;
+    case 321:
+      if (constructor == paymentReceipt::ID) {
+        func(static_cast<paymentReceipt &>(obj));
+        return true;
+      }
+      break;
+    case 323:
+      if (constructor == updateChatMessageSender::ID) {
+        func(static_cast<updateChatMessageSender &>(obj));
+        return true;
+      }
+      break;
+    case 324:
+      if (constructor == validatedOrderInfo::ID) {
+        func(static_cast<validatedOrderInfo &>(obj));
+        return true;
+      }
+      break;
+    case 333:
+      if (constructor == accountTtl::ID) {
+        func(static_cast<accountTtl &>(obj));
+        return true;
+      }
+      if (constructor == chatActionBarInviteMembers::ID) {
+        func(static_cast<chatActionBarInviteMembers &>(obj));
+        return true;
+      }
+      break;
+    case 337:
+      if (constructor == passportElementTypeRentalAgreement::ID) {
+        func(static_cast<passportElementTypeRentalAgreement &>(obj));
+        return true;
+      }
+      break;
+    case 338:
+      if (constructor == chatEventMessagePinned::ID) {
+        func(static_cast<chatEventMessagePinned &>(obj));
+        return true;
+      }
+      break;
+    case 341:
+      if (constructor == inputMessageLocation::ID) {
+        func(static_cast<inputMessageLocation &>(obj));
+        return true;
+      }
+      break;
+    case 345:
+      if (constructor == messageCalendar::ID) {
+        func(static_cast<messageCalendar &>(obj));
+        return true;
+      }
+      break;
+    case 349:
+      if (constructor == updateNewCallSignalingData::ID) {
+        func(static_cast<updateNewCallSignalingData &>(obj));
+        return true;
+      }
+      break;
+    case 351:
+      if (constructor == messageVideoChatEnded::ID) {
+        func(static_cast<messageVideoChatEnded &>(obj));
+        return true;
+      }
+      break;
+    case 352:
+      if (constructor == users::ID) {
+        func(static_cast<users &>(obj));
+        return true;
+      }
+      break;
+    case 356:
+      if (constructor == httpUrl::ID) {
+        func(static_cast<httpUrl &>(obj));
+        return true;
+      }
+      break;
+    case 361:
+      if (constructor == textEntityTypeUrl::ID) {
+        func(static_cast<textEntityTypeUrl &>(obj));
+        return true;
+      }
+      break;
+    case 364:
+      if (constructor == animations::ID) {
+        func(static_cast<animations &>(obj));
+        return true;
+      }
+      if (constructor == callbackQueryPayloadData::ID) {
+        func(static_cast<callbackQueryPayloadData &>(obj));
+        return true;
+      }
+      break;
+    case 366:
+      if (constructor == messageSendOptions::ID) {
+        func(static_cast<messageSendOptions &>(obj));
+        return true;
+      }
+      break;
+    case 369:
+      if (constructor == passportElements::ID) {
+        func(static_cast<passportElements &>(obj));
+        return true;
+      }
+      if (constructor == textEntityTypeMention::ID) {
+        func(static_cast<textEntityTypeMention &>(obj));
+        return true;
+      }
+      break;
+    case 370:
+      if (constructor == authorizationStateLoggingOut::ID) {
+        func(static_cast<authorizationStateLoggingOut &>(obj));
+        return true;
+      }
+      break;
+    case 372:
+      if (constructor == userPrivacySettingRuleRestrictUsers::ID) {
+        func(static_cast<userPrivacySettingRuleRestrictUsers &>(obj));
+        return true;
+      }
+      break;
+    case 374:
+      if (constructor == basicGroup::ID) {
+        func(static_cast<basicGroup &>(obj));
+        return true;
+      }
+      break;
+    case 379:
+      if (constructor == gameHighScores::ID) {
+        func(static_cast<gameHighScores &>(obj));
+        return true;
+      }
+      break;
+    case 381:
+      if (constructor == richTextSubscript::ID) {
+        func(static_cast<richTextSubscript &>(obj));
+        return true;
+      }
+      break;
+    case 383:
+      if (constructor == textEntityTypeUnderline::ID) {
+        func(static_cast<textEntityTypeUnderline &>(obj));
+        return true;
+      }
+      break;
+    case 386:
+      if (constructor == botCommandScopeDefault::ID) {
+        func(static_cast<botCommandScopeDefault &>(obj));
+        return true;
+      }
+      break;
+    case 387:
+      if (constructor == chatPhoto::ID) {
+        func(static_cast<chatPhoto &>(obj));
+        return true;
+      }
+      if (constructor == inputMessageAudio::ID) {
+        func(static_cast<inputMessageAudio &>(obj));
+        return true;
+      }
+      break;
+    case 389:
+      if (constructor == chatStatisticsAdministratorActionsInfo::ID) {
+        func(static_cast<chatStatisticsAdministratorActionsInfo &>(obj));
+        return true;
+      }
+      break;
+    case 390:
+      if (constructor == inlineKeyboardButtonTypeUrl::ID) {
+        func(static_cast<inlineKeyboardButtonTypeUrl &>(obj));
+        return true;
+      }
+      break;
+    case 391:
+      if (constructor == deepLinkInfo::ID) {
+        func(static_cast<deepLinkInfo &>(obj));
+        return true;
+      }
+      break;
+    case 396:
+      if (constructor == callDiscardReasonMissed::ID) {
+        func(static_cast<callDiscardReasonMissed &>(obj));
+        return true;
+      }
+      break;
+    case 400:
+      if (constructor == inputMessageGame::ID) {
+        func(static_cast<inputMessageGame &>(obj));
+        return true;
+      }
+      if (constructor == pushMessageContentVideoNote::ID) {
+        func(static_cast<pushMessageContentVideoNote &>(obj));
+        return true;
+      }
+      break;
+    case 402:
+      if (constructor == chatActionBarReportAddBlock::ID) {
+        func(static_cast<chatActionBarReportAddBlock &>(obj));
+        return true;
+      }
+      if (constructor == minithumbnail::ID) {
+        func(static_cast<minithumbnail &>(obj));
+        return true;
+      }
+      break;
+    case 406:
+      if (constructor == chatMembersFilterMembers::ID) {
+        func(static_cast<chatMembersFilterMembers &>(obj));
+        return true;
+      }
+      break;
+    case 408:
+      if (constructor == callServerTypeTelegramReflector::ID) {
+        func(static_cast<callServerTypeTelegramReflector &>(obj));
+        return true;
+      }
+      if (constructor == fileTypeProfilePhoto::ID) {
+        func(static_cast<fileTypeProfilePhoto &>(obj));
+        return true;
+      }
+      break;
+    case 410:
+      if (constructor == messageDice::ID) {
+        func(static_cast<messageDice &>(obj));
+        return true;
+      }
+      break;
+    case 415:
+      if (constructor == connectionStateConnecting::ID) {
+        func(static_cast<connectionStateConnecting &>(obj));
+        return true;
+      }
+      break;
+    case 420:
+      if (constructor == passportElementError::ID) {
+        func(static_cast<passportElementError &>(obj));
+        return true;
+      }
+      if (constructor == thumbnailFormatMpeg4::ID) {
+        func(static_cast<thumbnailFormatMpeg4 &>(obj));
+        return true;
+      }
+      break;
+    case 422:
+      if (constructor == checkStickerSetNameResultNameInvalid::ID) {
+        func(static_cast<checkStickerSetNameResultNameInvalid &>(obj));
+        return true;
+      }
+      if (constructor == inputPassportElementTemporaryRegistration::ID) {
+        func(static_cast<inputPassportElementTemporaryRegistration &>(obj));
+        return true;
+      }
+      break;
+    case 426:
+      if (constructor == userTypeBot::ID) {
+        func(static_cast<userTypeBot &>(obj));
+        return true;
+      }
+      break;
+    case 428:
+      if (constructor == updateChatIsBlocked::ID) {
+        func(static_cast<updateChatIsBlocked &>(obj));
+        return true;
+      }
+      break;
+    case 429:
+      if (constructor == messageThreadInfo::ID) {
+        func(static_cast<messageThreadInfo &>(obj));
+        return true;
+      }
+      break;
+    case 437:
+      if (constructor == chatReportReasonCopyright::ID) {
+        func(static_cast<chatReportReasonCopyright &>(obj));
+        return true;
+      }
+      break;
+    case 442:
+      if (constructor == userStatusRecently::ID) {
+        func(static_cast<userStatusRecently &>(obj));
+        return true;
+      }
+      break;
+    case 446:
+      if (constructor == chatAdministrators::ID) {
+        func(static_cast<chatAdministrators &>(obj));
+        return true;
+      }
+      if (constructor == chatEventVideoChatParticipantIsMutedToggled::ID) {
+        func(static_cast<chatEventVideoChatParticipantIsMutedToggled &>(obj));
+        return true;
+      }
+      if (constructor == searchMessagesFilterVideo::ID) {
+        func(static_cast<searchMessagesFilterVideo &>(obj));
+        return true;
+      }
+      break;
+    case 447:
+      if (constructor == countryInfo::ID) {
+        func(static_cast<countryInfo &>(obj));
+        return true;
+      }
+      break;
+    case 448:
+      if (constructor == updateDiceEmojis::ID) {
+        func(static_cast<updateDiceEmojis &>(obj));
+        return true;
+      }
+      break;
+    case 451:
+      if (constructor == messageChatJoinByRequest::ID) {
+        func(static_cast<messageChatJoinByRequest &>(obj));
+        return true;
+      }
+      if (constructor == pushMessageContentSticker::ID) {
+        func(static_cast<pushMessageContentSticker &>(obj));
+        return true;
+      }
+      if (constructor == searchMessagesFilterVoiceAndVideoNote::ID) {
+        func(static_cast<searchMessagesFilterVoiceAndVideoNote &>(obj));
+        return true;
+      }
+      break;
+    case 453:
+      if (constructor == chatActionBarReportUnrelatedLocation::ID) {
+        func(static_cast<chatActionBarReportUnrelatedLocation &>(obj));
+        return true;
+      }
+      break;
+    case 457:
+      if (constructor == inlineQueryResults::ID) {
+        func(static_cast<inlineQueryResults &>(obj));
+        return true;
+      }
+      break;
+    case 458:
+      if (constructor == inputPassportElementErrorSourceTranslationFile::ID) {
+        func(static_cast<inputPassportElementErrorSourceTranslationFile &>(obj));
+        return true;
+      }
+      break;
+    case 461:
+      if (constructor == inputMessageAnimation::ID) {
+        func(static_cast<inputMessageAnimation &>(obj));
+        return true;
+      }
+      break;
+    case 462:
+      if (constructor == backgroundTypePattern::ID) {
+        func(static_cast<backgroundTypePattern &>(obj));
+        return true;
+      }
+      if (constructor == chatStatisticsMessageInteractionInfo::ID) {
+        func(static_cast<chatStatisticsMessageInteractionInfo &>(obj));
+        return true;
+      }
+      if (constructor == customRequestResult::ID) {
+        func(static_cast<customRequestResult &>(obj));
+        return true;
+      }
+      break;
+    case 464:
+      if (constructor == userStatusOffline::ID) {
+        func(static_cast<userStatusOffline &>(obj));
+        return true;
+      }
+      break;
+    case 468:
+      if (constructor == callServer::ID) {
+        func(static_cast<callServer &>(obj));
+        return true;
+      }
+      break;
+    case 470:
+      if (constructor == fileTypeVideoNote::ID) {
+        func(static_cast<fileTypeVideoNote &>(obj));
+        return true;
+      }
+      break;
+    case 472:
+      if (constructor == callDiscardReasonEmpty::ID) {
+        func(static_cast<callDiscardReasonEmpty &>(obj));
+        return true;
+      }
+      break;
+    case 476:
+      if (constructor == stickerTypeMask::ID) {
+        func(static_cast<stickerTypeMask &>(obj));
+        return true;
+      }
+      if (constructor == updateNotification::ID) {
+        func(static_cast<updateNotification &>(obj));
+        return true;
+      }
+      break;
+    case 481:
+      if (constructor == groupCall::ID) {
+        func(static_cast<groupCall &>(obj));
+        return true;
+      }
+      if (constructor == updateMessageContent::ID) {
+        func(static_cast<updateMessageContent &>(obj));
+        return true;
+      }
+      break;
+    case 482:
+      if (constructor == diceStickersRegular::ID) {
+        func(static_cast<diceStickersRegular &>(obj));
+        return true;
+      }
+      break;
+    case 495:
+      if (constructor == maskPointMouth::ID) {
+        func(static_cast<maskPointMouth &>(obj));
+        return true;
+      }
+      break;
+    case 499:
+      if (constructor == deviceTokenBlackBerryPush::ID) {
+        func(static_cast<deviceTokenBlackBerryPush &>(obj));
+        return true;
+      }
+      break;
+    case 503:
+      if (constructor == chatEventVideoChatMuteNewParticipantsToggled::ID) {
+        func(static_cast<chatEventVideoChatMuteNewParticipantsToggled &>(obj));
+        return true;
+      }
+      break;
+    case 504:
+      if (constructor == updateOption::ID) {
+        func(static_cast<updateOption &>(obj));
+        return true;
+      }
+      break;
+    case 507:
+      if (constructor == pageBlockPullQuote::ID) {
+        func(static_cast<pageBlockPullQuote &>(obj));
+        return true;
+      }
+      break;
+    case 510:
+      if (constructor == updateUsersNearby::ID) {
+        func(static_cast<updateUsersNearby &>(obj));
+        return true;
+      }
+      break;
+    case 514:
+      if (constructor == chatNotificationSettings::ID) {
+        func(static_cast<chatNotificationSettings &>(obj));
+        return true;
+      }
+      break;
+    case 516:
+      if (constructor == messageForwardOriginUser::ID) {
+        func(static_cast<messageForwardOriginUser &>(obj));
+        return true;
+      }
+      break;
+    case 517:
+      if (constructor == chatEventPollStopped::ID) {
+        func(static_cast<chatEventPollStopped &>(obj));
+        return true;
+      }
+      if (constructor == chatStatisticsMessageSenderInfo::ID) {
+        func(static_cast<chatStatisticsMessageSenderInfo &>(obj));
+        return true;
+      }
+      break;
+    case 518:
+      if (constructor == chatActionBarSharePhoneNumber::ID) {
+        func(static_cast<chatActionBarSharePhoneNumber &>(obj));
+        return true;
+      }
+      if (constructor == messageSenders::ID) {
+        func(static_cast<messageSenders &>(obj));
+        return true;
+      }
+      if (constructor == messages::ID) {
+        func(static_cast<messages &>(obj));
+        return true;
+      }
+      break;
+    case 521:
+      if (constructor == updateUnreadChatCount::ID) {
+        func(static_cast<updateUnreadChatCount &>(obj));
+        return true;
+      }
+      break;
+    case 523:
+      if (constructor == callbackQueryAnswer::ID) {
+        func(static_cast<callbackQueryAnswer &>(obj));
+        return true;
+      }
+      break;
+    case 524:
+      if (constructor == chatReportReasonChildAbuse::ID) {
+        func(static_cast<chatReportReasonChildAbuse &>(obj));
+        return true;
+      }
+      if (constructor == gameHighScore::ID) {
+        func(static_cast<gameHighScore &>(obj));
+        return true;
+      }
+      break;
+    case 533:
+      if (constructor == messageForwardOriginChat::ID) {
+        func(static_cast<messageForwardOriginChat &>(obj));
+        return true;
+      }
+      break;
+    case 535:
+      if (constructor == inputMessageSticker::ID) {
+        func(static_cast<inputMessageSticker &>(obj));
+        return true;
+      }
+      if (constructor == passportElementDriverLicense::ID) {
+        func(static_cast<passportElementDriverLicense &>(obj));
+        return true;
+      }
+      break;
+    case 538:
+      if (constructor == jsonValueObject::ID) {
+        func(static_cast<jsonValueObject &>(obj));
+        return true;
+      }
+      if (constructor == userFullInfo::ID) {
+        func(static_cast<userFullInfo &>(obj));
+        return true;
+      }
+      break;
+    case 539:
+      if (constructor == inputPassportElementErrorSourceUnspecified::ID) {
+        func(static_cast<inputPassportElementErrorSourceUnspecified &>(obj));
+        return true;
+      }
+      break;
+    case 543:
+      if (constructor == chatActionUploadingVideoNote::ID) {
+        func(static_cast<chatActionUploadingVideoNote &>(obj));
+        return true;
+      }
+      if (constructor == chatStatisticsInviterInfo::ID) {
+        func(static_cast<chatStatisticsInviterInfo &>(obj));
+        return true;
+      }
+      break;
+    case 544:
+      if (constructor == pageBlockRelatedArticle::ID) {
+        func(static_cast<pageBlockRelatedArticle &>(obj));
+        return true;
+      }
+      break;
+    case 553:
+      if (constructor == callProblemInterruptions::ID) {
+        func(static_cast<callProblemInterruptions &>(obj));
+        return true;
+      }
+      break;
+    case 559:
+      if (constructor == messageVenue::ID) {
+        func(static_cast<messageVenue &>(obj));
+        return true;
+      }
+      break;
+    case 561:
+      if (constructor == passportElementTypeDriverLicense::ID) {
+        func(static_cast<passportElementTypeDriverLicense &>(obj));
+        return true;
+      }
+      break;
+    case 565:
+      if (constructor == richTextEmailAddress::ID) {
+        func(static_cast<richTextEmailAddress &>(obj));
+        return true;
+      }
+      break;
+    case 567:
+      if (constructor == fileTypeSecure::ID) {
+        func(static_cast<fileTypeSecure &>(obj));
+        return true;
+      }
+      if (constructor == paymentForm::ID) {
+        func(static_cast<paymentForm &>(obj));
+        return true;
+      }
+      break;
+    case 568:
+      if (constructor == messageAnimation::ID) {
+        func(static_cast<messageAnimation &>(obj));
+        return true;
+      }
+      if (constructor == pollOption::ID) {
+        func(static_cast<pollOption &>(obj));
+        return true;
+      }
+      break;
+    case 569:
+      if (constructor == pageBlockChatLink::ID) {
+        func(static_cast<pageBlockChatLink &>(obj));
+        return true;
+      }
+      break;
+    case 572:
+      if (constructor == callProblemDistortedSpeech::ID) {
+        func(static_cast<callProblemDistortedSpeech &>(obj));
+        return true;
+      }
+      break;
+    case 575:
+      if (constructor == chatActionBarReportSpam::ID) {
+        func(static_cast<chatActionBarReportSpam &>(obj));
+        return true;
+      }
+      if (constructor == identityDocument::ID) {
+        func(static_cast<identityDocument &>(obj));
+        return true;
+      }
+      break;
+    case 579:
+      if (constructor == chatMembersFilterBanned::ID) {
+        func(static_cast<chatMembersFilterBanned &>(obj));
+        return true;
+      }
+      break;
+    case 582:
+      if (constructor == chatMembersFilterRestricted::ID) {
+        func(static_cast<chatMembersFilterRestricted &>(obj));
+        return true;
+      }
+      break;
+    case 583:
+      if (constructor == updateChatMessageTtl::ID) {
+        func(static_cast<updateChatMessageTtl &>(obj));
+        return true;
+      }
+      break;
+    case 584:
+      if (constructor == fileTypeWallpaper::ID) {
+        func(static_cast<fileTypeWallpaper &>(obj));
+        return true;
+      }
+      break;
+    case 585:
+      if (constructor == webPageInstantView::ID) {
+        func(static_cast<webPageInstantView &>(obj));
+        return true;
+      }
+      break;
+    case 587:
+      if (constructor == messageFileTypePrivate::ID) {
+        func(static_cast<messageFileTypePrivate &>(obj));
+        return true;
+      }
+      if (constructor == updateFileGenerationStart::ID) {
+        func(static_cast<updateFileGenerationStart &>(obj));
+        return true;
+      }
+      break;
+    case 589:
+      if (constructor == chatEventMemberInvited::ID) {
+        func(static_cast<chatEventMemberInvited &>(obj));
+        return true;
+      }
+      if (constructor == updateFileGenerationStop::ID) {
+        func(static_cast<updateFileGenerationStop &>(obj));
+        return true;
+      }
+      break;
+    case 592:
+      if (constructor == supergroupMembersFilterMention::ID) {
+        func(static_cast<supergroupMembersFilterMention &>(obj));
+        return true;
+      }
+      break;
+    case 593:
+      if (constructor == chatEventIsAllHistoryAvailableToggled::ID) {
+        func(static_cast<chatEventIsAllHistoryAvailableToggled &>(obj));
+        return true;
+      }
+      if (constructor == pushMessageContentText::ID) {
+        func(static_cast<pushMessageContentText &>(obj));
+        return true;
+      }
+      break;
+    case 594:
+      if (constructor == updateNewCustomEvent::ID) {
+        func(static_cast<updateNewCustomEvent &>(obj));
+        return true;
+      }
+      break;
+    case 595:
+      if (constructor == inlineKeyboardButtonTypeSwitchInline::ID) {
+        func(static_cast<inlineKeyboardButtonTypeSwitchInline &>(obj));
+        return true;
+      }
+      break;
+    case 596:
+      if (constructor == supergroupMembersFilterBanned::ID) {
+        func(static_cast<supergroupMembersFilterBanned &>(obj));
+        return true;
+      }
+      break;
+    case 605:
+      if (constructor == internalLinkTypeUnsupportedProxy::ID) {
+        func(static_cast<internalLinkTypeUnsupportedProxy &>(obj));
+        return true;
+      }
+      break;
+    case 606:
+      if (constructor == chatActionBarAddContact::ID) {
+        func(static_cast<chatActionBarAddContact &>(obj));
+        return true;
+      }
+      break;
+    case 609:
+      if (constructor == pushMessageContentChatSetTheme::ID) {
+        func(static_cast<pushMessageContentChatSetTheme &>(obj));
+        return true;
+      }
+      break;
+    case 611:
+      if (constructor == messageSchedulingStateSendAtDate::ID) {
+        func(static_cast<messageSchedulingStateSendAtDate &>(obj));
+        return true;
+      }
+      break;
+    case 615:
+      if (constructor == searchMessagesFilterUnreadReaction::ID) {
+        func(static_cast<searchMessagesFilterUnreadReaction &>(obj));
+        return true;
+      }
+      break;
+    case 621:
+      if (constructor == messageSchedulingStateSendWhenOnline::ID) {
+        func(static_cast<messageSchedulingStateSendWhenOnline &>(obj));
+        return true;
+      }
+      break;
+    case 622:
+      if (constructor == authorizationStateWaitRegistration::ID) {
+        func(static_cast<authorizationStateWaitRegistration &>(obj));
+        return true;
+      }
+      if (constructor == messageFileTypeGroup::ID) {
+        func(static_cast<messageFileTypeGroup &>(obj));
+        return true;
+      }
+      break;
+    case 623:
+      if (constructor == messagePosition::ID) {
+        func(static_cast<messagePosition &>(obj));
+        return true;
+      }
+      break;
+    case 624:
+      if (constructor == pageBlockEmbedded::ID) {
+        func(static_cast<pageBlockEmbedded &>(obj));
+        return true;
+      }
+      break;
+    case 625:
+      if (constructor == passportElementUtilityBill::ID) {
+        func(static_cast<passportElementUtilityBill &>(obj));
+        return true;
+      }
+      if (constructor == searchMessagesFilterVoiceNote::ID) {
+        func(static_cast<searchMessagesFilterVoiceNote &>(obj));
+        return true;
+      }
+      break;
+    case 629:
+      if (constructor == thumbnailFormatTgs::ID) {
+        func(static_cast<thumbnailFormatTgs &>(obj));
+        return true;
+      }
+      break;
+    case 633:
+      if (constructor == basicGroupFullInfo::ID) {
+        func(static_cast<basicGroupFullInfo &>(obj));
+        return true;
+      }
+      break;
+    case 640:
+      if (constructor == pushMessageContentDocument::ID) {
+        func(static_cast<pushMessageContentDocument &>(obj));
+        return true;
+      }
+      break;
+    case 641:
+      if (constructor == availableReactions::ID) {
+        func(static_cast<availableReactions &>(obj));
+        return true;
+      }
+      break;
+    case 642:
+      if (constructor == chatEventHasProtectedContentToggled::ID) {
+        func(static_cast<chatEventHasProtectedContentToggled &>(obj));
+        return true;
+      }
+      if (constructor == encryptedCredentials::ID) {
+        func(static_cast<encryptedCredentials &>(obj));
+        return true;
+      }
+      break;
+    case 644:
+      if (constructor == storageStatisticsFast::ID) {
+        func(static_cast<storageStatisticsFast &>(obj));
+        return true;
+      }
+      break;
+    case 645:
+      if (constructor == inlineQueryResultGame::ID) {
+        func(static_cast<inlineQueryResultGame &>(obj));
+        return true;
+      }
+      break;
+    case 647:
+      if (constructor == hashtags::ID) {
+        func(static_cast<hashtags &>(obj));
+        return true;
+      }
+      break;
+    case 649:
+      if (constructor == chatLocation::ID) {
+        func(static_cast<chatLocation &>(obj));
+        return true;
+      }
+      break;
+    case 650:
+      if (constructor == authorizationStateClosed::ID) {
+        func(static_cast<authorizationStateClosed &>(obj));
+        return true;
+      }
+      if (constructor == fileTypeSecret::ID) {
+        func(static_cast<fileTypeSecret &>(obj));
+        return true;
+      }
+      break;
+    case 651:
+      if (constructor == messageSenderChat::ID) {
+        func(static_cast<messageSenderChat &>(obj));
+        return true;
+      }
+      break;
+    case 655:
+      if (constructor == chatPosition::ID) {
+        func(static_cast<chatPosition &>(obj));
+        return true;
+      }
+      break;
+    case 657:
+      if (constructor == chatMemberStatusLeft::ID) {
+        func(static_cast<chatMemberStatusLeft &>(obj));
+        return true;
+      }
+      if (constructor == updateAnimatedEmojiMessageClicked::ID) {
+        func(static_cast<updateAnimatedEmojiMessageClicked &>(obj));
+        return true;
+      }
+      break;
+    case 658:
+      if (constructor == messageChatChangeTitle::ID) {
+        func(static_cast<messageChatChangeTitle &>(obj));
+        return true;
+      }
+      break;
+    case 663:
+      if (constructor == pageBlockCollage::ID) {
+        func(static_cast<pageBlockCollage &>(obj));
+        return true;
+      }
+      if (constructor == userPrivacySettingAllowFindingByPhoneNumber::ID) {
+        func(static_cast<userPrivacySettingAllowFindingByPhoneNumber &>(obj));
+        return true;
+      }
+      break;
+    case 666:
+      if (constructor == updateChatNotificationSettings::ID) {
+        func(static_cast<updateChatNotificationSettings &>(obj));
+        return true;
+      }
+      break;
+    case 667:
+      if (constructor == authorizationStateWaitTdlibParameters::ID) {
+        func(static_cast<authorizationStateWaitTdlibParameters &>(obj));
+        return true;
+      }
+      break;
+    case 672:
+      if (constructor == maskPointEyes::ID) {
+        func(static_cast<maskPointEyes &>(obj));
+        return true;
+      }
+      break;
+    case 673:
+      if (constructor == backgrounds::ID) {
+        func(static_cast<backgrounds &>(obj));
+        return true;
+      }
+      if (constructor == chatActionTyping::ID) {
+        func(static_cast<chatActionTyping &>(obj));
+        return true;
+      }
+      break;
+    case 674:
+      if (constructor == pushMessageContentContactRegistered::ID) {
+        func(static_cast<pushMessageContentContactRegistered &>(obj));
+        return true;
+      }
+      break;
+    case 677:
+      if (constructor == labeledPricePart::ID) {
+        func(static_cast<labeledPricePart &>(obj));
+        return true;
+      }
+      break;
+    case 679:
+      if (constructor == fileTypePhoto::ID) {
+        func(static_cast<fileTypePhoto &>(obj));
+        return true;
+      }
+      break;
+    case 680:
+      if (constructor == chatEventInvitesToggled::ID) {
+        func(static_cast<chatEventInvitesToggled &>(obj));
+        return true;
+      }
+      break;
+    case 681:
+      if (constructor == inputInlineQueryResultAudio::ID) {
+        func(static_cast<inputInlineQueryResultAudio &>(obj));
+        return true;
+      }
+      break;
+    case 684:
+      if (constructor == messagePhoto::ID) {
+        func(static_cast<messagePhoto &>(obj));
+        return true;
+      }
+      break;
+    case 688:
+      if (constructor == updateScopeNotificationSettings::ID) {
+        func(static_cast<updateScopeNotificationSettings &>(obj));
+        return true;
+      }
+      break;
+    case 692:
+      if (constructor == notificationTypeNewPushMessage::ID) {
+        func(static_cast<notificationTypeNewPushMessage &>(obj));
+        return true;
+      }
+      break;
+    case 693:
+      if (constructor == messageForwardInfo::ID) {
+        func(static_cast<messageForwardInfo &>(obj));
+        return true;
+      }
+      break;
+    case 694:
+      if (constructor == richTextAnchorLink::ID) {
+        func(static_cast<richTextAnchorLink &>(obj));
+        return true;
+      }
+      break;
+    case 695:
+      if (constructor == videoChat::ID) {
+        func(static_cast<videoChat &>(obj));
+        return true;
+      }
+      break;
+    case 697:
+      if (constructor == inlineQueryResultLocation::ID) {
+        func(static_cast<inlineQueryResultLocation &>(obj));
+        return true;
+      }
+      break;
+    case 698:
+      if (constructor == messageChatUpgradeTo::ID) {
+        func(static_cast<messageChatUpgradeTo &>(obj));
+        return true;
+      }
+      if (constructor == pageBlockPreformatted::ID) {
+        func(static_cast<pageBlockPreformatted &>(obj));
+        return true;
+      }
+      break;
+    case 699:
+      if (constructor == passportElementErrorSourceFile::ID) {
+        func(static_cast<passportElementErrorSourceFile &>(obj));
+        return true;
+      }
+      break;
+    case 709:
+      if (constructor == updateUser::ID) {
+        func(static_cast<updateUser &>(obj));
+        return true;
+      }
+      break;
+    case 710:
+      if (constructor == callStateDiscarded::ID) {
+        func(static_cast<callStateDiscarded &>(obj));
+        return true;
+      }
+      break;
+    case 716:
+      if (constructor == internalLinkTypeUnknownDeepLink::ID) {
+        func(static_cast<internalLinkTypeUnknownDeepLink &>(obj));
+        return true;
+      }
+      break;
+    case 721:
+      if (constructor == topChatCategoryChannels::ID) {
+        func(static_cast<topChatCategoryChannels &>(obj));
+        return true;
+      }
+      break;
+    case 723:
+      if (constructor == inputMessageInvoice::ID) {
+        func(static_cast<inputMessageInvoice &>(obj));
+        return true;
+      }
+      break;
+    case 728:
+      if (constructor == messageText::ID) {
+        func(static_cast<messageText &>(obj));
+        return true;
+      }
+      break;
+    case 729:
+      if (constructor == chatEventTitleChanged::ID) {
+        func(static_cast<chatEventTitleChanged &>(obj));
+        return true;
+      }
+      break;
+    case 731:
+      if (constructor == groupCallId::ID) {
+        func(static_cast<groupCallId &>(obj));
+        return true;
+      }
+      break;
+    case 732:
+      if (constructor == jsonValueBoolean::ID) {
+        func(static_cast<jsonValueBoolean &>(obj));
+        return true;
+      }
+      break;
+    case 734:
+      if (constructor == chatEventPhotoChanged::ID) {
+        func(static_cast<chatEventPhotoChanged &>(obj));
+        return true;
+      }
+      break;
+    case 735:
+      if (constructor == statisticalGraphAsync::ID) {
+        func(static_cast<statisticalGraphAsync &>(obj));
+        return true;
+      }
+      break;
+    case 737:
+      if (constructor == chatEventMessageTtlChanged::ID) {
+        func(static_cast<chatEventMessageTtlChanged &>(obj));
+        return true;
+      }
+      break;
+    case 744:
+      if (constructor == chatInviteLinks::ID) {
+        func(static_cast<chatInviteLinks &>(obj));
+        return true;
+      }
+      if (constructor == messageCall::ID) {
+        func(static_cast<messageCall &>(obj));
+        return true;
+      }
+      if (constructor == pageBlockDetails::ID) {
+        func(static_cast<pageBlockDetails &>(obj));
+        return true;
+      }
+      break;
+    case 748:
+      if (constructor == richTextBold::ID) {
+        func(static_cast<richTextBold &>(obj));
+        return true;
+      }
+      break;
+    case 750:
+      if (constructor == passportElementErrorSourceUnspecified::ID) {
+        func(static_cast<passportElementErrorSourceUnspecified &>(obj));
+        return true;
+      }
+      break;
+    case 751:
+      if (constructor == passportElementTypeUtilityBill::ID) {
+        func(static_cast<passportElementTypeUtilityBill &>(obj));
+        return true;
+      }
+      break;
+    case 757:
+      if (constructor == textParseModeHTML::ID) {
+        func(static_cast<textParseModeHTML &>(obj));
+        return true;
+      }
+      break;
+    case 759:
+      if (constructor == messageDocument::ID) {
+        func(static_cast<messageDocument &>(obj));
+        return true;
+      }
+      break;
+    case 760:
+      if (constructor == updateNewCallbackQuery::ID) {
+        func(static_cast<updateNewCallbackQuery &>(obj));
+        return true;
+      }
+      break;
+    case 761:
+      if (constructor == chatJoinRequests::ID) {
+        func(static_cast<chatJoinRequests &>(obj));
+        return true;
+      }
+      break;
+    case 765:
+      if (constructor == messageLocation::ID) {
+        func(static_cast<messageLocation &>(obj));
+        return true;
+      }
+      break;
+    case 767:
+      if (constructor == thumbnailFormatJpeg::ID) {
+        func(static_cast<thumbnailFormatJpeg &>(obj));
+        return true;
+      }
+      break;
+    case 769:
+      if (constructor == messageCopyOptions::ID) {
+        func(static_cast<messageCopyOptions &>(obj));
+        return true;
+      }
+      break;
+    case 770:
+      if (constructor == botCommandScopeAllGroupChats::ID) {
+        func(static_cast<botCommandScopeAllGroupChats &>(obj));
+        return true;
+      }
+      break;
+    case 771:
+      if (constructor == updateChatAvailableReactions::ID) {
+        func(static_cast<updateChatAvailableReactions &>(obj));
+        return true;
+      }
+      break;
+    case 776:
+      if (constructor == updateMessageInteractionInfo::ID) {
+        func(static_cast<updateMessageInteractionInfo &>(obj));
+        return true;
+      }
+      break;
+    case 778:
+      if (constructor == chatActionStartPlayingGame::ID) {
+        func(static_cast<chatActionStartPlayingGame &>(obj));
+        return true;
+      }
+      break;
+    case 779:
+      if (constructor == botCommandScopeChat::ID) {
+        func(static_cast<botCommandScopeChat &>(obj));
+        return true;
+      }
+      break;
+    case 788:
+      if (constructor == foundMessages::ID) {
+        func(static_cast<foundMessages &>(obj));
+        return true;
+      }
+      break;
+    case 790:
+      if (constructor == pageBlockAnimation::ID) {
+        func(static_cast<pageBlockAnimation &>(obj));
+        return true;
+      }
+      break;
+    case 792:
+      if (constructor == loginUrlInfoOpen::ID) {
+        func(static_cast<loginUrlInfoOpen &>(obj));
+        return true;
+      }
+      if (constructor == notificationGroupTypeMentions::ID) {
+        func(static_cast<notificationGroupTypeMentions &>(obj));
+        return true;
+      }
+      break;
+    case 798:
+      if (constructor == botCommandScopeAllPrivateChats::ID) {
+        func(static_cast<botCommandScopeAllPrivateChats &>(obj));
+        return true;
+      }
+      break;
+    case 800:
+      if (constructor == updateChatDraftMessage::ID) {
+        func(static_cast<updateChatDraftMessage &>(obj));
+        return true;
+      }
+      break;
+    case 803:
+      if (constructor == richTextMarked::ID) {
+        func(static_cast<richTextMarked &>(obj));
+        return true;
+      }
+      break;
+    case 806:
+      if (constructor == supergroupMembersFilterRecent::ID) {
+        func(static_cast<supergroupMembersFilterRecent &>(obj));
+        return true;
+      }
+      if (constructor == updateChatOnlineMemberCount::ID) {
+        func(static_cast<updateChatOnlineMemberCount &>(obj));
+        return true;
+      }
+      break;
+    case 810:
+      if (constructor == proxyTypeHttp::ID) {
+        func(static_cast<proxyTypeHttp &>(obj));
+        return true;
+      }
+      break;
+    case 812:
+      if (constructor == chatActionUploadingDocument::ID) {
+        func(static_cast<chatActionUploadingDocument &>(obj));
+        return true;
+      }
+      break;
+    case 813:
+      if (constructor == updateNewCustomQuery::ID) {
+        func(static_cast<updateNewCustomQuery &>(obj));
+        return true;
+      }
+      break;
+    case 817:
+      if (constructor == messageExpiredVideo::ID) {
+        func(static_cast<messageExpiredVideo &>(obj));
+        return true;
+      }
+      break;
+    case 818:
+      if (constructor == addedReaction::ID) {
+        func(static_cast<addedReaction &>(obj));
+        return true;
+      }
+      break;
+    case 819:
+      if (constructor == networkTypeWiFi::ID) {
+        func(static_cast<networkTypeWiFi &>(obj));
+        return true;
+      }
+      break;
+    case 825:
+      if (constructor == messageSupergroupChatCreate::ID) {
+        func(static_cast<messageSupergroupChatCreate &>(obj));
+        return true;
+      }
+      if (constructor == updateChatPendingJoinRequests::ID) {
+        func(static_cast<updateChatPendingJoinRequests &>(obj));
+        return true;
+      }
+      break;
+    case 828:
+      if (constructor == internalLinkTypeChangePhoneNumber::ID) {
+        func(static_cast<internalLinkTypeChangePhoneNumber &>(obj));
+        return true;
+      }
+      if (constructor == pageBlockTable::ID) {
+        func(static_cast<pageBlockTable &>(obj));
+        return true;
+      }
+      break;
+    case 834:
+      if (constructor == optionValueInteger::ID) {
+        func(static_cast<optionValueInteger &>(obj));
+        return true;
+      }
+      break;
+    case 839:
+      if (constructor == sponsoredMessage::ID) {
+        func(static_cast<sponsoredMessage &>(obj));
+        return true;
+      }
+      break;
+    case 841:
+      if (constructor == userPrivacySettingRuleAllowAll::ID) {
+        func(static_cast<userPrivacySettingRuleAllowAll &>(obj));
+        return true;
+      }
+      break;
+    case 844:
+      if (constructor == textEntityTypePhoneNumber::ID) {
+        func(static_cast<textEntityTypePhoneNumber &>(obj));
+        return true;
+      }
+      break;
+    case 851:
+      if (constructor == addedReactions::ID) {
+        func(static_cast<addedReactions &>(obj));
+        return true;
+      }
+      break;
+    case 853:
+      if (constructor == callbackQueryPayloadDataWithPassword::ID) {
+        func(static_cast<callbackQueryPayloadDataWithPassword &>(obj));
+        return true;
+      }
+      break;
+    case 858:
+      if (constructor == inputPersonalDocument::ID) {
+        func(static_cast<inputPersonalDocument &>(obj));
+        return true;
+      }
+      break;
+    case 859:
+      if (constructor == updateUnreadMessageCount::ID) {
+        func(static_cast<updateUnreadMessageCount &>(obj));
+        return true;
+      }
+      break;
+    case 861:
+      if (constructor == notificationGroupTypeCalls::ID) {
+        func(static_cast<notificationGroupTypeCalls &>(obj));
+        return true;
+      }
+      break;
+    case 863:
+      if (constructor == callId::ID) {
+        func(static_cast<callId &>(obj));
+        return true;
+      }
+      if (constructor == updateChatPosition::ID) {
+        func(static_cast<updateChatPosition &>(obj));
+        return true;
+      }
+      break;
+    case 867:
+      if (constructor == inputMessagePhoto::ID) {
+        func(static_cast<inputMessagePhoto &>(obj));
+        return true;
+      }
+      break;
+    case 868:
+      if (constructor == updateChatTheme::ID) {
+        func(static_cast<updateChatTheme &>(obj));
+        return true;
+      }
+      break;
+    case 872:
+      if (constructor == inlineKeyboardButtonTypeUser::ID) {
+        func(static_cast<inlineKeyboardButtonTypeUser &>(obj));
+        return true;
+      }
+      if (constructor == messageWebsiteConnected::ID) {
+        func(static_cast<messageWebsiteConnected &>(obj));
+        return true;
+      }
+      break;
+    case 873:
+      if (constructor == authorizationStateWaitEncryptionKey::ID) {
+        func(static_cast<authorizationStateWaitEncryptionKey &>(obj));
+        return true;
+      }
+      break;
+    case 876:
+      if (constructor == optionValueBoolean::ID) {
+        func(static_cast<optionValueBoolean &>(obj));
+        return true;
+      }
+      break;
+    case 877:
+      if (constructor == deviceTokenWindowsPush::ID) {
+        func(static_cast<deviceTokenWindowsPush &>(obj));
+        return true;
+      }
+      break;
+    case 878:
+      if (constructor == maskPosition::ID) {
+        func(static_cast<maskPosition &>(obj));
+        return true;
+      }
+      break;
+    case 888:
+      if (constructor == updateMessageLiveLocationViewed::ID) {
+        func(static_cast<updateMessageLiveLocationViewed &>(obj));
+        return true;
+      }
+      break;
+    case 889:
+      if (constructor == authorizationStateWaitPassword::ID) {
+        func(static_cast<authorizationStateWaitPassword &>(obj));
+        return true;
+      }
+      break;
+    case 892:
+      if (constructor == messageCalendarDay::ID) {
+        func(static_cast<messageCalendarDay &>(obj));
+        return true;
+      }
+      break;
+    case 895:
+      if (constructor == richTextSuperscript::ID) {
+        func(static_cast<richTextSuperscript &>(obj));
+        return true;
+      }
+      break;
+    case 897:
+      if (constructor == updateChatReadInbox::ID) {
+        func(static_cast<updateChatReadInbox &>(obj));
+        return true;
+      }
+      break;
+    case 898:
+      if (constructor == inputCredentialsNew::ID) {
+        func(static_cast<inputCredentialsNew &>(obj));
+        return true;
+      }
+      break;
+    case 903:
+      if (constructor == inlineQueryResultContact::ID) {
+        func(static_cast<inlineQueryResultContact &>(obj));
+        return true;
+      }
+      break;
+    case 907:
+      if (constructor == inlineKeyboardButtonTypeCallbackGame::ID) {
+        func(static_cast<inlineKeyboardButtonTypeCallbackGame &>(obj));
+        return true;
+      }
+      if (constructor == notificationGroupTypeMessages::ID) {
+        func(static_cast<notificationGroupTypeMessages &>(obj));
+        return true;
+      }
+      break;
+    case 910:
+      if (constructor == updateNewInlineCallbackQuery::ID) {
+        func(static_cast<updateNewInlineCallbackQuery &>(obj));
+        return true;
+      }
+      break;
+    case 911:
+      if (constructor == passportElementTemporaryRegistration::ID) {
+        func(static_cast<passportElementTemporaryRegistration &>(obj));
+        return true;
+      }
+      break;
+    case 912:
+      if (constructor == inputMessageVoiceNote::ID) {
+        func(static_cast<inputMessageVoiceNote &>(obj));
+        return true;
+      }
+      break;
+    case 915:
+      if (constructor == messageVoiceNote::ID) {
+        func(static_cast<messageVoiceNote &>(obj));
+        return true;
+      }
+      break;
+    case 916:
+      if (constructor == passportElementsWithErrors::ID) {
+        func(static_cast<passportElementsWithErrors &>(obj));
+        return true;
+      }
+      break;
+    case 920:
+      if (constructor == updateAuthorizationState::ID) {
+        func(static_cast<updateAuthorizationState &>(obj));
+        return true;
+      }
+      if (constructor == userPrivacySettingShowProfilePhoto::ID) {
+        func(static_cast<userPrivacySettingShowProfilePhoto &>(obj));
+        return true;
+      }
+      break;
+    case 923:
+      if (constructor == savedCredentials::ID) {
+        func(static_cast<savedCredentials &>(obj));
+        return true;
+      }
+      break;
+    case 924:
+      if (constructor == session::ID) {
+        func(static_cast<session &>(obj));
+        return true;
+      }
+      break;
+    case 928:
+      if (constructor == suggestedActionCheckPassword::ID) {
+        func(static_cast<suggestedActionCheckPassword &>(obj));
+        return true;
+      }
+      if (constructor == textEntityTypePreCode::ID) {
+        func(static_cast<textEntityTypePreCode &>(obj));
+        return true;
+      }
+      break;
+    case 930:
+      if (constructor == internalLinkTypeMessage::ID) {
+        func(static_cast<internalLinkTypeMessage &>(obj));
+        return true;
+      }
+      if (constructor == stickerSets::ID) {
+        func(static_cast<stickerSets &>(obj));
+        return true;
+      }
+      break;
+    case 931:
+      if (constructor == pollTypeRegular::ID) {
+        func(static_cast<pollTypeRegular &>(obj));
+        return true;
+      }
+      break;
+    case 934:
+      if (constructor == passportElementPersonalDetails::ID) {
+        func(static_cast<passportElementPersonalDetails &>(obj));
+        return true;
+      }
+      break;
+    case 935:
+      if (constructor == inlineKeyboardButtonTypeCallbackWithPassword::ID) {
+        func(static_cast<inlineKeyboardButtonTypeCallbackWithPassword &>(obj));
+        return true;
+      }
+      if (constructor == logVerbosityLevel::ID) {
+        func(static_cast<logVerbosityLevel &>(obj));
+        return true;
+      }
+      if (constructor == updateUserFullInfo::ID) {
+        func(static_cast<updateUserFullInfo &>(obj));
+        return true;
+      }
+      break;
+    case 936:
+      if (constructor == supergroupMembersFilterContacts::ID) {
+        func(static_cast<supergroupMembersFilterContacts &>(obj));
+        return true;
+      }
+      break;
+    case 941:
+      if (constructor == passportElementTypePhoneNumber::ID) {
+        func(static_cast<passportElementTypePhoneNumber &>(obj));
+        return true;
+      }
+      break;
+    case 942:
+      if (constructor == proxies::ID) {
+        func(static_cast<proxies &>(obj));
+        return true;
+      }
+      if (constructor == proxy::ID) {
+        func(static_cast<proxy &>(obj));
+        return true;
+      }
+      break;
+    case 946:
+      if (constructor == passportElementTypePassportRegistration::ID) {
+        func(static_cast<passportElementTypePassportRegistration &>(obj));
+        return true;
+      }
+      break;
+    case 949:
+      if (constructor == supergroupMembersFilterBots::ID) {
+        func(static_cast<supergroupMembersFilterBots &>(obj));
+        return true;
+      }
+      break;
+    case 950:
+      if (constructor == chatReportReasonUnrelatedLocation::ID) {
+        func(static_cast<chatReportReasonUnrelatedLocation &>(obj));
+        return true;
+      }
+      break;
+    case 952:
+      if (constructor == messageContactRegistered::ID) {
+        func(static_cast<messageContactRegistered &>(obj));
+        return true;
+      }
+      break;
+    case 953:
+      if (constructor == updateRecentStickers::ID) {
+        func(static_cast<updateRecentStickers &>(obj));
+        return true;
+      }
+      break;
+    case 956:
+      if (constructor == pollTypeQuiz::ID) {
+        func(static_cast<pollTypeQuiz &>(obj));
+        return true;
+      }
+      break;
+    case 958:
+      if (constructor == userPrivacySettingRuleAllowChatMembers::ID) {
+        func(static_cast<userPrivacySettingRuleAllowChatMembers &>(obj));
+        return true;
+      }
+      break;
+    case 959:
+      if (constructor == messageVideoChatScheduled::ID) {
+        func(static_cast<messageVideoChatScheduled &>(obj));
+        return true;
+      }
+      break;
+    case 960:
+      if (constructor == updateMessageIsPinned::ID) {
+        func(static_cast<updateMessageIsPinned &>(obj));
+        return true;
+      }
+      break;
+    case 962:
+      if (constructor == inputPassportElementErrorSourceReverseSide::ID) {
+        func(static_cast<inputPassportElementErrorSourceReverseSide &>(obj));
+        return true;
+      }
+      break;
+    case 965:
+      if (constructor == internalLinkTypeBotStartInGroup::ID) {
+        func(static_cast<internalLinkTypeBotStartInGroup &>(obj));
+        return true;
+      }
+      break;
+    case 966:
+      if (constructor == notificationSettingsScopePrivateChats::ID) {
+        func(static_cast<notificationSettingsScopePrivateChats &>(obj));
+        return true;
+      }
+      break;
+    case 967:
+      if (constructor == messageReaction::ID) {
+        func(static_cast<messageReaction &>(obj));
+        return true;
+      }
+      break;
+    case 971:
+      if (constructor == pushMessageContentMediaAlbum::ID) {
+        func(static_cast<pushMessageContentMediaAlbum &>(obj));
+        return true;
+      }
+      break;
+    case 980:
+      if (constructor == userStatusLastMonth::ID) {
+        func(static_cast<userStatusLastMonth &>(obj));
+        return true;
+      }
+      break;
+    case 982:
+      if (constructor == messageScreenshotTaken::ID) {
+        func(static_cast<messageScreenshotTaken &>(obj));
+        return true;
+      }
+      break;
+    case 983:
+      if (constructor == passportElementErrorSourceFiles::ID) {
+        func(static_cast<passportElementErrorSourceFiles &>(obj));
+        return true;
+      }
+      break;
+    case 984:
+      if (constructor == passportElementErrorSourceDataField::ID) {
+        func(static_cast<passportElementErrorSourceDataField &>(obj));
+        return true;
+      }
+      break;
+    case 985:
+      if (constructor == inlineQueryResultPhoto::ID) {
+        func(static_cast<inlineQueryResultPhoto &>(obj));
+        return true;
+      }
+      break;
+    case 988:
+      if (constructor == passportElementErrorSourceSelfie::ID) {
+        func(static_cast<passportElementErrorSourceSelfie &>(obj));
+        return true;
+      }
+      break;
+    case 989:
+      if (constructor == fileTypeAudio::ID) {
+        func(static_cast<fileTypeAudio &>(obj));
+        return true;
+      }
+      break;
+    case 994:
+      if (constructor == messageStatistics::ID) {
+        func(static_cast<messageStatistics &>(obj));
+        return true;
+      }
+      break;
+    case 996:
+      if (constructor == chatTypeBasicGroup::ID) {
+        func(static_cast<chatTypeBasicGroup &>(obj));
+        return true;
+      }
+      break;
+    case 997:
+      if (constructor == passportElementErrorSourceTranslationFiles::ID) {
+        func(static_cast<passportElementErrorSourceTranslationFiles &>(obj));
+        return true;
+      }
+      break;
+    case 999:
+      if (constructor == updateChatHasScheduledMessages::ID) {
+        func(static_cast<updateChatHasScheduledMessages &>(obj));
+        return true;
+      }
+      break;
+    case 1000:
+      if (constructor == chatEventUsernameChanged::ID) {
+        func(static_cast<chatEventUsernameChanged &>(obj));
+        return true;
+      }
+      break;
+    case 1001:
+      if (constructor == updateUserStatus::ID) {
+        func(static_cast<updateUserStatus &>(obj));
+        return true;
+      }
+      break;
+    case 1002:
+      if (constructor == languagePackStringValuePluralized::ID) {
+        func(static_cast<languagePackStringValuePluralized &>(obj));
+        return true;
+      }
+      break;
+    case 1004:
+      if (constructor == updateChatLastMessage::ID) {
+        func(static_cast<updateChatLastMessage &>(obj));
+        return true;
+      }
+      break;
+    case 1009:
+      if (constructor == background::ID) {
+        func(static_cast<background &>(obj));
+        return true;
+      }
+      break;
+    case 1011:
+      if (constructor == suggestedActionEnableArchiveAndMuteNewChats::ID) {
+        func(static_cast<suggestedActionEnableArchiveAndMuteNewChats &>(obj));
+        return true;
+      }
+      break;
+    case 1014:
+      if (constructor == internalLinkTypeChatInvite::ID) {
+        func(static_cast<internalLinkTypeChatInvite &>(obj));
+        return true;
+      }
+      break;
+    case 1016:
+      if (constructor == userPrivacySettingRuleAllowUsers::ID) {
+        func(static_cast<userPrivacySettingRuleAllowUsers &>(obj));
+        return true;
+      }
+      break;
+    case 1019:
+      if (constructor == photoSize::ID) {
+        func(static_cast<photoSize &>(obj));
+        return true;
+      }
+      break;
+    case 1021:
+      if (constructor == languagePackStringValueOrdinary::ID) {
+        func(static_cast<languagePackStringValueOrdinary &>(obj));
+        return true;
+      }
+      if (constructor == messagePoll::ID) {
+        func(static_cast<messagePoll &>(obj));
+        return true;
+      }
+      break;
+    case 1022:
+      if (constructor == chatMemberStatusMember::ID) {
+        func(static_cast<chatMemberStatusMember &>(obj));
+        return true;
+      }
+      if (constructor == userPrivacySettingShowStatus::ID) {
+        func(static_cast<userPrivacySettingShowStatus &>(obj));
+        return true;
+      }
+      break;
+    case 1028:
+      if (constructor == chatListFilter::ID) {
+        func(static_cast<chatListFilter &>(obj));
+        return true;
+      }
+      if (constructor == networkStatisticsEntryCall::ID) {
+        func(static_cast<networkStatisticsEntryCall &>(obj));
+        return true;
+      }
+      break;
+    case 1029:
+      if (constructor == inputMessageDice::ID) {
+        func(static_cast<inputMessageDice &>(obj));
+        return true;
+      }
+      break;
+    case 1031:
+      if (constructor == chatMembersFilterAdministrators::ID) {
+        func(static_cast<chatMembersFilterAdministrators &>(obj));
+        return true;
+      }
+      break;
+    case 1034:
+      if (constructor == pageBlockAnchor::ID) {
+        func(static_cast<pageBlockAnchor &>(obj));
+        return true;
+      }
+      break;
+    case 1038:
+      if (constructor == inputInlineQueryResultAnimation::ID) {
+        func(static_cast<inputInlineQueryResultAnimation &>(obj));
+        return true;
+      }
+      break;
+    case 1039:
+      if (constructor == inputPassportElementErrorSourceFiles::ID) {
+        func(static_cast<inputPassportElementErrorSourceFiles &>(obj));
+        return true;
+      }
+      break;
+    case 1043:
+      if (constructor == messageReplyInfo::ID) {
+        func(static_cast<messageReplyInfo &>(obj));
+        return true;
+      }
+      break;
+    case 1045:
+      if (constructor == updateNewMessage::ID) {
+        func(static_cast<updateNewMessage &>(obj));
+        return true;
+      }
+      if (constructor == userStatusOnline::ID) {
+        func(static_cast<userStatusOnline &>(obj));
+        return true;
+      }
+      break;
+    case 1047:
+      if (constructor == chatEvents::ID) {
+        func(static_cast<chatEvents &>(obj));
+        return true;
+      }
+      break;
+    case 1048:
+      if (constructor == authorizationStateWaitPhoneNumber::ID) {
+        func(static_cast<authorizationStateWaitPhoneNumber &>(obj));
+        return true;
+      }
+      break;
+    case 1052:
+      if (constructor == inlineKeyboardButton::ID) {
+        func(static_cast<inlineKeyboardButton &>(obj));
+        return true;
+      }
+      break;
+    case 1053:
+      if (constructor == callProblemNoise::ID) {
+        func(static_cast<callProblemNoise &>(obj));
+        return true;
+      }
+      break;
+    case 1055:
+      if (constructor == inlineKeyboardButtonTypeCallback::ID) {
+        func(static_cast<inlineKeyboardButtonTypeCallback &>(obj));
+        return true;
+      }
+      break;
+    case 1056:
+      if (constructor == internalLinkTypeStickerSet::ID) {
+        func(static_cast<internalLinkTypeStickerSet &>(obj));
+        return true;
+      }
+      break;
+    case 1061:
+      if (constructor == passportElementTypeEmailAddress::ID) {
+        func(static_cast<passportElementTypeEmailAddress &>(obj));
+        return true;
+      }
+      break;
+    case 1066:
+      if (constructor == callDiscardReasonHungUp::ID) {
+        func(static_cast<callDiscardReasonHungUp &>(obj));
+        return true;
+      }
+      break;
+    case 1067:
+      if (constructor == messagePaymentSuccessfulBot::ID) {
+        func(static_cast<messagePaymentSuccessfulBot &>(obj));
+        return true;
+      }
+      if (constructor == pushMessageContentVoiceNote::ID) {
+        func(static_cast<pushMessageContentVoiceNote &>(obj));
+        return true;
+      }
+      break;
+    case 1070:
+      if (constructor == internalLinkTypeThemeSettings::ID) {
+        func(static_cast<internalLinkTypeThemeSettings &>(obj));
+        return true;
+      }
+      break;
+    case 1072:
+      if (constructor == supergroupMembersFilterSearch::ID) {
+        func(static_cast<supergroupMembersFilterSearch &>(obj));
+        return true;
+      }
+      break;
+    case 1078:
+      if (constructor == updateChatPhoto::ID) {
+        func(static_cast<updateChatPhoto &>(obj));
+        return true;
+      }
+      if (constructor == updateNotificationGroup::ID) {
+        func(static_cast<updateNotificationGroup &>(obj));
+        return true;
+      }
+      break;
+    case 1084:
+      if (constructor == userStatusLastWeek::ID) {
+        func(static_cast<userStatusLastWeek &>(obj));
+        return true;
+      }
+      break;
+    case 1086:
+      if (constructor == chatEventPermissionsChanged::ID) {
+        func(static_cast<chatEventPermissionsChanged &>(obj));
+        return true;
+      }
+      if (constructor == messageChatAddMembers::ID) {
+        func(static_cast<messageChatAddMembers &>(obj));
+        return true;
+      }
+      break;
+    case 1089:
+      if (constructor == messageAnimatedEmoji::ID) {
+        func(static_cast<messageAnimatedEmoji &>(obj));
+        return true;
+      }
+      if (constructor == suggestedActionCheckPhoneNumber::ID) {
+        func(static_cast<suggestedActionCheckPhoneNumber &>(obj));
+        return true;
+      }
+      break;
+    case 1091:
+      if (constructor == suggestedActionConvertToBroadcastGroup::ID) {
+        func(static_cast<suggestedActionConvertToBroadcastGroup &>(obj));
+        return true;
+      }
+      break;
+    case 1093:
+      if (constructor == vectorPathCommandCubicBezierCurve::ID) {
+        func(static_cast<vectorPathCommandCubicBezierCurve &>(obj));
+        return true;
+      }
+      break;
+    case 1095:
+      if (constructor == keyboardButton::ID) {
+        func(static_cast<keyboardButton &>(obj));
+        return true;
+      }
+      break;
+    case 1097:
+      if (constructor == authenticationCodeTypeTelegramMessage::ID) {
+        func(static_cast<authenticationCodeTypeTelegramMessage &>(obj));
+        return true;
+      }
+      break;
+    case 1099:
+      if (constructor == canTransferOwnershipResultPasswordTooFresh::ID) {
+        func(static_cast<canTransferOwnershipResultPasswordTooFresh &>(obj));
+        return true;
+      }
+      if (constructor == statisticalValue::ID) {
+        func(static_cast<statisticalValue &>(obj));
+        return true;
+      }
+      break;
+    case 1102:
+      if (constructor == networkTypeMobile::ID) {
+        func(static_cast<networkTypeMobile &>(obj));
+        return true;
+      }
+      break;
+    case 1110:
+      if (constructor == updates::ID) {
+        func(static_cast<updates &>(obj));
+        return true;
+      }
+      break;
+    case 1116:
+      if (constructor == personalDocument::ID) {
+        func(static_cast<personalDocument &>(obj));
+        return true;
+      }
+      break;
+    case 1117:
+      if (constructor == inputPassportElementPassport::ID) {
+        func(static_cast<inputPassportElementPassport &>(obj));
+        return true;
+      }
+      break;
+    case 1122:
+      if (constructor == pageBlockVerticalAlignmentMiddle::ID) {
+        func(static_cast<pageBlockVerticalAlignmentMiddle &>(obj));
+        return true;
+      }
+      if (constructor == pushMessageContentVideo::ID) {
+        func(static_cast<pushMessageContentVideo &>(obj));
+        return true;
+      }
+      break;
+    case 1126:
+      if (constructor == passportElementInternalPassport::ID) {
+        func(static_cast<passportElementInternalPassport &>(obj));
+        return true;
+      }
+      break;
+    case 1127:
+      if (constructor == draftMessage::ID) {
+        func(static_cast<draftMessage &>(obj));
+        return true;
+      }
+      break;
+    case 1129:
+      if (constructor == pageBlockDivider::ID) {
+        func(static_cast<pageBlockDivider &>(obj));
+        return true;
+      }
+      if (constructor == supergroupMembersFilterAdministrators::ID) {
+        func(static_cast<supergroupMembersFilterAdministrators &>(obj));
+        return true;
+      }
+      break;
+    case 1130:
+      if (constructor == remoteFile::ID) {
+        func(static_cast<remoteFile &>(obj));
+        return true;
+      }
+      break;
+    case 1132:
+      if (constructor == updateMessageContentOpened::ID) {
+        func(static_cast<updateMessageContentOpened &>(obj));
+        return true;
+      }
+      break;
+    case 1134:
+      if (constructor == jsonObjectMember::ID) {
+        func(static_cast<jsonObjectMember &>(obj));
+        return true;
+      }
+      break;
+    case 1138:
+      if (constructor == tMeUrls::ID) {
+        func(static_cast<tMeUrls &>(obj));
+        return true;
+      }
+      break;
+    case 1141:
+      if (constructor == pushMessageContentHidden::ID) {
+        func(static_cast<pushMessageContentHidden &>(obj));
+        return true;
+      }
+      break;
+    case 1143:
+      if (constructor == deviceTokenApplePush::ID) {
+        func(static_cast<deviceTokenApplePush &>(obj));
+        return true;
+      }
+      if (constructor == game::ID) {
+        func(static_cast<game &>(obj));
+        return true;
+      }
+      if (constructor == importedContacts::ID) {
+        func(static_cast<importedContacts &>(obj));
+        return true;
+      }
+      break;
+    case 1144:
+      if (constructor == topChatCategoryUsers::ID) {
+        func(static_cast<topChatCategoryUsers &>(obj));
+        return true;
+      }
+      break;
+    case 1147:
+      if (constructor == userPrivacySettingRuleRestrictAll::ID) {
+        func(static_cast<userPrivacySettingRuleRestrictAll &>(obj));
+        return true;
+      }
+      break;
+    case 1148:
+      if (constructor == pushMessageContentPoll::ID) {
+        func(static_cast<pushMessageContentPoll &>(obj));
+        return true;
+      }
+      break;
+    case 1149:
+      if (constructor == passportElementAddress::ID) {
+        func(static_cast<passportElementAddress &>(obj));
+        return true;
+      }
+      break;
+    case 1151:
+      if (constructor == testInt::ID) {
+        func(static_cast<testInt &>(obj));
+        return true;
+      }
+      break;
+    case 1156:
+      if (constructor == groupCallVideoQualityThumbnail::ID) {
+        func(static_cast<groupCallVideoQualityThumbnail &>(obj));
+        return true;
+      }
+      break;
+    case 1160:
+      if (constructor == updateNewChatJoinRequest::ID) {
+        func(static_cast<updateNewChatJoinRequest &>(obj));
+        return true;
+      }
+      break;
+    case 1162:
+      if (constructor == callDiscardReasonDeclined::ID) {
+        func(static_cast<callDiscardReasonDeclined &>(obj));
+        return true;
+      }
+      if (constructor == inlineQueryResultVoiceNote::ID) {
+        func(static_cast<inlineQueryResultVoiceNote &>(obj));
+        return true;
+      }
+      break;
+    case 1163:
+      if (constructor == groupCallParticipantVideoInfo::ID) {
+        func(static_cast<groupCallParticipantVideoInfo &>(obj));
+        return true;
+      }
+      break;
+    case 1166:
+      if (constructor == callStateReady::ID) {
+        func(static_cast<callStateReady &>(obj));
+        return true;
+      }
+      break;
+    case 1168:
+      if (constructor == inlineQueryResultAnimation::ID) {
+        func(static_cast<inlineQueryResultAnimation &>(obj));
+        return true;
+      }
+      if (constructor == recommendedChatFilter::ID) {
+        func(static_cast<recommendedChatFilter &>(obj));
+        return true;
+      }
+      if (constructor == themeSettings::ID) {
+        func(static_cast<themeSettings &>(obj));
+        return true;
+      }
+      break;
+    case 1174:
+      if (constructor == stickerTypeVideo::ID) {
+        func(static_cast<stickerTypeVideo &>(obj));
+        return true;
+      }
+      break;
+    case 1175:
+      if (constructor == chatReportReasonPornography::ID) {
+        func(static_cast<chatReportReasonPornography &>(obj));
+        return true;
+      }
+      if (constructor == stickerTypeStatic::ID) {
+        func(static_cast<stickerTypeStatic &>(obj));
+        return true;
+      }
+      break;
+    case 1176:
+      if (constructor == authenticationCodeTypeFlashCall::ID) {
+        func(static_cast<authenticationCodeTypeFlashCall &>(obj));
+        return true;
+      }
+      if (constructor == chatSourceMtprotoProxy::ID) {
+        func(static_cast<chatSourceMtprotoProxy &>(obj));
+        return true;
+      }
+      if (constructor == phoneNumberInfo::ID) {
+        func(static_cast<phoneNumberInfo &>(obj));
+        return true;
+      }
+      break;
+    case 1177:
+      if (constructor == chat::ID) {
+        func(static_cast<chat &>(obj));
+        return true;
+      }
+      if (constructor == inputInlineQueryResultArticle::ID) {
+        func(static_cast<inputInlineQueryResultArticle &>(obj));
+        return true;
+      }
+      break;
+    case 1179:
+      if (constructor == inputBackgroundRemote::ID) {
+        func(static_cast<inputBackgroundRemote &>(obj));
+        return true;
+      }
+      if (constructor == proxyTypeMtproto::ID) {
+        func(static_cast<proxyTypeMtproto &>(obj));
+        return true;
+      }
+      break;
+    case 1181:
+      if (constructor == chatEventDescriptionChanged::ID) {
+        func(static_cast<chatEventDescriptionChanged &>(obj));
+        return true;
+      }
+      break;
+    case 1184:
+      if (constructor == groupCallVideoSourceGroup::ID) {
+        func(static_cast<groupCallVideoSourceGroup &>(obj));
+        return true;
+      }
+      break;
+    case 1185:
+      if (constructor == updateBasicGroupFullInfo::ID) {
+        func(static_cast<updateBasicGroupFullInfo &>(obj));
+        return true;
+      }
+      break;
+    case 1186:
+      if (constructor == callStateError::ID) {
+        func(static_cast<callStateError &>(obj));
+        return true;
+      }
+      break;
+    case 1188:
+      if (constructor == checkStickerSetNameResultOk::ID) {
+        func(static_cast<checkStickerSetNameResultOk &>(obj));
+        return true;
+      }
+      break;
+    case 1189:
+      if (constructor == inputPassportElementErrorSourceSelfie::ID) {
+        func(static_cast<inputPassportElementErrorSourceSelfie &>(obj));
+        return true;
+      }
+      if (constructor == inputSticker::ID) {
+        func(static_cast<inputSticker &>(obj));
+        return true;
+      }
+      break;
+    case 1190:
+      if (constructor == updateServiceNotification::ID) {
+        func(static_cast<updateServiceNotification &>(obj));
+        return true;
+      }
+      break;
+    case 1191:
+      if (constructor == paymentsProviderStripe::ID) {
+        func(static_cast<paymentsProviderStripe &>(obj));
+        return true;
+      }
+      if (constructor == updateSupergroupFullInfo::ID) {
+        func(static_cast<updateSupergroupFullInfo &>(obj));
+        return true;
+      }
+      break;
+    case 1199:
+      if (constructor == localizationTargetInfo::ID) {
+        func(static_cast<localizationTargetInfo &>(obj));
+        return true;
+      }
+      break;
+    case 1200:
+      if (constructor == sticker::ID) {
+        func(static_cast<sticker &>(obj));
+        return true;
+      }
+      break;
+    case 1201:
+      if (constructor == animatedChatPhoto::ID) {
+        func(static_cast<animatedChatPhoto &>(obj));
+        return true;
+      }
+      if (constructor == pageBlockEmbeddedPost::ID) {
+        func(static_cast<pageBlockEmbeddedPost &>(obj));
+        return true;
+      }
+      break;
+    case 1208:
+      if (constructor == fileTypeSecretThumbnail::ID) {
+        func(static_cast<fileTypeSecretThumbnail &>(obj));
+        return true;
+      }
+      break;
+    case 1212:
+      if (constructor == fileTypeAnimation::ID) {
+        func(static_cast<fileTypeAnimation &>(obj));
+        return true;
+      }
+      break;
+    case 1213:
+      if (constructor == updateChatTitle::ID) {
+        func(static_cast<updateChatTitle &>(obj));
+        return true;
+      }
+      break;
+    case 1214:
+      if (constructor == internalLinkTypeBotStart::ID) {
+        func(static_cast<internalLinkTypeBotStart &>(obj));
+        return true;
+      }
+      break;
+    case 1215:
+      if (constructor == textEntityTypeTextUrl::ID) {
+        func(static_cast<textEntityTypeTextUrl &>(obj));
+        return true;
+      }
+      break;
+    case 1218:
+      if (constructor == searchMessagesFilterUrl::ID) {
+        func(static_cast<searchMessagesFilterUrl &>(obj));
+        return true;
+      }
+      break;
+    case 1223:
+      if (constructor == paymentFormTheme::ID) {
+        func(static_cast<paymentFormTheme &>(obj));
+        return true;
+      }
+      break;
+    case 1227:
+      if (constructor == ok::ID) {
+        func(static_cast<ok &>(obj));
+        return true;
+      }
+      break;
+    case 1229:
+      if (constructor == internalLinkTypePublicChat::ID) {
+        func(static_cast<internalLinkTypePublicChat &>(obj));
+        return true;
+      }
+      break;
+    case 1233:
+      if (constructor == updateGroupCallParticipant::ID) {
+        func(static_cast<updateGroupCallParticipant &>(obj));
+        return true;
+      }
+      break;
+    case 1234:
+      if (constructor == messageForwardOriginChannel::ID) {
+        func(static_cast<messageForwardOriginChannel &>(obj));
+        return true;
+      }
+      break;
+    case 1235:
+      if (constructor == updateMessageEdited::ID) {
+        func(static_cast<updateMessageEdited &>(obj));
+        return true;
+      }
+      break;
+    case 1245:
+      if (constructor == messageBroadcastResults::ID) {
+        func(static_cast<messageBroadcastResults &>(obj));
+        return true;
+      }
+      if (constructor == updateFavoriteStickers::ID) {
+        func(static_cast<updateFavoriteStickers &>(obj));
+        return true;
+      }
+      break;
+    case 1247:
+      if (constructor == pageBlockHeader::ID) {
+        func(static_cast<pageBlockHeader &>(obj));
+        return true;
+      }
+      if (constructor == statisticalGraphData::ID) {
+        func(static_cast<statisticalGraphData &>(obj));
+        return true;
+      }
+      break;
+    case 1248:
+      if (constructor == searchMessagesFilterEmpty::ID) {
+        func(static_cast<searchMessagesFilterEmpty &>(obj));
+        return true;
+      }
+      break;
+    case 1251:
+      if (constructor == inputPassportElementAddress::ID) {
+        func(static_cast<inputPassportElementAddress &>(obj));
+        return true;
+      }
+      break;
+    case 1257:
+      if (constructor == inputChatPhotoPrevious::ID) {
+        func(static_cast<inputChatPhotoPrevious &>(obj));
+        return true;
+      }
+      break;
+    case 1262:
+      if (constructor == updateNewInlineQuery::ID) {
+        func(static_cast<updateNewInlineQuery &>(obj));
+        return true;
+      }
+      break;
+    case 1263:
+      if (constructor == jsonValueNumber::ID) {
+        func(static_cast<jsonValueNumber &>(obj));
+        return true;
+      }
+      break;
+    case 1264:
+      if (constructor == keyboardButtonTypeRequestPhoneNumber::ID) {
+        func(static_cast<keyboardButtonTypeRequestPhoneNumber &>(obj));
+        return true;
+      }
+      break;
+    case 1265:
+      if (constructor == chatFilter::ID) {
+        func(static_cast<chatFilter &>(obj));
+        return true;
+      }
+      if (constructor == pushMessageContentChatChangeTitle::ID) {
+        func(static_cast<pushMessageContentChatChangeTitle &>(obj));
+        return true;
+      }
+      break;
+    case 1269:
+      if (constructor == chatActionChoosingLocation::ID) {
+        func(static_cast<chatActionChoosingLocation &>(obj));
+        return true;
+      }
+      if (constructor == chatListMain::ID) {
+        func(static_cast<chatListMain &>(obj));
+        return true;
+      }
+      break;
+    case 1270:
+      if (constructor == pageBlockTitle::ID) {
+        func(static_cast<pageBlockTitle &>(obj));
+        return true;
+      }
+      break;
+    case 1271:
+      if (constructor == passportElementPassport::ID) {
+        func(static_cast<passportElementPassport &>(obj));
+        return true;
+      }
+      break;
+    case 1273:
+      if (constructor == messageCustomServiceAction::ID) {
+        func(static_cast<messageCustomServiceAction &>(obj));
+        return true;
+      }
+      break;
+    case 1274:
+      if (constructor == messagePinMessage::ID) {
+        func(static_cast<messagePinMessage &>(obj));
+        return true;
+      }
+      break;
+    case 1277:
+      if (constructor == chatPermissions::ID) {
+        func(static_cast<chatPermissions &>(obj));
+        return true;
+      }
+      break;
+    case 1279:
+      if (constructor == storageStatisticsByChat::ID) {
+        func(static_cast<storageStatisticsByChat &>(obj));
+        return true;
+      }
+      break;
+    case 1280:
+      if (constructor == canTransferOwnershipResultPasswordNeeded::ID) {
+        func(static_cast<canTransferOwnershipResultPasswordNeeded &>(obj));
+        return true;
+      }
+      break;
+    case 1281:
+      if (constructor == deviceTokenFirebaseCloudMessaging::ID) {
+        func(static_cast<deviceTokenFirebaseCloudMessaging &>(obj));
+        return true;
+      }
+      if (constructor == photo::ID) {
+        func(static_cast<photo &>(obj));
+        return true;
+      }
+      break;
+    case 1284:
+      if (constructor == botCommands::ID) {
+        func(static_cast<botCommands &>(obj));
+        return true;
+      }
+      break;
+    case 1286:
+      if (constructor == chatListArchive::ID) {
+        func(static_cast<chatListArchive &>(obj));
+        return true;
+      }
+      break;
+    case 1287:
+      if (constructor == inputMessageVenue::ID) {
+        func(static_cast<inputMessageVenue &>(obj));
+        return true;
+      }
+      break;
+    case 1288:
+      if (constructor == updateSuggestedActions::ID) {
+        func(static_cast<updateSuggestedActions &>(obj));
+        return true;
+      }
+      break;
+    case 1296:
+      if (constructor == inlineQueryResultArticle::ID) {
+        func(static_cast<inlineQueryResultArticle &>(obj));
+        return true;
+      }
+      break;
+    case 1298:
+      if (constructor == callProblemSilentRemote::ID) {
+        func(static_cast<callProblemSilentRemote &>(obj));
+        return true;
+      }
+      if (constructor == pageBlockAuthorDate::ID) {
+        func(static_cast<pageBlockAuthorDate &>(obj));
+        return true;
+      }
+      break;
+    case 1302:
+      if (constructor == updateFile::ID) {
+        func(static_cast<updateFile &>(obj));
+        return true;
+      }
+      break;
+    case 1303:
+      if (constructor == messagePaymentSuccessful::ID) {
+        func(static_cast<messagePaymentSuccessful &>(obj));
+        return true;
+      }
+      break;
+    case 1306:
+      if (constructor == inputMessagePoll::ID) {
+        func(static_cast<inputMessagePoll &>(obj));
+        return true;
+      }
+      break;
+    case 1307:
+      if (constructor == chatListSnapshot::ID) {
+        func(static_cast<chatListSnapshot &>(obj));
+        return true;
+      }
+      if (constructor == inputInlineQueryResultPhoto::ID) {
+        func(static_cast<inputInlineQueryResultPhoto &>(obj));
+        return true;
+      }
+      break;
+    case 1309:
+      if (constructor == chatEventMessageUnpinned::ID) {
+        func(static_cast<chatEventMessageUnpinned &>(obj));
+        return true;
+      }
+      break;
+    case 1311:
+      if (constructor == chatAdministrator::ID) {
+        func(static_cast<chatAdministrator &>(obj));
+        return true;
+      }
+      break;
+    case 1316:
+      if (constructor == inputPassportElementRentalAgreement::ID) {
+        func(static_cast<inputPassportElementRentalAgreement &>(obj));
+        return true;
+      }
+      break;
+    case 1318:
+      if (constructor == recoveryEmailAddress::ID) {
+        func(static_cast<recoveryEmailAddress &>(obj));
+        return true;
+      }
+      break;
+    case 1322:
+      if (constructor == callProblemSilentLocal::ID) {
+        func(static_cast<callProblemSilentLocal &>(obj));
+        return true;
+      }
+      break;
+    case 1323:
+      if (constructor == textEntityTypeEmailAddress::ID) {
+        func(static_cast<textEntityTypeEmailAddress &>(obj));
+        return true;
+      }
+      break;
+    case 1331:
+      if (constructor == chatInviteLinkCounts::ID) {
+        func(static_cast<chatInviteLinkCounts &>(obj));
+        return true;
+      }
+      if (constructor == userPrivacySettingShowPhoneNumber::ID) {
+        func(static_cast<userPrivacySettingShowPhoneNumber &>(obj));
+        return true;
+      }
+      break;
+    case 1334:
+      if (constructor == chatEventSlowModeDelayChanged::ID) {
+        func(static_cast<chatEventSlowModeDelayChanged &>(obj));
+        return true;
+      }
+      break;
+    case 1335:
+      if (constructor == pushMessageContentPhoto::ID) {
+        func(static_cast<pushMessageContentPhoto &>(obj));
+        return true;
+      }
+      break;
+    case 1336:
+      if (constructor == pageBlockSlideshow::ID) {
+        func(static_cast<pageBlockSlideshow &>(obj));
+        return true;
+      }
+      break;
+    case 1339:
+      if (constructor == searchMessagesFilterChatPhoto::ID) {
+        func(static_cast<searchMessagesFilterChatPhoto &>(obj));
+        return true;
+      }
+      if (constructor == topChatCategoryGroups::ID) {
+        func(static_cast<topChatCategoryGroups &>(obj));
+        return true;
+      }
+      break;
+    case 1340:
+      if (constructor == inputFileLocal::ID) {
+        func(static_cast<inputFileLocal &>(obj));
+        return true;
+      }
+      break;
+    case 1342:
+      if (constructor == inputInlineQueryResultVoiceNote::ID) {
+        func(static_cast<inputInlineQueryResultVoiceNote &>(obj));
+        return true;
+      }
+      if (constructor == webPage::ID) {
+        func(static_cast<webPage &>(obj));
+        return true;
+      }
+      break;
+    case 1343:
+      if (constructor == inputPassportElementErrorSourceDataField::ID) {
+        func(static_cast<inputPassportElementErrorSourceDataField &>(obj));
+        return true;
+      }
+      break;
+    case 1345:
+      if (constructor == messageAudio::ID) {
+        func(static_cast<messageAudio &>(obj));
+        return true;
+      }
+      break;
+    case 1346:
+      if (constructor == passportElementTypeTemporaryRegistration::ID) {
+        func(static_cast<passportElementTypeTemporaryRegistration &>(obj));
+        return true;
+      }
+      if (constructor == updateChatReplyMarkup::ID) {
+        func(static_cast<updateChatReplyMarkup &>(obj));
+        return true;
+      }
+      break;
+    case 1351:
+      if (constructor == animation::ID) {
+        func(static_cast<animation &>(obj));
+        return true;
+      }
+      break;
+    case 1352:
+      if (constructor == userTypeRegular::ID) {
+        func(static_cast<userTypeRegular &>(obj));
+        return true;
+      }
+      break;
+    case 1354:
+      if (constructor == textEntityTypeCashtag::ID) {
+        func(static_cast<textEntityTypeCashtag &>(obj));
+        return true;
+      }
+      break;
+    case 1356:
+      if (constructor == replyMarkupShowKeyboard::ID) {
+        func(static_cast<replyMarkupShowKeyboard &>(obj));
+        return true;
+      }
+      break;
+    case 1357:
+      if (constructor == chatStatisticsSupergroup::ID) {
+        func(static_cast<chatStatisticsSupergroup &>(obj));
+        return true;
+      }
+      break;
+    case 1358:
+      if (constructor == inputMessageText::ID) {
+        func(static_cast<inputMessageText &>(obj));
+        return true;
+      }
+      break;
+    case 1359:
+      if (constructor == internalLinkTypeSettings::ID) {
+        func(static_cast<internalLinkTypeSettings &>(obj));
+        return true;
+      }
+      if (constructor == messageLink::ID) {
+        func(static_cast<messageLink &>(obj));
+        return true;
+      }
+      break;
+    case 1362:
+      if (constructor == bankCardInfo::ID) {
+        func(static_cast<bankCardInfo &>(obj));
+        return true;
+      }
+      break;
+    case 1363:
+      if (constructor == personalDetails::ID) {
+        func(static_cast<personalDetails &>(obj));
+        return true;
+      }
+      break;
+    case 1365:
+      if (constructor == richTextPhoneNumber::ID) {
+        func(static_cast<richTextPhoneNumber &>(obj));
+        return true;
+      }
+      break;
+    case 1366:
+      if (constructor == authorizationStateWaitOtherDeviceConfirmation::ID) {
+        func(static_cast<authorizationStateWaitOtherDeviceConfirmation &>(obj));
+        return true;
+      }
+      break;
+    case 1367:
+      if (constructor == pageBlockCover::ID) {
+        func(static_cast<pageBlockCover &>(obj));
+        return true;
+      }
+      break;
+    case 1368:
+      if (constructor == internalLinkTypeAuthenticationCode::ID) {
+        func(static_cast<internalLinkTypeAuthenticationCode &>(obj));
+        return true;
+      }
+      break;
+    case 1372:
+      if (constructor == chatFilterInfo::ID) {
+        func(static_cast<chatFilterInfo &>(obj));
+        return true;
+      }
+      break;
+    case 1381:
+      if (constructor == location::ID) {
+        func(static_cast<location &>(obj));
+        return true;
+      }
+      if (constructor == pageBlockListItem::ID) {
+        func(static_cast<pageBlockListItem &>(obj));
+        return true;
+      }
+      if (constructor == updateNewChosenInlineResult::ID) {
+        func(static_cast<updateNewChosenInlineResult &>(obj));
+        return true;
+      }
+      break;
+    case 1388:
+      if (constructor == internalLinkTypeFilterSettings::ID) {
+        func(static_cast<internalLinkTypeFilterSettings &>(obj));
+        return true;
+      }
+      if (constructor == searchMessagesFilterAudio::ID) {
+        func(static_cast<searchMessagesFilterAudio &>(obj));
+        return true;
+      }
+      break;
+    case 1389:
+      if (constructor == localFile::ID) {
+        func(static_cast<localFile &>(obj));
+        return true;
+      }
+      break;
+    case 1390:
+      if (constructor == messageSendingStateFailed::ID) {
+        func(static_cast<messageSendingStateFailed &>(obj));
+        return true;
+      }
+      break;
+    case 1391:
+      if (constructor == updateGroupCall::ID) {
+        func(static_cast<updateGroupCall &>(obj));
+        return true;
+      }
+      break;
+    case 1392:
+      if (constructor == replyMarkupForceReply::ID) {
+        func(static_cast<replyMarkupForceReply &>(obj));
+        return true;
+      }
+      break;
+    case 1393:
+      if (constructor == voiceNote::ID) {
+        func(static_cast<voiceNote &>(obj));
+        return true;
+      }
+      break;
+    case 1395:
+      if (constructor == checkChatUsernameResultUsernameOccupied::ID) {
+        func(static_cast<checkChatUsernameResultUsernameOccupied &>(obj));
+        return true;
+      }
+      if (constructor == secretChat::ID) {
+        func(static_cast<secretChat &>(obj));
+        return true;
+      }
+      break;
+    case 1397:
+      if (constructor == secretChatStatePending::ID) {
+        func(static_cast<secretChatStatePending &>(obj));
+        return true;
+      }
+      break;
+    case 1400:
+      if (constructor == callProblemPixelatedVideo::ID) {
+        func(static_cast<callProblemPixelatedVideo &>(obj));
+        return true;
+      }
+      break;
+    case 1402:
+      if (constructor == connectedWebsite::ID) {
+        func(static_cast<connectedWebsite &>(obj));
+        return true;
+      }
+      if (constructor == testVectorInt::ID) {
+        func(static_cast<testVectorInt &>(obj));
+        return true;
+      }
+      break;
+    case 1403:
+      if (constructor == messageVideo::ID) {
+        func(static_cast<messageVideo &>(obj));
+        return true;
+      }
+      break;
+    case 1404:
+      if (constructor == callProblemDistortedVideo::ID) {
+        func(static_cast<callProblemDistortedVideo &>(obj));
+        return true;
+      }
+      break;
+    case 1406:
+      if (constructor == pushMessageContentLocation::ID) {
+        func(static_cast<pushMessageContentLocation &>(obj));
+        return true;
+      }
+      if (constructor == searchMessagesFilterDocument::ID) {
+        func(static_cast<searchMessagesFilterDocument &>(obj));
+        return true;
+      }
+      if (constructor == updateTermsOfService::ID) {
+        func(static_cast<updateTermsOfService &>(obj));
+        return true;
+      }
+      break;
+    case 1407:
+      if (constructor == autoDownloadSettingsPresets::ID) {
+        func(static_cast<autoDownloadSettingsPresets &>(obj));
+        return true;
+      }
+      break;
+    case 1408:
+      if (constructor == checkStickerSetNameResultNameOccupied::ID) {
+        func(static_cast<checkStickerSetNameResultNameOccupied &>(obj));
+        return true;
+      }
+      break;
+    case 1413:
+      if (constructor == deviceTokenWebPush::ID) {
+        func(static_cast<deviceTokenWebPush &>(obj));
+        return true;
+      }
+      if (constructor == updateChatUnreadMentionCount::ID) {
+        func(static_cast<updateChatUnreadMentionCount &>(obj));
+        return true;
+      }
+      break;
+    case 1414:
+      if (constructor == updateMessageUnreadReactions::ID) {
+        func(static_cast<updateMessageUnreadReactions &>(obj));
+        return true;
+      }
+      break;
+    case 1416:
+      if (constructor == inputMessageDocument::ID) {
+        func(static_cast<inputMessageDocument &>(obj));
+        return true;
+      }
+      break;
+    case 1418:
+      if (constructor == messageGameScore::ID) {
+        func(static_cast<messageGameScore &>(obj));
+        return true;
+      }
+      break;
+    case 1419:
+      if (constructor == audio::ID) {
+        func(static_cast<audio &>(obj));
+        return true;
+      }
+      if (constructor == chatEventMessageEdited::ID) {
+        func(static_cast<chatEventMessageEdited &>(obj));
+        return true;
+      }
+      break;
+    case 1420:
+      if (constructor == chatActionRecordingVideo::ID) {
+        func(static_cast<chatActionRecordingVideo &>(obj));
+        return true;
+      }
+      if (constructor == chatActionRecordingVideoNote::ID) {
+        func(static_cast<chatActionRecordingVideoNote &>(obj));
+        return true;
+      }
+      if (constructor == datedFile::ID) {
+        func(static_cast<datedFile &>(obj));
+        return true;
+      }
+      break;
+    case 1422:
+      if (constructor == connectedWebsites::ID) {
+        func(static_cast<connectedWebsites &>(obj));
+        return true;
+      }
+      break;
+    case 1423:
+      if (constructor == updateChatDefaultDisableNotification::ID) {
+        func(static_cast<updateChatDefaultDisableNotification &>(obj));
+        return true;
+      }
+      break;
+    case 1427:
+      if (constructor == messageChatDeletePhoto::ID) {
+        func(static_cast<messageChatDeletePhoto &>(obj));
+        return true;
+      }
+      break;
+    case 1435:
+      if (constructor == callStateExchangingKeys::ID) {
+        func(static_cast<callStateExchangingKeys &>(obj));
+        return true;
+      }
+      if (constructor == formattedText::ID) {
+        func(static_cast<formattedText &>(obj));
+        return true;
+      }
+      if (constructor == pushMessageContentChatDeleteMember::ID) {
+        func(static_cast<pushMessageContentChatDeleteMember &>(obj));
+        return true;
+      }
+      break;
+    case 1442:
+      if (constructor == jsonValueString::ID) {
+        func(static_cast<jsonValueString &>(obj));
+        return true;
+      }
+      break;
+    case 1443:
+      if (constructor == statisticalGraphError::ID) {
+        func(static_cast<statisticalGraphError &>(obj));
+        return true;
+      }
+      break;
+    case 1444:
+      if (constructor == databaseStatistics::ID) {
+        func(static_cast<databaseStatistics &>(obj));
+        return true;
+      }
+      break;
+    case 1445:
+      if (constructor == inputPassportElementUtilityBill::ID) {
+        func(static_cast<inputPassportElementUtilityBill &>(obj));
+        return true;
+      }
+      break;
+    case 1446:
+      if (constructor == pageBlockAudio::ID) {
+        func(static_cast<pageBlockAudio &>(obj));
+        return true;
+      }
+      if (constructor == passwordState::ID) {
+        func(static_cast<passwordState &>(obj));
+        return true;
+      }
+      break;
+    case 1447:
+      if (constructor == authorizationStateReady::ID) {
+        func(static_cast<authorizationStateReady &>(obj));
+        return true;
+      }
+      break;
+    case 1452:
+      if (constructor == orderInfo::ID) {
+        func(static_cast<orderInfo &>(obj));
+        return true;
+      }
+      break;
+    case 1453:
+      if (constructor == contact::ID) {
+        func(static_cast<contact &>(obj));
+        return true;
+      }
+      break;
+    case 1454:
+      if (constructor == connectionStateWaitingForNetwork::ID) {
+        func(static_cast<connectionStateWaitingForNetwork &>(obj));
+        return true;
+      }
+      break;
+    case 1456:
+      if (constructor == textEntityTypeMediaTimestamp::ID) {
+        func(static_cast<textEntityTypeMediaTimestamp &>(obj));
+        return true;
+      }
+      break;
+    case 1458:
+      if (constructor == chatMemberStatusBanned::ID) {
+        func(static_cast<chatMemberStatusBanned &>(obj));
+        return true;
+      }
+      break;
+    case 1461:
+      if (constructor == connectionStateConnectingToProxy::ID) {
+        func(static_cast<connectionStateConnectingToProxy &>(obj));
+        return true;
+      }
+      break;
+    case 1463:
+      if (constructor == userPrivacySettingAllowChatInvites::ID) {
+        func(static_cast<userPrivacySettingAllowChatInvites &>(obj));
+        return true;
+      }
+      break;
+    case 1464:
+      if (constructor == inputPassportElementPassportRegistration::ID) {
+        func(static_cast<inputPassportElementPassportRegistration &>(obj));
+        return true;
+      }
+      if (constructor == testVectorIntObject::ID) {
+        func(static_cast<testVectorIntObject &>(obj));
+        return true;
+      }
+      break;
+    case 1469:
+      if (constructor == textEntityTypeMentionName::ID) {
+        func(static_cast<textEntityTypeMentionName &>(obj));
+        return true;
+      }
+      break;
+    case 1472:
+      if (constructor == groupCallRecentSpeaker::ID) {
+        func(static_cast<groupCallRecentSpeaker &>(obj));
+        return true;
+      }
+      break;
+    case 1473:
+      if (constructor == passportElementEmailAddress::ID) {
+        func(static_cast<passportElementEmailAddress &>(obj));
+        return true;
+      }
+      break;
+    case 1475:
+      if (constructor == notificationTypeNewMessage::ID) {
+        func(static_cast<notificationTypeNewMessage &>(obj));
+        return true;
+      }
+      if (constructor == supergroup::ID) {
+        func(static_cast<supergroup &>(obj));
+        return true;
+      }
+      break;
+    case 1477:
+      if (constructor == updatePollAnswer::ID) {
+        func(static_cast<updatePollAnswer &>(obj));
+        return true;
+      }
+      break;
+    case 1478:
+      if (constructor == updateChatFilters::ID) {
+        func(static_cast<updateChatFilters &>(obj));
+        return true;
+      }
+      break;
+    case 1483:
+      if (constructor == video::ID) {
+        func(static_cast<video &>(obj));
+        return true;
+      }
+      break;
+    case 1484:
+      if (constructor == searchMessagesFilterFailedToSend::ID) {
+        func(static_cast<searchMessagesFilterFailedToSend &>(obj));
+        return true;
+      }
+      break;
+    case 1489:
+      if (constructor == chatMembersFilterBots::ID) {
+        func(static_cast<chatMembersFilterBots &>(obj));
+        return true;
+      }
+      break;
+    case 1495:
+      if (constructor == networkTypeOther::ID) {
+        func(static_cast<networkTypeOther &>(obj));
+        return true;
+      }
+      break;
+    case 1497:
+      if (constructor == backgroundTypeFill::ID) {
+        func(static_cast<backgroundTypeFill &>(obj));
+        return true;
+      }
+      break;
+    case 1498:
+      if (constructor == document::ID) {
+        func(static_cast<document &>(obj));
+        return true;
+      }
+      break;
+    case 1499:
+      if (constructor == chatInviteLinkMembers::ID) {
+        func(static_cast<chatInviteLinkMembers &>(obj));
+        return true;
+      }
+      break;
+    case 1500:
+      if (constructor == deviceTokenApplePushVoIP::ID) {
+        func(static_cast<deviceTokenApplePushVoIP &>(obj));
+        return true;
+      }
+      if (constructor == searchMessagesFilterUnreadMention::ID) {
+        func(static_cast<searchMessagesFilterUnreadMention &>(obj));
+        return true;
+      }
+      break;
+    case 1507:
+      if (constructor == emojis::ID) {
+        func(static_cast<emojis &>(obj));
+        return true;
+      }
+      if (constructor == fileTypeVideo::ID) {
+        func(static_cast<fileTypeVideo &>(obj));
+        return true;
+      }
+      break;
+    case 1511:
+      if (constructor == passportElementBankStatement::ID) {
+        func(static_cast<passportElementBankStatement &>(obj));
+        return true;
+      }
+      if (constructor == searchMessagesFilterPhotoAndVideo::ID) {
+        func(static_cast<searchMessagesFilterPhotoAndVideo &>(obj));
+        return true;
+      }
+      break;
+    case 1512:
+      if (constructor == inputInlineQueryResultLocation::ID) {
+        func(static_cast<inputInlineQueryResultLocation &>(obj));
+        return true;
+      }
+      break;
+    case 1514:
+      if (constructor == groupCallParticipant::ID) {
+        func(static_cast<groupCallParticipant &>(obj));
+        return true;
+      }
+      break;
+    case 1517:
+      if (constructor == resetPasswordResultOk::ID) {
+        func(static_cast<resetPasswordResultOk &>(obj));
+        return true;
+      }
+      break;
+    case 1518:
+      if (constructor == messageGame::ID) {
+        func(static_cast<messageGame &>(obj));
+        return true;
+      }
+      break;
+    case 1520:
+      if (constructor == chatJoinRequest::ID) {
+        func(static_cast<chatJoinRequest &>(obj));
+        return true;
+      }
+      if (constructor == inputChatPhotoStatic::ID) {
+        func(static_cast<inputChatPhotoStatic &>(obj));
+        return true;
+      }
+      break;
+    case 1523:
+      if (constructor == inputInlineQueryResultSticker::ID) {
+        func(static_cast<inputInlineQueryResultSticker &>(obj));
+        return true;
+      }
+      break;
+    case 1525:
+      if (constructor == diceStickersSlotMachine::ID) {
+        func(static_cast<diceStickersSlotMachine &>(obj));
+        return true;
+      }
+      break;
+    case 1527:
+      if (constructor == memoryStatistics::ID) {
+        func(static_cast<memoryStatistics &>(obj));
+        return true;
+      }
+      break;
+    case 1528:
+      if (constructor == pageBlockSubheader::ID) {
+        func(static_cast<pageBlockSubheader &>(obj));
+        return true;
+      }
+      break;
+    case 1530:
+      if (constructor == proxyTypeSocks5::ID) {
+        func(static_cast<proxyTypeSocks5 &>(obj));
+        return true;
+      }
+      if (constructor == updateChatVideoChat::ID) {
+        func(static_cast<updateChatVideoChat &>(obj));
+        return true;
+      }
+      break;
+    case 1533:
+      if (constructor == pushMessageContentMessageForwards::ID) {
+        func(static_cast<pushMessageContentMessageForwards &>(obj));
+        return true;
+      }
+      if (constructor == suggestedActionViewChecksHint::ID) {
+        func(static_cast<suggestedActionViewChecksHint &>(obj));
+        return true;
+      }
+      break;
+    case 1535:
+      if (constructor == replyMarkupRemoveKeyboard::ID) {
+        func(static_cast<replyMarkupRemoveKeyboard &>(obj));
+        return true;
+      }
+      break;
+    case 1540:
+      if (constructor == chatActionCancel::ID) {
+        func(static_cast<chatActionCancel &>(obj));
+        return true;
+      }
+      break;
+    case 1541:
+      if (constructor == testBytes::ID) {
+        func(static_cast<testBytes &>(obj));
+        return true;
+      }
+      break;
+    case 1546:
+      if (constructor == fileTypeUnknown::ID) {
+        func(static_cast<fileTypeUnknown &>(obj));
+        return true;
+      }
+      break;
+    case 1547:
+      if (constructor == date::ID) {
+        func(static_cast<date &>(obj));
+        return true;
+      }
+      break;
+    case 1548:
+      if (constructor == callStateHangingUp::ID) {
+        func(static_cast<callStateHangingUp &>(obj));
+        return true;
+      }
+      break;
+    case 1551:
+      if (constructor == fileTypeDocument::ID) {
+        func(static_cast<fileTypeDocument &>(obj));
+        return true;
+      }
+      if (constructor == inputCredentialsSaved::ID) {
+        func(static_cast<inputCredentialsSaved &>(obj));
+        return true;
+      }
+      break;
+    case 1554:
+      if (constructor == invoice::ID) {
+        func(static_cast<invoice &>(obj));
+        return true;
+      }
+      break;
+    case 1555:
+      if (constructor == notificationSettingsScopeChannelChats::ID) {
+        func(static_cast<notificationSettingsScopeChannelChats &>(obj));
+        return true;
+      }
+      break;
+    case 1557:
+      if (constructor == inputPassportElementPersonalDetails::ID) {
+        func(static_cast<inputPassportElementPersonalDetails &>(obj));
+        return true;
+      }
+      break;
+    case 1559:
+      if (constructor == inlineQueryResultVideo::ID) {
+        func(static_cast<inlineQueryResultVideo &>(obj));
+        return true;
+      }
+      if (constructor == networkTypeMobileRoaming::ID) {
+        func(static_cast<networkTypeMobileRoaming &>(obj));
+        return true;
+      }
+      break;
+    case 1562:
+      if (constructor == internalLinkTypeTheme::ID) {
+        func(static_cast<internalLinkTypeTheme &>(obj));
+        return true;
+      }
+      break;
+    case 1565:
+      if (constructor == scopeNotificationSettings::ID) {
+        func(static_cast<scopeNotificationSettings &>(obj));
+        return true;
+      }
+      break;
+    case 1570:
+      if (constructor == deviceTokenSimplePush::ID) {
+        func(static_cast<deviceTokenSimplePush &>(obj));
+        return true;
+      }
+      break;
+    case 1573:
+      if (constructor == internalLinkTypeQrCodeAuthentication::ID) {
+        func(static_cast<internalLinkTypeQrCodeAuthentication &>(obj));
+        return true;
+      }
+      if (constructor == textEntityTypeSpoiler::ID) {
+        func(static_cast<textEntityTypeSpoiler &>(obj));
+        return true;
+      }
+      break;
+    case 1574:
+      if (constructor == jsonValueNull::ID) {
+        func(static_cast<jsonValueNull &>(obj));
+        return true;
+      }
+      if (constructor == richTextItalic::ID) {
+        func(static_cast<richTextItalic &>(obj));
+        return true;
+      }
+      break;
+    case 1577:
+      if (constructor == inlineQueryResultSticker::ID) {
+        func(static_cast<inlineQueryResultSticker &>(obj));
+        return true;
+      }
+      break;
+    case 1579:
+      if (constructor == stickers::ID) {
+        func(static_cast<stickers &>(obj));
+        return true;
+      }
+      break;
+    case 1583:
+      if (constructor == paymentResult::ID) {
+        func(static_cast<paymentResult &>(obj));
+        return true;
+      }
+      break;
+    case 1584:
+      if (constructor == deviceTokenTizenPush::ID) {
+        func(static_cast<deviceTokenTizenPush &>(obj));
+        return true;
+      }
+      break;
+    case 1585:
+      if (constructor == messageInvoice::ID) {
+        func(static_cast<messageInvoice &>(obj));
+        return true;
+      }
+      break;
+    case 1586:
+      if (constructor == passportElementTypePassport::ID) {
+        func(static_cast<passportElementTypePassport &>(obj));
+        return true;
+      }
+      break;
+    case 1590:
+      if (constructor == pageBlockBlockQuote::ID) {
+        func(static_cast<pageBlockBlockQuote &>(obj));
+        return true;
+      }
+      break;
+    case 1591:
+      if (constructor == chatActionBarJoinRequest::ID) {
+        func(static_cast<chatActionBarJoinRequest &>(obj));
+        return true;
+      }
+      if (constructor == chatMembers::ID) {
+        func(static_cast<chatMembers &>(obj));
+        return true;
+      }
+      break;
+    case 1599:
+      if (constructor == canTransferOwnershipResultSessionTooFresh::ID) {
+        func(static_cast<canTransferOwnershipResultSessionTooFresh &>(obj));
+        return true;
+      }
+      break;
+    case 1603:
+      if (constructor == chatEventMemberJoinedByInviteLink::ID) {
+        func(static_cast<chatEventMemberJoinedByInviteLink &>(obj));
+        return true;
+      }
+      break;
+    case 1604:
+      if (constructor == updateTrendingStickerSets::ID) {
+        func(static_cast<updateTrendingStickerSets &>(obj));
+        return true;
+      }
+      break;
+    case 1605:
+      if (constructor == vectorPathCommandLine::ID) {
+        func(static_cast<vectorPathCommandLine &>(obj));
+        return true;
+      }
+      break;
+    case 1606:
+      if (constructor == pageBlockVerticalAlignmentBottom::ID) {
+        func(static_cast<pageBlockVerticalAlignmentBottom &>(obj));
+        return true;
+      }
+      if (constructor == textEntityTypeStrikethrough::ID) {
+        func(static_cast<textEntityTypeStrikethrough &>(obj));
+        return true;
+      }
+      break;
+    case 1611:
+      if (constructor == pageBlockSubtitle::ID) {
+        func(static_cast<pageBlockSubtitle &>(obj));
+        return true;
+      }
+      if (constructor == textParseModeMarkdown::ID) {
+        func(static_cast<textParseModeMarkdown &>(obj));
+        return true;
+      }
+      break;
+    case 1613:
+      if (constructor == inputIdentityDocument::ID) {
+        func(static_cast<inputIdentityDocument &>(obj));
+        return true;
+      }
+      if (constructor == pageBlockVoiceNote::ID) {
+        func(static_cast<pageBlockVoiceNote &>(obj));
+        return true;
+      }
+      break;
+    case 1615:
+      if (constructor == temporaryPasswordState::ID) {
+        func(static_cast<temporaryPasswordState &>(obj));
+        return true;
+      }
+      break;
+    case 1617:
+      if (constructor == recommendedChatFilters::ID) {
+        func(static_cast<recommendedChatFilters &>(obj));
+        return true;
+      }
+      break;
+    case 1618:
+      if (constructor == callServerTypeWebrtc::ID) {
+        func(static_cast<callServerTypeWebrtc &>(obj));
+        return true;
+      }
+      break;
+    case 1621:
+      if (constructor == chatMemberStatusAdministrator::ID) {
+        func(static_cast<chatMemberStatusAdministrator &>(obj));
+        return true;
+      }
+      break;
+    case 1622:
+      if (constructor == inlineQueryResultDocument::ID) {
+        func(static_cast<inlineQueryResultDocument &>(obj));
+        return true;
+      }
+      break;
+    case 1626:
+      if (constructor == updateUserPrivacySettingRules::ID) {
+        func(static_cast<updateUserPrivacySettingRules &>(obj));
+        return true;
+      }
+      break;
+    case 1627:
+      if (constructor == chatActionUploadingVideo::ID) {
+        func(static_cast<chatActionUploadingVideo &>(obj));
+        return true;
+      }
+      break;
+    case 1629:
+      if (constructor == botCommand::ID) {
+        func(static_cast<botCommand &>(obj));
+        return true;
+      }
+      break;
+    case 1632:
+      if (constructor == messageChatJoinByLink::ID) {
+        func(static_cast<messageChatJoinByLink &>(obj));
+        return true;
+      }
+      if (constructor == pageBlockList::ID) {
+        func(static_cast<pageBlockList &>(obj));
+        return true;
+      }
+      break;
+    case 1633:
+      if (constructor == authorizationStateWaitCode::ID) {
+        func(static_cast<authorizationStateWaitCode &>(obj));
+        return true;
+      }
+      break;
+    case 1634:
+      if (constructor == userTypeUnknown::ID) {
+        func(static_cast<userTypeUnknown &>(obj));
+        return true;
+      }
+      break;
+    case 1637:
+      if (constructor == inputChatPhotoAnimation::ID) {
+        func(static_cast<inputChatPhotoAnimation &>(obj));
+        return true;
+      }
+      break;
+    case 1639:
+      if (constructor == textEntityTypeBankCardNumber::ID) {
+        func(static_cast<textEntityTypeBankCardNumber &>(obj));
+        return true;
+      }
+      break;
+    case 1640:
+      if (constructor == inputPassportElementError::ID) {
+        func(static_cast<inputPassportElementError &>(obj));
+        return true;
+      }
+      if (constructor == messageProximityAlertTriggered::ID) {
+        func(static_cast<messageProximityAlertTriggered &>(obj));
+        return true;
+      }
+      break;
+    case 1641:
+      if (constructor == messagePassportDataReceived::ID) {
+        func(static_cast<messagePassportDataReceived &>(obj));
+        return true;
+      }
+      break;
+    case 1643:
+      if (constructor == pageBlockFooter::ID) {
+        func(static_cast<pageBlockFooter &>(obj));
+        return true;
+      }
+      if (constructor == pushMessageContentBasicGroupChatCreate::ID) {
+        func(static_cast<pushMessageContentBasicGroupChatCreate &>(obj));
+        return true;
+      }
+      break;
+    case 1645:
+      if (constructor == chatMembersFilterMention::ID) {
+        func(static_cast<chatMembersFilterMention &>(obj));
+        return true;
+      }
+      break;
+    case 1648:
+      if (constructor == messagePositions::ID) {
+        func(static_cast<messagePositions &>(obj));
+        return true;
+      }
+      if (constructor == updateChatReadOutbox::ID) {
+        func(static_cast<updateChatReadOutbox &>(obj));
+        return true;
+      }
+      break;
+    case 1649:
+      if (constructor == jsonValueArray::ID) {
+        func(static_cast<jsonValueArray &>(obj));
+        return true;
+      }
+      break;
+    case 1650:
+      if (constructor == poll::ID) {
+        func(static_cast<poll &>(obj));
+        return true;
+      }
+      break;
+    case 1652:
+      if (constructor == connectionStateUpdating::ID) {
+        func(static_cast<connectionStateUpdating &>(obj));
+        return true;
+      }
+      break;
+    case 1653:
+      if (constructor == chatLists::ID) {
+        func(static_cast<chatLists &>(obj));
+        return true;
+      }
+      break;
+    case 1654:
+      if (constructor == replyMarkupInlineKeyboard::ID) {
+        func(static_cast<replyMarkupInlineKeyboard &>(obj));
+        return true;
+      }
+      break;
+    case 1656:
+      if (constructor == messageVideoNote::ID) {
+        func(static_cast<messageVideoNote &>(obj));
+        return true;
+      }
+      break;
+    case 1658:
+      if (constructor == chatReportReasonSpam::ID) {
+        func(static_cast<chatReportReasonSpam &>(obj));
+        return true;
+      }
+      break;
+    case 1661:
+      if (constructor == publicChatTypeIsLocationBased::ID) {
+        func(static_cast<publicChatTypeIsLocationBased &>(obj));
+        return true;
+      }
+      break;
+    case 1667:
+      if (constructor == updateChatHasProtectedContent::ID) {
+        func(static_cast<updateChatHasProtectedContent &>(obj));
+        return true;
+      }
+      break;
+    case 1673:
+      if (constructor == checkChatUsernameResultUsernameInvalid::ID) {
+        func(static_cast<checkChatUsernameResultUsernameInvalid &>(obj));
+        return true;
+      }
+      break;
+    case 1674:
+      if (constructor == point::ID) {
+        func(static_cast<point &>(obj));
+        return true;
+      }
+      break;
+    case 1676:
+      if (constructor == botCommandScopeChatMember::ID) {
+        func(static_cast<botCommandScopeChatMember &>(obj));
+        return true;
+      }
+      break;
+    case 1677:
+      if (constructor == suggestedActionSetPassword::ID) {
+        func(static_cast<suggestedActionSetPassword &>(obj));
+        return true;
+      }
+      break;
+    case 1679:
+      if (constructor == dateRange::ID) {
+        func(static_cast<dateRange &>(obj));
+        return true;
+      }
+      break;
+    case 1680:
+      if (constructor == passportElementIdentityCard::ID) {
+        func(static_cast<passportElementIdentityCard &>(obj));
+        return true;
+      }
+      break;
+    case 1683:
+      if (constructor == passportElementTypeBankStatement::ID) {
+        func(static_cast<passportElementTypeBankStatement &>(obj));
+        return true;
+      }
+      break;
+    case 1686:
+      if (constructor == messageExpiredPhoto::ID) {
+        func(static_cast<messageExpiredPhoto &>(obj));
+        return true;
+      }
+      break;
+    case 1688:
+      if (constructor == callProtocol::ID) {
+        func(static_cast<callProtocol &>(obj));
+        return true;
+      }
+      if (constructor == storageStatistics::ID) {
+        func(static_cast<storageStatistics &>(obj));
+        return true;
+      }
+      break;
+    case 1689:
+      if (constructor == internalLinkTypeVideoChat::ID) {
+        func(static_cast<internalLinkTypeVideoChat &>(obj));
+        return true;
+      }
+      if (constructor == searchMessagesFilterMention::ID) {
+        func(static_cast<searchMessagesFilterMention &>(obj));
+        return true;
+      }
+      break;
+    case 1694:
+      if (constructor == searchMessagesFilterPhoto::ID) {
+        func(static_cast<searchMessagesFilterPhoto &>(obj));
+        return true;
+      }
+      break;
+    case 1696:
+      if (constructor == filePart::ID) {
+        func(static_cast<filePart &>(obj));
+        return true;
+      }
+      if (constructor == updateChatIsMarkedAsUnread::ID) {
+        func(static_cast<updateChatIsMarkedAsUnread &>(obj));
+        return true;
+      }
+      break;
+    case 1698:
+      if (constructor == updateSelectedBackground::ID) {
+        func(static_cast<updateSelectedBackground &>(obj));
+        return true;
+      }
+      break;
+    case 1709:
+      if (constructor == authorizationStateClosing::ID) {
+        func(static_cast<authorizationStateClosing &>(obj));
+        return true;
+      }
+      if (constructor == pageBlockKicker::ID) {
+        func(static_cast<pageBlockKicker &>(obj));
+        return true;
+      }
+      break;
+    case 1711:
+      if (constructor == maskPointChin::ID) {
+        func(static_cast<maskPointChin &>(obj));
+        return true;
+      }
+      break;
+    case 1712:
+      if (constructor == textEntityTypeCode::ID) {
+        func(static_cast<textEntityTypeCode &>(obj));
+        return true;
+      }
+      break;
+    case 1716:
+      if (constructor == inputPassportElementErrorSourceFrontSide::ID) {
+        func(static_cast<inputPassportElementErrorSourceFrontSide &>(obj));
+        return true;
+      }
+      if (constructor == thumbnailFormatWebm::ID) {
+        func(static_cast<thumbnailFormatWebm &>(obj));
+        return true;
+      }
+      break;
+    case 1718:
+      if (constructor == inputPassportElementEmailAddress::ID) {
+        func(static_cast<inputPassportElementEmailAddress &>(obj));
+        return true;
+      }
+      break;
+    case 1720:
+      if (constructor == inputBackgroundLocal::ID) {
+        func(static_cast<inputBackgroundLocal &>(obj));
+        return true;
+      }
+      break;
+    case 1721:
+      if (constructor == passportElementErrorSourceReverseSide::ID) {
+        func(static_cast<passportElementErrorSourceReverseSide &>(obj));
+        return true;
+      }
+      break;
+    case 1724:
+      if (constructor == chatEventInviteLinkEdited::ID) {
+        func(static_cast<chatEventInviteLinkEdited &>(obj));
+        return true;
+      }
+      break;
+    case 1725:
+      if (constructor == messageChatSetTtl::ID) {
+        func(static_cast<messageChatSetTtl &>(obj));
+        return true;
+      }
+      break;
+    case 1726:
+      if (constructor == callStatePending::ID) {
+        func(static_cast<callStatePending &>(obj));
+        return true;
+      }
+      if (constructor == passportElementTypeInternalPassport::ID) {
+        func(static_cast<passportElementTypeInternalPassport &>(obj));
+        return true;
+      }
+      break;
+    case 1728:
+      if (constructor == pushMessageContentScreenshotTaken::ID) {
+        func(static_cast<pushMessageContentScreenshotTaken &>(obj));
+        return true;
+      }
+      break;
+    case 1732:
+      if (constructor == userPrivacySettingAllowPeerToPeerCalls::ID) {
+        func(static_cast<userPrivacySettingAllowPeerToPeerCalls &>(obj));
+        return true;
+      }
+      break;
+    case 1739:
+      if (constructor == internalLinkTypeLanguagePack::ID) {
+        func(static_cast<internalLinkTypeLanguagePack &>(obj));
+        return true;
+      }
+      if (constructor == updateSupergroup::ID) {
+        func(static_cast<updateSupergroup &>(obj));
+        return true;
+      }
+      break;
+    case 1742:
+      if (constructor == richTextAnchor::ID) {
+        func(static_cast<richTextAnchor &>(obj));
+        return true;
+      }
+      break;
+    case 1747:
+      if (constructor == textEntityTypePre::ID) {
+        func(static_cast<textEntityTypePre &>(obj));
+        return true;
+      }
+      break;
+    case 1750:
+      if (constructor == botCommandScopeChatAdministrators::ID) {
+        func(static_cast<botCommandScopeChatAdministrators &>(obj));
+        return true;
+      }
+      if (constructor == pushMessageContentGame::ID) {
+        func(static_cast<pushMessageContentGame &>(obj));
+        return true;
+      }
+      break;
+    case 1753:
+      if (constructor == profilePhoto::ID) {
+        func(static_cast<profilePhoto &>(obj));
+        return true;
+      }
+      break;
+    case 1757:
+      if (constructor == backgroundTypeWallpaper::ID) {
+        func(static_cast<backgroundTypeWallpaper &>(obj));
+        return true;
+      }
+      break;
+    case 1758:
+      if (constructor == pageBlockPhoto::ID) {
+        func(static_cast<pageBlockPhoto &>(obj));
+        return true;
+      }
+      break;
+    case 1759:
+      if (constructor == richTextUnderline::ID) {
+        func(static_cast<richTextUnderline &>(obj));
+        return true;
+      }
+      break;
+    case 1761:
+      if (constructor == chatActionUploadingPhoto::ID) {
+        func(static_cast<chatActionUploadingPhoto &>(obj));
+        return true;
+      }
+      if (constructor == richTextStrikethrough::ID) {
+        func(static_cast<richTextStrikethrough &>(obj));
+        return true;
+      }
+      break;
+    case 1762:
+      if (constructor == fileTypeThumbnail::ID) {
+        func(static_cast<fileTypeThumbnail &>(obj));
+        return true;
+      }
+      break;
+    case 1763:
+      if (constructor == deviceTokenMicrosoftPushVoIP::ID) {
+        func(static_cast<deviceTokenMicrosoftPushVoIP &>(obj));
+        return true;
+      }
+      if (constructor == updateChatThemes::ID) {
+        func(static_cast<updateChatThemes &>(obj));
+        return true;
+      }
+      break;
+    case 1764:
+      if (constructor == deviceTokenUbuntuPush::ID) {
+        func(static_cast<deviceTokenUbuntuPush &>(obj));
+        return true;
+      }
+      break;
+    case 1766:
+      if (constructor == richTextPlain::ID) {
+        func(static_cast<richTextPlain &>(obj));
+        return true;
+      }
+      break;
+    case 1770:
+      if (constructor == updateChatMember::ID) {
+        func(static_cast<updateChatMember &>(obj));
+        return true;
+      }
+      break;
+    case 1771:
+      if (constructor == messageChatUpgradeFrom::ID) {
+        func(static_cast<messageChatUpgradeFrom &>(obj));
+        return true;
+      }
+      if (constructor == searchMessagesFilterPinned::ID) {
+        func(static_cast<searchMessagesFilterPinned &>(obj));
+        return true;
+      }
+      break;
+    case 1775:
+      if (constructor == fileTypeNone::ID) {
+        func(static_cast<fileTypeNone &>(obj));
+        return true;
+      }
+      break;
+    case 1778:
+      if (constructor == authenticationCodeTypeMissedCall::ID) {
+        func(static_cast<authenticationCodeTypeMissedCall &>(obj));
+        return true;
+      }
+      break;
+    case 1779:
+      if (constructor == richTextFixed::ID) {
+        func(static_cast<richTextFixed &>(obj));
+        return true;
+      }
+      break;
+    case 1780:
+      if (constructor == canTransferOwnershipResultOk::ID) {
+        func(static_cast<canTransferOwnershipResultOk &>(obj));
+        return true;
+      }
+      break;
+    case 1781:
+      if (constructor == chatEvent::ID) {
+        func(static_cast<chatEvent &>(obj));
+        return true;
+      }
+      break;
+    case 1786:
+      if (constructor == internalLinkTypeGame::ID) {
+        func(static_cast<internalLinkTypeGame &>(obj));
+        return true;
+      }
+      if (constructor == stickerTypeAnimated::ID) {
+        func(static_cast<stickerTypeAnimated &>(obj));
+        return true;
+      }
+      break;
+    case 1793:
+      if (constructor == videoNote::ID) {
+        func(static_cast<videoNote &>(obj));
+        return true;
+      }
+      break;
+    case 1795:
+      if (constructor == optionValueEmpty::ID) {
+        func(static_cast<optionValueEmpty &>(obj));
+        return true;
+      }
+      break;
+    case 1799:
+      if (constructor == topChatCategoryBots::ID) {
+        func(static_cast<topChatCategoryBots &>(obj));
+        return true;
+      }
+      break;
+    case 1802:
+      if (constructor == richTexts::ID) {
+        func(static_cast<richTexts &>(obj));
+        return true;
+      }
+      break;
+    case 1803:
+      if (constructor == pushMessageContentInvoice::ID) {
+        func(static_cast<pushMessageContentInvoice &>(obj));
+        return true;
+      }
+      break;
+    case 1805:
+      if (constructor == updateDeleteMessages::ID) {
+        func(static_cast<updateDeleteMessages &>(obj));
+        return true;
+      }
+      break;
+    case 1806:
+      if (constructor == chatActionRecordingVoiceNote::ID) {
+        func(static_cast<chatActionRecordingVoiceNote &>(obj));
+        return true;
+      }
+      break;
+    case 1809:
+      if (constructor == updateReactions::ID) {
+        func(static_cast<updateReactions &>(obj));
+        return true;
+      }
+      break;
+    case 1811:
+      if (constructor == chatActionChoosingContact::ID) {
+        func(static_cast<chatActionChoosingContact &>(obj));
+        return true;
+      }
+      break;
+    case 1815:
+      if (constructor == chatInviteLink::ID) {
+        func(static_cast<chatInviteLink &>(obj));
+        return true;
+      }
+      if (constructor == textEntityTypeBotCommand::ID) {
+        func(static_cast<textEntityTypeBotCommand &>(obj));
+        return true;
+      }
+      break;
+    case 1818:
+      if (constructor == chatPhotoInfo::ID) {
+        func(static_cast<chatPhotoInfo &>(obj));
+        return true;
+      }
+      break;
+    case 1820:
+      if (constructor == pageBlockHorizontalAlignmentRight::ID) {
+        func(static_cast<pageBlockHorizontalAlignmentRight &>(obj));
+        return true;
+      }
+      if (constructor == testVectorString::ID) {
+        func(static_cast<testVectorString &>(obj));
+        return true;
+      }
+      break;
+    case 1823:
+      if (constructor == error::ID) {
+        func(static_cast<error &>(obj));
+        return true;
+      }
+      if (constructor == pushMessageContentChatJoinByLink::ID) {
+        func(static_cast<pushMessageContentChatJoinByLink &>(obj));
+        return true;
+      }
+      break;
+    case 1824:
+      if (constructor == chatEventStickerSetChanged::ID) {
+        func(static_cast<chatEventStickerSetChanged &>(obj));
+        return true;
+      }
+      break;
+    case 1827:
+      if (constructor == userPrivacySettingRuleRestrictContacts::ID) {
+        func(static_cast<userPrivacySettingRuleRestrictContacts &>(obj));
+        return true;
+      }
+      break;
+    case 1828:
+      if (constructor == textEntity::ID) {
+        func(static_cast<textEntity &>(obj));
+        return true;
+      }
+      break;
+    case 1829:
+      if (constructor == inputThumbnail::ID) {
+        func(static_cast<inputThumbnail &>(obj));
+        return true;
+      }
+      break;
+    case 1831:
+      if (constructor == pageBlockHorizontalAlignmentLeft::ID) {
+        func(static_cast<pageBlockHorizontalAlignmentLeft &>(obj));
+        return true;
+      }
+      break;
+    case 1834:
+      if (constructor == chatInviteLinkInfo::ID) {
+        func(static_cast<chatInviteLinkInfo &>(obj));
+        return true;
+      }
+      break;
+    case 1835:
+      if (constructor == chatEventLogFilters::ID) {
+        func(static_cast<chatEventLogFilters &>(obj));
+        return true;
+      }
+      if (constructor == userStatusEmpty::ID) {
+        func(static_cast<userStatusEmpty &>(obj));
+        return true;
+      }
+      break;
+    case 1842:
+      if (constructor == inputPassportElementBankStatement::ID) {
+        func(static_cast<inputPassportElementBankStatement &>(obj));
+        return true;
+      }
+      break;
+    case 1845:
+      if (constructor == chatMemberStatusCreator::ID) {
+        func(static_cast<chatMemberStatusCreator &>(obj));
+        return true;
+      }
+      if (constructor == chatReportReasonFake::ID) {
+        func(static_cast<chatReportReasonFake &>(obj));
+        return true;
+      }
+      break;
+    case 1847:
+      if (constructor == messageChatDeleteMember::ID) {
+        func(static_cast<messageChatDeleteMember &>(obj));
+        return true;
+      }
+      break;
+    case 1850:
+      if (constructor == chatNearby::ID) {
+        func(static_cast<chatNearby &>(obj));
+        return true;
+      }
+      break;
+    case 1851:
+      if (constructor == publicChatTypeHasUsername::ID) {
+        func(static_cast<publicChatTypeHasUsername &>(obj));
+        return true;
+      }
+      break;
+    case 1853:
+      if (constructor == callbackQueryPayloadGame::ID) {
+        func(static_cast<callbackQueryPayloadGame &>(obj));
+        return true;
+      }
+      break;
+    case 1856:
+      if (constructor == checkChatUsernameResultPublicChatsTooMuch::ID) {
+        func(static_cast<checkChatUsernameResultPublicChatsTooMuch &>(obj));
+        return true;
+      }
+      break;
+    case 1857:
+      if (constructor == connectionStateReady::ID) {
+        func(static_cast<connectionStateReady &>(obj));
+        return true;
+      }
+      if (constructor == messageForwardOriginHiddenUser::ID) {
+        func(static_cast<messageForwardOriginHiddenUser &>(obj));
+        return true;
+      }
+      break;
+    case 1858:
+      if (constructor == passportElementTypeIdentityCard::ID) {
+        func(static_cast<passportElementTypeIdentityCard &>(obj));
+        return true;
+      }
+      if (constructor == searchMessagesFilterAnimation::ID) {
+        func(static_cast<searchMessagesFilterAnimation &>(obj));
+        return true;
+      }
+      break;
+    case 1859:
+      if (constructor == chatMembersFilterContacts::ID) {
+        func(static_cast<chatMembersFilterContacts &>(obj));
+        return true;
+      }
+      break;
+    case 1860:
+      if (constructor == chatPhotos::ID) {
+        func(static_cast<chatPhotos &>(obj));
+        return true;
+      }
+      if (constructor == updateMessageMentionRead::ID) {
+        func(static_cast<updateMessageMentionRead &>(obj));
+        return true;
+      }
+      break;
+    case 1864:
+      if (constructor == sessions::ID) {
+        func(static_cast<sessions &>(obj));
+        return true;
+      }
+      break;
+    case 1865:
+      if (constructor == richTextUrl::ID) {
+        func(static_cast<richTextUrl &>(obj));
+        return true;
+      }
+      if (constructor == topChatCategoryCalls::ID) {
+        func(static_cast<topChatCategoryCalls &>(obj));
+        return true;
+      }
+      break;
+    case 1866:
+      if (constructor == inputMessageVideo::ID) {
+        func(static_cast<inputMessageVideo &>(obj));
+        return true;
+      }
+      break;
+    case 1869:
+      if (constructor == inlineQueryResultAudio::ID) {
+        func(static_cast<inlineQueryResultAudio &>(obj));
+        return true;
+      }
+      if (constructor == messageForwardOriginMessageImport::ID) {
+        func(static_cast<messageForwardOriginMessageImport &>(obj));
+        return true;
+      }
+      break;
+    case 1874:
+      if (constructor == chatActionUploadingVoiceNote::ID) {
+        func(static_cast<chatActionUploadingVoiceNote &>(obj));
+        return true;
+      }
+      break;
+    case 1877:
+      if (constructor == inputInlineQueryResultVenue::ID) {
+        func(static_cast<inputInlineQueryResultVenue &>(obj));
+        return true;
+      }
+      if (constructor == messageBroadcastResult::ID) {
+        func(static_cast<messageBroadcastResult &>(obj));
+        return true;
+      }
+      break;
+    case 1878:
+      if (constructor == backgroundFillGradient::ID) {
+        func(static_cast<backgroundFillGradient &>(obj));
+        return true;
+      }
+      break;
+    case 1879:
+      if (constructor == encryptedPassportElement::ID) {
+        func(static_cast<encryptedPassportElement &>(obj));
+        return true;
+      }
+      break;
+    case 1881:
+      if (constructor == keyboardButtonTypeRequestPoll::ID) {
+        func(static_cast<keyboardButtonTypeRequestPoll &>(obj));
+        return true;
+      }
+      break;
+    case 1882:
+      if (constructor == deviceTokenMicrosoftPush::ID) {
+        func(static_cast<deviceTokenMicrosoftPush &>(obj));
+        return true;
+      }
+      break;
+    case 1883:
+      if (constructor == supergroupMembersFilterRestricted::ID) {
+        func(static_cast<supergroupMembersFilterRestricted &>(obj));
+        return true;
+      }
+      break;
+    case 1884:
+      if (constructor == chatEventSignMessagesToggled::ID) {
+        func(static_cast<chatEventSignMessagesToggled &>(obj));
+        return true;
+      }
+      if (constructor == checkChatUsernameResultOk::ID) {
+        func(static_cast<checkChatUsernameResultOk &>(obj));
+        return true;
+      }
+      break;
+    case 1885:
+      if (constructor == unreadReaction::ID) {
+        func(static_cast<unreadReaction &>(obj));
+        return true;
+      }
+      break;
+    case 1886:
+      if (constructor == tMeUrlTypeStickerSet::ID) {
+        func(static_cast<tMeUrlTypeStickerSet &>(obj));
+        return true;
+      }
+      break;
+    case 1887:
+      if (constructor == inputPassportElementIdentityCard::ID) {
+        func(static_cast<inputPassportElementIdentityCard &>(obj));
+        return true;
+      }
+      break;
+    case 1888:
+      if (constructor == authenticationCodeTypeCall::ID) {
+        func(static_cast<authenticationCodeTypeCall &>(obj));
+        return true;
+      }
+      break;
+    case 1891:
+      if (constructor == updatePoll::ID) {
+        func(static_cast<updatePoll &>(obj));
+        return true;
+      }
+      break;
+    case 1892:
+      if (constructor == chatMemberStatusRestricted::ID) {
+        func(static_cast<chatMemberStatusRestricted &>(obj));
+        return true;
+      }
+      break;
+    case 1894:
+      if (constructor == pageBlockCaption::ID) {
+        func(static_cast<pageBlockCaption &>(obj));
+        return true;
+      }
+      break;
+    case 1895:
+      if (constructor == chatJoinRequestsInfo::ID) {
+        func(static_cast<chatJoinRequestsInfo &>(obj));
+        return true;
+      }
+      if (constructor == passportAuthorizationForm::ID) {
+        func(static_cast<passportAuthorizationForm &>(obj));
+        return true;
+      }
+      break;
+    case 1896:
+      if (constructor == updateMessageSendSucceeded::ID) {
+        func(static_cast<updateMessageSendSucceeded &>(obj));
+        return true;
+      }
+      break;
+    case 1897:
+      if (constructor == chatEventVideoChatParticipantVolumeLevelChanged::ID) {
+        func(static_cast<chatEventVideoChatParticipantVolumeLevelChanged &>(obj));
+        return true;
+      }
+      break;
+    case 1899:
+      if (constructor == messageFileTypeUnknown::ID) {
+        func(static_cast<messageFileTypeUnknown &>(obj));
+        return true;
+      }
+      break;
+    case 1902:
+      if (constructor == userPrivacySettingRuleAllowContacts::ID) {
+        func(static_cast<userPrivacySettingRuleAllowContacts &>(obj));
+        return true;
+      }
+      break;
+    case 1904:
+      if (constructor == languagePackStringValueDeleted::ID) {
+        func(static_cast<languagePackStringValueDeleted &>(obj));
+        return true;
+      }
+      break;
+    case 1905:
+      if (constructor == searchMessagesFilterVideoNote::ID) {
+        func(static_cast<searchMessagesFilterVideoNote &>(obj));
+        return true;
+      }
+      break;
+    case 1910:
+      if (constructor == messageUnsupported::ID) {
+        func(static_cast<messageUnsupported &>(obj));
+        return true;
+      }
+      break;
+    case 1912:
+      if (constructor == inputCredentialsApplePay::ID) {
+        func(static_cast<inputCredentialsApplePay &>(obj));
+        return true;
+      }
+      if (constructor == richTextReference::ID) {
+        func(static_cast<richTextReference &>(obj));
+        return true;
+      }
+      break;
+    case 1913:
+      if (constructor == notificationGroup::ID) {
+        func(static_cast<notificationGroup &>(obj));
+        return true;
+      }
+      break;
+    case 1917:
+      if (constructor == messagePassportDataSent::ID) {
+        func(static_cast<messagePassportDataSent &>(obj));
+        return true;
+      }
+      if (constructor == updateChatActionBar::ID) {
+        func(static_cast<updateChatActionBar &>(obj));
+        return true;
+      }
+      break;
+    case 1924:
+      if (constructor == messageSenderUser::ID) {
+        func(static_cast<messageSenderUser &>(obj));
+        return true;
+      }
+      break;
+    case 1925:
+      if (constructor == updateSavedAnimations::ID) {
+        func(static_cast<updateSavedAnimations &>(obj));
+        return true;
+      }
+      break;
+    case 1930:
+      if (constructor == venue::ID) {
+        func(static_cast<venue &>(obj));
+        return true;
+      }
+      break;
+    case 1932:
+      if (constructor == updateMessageSendFailed::ID) {
+        func(static_cast<updateMessageSendFailed &>(obj));
+        return true;
+      }
+      break;
+    case 1934:
+      if (constructor == chatEventMessageDeleted::ID) {
+        func(static_cast<chatEventMessageDeleted &>(obj));
+        return true;
+      }
+      break;
+    case 1937:
+      if (constructor == chatTypeSecret::ID) {
+        func(static_cast<chatTypeSecret &>(obj));
+        return true;
+      }
+      break;
+    case 1942:
+      if (constructor == tMeUrlTypeUser::ID) {
+        func(static_cast<tMeUrlTypeUser &>(obj));
+        return true;
+      }
+      break;
+    case 1943:
+      if (constructor == chatEventMemberLeft::ID) {
+        func(static_cast<chatEventMemberLeft &>(obj));
+        return true;
+      }
+      break;
+    case 1946:
+      if (constructor == botCommandScopeAllChatAdministrators::ID) {
+        func(static_cast<botCommandScopeAllChatAdministrators &>(obj));
+        return true;
+      }
+      break;
+    case 1950:
+      if (constructor == passportElementPhoneNumber::ID) {
+        func(static_cast<passportElementPhoneNumber &>(obj));
+        return true;
+      }
+      break;
+    case 1951:
+      if (constructor == callProblemEcho::ID) {
+        func(static_cast<callProblemEcho &>(obj));
+        return true;
+      }
+      if (constructor == inputInlineQueryResultDocument::ID) {
+        func(static_cast<inputInlineQueryResultDocument &>(obj));
+        return true;
+      }
+      break;
+    case 1952:
+      if (constructor == seconds::ID) {
+        func(static_cast<seconds &>(obj));
+        return true;
+      }
+      break;
+    case 1954:
+      if (constructor == passportElementTypeAddress::ID) {
+        func(static_cast<passportElementTypeAddress &>(obj));
+        return true;
+      }
+      if (constructor == updateNewChat::ID) {
+        func(static_cast<updateNewChat &>(obj));
+        return true;
+      }
+      break;
+    case 1955:
+      if (constructor == pageBlockTableCell::ID) {
+        func(static_cast<pageBlockTableCell &>(obj));
+        return true;
+      }
+      break;
+    case 1958:
+      if (constructor == notificationSettingsScopeGroupChats::ID) {
+        func(static_cast<notificationSettingsScopeGroupChats &>(obj));
+        return true;
+      }
+      break;
+    case 1962:
+      if (constructor == chatEventMemberJoinedByRequest::ID) {
+        func(static_cast<chatEventMemberJoinedByRequest &>(obj));
+        return true;
+      }
+      break;
+    case 1963:
+      if (constructor == chatEventInviteLinkRevoked::ID) {
+        func(static_cast<chatEventInviteLinkRevoked &>(obj));
+        return true;
+      }
+      break;
+    case 1964:
+      if (constructor == inputInlineQueryResultGame::ID) {
+        func(static_cast<inputInlineQueryResultGame &>(obj));
+        return true;
+      }
+      break;
+    case 1965:
+      if (constructor == inputMessageContact::ID) {
+        func(static_cast<inputMessageContact &>(obj));
+        return true;
+      }
+      break;
+    case 1970:
+      if (constructor == messageChatChangePhoto::ID) {
+        func(static_cast<messageChatChangePhoto &>(obj));
+        return true;
+      }
+      break;
+    case 1972:
+      if (constructor == textEntities::ID) {
+        func(static_cast<textEntities &>(obj));
+        return true;
+      }
+      break;
+    case 1973:
+      if (constructor == chatInviteLinkMember::ID) {
+        func(static_cast<chatInviteLinkMember &>(obj));
+        return true;
+      }
+      if (constructor == chatsNearby::ID) {
+        func(static_cast<chatsNearby &>(obj));
+        return true;
+      }
+      if (constructor == inlineKeyboardButtonTypeBuy::ID) {
+        func(static_cast<inlineKeyboardButtonTypeBuy &>(obj));
+        return true;
+      }
+      break;
+    case 1975:
+      if (constructor == closedVectorPath::ID) {
+        func(static_cast<closedVectorPath &>(obj));
+        return true;
+      }
+      break;
+    case 1979:
+      if (constructor == updateChatUnreadReactionCount::ID) {
+        func(static_cast<updateChatUnreadReactionCount &>(obj));
+        return true;
+      }
+      break;
+    case 1981:
+      if (constructor == chatInviteLinkCount::ID) {
+        func(static_cast<chatInviteLinkCount &>(obj));
+        return true;
+      }
+      break;
+    case 1984:
+      if (constructor == storageStatisticsByFileType::ID) {
+        func(static_cast<storageStatisticsByFileType &>(obj));
+        return true;
+      }
+      break;
+    case 1986:
+      if (constructor == inputCredentialsGooglePay::ID) {
+        func(static_cast<inputCredentialsGooglePay &>(obj));
+        return true;
+      }
+      break;
+    case 1989:
+      if (constructor == termsOfService::ID) {
+        func(static_cast<termsOfService &>(obj));
+        return true;
+      }
+      break;
+    case 1992:
+      if (constructor == updateChatAction::ID) {
+        func(static_cast<updateChatAction &>(obj));
+        return true;
+      }
+      break;
+    case 1993:
+      if (constructor == notificationGroupTypeSecretChat::ID) {
+        func(static_cast<notificationGroupTypeSecretChat &>(obj));
+        return true;
+      }
+      break;
+    case 1997:
+      if (constructor == updateCall::ID) {
+        func(static_cast<updateCall &>(obj));
+        return true;
+      }
+      break;
+    case 1998:
+      if (constructor == passportSuitableElement::ID) {
+        func(static_cast<passportSuitableElement &>(obj));
+        return true;
+      }
+      break;
+    case 1999:
+      if (constructor == chatEventInviteLinkDeleted::ID) {
+        func(static_cast<chatEventInviteLinkDeleted &>(obj));
+        return true;
+      }
+      break;
+    case 2000:
+      if (constructor == chatReportReasonCustom::ID) {
+        func(static_cast<chatReportReasonCustom &>(obj));
+        return true;
+      }
+      break;
+    case 2002:
+      if (constructor == messageInviteVideoChatParticipants::ID) {
+        func(static_cast<messageInviteVideoChatParticipants &>(obj));
+        return true;
+      }
+      break;
+    case 2003:
+      if (constructor == thumbnailFormatGif::ID) {
+        func(static_cast<thumbnailFormatGif &>(obj));
+        return true;
+      }
+      break;
+    case 2004:
+      if (constructor == internalLinkTypePassportDataRequest::ID) {
+        func(static_cast<internalLinkTypePassportDataRequest &>(obj));
+        return true;
+      }
+      break;
+    case 2005:
+      if (constructor == thumbnailFormatWebp::ID) {
+        func(static_cast<thumbnailFormatWebp &>(obj));
+        return true;
+      }
+      break;
+    case 2008:
+      if (constructor == inlineQueryResultVenue::ID) {
+        func(static_cast<inlineQueryResultVenue &>(obj));
+        return true;
+      }
+      if (constructor == messageInteractionInfo::ID) {
+        func(static_cast<messageInteractionInfo &>(obj));
+        return true;
+      }
+      break;
+    case 2010:
+      if (constructor == chats::ID) {
+        func(static_cast<chats &>(obj));
+        return true;
+      }
+      break;
+    case 2011:
+      if (constructor == testString::ID) {
+        func(static_cast<testString &>(obj));
+        return true;
+      }
+      break;
+    case 2013:
+      if (constructor == supergroupFullInfo::ID) {
+        func(static_cast<supergroupFullInfo &>(obj));
+        return true;
+      }
+      if (constructor == updateSecretChat::ID) {
+        func(static_cast<updateSecretChat &>(obj));
+        return true;
+      }
+      break;
+    case 2014:
+      if (constructor == messageSticker::ID) {
+        func(static_cast<messageSticker &>(obj));
+        return true;
+      }
+      break;
+    case 2015:
+      if (constructor == updateLanguagePackStrings::ID) {
+        func(static_cast<updateLanguagePackStrings &>(obj));
+        return true;
+      }
+      break;
+    case 2017:
+      if (constructor == textEntityTypeItalic::ID) {
+        func(static_cast<textEntityTypeItalic &>(obj));
+        return true;
+      }
+      break;
+    case 2019:
+      if (constructor == pushMessageContentChatAddMembers::ID) {
+        func(static_cast<pushMessageContentChatAddMembers &>(obj));
+        return true;
+      }
+      break;
+    case 2026:
+      if (constructor == pageBlockVideo::ID) {
+        func(static_cast<pageBlockVideo &>(obj));
+        return true;
+      }
+      if (constructor == passportElementTypePersonalDetails::ID) {
+        func(static_cast<passportElementTypePersonalDetails &>(obj));
+        return true;
+      }
+      break;
+    case 2033:
+      if (constructor == pushMessageContentChatJoinByRequest::ID) {
+        func(static_cast<pushMessageContentChatJoinByRequest &>(obj));
+        return true;
+      }
+      break;
+    case 2034:
+      if (constructor == networkStatistics::ID) {
+        func(static_cast<networkStatistics &>(obj));
+        return true;
+      }
+      break;
+    case 2035:
+      if (constructor == messageBasicGroupChatCreate::ID) {
+        func(static_cast<messageBasicGroupChatCreate &>(obj));
+        return true;
+      }
+      break;
+    case 2042:
+      if (constructor == callDiscardReasonDisconnected::ID) {
+        func(static_cast<callDiscardReasonDisconnected &>(obj));
+        return true;
+      }
+      break;
+    case 2043:
+      if (constructor == autoDownloadSettings::ID) {
+        func(static_cast<autoDownloadSettings &>(obj));
+        return true;
+      }
+      break;
+    case 2045:
+      if (constructor == loginUrlInfoRequestConfirmation::ID) {
+        func(static_cast<loginUrlInfoRequestConfirmation &>(obj));
+        return true;
+      }
+      break;
+    default:
+      break;
+  }
+  return false;
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(Function &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch ((static_cast<std::uint32_t>(constructor) * 3800631789u) >> 22) {
+    case 0:
+      if (constructor == removeRecentHashtag::ID) {
+        func(static_cast<removeRecentHashtag &>(obj));
+        return true;
+      }
+      if (constructor == writeGeneratedFilePart::ID) {
+        func(static_cast<writeGeneratedFilePart &>(obj));
+        return true;
+      }
+      break;
+    case 1:
+      if (constructor == sendMessageAlbum::ID) {
+        func(static_cast<sendMessageAlbum &>(obj));
+        return true;
+      }
+      break;
+    case 7:
+      if (constructor == deleteLanguagePack::ID) {
+        func(static_cast<deleteLanguagePack &>(obj));
+        return true;
+      }
+      break;
+    case 8:
+      if (constructor == startGroupCallScreenSharing::ID) {
+        func(static_cast<startGroupCallScreenSharing &>(obj));
+        return true;
+      }
+      break;
+    case 14:
+      if (constructor == parseMarkdown::ID) {
+        func(static_cast<parseMarkdown &>(obj));
+        return true;
+      }
+      break;
+    case 15:
+      if (constructor == deleteChatReplyMarkup::ID) {
+        func(static_cast<deleteChatReplyMarkup &>(obj));
+        return true;
+      }
+      break;
+    case 17:
+      if (constructor == testCallString::ID) {
+        func(static_cast<testCallString &>(obj));
+        return true;
+      }
+      break;
+    case 18:
+      if (constructor == getCurrentState::ID) {
+        func(static_cast<getCurrentState &>(obj));
+        return true;
+      }
+      break;
+    case 20:
+      if (constructor == resetBackgrounds::ID) {
+        func(static_cast<resetBackgrounds &>(obj));
+        return true;
+      }
+      break;
+    case 24:
+      if (constructor == sendCallRating::ID) {
+        func(static_cast<sendCallRating &>(obj));
+        return true;
+      }
+      break;
+    case 26:
+      if (constructor == toggleGroupCallMuteNewParticipants::ID) {
+        func(static_cast<toggleGroupCallMuteNewParticipants &>(obj));
+        return true;
+      }
+      break;
+    case 28:
+      if (constructor == searchChatMembers::ID) {
+        func(static_cast<searchChatMembers &>(obj));
+        return true;
+      }
+      break;
+    case 30:
+      if (constructor == startScheduledGroupCall::ID) {
+        func(static_cast<startScheduledGroupCall &>(obj));
+        return true;
+      }
+      break;
+    case 35:
+      if (constructor == getGroupCall::ID) {
+        func(static_cast<getGroupCall &>(obj));
+        return true;
+      }
+      break;
+    case 36:
+      if (constructor == getChatStatistics::ID) {
+        func(static_cast<getChatStatistics &>(obj));
+        return true;
+      }
+      break;
+    case 37:
+      if (constructor == setUsername::ID) {
+        func(static_cast<setUsername &>(obj));
+        return true;
+      }
+      break;
+    case 38:
+      if (constructor == getStorageStatistics::ID) {
+        func(static_cast<getStorageStatistics &>(obj));
+        return true;
+      }
+      break;
+    case 40:
+      if (constructor == checkDatabaseEncryptionKey::ID) {
+        func(static_cast<checkDatabaseEncryptionKey &>(obj));
+        return true;
+      }
+      break;
+    case 41:
+      if (constructor == testSquareInt::ID) {
+        func(static_cast<testSquareInt &>(obj));
+        return true;
+      }
+      break;
+    case 44:
+      if (constructor == getChatJoinRequests::ID) {
+        func(static_cast<getChatJoinRequests &>(obj));
+        return true;
+      }
+      break;
+    case 45:
+      if (constructor == sendPhoneNumberConfirmationCode::ID) {
+        func(static_cast<sendPhoneNumberConfirmationCode &>(obj));
+        return true;
+      }
+      break;
+    case 47:
+      if (constructor == checkAuthenticationBotToken::ID) {
+        func(static_cast<checkAuthenticationBotToken &>(obj));
+        return true;
+      }
+      break;
+    case 50:
+      if (constructor == toggleGroupCallIsMyVideoPaused::ID) {
+        func(static_cast<toggleGroupCallIsMyVideoPaused &>(obj));
+        return true;
+      }
+      break;
+    case 51:
+      if (constructor == forwardMessages::ID) {
+        func(static_cast<forwardMessages &>(obj));
+        return true;
+      }
+      break;
+    case 52:
+      if (constructor == setTdlibParameters::ID) {
+        func(static_cast<setTdlibParameters &>(obj));
+        return true;
+      }
+      break;
+    case 53:
+      if (constructor == removeStickerFromSet::ID) {
+        func(static_cast<removeStickerFromSet &>(obj));
+        return true;
+      }
+      break;
+    case 54:
+      if (constructor == searchBackground::ID) {
+        func(static_cast<searchBackground &>(obj));
+        return true;
+      }
+      break;
+    case 56:
+      if (constructor == testNetwork::ID) {
+        func(static_cast<testNetwork &>(obj));
+        return true;
+      }
+      break;
+    case 59:
+      if (constructor == getSupergroup::ID) {
+        func(static_cast<getSupergroup &>(obj));
+        return true;
+      }
+      break;
+    case 60:
+      if (constructor == searchChatsNearby::ID) {
+        func(static_cast<searchChatsNearby &>(obj));
+        return true;
+      }
+      break;
+    case 61:
+      if (constructor == setLogVerbosityLevel::ID) {
+        func(static_cast<setLogVerbosityLevel &>(obj));
+        return true;
+      }
+      break;
+    case 62:
+      if (constructor == getUserProfilePhotos::ID) {
+        func(static_cast<getUserProfilePhotos &>(obj));
+        return true;
+      }
+      break;
+    case 64:
+      if (constructor == translateText::ID) {
+        func(static_cast<translateText &>(obj));
+        return true;
+      }
+      break;
+    case 67:
+      if (constructor == getAccountTtl::ID) {
+        func(static_cast<getAccountTtl &>(obj));
+        return true;
+      }
+      break;
+    case 73:
+      if (constructor == toggleGroupCallIsMyVideoEnabled::ID) {
+        func(static_cast<toggleGroupCallIsMyVideoEnabled &>(obj));
+        return true;
+      }
+      break;
+    case 75:
+      if (constructor == close::ID) {
+        func(static_cast<close &>(obj));
+        return true;
+      }
+      break;
+    case 77:
+      if (constructor == deleteMessages::ID) {
+        func(static_cast<deleteMessages &>(obj));
+        return true;
+      }
+      break;
+    case 86:
+      if (constructor == getBackgrounds::ID) {
+        func(static_cast<getBackgrounds &>(obj));
+        return true;
+      }
+      if (constructor == getChatScheduledMessages::ID) {
+        func(static_cast<getChatScheduledMessages &>(obj));
+        return true;
+      }
+      break;
+    case 91:
+      if (constructor == removeNotificationGroup::ID) {
+        func(static_cast<removeNotificationGroup &>(obj));
+        return true;
+      }
+      break;
+    case 94:
+      if (constructor == editMessageCaption::ID) {
+        func(static_cast<editMessageCaption &>(obj));
+        return true;
+      }
+      break;
+    case 95:
+      if (constructor == checkAuthenticationCode::ID) {
+        func(static_cast<checkAuthenticationCode &>(obj));
+        return true;
+      }
+      if (constructor == getChatInviteLinkMembers::ID) {
+        func(static_cast<getChatInviteLinkMembers &>(obj));
+        return true;
+      }
+      if (constructor == getLoginUrlInfo::ID) {
+        func(static_cast<getLoginUrlInfo &>(obj));
+        return true;
+      }
+      break;
+    case 97:
+      if (constructor == deleteChatHistory::ID) {
+        func(static_cast<deleteChatHistory &>(obj));
+        return true;
+      }
+      break;
+    case 99:
+      if (constructor == toggleSupergroupSignMessages::ID) {
+        func(static_cast<toggleSupergroupSignMessages &>(obj));
+        return true;
+      }
+      break;
+    case 102:
+      if (constructor == openChat::ID) {
+        func(static_cast<openChat &>(obj));
+        return true;
+      }
+      break;
+    case 104:
+      if (constructor == changeImportedContacts::ID) {
+        func(static_cast<changeImportedContacts &>(obj));
+        return true;
+      }
+      break;
+    case 105:
+      if (constructor == getPhoneNumberInfoSync::ID) {
+        func(static_cast<getPhoneNumberInfoSync &>(obj));
+        return true;
+      }
+      break;
+    case 109:
+      if (constructor == getChatEventLog::ID) {
+        func(static_cast<getChatEventLog &>(obj));
+        return true;
+      }
+      if (constructor == getWebPageInstantView::ID) {
+        func(static_cast<getWebPageInstantView &>(obj));
+        return true;
+      }
+      break;
+    case 111:
+      if (constructor == editMessageMedia::ID) {
+        func(static_cast<editMessageMedia &>(obj));
+        return true;
+      }
+      break;
+    case 113:
+      if (constructor == getExternalLink::ID) {
+        func(static_cast<getExternalLink &>(obj));
+        return true;
+      }
+      break;
+    case 115:
+      if (constructor == setPollAnswer::ID) {
+        func(static_cast<setPollAnswer &>(obj));
+        return true;
+      }
+      break;
+    case 119:
+      if (constructor == addNetworkStatistics::ID) {
+        func(static_cast<addNetworkStatistics &>(obj));
+        return true;
+      }
+      break;
+    case 120:
+      if (constructor == getPollVoters::ID) {
+        func(static_cast<getPollVoters &>(obj));
+        return true;
+      }
+      if (constructor == setPassportElementErrors::ID) {
+        func(static_cast<setPassportElementErrors &>(obj));
+        return true;
+      }
+      break;
+    case 121:
+      if (constructor == joinGroupCall::ID) {
+        func(static_cast<joinGroupCall &>(obj));
+        return true;
+      }
+      break;
+    case 122:
+      if (constructor == setChatMessageTtl::ID) {
+        func(static_cast<setChatMessageTtl &>(obj));
+        return true;
+      }
+      break;
+    case 123:
+      if (constructor == testProxy::ID) {
+        func(static_cast<testProxy &>(obj));
+        return true;
+      }
+      break;
+    case 127:
+      if (constructor == setChatLocation::ID) {
+        func(static_cast<setChatLocation &>(obj));
+        return true;
+      }
+      break;
+    case 130:
+      if (constructor == resendAuthenticationCode::ID) {
+        func(static_cast<resendAuthenticationCode &>(obj));
+        return true;
+      }
+      break;
+    case 131:
+      if (constructor == toggleSessionCanAcceptCalls::ID) {
+        func(static_cast<toggleSessionCanAcceptCalls &>(obj));
+        return true;
+      }
+      break;
+    case 133:
+      if (constructor == checkChatUsername::ID) {
+        func(static_cast<checkChatUsername &>(obj));
+        return true;
+      }
+      break;
+    case 135:
+      if (constructor == setChatMemberStatus::ID) {
+        func(static_cast<setChatMemberStatus &>(obj));
+        return true;
+      }
+      break;
+    case 138:
+      if (constructor == setMessageReaction::ID) {
+        func(static_cast<setMessageReaction &>(obj));
+        return true;
+      }
+      break;
+    case 142:
+      if (constructor == removeFavoriteSticker::ID) {
+        func(static_cast<removeFavoriteSticker &>(obj));
+        return true;
+      }
+      break;
+    case 143:
+      if (constructor == searchChatRecentLocationMessages::ID) {
+        func(static_cast<searchChatRecentLocationMessages &>(obj));
+        return true;
+      }
+      break;
+    case 145:
+      if (constructor == registerUser::ID) {
+        func(static_cast<registerUser &>(obj));
+        return true;
+      }
+      if (constructor == searchSecretMessages::ID) {
+        func(static_cast<searchSecretMessages &>(obj));
+        return true;
+      }
+      break;
+    case 146:
+      if (constructor == getAllPassportElements::ID) {
+        func(static_cast<getAllPassportElements &>(obj));
+        return true;
+      }
+      break;
+    case 152:
+      if (constructor == searchStickerSet::ID) {
+        func(static_cast<searchStickerSet &>(obj));
+        return true;
+      }
+      break;
+    case 153:
+      if (constructor == getAnimatedEmoji::ID) {
+        func(static_cast<getAnimatedEmoji &>(obj));
+        return true;
+      }
+      break;
+    case 156:
+      if (constructor == loadChats::ID) {
+        func(static_cast<loadChats &>(obj));
+        return true;
+      }
+      break;
+    case 157:
+      if (constructor == finishFileGeneration::ID) {
+        func(static_cast<finishFileGeneration &>(obj));
+        return true;
+      }
+      break;
+    case 159:
+      if (constructor == getLoginUrl::ID) {
+        func(static_cast<getLoginUrl &>(obj));
+        return true;
+      }
+      break;
+    case 167:
+      if (constructor == stopPoll::ID) {
+        func(static_cast<stopPoll &>(obj));
+        return true;
+      }
+      break;
+    case 168:
+      if (constructor == setChatNotificationSettings::ID) {
+        func(static_cast<setChatNotificationSettings &>(obj));
+        return true;
+      }
+      break;
+    case 169:
+      if (constructor == getNetworkStatistics::ID) {
+        func(static_cast<getNetworkStatistics &>(obj));
+        return true;
+      }
+      if (constructor == setChatPermissions::ID) {
+        func(static_cast<setChatPermissions &>(obj));
+        return true;
+      }
+      break;
+    case 170:
+      if (constructor == sendPhoneNumberVerificationCode::ID) {
+        func(static_cast<sendPhoneNumberVerificationCode &>(obj));
+        return true;
+      }
+      break;
+    case 171:
+      if (constructor == removeNotification::ID) {
+        func(static_cast<removeNotification &>(obj));
+        return true;
+      }
+      break;
+    case 173:
+      if (constructor == setGroupCallParticipantVolumeLevel::ID) {
+        func(static_cast<setGroupCallParticipantVolumeLevel &>(obj));
+        return true;
+      }
+      break;
+    case 176:
+      if (constructor == getMessagePublicForwards::ID) {
+        func(static_cast<getMessagePublicForwards &>(obj));
+        return true;
+      }
+      break;
+    case 183:
+      if (constructor == sharePhoneNumber::ID) {
+        func(static_cast<sharePhoneNumber &>(obj));
+        return true;
+      }
+      break;
+    case 186:
+      if (constructor == editInlineMessageCaption::ID) {
+        func(static_cast<editInlineMessageCaption &>(obj));
+        return true;
+      }
+      break;
+    case 189:
+      if (constructor == reportChatPhoto::ID) {
+        func(static_cast<reportChatPhoto &>(obj));
+        return true;
+      }
+      break;
+    case 193:
+      if (constructor == requestAuthenticationPasswordRecovery::ID) {
+        func(static_cast<requestAuthenticationPasswordRecovery &>(obj));
+        return true;
+      }
+      break;
+    case 194:
+      if (constructor == getMessages::ID) {
+        func(static_cast<getMessages &>(obj));
+        return true;
+      }
+      break;
+    case 196:
+      if (constructor == setAutoDownloadSettings::ID) {
+        func(static_cast<setAutoDownloadSettings &>(obj));
+        return true;
+      }
+      break;
+    case 197:
+      if (constructor == setSupergroupUsername::ID) {
+        func(static_cast<setSupergroupUsername &>(obj));
+        return true;
+      }
+      break;
+    case 199:
+      if (constructor == getCallbackQueryAnswer::ID) {
+        func(static_cast<getCallbackQueryAnswer &>(obj));
+        return true;
+      }
+      if (constructor == importMessages::ID) {
+        func(static_cast<importMessages &>(obj));
+        return true;
+      }
+      break;
+    case 200:
+      if (constructor == banChatMember::ID) {
+        func(static_cast<banChatMember &>(obj));
+        return true;
+      }
+      break;
+    case 202:
+      if (constructor == createNewStickerSet::ID) {
+        func(static_cast<createNewStickerSet &>(obj));
+        return true;
+      }
+      if (constructor == getStorageStatisticsFast::ID) {
+        func(static_cast<getStorageStatisticsFast &>(obj));
+        return true;
+      }
+      break;
+    case 207:
+      if (constructor == getChatAvailableMessageSenders::ID) {
+        func(static_cast<getChatAvailableMessageSenders &>(obj));
+        return true;
+      }
+      break;
+    case 208:
+      if (constructor == optimizeStorage::ID) {
+        func(static_cast<optimizeStorage &>(obj));
+        return true;
+      }
+      break;
+    case 213:
+      if (constructor == editInlineMessageMedia::ID) {
+        func(static_cast<editInlineMessageMedia &>(obj));
+        return true;
+      }
+      if (constructor == searchStickerSets::ID) {
+        func(static_cast<searchStickerSets &>(obj));
+        return true;
+      }
+      break;
+    case 223:
+      if (constructor == getSavedAnimations::ID) {
+        func(static_cast<getSavedAnimations &>(obj));
+        return true;
+      }
+      break;
+    case 228:
+      if (constructor == replacePrimaryChatInviteLink::ID) {
+        func(static_cast<replacePrimaryChatInviteLink &>(obj));
+        return true;
+      }
+      break;
+    case 233:
+      if (constructor == addContact::ID) {
+        func(static_cast<addContact &>(obj));
+        return true;
+      }
+      break;
+    case 236:
+      if (constructor == resendMessages::ID) {
+        func(static_cast<resendMessages &>(obj));
+        return true;
+      }
+      break;
+    case 237:
+      if (constructor == createCall::ID) {
+        func(static_cast<createCall &>(obj));
+        return true;
+      }
+      if (constructor == setAlarm::ID) {
+        func(static_cast<setAlarm &>(obj));
+        return true;
+      }
+      break;
+    case 241:
+      if (constructor == toggleChatHasProtectedContent::ID) {
+        func(static_cast<toggleChatHasProtectedContent &>(obj));
+        return true;
+      }
+      break;
+    case 242:
+      if (constructor == getImportedContactCount::ID) {
+        func(static_cast<getImportedContactCount &>(obj));
+        return true;
+      }
+      break;
+    case 245:
+      if (constructor == addFavoriteSticker::ID) {
+        func(static_cast<addFavoriteSticker &>(obj));
+        return true;
+      }
+      break;
+    case 263:
+      if (constructor == setAuthenticationPhoneNumber::ID) {
+        func(static_cast<setAuthenticationPhoneNumber &>(obj));
+        return true;
+      }
+      break;
+    case 267:
+      if (constructor == testUseUpdate::ID) {
+        func(static_cast<testUseUpdate &>(obj));
+        return true;
+      }
+      break;
+    case 272:
+      if (constructor == setChatSlowModeDelay::ID) {
+        func(static_cast<setChatSlowModeDelay &>(obj));
+        return true;
+      }
+      break;
+    case 274:
+      if (constructor == setFileGenerationProgress::ID) {
+        func(static_cast<setFileGenerationProgress &>(obj));
+        return true;
+      }
+      break;
+    case 276:
+      if (constructor == addChatToList::ID) {
+        func(static_cast<addChatToList &>(obj));
+        return true;
+      }
+      break;
+    case 278:
+      if (constructor == checkAuthenticationPassword::ID) {
+        func(static_cast<checkAuthenticationPassword &>(obj));
+        return true;
+      }
+      if (constructor == testCallBytes::ID) {
+        func(static_cast<testCallBytes &>(obj));
+        return true;
+      }
+      break;
+    case 280:
+      if (constructor == getFileExtension::ID) {
+        func(static_cast<getFileExtension &>(obj));
+        return true;
+      }
+      break;
+    case 281:
+      if (constructor == readFilePart::ID) {
+        func(static_cast<readFilePart &>(obj));
+        return true;
+      }
+      if (constructor == toggleGroupCallScreenSharingIsPaused::ID) {
+        func(static_cast<toggleGroupCallScreenSharingIsPaused &>(obj));
+        return true;
+      }
+      break;
+    case 282:
+      if (constructor == getUser::ID) {
+        func(static_cast<getUser &>(obj));
+        return true;
+      }
+      if (constructor == pingProxy::ID) {
+        func(static_cast<pingProxy &>(obj));
+        return true;
+      }
+      break;
+    case 283:
+      if (constructor == reportSupergroupSpam::ID) {
+        func(static_cast<reportSupergroupSpam &>(obj));
+        return true;
+      }
+      break;
+    case 292:
+      if (constructor == checkAuthenticationPasswordRecoveryCode::ID) {
+        func(static_cast<checkAuthenticationPasswordRecoveryCode &>(obj));
+        return true;
+      }
+      break;
+    case 295:
+      if (constructor == sendBotStartMessage::ID) {
+        func(static_cast<sendBotStartMessage &>(obj));
+        return true;
+      }
+      break;
+    case 297:
+      if (constructor == deleteProfilePhoto::ID) {
+        func(static_cast<deleteProfilePhoto &>(obj));
+        return true;
+      }
+      break;
+    case 298:
+      if (constructor == getTopChats::ID) {
+        func(static_cast<getTopChats &>(obj));
+        return true;
+      }
+      if (constructor == toggleGroupCallParticipantIsHandRaised::ID) {
+        func(static_cast<toggleGroupCallParticipantIsHandRaised &>(obj));
+        return true;
+      }
+      break;
+    case 299:
+      if (constructor == resetAllNotificationSettings::ID) {
+        func(static_cast<resetAllNotificationSettings &>(obj));
+        return true;
+      }
+      break;
+    case 303:
+      if (constructor == deleteAllCallMessages::ID) {
+        func(static_cast<deleteAllCallMessages &>(obj));
+        return true;
+      }
+      if (constructor == getInlineGameHighScores::ID) {
+        func(static_cast<getInlineGameHighScores &>(obj));
+        return true;
+      }
+      break;
+    case 304:
+      if (constructor == deletePassportElement::ID) {
+        func(static_cast<deletePassportElement &>(obj));
+        return true;
+      }
+      break;
+    case 305:
+      if (constructor == getInactiveSupergroupChats::ID) {
+        func(static_cast<getInactiveSupergroupChats &>(obj));
+        return true;
+      }
+      if (constructor == setCustomLanguagePack::ID) {
+        func(static_cast<setCustomLanguagePack &>(obj));
+        return true;
+      }
+      break;
+    case 307:
+      if (constructor == getStartupStatistics::ID) {
+        func(static_cast<getStartupStatistics &>(obj));
+        return true;
+      }
+      break;
+    case 312:
+      if (constructor == getGroupCallStreamSegment::ID) {
+        func(static_cast<getGroupCallStreamSegment &>(obj));
+        return true;
+      }
+      if (constructor == sendCallSignalingData::ID) {
+        func(static_cast<sendCallSignalingData &>(obj));
+        return true;
+      }
+      break;
+    case 318:
+      if (constructor == saveApplicationLogEvent::ID) {
+        func(static_cast<saveApplicationLogEvent &>(obj));
+        return true;
+      }
+      break;
+    case 321:
+      if (constructor == answerPreCheckoutQuery::ID) {
+        func(static_cast<answerPreCheckoutQuery &>(obj));
+        return true;
+      }
+      if (constructor == downloadFile::ID) {
+        func(static_cast<downloadFile &>(obj));
+        return true;
+      }
+      break;
+    case 325:
+      if (constructor == discardCall::ID) {
+        func(static_cast<discardCall &>(obj));
+        return true;
+      }
+      if (constructor == searchPublicChat::ID) {
+        func(static_cast<searchPublicChat &>(obj));
+        return true;
+      }
+      break;
+    case 329:
+      if (constructor == parseTextEntities::ID) {
+        func(static_cast<parseTextEntities &>(obj));
+        return true;
+      }
+      break;
+    case 332:
+      if (constructor == requestQrCodeAuthentication::ID) {
+        func(static_cast<requestQrCodeAuthentication &>(obj));
+        return true;
+      }
+      break;
+    case 334:
+      if (constructor == getChatListSnapshot::ID) {
+        func(static_cast<getChatListSnapshot &>(obj));
+        return true;
+      }
+      break;
+    case 339:
+      if (constructor == leaveGroupCall::ID) {
+        func(static_cast<leaveGroupCall &>(obj));
+        return true;
+      }
+      break;
+    case 341:
+      if (constructor == deleteFile::ID) {
+        func(static_cast<deleteFile &>(obj));
+        return true;
+      }
+      break;
+    case 342:
+      if (constructor == checkPhoneNumberConfirmationCode::ID) {
+        func(static_cast<checkPhoneNumberConfirmationCode &>(obj));
+        return true;
+      }
+      break;
+    case 343:
+      if (constructor == getMe::ID) {
+        func(static_cast<getMe &>(obj));
+        return true;
+      }
+      break;
+    case 344:
+      if (constructor == testGetDifference::ID) {
+        func(static_cast<testGetDifference &>(obj));
+        return true;
+      }
+      break;
+    case 346:
+      if (constructor == loadGroupCallParticipants::ID) {
+        func(static_cast<loadGroupCallParticipants &>(obj));
+        return true;
+      }
+      break;
+    case 347:
+      if (constructor == editCustomLanguagePackInfo::ID) {
+        func(static_cast<editCustomLanguagePackInfo &>(obj));
+        return true;
+      }
+      if (constructor == sendPassportAuthorizationForm::ID) {
+        func(static_cast<sendPassportAuthorizationForm &>(obj));
+        return true;
+      }
+      break;
+    case 349:
+      if (constructor == getEmojiSuggestionsUrl::ID) {
+        func(static_cast<getEmojiSuggestionsUrl &>(obj));
+        return true;
+      }
+      if (constructor == reorderInstalledStickerSets::ID) {
+        func(static_cast<reorderInstalledStickerSets &>(obj));
+        return true;
+      }
+      break;
+    case 351:
+      if (constructor == pinChatMessage::ID) {
+        func(static_cast<pinChatMessage &>(obj));
+        return true;
+      }
+      if (constructor == sendChatAction::ID) {
+        func(static_cast<sendChatAction &>(obj));
+        return true;
+      }
+      break;
+    case 353:
+      if (constructor == getMemoryStatistics::ID) {
+        func(static_cast<getMemoryStatistics &>(obj));
+        return true;
+      }
+      break;
+    case 355:
+      if (constructor == getBackgroundUrl::ID) {
+        func(static_cast<getBackgroundUrl &>(obj));
+        return true;
+      }
+      break;
+    case 357:
+      if (constructor == setAccountTtl::ID) {
+        func(static_cast<setAccountTtl &>(obj));
+        return true;
+      }
+      break;
+    case 358:
+      if (constructor == reorderChatFilters::ID) {
+        func(static_cast<reorderChatFilters &>(obj));
+        return true;
+      }
+      break;
+    case 361:
+      if (constructor == removeSavedAnimation::ID) {
+        func(static_cast<removeSavedAnimation &>(obj));
+        return true;
+      }
+      break;
+    case 366:
+      if (constructor == cancelPasswordReset::ID) {
+        func(static_cast<cancelPasswordReset &>(obj));
+        return true;
+      }
+      if (constructor == destroy::ID) {
+        func(static_cast<destroy &>(obj));
+        return true;
+      }
+      break;
+    case 368:
+      if (constructor == getRecommendedChatFilters::ID) {
+        func(static_cast<getRecommendedChatFilters &>(obj));
+        return true;
+      }
+      break;
+    case 369:
+      if (constructor == createNewSecretChat::ID) {
+        func(static_cast<createNewSecretChat &>(obj));
+        return true;
+      }
+      if (constructor == inviteGroupCallParticipants::ID) {
+        func(static_cast<inviteGroupCallParticipants &>(obj));
+        return true;
+      }
+      break;
+    case 372:
+      if (constructor == deleteAccount::ID) {
+        func(static_cast<deleteAccount &>(obj));
+        return true;
+      }
+      break;
+    case 373:
+      if (constructor == getExternalLinkInfo::ID) {
+        func(static_cast<getExternalLinkInfo &>(obj));
+        return true;
+      }
+      break;
+    case 374:
+      if (constructor == leaveChat::ID) {
+        func(static_cast<leaveChat &>(obj));
+        return true;
+      }
+      break;
+    case 378:
+      if (constructor == removeContacts::ID) {
+        func(static_cast<removeContacts &>(obj));
+        return true;
+      }
+      break;
+    case 381:
+      if (constructor == getLocalizationTargetInfo::ID) {
+        func(static_cast<getLocalizationTargetInfo &>(obj));
+        return true;
+      }
+      break;
+    case 390:
+      if (constructor == getMessageThread::ID) {
+        func(static_cast<getMessageThread &>(obj));
+        return true;
+      }
+      if (constructor == getRecoveryEmailAddress::ID) {
+        func(static_cast<getRecoveryEmailAddress &>(obj));
+        return true;
+      }
+      break;
+    case 391:
+      if (constructor == processChatJoinRequests::ID) {
+        func(static_cast<processChatJoinRequests &>(obj));
+        return true;
+      }
+      break;
+    case 395:
+      if (constructor == toggleChatIsPinned::ID) {
+        func(static_cast<toggleChatIsPinned &>(obj));
+        return true;
+      }
+      break;
+    case 396:
+      if (constructor == removeRecentlyFoundChat::ID) {
+        func(static_cast<removeRecentlyFoundChat &>(obj));
+        return true;
+      }
+      break;
+    case 399:
+      if (constructor == getStickerEmojis::ID) {
+        func(static_cast<getStickerEmojis &>(obj));
+        return true;
+      }
+      break;
+    case 401:
+      if (constructor == getChatMessageCalendar::ID) {
+        func(static_cast<getChatMessageCalendar &>(obj));
+        return true;
+      }
+      break;
+    case 406:
+      if (constructor == setInlineGameScore::ID) {
+        func(static_cast<setInlineGameScore &>(obj));
+        return true;
+      }
+      break;
+    case 407:
+      if (constructor == removeRecentSticker::ID) {
+        func(static_cast<removeRecentSticker &>(obj));
+        return true;
+      }
+      break;
+    case 409:
+      if (constructor == searchChats::ID) {
+        func(static_cast<searchChats &>(obj));
+        return true;
+      }
+      if (constructor == sendChatScreenshotTakenNotification::ID) {
+        func(static_cast<sendChatScreenshotTakenNotification &>(obj));
+        return true;
+      }
+      break;
+    case 410:
+      if (constructor == checkStickerSetName::ID) {
+        func(static_cast<checkStickerSetName &>(obj));
+        return true;
+      }
+      break;
+    case 411:
+      if (constructor == getGameHighScores::ID) {
+        func(static_cast<getGameHighScores &>(obj));
+        return true;
+      }
+      break;
+    case 412:
+      if (constructor == setLogStream::ID) {
+        func(static_cast<setLogStream &>(obj));
+        return true;
+      }
+      break;
+    case 414:
+      if (constructor == getChatFilterDefaultIconName::ID) {
+        func(static_cast<getChatFilterDefaultIconName &>(obj));
+        return true;
+      }
+      break;
+    case 415:
+      if (constructor == setInactiveSessionTtl::ID) {
+        func(static_cast<setInactiveSessionTtl &>(obj));
+        return true;
+      }
+      break;
+    case 417:
+      if (constructor == getWebPagePreview::ID) {
+        func(static_cast<getWebPagePreview &>(obj));
+        return true;
+      }
+      break;
+    case 418:
+      if (constructor == getMessageLink::ID) {
+        func(static_cast<getMessageLink &>(obj));
+        return true;
+      }
+      break;
+    case 419:
+      if (constructor == closeChat::ID) {
+        func(static_cast<closeChat &>(obj));
+        return true;
+      }
+      break;
+    case 425:
+      if (constructor == answerShippingQuery::ID) {
+        func(static_cast<answerShippingQuery &>(obj));
+        return true;
+      }
+      if (constructor == setBackground::ID) {
+        func(static_cast<setBackground &>(obj));
+        return true;
+      }
+      break;
+    case 429:
+      if (constructor == clearImportedContacts::ID) {
+        func(static_cast<clearImportedContacts &>(obj));
+        return true;
+      }
+      break;
+    case 433:
+      if (constructor == startGroupCallRecording::ID) {
+        func(static_cast<startGroupCallRecording &>(obj));
+        return true;
+      }
+      break;
+    case 434:
+      if (constructor == setGroupCallTitle::ID) {
+        func(static_cast<setGroupCallTitle &>(obj));
+        return true;
+      }
+      break;
+    case 435:
+      if (constructor == setDatabaseEncryptionKey::ID) {
+        func(static_cast<setDatabaseEncryptionKey &>(obj));
+        return true;
+      }
+      if (constructor == uploadStickerFile::ID) {
+        func(static_cast<uploadStickerFile &>(obj));
+        return true;
+      }
+      break;
+    case 437:
+      if (constructor == createSupergroupChat::ID) {
+        func(static_cast<createSupergroupChat &>(obj));
+        return true;
+      }
+      break;
+    case 439:
+      if (constructor == resendChangePhoneNumberCode::ID) {
+        func(static_cast<resendChangePhoneNumberCode &>(obj));
+        return true;
+      }
+      break;
+    case 440:
+      if (constructor == searchPublicChats::ID) {
+        func(static_cast<searchPublicChats &>(obj));
+        return true;
+      }
+      break;
+    case 441:
+      if (constructor == getAutoDownloadSettingsPresets::ID) {
+        func(static_cast<getAutoDownloadSettingsPresets &>(obj));
+        return true;
+      }
+      break;
+    case 448:
+      if (constructor == createNewSupergroupChat::ID) {
+        func(static_cast<createNewSupergroupChat &>(obj));
+        return true;
+      }
+      break;
+    case 449:
+      if (constructor == clearAllDraftMessages::ID) {
+        func(static_cast<clearAllDraftMessages &>(obj));
+        return true;
+      }
+      break;
+    case 452:
+      if (constructor == getProxyLink::ID) {
+        func(static_cast<getProxyLink &>(obj));
+        return true;
+      }
+      break;
+    case 453:
+      if (constructor == addSavedAnimation::ID) {
+        func(static_cast<addSavedAnimation &>(obj));
+        return true;
+      }
+      break;
+    case 454:
+      if (constructor == disconnectAllWebsites::ID) {
+        func(static_cast<disconnectAllWebsites &>(obj));
+        return true;
+      }
+      if (constructor == synchronizeLanguagePack::ID) {
+        func(static_cast<synchronizeLanguagePack &>(obj));
+        return true;
+      }
+      break;
+    case 455:
+      if (constructor == getGroupsInCommon::ID) {
+        func(static_cast<getGroupsInCommon &>(obj));
+        return true;
+      }
+      break;
+    case 456:
+      if (constructor == viewTrendingStickerSets::ID) {
+        func(static_cast<viewTrendingStickerSets &>(obj));
+        return true;
+      }
+      break;
+    case 457:
+      if (constructor == getLogStream::ID) {
+        func(static_cast<getLogStream &>(obj));
+        return true;
+      }
+      break;
+    case 463:
+      if (constructor == setPinnedChats::ID) {
+        func(static_cast<setPinnedChats &>(obj));
+        return true;
+      }
+      break;
+    case 465:
+      if (constructor == canTransferOwnership::ID) {
+        func(static_cast<canTransferOwnership &>(obj));
+        return true;
+      }
+      break;
+    case 467:
+      if (constructor == enableProxy::ID) {
+        func(static_cast<enableProxy &>(obj));
+        return true;
+      }
+      if (constructor == getSupergroupFullInfo::ID) {
+        func(static_cast<getSupergroupFullInfo &>(obj));
+        return true;
+      }
+      break;
+    case 470:
+      if (constructor == getJsonValue::ID) {
+        func(static_cast<getJsonValue &>(obj));
+        return true;
+      }
+      break;
+    case 471:
+      if (constructor == setLogTagVerbosityLevel::ID) {
+        func(static_cast<setLogTagVerbosityLevel &>(obj));
+        return true;
+      }
+      break;
+    case 475:
+      if (constructor == resendPhoneNumberConfirmationCode::ID) {
+        func(static_cast<resendPhoneNumberConfirmationCode &>(obj));
+        return true;
+      }
+      if (constructor == searchChatsOnServer::ID) {
+        func(static_cast<searchChatsOnServer &>(obj));
+        return true;
+      }
+      break;
+    case 477:
+      if (constructor == editMessageText::ID) {
+        func(static_cast<editMessageText &>(obj));
+        return true;
+      }
+      if (constructor == getChatMessageCount::ID) {
+        func(static_cast<getChatMessageCount &>(obj));
+        return true;
+      }
+      break;
+    case 479:
+      if (constructor == getChatSponsoredMessage::ID) {
+        func(static_cast<getChatSponsoredMessage &>(obj));
+        return true;
+      }
+      break;
+    case 480:
+      if (constructor == viewMessages::ID) {
+        func(static_cast<viewMessages &>(obj));
+        return true;
+      }
+      break;
+    case 481:
+      if (constructor == getPushReceiverId::ID) {
+        func(static_cast<getPushReceiverId &>(obj));
+        return true;
+      }
+      if (constructor == setPassportElement::ID) {
+        func(static_cast<setPassportElement &>(obj));
+        return true;
+      }
+      break;
+    case 482:
+      if (constructor == getChatHistory::ID) {
+        func(static_cast<getChatHistory &>(obj));
+        return true;
+      }
+      break;
+    case 483:
+      if (constructor == getSuitableDiscussionChats::ID) {
+        func(static_cast<getSuitableDiscussionChats &>(obj));
+        return true;
+      }
+      break;
+    case 491:
+      if (constructor == getChatListsToAddChat::ID) {
+        func(static_cast<getChatListsToAddChat &>(obj));
+        return true;
+      }
+      if (constructor == setUserPrivacySettingRules::ID) {
+        func(static_cast<setUserPrivacySettingRules &>(obj));
+        return true;
+      }
+      break;
+    case 494:
+      if (constructor == revokeGroupCallInviteLink::ID) {
+        func(static_cast<revokeGroupCallInviteLink &>(obj));
+        return true;
+      }
+      break;
+    case 495:
+      if (constructor == terminateSession::ID) {
+        func(static_cast<terminateSession &>(obj));
+        return true;
+      }
+      break;
+    case 496:
+      if (constructor == uploadFile::ID) {
+        func(static_cast<uploadFile &>(obj));
+        return true;
+      }
+      break;
+    case 497:
+      if (constructor == removeProxy::ID) {
+        func(static_cast<removeProxy &>(obj));
+        return true;
+      }
+      break;
+    case 503:
+      if (constructor == validateOrderInfo::ID) {
+        func(static_cast<validateOrderInfo &>(obj));
+        return true;
+      }
+      break;
+    case 504:
+      if (constructor == getMessageLocally::ID) {
+        func(static_cast<getMessageLocally &>(obj));
+        return true;
+      }
+      break;
+    case 505:
+      if (constructor == getChatFilter::ID) {
+        func(static_cast<getChatFilter &>(obj));
+        return true;
+      }
+      break;
+    case 506:
+      if (constructor == editChatInviteLink::ID) {
+        func(static_cast<editChatInviteLink &>(obj));
+        return true;
+      }
+      break;
+    case 509:
+      if (constructor == checkPasswordRecoveryCode::ID) {
+        func(static_cast<checkPasswordRecoveryCode &>(obj));
+        return true;
+      }
+      break;
+    case 516:
+      if (constructor == editMessageSchedulingState::ID) {
+        func(static_cast<editMessageSchedulingState &>(obj));
+        return true;
+      }
+      break;
+    case 517:
+      if (constructor == answerCustomQuery::ID) {
+        func(static_cast<answerCustomQuery &>(obj));
+        return true;
+      }
+      break;
+    case 519:
+      if (constructor == setChatClientData::ID) {
+        func(static_cast<setChatClientData &>(obj));
+        return true;
+      }
+      break;
+    case 521:
+      if (constructor == addChatMembers::ID) {
+        func(static_cast<addChatMembers &>(obj));
+        return true;
+      }
+      break;
+    case 524:
+      if (constructor == getFileDownloadedPrefixSize::ID) {
+        func(static_cast<getFileDownloadedPrefixSize &>(obj));
+        return true;
+      }
+      break;
+    case 526:
+      if (constructor == deleteSavedOrderInfo::ID) {
+        func(static_cast<deleteSavedOrderInfo &>(obj));
+        return true;
+      }
+      break;
+    case 528:
+      if (constructor == getProxies::ID) {
+        func(static_cast<getProxies &>(obj));
+        return true;
+      }
+      break;
+    case 531:
+      if (constructor == getRecentlyVisitedTMeUrls::ID) {
+        func(static_cast<getRecentlyVisitedTMeUrls &>(obj));
+        return true;
+      }
+      break;
+    case 535:
+      if (constructor == registerDevice::ID) {
+        func(static_cast<registerDevice &>(obj));
+        return true;
+      }
+      break;
+    case 538:
+      if (constructor == toggleSessionCanAcceptSecretChats::ID) {
+        func(static_cast<toggleSessionCanAcceptSecretChats &>(obj));
+        return true;
+      }
+      break;
+    case 539:
+      if (constructor == getChatSparseMessagePositions::ID) {
+        func(static_cast<getChatSparseMessagePositions &>(obj));
+        return true;
+      }
+      break;
+    case 541:
+      if (constructor == removeTopChat::ID) {
+        func(static_cast<removeTopChat &>(obj));
+        return true;
+      }
+      break;
+    case 543:
+      if (constructor == editMessageReplyMarkup::ID) {
+        func(static_cast<editMessageReplyMarkup &>(obj));
+        return true;
+      }
+      break;
+    case 547:
+      if (constructor == getRemoteFile::ID) {
+        func(static_cast<getRemoteFile &>(obj));
+        return true;
+      }
+      if (constructor == readAllChatReactions::ID) {
+        func(static_cast<readAllChatReactions &>(obj));
+        return true;
+      }
+      if (constructor == setBotUpdatesStatus::ID) {
+        func(static_cast<setBotUpdatesStatus &>(obj));
+        return true;
+      }
+      break;
+    case 549:
+      if (constructor == setGroupCallParticipantIsSpeaking::ID) {
+        func(static_cast<setGroupCallParticipantIsSpeaking &>(obj));
+        return true;
+      }
+      break;
+    case 550:
+      if (constructor == transferChatOwnership::ID) {
+        func(static_cast<transferChatOwnership &>(obj));
+        return true;
+      }
+      break;
+    case 553:
+      if (constructor == getGroupCallInviteLink::ID) {
+        func(static_cast<getGroupCallInviteLink &>(obj));
+        return true;
+      }
+      break;
+    case 555:
+      if (constructor == toggleChatDefaultDisableNotification::ID) {
+        func(static_cast<toggleChatDefaultDisableNotification &>(obj));
+        return true;
+      }
+      break;
+    case 558:
+      if (constructor == checkChangePhoneNumberCode::ID) {
+        func(static_cast<checkChangePhoneNumberCode &>(obj));
+        return true;
+      }
+      break;
+    case 564:
+      if (constructor == getSuggestedStickerSetName::ID) {
+        func(static_cast<getSuggestedStickerSetName &>(obj));
+        return true;
+      }
+      if (constructor == searchInstalledStickerSets::ID) {
+        func(static_cast<searchInstalledStickerSets &>(obj));
+        return true;
+      }
+      break;
+    case 567:
+      if (constructor == getCreatedPublicChats::ID) {
+        func(static_cast<getCreatedPublicChats &>(obj));
+        return true;
+      }
+      break;
+    case 569:
+      if (constructor == setChatDescription::ID) {
+        func(static_cast<setChatDescription &>(obj));
+        return true;
+      }
+      break;
+    case 570:
+      if (constructor == changePhoneNumber::ID) {
+        func(static_cast<changePhoneNumber &>(obj));
+        return true;
+      }
+      if (constructor == deleteRevokedChatInviteLink::ID) {
+        func(static_cast<deleteRevokedChatInviteLink &>(obj));
+        return true;
+      }
+      if (constructor == getMessage::ID) {
+        func(static_cast<getMessage &>(obj));
+        return true;
+      }
+      break;
+    case 572:
+      if (constructor == getSavedOrderInfo::ID) {
+        func(static_cast<getSavedOrderInfo &>(obj));
+        return true;
+      }
+      break;
+    case 574:
+      if (constructor == getChatPinnedMessage::ID) {
+        func(static_cast<getChatPinnedMessage &>(obj));
+        return true;
+      }
+      break;
+    case 575:
+      if (constructor == getLogTags::ID) {
+        func(static_cast<getLogTags &>(obj));
+        return true;
+      }
+      break;
+    case 580:
+      if (constructor == getAttachedStickerSets::ID) {
+        func(static_cast<getAttachedStickerSets &>(obj));
+        return true;
+      }
+      break;
+    case 581:
+      if (constructor == createVideoChat::ID) {
+        func(static_cast<createVideoChat &>(obj));
+        return true;
+      }
+      break;
+    case 583:
+      if (constructor == getChatNotificationSettingsExceptions::ID) {
+        func(static_cast<getChatNotificationSettingsExceptions &>(obj));
+        return true;
+      }
+      break;
+    case 585:
+      if (constructor == getBasicGroupFullInfo::ID) {
+        func(static_cast<getBasicGroupFullInfo &>(obj));
+        return true;
+      }
+      if (constructor == getMessageFileType::ID) {
+        func(static_cast<getMessageFileType &>(obj));
+        return true;
+      }
+      break;
+    case 586:
+      if (constructor == setUpdateFilter::ID) {
+        func(static_cast<setUpdateFilter &>(obj));
+        return true;
+      }
+      break;
+    case 587:
+      if (constructor == testCallVectorIntObject::ID) {
+        func(static_cast<testCallVectorIntObject &>(obj));
+        return true;
+      }
+      break;
+    case 589:
+      if (constructor == processChatJoinRequest::ID) {
+        func(static_cast<processChatJoinRequest &>(obj));
+        return true;
+      }
+      break;
+    case 592:
+      if (constructor == deleteAllRevokedChatInviteLinks::ID) {
+        func(static_cast<deleteAllRevokedChatInviteLinks &>(obj));
+        return true;
+      }
+      break;
+    case 594:
+      if (constructor == getStickerSet::ID) {
+        func(static_cast<getStickerSet &>(obj));
+        return true;
+      }
+      if (constructor == toggleChatIsMarkedAsUnread::ID) {
+        func(static_cast<toggleChatIsMarkedAsUnread &>(obj));
+        return true;
+      }
+      break;
+    case 595:
+      if (constructor == sendCustomRequest::ID) {
+        func(static_cast<sendCustomRequest &>(obj));
+        return true;
+      }
+      break;
+    case 598:
+      if (constructor == getNetworkRequestLatencyStatistics::ID) {
+        func(static_cast<getNetworkRequestLatencyStatistics &>(obj));
+        return true;
+      }
+      break;
+    case 601:
+      if (constructor == getConnectedWebsites::ID) {
+        func(static_cast<getConnectedWebsites &>(obj));
+        return true;
+      }
+      if (constructor == readAllChatMentions::ID) {
+        func(static_cast<readAllChatMentions &>(obj));
+        return true;
+      }
+      break;
+    case 604:
+      if (constructor == getBlockedMessageSenders::ID) {
+        func(static_cast<getBlockedMessageSenders &>(obj));
+        return true;
+      }
+      break;
+    case 608:
+      if (constructor == checkEmailAddressVerificationCode::ID) {
+        func(static_cast<checkEmailAddressVerificationCode &>(obj));
+        return true;
+      }
+      if (constructor == unpinChatMessage::ID) {
+        func(static_cast<unpinChatMessage &>(obj));
+        return true;
+      }
+      break;
+    case 615:
+      if (constructor == getSecretChat::ID) {
+        func(static_cast<getSecretChat &>(obj));
+        return true;
+      }
+      break;
+    case 619:
+      if (constructor == removeBackground::ID) {
+        func(static_cast<removeBackground &>(obj));
+        return true;
+      }
+      break;
+    case 620:
+      if (constructor == getTemporaryPasswordState::ID) {
+        func(static_cast<getTemporaryPasswordState &>(obj));
+        return true;
+      }
+      if (constructor == upgradeBasicGroupChatToSupergroupChat::ID) {
+        func(static_cast<upgradeBasicGroupChatToSupergroupChat &>(obj));
+        return true;
+      }
+      break;
+    case 621:
+      if (constructor == getLanguagePackInfo::ID) {
+        func(static_cast<getLanguagePackInfo &>(obj));
+        return true;
+      }
+      break;
+    case 623:
+      if (constructor == setChatPhoto::ID) {
+        func(static_cast<setChatPhoto &>(obj));
+        return true;
+      }
+      break;
+    case 632:
+      if (constructor == getChatAdministrators::ID) {
+        func(static_cast<getChatAdministrators &>(obj));
+        return true;
+      }
+      break;
+    case 638:
+      if (constructor == confirmQrCodeAuthentication::ID) {
+        func(static_cast<confirmQrCodeAuthentication &>(obj));
+        return true;
+      }
+      break;
+    case 639:
+      if (constructor == getPasswordState::ID) {
+        func(static_cast<getPasswordState &>(obj));
+        return true;
+      }
+      break;
+    case 643:
+      if (constructor == setNetworkType::ID) {
+        func(static_cast<setNetworkType &>(obj));
+        return true;
+      }
+      break;
+    case 645:
+      if (constructor == getLogVerbosityLevel::ID) {
+        func(static_cast<getLogVerbosityLevel &>(obj));
+        return true;
+      }
+      break;
+    case 648:
+      if (constructor == revokeChatInviteLink::ID) {
+        func(static_cast<revokeChatInviteLink &>(obj));
+        return true;
+      }
+      break;
+    case 650:
+      if (constructor == getApplicationConfig::ID) {
+        func(static_cast<getApplicationConfig &>(obj));
+        return true;
+      }
+      break;
+    case 652:
+      if (constructor == setGameScore::ID) {
+        func(static_cast<setGameScore &>(obj));
+        return true;
+      }
+      break;
+    case 653:
+      if (constructor == resendRecoveryEmailAddressCode::ID) {
+        func(static_cast<resendRecoveryEmailAddressCode &>(obj));
+        return true;
+      }
+      break;
+    case 655:
+      if (constructor == getLogTagVerbosityLevel::ID) {
+        func(static_cast<getLogTagVerbosityLevel &>(obj));
+        return true;
+      }
+      break;
+    case 656:
+      if (constructor == setChatAvailableReactions::ID) {
+        func(static_cast<setChatAvailableReactions &>(obj));
+        return true;
+      }
+      break;
+    case 657:
+      if (constructor == getActiveSessions::ID) {
+        func(static_cast<getActiveSessions &>(obj));
+        return true;
+      }
+      break;
+    case 659:
+      if (constructor == hideSuggestedAction::ID) {
+        func(static_cast<hideSuggestedAction &>(obj));
+        return true;
+      }
+      break;
+    case 673:
+      if (constructor == blockMessageSenderFromReplies::ID) {
+        func(static_cast<blockMessageSenderFromReplies &>(obj));
+        return true;
+      }
+      break;
+    case 676:
+      if (constructor == getChat::ID) {
+        func(static_cast<getChat &>(obj));
+        return true;
+      }
+      break;
+    case 679:
+      if (constructor == cancelUploadFile::ID) {
+        func(static_cast<cancelUploadFile &>(obj));
+        return true;
+      }
+      break;
+    case 686:
+      if (constructor == resetPassword::ID) {
+        func(static_cast<resetPassword &>(obj));
+        return true;
+      }
+      break;
+    case 691:
+      if (constructor == setName::ID) {
+        func(static_cast<setName &>(obj));
+        return true;
+      }
+      break;
+    case 692:
+      if (constructor == getPassportAuthorizationForm::ID) {
+        func(static_cast<getPassportAuthorizationForm &>(obj));
+        return true;
+      }
+      break;
+    case 696:
+      if (constructor == importContacts::ID) {
+        func(static_cast<importContacts &>(obj));
+        return true;
+      }
+      break;
+    case 697:
+      if (constructor == getScopeNotificationSettings::ID) {
+        func(static_cast<getScopeNotificationSettings &>(obj));
+        return true;
+      }
+      break;
+    case 701:
+      if (constructor == toggleSupergroupIsAllHistoryAvailable::ID) {
+        func(static_cast<toggleSupergroupIsAllHistoryAvailable &>(obj));
+        return true;
+      }
+      break;
+    case 702:
+      if (constructor == editInlineMessageReplyMarkup::ID) {
+        func(static_cast<editInlineMessageReplyMarkup &>(obj));
+        return true;
+      }
+      break;
+    case 703:
+      if (constructor == endGroupCall::ID) {
+        func(static_cast<endGroupCall &>(obj));
+        return true;
+      }
+      break;
+    case 705:
+      if (constructor == addLogMessage::ID) {
+        func(static_cast<addLogMessage &>(obj));
+        return true;
+      }
+      break;
+    case 708:
+      if (constructor == setCommands::ID) {
+        func(static_cast<setCommands &>(obj));
+        return true;
+      }
+      break;
+    case 715:
+      if (constructor == getChats::ID) {
+        func(static_cast<getChats &>(obj));
+        return true;
+      }
+      if (constructor == getPassportElement::ID) {
+        func(static_cast<getPassportElement &>(obj));
+        return true;
+      }
+      break;
+    case 716:
+      if (constructor == createTemporaryPassword::ID) {
+        func(static_cast<createTemporaryPassword &>(obj));
+        return true;
+      }
+      break;
+    case 722:
+      if (constructor == testCallVectorStringObject::ID) {
+        func(static_cast<testCallVectorStringObject &>(obj));
+        return true;
+      }
+      break;
+    case 723:
+      if (constructor == recoverAuthenticationPassword::ID) {
+        func(static_cast<recoverAuthenticationPassword &>(obj));
+        return true;
+      }
+      break;
+    case 724:
+      if (constructor == joinChat::ID) {
+        func(static_cast<joinChat &>(obj));
+        return true;
+      }
+      if (constructor == sendMessageBroadcast::ID) {
+        func(static_cast<sendMessageBroadcast &>(obj));
+        return true;
+      }
+      break;
+    case 727:
+      if (constructor == deleteSavedCredentials::ID) {
+        func(static_cast<deleteSavedCredentials &>(obj));
+        return true;
+      }
+      break;
+    case 728:
+      if (constructor == terminateAllOtherSessions::ID) {
+        func(static_cast<terminateAllOtherSessions &>(obj));
+        return true;
+      }
+      break;
+    case 729:
+      if (constructor == getCallbackQueryMessage::ID) {
+        func(static_cast<getCallbackQueryMessage &>(obj));
+        return true;
+      }
+      break;
+    case 732:
+      if (constructor == getPaymentForm::ID) {
+        func(static_cast<getPaymentForm &>(obj));
+        return true;
+      }
+      break;
+    case 744:
+      if (constructor == getFileMimeType::ID) {
+        func(static_cast<getFileMimeType &>(obj));
+        return true;
+      }
+      break;
+    case 745:
+      if (constructor == getOption::ID) {
+        func(static_cast<getOption &>(obj));
+        return true;
+      }
+      break;
+    case 747:
+      if (constructor == getMessageAddedReactions::ID) {
+        func(static_cast<getMessageAddedReactions &>(obj));
+        return true;
+      }
+      break;
+    case 752:
+      if (constructor == searchHashtags::ID) {
+        func(static_cast<searchHashtags &>(obj));
+        return true;
+      }
+      break;
+    case 756:
+      if (constructor == checkChatInviteLink::ID) {
+        func(static_cast<checkChatInviteLink &>(obj));
+        return true;
+      }
+      if (constructor == deleteChat::ID) {
+        func(static_cast<deleteChat &>(obj));
+        return true;
+      }
+      if (constructor == getVideoChatAvailableParticipants::ID) {
+        func(static_cast<getVideoChatAvailableParticipants &>(obj));
+        return true;
+      }
+      break;
+    case 758:
+      if (constructor == getMarkdownText::ID) {
+        func(static_cast<getMarkdownText &>(obj));
+        return true;
+      }
+      break;
+    case 760:
+      if (constructor == checkRecoveryEmailAddressCode::ID) {
+        func(static_cast<checkRecoveryEmailAddressCode &>(obj));
+        return true;
+      }
+      if (constructor == getContacts::ID) {
+        func(static_cast<getContacts &>(obj));
+        return true;
+      }
+      break;
+    case 763:
+      if (constructor == deleteChatFilter::ID) {
+        func(static_cast<deleteChatFilter &>(obj));
+        return true;
+      }
+      break;
+    case 765:
+      if (constructor == checkPhoneNumberVerificationCode::ID) {
+        func(static_cast<checkPhoneNumberVerificationCode &>(obj));
+        return true;
+      }
+      if (constructor == getMessageLinkInfo::ID) {
+        func(static_cast<getMessageLinkInfo &>(obj));
+        return true;
+      }
+      break;
+    case 767:
+      if (constructor == getRuntimeMetrics::ID) {
+        func(static_cast<getRuntimeMetrics &>(obj));
+        return true;
+      }
+      break;
+    case 768:
+      if (constructor == getStickers::ID) {
+        func(static_cast<getStickers &>(obj));
+        return true;
+      }
+      break;
+    case 769:
+      if (constructor == getRecentInlineBots::ID) {
+        func(static_cast<getRecentInlineBots &>(obj));
+        return true;
+      }
+      break;
+    case 770:
+      if (constructor == unpinAllChatMessages::ID) {
+        func(static_cast<unpinAllChatMessages &>(obj));
+        return true;
+      }
+      break;
+    case 771:
+      if (constructor == getFile::ID) {
+        func(static_cast<getFile &>(obj));
+        return true;
+      }
+      break;
+    case 775:
+      if (constructor == getPhoneNumberInfo::ID) {
+        func(static_cast<getPhoneNumberInfo &>(obj));
+        return true;
+      }
+      break;
+    case 776:
+      if (constructor == getRecentStickers::ID) {
+        func(static_cast<getRecentStickers &>(obj));
+        return true;
+      }
+      break;
+    case 777:
+      if (constructor == setChatMessageSender::ID) {
+        func(static_cast<setChatMessageSender &>(obj));
+        return true;
+      }
+      break;
+    case 779:
+      if (constructor == getPassportAuthorizationFormAvailableElements::ID) {
+        func(static_cast<getPassportAuthorizationFormAvailableElements &>(obj));
+        return true;
+      }
+      break;
+    case 782:
+      if (constructor == deleteCommands::ID) {
+        func(static_cast<deleteCommands &>(obj));
+        return true;
+      }
+      break;
+    case 783:
+      if (constructor == getSupportUser::ID) {
+        func(static_cast<getSupportUser &>(obj));
+        return true;
+      }
+      break;
+    case 784:
+      if (constructor == getMapThumbnailFile::ID) {
+        func(static_cast<getMapThumbnailFile &>(obj));
+        return true;
+      }
+      break;
+    case 787:
+      if (constructor == getUserFullInfo::ID) {
+        func(static_cast<getUserFullInfo &>(obj));
+        return true;
+      }
+      break;
+    case 790:
+      if (constructor == searchEmojis::ID) {
+        func(static_cast<searchEmojis &>(obj));
+        return true;
+      }
+      break;
+    case 791:
+      if (constructor == openMessageContent::ID) {
+        func(static_cast<openMessageContent &>(obj));
+        return true;
+      }
+      break;
+    case 793:
+      if (constructor == addLocalMessage::ID) {
+        func(static_cast<addLocalMessage &>(obj));
+        return true;
+      }
+      if (constructor == getMessageStatistics::ID) {
+        func(static_cast<getMessageStatistics &>(obj));
+        return true;
+      }
+      break;
+    case 794:
+      if (constructor == editProxy::ID) {
+        func(static_cast<editProxy &>(obj));
+        return true;
+      }
+      break;
+    case 795:
+      if (constructor == testCallVectorInt::ID) {
+        func(static_cast<testCallVectorInt &>(obj));
+        return true;
+      }
+      break;
+    case 797:
+      if (constructor == getDatabaseStatistics::ID) {
+        func(static_cast<getDatabaseStatistics &>(obj));
+        return true;
+      }
+      if (constructor == getLanguagePackString::ID) {
+        func(static_cast<getLanguagePackString &>(obj));
+        return true;
+      }
+      break;
+    case 798:
+      if (constructor == resendEmailAddressVerificationCode::ID) {
+        func(static_cast<resendEmailAddressVerificationCode &>(obj));
+        return true;
+      }
+      break;
+    case 799:
+      if (constructor == createBasicGroupChat::ID) {
+        func(static_cast<createBasicGroupChat &>(obj));
+        return true;
+      }
+      if (constructor == searchChatMessages::ID) {
+        func(static_cast<searchChatMessages &>(obj));
+        return true;
+      }
+      break;
+    case 803:
+      if (constructor == sendMessage::ID) {
+        func(static_cast<sendMessage &>(obj));
+        return true;
+      }
+      break;
+    case 804:
+      if (constructor == getMessageAvailableReactions::ID) {
+        func(static_cast<getMessageAvailableReactions &>(obj));
+        return true;
+      }
+      break;
+    case 806:
+      if (constructor == getMessageEmbeddingCode::ID) {
+        func(static_cast<getMessageEmbeddingCode &>(obj));
+        return true;
+      }
+      break;
+    case 807:
+      if (constructor == getInternalLinkType::ID) {
+        func(static_cast<getInternalLinkType &>(obj));
+        return true;
+      }
+      break;
+    case 819:
+      if (constructor == getCommands::ID) {
+        func(static_cast<getCommands &>(obj));
+        return true;
+      }
+      if (constructor == testReturnError::ID) {
+        func(static_cast<testReturnError &>(obj));
+        return true;
+      }
+      break;
+    case 822:
+      if (constructor == getMessageImportConfirmationText::ID) {
+        func(static_cast<getMessageImportConfirmationText &>(obj));
+        return true;
+      }
+      break;
+    case 823:
+      if (constructor == testCallVectorString::ID) {
+        func(static_cast<testCallVectorString &>(obj));
+        return true;
+      }
+      break;
+    case 827:
+      if (constructor == setProfilePhoto::ID) {
+        func(static_cast<setProfilePhoto &>(obj));
+        return true;
+      }
+      break;
+    case 832:
+      if (constructor == sendCallDebugInformation::ID) {
+        func(static_cast<sendCallDebugInformation &>(obj));
+        return true;
+      }
+      break;
+    case 837:
+      if (constructor == searchContacts::ID) {
+        func(static_cast<searchContacts &>(obj));
+        return true;
+      }
+      break;
+    case 838:
+      if (constructor == searchCallMessages::ID) {
+        func(static_cast<searchCallMessages &>(obj));
+        return true;
+      }
+      if (constructor == sendPaymentForm::ID) {
+        func(static_cast<sendPaymentForm &>(obj));
+        return true;
+      }
+      break;
+    case 839:
+      if (constructor == editInlineMessageText::ID) {
+        func(static_cast<editInlineMessageText &>(obj));
+        return true;
+      }
+      if (constructor == getChatMember::ID) {
+        func(static_cast<getChatMember &>(obj));
+        return true;
+      }
+      if (constructor == getMessageViewers::ID) {
+        func(static_cast<getMessageViewers &>(obj));
+        return true;
+      }
+      break;
+    case 842:
+      if (constructor == getAuthorizationState::ID) {
+        func(static_cast<getAuthorizationState &>(obj));
+        return true;
+      }
+      break;
+    case 843:
+      if (constructor == getBasicGroup::ID) {
+        func(static_cast<getBasicGroup &>(obj));
+        return true;
+      }
+      break;
+    case 844:
+      if (constructor == setChatDraftMessage::ID) {
+        func(static_cast<setChatDraftMessage &>(obj));
+        return true;
+      }
+      break;
+    case 845:
+      if (constructor == toggleSupergroupIsBroadcastGroup::ID) {
+        func(static_cast<toggleSupergroupIsBroadcastGroup &>(obj));
+        return true;
+      }
+      break;
+    case 850:
+      if (constructor == endGroupCallScreenSharing::ID) {
+        func(static_cast<endGroupCallScreenSharing &>(obj));
+        return true;
+      }
+      if (constructor == setCustomLanguagePackString::ID) {
+        func(static_cast<setCustomLanguagePackString &>(obj));
+        return true;
+      }
+      break;
+    case 852:
+      if (constructor == endGroupCallRecording::ID) {
+        func(static_cast<endGroupCallRecording &>(obj));
+        return true;
+      }
+      if (constructor == toggleGroupCallEnabledStartNotification::ID) {
+        func(static_cast<toggleGroupCallEnabledStartNotification &>(obj));
+        return true;
+      }
+      break;
+    case 855:
+      if (constructor == deleteChatMessagesByDate::ID) {
+        func(static_cast<deleteChatMessagesByDate &>(obj));
+        return true;
+      }
+      if (constructor == getUserPrivacySettingRules::ID) {
+        func(static_cast<getUserPrivacySettingRules &>(obj));
+        return true;
+      }
+      break;
+    case 856:
+      if (constructor == editInlineMessageLiveLocation::ID) {
+        func(static_cast<editInlineMessageLiveLocation &>(obj));
+        return true;
+      }
+      if (constructor == requestPasswordRecovery::ID) {
+        func(static_cast<requestPasswordRecovery &>(obj));
+        return true;
+      }
+      break;
+    case 858:
+      if (constructor == checkCreatedPublicChatsLimit::ID) {
+        func(static_cast<checkCreatedPublicChatsLimit &>(obj));
+        return true;
+      }
+      break;
+    case 859:
+      if (constructor == getTrendingStickerSets::ID) {
+        func(static_cast<getTrendingStickerSets &>(obj));
+        return true;
+      }
+      break;
+    case 864:
+      if (constructor == editChatFilter::ID) {
+        func(static_cast<editChatFilter &>(obj));
+        return true;
+      }
+      break;
+    case 870:
+      if (constructor == closeSecretChat::ID) {
+        func(static_cast<closeSecretChat &>(obj));
+        return true;
+      }
+      break;
+    case 872:
+      if (constructor == getRepliedMessage::ID) {
+        func(static_cast<getRepliedMessage &>(obj));
+        return true;
+      }
+      break;
+    case 874:
+      if (constructor == createNewBasicGroupChat::ID) {
+        func(static_cast<createNewBasicGroupChat &>(obj));
+        return true;
+      }
+      if (constructor == recoverPassword::ID) {
+        func(static_cast<recoverPassword &>(obj));
+        return true;
+      }
+      break;
+    case 875:
+      if (constructor == getRecentlyOpenedChats::ID) {
+        func(static_cast<getRecentlyOpenedChats &>(obj));
+        return true;
+      }
+      break;
+    case 876:
+      if (constructor == getInstalledStickerSets::ID) {
+        func(static_cast<getInstalledStickerSets &>(obj));
+        return true;
+      }
+      if (constructor == setLocation::ID) {
+        func(static_cast<setLocation &>(obj));
+        return true;
+      }
+      break;
+    case 878:
+      if (constructor == reportChat::ID) {
+        func(static_cast<reportChat &>(obj));
+        return true;
+      }
+      break;
+    case 879:
+      if (constructor == getSupergroupMembers::ID) {
+        func(static_cast<getSupergroupMembers &>(obj));
+        return true;
+      }
+      break;
+    case 881:
+      if (constructor == acceptTermsOfService::ID) {
+        func(static_cast<acceptTermsOfService &>(obj));
+        return true;
+      }
+      break;
+    case 882:
+      if (constructor == getLanguagePackStrings::ID) {
+        func(static_cast<getLanguagePackStrings &>(obj));
+        return true;
+      }
+      break;
+    case 883:
+      if (constructor == getApplicationDownloadLink::ID) {
+        func(static_cast<getApplicationDownloadLink &>(obj));
+        return true;
+      }
+      break;
+    case 888:
+      if (constructor == getPaymentReceipt::ID) {
+        func(static_cast<getPaymentReceipt &>(obj));
+        return true;
+      }
+      break;
+    case 889:
+      if (constructor == setRecoveryEmailAddress::ID) {
+        func(static_cast<setRecoveryEmailAddress &>(obj));
+        return true;
+      }
+      break;
+    case 890:
+      if (constructor == disconnectWebsite::ID) {
+        func(static_cast<disconnectWebsite &>(obj));
+        return true;
+      }
+      break;
+    case 891:
+      if (constructor == searchStickers::ID) {
+        func(static_cast<searchStickers &>(obj));
+        return true;
+      }
+      if (constructor == setPassword::ID) {
+        func(static_cast<setPassword &>(obj));
+        return true;
+      }
+      break;
+    case 892:
+      if (constructor == getFavoriteStickers::ID) {
+        func(static_cast<getFavoriteStickers &>(obj));
+        return true;
+      }
+      if (constructor == getSuggestedFileName::ID) {
+        func(static_cast<getSuggestedFileName &>(obj));
+        return true;
+      }
+      break;
+    case 893:
+      if (constructor == changeStickerSet::ID) {
+        func(static_cast<changeStickerSet &>(obj));
+        return true;
+      }
+      break;
+    case 895:
+      if (constructor == processPushNotification::ID) {
+        func(static_cast<processPushNotification &>(obj));
+        return true;
+      }
+      break;
+    case 896:
+      if (constructor == getActiveLiveLocationMessages::ID) {
+        func(static_cast<getActiveLiveLocationMessages &>(obj));
+        return true;
+      }
+      if (constructor == getInlineQueryResults::ID) {
+        func(static_cast<getInlineQueryResults &>(obj));
+        return true;
+      }
+      break;
+    case 899:
+      if (constructor == answerCallbackQuery::ID) {
+        func(static_cast<answerCallbackQuery &>(obj));
+        return true;
+      }
+      break;
+    case 901:
+      if (constructor == setBio::ID) {
+        func(static_cast<setBio &>(obj));
+        return true;
+      }
+      break;
+    case 902:
+      if (constructor == logOut::ID) {
+        func(static_cast<logOut &>(obj));
+        return true;
+      }
+      break;
+    case 903:
+      if (constructor == disableProxy::ID) {
+        func(static_cast<disableProxy &>(obj));
+        return true;
+      }
+      break;
+    case 908:
+      if (constructor == setChatTheme::ID) {
+        func(static_cast<setChatTheme &>(obj));
+        return true;
+      }
+      break;
+    case 910:
+      if (constructor == addProxy::ID) {
+        func(static_cast<addProxy &>(obj));
+        return true;
+      }
+      if (constructor == setChatTitle::ID) {
+        func(static_cast<setChatTitle &>(obj));
+        return true;
+      }
+      break;
+    case 911:
+      if (constructor == clearRecentStickers::ID) {
+        func(static_cast<clearRecentStickers &>(obj));
+        return true;
+      }
+      break;
+    case 915:
+      if (constructor == getChatMessageByDate::ID) {
+        func(static_cast<getChatMessageByDate &>(obj));
+        return true;
+      }
+      break;
+    case 921:
+      if (constructor == joinChatByInviteLink::ID) {
+        func(static_cast<joinChatByInviteLink &>(obj));
+        return true;
+      }
+      break;
+    case 926:
+      if (constructor == setScopeNotificationSettings::ID) {
+        func(static_cast<setScopeNotificationSettings &>(obj));
+        return true;
+      }
+      break;
+    case 936:
+      if (constructor == getDeepLinkInfo::ID) {
+        func(static_cast<getDeepLinkInfo &>(obj));
+        return true;
+      }
+      if (constructor == sendEmailAddressVerificationCode::ID) {
+        func(static_cast<sendEmailAddressVerificationCode &>(obj));
+        return true;
+      }
+      break;
+    case 938:
+      if (constructor == getArchivedStickerSets::ID) {
+        func(static_cast<getArchivedStickerSets &>(obj));
+        return true;
+      }
+      break;
+    case 939:
+      if (constructor == editMessageLiveLocation::ID) {
+        func(static_cast<editMessageLiveLocation &>(obj));
+        return true;
+      }
+      if (constructor == setSupergroupStickerSet::ID) {
+        func(static_cast<setSupergroupStickerSet &>(obj));
+        return true;
+      }
+      break;
+    case 944:
+      if (constructor == getJsonString::ID) {
+        func(static_cast<getJsonString &>(obj));
+        return true;
+      }
+      break;
+    case 946:
+      if (constructor == getCountries::ID) {
+        func(static_cast<getCountries &>(obj));
+        return true;
+      }
+      break;
+    case 947:
+      if (constructor == addRecentSticker::ID) {
+        func(static_cast<addRecentSticker &>(obj));
+        return true;
+      }
+      if (constructor == resetNetworkStatistics::ID) {
+        func(static_cast<resetNetworkStatistics &>(obj));
+        return true;
+      }
+      break;
+    case 953:
+      if (constructor == getBankCardInfo::ID) {
+        func(static_cast<getBankCardInfo &>(obj));
+        return true;
+      }
+      break;
+    case 954:
+      if (constructor == getTextEntities::ID) {
+        func(static_cast<getTextEntities &>(obj));
+        return true;
+      }
+      break;
+    case 955:
+      if (constructor == clickAnimatedEmojiMessage::ID) {
+        func(static_cast<clickAnimatedEmojiMessage &>(obj));
+        return true;
+      }
+      break;
+    case 957:
+      if (constructor == setStickerSetThumbnail::ID) {
+        func(static_cast<setStickerSetThumbnail &>(obj));
+        return true;
+      }
+      break;
+    case 960:
+      if (constructor == getChatInviteLink::ID) {
+        func(static_cast<getChatInviteLink &>(obj));
+        return true;
+      }
+      break;
+    case 963:
+      if (constructor == getCountryCode::ID) {
+        func(static_cast<getCountryCode &>(obj));
+        return true;
+      }
+      break;
+    case 964:
+      if (constructor == addRecentlyFoundChat::ID) {
+        func(static_cast<addRecentlyFoundChat &>(obj));
+        return true;
+      }
+      break;
+    case 970:
+      if (constructor == createPrivateChat::ID) {
+        func(static_cast<createPrivateChat &>(obj));
+        return true;
+      }
+      if (constructor == toggleMessageSenderIsBlocked::ID) {
+        func(static_cast<toggleMessageSenderIsBlocked &>(obj));
+        return true;
+      }
+      break;
+    case 972:
+      if (constructor == testCallEmpty::ID) {
+        func(static_cast<testCallEmpty &>(obj));
+        return true;
+      }
+      break;
+    case 973:
+      if (constructor == acceptCall::ID) {
+        func(static_cast<acceptCall &>(obj));
+        return true;
+      }
+      break;
+    case 974:
+      if (constructor == getMessageThreadHistory::ID) {
+        func(static_cast<getMessageThreadHistory &>(obj));
+        return true;
+      }
+      break;
+    case 979:
+      if (constructor == resendPhoneNumberVerificationCode::ID) {
+        func(static_cast<resendPhoneNumberVerificationCode &>(obj));
+        return true;
+      }
+      break;
+    case 987:
+      if (constructor == cleanFileName::ID) {
+        func(static_cast<cleanFileName &>(obj));
+        return true;
+      }
+      if (constructor == sendInlineQueryResultMessage::ID) {
+        func(static_cast<sendInlineQueryResultMessage &>(obj));
+        return true;
+      }
+      break;
+    case 992:
+      if (constructor == createChatFilter::ID) {
+        func(static_cast<createChatFilter &>(obj));
+        return true;
+      }
+      break;
+    case 995:
+      if (constructor == setVideoChatDefaultParticipant::ID) {
+        func(static_cast<setVideoChatDefaultParticipant &>(obj));
+        return true;
+      }
+      break;
+    case 997:
+      if (constructor == createSecretChat::ID) {
+        func(static_cast<createSecretChat &>(obj));
+        return true;
+      }
+      if (constructor == deleteChatMessagesBySender::ID) {
+        func(static_cast<deleteChatMessagesBySender &>(obj));
+        return true;
+      }
+      break;
+    case 999:
+      if (constructor == setOption::ID) {
+        func(static_cast<setOption &>(obj));
+        return true;
+      }
+      break;
+    case 1000:
+      if (constructor == getChatInviteLinkCounts::ID) {
+        func(static_cast<getChatInviteLinkCounts &>(obj));
+        return true;
+      }
+      break;
+    case 1002:
+      if (constructor == getStatisticalGraph::ID) {
+        func(static_cast<getStatisticalGraph &>(obj));
+        return true;
+      }
+      break;
+    case 1003:
+      if (constructor == removeChatActionBar::ID) {
+        func(static_cast<removeChatActionBar &>(obj));
+        return true;
+      }
+      break;
+    case 1004:
+      if (constructor == setStickerPositionInSet::ID) {
+        func(static_cast<setStickerPositionInSet &>(obj));
+        return true;
+      }
+      break;
+    case 1007:
+      if (constructor == addStickerToSet::ID) {
+        func(static_cast<addStickerToSet &>(obj));
+        return true;
+      }
+      break;
+    case 1009:
+      if (constructor == createChatInviteLink::ID) {
+        func(static_cast<createChatInviteLink &>(obj));
+        return true;
+      }
+      break;
+    case 1010:
+      if (constructor == clearRecentlyFoundChats::ID) {
+        func(static_cast<clearRecentlyFoundChats &>(obj));
+        return true;
+      }
+      break;
+    case 1011:
+      if (constructor == addCustomServerLanguagePack::ID) {
+        func(static_cast<addCustomServerLanguagePack &>(obj));
+        return true;
+      }
+      break;
+    case 1012:
+      if (constructor == searchMessages::ID) {
+        func(static_cast<searchMessages &>(obj));
+        return true;
+      }
+      break;
+    case 1013:
+      if (constructor == getChatInviteLinks::ID) {
+        func(static_cast<getChatInviteLinks &>(obj));
+        return true;
+      }
+      break;
+    case 1014:
+      if (constructor == cancelDownloadFile::ID) {
+        func(static_cast<cancelDownloadFile &>(obj));
+        return true;
+      }
+      break;
+    case 1015:
+      if (constructor == answerInlineQuery::ID) {
+        func(static_cast<answerInlineQuery &>(obj));
+        return true;
+      }
+      break;
+    case 1016:
+      if (constructor == getPreferredCountryLanguage::ID) {
+        func(static_cast<getPreferredCountryLanguage &>(obj));
+        return true;
+      }
+      break;
+    case 1019:
+      if (constructor == setChatDiscussionGroup::ID) {
+        func(static_cast<setChatDiscussionGroup &>(obj));
+        return true;
+      }
+      break;
+    case 1022:
+      if (constructor == addChatMember::ID) {
+        func(static_cast<addChatMember &>(obj));
+        return true;
+      }
+      break;
+    case 1023:
+      if (constructor == toggleGroupCallParticipantIsMuted::ID) {
+        func(static_cast<toggleGroupCallParticipantIsMuted &>(obj));
+        return true;
+      }
+      break;
+    default:
+      break;
+  }
+  return false;
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(AuthenticationCodeType &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case authenticationCodeTypeTelegramMessage::ID:
+      func(static_cast<authenticationCodeTypeTelegramMessage &>(obj));
+      return true;
+    case authenticationCodeTypeSms::ID:
+      func(static_cast<authenticationCodeTypeSms &>(obj));
+      return true;
+    case authenticationCodeTypeCall::ID:
+      func(static_cast<authenticationCodeTypeCall &>(obj));
+      return true;
+    case authenticationCodeTypeFlashCall::ID:
+      func(static_cast<authenticationCodeTypeFlashCall &>(obj));
+      return true;
+    case authenticationCodeTypeMissedCall::ID:
+      func(static_cast<authenticationCodeTypeMissedCall &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(AuthorizationState &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case authorizationStateWaitTdlibParameters::ID:
+      func(static_cast<authorizationStateWaitTdlibParameters &>(obj));
+      return true;
+    case authorizationStateWaitEncryptionKey::ID:
+      func(static_cast<authorizationStateWaitEncryptionKey &>(obj));
+      return true;
+    case authorizationStateWaitPhoneNumber::ID:
+      func(static_cast<authorizationStateWaitPhoneNumber &>(obj));
+      return true;
+    case authorizationStateWaitCode::ID:
+      func(static_cast<authorizationStateWaitCode &>(obj));
+      return true;
+    case authorizationStateWaitOtherDeviceConfirmation::ID:
+      func(static_cast<authorizationStateWaitOtherDeviceConfirmation &>(obj));
+      return true;
+    case authorizationStateWaitRegistration::ID:
+      func(static_cast<authorizationStateWaitRegistration &>(obj));
+      return true;
+    case authorizationStateWaitPassword::ID:
+      func(static_cast<authorizationStateWaitPassword &>(obj));
+      return true;
+    case authorizationStateReady::ID:
+      func(static_cast<authorizationStateReady &>(obj));
+      return true;
+    case authorizationStateLoggingOut::ID:
+      func(static_cast<authorizationStateLoggingOut &>(obj));
+      return true;
+    case authorizationStateClosing::ID:
+      func(static_cast<authorizationStateClosing &>(obj));
+      return true;
+    case authorizationStateClosed::ID:
+      func(static_cast<authorizationStateClosed &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(BackgroundFill &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case backgroundFillSolid::ID:
+      func(static_cast<backgroundFillSolid &>(obj));
+      return true;
+    case backgroundFillGradient::ID:
+      func(static_cast<backgroundFillGradient &>(obj));
+      return true;
+    case backgroundFillFreeformGradient::ID:
+      func(static_cast<backgroundFillFreeformGradient &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(BackgroundType &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case backgroundTypeWallpaper::ID:
+      func(static_cast<backgroundTypeWallpaper &>(obj));
+      return true;
+    case backgroundTypePattern::ID:
+      func(static_cast<backgroundTypePattern &>(obj));
+      return true;
+    case backgroundTypeFill::ID:
+      func(static_cast<backgroundTypeFill &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(BotCommandScope &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case botCommandScopeDefault::ID:
+      func(static_cast<botCommandScopeDefault &>(obj));
+      return true;
+    case botCommandScopeAllPrivateChats::ID:
+      func(static_cast<botCommandScopeAllPrivateChats &>(obj));
+      return true;
+    case botCommandScopeAllGroupChats::ID:
+      func(static_cast<botCommandScopeAllGroupChats &>(obj));
+      return true;
+    case botCommandScopeAllChatAdministrators::ID:
+      func(static_cast<botCommandScopeAllChatAdministrators &>(obj));
+      return true;
+    case botCommandScopeChat::ID:
+      func(static_cast<botCommandScopeChat &>(obj));
+      return true;
+    case botCommandScopeChatAdministrators::ID:
+      func(static_cast<botCommandScopeChatAdministrators &>(obj));
+      return true;
+    case botCommandScopeChatMember::ID:
+      func(static_cast<botCommandScopeChatMember &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(CallDiscardReason &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case callDiscardReasonEmpty::ID:
+      func(static_cast<callDiscardReasonEmpty &>(obj));
+      return true;
+    case callDiscardReasonMissed::ID:
+      func(static_cast<callDiscardReasonMissed &>(obj));
+      return true;
+    case callDiscardReasonDeclined::ID:
+      func(static_cast<callDiscardReasonDeclined &>(obj));
+      return true;
+    case callDiscardReasonDisconnected::ID:
+      func(static_cast<callDiscardReasonDisconnected &>(obj));
+      return true;
+    case callDiscardReasonHungUp::ID:
+      func(static_cast<callDiscardReasonHungUp &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(CallProblem &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case callProblemEcho::ID:
+      func(static_cast<callProblemEcho &>(obj));
+      return true;
+    case callProblemNoise::ID:
+      func(static_cast<callProblemNoise &>(obj));
+      return true;
+    case callProblemInterruptions::ID:
+      func(static_cast<callProblemInterruptions &>(obj));
+      return true;
+    case callProblemDistortedSpeech::ID:
+      func(static_cast<callProblemDistortedSpeech &>(obj));
+      return true;
+    case callProblemSilentLocal::ID:
+      func(static_cast<callProblemSilentLocal &>(obj));
+      return true;
+    case callProblemSilentRemote::ID:
+      func(static_cast<callProblemSilentRemote &>(obj));
+      return true;
+    case callProblemDropped::ID:
+      func(static_cast<callProblemDropped &>(obj));
+      return true;
+    case callProblemDistortedVideo::ID:
+      func(static_cast<callProblemDistortedVideo &>(obj));
+      return true;
+    case callProblemPixelatedVideo::ID:
+      func(static_cast<callProblemPixelatedVideo &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(CallServerType &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case callServerTypeTelegramReflector::ID:
+      func(static_cast<callServerTypeTelegramReflector &>(obj));
+      return true;
+    case callServerTypeWebrtc::ID:
+      func(static_cast<callServerTypeWebrtc &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(CallState &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case callStatePending::ID:
+      func(static_cast<callStatePending &>(obj));
+      return true;
+    case callStateExchangingKeys::ID:
+      func(static_cast<callStateExchangingKeys &>(obj));
+      return true;
+    case callStateReady::ID:
+      func(static_cast<callStateReady &>(obj));
+      return true;
+    case callStateHangingUp::ID:
+      func(static_cast<callStateHangingUp &>(obj));
+      return true;
+    case callStateDiscarded::ID:
+      func(static_cast<callStateDiscarded &>(obj));
+      return true;
+    case callStateError::ID:
+      func(static_cast<callStateError &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(CallbackQueryPayload &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case callbackQueryPayloadData::ID:
+      func(static_cast<callbackQueryPayloadData &>(obj));
+      return true;
+    case callbackQueryPayloadDataWithPassword::ID:
+      func(static_cast<callbackQueryPayloadDataWithPassword &>(obj));
+      return true;
+    case callbackQueryPayloadGame::ID:
+      func(static_cast<callbackQueryPayloadGame &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(CanTransferOwnershipResult &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case canTransferOwnershipResultOk::ID:
+      func(static_cast<canTransferOwnershipResultOk &>(obj));
+      return true;
+    case canTransferOwnershipResultPasswordNeeded::ID:
+      func(static_cast<canTransferOwnershipResultPasswordNeeded &>(obj));
+      return true;
+    case canTransferOwnershipResultPasswordTooFresh::ID:
+      func(static_cast<canTransferOwnershipResultPasswordTooFresh &>(obj));
+      return true;
+    case canTransferOwnershipResultSessionTooFresh::ID:
+      func(static_cast<canTransferOwnershipResultSessionTooFresh &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(ChatAction &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case chatActionTyping::ID:
+      func(static_cast<chatActionTyping &>(obj));
+      return true;
+    case chatActionRecordingVideo::ID:
+      func(static_cast<chatActionRecordingVideo &>(obj));
+      return true;
+    case chatActionUploadingVideo::ID:
+      func(static_cast<chatActionUploadingVideo &>(obj));
+      return true;
+    case chatActionRecordingVoiceNote::ID:
+      func(static_cast<chatActionRecordingVoiceNote &>(obj));
+      return true;
+    case chatActionUploadingVoiceNote::ID:
+      func(static_cast<chatActionUploadingVoiceNote &>(obj));
+      return true;
+    case chatActionUploadingPhoto::ID:
+      func(static_cast<chatActionUploadingPhoto &>(obj));
+      return true;
+    case chatActionUploadingDocument::ID:
+      func(static_cast<chatActionUploadingDocument &>(obj));
+      return true;
+    case chatActionChoosingSticker::ID:
+      func(static_cast<chatActionChoosingSticker &>(obj));
+      return true;
+    case chatActionChoosingLocation::ID:
+      func(static_cast<chatActionChoosingLocation &>(obj));
+      return true;
+    case chatActionChoosingContact::ID:
+      func(static_cast<chatActionChoosingContact &>(obj));
+      return true;
+    case chatActionStartPlayingGame::ID:
+      func(static_cast<chatActionStartPlayingGame &>(obj));
+      return true;
+    case chatActionRecordingVideoNote::ID:
+      func(static_cast<chatActionRecordingVideoNote &>(obj));
+      return true;
+    case chatActionUploadingVideoNote::ID:
+      func(static_cast<chatActionUploadingVideoNote &>(obj));
+      return true;
+    case chatActionWatchingAnimations::ID:
+      func(static_cast<chatActionWatchingAnimations &>(obj));
+      return true;
+    case chatActionCancel::ID:
+      func(static_cast<chatActionCancel &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(ChatActionBar &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case chatActionBarReportSpam::ID:
+      func(static_cast<chatActionBarReportSpam &>(obj));
+      return true;
+    case chatActionBarReportUnrelatedLocation::ID:
+      func(static_cast<chatActionBarReportUnrelatedLocation &>(obj));
+      return true;
+    case chatActionBarInviteMembers::ID:
+      func(static_cast<chatActionBarInviteMembers &>(obj));
+      return true;
+    case chatActionBarReportAddBlock::ID:
+      func(static_cast<chatActionBarReportAddBlock &>(obj));
+      return true;
+    case chatActionBarAddContact::ID:
+      func(static_cast<chatActionBarAddContact &>(obj));
+      return true;
+    case chatActionBarSharePhoneNumber::ID:
+      func(static_cast<chatActionBarSharePhoneNumber &>(obj));
+      return true;
+    case chatActionBarJoinRequest::ID:
+      func(static_cast<chatActionBarJoinRequest &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(ChatEventAction &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch ((static_cast<std::uint32_t>(constructor) * 3054660601u) >> 25) {
+    case 1:
+      if (constructor == chatEventLinkedChatChanged::ID) {
+        func(static_cast<chatEventLinkedChatChanged &>(obj));
+        return true;
+      }
+      break;
+    case 5:
+      if (constructor == chatEventMessageEdited::ID) {
+        func(static_cast<chatEventMessageEdited &>(obj));
+        return true;
+      }
+      break;
+    case 13:
+      if (constructor == chatEventInvitesToggled::ID) {
+        func(static_cast<chatEventInvitesToggled &>(obj));
+        return true;
+      }
+      break;
+    case 14:
+      if (constructor == chatEventIsAllHistoryAvailableToggled::ID) {
+        func(static_cast<chatEventIsAllHistoryAvailableToggled &>(obj));
+        return true;
+      }
+      break;
+    case 24:
+      if (constructor == chatEventMemberJoinedByInviteLink::ID) {
+        func(static_cast<chatEventMemberJoinedByInviteLink &>(obj));
+        return true;
+      }
+      break;
+    case 25:
+      if (constructor == chatEventVideoChatEnded::ID) {
+        func(static_cast<chatEventVideoChatEnded &>(obj));
+        return true;
+      }
+      break;
+    case 32:
+      if (constructor == chatEventMessagePinned::ID) {
+        func(static_cast<chatEventMessagePinned &>(obj));
+        return true;
+      }
+      break;
+    case 33:
+      if (constructor == chatEventUsernameChanged::ID) {
+        func(static_cast<chatEventUsernameChanged &>(obj));
+        return true;
+      }
+      break;
+    case 38:
+      if (constructor == chatEventStickerSetChanged::ID) {
+        func(static_cast<chatEventStickerSetChanged &>(obj));
+        return true;
+      }
+      break;
+    case 51:
+      if (constructor == chatEventSignMessagesToggled::ID) {
+        func(static_cast<chatEventSignMessagesToggled &>(obj));
+        return true;
+      }
+      break;
+    case 56:
+      if (constructor == chatEventMemberLeft::ID) {
+        func(static_cast<chatEventMemberLeft &>(obj));
+        return true;
+      }
+      break;
+    case 57:
+      if (constructor == chatEventHasProtectedContentToggled::ID) {
+        func(static_cast<chatEventHasProtectedContentToggled &>(obj));
+        return true;
+      }
+      break;
+    case 60:
+      if (constructor == chatEventVideoChatCreated::ID) {
+        func(static_cast<chatEventVideoChatCreated &>(obj));
+        return true;
+      }
+      break;
+    case 61:
+      if (constructor == chatEventInviteLinkDeleted::ID) {
+        func(static_cast<chatEventInviteLinkDeleted &>(obj));
+        return true;
+      }
+      break;
+    case 71:
+      if (constructor == chatEventPhotoChanged::ID) {
+        func(static_cast<chatEventPhotoChanged &>(obj));
+        return true;
+      }
+      break;
+    case 72:
+      if (constructor == chatEventAvailableReactionsChanged::ID) {
+        func(static_cast<chatEventAvailableReactionsChanged &>(obj));
+        return true;
+      }
+      break;
+    case 76:
+      if (constructor == chatEventPermissionsChanged::ID) {
+        func(static_cast<chatEventPermissionsChanged &>(obj));
+        return true;
+      }
+      break;
+    case 77:
+      if (constructor == chatEventDescriptionChanged::ID) {
+        func(static_cast<chatEventDescriptionChanged &>(obj));
+        return true;
+      }
+      break;
+    case 78:
+      if (constructor == chatEventSlowModeDelayChanged::ID) {
+        func(static_cast<chatEventSlowModeDelayChanged &>(obj));
+        return true;
+      }
+      break;
+    case 79:
+      if (constructor == chatEventVideoChatParticipantVolumeLevelChanged::ID) {
+        func(static_cast<chatEventVideoChatParticipantVolumeLevelChanged &>(obj));
+        return true;
+      }
+      break;
+    case 83:
+      if (constructor == chatEventMessageUnpinned::ID) {
+        func(static_cast<chatEventMessageUnpinned &>(obj));
+        return true;
+      }
+      break;
+    case 84:
+      if (constructor == chatEventPollStopped::ID) {
+        func(static_cast<chatEventPollStopped &>(obj));
+        return true;
+      }
+      break;
+    case 92:
+      if (constructor == chatEventVideoChatMuteNewParticipantsToggled::ID) {
+        func(static_cast<chatEventVideoChatMuteNewParticipantsToggled &>(obj));
+        return true;
+      }
+      break;
+    case 97:
+      if (constructor == chatEventInviteLinkRevoked::ID) {
+        func(static_cast<chatEventInviteLinkRevoked &>(obj));
+        return true;
+      }
+      break;
+    case 99:
+      if (constructor == chatEventTitleChanged::ID) {
+        func(static_cast<chatEventTitleChanged &>(obj));
+        return true;
+      }
+      break;
+    case 105:
+      if (constructor == chatEventLocationChanged::ID) {
+        func(static_cast<chatEventLocationChanged &>(obj));
+        return true;
+      }
+      break;
+    case 107:
+      if (constructor == chatEventMemberJoined::ID) {
+        func(static_cast<chatEventMemberJoined &>(obj));
+        return true;
+      }
+      break;
+    case 108:
+      if (constructor == chatEventMemberInvited::ID) {
+        func(static_cast<chatEventMemberInvited &>(obj));
+        return true;
+      }
+      break;
+    case 113:
+      if (constructor == chatEventMessageTtlChanged::ID) {
+        func(static_cast<chatEventMessageTtlChanged &>(obj));
+        return true;
+      }
+      break;
+    case 115:
+      if (constructor == chatEventVideoChatParticipantIsMutedToggled::ID) {
+        func(static_cast<chatEventVideoChatParticipantIsMutedToggled &>(obj));
+        return true;
+      }
+      break;
+    case 116:
+      if (constructor == chatEventMessageDeleted::ID) {
+        func(static_cast<chatEventMessageDeleted &>(obj));
+        return true;
+      }
+      break;
+    case 119:
+      if (constructor == chatEventMemberJoinedByRequest::ID) {
+        func(static_cast<chatEventMemberJoinedByRequest &>(obj));
+        return true;
+      }
+      break;
+    case 120:
+      if (constructor == chatEventMemberPromoted::ID) {
+        func(static_cast<chatEventMemberPromoted &>(obj));
+        return true;
+      }
+      break;
+    case 122:
+      if (constructor == chatEventMemberRestricted::ID) {
+        func(static_cast<chatEventMemberRestricted &>(obj));
+        return true;
+      }
+      break;
+    case 125:
+      if (constructor == chatEventInviteLinkEdited::ID) {
+        func(static_cast<chatEventInviteLinkEdited &>(obj));
+        return true;
+      }
+      break;
+    default:
+      break;
+  }
+  return false;
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(ChatList &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case chatListMain::ID:
+      func(static_cast<chatListMain &>(obj));
+      return true;
+    case chatListArchive::ID:
+      func(static_cast<chatListArchive &>(obj));
+      return true;
+    case chatListFilter::ID:
+      func(static_cast<chatListFilter &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(ChatMemberStatus &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case chatMemberStatusCreator::ID:
+      func(static_cast<chatMemberStatusCreator &>(obj));
+      return true;
+    case chatMemberStatusAdministrator::ID:
+      func(static_cast<chatMemberStatusAdministrator &>(obj));
+      return true;
+    case chatMemberStatusMember::ID:
+      func(static_cast<chatMemberStatusMember &>(obj));
+      return true;
+    case chatMemberStatusRestricted::ID:
+      func(static_cast<chatMemberStatusRestricted &>(obj));
+      return true;
+    case chatMemberStatusLeft::ID:
+      func(static_cast<chatMemberStatusLeft &>(obj));
+      return true;
+    case chatMemberStatusBanned::ID:
+      func(static_cast<chatMemberStatusBanned &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(ChatMembersFilter &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case chatMembersFilterContacts::ID:
+      func(static_cast<chatMembersFilterContacts &>(obj));
+      return true;
+    case chatMembersFilterAdministrators::ID:
+      func(static_cast<chatMembersFilterAdministrators &>(obj));
+      return true;
+    case chatMembersFilterMembers::ID:
+      func(static_cast<chatMembersFilterMembers &>(obj));
+      return true;
+    case chatMembersFilterMention::ID:
+      func(static_cast<chatMembersFilterMention &>(obj));
+      return true;
+    case chatMembersFilterRestricted::ID:
+      func(static_cast<chatMembersFilterRestricted &>(obj));
+      return true;
+    case chatMembersFilterBanned::ID:
+      func(static_cast<chatMembersFilterBanned &>(obj));
+      return true;
+    case chatMembersFilterBots::ID:
+      func(static_cast<chatMembersFilterBots &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(ChatReportReason &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case chatReportReasonSpam::ID:
+      func(static_cast<chatReportReasonSpam &>(obj));
+      return true;
+    case chatReportReasonViolence::ID:
+      func(static_cast<chatReportReasonViolence &>(obj));
+      return true;
+    case chatReportReasonPornography::ID:
+      func(static_cast<chatReportReasonPornography &>(obj));
+      return true;
+    case chatReportReasonChildAbuse::ID:
+      func(static_cast<chatReportReasonChildAbuse &>(obj));
+      return true;
+    case chatReportReasonCopyright::ID:
+      func(static_cast<chatReportReasonCopyright &>(obj));
+      return true;
+    case chatReportReasonUnrelatedLocation::ID:
+      func(static_cast<chatReportReasonUnrelatedLocation &>(obj));
+      return true;
+    case chatReportReasonFake::ID:
+      func(static_cast<chatReportReasonFake &>(obj));
+      return true;
+    case chatReportReasonCustom::ID:
+      func(static_cast<chatReportReasonCustom &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(ChatSource &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case chatSourceMtprotoProxy::ID:
+      func(static_cast<chatSourceMtprotoProxy &>(obj));
+      return true;
+    case chatSourcePublicServiceAnnouncement::ID:
+      func(static_cast<chatSourcePublicServiceAnnouncement &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(ChatStatistics &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case chatStatisticsSupergroup::ID:
+      func(static_cast<chatStatisticsSupergroup &>(obj));
+      return true;
+    case chatStatisticsChannel::ID:
+      func(static_cast<chatStatisticsChannel &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(ChatType &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case chatTypePrivate::ID:
+      func(static_cast<chatTypePrivate &>(obj));
+      return true;
+    case chatTypeBasicGroup::ID:
+      func(static_cast<chatTypeBasicGroup &>(obj));
+      return true;
+    case chatTypeSupergroup::ID:
+      func(static_cast<chatTypeSupergroup &>(obj));
+      return true;
+    case chatTypeSecret::ID:
+      func(static_cast<chatTypeSecret &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(CheckChatUsernameResult &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case checkChatUsernameResultOk::ID:
+      func(static_cast<checkChatUsernameResultOk &>(obj));
+      return true;
+    case checkChatUsernameResultUsernameInvalid::ID:
+      func(static_cast<checkChatUsernameResultUsernameInvalid &>(obj));
+      return true;
+    case checkChatUsernameResultUsernameOccupied::ID:
+      func(static_cast<checkChatUsernameResultUsernameOccupied &>(obj));
+      return true;
+    case checkChatUsernameResultPublicChatsTooMuch::ID:
+      func(static_cast<checkChatUsernameResultPublicChatsTooMuch &>(obj));
+      return true;
+    case checkChatUsernameResultPublicGroupsUnavailable::ID:
+      func(static_cast<checkChatUsernameResultPublicGroupsUnavailable &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(CheckStickerSetNameResult &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case checkStickerSetNameResultOk::ID:
+      func(static_cast<checkStickerSetNameResultOk &>(obj));
+      return true;
+    case checkStickerSetNameResultNameInvalid::ID:
+      func(static_cast<checkStickerSetNameResultNameInvalid &>(obj));
+      return true;
+    case checkStickerSetNameResultNameOccupied::ID:
+      func(static_cast<checkStickerSetNameResultNameOccupied &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(ConnectionState &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case connectionStateWaitingForNetwork::ID:
+      func(static_cast<connectionStateWaitingForNetwork &>(obj));
+      return true;
+    case connectionStateConnectingToProxy::ID:
+      func(static_cast<connectionStateConnectingToProxy &>(obj));
+      return true;
+    case connectionStateConnecting::ID:
+      func(static_cast<connectionStateConnecting &>(obj));
+      return true;
+    case connectionStateUpdating::ID:
+      func(static_cast<connectionStateUpdating &>(obj));
+      return true;
+    case connectionStateReady::ID:
+      func(static_cast<connectionStateReady &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(DeviceToken &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case deviceTokenFirebaseCloudMessaging::ID:
+      func(static_cast<deviceTokenFirebaseCloudMessaging &>(obj));
+      return true;
+    case deviceTokenApplePush::ID:
+      func(static_cast<deviceTokenApplePush &>(obj));
+      return true;
+    case deviceTokenApplePushVoIP::ID:
+      func(static_cast<deviceTokenApplePushVoIP &>(obj));
+      return true;
+    case deviceTokenWindowsPush::ID:
+      func(static_cast<deviceTokenWindowsPush &>(obj));
+      return true;
+    case deviceTokenMicrosoftPush::ID:
+      func(static_cast<deviceTokenMicrosoftPush &>(obj));
+      return true;
+    case deviceTokenMicrosoftPushVoIP::ID:
+      func(static_cast<deviceTokenMicrosoftPushVoIP &>(obj));
+      return true;
+    case deviceTokenWebPush::ID:
+      func(static_cast<deviceTokenWebPush &>(obj));
+      return true;
+    case deviceTokenSimplePush::ID:
+      func(static_cast<deviceTokenSimplePush &>(obj));
+      return true;
+    case deviceTokenUbuntuPush::ID:
+      func(static_cast<deviceTokenUbuntuPush &>(obj));
+      return true;
+    case deviceTokenBlackBerryPush::ID:
+      func(static_cast<deviceTokenBlackBerryPush &>(obj));
+      return true;
+    case deviceTokenTizenPush::ID:
+      func(static_cast<deviceTokenTizenPush &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(DiceStickers &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case diceStickersRegular::ID:
+      func(static_cast<diceStickersRegular &>(obj));
+      return true;
+    case diceStickersSlotMachine::ID:
+      func(static_cast<diceStickersSlotMachine &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(FileType &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch ((static_cast<std::uint32_t>(constructor) * 1355882817u) >> 27) {
+    case 1:
+      if (constructor == fileTypeSecret::ID) {
+        func(static_cast<fileTypeSecret &>(obj));
+        return true;
+      }
+      break;
+    case 2:
+      if (constructor == fileTypeSecure::ID) {
+        func(static_cast<fileTypeSecure &>(obj));
+        return true;
+      }
+      break;
+    case 3:
+      if (constructor == fileTypeNone::ID) {
+        func(static_cast<fileTypeNone &>(obj));
+        return true;
+      }
+      break;
+    case 4:
+      if (constructor == fileTypeVoiceNote::ID) {
+        func(static_cast<fileTypeVoiceNote &>(obj));
+        return true;
+      }
+      break;
+    case 5:
+      if (constructor == fileTypeAudio::ID) {
+        func(static_cast<fileTypeAudio &>(obj));
+        return true;
+      }
+      break;
+    case 9:
+      if (constructor == fileTypePhoto::ID) {
+        func(static_cast<fileTypePhoto &>(obj));
+        return true;
+      }
+      break;
+    case 10:
+      if (constructor == fileTypeSticker::ID) {
+        func(static_cast<fileTypeSticker &>(obj));
+        return true;
+      }
+      break;
+    case 11:
+      if (constructor == fileTypeAnimation::ID) {
+        func(static_cast<fileTypeAnimation &>(obj));
+        return true;
+      }
+      break;
+    case 19:
+      if (constructor == fileTypeWallpaper::ID) {
+        func(static_cast<fileTypeWallpaper &>(obj));
+        return true;
+      }
+      break;
+    case 20:
+      if (constructor == fileTypeUnknown::ID) {
+        func(static_cast<fileTypeUnknown &>(obj));
+        return true;
+      }
+      break;
+    case 23:
+      if (constructor == fileTypeVideo::ID) {
+        func(static_cast<fileTypeVideo &>(obj));
+        return true;
+      }
+      break;
+    case 25:
+      if (constructor == fileTypeProfilePhoto::ID) {
+        func(static_cast<fileTypeProfilePhoto &>(obj));
+        return true;
+      }
+      break;
+    case 26:
+      if (constructor == fileTypeSecretThumbnail::ID) {
+        func(static_cast<fileTypeSecretThumbnail &>(obj));
+        return true;
+      }
+      break;
+    case 27:
+      if (constructor == fileTypeDocument::ID) {
+        func(static_cast<fileTypeDocument &>(obj));
+        return true;
+      }
+      break;
+    case 30:
+      if (constructor == fileTypeThumbnail::ID) {
+        func(static_cast<fileTypeThumbnail &>(obj));
+        return true;
+      }
+      break;
+    case 31:
+      if (constructor == fileTypeVideoNote::ID) {
+        func(static_cast<fileTypeVideoNote &>(obj));
+        return true;
+      }
+      break;
+    default:
+      break;
+  }
+  return false;
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(GroupCallVideoQuality &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case groupCallVideoQualityThumbnail::ID:
+      func(static_cast<groupCallVideoQualityThumbnail &>(obj));
+      return true;
+    case groupCallVideoQualityMedium::ID:
+      func(static_cast<groupCallVideoQualityMedium &>(obj));
+      return true;
+    case groupCallVideoQualityFull::ID:
+      func(static_cast<groupCallVideoQualityFull &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(InlineKeyboardButtonType &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case inlineKeyboardButtonTypeUrl::ID:
+      func(static_cast<inlineKeyboardButtonTypeUrl &>(obj));
+      return true;
+    case inlineKeyboardButtonTypeLoginUrl::ID:
+      func(static_cast<inlineKeyboardButtonTypeLoginUrl &>(obj));
+      return true;
+    case inlineKeyboardButtonTypeCallback::ID:
+      func(static_cast<inlineKeyboardButtonTypeCallback &>(obj));
+      return true;
+    case inlineKeyboardButtonTypeCallbackWithPassword::ID:
+      func(static_cast<inlineKeyboardButtonTypeCallbackWithPassword &>(obj));
+      return true;
+    case inlineKeyboardButtonTypeCallbackGame::ID:
+      func(static_cast<inlineKeyboardButtonTypeCallbackGame &>(obj));
+      return true;
+    case inlineKeyboardButtonTypeSwitchInline::ID:
+      func(static_cast<inlineKeyboardButtonTypeSwitchInline &>(obj));
+      return true;
+    case inlineKeyboardButtonTypeBuy::ID:
+      func(static_cast<inlineKeyboardButtonTypeBuy &>(obj));
+      return true;
+    case inlineKeyboardButtonTypeUser::ID:
+      func(static_cast<inlineKeyboardButtonTypeUser &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(InlineQueryResult &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case inlineQueryResultArticle::ID:
+      func(static_cast<inlineQueryResultArticle &>(obj));
+      return true;
+    case inlineQueryResultContact::ID:
+      func(static_cast<inlineQueryResultContact &>(obj));
+      return true;
+    case inlineQueryResultLocation::ID:
+      func(static_cast<inlineQueryResultLocation &>(obj));
+      return true;
+    case inlineQueryResultVenue::ID:
+      func(static_cast<inlineQueryResultVenue &>(obj));
+      return true;
+    case inlineQueryResultGame::ID:
+      func(static_cast<inlineQueryResultGame &>(obj));
+      return true;
+    case inlineQueryResultAnimation::ID:
+      func(static_cast<inlineQueryResultAnimation &>(obj));
+      return true;
+    case inlineQueryResultAudio::ID:
+      func(static_cast<inlineQueryResultAudio &>(obj));
+      return true;
+    case inlineQueryResultDocument::ID:
+      func(static_cast<inlineQueryResultDocument &>(obj));
+      return true;
+    case inlineQueryResultPhoto::ID:
+      func(static_cast<inlineQueryResultPhoto &>(obj));
+      return true;
+    case inlineQueryResultSticker::ID:
+      func(static_cast<inlineQueryResultSticker &>(obj));
+      return true;
+    case inlineQueryResultVideo::ID:
+      func(static_cast<inlineQueryResultVideo &>(obj));
+      return true;
+    case inlineQueryResultVoiceNote::ID:
+      func(static_cast<inlineQueryResultVoiceNote &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(InputBackground &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case inputBackgroundLocal::ID:
+      func(static_cast<inputBackgroundLocal &>(obj));
+      return true;
+    case inputBackgroundRemote::ID:
+      func(static_cast<inputBackgroundRemote &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(InputChatPhoto &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case inputChatPhotoPrevious::ID:
+      func(static_cast<inputChatPhotoPrevious &>(obj));
+      return true;
+    case inputChatPhotoStatic::ID:
+      func(static_cast<inputChatPhotoStatic &>(obj));
+      return true;
+    case inputChatPhotoAnimation::ID:
+      func(static_cast<inputChatPhotoAnimation &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(InputCredentials &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case inputCredentialsSaved::ID:
+      func(static_cast<inputCredentialsSaved &>(obj));
+      return true;
+    case inputCredentialsNew::ID:
+      func(static_cast<inputCredentialsNew &>(obj));
+      return true;
+    case inputCredentialsApplePay::ID:
+      func(static_cast<inputCredentialsApplePay &>(obj));
+      return true;
+    case inputCredentialsGooglePay::ID:
+      func(static_cast<inputCredentialsGooglePay &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(InputFile &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case inputFileId::ID:
+      func(static_cast<inputFileId &>(obj));
+      return true;
+    case inputFileRemote::ID:
+      func(static_cast<inputFileRemote &>(obj));
+      return true;
+    case inputFileLocal::ID:
+      func(static_cast<inputFileLocal &>(obj));
+      return true;
+    case inputFileGenerated::ID:
+      func(static_cast<inputFileGenerated &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(InputInlineQueryResult &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case inputInlineQueryResultAnimation::ID:
+      func(static_cast<inputInlineQueryResultAnimation &>(obj));
+      return true;
+    case inputInlineQueryResultArticle::ID:
+      func(static_cast<inputInlineQueryResultArticle &>(obj));
+      return true;
+    case inputInlineQueryResultAudio::ID:
+      func(static_cast<inputInlineQueryResultAudio &>(obj));
+      return true;
+    case inputInlineQueryResultContact::ID:
+      func(static_cast<inputInlineQueryResultContact &>(obj));
+      return true;
+    case inputInlineQueryResultDocument::ID:
+      func(static_cast<inputInlineQueryResultDocument &>(obj));
+      return true;
+    case inputInlineQueryResultGame::ID:
+      func(static_cast<inputInlineQueryResultGame &>(obj));
+      return true;
+    case inputInlineQueryResultLocation::ID:
+      func(static_cast<inputInlineQueryResultLocation &>(obj));
+      return true;
+    case inputInlineQueryResultPhoto::ID:
+      func(static_cast<inputInlineQueryResultPhoto &>(obj));
+      return true;
+    case inputInlineQueryResultSticker::ID:
+      func(static_cast<inputInlineQueryResultSticker &>(obj));
+      return true;
+    case inputInlineQueryResultVenue::ID:
+      func(static_cast<inputInlineQueryResultVenue &>(obj));
+      return true;
+    case inputInlineQueryResultVideo::ID:
+      func(static_cast<inputInlineQueryResultVideo &>(obj));
+      return true;
+    case inputInlineQueryResultVoiceNote::ID:
+      func(static_cast<inputInlineQueryResultVoiceNote &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(InputMessageContent &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch ((static_cast<std::uint32_t>(constructor) * 2703273161u) >> 26) {
+    case 1:
+      if (constructor == inputMessagePoll::ID) {
+        func(static_cast<inputMessagePoll &>(obj));
+        return true;
+      }
+      break;
+    case 4:
+      if (constructor == inputMessageSticker::ID) {
+        func(static_cast<inputMessageSticker &>(obj));
+        return true;
+      }
+      break;
+    case 16:
+      if (constructor == inputMessageVenue::ID) {
+        func(static_cast<inputMessageVenue &>(obj));
+        return true;
+      }
+      break;
+    case 19:
+      if (constructor == inputMessageVideo::ID) {
+        func(static_cast<inputMessageVideo &>(obj));
+        return true;
+      }
+      break;
+    case 20:
+      if (constructor == inputMessageGame::ID) {
+        func(static_cast<inputMessageGame &>(obj));
+        return true;
+      }
+      break;
+    case 28:
+      if (constructor == inputMessageDice::ID) {
+        func(static_cast<inputMessageDice &>(obj));
+        return true;
+      }
+      break;
+    case 29:
+      if (constructor == inputMessageInvoice::ID) {
+        func(static_cast<inputMessageInvoice &>(obj));
+        return true;
+      }
+      break;
+    case 36:
+      if (constructor == inputMessageDocument::ID) {
+        func(static_cast<inputMessageDocument &>(obj));
+        return true;
+      }
+      break;
+    case 38:
+      if (constructor == inputMessageVoiceNote::ID) {
+        func(static_cast<inputMessageVoiceNote &>(obj));
+        return true;
+      }
+      break;
+    case 39:
+      if (constructor == inputMessageForwarded::ID) {
+        func(static_cast<inputMessageForwarded &>(obj));
+        return true;
+      }
+      break;
+    case 46:
+      if (constructor == inputMessageAnimation::ID) {
+        func(static_cast<inputMessageAnimation &>(obj));
+        return true;
+      }
+      break;
+    case 48:
+      if (constructor == inputMessagePhoto::ID) {
+        func(static_cast<inputMessagePhoto &>(obj));
+        return true;
+      }
+      break;
+    case 51:
+      if (constructor == inputMessageLocation::ID) {
+        func(static_cast<inputMessageLocation &>(obj));
+        return true;
+      }
+      break;
+    case 56:
+      if (constructor == inputMessageAudio::ID) {
+        func(static_cast<inputMessageAudio &>(obj));
+        return true;
+      }
+      break;
+    case 61:
+      if (constructor == inputMessageVideoNote::ID) {
+        func(static_cast<inputMessageVideoNote &>(obj));
+        return true;
+      }
+      break;
+    case 62:
+      if (constructor == inputMessageContact::ID) {
+        func(static_cast<inputMessageContact &>(obj));
+        return true;
+      }
+      break;
+    case 63:
+      if (constructor == inputMessageText::ID) {
+        func(static_cast<inputMessageText &>(obj));
+        return true;
+      }
+      break;
+    default:
+      break;
+  }
+  return false;
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(InputPassportElement &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case inputPassportElementPersonalDetails::ID:
+      func(static_cast<inputPassportElementPersonalDetails &>(obj));
+      return true;
+    case inputPassportElementPassport::ID:
+      func(static_cast<inputPassportElementPassport &>(obj));
+      return true;
+    case inputPassportElementDriverLicense::ID:
+      func(static_cast<inputPassportElementDriverLicense &>(obj));
+      return true;
+    case inputPassportElementIdentityCard::ID:
+      func(static_cast<inputPassportElementIdentityCard &>(obj));
+      return true;
+    case inputPassportElementInternalPassport::ID:
+      func(static_cast<inputPassportElementInternalPassport &>(obj));
+      return true;
+    case inputPassportElementAddress::ID:
+      func(static_cast<inputPassportElementAddress &>(obj));
+      return true;
+    case inputPassportElementUtilityBill::ID:
+      func(static_cast<inputPassportElementUtilityBill &>(obj));
+      return true;
+    case inputPassportElementBankStatement::ID:
+      func(static_cast<inputPassportElementBankStatement &>(obj));
+      return true;
+    case inputPassportElementRentalAgreement::ID:
+      func(static_cast<inputPassportElementRentalAgreement &>(obj));
+      return true;
+    case inputPassportElementPassportRegistration::ID:
+      func(static_cast<inputPassportElementPassportRegistration &>(obj));
+      return true;
+    case inputPassportElementTemporaryRegistration::ID:
+      func(static_cast<inputPassportElementTemporaryRegistration &>(obj));
+      return true;
+    case inputPassportElementPhoneNumber::ID:
+      func(static_cast<inputPassportElementPhoneNumber &>(obj));
+      return true;
+    case inputPassportElementEmailAddress::ID:
+      func(static_cast<inputPassportElementEmailAddress &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(InputPassportElementErrorSource &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case inputPassportElementErrorSourceUnspecified::ID:
+      func(static_cast<inputPassportElementErrorSourceUnspecified &>(obj));
+      return true;
+    case inputPassportElementErrorSourceDataField::ID:
+      func(static_cast<inputPassportElementErrorSourceDataField &>(obj));
+      return true;
+    case inputPassportElementErrorSourceFrontSide::ID:
+      func(static_cast<inputPassportElementErrorSourceFrontSide &>(obj));
+      return true;
+    case inputPassportElementErrorSourceReverseSide::ID:
+      func(static_cast<inputPassportElementErrorSourceReverseSide &>(obj));
+      return true;
+    case inputPassportElementErrorSourceSelfie::ID:
+      func(static_cast<inputPassportElementErrorSourceSelfie &>(obj));
+      return true;
+    case inputPassportElementErrorSourceTranslationFile::ID:
+      func(static_cast<inputPassportElementErrorSourceTranslationFile &>(obj));
+      return true;
+    case inputPassportElementErrorSourceTranslationFiles::ID:
+      func(static_cast<inputPassportElementErrorSourceTranslationFiles &>(obj));
+      return true;
+    case inputPassportElementErrorSourceFile::ID:
+      func(static_cast<inputPassportElementErrorSourceFile &>(obj));
+      return true;
+    case inputPassportElementErrorSourceFiles::ID:
+      func(static_cast<inputPassportElementErrorSourceFiles &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(InternalLinkType &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch ((static_cast<std::uint32_t>(constructor) * 1752888841u) >> 26) {
+    case 0:
+      if (constructor == internalLinkTypeLanguagePack::ID) {
+        func(static_cast<internalLinkTypeLanguagePack &>(obj));
+        return true;
+      }
+      break;
+    case 2:
+      if (constructor == internalLinkTypeChangePhoneNumber::ID) {
+        func(static_cast<internalLinkTypeChangePhoneNumber &>(obj));
+        return true;
+      }
+      break;
+    case 6:
+      if (constructor == internalLinkTypeUnknownDeepLink::ID) {
+        func(static_cast<internalLinkTypeUnknownDeepLink &>(obj));
+        return true;
+      }
+      break;
+    case 9:
+      if (constructor == internalLinkTypeThemeSettings::ID) {
+        func(static_cast<internalLinkTypeThemeSettings &>(obj));
+        return true;
+      }
+      break;
+    case 12:
+      if (constructor == internalLinkTypeActiveSessions::ID) {
+        func(static_cast<internalLinkTypeActiveSessions &>(obj));
+        return true;
+      }
+      break;
+    case 14:
+      if (constructor == internalLinkTypePublicChat::ID) {
+        func(static_cast<internalLinkTypePublicChat &>(obj));
+        return true;
+      }
+      break;
+    case 20:
+      if (constructor == internalLinkTypeMessageDraft::ID) {
+        func(static_cast<internalLinkTypeMessageDraft &>(obj));
+        return true;
+      }
+      break;
+    case 22:
+      if (constructor == internalLinkTypeTheme::ID) {
+        func(static_cast<internalLinkTypeTheme &>(obj));
+        return true;
+      }
+      break;
+    case 25:
+      if (constructor == internalLinkTypeStickerSet::ID) {
+        func(static_cast<internalLinkTypeStickerSet &>(obj));
+        return true;
+      }
+      break;
+    case 26:
+      if (constructor == internalLinkTypeFilterSettings::ID) {
+        func(static_cast<internalLinkTypeFilterSettings &>(obj));
+        return true;
+      }
+      break;
+    case 29:
+      if (constructor == internalLinkTypeMessage::ID) {
+        func(static_cast<internalLinkTypeMessage &>(obj));
+        return true;
+      }
+      break;
+    case 30:
+      if (constructor == internalLinkTypeBotStartInGroup::ID) {
+        func(static_cast<internalLinkTypeBotStartInGroup &>(obj));
+        return true;
+      }
+      break;
+    case 31:
+      if (constructor == internalLinkTypeVideoChat::ID) {
+        func(static_cast<internalLinkTypeVideoChat &>(obj));
+        return true;
+      }
+      break;
+    case 38:
+      if (constructor == internalLinkTypePhoneNumberConfirmation::ID) {
+        func(static_cast<internalLinkTypePhoneNumberConfirmation &>(obj));
+        return true;
+      }
+      break;
+    case 40:
+      if (constructor == internalLinkTypeUnsupportedProxy::ID) {
+        func(static_cast<internalLinkTypeUnsupportedProxy &>(obj));
+        return true;
+      }
+      break;
+    case 43:
+      if (constructor == internalLinkTypeGame::ID) {
+        func(static_cast<internalLinkTypeGame &>(obj));
+        return true;
+      }
+      break;
+    case 45:
+      if (constructor == internalLinkTypeQrCodeAuthentication::ID) {
+        func(static_cast<internalLinkTypeQrCodeAuthentication &>(obj));
+        return true;
+      }
+      break;
+    case 51:
+      if (constructor == internalLinkTypeChatInvite::ID) {
+        func(static_cast<internalLinkTypeChatInvite &>(obj));
+        return true;
+      }
+      break;
+    case 53:
+      if (constructor == internalLinkTypeBackground::ID) {
+        func(static_cast<internalLinkTypeBackground &>(obj));
+        return true;
+      }
+      break;
+    case 54:
+      if (constructor == internalLinkTypeSettings::ID) {
+        func(static_cast<internalLinkTypeSettings &>(obj));
+        return true;
+      }
+      break;
+    case 57:
+      if (constructor == internalLinkTypeBotStart::ID) {
+        func(static_cast<internalLinkTypeBotStart &>(obj));
+        return true;
+      }
+      break;
+    case 59:
+      if (constructor == internalLinkTypePassportDataRequest::ID) {
+        func(static_cast<internalLinkTypePassportDataRequest &>(obj));
+        return true;
+      }
+      break;
+    case 61:
+      if (constructor == internalLinkTypeProxy::ID) {
+        func(static_cast<internalLinkTypeProxy &>(obj));
+        return true;
+      }
+      break;
+    case 63:
+      if (constructor == internalLinkTypeAuthenticationCode::ID) {
+        func(static_cast<internalLinkTypeAuthenticationCode &>(obj));
+        return true;
+      }
+      break;
+    default:
+      break;
+  }
+  return false;
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(JsonValue &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case jsonValueNull::ID:
+      func(static_cast<jsonValueNull &>(obj));
+      return true;
+    case jsonValueBoolean::ID:
+      func(static_cast<jsonValueBoolean &>(obj));
+      return true;
+    case jsonValueNumber::ID:
+      func(static_cast<jsonValueNumber &>(obj));
+      return true;
+    case jsonValueString::ID:
+      func(static_cast<jsonValueString &>(obj));
+      return true;
+    case jsonValueArray::ID:
+      func(static_cast<jsonValueArray &>(obj));
+      return true;
+    case jsonValueObject::ID:
+      func(static_cast<jsonValueObject &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(KeyboardButtonType &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case keyboardButtonTypeText::ID:
+      func(static_cast<keyboardButtonTypeText &>(obj));
+      return true;
+    case keyboardButtonTypeRequestPhoneNumber::ID:
+      func(static_cast<keyboardButtonTypeRequestPhoneNumber &>(obj));
+      return true;
+    case keyboardButtonTypeRequestLocation::ID:
+      func(static_cast<keyboardButtonTypeRequestLocation &>(obj));
+      return true;
+    case keyboardButtonTypeRequestPoll::ID:
+      func(static_cast<keyboardButtonTypeRequestPoll &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(LanguagePackStringValue &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case languagePackStringValueOrdinary::ID:
+      func(static_cast<languagePackStringValueOrdinary &>(obj));
+      return true;
+    case languagePackStringValuePluralized::ID:
+      func(static_cast<languagePackStringValuePluralized &>(obj));
+      return true;
+    case languagePackStringValueDeleted::ID:
+      func(static_cast<languagePackStringValueDeleted &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(LogStream &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case logStreamDefault::ID:
+      func(static_cast<logStreamDefault &>(obj));
+      return true;
+    case logStreamFile::ID:
+      func(static_cast<logStreamFile &>(obj));
+      return true;
+    case logStreamEmpty::ID:
+      func(static_cast<logStreamEmpty &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(LoginUrlInfo &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case loginUrlInfoOpen::ID:
+      func(static_cast<loginUrlInfoOpen &>(obj));
+      return true;
+    case loginUrlInfoRequestConfirmation::ID:
+      func(static_cast<loginUrlInfoRequestConfirmation &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(MaskPoint &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case maskPointForehead::ID:
+      func(static_cast<maskPointForehead &>(obj));
+      return true;
+    case maskPointEyes::ID:
+      func(static_cast<maskPointEyes &>(obj));
+      return true;
+    case maskPointMouth::ID:
+      func(static_cast<maskPointMouth &>(obj));
+      return true;
+    case maskPointChin::ID:
+      func(static_cast<maskPointChin &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(MessageContent &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch ((static_cast<std::uint32_t>(constructor) * 1014971429u) >> 25) {
+    case 1:
+      if (constructor == messageCall::ID) {
+        func(static_cast<messageCall &>(obj));
+        return true;
+      }
+      break;
+    case 3:
+      if (constructor == messageInviteVideoChatParticipants::ID) {
+        func(static_cast<messageInviteVideoChatParticipants &>(obj));
+        return true;
+      }
+      break;
+    case 4:
+      if (constructor == messageGame::ID) {
+        func(static_cast<messageGame &>(obj));
+        return true;
+      }
+      break;
+    case 5:
+      if (constructor == messageChatUpgradeTo::ID) {
+        func(static_cast<messageChatUpgradeTo &>(obj));
+        return true;
+      }
+      break;
+    case 9:
+      if (constructor == messageVenue::ID) {
+        func(static_cast<messageVenue &>(obj));
+        return true;
+      }
+      break;
+    case 12:
+      if (constructor == messageWebsiteConnected::ID) {
+        func(static_cast<messageWebsiteConnected &>(obj));
+        return true;
+      }
+      break;
+    case 17:
+      if (constructor == messageCustomServiceAction::ID) {
+        func(static_cast<messageCustomServiceAction &>(obj));
+        return true;
+      }
+      break;
+    case 19:
+      if (constructor == messageSupergroupChatCreate::ID) {
+        func(static_cast<messageSupergroupChatCreate &>(obj));
+        return true;
+      }
+      break;
+    case 22:
+      if (constructor == messageVoiceNote::ID) {
+        func(static_cast<messageVoiceNote &>(obj));
+        return true;
+      }
+      break;
+    case 23:
+      if (constructor == messageAudio::ID) {
+        func(static_cast<messageAudio &>(obj));
+        return true;
+      }
+      break;
+    case 25:
+      if (constructor == messageUnsupported::ID) {
+        func(static_cast<messageUnsupported &>(obj));
+        return true;
+      }
+      break;
+    case 27:
+      if (constructor == messagePaymentSuccessful::ID) {
+        func(static_cast<messagePaymentSuccessful &>(obj));
+        return true;
+      }
+      break;
+    case 29:
+      if (constructor == messageScreenshotTaken::ID) {
+        func(static_cast<messageScreenshotTaken &>(obj));
+        return true;
+      }
+      break;
+    case 30:
+      if (constructor == messageGameScore::ID) {
+        func(static_cast<messageGameScore &>(obj));
+        return true;
+      }
+      break;
+    case 31:
+      if (constructor == messageChatJoinByLink::ID) {
+        func(static_cast<messageChatJoinByLink &>(obj));
+        return true;
+      }
+      break;
+    case 37:
+      if (constructor == messageExpiredVideo::ID) {
+        func(static_cast<messageExpiredVideo &>(obj));
+        return true;
+      }
+      break;
+    case 38:
+      if (constructor == messageContact::ID) {
+        func(static_cast<messageContact &>(obj));
+        return true;
+      }
+      break;
+    case 44:
+      if (constructor == messagePassportDataSent::ID) {
+        func(static_cast<messagePassportDataSent &>(obj));
+        return true;
+      }
+      break;
+    case 46:
+      if (constructor == messagePinMessage::ID) {
+        func(static_cast<messagePinMessage &>(obj));
+        return true;
+      }
+      break;
+    case 53:
+      if (constructor == messageText::ID) {
+        func(static_cast<messageText &>(obj));
+        return true;
+      }
+      break;
+    case 56:
+      if (constructor == messageChatSetTheme::ID) {
+        func(static_cast<messageChatSetTheme &>(obj));
+        return true;
+      }
+      break;
+    case 59:
+      if (constructor == messageChatDeletePhoto::ID) {
+        func(static_cast<messageChatDeletePhoto &>(obj));
+        return true;
+      }
+      break;
+    case 63:
+      if (constructor == messageChatJoinByRequest::ID) {
+        func(static_cast<messageChatJoinByRequest &>(obj));
+        return true;
+      }
+      break;
+    case 65:
+      if (constructor == messageExpiredPhoto::ID) {
+        func(static_cast<messageExpiredPhoto &>(obj));
+        return true;
+      }
+      break;
+    case 67:
+      if (constructor == messagePaymentSuccessfulBot::ID) {
+        func(static_cast<messagePaymentSuccessfulBot &>(obj));
+        return true;
+      }
+      break;
+    case 77:
+      if (constructor == messageChatChangeTitle::ID) {
+        func(static_cast<messageChatChangeTitle &>(obj));
+        return true;
+      }
+      break;
+    case 83:
+      if (constructor == messageBasicGroupChatCreate::ID) {
+        func(static_cast<messageBasicGroupChatCreate &>(obj));
+        return true;
+      }
+      break;
+    case 88:
+      if (constructor == messageContactRegistered::ID) {
+        func(static_cast<messageContactRegistered &>(obj));
+        return true;
+      }
+      break;
+    case 93:
+      if (constructor == messageAnimatedEmoji::ID) {
+        func(static_cast<messageAnimatedEmoji &>(obj));
+        return true;
+      }
+      break;
+    case 100:
+      if (constructor == messagePassportDataReceived::ID) {
+        func(static_cast<messagePassportDataReceived &>(obj));
+        return true;
+      }
+      break;
+    case 102:
+      if (constructor == messageVideoChatStarted::ID) {
+        func(static_cast<messageVideoChatStarted &>(obj));
+        return true;
+      }
+      break;
+    case 104:
+      if (constructor == messageProximityAlertTriggered::ID) {
+        func(static_cast<messageProximityAlertTriggered &>(obj));
+        return true;
+      }
+      break;
+    case 106:
+      if (constructor == messagePoll::ID) {
+        func(static_cast<messagePoll &>(obj));
+        return true;
+      }
+      break;
+    case 107:
+      if (constructor == messageChatUpgradeFrom::ID) {
+        func(static_cast<messageChatUpgradeFrom &>(obj));
+        return true;
+      }
+      break;
+    case 108:
+      if (constructor == messageVideoChatEnded::ID) {
+        func(static_cast<messageVideoChatEnded &>(obj));
+        return true;
+      }
+      break;
+    case 109:
+      if (constructor == messageLocation::ID) {
+        func(static_cast<messageLocation &>(obj));
+        return true;
+      }
+      if (constructor == messageInvoice::ID) {
+        func(static_cast<messageInvoice &>(obj));
+        return true;
+      }
+      break;
+    case 111:
+      if (constructor == messageAnimation::ID) {
+        func(static_cast<messageAnimation &>(obj));
+        return true;
+      }
+      break;
+    case 112:
+      if (constructor == messageChatSetTtl::ID) {
+        func(static_cast<messageChatSetTtl &>(obj));
+        return true;
+      }
+      break;
+    case 113:
+      if (constructor == messagePhoto::ID) {
+        func(static_cast<messagePhoto &>(obj));
+        return true;
+      }
+      break;
+    case 114:
+      if (constructor == messageVideo::ID) {
+        func(static_cast<messageVideo &>(obj));
+        return true;
+      }
+      break;
+    case 118:
+      if (constructor == messageChatAddMembers::ID) {
+        func(static_cast<messageChatAddMembers &>(obj));
+        return true;
+      }
+      break;
+    case 119:
+      if (constructor == messageVideoNote::ID) {
+        func(static_cast<messageVideoNote &>(obj));
+        return true;
+      }
+      break;
+    case 120:
+      if (constructor == messageDocument::ID) {
+        func(static_cast<messageDocument &>(obj));
+        return true;
+      }
+      break;
+    case 121:
+      if (constructor == messageChatChangePhoto::ID) {
+        func(static_cast<messageChatChangePhoto &>(obj));
+        return true;
+      }
+      break;
+    case 123:
+      if (constructor == messageSticker::ID) {
+        func(static_cast<messageSticker &>(obj));
+        return true;
+      }
+      break;
+    case 124:
+      if (constructor == messageDice::ID) {
+        func(static_cast<messageDice &>(obj));
+        return true;
+      }
+      break;
+    case 125:
+      if (constructor == messageChatDeleteMember::ID) {
+        func(static_cast<messageChatDeleteMember &>(obj));
+        return true;
+      }
+      break;
+    case 126:
+      if (constructor == messageVideoChatScheduled::ID) {
+        func(static_cast<messageVideoChatScheduled &>(obj));
+        return true;
+      }
+      break;
+    default:
+      break;
+  }
+  return false;
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(MessageFileType &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case messageFileTypePrivate::ID:
+      func(static_cast<messageFileTypePrivate &>(obj));
+      return true;
+    case messageFileTypeGroup::ID:
+      func(static_cast<messageFileTypeGroup &>(obj));
+      return true;
+    case messageFileTypeUnknown::ID:
+      func(static_cast<messageFileTypeUnknown &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(MessageForwardOrigin &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case messageForwardOriginUser::ID:
+      func(static_cast<messageForwardOriginUser &>(obj));
+      return true;
+    case messageForwardOriginChat::ID:
+      func(static_cast<messageForwardOriginChat &>(obj));
+      return true;
+    case messageForwardOriginHiddenUser::ID:
+      func(static_cast<messageForwardOriginHiddenUser &>(obj));
+      return true;
+    case messageForwardOriginChannel::ID:
+      func(static_cast<messageForwardOriginChannel &>(obj));
+      return true;
+    case messageForwardOriginMessageImport::ID:
+      func(static_cast<messageForwardOriginMessageImport &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(MessageSchedulingState &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case messageSchedulingStateSendAtDate::ID:
+      func(static_cast<messageSchedulingStateSendAtDate &>(obj));
+      return true;
+    case messageSchedulingStateSendWhenOnline::ID:
+      func(static_cast<messageSchedulingStateSendWhenOnline &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(MessageSender &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case messageSenderUser::ID:
+      func(static_cast<messageSenderUser &>(obj));
+      return true;
+    case messageSenderChat::ID:
+      func(static_cast<messageSenderChat &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(MessageSendingState &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case messageSendingStatePending::ID:
+      func(static_cast<messageSendingStatePending &>(obj));
+      return true;
+    case messageSendingStateFailed::ID:
+      func(static_cast<messageSendingStateFailed &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(NetworkStatisticsEntry &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case networkStatisticsEntryFile::ID:
+      func(static_cast<networkStatisticsEntryFile &>(obj));
+      return true;
+    case networkStatisticsEntryCall::ID:
+      func(static_cast<networkStatisticsEntryCall &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(NetworkType &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case networkTypeNone::ID:
+      func(static_cast<networkTypeNone &>(obj));
+      return true;
+    case networkTypeMobile::ID:
+      func(static_cast<networkTypeMobile &>(obj));
+      return true;
+    case networkTypeMobileRoaming::ID:
+      func(static_cast<networkTypeMobileRoaming &>(obj));
+      return true;
+    case networkTypeWiFi::ID:
+      func(static_cast<networkTypeWiFi &>(obj));
+      return true;
+    case networkTypeOther::ID:
+      func(static_cast<networkTypeOther &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(NotificationGroupType &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case notificationGroupTypeMessages::ID:
+      func(static_cast<notificationGroupTypeMessages &>(obj));
+      return true;
+    case notificationGroupTypeMentions::ID:
+      func(static_cast<notificationGroupTypeMentions &>(obj));
+      return true;
+    case notificationGroupTypeSecretChat::ID:
+      func(static_cast<notificationGroupTypeSecretChat &>(obj));
+      return true;
+    case notificationGroupTypeCalls::ID:
+      func(static_cast<notificationGroupTypeCalls &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(NotificationSettingsScope &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case notificationSettingsScopePrivateChats::ID:
+      func(static_cast<notificationSettingsScopePrivateChats &>(obj));
+      return true;
+    case notificationSettingsScopeGroupChats::ID:
+      func(static_cast<notificationSettingsScopeGroupChats &>(obj));
+      return true;
+    case notificationSettingsScopeChannelChats::ID:
+      func(static_cast<notificationSettingsScopeChannelChats &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(NotificationType &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case notificationTypeNewMessage::ID:
+      func(static_cast<notificationTypeNewMessage &>(obj));
+      return true;
+    case notificationTypeNewSecretChat::ID:
+      func(static_cast<notificationTypeNewSecretChat &>(obj));
+      return true;
+    case notificationTypeNewCall::ID:
+      func(static_cast<notificationTypeNewCall &>(obj));
+      return true;
+    case notificationTypeNewPushMessage::ID:
+      func(static_cast<notificationTypeNewPushMessage &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(OptionValue &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case optionValueBoolean::ID:
+      func(static_cast<optionValueBoolean &>(obj));
+      return true;
+    case optionValueEmpty::ID:
+      func(static_cast<optionValueEmpty &>(obj));
+      return true;
+    case optionValueInteger::ID:
+      func(static_cast<optionValueInteger &>(obj));
+      return true;
+    case optionValueString::ID:
+      func(static_cast<optionValueString &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(PageBlock &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch ((static_cast<std::uint32_t>(constructor) * 1826457361u) >> 26) {
+    case 1:
+      if (constructor == pageBlockSubheader::ID) {
+        func(static_cast<pageBlockSubheader &>(obj));
+        return true;
+      }
+      break;
+    case 3:
+      if (constructor == pageBlockPhoto::ID) {
+        func(static_cast<pageBlockPhoto &>(obj));
+        return true;
+      }
+      break;
+    case 4:
+      if (constructor == pageBlockAuthorDate::ID) {
+        func(static_cast<pageBlockAuthorDate &>(obj));
+        return true;
+      }
+      break;
+    case 6:
+      if (constructor == pageBlockChatLink::ID) {
+        func(static_cast<pageBlockChatLink &>(obj));
+        return true;
+      }
+      break;
+    case 8:
+      if (constructor == pageBlockAnimation::ID) {
+        func(static_cast<pageBlockAnimation &>(obj));
+        return true;
+      }
+      break;
+    case 10:
+      if (constructor == pageBlockEmbeddedPost::ID) {
+        func(static_cast<pageBlockEmbeddedPost &>(obj));
+        return true;
+      }
+      break;
+    case 13:
+      if (constructor == pageBlockRelatedArticles::ID) {
+        func(static_cast<pageBlockRelatedArticles &>(obj));
+        return true;
+      }
+      break;
+    case 21:
+      if (constructor == pageBlockCollage::ID) {
+        func(static_cast<pageBlockCollage &>(obj));
+        return true;
+      }
+      break;
+    case 26:
+      if (constructor == pageBlockEmbedded::ID) {
+        func(static_cast<pageBlockEmbedded &>(obj));
+        return true;
+      }
+      break;
+    case 27:
+      if (constructor == pageBlockDivider::ID) {
+        func(static_cast<pageBlockDivider &>(obj));
+        return true;
+      }
+      break;
+    case 28:
+      if (constructor == pageBlockParagraph::ID) {
+        func(static_cast<pageBlockParagraph &>(obj));
+        return true;
+      }
+      break;
+    case 32:
+      if (constructor == pageBlockHeader::ID) {
+        func(static_cast<pageBlockHeader &>(obj));
+        return true;
+      }
+      break;
+    case 38:
+      if (constructor == pageBlockCover::ID) {
+        func(static_cast<pageBlockCover &>(obj));
+        return true;
+      }
+      break;
+    case 40:
+      if (constructor == pageBlockPullQuote::ID) {
+        func(static_cast<pageBlockPullQuote &>(obj));
+        return true;
+      }
+      break;
+    case 42:
+      if (constructor == pageBlockDetails::ID) {
+        func(static_cast<pageBlockDetails &>(obj));
+        return true;
+      }
+      break;
+    case 43:
+      if (constructor == pageBlockTitle::ID) {
+        func(static_cast<pageBlockTitle &>(obj));
+        return true;
+      }
+      break;
+    case 44:
+      if (constructor == pageBlockKicker::ID) {
+        func(static_cast<pageBlockKicker &>(obj));
+        return true;
+      }
+      break;
+    case 46:
+      if (constructor == pageBlockSubtitle::ID) {
+        func(static_cast<pageBlockSubtitle &>(obj));
+        return true;
+      }
+      break;
+    case 51:
+      if (constructor == pageBlockAudio::ID) {
+        func(static_cast<pageBlockAudio &>(obj));
+        return true;
+      }
+      break;
+    case 52:
+      if (constructor == pageBlockSlideshow::ID) {
+        func(static_cast<pageBlockSlideshow &>(obj));
+        return true;
+      }
+      break;
+    case 53:
+      if (constructor == pageBlockList::ID) {
+        func(static_cast<pageBlockList &>(obj));
+        return true;
+      }
+      break;
+    case 54:
+      if (constructor == pageBlockBlockQuote::ID) {
+        func(static_cast<pageBlockBlockQuote &>(obj));
+        return true;
+      }
+      break;
+    case 56:
+      if (constructor == pageBlockMap::ID) {
+        func(static_cast<pageBlockMap &>(obj));
+        return true;
+      }
+      break;
+    case 57:
+      if (constructor == pageBlockFooter::ID) {
+        func(static_cast<pageBlockFooter &>(obj));
+        return true;
+      }
+      break;
+    case 59:
+      if (constructor == pageBlockVideo::ID) {
+        func(static_cast<pageBlockVideo &>(obj));
+        return true;
+      }
+      break;
+    case 60:
+      if (constructor == pageBlockVoiceNote::ID) {
+        func(static_cast<pageBlockVoiceNote &>(obj));
+        return true;
+      }
+      break;
+    case 62:
+      if (constructor == pageBlockAnchor::ID) {
+        func(static_cast<pageBlockAnchor &>(obj));
+        return true;
+      }
+      break;
+    case 63:
+      if (constructor == pageBlockPreformatted::ID) {
+        func(static_cast<pageBlockPreformatted &>(obj));
+        return true;
+      }
+      if (constructor == pageBlockTable::ID) {
+        func(static_cast<pageBlockTable &>(obj));
+        return true;
+      }
+      break;
+    default:
+      break;
+  }
+  return false;
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(PageBlockHorizontalAlignment &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case pageBlockHorizontalAlignmentLeft::ID:
+      func(static_cast<pageBlockHorizontalAlignmentLeft &>(obj));
+      return true;
+    case pageBlockHorizontalAlignmentCenter::ID:
+      func(static_cast<pageBlockHorizontalAlignmentCenter &>(obj));
+      return true;
+    case pageBlockHorizontalAlignmentRight::ID:
+      func(static_cast<pageBlockHorizontalAlignmentRight &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(PageBlockVerticalAlignment &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case pageBlockVerticalAlignmentTop::ID:
+      func(static_cast<pageBlockVerticalAlignmentTop &>(obj));
+      return true;
+    case pageBlockVerticalAlignmentMiddle::ID:
+      func(static_cast<pageBlockVerticalAlignmentMiddle &>(obj));
+      return true;
+    case pageBlockVerticalAlignmentBottom::ID:
+      func(static_cast<pageBlockVerticalAlignmentBottom &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(PassportElement &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case passportElementPersonalDetails::ID:
+      func(static_cast<passportElementPersonalDetails &>(obj));
+      return true;
+    case passportElementPassport::ID:
+      func(static_cast<passportElementPassport &>(obj));
+      return true;
+    case passportElementDriverLicense::ID:
+      func(static_cast<passportElementDriverLicense &>(obj));
+      return true;
+    case passportElementIdentityCard::ID:
+      func(static_cast<passportElementIdentityCard &>(obj));
+      return true;
+    case passportElementInternalPassport::ID:
+      func(static_cast<passportElementInternalPassport &>(obj));
+      return true;
+    case passportElementAddress::ID:
+      func(static_cast<passportElementAddress &>(obj));
+      return true;
+    case passportElementUtilityBill::ID:
+      func(static_cast<passportElementUtilityBill &>(obj));
+      return true;
+    case passportElementBankStatement::ID:
+      func(static_cast<passportElementBankStatement &>(obj));
+      return true;
+    case passportElementRentalAgreement::ID:
+      func(static_cast<passportElementRentalAgreement &>(obj));
+      return true;
+    case passportElementPassportRegistration::ID:
+      func(static_cast<passportElementPassportRegistration &>(obj));
+      return true;
+    case passportElementTemporaryRegistration::ID:
+      func(static_cast<passportElementTemporaryRegistration &>(obj));
+      return true;
+    case passportElementPhoneNumber::ID:
+      func(static_cast<passportElementPhoneNumber &>(obj));
+      return true;
+    case passportElementEmailAddress::ID:
+      func(static_cast<passportElementEmailAddress &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(PassportElementErrorSource &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case passportElementErrorSourceUnspecified::ID:
+      func(static_cast<passportElementErrorSourceUnspecified &>(obj));
+      return true;
+    case passportElementErrorSourceDataField::ID:
+      func(static_cast<passportElementErrorSourceDataField &>(obj));
+      return true;
+    case passportElementErrorSourceFrontSide::ID:
+      func(static_cast<passportElementErrorSourceFrontSide &>(obj));
+      return true;
+    case passportElementErrorSourceReverseSide::ID:
+      func(static_cast<passportElementErrorSourceReverseSide &>(obj));
+      return true;
+    case passportElementErrorSourceSelfie::ID:
+      func(static_cast<passportElementErrorSourceSelfie &>(obj));
+      return true;
+    case passportElementErrorSourceTranslationFile::ID:
+      func(static_cast<passportElementErrorSourceTranslationFile &>(obj));
+      return true;
+    case passportElementErrorSourceTranslationFiles::ID:
+      func(static_cast<passportElementErrorSourceTranslationFiles &>(obj));
+      return true;
+    case passportElementErrorSourceFile::ID:
+      func(static_cast<passportElementErrorSourceFile &>(obj));
+      return true;
+    case passportElementErrorSourceFiles::ID:
+      func(static_cast<passportElementErrorSourceFiles &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(PassportElementType &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case passportElementTypePersonalDetails::ID:
+      func(static_cast<passportElementTypePersonalDetails &>(obj));
+      return true;
+    case passportElementTypePassport::ID:
+      func(static_cast<passportElementTypePassport &>(obj));
+      return true;
+    case passportElementTypeDriverLicense::ID:
+      func(static_cast<passportElementTypeDriverLicense &>(obj));
+      return true;
+    case passportElementTypeIdentityCard::ID:
+      func(static_cast<passportElementTypeIdentityCard &>(obj));
+      return true;
+    case passportElementTypeInternalPassport::ID:
+      func(static_cast<passportElementTypeInternalPassport &>(obj));
+      return true;
+    case passportElementTypeAddress::ID:
+      func(static_cast<passportElementTypeAddress &>(obj));
+      return true;
+    case passportElementTypeUtilityBill::ID:
+      func(static_cast<passportElementTypeUtilityBill &>(obj));
+      return true;
+    case passportElementTypeBankStatement::ID:
+      func(static_cast<passportElementTypeBankStatement &>(obj));
+      return true;
+    case passportElementTypeRentalAgreement::ID:
+      func(static_cast<passportElementTypeRentalAgreement &>(obj));
+      return true;
+    case passportElementTypePassportRegistration::ID:
+      func(static_cast<passportElementTypePassportRegistration &>(obj));
+      return true;
+    case passportElementTypeTemporaryRegistration::ID:
+      func(static_cast<passportElementTypeTemporaryRegistration &>(obj));
+      return true;
+    case passportElementTypePhoneNumber::ID:
+      func(static_cast<passportElementTypePhoneNumber &>(obj));
+      return true;
+    case passportElementTypeEmailAddress::ID:
+      func(static_cast<passportElementTypeEmailAddress &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(PollType &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case pollTypeRegular::ID:
+      func(static_cast<pollTypeRegular &>(obj));
+      return true;
+    case pollTypeQuiz::ID:
+      func(static_cast<pollTypeQuiz &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(ProxyType &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case proxyTypeSocks5::ID:
+      func(static_cast<proxyTypeSocks5 &>(obj));
+      return true;
+    case proxyTypeHttp::ID:
+      func(static_cast<proxyTypeHttp &>(obj));
+      return true;
+    case proxyTypeMtproto::ID:
+      func(static_cast<proxyTypeMtproto &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(PublicChatType &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case publicChatTypeHasUsername::ID:
+      func(static_cast<publicChatTypeHasUsername &>(obj));
+      return true;
+    case publicChatTypeIsLocationBased::ID:
+      func(static_cast<publicChatTypeIsLocationBased &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(PushMessageContent &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch ((static_cast<std::uint32_t>(constructor) * 460811629u) >> 26) {
+    case 3:
+      if (constructor == pushMessageContentGame::ID) {
+        func(static_cast<pushMessageContentGame &>(obj));
+        return true;
+      }
+      break;
+    case 5:
+      if (constructor == pushMessageContentContactRegistered::ID) {
+        func(static_cast<pushMessageContentContactRegistered &>(obj));
+        return true;
+      }
+      break;
+    case 10:
+      if (constructor == pushMessageContentHidden::ID) {
+        func(static_cast<pushMessageContentHidden &>(obj));
+        return true;
+      }
+      break;
+    case 11:
+      if (constructor == pushMessageContentChatChangeTitle::ID) {
+        func(static_cast<pushMessageContentChatChangeTitle &>(obj));
+        return true;
+      }
+      break;
+    case 12:
+      if (constructor == pushMessageContentChatJoinByRequest::ID) {
+        func(static_cast<pushMessageContentChatJoinByRequest &>(obj));
+        return true;
+      }
+      break;
+    case 14:
+      if (constructor == pushMessageContentInvoice::ID) {
+        func(static_cast<pushMessageContentInvoice &>(obj));
+        return true;
+      }
+      break;
+    case 16:
+      if (constructor == pushMessageContentText::ID) {
+        func(static_cast<pushMessageContentText &>(obj));
+        return true;
+      }
+      break;
+    case 18:
+      if (constructor == pushMessageContentChatJoinByLink::ID) {
+        func(static_cast<pushMessageContentChatJoinByLink &>(obj));
+        return true;
+      }
+      break;
+    case 19:
+      if (constructor == pushMessageContentDocument::ID) {
+        func(static_cast<pushMessageContentDocument &>(obj));
+        return true;
+      }
+      if (constructor == pushMessageContentPhoto::ID) {
+        func(static_cast<pushMessageContentPhoto &>(obj));
+        return true;
+      }
+      break;
+    case 22:
+      if (constructor == pushMessageContentVideo::ID) {
+        func(static_cast<pushMessageContentVideo &>(obj));
+        return true;
+      }
+      break;
+    case 24:
+      if (constructor == pushMessageContentVideoNote::ID) {
+        func(static_cast<pushMessageContentVideoNote &>(obj));
+        return true;
+      }
+      break;
+    case 26:
+      if (constructor == pushMessageContentMessageForwards::ID) {
+        func(static_cast<pushMessageContentMessageForwards &>(obj));
+        return true;
+      }
+      break;
+    case 28:
+      if (constructor == pushMessageContentGameScore::ID) {
+        func(static_cast<pushMessageContentGameScore &>(obj));
+        return true;
+      }
+      break;
+    case 29:
+      if (constructor == pushMessageContentContact::ID) {
+        func(static_cast<pushMessageContentContact &>(obj));
+        return true;
+      }
+      break;
+    case 31:
+      if (constructor == pushMessageContentScreenshotTaken::ID) {
+        func(static_cast<pushMessageContentScreenshotTaken &>(obj));
+        return true;
+      }
+      break;
+    case 33:
+      if (constructor == pushMessageContentPoll::ID) {
+        func(static_cast<pushMessageContentPoll &>(obj));
+        return true;
+      }
+      break;
+    case 34:
+      if (constructor == pushMessageContentBasicGroupChatCreate::ID) {
+        func(static_cast<pushMessageContentBasicGroupChatCreate &>(obj));
+        return true;
+      }
+      break;
+    case 36:
+      if (constructor == pushMessageContentAnimation::ID) {
+        func(static_cast<pushMessageContentAnimation &>(obj));
+        return true;
+      }
+      break;
+    case 38:
+      if (constructor == pushMessageContentChatDeleteMember::ID) {
+        func(static_cast<pushMessageContentChatDeleteMember &>(obj));
+        return true;
+      }
+      break;
+    case 41:
+      if (constructor == pushMessageContentLocation::ID) {
+        func(static_cast<pushMessageContentLocation &>(obj));
+        return true;
+      }
+      break;
+    case 44:
+      if (constructor == pushMessageContentChatSetTheme::ID) {
+        func(static_cast<pushMessageContentChatSetTheme &>(obj));
+        return true;
+      }
+      break;
+    case 46:
+      if (constructor == pushMessageContentChatAddMembers::ID) {
+        func(static_cast<pushMessageContentChatAddMembers &>(obj));
+        return true;
+      }
+      break;
+    case 48:
+      if (constructor == pushMessageContentMediaAlbum::ID) {
+        func(static_cast<pushMessageContentMediaAlbum &>(obj));
+        return true;
+      }
+      break;
+    case 49:
+      if (constructor == pushMessageContentVoiceNote::ID) {
+        func(static_cast<pushMessageContentVoiceNote &>(obj));
+        return true;
+      }
+      break;
+    case 50:
+      if (constructor == pushMessageContentAudio::ID) {
+        func(static_cast<pushMessageContentAudio &>(obj));
+        return true;
+      }
+      break;
+    case 60:
+      if (constructor == pushMessageContentSticker::ID) {
+        func(static_cast<pushMessageContentSticker &>(obj));
+        return true;
+      }
+      break;
+    case 61:
+      if (constructor == pushMessageContentChatChangePhoto::ID) {
+        func(static_cast<pushMessageContentChatChangePhoto &>(obj));
+        return true;
+      }
+      break;
+    default:
+      break;
+  }
+  return false;
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(ReplyMarkup &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case replyMarkupRemoveKeyboard::ID:
+      func(static_cast<replyMarkupRemoveKeyboard &>(obj));
+      return true;
+    case replyMarkupForceReply::ID:
+      func(static_cast<replyMarkupForceReply &>(obj));
+      return true;
+    case replyMarkupShowKeyboard::ID:
+      func(static_cast<replyMarkupShowKeyboard &>(obj));
+      return true;
+    case replyMarkupInlineKeyboard::ID:
+      func(static_cast<replyMarkupInlineKeyboard &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(ResetPasswordResult &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case resetPasswordResultOk::ID:
+      func(static_cast<resetPasswordResultOk &>(obj));
+      return true;
+    case resetPasswordResultPending::ID:
+      func(static_cast<resetPasswordResultPending &>(obj));
+      return true;
+    case resetPasswordResultDeclined::ID:
+      func(static_cast<resetPasswordResultDeclined &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(RichText &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch ((static_cast<std::uint32_t>(constructor) * 1569507317u) >> 26) {
+    case 2:
+      if (constructor == richTextUnderline::ID) {
+        func(static_cast<richTextUnderline &>(obj));
+        return true;
+      }
+      break;
+    case 6:
+      if (constructor == richTextFixed::ID) {
+        func(static_cast<richTextFixed &>(obj));
+        return true;
+      }
+      break;
+    case 8:
+      if (constructor == richTexts::ID) {
+        func(static_cast<richTexts &>(obj));
+        return true;
+      }
+      break;
+    case 14:
+      if (constructor == richTextItalic::ID) {
+        func(static_cast<richTextItalic &>(obj));
+        return true;
+      }
+      break;
+    case 17:
+      if (constructor == richTextReference::ID) {
+        func(static_cast<richTextReference &>(obj));
+        return true;
+      }
+      break;
+    case 18:
+      if (constructor == richTextIcon::ID) {
+        func(static_cast<richTextIcon &>(obj));
+        return true;
+      }
+      break;
+    case 25:
+      if (constructor == richTextBold::ID) {
+        func(static_cast<richTextBold &>(obj));
+        return true;
+      }
+      break;
+    case 29:
+      if (constructor == richTextSuperscript::ID) {
+        func(static_cast<richTextSuperscript &>(obj));
+        return true;
+      }
+      break;
+    case 30:
+      if (constructor == richTextStrikethrough::ID) {
+        func(static_cast<richTextStrikethrough &>(obj));
+        return true;
+      }
+      break;
+    case 31:
+      if (constructor == richTextSubscript::ID) {
+        func(static_cast<richTextSubscript &>(obj));
+        return true;
+      }
+      break;
+    case 41:
+      if (constructor == richTextAnchor::ID) {
+        func(static_cast<richTextAnchor &>(obj));
+        return true;
+      }
+      break;
+    case 45:
+      if (constructor == richTextPlain::ID) {
+        func(static_cast<richTextPlain &>(obj));
+        return true;
+      }
+      break;
+    case 46:
+      if (constructor == richTextPhoneNumber::ID) {
+        func(static_cast<richTextPhoneNumber &>(obj));
+        return true;
+      }
+      break;
+    case 47:
+      if (constructor == richTextMarked::ID) {
+        func(static_cast<richTextMarked &>(obj));
+        return true;
+      }
+      break;
+    case 51:
+      if (constructor == richTextEmailAddress::ID) {
+        func(static_cast<richTextEmailAddress &>(obj));
+        return true;
+      }
+      break;
+    case 54:
+      if (constructor == richTextAnchorLink::ID) {
+        func(static_cast<richTextAnchorLink &>(obj));
+        return true;
+      }
+      break;
+    case 59:
+      if (constructor == richTextUrl::ID) {
+        func(static_cast<richTextUrl &>(obj));
+        return true;
+      }
+      break;
+    default:
+      break;
+  }
+  return false;
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(SearchMessagesFilter &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch ((static_cast<std::uint32_t>(constructor) * 4267689421u) >> 26) {
+    case 5:
+      if (constructor == searchMessagesFilterPhoto::ID) {
+        func(static_cast<searchMessagesFilterPhoto &>(obj));
+        return true;
+      }
+      break;
+    case 6:
+      if (constructor == searchMessagesFilterVoiceNote::ID) {
+        func(static_cast<searchMessagesFilterVoiceNote &>(obj));
+        return true;
+      }
+      break;
+    case 15:
+      if (constructor == searchMessagesFilterUrl::ID) {
+        func(static_cast<searchMessagesFilterUrl &>(obj));
+        return true;
+      }
+      break;
+    case 16:
+      if (constructor == searchMessagesFilterFailedToSend::ID) {
+        func(static_cast<searchMessagesFilterFailedToSend &>(obj));
+        return true;
+      }
+      break;
+    case 18:
+      if (constructor == searchMessagesFilterVideo::ID) {
+        func(static_cast<searchMessagesFilterVideo &>(obj));
+        return true;
+      }
+      break;
+    case 19:
+      if (constructor == searchMessagesFilterUnreadReaction::ID) {
+        func(static_cast<searchMessagesFilterUnreadReaction &>(obj));
+        return true;
+      }
+      break;
+    case 23:
+      if (constructor == searchMessagesFilterDocument::ID) {
+        func(static_cast<searchMessagesFilterDocument &>(obj));
+        return true;
+      }
+      break;
+    case 25:
+      if (constructor == searchMessagesFilterAudio::ID) {
+        func(static_cast<searchMessagesFilterAudio &>(obj));
+        return true;
+      }
+      break;
+    case 36:
+      if (constructor == searchMessagesFilterVoiceAndVideoNote::ID) {
+        func(static_cast<searchMessagesFilterVoiceAndVideoNote &>(obj));
+        return true;
+      }
+      break;
+    case 41:
+      if (constructor == searchMessagesFilterPinned::ID) {
+        func(static_cast<searchMessagesFilterPinned &>(obj));
+        return true;
+      }
+      break;
+    case 42:
+      if (constructor == searchMessagesFilterEmpty::ID) {
+        func(static_cast<searchMessagesFilterEmpty &>(obj));
+        return true;
+      }
+      break;
+    case 48:
+      if (constructor == searchMessagesFilterMention::ID) {
+        func(static_cast<searchMessagesFilterMention &>(obj));
+        return true;
+      }
+      break;
+    case 54:
+      if (constructor == searchMessagesFilterUnreadMention::ID) {
+        func(static_cast<searchMessagesFilterUnreadMention &>(obj));
+        return true;
+      }
+      break;
+    case 57:
+      if (constructor == searchMessagesFilterChatPhoto::ID) {
+        func(static_cast<searchMessagesFilterChatPhoto &>(obj));
+        return true;
+      }
+      break;
+    case 58:
+      if (constructor == searchMessagesFilterAnimation::ID) {
+        func(static_cast<searchMessagesFilterAnimation &>(obj));
+        return true;
+      }
+      break;
+    case 60:
+      if (constructor == searchMessagesFilterVideoNote::ID) {
+        func(static_cast<searchMessagesFilterVideoNote &>(obj));
+        return true;
+      }
+      break;
+    case 62:
+      if (constructor == searchMessagesFilterPhotoAndVideo::ID) {
+        func(static_cast<searchMessagesFilterPhotoAndVideo &>(obj));
+        return true;
+      }
+      break;
+    default:
+      break;
+  }
+  return false;
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(SecretChatState &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case secretChatStatePending::ID:
+      func(static_cast<secretChatStatePending &>(obj));
+      return true;
+    case secretChatStateReady::ID:
+      func(static_cast<secretChatStateReady &>(obj));
+      return true;
+    case secretChatStateClosed::ID:
+      func(static_cast<secretChatStateClosed &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(StatisticalGraph &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case statisticalGraphData::ID:
+      func(static_cast<statisticalGraphData &>(obj));
+      return true;
+    case statisticalGraphAsync::ID:
+      func(static_cast<statisticalGraphAsync &>(obj));
+      return true;
+    case statisticalGraphError::ID:
+      func(static_cast<statisticalGraphError &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(StickerType &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case stickerTypeStatic::ID:
+      func(static_cast<stickerTypeStatic &>(obj));
+      return true;
+    case stickerTypeAnimated::ID:
+      func(static_cast<stickerTypeAnimated &>(obj));
+      return true;
+    case stickerTypeVideo::ID:
+      func(static_cast<stickerTypeVideo &>(obj));
+      return true;
+    case stickerTypeMask::ID:
+      func(static_cast<stickerTypeMask &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(SuggestedAction &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case suggestedActionEnableArchiveAndMuteNewChats::ID:
+      func(static_cast<suggestedActionEnableArchiveAndMuteNewChats &>(obj));
+      return true;
+    case suggestedActionCheckPassword::ID:
+      func(static_cast<suggestedActionCheckPassword &>(obj));
+      return true;
+    case suggestedActionCheckPhoneNumber::ID:
+      func(static_cast<suggestedActionCheckPhoneNumber &>(obj));
+      return true;
+    case suggestedActionViewChecksHint::ID:
+      func(static_cast<suggestedActionViewChecksHint &>(obj));
+      return true;
+    case suggestedActionConvertToBroadcastGroup::ID:
+      func(static_cast<suggestedActionConvertToBroadcastGroup &>(obj));
+      return true;
+    case suggestedActionSetPassword::ID:
+      func(static_cast<suggestedActionSetPassword &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(SupergroupMembersFilter &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case supergroupMembersFilterRecent::ID:
+      func(static_cast<supergroupMembersFilterRecent &>(obj));
+      return true;
+    case supergroupMembersFilterContacts::ID:
+      func(static_cast<supergroupMembersFilterContacts &>(obj));
+      return true;
+    case supergroupMembersFilterAdministrators::ID:
+      func(static_cast<supergroupMembersFilterAdministrators &>(obj));
+      return true;
+    case supergroupMembersFilterSearch::ID:
+      func(static_cast<supergroupMembersFilterSearch &>(obj));
+      return true;
+    case supergroupMembersFilterRestricted::ID:
+      func(static_cast<supergroupMembersFilterRestricted &>(obj));
+      return true;
+    case supergroupMembersFilterBanned::ID:
+      func(static_cast<supergroupMembersFilterBanned &>(obj));
+      return true;
+    case supergroupMembersFilterMention::ID:
+      func(static_cast<supergroupMembersFilterMention &>(obj));
+      return true;
+    case supergroupMembersFilterBots::ID:
+      func(static_cast<supergroupMembersFilterBots &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(TMeUrlType &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case tMeUrlTypeUser::ID:
+      func(static_cast<tMeUrlTypeUser &>(obj));
+      return true;
+    case tMeUrlTypeSupergroup::ID:
+      func(static_cast<tMeUrlTypeSupergroup &>(obj));
+      return true;
+    case tMeUrlTypeChatInvite::ID:
+      func(static_cast<tMeUrlTypeChatInvite &>(obj));
+      return true;
+    case tMeUrlTypeStickerSet::ID:
+      func(static_cast<tMeUrlTypeStickerSet &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(TextEntityType &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch ((static_cast<std::uint32_t>(constructor) * 796688665u) >> 26) {
+    case 3:
+      if (constructor == textEntityTypeEmailAddress::ID) {
+        func(static_cast<textEntityTypeEmailAddress &>(obj));
+        return true;
+      }
+      break;
+    case 4:
+      if (constructor == textEntityTypePhoneNumber::ID) {
+        func(static_cast<textEntityTypePhoneNumber &>(obj));
+        return true;
+      }
+      break;
+    case 5:
+      if (constructor == textEntityTypeUnderline::ID) {
+        func(static_cast<textEntityTypeUnderline &>(obj));
+        return true;
+      }
+      break;
+    case 6:
+      if (constructor == textEntityTypeStrikethrough::ID) {
+        func(static_cast<textEntityTypeStrikethrough &>(obj));
+        return true;
+      }
+      break;
+    case 7:
+      if (constructor == textEntityTypeBankCardNumber::ID) {
+        func(static_cast<textEntityTypeBankCardNumber &>(obj));
+        return true;
+      }
+      break;
+    case 13:
+      if (constructor == textEntityTypeUrl::ID) {
+        func(static_cast<textEntityTypeUrl &>(obj));
+        return true;
+      }
+      break;
+    case 14:
+      if (constructor == textEntityTypeCode::ID) {
+        func(static_cast<textEntityTypeCode &>(obj));
+        return true;
+      }
+      break;
+    case 16:
+      if (constructor == textEntityTypeBold::ID) {
+        func(static_cast<textEntityTypeBold &>(obj));
+        return true;
+      }
+      break;
+    case 17:
+      if (constructor == textEntityTypeMentionName::ID) {
+        func(static_cast<textEntityTypeMentionName &>(obj));
+        return true;
+      }
+      break;
+    case 18:
+      if (constructor == textEntityTypeHashtag::ID) {
+        func(static_cast<textEntityTypeHashtag &>(obj));
+        return true;
+      }
+      break;
+    case 19:
+      if (constructor == textEntityTypeBotCommand::ID) {
+        func(static_cast<textEntityTypeBotCommand &>(obj));
+        return true;
+      }
+      break;
+    case 21:
+      if (constructor == textEntityTypePre::ID) {
+        func(static_cast<textEntityTypePre &>(obj));
+        return true;
+      }
+      break;
+    case 30:
+      if (constructor == textEntityTypeMediaTimestamp::ID) {
+        func(static_cast<textEntityTypeMediaTimestamp &>(obj));
+        return true;
+      }
+      break;
+    case 34:
+      if (constructor == textEntityTypeTextUrl::ID) {
+        func(static_cast<textEntityTypeTextUrl &>(obj));
+        return true;
+      }
+      break;
+    case 42:
+      if (constructor == textEntityTypeCashtag::ID) {
+        func(static_cast<textEntityTypeCashtag &>(obj));
+        return true;
+      }
+      break;
+    case 44:
+      if (constructor == textEntityTypePreCode::ID) {
+        func(static_cast<textEntityTypePreCode &>(obj));
+        return true;
+      }
+      break;
+    case 53:
+      if (constructor == textEntityTypeMention::ID) {
+        func(static_cast<textEntityTypeMention &>(obj));
+        return true;
+      }
+      break;
+    case 61:
+      if (constructor == textEntityTypeItalic::ID) {
+        func(static_cast<textEntityTypeItalic &>(obj));
+        return true;
+      }
+      break;
+    case 63:
+      if (constructor == textEntityTypeSpoiler::ID) {
+        func(static_cast<textEntityTypeSpoiler &>(obj));
+        return true;
+      }
+      break;
+    default:
+      break;
+  }
+  return false;
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(TextParseMode &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case textParseModeMarkdown::ID:
+      func(static_cast<textParseModeMarkdown &>(obj));
+      return true;
+    case textParseModeHTML::ID:
+      func(static_cast<textParseModeHTML &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(ThumbnailFormat &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case thumbnailFormatJpeg::ID:
+      func(static_cast<thumbnailFormatJpeg &>(obj));
+      return true;
+    case thumbnailFormatGif::ID:
+      func(static_cast<thumbnailFormatGif &>(obj));
+      return true;
+    case thumbnailFormatMpeg4::ID:
+      func(static_cast<thumbnailFormatMpeg4 &>(obj));
+      return true;
+    case thumbnailFormatPng::ID:
+      func(static_cast<thumbnailFormatPng &>(obj));
+      return true;
+    case thumbnailFormatTgs::ID:
+      func(static_cast<thumbnailFormatTgs &>(obj));
+      return true;
+    case thumbnailFormatWebm::ID:
+      func(static_cast<thumbnailFormatWebm &>(obj));
+      return true;
+    case thumbnailFormatWebp::ID:
+      func(static_cast<thumbnailFormatWebp &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(TopChatCategory &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case topChatCategoryUsers::ID:
+      func(static_cast<topChatCategoryUsers &>(obj));
+      return true;
+    case topChatCategoryBots::ID:
+      func(static_cast<topChatCategoryBots &>(obj));
+      return true;
+    case topChatCategoryGroups::ID:
+      func(static_cast<topChatCategoryGroups &>(obj));
+      return true;
+    case topChatCategoryChannels::ID:
+      func(static_cast<topChatCategoryChannels &>(obj));
+      return true;
+    case topChatCategoryInlineBots::ID:
+      func(static_cast<topChatCategoryInlineBots &>(obj));
+      return true;
+    case topChatCategoryCalls::ID:
+      func(static_cast<topChatCategoryCalls &>(obj));
+      return true;
+    case topChatCategoryForwardChats::ID:
+      func(static_cast<topChatCategoryForwardChats &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(Update &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch ((static_cast<std::uint32_t>(constructor) * 632327233u) >> 24) {
+    case 3:
+      if (constructor == updateSupergroupFullInfo::ID) {
+        func(static_cast<updateSupergroupFullInfo &>(obj));
+        return true;
+      }
+      break;
+    case 4:
+      if (constructor == updateOption::ID) {
+        func(static_cast<updateOption &>(obj));
+        return true;
+      }
+      break;
+    case 13:
+      if (constructor == updateChatMessageTtl::ID) {
+        func(static_cast<updateChatMessageTtl &>(obj));
+        return true;
+      }
+      break;
+    case 14:
+      if (constructor == updateReactions::ID) {
+        func(static_cast<updateReactions &>(obj));
+        return true;
+      }
+      break;
+    case 19:
+      if (constructor == updateUser::ID) {
+        func(static_cast<updateUser &>(obj));
+        return true;
+      }
+      break;
+    case 26:
+      if (constructor == updateChatActionBar::ID) {
+        func(static_cast<updateChatActionBar &>(obj));
+        return true;
+      }
+      break;
+    case 27:
+      if (constructor == updateCall::ID) {
+        func(static_cast<updateCall &>(obj));
+        return true;
+      }
+      break;
+    case 28:
+      if (constructor == updateChatPhoto::ID) {
+        func(static_cast<updateChatPhoto &>(obj));
+        return true;
+      }
+      break;
+    case 32:
+      if (constructor == updateChatUnreadMentionCount::ID) {
+        func(static_cast<updateChatUnreadMentionCount &>(obj));
+        return true;
+      }
+      break;
+    case 36:
+      if (constructor == updateChatNotificationSettings::ID) {
+        func(static_cast<updateChatNotificationSettings &>(obj));
+        return true;
+      }
+      break;
+    case 39:
+      if (constructor == updateSelectedBackground::ID) {
+        func(static_cast<updateSelectedBackground &>(obj));
+        return true;
+      }
+      break;
+    case 43:
+      if (constructor == updateNotification::ID) {
+        func(static_cast<updateNotification &>(obj));
+        return true;
+      }
+      break;
+    case 44:
+      if (constructor == updateAnimatedEmojiMessageClicked::ID) {
+        func(static_cast<updateAnimatedEmojiMessageClicked &>(obj));
+        return true;
+      }
+      break;
+    case 45:
+      if (constructor == updateChatReplyMarkup::ID) {
+        func(static_cast<updateChatReplyMarkup &>(obj));
+        return true;
+      }
+      break;
+    case 51:
+      if (constructor == updateDeleteMessages::ID) {
+        func(static_cast<updateDeleteMessages &>(obj));
+        return true;
+      }
+      break;
+    case 52:
+      if (constructor == updateChatPermissions::ID) {
+        func(static_cast<updateChatPermissions &>(obj));
+        return true;
+      }
+      break;
+    case 54:
+      if (constructor == updateMessageSendFailed::ID) {
+        func(static_cast<updateMessageSendFailed &>(obj));
+        return true;
+      }
+      break;
+    case 55:
+      if (constructor == updateChatAction::ID) {
+        func(static_cast<updateChatAction &>(obj));
+        return true;
+      }
+      break;
+    case 58:
+      if (constructor == updateChatTitle::ID) {
+        func(static_cast<updateChatTitle &>(obj));
+        return true;
+      }
+      if (constructor == updateChatPendingJoinRequests::ID) {
+        func(static_cast<updateChatPendingJoinRequests &>(obj));
+        return true;
+      }
+      break;
+    case 61:
+      if (constructor == updatePollAnswer::ID) {
+        func(static_cast<updatePollAnswer &>(obj));
+        return true;
+      }
+      break;
+    case 64:
+      if (constructor == updateStickerSet::ID) {
+        func(static_cast<updateStickerSet &>(obj));
+        return true;
+      }
+      break;
+    case 66:
+      if (constructor == updateMessageSendAcknowledged::ID) {
+        func(static_cast<updateMessageSendAcknowledged &>(obj));
+        return true;
+      }
+      break;
+    case 67:
+      if (constructor == updateChatUnreadReactionCount::ID) {
+        func(static_cast<updateChatUnreadReactionCount &>(obj));
+        return true;
+      }
+      break;
+    case 70:
+      if (constructor == updateSuggestedActions::ID) {
+        func(static_cast<updateSuggestedActions &>(obj));
+        return true;
+      }
+      break;
+    case 71:
+      if (constructor == updateHavePendingNotifications::ID) {
+        func(static_cast<updateHavePendingNotifications &>(obj));
+        return true;
+      }
+      if (constructor == updateDiceEmojis::ID) {
+        func(static_cast<updateDiceEmojis &>(obj));
+        return true;
+      }
+      break;
+    case 72:
+      if (constructor == updateChatIsBlocked::ID) {
+        func(static_cast<updateChatIsBlocked &>(obj));
+        return true;
+      }
+      break;
+    case 74:
+      if (constructor == updateChatOnlineMemberCount::ID) {
+        func(static_cast<updateChatOnlineMemberCount &>(obj));
+        return true;
+      }
+      break;
+    case 77:
+      if (constructor == updateLanguagePackStrings::ID) {
+        func(static_cast<updateLanguagePackStrings &>(obj));
+        return true;
+      }
+      break;
+    case 78:
+      if (constructor == updateServiceNotification::ID) {
+        func(static_cast<updateServiceNotification &>(obj));
+        return true;
+      }
+      break;
+    case 81:
+      if (constructor == updateNewChat::ID) {
+        func(static_cast<updateNewChat &>(obj));
+        return true;
+      }
+      break;
+    case 82:
+      if (constructor == updateChatPosition::ID) {
+        func(static_cast<updateChatPosition &>(obj));
+        return true;
+      }
+      break;
+    case 83:
+      if (constructor == updateMessageSendSucceeded::ID) {
+        func(static_cast<updateMessageSendSucceeded &>(obj));
+        return true;
+      }
+      break;
+    case 87:
+      if (constructor == updateFileGenerationStop::ID) {
+        func(static_cast<updateFileGenerationStop &>(obj));
+        return true;
+      }
+      break;
+    case 90:
+      if (constructor == updateNewChosenInlineResult::ID) {
+        func(static_cast<updateNewChosenInlineResult &>(obj));
+        return true;
+      }
+      break;
+    case 92:
+      if (constructor == updateConnectionState::ID) {
+        func(static_cast<updateConnectionState &>(obj));
+        return true;
+      }
+      break;
+    case 93:
+      if (constructor == updateChatDefaultDisableNotification::ID) {
+        func(static_cast<updateChatDefaultDisableNotification &>(obj));
+        return true;
+      }
+      break;
+    case 94:
+      if (constructor == updateAuthorizationState::ID) {
+        func(static_cast<updateAuthorizationState &>(obj));
+        return true;
+      }
+      break;
+    case 95:
+      if (constructor == updateGroupCall::ID) {
+        func(static_cast<updateGroupCall &>(obj));
+        return true;
+      }
+      break;
+    case 103:
+      if (constructor == updateChatLastMessage::ID) {
+        func(static_cast<updateChatLastMessage &>(obj));
+        return true;
+      }
+      break;
+    case 108:
+      if (constructor == updateChatReadInbox::ID) {
+        func(static_cast<updateChatReadInbox &>(obj));
+        return true;
+      }
+      break;
+    case 111:
+      if (constructor == updateUserPrivacySettingRules::ID) {
+        func(static_cast<updateUserPrivacySettingRules &>(obj));
+        return true;
+      }
+      break;
+    case 112:
+      if (constructor == updateSecretChat::ID) {
+        func(static_cast<updateSecretChat &>(obj));
+        return true;
+      }
+      break;
+    case 118:
+      if (constructor == updateMessageContent::ID) {
+        func(static_cast<updateMessageContent &>(obj));
+        return true;
+      }
+      break;
+    case 119:
+      if (constructor == updateUserStatus::ID) {
+        func(static_cast<updateUserStatus &>(obj));
+        return true;
+      }
+      break;
+    case 121:
+      if (constructor == updateChatReadOutbox::ID) {
+        func(static_cast<updateChatReadOutbox &>(obj));
+        return true;
+      }
+      break;
+    case 122:
+      if (constructor == updateChatMember::ID) {
+        func(static_cast<updateChatMember &>(obj));
+        return true;
+      }
+      break;
+    case 123:
+      if (constructor == updateFavoriteStickers::ID) {
+        func(static_cast<updateFavoriteStickers &>(obj));
+        return true;
+      }
+      break;
+    case 129:
+      if (constructor == updateBasicGroupFullInfo::ID) {
+        func(static_cast<updateBasicGroupFullInfo &>(obj));
+        return true;
+      }
+      break;
+    case 132:
+      if (constructor == updateScopeNotificationSettings::ID) {
+        func(static_cast<updateScopeNotificationSettings &>(obj));
+        return true;
+      }
+      break;
+    case 133:
+      if (constructor == updateBasicGroup::ID) {
+        func(static_cast<updateBasicGroup &>(obj));
+        return true;
+      }
+      break;
+    case 139:
+      if (constructor == updateInstalledStickerSets::ID) {
+        func(static_cast<updateInstalledStickerSets &>(obj));
+        return true;
+      }
+      break;
+    case 141:
+      if (constructor == updateMessageEdited::ID) {
+        func(static_cast<updateMessageEdited &>(obj));
+        return true;
+      }
+      break;
+    case 143:
+      if (constructor == updateActiveNotifications::ID) {
+        func(static_cast<updateActiveNotifications &>(obj));
+        return true;
+      }
+      break;
+    case 144:
+      if (constructor == updateTrendingStickerSets::ID) {
+        func(static_cast<updateTrendingStickerSets &>(obj));
+        return true;
+      }
+      break;
+    case 149:
+      if (constructor == updateNewInlineCallbackQuery::ID) {
+        func(static_cast<updateNewInlineCallbackQuery &>(obj));
+        return true;
+      }
+      break;
+    case 151:
+      if (constructor == updateMessageLiveLocationViewed::ID) {
+        func(static_cast<updateMessageLiveLocationViewed &>(obj));
+        return true;
+      }
+      break;
+    case 153:
+      if (constructor == updateUnreadMessageCount::ID) {
+        func(static_cast<updateUnreadMessageCount &>(obj));
+        return true;
+      }
+      break;
+    case 158:
+      if (constructor == updateMessageIsPinned::ID) {
+        func(static_cast<updateMessageIsPinned &>(obj));
+        return true;
+      }
+      break;
+    case 160:
+      if (constructor == updateMessageInteractionInfo::ID) {
+        func(static_cast<updateMessageInteractionInfo &>(obj));
+        return true;
+      }
+      break;
+    case 161:
+      if (constructor == updateChatHasScheduledMessages::ID) {
+        func(static_cast<updateChatHasScheduledMessages &>(obj));
+        return true;
+      }
+      break;
+    case 162:
+      if (constructor == updateUnreadChatCount::ID) {
+        func(static_cast<updateUnreadChatCount &>(obj));
+        return true;
+      }
+      break;
+    case 165:
+      if (constructor == updateChatTheme::ID) {
+        func(static_cast<updateChatTheme &>(obj));
+        return true;
+      }
+      break;
+    case 170:
+      if (constructor == updateChatDraftMessage::ID) {
+        func(static_cast<updateChatDraftMessage &>(obj));
+        return true;
+      }
+      break;
+    case 171:
+      if (constructor == updateMessageMentionRead::ID) {
+        func(static_cast<updateMessageMentionRead &>(obj));
+        return true;
+      }
+      break;
+    case 174:
+      if (constructor == updateNewShippingQuery::ID) {
+        func(static_cast<updateNewShippingQuery &>(obj));
+        return true;
+      }
+      break;
+    case 178:
+      if (constructor == updateChatMessageSender::ID) {
+        func(static_cast<updateChatMessageSender &>(obj));
+        return true;
+      }
+      break;
+    case 182:
+      if (constructor == updateAnimationSearchParameters::ID) {
+        func(static_cast<updateAnimationSearchParameters &>(obj));
+        return true;
+      }
+      break;
+    case 192:
+      if (constructor == updateNewCallSignalingData::ID) {
+        func(static_cast<updateNewCallSignalingData &>(obj));
+        return true;
+      }
+      break;
+    case 193:
+      if (constructor == updatePoll::ID) {
+        func(static_cast<updatePoll &>(obj));
+        return true;
+      }
+      break;
+    case 194:
+      if (constructor == updateChatVideoChat::ID) {
+        func(static_cast<updateChatVideoChat &>(obj));
+        return true;
+      }
+      break;
+    case 195:
+      if (constructor == updateTermsOfService::ID) {
+        func(static_cast<updateTermsOfService &>(obj));
+        return true;
+      }
+      break;
+    case 198:
+      if (constructor == updateChatAvailableReactions::ID) {
+        func(static_cast<updateChatAvailableReactions &>(obj));
+        return true;
+      }
+      break;
+    case 200:
+      if (constructor == updateChatIsMarkedAsUnread::ID) {
+        func(static_cast<updateChatIsMarkedAsUnread &>(obj));
+        return true;
+      }
+      break;
+    case 201:
+      if (constructor == updateSavedAnimations::ID) {
+        func(static_cast<updateSavedAnimations &>(obj));
+        return true;
+      }
+      break;
+    case 204:
+      if (constructor == updateChatHasProtectedContent::ID) {
+        func(static_cast<updateChatHasProtectedContent &>(obj));
+        return true;
+      }
+      break;
+    case 205:
+      if (constructor == updateChatThemes::ID) {
+        func(static_cast<updateChatThemes &>(obj));
+        return true;
+      }
+      break;
+    case 206:
+      if (constructor == updateUsersNearby::ID) {
+        func(static_cast<updateUsersNearby &>(obj));
+        return true;
+      }
+      break;
+    case 210:
+      if (constructor == updateNewChatJoinRequest::ID) {
+        func(static_cast<updateNewChatJoinRequest &>(obj));
+        return true;
+      }
+      break;
+    case 213:
+      if (constructor == updateMessageContentOpened::ID) {
+        func(static_cast<updateMessageContentOpened &>(obj));
+        return true;
+      }
+      if (constructor == updateRecentStickers::ID) {
+        func(static_cast<updateRecentStickers &>(obj));
+        return true;
+      }
+      break;
+    case 216:
+      if (constructor == updateNewCustomQuery::ID) {
+        func(static_cast<updateNewCustomQuery &>(obj));
+        return true;
+      }
+      break;
+    case 217:
+      if (constructor == updateChatFilters::ID) {
+        func(static_cast<updateChatFilters &>(obj));
+        return true;
+      }
+      break;
+    case 218:
+      if (constructor == updateSupergroup::ID) {
+        func(static_cast<updateSupergroup &>(obj));
+        return true;
+      }
+      break;
+    case 219:
+      if (constructor == updateNewCallbackQuery::ID) {
+        func(static_cast<updateNewCallbackQuery &>(obj));
+        return true;
+      }
+      break;
+    case 221:
+      if (constructor == updateNewPreCheckoutQuery::ID) {
+        func(static_cast<updateNewPreCheckoutQuery &>(obj));
+        return true;
+      }
+      break;
+    case 225:
+      if (constructor == updateMessageUnreadReactions::ID) {
+        func(static_cast<updateMessageUnreadReactions &>(obj));
+        return true;
+      }
+      break;
+    case 232:
+      if (constructor == updateNewCustomEvent::ID) {
+        func(static_cast<updateNewCustomEvent &>(obj));
+        return true;
+      }
+      break;
+    case 234:
+      if (constructor == updateFileGenerationStart::ID) {
+        func(static_cast<updateFileGenerationStart &>(obj));
+        return true;
+      }
+      break;
+    case 236:
+      if (constructor == updateFile::ID) {
+        func(static_cast<updateFile &>(obj));
+        return true;
+      }
+      break;
+    case 237:
+      if (constructor == updateGroupCallParticipant::ID) {
+        func(static_cast<updateGroupCallParticipant &>(obj));
+        return true;
+      }
+      break;
+    case 243:
+      if (constructor == updateUserFullInfo::ID) {
+        func(static_cast<updateUserFullInfo &>(obj));
+        return true;
+      }
+      break;
+    case 249:
+      if (constructor == updateNotificationGroup::ID) {
+        func(static_cast<updateNotificationGroup &>(obj));
+        return true;
+      }
+      break;
+    case 250:
+      if (constructor == updateNewInlineQuery::ID) {
+        func(static_cast<updateNewInlineQuery &>(obj));
+        return true;
+      }
+      break;
+    case 255:
+      if (constructor == updateNewMessage::ID) {
+        func(static_cast<updateNewMessage &>(obj));
+        return true;
+      }
+      break;
+    default:
+      break;
+  }
+  return false;
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(UserPrivacySetting &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case userPrivacySettingShowStatus::ID:
+      func(static_cast<userPrivacySettingShowStatus &>(obj));
+      return true;
+    case userPrivacySettingShowProfilePhoto::ID:
+      func(static_cast<userPrivacySettingShowProfilePhoto &>(obj));
+      return true;
+    case userPrivacySettingShowLinkInForwardedMessages::ID:
+      func(static_cast<userPrivacySettingShowLinkInForwardedMessages &>(obj));
+      return true;
+    case userPrivacySettingShowPhoneNumber::ID:
+      func(static_cast<userPrivacySettingShowPhoneNumber &>(obj));
+      return true;
+    case userPrivacySettingAllowChatInvites::ID:
+      func(static_cast<userPrivacySettingAllowChatInvites &>(obj));
+      return true;
+    case userPrivacySettingAllowCalls::ID:
+      func(static_cast<userPrivacySettingAllowCalls &>(obj));
+      return true;
+    case userPrivacySettingAllowPeerToPeerCalls::ID:
+      func(static_cast<userPrivacySettingAllowPeerToPeerCalls &>(obj));
+      return true;
+    case userPrivacySettingAllowFindingByPhoneNumber::ID:
+      func(static_cast<userPrivacySettingAllowFindingByPhoneNumber &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(UserPrivacySettingRule &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case userPrivacySettingRuleAllowAll::ID:
+      func(static_cast<userPrivacySettingRuleAllowAll &>(obj));
+      return true;
+    case userPrivacySettingRuleAllowContacts::ID:
+      func(static_cast<userPrivacySettingRuleAllowContacts &>(obj));
+      return true;
+    case userPrivacySettingRuleAllowUsers::ID:
+      func(static_cast<userPrivacySettingRuleAllowUsers &>(obj));
+      return true;
+    case userPrivacySettingRuleAllowChatMembers::ID:
+      func(static_cast<userPrivacySettingRuleAllowChatMembers &>(obj));
+      return true;
+    case userPrivacySettingRuleRestrictAll::ID:
+      func(static_cast<userPrivacySettingRuleRestrictAll &>(obj));
+      return true;
+    case userPrivacySettingRuleRestrictContacts::ID:
+      func(static_cast<userPrivacySettingRuleRestrictContacts &>(obj));
+      return true;
+    case userPrivacySettingRuleRestrictUsers::ID:
+      func(static_cast<userPrivacySettingRuleRestrictUsers &>(obj));
+      return true;
+    case userPrivacySettingRuleRestrictChatMembers::ID:
+      func(static_cast<userPrivacySettingRuleRestrictChatMembers &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(UserStatus &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case userStatusEmpty::ID:
+      func(static_cast<userStatusEmpty &>(obj));
+      return true;
+    case userStatusOnline::ID:
+      func(static_cast<userStatusOnline &>(obj));
+      return true;
+    case userStatusOffline::ID:
+      func(static_cast<userStatusOffline &>(obj));
+      return true;
+    case userStatusRecently::ID:
+      func(static_cast<userStatusRecently &>(obj));
+      return true;
+    case userStatusLastWeek::ID:
+      func(static_cast<userStatusLastWeek &>(obj));
+      return true;
+    case userStatusLastMonth::ID:
+      func(static_cast<userStatusLastMonth &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(UserType &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case userTypeRegular::ID:
+      func(static_cast<userTypeRegular &>(obj));
+      return true;
+    case userTypeDeleted::ID:
+      func(static_cast<userTypeDeleted &>(obj));
+      return true;
+    case userTypeBot::ID:
+      func(static_cast<userTypeBot &>(obj));
+      return true;
+    case userTypeUnknown::ID:
+      func(static_cast<userTypeUnknown &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(VectorPathCommand &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case vectorPathCommandLine::ID:
+      func(static_cast<vectorPathCommandLine &>(obj));
+      return true;
+    case vectorPathCommandCubicBezierCurve::ID:
+      func(static_cast<vectorPathCommandCubicBezierCurve &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+}  // namespace td_api
+}  // namespace td
@@ -0,0 +1,13027 @@
+#pragma once
+
+/**
+ * \file
+ * Contains downcast_call methods for calling a function object on downcasted to
+ * the most derived class TDLib API object.
+ */
+#include "telegram_api.h"
+
+namespace td {
+namespace telegram_api {
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(Object &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch ((static_cast<std::uint32_t>(constructor) * 3910468849u) >> 21) {
+    case 0:
+      if (constructor == pageBlockRelatedArticles::ID) {
+        func(static_cast<pageBlockRelatedArticles &>(obj));
+        return true;
+      }
+      break;
+    case 1:
+      if (constructor == botCommandScopeUsers::ID) {
+        func(static_cast<botCommandScopeUsers &>(obj));
+        return true;
+      }
+      break;
+    case 2:
+      if (constructor == inputBotInlineMessageID64::ID) {
+        func(static_cast<inputBotInlineMessageID64 &>(obj));
+        return true;
+      }
+      break;
+    case 3:
+      if (constructor == channelAdminLogEventActionParticipantVolume::ID) {
+        func(static_cast<channelAdminLogEventActionParticipantVolume &>(obj));
+        return true;
+      }
+      break;
+    case 7:
+      if (constructor == pollAnswer::ID) {
+        func(static_cast<pollAnswer &>(obj));
+        return true;
+      }
+      break;
+    case 8:
+      if (constructor == channelAdminLogEventActionExportedInviteEdit::ID) {
+        func(static_cast<channelAdminLogEventActionExportedInviteEdit &>(obj));
+        return true;
+      }
+      break;
+    case 11:
+      if (constructor == topPeerCategoryChannels::ID) {
+        func(static_cast<topPeerCategoryChannels &>(obj));
+        return true;
+      }
+      break;
+    case 12:
+      if (constructor == updateEncryption::ID) {
+        func(static_cast<updateEncryption &>(obj));
+        return true;
+      }
+      break;
+    case 18:
+      if (constructor == peerBlocked::ID) {
+        func(static_cast<peerBlocked &>(obj));
+        return true;
+      }
+      break;
+    case 21:
+      if (constructor == updateShort::ID) {
+        func(static_cast<updateShort &>(obj));
+        return true;
+      }
+      break;
+    case 28:
+      if (constructor == channelAdminLogEventActionParticipantUnmute::ID) {
+        func(static_cast<channelAdminLogEventActionParticipantUnmute &>(obj));
+        return true;
+      }
+      break;
+    case 30:
+      if (constructor == themeSettings::ID) {
+        func(static_cast<themeSettings &>(obj));
+        return true;
+      }
+      if (constructor == updates_differenceEmpty::ID) {
+        func(static_cast<updates_differenceEmpty &>(obj));
+        return true;
+      }
+      break;
+    case 31:
+      if (constructor == messageEntityStrike::ID) {
+        func(static_cast<messageEntityStrike &>(obj));
+        return true;
+      }
+      break;
+    case 39:
+      if (constructor == speakingInGroupCallAction::ID) {
+        func(static_cast<speakingInGroupCallAction &>(obj));
+        return true;
+      }
+      break;
+    case 40:
+      if (constructor == topPeerCategoryBotsPM::ID) {
+        func(static_cast<topPeerCategoryBotsPM &>(obj));
+        return true;
+      }
+      if (constructor == account_wallPapersNotModified::ID) {
+        func(static_cast<account_wallPapersNotModified &>(obj));
+        return true;
+      }
+      break;
+    case 41:
+      if (constructor == inputMessagesFilterContacts::ID) {
+        func(static_cast<inputMessagesFilterContacts &>(obj));
+        return true;
+      }
+      break;
+    case 43:
+      if (constructor == restrictionReason::ID) {
+        func(static_cast<restrictionReason &>(obj));
+        return true;
+      }
+      break;
+    case 52:
+      if (constructor == message::ID) {
+        func(static_cast<message &>(obj));
+        return true;
+      }
+      break;
+    case 54:
+      if (constructor == updateChannelMessageForwards::ID) {
+        func(static_cast<updateChannelMessageForwards &>(obj));
+        return true;
+      }
+      break;
+    case 55:
+      if (constructor == peerSettings::ID) {
+        func(static_cast<peerSettings &>(obj));
+        return true;
+      }
+      if (constructor == urlAuthResultRequest::ID) {
+        func(static_cast<urlAuthResultRequest &>(obj));
+        return true;
+      }
+      break;
+    case 57:
+      if (constructor == channelAdminLogEventActionChangeStickerSet::ID) {
+        func(static_cast<channelAdminLogEventActionChangeStickerSet &>(obj));
+        return true;
+      }
+      if (constructor == inputPhotoEmpty::ID) {
+        func(static_cast<inputPhotoEmpty &>(obj));
+        return true;
+      }
+      break;
+    case 61:
+      if (constructor == channelParticipantsKicked::ID) {
+        func(static_cast<channelParticipantsKicked &>(obj));
+        return true;
+      }
+      break;
+    case 67:
+      if (constructor == geoPoint::ID) {
+        func(static_cast<geoPoint &>(obj));
+        return true;
+      }
+      break;
+    case 69:
+      if (constructor == storage_fileJpeg::ID) {
+        func(static_cast<storage_fileJpeg &>(obj));
+        return true;
+      }
+      break;
+    case 75:
+      if (constructor == channelAdminLogEventActionToggleGroupCallSetting::ID) {
+        func(static_cast<channelAdminLogEventActionToggleGroupCallSetting &>(obj));
+        return true;
+      }
+      break;
+    case 78:
+      if (constructor == pageListItemBlocks::ID) {
+        func(static_cast<pageListItemBlocks &>(obj));
+        return true;
+      }
+      break;
+    case 80:
+      if (constructor == inputFileLocation::ID) {
+        func(static_cast<inputFileLocation &>(obj));
+        return true;
+      }
+      break;
+    case 86:
+      if (constructor == updateUserPhoto::ID) {
+        func(static_cast<updateUserPhoto &>(obj));
+        return true;
+      }
+      break;
+    case 87:
+      if (constructor == folder::ID) {
+        func(static_cast<folder &>(obj));
+        return true;
+      }
+      break;
+    case 92:
+      if (constructor == inputPaymentCredentialsSaved::ID) {
+        func(static_cast<inputPaymentCredentialsSaved &>(obj));
+        return true;
+      }
+      break;
+    case 95:
+      if (constructor == botInlineMediaResult::ID) {
+        func(static_cast<botInlineMediaResult &>(obj));
+        return true;
+      }
+      break;
+    case 99:
+      if (constructor == secureValueErrorData::ID) {
+        func(static_cast<secureValueErrorData &>(obj));
+        return true;
+      }
+      break;
+    case 100:
+      if (constructor == messages_chats::ID) {
+        func(static_cast<messages_chats &>(obj));
+        return true;
+      }
+      break;
+    case 101:
+      if (constructor == inputChatUploadedPhoto::ID) {
+        func(static_cast<inputChatUploadedPhoto &>(obj));
+        return true;
+      }
+      if (constructor == auth_loginTokenSuccess::ID) {
+        func(static_cast<auth_loginTokenSuccess &>(obj));
+        return true;
+      }
+      break;
+    case 102:
+      if (constructor == updateEncryptedChatTyping::ID) {
+        func(static_cast<updateEncryptedChatTyping &>(obj));
+        return true;
+      }
+      break;
+    case 103:
+      if (constructor == photoSize::ID) {
+        func(static_cast<photoSize &>(obj));
+        return true;
+      }
+      break;
+    case 104:
+      if (constructor == channelAdminLogEventActionChangeLinkedChat::ID) {
+        func(static_cast<channelAdminLogEventActionChangeLinkedChat &>(obj));
+        return true;
+      }
+      if (constructor == updatePeerBlocked::ID) {
+        func(static_cast<updatePeerBlocked &>(obj));
+        return true;
+      }
+      break;
+    case 106:
+      if (constructor == inputFile::ID) {
+        func(static_cast<inputFile &>(obj));
+        return true;
+      }
+      break;
+    case 113:
+      if (constructor == inputWebFileGeoPointLocation::ID) {
+        func(static_cast<inputWebFileGeoPointLocation &>(obj));
+        return true;
+      }
+      break;
+    case 121:
+      if (constructor == contacts_importedContacts::ID) {
+        func(static_cast<contacts_importedContacts &>(obj));
+        return true;
+      }
+      break;
+    case 129:
+      if (constructor == channelAdminLogEventActionParticipantJoinByInvite::ID) {
+        func(static_cast<channelAdminLogEventActionParticipantJoinByInvite &>(obj));
+        return true;
+      }
+      if (constructor == channelLocationEmpty::ID) {
+        func(static_cast<channelLocationEmpty &>(obj));
+        return true;
+      }
+      break;
+    case 132:
+      if (constructor == updatePinnedDialogs::ID) {
+        func(static_cast<updatePinnedDialogs &>(obj));
+        return true;
+      }
+      break;
+    case 142:
+      if (constructor == messageActionChatJoinedByRequest::ID) {
+        func(static_cast<messageActionChatJoinedByRequest &>(obj));
+        return true;
+      }
+      if (constructor == messages_inactiveChats::ID) {
+        func(static_cast<messages_inactiveChats &>(obj));
+        return true;
+      }
+      break;
+    case 143:
+      if (constructor == messages_botResults::ID) {
+        func(static_cast<messages_botResults &>(obj));
+        return true;
+      }
+      break;
+    case 145:
+      if (constructor == updatePeerLocated::ID) {
+        func(static_cast<updatePeerLocated &>(obj));
+        return true;
+      }
+      break;
+    case 147:
+      if (constructor == inputBotInlineResultDocument::ID) {
+        func(static_cast<inputBotInlineResultDocument &>(obj));
+        return true;
+      }
+      break;
+    case 151:
+      if (constructor == channelAdminLogEventActionStopPoll::ID) {
+        func(static_cast<channelAdminLogEventActionStopPoll &>(obj));
+        return true;
+      }
+      break;
+    case 154:
+      if (constructor == updateBotWebhookJSON::ID) {
+        func(static_cast<updateBotWebhookJSON &>(obj));
+        return true;
+      }
+      break;
+    case 159:
+      if (constructor == messageEntityCode::ID) {
+        func(static_cast<messageEntityCode &>(obj));
+        return true;
+      }
+      break;
+    case 160:
+      if (constructor == chatPhotoEmpty::ID) {
+        func(static_cast<chatPhotoEmpty &>(obj));
+        return true;
+      }
+      break;
+    case 165:
+      if (constructor == groupCallParticipantVideo::ID) {
+        func(static_cast<groupCallParticipantVideo &>(obj));
+        return true;
+      }
+      break;
+    case 167:
+      if (constructor == inlineQueryPeerTypeSameBotPM::ID) {
+        func(static_cast<inlineQueryPeerTypeSameBotPM &>(obj));
+        return true;
+      }
+      if (constructor == inputGeoPointEmpty::ID) {
+        func(static_cast<inputGeoPointEmpty &>(obj));
+        return true;
+      }
+      break;
+    case 168:
+      if (constructor == messages_allStickersNotModified::ID) {
+        func(static_cast<messages_allStickersNotModified &>(obj));
+        return true;
+      }
+      break;
+    case 169:
+      if (constructor == messages_availableReactionsNotModified::ID) {
+        func(static_cast<messages_availableReactionsNotModified &>(obj));
+        return true;
+      }
+      break;
+    case 173:
+      if (constructor == botCommandScopeChats::ID) {
+        func(static_cast<botCommandScopeChats &>(obj));
+        return true;
+      }
+      break;
+    case 178:
+      if (constructor == messageService::ID) {
+        func(static_cast<messageService &>(obj));
+        return true;
+      }
+      break;
+    case 181:
+      if (constructor == geoPointEmpty::ID) {
+        func(static_cast<geoPointEmpty &>(obj));
+        return true;
+      }
+      break;
+    case 189:
+      if (constructor == botInlineMessageMediaContact::ID) {
+        func(static_cast<botInlineMessageMediaContact &>(obj));
+        return true;
+      }
+      break;
+    case 191:
+      if (constructor == baseThemeDay::ID) {
+        func(static_cast<baseThemeDay &>(obj));
+        return true;
+      }
+      break;
+    case 194:
+      if (constructor == messageActionInviteToGroupCall::ID) {
+        func(static_cast<messageActionInviteToGroupCall &>(obj));
+        return true;
+      }
+      break;
+    case 195:
+      if (constructor == messageMediaPoll::ID) {
+        func(static_cast<messageMediaPoll &>(obj));
+        return true;
+      }
+      break;
+    case 198:
+      if (constructor == savedPhoneContact::ID) {
+        func(static_cast<savedPhoneContact &>(obj));
+        return true;
+      }
+      if (constructor == sendMessageHistoryImportAction::ID) {
+        func(static_cast<sendMessageHistoryImportAction &>(obj));
+        return true;
+      }
+      break;
+    case 200:
+      if (constructor == channelAdminLogEventActionChangePhoto::ID) {
+        func(static_cast<channelAdminLogEventActionChangePhoto &>(obj));
+        return true;
+      }
+      if (constructor == codeSettings::ID) {
+        func(static_cast<codeSettings &>(obj));
+        return true;
+      }
+      break;
+    case 201:
+      if (constructor == secureValue::ID) {
+        func(static_cast<secureValue &>(obj));
+        return true;
+      }
+      break;
+    case 203:
+      if (constructor == messageMediaDice::ID) {
+        func(static_cast<messageMediaDice &>(obj));
+        return true;
+      }
+      break;
+    case 204:
+      if (constructor == pageBlockTitle::ID) {
+        func(static_cast<pageBlockTitle &>(obj));
+        return true;
+      }
+      break;
+    case 205:
+      if (constructor == inputWebDocument::ID) {
+        func(static_cast<inputWebDocument &>(obj));
+        return true;
+      }
+      if (constructor == messages_dialogsSlice::ID) {
+        func(static_cast<messages_dialogsSlice &>(obj));
+        return true;
+      }
+      break;
+    case 207:
+      if (constructor == account_resetPasswordOk::ID) {
+        func(static_cast<account_resetPasswordOk &>(obj));
+        return true;
+      }
+      break;
+    case 208:
+      if (constructor == messages_availableReactions::ID) {
+        func(static_cast<messages_availableReactions &>(obj));
+        return true;
+      }
+      break;
+    case 213:
+      if (constructor == textPhone::ID) {
+        func(static_cast<textPhone &>(obj));
+        return true;
+      }
+      if (constructor == sendMessageEmojiInteraction::ID) {
+        func(static_cast<sendMessageEmojiInteraction &>(obj));
+        return true;
+      }
+      break;
+    case 218:
+      if (constructor == pageBlockList::ID) {
+        func(static_cast<pageBlockList &>(obj));
+        return true;
+      }
+      break;
+    case 220:
+      if (constructor == messageActionBotAllowed::ID) {
+        func(static_cast<messageActionBotAllowed &>(obj));
+        return true;
+      }
+      break;
+    case 221:
+      if (constructor == inputPrivacyValueDisallowChatParticipants::ID) {
+        func(static_cast<inputPrivacyValueDisallowChatParticipants &>(obj));
+        return true;
+      }
+      break;
+    case 223:
+      if (constructor == privacyValueDisallowUsers::ID) {
+        func(static_cast<privacyValueDisallowUsers &>(obj));
+        return true;
+      }
+      break;
+    case 225:
+      if (constructor == messageMediaInvoice::ID) {
+        func(static_cast<messageMediaInvoice &>(obj));
+        return true;
+      }
+      break;
+    case 227:
+      if (constructor == inputGameID::ID) {
+        func(static_cast<inputGameID &>(obj));
+        return true;
+      }
+      break;
+    case 229:
+      if (constructor == jsonObject::ID) {
+        func(static_cast<jsonObject &>(obj));
+        return true;
+      }
+      break;
+    case 232:
+      if (constructor == groupCallParticipantVideoSourceGroup::ID) {
+        func(static_cast<groupCallParticipantVideoSourceGroup &>(obj));
+        return true;
+      }
+      break;
+    case 235:
+      if (constructor == messages_dhConfigNotModified::ID) {
+        func(static_cast<messages_dhConfigNotModified &>(obj));
+        return true;
+      }
+      break;
+    case 236:
+      if (constructor == inputPeerSelf::ID) {
+        func(static_cast<inputPeerSelf &>(obj));
+        return true;
+      }
+      if (constructor == help_userInfo::ID) {
+        func(static_cast<help_userInfo &>(obj));
+        return true;
+      }
+      break;
+    case 242:
+      if (constructor == channelFull::ID) {
+        func(static_cast<channelFull &>(obj));
+        return true;
+      }
+      break;
+    case 246:
+      if (constructor == inputGroupCall::ID) {
+        func(static_cast<inputGroupCall &>(obj));
+        return true;
+      }
+      break;
+    case 247:
+      if (constructor == messageMediaUnsupported::ID) {
+        func(static_cast<messageMediaUnsupported &>(obj));
+        return true;
+      }
+      break;
+    case 251:
+      if (constructor == inputAppEvent::ID) {
+        func(static_cast<inputAppEvent &>(obj));
+        return true;
+      }
+      break;
+    case 252:
+      if (constructor == messageEntityTextUrl::ID) {
+        func(static_cast<messageEntityTextUrl &>(obj));
+        return true;
+      }
+      break;
+    case 254:
+      if (constructor == channelAdminLogEventActionToggleNoForwards::ID) {
+        func(static_cast<channelAdminLogEventActionToggleNoForwards &>(obj));
+        return true;
+      }
+      if (constructor == inputMessagesFilterChatPhotos::ID) {
+        func(static_cast<inputMessagesFilterChatPhotos &>(obj));
+        return true;
+      }
+      break;
+    case 258:
+      if (constructor == inputMessagesFilterGif::ID) {
+        func(static_cast<inputMessagesFilterGif &>(obj));
+        return true;
+      }
+      break;
+    case 265:
+      if (constructor == groupCallParticipant::ID) {
+        func(static_cast<groupCallParticipant &>(obj));
+        return true;
+      }
+      if (constructor == topPeerCategoryForwardUsers::ID) {
+        func(static_cast<topPeerCategoryForwardUsers &>(obj));
+        return true;
+      }
+      break;
+    case 266:
+      if (constructor == updateBotWebhookJSONQuery::ID) {
+        func(static_cast<updateBotWebhookJSONQuery &>(obj));
+        return true;
+      }
+      break;
+    case 274:
+      if (constructor == dataJSON::ID) {
+        func(static_cast<dataJSON &>(obj));
+        return true;
+      }
+      break;
+    case 282:
+      if (constructor == inputPeerChannel::ID) {
+        func(static_cast<inputPeerChannel &>(obj));
+        return true;
+      }
+      break;
+    case 285:
+      if (constructor == secureValueTypeTemporaryRegistration::ID) {
+        func(static_cast<secureValueTypeTemporaryRegistration &>(obj));
+        return true;
+      }
+      if (constructor == account_wallPapers::ID) {
+        func(static_cast<account_wallPapers &>(obj));
+        return true;
+      }
+      break;
+    case 286:
+      if (constructor == inputPeerPhotoFileLocation::ID) {
+        func(static_cast<inputPeerPhotoFileLocation &>(obj));
+        return true;
+      }
+      if (constructor == messages_affectedFoundMessages::ID) {
+        func(static_cast<messages_affectedFoundMessages &>(obj));
+        return true;
+      }
+      if (constructor == messages_affectedHistory::ID) {
+        func(static_cast<messages_affectedHistory &>(obj));
+        return true;
+      }
+      break;
+    case 288:
+      if (constructor == chatInvitePeek::ID) {
+        func(static_cast<chatInvitePeek &>(obj));
+        return true;
+      }
+      break;
+    case 292:
+      if (constructor == exportedMessageLink::ID) {
+        func(static_cast<exportedMessageLink &>(obj));
+        return true;
+      }
+      break;
+    case 293:
+      if (constructor == pageBlockDivider::ID) {
+        func(static_cast<pageBlockDivider &>(obj));
+        return true;
+      }
+      break;
+    case 294:
+      if (constructor == textConcat::ID) {
+        func(static_cast<textConcat &>(obj));
+        return true;
+      }
+      break;
+    case 298:
+      if (constructor == inputUserSelf::ID) {
+        func(static_cast<inputUserSelf &>(obj));
+        return true;
+      }
+      if (constructor == inputUserFromMessage::ID) {
+        func(static_cast<inputUserFromMessage &>(obj));
+        return true;
+      }
+      if (constructor == contacts_found::ID) {
+        func(static_cast<contacts_found &>(obj));
+        return true;
+      }
+      break;
+    case 301:
+      if (constructor == messageActionCustomAction::ID) {
+        func(static_cast<messageActionCustomAction &>(obj));
+        return true;
+      }
+      break;
+    case 302:
+      if (constructor == webPage::ID) {
+        func(static_cast<webPage &>(obj));
+        return true;
+      }
+      break;
+    case 304:
+      if (constructor == inputPeerChat::ID) {
+        func(static_cast<inputPeerChat &>(obj));
+        return true;
+      }
+      break;
+    case 305:
+      if (constructor == inputKeyboardButtonUrlAuth::ID) {
+        func(static_cast<inputKeyboardButtonUrlAuth &>(obj));
+        return true;
+      }
+      break;
+    case 307:
+      if (constructor == messageEntityMentionName::ID) {
+        func(static_cast<messageEntityMentionName &>(obj));
+        return true;
+      }
+      break;
+    case 310:
+      if (constructor == privacyKeyChatInvite::ID) {
+        func(static_cast<privacyKeyChatInvite &>(obj));
+        return true;
+      }
+      break;
+    case 312:
+      if (constructor == inputBotInlineMessageGame::ID) {
+        func(static_cast<inputBotInlineMessageGame &>(obj));
+        return true;
+      }
+      break;
+    case 313:
+      if (constructor == langPackDifference::ID) {
+        func(static_cast<langPackDifference &>(obj));
+        return true;
+      }
+      break;
+    case 314:
+      if (constructor == textBold::ID) {
+        func(static_cast<textBold &>(obj));
+        return true;
+      }
+      break;
+    case 317:
+      if (constructor == channelParticipantsAdmins::ID) {
+        func(static_cast<channelParticipantsAdmins &>(obj));
+        return true;
+      }
+      break;
+    case 319:
+      if (constructor == baseThemeNight::ID) {
+        func(static_cast<baseThemeNight &>(obj));
+        return true;
+      }
+      break;
+    case 327:
+      if (constructor == draftMessageEmpty::ID) {
+        func(static_cast<draftMessageEmpty &>(obj));
+        return true;
+      }
+      break;
+    case 328:
+      if (constructor == userProfilePhoto::ID) {
+        func(static_cast<userProfilePhoto &>(obj));
+        return true;
+      }
+      break;
+    case 329:
+      if (constructor == inputStickerSetID::ID) {
+        func(static_cast<inputStickerSetID &>(obj));
+        return true;
+      }
+      if (constructor == updateChannelTooLong::ID) {
+        func(static_cast<updateChannelTooLong &>(obj));
+        return true;
+      }
+      break;
+    case 331:
+      if (constructor == updateChat::ID) {
+        func(static_cast<updateChat &>(obj));
+        return true;
+      }
+      break;
+    case 334:
+      if (constructor == updateMessageReactions::ID) {
+        func(static_cast<updateMessageReactions &>(obj));
+        return true;
+      }
+      break;
+    case 336:
+      if (constructor == channels_adminLogResults::ID) {
+        func(static_cast<channels_adminLogResults &>(obj));
+        return true;
+      }
+      break;
+    case 339:
+      if (constructor == topPeerCategoryForwardChats::ID) {
+        func(static_cast<topPeerCategoryForwardChats &>(obj));
+        return true;
+      }
+      break;
+    case 344:
+      if (constructor == pageBlockVideo::ID) {
+        func(static_cast<pageBlockVideo &>(obj));
+        return true;
+      }
+      if (constructor == phoneCallWaiting::ID) {
+        func(static_cast<phoneCallWaiting &>(obj));
+        return true;
+      }
+      break;
+    case 346:
+      if (constructor == chatForbidden::ID) {
+        func(static_cast<chatForbidden &>(obj));
+        return true;
+      }
+      break;
+    case 348:
+      if (constructor == upload_cdnFileReuploadNeeded::ID) {
+        func(static_cast<upload_cdnFileReuploadNeeded &>(obj));
+        return true;
+      }
+      break;
+    case 352:
+      if (constructor == channelAdminLogEventActionParticipantInvite::ID) {
+        func(static_cast<channelAdminLogEventActionParticipantInvite &>(obj));
+        return true;
+      }
+      break;
+    case 353:
+      if (constructor == messageViews::ID) {
+        func(static_cast<messageViews &>(obj));
+        return true;
+      }
+      break;
+    case 356:
+      if (constructor == phoneCallDiscardReasonBusy::ID) {
+        func(static_cast<phoneCallDiscardReasonBusy &>(obj));
+        return true;
+      }
+      break;
+    case 362:
+      if (constructor == documentAttributeFilename::ID) {
+        func(static_cast<documentAttributeFilename &>(obj));
+        return true;
+      }
+      break;
+    case 364:
+      if (constructor == phoneCallAccepted::ID) {
+        func(static_cast<phoneCallAccepted &>(obj));
+        return true;
+      }
+      if (constructor == videoSize::ID) {
+        func(static_cast<videoSize &>(obj));
+        return true;
+      }
+      break;
+    case 365:
+      if (constructor == pageBlockPreformatted::ID) {
+        func(static_cast<pageBlockPreformatted &>(obj));
+        return true;
+      }
+      break;
+    case 366:
+      if (constructor == privacyValueDisallowAll::ID) {
+        func(static_cast<privacyValueDisallowAll &>(obj));
+        return true;
+      }
+      break;
+    case 368:
+      if (constructor == messages_exportedChatInvites::ID) {
+        func(static_cast<messages_exportedChatInvites &>(obj));
+        return true;
+      }
+      break;
+    case 369:
+      if (constructor == inputPrivacyKeyForwards::ID) {
+        func(static_cast<inputPrivacyKeyForwards &>(obj));
+        return true;
+      }
+      break;
+    case 371:
+      if (constructor == dcOption::ID) {
+        func(static_cast<dcOption &>(obj));
+        return true;
+      }
+      break;
+    case 372:
+      if (constructor == account_themesNotModified::ID) {
+        func(static_cast<account_themesNotModified &>(obj));
+        return true;
+      }
+      break;
+    case 373:
+      if (constructor == chatParticipantsForbidden::ID) {
+        func(static_cast<chatParticipantsForbidden &>(obj));
+        return true;
+      }
+      if (constructor == inputStickerSetThumbLegacy::ID) {
+        func(static_cast<inputStickerSetThumbLegacy &>(obj));
+        return true;
+      }
+      break;
+    case 376:
+      if (constructor == inputStickerSetItem::ID) {
+        func(static_cast<inputStickerSetItem &>(obj));
+        return true;
+      }
+      break;
+    case 377:
+      if (constructor == inputReportReasonSpam::ID) {
+        func(static_cast<inputReportReasonSpam &>(obj));
+        return true;
+      }
+      break;
+    case 378:
+      if (constructor == messageEntityPre::ID) {
+        func(static_cast<messageEntityPre &>(obj));
+        return true;
+      }
+      break;
+    case 379:
+      if (constructor == channelLocation::ID) {
+        func(static_cast<channelLocation &>(obj));
+        return true;
+      }
+      if (constructor == updateNewMessage::ID) {
+        func(static_cast<updateNewMessage &>(obj));
+        return true;
+      }
+      if (constructor == messages_searchCounter::ID) {
+        func(static_cast<messages_searchCounter &>(obj));
+        return true;
+      }
+      break;
+    case 380:
+      if (constructor == langPackLanguage::ID) {
+        func(static_cast<langPackLanguage &>(obj));
+        return true;
+      }
+      if (constructor == messageMediaVenue::ID) {
+        func(static_cast<messageMediaVenue &>(obj));
+        return true;
+      }
+      break;
+    case 385:
+      if (constructor == updateBotChatInviteRequester::ID) {
+        func(static_cast<updateBotChatInviteRequester &>(obj));
+        return true;
+      }
+      break;
+    case 389:
+      if (constructor == receivedNotifyMessage::ID) {
+        func(static_cast<receivedNotifyMessage &>(obj));
+        return true;
+      }
+      if (constructor == statsDateRangeDays::ID) {
+        func(static_cast<statsDateRangeDays &>(obj));
+        return true;
+      }
+      break;
+    case 391:
+      if (constructor == messages_highScores::ID) {
+        func(static_cast<messages_highScores &>(obj));
+        return true;
+      }
+      break;
+    case 393:
+      if (constructor == help_promoData::ID) {
+        func(static_cast<help_promoData &>(obj));
+        return true;
+      }
+      break;
+    case 395:
+      if (constructor == peerUser::ID) {
+        func(static_cast<peerUser &>(obj));
+        return true;
+      }
+      break;
+    case 397:
+      if (constructor == theme::ID) {
+        func(static_cast<theme &>(obj));
+        return true;
+      }
+      break;
+    case 398:
+      if (constructor == updates_difference::ID) {
+        func(static_cast<updates_difference &>(obj));
+        return true;
+      }
+      break;
+    case 399:
+      if (constructor == inputWallPaperNoFile::ID) {
+        func(static_cast<inputWallPaperNoFile &>(obj));
+        return true;
+      }
+      break;
+    case 403:
+      if (constructor == phoneConnectionWebrtc::ID) {
+        func(static_cast<phoneConnectionWebrtc &>(obj));
+        return true;
+      }
+      if (constructor == stickerSetCovered::ID) {
+        func(static_cast<stickerSetCovered &>(obj));
+        return true;
+      }
+      break;
+    case 405:
+      if (constructor == inputNotifyUsers::ID) {
+        func(static_cast<inputNotifyUsers &>(obj));
+        return true;
+      }
+      break;
+    case 409:
+      if (constructor == stats_broadcastStats::ID) {
+        func(static_cast<stats_broadcastStats &>(obj));
+        return true;
+      }
+      break;
+    case 410:
+      if (constructor == searchResultsCalendarPeriod::ID) {
+        func(static_cast<searchResultsCalendarPeriod &>(obj));
+        return true;
+      }
+      break;
+    case 412:
+      if (constructor == jsonNull::ID) {
+        func(static_cast<jsonNull &>(obj));
+        return true;
+      }
+      break;
+    case 413:
+      if (constructor == messageActionSecureValuesSentMe::ID) {
+        func(static_cast<messageActionSecureValuesSentMe &>(obj));
+        return true;
+      }
+      break;
+    case 417:
+      if (constructor == channelAdminLogEventsFilter::ID) {
+        func(static_cast<channelAdminLogEventsFilter &>(obj));
+        return true;
+      }
+      break;
+    case 418:
+      if (constructor == contacts_contacts::ID) {
+        func(static_cast<contacts_contacts &>(obj));
+        return true;
+      }
+      break;
+    case 420:
+      if (constructor == inputMediaPoll::ID) {
+        func(static_cast<inputMediaPoll &>(obj));
+        return true;
+      }
+      if (constructor == messageMediaDocument::ID) {
+        func(static_cast<messageMediaDocument &>(obj));
+        return true;
+      }
+      break;
+    case 425:
+      if (constructor == emojiKeywordDeleted::ID) {
+        func(static_cast<emojiKeywordDeleted &>(obj));
+        return true;
+      }
+      if (constructor == inputKeyboardButtonUserProfile::ID) {
+        func(static_cast<inputKeyboardButtonUserProfile &>(obj));
+        return true;
+      }
+      break;
+    case 427:
+      if (constructor == chatParticipantCreator::ID) {
+        func(static_cast<chatParticipantCreator &>(obj));
+        return true;
+      }
+      break;
+    case 428:
+      if (constructor == keyboardButtonRequestPoll::ID) {
+        func(static_cast<keyboardButtonRequestPoll &>(obj));
+        return true;
+      }
+      break;
+    case 431:
+      if (constructor == chatBannedRights::ID) {
+        func(static_cast<chatBannedRights &>(obj));
+        return true;
+      }
+      break;
+    case 436:
+      if (constructor == updateMessagePollVote::ID) {
+        func(static_cast<updateMessagePollVote &>(obj));
+        return true;
+      }
+      if (constructor == messages_exportedChatInvite::ID) {
+        func(static_cast<messages_exportedChatInvite &>(obj));
+        return true;
+      }
+      break;
+    case 437:
+      if (constructor == storage_fileMp4::ID) {
+        func(static_cast<storage_fileMp4 &>(obj));
+        return true;
+      }
+      break;
+    case 438:
+      if (constructor == inputCheckPasswordSRP::ID) {
+        func(static_cast<inputCheckPasswordSRP &>(obj));
+        return true;
+      }
+      break;
+    case 439:
+      if (constructor == textItalic::ID) {
+        func(static_cast<textItalic &>(obj));
+        return true;
+      }
+      break;
+    case 442:
+      if (constructor == account_tmpPassword::ID) {
+        func(static_cast<account_tmpPassword &>(obj));
+        return true;
+      }
+      break;
+    case 448:
+      if (constructor == messageActionEmpty::ID) {
+        func(static_cast<messageActionEmpty &>(obj));
+        return true;
+      }
+      break;
+    case 456:
+      if (constructor == inputBotInlineMessageMediaInvoice::ID) {
+        func(static_cast<inputBotInlineMessageMediaInvoice &>(obj));
+        return true;
+      }
+      break;
+    case 459:
+      if (constructor == inputChannelEmpty::ID) {
+        func(static_cast<inputChannelEmpty &>(obj));
+        return true;
+      }
+      if (constructor == help_configSimple::ID) {
+        func(static_cast<help_configSimple &>(obj));
+        return true;
+      }
+      break;
+    case 465:
+      if (constructor == auth_codeTypeMissedCall::ID) {
+        func(static_cast<auth_codeTypeMissedCall &>(obj));
+        return true;
+      }
+      break;
+    case 468:
+      if (constructor == pageBlockAuthorDate::ID) {
+        func(static_cast<pageBlockAuthorDate &>(obj));
+        return true;
+      }
+      if (constructor == updateSavedGifs::ID) {
+        func(static_cast<updateSavedGifs &>(obj));
+        return true;
+      }
+      break;
+    case 474:
+      if (constructor == messageActionChatMigrateTo::ID) {
+        func(static_cast<messageActionChatMigrateTo &>(obj));
+        return true;
+      }
+      break;
+    case 475:
+      if (constructor == updatesTooLong::ID) {
+        func(static_cast<updatesTooLong &>(obj));
+        return true;
+      }
+      break;
+    case 478:
+      if (constructor == messageMediaContact::ID) {
+        func(static_cast<messageMediaContact &>(obj));
+        return true;
+      }
+      break;
+    case 485:
+      if (constructor == messages_messageViews::ID) {
+        func(static_cast<messages_messageViews &>(obj));
+        return true;
+      }
+      break;
+    case 496:
+      if (constructor == inputMediaDocumentExternal::ID) {
+        func(static_cast<inputMediaDocumentExternal &>(obj));
+        return true;
+      }
+      break;
+    case 497:
+      if (constructor == secureValueTypeEmail::ID) {
+        func(static_cast<secureValueTypeEmail &>(obj));
+        return true;
+      }
+      if (constructor == messages_favedStickersNotModified::ID) {
+        func(static_cast<messages_favedStickersNotModified &>(obj));
+        return true;
+      }
+      break;
+    case 498:
+      if (constructor == documentAttributeHasStickers::ID) {
+        func(static_cast<documentAttributeHasStickers &>(obj));
+        return true;
+      }
+      break;
+    case 499:
+      if (constructor == botInlineMessageMediaInvoice::ID) {
+        func(static_cast<botInlineMessageMediaInvoice &>(obj));
+        return true;
+      }
+      if (constructor == storage_fileMov::ID) {
+        func(static_cast<storage_fileMov &>(obj));
+        return true;
+      }
+      break;
+    case 501:
+      if (constructor == inputNotifyPeer::ID) {
+        func(static_cast<inputNotifyPeer &>(obj));
+        return true;
+      }
+      break;
+    case 502:
+      if (constructor == updateChatUserTyping::ID) {
+        func(static_cast<updateChatUserTyping &>(obj));
+        return true;
+      }
+      if (constructor == messages_historyImportParsed::ID) {
+        func(static_cast<messages_historyImportParsed &>(obj));
+        return true;
+      }
+      break;
+    case 504:
+      if (constructor == wallPaper::ID) {
+        func(static_cast<wallPaper &>(obj));
+        return true;
+      }
+      break;
+    case 505:
+      if (constructor == chatParticipant::ID) {
+        func(static_cast<chatParticipant &>(obj));
+        return true;
+      }
+      break;
+    case 508:
+      if (constructor == account_password::ID) {
+        func(static_cast<account_password &>(obj));
+        return true;
+      }
+      break;
+    case 514:
+      if (constructor == updates::ID) {
+        func(static_cast<updates &>(obj));
+        return true;
+      }
+      break;
+    case 515:
+      if (constructor == userFull::ID) {
+        func(static_cast<userFull &>(obj));
+        return true;
+      }
+      break;
+    case 518:
+      if (constructor == users_userFull::ID) {
+        func(static_cast<users_userFull &>(obj));
+        return true;
+      }
+      break;
+    case 522:
+      if (constructor == pageTableRow::ID) {
+        func(static_cast<pageTableRow &>(obj));
+        return true;
+      }
+      if (constructor == sendMessageUploadRoundAction::ID) {
+        func(static_cast<sendMessageUploadRoundAction &>(obj));
+        return true;
+      }
+      break;
+    case 523:
+      if (constructor == statsGroupTopAdmin::ID) {
+        func(static_cast<statsGroupTopAdmin &>(obj));
+        return true;
+      }
+      break;
+    case 524:
+      if (constructor == inputUserEmpty::ID) {
+        func(static_cast<inputUserEmpty &>(obj));
+        return true;
+      }
+      break;
+    case 525:
+      if (constructor == botCommandScopePeer::ID) {
+        func(static_cast<botCommandScopePeer &>(obj));
+        return true;
+      }
+      if (constructor == recentMeUrlChat::ID) {
+        func(static_cast<recentMeUrlChat &>(obj));
+        return true;
+      }
+      break;
+    case 526:
+      if (constructor == folderPeer::ID) {
+        func(static_cast<folderPeer &>(obj));
+        return true;
+      }
+      break;
+    case 528:
+      if (constructor == config::ID) {
+        func(static_cast<config &>(obj));
+        return true;
+      }
+      break;
+    case 529:
+      if (constructor == userStatusOffline::ID) {
+        func(static_cast<userStatusOffline &>(obj));
+        return true;
+      }
+      if (constructor == contacts_topPeersDisabled::ID) {
+        func(static_cast<contacts_topPeersDisabled &>(obj));
+        return true;
+      }
+      break;
+    case 531:
+      if (constructor == chatPhoto::ID) {
+        func(static_cast<chatPhoto &>(obj));
+        return true;
+      }
+      break;
+    case 532:
+      if (constructor == sendMessageUploadVideoAction::ID) {
+        func(static_cast<sendMessageUploadVideoAction &>(obj));
+        return true;
+      }
+      if (constructor == topPeerCategoryPeers::ID) {
+        func(static_cast<topPeerCategoryPeers &>(obj));
+        return true;
+      }
+      break;
+    case 534:
+      if (constructor == channelAdminLogEventActionParticipantMute::ID) {
+        func(static_cast<channelAdminLogEventActionParticipantMute &>(obj));
+        return true;
+      }
+      if (constructor == messages_archivedStickers::ID) {
+        func(static_cast<messages_archivedStickers &>(obj));
+        return true;
+      }
+      break;
+    case 541:
+      if (constructor == messageMediaEmpty::ID) {
+        func(static_cast<messageMediaEmpty &>(obj));
+        return true;
+      }
+      break;
+    case 546:
+      if (constructor == messageEntityUnderline::ID) {
+        func(static_cast<messageEntityUnderline &>(obj));
+        return true;
+      }
+      break;
+    case 548:
+      if (constructor == document::ID) {
+        func(static_cast<document &>(obj));
+        return true;
+      }
+      break;
+    case 549:
+      if (constructor == botInlineMessageMediaGeo::ID) {
+        func(static_cast<botInlineMessageMediaGeo &>(obj));
+        return true;
+      }
+      break;
+    case 554:
+      if (constructor == messages_recentStickersNotModified::ID) {
+        func(static_cast<messages_recentStickersNotModified &>(obj));
+        return true;
+      }
+      break;
+    case 557:
+      if (constructor == inputMessagesFilterRoundVideo::ID) {
+        func(static_cast<inputMessagesFilterRoundVideo &>(obj));
+        return true;
+      }
+      break;
+    case 558:
+      if (constructor == inputPeerUser::ID) {
+        func(static_cast<inputPeerUser &>(obj));
+        return true;
+      }
+      break;
+    case 559:
+      if (constructor == help_appUpdate::ID) {
+        func(static_cast<help_appUpdate &>(obj));
+        return true;
+      }
+      break;
+    case 561:
+      if (constructor == phoneCallDiscardReasonDisconnect::ID) {
+        func(static_cast<phoneCallDiscardReasonDisconnect &>(obj));
+        return true;
+      }
+      break;
+    case 562:
+      if (constructor == encryptedMessage::ID) {
+        func(static_cast<encryptedMessage &>(obj));
+        return true;
+      }
+      break;
+    case 563:
+      if (constructor == messages_channelMessages::ID) {
+        func(static_cast<messages_channelMessages &>(obj));
+        return true;
+      }
+      break;
+    case 566:
+      if (constructor == channelAdminLogEventActionParticipantJoinByRequest::ID) {
+        func(static_cast<channelAdminLogEventActionParticipantJoinByRequest &>(obj));
+        return true;
+      }
+      if (constructor == updateEncryptedMessagesRead::ID) {
+        func(static_cast<updateEncryptedMessagesRead &>(obj));
+        return true;
+      }
+      break;
+    case 569:
+      if (constructor == textAnchor::ID) {
+        func(static_cast<textAnchor &>(obj));
+        return true;
+      }
+      break;
+    case 570:
+      if (constructor == pageBlockEmbed::ID) {
+        func(static_cast<pageBlockEmbed &>(obj));
+        return true;
+      }
+      break;
+    case 571:
+      if (constructor == updateChatParticipantAdd::ID) {
+        func(static_cast<updateChatParticipantAdd &>(obj));
+        return true;
+      }
+      break;
+    case 573:
+      if (constructor == channelAdminLogEventActionExportedInviteDelete::ID) {
+        func(static_cast<channelAdminLogEventActionExportedInviteDelete &>(obj));
+        return true;
+      }
+      break;
+    case 574:
+      if (constructor == chat::ID) {
+        func(static_cast<chat &>(obj));
+        return true;
+      }
+      break;
+    case 581:
+      if (constructor == messagePeerReaction::ID) {
+        func(static_cast<messagePeerReaction &>(obj));
+        return true;
+      }
+      break;
+    case 582:
+      if (constructor == contacts_resolvedPeer::ID) {
+        func(static_cast<contacts_resolvedPeer &>(obj));
+        return true;
+      }
+      break;
+    case 583:
+      if (constructor == messageActionChatDeleteUser::ID) {
+        func(static_cast<messageActionChatDeleteUser &>(obj));
+        return true;
+      }
+      break;
+    case 590:
+      if (constructor == updatePtsChanged::ID) {
+        func(static_cast<updatePtsChanged &>(obj));
+        return true;
+      }
+      break;
+    case 592:
+      if (constructor == inputMessagesFilterGeo::ID) {
+        func(static_cast<inputMessagesFilterGeo &>(obj));
+        return true;
+      }
+      break;
+    case 593:
+      if (constructor == channelAdminLogEventActionUpdatePinned::ID) {
+        func(static_cast<channelAdminLogEventActionUpdatePinned &>(obj));
+        return true;
+      }
+      break;
+    case 594:
+      if (constructor == contacts_topPeers::ID) {
+        func(static_cast<contacts_topPeers &>(obj));
+        return true;
+      }
+      break;
+    case 598:
+      if (constructor == updateNewStickerSet::ID) {
+        func(static_cast<updateNewStickerSet &>(obj));
+        return true;
+      }
+      break;
+    case 599:
+      if (constructor == messageReplyHeader::ID) {
+        func(static_cast<messageReplyHeader &>(obj));
+        return true;
+      }
+      if (constructor == privacyValueDisallowContacts::ID) {
+        func(static_cast<privacyValueDisallowContacts &>(obj));
+        return true;
+      }
+      break;
+    case 601:
+      if (constructor == cdnPublicKey::ID) {
+        func(static_cast<cdnPublicKey &>(obj));
+        return true;
+      }
+      break;
+    case 602:
+      if (constructor == updateBotPrecheckoutQuery::ID) {
+        func(static_cast<updateBotPrecheckoutQuery &>(obj));
+        return true;
+      }
+      break;
+    case 604:
+      if (constructor == inputChannel::ID) {
+        func(static_cast<inputChannel &>(obj));
+        return true;
+      }
+      if (constructor == secureValueErrorFrontSide::ID) {
+        func(static_cast<secureValueErrorFrontSide &>(obj));
+        return true;
+      }
+      break;
+    case 607:
+      if (constructor == updateReadHistoryInbox::ID) {
+        func(static_cast<updateReadHistoryInbox &>(obj));
+        return true;
+      }
+      break;
+    case 611:
+      if (constructor == inputPaymentCredentialsApplePay::ID) {
+        func(static_cast<inputPaymentCredentialsApplePay &>(obj));
+        return true;
+      }
+      if (constructor == messages_affectedMessages::ID) {
+        func(static_cast<messages_affectedMessages &>(obj));
+        return true;
+      }
+      break;
+    case 613:
+      if (constructor == sendMessageRecordRoundAction::ID) {
+        func(static_cast<sendMessageRecordRoundAction &>(obj));
+        return true;
+      }
+      break;
+    case 618:
+      if (constructor == updateEditMessage::ID) {
+        func(static_cast<updateEditMessage &>(obj));
+        return true;
+      }
+      break;
+    case 619:
+      if (constructor == channelParticipantsRecent::ID) {
+        func(static_cast<channelParticipantsRecent &>(obj));
+        return true;
+      }
+      break;
+    case 620:
+      if (constructor == updateDeleteChannelMessages::ID) {
+        func(static_cast<updateDeleteChannelMessages &>(obj));
+        return true;
+      }
+      break;
+    case 622:
+      if (constructor == help_recentMeUrls::ID) {
+        func(static_cast<help_recentMeUrls &>(obj));
+        return true;
+      }
+      break;
+    case 624:
+      if (constructor == highScore::ID) {
+        func(static_cast<highScore &>(obj));
+        return true;
+      }
+      break;
+    case 626:
+      if (constructor == updateNewEncryptedMessage::ID) {
+        func(static_cast<updateNewEncryptedMessage &>(obj));
+        return true;
+      }
+      break;
+    case 627:
+      if (constructor == messageMediaGeo::ID) {
+        func(static_cast<messageMediaGeo &>(obj));
+        return true;
+      }
+      if (constructor == securePlainPhone::ID) {
+        func(static_cast<securePlainPhone &>(obj));
+        return true;
+      }
+      break;
+    case 628:
+      if (constructor == messageActionSetChatTheme::ID) {
+        func(static_cast<messageActionSetChatTheme &>(obj));
+        return true;
+      }
+      if (constructor == page::ID) {
+        func(static_cast<page &>(obj));
+        return true;
+      }
+      break;
+    case 630:
+      if (constructor == inputWebFileLocation::ID) {
+        func(static_cast<inputWebFileLocation &>(obj));
+        return true;
+      }
+      break;
+    case 632:
+      if (constructor == botInlineMessageText::ID) {
+        func(static_cast<botInlineMessageText &>(obj));
+        return true;
+      }
+      break;
+    case 634:
+      if (constructor == inputMessagesFilterUrl::ID) {
+        func(static_cast<inputMessagesFilterUrl &>(obj));
+        return true;
+      }
+      break;
+    case 636:
+      if (constructor == updateMessagePoll::ID) {
+        func(static_cast<updateMessagePoll &>(obj));
+        return true;
+      }
+      break;
+    case 637:
+      if (constructor == help_termsOfServiceUpdateEmpty::ID) {
+        func(static_cast<help_termsOfServiceUpdateEmpty &>(obj));
+        return true;
+      }
+      break;
+    case 640:
+      if (constructor == help_support::ID) {
+        func(static_cast<help_support &>(obj));
+        return true;
+      }
+      break;
+    case 642:
+      if (constructor == channelMessagesFilter::ID) {
+        func(static_cast<channelMessagesFilter &>(obj));
+        return true;
+      }
+      if (constructor == updateStickerSets::ID) {
+        func(static_cast<updateStickerSets &>(obj));
+        return true;
+      }
+      break;
+    case 643:
+      if (constructor == inputBotInlineMessageText::ID) {
+        func(static_cast<inputBotInlineMessageText &>(obj));
+        return true;
+      }
+      break;
+    case 644:
+      if (constructor == inputPrivacyValueAllowUsers::ID) {
+        func(static_cast<inputPrivacyValueAllowUsers &>(obj));
+        return true;
+      }
+      if (constructor == updates_state::ID) {
+        func(static_cast<updates_state &>(obj));
+        return true;
+      }
+      break;
+    case 646:
+      if (constructor == pageBlockSubtitle::ID) {
+        func(static_cast<pageBlockSubtitle &>(obj));
+        return true;
+      }
+      break;
+    case 647:
+      if (constructor == inlineQueryPeerTypePM::ID) {
+        func(static_cast<inlineQueryPeerTypePM &>(obj));
+        return true;
+      }
+      if (constructor == peerNotifySettings::ID) {
+        func(static_cast<peerNotifySettings &>(obj));
+        return true;
+      }
+      break;
+    case 653:
+      if (constructor == messageReplies::ID) {
+        func(static_cast<messageReplies &>(obj));
+        return true;
+      }
+      break;
+    case 655:
+      if (constructor == textMarked::ID) {
+        func(static_cast<textMarked &>(obj));
+        return true;
+      }
+      break;
+    case 665:
+      if (constructor == replyKeyboardMarkup::ID) {
+        func(static_cast<replyKeyboardMarkup &>(obj));
+        return true;
+      }
+      break;
+    case 669:
+      if (constructor == statsURL::ID) {
+        func(static_cast<statsURL &>(obj));
+        return true;
+      }
+      break;
+    case 673:
+      if (constructor == payments_validatedRequestedInfo::ID) {
+        func(static_cast<payments_validatedRequestedInfo &>(obj));
+        return true;
+      }
+      break;
+    case 674:
+      if (constructor == storage_filePdf::ID) {
+        func(static_cast<storage_filePdf &>(obj));
+        return true;
+      }
+      break;
+    case 678:
+      if (constructor == storage_fileUnknown::ID) {
+        func(static_cast<storage_fileUnknown &>(obj));
+        return true;
+      }
+      break;
+    case 681:
+      if (constructor == inputPrivacyKeyAddedByPhone::ID) {
+        func(static_cast<inputPrivacyKeyAddedByPhone &>(obj));
+        return true;
+      }
+      break;
+    case 684:
+      if (constructor == inputWallPaperSlug::ID) {
+        func(static_cast<inputWallPaperSlug &>(obj));
+        return true;
+      }
+      break;
+    case 685:
+      if (constructor == availableReaction::ID) {
+        func(static_cast<availableReaction &>(obj));
+        return true;
+      }
+      if (constructor == photos_photo::ID) {
+        func(static_cast<photos_photo &>(obj));
+        return true;
+      }
+      break;
+    case 687:
+      if (constructor == updateBotShippingQuery::ID) {
+        func(static_cast<updateBotShippingQuery &>(obj));
+        return true;
+      }
+      break;
+    case 688:
+      if (constructor == encryptedChatWaiting::ID) {
+        func(static_cast<encryptedChatWaiting &>(obj));
+        return true;
+      }
+      break;
+    case 690:
+      if (constructor == inputMediaDice::ID) {
+        func(static_cast<inputMediaDice &>(obj));
+        return true;
+      }
+      if (constructor == messages_chatsSlice::ID) {
+        func(static_cast<messages_chatsSlice &>(obj));
+        return true;
+      }
+      break;
+    case 691:
+      if (constructor == passwordKdfAlgoUnknown::ID) {
+        func(static_cast<passwordKdfAlgoUnknown &>(obj));
+        return true;
+      }
+      break;
+    case 700:
+      if (constructor == notifyPeer::ID) {
+        func(static_cast<notifyPeer &>(obj));
+        return true;
+      }
+      if (constructor == notifyChats::ID) {
+        func(static_cast<notifyChats &>(obj));
+        return true;
+      }
+      break;
+    case 704:
+      if (constructor == documentAttributeImageSize::ID) {
+        func(static_cast<documentAttributeImageSize &>(obj));
+        return true;
+      }
+      if (constructor == messageEntityItalic::ID) {
+        func(static_cast<messageEntityItalic &>(obj));
+        return true;
+      }
+      break;
+    case 707:
+      if (constructor == messages_exportedChatInviteReplaced::ID) {
+        func(static_cast<messages_exportedChatInviteReplaced &>(obj));
+        return true;
+      }
+      break;
+    case 709:
+      if (constructor == inputEncryptedFileLocation::ID) {
+        func(static_cast<inputEncryptedFileLocation &>(obj));
+        return true;
+      }
+      break;
+    case 710:
+      if (constructor == auth_sentCodeTypeApp::ID) {
+        func(static_cast<auth_sentCodeTypeApp &>(obj));
+        return true;
+      }
+      if (constructor == messages_messagesSlice::ID) {
+        func(static_cast<messages_messagesSlice &>(obj));
+        return true;
+      }
+      break;
+    case 711:
+      if (constructor == pageBlockEmbedPost::ID) {
+        func(static_cast<pageBlockEmbedPost &>(obj));
+        return true;
+      }
+      break;
+    case 719:
+      if (constructor == auth_sentCode::ID) {
+        func(static_cast<auth_sentCode &>(obj));
+        return true;
+      }
+      break;
+    case 721:
+      if (constructor == updateShortSentMessage::ID) {
+        func(static_cast<updateShortSentMessage &>(obj));
+        return true;
+      }
+      break;
+    case 725:
+      if (constructor == notifyUsers::ID) {
+        func(static_cast<notifyUsers &>(obj));
+        return true;
+      }
+      break;
+    case 726:
+      if (constructor == updateGroupCallParticipants::ID) {
+        func(static_cast<updateGroupCallParticipants &>(obj));
+        return true;
+      }
+      break;
+    case 727:
+      if (constructor == inputTheme::ID) {
+        func(static_cast<inputTheme &>(obj));
+        return true;
+      }
+      break;
+    case 730:
+      if (constructor == channelAdminLogEventActionChangeLocation::ID) {
+        func(static_cast<channelAdminLogEventActionChangeLocation &>(obj));
+        return true;
+      }
+      if (constructor == secureValueTypeBankStatement::ID) {
+        func(static_cast<secureValueTypeBankStatement &>(obj));
+        return true;
+      }
+      if (constructor == updateUserName::ID) {
+        func(static_cast<updateUserName &>(obj));
+        return true;
+      }
+      break;
+    case 731:
+      if (constructor == messageActionPinMessage::ID) {
+        func(static_cast<messageActionPinMessage &>(obj));
+        return true;
+      }
+      break;
+    case 732:
+      if (constructor == phone_groupParticipants::ID) {
+        func(static_cast<phone_groupParticipants &>(obj));
+        return true;
+      }
+      break;
+    case 735:
+      if (constructor == messageActionChatEditTitle::ID) {
+        func(static_cast<messageActionChatEditTitle &>(obj));
+        return true;
+      }
+      break;
+    case 739:
+      if (constructor == messages_stickerSetNotModified::ID) {
+        func(static_cast<messages_stickerSetNotModified &>(obj));
+        return true;
+      }
+      break;
+    case 742:
+      if (constructor == updateShortChatMessage::ID) {
+        func(static_cast<updateShortChatMessage &>(obj));
+        return true;
+      }
+      if (constructor == auth_passwordRecovery::ID) {
+        func(static_cast<auth_passwordRecovery &>(obj));
+        return true;
+      }
+      break;
+    case 750:
+      if (constructor == keyboardButtonBuy::ID) {
+        func(static_cast<keyboardButtonBuy &>(obj));
+        return true;
+      }
+      break;
+    case 753:
+      if (constructor == channelParticipant::ID) {
+        func(static_cast<channelParticipant &>(obj));
+        return true;
+      }
+      break;
+    case 757:
+      if (constructor == updatePhoneCall::ID) {
+        func(static_cast<updatePhoneCall &>(obj));
+        return true;
+      }
+      break;
+    case 758:
+      if (constructor == statsGroupTopPoster::ID) {
+        func(static_cast<statsGroupTopPoster &>(obj));
+        return true;
+      }
+      break;
+    case 768:
+      if (constructor == messageActionChannelCreate::ID) {
+        func(static_cast<messageActionChannelCreate &>(obj));
+        return true;
+      }
+      if (constructor == secureValueErrorFile::ID) {
+        func(static_cast<secureValueErrorFile &>(obj));
+        return true;
+      }
+      break;
+    case 772:
+      if (constructor == inputPeerNotifySettings::ID) {
+        func(static_cast<inputPeerNotifySettings &>(obj));
+        return true;
+      }
+      break;
+    case 774:
+      if (constructor == keyboardButtonUserProfile::ID) {
+        func(static_cast<keyboardButtonUserProfile &>(obj));
+        return true;
+      }
+      break;
+    case 775:
+      if (constructor == textFixed::ID) {
+        func(static_cast<textFixed &>(obj));
+        return true;
+      }
+      break;
+    case 792:
+      if (constructor == replyKeyboardHide::ID) {
+        func(static_cast<replyKeyboardHide &>(obj));
+        return true;
+      }
+      break;
+    case 797:
+      if (constructor == messageActionGameScore::ID) {
+        func(static_cast<messageActionGameScore &>(obj));
+        return true;
+      }
+      if (constructor == updateLoginToken::ID) {
+        func(static_cast<updateLoginToken &>(obj));
+        return true;
+      }
+      break;
+    case 798:
+      if (constructor == updateChannel::ID) {
+        func(static_cast<updateChannel &>(obj));
+        return true;
+      }
+      break;
+    case 800:
+      if (constructor == phoneCallDiscarded::ID) {
+        func(static_cast<phoneCallDiscarded &>(obj));
+        return true;
+      }
+      break;
+    case 803:
+      if (constructor == phoneCallDiscardReasonMissed::ID) {
+        func(static_cast<phoneCallDiscardReasonMissed &>(obj));
+        return true;
+      }
+      if (constructor == sendMessageGamePlayAction::ID) {
+        func(static_cast<sendMessageGamePlayAction &>(obj));
+        return true;
+      }
+      break;
+    case 804:
+      if (constructor == upload_fileCdnRedirect::ID) {
+        func(static_cast<upload_fileCdnRedirect &>(obj));
+        return true;
+      }
+      break;
+    case 806:
+      if (constructor == help_countriesListNotModified::ID) {
+        func(static_cast<help_countriesListNotModified &>(obj));
+        return true;
+      }
+      break;
+    case 807:
+      if (constructor == inputPrivacyKeyProfilePhoto::ID) {
+        func(static_cast<inputPrivacyKeyProfilePhoto &>(obj));
+        return true;
+      }
+      break;
+    case 810:
+      if (constructor == documentAttributeAudio::ID) {
+        func(static_cast<documentAttributeAudio &>(obj));
+        return true;
+      }
+      break;
+    case 818:
+      if (constructor == poll::ID) {
+        func(static_cast<poll &>(obj));
+        return true;
+      }
+      if (constructor == secureValueErrorSelfie::ID) {
+        func(static_cast<secureValueErrorSelfie &>(obj));
+        return true;
+      }
+      break;
+    case 823:
+      if (constructor == payments_savedInfo::ID) {
+        func(static_cast<payments_savedInfo &>(obj));
+        return true;
+      }
+      break;
+    case 824:
+      if (constructor == inputThemeSettings::ID) {
+        func(static_cast<inputThemeSettings &>(obj));
+        return true;
+      }
+      break;
+    case 829:
+      if (constructor == updateShortMessage::ID) {
+        func(static_cast<updateShortMessage &>(obj));
+        return true;
+      }
+      break;
+    case 831:
+      if (constructor == dialogPeerFolder::ID) {
+        func(static_cast<dialogPeerFolder &>(obj));
+        return true;
+      }
+      break;
+    case 832:
+      if (constructor == peerLocated::ID) {
+        func(static_cast<peerLocated &>(obj));
+        return true;
+      }
+      break;
+    case 834:
+      if (constructor == updateBotStopped::ID) {
+        func(static_cast<updateBotStopped &>(obj));
+        return true;
+      }
+      break;
+    case 835:
+      if (constructor == updateChannelReadMessagesContents::ID) {
+        func(static_cast<updateChannelReadMessagesContents &>(obj));
+        return true;
+      }
+      break;
+    case 840:
+      if (constructor == updateBotCommands::ID) {
+        func(static_cast<updateBotCommands &>(obj));
+        return true;
+      }
+      break;
+    case 841:
+      if (constructor == inputMessageEntityMentionName::ID) {
+        func(static_cast<inputMessageEntityMentionName &>(obj));
+        return true;
+      }
+      break;
+    case 845:
+      if (constructor == channelAdminLogEventActionDiscardGroupCall::ID) {
+        func(static_cast<channelAdminLogEventActionDiscardGroupCall &>(obj));
+        return true;
+      }
+      if (constructor == messages_featuredStickers::ID) {
+        func(static_cast<messages_featuredStickers &>(obj));
+        return true;
+      }
+      break;
+    case 850:
+      if (constructor == invoice::ID) {
+        func(static_cast<invoice &>(obj));
+        return true;
+      }
+      if (constructor == updateBotInlineQuery::ID) {
+        func(static_cast<updateBotInlineQuery &>(obj));
+        return true;
+      }
+      break;
+    case 853:
+      if (constructor == baseThemeArctic::ID) {
+        func(static_cast<baseThemeArctic &>(obj));
+        return true;
+      }
+      break;
+    case 854:
+      if (constructor == chatInviteImporter::ID) {
+        func(static_cast<chatInviteImporter &>(obj));
+        return true;
+      }
+      break;
+    case 855:
+      if (constructor == channelAdminLogEventActionChangeAvailableReactions::ID) {
+        func(static_cast<channelAdminLogEventActionChangeAvailableReactions &>(obj));
+        return true;
+      }
+      break;
+    case 858:
+      if (constructor == updateBotInlineSend::ID) {
+        func(static_cast<updateBotInlineSend &>(obj));
+        return true;
+      }
+      break;
+    case 859:
+      if (constructor == draftMessage::ID) {
+        func(static_cast<draftMessage &>(obj));
+        return true;
+      }
+      break;
+    case 861:
+      if (constructor == upload_file::ID) {
+        func(static_cast<upload_file &>(obj));
+        return true;
+      }
+      break;
+    case 862:
+      if (constructor == channelAdminLogEventActionParticipantToggleBan::ID) {
+        func(static_cast<channelAdminLogEventActionParticipantToggleBan &>(obj));
+        return true;
+      }
+      break;
+    case 869:
+      if (constructor == securePasswordKdfAlgoUnknown::ID) {
+        func(static_cast<securePasswordKdfAlgoUnknown &>(obj));
+        return true;
+      }
+      break;
+    case 871:
+      if (constructor == inputMessagesFilterPhotos::ID) {
+        func(static_cast<inputMessagesFilterPhotos &>(obj));
+        return true;
+      }
+      if (constructor == phone_phoneCall::ID) {
+        func(static_cast<phone_phoneCall &>(obj));
+        return true;
+      }
+      break;
+    case 878:
+      if (constructor == pageBlockFooter::ID) {
+        func(static_cast<pageBlockFooter &>(obj));
+        return true;
+      }
+      break;
+    case 885:
+      if (constructor == jsonNumber::ID) {
+        func(static_cast<jsonNumber &>(obj));
+        return true;
+      }
+      break;
+    case 889:
+      if (constructor == urlAuthResultDefault::ID) {
+        func(static_cast<urlAuthResultDefault &>(obj));
+        return true;
+      }
+      break;
+    case 892:
+      if (constructor == updateChannelAvailableMessages::ID) {
+        func(static_cast<updateChannelAvailableMessages &>(obj));
+        return true;
+      }
+      break;
+    case 893:
+      if (constructor == webPagePending::ID) {
+        func(static_cast<webPagePending &>(obj));
+        return true;
+      }
+      break;
+    case 894:
+      if (constructor == secureValueTypePassportRegistration::ID) {
+        func(static_cast<secureValueTypePassportRegistration &>(obj));
+        return true;
+      }
+      if (constructor == messages_searchResultsPositions::ID) {
+        func(static_cast<messages_searchResultsPositions &>(obj));
+        return true;
+      }
+      break;
+    case 898:
+      if (constructor == photoCachedSize::ID) {
+        func(static_cast<photoCachedSize &>(obj));
+        return true;
+      }
+      break;
+    case 899:
+      if (constructor == account_passwordSettings::ID) {
+        func(static_cast<account_passwordSettings &>(obj));
+        return true;
+      }
+      break;
+    case 902:
+      if (constructor == messages_chatAdminsWithInvites::ID) {
+        func(static_cast<messages_chatAdminsWithInvites &>(obj));
+        return true;
+      }
+      break;
+    case 904:
+      if (constructor == cdnConfig::ID) {
+        func(static_cast<cdnConfig &>(obj));
+        return true;
+      }
+      break;
+    case 905:
+      if (constructor == messageActionChannelMigrateFrom::ID) {
+        func(static_cast<messageActionChannelMigrateFrom &>(obj));
+        return true;
+      }
+      break;
+    case 906:
+      if (constructor == inputMediaGeoPoint::ID) {
+        func(static_cast<inputMediaGeoPoint &>(obj));
+        return true;
+      }
+      if (constructor == contacts_blocked::ID) {
+        func(static_cast<contacts_blocked &>(obj));
+        return true;
+      }
+      break;
+    case 909:
+      if (constructor == chatInviteExported::ID) {
+        func(static_cast<chatInviteExported &>(obj));
+        return true;
+      }
+      break;
+    case 911:
+      if (constructor == inputMediaDocument::ID) {
+        func(static_cast<inputMediaDocument &>(obj));
+        return true;
+      }
+      if (constructor == messages_searchResultsCalendar::ID) {
+        func(static_cast<messages_searchResultsCalendar &>(obj));
+        return true;
+      }
+      break;
+    case 914:
+      if (constructor == encryptedChatRequested::ID) {
+        func(static_cast<encryptedChatRequested &>(obj));
+        return true;
+      }
+      break;
+    case 919:
+      if (constructor == channelAdminLogEventActionSendMessage::ID) {
+        func(static_cast<channelAdminLogEventActionSendMessage &>(obj));
+        return true;
+      }
+      if (constructor == secureValueTypePassport::ID) {
+        func(static_cast<secureValueTypePassport &>(obj));
+        return true;
+      }
+      break;
+    case 921:
+      if (constructor == secureValueTypeIdentityCard::ID) {
+        func(static_cast<secureValueTypeIdentityCard &>(obj));
+        return true;
+      }
+      break;
+    case 925:
+      if (constructor == inputMessagesFilterRoundVoice::ID) {
+        func(static_cast<inputMessagesFilterRoundVoice &>(obj));
+        return true;
+      }
+      break;
+    case 928:
+      if (constructor == updatePeerHistoryTTL::ID) {
+        func(static_cast<updatePeerHistoryTTL &>(obj));
+        return true;
+      }
+      break;
+    case 930:
+      if (constructor == inputStickerSetDice::ID) {
+        func(static_cast<inputStickerSetDice &>(obj));
+        return true;
+      }
+      break;
+    case 933:
+      if (constructor == userStatusLastWeek::ID) {
+        func(static_cast<userStatusLastWeek &>(obj));
+        return true;
+      }
+      break;
+    case 934:
+      if (constructor == updateFolderPeers::ID) {
+        func(static_cast<updateFolderPeers &>(obj));
+        return true;
+      }
+      break;
+    case 935:
+      if (constructor == stats_messageStats::ID) {
+        func(static_cast<stats_messageStats &>(obj));
+        return true;
+      }
+      break;
+    case 940:
+      if (constructor == sendMessageChooseContactAction::ID) {
+        func(static_cast<sendMessageChooseContactAction &>(obj));
+        return true;
+      }
+      break;
+    case 941:
+      if (constructor == secureRequiredType::ID) {
+        func(static_cast<secureRequiredType &>(obj));
+        return true;
+      }
+      break;
+    case 944:
+      if (constructor == notifyBroadcasts::ID) {
+        func(static_cast<notifyBroadcasts &>(obj));
+        return true;
+      }
+      if (constructor == account_resetPasswordRequestedWait::ID) {
+        func(static_cast<account_resetPasswordRequestedWait &>(obj));
+        return true;
+      }
+      break;
+    case 946:
+      if (constructor == bankCardOpenUrl::ID) {
+        func(static_cast<bankCardOpenUrl &>(obj));
+        return true;
+      }
+      break;
+    case 948:
+      if (constructor == help_passportConfig::ID) {
+        func(static_cast<help_passportConfig &>(obj));
+        return true;
+      }
+      break;
+    case 949:
+      if (constructor == privacyKeyPhoneP2P::ID) {
+        func(static_cast<privacyKeyPhoneP2P &>(obj));
+        return true;
+      }
+      break;
+    case 951:
+      if (constructor == messageActionPaymentSent::ID) {
+        func(static_cast<messageActionPaymentSent &>(obj));
+        return true;
+      }
+      break;
+    case 957:
+      if (constructor == inputMessagesFilterPhoneCalls::ID) {
+        func(static_cast<inputMessagesFilterPhoneCalls &>(obj));
+        return true;
+      }
+      break;
+    case 960:
+      if (constructor == inputPaymentCredentials::ID) {
+        func(static_cast<inputPaymentCredentials &>(obj));
+        return true;
+      }
+      break;
+    case 963:
+      if (constructor == messageActionGeoProximityReached::ID) {
+        func(static_cast<messageActionGeoProximityReached &>(obj));
+        return true;
+      }
+      if (constructor == passwordKdfAlgoSHA256SHA256PBKDF2HMACSHA512iter100000SHA256ModPow::ID) {
+        func(static_cast<passwordKdfAlgoSHA256SHA256PBKDF2HMACSHA512iter100000SHA256ModPow &>(obj));
+        return true;
+      }
+      break;
+    case 966:
+      if (constructor == ipPort::ID) {
+        func(static_cast<ipPort &>(obj));
+        return true;
+      }
+      break;
+    case 967:
+      if (constructor == phone_groupCall::ID) {
+        func(static_cast<phone_groupCall &>(obj));
+        return true;
+      }
+      break;
+    case 969:
+      if (constructor == stickerSetMultiCovered::ID) {
+        func(static_cast<stickerSetMultiCovered &>(obj));
+        return true;
+      }
+      break;
+    case 975:
+      if (constructor == messageActionChatCreate::ID) {
+        func(static_cast<messageActionChatCreate &>(obj));
+        return true;
+      }
+      break;
+    case 976:
+      if (constructor == secureValueErrorTranslationFiles::ID) {
+        func(static_cast<secureValueErrorTranslationFiles &>(obj));
+        return true;
+      }
+      break;
+    case 977:
+      if (constructor == messages_foundStickerSetsNotModified::ID) {
+        func(static_cast<messages_foundStickerSetsNotModified &>(obj));
+        return true;
+      }
+      break;
+    case 978:
+      if (constructor == inputChatPhotoEmpty::ID) {
+        func(static_cast<inputChatPhotoEmpty &>(obj));
+        return true;
+      }
+      if (constructor == webDocument::ID) {
+        func(static_cast<webDocument &>(obj));
+        return true;
+      }
+      break;
+    case 979:
+      if (constructor == sendMessageCancelAction::ID) {
+        func(static_cast<sendMessageCancelAction &>(obj));
+        return true;
+      }
+      break;
+    case 984:
+      if (constructor == labeledPrice::ID) {
+        func(static_cast<labeledPrice &>(obj));
+        return true;
+      }
+      break;
+    case 986:
+      if (constructor == photoEmpty::ID) {
+        func(static_cast<photoEmpty &>(obj));
+        return true;
+      }
+      break;
+    case 987:
+      if (constructor == channelAdminLogEventActionToggleSlowMode::ID) {
+        func(static_cast<channelAdminLogEventActionToggleSlowMode &>(obj));
+        return true;
+      }
+      if (constructor == secureValueTypePhone::ID) {
+        func(static_cast<secureValueTypePhone &>(obj));
+        return true;
+      }
+      break;
+    case 989:
+      if (constructor == botInlineMessageMediaAuto::ID) {
+        func(static_cast<botInlineMessageMediaAuto &>(obj));
+        return true;
+      }
+      break;
+    case 990:
+      if (constructor == auth_authorization::ID) {
+        func(static_cast<auth_authorization &>(obj));
+        return true;
+      }
+      break;
+    case 991:
+      if (constructor == photoPathSize::ID) {
+        func(static_cast<photoPathSize &>(obj));
+        return true;
+      }
+      break;
+    case 998:
+      if (constructor == emojiLanguage::ID) {
+        func(static_cast<emojiLanguage &>(obj));
+        return true;
+      }
+      break;
+    case 1000:
+      if (constructor == chatParticipantAdmin::ID) {
+        func(static_cast<chatParticipantAdmin &>(obj));
+        return true;
+      }
+      break;
+    case 1001:
+      if (constructor == help_deepLinkInfoEmpty::ID) {
+        func(static_cast<help_deepLinkInfoEmpty &>(obj));
+        return true;
+      }
+      if (constructor == messages_stickers::ID) {
+        func(static_cast<messages_stickers &>(obj));
+        return true;
+      }
+      break;
+    case 1002:
+      if (constructor == channelAdminLogEventActionParticipantLeave::ID) {
+        func(static_cast<channelAdminLogEventActionParticipantLeave &>(obj));
+        return true;
+      }
+      if (constructor == secureValueErrorReverseSide::ID) {
+        func(static_cast<secureValueErrorReverseSide &>(obj));
+        return true;
+      }
+      break;
+    case 1003:
+      if (constructor == urlAuthResultAccepted::ID) {
+        func(static_cast<urlAuthResultAccepted &>(obj));
+        return true;
+      }
+      break;
+    case 1004:
+      if (constructor == help_promoDataEmpty::ID) {
+        func(static_cast<help_promoDataEmpty &>(obj));
+        return true;
+      }
+      break;
+    case 1009:
+      if (constructor == pageBlockKicker::ID) {
+        func(static_cast<pageBlockKicker &>(obj));
+        return true;
+      }
+      break;
+    case 1012:
+      if (constructor == stickerSet::ID) {
+        func(static_cast<stickerSet &>(obj));
+        return true;
+      }
+      break;
+    case 1013:
+      if (constructor == emojiKeywordsDifference::ID) {
+        func(static_cast<emojiKeywordsDifference &>(obj));
+        return true;
+      }
+      break;
+    case 1014:
+      if (constructor == updateReadChannelDiscussionOutbox::ID) {
+        func(static_cast<updateReadChannelDiscussionOutbox &>(obj));
+        return true;
+      }
+      break;
+    case 1015:
+      if (constructor == messages_savedGifsNotModified::ID) {
+        func(static_cast<messages_savedGifsNotModified &>(obj));
+        return true;
+      }
+      break;
+    case 1016:
+      if (constructor == storage_fileWebp::ID) {
+        func(static_cast<storage_fileWebp &>(obj));
+        return true;
+      }
+      break;
+    case 1017:
+      if (constructor == paymentRequestedInfo::ID) {
+        func(static_cast<paymentRequestedInfo &>(obj));
+        return true;
+      }
+      break;
+    case 1018:
+      if (constructor == inputMessagesFilterVideo::ID) {
+        func(static_cast<inputMessagesFilterVideo &>(obj));
+        return true;
+      }
+      break;
+    case 1019:
+      if (constructor == inputEncryptedFileUploaded::ID) {
+        func(static_cast<inputEncryptedFileUploaded &>(obj));
+        return true;
+      }
+      if (constructor == messages_dialogs::ID) {
+        func(static_cast<messages_dialogs &>(obj));
+        return true;
+      }
+      break;
+    case 1021:
+      if (constructor == messages_featuredStickersNotModified::ID) {
+        func(static_cast<messages_featuredStickersNotModified &>(obj));
+        return true;
+      }
+      break;
+    case 1023:
+      if (constructor == channelParticipantBanned::ID) {
+        func(static_cast<channelParticipantBanned &>(obj));
+        return true;
+      }
+      break;
+    case 1024:
+      if (constructor == autoDownloadSettings::ID) {
+        func(static_cast<autoDownloadSettings &>(obj));
+        return true;
+      }
+      if (constructor == chatEmpty::ID) {
+        func(static_cast<chatEmpty &>(obj));
+        return true;
+      }
+      if (constructor == messageActionSetMessagesTTL::ID) {
+        func(static_cast<messageActionSetMessagesTTL &>(obj));
+        return true;
+      }
+      break;
+    case 1025:
+      if (constructor == inputPrivacyKeyPhoneCall::ID) {
+        func(static_cast<inputPrivacyKeyPhoneCall &>(obj));
+        return true;
+      }
+      if (constructor == sendMessageUploadPhotoAction::ID) {
+        func(static_cast<sendMessageUploadPhotoAction &>(obj));
+        return true;
+      }
+      break;
+    case 1026:
+      if (constructor == keyboardButtonUrlAuth::ID) {
+        func(static_cast<keyboardButtonUrlAuth &>(obj));
+        return true;
+      }
+      if (constructor == secureCredentialsEncrypted::ID) {
+        func(static_cast<secureCredentialsEncrypted &>(obj));
+        return true;
+      }
+      break;
+    case 1027:
+      if (constructor == userEmpty::ID) {
+        func(static_cast<userEmpty &>(obj));
+        return true;
+      }
+      if (constructor == storage_fileGif::ID) {
+        func(static_cast<storage_fileGif &>(obj));
+        return true;
+      }
+      break;
+    case 1034:
+      if (constructor == updates_differenceSlice::ID) {
+        func(static_cast<updates_differenceSlice &>(obj));
+        return true;
+      }
+      break;
+    case 1035:
+      if (constructor == messageActionSecureValuesSent::ID) {
+        func(static_cast<messageActionSecureValuesSent &>(obj));
+        return true;
+      }
+      break;
+    case 1037:
+      if (constructor == securePlainEmail::ID) {
+        func(static_cast<securePlainEmail &>(obj));
+        return true;
+      }
+      break;
+    case 1038:
+      if (constructor == botInlineResult::ID) {
+        func(static_cast<botInlineResult &>(obj));
+        return true;
+      }
+      break;
+    case 1043:
+      if (constructor == pageBlockSubheader::ID) {
+        func(static_cast<pageBlockSubheader &>(obj));
+        return true;
+      }
+      break;
+    case 1044:
+      if (constructor == messages_chatInviteImporters::ID) {
+        func(static_cast<messages_chatInviteImporters &>(obj));
+        return true;
+      }
+      if (constructor == upload_webFile::ID) {
+        func(static_cast<upload_webFile &>(obj));
+        return true;
+      }
+      break;
+    case 1054:
+      if (constructor == channelParticipantsContacts::ID) {
+        func(static_cast<channelParticipantsContacts &>(obj));
+        return true;
+      }
+      break;
+    case 1057:
+      if (constructor == recentMeUrlUser::ID) {
+        func(static_cast<recentMeUrlUser &>(obj));
+        return true;
+      }
+      break;
+    case 1058:
+      if (constructor == messageEntityMention::ID) {
+        func(static_cast<messageEntityMention &>(obj));
+        return true;
+      }
+      break;
+    case 1059:
+      if (constructor == channelMessagesFilterEmpty::ID) {
+        func(static_cast<channelMessagesFilterEmpty &>(obj));
+        return true;
+      }
+      break;
+    case 1061:
+      if (constructor == messages_sponsoredMessages::ID) {
+        func(static_cast<messages_sponsoredMessages &>(obj));
+        return true;
+      }
+      break;
+    case 1062:
+      if (constructor == messageActionChatAddUser::ID) {
+        func(static_cast<messageActionChatAddUser &>(obj));
+        return true;
+      }
+      if (constructor == pageBlockCover::ID) {
+        func(static_cast<pageBlockCover &>(obj));
+        return true;
+      }
+      if (constructor == topPeerCategoryCorrespondents::ID) {
+        func(static_cast<topPeerCategoryCorrespondents &>(obj));
+        return true;
+      }
+      break;
+    case 1064:
+      if (constructor == inputPhotoFileLocation::ID) {
+        func(static_cast<inputPhotoFileLocation &>(obj));
+        return true;
+      }
+      break;
+    case 1066:
+      if (constructor == messageReactions::ID) {
+        func(static_cast<messageReactions &>(obj));
+        return true;
+      }
+      if (constructor == userStatusEmpty::ID) {
+        func(static_cast<userStatusEmpty &>(obj));
+        return true;
+      }
+      break;
+    case 1067:
+      if (constructor == messageMediaGeoLive::ID) {
+        func(static_cast<messageMediaGeoLive &>(obj));
+        return true;
+      }
+      break;
+    case 1069:
+      if (constructor == updatePhoneCallSignalingData::ID) {
+        func(static_cast<updatePhoneCallSignalingData &>(obj));
+        return true;
+      }
+      break;
+    case 1070:
+      if (constructor == peerChannel::ID) {
+        func(static_cast<peerChannel &>(obj));
+        return true;
+      }
+      break;
+    case 1074:
+      if (constructor == messageEntityBankCard::ID) {
+        func(static_cast<messageEntityBankCard &>(obj));
+        return true;
+      }
+      break;
+    case 1075:
+      if (constructor == updatePinnedChannelMessages::ID) {
+        func(static_cast<updatePinnedChannelMessages &>(obj));
+        return true;
+      }
+      break;
+    case 1080:
+      if (constructor == secureValueTypeUtilityBill::ID) {
+        func(static_cast<secureValueTypeUtilityBill &>(obj));
+        return true;
+      }
+      if (constructor == messages_discussionMessage::ID) {
+        func(static_cast<messages_discussionMessage &>(obj));
+        return true;
+      }
+      break;
+    case 1084:
+      if (constructor == messageRange::ID) {
+        func(static_cast<messageRange &>(obj));
+        return true;
+      }
+      if (constructor == updates_channelDifference::ID) {
+        func(static_cast<updates_channelDifference &>(obj));
+        return true;
+      }
+      break;
+    case 1087:
+      if (constructor == inputEncryptedFile::ID) {
+        func(static_cast<inputEncryptedFile &>(obj));
+        return true;
+      }
+      break;
+    case 1089:
+      if (constructor == updatePeerSettings::ID) {
+        func(static_cast<updatePeerSettings &>(obj));
+        return true;
+      }
+      break;
+    case 1090:
+      if (constructor == channelAdminLogEventActionParticipantToggleAdmin::ID) {
+        func(static_cast<channelAdminLogEventActionParticipantToggleAdmin &>(obj));
+        return true;
+      }
+      break;
+    case 1091:
+      if (constructor == channelAdminLogEventActionChangeHistoryTTL::ID) {
+        func(static_cast<channelAdminLogEventActionChangeHistoryTTL &>(obj));
+        return true;
+      }
+      break;
+    case 1096:
+      if (constructor == messageEmpty::ID) {
+        func(static_cast<messageEmpty &>(obj));
+        return true;
+      }
+      break;
+    case 1097:
+      if (constructor == securePasswordKdfAlgoPBKDF2HMACSHA512iter100000::ID) {
+        func(static_cast<securePasswordKdfAlgoPBKDF2HMACSHA512iter100000 &>(obj));
+        return true;
+      }
+      break;
+    case 1098:
+      if (constructor == auth_codeTypeFlashCall::ID) {
+        func(static_cast<auth_codeTypeFlashCall &>(obj));
+        return true;
+      }
+      break;
+    case 1099:
+      if (constructor == inputSingleMedia::ID) {
+        func(static_cast<inputSingleMedia &>(obj));
+        return true;
+      }
+      break;
+    case 1101:
+      if (constructor == pageBlockUnsupported::ID) {
+        func(static_cast<pageBlockUnsupported &>(obj));
+        return true;
+      }
+      if (constructor == updates_channelDifferenceTooLong::ID) {
+        func(static_cast<updates_channelDifferenceTooLong &>(obj));
+        return true;
+      }
+      break;
+    case 1102:
+      if (constructor == inputStickeredMediaPhoto::ID) {
+        func(static_cast<inputStickeredMediaPhoto &>(obj));
+        return true;
+      }
+      break;
+    case 1104:
+      if (constructor == langPackStringDeleted::ID) {
+        func(static_cast<langPackStringDeleted &>(obj));
+        return true;
+      }
+      break;
+    case 1106:
+      if (constructor == encryptedChat::ID) {
+        func(static_cast<encryptedChat &>(obj));
+        return true;
+      }
+      break;
+    case 1107:
+      if (constructor == secureValueTypeDriverLicense::ID) {
+        func(static_cast<secureValueTypeDriverLicense &>(obj));
+        return true;
+      }
+      if (constructor == auth_exportedAuthorization::ID) {
+        func(static_cast<auth_exportedAuthorization &>(obj));
+        return true;
+      }
+      break;
+    case 1108:
+      if (constructor == inputPrivacyValueDisallowContacts::ID) {
+        func(static_cast<inputPrivacyValueDisallowContacts &>(obj));
+        return true;
+      }
+      break;
+    case 1114:
+      if (constructor == updateReadChannelOutbox::ID) {
+        func(static_cast<updateReadChannelOutbox &>(obj));
+        return true;
+      }
+      break;
+    case 1116:
+      if (constructor == channelAdminLogEventActionDeleteMessage::ID) {
+        func(static_cast<channelAdminLogEventActionDeleteMessage &>(obj));
+        return true;
+      }
+      break;
+    case 1119:
+      if (constructor == inputMediaGeoLive::ID) {
+        func(static_cast<inputMediaGeoLive &>(obj));
+        return true;
+      }
+      break;
+    case 1122:
+      if (constructor == inputReportReasonOther::ID) {
+        func(static_cast<inputReportReasonOther &>(obj));
+        return true;
+      }
+      break;
+    case 1123:
+      if (constructor == secureValueTypeAddress::ID) {
+        func(static_cast<secureValueTypeAddress &>(obj));
+        return true;
+      }
+      break;
+    case 1125:
+      if (constructor == inputBotInlineResult::ID) {
+        func(static_cast<inputBotInlineResult &>(obj));
+        return true;
+      }
+      break;
+    case 1126:
+      if (constructor == statsGraphError::ID) {
+        func(static_cast<statsGraphError &>(obj));
+        return true;
+      }
+      if (constructor == updates_differenceTooLong::ID) {
+        func(static_cast<updates_differenceTooLong &>(obj));
+        return true;
+      }
+      break;
+    case 1127:
+      if (constructor == inputDocument::ID) {
+        func(static_cast<inputDocument &>(obj));
+        return true;
+      }
+      break;
+    case 1129:
+      if (constructor == messages_messages::ID) {
+        func(static_cast<messages_messages &>(obj));
+        return true;
+      }
+      break;
+    case 1130:
+      if (constructor == messageFwdHeader::ID) {
+        func(static_cast<messageFwdHeader &>(obj));
+        return true;
+      }
+      break;
+    case 1133:
+      if (constructor == messages_translateResultText::ID) {
+        func(static_cast<messages_translateResultText &>(obj));
+        return true;
+      }
+      break;
+    case 1145:
+      if (constructor == pageBlockDetails::ID) {
+        func(static_cast<pageBlockDetails &>(obj));
+        return true;
+      }
+      break;
+    case 1147:
+      if (constructor == secureSecretSettings::ID) {
+        func(static_cast<secureSecretSettings &>(obj));
+        return true;
+      }
+      break;
+    case 1151:
+      if (constructor == channels_channelParticipants::ID) {
+        func(static_cast<channels_channelParticipants &>(obj));
+        return true;
+      }
+      break;
+    case 1152:
+      if (constructor == inputMediaContact::ID) {
+        func(static_cast<inputMediaContact &>(obj));
+        return true;
+      }
+      break;
+    case 1153:
+      if (constructor == inputPhoto::ID) {
+        func(static_cast<inputPhoto &>(obj));
+        return true;
+      }
+      break;
+    case 1156:
+      if (constructor == ipPortSecret::ID) {
+        func(static_cast<ipPortSecret &>(obj));
+        return true;
+      }
+      break;
+    case 1158:
+      if (constructor == keyboardButtonRow::ID) {
+        func(static_cast<keyboardButtonRow &>(obj));
+        return true;
+      }
+      break;
+    case 1160:
+      if (constructor == help_countriesList::ID) {
+        func(static_cast<help_countriesList &>(obj));
+        return true;
+      }
+      break;
+    case 1165:
+      if (constructor == messages_stickerSetInstallResultArchive::ID) {
+        func(static_cast<messages_stickerSetInstallResultArchive &>(obj));
+        return true;
+      }
+      break;
+    case 1166:
+      if (constructor == payments_bankCardData::ID) {
+        func(static_cast<payments_bankCardData &>(obj));
+        return true;
+      }
+      if (constructor == photos_photos::ID) {
+        func(static_cast<photos_photos &>(obj));
+        return true;
+      }
+      break;
+    case 1168:
+      if (constructor == messages_botCallbackAnswer::ID) {
+        func(static_cast<messages_botCallbackAnswer &>(obj));
+        return true;
+      }
+      break;
+    case 1171:
+      if (constructor == jsonBool::ID) {
+        func(static_cast<jsonBool &>(obj));
+        return true;
+      }
+      if (constructor == replyInlineMarkup::ID) {
+        func(static_cast<replyInlineMarkup &>(obj));
+        return true;
+      }
+      break;
+    case 1173:
+      if (constructor == phone_joinAsPeers::ID) {
+        func(static_cast<phone_joinAsPeers &>(obj));
+        return true;
+      }
+      break;
+    case 1175:
+      if (constructor == secureData::ID) {
+        func(static_cast<secureData &>(obj));
+        return true;
+      }
+      break;
+    case 1177:
+      if (constructor == secureValueTypeRentalAgreement::ID) {
+        func(static_cast<secureValueTypeRentalAgreement &>(obj));
+        return true;
+      }
+      break;
+    case 1179:
+      if (constructor == fileHash::ID) {
+        func(static_cast<fileHash &>(obj));
+        return true;
+      }
+      if (constructor == inputFileBig::ID) {
+        func(static_cast<inputFileBig &>(obj));
+        return true;
+      }
+      break;
+    case 1180:
+      if (constructor == inputMessagesFilterMyMentions::ID) {
+        func(static_cast<inputMessagesFilterMyMentions &>(obj));
+        return true;
+      }
+      break;
+    case 1182:
+      if (constructor == channelParticipantsBots::ID) {
+        func(static_cast<channelParticipantsBots &>(obj));
+        return true;
+      }
+      break;
+    case 1193:
+      if (constructor == chatInviteAlready::ID) {
+        func(static_cast<chatInviteAlready &>(obj));
+        return true;
+      }
+      break;
+    case 1197:
+      if (constructor == encryptedFile::ID) {
+        func(static_cast<encryptedFile &>(obj));
+        return true;
+      }
+      break;
+    case 1199:
+      if (constructor == inputBotInlineResultPhoto::ID) {
+        func(static_cast<inputBotInlineResultPhoto &>(obj));
+        return true;
+      }
+      break;
+    case 1200:
+      if (constructor == chatOnlines::ID) {
+        func(static_cast<chatOnlines &>(obj));
+        return true;
+      }
+      if (constructor == messages_recentStickers::ID) {
+        func(static_cast<messages_recentStickers &>(obj));
+        return true;
+      }
+      break;
+    case 1205:
+      if (constructor == inputDocumentEmpty::ID) {
+        func(static_cast<inputDocumentEmpty &>(obj));
+        return true;
+      }
+      break;
+    case 1208:
+      if (constructor == photoStrippedSize::ID) {
+        func(static_cast<photoStrippedSize &>(obj));
+        return true;
+      }
+      break;
+    case 1210:
+      if (constructor == auth_sentCodeTypeCall::ID) {
+        func(static_cast<auth_sentCodeTypeCall &>(obj));
+        return true;
+      }
+      break;
+    case 1214:
+      if (constructor == updateChatDefaultBannedRights::ID) {
+        func(static_cast<updateChatDefaultBannedRights &>(obj));
+        return true;
+      }
+      break;
+    case 1215:
+      if (constructor == updates_channelDifferenceEmpty::ID) {
+        func(static_cast<updates_channelDifferenceEmpty &>(obj));
+        return true;
+      }
+      break;
+    case 1216:
+      if (constructor == botCommand::ID) {
+        func(static_cast<botCommand &>(obj));
+        return true;
+      }
+      if (constructor == messageEntityUrl::ID) {
+        func(static_cast<messageEntityUrl &>(obj));
+        return true;
+      }
+      if (constructor == peerSelfLocated::ID) {
+        func(static_cast<peerSelfLocated &>(obj));
+        return true;
+      }
+      break;
+    case 1220:
+      if (constructor == nearestDc::ID) {
+        func(static_cast<nearestDc &>(obj));
+        return true;
+      }
+      break;
+    case 1222:
+      if (constructor == updateDialogUnreadMark::ID) {
+        func(static_cast<updateDialogUnreadMark &>(obj));
+        return true;
+      }
+      break;
+    case 1228:
+      if (constructor == inputMediaGame::ID) {
+        func(static_cast<inputMediaGame &>(obj));
+        return true;
+      }
+      break;
+    case 1230:
+      if (constructor == updateChatParticipant::ID) {
+        func(static_cast<updateChatParticipant &>(obj));
+        return true;
+      }
+      break;
+    case 1231:
+      if (constructor == auth_sentCodeTypeSms::ID) {
+        func(static_cast<auth_sentCodeTypeSms &>(obj));
+        return true;
+      }
+      break;
+    case 1233:
+      if (constructor == inputMessageCallbackQuery::ID) {
+        func(static_cast<inputMessageCallbackQuery &>(obj));
+        return true;
+      }
+      break;
+    case 1238:
+      if (constructor == messageActionGroupCallScheduled::ID) {
+        func(static_cast<messageActionGroupCallScheduled &>(obj));
+        return true;
+      }
+      break;
+    case 1241:
+      if (constructor == inputNotifyChats::ID) {
+        func(static_cast<inputNotifyChats &>(obj));
+        return true;
+      }
+      break;
+    case 1243:
+      if (constructor == stickers_suggestedShortName::ID) {
+        func(static_cast<stickers_suggestedShortName &>(obj));
+        return true;
+      }
+      break;
+    case 1244:
+      if (constructor == phoneCallDiscardReasonHangup::ID) {
+        func(static_cast<phoneCallDiscardReasonHangup &>(obj));
+        return true;
+      }
+      break;
+    case 1245:
+      if (constructor == messageActionPhoneCall::ID) {
+        func(static_cast<messageActionPhoneCall &>(obj));
+        return true;
+      }
+      break;
+    case 1248:
+      if (constructor == botInfo::ID) {
+        func(static_cast<botInfo &>(obj));
+        return true;
+      }
+      break;
+    case 1249:
+      if (constructor == phoneCallRequested::ID) {
+        func(static_cast<phoneCallRequested &>(obj));
+        return true;
+      }
+      break;
+    case 1253:
+      if (constructor == privacyKeyAddedByPhone::ID) {
+        func(static_cast<privacyKeyAddedByPhone &>(obj));
+        return true;
+      }
+      break;
+    case 1257:
+      if (constructor == inputPrivacyKeyPhoneP2P::ID) {
+        func(static_cast<inputPrivacyKeyPhoneP2P &>(obj));
+        return true;
+      }
+      break;
+    case 1259:
+      if (constructor == inputReportReasonViolence::ID) {
+        func(static_cast<inputReportReasonViolence &>(obj));
+        return true;
+      }
+      break;
+    case 1260:
+      if (constructor == privacyKeyStatusTimestamp::ID) {
+        func(static_cast<privacyKeyStatusTimestamp &>(obj));
+        return true;
+      }
+      break;
+    case 1261:
+      if (constructor == inputClientProxy::ID) {
+        func(static_cast<inputClientProxy &>(obj));
+        return true;
+      }
+      break;
+    case 1262:
+      if (constructor == privacyValueDisallowChatParticipants::ID) {
+        func(static_cast<privacyValueDisallowChatParticipants &>(obj));
+        return true;
+      }
+      break;
+    case 1265:
+      if (constructor == webPageEmpty::ID) {
+        func(static_cast<webPageEmpty &>(obj));
+        return true;
+      }
+      break;
+    case 1270:
+      if (constructor == inputMessagesFilterDocument::ID) {
+        func(static_cast<inputMessagesFilterDocument &>(obj));
+        return true;
+      }
+      break;
+    case 1272:
+      if (constructor == messageActionGroupCall::ID) {
+        func(static_cast<messageActionGroupCall &>(obj));
+        return true;
+      }
+      break;
+    case 1275:
+      if (constructor == phoneCall::ID) {
+        func(static_cast<phoneCall &>(obj));
+        return true;
+      }
+      break;
+    case 1276:
+      if (constructor == channelAdminLogEventActionChangeTitle::ID) {
+        func(static_cast<channelAdminLogEventActionChangeTitle &>(obj));
+        return true;
+      }
+      if (constructor == jsonString::ID) {
+        func(static_cast<jsonString &>(obj));
+        return true;
+      }
+      break;
+    case 1277:
+      if (constructor == messages_stickerSet::ID) {
+        func(static_cast<messages_stickerSet &>(obj));
+        return true;
+      }
+      break;
+    case 1280:
+      if (constructor == help_passportConfigNotModified::ID) {
+        func(static_cast<help_passportConfigNotModified &>(obj));
+        return true;
+      }
+      break;
+    case 1281:
+      if (constructor == recentMeUrlStickerSet::ID) {
+        func(static_cast<recentMeUrlStickerSet &>(obj));
+        return true;
+      }
+      if (constructor == updateBotCallbackQuery::ID) {
+        func(static_cast<updateBotCallbackQuery &>(obj));
+        return true;
+      }
+      break;
+    case 1282:
+      if (constructor == inputEncryptedFileBigUploaded::ID) {
+        func(static_cast<inputEncryptedFileBigUploaded &>(obj));
+        return true;
+      }
+      break;
+    case 1283:
+      if (constructor == messages_sentEncryptedFile::ID) {
+        func(static_cast<messages_sentEncryptedFile &>(obj));
+        return true;
+      }
+      break;
+    case 1286:
+      if (constructor == account_privacyRules::ID) {
+        func(static_cast<account_privacyRules &>(obj));
+        return true;
+      }
+      break;
+    case 1288:
+      if (constructor == messageEntityBlockquote::ID) {
+        func(static_cast<messageEntityBlockquote &>(obj));
+        return true;
+      }
+      break;
+    case 1290:
+      if (constructor == inputGeoPoint::ID) {
+        func(static_cast<inputGeoPoint &>(obj));
+        return true;
+      }
+      break;
+    case 1300:
+      if (constructor == pageCaption::ID) {
+        func(static_cast<pageCaption &>(obj));
+        return true;
+      }
+      break;
+    case 1301:
+      if (constructor == updatePrivacy::ID) {
+        func(static_cast<updatePrivacy &>(obj));
+        return true;
+      }
+      break;
+    case 1305:
+      if (constructor == botCommandScopeDefault::ID) {
+        func(static_cast<botCommandScopeDefault &>(obj));
+        return true;
+      }
+      if (constructor == messages_foundStickerSets::ID) {
+        func(static_cast<messages_foundStickerSets &>(obj));
+        return true;
+      }
+      break;
+    case 1307:
+      if (constructor == pageRelatedArticle::ID) {
+        func(static_cast<pageRelatedArticle &>(obj));
+        return true;
+      }
+      break;
+    case 1308:
+      if (constructor == accountDaysTTL::ID) {
+        func(static_cast<accountDaysTTL &>(obj));
+        return true;
+      }
+      if (constructor == textEmail::ID) {
+        func(static_cast<textEmail &>(obj));
+        return true;
+      }
+      if (constructor == messages_savedGifs::ID) {
+        func(static_cast<messages_savedGifs &>(obj));
+        return true;
+      }
+      break;
+    case 1311:
+      if (constructor == channelParticipantAdmin::ID) {
+        func(static_cast<channelParticipantAdmin &>(obj));
+        return true;
+      }
+      break;
+    case 1313:
+      if (constructor == documentAttributeSticker::ID) {
+        func(static_cast<documentAttributeSticker &>(obj));
+        return true;
+      }
+      break;
+    case 1317:
+      if (constructor == documentAttributeAnimated::ID) {
+        func(static_cast<documentAttributeAnimated &>(obj));
+        return true;
+      }
+      break;
+    case 1319:
+      if (constructor == channelParticipantLeft::ID) {
+        func(static_cast<channelParticipantLeft &>(obj));
+        return true;
+      }
+      break;
+    case 1322:
+      if (constructor == inputMediaVenue::ID) {
+        func(static_cast<inputMediaVenue &>(obj));
+        return true;
+      }
+      break;
+    case 1324:
+      if (constructor == statsAbsValueAndPrev::ID) {
+        func(static_cast<statsAbsValueAndPrev &>(obj));
+        return true;
+      }
+      break;
+    case 1327:
+      if (constructor == inputUser::ID) {
+        func(static_cast<inputUser &>(obj));
+        return true;
+      }
+      break;
+    case 1329:
+      if (constructor == chatFull::ID) {
+        func(static_cast<chatFull &>(obj));
+        return true;
+      }
+      break;
+    case 1333:
+      if (constructor == inlineQueryPeerTypeChat::ID) {
+        func(static_cast<inlineQueryPeerTypeChat &>(obj));
+        return true;
+      }
+      if (constructor == messages_messagesNotModified::ID) {
+        func(static_cast<messages_messagesNotModified &>(obj));
+        return true;
+      }
+      break;
+    case 1334:
+      if (constructor == storage_filePartial::ID) {
+        func(static_cast<storage_filePartial &>(obj));
+        return true;
+      }
+      break;
+    case 1336:
+      if (constructor == groupCall::ID) {
+        func(static_cast<groupCall &>(obj));
+        return true;
+      }
+      if (constructor == importedContact::ID) {
+        func(static_cast<importedContact &>(obj));
+        return true;
+      }
+      break;
+    case 1337:
+      if (constructor == textPlain::ID) {
+        func(static_cast<textPlain &>(obj));
+        return true;
+      }
+      break;
+    case 1338:
+      if (constructor == webPageNotModified::ID) {
+        func(static_cast<webPageNotModified &>(obj));
+        return true;
+      }
+      break;
+    case 1340:
+      if (constructor == account_takeout::ID) {
+        func(static_cast<account_takeout &>(obj));
+        return true;
+      }
+      break;
+    case 1342:
+      if (constructor == inputReportReasonChildAbuse::ID) {
+        func(static_cast<inputReportReasonChildAbuse &>(obj));
+        return true;
+      }
+      break;
+    case 1343:
+      if (constructor == updateChatParticipants::ID) {
+        func(static_cast<updateChatParticipants &>(obj));
+        return true;
+      }
+      break;
+    case 1346:
+      if (constructor == auth_codeTypeSms::ID) {
+        func(static_cast<auth_codeTypeSms &>(obj));
+        return true;
+      }
+      break;
+    case 1348:
+      if (constructor == pageListItemText::ID) {
+        func(static_cast<pageListItemText &>(obj));
+        return true;
+      }
+      break;
+    case 1359:
+      if (constructor == inputPeerChannelFromMessage::ID) {
+        func(static_cast<inputPeerChannelFromMessage &>(obj));
+        return true;
+      }
+      break;
+    case 1370:
+      if (constructor == messageActionContactSignUp::ID) {
+        func(static_cast<messageActionContactSignUp &>(obj));
+        return true;
+      }
+      break;
+    case 1371:
+      if (constructor == sendMessageUploadAudioAction::ID) {
+        func(static_cast<sendMessageUploadAudioAction &>(obj));
+        return true;
+      }
+      break;
+    case 1372:
+      if (constructor == textUnderline::ID) {
+        func(static_cast<textUnderline &>(obj));
+        return true;
+      }
+      break;
+    case 1373:
+      if (constructor == messageActionChatJoinedByLink::ID) {
+        func(static_cast<messageActionChatJoinedByLink &>(obj));
+        return true;
+      }
+      break;
+    case 1377:
+      if (constructor == accessPointRule::ID) {
+        func(static_cast<accessPointRule &>(obj));
+        return true;
+      }
+      if (constructor == channels_channelParticipant::ID) {
+        func(static_cast<channels_channelParticipant &>(obj));
+        return true;
+      }
+      break;
+    case 1379:
+      if (constructor == inputGameShortName::ID) {
+        func(static_cast<inputGameShortName &>(obj));
+        return true;
+      }
+      if (constructor == messages_peerSettings::ID) {
+        func(static_cast<messages_peerSettings &>(obj));
+        return true;
+      }
+      break;
+    case 1381:
+      if (constructor == updateDraftMessage::ID) {
+        func(static_cast<updateDraftMessage &>(obj));
+        return true;
+      }
+      break;
+    case 1385:
+      if (constructor == sendMessageUploadDocumentAction::ID) {
+        func(static_cast<sendMessageUploadDocumentAction &>(obj));
+        return true;
+      }
+      break;
+    case 1386:
+      if (constructor == phoneCallProtocol::ID) {
+        func(static_cast<phoneCallProtocol &>(obj));
+        return true;
+      }
+      break;
+    case 1388:
+      if (constructor == user::ID) {
+        func(static_cast<user &>(obj));
+        return true;
+      }
+      break;
+    case 1390:
+      if (constructor == updateDcOptions::ID) {
+        func(static_cast<updateDcOptions &>(obj));
+        return true;
+      }
+      break;
+    case 1392:
+      if (constructor == upload_cdnFile::ID) {
+        func(static_cast<upload_cdnFile &>(obj));
+        return true;
+      }
+      break;
+    case 1393:
+      if (constructor == help_userInfoEmpty::ID) {
+        func(static_cast<help_userInfoEmpty &>(obj));
+        return true;
+      }
+      break;
+    case 1394:
+      if (constructor == searchResultPosition::ID) {
+        func(static_cast<searchResultPosition &>(obj));
+        return true;
+      }
+      break;
+    case 1399:
+      if (constructor == statsGraphAsync::ID) {
+        func(static_cast<statsGraphAsync &>(obj));
+        return true;
+      }
+      break;
+    case 1400:
+      if (constructor == secureValueErrorFiles::ID) {
+        func(static_cast<secureValueErrorFiles &>(obj));
+        return true;
+      }
+      if (constructor == messages_peerDialogs::ID) {
+        func(static_cast<messages_peerDialogs &>(obj));
+        return true;
+      }
+      break;
+    case 1404:
+      if (constructor == statsGroupTopInviter::ID) {
+        func(static_cast<statsGroupTopInviter &>(obj));
+        return true;
+      }
+      break;
+    case 1406:
+      if (constructor == channels_sendAsPeers::ID) {
+        func(static_cast<channels_sendAsPeers &>(obj));
+        return true;
+      }
+      if (constructor == help_supportName::ID) {
+        func(static_cast<help_supportName &>(obj));
+        return true;
+      }
+      break;
+    case 1408:
+      if (constructor == inputMessageReplyTo::ID) {
+        func(static_cast<inputMessageReplyTo &>(obj));
+        return true;
+      }
+      if (constructor == updateContactsReset::ID) {
+        func(static_cast<updateContactsReset &>(obj));
+        return true;
+      }
+      break;
+    case 1409:
+      if (constructor == topPeer::ID) {
+        func(static_cast<topPeer &>(obj));
+        return true;
+      }
+      break;
+    case 1410:
+      if (constructor == privacyKeyPhoneNumber::ID) {
+        func(static_cast<privacyKeyPhoneNumber &>(obj));
+        return true;
+      }
+      break;
+    case 1412:
+      if (constructor == updatePinnedMessages::ID) {
+        func(static_cast<updatePinnedMessages &>(obj));
+        return true;
+      }
+      break;
+    case 1415:
+      if (constructor == payments_paymentResult::ID) {
+        func(static_cast<payments_paymentResult &>(obj));
+        return true;
+      }
+      break;
+    case 1418:
+      if (constructor == account_autoDownloadSettings::ID) {
+        func(static_cast<account_autoDownloadSettings &>(obj));
+        return true;
+      }
+      break;
+    case 1419:
+      if (constructor == messages_dialogsNotModified::ID) {
+        func(static_cast<messages_dialogsNotModified &>(obj));
+        return true;
+      }
+      break;
+    case 1420:
+      if (constructor == channel::ID) {
+        func(static_cast<channel &>(obj));
+        return true;
+      }
+      break;
+    case 1423:
+      if (constructor == inputStickerSetThumb::ID) {
+        func(static_cast<inputStickerSetThumb &>(obj));
+        return true;
+      }
+      if (constructor == channels_channelParticipantsNotModified::ID) {
+        func(static_cast<channels_channelParticipantsNotModified &>(obj));
+        return true;
+      }
+      break;
+    case 1424:
+      if (constructor == channelAdminLogEventActionChangeAbout::ID) {
+        func(static_cast<channelAdminLogEventActionChangeAbout &>(obj));
+        return true;
+      }
+      break;
+    case 1426:
+      if (constructor == pageBlockParagraph::ID) {
+        func(static_cast<pageBlockParagraph &>(obj));
+        return true;
+      }
+      break;
+    case 1427:
+      if (constructor == inputPrivacyKeyChatInvite::ID) {
+        func(static_cast<inputPrivacyKeyChatInvite &>(obj));
+        return true;
+      }
+      break;
+    case 1430:
+      if (constructor == topPeerCategoryPhoneCalls::ID) {
+        func(static_cast<topPeerCategoryPhoneCalls &>(obj));
+        return true;
+      }
+      if (constructor == storage_fileMp3::ID) {
+        func(static_cast<storage_fileMp3 &>(obj));
+        return true;
+      }
+      break;
+    case 1432:
+      if (constructor == messageMediaGame::ID) {
+        func(static_cast<messageMediaGame &>(obj));
+        return true;
+      }
+      break;
+    case 1434:
+      if (constructor == recentMeUrlChatInvite::ID) {
+        func(static_cast<recentMeUrlChatInvite &>(obj));
+        return true;
+      }
+      break;
+    case 1438:
+      if (constructor == inputStickeredMediaDocument::ID) {
+        func(static_cast<inputStickeredMediaDocument &>(obj));
+        return true;
+      }
+      break;
+    case 1445:
+      if (constructor == help_country::ID) {
+        func(static_cast<help_country &>(obj));
+        return true;
+      }
+      break;
+    case 1448:
+      if (constructor == messageEntityBold::ID) {
+        func(static_cast<messageEntityBold &>(obj));
+        return true;
+      }
+      break;
+    case 1451:
+      if (constructor == updateDeleteMessages::ID) {
+        func(static_cast<updateDeleteMessages &>(obj));
+        return true;
+      }
+      break;
+    case 1453:
+      if (constructor == channelAdminLogEvent::ID) {
+        func(static_cast<channelAdminLogEvent &>(obj));
+        return true;
+      }
+      break;
+    case 1454:
+      if (constructor == updateDeleteScheduledMessages::ID) {
+        func(static_cast<updateDeleteScheduledMessages &>(obj));
+        return true;
+      }
+      break;
+    case 1456:
+      if (constructor == help_noAppUpdate::ID) {
+        func(static_cast<help_noAppUpdate &>(obj));
+        return true;
+      }
+      if (constructor == messages_favedStickers::ID) {
+        func(static_cast<messages_favedStickers &>(obj));
+        return true;
+      }
+      break;
+    case 1460:
+      if (constructor == wallPaperNoFile::ID) {
+        func(static_cast<wallPaperNoFile &>(obj));
+        return true;
+      }
+      if (constructor == account_authorizationForm::ID) {
+        func(static_cast<account_authorizationForm &>(obj));
+        return true;
+      }
+      break;
+    case 1461:
+      if (constructor == updateGroupCallConnection::ID) {
+        func(static_cast<updateGroupCallConnection &>(obj));
+        return true;
+      }
+      break;
+    case 1462:
+      if (constructor == inputEncryptedFileEmpty::ID) {
+        func(static_cast<inputEncryptedFileEmpty &>(obj));
+        return true;
+      }
+      break;
+    case 1463:
+      if (constructor == updateFavedStickers::ID) {
+        func(static_cast<updateFavedStickers &>(obj));
+        return true;
+      }
+      break;
+    case 1464:
+      if (constructor == messageEntityHashtag::ID) {
+        func(static_cast<messageEntityHashtag &>(obj));
+        return true;
+      }
+      break;
+    case 1465:
+      if (constructor == keyboardButtonRequestGeoLocation::ID) {
+        func(static_cast<keyboardButtonRequestGeoLocation &>(obj));
+        return true;
+      }
+      break;
+    case 1466:
+      if (constructor == inputMediaInvoice::ID) {
+        func(static_cast<inputMediaInvoice &>(obj));
+        return true;
+      }
+      break;
+    case 1467:
+      if (constructor == channelParticipantsSearch::ID) {
+        func(static_cast<channelParticipantsSearch &>(obj));
+        return true;
+      }
+      break;
+    case 1468:
+      if (constructor == account_webAuthorizations::ID) {
+        func(static_cast<account_webAuthorizations &>(obj));
+        return true;
+      }
+      break;
+    case 1470:
+      if (constructor == updateChannelWebPage::ID) {
+        func(static_cast<updateChannelWebPage &>(obj));
+        return true;
+      }
+      break;
+    case 1471:
+      if (constructor == updateUserStatus::ID) {
+        func(static_cast<updateUserStatus &>(obj));
+        return true;
+      }
+      if (constructor == messages_stickersNotModified::ID) {
+        func(static_cast<messages_stickersNotModified &>(obj));
+        return true;
+      }
+      break;
+    case 1472:
+      if (constructor == inputMediaPhotoExternal::ID) {
+        func(static_cast<inputMediaPhotoExternal &>(obj));
+        return true;
+      }
+      break;
+    case 1473:
+      if (constructor == inputPeerEmpty::ID) {
+        func(static_cast<inputPeerEmpty &>(obj));
+        return true;
+      }
+      break;
+    case 1474:
+      if (constructor == textStrike::ID) {
+        func(static_cast<textStrike &>(obj));
+        return true;
+      }
+      break;
+    case 1477:
+      if (constructor == textSubscript::ID) {
+        func(static_cast<textSubscript &>(obj));
+        return true;
+      }
+      break;
+    case 1478:
+      if (constructor == messageUserVote::ID) {
+        func(static_cast<messageUserVote &>(obj));
+        return true;
+      }
+      break;
+    case 1483:
+      if (constructor == chatInvite::ID) {
+        func(static_cast<chatInvite &>(obj));
+        return true;
+      }
+      break;
+    case 1487:
+      if (constructor == inputBotInlineMessageMediaVenue::ID) {
+        func(static_cast<inputBotInlineMessageMediaVenue &>(obj));
+        return true;
+      }
+      break;
+    case 1491:
+      if (constructor == inputMediaUploadedDocument::ID) {
+        func(static_cast<inputMediaUploadedDocument &>(obj));
+        return true;
+      }
+      break;
+    case 1493:
+      if (constructor == phoneCallEmpty::ID) {
+        func(static_cast<phoneCallEmpty &>(obj));
+        return true;
+      }
+      break;
+    case 1495:
+      if (constructor == pageBlockBlockquote::ID) {
+        func(static_cast<pageBlockBlockquote &>(obj));
+        return true;
+      }
+      break;
+    case 1499:
+      if (constructor == messageMediaPhoto::ID) {
+        func(static_cast<messageMediaPhoto &>(obj));
+        return true;
+      }
+      break;
+    case 1500:
+      if (constructor == updateDialogFilter::ID) {
+        func(static_cast<updateDialogFilter &>(obj));
+        return true;
+      }
+      break;
+    case 1502:
+      if (constructor == updateMessageID::ID) {
+        func(static_cast<updateMessageID &>(obj));
+        return true;
+      }
+      break;
+    case 1507:
+      if (constructor == botCommandScopePeerUser::ID) {
+        func(static_cast<botCommandScopePeerUser &>(obj));
+        return true;
+      }
+      break;
+    case 1520:
+      if (constructor == messages_messageReactionsList::ID) {
+        func(static_cast<messages_messageReactionsList &>(obj));
+        return true;
+      }
+      break;
+    case 1521:
+      if (constructor == game::ID) {
+        func(static_cast<game &>(obj));
+        return true;
+      }
+      break;
+    case 1523:
+      if (constructor == updateDialogFilterOrder::ID) {
+        func(static_cast<updateDialogFilterOrder &>(obj));
+        return true;
+      }
+      break;
+    case 1524:
+      if (constructor == userStatusRecently::ID) {
+        func(static_cast<userStatusRecently &>(obj));
+        return true;
+      }
+      break;
+    case 1527:
+      if (constructor == channelForbidden::ID) {
+        func(static_cast<channelForbidden &>(obj));
+        return true;
+      }
+      if (constructor == updateReadMessagesContents::ID) {
+        func(static_cast<updateReadMessagesContents &>(obj));
+        return true;
+      }
+      break;
+    case 1528:
+      if (constructor == pollAnswerVoters::ID) {
+        func(static_cast<pollAnswerVoters &>(obj));
+        return true;
+      }
+      if (constructor == auth_codeTypeCall::ID) {
+        func(static_cast<auth_codeTypeCall &>(obj));
+        return true;
+      }
+      break;
+    case 1535:
+      if (constructor == updateNewChannelMessage::ID) {
+        func(static_cast<updateNewChannelMessage &>(obj));
+        return true;
+      }
+      break;
+    case 1537:
+      if (constructor == photo::ID) {
+        func(static_cast<photo &>(obj));
+        return true;
+      }
+      break;
+    case 1538:
+      if (constructor == channelAdminLogEventActionToggleInvites::ID) {
+        func(static_cast<channelAdminLogEventActionToggleInvites &>(obj));
+        return true;
+      }
+      break;
+    case 1541:
+      if (constructor == inputMessagesFilterPhotoVideo::ID) {
+        func(static_cast<inputMessagesFilterPhotoVideo &>(obj));
+        return true;
+      }
+      break;
+    case 1543:
+      if (constructor == updatePendingJoinRequests::ID) {
+        func(static_cast<updatePendingJoinRequests &>(obj));
+        return true;
+      }
+      if (constructor == webAuthorization::ID) {
+        func(static_cast<webAuthorization &>(obj));
+        return true;
+      }
+      break;
+    case 1544:
+      if (constructor == messages_sentEncryptedMessage::ID) {
+        func(static_cast<messages_sentEncryptedMessage &>(obj));
+        return true;
+      }
+      break;
+    case 1546:
+      if (constructor == channelAdminLogEventActionToggleSignatures::ID) {
+        func(static_cast<channelAdminLogEventActionToggleSignatures &>(obj));
+        return true;
+      }
+      if (constructor == updateNotifySettings::ID) {
+        func(static_cast<updateNotifySettings &>(obj));
+        return true;
+      }
+      break;
+    case 1547:
+      if (constructor == secureValueErrorTranslationFile::ID) {
+        func(static_cast<secureValueErrorTranslationFile &>(obj));
+        return true;
+      }
+      if (constructor == updateReadFeaturedStickers::ID) {
+        func(static_cast<updateReadFeaturedStickers &>(obj));
+        return true;
+      }
+      break;
+    case 1548:
+      if (constructor == updateNewScheduledMessage::ID) {
+        func(static_cast<updateNewScheduledMessage &>(obj));
+        return true;
+      }
+      break;
+    case 1549:
+      if (constructor == sendMessageRecordAudioAction::ID) {
+        func(static_cast<sendMessageRecordAudioAction &>(obj));
+        return true;
+      }
+      if (constructor == messages_dhConfig::ID) {
+        func(static_cast<messages_dhConfig &>(obj));
+        return true;
+      }
+      break;
+    case 1550:
+      if (constructor == chatAdminRights::ID) {
+        func(static_cast<chatAdminRights &>(obj));
+        return true;
+      }
+      if (constructor == inputGroupCallStream::ID) {
+        func(static_cast<inputGroupCallStream &>(obj));
+        return true;
+      }
+      break;
+    case 1551:
+      if (constructor == inputNotifyBroadcasts::ID) {
+        func(static_cast<inputNotifyBroadcasts &>(obj));
+        return true;
+      }
+      break;
+    case 1557:
+      if (constructor == inputBotInlineResultGame::ID) {
+        func(static_cast<inputBotInlineResultGame &>(obj));
+        return true;
+      }
+      break;
+    case 1559:
+      if (constructor == pageListOrderedItemText::ID) {
+        func(static_cast<pageListOrderedItemText &>(obj));
+        return true;
+      }
+      break;
+    case 1560:
+      if (constructor == inputPhoneContact::ID) {
+        func(static_cast<inputPhoneContact &>(obj));
+        return true;
+      }
+      break;
+    case 1562:
+      if (constructor == statsGraph::ID) {
+        func(static_cast<statsGraph &>(obj));
+        return true;
+      }
+      if (constructor == updateChatParticipantAdmin::ID) {
+        func(static_cast<updateChatParticipantAdmin &>(obj));
+        return true;
+      }
+      break;
+    case 1563:
+      if (constructor == inputStickerSetEmpty::ID) {
+        func(static_cast<inputStickerSetEmpty &>(obj));
+        return true;
+      }
+      break;
+    case 1564:
+      if (constructor == updateReadHistoryOutbox::ID) {
+        func(static_cast<updateReadHistoryOutbox &>(obj));
+        return true;
+      }
+      break;
+    case 1567:
+      if (constructor == pageBlockSlideshow::ID) {
+        func(static_cast<pageBlockSlideshow &>(obj));
+        return true;
+      }
+      break;
+    case 1570:
+      if (constructor == inputBotInlineMessageMediaGeo::ID) {
+        func(static_cast<inputBotInlineMessageMediaGeo &>(obj));
+        return true;
+      }
+      break;
+    case 1571:
+      if (constructor == langPackString::ID) {
+        func(static_cast<langPackString &>(obj));
+        return true;
+      }
+      break;
+    case 1573:
+      if (constructor == secureValueHash::ID) {
+        func(static_cast<secureValueHash &>(obj));
+        return true;
+      }
+      break;
+    case 1575:
+      if (constructor == messageActionScreenshotTaken::ID) {
+        func(static_cast<messageActionScreenshotTaken &>(obj));
+        return true;
+      }
+      break;
+    case 1576:
+      if (constructor == messages_translateNoResult::ID) {
+        func(static_cast<messages_translateNoResult &>(obj));
+        return true;
+      }
+      break;
+    case 1577:
+      if (constructor == updateLangPackTooLong::ID) {
+        func(static_cast<updateLangPackTooLong &>(obj));
+        return true;
+      }
+      break;
+    case 1578:
+      if (constructor == messages_allStickers::ID) {
+        func(static_cast<messages_allStickers &>(obj));
+        return true;
+      }
+      break;
+    case 1582:
+      if (constructor == messageActionPaymentSentMe::ID) {
+        func(static_cast<messageActionPaymentSentMe &>(obj));
+        return true;
+      }
+      break;
+    case 1585:
+      if (constructor == pageListOrderedItemBlocks::ID) {
+        func(static_cast<pageListOrderedItemBlocks &>(obj));
+        return true;
+      }
+      break;
+    case 1587:
+      if (constructor == updateGeoLiveViewed::ID) {
+        func(static_cast<updateGeoLiveViewed &>(obj));
+        return true;
+      }
+      break;
+    case 1590:
+      if (constructor == auth_sentCodeTypeMissedCall::ID) {
+        func(static_cast<auth_sentCodeTypeMissedCall &>(obj));
+        return true;
+      }
+      break;
+    case 1594:
+      if (constructor == secureRequiredTypeOneOf::ID) {
+        func(static_cast<secureRequiredTypeOneOf &>(obj));
+        return true;
+      }
+      break;
+    case 1595:
+      if (constructor == inputMessagePinned::ID) {
+        func(static_cast<inputMessagePinned &>(obj));
+        return true;
+      }
+      break;
+    case 1598:
+      if (constructor == messageEntityEmail::ID) {
+        func(static_cast<messageEntityEmail &>(obj));
+        return true;
+      }
+      if (constructor == privacyValueAllowContacts::ID) {
+        func(static_cast<privacyValueAllowContacts &>(obj));
+        return true;
+      }
+      if (constructor == wallPaperSettings::ID) {
+        func(static_cast<wallPaperSettings &>(obj));
+        return true;
+      }
+      break;
+    case 1600:
+      if (constructor == inputThemeSlug::ID) {
+        func(static_cast<inputThemeSlug &>(obj));
+        return true;
+      }
+      break;
+    case 1604:
+      if (constructor == dialogFolder::ID) {
+        func(static_cast<dialogFolder &>(obj));
+        return true;
+      }
+      break;
+    case 1608:
+      if (constructor == inputPrivacyKeyStatusTimestamp::ID) {
+        func(static_cast<inputPrivacyKeyStatusTimestamp &>(obj));
+        return true;
+      }
+      break;
+    case 1610:
+      if (constructor == inputStickerSetShortName::ID) {
+        func(static_cast<inputStickerSetShortName &>(obj));
+        return true;
+      }
+      if (constructor == keyboardButton::ID) {
+        func(static_cast<keyboardButton &>(obj));
+        return true;
+      }
+      break;
+    case 1611:
+      if (constructor == encryptedChatDiscarded::ID) {
+        func(static_cast<encryptedChatDiscarded &>(obj));
+        return true;
+      }
+      break;
+    case 1613:
+      if (constructor == channelAdminLogEventActionStartGroupCall::ID) {
+        func(static_cast<channelAdminLogEventActionStartGroupCall &>(obj));
+        return true;
+      }
+      break;
+    case 1616:
+      if (constructor == privacyValueAllowChatParticipants::ID) {
+        func(static_cast<privacyValueAllowChatParticipants &>(obj));
+        return true;
+      }
+      break;
+    case 1617:
+      if (constructor == encryptedMessageService::ID) {
+        func(static_cast<encryptedMessageService &>(obj));
+        return true;
+      }
+      if (constructor == keyboardButtonGame::ID) {
+        func(static_cast<keyboardButtonGame &>(obj));
+        return true;
+      }
+      break;
+    case 1618:
+      if (constructor == error::ID) {
+        func(static_cast<error &>(obj));
+        return true;
+      }
+      if (constructor == reactionCount::ID) {
+        func(static_cast<reactionCount &>(obj));
+        return true;
+      }
+      break;
+    case 1622:
+      if (constructor == updateChannelUserTyping::ID) {
+        func(static_cast<updateChannelUserTyping &>(obj));
+        return true;
+      }
+      break;
+    case 1623:
+      if (constructor == inputPrivacyValueAllowContacts::ID) {
+        func(static_cast<inputPrivacyValueAllowContacts &>(obj));
+        return true;
+      }
+      if (constructor == account_resetPasswordFailedWait::ID) {
+        func(static_cast<account_resetPasswordFailedWait &>(obj));
+        return true;
+      }
+      break;
+    case 1625:
+      if (constructor == inputTakeoutFileLocation::ID) {
+        func(static_cast<inputTakeoutFileLocation &>(obj));
+        return true;
+      }
+      break;
+    case 1626:
+      if (constructor == messageEntityUnknown::ID) {
+        func(static_cast<messageEntityUnknown &>(obj));
+        return true;
+      }
+      if (constructor == inputMessagesFilterEmpty::ID) {
+        func(static_cast<inputMessagesFilterEmpty &>(obj));
+        return true;
+      }
+      break;
+    case 1627:
+      if (constructor == sendMessageGeoLocationAction::ID) {
+        func(static_cast<sendMessageGeoLocationAction &>(obj));
+        return true;
+      }
+      break;
+    case 1628:
+      if (constructor == dialogFilter::ID) {
+        func(static_cast<dialogFilter &>(obj));
+        return true;
+      }
+      break;
+    case 1630:
+      if (constructor == inputReportReasonPornography::ID) {
+        func(static_cast<inputReportReasonPornography &>(obj));
+        return true;
+      }
+      break;
+    case 1639:
+      if (constructor == messageEntityBotCommand::ID) {
+        func(static_cast<messageEntityBotCommand &>(obj));
+        return true;
+      }
+      break;
+    case 1640:
+      if (constructor == contacts_contactsNotModified::ID) {
+        func(static_cast<contacts_contactsNotModified &>(obj));
+        return true;
+      }
+      break;
+    case 1641:
+      if (constructor == inputReportReasonFake::ID) {
+        func(static_cast<inputReportReasonFake &>(obj));
+        return true;
+      }
+      break;
+    case 1646:
+      if (constructor == pageBlockCollage::ID) {
+        func(static_cast<pageBlockCollage &>(obj));
+        return true;
+      }
+      break;
+    case 1648:
+      if (constructor == updateDialogFilters::ID) {
+        func(static_cast<updateDialogFilters &>(obj));
+        return true;
+      }
+      break;
+    case 1649:
+      if (constructor == globalPrivacySettings::ID) {
+        func(static_cast<globalPrivacySettings &>(obj));
+        return true;
+      }
+      break;
+    case 1650:
+      if (constructor == sendMessageRecordVideoAction::ID) {
+        func(static_cast<sendMessageRecordVideoAction &>(obj));
+        return true;
+      }
+      break;
+    case 1652:
+      if (constructor == jsonArray::ID) {
+        func(static_cast<jsonArray &>(obj));
+        return true;
+      }
+      break;
+    case 1653:
+      if (constructor == inputWallPaper::ID) {
+        func(static_cast<inputWallPaper &>(obj));
+        return true;
+      }
+      if (constructor == payments_paymentReceipt::ID) {
+        func(static_cast<payments_paymentReceipt &>(obj));
+        return true;
+      }
+      break;
+    case 1655:
+      if (constructor == contact::ID) {
+        func(static_cast<contact &>(obj));
+        return true;
+      }
+      if (constructor == photoSizeEmpty::ID) {
+        func(static_cast<photoSizeEmpty &>(obj));
+        return true;
+      }
+      break;
+    case 1656:
+      if (constructor == secureValueTypeInternalPassport::ID) {
+        func(static_cast<secureValueTypeInternalPassport &>(obj));
+        return true;
+      }
+      break;
+    case 1657:
+      if (constructor == pageBlockAudio::ID) {
+        func(static_cast<pageBlockAudio &>(obj));
+        return true;
+      }
+      break;
+    case 1658:
+      if (constructor == replyKeyboardForceReply::ID) {
+        func(static_cast<replyKeyboardForceReply &>(obj));
+        return true;
+      }
+      break;
+    case 1665:
+      if (constructor == textSuperscript::ID) {
+        func(static_cast<textSuperscript &>(obj));
+        return true;
+      }
+      break;
+    case 1666:
+      if (constructor == contactStatus::ID) {
+        func(static_cast<contactStatus &>(obj));
+        return true;
+      }
+      if (constructor == auth_authorizationSignUpRequired::ID) {
+        func(static_cast<auth_authorizationSignUpRequired &>(obj));
+        return true;
+      }
+      break;
+    case 1668:
+      if (constructor == inputReportReasonCopyright::ID) {
+        func(static_cast<inputReportReasonCopyright &>(obj));
+        return true;
+      }
+      break;
+    case 1669:
+      if (constructor == popularContact::ID) {
+        func(static_cast<popularContact &>(obj));
+        return true;
+      }
+      break;
+    case 1672:
+      if (constructor == textUrl::ID) {
+        func(static_cast<textUrl &>(obj));
+        return true;
+      }
+      break;
+    case 1673:
+      if (constructor == privacyValueAllowAll::ID) {
+        func(static_cast<privacyValueAllowAll &>(obj));
+        return true;
+      }
+      break;
+    case 1675:
+      if (constructor == photoSizeProgressive::ID) {
+        func(static_cast<photoSizeProgressive &>(obj));
+        return true;
+      }
+      break;
+    case 1679:
+      if (constructor == groupCallDiscarded::ID) {
+        func(static_cast<groupCallDiscarded &>(obj));
+        return true;
+      }
+      break;
+    case 1684:
+      if (constructor == messages_messageEditData::ID) {
+        func(static_cast<messages_messageEditData &>(obj));
+        return true;
+      }
+      break;
+    case 1687:
+      if (constructor == updateTheme::ID) {
+        func(static_cast<updateTheme &>(obj));
+        return true;
+      }
+      break;
+    case 1688:
+      if (constructor == contacts_topPeersNotModified::ID) {
+        func(static_cast<contacts_topPeersNotModified &>(obj));
+        return true;
+      }
+      if (constructor == help_inviteText::ID) {
+        func(static_cast<help_inviteText &>(obj));
+        return true;
+      }
+      break;
+    case 1690:
+      if (constructor == inputBotInlineMessageMediaAuto::ID) {
+        func(static_cast<inputBotInlineMessageMediaAuto &>(obj));
+        return true;
+      }
+      if (constructor == jsonObjectValue::ID) {
+        func(static_cast<jsonObjectValue &>(obj));
+        return true;
+      }
+      break;
+    case 1695:
+      if (constructor == botInlineMessageMediaVenue::ID) {
+        func(static_cast<botInlineMessageMediaVenue &>(obj));
+        return true;
+      }
+      break;
+    case 1696:
+      if (constructor == userProfilePhotoEmpty::ID) {
+        func(static_cast<userProfilePhotoEmpty &>(obj));
+        return true;
+      }
+      break;
+    case 1698:
+      if (constructor == userStatusOnline::ID) {
+        func(static_cast<userStatusOnline &>(obj));
+        return true;
+      }
+      break;
+    case 1699:
+      if (constructor == securePasswordKdfAlgoSHA512::ID) {
+        func(static_cast<securePasswordKdfAlgoSHA512 &>(obj));
+        return true;
+      }
+      break;
+    case 1700:
+      if (constructor == inputStickerSetAnimatedEmoji::ID) {
+        func(static_cast<inputStickerSetAnimatedEmoji &>(obj));
+        return true;
+      }
+      break;
+    case 1708:
+      if (constructor == botCommandScopeChatAdmins::ID) {
+        func(static_cast<botCommandScopeChatAdmins &>(obj));
+        return true;
+      }
+      break;
+    case 1709:
+      if (constructor == documentAttributeVideo::ID) {
+        func(static_cast<documentAttributeVideo &>(obj));
+        return true;
+      }
+      break;
+    case 1712:
+      if (constructor == sendMessageChooseStickerAction::ID) {
+        func(static_cast<sendMessageChooseStickerAction &>(obj));
+        return true;
+      }
+      break;
+    case 1717:
+      if (constructor == channelParticipantsMentions::ID) {
+        func(static_cast<channelParticipantsMentions &>(obj));
+        return true;
+      }
+      break;
+    case 1718:
+      if (constructor == payments_paymentForm::ID) {
+        func(static_cast<payments_paymentForm &>(obj));
+        return true;
+      }
+      break;
+    case 1721:
+      if (constructor == inputPhoneCall::ID) {
+        func(static_cast<inputPhoneCall &>(obj));
+        return true;
+      }
+      break;
+    case 1728:
+      if (constructor == inputPrivacyValueAllowChatParticipants::ID) {
+        func(static_cast<inputPrivacyValueAllowChatParticipants &>(obj));
+        return true;
+      }
+      if (constructor == updateEditChannelMessage::ID) {
+        func(static_cast<updateEditChannelMessage &>(obj));
+        return true;
+      }
+      break;
+    case 1730:
+      if (constructor == inputPeerUserFromMessage::ID) {
+        func(static_cast<inputPeerUserFromMessage &>(obj));
+        return true;
+      }
+      if (constructor == updateReadChannelDiscussionInbox::ID) {
+        func(static_cast<updateReadChannelDiscussionInbox &>(obj));
+        return true;
+      }
+      break;
+    case 1731:
+      if (constructor == pollResults::ID) {
+        func(static_cast<pollResults &>(obj));
+        return true;
+      }
+      break;
+    case 1734:
+      if (constructor == inputFolderPeer::ID) {
+        func(static_cast<inputFolderPeer &>(obj));
+        return true;
+      }
+      break;
+    case 1740:
+      if (constructor == inputMediaPhoto::ID) {
+        func(static_cast<inputMediaPhoto &>(obj));
+        return true;
+      }
+      break;
+    case 1745:
+      if (constructor == inputEncryptedChat::ID) {
+        func(static_cast<inputEncryptedChat &>(obj));
+        return true;
+      }
+      break;
+    case 1747:
+      if (constructor == encryptedChatEmpty::ID) {
+        func(static_cast<encryptedChatEmpty &>(obj));
+        return true;
+      }
+      break;
+    case 1750:
+      if (constructor == phone_exportedGroupCallInvite::ID) {
+        func(static_cast<phone_exportedGroupCallInvite &>(obj));
+        return true;
+      }
+      break;
+    case 1751:
+      if (constructor == inputChatPhoto::ID) {
+        func(static_cast<inputChatPhoto &>(obj));
+        return true;
+      }
+      break;
+    case 1752:
+      if (constructor == pageBlockPullquote::ID) {
+        func(static_cast<pageBlockPullquote &>(obj));
+        return true;
+      }
+      break;
+    case 1755:
+      if (constructor == authorization::ID) {
+        func(static_cast<authorization &>(obj));
+        return true;
+      }
+      break;
+    case 1759:
+      if (constructor == messageActionHistoryClear::ID) {
+        func(static_cast<messageActionHistoryClear &>(obj));
+        return true;
+      }
+      break;
+    case 1767:
+      if (constructor == account_authorizations::ID) {
+        func(static_cast<account_authorizations &>(obj));
+        return true;
+      }
+      break;
+    case 1768:
+      if (constructor == privacyValueAllowUsers::ID) {
+        func(static_cast<privacyValueAllowUsers &>(obj));
+        return true;
+      }
+      if (constructor == updateUserPhone::ID) {
+        func(static_cast<updateUserPhone &>(obj));
+        return true;
+      }
+      break;
+    case 1769:
+      if (constructor == messageActionChatDeletePhoto::ID) {
+        func(static_cast<messageActionChatDeletePhoto &>(obj));
+        return true;
+      }
+      break;
+    case 1770:
+      if (constructor == baseThemeClassic::ID) {
+        func(static_cast<baseThemeClassic &>(obj));
+        return true;
+      }
+      if (constructor == postAddress::ID) {
+        func(static_cast<postAddress &>(obj));
+        return true;
+      }
+      break;
+    case 1773:
+      if (constructor == chatAdminWithInvites::ID) {
+        func(static_cast<chatAdminWithInvites &>(obj));
+        return true;
+      }
+      break;
+    case 1776:
+      if (constructor == help_deepLinkInfo::ID) {
+        func(static_cast<help_deepLinkInfo &>(obj));
+        return true;
+      }
+      break;
+    case 1778:
+      if (constructor == channelAdminLogEventActionTogglePreHistoryHidden::ID) {
+        func(static_cast<channelAdminLogEventActionTogglePreHistoryHidden &>(obj));
+        return true;
+      }
+      break;
+    case 1779:
+      if (constructor == messageEntityPhone::ID) {
+        func(static_cast<messageEntityPhone &>(obj));
+        return true;
+      }
+      if (constructor == auth_sentCodeTypeFlashCall::ID) {
+        func(static_cast<auth_sentCodeTypeFlashCall &>(obj));
+        return true;
+      }
+      break;
+    case 1780:
+      if (constructor == channelParticipantSelf::ID) {
+        func(static_cast<channelParticipantSelf &>(obj));
+        return true;
+      }
+      break;
+    case 1781:
+      if (constructor == pageBlockTable::ID) {
+        func(static_cast<pageBlockTable &>(obj));
+        return true;
+      }
+      if (constructor == messages_votesList::ID) {
+        func(static_cast<messages_votesList &>(obj));
+        return true;
+      }
+      break;
+    case 1784:
+      if (constructor == secureFile::ID) {
+        func(static_cast<secureFile &>(obj));
+        return true;
+      }
+      break;
+    case 1785:
+      if (constructor == keyboardButtonRequestPhone::ID) {
+        func(static_cast<keyboardButtonRequestPhone &>(obj));
+        return true;
+      }
+      if (constructor == privacyKeyForwards::ID) {
+        func(static_cast<privacyKeyForwards &>(obj));
+        return true;
+      }
+      break;
+    case 1787:
+      if (constructor == inputPaymentCredentialsGooglePay::ID) {
+        func(static_cast<inputPaymentCredentialsGooglePay &>(obj));
+        return true;
+      }
+      if (constructor == contacts_blockedSlice::ID) {
+        func(static_cast<contacts_blockedSlice &>(obj));
+        return true;
+      }
+      break;
+    case 1788:
+      if (constructor == emojiKeyword::ID) {
+        func(static_cast<emojiKeyword &>(obj));
+        return true;
+      }
+      break;
+    case 1790:
+      if (constructor == messages_stickerSetInstallResultSuccess::ID) {
+        func(static_cast<messages_stickerSetInstallResultSuccess &>(obj));
+        return true;
+      }
+      break;
+    case 1793:
+      if (constructor == dialog::ID) {
+        func(static_cast<dialog &>(obj));
+        return true;
+      }
+      break;
+    case 1797:
+      if (constructor == inlineQueryPeerTypeMegagroup::ID) {
+        func(static_cast<inlineQueryPeerTypeMegagroup &>(obj));
+        return true;
+      }
+      if (constructor == messageUserVoteMultiple::ID) {
+        func(static_cast<messageUserVoteMultiple &>(obj));
+        return true;
+      }
+      break;
+    case 1798:
+      if (constructor == channelParticipantCreator::ID) {
+        func(static_cast<channelParticipantCreator &>(obj));
+        return true;
+      }
+      if (constructor == sponsoredMessage::ID) {
+        func(static_cast<sponsoredMessage &>(obj));
+        return true;
+      }
+      break;
+    case 1800:
+      if (constructor == storage_filePng::ID) {
+        func(static_cast<storage_filePng &>(obj));
+        return true;
+      }
+      break;
+    case 1801:
+      if (constructor == updateUserTyping::ID) {
+        func(static_cast<updateUserTyping &>(obj));
+        return true;
+      }
+      break;
+    case 1804:
+      if (constructor == inputBotInlineMessageMediaContact::ID) {
+        func(static_cast<inputBotInlineMessageMediaContact &>(obj));
+        return true;
+      }
+      break;
+    case 1805:
+      if (constructor == secureValueTypePersonalDetails::ID) {
+        func(static_cast<secureValueTypePersonalDetails &>(obj));
+        return true;
+      }
+      break;
+    case 1811:
+      if (constructor == inputCheckPasswordEmpty::ID) {
+        func(static_cast<inputCheckPasswordEmpty &>(obj));
+        return true;
+      }
+      break;
+    case 1813:
+      if (constructor == channelAdminLogEventActionParticipantJoin::ID) {
+        func(static_cast<channelAdminLogEventActionParticipantJoin &>(obj));
+        return true;
+      }
+      break;
+    case 1816:
+      if (constructor == pageBlockChannel::ID) {
+        func(static_cast<pageBlockChannel &>(obj));
+        return true;
+      }
+      break;
+    case 1817:
+      if (constructor == statsPercentValue::ID) {
+        func(static_cast<statsPercentValue &>(obj));
+        return true;
+      }
+      if (constructor == account_sentEmailCode::ID) {
+        func(static_cast<account_sentEmailCode &>(obj));
+        return true;
+      }
+      break;
+    case 1818:
+      if (constructor == channelAdminLogEventActionDefaultBannedRights::ID) {
+        func(static_cast<channelAdminLogEventActionDefaultBannedRights &>(obj));
+        return true;
+      }
+      if (constructor == inputMediaEmpty::ID) {
+        func(static_cast<inputMediaEmpty &>(obj));
+        return true;
+      }
+      if (constructor == webPageAttributeTheme::ID) {
+        func(static_cast<webPageAttributeTheme &>(obj));
+        return true;
+      }
+      break;
+    case 1819:
+      if (constructor == messageMediaWebPage::ID) {
+        func(static_cast<messageMediaWebPage &>(obj));
+        return true;
+      }
+      if (constructor == textEmpty::ID) {
+        func(static_cast<textEmpty &>(obj));
+        return true;
+      }
+      break;
+    case 1822:
+      if (constructor == inputPeerPhotoFileLocationLegacy::ID) {
+        func(static_cast<inputPeerPhotoFileLocationLegacy &>(obj));
+        return true;
+      }
+      break;
+    case 1824:
+      if (constructor == inputMessageID::ID) {
+        func(static_cast<inputMessageID &>(obj));
+        return true;
+      }
+      if (constructor == account_themes::ID) {
+        func(static_cast<account_themes &>(obj));
+        return true;
+      }
+      break;
+    case 1825:
+      if (constructor == payments_paymentVerificationNeeded::ID) {
+        func(static_cast<payments_paymentVerificationNeeded &>(obj));
+        return true;
+      }
+      if (constructor == photos_photosSlice::ID) {
+        func(static_cast<photos_photosSlice &>(obj));
+        return true;
+      }
+      break;
+    case 1827:
+      if (constructor == inputMessagesFilterPinned::ID) {
+        func(static_cast<inputMessagesFilterPinned &>(obj));
+        return true;
+      }
+      break;
+    case 1833:
+      if (constructor == channelAdminLogEventActionChangeUsername::ID) {
+        func(static_cast<channelAdminLogEventActionChangeUsername &>(obj));
+        return true;
+      }
+      break;
+    case 1835:
+      if (constructor == botCommandScopePeerAdmins::ID) {
+        func(static_cast<botCommandScopePeerAdmins &>(obj));
+        return true;
+      }
+      break;
+    case 1839:
+      if (constructor == inputReportReasonGeoIrrelevant::ID) {
+        func(static_cast<inputReportReasonGeoIrrelevant &>(obj));
+        return true;
+      }
+      break;
+    case 1846:
+      if (constructor == messages_checkedHistoryImportPeer::ID) {
+        func(static_cast<messages_checkedHistoryImportPeer &>(obj));
+        return true;
+      }
+      break;
+    case 1848:
+      if (constructor == account_passwordInputSettings::ID) {
+        func(static_cast<account_passwordInputSettings &>(obj));
+        return true;
+      }
+      break;
+    case 1855:
+      if (constructor == inputDocumentFileLocation::ID) {
+        func(static_cast<inputDocumentFileLocation &>(obj));
+        return true;
+      }
+      break;
+    case 1856:
+      if (constructor == keyboardButtonCallback::ID) {
+        func(static_cast<keyboardButtonCallback &>(obj));
+        return true;
+      }
+      if (constructor == pageBlockHeader::ID) {
+        func(static_cast<pageBlockHeader &>(obj));
+        return true;
+      }
+      break;
+    case 1857:
+      if (constructor == inputSecureFileLocation::ID) {
+        func(static_cast<inputSecureFileLocation &>(obj));
+        return true;
+      }
+      if (constructor == inputPrivacyValueDisallowAll::ID) {
+        func(static_cast<inputPrivacyValueDisallowAll &>(obj));
+        return true;
+      }
+      break;
+    case 1858:
+      if (constructor == updateConfig::ID) {
+        func(static_cast<updateConfig &>(obj));
+        return true;
+      }
+      break;
+    case 1861:
+      if (constructor == pageTableCell::ID) {
+        func(static_cast<pageTableCell &>(obj));
+        return true;
+      }
+      break;
+    case 1862:
+      if (constructor == updateInlineBotCallbackQuery::ID) {
+        func(static_cast<updateInlineBotCallbackQuery &>(obj));
+        return true;
+      }
+      break;
+    case 1864:
+      if (constructor == updateChannelParticipant::ID) {
+        func(static_cast<updateChannelParticipant &>(obj));
+        return true;
+      }
+      break;
+    case 1866:
+      if (constructor == baseThemeTinted::ID) {
+        func(static_cast<baseThemeTinted &>(obj));
+        return true;
+      }
+      break;
+    case 1869:
+      if (constructor == inputDialogPeerFolder::ID) {
+        func(static_cast<inputDialogPeerFolder &>(obj));
+        return true;
+      }
+      break;
+    case 1871:
+      if (constructor == privacyKeyPhoneCall::ID) {
+        func(static_cast<privacyKeyPhoneCall &>(obj));
+        return true;
+      }
+      break;
+    case 1872:
+      if (constructor == inlineBotSwitchPM::ID) {
+        func(static_cast<inlineBotSwitchPM &>(obj));
+        return true;
+      }
+      break;
+    case 1879:
+      if (constructor == inputSecureFile::ID) {
+        func(static_cast<inputSecureFile &>(obj));
+        return true;
+      }
+      break;
+    case 1883:
+      if (constructor == inputMediaUploadedPhoto::ID) {
+        func(static_cast<inputMediaUploadedPhoto &>(obj));
+        return true;
+      }
+      break;
+    case 1885:
+      if (constructor == dialogPeer::ID) {
+        func(static_cast<dialogPeer &>(obj));
+        return true;
+      }
+      if (constructor == auth_loginToken::ID) {
+        func(static_cast<auth_loginToken &>(obj));
+        return true;
+      }
+      break;
+    case 1889:
+      if (constructor == stats_megagroupStats::ID) {
+        func(static_cast<stats_megagroupStats &>(obj));
+        return true;
+      }
+      break;
+    case 1895:
+      if (constructor == inputPrivacyKeyPhoneNumber::ID) {
+        func(static_cast<inputPrivacyKeyPhoneNumber &>(obj));
+        return true;
+      }
+      break;
+    case 1897:
+      if (constructor == messages_chatFull::ID) {
+        func(static_cast<messages_chatFull &>(obj));
+        return true;
+      }
+      break;
+    case 1900:
+      if (constructor == documentEmpty::ID) {
+        func(static_cast<documentEmpty &>(obj));
+        return true;
+      }
+      break;
+    case 1903:
+      if (constructor == updateGroupCall::ID) {
+        func(static_cast<updateGroupCall &>(obj));
+        return true;
+      }
+      break;
+    case 1905:
+      if (constructor == langPackStringPluralized::ID) {
+        func(static_cast<langPackStringPluralized &>(obj));
+        return true;
+      }
+      break;
+    case 1909:
+      if (constructor == updateServiceNotification::ID) {
+        func(static_cast<updateServiceNotification &>(obj));
+        return true;
+      }
+      if (constructor == updateReadChannelInbox::ID) {
+        func(static_cast<updateReadChannelInbox &>(obj));
+        return true;
+      }
+      break;
+    case 1910:
+      if (constructor == inputSecureValue::ID) {
+        func(static_cast<inputSecureValue &>(obj));
+        return true;
+      }
+      break;
+    case 1912:
+      if (constructor == secureFileEmpty::ID) {
+        func(static_cast<secureFileEmpty &>(obj));
+        return true;
+      }
+      break;
+    case 1916:
+      if (constructor == shippingOption::ID) {
+        func(static_cast<shippingOption &>(obj));
+        return true;
+      }
+      break;
+    case 1918:
+      if (constructor == inputChannelFromMessage::ID) {
+        func(static_cast<inputChannelFromMessage &>(obj));
+        return true;
+      }
+      if (constructor == messageEntityCashtag::ID) {
+        func(static_cast<messageEntityCashtag &>(obj));
+        return true;
+      }
+      break;
+    case 1920:
+      if (constructor == channelAdminLogEventActionEditMessage::ID) {
+        func(static_cast<channelAdminLogEventActionEditMessage &>(obj));
+        return true;
+      }
+      break;
+    case 1923:
+      if (constructor == sendMessageTypingAction::ID) {
+        func(static_cast<sendMessageTypingAction &>(obj));
+        return true;
+      }
+      break;
+    case 1926:
+      if (constructor == pageBlockAnchor::ID) {
+        func(static_cast<pageBlockAnchor &>(obj));
+        return true;
+      }
+      if (constructor == recentMeUrlUnknown::ID) {
+        func(static_cast<recentMeUrlUnknown &>(obj));
+        return true;
+      }
+      break;
+    case 1930:
+      if (constructor == messageEntitySpoiler::ID) {
+        func(static_cast<messageEntitySpoiler &>(obj));
+        return true;
+      }
+      break;
+    case 1933:
+      if (constructor == updateStickerSetsOrder::ID) {
+        func(static_cast<updateStickerSetsOrder &>(obj));
+        return true;
+      }
+      break;
+    case 1934:
+      if (constructor == privacyKeyProfilePhoto::ID) {
+        func(static_cast<privacyKeyProfilePhoto &>(obj));
+        return true;
+      }
+      break;
+    case 1935:
+      if (constructor == encryptedFileEmpty::ID) {
+        func(static_cast<encryptedFileEmpty &>(obj));
+        return true;
+      }
+      break;
+    case 1941:
+      if (constructor == inputBotInlineMessageID::ID) {
+        func(static_cast<inputBotInlineMessageID &>(obj));
+        return true;
+      }
+      break;
+    case 1942:
+      if (constructor == updatesCombined::ID) {
+        func(static_cast<updatesCombined &>(obj));
+        return true;
+      }
+      break;
+    case 1947:
+      if (constructor == pageBlockPhoto::ID) {
+        func(static_cast<pageBlockPhoto &>(obj));
+        return true;
+      }
+      break;
+    case 1948:
+      if (constructor == inputPrivacyValueAllowAll::ID) {
+        func(static_cast<inputPrivacyValueAllowAll &>(obj));
+        return true;
+      }
+      break;
+    case 1950:
+      if (constructor == auth_loggedOut::ID) {
+        func(static_cast<auth_loggedOut &>(obj));
+        return true;
+      }
+      break;
+    case 1952:
+      if (constructor == peerChat::ID) {
+        func(static_cast<peerChat &>(obj));
+        return true;
+      }
+      if (constructor == topPeerCategoryBotsInline::ID) {
+        func(static_cast<topPeerCategoryBotsInline &>(obj));
+        return true;
+      }
+      break;
+    case 1961:
+      if (constructor == inlineQueryPeerTypeBroadcast::ID) {
+        func(static_cast<inlineQueryPeerTypeBroadcast &>(obj));
+        return true;
+      }
+      break;
+    case 1966:
+      if (constructor == updateChannelMessageViews::ID) {
+        func(static_cast<updateChannelMessageViews &>(obj));
+        return true;
+      }
+      break;
+    case 1969:
+      if (constructor == channelAdminLogEventActionExportedInviteRevoke::ID) {
+        func(static_cast<channelAdminLogEventActionExportedInviteRevoke &>(obj));
+        return true;
+      }
+      if (constructor == updateChatParticipantDelete::ID) {
+        func(static_cast<updateChatParticipantDelete &>(obj));
+        return true;
+      }
+      break;
+    case 1974:
+      if (constructor == dialogFilterSuggested::ID) {
+        func(static_cast<dialogFilterSuggested &>(obj));
+        return true;
+      }
+      if (constructor == topPeerCategoryGroups::ID) {
+        func(static_cast<topPeerCategoryGroups &>(obj));
+        return true;
+      }
+      break;
+    case 1975:
+      if (constructor == stickerPack::ID) {
+        func(static_cast<stickerPack &>(obj));
+        return true;
+      }
+      break;
+    case 1976:
+      if (constructor == updateLangPack::ID) {
+        func(static_cast<updateLangPack &>(obj));
+        return true;
+      }
+      break;
+    case 1982:
+      if (constructor == inputPhotoLegacyFileLocation::ID) {
+        func(static_cast<inputPhotoLegacyFileLocation &>(obj));
+        return true;
+      }
+      if (constructor == phoneConnection::ID) {
+        func(static_cast<phoneConnection &>(obj));
+        return true;
+      }
+      break;
+    case 1986:
+      if (constructor == help_countryCode::ID) {
+        func(static_cast<help_countryCode &>(obj));
+        return true;
+      }
+      break;
+    case 1989:
+      if (constructor == pageBlockOrderedList::ID) {
+        func(static_cast<pageBlockOrderedList &>(obj));
+        return true;
+      }
+      break;
+    case 1990:
+      if (constructor == messageInteractionCounters::ID) {
+        func(static_cast<messageInteractionCounters &>(obj));
+        return true;
+      }
+      break;
+    case 1991:
+      if (constructor == help_termsOfServiceUpdate::ID) {
+        func(static_cast<help_termsOfServiceUpdate &>(obj));
+        return true;
+      }
+      break;
+    case 1996:
+      if (constructor == paymentSavedCredentialsCard::ID) {
+        func(static_cast<paymentSavedCredentialsCard &>(obj));
+        return true;
+      }
+      break;
+    case 1997:
+      if (constructor == inputMessagesFilterMusic::ID) {
+        func(static_cast<inputMessagesFilterMusic &>(obj));
+        return true;
+      }
+      break;
+    case 1998:
+      if (constructor == help_termsOfService::ID) {
+        func(static_cast<help_termsOfService &>(obj));
+        return true;
+      }
+      break;
+    case 1999:
+      if (constructor == paymentCharge::ID) {
+        func(static_cast<paymentCharge &>(obj));
+        return true;
+      }
+      break;
+    case 2002:
+      if (constructor == emojiURL::ID) {
+        func(static_cast<emojiURL &>(obj));
+        return true;
+      }
+      break;
+    case 2007:
+      if (constructor == updateWebPage::ID) {
+        func(static_cast<updateWebPage &>(obj));
+        return true;
+      }
+      break;
+    case 2008:
+      if (constructor == inputSecureFileUploaded::ID) {
+        func(static_cast<inputSecureFileUploaded &>(obj));
+        return true;
+      }
+      if (constructor == keyboardButtonSwitchInline::ID) {
+        func(static_cast<keyboardButtonSwitchInline &>(obj));
+        return true;
+      }
+      break;
+    case 2009:
+      if (constructor == chatParticipants::ID) {
+        func(static_cast<chatParticipants &>(obj));
+        return true;
+      }
+      if (constructor == webDocumentNoProxy::ID) {
+        func(static_cast<webDocumentNoProxy &>(obj));
+        return true;
+      }
+      break;
+    case 2010:
+      if (constructor == maskCoords::ID) {
+        func(static_cast<maskCoords &>(obj));
+        return true;
+      }
+      break;
+    case 2011:
+      if (constructor == inputMessagesFilterVoice::ID) {
+        func(static_cast<inputMessagesFilterVoice &>(obj));
+        return true;
+      }
+      if (constructor == auth_loginTokenMigrateTo::ID) {
+        func(static_cast<auth_loginTokenMigrateTo &>(obj));
+        return true;
+      }
+      break;
+    case 2014:
+      if (constructor == pageBlockMap::ID) {
+        func(static_cast<pageBlockMap &>(obj));
+        return true;
+      }
+      if (constructor == secureValueError::ID) {
+        func(static_cast<secureValueError &>(obj));
+        return true;
+      }
+      break;
+    case 2015:
+      if (constructor == account_contentSettings::ID) {
+        func(static_cast<account_contentSettings &>(obj));
+        return true;
+      }
+      break;
+    case 2017:
+      if (constructor == keyboardButtonUrl::ID) {
+        func(static_cast<keyboardButtonUrl &>(obj));
+        return true;
+      }
+      break;
+    case 2018:
+      if (constructor == channelParticipantsBanned::ID) {
+        func(static_cast<channelParticipantsBanned &>(obj));
+        return true;
+      }
+      break;
+    case 2020:
+      if (constructor == messages_historyImport::ID) {
+        func(static_cast<messages_historyImport &>(obj));
+        return true;
+      }
+      break;
+    case 2023:
+      if (constructor == inputDialogPeer::ID) {
+        func(static_cast<inputDialogPeer &>(obj));
+        return true;
+      }
+      break;
+    case 2029:
+      if (constructor == sendMessageEmojiInteractionSeen::ID) {
+        func(static_cast<sendMessageEmojiInteractionSeen &>(obj));
+        return true;
+      }
+      break;
+    case 2032:
+      if (constructor == messageUserVoteInputOption::ID) {
+        func(static_cast<messageUserVoteInputOption &>(obj));
+        return true;
+      }
+      break;
+    case 2033:
+      if (constructor == updateDialogPinned::ID) {
+        func(static_cast<updateDialogPinned &>(obj));
+        return true;
+      }
+      break;
+    case 2035:
+      if (constructor == userStatusLastMonth::ID) {
+        func(static_cast<userStatusLastMonth &>(obj));
+        return true;
+      }
+      break;
+    case 2037:
+      if (constructor == inputStickerSetAnimatedEmojiAnimations::ID) {
+        func(static_cast<inputStickerSetAnimatedEmojiAnimations &>(obj));
+        return true;
+      }
+      break;
+    case 2038:
+      if (constructor == textImage::ID) {
+        func(static_cast<textImage &>(obj));
+        return true;
+      }
+      break;
+    case 2042:
+      if (constructor == messageActionChatEditPhoto::ID) {
+        func(static_cast<messageActionChatEditPhoto &>(obj));
+        return true;
+      }
+      break;
+    case 2044:
+      if (constructor == inputPrivacyValueDisallowUsers::ID) {
+        func(static_cast<inputPrivacyValueDisallowUsers &>(obj));
+        return true;
+      }
+      if (constructor == updateRecentStickers::ID) {
+        func(static_cast<updateRecentStickers &>(obj));
+        return true;
+      }
+      break;
+    default:
+      break;
+  }
+  return false;
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(Function &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch ((static_cast<std::uint32_t>(constructor) * 363268893u) >> 22) {
+    case 1:
+      if (constructor == phone_startScheduledGroupCall::ID) {
+        func(static_cast<phone_startScheduledGroupCall &>(obj));
+        return true;
+      }
+      break;
+    case 2:
+      if (constructor == messages_readEncryptedHistory::ID) {
+        func(static_cast<messages_readEncryptedHistory &>(obj));
+        return true;
+      }
+      break;
+    case 5:
+      if (constructor == phone_saveDefaultGroupCallJoinAs::ID) {
+        func(static_cast<phone_saveDefaultGroupCallJoinAs &>(obj));
+        return true;
+      }
+      break;
+    case 6:
+      if (constructor == messages_deleteExportedChatInvite::ID) {
+        func(static_cast<messages_deleteExportedChatInvite &>(obj));
+        return true;
+      }
+      if (constructor == messages_getWebPage::ID) {
+        func(static_cast<messages_getWebPage &>(obj));
+        return true;
+      }
+      break;
+    case 13:
+      if (constructor == account_updateNotifySettings::ID) {
+        func(static_cast<account_updateNotifySettings &>(obj));
+        return true;
+      }
+      break;
+    case 14:
+      if (constructor == channels_deleteMessages::ID) {
+        func(static_cast<channels_deleteMessages &>(obj));
+        return true;
+      }
+      break;
+    case 15:
+      if (constructor == phone_joinGroupCall::ID) {
+        func(static_cast<phone_joinGroupCall &>(obj));
+        return true;
+      }
+      break;
+    case 17:
+      if (constructor == channels_editCreator::ID) {
+        func(static_cast<channels_editCreator &>(obj));
+        return true;
+      }
+      break;
+    case 20:
+      if (constructor == messages_readDiscussion::ID) {
+        func(static_cast<messages_readDiscussion &>(obj));
+        return true;
+      }
+      break;
+    case 27:
+      if (constructor == langpack_getStrings::ID) {
+        func(static_cast<langpack_getStrings &>(obj));
+        return true;
+      }
+      break;
+    case 33:
+      if (constructor == account_getAccountTTL::ID) {
+        func(static_cast<account_getAccountTTL &>(obj));
+        return true;
+      }
+      break;
+    case 34:
+      if (constructor == contacts_resetSaved::ID) {
+        func(static_cast<contacts_resetSaved &>(obj));
+        return true;
+      }
+      break;
+    case 37:
+      if (constructor == messages_editMessage::ID) {
+        func(static_cast<messages_editMessage &>(obj));
+        return true;
+      }
+      if (constructor == stickers_createStickerSet::ID) {
+        func(static_cast<stickers_createStickerSet &>(obj));
+        return true;
+      }
+      break;
+    case 42:
+      if (constructor == phone_getGroupCall::ID) {
+        func(static_cast<phone_getGroupCall &>(obj));
+        return true;
+      }
+      break;
+    case 44:
+      if (constructor == langpack_getLangPack::ID) {
+        func(static_cast<langpack_getLangPack &>(obj));
+        return true;
+      }
+      break;
+    case 47:
+      if (constructor == messages_getDiscussionMessage::ID) {
+        func(static_cast<messages_getDiscussionMessage &>(obj));
+        return true;
+      }
+      break;
+    case 48:
+      if (constructor == channels_getGroupsForDiscussion::ID) {
+        func(static_cast<channels_getGroupsForDiscussion &>(obj));
+        return true;
+      }
+      if (constructor == messages_editChatPhoto::ID) {
+        func(static_cast<messages_editChatPhoto &>(obj));
+        return true;
+      }
+      break;
+    case 50:
+      if (constructor == folders_editPeerFolders::ID) {
+        func(static_cast<folders_editPeerFolders &>(obj));
+        return true;
+      }
+      break;
+    case 53:
+      if (constructor == help_getTermsOfServiceUpdate::ID) {
+        func(static_cast<help_getTermsOfServiceUpdate &>(obj));
+        return true;
+      }
+      break;
+    case 54:
+      if (constructor == messages_getAllStickers::ID) {
+        func(static_cast<messages_getAllStickers &>(obj));
+        return true;
+      }
+      break;
+    case 56:
+      if (constructor == account_cancelPasswordEmail::ID) {
+        func(static_cast<account_cancelPasswordEmail &>(obj));
+        return true;
+      }
+      break;
+    case 59:
+      if (constructor == contacts_getTopPeers::ID) {
+        func(static_cast<contacts_getTopPeers &>(obj));
+        return true;
+      }
+      if (constructor == contacts_resolveUsername::ID) {
+        func(static_cast<contacts_resolveUsername &>(obj));
+        return true;
+      }
+      break;
+    case 61:
+      if (constructor == channels_editTitle::ID) {
+        func(static_cast<channels_editTitle &>(obj));
+        return true;
+      }
+      break;
+    case 64:
+      if (constructor == langpack_getDifference::ID) {
+        func(static_cast<langpack_getDifference &>(obj));
+        return true;
+      }
+      break;
+    case 66:
+      if (constructor == contacts_addContact::ID) {
+        func(static_cast<contacts_addContact &>(obj));
+        return true;
+      }
+      break;
+    case 68:
+      if (constructor == channels_editPhoto::ID) {
+        func(static_cast<channels_editPhoto &>(obj));
+        return true;
+      }
+      if (constructor == messages_requestEncryption::ID) {
+        func(static_cast<messages_requestEncryption &>(obj));
+        return true;
+      }
+      break;
+    case 72:
+      if (constructor == account_resetWebAuthorization::ID) {
+        func(static_cast<account_resetWebAuthorization &>(obj));
+        return true;
+      }
+      if (constructor == channels_editAdmin::ID) {
+        func(static_cast<channels_editAdmin &>(obj));
+        return true;
+      }
+      break;
+    case 76:
+      if (constructor == account_sendVerifyEmailCode::ID) {
+        func(static_cast<account_sendVerifyEmailCode &>(obj));
+        return true;
+      }
+      break;
+    case 86:
+      if (constructor == account_setContentSettings::ID) {
+        func(static_cast<account_setContentSettings &>(obj));
+        return true;
+      }
+      if (constructor == messages_setGameScore::ID) {
+        func(static_cast<messages_setGameScore &>(obj));
+        return true;
+      }
+      break;
+    case 88:
+      if (constructor == contacts_deleteByPhones::ID) {
+        func(static_cast<contacts_deleteByPhones &>(obj));
+        return true;
+      }
+      break;
+    case 89:
+      if (constructor == contacts_importContacts::ID) {
+        func(static_cast<contacts_importContacts &>(obj));
+        return true;
+      }
+      break;
+    case 90:
+      if (constructor == channels_joinChannel::ID) {
+        func(static_cast<channels_joinChannel &>(obj));
+        return true;
+      }
+      break;
+    case 91:
+      if (constructor == channels_readHistory::ID) {
+        func(static_cast<channels_readHistory &>(obj));
+        return true;
+      }
+      break;
+    case 92:
+      if (constructor == channels_deleteParticipantHistory::ID) {
+        func(static_cast<channels_deleteParticipantHistory &>(obj));
+        return true;
+      }
+      break;
+    case 94:
+      if (constructor == messages_deleteMessages::ID) {
+        func(static_cast<messages_deleteMessages &>(obj));
+        return true;
+      }
+      break;
+    case 98:
+      if (constructor == upload_getCdnFileHashes::ID) {
+        func(static_cast<upload_getCdnFileHashes &>(obj));
+        return true;
+      }
+      break;
+    case 99:
+      if (constructor == auth_cancelCode::ID) {
+        func(static_cast<auth_cancelCode &>(obj));
+        return true;
+      }
+      if (constructor == messages_setInlineGameScore::ID) {
+        func(static_cast<messages_setInlineGameScore &>(obj));
+        return true;
+      }
+      break;
+    case 102:
+      if (constructor == channels_getInactiveChannels::ID) {
+        func(static_cast<channels_getInactiveChannels &>(obj));
+        return true;
+      }
+      break;
+    case 104:
+      if (constructor == messages_initHistoryImport::ID) {
+        func(static_cast<messages_initHistoryImport &>(obj));
+        return true;
+      }
+      break;
+    case 105:
+      if (constructor == help_getCountriesList::ID) {
+        func(static_cast<help_getCountriesList &>(obj));
+        return true;
+      }
+      break;
+    case 106:
+      if (constructor == auth_acceptLoginToken::ID) {
+        func(static_cast<auth_acceptLoginToken &>(obj));
+        return true;
+      }
+      break;
+    case 107:
+      if (constructor == account_getNotifyExceptions::ID) {
+        func(static_cast<account_getNotifyExceptions &>(obj));
+        return true;
+      }
+      break;
+    case 108:
+      if (constructor == help_acceptTermsOfService::ID) {
+        func(static_cast<help_acceptTermsOfService &>(obj));
+        return true;
+      }
+      break;
+    case 110:
+      if (constructor == bots_answerWebhookJSONQuery::ID) {
+        func(static_cast<bots_answerWebhookJSONQuery &>(obj));
+        return true;
+      }
+      break;
+    case 111:
+      if (constructor == channels_reportSpam::ID) {
+        func(static_cast<channels_reportSpam &>(obj));
+        return true;
+      }
+      break;
+    case 112:
+      if (constructor == channels_getSponsoredMessages::ID) {
+        func(static_cast<channels_getSponsoredMessages &>(obj));
+        return true;
+      }
+      break;
+    case 119:
+      if (constructor == account_getTheme::ID) {
+        func(static_cast<account_getTheme &>(obj));
+        return true;
+      }
+      if (constructor == auth_resetAuthorizations::ID) {
+        func(static_cast<auth_resetAuthorizations &>(obj));
+        return true;
+      }
+      break;
+    case 121:
+      if (constructor == account_getChatThemes::ID) {
+        func(static_cast<account_getChatThemes &>(obj));
+        return true;
+      }
+      if (constructor == stickers_suggestShortName::ID) {
+        func(static_cast<stickers_suggestShortName &>(obj));
+        return true;
+      }
+      break;
+    case 123:
+      if (constructor == phone_confirmCall::ID) {
+        func(static_cast<phone_confirmCall &>(obj));
+        return true;
+      }
+      break;
+    case 125:
+      if (constructor == channels_getMessages::ID) {
+        func(static_cast<channels_getMessages &>(obj));
+        return true;
+      }
+      break;
+    case 126:
+      if (constructor == account_getPrivacy::ID) {
+        func(static_cast<account_getPrivacy &>(obj));
+        return true;
+      }
+      if (constructor == photos_deletePhotos::ID) {
+        func(static_cast<photos_deletePhotos &>(obj));
+        return true;
+      }
+      break;
+    case 128:
+      if (constructor == contacts_block::ID) {
+        func(static_cast<contacts_block &>(obj));
+        return true;
+      }
+      break;
+    case 131:
+      if (constructor == account_updateStatus::ID) {
+        func(static_cast<account_updateStatus &>(obj));
+        return true;
+      }
+      break;
+    case 135:
+      if (constructor == messages_getEmojiKeywordsLanguages::ID) {
+        func(static_cast<messages_getEmojiKeywordsLanguages &>(obj));
+        return true;
+      }
+      break;
+    case 136:
+      if (constructor == account_acceptAuthorization::ID) {
+        func(static_cast<account_acceptAuthorization &>(obj));
+        return true;
+      }
+      break;
+    case 138:
+      if (constructor == messages_getSplitRanges::ID) {
+        func(static_cast<messages_getSplitRanges &>(obj));
+        return true;
+      }
+      break;
+    case 139:
+      if (constructor == messages_getFavedStickers::ID) {
+        func(static_cast<messages_getFavedStickers &>(obj));
+        return true;
+      }
+      break;
+    case 142:
+      if (constructor == messages_getAdminsWithInvites::ID) {
+        func(static_cast<messages_getAdminsWithInvites &>(obj));
+        return true;
+      }
+      break;
+    case 144:
+      if (constructor == messages_getReplies::ID) {
+        func(static_cast<messages_getReplies &>(obj));
+        return true;
+      }
+      break;
+    case 146:
+      if (constructor == auth_sendCode::ID) {
+        func(static_cast<auth_sendCode &>(obj));
+        return true;
+      }
+      break;
+    case 149:
+      if (constructor == phone_getCallConfig::ID) {
+        func(static_cast<phone_getCallConfig &>(obj));
+        return true;
+      }
+      break;
+    case 154:
+      if (constructor == messages_reportSpam::ID) {
+        func(static_cast<messages_reportSpam &>(obj));
+        return true;
+      }
+      if (constructor == phone_discardCall::ID) {
+        func(static_cast<phone_discardCall &>(obj));
+        return true;
+      }
+      break;
+    case 155:
+      if (constructor == messages_setBotShippingResults::ID) {
+        func(static_cast<messages_setBotShippingResults &>(obj));
+        return true;
+      }
+      break;
+    case 157:
+      if (constructor == messages_hideAllChatJoinRequests::ID) {
+        func(static_cast<messages_hideAllChatJoinRequests &>(obj));
+        return true;
+      }
+      break;
+    case 160:
+      if (constructor == auth_signIn::ID) {
+        func(static_cast<auth_signIn &>(obj));
+        return true;
+      }
+      break;
+    case 161:
+      if (constructor == account_sendChangePhoneCode::ID) {
+        func(static_cast<account_sendChangePhoneCode &>(obj));
+        return true;
+      }
+      break;
+    case 164:
+      if (constructor == photos_getUserPhotos::ID) {
+        func(static_cast<photos_getUserPhotos &>(obj));
+        return true;
+      }
+      break;
+    case 166:
+      if (constructor == upload_getWebFile::ID) {
+        func(static_cast<upload_getWebFile &>(obj));
+        return true;
+      }
+      break;
+    case 170:
+      if (constructor == messages_editChatAbout::ID) {
+        func(static_cast<messages_editChatAbout &>(obj));
+        return true;
+      }
+      break;
+    case 176:
+      if (constructor == account_saveWallPaper::ID) {
+        func(static_cast<account_saveWallPaper &>(obj));
+        return true;
+      }
+      if (constructor == messages_checkHistoryImportPeer::ID) {
+        func(static_cast<messages_checkHistoryImportPeer &>(obj));
+        return true;
+      }
+      break;
+    case 180:
+      if (constructor == account_saveAutoDownloadSettings::ID) {
+        func(static_cast<account_saveAutoDownloadSettings &>(obj));
+        return true;
+      }
+      if (constructor == phone_setCallRating::ID) {
+        func(static_cast<phone_setCallRating &>(obj));
+        return true;
+      }
+      break;
+    case 182:
+      if (constructor == messages_getSuggestedDialogFilters::ID) {
+        func(static_cast<messages_getSuggestedDialogFilters &>(obj));
+        return true;
+      }
+      break;
+    case 183:
+      if (constructor == messages_getAllChats::ID) {
+        func(static_cast<messages_getAllChats &>(obj));
+        return true;
+      }
+      break;
+    case 184:
+      if (constructor == contacts_unblock::ID) {
+        func(static_cast<contacts_unblock &>(obj));
+        return true;
+      }
+      break;
+    case 185:
+      if (constructor == messages_toggleStickerSets::ID) {
+        func(static_cast<messages_toggleStickerSets &>(obj));
+        return true;
+      }
+      break;
+    case 186:
+      if (constructor == phone_sendSignalingData::ID) {
+        func(static_cast<phone_sendSignalingData &>(obj));
+        return true;
+      }
+      break;
+    case 187:
+      if (constructor == channels_setDiscussionGroup::ID) {
+        func(static_cast<channels_setDiscussionGroup &>(obj));
+        return true;
+      }
+      break;
+    case 188:
+      if (constructor == auth_importAuthorization::ID) {
+        func(static_cast<auth_importAuthorization &>(obj));
+        return true;
+      }
+      break;
+    case 197:
+      if (constructor == help_getRecentMeUrls::ID) {
+        func(static_cast<help_getRecentMeUrls &>(obj));
+        return true;
+      }
+      break;
+    case 199:
+      if (constructor == account_updateUsername::ID) {
+        func(static_cast<account_updateUsername &>(obj));
+        return true;
+      }
+      if (constructor == channels_deleteHistory::ID) {
+        func(static_cast<channels_deleteHistory &>(obj));
+        return true;
+      }
+      if (constructor == messages_getSearchResultsPositions::ID) {
+        func(static_cast<messages_getSearchResultsPositions &>(obj));
+        return true;
+      }
+      break;
+    case 201:
+      if (constructor == contacts_acceptContact::ID) {
+        func(static_cast<contacts_acceptContact &>(obj));
+        return true;
+      }
+      break;
+    case 202:
+      if (constructor == account_setGlobalPrivacySettings::ID) {
+        func(static_cast<account_setGlobalPrivacySettings &>(obj));
+        return true;
+      }
+      break;
+    case 205:
+      if (constructor == messages_getSavedGifs::ID) {
+        func(static_cast<messages_getSavedGifs &>(obj));
+        return true;
+      }
+      break;
+    case 206:
+      if (constructor == help_getPassportConfig::ID) {
+        func(static_cast<help_getPassportConfig &>(obj));
+        return true;
+      }
+      break;
+    case 207:
+      if (constructor == phone_discardGroupCall::ID) {
+        func(static_cast<phone_discardGroupCall &>(obj));
+        return true;
+      }
+      break;
+    case 210:
+      if (constructor == stickers_changeStickerPosition::ID) {
+        func(static_cast<stickers_changeStickerPosition &>(obj));
+        return true;
+      }
+      break;
+    case 211:
+      if (constructor == contacts_getContactIDs::ID) {
+        func(static_cast<contacts_getContactIDs &>(obj));
+        return true;
+      }
+      break;
+    case 215:
+      if (constructor == stats_getMessagePublicForwards::ID) {
+        func(static_cast<stats_getMessagePublicForwards &>(obj));
+        return true;
+      }
+      break;
+    case 222:
+      if (constructor == messages_getRecentLocations::ID) {
+        func(static_cast<messages_getRecentLocations &>(obj));
+        return true;
+      }
+      break;
+    case 226:
+      if (constructor == messages_getMessages::ID) {
+        func(static_cast<messages_getMessages &>(obj));
+        return true;
+      }
+      break;
+    case 228:
+      if (constructor == messages_uninstallStickerSet::ID) {
+        func(static_cast<messages_uninstallStickerSet &>(obj));
+        return true;
+      }
+      if (constructor == messages_unpinAllMessages::ID) {
+        func(static_cast<messages_unpinAllMessages &>(obj));
+        return true;
+      }
+      break;
+    case 229:
+      if (constructor == account_sendConfirmPhoneCode::ID) {
+        func(static_cast<account_sendConfirmPhoneCode &>(obj));
+        return true;
+      }
+      break;
+    case 233:
+      if (constructor == account_getWebAuthorizations::ID) {
+        func(static_cast<account_getWebAuthorizations &>(obj));
+        return true;
+      }
+      break;
+    case 241:
+      if (constructor == messages_getMessagesReactions::ID) {
+        func(static_cast<messages_getMessagesReactions &>(obj));
+        return true;
+      }
+      break;
+    case 243:
+      if (constructor == messages_getChatInviteImporters::ID) {
+        func(static_cast<messages_getChatInviteImporters &>(obj));
+        return true;
+      }
+      break;
+    case 248:
+      if (constructor == account_getSecureValue::ID) {
+        func(static_cast<account_getSecureValue &>(obj));
+        return true;
+      }
+      break;
+    case 250:
+      if (constructor == messages_toggleNoForwards::ID) {
+        func(static_cast<messages_toggleNoForwards &>(obj));
+        return true;
+      }
+      break;
+    case 252:
+      if (constructor == account_installTheme::ID) {
+        func(static_cast<account_installTheme &>(obj));
+        return true;
+      }
+      break;
+    case 254:
+      if (constructor == account_uploadWallPaper::ID) {
+        func(static_cast<account_uploadWallPaper &>(obj));
+        return true;
+      }
+      break;
+    case 255:
+      if (constructor == messages_setBotPrecheckoutResults::ID) {
+        func(static_cast<messages_setBotPrecheckoutResults &>(obj));
+        return true;
+      }
+      break;
+    case 260:
+      if (constructor == auth_bindTempAuthKey::ID) {
+        func(static_cast<auth_bindTempAuthKey &>(obj));
+        return true;
+      }
+      if (constructor == bots_resetBotCommands::ID) {
+        func(static_cast<bots_resetBotCommands &>(obj));
+        return true;
+      }
+      break;
+    case 263:
+      if (constructor == messages_getOnlines::ID) {
+        func(static_cast<messages_getOnlines &>(obj));
+        return true;
+      }
+      break;
+    case 269:
+      if (constructor == account_changeAuthorizationSettings::ID) {
+        func(static_cast<account_changeAuthorizationSettings &>(obj));
+        return true;
+      }
+      break;
+    case 271:
+      if (constructor == account_resetWallPapers::ID) {
+        func(static_cast<account_resetWallPapers &>(obj));
+        return true;
+      }
+      break;
+    case 275:
+      if (constructor == messages_faveSticker::ID) {
+        func(static_cast<messages_faveSticker &>(obj));
+        return true;
+      }
+      break;
+    case 278:
+      if (constructor == upload_reuploadCdnFile::ID) {
+        func(static_cast<upload_reuploadCdnFile &>(obj));
+        return true;
+      }
+      break;
+    case 279:
+      if (constructor == messages_getExportedChatInvite::ID) {
+        func(static_cast<messages_getExportedChatInvite &>(obj));
+        return true;
+      }
+      break;
+    case 281:
+      if (constructor == messages_translateText::ID) {
+        func(static_cast<messages_translateText &>(obj));
+        return true;
+      }
+      break;
+    case 284:
+      if (constructor == messages_reorderStickerSets::ID) {
+        func(static_cast<messages_reorderStickerSets &>(obj));
+        return true;
+      }
+      break;
+    case 286:
+      if (constructor == help_getAppConfig::ID) {
+        func(static_cast<help_getAppConfig &>(obj));
+        return true;
+      }
+      break;
+    case 287:
+      if (constructor == channels_editLocation::ID) {
+        func(static_cast<channels_editLocation &>(obj));
+        return true;
+      }
+      break;
+    case 288:
+      if (constructor == channels_getChannels::ID) {
+        func(static_cast<channels_getChannels &>(obj));
+        return true;
+      }
+      break;
+    case 290:
+      if (constructor == folders_deleteFolder::ID) {
+        func(static_cast<folders_deleteFolder &>(obj));
+        return true;
+      }
+      break;
+    case 291:
+      if (constructor == messages_getEmojiKeywordsDifference::ID) {
+        func(static_cast<messages_getEmojiKeywordsDifference &>(obj));
+        return true;
+      }
+      break;
+    case 294:
+      if (constructor == messages_getGameHighScores::ID) {
+        func(static_cast<messages_getGameHighScores &>(obj));
+        return true;
+      }
+      break;
+    case 296:
+      if (constructor == messages_getAllDrafts::ID) {
+        func(static_cast<messages_getAllDrafts &>(obj));
+        return true;
+      }
+      if (constructor == messages_saveDefaultSendAs::ID) {
+        func(static_cast<messages_saveDefaultSendAs &>(obj));
+        return true;
+      }
+      break;
+    case 298:
+      if (constructor == account_resetNotifySettings::ID) {
+        func(static_cast<account_resetNotifySettings &>(obj));
+        return true;
+      }
+      if (constructor == updates_getChannelDifference::ID) {
+        func(static_cast<updates_getChannelDifference &>(obj));
+        return true;
+      }
+      break;
+    case 300:
+      if (constructor == account_getMultiWallPapers::ID) {
+        func(static_cast<account_getMultiWallPapers &>(obj));
+        return true;
+      }
+      break;
+    case 303:
+      if (constructor == messages_getMessagesViews::ID) {
+        func(static_cast<messages_getMessagesViews &>(obj));
+        return true;
+      }
+      break;
+    case 306:
+      if (constructor == messages_report::ID) {
+        func(static_cast<messages_report &>(obj));
+        return true;
+      }
+      break;
+    case 307:
+      if (constructor == messages_updatePinnedMessage::ID) {
+        func(static_cast<messages_updatePinnedMessage &>(obj));
+        return true;
+      }
+      break;
+    case 308:
+      if (constructor == updates_getDifference::ID) {
+        func(static_cast<updates_getDifference &>(obj));
+        return true;
+      }
+      break;
+    case 310:
+      if (constructor == help_dismissSuggestion::ID) {
+        func(static_cast<help_dismissSuggestion &>(obj));
+        return true;
+      }
+      break;
+    case 313:
+      if (constructor == messages_getAvailableReactions::ID) {
+        func(static_cast<messages_getAvailableReactions &>(obj));
+        return true;
+      }
+      break;
+    case 317:
+      if (constructor == help_getDeepLinkInfo::ID) {
+        func(static_cast<help_getDeepLinkInfo &>(obj));
+        return true;
+      }
+      break;
+    case 318:
+      if (constructor == account_deleteAccount::ID) {
+        func(static_cast<account_deleteAccount &>(obj));
+        return true;
+      }
+      break;
+    case 320:
+      if (constructor == account_getAllSecureValues::ID) {
+        func(static_cast<account_getAllSecureValues &>(obj));
+        return true;
+      }
+      break;
+    case 322:
+      if (constructor == test_useError::ID) {
+        func(static_cast<test_useError &>(obj));
+        return true;
+      }
+      break;
+    case 324:
+      if (constructor == account_getAuthorizationForm::ID) {
+        func(static_cast<account_getAuthorizationForm &>(obj));
+        return true;
+      }
+      break;
+    case 325:
+      if (constructor == account_reportProfilePhoto::ID) {
+        func(static_cast<account_reportProfilePhoto &>(obj));
+        return true;
+      }
+      break;
+    case 330:
+      if (constructor == channels_getSendAs::ID) {
+        func(static_cast<channels_getSendAs &>(obj));
+        return true;
+      }
+      break;
+    case 331:
+      if (constructor == auth_requestPasswordRecovery::ID) {
+        func(static_cast<auth_requestPasswordRecovery &>(obj));
+        return true;
+      }
+      break;
+    case 334:
+      if (constructor == messages_sendInlineBotResult::ID) {
+        func(static_cast<messages_sendInlineBotResult &>(obj));
+        return true;
+      }
+      break;
+    case 342:
+      if (constructor == channels_toggleSignatures::ID) {
+        func(static_cast<channels_toggleSignatures &>(obj));
+        return true;
+      }
+      break;
+    case 346:
+      if (constructor == messages_importChatInvite::ID) {
+        func(static_cast<messages_importChatInvite &>(obj));
+        return true;
+      }
+      break;
+    case 352:
+      if (constructor == messages_getPollVotes::ID) {
+        func(static_cast<messages_getPollVotes &>(obj));
+        return true;
+      }
+      break;
+    case 353:
+      if (constructor == updates_getState::ID) {
+        func(static_cast<updates_getState &>(obj));
+        return true;
+      }
+      break;
+    case 354:
+      if (constructor == help_getAppChangelog::ID) {
+        func(static_cast<help_getAppChangelog &>(obj));
+        return true;
+      }
+      break;
+    case 359:
+      if (constructor == messages_startHistoryImport::ID) {
+        func(static_cast<messages_startHistoryImport &>(obj));
+        return true;
+      }
+      break;
+    case 362:
+      if (constructor == account_setContactSignUpNotification::ID) {
+        func(static_cast<account_setContactSignUpNotification &>(obj));
+        return true;
+      }
+      break;
+    case 366:
+      if (constructor == messages_getWebPagePreview::ID) {
+        func(static_cast<messages_getWebPagePreview &>(obj));
+        return true;
+      }
+      break;
+    case 368:
+      if (constructor == account_getWallPaper::ID) {
+        func(static_cast<account_getWallPaper &>(obj));
+        return true;
+      }
+      break;
+    case 372:
+      if (constructor == account_checkUsername::ID) {
+        func(static_cast<account_checkUsername &>(obj));
+        return true;
+      }
+      break;
+    case 375:
+      if (constructor == messages_search::ID) {
+        func(static_cast<messages_search &>(obj));
+        return true;
+      }
+      break;
+    case 377:
+      if (constructor == messages_getMaskStickers::ID) {
+        func(static_cast<messages_getMaskStickers &>(obj));
+        return true;
+      }
+      break;
+    case 380:
+      if (constructor == users_getFullUser::ID) {
+        func(static_cast<users_getFullUser &>(obj));
+        return true;
+      }
+      break;
+    case 384:
+      if (constructor == messages_getExportedChatInvites::ID) {
+        func(static_cast<messages_getExportedChatInvites &>(obj));
+        return true;
+      }
+      break;
+    case 394:
+      if (constructor == phone_editGroupCallParticipant::ID) {
+        func(static_cast<phone_editGroupCallParticipant &>(obj));
+        return true;
+      }
+      break;
+    case 395:
+      if (constructor == contacts_resetTopPeerRating::ID) {
+        func(static_cast<contacts_resetTopPeerRating &>(obj));
+        return true;
+      }
+      break;
+    case 396:
+      if (constructor == messages_getPollResults::ID) {
+        func(static_cast<messages_getPollResults &>(obj));
+        return true;
+      }
+      break;
+    case 399:
+      if (constructor == account_getThemes::ID) {
+        func(static_cast<account_getThemes &>(obj));
+        return true;
+      }
+      break;
+    case 405:
+      if (constructor == account_resetWebAuthorizations::ID) {
+        func(static_cast<account_resetWebAuthorizations &>(obj));
+        return true;
+      }
+      break;
+    case 406:
+      if (constructor == help_getUserInfo::ID) {
+        func(static_cast<help_getUserInfo &>(obj));
+        return true;
+      }
+      break;
+    case 411:
+      if (constructor == messages_getEmojiKeywords::ID) {
+        func(static_cast<messages_getEmojiKeywords &>(obj));
+        return true;
+      }
+      break;
+    case 412:
+      if (constructor == messages_deleteChat::ID) {
+        func(static_cast<messages_deleteChat &>(obj));
+        return true;
+      }
+      break;
+    case 416:
+      if (constructor == messages_getFeaturedStickers::ID) {
+        func(static_cast<messages_getFeaturedStickers &>(obj));
+        return true;
+      }
+      if (constructor == messages_getStickerSet::ID) {
+        func(static_cast<messages_getStickerSet &>(obj));
+        return true;
+      }
+      break;
+    case 420:
+      if (constructor == channels_getAdminLog::ID) {
+        func(static_cast<channels_getAdminLog &>(obj));
+        return true;
+      }
+      break;
+    case 422:
+      if (constructor == messages_requestUrlAuth::ID) {
+        func(static_cast<messages_requestUrlAuth &>(obj));
+        return true;
+      }
+      break;
+    case 426:
+      if (constructor == account_deleteSecureValue::ID) {
+        func(static_cast<account_deleteSecureValue &>(obj));
+        return true;
+      }
+      break;
+    case 433:
+      if (constructor == stats_getMessageStats::ID) {
+        func(static_cast<stats_getMessageStats &>(obj));
+        return true;
+      }
+      break;
+    case 437:
+      if (constructor == phone_exportGroupCallInvite::ID) {
+        func(static_cast<phone_exportGroupCallInvite &>(obj));
+        return true;
+      }
+      break;
+    case 438:
+      if (constructor == account_setPrivacy::ID) {
+        func(static_cast<account_setPrivacy &>(obj));
+        return true;
+      }
+      break;
+    case 439:
+      if (constructor == messages_sendVote::ID) {
+        func(static_cast<messages_sendVote &>(obj));
+        return true;
+      }
+      break;
+    case 444:
+      if (constructor == messages_getDialogUnreadMarks::ID) {
+        func(static_cast<messages_getDialogUnreadMarks &>(obj));
+        return true;
+      }
+      break;
+    case 445:
+      if (constructor == account_getContentSettings::ID) {
+        func(static_cast<account_getContentSettings &>(obj));
+        return true;
+      }
+      if (constructor == messages_readFeaturedStickers::ID) {
+        func(static_cast<messages_readFeaturedStickers &>(obj));
+        return true;
+      }
+      break;
+    case 446:
+      if (constructor == account_getWallPapers::ID) {
+        func(static_cast<account_getWallPapers &>(obj));
+        return true;
+      }
+      break;
+    case 448:
+      if (constructor == messages_getMessageEditData::ID) {
+        func(static_cast<messages_getMessageEditData &>(obj));
+        return true;
+      }
+      break;
+    case 449:
+      if (constructor == messages_receivedQueue::ID) {
+        func(static_cast<messages_receivedQueue &>(obj));
+        return true;
+      }
+      break;
+    case 455:
+      if (constructor == contacts_getContacts::ID) {
+        func(static_cast<contacts_getContacts &>(obj));
+        return true;
+      }
+      break;
+    case 457:
+      if (constructor == channels_toggleSlowMode::ID) {
+        func(static_cast<channels_toggleSlowMode &>(obj));
+        return true;
+      }
+      break;
+    case 458:
+      if (constructor == payments_getSavedInfo::ID) {
+        func(static_cast<payments_getSavedInfo &>(obj));
+        return true;
+      }
+      break;
+    case 459:
+      if (constructor == channels_updateUsername::ID) {
+        func(static_cast<channels_updateUsername &>(obj));
+        return true;
+      }
+      break;
+    case 461:
+      if (constructor == messages_saveGif::ID) {
+        func(static_cast<messages_saveGif &>(obj));
+        return true;
+      }
+      break;
+    case 462:
+      if (constructor == contacts_getLocated::ID) {
+        func(static_cast<contacts_getLocated &>(obj));
+        return true;
+      }
+      if (constructor == messages_getDhConfig::ID) {
+        func(static_cast<messages_getDhConfig &>(obj));
+        return true;
+      }
+      break;
+    case 465:
+      if (constructor == auth_logOut::ID) {
+        func(static_cast<auth_logOut &>(obj));
+        return true;
+      }
+      break;
+    case 467:
+      if (constructor == phone_editGroupCallTitle::ID) {
+        func(static_cast<phone_editGroupCallTitle &>(obj));
+        return true;
+      }
+      break;
+    case 468:
+      if (constructor == account_initTakeoutSession::ID) {
+        func(static_cast<account_initTakeoutSession &>(obj));
+        return true;
+      }
+      if (constructor == messages_acceptEncryption::ID) {
+        func(static_cast<messages_acceptEncryption &>(obj));
+        return true;
+      }
+      break;
+    case 469:
+      if (constructor == test_useConfigSimple::ID) {
+        func(static_cast<test_useConfigSimple &>(obj));
+        return true;
+      }
+      break;
+    case 473:
+      if (constructor == messages_uploadMedia::ID) {
+        func(static_cast<messages_uploadMedia &>(obj));
+        return true;
+      }
+      break;
+    case 480:
+      if (constructor == phone_requestCall::ID) {
+        func(static_cast<phone_requestCall &>(obj));
+        return true;
+      }
+      break;
+    case 482:
+      if (constructor == messages_sendScheduledMessages::ID) {
+        func(static_cast<messages_sendScheduledMessages &>(obj));
+        return true;
+      }
+      break;
+    case 485:
+      if (constructor == messages_setEncryptedTyping::ID) {
+        func(static_cast<messages_setEncryptedTyping &>(obj));
+        return true;
+      }
+      break;
+    case 487:
+      if (constructor == messages_exportChatInvite::ID) {
+        func(static_cast<messages_exportChatInvite &>(obj));
+        return true;
+      }
+      break;
+    case 491:
+      if (constructor == messages_getUnreadMentions::ID) {
+        func(static_cast<messages_getUnreadMentions &>(obj));
+        return true;
+      }
+      break;
+    case 493:
+      if (constructor == account_getAuthorizations::ID) {
+        func(static_cast<account_getAuthorizations &>(obj));
+        return true;
+      }
+      if (constructor == messages_checkHistoryImport::ID) {
+        func(static_cast<messages_checkHistoryImport &>(obj));
+        return true;
+      }
+      break;
+    case 495:
+      if (constructor == messages_markDialogUnread::ID) {
+        func(static_cast<messages_markDialogUnread &>(obj));
+        return true;
+      }
+      break;
+    case 496:
+      if (constructor == messages_migrateChat::ID) {
+        func(static_cast<messages_migrateChat &>(obj));
+        return true;
+      }
+      break;
+    case 504:
+      if (constructor == messages_getOldFeaturedStickers::ID) {
+        func(static_cast<messages_getOldFeaturedStickers &>(obj));
+        return true;
+      }
+      break;
+    case 506:
+      if (constructor == messages_sendMedia::ID) {
+        func(static_cast<messages_sendMedia &>(obj));
+        return true;
+      }
+      break;
+    case 507:
+      if (constructor == channels_viewSponsoredMessage::ID) {
+        func(static_cast<channels_viewSponsoredMessage &>(obj));
+        return true;
+      }
+      break;
+    case 512:
+      if (constructor == phone_inviteToGroupCall::ID) {
+        func(static_cast<phone_inviteToGroupCall &>(obj));
+        return true;
+      }
+      break;
+    case 515:
+      if (constructor == messages_sendMessage::ID) {
+        func(static_cast<messages_sendMessage &>(obj));
+        return true;
+      }
+      if (constructor == messages_uploadEncryptedFile::ID) {
+        func(static_cast<messages_uploadEncryptedFile &>(obj));
+        return true;
+      }
+      break;
+    case 517:
+      if (constructor == messages_sendScreenshotNotification::ID) {
+        func(static_cast<messages_sendScreenshotNotification &>(obj));
+        return true;
+      }
+      break;
+    case 522:
+      if (constructor == bots_sendCustomRequest::ID) {
+        func(static_cast<bots_sendCustomRequest &>(obj));
+        return true;
+      }
+      break;
+    case 525:
+      if (constructor == messages_getPeerSettings::ID) {
+        func(static_cast<messages_getPeerSettings &>(obj));
+        return true;
+      }
+      break;
+    case 527:
+      if (constructor == account_resendPasswordEmail::ID) {
+        func(static_cast<account_resendPasswordEmail &>(obj));
+        return true;
+      }
+      break;
+    case 534:
+      if (constructor == help_getSupportName::ID) {
+        func(static_cast<help_getSupportName &>(obj));
+        return true;
+      }
+      if (constructor == payments_clearSavedInfo::ID) {
+        func(static_cast<payments_clearSavedInfo &>(obj));
+        return true;
+      }
+      if (constructor == users_getUsers::ID) {
+        func(static_cast<users_getUsers &>(obj));
+        return true;
+      }
+      break;
+    case 535:
+      if (constructor == account_registerDevice::ID) {
+        func(static_cast<account_registerDevice &>(obj));
+        return true;
+      }
+      if (constructor == messages_getAttachedStickers::ID) {
+        func(static_cast<messages_getAttachedStickers &>(obj));
+        return true;
+      }
+      if (constructor == phone_createGroupCall::ID) {
+        func(static_cast<phone_createGroupCall &>(obj));
+        return true;
+      }
+      break;
+    case 537:
+      if (constructor == account_verifyEmail::ID) {
+        func(static_cast<account_verifyEmail &>(obj));
+        return true;
+      }
+      break;
+    case 540:
+      if (constructor == account_reportPeer::ID) {
+        func(static_cast<account_reportPeer &>(obj));
+        return true;
+      }
+      break;
+    case 543:
+      if (constructor == photos_updateProfilePhoto::ID) {
+        func(static_cast<photos_updateProfilePhoto &>(obj));
+        return true;
+      }
+      break;
+    case 545:
+      if (constructor == bots_setBotCommands::ID) {
+        func(static_cast<bots_setBotCommands &>(obj));
+        return true;
+      }
+      break;
+    case 549:
+      if (constructor == contacts_blockFromReplies::ID) {
+        func(static_cast<contacts_blockFromReplies &>(obj));
+        return true;
+      }
+      break;
+    case 550:
+      if (constructor == messages_searchGlobal::ID) {
+        func(static_cast<messages_searchGlobal &>(obj));
+        return true;
+      }
+      break;
+    case 553:
+      if (constructor == messages_readMessageContents::ID) {
+        func(static_cast<messages_readMessageContents &>(obj));
+        return true;
+      }
+      break;
+    case 554:
+      if (constructor == help_getAppUpdate::ID) {
+        func(static_cast<help_getAppUpdate &>(obj));
+        return true;
+      }
+      break;
+    case 555:
+      if (constructor == phone_getGroupParticipants::ID) {
+        func(static_cast<phone_getGroupParticipants &>(obj));
+        return true;
+      }
+      break;
+    case 561:
+      if (constructor == account_updateTheme::ID) {
+        func(static_cast<account_updateTheme &>(obj));
+        return true;
+      }
+      break;
+    case 562:
+      if (constructor == account_getContactSignUpNotification::ID) {
+        func(static_cast<account_getContactSignUpNotification &>(obj));
+        return true;
+      }
+      if (constructor == account_getPassword::ID) {
+        func(static_cast<account_getPassword &>(obj));
+        return true;
+      }
+      break;
+    case 563:
+      if (constructor == channels_exportMessageLink::ID) {
+        func(static_cast<channels_exportMessageLink &>(obj));
+        return true;
+      }
+      break;
+    case 564:
+      if (constructor == phone_joinGroupCallPresentation::ID) {
+        func(static_cast<phone_joinGroupCallPresentation &>(obj));
+        return true;
+      }
+      break;
+    case 567:
+      if (constructor == messages_deletePhoneCallHistory::ID) {
+        func(static_cast<messages_deletePhoneCallHistory &>(obj));
+        return true;
+      }
+      if (constructor == messages_deleteScheduledMessages::ID) {
+        func(static_cast<messages_deleteScheduledMessages &>(obj));
+        return true;
+      }
+      break;
+    case 572:
+      if (constructor == upload_saveFilePart::ID) {
+        func(static_cast<upload_saveFilePart &>(obj));
+        return true;
+      }
+      break;
+    case 577:
+      if (constructor == phone_toggleGroupCallRecord::ID) {
+        func(static_cast<phone_toggleGroupCallRecord &>(obj));
+        return true;
+      }
+      break;
+    case 579:
+      if (constructor == auth_recoverPassword::ID) {
+        func(static_cast<auth_recoverPassword &>(obj));
+        return true;
+      }
+      break;
+    case 581:
+      if (constructor == contacts_getStatuses::ID) {
+        func(static_cast<contacts_getStatuses &>(obj));
+        return true;
+      }
+      break;
+    case 584:
+      if (constructor == account_finishTakeoutSession::ID) {
+        func(static_cast<account_finishTakeoutSession &>(obj));
+        return true;
+      }
+      break;
+    case 586:
+      if (constructor == messages_setDefaultReaction::ID) {
+        func(static_cast<messages_setDefaultReaction &>(obj));
+        return true;
+      }
+      break;
+    case 587:
+      if (constructor == messages_hideChatJoinRequest::ID) {
+        func(static_cast<messages_hideChatJoinRequest &>(obj));
+        return true;
+      }
+      break;
+    case 589:
+      if (constructor == messages_readReactions::ID) {
+        func(static_cast<messages_readReactions &>(obj));
+        return true;
+      }
+      break;
+    case 590:
+      if (constructor == phone_saveCallDebug::ID) {
+        func(static_cast<phone_saveCallDebug &>(obj));
+        return true;
+      }
+      break;
+    case 594:
+      if (constructor == messages_setBotCallbackAnswer::ID) {
+        func(static_cast<messages_setBotCallbackAnswer &>(obj));
+        return true;
+      }
+      break;
+    case 600:
+      if (constructor == messages_clearAllDrafts::ID) {
+        func(static_cast<messages_clearAllDrafts &>(obj));
+        return true;
+      }
+      break;
+    case 603:
+      if (constructor == messages_getStickers::ID) {
+        func(static_cast<messages_getStickers &>(obj));
+        return true;
+      }
+      break;
+    case 604:
+      if (constructor == account_getTmpPassword::ID) {
+        func(static_cast<account_getTmpPassword &>(obj));
+        return true;
+      }
+      break;
+    case 605:
+      if (constructor == messages_getMessageReactionsList::ID) {
+        func(static_cast<messages_getMessageReactionsList &>(obj));
+        return true;
+      }
+      if (constructor == stickers_addStickerToSet::ID) {
+        func(static_cast<stickers_addStickerToSet &>(obj));
+        return true;
+      }
+      break;
+    case 610:
+      if (constructor == messages_getScheduledMessages::ID) {
+        func(static_cast<messages_getScheduledMessages &>(obj));
+        return true;
+      }
+      break;
+    case 611:
+      if (constructor == bots_getBotCommands::ID) {
+        func(static_cast<bots_getBotCommands &>(obj));
+        return true;
+      }
+      break;
+    case 618:
+      if (constructor == account_setAuthorizationTTL::ID) {
+        func(static_cast<account_setAuthorizationTTL &>(obj));
+        return true;
+      }
+      break;
+    case 619:
+      if (constructor == phone_receivedCall::ID) {
+        func(static_cast<phone_receivedCall &>(obj));
+        return true;
+      }
+      break;
+    case 623:
+      if (constructor == messages_clearRecentStickers::ID) {
+        func(static_cast<messages_clearRecentStickers &>(obj));
+        return true;
+      }
+      break;
+    case 625:
+      if (constructor == channels_getParticipants::ID) {
+        func(static_cast<channels_getParticipants &>(obj));
+        return true;
+      }
+      break;
+    case 630:
+      if (constructor == messages_deleteRevokedExportedChatInvites::ID) {
+        func(static_cast<messages_deleteRevokedExportedChatInvites &>(obj));
+        return true;
+      }
+      break;
+    case 631:
+      if (constructor == messages_getInlineGameHighScores::ID) {
+        func(static_cast<messages_getInlineGameHighScores &>(obj));
+        return true;
+      }
+      break;
+    case 634:
+      if (constructor == help_setBotUpdatesStatus::ID) {
+        func(static_cast<help_setBotUpdatesStatus &>(obj));
+        return true;
+      }
+      break;
+    case 638:
+      if (constructor == account_getPasswordSettings::ID) {
+        func(static_cast<account_getPasswordSettings &>(obj));
+        return true;
+      }
+      break;
+    case 646:
+      if (constructor == stats_getMegagroupStats::ID) {
+        func(static_cast<stats_getMegagroupStats &>(obj));
+        return true;
+      }
+      break;
+    case 651:
+      if (constructor == messages_getScheduledHistory::ID) {
+        func(static_cast<messages_getScheduledHistory &>(obj));
+        return true;
+      }
+      break;
+    case 652:
+      if (constructor == messages_reportEncryptedSpam::ID) {
+        func(static_cast<messages_reportEncryptedSpam &>(obj));
+        return true;
+      }
+      break;
+    case 658:
+      if (constructor == messages_installStickerSet::ID) {
+        func(static_cast<messages_installStickerSet &>(obj));
+        return true;
+      }
+      break;
+    case 662:
+      if (constructor == messages_hidePeerSettingsBar::ID) {
+        func(static_cast<messages_hidePeerSettingsBar &>(obj));
+        return true;
+      }
+      break;
+    case 668:
+      if (constructor == channels_editBanned::ID) {
+        func(static_cast<channels_editBanned &>(obj));
+        return true;
+      }
+      break;
+    case 670:
+      if (constructor == channels_readMessageContents::ID) {
+        func(static_cast<channels_readMessageContents &>(obj));
+        return true;
+      }
+      break;
+    case 673:
+      if (constructor == channels_setStickers::ID) {
+        func(static_cast<channels_setStickers &>(obj));
+        return true;
+      }
+      if (constructor == messages_setChatAvailableReactions::ID) {
+        func(static_cast<messages_setChatAvailableReactions &>(obj));
+        return true;
+      }
+      break;
+    case 674:
+      if (constructor == account_verifyPhone::ID) {
+        func(static_cast<account_verifyPhone &>(obj));
+        return true;
+      }
+      break;
+    case 677:
+      if (constructor == auth_importLoginToken::ID) {
+        func(static_cast<auth_importLoginToken &>(obj));
+        return true;
+      }
+      break;
+    case 678:
+      if (constructor == messages_getArchivedStickers::ID) {
+        func(static_cast<messages_getArchivedStickers &>(obj));
+        return true;
+      }
+      break;
+    case 691:
+      if (constructor == messages_getInlineBotResults::ID) {
+        func(static_cast<messages_getInlineBotResults &>(obj));
+        return true;
+      }
+      break;
+    case 692:
+      if (constructor == help_editUserInfo::ID) {
+        func(static_cast<help_editUserInfo &>(obj));
+        return true;
+      }
+      break;
+    case 697:
+      if (constructor == auth_checkRecoveryPassword::ID) {
+        func(static_cast<auth_checkRecoveryPassword &>(obj));
+        return true;
+      }
+      break;
+    case 707:
+      if (constructor == account_changePhone::ID) {
+        func(static_cast<account_changePhone &>(obj));
+        return true;
+      }
+      break;
+    case 713:
+      if (constructor == langpack_getLanguages::ID) {
+        func(static_cast<langpack_getLanguages &>(obj));
+        return true;
+      }
+      break;
+    case 714:
+      if (constructor == contacts_toggleTopPeers::ID) {
+        func(static_cast<contacts_toggleTopPeers &>(obj));
+        return true;
+      }
+      break;
+    case 716:
+      if (constructor == messages_readHistory::ID) {
+        func(static_cast<messages_readHistory &>(obj));
+        return true;
+      }
+      break;
+    case 717:
+      if (constructor == account_resetPassword::ID) {
+        func(static_cast<account_resetPassword &>(obj));
+        return true;
+      }
+      break;
+    case 718:
+      if (constructor == help_getInviteText::ID) {
+        func(static_cast<help_getInviteText &>(obj));
+        return true;
+      }
+      break;
+    case 722:
+      if (constructor == account_unregisterDevice::ID) {
+        func(static_cast<account_unregisterDevice &>(obj));
+        return true;
+      }
+      break;
+    case 723:
+      if (constructor == contacts_search::ID) {
+        func(static_cast<contacts_search &>(obj));
+        return true;
+      }
+      break;
+    case 728:
+      if (constructor == account_installWallPaper::ID) {
+        func(static_cast<account_installWallPaper &>(obj));
+        return true;
+      }
+      break;
+    case 729:
+      if (constructor == account_getAutoDownloadSettings::ID) {
+        func(static_cast<account_getAutoDownloadSettings &>(obj));
+        return true;
+      }
+      break;
+    case 730:
+      if (constructor == account_declinePasswordReset::ID) {
+        func(static_cast<account_declinePasswordReset &>(obj));
+        return true;
+      }
+      break;
+    case 732:
+      if (constructor == channels_inviteToChannel::ID) {
+        func(static_cast<channels_inviteToChannel &>(obj));
+        return true;
+      }
+      break;
+    case 733:
+      if (constructor == messages_sendMultiMedia::ID) {
+        func(static_cast<messages_sendMultiMedia &>(obj));
+        return true;
+      }
+      break;
+    case 737:
+      if (constructor == messages_getSearchResultsCalendar::ID) {
+        func(static_cast<messages_getSearchResultsCalendar &>(obj));
+        return true;
+      }
+      break;
+    case 739:
+      if (constructor == auth_exportLoginToken::ID) {
+        func(static_cast<auth_exportLoginToken &>(obj));
+        return true;
+      }
+      break;
+    case 740:
+      if (constructor == help_getConfig::ID) {
+        func(static_cast<help_getConfig &>(obj));
+        return true;
+      }
+      break;
+    case 741:
+      if (constructor == messages_setHistoryTTL::ID) {
+        func(static_cast<messages_setHistoryTTL &>(obj));
+        return true;
+      }
+      break;
+    case 754:
+      if (constructor == channels_convertToGigagroup::ID) {
+        func(static_cast<channels_convertToGigagroup &>(obj));
+        return true;
+      }
+      if (constructor == photos_uploadProfilePhoto::ID) {
+        func(static_cast<photos_uploadProfilePhoto &>(obj));
+        return true;
+      }
+      break;
+    case 759:
+      if (constructor == messages_getCommonChats::ID) {
+        func(static_cast<messages_getCommonChats &>(obj));
+        return true;
+      }
+      if (constructor == stickers_removeStickerFromSet::ID) {
+        func(static_cast<stickers_removeStickerFromSet &>(obj));
+        return true;
+      }
+      break;
+    case 761:
+      if (constructor == messages_editChatTitle::ID) {
+        func(static_cast<messages_editChatTitle &>(obj));
+        return true;
+      }
+      if (constructor == messages_editExportedChatInvite::ID) {
+        func(static_cast<messages_editExportedChatInvite &>(obj));
+        return true;
+      }
+      break;
+    case 763:
+      if (constructor == stickers_setStickerSetThumb::ID) {
+        func(static_cast<stickers_setStickerSetThumb &>(obj));
+        return true;
+      }
+      break;
+    case 774:
+      if (constructor == contacts_deleteContacts::ID) {
+        func(static_cast<contacts_deleteContacts &>(obj));
+        return true;
+      }
+      break;
+    case 775:
+      if (constructor == contacts_getSaved::ID) {
+        func(static_cast<contacts_getSaved &>(obj));
+        return true;
+      }
+      break;
+    case 777:
+      if (constructor == upload_getFile::ID) {
+        func(static_cast<upload_getFile &>(obj));
+        return true;
+      }
+      break;
+    case 778:
+      if (constructor == messages_setChatTheme::ID) {
+        func(static_cast<messages_setChatTheme &>(obj));
+        return true;
+      }
+      break;
+    case 779:
+      if (constructor == messages_getPeerDialogs::ID) {
+        func(static_cast<messages_getPeerDialogs &>(obj));
+        return true;
+      }
+      break;
+    case 783:
+      if (constructor == messages_editChatAdmin::ID) {
+        func(static_cast<messages_editChatAdmin &>(obj));
+        return true;
+      }
+      break;
+    case 784:
+      if (constructor == account_saveTheme::ID) {
+        func(static_cast<account_saveTheme &>(obj));
+        return true;
+      }
+      break;
+    case 785:
+      if (constructor == channels_getParticipant::ID) {
+        func(static_cast<channels_getParticipant &>(obj));
+        return true;
+      }
+      break;
+    case 787:
+      if (constructor == auth_dropTempAuthKeys::ID) {
+        func(static_cast<auth_dropTempAuthKeys &>(obj));
+        return true;
+      }
+      if (constructor == channels_togglePreHistoryHidden::ID) {
+        func(static_cast<channels_togglePreHistoryHidden &>(obj));
+        return true;
+      }
+      break;
+    case 789:
+      if (constructor == channels_getAdminedPublicChannels::ID) {
+        func(static_cast<channels_getAdminedPublicChannels &>(obj));
+        return true;
+      }
+      break;
+    case 790:
+      if (constructor == phone_leaveGroupCallPresentation::ID) {
+        func(static_cast<phone_leaveGroupCallPresentation &>(obj));
+        return true;
+      }
+      break;
+    case 793:
+      if (constructor == account_updateProfile::ID) {
+        func(static_cast<account_updateProfile &>(obj));
+        return true;
+      }
+      break;
+    case 804:
+      if (constructor == phone_acceptCall::ID) {
+        func(static_cast<phone_acceptCall &>(obj));
+        return true;
+      }
+      break;
+    case 805:
+      if (constructor == messages_saveRecentSticker::ID) {
+        func(static_cast<messages_saveRecentSticker &>(obj));
+        return true;
+      }
+      break;
+    case 806:
+      if (constructor == help_getPromoData::ID) {
+        func(static_cast<help_getPromoData &>(obj));
+        return true;
+      }
+      break;
+    case 809:
+      if (constructor == upload_getCdnFile::ID) {
+        func(static_cast<upload_getCdnFile &>(obj));
+        return true;
+      }
+      break;
+    case 816:
+      if (constructor == channels_createChannel::ID) {
+        func(static_cast<channels_createChannel &>(obj));
+        return true;
+      }
+      break;
+    case 823:
+      if (constructor == messages_uploadImportedMedia::ID) {
+        func(static_cast<messages_uploadImportedMedia &>(obj));
+        return true;
+      }
+      break;
+    case 825:
+      if (constructor == stats_getBroadcastStats::ID) {
+        func(static_cast<stats_getBroadcastStats &>(obj));
+        return true;
+      }
+      break;
+    case 828:
+      if (constructor == account_createTheme::ID) {
+        func(static_cast<account_createTheme &>(obj));
+        return true;
+      }
+      if (constructor == messages_updateDialogFilter::ID) {
+        func(static_cast<messages_updateDialogFilter &>(obj));
+        return true;
+      }
+      break;
+    case 830:
+      if (constructor == messages_getMessageReadParticipants::ID) {
+        func(static_cast<messages_getMessageReadParticipants &>(obj));
+        return true;
+      }
+      break;
+    case 833:
+      if (constructor == auth_checkPassword::ID) {
+        func(static_cast<auth_checkPassword &>(obj));
+        return true;
+      }
+      break;
+    case 836:
+      if (constructor == help_getNearestDc::ID) {
+        func(static_cast<help_getNearestDc &>(obj));
+        return true;
+      }
+      if (constructor == phone_checkGroupCall::ID) {
+        func(static_cast<phone_checkGroupCall &>(obj));
+        return true;
+      }
+      break;
+    case 844:
+      if (constructor == messages_acceptUrlAuth::ID) {
+        func(static_cast<messages_acceptUrlAuth &>(obj));
+        return true;
+      }
+      if (constructor == messages_editChatDefaultBannedRights::ID) {
+        func(static_cast<messages_editChatDefaultBannedRights &>(obj));
+        return true;
+      }
+      break;
+    case 845:
+      if (constructor == messages_editInlineBotMessage::ID) {
+        func(static_cast<messages_editInlineBotMessage &>(obj));
+        return true;
+      }
+      break;
+    case 846:
+      if (constructor == channels_getFullChannel::ID) {
+        func(static_cast<channels_getFullChannel &>(obj));
+        return true;
+      }
+      break;
+    case 853:
+      if (constructor == messages_updateDialogFiltersOrder::ID) {
+        func(static_cast<messages_updateDialogFiltersOrder &>(obj));
+        return true;
+      }
+      break;
+    case 855:
+      if (constructor == account_updatePasswordSettings::ID) {
+        func(static_cast<account_updatePasswordSettings &>(obj));
+        return true;
+      }
+      break;
+    case 856:
+      if (constructor == account_updateDeviceLocked::ID) {
+        func(static_cast<account_updateDeviceLocked &>(obj));
+        return true;
+      }
+      break;
+    case 859:
+      if (constructor == account_getNotifySettings::ID) {
+        func(static_cast<account_getNotifySettings &>(obj));
+        return true;
+      }
+      break;
+    case 863:
+      if (constructor == channels_checkUsername::ID) {
+        func(static_cast<channels_checkUsername &>(obj));
+        return true;
+      }
+      break;
+    case 864:
+      if (constructor == stickers_checkShortName::ID) {
+        func(static_cast<stickers_checkShortName &>(obj));
+        return true;
+      }
+      break;
+    case 865:
+      if (constructor == messages_checkChatInvite::ID) {
+        func(static_cast<messages_checkChatInvite &>(obj));
+        return true;
+      }
+      break;
+    case 868:
+      if (constructor == upload_getFileHashes::ID) {
+        func(static_cast<upload_getFileHashes &>(obj));
+        return true;
+      }
+      break;
+    case 874:
+      if (constructor == payments_sendPaymentForm::ID) {
+        func(static_cast<payments_sendPaymentForm &>(obj));
+        return true;
+      }
+      break;
+    case 875:
+      if (constructor == messages_addChatUser::ID) {
+        func(static_cast<messages_addChatUser &>(obj));
+        return true;
+      }
+      break;
+    case 876:
+      if (constructor == auth_importBotAuthorization::ID) {
+        func(static_cast<auth_importBotAuthorization &>(obj));
+        return true;
+      }
+      if (constructor == upload_saveBigFilePart::ID) {
+        func(static_cast<upload_saveBigFilePart &>(obj));
+        return true;
+      }
+      break;
+    case 877:
+      if (constructor == messages_getEmojiURL::ID) {
+        func(static_cast<messages_getEmojiURL &>(obj));
+        return true;
+      }
+      break;
+    case 880:
+      if (constructor == messages_getDialogs::ID) {
+        func(static_cast<messages_getDialogs &>(obj));
+        return true;
+      }
+      break;
+    case 884:
+      if (constructor == messages_sendReaction::ID) {
+        func(static_cast<messages_sendReaction &>(obj));
+        return true;
+      }
+      break;
+    case 891:
+      if (constructor == phone_toggleGroupCallSettings::ID) {
+        func(static_cast<phone_toggleGroupCallSettings &>(obj));
+        return true;
+      }
+      break;
+    case 892:
+      if (constructor == messages_toggleDialogPin::ID) {
+        func(static_cast<messages_toggleDialogPin &>(obj));
+        return true;
+      }
+      break;
+    case 893:
+      if (constructor == messages_getRecentStickers::ID) {
+        func(static_cast<messages_getRecentStickers &>(obj));
+        return true;
+      }
+      break;
+    case 895:
+      if (constructor == account_setAccountTTL::ID) {
+        func(static_cast<account_setAccountTTL &>(obj));
+        return true;
+      }
+      break;
+    case 896:
+      if (constructor == users_setSecureValueErrors::ID) {
+        func(static_cast<users_setSecureValueErrors &>(obj));
+        return true;
+      }
+      break;
+    case 897:
+      if (constructor == messages_forwardMessages::ID) {
+        func(static_cast<messages_forwardMessages &>(obj));
+        return true;
+      }
+      break;
+    case 898:
+      if (constructor == help_getCdnConfig::ID) {
+        func(static_cast<help_getCdnConfig &>(obj));
+        return true;
+      }
+      if (constructor == help_hidePromoData::ID) {
+        func(static_cast<help_hidePromoData &>(obj));
+        return true;
+      }
+      break;
+    case 902:
+      if (constructor == messages_createChat::ID) {
+        func(static_cast<messages_createChat &>(obj));
+        return true;
+      }
+      break;
+    case 903:
+      if (constructor == stats_loadAsyncGraph::ID) {
+        func(static_cast<stats_loadAsyncGraph &>(obj));
+        return true;
+      }
+      break;
+    case 906:
+      if (constructor == account_getGlobalPrivacySettings::ID) {
+        func(static_cast<account_getGlobalPrivacySettings &>(obj));
+        return true;
+      }
+      break;
+    case 909:
+      if (constructor == messages_deleteChatUser::ID) {
+        func(static_cast<messages_deleteChatUser &>(obj));
+        return true;
+      }
+      break;
+    case 910:
+      if (constructor == account_resetAuthorization::ID) {
+        func(static_cast<account_resetAuthorization &>(obj));
+        return true;
+      }
+      break;
+    case 911:
+      if (constructor == messages_getDocumentByHash::ID) {
+        func(static_cast<messages_getDocumentByHash &>(obj));
+        return true;
+      }
+      break;
+    case 915:
+      if (constructor == channels_getLeftChannels::ID) {
+        func(static_cast<channels_getLeftChannels &>(obj));
+        return true;
+      }
+      break;
+    case 916:
+      if (constructor == phone_toggleGroupCallStartSubscription::ID) {
+        func(static_cast<phone_toggleGroupCallStartSubscription &>(obj));
+        return true;
+      }
+      break;
+    case 917:
+      if (constructor == phone_getGroupCallJoinAs::ID) {
+        func(static_cast<phone_getGroupCallJoinAs &>(obj));
+        return true;
+      }
+      break;
+    case 920:
+      if (constructor == account_confirmPasswordEmail::ID) {
+        func(static_cast<account_confirmPasswordEmail &>(obj));
+        return true;
+      }
+      break;
+    case 923:
+      if (constructor == phone_leaveGroupCall::ID) {
+        func(static_cast<phone_leaveGroupCall &>(obj));
+        return true;
+      }
+      break;
+    case 925:
+      if (constructor == auth_signUp::ID) {
+        func(static_cast<auth_signUp &>(obj));
+        return true;
+      }
+      break;
+    case 933:
+      if (constructor == help_getSupport::ID) {
+        func(static_cast<help_getSupport &>(obj));
+        return true;
+      }
+      break;
+    case 937:
+      if (constructor == auth_resendCode::ID) {
+        func(static_cast<auth_resendCode &>(obj));
+        return true;
+      }
+      if (constructor == channels_deleteChannel::ID) {
+        func(static_cast<channels_deleteChannel &>(obj));
+        return true;
+      }
+      break;
+    case 938:
+      if (constructor == messages_searchStickerSets::ID) {
+        func(static_cast<messages_searchStickerSets &>(obj));
+        return true;
+      }
+      if (constructor == messages_setInlineBotResults::ID) {
+        func(static_cast<messages_setInlineBotResults &>(obj));
+        return true;
+      }
+      break;
+    case 939:
+      if (constructor == messages_getBotCallbackAnswer::ID) {
+        func(static_cast<messages_getBotCallbackAnswer &>(obj));
+        return true;
+      }
+      if (constructor == payments_getPaymentReceipt::ID) {
+        func(static_cast<payments_getPaymentReceipt &>(obj));
+        return true;
+      }
+      break;
+    case 943:
+      if (constructor == help_saveAppLog::ID) {
+        func(static_cast<help_saveAppLog &>(obj));
+        return true;
+      }
+      break;
+    case 945:
+      if (constructor == payments_getPaymentForm::ID) {
+        func(static_cast<payments_getPaymentForm &>(obj));
+        return true;
+      }
+      break;
+    case 946:
+      if (constructor == messages_startBot::ID) {
+        func(static_cast<messages_startBot &>(obj));
+        return true;
+      }
+      break;
+    case 948:
+      if (constructor == messages_sendEncryptedFile::ID) {
+        func(static_cast<messages_sendEncryptedFile &>(obj));
+        return true;
+      }
+      break;
+    case 949:
+      if (constructor == messages_getFullChat::ID) {
+        func(static_cast<messages_getFullChat &>(obj));
+        return true;
+      }
+      break;
+    case 952:
+      if (constructor == messages_saveDraft::ID) {
+        func(static_cast<messages_saveDraft &>(obj));
+        return true;
+      }
+      break;
+    case 954:
+      if (constructor == messages_sendEncryptedService::ID) {
+        func(static_cast<messages_sendEncryptedService &>(obj));
+        return true;
+      }
+      break;
+    case 955:
+      if (constructor == account_uploadTheme::ID) {
+        func(static_cast<account_uploadTheme &>(obj));
+        return true;
+      }
+      break;
+    case 961:
+      if (constructor == messages_sendEncrypted::ID) {
+        func(static_cast<messages_sendEncrypted &>(obj));
+        return true;
+      }
+      break;
+    case 966:
+      if (constructor == account_sendVerifyPhoneCode::ID) {
+        func(static_cast<account_sendVerifyPhoneCode &>(obj));
+        return true;
+      }
+      break;
+    case 967:
+      if (constructor == langpack_getLanguage::ID) {
+        func(static_cast<langpack_getLanguage &>(obj));
+        return true;
+      }
+      break;
+    case 972:
+      if (constructor == payments_validateRequestedInfo::ID) {
+        func(static_cast<payments_validateRequestedInfo &>(obj));
+        return true;
+      }
+      break;
+    case 976:
+      if (constructor == messages_receivedMessages::ID) {
+        func(static_cast<messages_receivedMessages &>(obj));
+        return true;
+      }
+      break;
+    case 985:
+      if (constructor == auth_exportAuthorization::ID) {
+        func(static_cast<auth_exportAuthorization &>(obj));
+        return true;
+      }
+      if (constructor == messages_getHistory::ID) {
+        func(static_cast<messages_getHistory &>(obj));
+        return true;
+      }
+      break;
+    case 987:
+      if (constructor == messages_deleteHistory::ID) {
+        func(static_cast<messages_deleteHistory &>(obj));
+        return true;
+      }
+      if (constructor == messages_setTyping::ID) {
+        func(static_cast<messages_setTyping &>(obj));
+        return true;
+      }
+      break;
+    case 990:
+      if (constructor == channels_leaveChannel::ID) {
+        func(static_cast<channels_leaveChannel &>(obj));
+        return true;
+      }
+      break;
+    case 991:
+      if (constructor == messages_getUnreadReactions::ID) {
+        func(static_cast<messages_getUnreadReactions &>(obj));
+        return true;
+      }
+      break;
+    case 997:
+      if (constructor == messages_getDialogFilters::ID) {
+        func(static_cast<messages_getDialogFilters &>(obj));
+        return true;
+      }
+      break;
+    case 998:
+      if (constructor == messages_getSearchCounters::ID) {
+        func(static_cast<messages_getSearchCounters &>(obj));
+        return true;
+      }
+      if (constructor == messages_reorderPinnedDialogs::ID) {
+        func(static_cast<messages_reorderPinnedDialogs &>(obj));
+        return true;
+      }
+      break;
+    case 1002:
+      if (constructor == messages_discardEncryption::ID) {
+        func(static_cast<messages_discardEncryption &>(obj));
+        return true;
+      }
+      break;
+    case 1006:
+      if (constructor == messages_readMentions::ID) {
+        func(static_cast<messages_readMentions &>(obj));
+        return true;
+      }
+      break;
+    case 1008:
+      if (constructor == messages_getPinnedDialogs::ID) {
+        func(static_cast<messages_getPinnedDialogs &>(obj));
+        return true;
+      }
+      break;
+    case 1009:
+      if (constructor == messages_getChats::ID) {
+        func(static_cast<messages_getChats &>(obj));
+        return true;
+      }
+      break;
+    case 1011:
+      if (constructor == payments_getBankCardData::ID) {
+        func(static_cast<payments_getBankCardData &>(obj));
+        return true;
+      }
+      break;
+    case 1012:
+      if (constructor == account_confirmPhone::ID) {
+        func(static_cast<account_confirmPhone &>(obj));
+        return true;
+      }
+      if (constructor == contacts_getBlocked::ID) {
+        func(static_cast<contacts_getBlocked &>(obj));
+        return true;
+      }
+      break;
+    case 1019:
+      if (constructor == account_saveSecureValue::ID) {
+        func(static_cast<account_saveSecureValue &>(obj));
+        return true;
+      }
+      break;
+    default:
+      break;
+  }
+  return false;
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(BaseTheme &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case baseThemeClassic::ID:
+      func(static_cast<baseThemeClassic &>(obj));
+      return true;
+    case baseThemeDay::ID:
+      func(static_cast<baseThemeDay &>(obj));
+      return true;
+    case baseThemeNight::ID:
+      func(static_cast<baseThemeNight &>(obj));
+      return true;
+    case baseThemeTinted::ID:
+      func(static_cast<baseThemeTinted &>(obj));
+      return true;
+    case baseThemeArctic::ID:
+      func(static_cast<baseThemeArctic &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(BotCommandScope &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case botCommandScopeDefault::ID:
+      func(static_cast<botCommandScopeDefault &>(obj));
+      return true;
+    case botCommandScopeUsers::ID:
+      func(static_cast<botCommandScopeUsers &>(obj));
+      return true;
+    case botCommandScopeChats::ID:
+      func(static_cast<botCommandScopeChats &>(obj));
+      return true;
+    case botCommandScopeChatAdmins::ID:
+      func(static_cast<botCommandScopeChatAdmins &>(obj));
+      return true;
+    case botCommandScopePeer::ID:
+      func(static_cast<botCommandScopePeer &>(obj));
+      return true;
+    case botCommandScopePeerAdmins::ID:
+      func(static_cast<botCommandScopePeerAdmins &>(obj));
+      return true;
+    case botCommandScopePeerUser::ID:
+      func(static_cast<botCommandScopePeerUser &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(BotInlineMessage &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case botInlineMessageMediaAuto::ID:
+      func(static_cast<botInlineMessageMediaAuto &>(obj));
+      return true;
+    case botInlineMessageText::ID:
+      func(static_cast<botInlineMessageText &>(obj));
+      return true;
+    case botInlineMessageMediaGeo::ID:
+      func(static_cast<botInlineMessageMediaGeo &>(obj));
+      return true;
+    case botInlineMessageMediaVenue::ID:
+      func(static_cast<botInlineMessageMediaVenue &>(obj));
+      return true;
+    case botInlineMessageMediaContact::ID:
+      func(static_cast<botInlineMessageMediaContact &>(obj));
+      return true;
+    case botInlineMessageMediaInvoice::ID:
+      func(static_cast<botInlineMessageMediaInvoice &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(BotInlineResult &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case botInlineResult::ID:
+      func(static_cast<botInlineResult &>(obj));
+      return true;
+    case botInlineMediaResult::ID:
+      func(static_cast<botInlineMediaResult &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(ChannelAdminLogEventAction &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch ((static_cast<std::uint32_t>(constructor) * 2353333221u) >> 25) {
+    case 1:
+      if (constructor == channelAdminLogEventActionChangeTitle::ID) {
+        func(static_cast<channelAdminLogEventActionChangeTitle &>(obj));
+        return true;
+      }
+      break;
+    case 4:
+      if (constructor == channelAdminLogEventActionParticipantUnmute::ID) {
+        func(static_cast<channelAdminLogEventActionParticipantUnmute &>(obj));
+        return true;
+      }
+      break;
+    case 6:
+      if (constructor == channelAdminLogEventActionDeleteMessage::ID) {
+        func(static_cast<channelAdminLogEventActionDeleteMessage &>(obj));
+        return true;
+      }
+      break;
+    case 7:
+      if (constructor == channelAdminLogEventActionParticipantMute::ID) {
+        func(static_cast<channelAdminLogEventActionParticipantMute &>(obj));
+        return true;
+      }
+      break;
+    case 8:
+      if (constructor == channelAdminLogEventActionParticipantJoin::ID) {
+        func(static_cast<channelAdminLogEventActionParticipantJoin &>(obj));
+        return true;
+      }
+      break;
+    case 16:
+      if (constructor == channelAdminLogEventActionChangeLinkedChat::ID) {
+        func(static_cast<channelAdminLogEventActionChangeLinkedChat &>(obj));
+        return true;
+      }
+      break;
+    case 20:
+      if (constructor == channelAdminLogEventActionExportedInviteRevoke::ID) {
+        func(static_cast<channelAdminLogEventActionExportedInviteRevoke &>(obj));
+        return true;
+      }
+      break;
+    case 22:
+      if (constructor == channelAdminLogEventActionStopPoll::ID) {
+        func(static_cast<channelAdminLogEventActionStopPoll &>(obj));
+        return true;
+      }
+      break;
+    case 28:
+      if (constructor == channelAdminLogEventActionToggleInvites::ID) {
+        func(static_cast<channelAdminLogEventActionToggleInvites &>(obj));
+        return true;
+      }
+      break;
+    case 32:
+      if (constructor == channelAdminLogEventActionParticipantJoinByRequest::ID) {
+        func(static_cast<channelAdminLogEventActionParticipantJoinByRequest &>(obj));
+        return true;
+      }
+      break;
+    case 33:
+      if (constructor == channelAdminLogEventActionChangeStickerSet::ID) {
+        func(static_cast<channelAdminLogEventActionChangeStickerSet &>(obj));
+        return true;
+      }
+      break;
+    case 38:
+      if (constructor == channelAdminLogEventActionChangeLocation::ID) {
+        func(static_cast<channelAdminLogEventActionChangeLocation &>(obj));
+        return true;
+      }
+      break;
+    case 39:
+      if (constructor == channelAdminLogEventActionStartGroupCall::ID) {
+        func(static_cast<channelAdminLogEventActionStartGroupCall &>(obj));
+        return true;
+      }
+      break;
+    case 42:
+      if (constructor == channelAdminLogEventActionParticipantVolume::ID) {
+        func(static_cast<channelAdminLogEventActionParticipantVolume &>(obj));
+        return true;
+      }
+      break;
+    case 43:
+      if (constructor == channelAdminLogEventActionChangeHistoryTTL::ID) {
+        func(static_cast<channelAdminLogEventActionChangeHistoryTTL &>(obj));
+        return true;
+      }
+      break;
+    case 50:
+      if (constructor == channelAdminLogEventActionDefaultBannedRights::ID) {
+        func(static_cast<channelAdminLogEventActionDefaultBannedRights &>(obj));
+        return true;
+      }
+      break;
+    case 56:
+      if (constructor == channelAdminLogEventActionToggleSlowMode::ID) {
+        func(static_cast<channelAdminLogEventActionToggleSlowMode &>(obj));
+        return true;
+      }
+      break;
+    case 61:
+      if (constructor == channelAdminLogEventActionDiscardGroupCall::ID) {
+        func(static_cast<channelAdminLogEventActionDiscardGroupCall &>(obj));
+        return true;
+      }
+      break;
+    case 65:
+      if (constructor == channelAdminLogEventActionParticipantToggleBan::ID) {
+        func(static_cast<channelAdminLogEventActionParticipantToggleBan &>(obj));
+        return true;
+      }
+      break;
+    case 66:
+      if (constructor == channelAdminLogEventActionExportedInviteDelete::ID) {
+        func(static_cast<channelAdminLogEventActionExportedInviteDelete &>(obj));
+        return true;
+      }
+      break;
+    case 72:
+      if (constructor == channelAdminLogEventActionChangeUsername::ID) {
+        func(static_cast<channelAdminLogEventActionChangeUsername &>(obj));
+        return true;
+      }
+      break;
+    case 73:
+      if (constructor == channelAdminLogEventActionChangePhoto::ID) {
+        func(static_cast<channelAdminLogEventActionChangePhoto &>(obj));
+        return true;
+      }
+      break;
+    case 75:
+      if (constructor == channelAdminLogEventActionParticipantJoinByInvite::ID) {
+        func(static_cast<channelAdminLogEventActionParticipantJoinByInvite &>(obj));
+        return true;
+      }
+      break;
+    case 76:
+      if (constructor == channelAdminLogEventActionTogglePreHistoryHidden::ID) {
+        func(static_cast<channelAdminLogEventActionTogglePreHistoryHidden &>(obj));
+        return true;
+      }
+      break;
+    case 81:
+      if (constructor == channelAdminLogEventActionParticipantToggleAdmin::ID) {
+        func(static_cast<channelAdminLogEventActionParticipantToggleAdmin &>(obj));
+        return true;
+      }
+      break;
+    case 97:
+      if (constructor == channelAdminLogEventActionToggleGroupCallSetting::ID) {
+        func(static_cast<channelAdminLogEventActionToggleGroupCallSetting &>(obj));
+        return true;
+      }
+      break;
+    case 98:
+      if (constructor == channelAdminLogEventActionToggleNoForwards::ID) {
+        func(static_cast<channelAdminLogEventActionToggleNoForwards &>(obj));
+        return true;
+      }
+      break;
+    case 103:
+      if (constructor == channelAdminLogEventActionChangeAbout::ID) {
+        func(static_cast<channelAdminLogEventActionChangeAbout &>(obj));
+        return true;
+      }
+      break;
+    case 104:
+      if (constructor == channelAdminLogEventActionExportedInviteEdit::ID) {
+        func(static_cast<channelAdminLogEventActionExportedInviteEdit &>(obj));
+        return true;
+      }
+      break;
+    case 105:
+      if (constructor == channelAdminLogEventActionParticipantLeave::ID) {
+        func(static_cast<channelAdminLogEventActionParticipantLeave &>(obj));
+        return true;
+      }
+      break;
+    case 106:
+      if (constructor == channelAdminLogEventActionSendMessage::ID) {
+        func(static_cast<channelAdminLogEventActionSendMessage &>(obj));
+        return true;
+      }
+      break;
+    case 109:
+      if (constructor == channelAdminLogEventActionParticipantInvite::ID) {
+        func(static_cast<channelAdminLogEventActionParticipantInvite &>(obj));
+        return true;
+      }
+      break;
+    case 123:
+      if (constructor == channelAdminLogEventActionUpdatePinned::ID) {
+        func(static_cast<channelAdminLogEventActionUpdatePinned &>(obj));
+        return true;
+      }
+      break;
+    case 124:
+      if (constructor == channelAdminLogEventActionChangeAvailableReactions::ID) {
+        func(static_cast<channelAdminLogEventActionChangeAvailableReactions &>(obj));
+        return true;
+      }
+      break;
+    case 125:
+      if (constructor == channelAdminLogEventActionToggleSignatures::ID) {
+        func(static_cast<channelAdminLogEventActionToggleSignatures &>(obj));
+        return true;
+      }
+      break;
+    case 126:
+      if (constructor == channelAdminLogEventActionEditMessage::ID) {
+        func(static_cast<channelAdminLogEventActionEditMessage &>(obj));
+        return true;
+      }
+      break;
+    default:
+      break;
+  }
+  return false;
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(ChannelLocation &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case channelLocationEmpty::ID:
+      func(static_cast<channelLocationEmpty &>(obj));
+      return true;
+    case channelLocation::ID:
+      func(static_cast<channelLocation &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(ChannelMessagesFilter &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case channelMessagesFilterEmpty::ID:
+      func(static_cast<channelMessagesFilterEmpty &>(obj));
+      return true;
+    case channelMessagesFilter::ID:
+      func(static_cast<channelMessagesFilter &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(ChannelParticipant &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case channelParticipant::ID:
+      func(static_cast<channelParticipant &>(obj));
+      return true;
+    case channelParticipantSelf::ID:
+      func(static_cast<channelParticipantSelf &>(obj));
+      return true;
+    case channelParticipantCreator::ID:
+      func(static_cast<channelParticipantCreator &>(obj));
+      return true;
+    case channelParticipantAdmin::ID:
+      func(static_cast<channelParticipantAdmin &>(obj));
+      return true;
+    case channelParticipantBanned::ID:
+      func(static_cast<channelParticipantBanned &>(obj));
+      return true;
+    case channelParticipantLeft::ID:
+      func(static_cast<channelParticipantLeft &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(ChannelParticipantsFilter &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case channelParticipantsRecent::ID:
+      func(static_cast<channelParticipantsRecent &>(obj));
+      return true;
+    case channelParticipantsAdmins::ID:
+      func(static_cast<channelParticipantsAdmins &>(obj));
+      return true;
+    case channelParticipantsKicked::ID:
+      func(static_cast<channelParticipantsKicked &>(obj));
+      return true;
+    case channelParticipantsBots::ID:
+      func(static_cast<channelParticipantsBots &>(obj));
+      return true;
+    case channelParticipantsBanned::ID:
+      func(static_cast<channelParticipantsBanned &>(obj));
+      return true;
+    case channelParticipantsSearch::ID:
+      func(static_cast<channelParticipantsSearch &>(obj));
+      return true;
+    case channelParticipantsContacts::ID:
+      func(static_cast<channelParticipantsContacts &>(obj));
+      return true;
+    case channelParticipantsMentions::ID:
+      func(static_cast<channelParticipantsMentions &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(Chat &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case chatEmpty::ID:
+      func(static_cast<chatEmpty &>(obj));
+      return true;
+    case chat::ID:
+      func(static_cast<chat &>(obj));
+      return true;
+    case chatForbidden::ID:
+      func(static_cast<chatForbidden &>(obj));
+      return true;
+    case channel::ID:
+      func(static_cast<channel &>(obj));
+      return true;
+    case channelForbidden::ID:
+      func(static_cast<channelForbidden &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(ChatFull &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case chatFull::ID:
+      func(static_cast<chatFull &>(obj));
+      return true;
+    case channelFull::ID:
+      func(static_cast<channelFull &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(ChatInvite &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case chatInviteAlready::ID:
+      func(static_cast<chatInviteAlready &>(obj));
+      return true;
+    case chatInvite::ID:
+      func(static_cast<chatInvite &>(obj));
+      return true;
+    case chatInvitePeek::ID:
+      func(static_cast<chatInvitePeek &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(ChatParticipant &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case chatParticipant::ID:
+      func(static_cast<chatParticipant &>(obj));
+      return true;
+    case chatParticipantCreator::ID:
+      func(static_cast<chatParticipantCreator &>(obj));
+      return true;
+    case chatParticipantAdmin::ID:
+      func(static_cast<chatParticipantAdmin &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(ChatParticipants &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case chatParticipantsForbidden::ID:
+      func(static_cast<chatParticipantsForbidden &>(obj));
+      return true;
+    case chatParticipants::ID:
+      func(static_cast<chatParticipants &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(ChatPhoto &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case chatPhotoEmpty::ID:
+      func(static_cast<chatPhotoEmpty &>(obj));
+      return true;
+    case chatPhoto::ID:
+      func(static_cast<chatPhoto &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(Dialog &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case dialog::ID:
+      func(static_cast<dialog &>(obj));
+      return true;
+    case dialogFolder::ID:
+      func(static_cast<dialogFolder &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(DialogPeer &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case dialogPeer::ID:
+      func(static_cast<dialogPeer &>(obj));
+      return true;
+    case dialogPeerFolder::ID:
+      func(static_cast<dialogPeerFolder &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(Document &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case documentEmpty::ID:
+      func(static_cast<documentEmpty &>(obj));
+      return true;
+    case document::ID:
+      func(static_cast<document &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(DocumentAttribute &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case documentAttributeImageSize::ID:
+      func(static_cast<documentAttributeImageSize &>(obj));
+      return true;
+    case documentAttributeAnimated::ID:
+      func(static_cast<documentAttributeAnimated &>(obj));
+      return true;
+    case documentAttributeSticker::ID:
+      func(static_cast<documentAttributeSticker &>(obj));
+      return true;
+    case documentAttributeVideo::ID:
+      func(static_cast<documentAttributeVideo &>(obj));
+      return true;
+    case documentAttributeAudio::ID:
+      func(static_cast<documentAttributeAudio &>(obj));
+      return true;
+    case documentAttributeFilename::ID:
+      func(static_cast<documentAttributeFilename &>(obj));
+      return true;
+    case documentAttributeHasStickers::ID:
+      func(static_cast<documentAttributeHasStickers &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(DraftMessage &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case draftMessageEmpty::ID:
+      func(static_cast<draftMessageEmpty &>(obj));
+      return true;
+    case draftMessage::ID:
+      func(static_cast<draftMessage &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(EmojiKeyword &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case emojiKeyword::ID:
+      func(static_cast<emojiKeyword &>(obj));
+      return true;
+    case emojiKeywordDeleted::ID:
+      func(static_cast<emojiKeywordDeleted &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(EncryptedChat &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case encryptedChatEmpty::ID:
+      func(static_cast<encryptedChatEmpty &>(obj));
+      return true;
+    case encryptedChatWaiting::ID:
+      func(static_cast<encryptedChatWaiting &>(obj));
+      return true;
+    case encryptedChatRequested::ID:
+      func(static_cast<encryptedChatRequested &>(obj));
+      return true;
+    case encryptedChat::ID:
+      func(static_cast<encryptedChat &>(obj));
+      return true;
+    case encryptedChatDiscarded::ID:
+      func(static_cast<encryptedChatDiscarded &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(EncryptedFile &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case encryptedFileEmpty::ID:
+      func(static_cast<encryptedFileEmpty &>(obj));
+      return true;
+    case encryptedFile::ID:
+      func(static_cast<encryptedFile &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(EncryptedMessage &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case encryptedMessage::ID:
+      func(static_cast<encryptedMessage &>(obj));
+      return true;
+    case encryptedMessageService::ID:
+      func(static_cast<encryptedMessageService &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(GeoPoint &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case geoPointEmpty::ID:
+      func(static_cast<geoPointEmpty &>(obj));
+      return true;
+    case geoPoint::ID:
+      func(static_cast<geoPoint &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(GroupCall &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case groupCallDiscarded::ID:
+      func(static_cast<groupCallDiscarded &>(obj));
+      return true;
+    case groupCall::ID:
+      func(static_cast<groupCall &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(InlineQueryPeerType &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case inlineQueryPeerTypeSameBotPM::ID:
+      func(static_cast<inlineQueryPeerTypeSameBotPM &>(obj));
+      return true;
+    case inlineQueryPeerTypePM::ID:
+      func(static_cast<inlineQueryPeerTypePM &>(obj));
+      return true;
+    case inlineQueryPeerTypeChat::ID:
+      func(static_cast<inlineQueryPeerTypeChat &>(obj));
+      return true;
+    case inlineQueryPeerTypeMegagroup::ID:
+      func(static_cast<inlineQueryPeerTypeMegagroup &>(obj));
+      return true;
+    case inlineQueryPeerTypeBroadcast::ID:
+      func(static_cast<inlineQueryPeerTypeBroadcast &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(InputBotInlineMessage &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case inputBotInlineMessageMediaAuto::ID:
+      func(static_cast<inputBotInlineMessageMediaAuto &>(obj));
+      return true;
+    case inputBotInlineMessageText::ID:
+      func(static_cast<inputBotInlineMessageText &>(obj));
+      return true;
+    case inputBotInlineMessageMediaGeo::ID:
+      func(static_cast<inputBotInlineMessageMediaGeo &>(obj));
+      return true;
+    case inputBotInlineMessageMediaVenue::ID:
+      func(static_cast<inputBotInlineMessageMediaVenue &>(obj));
+      return true;
+    case inputBotInlineMessageMediaContact::ID:
+      func(static_cast<inputBotInlineMessageMediaContact &>(obj));
+      return true;
+    case inputBotInlineMessageGame::ID:
+      func(static_cast<inputBotInlineMessageGame &>(obj));
+      return true;
+    case inputBotInlineMessageMediaInvoice::ID:
+      func(static_cast<inputBotInlineMessageMediaInvoice &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(InputBotInlineMessageID &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case inputBotInlineMessageID::ID:
+      func(static_cast<inputBotInlineMessageID &>(obj));
+      return true;
+    case inputBotInlineMessageID64::ID:
+      func(static_cast<inputBotInlineMessageID64 &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(InputBotInlineResult &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case inputBotInlineResult::ID:
+      func(static_cast<inputBotInlineResult &>(obj));
+      return true;
+    case inputBotInlineResultPhoto::ID:
+      func(static_cast<inputBotInlineResultPhoto &>(obj));
+      return true;
+    case inputBotInlineResultDocument::ID:
+      func(static_cast<inputBotInlineResultDocument &>(obj));
+      return true;
+    case inputBotInlineResultGame::ID:
+      func(static_cast<inputBotInlineResultGame &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(InputChannel &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case inputChannelEmpty::ID:
+      func(static_cast<inputChannelEmpty &>(obj));
+      return true;
+    case inputChannel::ID:
+      func(static_cast<inputChannel &>(obj));
+      return true;
+    case inputChannelFromMessage::ID:
+      func(static_cast<inputChannelFromMessage &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(InputChatPhoto &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case inputChatPhotoEmpty::ID:
+      func(static_cast<inputChatPhotoEmpty &>(obj));
+      return true;
+    case inputChatUploadedPhoto::ID:
+      func(static_cast<inputChatUploadedPhoto &>(obj));
+      return true;
+    case inputChatPhoto::ID:
+      func(static_cast<inputChatPhoto &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(InputCheckPasswordSRP &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case inputCheckPasswordEmpty::ID:
+      func(static_cast<inputCheckPasswordEmpty &>(obj));
+      return true;
+    case inputCheckPasswordSRP::ID:
+      func(static_cast<inputCheckPasswordSRP &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(InputDialogPeer &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case inputDialogPeer::ID:
+      func(static_cast<inputDialogPeer &>(obj));
+      return true;
+    case inputDialogPeerFolder::ID:
+      func(static_cast<inputDialogPeerFolder &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(InputDocument &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case inputDocumentEmpty::ID:
+      func(static_cast<inputDocumentEmpty &>(obj));
+      return true;
+    case inputDocument::ID:
+      func(static_cast<inputDocument &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(InputEncryptedFile &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case inputEncryptedFileEmpty::ID:
+      func(static_cast<inputEncryptedFileEmpty &>(obj));
+      return true;
+    case inputEncryptedFileUploaded::ID:
+      func(static_cast<inputEncryptedFileUploaded &>(obj));
+      return true;
+    case inputEncryptedFile::ID:
+      func(static_cast<inputEncryptedFile &>(obj));
+      return true;
+    case inputEncryptedFileBigUploaded::ID:
+      func(static_cast<inputEncryptedFileBigUploaded &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(InputFile &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case inputFile::ID:
+      func(static_cast<inputFile &>(obj));
+      return true;
+    case inputFileBig::ID:
+      func(static_cast<inputFileBig &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(InputFileLocation &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case inputPeerPhotoFileLocationLegacy::ID:
+      func(static_cast<inputPeerPhotoFileLocationLegacy &>(obj));
+      return true;
+    case inputStickerSetThumbLegacy::ID:
+      func(static_cast<inputStickerSetThumbLegacy &>(obj));
+      return true;
+    case inputFileLocation::ID:
+      func(static_cast<inputFileLocation &>(obj));
+      return true;
+    case inputEncryptedFileLocation::ID:
+      func(static_cast<inputEncryptedFileLocation &>(obj));
+      return true;
+    case inputDocumentFileLocation::ID:
+      func(static_cast<inputDocumentFileLocation &>(obj));
+      return true;
+    case inputSecureFileLocation::ID:
+      func(static_cast<inputSecureFileLocation &>(obj));
+      return true;
+    case inputTakeoutFileLocation::ID:
+      func(static_cast<inputTakeoutFileLocation &>(obj));
+      return true;
+    case inputPhotoFileLocation::ID:
+      func(static_cast<inputPhotoFileLocation &>(obj));
+      return true;
+    case inputPhotoLegacyFileLocation::ID:
+      func(static_cast<inputPhotoLegacyFileLocation &>(obj));
+      return true;
+    case inputPeerPhotoFileLocation::ID:
+      func(static_cast<inputPeerPhotoFileLocation &>(obj));
+      return true;
+    case inputStickerSetThumb::ID:
+      func(static_cast<inputStickerSetThumb &>(obj));
+      return true;
+    case inputGroupCallStream::ID:
+      func(static_cast<inputGroupCallStream &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(InputGame &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case inputGameID::ID:
+      func(static_cast<inputGameID &>(obj));
+      return true;
+    case inputGameShortName::ID:
+      func(static_cast<inputGameShortName &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(InputGeoPoint &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case inputGeoPointEmpty::ID:
+      func(static_cast<inputGeoPointEmpty &>(obj));
+      return true;
+    case inputGeoPoint::ID:
+      func(static_cast<inputGeoPoint &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(InputMedia &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case inputMediaEmpty::ID:
+      func(static_cast<inputMediaEmpty &>(obj));
+      return true;
+    case inputMediaUploadedPhoto::ID:
+      func(static_cast<inputMediaUploadedPhoto &>(obj));
+      return true;
+    case inputMediaPhoto::ID:
+      func(static_cast<inputMediaPhoto &>(obj));
+      return true;
+    case inputMediaGeoPoint::ID:
+      func(static_cast<inputMediaGeoPoint &>(obj));
+      return true;
+    case inputMediaContact::ID:
+      func(static_cast<inputMediaContact &>(obj));
+      return true;
+    case inputMediaUploadedDocument::ID:
+      func(static_cast<inputMediaUploadedDocument &>(obj));
+      return true;
+    case inputMediaDocument::ID:
+      func(static_cast<inputMediaDocument &>(obj));
+      return true;
+    case inputMediaVenue::ID:
+      func(static_cast<inputMediaVenue &>(obj));
+      return true;
+    case inputMediaPhotoExternal::ID:
+      func(static_cast<inputMediaPhotoExternal &>(obj));
+      return true;
+    case inputMediaDocumentExternal::ID:
+      func(static_cast<inputMediaDocumentExternal &>(obj));
+      return true;
+    case inputMediaGame::ID:
+      func(static_cast<inputMediaGame &>(obj));
+      return true;
+    case inputMediaInvoice::ID:
+      func(static_cast<inputMediaInvoice &>(obj));
+      return true;
+    case inputMediaGeoLive::ID:
+      func(static_cast<inputMediaGeoLive &>(obj));
+      return true;
+    case inputMediaPoll::ID:
+      func(static_cast<inputMediaPoll &>(obj));
+      return true;
+    case inputMediaDice::ID:
+      func(static_cast<inputMediaDice &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(InputMessage &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case inputMessageID::ID:
+      func(static_cast<inputMessageID &>(obj));
+      return true;
+    case inputMessageReplyTo::ID:
+      func(static_cast<inputMessageReplyTo &>(obj));
+      return true;
+    case inputMessagePinned::ID:
+      func(static_cast<inputMessagePinned &>(obj));
+      return true;
+    case inputMessageCallbackQuery::ID:
+      func(static_cast<inputMessageCallbackQuery &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(InputNotifyPeer &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case inputNotifyPeer::ID:
+      func(static_cast<inputNotifyPeer &>(obj));
+      return true;
+    case inputNotifyUsers::ID:
+      func(static_cast<inputNotifyUsers &>(obj));
+      return true;
+    case inputNotifyChats::ID:
+      func(static_cast<inputNotifyChats &>(obj));
+      return true;
+    case inputNotifyBroadcasts::ID:
+      func(static_cast<inputNotifyBroadcasts &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(InputPaymentCredentials &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case inputPaymentCredentialsSaved::ID:
+      func(static_cast<inputPaymentCredentialsSaved &>(obj));
+      return true;
+    case inputPaymentCredentials::ID:
+      func(static_cast<inputPaymentCredentials &>(obj));
+      return true;
+    case inputPaymentCredentialsApplePay::ID:
+      func(static_cast<inputPaymentCredentialsApplePay &>(obj));
+      return true;
+    case inputPaymentCredentialsGooglePay::ID:
+      func(static_cast<inputPaymentCredentialsGooglePay &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(InputPeer &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case inputPeerEmpty::ID:
+      func(static_cast<inputPeerEmpty &>(obj));
+      return true;
+    case inputPeerSelf::ID:
+      func(static_cast<inputPeerSelf &>(obj));
+      return true;
+    case inputPeerChat::ID:
+      func(static_cast<inputPeerChat &>(obj));
+      return true;
+    case inputPeerUser::ID:
+      func(static_cast<inputPeerUser &>(obj));
+      return true;
+    case inputPeerChannel::ID:
+      func(static_cast<inputPeerChannel &>(obj));
+      return true;
+    case inputPeerUserFromMessage::ID:
+      func(static_cast<inputPeerUserFromMessage &>(obj));
+      return true;
+    case inputPeerChannelFromMessage::ID:
+      func(static_cast<inputPeerChannelFromMessage &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(InputPhoto &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case inputPhotoEmpty::ID:
+      func(static_cast<inputPhotoEmpty &>(obj));
+      return true;
+    case inputPhoto::ID:
+      func(static_cast<inputPhoto &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(InputPrivacyKey &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case inputPrivacyKeyStatusTimestamp::ID:
+      func(static_cast<inputPrivacyKeyStatusTimestamp &>(obj));
+      return true;
+    case inputPrivacyKeyChatInvite::ID:
+      func(static_cast<inputPrivacyKeyChatInvite &>(obj));
+      return true;
+    case inputPrivacyKeyPhoneCall::ID:
+      func(static_cast<inputPrivacyKeyPhoneCall &>(obj));
+      return true;
+    case inputPrivacyKeyPhoneP2P::ID:
+      func(static_cast<inputPrivacyKeyPhoneP2P &>(obj));
+      return true;
+    case inputPrivacyKeyForwards::ID:
+      func(static_cast<inputPrivacyKeyForwards &>(obj));
+      return true;
+    case inputPrivacyKeyProfilePhoto::ID:
+      func(static_cast<inputPrivacyKeyProfilePhoto &>(obj));
+      return true;
+    case inputPrivacyKeyPhoneNumber::ID:
+      func(static_cast<inputPrivacyKeyPhoneNumber &>(obj));
+      return true;
+    case inputPrivacyKeyAddedByPhone::ID:
+      func(static_cast<inputPrivacyKeyAddedByPhone &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(InputPrivacyRule &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case inputPrivacyValueAllowContacts::ID:
+      func(static_cast<inputPrivacyValueAllowContacts &>(obj));
+      return true;
+    case inputPrivacyValueAllowAll::ID:
+      func(static_cast<inputPrivacyValueAllowAll &>(obj));
+      return true;
+    case inputPrivacyValueAllowUsers::ID:
+      func(static_cast<inputPrivacyValueAllowUsers &>(obj));
+      return true;
+    case inputPrivacyValueDisallowContacts::ID:
+      func(static_cast<inputPrivacyValueDisallowContacts &>(obj));
+      return true;
+    case inputPrivacyValueDisallowAll::ID:
+      func(static_cast<inputPrivacyValueDisallowAll &>(obj));
+      return true;
+    case inputPrivacyValueDisallowUsers::ID:
+      func(static_cast<inputPrivacyValueDisallowUsers &>(obj));
+      return true;
+    case inputPrivacyValueAllowChatParticipants::ID:
+      func(static_cast<inputPrivacyValueAllowChatParticipants &>(obj));
+      return true;
+    case inputPrivacyValueDisallowChatParticipants::ID:
+      func(static_cast<inputPrivacyValueDisallowChatParticipants &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(InputSecureFile &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case inputSecureFileUploaded::ID:
+      func(static_cast<inputSecureFileUploaded &>(obj));
+      return true;
+    case inputSecureFile::ID:
+      func(static_cast<inputSecureFile &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(InputStickerSet &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case inputStickerSetEmpty::ID:
+      func(static_cast<inputStickerSetEmpty &>(obj));
+      return true;
+    case inputStickerSetID::ID:
+      func(static_cast<inputStickerSetID &>(obj));
+      return true;
+    case inputStickerSetShortName::ID:
+      func(static_cast<inputStickerSetShortName &>(obj));
+      return true;
+    case inputStickerSetAnimatedEmoji::ID:
+      func(static_cast<inputStickerSetAnimatedEmoji &>(obj));
+      return true;
+    case inputStickerSetDice::ID:
+      func(static_cast<inputStickerSetDice &>(obj));
+      return true;
+    case inputStickerSetAnimatedEmojiAnimations::ID:
+      func(static_cast<inputStickerSetAnimatedEmojiAnimations &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(InputStickeredMedia &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case inputStickeredMediaPhoto::ID:
+      func(static_cast<inputStickeredMediaPhoto &>(obj));
+      return true;
+    case inputStickeredMediaDocument::ID:
+      func(static_cast<inputStickeredMediaDocument &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(InputTheme &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case inputTheme::ID:
+      func(static_cast<inputTheme &>(obj));
+      return true;
+    case inputThemeSlug::ID:
+      func(static_cast<inputThemeSlug &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(InputUser &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case inputUserEmpty::ID:
+      func(static_cast<inputUserEmpty &>(obj));
+      return true;
+    case inputUserSelf::ID:
+      func(static_cast<inputUserSelf &>(obj));
+      return true;
+    case inputUser::ID:
+      func(static_cast<inputUser &>(obj));
+      return true;
+    case inputUserFromMessage::ID:
+      func(static_cast<inputUserFromMessage &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(InputWallPaper &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case inputWallPaper::ID:
+      func(static_cast<inputWallPaper &>(obj));
+      return true;
+    case inputWallPaperSlug::ID:
+      func(static_cast<inputWallPaperSlug &>(obj));
+      return true;
+    case inputWallPaperNoFile::ID:
+      func(static_cast<inputWallPaperNoFile &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(InputWebFileLocation &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case inputWebFileLocation::ID:
+      func(static_cast<inputWebFileLocation &>(obj));
+      return true;
+    case inputWebFileGeoPointLocation::ID:
+      func(static_cast<inputWebFileGeoPointLocation &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(IpPort &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case ipPort::ID:
+      func(static_cast<ipPort &>(obj));
+      return true;
+    case ipPortSecret::ID:
+      func(static_cast<ipPortSecret &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(JSONValue &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case jsonNull::ID:
+      func(static_cast<jsonNull &>(obj));
+      return true;
+    case jsonBool::ID:
+      func(static_cast<jsonBool &>(obj));
+      return true;
+    case jsonNumber::ID:
+      func(static_cast<jsonNumber &>(obj));
+      return true;
+    case jsonString::ID:
+      func(static_cast<jsonString &>(obj));
+      return true;
+    case jsonArray::ID:
+      func(static_cast<jsonArray &>(obj));
+      return true;
+    case jsonObject::ID:
+      func(static_cast<jsonObject &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(KeyboardButton &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case keyboardButton::ID:
+      func(static_cast<keyboardButton &>(obj));
+      return true;
+    case keyboardButtonUrl::ID:
+      func(static_cast<keyboardButtonUrl &>(obj));
+      return true;
+    case keyboardButtonCallback::ID:
+      func(static_cast<keyboardButtonCallback &>(obj));
+      return true;
+    case keyboardButtonRequestPhone::ID:
+      func(static_cast<keyboardButtonRequestPhone &>(obj));
+      return true;
+    case keyboardButtonRequestGeoLocation::ID:
+      func(static_cast<keyboardButtonRequestGeoLocation &>(obj));
+      return true;
+    case keyboardButtonSwitchInline::ID:
+      func(static_cast<keyboardButtonSwitchInline &>(obj));
+      return true;
+    case keyboardButtonGame::ID:
+      func(static_cast<keyboardButtonGame &>(obj));
+      return true;
+    case keyboardButtonBuy::ID:
+      func(static_cast<keyboardButtonBuy &>(obj));
+      return true;
+    case keyboardButtonUrlAuth::ID:
+      func(static_cast<keyboardButtonUrlAuth &>(obj));
+      return true;
+    case inputKeyboardButtonUrlAuth::ID:
+      func(static_cast<inputKeyboardButtonUrlAuth &>(obj));
+      return true;
+    case keyboardButtonRequestPoll::ID:
+      func(static_cast<keyboardButtonRequestPoll &>(obj));
+      return true;
+    case inputKeyboardButtonUserProfile::ID:
+      func(static_cast<inputKeyboardButtonUserProfile &>(obj));
+      return true;
+    case keyboardButtonUserProfile::ID:
+      func(static_cast<keyboardButtonUserProfile &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(LangPackString &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case langPackString::ID:
+      func(static_cast<langPackString &>(obj));
+      return true;
+    case langPackStringPluralized::ID:
+      func(static_cast<langPackStringPluralized &>(obj));
+      return true;
+    case langPackStringDeleted::ID:
+      func(static_cast<langPackStringDeleted &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(Message &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case messageEmpty::ID:
+      func(static_cast<messageEmpty &>(obj));
+      return true;
+    case message::ID:
+      func(static_cast<message &>(obj));
+      return true;
+    case messageService::ID:
+      func(static_cast<messageService &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(MessageAction &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch ((static_cast<std::uint32_t>(constructor) * 775454513u) >> 26) {
+    case 0:
+      if (constructor == messageActionChatJoinedByRequest::ID) {
+        func(static_cast<messageActionChatJoinedByRequest &>(obj));
+        return true;
+      }
+      break;
+    case 1:
+      if (constructor == messageActionContactSignUp::ID) {
+        func(static_cast<messageActionContactSignUp &>(obj));
+        return true;
+      }
+      break;
+    case 3:
+      if (constructor == messageActionGameScore::ID) {
+        func(static_cast<messageActionGameScore &>(obj));
+        return true;
+      }
+      break;
+    case 4:
+      if (constructor == messageActionChannelMigrateFrom::ID) {
+        func(static_cast<messageActionChannelMigrateFrom &>(obj));
+        return true;
+      }
+      break;
+    case 7:
+      if (constructor == messageActionChatDeleteUser::ID) {
+        func(static_cast<messageActionChatDeleteUser &>(obj));
+        return true;
+      }
+      break;
+    case 11:
+      if (constructor == messageActionChannelCreate::ID) {
+        func(static_cast<messageActionChannelCreate &>(obj));
+        return true;
+      }
+      break;
+    case 13:
+      if (constructor == messageActionChatAddUser::ID) {
+        func(static_cast<messageActionChatAddUser &>(obj));
+        return true;
+      }
+      break;
+    case 16:
+      if (constructor == messageActionPaymentSentMe::ID) {
+        func(static_cast<messageActionPaymentSentMe &>(obj));
+        return true;
+      }
+      break;
+    case 19:
+      if (constructor == messageActionGroupCallScheduled::ID) {
+        func(static_cast<messageActionGroupCallScheduled &>(obj));
+        return true;
+      }
+      break;
+    case 21:
+      if (constructor == messageActionScreenshotTaken::ID) {
+        func(static_cast<messageActionScreenshotTaken &>(obj));
+        return true;
+      }
+      break;
+    case 22:
+      if (constructor == messageActionChatEditTitle::ID) {
+        func(static_cast<messageActionChatEditTitle &>(obj));
+        return true;
+      }
+      break;
+    case 24:
+      if (constructor == messageActionPinMessage::ID) {
+        func(static_cast<messageActionPinMessage &>(obj));
+        return true;
+      }
+      break;
+    case 25:
+      if (constructor == messageActionPaymentSent::ID) {
+        func(static_cast<messageActionPaymentSent &>(obj));
+        return true;
+      }
+      break;
+    case 26:
+      if (constructor == messageActionSecureValuesSentMe::ID) {
+        func(static_cast<messageActionSecureValuesSentMe &>(obj));
+        return true;
+      }
+      break;
+    case 29:
+      if (constructor == messageActionSetChatTheme::ID) {
+        func(static_cast<messageActionSetChatTheme &>(obj));
+        return true;
+      }
+      break;
+    case 30:
+      if (constructor == messageActionInviteToGroupCall::ID) {
+        func(static_cast<messageActionInviteToGroupCall &>(obj));
+        return true;
+      }
+      break;
+    case 31:
+      if (constructor == messageActionChatCreate::ID) {
+        func(static_cast<messageActionChatCreate &>(obj));
+        return true;
+      }
+      break;
+    case 33:
+      if (constructor == messageActionSetMessagesTTL::ID) {
+        func(static_cast<messageActionSetMessagesTTL &>(obj));
+        return true;
+      }
+      break;
+    case 36:
+      if (constructor == messageActionEmpty::ID) {
+        func(static_cast<messageActionEmpty &>(obj));
+        return true;
+      }
+      break;
+    case 42:
+      if (constructor == messageActionChatJoinedByLink::ID) {
+        func(static_cast<messageActionChatJoinedByLink &>(obj));
+        return true;
+      }
+      break;
+    case 44:
+      if (constructor == messageActionChatEditPhoto::ID) {
+        func(static_cast<messageActionChatEditPhoto &>(obj));
+        return true;
+      }
+      break;
+    case 46:
+      if (constructor == messageActionHistoryClear::ID) {
+        func(static_cast<messageActionHistoryClear &>(obj));
+        return true;
+      }
+      break;
+    case 47:
+      if (constructor == messageActionCustomAction::ID) {
+        func(static_cast<messageActionCustomAction &>(obj));
+        return true;
+      }
+      break;
+    case 48:
+      if (constructor == messageActionGroupCall::ID) {
+        func(static_cast<messageActionGroupCall &>(obj));
+        return true;
+      }
+      break;
+    case 52:
+      if (constructor == messageActionSecureValuesSent::ID) {
+        func(static_cast<messageActionSecureValuesSent &>(obj));
+        return true;
+      }
+      break;
+    case 54:
+      if (constructor == messageActionChatDeletePhoto::ID) {
+        func(static_cast<messageActionChatDeletePhoto &>(obj));
+        return true;
+      }
+      break;
+    case 56:
+      if (constructor == messageActionGeoProximityReached::ID) {
+        func(static_cast<messageActionGeoProximityReached &>(obj));
+        return true;
+      }
+      break;
+    case 60:
+      if (constructor == messageActionChatMigrateTo::ID) {
+        func(static_cast<messageActionChatMigrateTo &>(obj));
+        return true;
+      }
+      break;
+    case 61:
+      if (constructor == messageActionPhoneCall::ID) {
+        func(static_cast<messageActionPhoneCall &>(obj));
+        return true;
+      }
+      break;
+    case 62:
+      if (constructor == messageActionBotAllowed::ID) {
+        func(static_cast<messageActionBotAllowed &>(obj));
+        return true;
+      }
+      break;
+    default:
+      break;
+  }
+  return false;
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(MessageEntity &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch ((static_cast<std::uint32_t>(constructor) * 3682059457u) >> 26) {
+    case 2:
+      if (constructor == messageEntityPre::ID) {
+        func(static_cast<messageEntityPre &>(obj));
+        return true;
+      }
+      break;
+    case 3:
+      if (constructor == messageEntityPhone::ID) {
+        func(static_cast<messageEntityPhone &>(obj));
+        return true;
+      }
+      break;
+    case 7:
+      if (constructor == messageEntityUrl::ID) {
+        func(static_cast<messageEntityUrl &>(obj));
+        return true;
+      }
+      break;
+    case 8:
+      if (constructor == messageEntityStrike::ID) {
+        func(static_cast<messageEntityStrike &>(obj));
+        return true;
+      }
+      break;
+    case 13:
+      if (constructor == messageEntityMentionName::ID) {
+        func(static_cast<messageEntityMentionName &>(obj));
+        return true;
+      }
+      break;
+    case 15:
+      if (constructor == inputMessageEntityMentionName::ID) {
+        func(static_cast<inputMessageEntityMentionName &>(obj));
+        return true;
+      }
+      break;
+    case 17:
+      if (constructor == messageEntityBotCommand::ID) {
+        func(static_cast<messageEntityBotCommand &>(obj));
+        return true;
+      }
+      break;
+    case 28:
+      if (constructor == messageEntityBlockquote::ID) {
+        func(static_cast<messageEntityBlockquote &>(obj));
+        return true;
+      }
+      break;
+    case 31:
+      if (constructor == messageEntityHashtag::ID) {
+        func(static_cast<messageEntityHashtag &>(obj));
+        return true;
+      }
+      break;
+    case 32:
+      if (constructor == messageEntityBold::ID) {
+        func(static_cast<messageEntityBold &>(obj));
+        return true;
+      }
+      break;
+    case 33:
+      if (constructor == messageEntityCashtag::ID) {
+        func(static_cast<messageEntityCashtag &>(obj));
+        return true;
+      }
+      break;
+    case 41:
+      if (constructor == messageEntityItalic::ID) {
+        func(static_cast<messageEntityItalic &>(obj));
+        return true;
+      }
+      break;
+    case 42:
+      if (constructor == messageEntityUnderline::ID) {
+        func(static_cast<messageEntityUnderline &>(obj));
+        return true;
+      }
+      break;
+    case 43:
+      if (constructor == messageEntityEmail::ID) {
+        func(static_cast<messageEntityEmail &>(obj));
+        return true;
+      }
+      break;
+    case 44:
+      if (constructor == messageEntityTextUrl::ID) {
+        func(static_cast<messageEntityTextUrl &>(obj));
+        return true;
+      }
+      break;
+    case 50:
+      if (constructor == messageEntityBankCard::ID) {
+        func(static_cast<messageEntityBankCard &>(obj));
+        return true;
+      }
+      break;
+    case 54:
+      if (constructor == messageEntityMention::ID) {
+        func(static_cast<messageEntityMention &>(obj));
+        return true;
+      }
+      break;
+    case 56:
+      if (constructor == messageEntityCode::ID) {
+        func(static_cast<messageEntityCode &>(obj));
+        return true;
+      }
+      break;
+    case 60:
+      if (constructor == messageEntityUnknown::ID) {
+        func(static_cast<messageEntityUnknown &>(obj));
+        return true;
+      }
+      break;
+    case 62:
+      if (constructor == messageEntitySpoiler::ID) {
+        func(static_cast<messageEntitySpoiler &>(obj));
+        return true;
+      }
+      break;
+    default:
+      break;
+  }
+  return false;
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(MessageMedia &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case messageMediaEmpty::ID:
+      func(static_cast<messageMediaEmpty &>(obj));
+      return true;
+    case messageMediaPhoto::ID:
+      func(static_cast<messageMediaPhoto &>(obj));
+      return true;
+    case messageMediaGeo::ID:
+      func(static_cast<messageMediaGeo &>(obj));
+      return true;
+    case messageMediaContact::ID:
+      func(static_cast<messageMediaContact &>(obj));
+      return true;
+    case messageMediaUnsupported::ID:
+      func(static_cast<messageMediaUnsupported &>(obj));
+      return true;
+    case messageMediaDocument::ID:
+      func(static_cast<messageMediaDocument &>(obj));
+      return true;
+    case messageMediaWebPage::ID:
+      func(static_cast<messageMediaWebPage &>(obj));
+      return true;
+    case messageMediaVenue::ID:
+      func(static_cast<messageMediaVenue &>(obj));
+      return true;
+    case messageMediaGame::ID:
+      func(static_cast<messageMediaGame &>(obj));
+      return true;
+    case messageMediaInvoice::ID:
+      func(static_cast<messageMediaInvoice &>(obj));
+      return true;
+    case messageMediaGeoLive::ID:
+      func(static_cast<messageMediaGeoLive &>(obj));
+      return true;
+    case messageMediaPoll::ID:
+      func(static_cast<messageMediaPoll &>(obj));
+      return true;
+    case messageMediaDice::ID:
+      func(static_cast<messageMediaDice &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(MessageUserVote &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case messageUserVote::ID:
+      func(static_cast<messageUserVote &>(obj));
+      return true;
+    case messageUserVoteInputOption::ID:
+      func(static_cast<messageUserVoteInputOption &>(obj));
+      return true;
+    case messageUserVoteMultiple::ID:
+      func(static_cast<messageUserVoteMultiple &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(MessagesFilter &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch ((static_cast<std::uint32_t>(constructor) * 1539026233u) >> 26) {
+    case 3:
+      if (constructor == inputMessagesFilterPinned::ID) {
+        func(static_cast<inputMessagesFilterPinned &>(obj));
+        return true;
+      }
+      break;
+    case 8:
+      if (constructor == inputMessagesFilterDocument::ID) {
+        func(static_cast<inputMessagesFilterDocument &>(obj));
+        return true;
+      }
+      break;
+    case 16:
+      if (constructor == inputMessagesFilterRoundVideo::ID) {
+        func(static_cast<inputMessagesFilterRoundVideo &>(obj));
+        return true;
+      }
+      break;
+    case 21:
+      if (constructor == inputMessagesFilterEmpty::ID) {
+        func(static_cast<inputMessagesFilterEmpty &>(obj));
+        return true;
+      }
+      break;
+    case 22:
+      if (constructor == inputMessagesFilterGeo::ID) {
+        func(static_cast<inputMessagesFilterGeo &>(obj));
+        return true;
+      }
+      break;
+    case 29:
+      if (constructor == inputMessagesFilterPhotoVideo::ID) {
+        func(static_cast<inputMessagesFilterPhotoVideo &>(obj));
+        return true;
+      }
+      break;
+    case 30:
+      if (constructor == inputMessagesFilterPhoneCalls::ID) {
+        func(static_cast<inputMessagesFilterPhoneCalls &>(obj));
+        return true;
+      }
+      break;
+    case 31:
+      if (constructor == inputMessagesFilterPhotos::ID) {
+        func(static_cast<inputMessagesFilterPhotos &>(obj));
+        return true;
+      }
+      break;
+    case 32:
+      if (constructor == inputMessagesFilterChatPhotos::ID) {
+        func(static_cast<inputMessagesFilterChatPhotos &>(obj));
+        return true;
+      }
+      break;
+    case 33:
+      if (constructor == inputMessagesFilterGif::ID) {
+        func(static_cast<inputMessagesFilterGif &>(obj));
+        return true;
+      }
+      break;
+    case 37:
+      if (constructor == inputMessagesFilterMyMentions::ID) {
+        func(static_cast<inputMessagesFilterMyMentions &>(obj));
+        return true;
+      }
+      break;
+    case 40:
+      if (constructor == inputMessagesFilterMusic::ID) {
+        func(static_cast<inputMessagesFilterMusic &>(obj));
+        return true;
+      }
+      break;
+    case 43:
+      if (constructor == inputMessagesFilterContacts::ID) {
+        func(static_cast<inputMessagesFilterContacts &>(obj));
+        return true;
+      }
+      break;
+    case 44:
+      if (constructor == inputMessagesFilterRoundVoice::ID) {
+        func(static_cast<inputMessagesFilterRoundVoice &>(obj));
+        return true;
+      }
+      break;
+    case 49:
+      if (constructor == inputMessagesFilterVideo::ID) {
+        func(static_cast<inputMessagesFilterVideo &>(obj));
+        return true;
+      }
+      break;
+    case 53:
+      if (constructor == inputMessagesFilterUrl::ID) {
+        func(static_cast<inputMessagesFilterUrl &>(obj));
+        return true;
+      }
+      break;
+    case 55:
+      if (constructor == inputMessagesFilterVoice::ID) {
+        func(static_cast<inputMessagesFilterVoice &>(obj));
+        return true;
+      }
+      break;
+    default:
+      break;
+  }
+  return false;
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(NotifyPeer &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case notifyPeer::ID:
+      func(static_cast<notifyPeer &>(obj));
+      return true;
+    case notifyUsers::ID:
+      func(static_cast<notifyUsers &>(obj));
+      return true;
+    case notifyChats::ID:
+      func(static_cast<notifyChats &>(obj));
+      return true;
+    case notifyBroadcasts::ID:
+      func(static_cast<notifyBroadcasts &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(PageBlock &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch ((static_cast<std::uint32_t>(constructor) * 2430576845u) >> 26) {
+    case 0:
+      if (constructor == pageBlockList::ID) {
+        func(static_cast<pageBlockList &>(obj));
+        return true;
+      }
+      break;
+    case 1:
+      if (constructor == pageBlockHeader::ID) {
+        func(static_cast<pageBlockHeader &>(obj));
+        return true;
+      }
+      break;
+    case 4:
+      if (constructor == pageBlockDivider::ID) {
+        func(static_cast<pageBlockDivider &>(obj));
+        return true;
+      }
+      break;
+    case 6:
+      if (constructor == pageBlockUnsupported::ID) {
+        func(static_cast<pageBlockUnsupported &>(obj));
+        return true;
+      }
+      break;
+    case 7:
+      if (constructor == pageBlockFooter::ID) {
+        func(static_cast<pageBlockFooter &>(obj));
+        return true;
+      }
+      break;
+    case 9:
+      if (constructor == pageBlockKicker::ID) {
+        func(static_cast<pageBlockKicker &>(obj));
+        return true;
+      }
+      break;
+    case 10:
+      if (constructor == pageBlockAuthorDate::ID) {
+        func(static_cast<pageBlockAuthorDate &>(obj));
+        return true;
+      }
+      break;
+    case 11:
+      if (constructor == pageBlockAnchor::ID) {
+        func(static_cast<pageBlockAnchor &>(obj));
+        return true;
+      }
+      break;
+    case 14:
+      if (constructor == pageBlockOrderedList::ID) {
+        func(static_cast<pageBlockOrderedList &>(obj));
+        return true;
+      }
+      break;
+    case 17:
+      if (constructor == pageBlockPreformatted::ID) {
+        func(static_cast<pageBlockPreformatted &>(obj));
+        return true;
+      }
+      break;
+    case 21:
+      if (constructor == pageBlockParagraph::ID) {
+        func(static_cast<pageBlockParagraph &>(obj));
+        return true;
+      }
+      break;
+    case 22:
+      if (constructor == pageBlockRelatedArticles::ID) {
+        func(static_cast<pageBlockRelatedArticles &>(obj));
+        return true;
+      }
+      break;
+    case 23:
+      if (constructor == pageBlockCollage::ID) {
+        func(static_cast<pageBlockCollage &>(obj));
+        return true;
+      }
+      break;
+    case 25:
+      if (constructor == pageBlockVideo::ID) {
+        func(static_cast<pageBlockVideo &>(obj));
+        return true;
+      }
+      break;
+    case 28:
+      if (constructor == pageBlockSubtitle::ID) {
+        func(static_cast<pageBlockSubtitle &>(obj));
+        return true;
+      }
+      break;
+    case 30:
+      if (constructor == pageBlockEmbedPost::ID) {
+        func(static_cast<pageBlockEmbedPost &>(obj));
+        return true;
+      }
+      break;
+    case 31:
+      if (constructor == pageBlockBlockquote::ID) {
+        func(static_cast<pageBlockBlockquote &>(obj));
+        return true;
+      }
+      break;
+    case 32:
+      if (constructor == pageBlockSlideshow::ID) {
+        func(static_cast<pageBlockSlideshow &>(obj));
+        return true;
+      }
+      break;
+    case 34:
+      if (constructor == pageBlockPhoto::ID) {
+        func(static_cast<pageBlockPhoto &>(obj));
+        return true;
+      }
+      break;
+    case 41:
+      if (constructor == pageBlockPullquote::ID) {
+        func(static_cast<pageBlockPullquote &>(obj));
+        return true;
+      }
+      break;
+    case 43:
+      if (constructor == pageBlockSubheader::ID) {
+        func(static_cast<pageBlockSubheader &>(obj));
+        return true;
+      }
+      break;
+    case 45:
+      if (constructor == pageBlockEmbed::ID) {
+        func(static_cast<pageBlockEmbed &>(obj));
+        return true;
+      }
+      break;
+    case 46:
+      if (constructor == pageBlockTable::ID) {
+        func(static_cast<pageBlockTable &>(obj));
+        return true;
+      }
+      break;
+    case 47:
+      if (constructor == pageBlockChannel::ID) {
+        func(static_cast<pageBlockChannel &>(obj));
+        return true;
+      }
+      break;
+    case 49:
+      if (constructor == pageBlockCover::ID) {
+        func(static_cast<pageBlockCover &>(obj));
+        return true;
+      }
+      break;
+    case 51:
+      if (constructor == pageBlockMap::ID) {
+        func(static_cast<pageBlockMap &>(obj));
+        return true;
+      }
+      break;
+    case 54:
+      if (constructor == pageBlockAudio::ID) {
+        func(static_cast<pageBlockAudio &>(obj));
+        return true;
+      }
+      break;
+    case 55:
+      if (constructor == pageBlockDetails::ID) {
+        func(static_cast<pageBlockDetails &>(obj));
+        return true;
+      }
+      break;
+    case 62:
+      if (constructor == pageBlockTitle::ID) {
+        func(static_cast<pageBlockTitle &>(obj));
+        return true;
+      }
+      break;
+    default:
+      break;
+  }
+  return false;
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(PageListItem &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case pageListItemText::ID:
+      func(static_cast<pageListItemText &>(obj));
+      return true;
+    case pageListItemBlocks::ID:
+      func(static_cast<pageListItemBlocks &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(PageListOrderedItem &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case pageListOrderedItemText::ID:
+      func(static_cast<pageListOrderedItemText &>(obj));
+      return true;
+    case pageListOrderedItemBlocks::ID:
+      func(static_cast<pageListOrderedItemBlocks &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(PasswordKdfAlgo &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case passwordKdfAlgoUnknown::ID:
+      func(static_cast<passwordKdfAlgoUnknown &>(obj));
+      return true;
+    case passwordKdfAlgoSHA256SHA256PBKDF2HMACSHA512iter100000SHA256ModPow::ID:
+      func(static_cast<passwordKdfAlgoSHA256SHA256PBKDF2HMACSHA512iter100000SHA256ModPow &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(Peer &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case peerUser::ID:
+      func(static_cast<peerUser &>(obj));
+      return true;
+    case peerChat::ID:
+      func(static_cast<peerChat &>(obj));
+      return true;
+    case peerChannel::ID:
+      func(static_cast<peerChannel &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(PeerLocated &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case peerLocated::ID:
+      func(static_cast<peerLocated &>(obj));
+      return true;
+    case peerSelfLocated::ID:
+      func(static_cast<peerSelfLocated &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(PhoneCall &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case phoneCallEmpty::ID:
+      func(static_cast<phoneCallEmpty &>(obj));
+      return true;
+    case phoneCallWaiting::ID:
+      func(static_cast<phoneCallWaiting &>(obj));
+      return true;
+    case phoneCallRequested::ID:
+      func(static_cast<phoneCallRequested &>(obj));
+      return true;
+    case phoneCallAccepted::ID:
+      func(static_cast<phoneCallAccepted &>(obj));
+      return true;
+    case phoneCall::ID:
+      func(static_cast<phoneCall &>(obj));
+      return true;
+    case phoneCallDiscarded::ID:
+      func(static_cast<phoneCallDiscarded &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(PhoneCallDiscardReason &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case phoneCallDiscardReasonMissed::ID:
+      func(static_cast<phoneCallDiscardReasonMissed &>(obj));
+      return true;
+    case phoneCallDiscardReasonDisconnect::ID:
+      func(static_cast<phoneCallDiscardReasonDisconnect &>(obj));
+      return true;
+    case phoneCallDiscardReasonHangup::ID:
+      func(static_cast<phoneCallDiscardReasonHangup &>(obj));
+      return true;
+    case phoneCallDiscardReasonBusy::ID:
+      func(static_cast<phoneCallDiscardReasonBusy &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(PhoneConnection &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case phoneConnection::ID:
+      func(static_cast<phoneConnection &>(obj));
+      return true;
+    case phoneConnectionWebrtc::ID:
+      func(static_cast<phoneConnectionWebrtc &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(Photo &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case photoEmpty::ID:
+      func(static_cast<photoEmpty &>(obj));
+      return true;
+    case photo::ID:
+      func(static_cast<photo &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(PhotoSize &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case photoSizeEmpty::ID:
+      func(static_cast<photoSizeEmpty &>(obj));
+      return true;
+    case photoSize::ID:
+      func(static_cast<photoSize &>(obj));
+      return true;
+    case photoCachedSize::ID:
+      func(static_cast<photoCachedSize &>(obj));
+      return true;
+    case photoStrippedSize::ID:
+      func(static_cast<photoStrippedSize &>(obj));
+      return true;
+    case photoSizeProgressive::ID:
+      func(static_cast<photoSizeProgressive &>(obj));
+      return true;
+    case photoPathSize::ID:
+      func(static_cast<photoPathSize &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(PrivacyKey &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case privacyKeyStatusTimestamp::ID:
+      func(static_cast<privacyKeyStatusTimestamp &>(obj));
+      return true;
+    case privacyKeyChatInvite::ID:
+      func(static_cast<privacyKeyChatInvite &>(obj));
+      return true;
+    case privacyKeyPhoneCall::ID:
+      func(static_cast<privacyKeyPhoneCall &>(obj));
+      return true;
+    case privacyKeyPhoneP2P::ID:
+      func(static_cast<privacyKeyPhoneP2P &>(obj));
+      return true;
+    case privacyKeyForwards::ID:
+      func(static_cast<privacyKeyForwards &>(obj));
+      return true;
+    case privacyKeyProfilePhoto::ID:
+      func(static_cast<privacyKeyProfilePhoto &>(obj));
+      return true;
+    case privacyKeyPhoneNumber::ID:
+      func(static_cast<privacyKeyPhoneNumber &>(obj));
+      return true;
+    case privacyKeyAddedByPhone::ID:
+      func(static_cast<privacyKeyAddedByPhone &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(PrivacyRule &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case privacyValueAllowContacts::ID:
+      func(static_cast<privacyValueAllowContacts &>(obj));
+      return true;
+    case privacyValueAllowAll::ID:
+      func(static_cast<privacyValueAllowAll &>(obj));
+      return true;
+    case privacyValueAllowUsers::ID:
+      func(static_cast<privacyValueAllowUsers &>(obj));
+      return true;
+    case privacyValueDisallowContacts::ID:
+      func(static_cast<privacyValueDisallowContacts &>(obj));
+      return true;
+    case privacyValueDisallowAll::ID:
+      func(static_cast<privacyValueDisallowAll &>(obj));
+      return true;
+    case privacyValueDisallowUsers::ID:
+      func(static_cast<privacyValueDisallowUsers &>(obj));
+      return true;
+    case privacyValueAllowChatParticipants::ID:
+      func(static_cast<privacyValueAllowChatParticipants &>(obj));
+      return true;
+    case privacyValueDisallowChatParticipants::ID:
+      func(static_cast<privacyValueDisallowChatParticipants &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(RecentMeUrl &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case recentMeUrlUnknown::ID:
+      func(static_cast<recentMeUrlUnknown &>(obj));
+      return true;
+    case recentMeUrlUser::ID:
+      func(static_cast<recentMeUrlUser &>(obj));
+      return true;
+    case recentMeUrlChat::ID:
+      func(static_cast<recentMeUrlChat &>(obj));
+      return true;
+    case recentMeUrlChatInvite::ID:
+      func(static_cast<recentMeUrlChatInvite &>(obj));
+      return true;
+    case recentMeUrlStickerSet::ID:
+      func(static_cast<recentMeUrlStickerSet &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(ReplyMarkup &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case replyKeyboardHide::ID:
+      func(static_cast<replyKeyboardHide &>(obj));
+      return true;
+    case replyKeyboardForceReply::ID:
+      func(static_cast<replyKeyboardForceReply &>(obj));
+      return true;
+    case replyKeyboardMarkup::ID:
+      func(static_cast<replyKeyboardMarkup &>(obj));
+      return true;
+    case replyInlineMarkup::ID:
+      func(static_cast<replyInlineMarkup &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(ReportReason &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case inputReportReasonSpam::ID:
+      func(static_cast<inputReportReasonSpam &>(obj));
+      return true;
+    case inputReportReasonViolence::ID:
+      func(static_cast<inputReportReasonViolence &>(obj));
+      return true;
+    case inputReportReasonPornography::ID:
+      func(static_cast<inputReportReasonPornography &>(obj));
+      return true;
+    case inputReportReasonChildAbuse::ID:
+      func(static_cast<inputReportReasonChildAbuse &>(obj));
+      return true;
+    case inputReportReasonOther::ID:
+      func(static_cast<inputReportReasonOther &>(obj));
+      return true;
+    case inputReportReasonCopyright::ID:
+      func(static_cast<inputReportReasonCopyright &>(obj));
+      return true;
+    case inputReportReasonGeoIrrelevant::ID:
+      func(static_cast<inputReportReasonGeoIrrelevant &>(obj));
+      return true;
+    case inputReportReasonFake::ID:
+      func(static_cast<inputReportReasonFake &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(RichText &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch ((static_cast<std::uint32_t>(constructor) * 649999625u) >> 27) {
+    case 5:
+      if (constructor == textAnchor::ID) {
+        func(static_cast<textAnchor &>(obj));
+        return true;
+      }
+      break;
+    case 6:
+      if (constructor == textMarked::ID) {
+        func(static_cast<textMarked &>(obj));
+        return true;
+      }
+      break;
+    case 10:
+      if (constructor == textStrike::ID) {
+        func(static_cast<textStrike &>(obj));
+        return true;
+      }
+      break;
+    case 13:
+      if (constructor == textFixed::ID) {
+        func(static_cast<textFixed &>(obj));
+        return true;
+      }
+      break;
+    case 14:
+      if (constructor == textPlain::ID) {
+        func(static_cast<textPlain &>(obj));
+        return true;
+      }
+      break;
+    case 15:
+      if (constructor == textEmail::ID) {
+        func(static_cast<textEmail &>(obj));
+        return true;
+      }
+      break;
+    case 16:
+      if (constructor == textPhone::ID) {
+        func(static_cast<textPhone &>(obj));
+        return true;
+      }
+      break;
+    case 17:
+      if (constructor == textItalic::ID) {
+        func(static_cast<textItalic &>(obj));
+        return true;
+      }
+      break;
+    case 18:
+      if (constructor == textUnderline::ID) {
+        func(static_cast<textUnderline &>(obj));
+        return true;
+      }
+      break;
+    case 19:
+      if (constructor == textConcat::ID) {
+        func(static_cast<textConcat &>(obj));
+        return true;
+      }
+      break;
+    case 21:
+      if (constructor == textUrl::ID) {
+        func(static_cast<textUrl &>(obj));
+        return true;
+      }
+      break;
+    case 22:
+      if (constructor == textSubscript::ID) {
+        func(static_cast<textSubscript &>(obj));
+        return true;
+      }
+      break;
+    case 25:
+      if (constructor == textBold::ID) {
+        func(static_cast<textBold &>(obj));
+        return true;
+      }
+      break;
+    case 26:
+      if (constructor == textImage::ID) {
+        func(static_cast<textImage &>(obj));
+        return true;
+      }
+      break;
+    case 29:
+      if (constructor == textEmpty::ID) {
+        func(static_cast<textEmpty &>(obj));
+        return true;
+      }
+      break;
+    case 31:
+      if (constructor == textSuperscript::ID) {
+        func(static_cast<textSuperscript &>(obj));
+        return true;
+      }
+      break;
+    default:
+      break;
+  }
+  return false;
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(SecureFile &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case secureFileEmpty::ID:
+      func(static_cast<secureFileEmpty &>(obj));
+      return true;
+    case secureFile::ID:
+      func(static_cast<secureFile &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(SecurePasswordKdfAlgo &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case securePasswordKdfAlgoUnknown::ID:
+      func(static_cast<securePasswordKdfAlgoUnknown &>(obj));
+      return true;
+    case securePasswordKdfAlgoPBKDF2HMACSHA512iter100000::ID:
+      func(static_cast<securePasswordKdfAlgoPBKDF2HMACSHA512iter100000 &>(obj));
+      return true;
+    case securePasswordKdfAlgoSHA512::ID:
+      func(static_cast<securePasswordKdfAlgoSHA512 &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(SecurePlainData &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case securePlainPhone::ID:
+      func(static_cast<securePlainPhone &>(obj));
+      return true;
+    case securePlainEmail::ID:
+      func(static_cast<securePlainEmail &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(SecureRequiredType &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case secureRequiredType::ID:
+      func(static_cast<secureRequiredType &>(obj));
+      return true;
+    case secureRequiredTypeOneOf::ID:
+      func(static_cast<secureRequiredTypeOneOf &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(SecureValueError &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case secureValueErrorData::ID:
+      func(static_cast<secureValueErrorData &>(obj));
+      return true;
+    case secureValueErrorFrontSide::ID:
+      func(static_cast<secureValueErrorFrontSide &>(obj));
+      return true;
+    case secureValueErrorReverseSide::ID:
+      func(static_cast<secureValueErrorReverseSide &>(obj));
+      return true;
+    case secureValueErrorSelfie::ID:
+      func(static_cast<secureValueErrorSelfie &>(obj));
+      return true;
+    case secureValueErrorFile::ID:
+      func(static_cast<secureValueErrorFile &>(obj));
+      return true;
+    case secureValueErrorFiles::ID:
+      func(static_cast<secureValueErrorFiles &>(obj));
+      return true;
+    case secureValueError::ID:
+      func(static_cast<secureValueError &>(obj));
+      return true;
+    case secureValueErrorTranslationFile::ID:
+      func(static_cast<secureValueErrorTranslationFile &>(obj));
+      return true;
+    case secureValueErrorTranslationFiles::ID:
+      func(static_cast<secureValueErrorTranslationFiles &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(SecureValueType &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case secureValueTypePersonalDetails::ID:
+      func(static_cast<secureValueTypePersonalDetails &>(obj));
+      return true;
+    case secureValueTypePassport::ID:
+      func(static_cast<secureValueTypePassport &>(obj));
+      return true;
+    case secureValueTypeDriverLicense::ID:
+      func(static_cast<secureValueTypeDriverLicense &>(obj));
+      return true;
+    case secureValueTypeIdentityCard::ID:
+      func(static_cast<secureValueTypeIdentityCard &>(obj));
+      return true;
+    case secureValueTypeInternalPassport::ID:
+      func(static_cast<secureValueTypeInternalPassport &>(obj));
+      return true;
+    case secureValueTypeAddress::ID:
+      func(static_cast<secureValueTypeAddress &>(obj));
+      return true;
+    case secureValueTypeUtilityBill::ID:
+      func(static_cast<secureValueTypeUtilityBill &>(obj));
+      return true;
+    case secureValueTypeBankStatement::ID:
+      func(static_cast<secureValueTypeBankStatement &>(obj));
+      return true;
+    case secureValueTypeRentalAgreement::ID:
+      func(static_cast<secureValueTypeRentalAgreement &>(obj));
+      return true;
+    case secureValueTypePassportRegistration::ID:
+      func(static_cast<secureValueTypePassportRegistration &>(obj));
+      return true;
+    case secureValueTypeTemporaryRegistration::ID:
+      func(static_cast<secureValueTypeTemporaryRegistration &>(obj));
+      return true;
+    case secureValueTypePhone::ID:
+      func(static_cast<secureValueTypePhone &>(obj));
+      return true;
+    case secureValueTypeEmail::ID:
+      func(static_cast<secureValueTypeEmail &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(SendMessageAction &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch ((static_cast<std::uint32_t>(constructor) * 3701634981u) >> 26) {
+    case 1:
+      if (constructor == sendMessageHistoryImportAction::ID) {
+        func(static_cast<sendMessageHistoryImportAction &>(obj));
+        return true;
+      }
+      break;
+    case 2:
+      if (constructor == sendMessageUploadPhotoAction::ID) {
+        func(static_cast<sendMessageUploadPhotoAction &>(obj));
+        return true;
+      }
+      break;
+    case 5:
+      if (constructor == sendMessageCancelAction::ID) {
+        func(static_cast<sendMessageCancelAction &>(obj));
+        return true;
+      }
+      break;
+    case 7:
+      if (constructor == sendMessageRecordAudioAction::ID) {
+        func(static_cast<sendMessageRecordAudioAction &>(obj));
+        return true;
+      }
+      break;
+    case 18:
+      if (constructor == sendMessageTypingAction::ID) {
+        func(static_cast<sendMessageTypingAction &>(obj));
+        return true;
+      }
+      break;
+    case 19:
+      if (constructor == sendMessageUploadAudioAction::ID) {
+        func(static_cast<sendMessageUploadAudioAction &>(obj));
+        return true;
+      }
+      break;
+    case 21:
+      if (constructor == sendMessageRecordVideoAction::ID) {
+        func(static_cast<sendMessageRecordVideoAction &>(obj));
+        return true;
+      }
+      break;
+    case 24:
+      if (constructor == sendMessageRecordRoundAction::ID) {
+        func(static_cast<sendMessageRecordRoundAction &>(obj));
+        return true;
+      }
+      break;
+    case 25:
+      if (constructor == sendMessageUploadDocumentAction::ID) {
+        func(static_cast<sendMessageUploadDocumentAction &>(obj));
+        return true;
+      }
+      break;
+    case 33:
+      if (constructor == sendMessageUploadVideoAction::ID) {
+        func(static_cast<sendMessageUploadVideoAction &>(obj));
+        return true;
+      }
+      break;
+    case 34:
+      if (constructor == sendMessageEmojiInteractionSeen::ID) {
+        func(static_cast<sendMessageEmojiInteractionSeen &>(obj));
+        return true;
+      }
+      break;
+    case 36:
+      if (constructor == sendMessageChooseContactAction::ID) {
+        func(static_cast<sendMessageChooseContactAction &>(obj));
+        return true;
+      }
+      break;
+    case 40:
+      if (constructor == speakingInGroupCallAction::ID) {
+        func(static_cast<speakingInGroupCallAction &>(obj));
+        return true;
+      }
+      break;
+    case 42:
+      if (constructor == sendMessageEmojiInteraction::ID) {
+        func(static_cast<sendMessageEmojiInteraction &>(obj));
+        return true;
+      }
+      break;
+    case 43:
+      if (constructor == sendMessageGeoLocationAction::ID) {
+        func(static_cast<sendMessageGeoLocationAction &>(obj));
+        return true;
+      }
+      break;
+    case 45:
+      if (constructor == sendMessageChooseStickerAction::ID) {
+        func(static_cast<sendMessageChooseStickerAction &>(obj));
+        return true;
+      }
+      break;
+    case 50:
+      if (constructor == sendMessageGamePlayAction::ID) {
+        func(static_cast<sendMessageGamePlayAction &>(obj));
+        return true;
+      }
+      break;
+    case 54:
+      if (constructor == sendMessageUploadRoundAction::ID) {
+        func(static_cast<sendMessageUploadRoundAction &>(obj));
+        return true;
+      }
+      break;
+    default:
+      break;
+  }
+  return false;
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(StatsGraph &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case statsGraphAsync::ID:
+      func(static_cast<statsGraphAsync &>(obj));
+      return true;
+    case statsGraphError::ID:
+      func(static_cast<statsGraphError &>(obj));
+      return true;
+    case statsGraph::ID:
+      func(static_cast<statsGraph &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(StickerSetCovered &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case stickerSetCovered::ID:
+      func(static_cast<stickerSetCovered &>(obj));
+      return true;
+    case stickerSetMultiCovered::ID:
+      func(static_cast<stickerSetMultiCovered &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(TopPeerCategory &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case topPeerCategoryBotsPM::ID:
+      func(static_cast<topPeerCategoryBotsPM &>(obj));
+      return true;
+    case topPeerCategoryBotsInline::ID:
+      func(static_cast<topPeerCategoryBotsInline &>(obj));
+      return true;
+    case topPeerCategoryCorrespondents::ID:
+      func(static_cast<topPeerCategoryCorrespondents &>(obj));
+      return true;
+    case topPeerCategoryGroups::ID:
+      func(static_cast<topPeerCategoryGroups &>(obj));
+      return true;
+    case topPeerCategoryChannels::ID:
+      func(static_cast<topPeerCategoryChannels &>(obj));
+      return true;
+    case topPeerCategoryPhoneCalls::ID:
+      func(static_cast<topPeerCategoryPhoneCalls &>(obj));
+      return true;
+    case topPeerCategoryForwardUsers::ID:
+      func(static_cast<topPeerCategoryForwardUsers &>(obj));
+      return true;
+    case topPeerCategoryForwardChats::ID:
+      func(static_cast<topPeerCategoryForwardChats &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(Update &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch ((static_cast<std::uint32_t>(constructor) * 2920358897u) >> 24) {
+    case 6:
+      if (constructor == updateChannelAvailableMessages::ID) {
+        func(static_cast<updateChannelAvailableMessages &>(obj));
+        return true;
+      }
+      break;
+    case 8:
+      if (constructor == updateChatParticipant::ID) {
+        func(static_cast<updateChatParticipant &>(obj));
+        return true;
+      }
+      break;
+    case 9:
+      if (constructor == updateChatDefaultBannedRights::ID) {
+        func(static_cast<updateChatDefaultBannedRights &>(obj));
+        return true;
+      }
+      break;
+    case 11:
+      if (constructor == updateLoginToken::ID) {
+        func(static_cast<updateLoginToken &>(obj));
+        return true;
+      }
+      break;
+    case 13:
+      if (constructor == updatePinnedChannelMessages::ID) {
+        func(static_cast<updatePinnedChannelMessages &>(obj));
+        return true;
+      }
+      break;
+    case 14:
+      if (constructor == updateStickerSets::ID) {
+        func(static_cast<updateStickerSets &>(obj));
+        return true;
+      }
+      break;
+    case 15:
+      if (constructor == updateBotInlineQuery::ID) {
+        func(static_cast<updateBotInlineQuery &>(obj));
+        return true;
+      }
+      break;
+    case 22:
+      if (constructor == updateNewStickerSet::ID) {
+        func(static_cast<updateNewStickerSet &>(obj));
+        return true;
+      }
+      if (constructor == updateStickerSetsOrder::ID) {
+        func(static_cast<updateStickerSetsOrder &>(obj));
+        return true;
+      }
+      break;
+    case 25:
+      if (constructor == updateLangPackTooLong::ID) {
+        func(static_cast<updateLangPackTooLong &>(obj));
+        return true;
+      }
+      break;
+    case 27:
+      if (constructor == updateTheme::ID) {
+        func(static_cast<updateTheme &>(obj));
+        return true;
+      }
+      break;
+    case 28:
+      if (constructor == updateChannelMessageViews::ID) {
+        func(static_cast<updateChannelMessageViews &>(obj));
+        return true;
+      }
+      break;
+    case 32:
+      if (constructor == updateDialogFilterOrder::ID) {
+        func(static_cast<updateDialogFilterOrder &>(obj));
+        return true;
+      }
+      break;
+    case 36:
+      if (constructor == updateConfig::ID) {
+        func(static_cast<updateConfig &>(obj));
+        return true;
+      }
+      break;
+    case 37:
+      if (constructor == updateReadChannelInbox::ID) {
+        func(static_cast<updateReadChannelInbox &>(obj));
+        return true;
+      }
+      if (constructor == updateChannelUserTyping::ID) {
+        func(static_cast<updateChannelUserTyping &>(obj));
+        return true;
+      }
+      break;
+    case 46:
+      if (constructor == updateChannel::ID) {
+        func(static_cast<updateChannel &>(obj));
+        return true;
+      }
+      break;
+    case 47:
+      if (constructor == updateChannelParticipant::ID) {
+        func(static_cast<updateChannelParticipant &>(obj));
+        return true;
+      }
+      break;
+    case 48:
+      if (constructor == updateNewChannelMessage::ID) {
+        func(static_cast<updateNewChannelMessage &>(obj));
+        return true;
+      }
+      break;
+    case 51:
+      if (constructor == updateServiceNotification::ID) {
+        func(static_cast<updateServiceNotification &>(obj));
+        return true;
+      }
+      break;
+    case 55:
+      if (constructor == updateBotCallbackQuery::ID) {
+        func(static_cast<updateBotCallbackQuery &>(obj));
+        return true;
+      }
+      break;
+    case 56:
+      if (constructor == updateUserTyping::ID) {
+        func(static_cast<updateUserTyping &>(obj));
+        return true;
+      }
+      break;
+    case 57:
+      if (constructor == updateDeleteChannelMessages::ID) {
+        func(static_cast<updateDeleteChannelMessages &>(obj));
+        return true;
+      }
+      if (constructor == updateChat::ID) {
+        func(static_cast<updateChat &>(obj));
+        return true;
+      }
+      break;
+    case 63:
+      if (constructor == updateDcOptions::ID) {
+        func(static_cast<updateDcOptions &>(obj));
+        return true;
+      }
+      break;
+    case 73:
+      if (constructor == updateEncryptedMessagesRead::ID) {
+        func(static_cast<updateEncryptedMessagesRead &>(obj));
+        return true;
+      }
+      break;
+    case 75:
+      if (constructor == updateChatParticipantDelete::ID) {
+        func(static_cast<updateChatParticipantDelete &>(obj));
+        return true;
+      }
+      break;
+    case 76:
+      if (constructor == updatePhoneCallSignalingData::ID) {
+        func(static_cast<updatePhoneCallSignalingData &>(obj));
+        return true;
+      }
+      break;
+    case 77:
+      if (constructor == updatePendingJoinRequests::ID) {
+        func(static_cast<updatePendingJoinRequests &>(obj));
+        return true;
+      }
+      break;
+    case 83:
+      if (constructor == updateFavedStickers::ID) {
+        func(static_cast<updateFavedStickers &>(obj));
+        return true;
+      }
+      break;
+    case 87:
+      if (constructor == updateContactsReset::ID) {
+        func(static_cast<updateContactsReset &>(obj));
+        return true;
+      }
+      break;
+    case 90:
+      if (constructor == updateBotInlineSend::ID) {
+        func(static_cast<updateBotInlineSend &>(obj));
+        return true;
+      }
+      break;
+    case 93:
+      if (constructor == updateEditChannelMessage::ID) {
+        func(static_cast<updateEditChannelMessage &>(obj));
+        return true;
+      }
+      break;
+    case 97:
+      if (constructor == updatePeerHistoryTTL::ID) {
+        func(static_cast<updatePeerHistoryTTL &>(obj));
+        return true;
+      }
+      break;
+    case 100:
+      if (constructor == updateEditMessage::ID) {
+        func(static_cast<updateEditMessage &>(obj));
+        return true;
+      }
+      break;
+    case 103:
+      if (constructor == updateDialogUnreadMark::ID) {
+        func(static_cast<updateDialogUnreadMark &>(obj));
+        return true;
+      }
+      break;
+    case 104:
+      if (constructor == updateChatParticipantAdmin::ID) {
+        func(static_cast<updateChatParticipantAdmin &>(obj));
+        return true;
+      }
+      break;
+    case 105:
+      if (constructor == updateGroupCallConnection::ID) {
+        func(static_cast<updateGroupCallConnection &>(obj));
+        return true;
+      }
+      break;
+    case 110:
+      if (constructor == updateDialogFilter::ID) {
+        func(static_cast<updateDialogFilter &>(obj));
+        return true;
+      }
+      break;
+    case 111:
+      if (constructor == updateNewScheduledMessage::ID) {
+        func(static_cast<updateNewScheduledMessage &>(obj));
+        return true;
+      }
+      if (constructor == updateDeleteScheduledMessages::ID) {
+        func(static_cast<updateDeleteScheduledMessages &>(obj));
+        return true;
+      }
+      break;
+    case 112:
+      if (constructor == updateGroupCall::ID) {
+        func(static_cast<updateGroupCall &>(obj));
+        return true;
+      }
+      break;
+    case 116:
+      if (constructor == updateInlineBotCallbackQuery::ID) {
+        func(static_cast<updateInlineBotCallbackQuery &>(obj));
+        return true;
+      }
+      break;
+    case 117:
+      if (constructor == updateUserPhoto::ID) {
+        func(static_cast<updateUserPhoto &>(obj));
+        return true;
+      }
+      break;
+    case 118:
+      if (constructor == updateReadFeaturedStickers::ID) {
+        func(static_cast<updateReadFeaturedStickers &>(obj));
+        return true;
+      }
+      break;
+    case 127:
+      if (constructor == updateReadMessagesContents::ID) {
+        func(static_cast<updateReadMessagesContents &>(obj));
+        return true;
+      }
+      break;
+    case 129:
+      if (constructor == updatePrivacy::ID) {
+        func(static_cast<updatePrivacy &>(obj));
+        return true;
+      }
+      if (constructor == updateMessageReactions::ID) {
+        func(static_cast<updateMessageReactions &>(obj));
+        return true;
+      }
+      break;
+    case 130:
+      if (constructor == updateEncryptedChatTyping::ID) {
+        func(static_cast<updateEncryptedChatTyping &>(obj));
+        return true;
+      }
+      if (constructor == updateDialogPinned::ID) {
+        func(static_cast<updateDialogPinned &>(obj));
+        return true;
+      }
+      break;
+    case 131:
+      if (constructor == updateGroupCallParticipants::ID) {
+        func(static_cast<updateGroupCallParticipants &>(obj));
+        return true;
+      }
+      break;
+    case 134:
+      if (constructor == updatePinnedMessages::ID) {
+        func(static_cast<updatePinnedMessages &>(obj));
+        return true;
+      }
+      break;
+    case 136:
+      if (constructor == updatePeerSettings::ID) {
+        func(static_cast<updatePeerSettings &>(obj));
+        return true;
+      }
+      break;
+    case 137:
+      if (constructor == updateFolderPeers::ID) {
+        func(static_cast<updateFolderPeers &>(obj));
+        return true;
+      }
+      break;
+    case 141:
+      if (constructor == updatePeerLocated::ID) {
+        func(static_cast<updatePeerLocated &>(obj));
+        return true;
+      }
+      break;
+    case 146:
+      if (constructor == updateBotWebhookJSONQuery::ID) {
+        func(static_cast<updateBotWebhookJSONQuery &>(obj));
+        return true;
+      }
+      break;
+    case 147:
+      if (constructor == updateNotifySettings::ID) {
+        func(static_cast<updateNotifySettings &>(obj));
+        return true;
+      }
+      break;
+    case 149:
+      if (constructor == updateGeoLiveViewed::ID) {
+        func(static_cast<updateGeoLiveViewed &>(obj));
+        return true;
+      }
+      break;
+    case 154:
+      if (constructor == updateEncryption::ID) {
+        func(static_cast<updateEncryption &>(obj));
+        return true;
+      }
+      break;
+    case 155:
+      if (constructor == updateMessagePollVote::ID) {
+        func(static_cast<updateMessagePollVote &>(obj));
+        return true;
+      }
+      break;
+    case 160:
+      if (constructor == updatePinnedDialogs::ID) {
+        func(static_cast<updatePinnedDialogs &>(obj));
+        return true;
+      }
+      break;
+    case 165:
+      if (constructor == updateChatParticipants::ID) {
+        func(static_cast<updateChatParticipants &>(obj));
+        return true;
+      }
+      break;
+    case 166:
+      if (constructor == updatePhoneCall::ID) {
+        func(static_cast<updatePhoneCall &>(obj));
+        return true;
+      }
+      break;
+    case 168:
+      if (constructor == updateReadChannelDiscussionOutbox::ID) {
+        func(static_cast<updateReadChannelDiscussionOutbox &>(obj));
+        return true;
+      }
+      break;
+    case 171:
+      if (constructor == updateUserStatus::ID) {
+        func(static_cast<updateUserStatus &>(obj));
+        return true;
+      }
+      break;
+    case 175:
+      if (constructor == updateUserPhone::ID) {
+        func(static_cast<updateUserPhone &>(obj));
+        return true;
+      }
+      break;
+    case 177:
+      if (constructor == updateSavedGifs::ID) {
+        func(static_cast<updateSavedGifs &>(obj));
+        return true;
+      }
+      break;
+    case 180:
+      if (constructor == updateNewEncryptedMessage::ID) {
+        func(static_cast<updateNewEncryptedMessage &>(obj));
+        return true;
+      }
+      break;
+    case 181:
+      if (constructor == updateChannelWebPage::ID) {
+        func(static_cast<updateChannelWebPage &>(obj));
+        return true;
+      }
+      break;
+    case 187:
+      if (constructor == updateChatParticipantAdd::ID) {
+        func(static_cast<updateChatParticipantAdd &>(obj));
+        return true;
+      }
+      break;
+    case 189:
+      if (constructor == updateBotChatInviteRequester::ID) {
+        func(static_cast<updateBotChatInviteRequester &>(obj));
+        return true;
+      }
+      break;
+    case 190:
+      if (constructor == updateLangPack::ID) {
+        func(static_cast<updateLangPack &>(obj));
+        return true;
+      }
+      break;
+    case 193:
+      if (constructor == updateBotShippingQuery::ID) {
+        func(static_cast<updateBotShippingQuery &>(obj));
+        return true;
+      }
+      break;
+    case 197:
+      if (constructor == updateReadChannelOutbox::ID) {
+        func(static_cast<updateReadChannelOutbox &>(obj));
+        return true;
+      }
+      break;
+    case 198:
+      if (constructor == updateBotStopped::ID) {
+        func(static_cast<updateBotStopped &>(obj));
+        return true;
+      }
+      break;
+    case 199:
+      if (constructor == updateBotCommands::ID) {
+        func(static_cast<updateBotCommands &>(obj));
+        return true;
+      }
+      break;
+    case 201:
+      if (constructor == updateChatUserTyping::ID) {
+        func(static_cast<updateChatUserTyping &>(obj));
+        return true;
+      }
+      break;
+    case 211:
+      if (constructor == updateDeleteMessages::ID) {
+        func(static_cast<updateDeleteMessages &>(obj));
+        return true;
+      }
+      break;
+    case 213:
+      if (constructor == updateChannelMessageForwards::ID) {
+        func(static_cast<updateChannelMessageForwards &>(obj));
+        return true;
+      }
+      break;
+    case 216:
+      if (constructor == updateChannelTooLong::ID) {
+        func(static_cast<updateChannelTooLong &>(obj));
+        return true;
+      }
+      break;
+    case 217:
+      if (constructor == updateChannelReadMessagesContents::ID) {
+        func(static_cast<updateChannelReadMessagesContents &>(obj));
+        return true;
+      }
+      break;
+    case 223:
+      if (constructor == updateDraftMessage::ID) {
+        func(static_cast<updateDraftMessage &>(obj));
+        return true;
+      }
+      break;
+    case 225:
+      if (constructor == updateDialogFilters::ID) {
+        func(static_cast<updateDialogFilters &>(obj));
+        return true;
+      }
+      break;
+    case 226:
+      if (constructor == updateReadChannelDiscussionInbox::ID) {
+        func(static_cast<updateReadChannelDiscussionInbox &>(obj));
+        return true;
+      }
+      break;
+    case 233:
+      if (constructor == updatePeerBlocked::ID) {
+        func(static_cast<updatePeerBlocked &>(obj));
+        return true;
+      }
+      break;
+    case 234:
+      if (constructor == updateNewMessage::ID) {
+        func(static_cast<updateNewMessage &>(obj));
+        return true;
+      }
+      if (constructor == updateWebPage::ID) {
+        func(static_cast<updateWebPage &>(obj));
+        return true;
+      }
+      break;
+    case 235:
+      if (constructor == updateMessagePoll::ID) {
+        func(static_cast<updateMessagePoll &>(obj));
+        return true;
+      }
+      break;
+    case 236:
+      if (constructor == updateReadHistoryOutbox::ID) {
+        func(static_cast<updateReadHistoryOutbox &>(obj));
+        return true;
+      }
+      break;
+    case 239:
+      if (constructor == updatePtsChanged::ID) {
+        func(static_cast<updatePtsChanged &>(obj));
+        return true;
+      }
+      break;
+    case 241:
+      if (constructor == updateMessageID::ID) {
+        func(static_cast<updateMessageID &>(obj));
+        return true;
+      }
+      break;
+    case 242:
+      if (constructor == updateRecentStickers::ID) {
+        func(static_cast<updateRecentStickers &>(obj));
+        return true;
+      }
+      break;
+    case 247:
+      if (constructor == updateBotPrecheckoutQuery::ID) {
+        func(static_cast<updateBotPrecheckoutQuery &>(obj));
+        return true;
+      }
+      break;
+    case 250:
+      if (constructor == updateReadHistoryInbox::ID) {
+        func(static_cast<updateReadHistoryInbox &>(obj));
+        return true;
+      }
+      break;
+    case 254:
+      if (constructor == updateUserName::ID) {
+        func(static_cast<updateUserName &>(obj));
+        return true;
+      }
+      break;
+    case 255:
+      if (constructor == updateBotWebhookJSON::ID) {
+        func(static_cast<updateBotWebhookJSON &>(obj));
+        return true;
+      }
+      break;
+    default:
+      break;
+  }
+  return false;
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(Updates &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case updatesTooLong::ID:
+      func(static_cast<updatesTooLong &>(obj));
+      return true;
+    case updateShortMessage::ID:
+      func(static_cast<updateShortMessage &>(obj));
+      return true;
+    case updateShortChatMessage::ID:
+      func(static_cast<updateShortChatMessage &>(obj));
+      return true;
+    case updateShort::ID:
+      func(static_cast<updateShort &>(obj));
+      return true;
+    case updatesCombined::ID:
+      func(static_cast<updatesCombined &>(obj));
+      return true;
+    case updates::ID:
+      func(static_cast<updates &>(obj));
+      return true;
+    case updateShortSentMessage::ID:
+      func(static_cast<updateShortSentMessage &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(UrlAuthResult &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case urlAuthResultRequest::ID:
+      func(static_cast<urlAuthResultRequest &>(obj));
+      return true;
+    case urlAuthResultAccepted::ID:
+      func(static_cast<urlAuthResultAccepted &>(obj));
+      return true;
+    case urlAuthResultDefault::ID:
+      func(static_cast<urlAuthResultDefault &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(User &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case userEmpty::ID:
+      func(static_cast<userEmpty &>(obj));
+      return true;
+    case user::ID:
+      func(static_cast<user &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(UserProfilePhoto &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case userProfilePhotoEmpty::ID:
+      func(static_cast<userProfilePhotoEmpty &>(obj));
+      return true;
+    case userProfilePhoto::ID:
+      func(static_cast<userProfilePhoto &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(UserStatus &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case userStatusEmpty::ID:
+      func(static_cast<userStatusEmpty &>(obj));
+      return true;
+    case userStatusOnline::ID:
+      func(static_cast<userStatusOnline &>(obj));
+      return true;
+    case userStatusOffline::ID:
+      func(static_cast<userStatusOffline &>(obj));
+      return true;
+    case userStatusRecently::ID:
+      func(static_cast<userStatusRecently &>(obj));
+      return true;
+    case userStatusLastWeek::ID:
+      func(static_cast<userStatusLastWeek &>(obj));
+      return true;
+    case userStatusLastMonth::ID:
+      func(static_cast<userStatusLastMonth &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(WallPaper &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case wallPaper::ID:
+      func(static_cast<wallPaper &>(obj));
+      return true;
+    case wallPaperNoFile::ID:
+      func(static_cast<wallPaperNoFile &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(WebDocument &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case webDocument::ID:
+      func(static_cast<webDocument &>(obj));
+      return true;
+    case webDocumentNoProxy::ID:
+      func(static_cast<webDocumentNoProxy &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(WebPage &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case webPageEmpty::ID:
+      func(static_cast<webPageEmpty &>(obj));
+      return true;
+    case webPagePending::ID:
+      func(static_cast<webPagePending &>(obj));
+      return true;
+    case webPage::ID:
+      func(static_cast<webPage &>(obj));
+      return true;
+    case webPageNotModified::ID:
+      func(static_cast<webPageNotModified &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(account_ResetPasswordResult &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case account_resetPasswordFailedWait::ID:
+      func(static_cast<account_resetPasswordFailedWait &>(obj));
+      return true;
+    case account_resetPasswordRequestedWait::ID:
+      func(static_cast<account_resetPasswordRequestedWait &>(obj));
+      return true;
+    case account_resetPasswordOk::ID:
+      func(static_cast<account_resetPasswordOk &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(account_Themes &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case account_themesNotModified::ID:
+      func(static_cast<account_themesNotModified &>(obj));
+      return true;
+    case account_themes::ID:
+      func(static_cast<account_themes &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(account_WallPapers &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case account_wallPapersNotModified::ID:
+      func(static_cast<account_wallPapersNotModified &>(obj));
+      return true;
+    case account_wallPapers::ID:
+      func(static_cast<account_wallPapers &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(auth_Authorization &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case auth_authorization::ID:
+      func(static_cast<auth_authorization &>(obj));
+      return true;
+    case auth_authorizationSignUpRequired::ID:
+      func(static_cast<auth_authorizationSignUpRequired &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(auth_CodeType &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case auth_codeTypeSms::ID:
+      func(static_cast<auth_codeTypeSms &>(obj));
+      return true;
+    case auth_codeTypeCall::ID:
+      func(static_cast<auth_codeTypeCall &>(obj));
+      return true;
+    case auth_codeTypeFlashCall::ID:
+      func(static_cast<auth_codeTypeFlashCall &>(obj));
+      return true;
+    case auth_codeTypeMissedCall::ID:
+      func(static_cast<auth_codeTypeMissedCall &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(auth_LoginToken &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case auth_loginToken::ID:
+      func(static_cast<auth_loginToken &>(obj));
+      return true;
+    case auth_loginTokenMigrateTo::ID:
+      func(static_cast<auth_loginTokenMigrateTo &>(obj));
+      return true;
+    case auth_loginTokenSuccess::ID:
+      func(static_cast<auth_loginTokenSuccess &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(auth_SentCodeType &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case auth_sentCodeTypeApp::ID:
+      func(static_cast<auth_sentCodeTypeApp &>(obj));
+      return true;
+    case auth_sentCodeTypeSms::ID:
+      func(static_cast<auth_sentCodeTypeSms &>(obj));
+      return true;
+    case auth_sentCodeTypeCall::ID:
+      func(static_cast<auth_sentCodeTypeCall &>(obj));
+      return true;
+    case auth_sentCodeTypeFlashCall::ID:
+      func(static_cast<auth_sentCodeTypeFlashCall &>(obj));
+      return true;
+    case auth_sentCodeTypeMissedCall::ID:
+      func(static_cast<auth_sentCodeTypeMissedCall &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(channels_ChannelParticipants &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case channels_channelParticipants::ID:
+      func(static_cast<channels_channelParticipants &>(obj));
+      return true;
+    case channels_channelParticipantsNotModified::ID:
+      func(static_cast<channels_channelParticipantsNotModified &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(contacts_Blocked &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case contacts_blocked::ID:
+      func(static_cast<contacts_blocked &>(obj));
+      return true;
+    case contacts_blockedSlice::ID:
+      func(static_cast<contacts_blockedSlice &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(contacts_Contacts &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case contacts_contactsNotModified::ID:
+      func(static_cast<contacts_contactsNotModified &>(obj));
+      return true;
+    case contacts_contacts::ID:
+      func(static_cast<contacts_contacts &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(contacts_TopPeers &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case contacts_topPeersNotModified::ID:
+      func(static_cast<contacts_topPeersNotModified &>(obj));
+      return true;
+    case contacts_topPeers::ID:
+      func(static_cast<contacts_topPeers &>(obj));
+      return true;
+    case contacts_topPeersDisabled::ID:
+      func(static_cast<contacts_topPeersDisabled &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(help_AppUpdate &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case help_appUpdate::ID:
+      func(static_cast<help_appUpdate &>(obj));
+      return true;
+    case help_noAppUpdate::ID:
+      func(static_cast<help_noAppUpdate &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(help_CountriesList &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case help_countriesListNotModified::ID:
+      func(static_cast<help_countriesListNotModified &>(obj));
+      return true;
+    case help_countriesList::ID:
+      func(static_cast<help_countriesList &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(help_DeepLinkInfo &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case help_deepLinkInfoEmpty::ID:
+      func(static_cast<help_deepLinkInfoEmpty &>(obj));
+      return true;
+    case help_deepLinkInfo::ID:
+      func(static_cast<help_deepLinkInfo &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(help_PassportConfig &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case help_passportConfigNotModified::ID:
+      func(static_cast<help_passportConfigNotModified &>(obj));
+      return true;
+    case help_passportConfig::ID:
+      func(static_cast<help_passportConfig &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(help_PromoData &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case help_promoDataEmpty::ID:
+      func(static_cast<help_promoDataEmpty &>(obj));
+      return true;
+    case help_promoData::ID:
+      func(static_cast<help_promoData &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(help_TermsOfServiceUpdate &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case help_termsOfServiceUpdateEmpty::ID:
+      func(static_cast<help_termsOfServiceUpdateEmpty &>(obj));
+      return true;
+    case help_termsOfServiceUpdate::ID:
+      func(static_cast<help_termsOfServiceUpdate &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(help_UserInfo &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case help_userInfoEmpty::ID:
+      func(static_cast<help_userInfoEmpty &>(obj));
+      return true;
+    case help_userInfo::ID:
+      func(static_cast<help_userInfo &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(messages_AllStickers &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case messages_allStickersNotModified::ID:
+      func(static_cast<messages_allStickersNotModified &>(obj));
+      return true;
+    case messages_allStickers::ID:
+      func(static_cast<messages_allStickers &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(messages_AvailableReactions &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case messages_availableReactionsNotModified::ID:
+      func(static_cast<messages_availableReactionsNotModified &>(obj));
+      return true;
+    case messages_availableReactions::ID:
+      func(static_cast<messages_availableReactions &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(messages_Chats &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case messages_chats::ID:
+      func(static_cast<messages_chats &>(obj));
+      return true;
+    case messages_chatsSlice::ID:
+      func(static_cast<messages_chatsSlice &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(messages_DhConfig &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case messages_dhConfigNotModified::ID:
+      func(static_cast<messages_dhConfigNotModified &>(obj));
+      return true;
+    case messages_dhConfig::ID:
+      func(static_cast<messages_dhConfig &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(messages_Dialogs &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case messages_dialogs::ID:
+      func(static_cast<messages_dialogs &>(obj));
+      return true;
+    case messages_dialogsSlice::ID:
+      func(static_cast<messages_dialogsSlice &>(obj));
+      return true;
+    case messages_dialogsNotModified::ID:
+      func(static_cast<messages_dialogsNotModified &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(messages_ExportedChatInvite &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case messages_exportedChatInvite::ID:
+      func(static_cast<messages_exportedChatInvite &>(obj));
+      return true;
+    case messages_exportedChatInviteReplaced::ID:
+      func(static_cast<messages_exportedChatInviteReplaced &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(messages_FavedStickers &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case messages_favedStickersNotModified::ID:
+      func(static_cast<messages_favedStickersNotModified &>(obj));
+      return true;
+    case messages_favedStickers::ID:
+      func(static_cast<messages_favedStickers &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(messages_FeaturedStickers &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case messages_featuredStickersNotModified::ID:
+      func(static_cast<messages_featuredStickersNotModified &>(obj));
+      return true;
+    case messages_featuredStickers::ID:
+      func(static_cast<messages_featuredStickers &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(messages_FoundStickerSets &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case messages_foundStickerSetsNotModified::ID:
+      func(static_cast<messages_foundStickerSetsNotModified &>(obj));
+      return true;
+    case messages_foundStickerSets::ID:
+      func(static_cast<messages_foundStickerSets &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(messages_Messages &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case messages_messages::ID:
+      func(static_cast<messages_messages &>(obj));
+      return true;
+    case messages_messagesSlice::ID:
+      func(static_cast<messages_messagesSlice &>(obj));
+      return true;
+    case messages_channelMessages::ID:
+      func(static_cast<messages_channelMessages &>(obj));
+      return true;
+    case messages_messagesNotModified::ID:
+      func(static_cast<messages_messagesNotModified &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(messages_RecentStickers &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case messages_recentStickersNotModified::ID:
+      func(static_cast<messages_recentStickersNotModified &>(obj));
+      return true;
+    case messages_recentStickers::ID:
+      func(static_cast<messages_recentStickers &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(messages_SavedGifs &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case messages_savedGifsNotModified::ID:
+      func(static_cast<messages_savedGifsNotModified &>(obj));
+      return true;
+    case messages_savedGifs::ID:
+      func(static_cast<messages_savedGifs &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(messages_SentEncryptedMessage &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case messages_sentEncryptedMessage::ID:
+      func(static_cast<messages_sentEncryptedMessage &>(obj));
+      return true;
+    case messages_sentEncryptedFile::ID:
+      func(static_cast<messages_sentEncryptedFile &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(messages_StickerSet &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case messages_stickerSet::ID:
+      func(static_cast<messages_stickerSet &>(obj));
+      return true;
+    case messages_stickerSetNotModified::ID:
+      func(static_cast<messages_stickerSetNotModified &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(messages_StickerSetInstallResult &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case messages_stickerSetInstallResultSuccess::ID:
+      func(static_cast<messages_stickerSetInstallResultSuccess &>(obj));
+      return true;
+    case messages_stickerSetInstallResultArchive::ID:
+      func(static_cast<messages_stickerSetInstallResultArchive &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(messages_Stickers &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case messages_stickersNotModified::ID:
+      func(static_cast<messages_stickersNotModified &>(obj));
+      return true;
+    case messages_stickers::ID:
+      func(static_cast<messages_stickers &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(messages_TranslatedText &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case messages_translateNoResult::ID:
+      func(static_cast<messages_translateNoResult &>(obj));
+      return true;
+    case messages_translateResultText::ID:
+      func(static_cast<messages_translateResultText &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(payments_PaymentResult &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case payments_paymentResult::ID:
+      func(static_cast<payments_paymentResult &>(obj));
+      return true;
+    case payments_paymentVerificationNeeded::ID:
+      func(static_cast<payments_paymentVerificationNeeded &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(photos_Photos &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case photos_photos::ID:
+      func(static_cast<photos_photos &>(obj));
+      return true;
+    case photos_photosSlice::ID:
+      func(static_cast<photos_photosSlice &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(storage_FileType &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case storage_fileUnknown::ID:
+      func(static_cast<storage_fileUnknown &>(obj));
+      return true;
+    case storage_filePartial::ID:
+      func(static_cast<storage_filePartial &>(obj));
+      return true;
+    case storage_fileJpeg::ID:
+      func(static_cast<storage_fileJpeg &>(obj));
+      return true;
+    case storage_fileGif::ID:
+      func(static_cast<storage_fileGif &>(obj));
+      return true;
+    case storage_filePng::ID:
+      func(static_cast<storage_filePng &>(obj));
+      return true;
+    case storage_filePdf::ID:
+      func(static_cast<storage_filePdf &>(obj));
+      return true;
+    case storage_fileMp3::ID:
+      func(static_cast<storage_fileMp3 &>(obj));
+      return true;
+    case storage_fileMov::ID:
+      func(static_cast<storage_fileMov &>(obj));
+      return true;
+    case storage_fileMp4::ID:
+      func(static_cast<storage_fileMp4 &>(obj));
+      return true;
+    case storage_fileWebp::ID:
+      func(static_cast<storage_fileWebp &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(updates_ChannelDifference &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case updates_channelDifferenceEmpty::ID:
+      func(static_cast<updates_channelDifferenceEmpty &>(obj));
+      return true;
+    case updates_channelDifferenceTooLong::ID:
+      func(static_cast<updates_channelDifferenceTooLong &>(obj));
+      return true;
+    case updates_channelDifference::ID:
+      func(static_cast<updates_channelDifference &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(updates_Difference &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case updates_differenceEmpty::ID:
+      func(static_cast<updates_differenceEmpty &>(obj));
+      return true;
+    case updates_difference::ID:
+      func(static_cast<updates_difference &>(obj));
+      return true;
+    case updates_differenceSlice::ID:
+      func(static_cast<updates_differenceSlice &>(obj));
+      return true;
+    case updates_differenceTooLong::ID:
+      func(static_cast<updates_differenceTooLong &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(upload_CdnFile &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case upload_cdnFileReuploadNeeded::ID:
+      func(static_cast<upload_cdnFileReuploadNeeded &>(obj));
+      return true;
+    case upload_cdnFile::ID:
+      func(static_cast<upload_cdnFile &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calls the specified function object with the given object downcasted to its most derived type.
+ * \param[in] obj Object to pass as an argument to the function object.
+ * \param[in] func Function object to which the object will be passed.
+ * \returns Whether function object call has happened. Should always return true for correct parameters.
+ */
+template <class T>
+bool downcast_call(upload_File &obj, const T &func) {
+  const std::int32_t constructor = obj.get_id();
+  switch (constructor) {
+    case upload_file::ID:
+      func(static_cast<upload_file &>(obj));
+      return true;
+    case upload_fileCdnRedirect::ID:
+      func(static_cast<upload_fileCdnRedirect &>(obj));
+      return true;
+    default:
+      return false;
+  }
+}
+
+}  // namespace telegram_api
+}  // namespace td
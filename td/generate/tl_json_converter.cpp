@@ -15,6 +15,7 @@
 #include "td/utils/SliceBuilder.h"
 #include "td/utils/StringBuilder.h"
 
+#include <map>
 #include <utility>
 
 namespace td {
@@ -101,10 +102,33 @@ void gen_from_json_constructor(StringBuilder &sb, const T *constructor, bool is_
     sb << ";\n\n";
   } else {
     sb << " {\n";
-    for (auto &arg : constructor->args) {
-      sb << "  TRY_STATUS(from_json" << (arg.type->type == tl::simple::Type::Bytes ? "_bytes" : "") << "(to."
-         << tl::simple::gen_cpp_field_name(arg.name) << ", get_json_object_field_force(from, \""
-         << tl::simple::gen_cpp_name(arg.name) << "\")));\n";
+    if (!constructor->args.empty()) {
+      // parse all fields in one pass over the object instead of looking up each field separately;
+      // field names are compared only with names of the same length
+      std::map<size_t, std::vector<const tl::simple::Arg *>> args_by_name_length;
+      for (auto &arg : constructor->args) {
+        args_by_name_length[tl::simple::gen_cpp_name(arg.name).size()].push_back(&arg);
+      }
+      sb << "  for (auto &field_value : from) {\n";
+      sb << "    Slice field_name = field_value.first;\n";
+      sb << "    switch (field_name.size()) {\n";
+      for (auto &length_args : args_by_name_length) {
+        sb << "      case " << length_args.first << ":\n";
+        bool is_first = true;
+        for (auto *arg : length_args.second) {
+          sb << (is_first ? "        if" : " else if") << " (field_name == Slice(\""
+             << tl::simple::gen_cpp_name(arg->name) << "\")) {\n";
+          sb << "          TRY_STATUS(from_json" << (arg->type->type == tl::simple::Type::Bytes ? "_bytes" : "")
+             << "(to." << tl::simple::gen_cpp_field_name(arg->name) << ", std::move(field_value.second)));\n";
+          sb << "        }";
+          is_first = false;
+        }
+        sb << "\n        break;\n";
+      }
+      sb << "      default:\n";
+      sb << "        break;\n";
+      sb << "    }\n";
+      sb << "  }\n";
     }
     sb << "  return Status::OK();\n";
     sb << "}\n\n";
@@ -130,12 +154,35 @@ void gen_from_json(StringBuilder &sb, const tl::simple::Schema &schema, bool is_
 
 using Vec = std::vector<std::pair<int32, std::string>>;
 void gen_tl_constructor_from_string(StringBuilder &sb, Slice name, const Vec &vec, bool is_header) {
-  sb << "Result<int32> tl_constructor_from_string(td_api::" << name << " *object, const std::string &str)";
+  sb << "Result<int32> tl_constructor_from_string(td_api::" << name << " *object, Slice str)";
   if (is_header) {
     sb << ";\n\n";
     return;
   }
   sb << " {\n";
+  if (vec.size() <= 16) {
+    // for small types comparison with names of the same length is faster than hashing
+    std::map<size_t, std::vector<const std::pair<int32, std::string> *>> constructors_by_name_length;
+    for (auto &p : vec) {
+      constructors_by_name_length[p.second.size()].push_back(&p);
+    }
+    sb << "  switch (str.size()) {\n";
+    for (auto &length_constructors : constructors_by_name_length) {
+      sb << "    case " << length_constructors.first << ":\n";
+      for (auto *p : length_constructors.second) {
+        sb << "      if (str == Slice(\"" << p->second << "\")) {\n";
+        sb << "        return " << p->first << ";\n";
+        sb << "      }\n";
+      }
+      sb << "      break;\n";
+    }
+    sb << "    default:\n";
+    sb << "      break;\n";
+    sb << "  }\n";
+    sb << "  return Status::Error(PSLICE() << \"Unknown class \\\"\" << str << \"\\\"\");\n";
+    sb << "}\n\n";
+    return;
+  }
   sb << "  static const std::unordered_map<Slice, int32, SliceHash> m = {\n";
 
   bool is_first = true;
@@ -219,7 +266,8 @@ void gen_json_converter_file(const tl::simple::Schema &schema, const std::string
     sb << "#include \"td/utils/Slice.h\"\n\n";
 
     sb << "#include <functional>\n";
-    sb << "#include <unordered_map>\n\n";
+    sb << "#include <unordered_map>\n";
+    sb << "#include <utility>\n\n";
   }
   sb << "namespace td {\n";
   sb << "namespace td_api {\n";
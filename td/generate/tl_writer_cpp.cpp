@@ -170,6 +170,9 @@ std::string TD_TL_writer_cpp::gen_fetch_class_name(const tl::tl_tree_type *tree_
   }
 
   assert(tree_type->children.empty());
+  if (tl_name == "td_api") {
+    return "TlFetchNullableObject<" + gen_main_class_name(t) + ">";
+  }
   return "TlFetchObject<" + gen_main_class_name(t) + ">";
 }
 
@@ -179,6 +182,11 @@ std::string TD_TL_writer_cpp::gen_full_fetch_class_name(const tl::tl_tree_type *
 
   assert(!(t->flags & tl::FLAG_DEFAULT_CONSTRUCTOR));  // Not supported yet
 
+  if (tl_name == "td_api" && !is_built_in_simple_type(name) && !is_built_in_complex_type(name)) {
+    // all objects are stored with their constructor identifier, because they can be null
+    return gen_fetch_class_name(tree_type);
+  }
+
   std::int32_t expected_constructor_id = 0;
   if (tree_type->flags & tl::FLAG_BARE) {
     assert(is_type_bare(t));
@@ -353,6 +361,9 @@ std::string TD_TL_writer_cpp::gen_store_class_name(const tl::tl_tree_type *tree_
   }
 
   assert(tree_type->children.empty());
+  if (tl_name == "td_api") {
+    return "TlStoreNullableObject";
+  }
   return "TlStoreObject";
 }
 
@@ -365,6 +376,10 @@ std::string TD_TL_writer_cpp::gen_full_store_class_name(const tl::tl_tree_type *
     return gen_store_class_name(tree_type);
   }
 
+  if (tl_name == "td_api" && !is_built_in_simple_type(t->name) && !is_built_in_complex_type(t->name)) {
+    return gen_store_class_name(tree_type);
+  }
+
   if (is_built_in_complex_type(t->name)) {
     return "TlStoreBoxed<" + gen_store_class_name(tree_type) + ", " + int_to_string(t->constructors[0]->id) + ">";
   }
@@ -509,7 +524,19 @@ std::string TD_TL_writer_cpp::gen_get_id(const std::string &class_name, std::int
   if (is_proxy) {
     return "";
   }
-  return "\nconst std::int32_t " + class_name + "::ID;\n";
+  std::string result = "\nconst std::int32_t " + class_name + "::ID;\n";
+  if (is_object_pooled(class_name)) {
+    result += "\nvoid *" + class_name +
+              "::operator new(std::size_t size) {\n"
+              "  return ::td::SmallObjectAllocator::allocate(size);\n"
+              "}\n"
+              "\nvoid " +
+              class_name +
+              "::operator delete(void *ptr, std::size_t size) {\n"
+              "  ::td::SmallObjectAllocator::deallocate(ptr, size);\n"
+              "}\n";
+  }
+  return result;
 }
 
 std::string TD_TL_writer_cpp::gen_function_result_type(const tl::tl_tree *result) const {
@@ -642,22 +669,20 @@ std::string TD_TL_writer_cpp::gen_store_function_end(const std::vector<tl::var_d
 }
 
 std::string TD_TL_writer_cpp::gen_fetch_switch_begin() const {
-  return "  int constructor = p.fetch_int();\n"
-         "  switch (constructor) {\n";
+  assert(constructor_switch_cases.empty());
+  return "  int constructor = p.fetch_int();\n";
 }
 
 std::string TD_TL_writer_cpp::gen_fetch_switch_case(const tl::tl_combinator *t, int arity) const {
   assert(arity == 0);
-  return "    case " + gen_class_name(t->name) +
-         "::ID:\n"
-         "      return " +
-         gen_class_name(t->name) + "::fetch(p);\n";
+  auto class_name = gen_class_name(t->name);
+  constructor_switch_cases.push_back({t->id, class_name, {"return " + class_name + "::fetch(p);"}});
+  return "";
 }
 
 std::string TD_TL_writer_cpp::gen_fetch_switch_end() const {
-  return "    default:\n"
-         "      FAIL(PSTRING() << \"Unknown constructor found \" << format::as_hex(constructor));\n"
-         "  }\n";
+  return gen_constructor_switch("constructor",
+                                "FAIL(PSTRING() << \"Unknown constructor found \" << format::as_hex(constructor));");
 }
 
 std::string TD_TL_writer_cpp::gen_constructor_begin(int field_count, const std::string &class_name,
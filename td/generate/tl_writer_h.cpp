@@ -108,7 +108,27 @@ std::string TD_TL_writer_h::gen_output_begin() const {
          "  }\n"
          "  result += \"}\\n\";\n"
          "  return result;\n"
-         "}\n\n";
+         "}\n\n" +
+         (tl_name == "telegram_api"
+              ? "template <class T>\n"
+                "std::string to_summary_string(const object_ptr<T> &value) {\n"
+                "  if (value == nullptr) {\n"
+                "    return \"null\";\n"
+                "  }\n"
+                "\n"
+                "  return value->get_name();\n"
+                "}\n\n"
+
+                "template <class T>\n"
+                "std::string to_summary_string(const std::vector<object_ptr<T>> &values) {\n"
+                "  std::string result = \"vector[\" + std::to_string(values.size()) + \"]\";\n"
+                "  if (!values.empty()) {\n"
+                "    result += \" of \";\n"
+                "    result += to_summary_string(values[0]);\n"
+                "  }\n"
+                "  return result;\n"
+                "}\n\n"
+              : "");
 }
 
 std::string TD_TL_writer_h::gen_output_end() const {
@@ -256,9 +276,37 @@ std::string TD_TL_writer_h::gen_forward_class_declaration(const std::string &cla
 
 std::string TD_TL_writer_h::gen_class_begin(const std::string &class_name, const std::string &base_class_name,
                                             bool is_proxy) const {
+  std::string allocation_functions;
+  if (tl_name == "telegram_api" && base_class_name == gen_base_tl_class_name()) {
+    // objects received from the server are created and destroyed in big batches
+    allocation_functions =
+        "  static void *operator new(std::size_t size) {\n"
+        "    return ::td::SmallObjectAllocator::allocate(size);\n"
+        "  }\n"
+        "  static void operator delete(void *ptr, std::size_t size) {\n"
+        "    ::td::SmallObjectAllocator::deallocate(ptr, size);\n"
+        "  }\n";
+  }
+  if (!is_proxy && is_object_pooled(class_name)) {
+    // the header must not depend on tdutils, so the functions are defined in the source file
+    allocation_functions =
+        "  static void *operator new(std::size_t size);\n"
+        "  static void operator delete(void *ptr, std::size_t size);\n";
+  }
+  if (!allocation_functions.empty()) {
+    // class-specific operator new hides the global placement new, which is used to construct objects in place,
+    // for example, by Result<T>
+    allocation_functions +=
+        "  static void *operator new(std::size_t size, void *ptr) {\n"
+        "    return ptr;\n"
+        "  }\n"
+        "  static void operator delete(void *ptr, void *place) {\n"
+        "  }\n";
+  }
   return "class " + class_name + (!is_proxy ? " final " : "") + ": public " + base_class_name +
          " {\n"
-         " public:\n";
+         " public:\n" +
+         allocation_functions;
 }
 
 std::string TD_TL_writer_h::gen_class_end() const {
@@ -271,21 +319,35 @@ std::string TD_TL_writer_h::gen_class_alias(const std::string &class_name, const
 }
 
 std::string TD_TL_writer_h::gen_get_id(const std::string &class_name, std::int32_t id, bool is_proxy) const {
+  // names of telegram_api objects are used for cheap diagnostics instead of full object dumps
+  bool need_name = tl_name == "telegram_api";
   if (is_proxy) {
     if (class_name == gen_base_tl_class_name()) {
       return "\n  virtual std::int32_t get_id() const = 0;\n";
     }
+    if (need_name && (class_name == gen_base_type_class_name(0) || class_name == gen_base_function_class_name())) {
+      return "\n  virtual const char *get_name() const = 0;\n";
+    }
 
     return "";
   }
 
-  return "\n"
-         "  static const std::int32_t ID = " +
-         int_to_string(id) +
-         ";\n"
-         "  std::int32_t get_id() const final {\n"
-         "    return ID;\n"
-         "  }\n";
+  std::string result = "\n"
+                       "  static const std::int32_t ID = " +
+                       int_to_string(id) +
+                       ";\n"
+                       "  std::int32_t get_id() const final {\n"
+                       "    return ID;\n"
+                       "  }\n";
+  if (need_name) {
+    result += "\n"
+              "  const char *get_name() const final {\n"
+              "    return \"" +
+              class_name +
+              "\";\n"
+              "  }\n";
+  }
+  return result;
 }
 
 std::string TD_TL_writer_h::gen_function_result_type(const tl::tl_tree *result) const {
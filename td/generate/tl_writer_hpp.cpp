@@ -215,7 +215,7 @@ std::string TD_TL_writer_hpp::gen_additional_proxy_function_begin(const std::str
       "bool downcast_call(" +
       class_name +
       " &obj, const T &func) {\n"
-      "  switch (obj.get_id()) {\n";
+      "  const std::int32_t constructor = obj.get_id();\n";
 }
 
 std::string TD_TL_writer_hpp::gen_additional_proxy_function_case(const std::string &function_name,
@@ -230,21 +230,16 @@ std::string TD_TL_writer_hpp::gen_additional_proxy_function_case(const std::stri
                                                                  const tl::tl_type *type, const tl::tl_combinator *t,
                                                                  int arity, bool is_function) const {
   assert(function_name == "downcast_call");
-  return "    case " + gen_class_name(t->name) +
-         "::ID:\n"
-         "      func(static_cast<" +
-         gen_class_name(t->name) +
-         " &>(obj));\n"
-         "      return true;\n";
+  auto class_name = gen_class_name(t->name);
+  constructor_switch_cases.push_back(
+      {t->id, class_name, {"func(static_cast<" + class_name + " &>(obj));", "return true;"}});
+  return "";
 }
 
 std::string TD_TL_writer_hpp::gen_additional_proxy_function_end(const std::string &function_name,
                                                                 const tl::tl_type *type, bool is_function) const {
   assert(function_name == "downcast_call");
-  return "    default:\n"
-         "      return false;\n"
-         "  }\n"
-         "}\n\n";
+  return gen_constructor_switch("constructor", "return false;") + "}\n\n";
 }
 
 std::string TD_TL_writer_hpp::gen_constructor_begin(int field_count, const std::string &class_name,
@@ -303,7 +303,8 @@ std::string TD_TL_writer_jni_cpp::gen_type_store(const std::string &field_name,
     } else if (name == "Double") {
       res = "env->SetDoubleField(s, " + field_name + "fieldID, " + field_name + ");";
     } else if (name == "String") {
-      res = "{ jstring nextString = jni::to_jstring(env, " + field_name +
+      res = "if (" + field_name + ".empty()) { env->SetObjectField(s, " + field_name +
+            "fieldID, jni::EmptyString); } else { jstring nextString = jni::to_jstring(env, " + field_name +
             "); if (nextString) { env->SetObjectField(s, " + field_name +
             "fieldID, nextString); env->DeleteLocalRef(nextString); } }";
     } else {
@@ -6,6 +6,7 @@
 //
 #include "tl_writer_td.h"
 
+#include <algorithm>
 #include <cassert>
 
 namespace td {
@@ -66,6 +67,100 @@ bool TD_TL_writer::is_full_constructor_generated(const tl::tl_combinator *t, boo
          t->name == "updateNewMessage" || t->name == "message" || t->name == "updateChannelTooLong";
 }
 
+bool TD_TL_writer::is_object_pooled(const std::string &class_name) const {
+  if (tl_name != "td_api") {
+    return false;
+  }
+
+  // objects of the most frequent updates are created in the TDLib thread and destroyed in a client thread right
+  // after they are serialized, so their memory is reused through SmallObjectAllocator
+  auto begins_with = [&class_name](const std::string &prefix) {
+    return class_name.compare(0, prefix.size(), prefix) == 0;
+  };
+  return class_name == "updateUserStatus" || begins_with("userStatus") || class_name == "updateChatAction" ||
+         (begins_with("chatAction") && !begins_with("chatActionBar")) || class_name == "messageSenderUser" ||
+         class_name == "messageSenderChat" || class_name == "updateFile" || class_name == "file" ||
+         class_name == "localFile" || class_name == "remoteFile" || class_name == "updateChatReadInbox";
+}
+
+std::string TD_TL_writer::gen_constructor_switch(const std::string &constructor_variable,
+                                                 const std::string &default_statement) const {
+  auto cases = std::move(constructor_switch_cases);
+  constructor_switch_cases.clear();
+
+  std::string res;
+  if (cases.size() < 16) {
+    res += "  switch (" + constructor_variable + ") {\n";
+    for (auto &c : cases) {
+      res += "    case " + c.class_name + "::ID:\n";
+      for (auto &statement : c.statements) {
+        res += "      " + statement + "\n";
+      }
+    }
+    res += "    default:\n      " + default_statement + "\n  }\n";
+    return res;
+  }
+
+  // constructor identifiers are sparse 32-bit values, so a switch over them is compiled to a binary search;
+  // switch over a multiplicative hash of the identifier instead, which gives a dense jump table with a couple of
+  // identifiers per bucket, and choose the multiplier minimizing the maximum bucket size
+  int bits = 1;
+  while ((static_cast<std::size_t>(1) << bits) < cases.size()) {
+    bits++;
+  }
+  bits++;
+  auto shift = 32 - bits;
+  auto get_bucket = [shift](std::uint32_t multiplier, std::int32_t id) {
+    return (static_cast<std::uint32_t>(id) * multiplier) >> shift;
+  };
+
+  std::uint32_t best_multiplier = 0;
+  std::size_t best_max_size = cases.size() + 1;
+  std::size_t best_collisions = 0;
+  std::vector<std::size_t> bucket_sizes(static_cast<std::size_t>(1) << bits);
+  std::uint32_t multiplier = 0x9E3779B1u;
+  for (int attempt = 0; attempt < 1000; attempt++) {
+    std::fill(bucket_sizes.begin(), bucket_sizes.end(), 0);
+    std::size_t max_size = 0;
+    std::size_t collisions = 0;
+    for (auto &c : cases) {
+      auto &size = bucket_sizes[get_bucket(multiplier, c.id)];
+      collisions += size++;
+      max_size = std::max(max_size, size);
+    }
+    if (max_size < best_max_size || (max_size == best_max_size && collisions < best_collisions)) {
+      best_multiplier = multiplier;
+      best_max_size = max_size;
+      best_collisions = collisions;
+    }
+    multiplier = (multiplier * 1664525u + 1013904223u) | 1u;
+  }
+
+  std::vector<std::vector<const ConstructorSwitchCase *>> buckets(bucket_sizes.size());
+  for (auto &c : cases) {
+    buckets[get_bucket(best_multiplier, c.id)].push_back(&c);
+  }
+
+  res += "  switch ((static_cast<std::uint32_t>(" + constructor_variable + ") * " + std::to_string(best_multiplier) +
+         "u) >> " + std::to_string(shift) + ") {\n";
+  for (std::size_t i = 0; i < buckets.size(); i++) {
+    if (buckets[i].empty()) {
+      continue;
+    }
+    res += "    case " + std::to_string(i) + ":\n";
+    for (auto c : buckets[i]) {
+      res += "      if (" + constructor_variable + " == " + c->class_name + "::ID) {\n";
+      for (auto &statement : c->statements) {
+        res += "        " + statement + "\n";
+      }
+      res += "      }\n";
+    }
+    res += "      break;\n";
+  }
+  res += "    default:\n      break;\n  }\n  " + default_statement + "\n";
+  return res;
+}
+
 int TD_TL_writer::get_storer_type(const tl::tl_combinator *t, const std::string &storer_name) const {
   return storer_name == "TlStorerToString";
 }
@@ -100,7 +195,7 @@ std::vector<std::string> TD_TL_writer::get_parsers() const {
   std::vector<std::string> parsers;
   if (tl_name == "telegram_api") {
     parsers.push_back("TlBufferParser");
-  } else if (tl_name == "mtproto_api" || tl_name == "secret_api") {
+  } else if (tl_name == "mtproto_api" || tl_name == "secret_api" || tl_name == "td_api") {
     parsers.push_back("TlParser");
   }
   return parsers;
@@ -108,7 +203,7 @@ std::vector<std::string> TD_TL_writer::get_parsers() const {
 
 std::vector<std::string> TD_TL_writer::get_storers() const {
   std::vector<std::string> storers;
-  if (tl_name == "telegram_api" || tl_name == "mtproto_api" || tl_name == "secret_api") {
+  if (tl_name == "telegram_api" || tl_name == "mtproto_api" || tl_name == "secret_api" || tl_name == "td_api") {
     storers.push_back("TlStorerCalcLength");
     storers.push_back("TlStorerUnsafe");
   }
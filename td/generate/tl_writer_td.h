@@ -8,6 +8,7 @@
 
 #include "td/tl/tl_writer.h"
 
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -24,6 +25,17 @@ class TD_TL_writer : public tl::TL_writer {
   const std::string string_type;
   const std::string bytes_type;
 
+  struct ConstructorSwitchCase {
+    std::int32_t id;
+    std::string class_name;
+    std::vector<std::string> statements;
+  };
+
+  // cases of the switch being generated; they are needed all at once to choose the switch layout
+  mutable std::vector<ConstructorSwitchCase> constructor_switch_cases;
+
+  std::string gen_constructor_switch(const std::string &constructor_variable, const std::string &default_statement) const;
+
  public:
   TD_TL_writer(const std::string &tl_name, const std::string &string_type, const std::string &bytes_type)
       : TL_writer(tl_name), string_type(string_type), bytes_type(bytes_type) {
@@ -60,6 +72,8 @@ class TD_TL_writer : public tl::TL_writer {
 
   std::string gen_constructor_parameter(int field_num, const std::string &class_name, const tl::arg &a,
                                         bool is_default) const override;
+
+  bool is_object_pooled(const std::string &class_name) const;
 };
 
 }  // namespace td
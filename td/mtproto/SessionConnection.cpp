@@ -624,11 +624,13 @@ bool SessionConnection::must_flush_packet() {
 
   // http_wait
   if (mode_ == Mode::HttpLongPoll) {
+    flush_reason_ = FlushReason::HttpWait;
     return true;
   }
   // queries and acks (+ resend & get_info)
   if (has_salt && force_send_at_ != 0) {
     if (Time::now_cached() > force_send_at_) {
+      flush_reason_ = FlushReason::Query;
       return true;
     } else {
       relax_timeout_at(&flush_packet_at_, force_send_at_);
@@ -638,6 +640,7 @@ bool SessionConnection::must_flush_packet() {
   // ping
   if (has_salt) {
     if (must_ping()) {
+      flush_reason_ = FlushReason::Ping;
       return true;
     }
     relax_timeout_at(&flush_packet_at_, last_ping_at_ + ping_must_delay());
@@ -645,16 +648,19 @@ bool SessionConnection::must_flush_packet() {
   // get_future_salt
   if (!has_salt) {
     if (last_get_future_salt_at_ == 0) {
+      flush_reason_ = FlushReason::FutureSalt;
       return true;
     }
     auto get_future_salts_at = last_get_future_salt_at_ + 60;
     if (get_future_salts_at < Time::now_cached()) {
+      flush_reason_ = FlushReason::FutureSalt;
       return true;
     }
     relax_timeout_at(&flush_packet_at_, get_future_salts_at);
   }
 
   if (has_salt && need_destroy_auth_key_ && !sent_destroy_auth_key_) {
+    flush_reason_ = FlushReason::DestroyAuthKey;
     return true;
   }
 
@@ -753,6 +759,7 @@ void SessionConnection::set_online(bool online_flag, bool is_main) {
 }
 
 void SessionConnection::do_close(Status status) {
+  log_flush_statistics();
   state_ = Closed;
   // NB: this could be destroyed after on_closed
   callback_->on_closed(std::move(status));
@@ -771,9 +778,7 @@ Result<uint64> SessionConnection::send_query(BufferSlice buffer, bool gzip_flag,
     message_id = auth_data_->next_message_id(Time::now_cached());
   }
   auto seq_no = auth_data_->next_seq_no(true);
-  if (to_send_.empty()) {
-    send_before(Time::now_cached() + QUERY_DELAY);
-  }
+  send_before(Time::now_cached() + get_query_delay(use_quick_ack));
   to_send_.push_back(
       MtprotoQuery{message_id, seq_no, std::move(buffer), gzip_flag, std::move(invoke_after_ids), use_quick_ack});
   VLOG(mtproto) << "Invoke query " << message_id << " of size " << to_send_.back().packet.size() << " with seq_no "
@@ -850,6 +855,34 @@ void SessionConnection::send_ack(uint64 message_id) {
   }
 }
 
+double SessionConnection::get_query_delay(bool use_quick_ack) const {
+  if (use_quick_ack) {
+    // the query is interactive, so send it as soon as possible
+    return 0.0;
+  }
+  // collect more background queries in a container on connections with big RTT
+  return clamp(raw_connection_->extra().rtt * 0.01, QUERY_DELAY, MAX_QUERY_DELAY);
+}
+
+void SessionConnection::log_flush_statistics() const {
+  const auto &stats = flush_statistics_;
+  int64 packet_count = 0;
+  for (auto count : stats.packet_count) {
+    packet_count += count;
+  }
+  if (packet_count == 0) {
+    return;
+  }
+  LOG(INFO) << "Sent " << packet_count << " packets with " << stats.query_count << " queries of total size "
+            << stats.query_size << " and " << stats.ack_count << " acks, " << stats.full_container_count
+            << " full containers; flushed for http_wait/queries/ping/future_salt/destroy_key: "
+            << stats.packet_count[static_cast<int32>(FlushReason::HttpWait)] << '/'
+            << stats.packet_count[static_cast<int32>(FlushReason::Query)] << '/'
+            << stats.packet_count[static_cast<int32>(FlushReason::Ping)] << '/'
+            << stats.packet_count[static_cast<int32>(FlushReason::FutureSalt)] << '/'
+            << stats.packet_count[static_cast<int32>(FlushReason::DestroyAuthKey)];
+}
+
 // don't send ping in poll mode.
 bool SessionConnection::may_ping() const {
   return last_ping_at_ == 0 || (mode_ != Mode::HttpLongPoll && last_ping_at_ + ping_may_delay() < Time::now_cached());
@@ -898,9 +931,13 @@ void SessionConnection::flush_packet() {
   size_t send_till = 0;
   size_t send_size = 0;
   // send at most 1020 queries, of total size 2^15
+  // queries with quick ack are interactive, so send them in smaller containers to not delay them by background queries
   // don't send anything if have no salt
   if (has_salt) {
-    while (send_till < to_send_.size() && send_till < 1020 && send_size < (1 << 15)) {
+    bool has_interactive_query = false;
+    while (send_till < to_send_.size() && send_till < MAX_CONTAINER_QUERY_COUNT && send_size < MAX_CONTAINER_SIZE &&
+           (!has_interactive_query || send_size < MAX_INTERACTIVE_CONTAINER_SIZE)) {
+      has_interactive_query |= to_send_[send_till].use_quick_ack;
       send_size += to_send_[send_till].packet.size();
       send_till++;
     }
@@ -924,6 +961,14 @@ void SessionConnection::flush_packet() {
 
   sent_destroy_auth_key_ |= destroy_auth_key;
 
+  flush_statistics_.packet_count[static_cast<int32>(flush_reason_)]++;
+  flush_statistics_.query_count += static_cast<int64>(queries.size());
+  flush_statistics_.query_size += static_cast<int64>(send_size);
+  flush_statistics_.ack_count += static_cast<int64>(to_ack_.size());
+  if (!to_send_.empty() && send_till != 0) {
+    flush_statistics_.full_container_count++;
+  }
+
   VLOG(mtproto) << "Sent packet: " << tag("query_count", queries.size()) << tag("ack_cnt", to_ack_.size())
                 << tag("ping", ping_id != 0) << tag("http_wait", max_delay >= 0)
                 << tag("future_salt", future_salt_n > 0) << tag("get_info", to_get_state_info_.size())
@@ -945,8 +990,8 @@ void SessionConnection::flush_packet() {
   // no more than 8192 ids per container..
   auto to_resend_answer = cut_tail(to_resend_answer_, 8192, "resend_answer");
   uint64 resend_answer_id = 0;
-  CHECK(queries.size() <= 1020);
-  auto to_cancel_answer = cut_tail(to_cancel_answer_, 1020 - queries.size(), "cancel_answer");
+  CHECK(queries.size() <= MAX_CONTAINER_QUERY_COUNT);
+  auto to_cancel_answer = cut_tail(to_cancel_answer_, MAX_CONTAINER_QUERY_COUNT - queries.size(), "cancel_answer");
   auto to_get_state_info = cut_tail(to_get_state_info_, 8192, "get_state_info");
   uint64 get_state_info_id = 0;
   auto to_ack = cut_tail(to_ack_, 8192, "ack");
@@ -132,6 +132,7 @@ class SessionConnection final
  private:
   static constexpr int ACK_DELAY = 30;                  // 30s
   static constexpr double QUERY_DELAY = 0.001;          // 0.001s
+  static constexpr double MAX_QUERY_DELAY = 0.01;       // 0.01s
   static constexpr double RESEND_ANSWER_DELAY = 0.001;  // 0.001s
 
   bool online_flag_ = false;
@@ -165,6 +166,10 @@ class SessionConnection final
   static constexpr int HTTP_MAX_DELAY = 30;              // 0.03s
   static constexpr int TEMP_KEY_TIMEOUT = 60 * 60 * 24;  // one day
 
+  static constexpr size_t MAX_CONTAINER_QUERY_COUNT = 1020;
+  static constexpr size_t MAX_CONTAINER_SIZE = 1 << 15;
+  static constexpr size_t MAX_INTERACTIVE_CONTAINER_SIZE = 1 << 12;  // containers with queries with quick ack
+
   vector<MtprotoQuery> to_send_;
   vector<int64> to_ack_;
   double force_send_at_ = 0;
@@ -195,6 +200,19 @@ class SessionConnection final
   double flush_packet_at_ = 0;
 
   double last_get_future_salt_at_ = 0;
+
+  enum class FlushReason : int32 { HttpWait, Query, Ping, FutureSalt, DestroyAuthKey, Size };
+  FlushReason flush_reason_ = FlushReason::Query;
+
+  struct FlushStatistics {
+    int64 packet_count[static_cast<int32>(FlushReason::Size)] = {};
+    int64 query_count = 0;
+    int64 query_size = 0;
+    int64 ack_count = 0;
+    int64 full_container_count = 0;
+  };
+  FlushStatistics flush_statistics_;
+
   enum { Init, Run, Fail, Closed } state_;
   Mode mode_;
   bool connected_flag_ = false;
@@ -260,6 +278,8 @@ class SessionConnection final
   void send_ack(uint64 message_id);
   void send_crypto(const Storer &storer, uint64 quick_ack_token);
   void send_before(double tm);
+  double get_query_delay(bool use_quick_ack) const;
+  void log_flush_statistics() const;
   bool may_ping() const;
   bool must_ping() const;
   bool must_flush_packet();
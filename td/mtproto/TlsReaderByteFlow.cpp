@@ -18,21 +18,26 @@ bool TlsReaderByteFlow::loop() {
     return false;
   }
 
-  auto it = input_->clone();
+  // the header is almost always contiguous, so there is no need to copy it
   uint8 buf[5];
-  it.advance(5, MutableSlice(buf, 5));
-  if (Slice(buf, 3) != Slice("\x17\x03\x03")) {
+  Slice header = input_->prepare_read();
+  if (header.size() < 5) {
+    auto it = input_->clone();
+    it.advance(5, MutableSlice(buf, 5));
+    header = Slice(buf, 5);
+  }
+  if (header.substr(0, 3) != Slice("\x17\x03\x03")) {
     close_input(Status::Error("Invalid bytes at the beginning of a packet (emulated tls)"));
     return false;
   }
-  size_t len = (buf[3] << 8) | buf[4];
-  if (it.size() < len) {
+  size_t len = (static_cast<uint8>(header[3]) << 8) | static_cast<uint8>(header[4]);
+  if (input_->size() < 5 + len) {
     set_need_size(5 + len);
     return false;
   }
 
-  output_.append(it.cut_head(len));
-  *input_ = std::move(it);
+  input_->advance(5);
+  output_.append(input_->cut_head(len));
   return true;
 }
 
@@ -144,14 +144,14 @@ size_t Transport::calc_crypto_size(size_t data_size) {
   return raw_size + ((enc_size + data_size + 15) & ~15);
 }
 
-// MTProto v2.0
-std::pair<uint32, UInt128> Transport::calc_message_key2(const AuthKey &auth_key, int X, Slice to_encrypt) {
+namespace {
+void init_message_key2_state(Sha256State &state, const AuthKey &auth_key, int X) {
   // msg_key_large = SHA256 (substr (auth_key, 88+x, 32) + plaintext + random_padding);
-  Sha256State state;
   state.init();
   state.feed(Slice(auth_key.key()).substr(88 + X, 32));
-  state.feed(to_encrypt);
+}
 
+std::pair<uint32, UInt128> get_message_key2(Sha256State &state) {
   uint8 msg_key_large_raw[32];
   MutableSlice msg_key_large(msg_key_large_raw, sizeof(msg_key_large_raw));
   state.extract(msg_key_large, true);
@@ -163,7 +163,6 @@ std::pair<uint32, UInt128> Transport::calc_message_key2(const AuthKey &auth_key,
   return std::make_pair(as<uint32>(msg_key_large_raw) | (1u << 31), res);
 }
 
-namespace {
 size_t do_calc_crypto_size2_basic(size_t data_size, size_t enc_size, size_t raw_size) {
   size_t encrypted_size = (enc_size + data_size + 12 + 15) & ~15;
 
@@ -185,6 +184,14 @@ size_t do_calc_crypto_size2_rand(size_t data_size, size_t enc_size, size_t raw_s
 }
 }  // namespace
 
+// MTProto v2.0
+std::pair<uint32, UInt128> Transport::calc_message_key2(const AuthKey &auth_key, int X, Slice to_encrypt) {
+  Sha256State state;
+  init_message_key2_state(state, auth_key, X);
+  state.feed(to_encrypt);
+  return get_message_key2(state);
+}
+
 template <class HeaderT>
 size_t Transport::calc_crypto_size2(size_t data_size, PacketInfo *info) {
   if (info->size != 0) {
@@ -237,13 +244,25 @@ Status Transport::read_crypto_impl(int X, MutableSlice message, const AuthKey &a
 
   UInt256 aes_key;
   UInt256 aes_iv;
+  Sha256State message_key_state;
   if (info->version == 1) {
     KDF(auth_key.key(), header->message_key, X, &aes_key, &aes_iv);
+    aes_ige_decrypt(as_slice(aes_key), as_slice(aes_iv), to_decrypt, to_decrypt);
   } else {
     KDF2(auth_key.key(), header->message_key, X, &aes_key, &aes_iv);
-  }
 
-  aes_ige_decrypt(as_slice(aes_key), as_slice(aes_iv), to_decrypt, to_decrypt);
+    // decrypt the message and calculate its message key in one pass over the data,
+    // hashing every chunk while it is still in the cache
+    constexpr size_t DECRYPT_CHUNK_SIZE = 1 << 14;
+    init_message_key2_state(message_key_state, auth_key, X);
+    AesIgeState aes_state;
+    aes_state.init(as_slice(aes_key), as_slice(aes_iv), false);
+    for (size_t offset = 0; offset < to_decrypt.size(); offset += DECRYPT_CHUNK_SIZE) {
+      auto chunk = to_decrypt.substr(offset, DECRYPT_CHUNK_SIZE);
+      aes_state.decrypt(chunk, chunk);
+      message_key_state.feed(chunk);
+    }
+  }
 
   size_t tail_size = message.end() - reinterpret_cast<char *>(header->data);
   if (tail_size < sizeof(PrefixT)) {
@@ -263,7 +282,7 @@ Status Transport::read_crypto_impl(int X, MutableSlice message, const AuthKey &a
     auto check_size = data_size * (1 - is_length_bad) + tail_size * is_length_bad;
     std::tie(info->message_ack, real_message_key) = calc_message_ack_and_key(*header, check_size);
   } else {
-    std::tie(info->message_ack, real_message_key) = calc_message_key2(auth_key, X, to_decrypt);
+    std::tie(info->message_ack, real_message_key) = get_message_key2(message_key_state);
   }
 
   int is_key_bad = false;
@@ -386,7 +386,7 @@ void AuthManager::log_out(uint64 query_id) {
 
 void AuthManager::send_log_out_query() {
   auto query = G()->net_query_creator().create(telegram_api::auth_logOut());
-  query->set_priority(1);
+  query->set_priority(NetQuery::INTERACTIVE_PRIORITY);
   start_net_query(NetQueryType::LogOut, std::move(query));
 }
 
@@ -618,13 +618,14 @@ void AuthManager::on_get_password_result(NetQueryPtr &result) {
       return;
     }
     LOG(INFO) << "Have SRP ID " << wait_password_state_.srp_id_;
-    auto hash = PasswordManager::get_input_check_password(password_, wait_password_state_.current_client_salt_,
-                                                          wait_password_state_.current_server_salt_,
-                                                          wait_password_state_.srp_g_, wait_password_state_.srp_p_,
-                                                          wait_password_state_.srp_B_, wait_password_state_.srp_id_);
-
-    start_net_query(NetQueryType::CheckPassword,
-                    G()->net_query_creator().create_unauth(telegram_api::auth_checkPassword(std::move(hash))));
+    PasswordManager::calc_input_check_password(
+        password_, wait_password_state_.current_client_salt_, wait_password_state_.current_server_salt_,
+        wait_password_state_.srp_g_, wait_password_state_.srp_p_, wait_password_state_.srp_B_,
+        wait_password_state_.srp_id_,
+        PromiseCreator::lambda([actor_id = actor_id(this), query_id = query_id_](
+                                   Result<tl_object_ptr<telegram_api::InputCheckPasswordSRP>> r_hash) {
+          send_closure(actor_id, &AuthManager::on_get_input_check_password, query_id, std::move(r_hash));
+        }));
   } else {
     update_state(State::WaitPassword);
     if (query_id_ != 0) {
@@ -633,6 +634,20 @@ void AuthManager::on_get_password_result(NetQueryPtr &result) {
   }
 }
 
+void AuthManager::on_get_input_check_password(uint64 query_id,
+                                               Result<tl_object_ptr<telegram_api::InputCheckPasswordSRP>> r_hash) {
+  if (query_id != query_id_ || state_ != State::WaitPassword) {
+    LOG(INFO) << "Ignore password hash for finished query " << query_id;
+    return;
+  }
+  if (r_hash.is_error()) {
+    return on_query_error(r_hash.move_as_error());
+  }
+
+  start_net_query(NetQueryType::CheckPassword,
+                  G()->net_query_creator().create_unauth(telegram_api::auth_checkPassword(r_hash.move_as_ok())));
+}
+
 void AuthManager::on_request_password_recovery_result(NetQueryPtr &result) {
   auto r_email_address_pattern = fetch_result<telegram_api::auth_requestPasswordRecovery>(result->ok());
   if (r_email_address_pattern.is_error()) {
@@ -911,6 +926,9 @@ void AuthManager::update_state(State new_state, bool force, bool should_save_sta
   if (new_state == State::LoggingOut || new_state == State::DestroyingKeys) {
     send_closure(G()->state_manager(), &StateManager::on_logging_out, true);
   }
+  if (new_state == State::Ok) {
+    send_closure(G()->td(), &Td::on_startup_phase_finished, Slice("authorize"));
+  }
   if (!skip_update) {
     send_closure(G()->td(), &Td::send_update,
                  make_tl_object<td_api::updateAuthorizationState>(get_authorization_state_object(state_)));
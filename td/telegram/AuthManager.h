@@ -230,6 +230,7 @@ class AuthManager final : public NetActor {
   void on_send_code_result(NetQueryPtr &result);
   void on_request_qr_code_result(NetQueryPtr &result, bool is_import);
   void on_get_password_result(NetQueryPtr &result);
+  void on_get_input_check_password(uint64 query_id, Result<tl_object_ptr<telegram_api::InputCheckPasswordSRP>> r_hash);
   void on_request_password_recovery_result(NetQueryPtr &result);
   void on_check_password_recovery_code_result(NetQueryPtr &result);
   void on_authentication_result(NetQueryPtr &result, bool is_from_current_query);
@@ -6,6 +6,7 @@
 //
 #include "td/telegram/Client.h"
 
+#include "td/telegram/ResponseQueueStats.h"
 #include "td/telegram/Td.h"
 #include "td/telegram/TdCallback.h"
 
@@ -31,10 +32,26 @@
 #include <queue>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 
 namespace td {
 
-#if TD_THREAD_UNSUPPORTED || TD_EVENTFD_UNSUPPORTED
+static std::mutex client_thread_affinity_masks_mutex;
+static vector<uint64> client_thread_affinity_masks;
+
+static ConcurrentScheduler::Options get_concurrent_scheduler_options() {
+  ConcurrentScheduler::Options options;
+  // additional schedulers are shared between Td instances, so database queries of one instance
+  // must not delay queries of other instances for too long
+  options.max_mailbox_flush_size = 100;
+  std::lock_guard<std::mutex> lock(client_thread_affinity_masks_mutex);
+  options.thread_affinity_masks = client_thread_affinity_masks;
+  return options;
+}
+
+// in a browser, sockets must be used from the main thread, which can't block, so Td instances run on the main thread
+// and only additional schedulers are moved to Web Workers
+#if TD_THREAD_UNSUPPORTED || TD_EVENTFD_UNSUPPORTED || TD_EVENTFD_EMSCRIPTEN
 class TdReceiver {
  public:
   ClientManager::Response receive(double timeout) {
@@ -52,6 +69,13 @@ class TdReceiver {
       Callback(ClientManager::ClientId client_id, TdReceiver *impl) : client_id_(client_id), impl_(impl) {
       }
       void on_result(uint64 id, td_api::object_ptr<td_api::Object> result) final {
+        if (id == 0 && result != nullptr && result->get_id() == td_api::updates::ID) {
+          // a batch of updates
+          for (auto &update : static_cast<td_api::updates *>(result.get())->updates_) {
+            impl_->responses_.push({client_id_, 0, std::move(update)});
+          }
+          return;
+        }
         impl_->responses_.push({client_id_, id, std::move(result)});
       }
       void on_error(uint64 id, td_api::object_ptr<td_api::error> error) final {
@@ -76,6 +100,10 @@ class TdReceiver {
     responses_.push({client_id, id, std::move(result)});
   }
 
+  size_t get_response_count() const {
+    return responses_.size();
+  }
+
  private:
   std::queue<ClientManager::Response> responses_;
 };
@@ -96,7 +124,13 @@ class ClientManager::Impl final {
         CHECK(options_.net_query_stats == nullptr);
         options_.net_query_stats = std::make_shared<NetQueryStats>();
         concurrent_scheduler_ = make_unique<ConcurrentScheduler>();
-        concurrent_scheduler_->init(0);
+#if TD_EVENTFD_EMSCRIPTEN
+        // database, GC and slow network schedulers
+        constexpr int32 ADDITIONAL_THREAD_COUNT = 3;
+#else
+        constexpr int32 ADDITIONAL_THREAD_COUNT = 0;
+#endif
+        concurrent_scheduler_->init(ADDITIONAL_THREAD_COUNT, get_concurrent_scheduler_options());
         concurrent_scheduler_->start();
       }
       tds_[client_id] =
@@ -105,6 +139,37 @@ class ClientManager::Impl final {
     requests_.push_back({client_id, request_id, std::move(request)});
   }
 
+  void send_many(vector<ClientManager::Request> &&requests) {
+    for (auto &request : requests) {
+      send(request.client_id, request.request_id, std::move(request.function));
+    }
+  }
+
+  bool set_thread_topology(int32 group_count, int32 additional_thread_count,
+                           ClientManager::ThreadGroupAssignmentPolicy policy) {
+    // all instances always use the same thread
+    return false;
+  }
+
+  void set_client_thread_group(ClientId client_id, int32 group_index) {
+  }
+
+  vector<int32> get_thread_group_loads() {
+    return {static_cast<int32>(tds_.size())};
+  }
+
+  void set_response_queue_limit(size_t max_size) {
+    // updates are received on the same thread, so the client can't lag behind
+  }
+
+  size_t get_response_queue_size() const {
+    return receiver_.get_response_count();
+  }
+
+  uint64 get_postponed_update_fetching_count() const {
+    return 0;
+  }
+
   Response receive(double timeout) {
     if (!requests_.empty()) {
       for (size_t i = 0; i < requests_.size(); i++) {
@@ -123,6 +188,7 @@ class ClientManager::Impl final {
 
         CHECK(concurrent_scheduler_ != nullptr);
         auto guard = concurrent_scheduler_->get_main_guard();
+        EventPriorityGuard priority_guard(EventPriority::Interactive);
         send_closure_later(it->second, &Td::request, request.id, std::move(request.request));
       }
       requests_.clear();
@@ -237,15 +303,18 @@ class MultiTd final : public Actor {
  public:
   explicit MultiTd(Td::Options options) : options_(std::move(options)) {
   }
-  void create(int32 td_id, unique_ptr<TdCallback> callback) {
+  void create(int32 td_id, unique_ptr<TdCallback> callback, std::shared_ptr<ResponseQueueStats> response_queue_stats) {
     auto &td = tds_[td_id];
     CHECK(td.empty());
 
+    auto options = options_;
+    options.response_queue_stats = std::move(response_queue_stats);
+
     string name = "Td";
     auto context = std::make_shared<ActorContext>();
     auto old_context = set_context(context);
     auto old_tag = set_tag(to_string(td_id));
-    td = create_actor<Td>("Td", std::move(callback), options_);
+    td = create_actor<Td>("Td", std::move(callback), std::move(options));
     set_context(old_context);
     set_tag(old_tag);
   }
@@ -254,9 +323,16 @@ class MultiTd final : public Actor {
             td_api::object_ptr<td_api::Function> &&request) {
     auto &td = tds_[client_id];
     CHECK(!td.empty());
+    EventPriorityGuard priority_guard(EventPriority::Interactive);
     send_closure(td, &Td::request, request_id, std::move(request));
   }
 
+  void send_many(vector<ClientManager::Request> &&requests) {
+    for (auto &request : requests) {
+      send(request.client_id, request.request_id, std::move(request.function));
+    }
+  }
+
   void close(int32 td_id) {
     size_t erased_count = tds_.erase(td_id);
     CHECK(erased_count > 0);
@@ -272,6 +348,7 @@ class TdReceiver {
   TdReceiver() {
     output_queue_ = std::make_shared<OutputQueue>();
     output_queue_->init();
+    response_queue_stats_ = std::make_shared<ResponseQueueStats>();
   }
 
   ClientManager::Response receive(double timeout, bool from_manager) {
@@ -296,13 +373,18 @@ class TdReceiver {
   unique_ptr<TdCallback> create_callback(ClientManager::ClientId client_id) {
     class Callback final : public TdCallback {
      public:
-      explicit Callback(ClientManager::ClientId client_id, std::shared_ptr<OutputQueue> output_queue)
-          : client_id_(client_id), output_queue_(std::move(output_queue)) {
+      Callback(ClientManager::ClientId client_id, std::shared_ptr<OutputQueue> output_queue,
+               std::shared_ptr<ResponseQueueStats> response_queue_stats)
+          : client_id_(client_id)
+          , output_queue_(std::move(output_queue))
+          , response_queue_stats_(std::move(response_queue_stats)) {
       }
       void on_result(uint64 id, td_api::object_ptr<td_api::Object> result) final {
+        response_queue_stats_->on_response_sent(get_response_count(id, result));
         output_queue_->writer_put({client_id_, id, std::move(result)});
       }
       void on_error(uint64 id, td_api::object_ptr<td_api::error> error) final {
+        response_queue_stats_->on_response_sent(1);
         output_queue_->writer_put({client_id_, id, std::move(error)});
       }
       Callback(const Callback &) = delete;
@@ -310,33 +392,67 @@ class TdReceiver {
       Callback(Callback &&) = delete;
       Callback &operator=(Callback &&) = delete;
       ~Callback() final {
+        response_queue_stats_->on_response_sent(1);
         output_queue_->writer_put({client_id_, 0, nullptr});
       }
 
      private:
       ClientManager::ClientId client_id_;
       std::shared_ptr<OutputQueue> output_queue_;
+      std::shared_ptr<ResponseQueueStats> response_queue_stats_;
     };
-    return td::make_unique<Callback>(client_id, output_queue_);
+    return td::make_unique<Callback>(client_id, output_queue_, response_queue_stats_);
   }
 
   void add_response(ClientManager::ClientId client_id, uint64 id, td_api::object_ptr<td_api::Object> result) {
+    response_queue_stats_->on_response_sent(get_response_count(id, result));
     output_queue_->writer_put({client_id, id, std::move(result)});
   }
 
+  const std::shared_ptr<ResponseQueueStats> &get_response_queue_stats() const {
+    return response_queue_stats_;
+  }
+
  private:
   using OutputQueue = MpscPollableQueue<ClientManager::Response>;
   std::shared_ptr<OutputQueue> output_queue_;
+  std::shared_ptr<ResponseQueueStats> response_queue_stats_;
   int output_queue_ready_cnt_{0};
   std::atomic<bool> receive_lock_{false};
 
+  // a batch of updates is passed through the queue as a single td_api::updates object
+  ClientManager::ClientId batch_client_id_{0};
+  vector<td_api::object_ptr<td_api::Update>> batch_updates_;
+  size_t batch_update_pos_{0};
+
+  // a batch of updates is counted as the number of updates in it
+  static size_t get_response_count(uint64 id, const td_api::object_ptr<td_api::Object> &result) {
+    if (id == 0 && result != nullptr && result->get_id() == td_api::updates::ID) {
+      return static_cast<const td_api::updates *>(result.get())->updates_.size();
+    }
+    return 1;
+  }
+
   ClientManager::Response receive_unlocked(double timeout) {
+    if (batch_update_pos_ < batch_updates_.size()) {
+      response_queue_stats_->on_response_received();
+      return {batch_client_id_, 0, std::move(batch_updates_[batch_update_pos_++])};
+    }
     if (output_queue_ready_cnt_ == 0) {
       output_queue_ready_cnt_ = output_queue_->reader_wait_nonblock();
     }
     if (output_queue_ready_cnt_ > 0) {
       output_queue_ready_cnt_--;
-      return output_queue_->reader_get_unsafe();
+      auto response = output_queue_->reader_get_unsafe();
+      if (response.request_id == 0 && response.object != nullptr &&
+          response.object->get_id() == td_api::updates::ID) {
+        batch_client_id_ = response.client_id;
+        batch_updates_ = std::move(static_cast<td_api::updates *>(response.object.get())->updates_);
+        batch_update_pos_ = 0;
+        return receive_unlocked(0);
+      }
+      response_queue_stats_->on_response_received();
+      return response;
     }
     if (timeout != 0) {
       output_queue_->reader_get_event_fd().wait(static_cast<int>(timeout * 1000));
@@ -348,11 +464,11 @@ class TdReceiver {
 
 class MultiImpl {
  public:
-  static constexpr int32 ADDITIONAL_THREAD_COUNT = 3;
+  static constexpr int32 DEFAULT_ADDITIONAL_THREAD_COUNT = 3;
 
-  explicit MultiImpl(std::shared_ptr<NetQueryStats> net_query_stats) {
+  MultiImpl(std::shared_ptr<NetQueryStats> net_query_stats, int32 additional_thread_count) {
     concurrent_scheduler_ = std::make_shared<ConcurrentScheduler>();
-    concurrent_scheduler_->init(ADDITIONAL_THREAD_COUNT);
+    concurrent_scheduler_->init(additional_thread_count, get_concurrent_scheduler_options());
     concurrent_scheduler_->start();
 
     {
@@ -378,9 +494,9 @@ class MultiImpl {
     return static_cast<int32>(result);
   }
 
-  void create(int32 td_id, unique_ptr<TdCallback> callback) {
+  void create(int32 td_id, unique_ptr<TdCallback> callback, std::shared_ptr<ResponseQueueStats> response_queue_stats) {
     auto guard = concurrent_scheduler_->get_send_guard();
-    send_closure(multi_td_, &MultiTd::create, td_id, std::move(callback));
+    send_closure(multi_td_, &MultiTd::create, td_id, std::move(callback), std::move(response_queue_stats));
   }
 
   static bool is_valid_client_id(int32 client_id) {
@@ -393,6 +509,11 @@ class MultiImpl {
     send_closure(multi_td_, &MultiTd::send, client_id, request_id, std::move(request));
   }
 
+  void send_many(vector<ClientManager::Request> &&requests) {
+    auto guard = concurrent_scheduler_->get_send_guard();
+    send_closure(multi_td_, &MultiTd::send_many, std::move(requests));
+  }
+
   void close(ClientManager::ClientId client_id) {
     auto guard = concurrent_scheduler_->get_send_guard();
     send_closure(multi_td_, &MultiTd::close, client_id);
@@ -424,30 +545,49 @@ std::atomic<uint32> MultiImpl::current_id_{1};
 
 class MultiImplPool {
  public:
-  std::shared_ptr<MultiImpl> get() {
+  bool set_topology(int32 group_count, int32 additional_thread_count,
+                    ClientManager::ThreadGroupAssignmentPolicy policy) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (!impls_.empty() || group_count < 0 || additional_thread_count < -1) {
+      return false;
+    }
+    if (additional_thread_count == -1) {
+      additional_thread_count = MultiImpl::DEFAULT_ADDITIONAL_THREAD_COUNT;
+    }
+    auto real_group_count = group_count == 0 ? get_default_group_count() : static_cast<size_t>(group_count);
+    if (!is_valid_topology(real_group_count, additional_thread_count)) {
+      return false;
+    }
+    group_count_ = group_count;
+    additional_thread_count_ = additional_thread_count;
+    policy_ = policy;
+    return true;
+  }
+
+  std::shared_ptr<MultiImpl> get(int32 client_id, int32 group_index) {
     std::unique_lock<std::mutex> lock(mutex_);
     if (impls_.empty()) {
       init_openssl_threads();
 
-      auto max_client_threads = clamp(thread::hardware_concurrency(), 8u, 20u) * 5 / 4;
-#if TD_OPENBSD
-      max_client_threads = td::min(max_client_threads, 4u);
-#endif
-      impls_.resize(max_client_threads);
-      CHECK(impls_.size() * (1 + MultiImpl::ADDITIONAL_THREAD_COUNT + 1 /* IOCP */) < 128);
+      impls_.resize(group_count_ == 0 ? get_default_group_count() : static_cast<size_t>(group_count_));
+      CHECK(is_valid_topology(impls_.size(), additional_thread_count_));
 
       net_query_stats_ = std::make_shared<NetQueryStats>();
     }
-    auto &impl = *std::min_element(impls_.begin(), impls_.end(),
-                                   [](auto &a, auto &b) { return a.lock().use_count() < b.lock().use_count(); });
+    auto &impl = impls_[get_group_index(client_id, group_index)];
     auto result = impl.lock();
     if (!result) {
-      result = std::make_shared<MultiImpl>(net_query_stats_);
+      result = std::make_shared<MultiImpl>(net_query_stats_, additional_thread_count_);
       impl = result;
     }
     return result;
   }
 
+  vector<int32> get_loads() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    return transform(impls_, [](auto &impl) { return static_cast<int32>(impl.use_count()); });
+  }
+
   void try_clear() {
     std::unique_lock<std::mutex> lock(mutex_);
     if (impls_.empty()) {
@@ -470,6 +610,41 @@ class MultiImplPool {
   std::mutex mutex_;
   std::vector<std::weak_ptr<MultiImpl>> impls_;
   std::shared_ptr<NetQueryStats> net_query_stats_;
+
+  int32 group_count_ = 0;
+  int32 additional_thread_count_ = MultiImpl::DEFAULT_ADDITIONAL_THREAD_COUNT;
+  ClientManager::ThreadGroupAssignmentPolicy policy_ = ClientManager::ThreadGroupAssignmentPolicy::LeastLoaded;
+
+  static size_t get_default_group_count() {
+    auto max_client_threads = clamp(thread::hardware_concurrency(), 8u, 20u) * 5 / 4;
+#if TD_OPENBSD
+    max_client_threads = td::min(max_client_threads, 4u);
+#endif
+    return max_client_threads;
+  }
+
+  static bool is_valid_topology(size_t group_count, int32 additional_thread_count) {
+    return group_count > 0 && group_count * (1 + additional_thread_count + 1 /* IOCP */) < 128;
+  }
+
+  size_t get_group_index(int32 client_id, int32 group_index) const {
+    switch (policy_) {
+      case ClientManager::ThreadGroupAssignmentPolicy::ClientIdHash:
+        return static_cast<uint32>(client_id) % impls_.size();
+      case ClientManager::ThreadGroupAssignmentPolicy::Explicit:
+        if (group_index >= 0) {
+          return static_cast<size_t>(group_index) % impls_.size();
+        }
+        break;
+      case ClientManager::ThreadGroupAssignmentPolicy::LeastLoaded:
+        break;
+      default:
+        UNREACHABLE();
+    }
+    auto it = std::min_element(impls_.begin(), impls_.end(),
+                               [](auto &a, auto &b) { return a.use_count() < b.use_count(); });
+    return static_cast<size_t>(it - impls_.begin());
+  }
 };
 
 class ClientManager::Impl final {
@@ -484,28 +659,16 @@ class ClientManager::Impl final {
   }
 
   void send(ClientId client_id, RequestId request_id, td_api::object_ptr<td_api::Function> &&request) {
-    auto lock = impls_mutex_.lock_read().move_as_ok();
     if (!MultiImpl::is_valid_client_id(client_id)) {
       receiver_.add_response(client_id, request_id,
                              td_api::make_object<td_api::error>(400, "Invalid TDLib instance specified"));
       return;
     }
 
-    auto it = impls_.find(client_id);
-    if (it != impls_.end() && it->second.impl == nullptr) {
-      lock.reset();
-
-      auto write_lock = impls_mutex_.lock_write().move_as_ok();
-      it = impls_.find(client_id);
-      if (it != impls_.end() && it->second.impl == nullptr) {
-        it->second.impl = pool_.get();
-        it->second.impl->create(client_id, receiver_.create_callback(client_id));
-      }
-      write_lock.reset();
+    create_impl_if_needed(client_id);
 
-      lock = impls_mutex_.lock_read().move_as_ok();
-      it = impls_.find(client_id);
-    }
+    auto lock = impls_mutex_.lock_read().move_as_ok();
+    auto it = impls_.find(client_id);
     if (it == impls_.end() || it->second.is_closed) {
       receiver_.add_response(client_id, request_id, td_api::make_object<td_api::error>(500, "Request aborted"));
       return;
@@ -513,6 +676,59 @@ class ClientManager::Impl final {
     it->second.impl->send(client_id, request_id, std::move(request));
   }
 
+  void send_many(vector<Request> &&requests) {
+    for (auto &request : requests) {
+      if (MultiImpl::is_valid_client_id(request.client_id)) {
+        create_impl_if_needed(request.client_id);
+      }
+    }
+
+    // requests to instances sharing the same MultiImpl are sent together to wake up its scheduler only once
+    vector<std::pair<MultiImpl *, vector<Request>>> batches;
+    auto lock = impls_mutex_.lock_read().move_as_ok();
+    for (auto &request : requests) {
+      if (!MultiImpl::is_valid_client_id(request.client_id)) {
+        receiver_.add_response(request.client_id, request.request_id,
+                               td_api::make_object<td_api::error>(400, "Invalid TDLib instance specified"));
+        continue;
+      }
+      auto it = impls_.find(request.client_id);
+      if (it == impls_.end() || it->second.is_closed) {
+        receiver_.add_response(request.client_id, request.request_id,
+                               td_api::make_object<td_api::error>(500, "Request aborted"));
+        continue;
+      }
+      auto *impl = it->second.impl.get();
+      auto batch_it =
+          std::find_if(batches.begin(), batches.end(), [impl](const auto &batch) { return batch.first == impl; });
+      if (batch_it == batches.end()) {
+        batches.emplace_back(impl, vector<Request>());
+        batch_it = batches.end() - 1;
+      }
+      batch_it->second.push_back(std::move(request));
+    }
+    for (auto &batch : batches) {
+      batch.first->send_many(std::move(batch.second));
+    }
+  }
+
+  void create_impl_if_needed(ClientId client_id) {
+    {
+      auto lock = impls_mutex_.lock_read().move_as_ok();
+      auto it = impls_.find(client_id);
+      if (it == impls_.end() || it->second.impl != nullptr) {
+        return;
+      }
+    }
+
+    auto write_lock = impls_mutex_.lock_write().move_as_ok();
+    auto it = impls_.find(client_id);
+    if (it != impls_.end() && it->second.impl == nullptr) {
+      it->second.impl = pool_.get(client_id, it->second.group_index);
+      it->second.impl->create(client_id, receiver_.create_callback(client_id), receiver_.get_response_queue_stats());
+    }
+  }
+
   Response receive(double timeout) {
     auto response = receiver_.receive(timeout, true);
     if (response.request_id == 0 && response.object != nullptr &&
@@ -543,6 +759,35 @@ class ClientManager::Impl final {
     return response;
   }
 
+  bool set_thread_topology(int32 group_count, int32 additional_thread_count,
+                           ClientManager::ThreadGroupAssignmentPolicy policy) {
+    return pool_.set_topology(group_count, additional_thread_count, policy);
+  }
+
+  void set_client_thread_group(ClientId client_id, int32 group_index) {
+    auto lock = impls_mutex_.lock_write().move_as_ok();
+    auto it = impls_.find(client_id);
+    if (it != impls_.end() && it->second.impl == nullptr) {
+      it->second.group_index = group_index;
+    }
+  }
+
+  vector<int32> get_thread_group_loads() {
+    return pool_.get_loads();
+  }
+
+  void set_response_queue_limit(size_t max_size) {
+    receiver_.get_response_queue_stats()->set_max_size(max_size);
+  }
+
+  size_t get_response_queue_size() const {
+    return receiver_.get_response_queue_stats()->get_size();
+  }
+
+  uint64 get_postponed_update_fetching_count() const {
+    return receiver_.get_response_queue_stats()->get_postponed_update_fetching_count();
+  }
+
   void close_impl(ClientId client_id) {
     auto it = impls_.find(client_id);
     CHECK(it != impls_.end());
@@ -578,6 +823,7 @@ class ClientManager::Impl final {
   RwMutex impls_mutex_;
   struct MultiImplInfo {
     std::shared_ptr<MultiImpl> impl;
+    int32 group_index = -1;
     bool is_closed = false;
   };
   std::unordered_map<ClientId, MultiImplInfo> impls_;
@@ -588,9 +834,9 @@ class Client::Impl final {
  public:
   Impl() {
     static MultiImplPool pool;
-    multi_impl_ = pool.get();
     td_id_ = MultiImpl::create_id();
-    multi_impl_->create(td_id_, receiver_.create_callback(td_id_));
+    multi_impl_ = pool.get(td_id_, -1);
+    multi_impl_->create(td_id_, receiver_.create_callback(td_id_), receiver_.get_response_queue_stats());
   }
 
   void send(Request request) {
@@ -666,10 +912,26 @@ void ClientManager::send(ClientId client_id, RequestId request_id, td_api::objec
   impl_->send(client_id, request_id, std::move(request));
 }
 
+void ClientManager::send_many(std::vector<Request> &&requests) {
+  impl_->send_many(std::move(requests));
+}
+
 ClientManager::Response ClientManager::receive(double timeout) {
   return impl_->receive(timeout);
 }
 
+std::vector<ClientManager::Response> ClientManager::receive_many(double timeout, std::size_t max_count) {
+  std::vector<Response> responses;
+  while (responses.size() < max_count) {
+    auto response = impl_->receive(responses.empty() ? timeout : 0.0);
+    if (response.object == nullptr) {
+      break;
+    }
+    responses.push_back(std::move(response));
+  }
+  return responses;
+}
+
 td_api::object_ptr<td_api::Object> ClientManager::execute(td_api::object_ptr<td_api::Function> &&request) {
   return Td::static_request(std::move(request));
 }
@@ -693,6 +955,36 @@ void ClientManager::set_log_message_callback(int max_verbosity_level, LogMessage
   }
 }
 
+bool ClientManager::set_thread_topology(std::int32_t group_count, std::int32_t additional_thread_count,
+                                        ThreadGroupAssignmentPolicy policy) {
+  return impl_->set_thread_topology(group_count, additional_thread_count, policy);
+}
+
+void ClientManager::set_client_thread_group(ClientId client_id, std::int32_t group_index) {
+  impl_->set_client_thread_group(client_id, group_index);
+}
+
+std::vector<std::int32_t> ClientManager::get_thread_group_loads() {
+  return impl_->get_thread_group_loads();
+}
+
+void ClientManager::set_response_queue_limit(std::size_t max_size) {
+  impl_->set_response_queue_limit(max_size);
+}
+
+std::size_t ClientManager::get_response_queue_size() const {
+  return impl_->get_response_queue_size();
+}
+
+std::uint64_t ClientManager::get_postponed_update_fetching_count() const {
+  return impl_->get_postponed_update_fetching_count();
+}
+
+void ClientManager::set_thread_affinity_masks(std::vector<std::uint64_t> thread_affinity_masks) {
+  std::lock_guard<std::mutex> lock(client_thread_affinity_masks_mutex);
+  client_thread_affinity_masks = std::move(thread_affinity_masks);
+}
+
 ClientManager::ClientManager(ClientManager &&other) noexcept = default;
 ClientManager &ClientManager::operator=(ClientManager &&other) noexcept = default;
 ClientManager::~ClientManager() = default;
@@ -11,8 +11,10 @@
 #include "td/telegram/td_api.h"
 #include "td/telegram/td_api.hpp"
 
+#include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <vector>
 
 namespace td {
 
@@ -86,6 +88,33 @@ class ClientManager final {
    */
   void send(ClientId client_id, RequestId request_id, td_api::object_ptr<td_api::Function> &&request);
 
+  /**
+   * A request to TDLib.
+   */
+  struct Request {
+    /**
+     * TDLib client instance identifier, to which the request is sent.
+     */
+    ClientId client_id;
+
+    /**
+     * Request identifier. Must be non-zero.
+     */
+    RequestId request_id;
+
+    /**
+     * TDLib API function representing a request to TDLib.
+     */
+    td_api::object_ptr<td_api::Function> function;
+  };
+
+  /**
+   * Sends many requests to TDLib at once. May be called from any thread.
+   * Requests to the same TDLib client instance are processed in the order they are specified.
+   * \param[in] requests Requests to TDLib.
+   */
+  void send_many(std::vector<Request> &&requests);
+
   /**
    * A response to a request, or an incoming update from TDLib.
    */
@@ -115,6 +144,16 @@ class ClientManager final {
    */
   Response receive(double timeout);
 
+  /**
+   * Receives up to max_count incoming updates and responses to requests from TDLib at once. May be called from any
+   * thread, but must not be called simultaneously from two different threads or simultaneously with receive.
+   * Waits only for the first response; all other responses are returned only if they are immediately available.
+   * \param[in] timeout The maximum number of seconds allowed for this function to wait for new data.
+   * \param[in] max_count The maximum number of returned responses.
+   * \return Received incoming updates and responses to requests. May be empty if the timeout expires.
+   */
+  std::vector<Response> receive_many(double timeout, std::size_t max_count);
+
   /**
    * Synchronously executes a TDLib request.
    * A request can be executed synchronously, only if it is documented with "Can be called synchronously".
@@ -144,6 +183,84 @@ class ClientManager final {
    */
   static void set_log_message_callback(int max_verbosity_level, LogMessageCallbackPtr callback);
 
+  /**
+   * Sets CPU affinity masks for internal threads of TDLib client instances, which will be created after the call.
+   * Every group of TDLib instances uses its own set of threads, numbered from 0, and the mask i is applied to the thread i
+   * of every group. Bit j of a mask allows the thread to run on CPU j. An absent or zero mask leaves the thread unpinned.
+   * Setting of CPU affinity is supported only on Linux.
+   *
+   * \param[in] thread_affinity_masks CPU affinity masks of the internal threads.
+   */
+  static void set_thread_affinity_masks(std::vector<std::uint64_t> thread_affinity_masks);
+
+  /**
+   * Policy of assignment of TDLib client instances to groups of internal threads.
+   */
+  enum class ThreadGroupAssignmentPolicy : std::int32_t {
+    /** The group with the least number of TDLib client instances is chosen. */
+    LeastLoaded,
+    /** The group is chosen by the client identifier. */
+    ClientIdHash,
+    /** The group is specified explicitly by set_client_thread_group; the least loaded group is chosen otherwise. */
+    Explicit
+  };
+
+  /**
+   * Changes the number of groups of internal threads and the number of threads in each group.
+   * Must be called before the first request to a TDLib client instance is sent.
+   * Multithreading is required for this method to have any effect.
+   *
+   * \param[in] group_count The number of groups of internal threads; pass 0 to choose it by the number of CPU cores.
+   * \param[in] additional_thread_count The number of threads in each group besides the main thread;
+   *                                    pass -1 to use the default value.
+   * \param[in] policy Policy of assignment of TDLib client instances to the groups.
+   * 
+eturn True, if the new parameters will be used, and false if they are invalid or it is too late to change them.
+   */
+  bool set_thread_topology(std::int32_t group_count, std::int32_t additional_thread_count,
+                           ThreadGroupAssignmentPolicy policy);
+
+  /**
+   * Chooses the group of internal threads for a TDLib client instance if ThreadGroupAssignmentPolicy::Explicit is used.
+   * Must be called before the first request to the TDLib client instance is sent.
+   *
+   * \param[in] client_id TDLib client instance identifier.
+   * \param[in] group_index Zero-based index of the group of internal threads.
+   */
+  void set_client_thread_group(ClientId client_id, std::int32_t group_index);
+
+  /**
+   * Returns the number of active TDLib client instances in each group of internal threads.
+   *
+   * 
+eturn The number of TDLib client instances in each group.
+   */
+  std::vector<std::int32_t> get_thread_group_loads();
+
+  /**
+   * Sets the maximum number of responses and updates, which can wait in the queue to be received by receive.
+   * If the limit is exceeded, TDLib client instances postpone fetching of missed updates from the server,
+   * until enough responses are received. Responses and updates are never dropped.
+   * Multithreading is required for this method to have any effect.
+   *
+   * \param[in] max_size The maximum size of the queue; pass 0 to remove the limit. By default, there is no limit.
+   */
+  void set_response_queue_limit(std::size_t max_size);
+
+  /**
+   * Returns the number of responses and updates, which are waiting in the queue to be received by receive.
+   *
+   * \return The current size of the queue.
+   */
+  std::size_t get_response_queue_size() const;
+
+  /**
+   * Returns the number of times fetching of missed updates was postponed because of the response queue limit.
+   *
+   * \return The number of postponements.
+   */
+  std::uint64_t get_postponed_update_fetching_count() const;
+
   /**
    * Destroys the client manager and all TDLib client instances managed by it.
    */
@@ -0,0 +1,98 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2022
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "td/telegram/ClientBinary.h"
+
+#include "td/telegram/Client.h"
+#include "td/telegram/td_api.h"
+
+#include "td/utils/logging.h"
+#include "td/utils/misc.h"
+#include "td/utils/port/thread_local.h"
+#include "td/utils/SliceBuilder.h"
+#include "td/utils/tl_parsers.h"
+#include "td/utils/tl_storers.h"
+
+#include <utility>
+
+namespace td {
+
+static td_api::object_ptr<td_api::Function> to_request(Slice request) {
+  TlParser parser(request);
+  auto function = td_api::Function::fetch(parser);
+  parser.fetch_end();
+  auto status = parser.get_status();
+  if (status.is_error() || function == nullptr) {
+    auto error = td_api::make_object<td_api::error>(400, PSTRING() << "Failed to parse TDLib request: " << status);
+    return td_api::make_object<td_api::testReturnError>(std::move(error));
+  }
+  return function;
+}
+
+static constexpr size_t MAX_KEPT_OUTPUT_BUFFER_SIZE = 1 << 24;
+
+static TD_THREAD_LOCAL string *current_output;
+
+// serializes the boxed object to the thread-local buffer, which is reused by subsequent responses
+static const char *store_response(const td_api::Object &object, int *response_length) {
+  init_thread_local<string>(current_output);
+  auto &output = *current_output;
+
+  TlStorerCalcLength storer_calc_length;
+  storer_calc_length.store_binary(object.get_id());
+  object.store(storer_calc_length);
+  auto length = storer_calc_length.get_length();
+
+  if (output.capacity() > MAX_KEPT_OUTPUT_BUFFER_SIZE && length <= MAX_KEPT_OUTPUT_BUFFER_SIZE) {
+    string().swap(output);
+  }
+  output.resize(length);
+  auto buf = MutableSlice(output).ubegin();
+  TlStorerUnsafe storer_unsafe(buf);
+  storer_unsafe.store_binary(object.get_id());
+  object.store(storer_unsafe);
+  CHECK(static_cast<size_t>(storer_unsafe.get_buf() - buf) == length);
+
+  *response_length = narrow_cast<int>(length);
+  return output.data();
+}
+
+static ClientManager *get_manager() {
+  return ClientManager::get_manager_singleton();
+}
+
+int binary_create_client_id() {
+  return static_cast<int>(get_manager()->create_client_id());
+}
+
+void binary_send(int client_id, int64 request_id, Slice request) {
+  if (request_id <= 0) {
+    // responses with zero request identifier are updates
+    LOG(ERROR) << "Ignore request with invalid identifier " << request_id;
+    return;
+  }
+  get_manager()->send(client_id, static_cast<ClientManager::RequestId>(request_id), to_request(request));
+}
+
+const char *binary_receive(double timeout, int *client_id, int64 *request_id, int *response_length) {
+  auto response = get_manager()->receive(timeout);
+  if (!response.object) {
+    *client_id = 0;
+    *request_id = 0;
+    *response_length = 0;
+    return nullptr;
+  }
+
+  *client_id = static_cast<int>(response.client_id);
+  *request_id = static_cast<int64>(response.request_id);
+  return store_response(*response.object, response_length);
+}
+
+const char *binary_execute(Slice request, int *response_length) {
+  return store_response(*ClientManager::execute(to_request(request)), response_length);
+}
+
+}  // namespace td
@@ -0,0 +1,22 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2022
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#pragma once
+
+#include "td/utils/common.h"
+#include "td/utils/Slice.h"
+
+namespace td {
+
+int binary_create_client_id();
+
+void binary_send(int client_id, int64 request_id, Slice request);
+
+const char *binary_receive(double timeout, int *client_id, int64 *request_id, int *response_length);
+
+const char *binary_execute(Slice request, int *response_length);
+
+}  // namespace td
@@ -11,9 +11,9 @@
 
 #include "td/utils/common.h"
 #include "td/utils/JsonBuilder.h"
+#include "td/utils/misc.h"
 #include "td/utils/port/thread_local.h"
 #include "td/utils/SliceBuilder.h"
-#include "td/utils/StackAllocator.h"
 #include "td/utils/StringBuilder.h"
 
 #include <utility>
@@ -54,9 +54,38 @@ static std::pair<td_api::object_ptr<td_api::Function>, string> to_request(Slice
   return std::make_pair(std::move(func), std::move(extra));
 }
 
-static string from_response(const td_api::Object &object, const string &extra, int client_id) {
-  auto buf = StackAllocator::alloc(1 << 18);
-  JsonBuilder jb(StringBuilder(buf.as_slice(), true), -1);
+// returns approximate size of JSON representation of lists of messages and other big objects
+static size_t get_json_size_estimate(const td_api::Object &object) {
+  constexpr size_t MESSAGE_SIZE = 2000;
+  switch (object.get_id()) {
+    case td_api::messages::ID:
+      return static_cast<const td_api::messages &>(object).messages_.size() * MESSAGE_SIZE;
+    case td_api::foundMessages::ID:
+      return static_cast<const td_api::foundMessages &>(object).messages_.size() * MESSAGE_SIZE;
+    case td_api::chatEvents::ID:
+      return static_cast<const td_api::chatEvents &>(object).events_.size() * MESSAGE_SIZE;
+    case td_api::chatMembers::ID:
+      return static_cast<const td_api::chatMembers &>(object).members_.size() * 200;
+    case td_api::stickers::ID:
+      return static_cast<const td_api::stickers &>(object).stickers_.size() * 1000;
+    default:
+      return 0;
+  }
+}
+
+static constexpr size_t MIN_OUTPUT_BUFFER_SIZE = 1 << 18;
+static constexpr size_t MAX_KEPT_OUTPUT_BUFFER_SIZE = 1 << 24;
+
+// serializes the null-terminated response directly to the output buffer after the first offset bytes
+// returns the size of the buffer prefix used after serialization
+static size_t write_response(string &output, size_t offset, const td_api::Object &object, const string &extra,
+                             int client_id) {
+  // allocate enough memory beforehand to avoid multiple reallocations of the buffer
+  auto buffer_size = offset + max(get_json_size_estimate(object), MIN_OUTPUT_BUFFER_SIZE);
+  if (output.size() < buffer_size) {
+    output.resize(buffer_size);
+  }
+  JsonBuilder jb(StringBuilder(MutableSlice(output).substr(offset), true), -1);
   jb.enter_value() << ToJson(object);
   auto &sb = jb.string_builder();
   auto slice = sb.as_cslice();
@@ -69,23 +98,62 @@ static string from_response(const td_api::Object &object, const string &extra, i
     sb << ",\"@client_id\":" << client_id;
   }
   sb << '}';
-  return sb.as_cslice().str();
+  auto result = sb.as_cslice();
+  if (result.begin() != &output[offset]) {
+    // the buffer was too small; keep the bigger buffer for next responses
+    output.resize(offset);
+    output.append(result.begin(), result.size());
+    output.push_back('\0');
+  }
+  return offset + result.size() + 1;
+}
+
+static void prepare_output(string &output) {
+  if (output.size() > MAX_KEPT_OUTPUT_BUFFER_SIZE) {
+    string().swap(output);
+  }
 }
 
 static TD_THREAD_LOCAL string *current_output;
 
-static const char *store_string(string str) {
+// serializes the response to the thread-local buffer, which is reused by subsequent responses
+static const char *store_response(const td_api::Object &object, const string &extra, int client_id) {
   init_thread_local<string>(current_output);
-  *current_output = std::move(str);
-  return current_output->c_str();
+  auto &output = *current_output;
+  prepare_output(output);
+  write_response(output, 0, object, extra, client_id);
+  return output.c_str();
+}
+
+void ClientJsonExtraStorage::set(std::uint64_t request_id, std::string extra) {
+  auto &shard = shards_[request_id % SHARD_COUNT];
+  std::lock_guard<std::mutex> guard(shard.mutex_);
+  shard.extra_[request_id] = std::move(extra);
+  shard.size_.store(shard.extra_.size(), std::memory_order_release);
+}
+
+std::string ClientJsonExtraStorage::extract(std::uint64_t request_id) {
+  auto &shard = shards_[request_id % SHARD_COUNT];
+  if (shard.size_.load(std::memory_order_acquire) == 0) {
+    // there are no requests with "@extra" in the shard
+    return std::string();
+  }
+  std::lock_guard<std::mutex> guard(shard.mutex_);
+  auto it = shard.extra_.find(request_id);
+  if (it == shard.extra_.end()) {
+    return std::string();
+  }
+  auto result = std::move(it->second);
+  shard.extra_.erase(it);
+  shard.size_.store(shard.extra_.size(), std::memory_order_release);
+  return result;
 }
 
 void ClientJson::send(Slice request) {
   auto parsed_request = to_request(request);
   std::uint64_t extra_id = extra_id_.fetch_add(1, std::memory_order_relaxed);
   if (!parsed_request.second.empty()) {
-    std::lock_guard<std::mutex> guard(mutex_);
-    extra_[extra_id] = std::move(parsed_request.second);
+    extra_.set(extra_id, std::move(parsed_request.second));
   }
   client_.send(Client::Request{extra_id, std::move(parsed_request.first)});
 }
@@ -98,28 +166,22 @@ const char *ClientJson::receive(double timeout) {
 
   string extra;
   if (response.id != 0) {
-    std::lock_guard<std::mutex> guard(mutex_);
-    auto it = extra_.find(response.id);
-    if (it != extra_.end()) {
-      extra = std::move(it->second);
-      extra_.erase(it);
-    }
+    extra = extra_.extract(response.id);
   }
-  return store_string(from_response(*response.object, extra, 0));
+  return store_response(*response.object, extra, 0);
 }
 
 const char *ClientJson::execute(Slice request) {
   auto parsed_request = to_request(request);
-  return store_string(from_response(*Client::execute(Client::Request{0, std::move(parsed_request.first)}).object,
-                                    parsed_request.second, 0));
+  return store_response(*Client::execute(Client::Request{0, std::move(parsed_request.first)}).object,
+                        parsed_request.second, 0);
 }
 
 static ClientManager *get_manager() {
   return ClientManager::get_manager_singleton();
 }
 
-static std::mutex extra_mutex;
-static std::unordered_map<int64, string> extra;
+static ClientJsonExtraStorage extra;
 static std::atomic<uint64> extra_id{1};
 
 int json_create_client_id() {
@@ -130,12 +192,25 @@ void json_send(int client_id, Slice request) {
   auto parsed_request = to_request(request);
   auto request_id = extra_id.fetch_add(1, std::memory_order_relaxed);
   if (!parsed_request.second.empty()) {
-    std::lock_guard<std::mutex> guard(extra_mutex);
-    extra[request_id] = std::move(parsed_request.second);
+    extra.set(request_id, std::move(parsed_request.second));
   }
   get_manager()->send(client_id, request_id, std::move(parsed_request.first));
 }
 
+void json_send_batch(int client_id, const vector<Slice> &requests) {
+  vector<ClientManager::Request> parsed_requests;
+  parsed_requests.reserve(requests.size());
+  for (auto request : requests) {
+    auto parsed_request = to_request(request);
+    auto request_id = extra_id.fetch_add(1, std::memory_order_relaxed);
+    if (!parsed_request.second.empty()) {
+      extra.set(request_id, std::move(parsed_request.second));
+    }
+    parsed_requests.push_back({client_id, request_id, std::move(parsed_request.first)});
+  }
+  get_manager()->send_many(std::move(parsed_requests));
+}
+
 const char *json_receive(double timeout) {
   auto response = get_manager()->receive(timeout);
   if (!response.object) {
@@ -144,20 +219,40 @@ const char *json_receive(double timeout) {
 
   string extra_str;
   if (response.request_id != 0) {
-    std::lock_guard<std::mutex> guard(extra_mutex);
-    auto it = extra.find(response.request_id);
-    if (it != extra.end()) {
-      extra_str = std::move(it->second);
-      extra.erase(it);
+    extra_str = extra.extract(response.request_id);
+  }
+  return store_response(*response.object, extra_str, response.client_id);
+}
+
+static TD_THREAD_LOCAL string *current_batch_output;
+static TD_THREAD_LOCAL vector<int> *current_batch_offsets;
+
+const char *json_receive_batch(double timeout, int max_count, int *response_count, const int **response_offsets) {
+  auto responses = get_manager()->receive_many(timeout, static_cast<size_t>(max(max_count, 0)));
+
+  init_thread_local<string>(current_batch_output);
+  init_thread_local<vector<int>>(current_batch_offsets);
+  auto &output = *current_batch_output;
+  auto &offsets = *current_batch_offsets;
+  prepare_output(output);
+  offsets.clear();
+  size_t offset = 0;
+  for (auto &response : responses) {
+    string extra_str;
+    if (response.request_id != 0) {
+      extra_str = extra.extract(response.request_id);
     }
+    offsets.push_back(narrow_cast<int>(offset));
+    offset = write_response(output, offset, *response.object, extra_str, response.client_id);
   }
-  return store_string(from_response(*response.object, extra_str, response.client_id));
+  *response_count = narrow_cast<int>(offsets.size());
+  *response_offsets = offsets.data();
+  return offsets.empty() ? nullptr : output.c_str();
 }
 
 const char *json_execute(Slice request) {
   auto parsed_request = to_request(request);
-  return store_string(
-      from_response(*ClientManager::execute(std::move(parsed_request.first)), parsed_request.second, 0));
+  return store_response(*ClientManager::execute(std::move(parsed_request.first)), parsed_request.second, 0);
 }
 
 }  // namespace td
@@ -8,9 +8,11 @@
 
 #include "td/telegram/Client.h"
 
+#include "td/utils/common.h"
 #include "td/utils/Slice.h"
 
 #include <atomic>
+#include <cstddef>
 #include <cstdint>
 #include <mutex>
 #include <string>
@@ -18,6 +20,24 @@
 
 namespace td {
 
+// stores "@extra" fields of pending requests; sharded to reduce lock contention between sending and receiving threads
+class ClientJsonExtraStorage {
+ public:
+  void set(std::uint64_t request_id, std::string extra);
+
+  std::string extract(std::uint64_t request_id);
+
+ private:
+  static constexpr std::size_t SHARD_COUNT = 16;
+
+  struct Shard {
+    std::mutex mutex_;
+    std::atomic<std::size_t> size_{0};
+    std::unordered_map<std::uint64_t, std::string> extra_;
+  };
+  Shard shards_[SHARD_COUNT];
+};
+
 // TODO can be removed in TDLib 2.0
 class ClientJson final {
  public:
@@ -29,8 +49,7 @@ class ClientJson final {
 
  private:
   Client client_;
-  std::mutex mutex_;  // for extra_
-  std::unordered_map<std::int64_t, std::string> extra_;
+  ClientJsonExtraStorage extra_;
   std::atomic<std::uint64_t> extra_id_{1};
 };
 
@@ -38,8 +57,12 @@ int json_create_client_id();
 
 void json_send(int client_id, Slice request);
 
+void json_send_batch(int client_id, const vector<Slice> &requests);
+
 const char *json_receive(double timeout);
 
+const char *json_receive_batch(double timeout, int max_count, int *response_count, const int **response_offsets);
+
 const char *json_execute(Slice request);
 
 }  // namespace td
@@ -480,8 +480,7 @@ static ActorOwn<> get_full_config(DcOption option, Promise<tl_object_ptr<telegra
 
    private:
     DcId dc_id_;
-    std::shared_ptr<PublicRsaKeyShared> public_rsa_key_ =
-        std::make_shared<PublicRsaKeyShared>(DcId::empty(), G()->is_test_dc());
+    std::shared_ptr<PublicRsaKeyShared> public_rsa_key_ = PublicRsaKeyShared::get_common(G()->is_test_dc());
 
     std::vector<unique_ptr<Listener>> auth_key_listeners_;
     void notify() {
@@ -6,12 +6,15 @@
 //
 #include "td/telegram/ConfigShared.h"
 
+#include "td/utils/HashTableUtils.h"
 #include "td/utils/logging.h"
 #include "td/utils/misc.h"
 #include "td/utils/SliceBuilder.h"
 
 namespace td {
 
+constexpr size_t ConfigShared::OPTION_CACHE_SIZE;
+
 ConfigShared::ConfigShared(std::shared_ptr<KeyValueSyncInterface> config_pmc) : config_pmc_(std::move(config_pmc)) {
 }
 
@@ -63,6 +66,16 @@ std::unordered_map<string, string> ConfigShared::get_options() const {
 }
 
 bool ConfigShared::get_option_boolean(Slice name, bool default_value) const {
+  CachedOption option;
+  if (get_cached_option(name, option)) {
+    if (option.type == '\0') {
+      return default_value;
+    }
+    if (option.type == 'B') {
+      return option.value != 0;
+    }
+  }
+
   auto value = get_option(name);
   if (value.empty()) {
     return default_value;
@@ -78,6 +91,16 @@ bool ConfigShared::get_option_boolean(Slice name, bool default_value) const {
 }
 
 int64 ConfigShared::get_option_integer(Slice name, int64 default_value) const {
+  CachedOption option;
+  if (get_cached_option(name, option)) {
+    if (option.type == '\0') {
+      return default_value;
+    }
+    if (option.type == 'I') {
+      return option.value;
+    }
+  }
+
   auto str_value = get_option(name);
   if (str_value.empty()) {
     return default_value;
@@ -101,12 +124,84 @@ string ConfigShared::get_option_string(Slice name, string default_value) const {
   return str_value.substr(1);
 }
 
+uint32 ConfigShared::get_option_name_hash(Slice name) {
+  size_t hash = 0;
+  for (auto c : name) {
+    hash = hash * 31 + static_cast<unsigned char>(c);
+  }
+  return randomize_hash(hash);
+}
+
+ConfigShared::CachedOption ConfigShared::parse_cached_option(Slice value) {
+  CachedOption option;
+  if (value.empty()) {
+    return option;
+  }
+  option.type = 'S';
+  if (value == "Btrue" || value == "Bfalse") {
+    option.type = 'B';
+    option.value = value == "Btrue";
+  } else if (value[0] == 'I') {
+    auto r_value = to_integer_safe<int64>(value.substr(1));
+    if (r_value.is_ok()) {
+      option.type = 'I';
+      option.value = r_value.ok();
+    }
+  }
+  return option;
+}
+
+ConfigShared::CachedOptionSlot *ConfigShared::find_cached_option_slot(Slice name, uint32 hash) const {
+  for (size_t i = 0; i < OPTION_CACHE_SIZE; i++) {
+    auto slot = option_cache_[(hash + i) & (OPTION_CACHE_SIZE - 1)].load(std::memory_order_acquire);
+    if (slot == nullptr || slot->name == name) {
+      return slot;
+    }
+  }
+  return nullptr;
+}
+
+bool ConfigShared::get_cached_option(Slice name, CachedOption &option) const {
+  auto hash = get_option_name_hash(name);
+  auto slot = find_cached_option_slot(name, hash);
+  if (slot == nullptr) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    slot = find_cached_option_slot(name, hash);
+    if (slot == nullptr) {
+      if (option_cache_slots_.size() >= OPTION_CACHE_SIZE / 2) {
+        return false;
+      }
+      option_cache_slots_.push_back(make_unique<CachedOptionSlot>());
+      slot = option_cache_slots_.back().get();
+      slot->name = name.str();
+      *slot->option.lock() = parse_cached_option(config_pmc_->get(slot->name));
+
+      size_t pos = hash & (OPTION_CACHE_SIZE - 1);
+      while (option_cache_[pos].load(std::memory_order_relaxed) != nullptr) {
+        pos = (pos + 1) & (OPTION_CACHE_SIZE - 1);
+      }
+      option_cache_[pos].store(slot, std::memory_order_release);
+    }
+  }
+  slot->option.read(option);
+  return true;
+}
+
 bool ConfigShared::set_option(Slice name, Slice value) {
+  std::lock_guard<std::mutex> guard(mutex_);
+  bool is_changed;
   if (value.empty()) {
-    return config_pmc_->erase(name.str()) != 0;
+    is_changed = config_pmc_->erase(name.str()) != 0;
   } else {
-    return config_pmc_->set(name.str(), value.str()) != 0;
+    is_changed = config_pmc_->set(name.str(), value.str()) != 0;
+  }
+  if (is_changed) {
+    auto slot = find_cached_option_slot(name, get_option_name_hash(name));
+    if (slot != nullptr) {
+      *slot->option.lock() = parse_cached_option(value);
+    }
   }
+  return is_changed;
 }
 
 void ConfigShared::on_option_updated(Slice name) const {
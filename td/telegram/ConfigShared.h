@@ -8,10 +8,14 @@
 
 #include "td/db/KeyValueSyncInterface.h"
 
+#include "td/utils/AtomicRead.h"
 #include "td/utils/common.h"
 #include "td/utils/Slice.h"
 
+#include <array>
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include <unordered_map>
 
 namespace td {
@@ -52,6 +56,32 @@ class ConfigShared {
   std::shared_ptr<KeyValueSyncInterface> config_pmc_;
   unique_ptr<Callback> callback_;
 
+  // parsed value of a boolean or an integer option
+  struct CachedOption {
+    char type = '\0';  // '\0' for absent options, 'B' or 'I' for cached options and 'S' for all other options
+    int64 value = 0;
+  };
+
+  struct CachedOptionSlot {
+    string name;
+    AtomicRead<CachedOption> option;
+  };
+
+  // options are read from all threads much more often than they are changed, so parsed values of used options are
+  // cached in a lock-free open addressing hash table; slots are never removed and are updated under the mutex
+  static constexpr size_t OPTION_CACHE_SIZE = 512;
+  mutable std::array<std::atomic<CachedOptionSlot *>, OPTION_CACHE_SIZE> option_cache_{};
+  mutable vector<unique_ptr<CachedOptionSlot>> option_cache_slots_;
+  mutable std::mutex mutex_;
+
+  static uint32 get_option_name_hash(Slice name);
+
+  static CachedOption parse_cached_option(Slice value);
+
+  bool get_cached_option(Slice name, CachedOption &option) const;
+
+  CachedOptionSlot *find_cached_option_slot(Slice name, uint32 hash) const;
+
   bool set_option(Slice name, Slice value);
 
   void on_option_updated(Slice name) const;
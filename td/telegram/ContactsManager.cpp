@@ -22,6 +22,7 @@
 #include "td/telegram/LinkManager.h"
 #include "td/telegram/logevent/LogEvent.h"
 #include "td/telegram/logevent/LogEventHelper.h"
+#include "td/telegram/MemoryStats.h"
 #include "td/telegram/MessageSender.h"
 #include "td/telegram/MessagesManager.h"
 #include "td/telegram/MessageTtl.h"
@@ -54,6 +55,7 @@
 
 #include "td/utils/algorithm.h"
 #include "td/utils/buffer.h"
+#include "td/utils/crypto.h"
 #include "td/utils/format.h"
 #include "td/utils/logging.h"
 #include "td/utils/misc.h"
@@ -3258,6 +3260,18 @@ ContactsManager::ContactsManager(Td *td, ActorShared<> parent) : td_(td), parent
 
   channel_participant_cache_timeout_.set_callback(on_channel_participant_cache_timeout_callback);
   channel_participant_cache_timeout_.set_callback_data(static_cast<void *>(this));
+
+  user_full_unload_timeout_.set_callback(on_user_full_unload_timeout_callback);
+  user_full_unload_timeout_.set_callback_data(static_cast<void *>(this));
+
+  channel_full_unload_timeout_.set_callback(on_channel_full_unload_timeout_callback);
+  channel_full_unload_timeout_.set_callback_data(static_cast<void *>(this));
+
+  user_status_update_timeout_.set_callback(on_user_status_update_timeout_callback);
+  user_status_update_timeout_.set_callback_data(static_cast<void *>(this));
+
+  dialog_online_member_count_timeout_.set_callback(on_dialog_online_member_count_timeout_callback);
+  dialog_online_member_count_timeout_.set_callback_data(static_cast<void *>(this));
 }
 
 ContactsManager::~ContactsManager() = default;
@@ -3305,8 +3319,7 @@ void ContactsManager::on_user_online_timeout(UserId user_id) {
   CHECK(u->is_update_user_sent);
 
   LOG(INFO) << "Update " << user_id << " online status to offline";
-  send_closure(G()->td(), &Td::send_update,
-               td_api::make_object<td_api::updateUserStatus>(user_id.get(), get_user_status_object(user_id, u)));
+  schedule_user_status_update(user_id);
 
   update_user_online_member_count(u);
 }
@@ -3456,6 +3469,184 @@ void ContactsManager::on_channel_participant_cache_timeout(ChannelId channel_id)
   }
 }
 
+void ContactsManager::on_user_full_unload_timeout_callback(void *contacts_manager_ptr, int64 user_id_long) {
+  if (G()->close_flag()) {
+    return;
+  }
+
+  auto contacts_manager = static_cast<ContactsManager *>(contacts_manager_ptr);
+  send_closure_later(contacts_manager->actor_id(contacts_manager), &ContactsManager::on_user_full_unload_timeout,
+                     UserId(user_id_long));
+}
+
+void ContactsManager::on_user_full_unload_timeout(UserId user_id) {
+  if (G()->close_flag()) {
+    return;
+  }
+
+  auto it = users_full_.find(user_id);
+  if (it == users_full_.end()) {
+    return;
+  }
+
+  // the full info was saved to the database, so it can be loaded again by get_user_full_force when needed
+  const auto *user_full = it->second.get();
+  auto unload_in = user_full->last_access_time + FULL_INFO_UNLOAD_DELAY - Time::now();
+  if (unload_in > 0) {
+    user_full_unload_timeout_.set_timeout_in(user_id.get(), unload_in + 1);
+    return;
+  }
+  if (user_full->is_changed || user_full->need_send_update || user_full->need_save_to_database) {
+    user_full_unload_timeout_.set_timeout_in(user_id.get(), FULL_INFO_UNLOAD_DELAY);
+    return;
+  }
+
+  LOG(INFO) << "Unload full " << user_id;
+  users_full_.erase(it);
+  unavailable_user_fulls_.erase(user_id);
+}
+
+void ContactsManager::on_channel_full_unload_timeout_callback(void *contacts_manager_ptr, int64 channel_id_long) {
+  if (G()->close_flag()) {
+    return;
+  }
+
+  auto contacts_manager = static_cast<ContactsManager *>(contacts_manager_ptr);
+  send_closure_later(contacts_manager->actor_id(contacts_manager), &ContactsManager::on_channel_full_unload_timeout,
+                     ChannelId(channel_id_long));
+}
+
+void ContactsManager::on_channel_full_unload_timeout(ChannelId channel_id) {
+  if (G()->close_flag()) {
+    return;
+  }
+
+  auto it = channels_full_.find(channel_id);
+  if (it == channels_full_.end()) {
+    return;
+  }
+
+  const auto *channel_full = it->second.get();
+  auto unload_in = channel_full->last_access_time + FULL_INFO_UNLOAD_DELAY - Time::now();
+  if (unload_in > 0) {
+    channel_full_unload_timeout_.set_timeout_in(channel_id.get(), unload_in + 1);
+    return;
+  }
+  if (channel_full->is_changed || channel_full->need_send_update || channel_full->need_save_to_database) {
+    channel_full_unload_timeout_.set_timeout_in(channel_id.get(), FULL_INFO_UNLOAD_DELAY);
+    return;
+  }
+
+  LOG(INFO) << "Unload full " << channel_id;
+  channels_full_.erase(it);
+  unavailable_channel_fulls_.erase(channel_id);
+}
+
+void ContactsManager::on_user_status_update_timeout_callback(void *contacts_manager_ptr, int64 user_id_long) {
+  if (G()->close_flag()) {
+    return;
+  }
+
+  auto contacts_manager = static_cast<ContactsManager *>(contacts_manager_ptr);
+  send_closure_later(contacts_manager->actor_id(contacts_manager), &ContactsManager::on_user_status_update_timeout,
+                     UserId(user_id_long));
+}
+
+void ContactsManager::on_user_status_update_timeout(UserId user_id) {
+  if (G()->close_flag()) {
+    return;
+  }
+
+  if (td_->is_update_ignored(td_api::updateUserStatus::ID)) {
+    return;
+  }
+
+  auto u = get_user(user_id);
+  CHECK(u != nullptr);
+  CHECK(u->is_update_user_sent);
+  send_closure(G()->td(), &Td::send_update,
+               td_api::make_object<td_api::updateUserStatus>(user_id.get(), get_user_status_object(user_id, u)));
+}
+
+void ContactsManager::on_dialog_online_member_count_timeout_callback(void *contacts_manager_ptr,
+                                                                     int64 dialog_id_long) {
+  if (G()->close_flag()) {
+    return;
+  }
+
+  auto contacts_manager = static_cast<ContactsManager *>(contacts_manager_ptr);
+  send_closure_later(contacts_manager->actor_id(contacts_manager),
+                     &ContactsManager::on_dialog_online_member_count_timeout, DialogId(dialog_id_long));
+}
+
+void ContactsManager::on_dialog_online_member_count_timeout(DialogId dialog_id) {
+  if (G()->close_flag()) {
+    return;
+  }
+
+  switch (dialog_id.get_type()) {
+    case DialogType::Chat: {
+      auto chat_id = dialog_id.get_chat_id();
+      auto chat_full = get_chat_full(chat_id);
+      if (chat_full != nullptr) {
+        update_chat_online_member_count(chat_full, chat_id, false);
+      }
+      break;
+    }
+    case DialogType::Channel:
+      update_channel_online_member_count(dialog_id.get_channel_id(), false);
+      break;
+    case DialogType::User:
+    case DialogType::SecretChat:
+    case DialogType::None:
+    default:
+      UNREACHABLE();
+      break;
+  }
+}
+
+const vector<RestrictionReason> &ContactsManager::User::get_restriction_reasons() const {
+  static const vector<RestrictionReason> empty_restriction_reasons;
+  if (rare_fields == nullptr) {
+    return empty_restriction_reasons;
+  }
+  return rare_fields->restriction_reasons;
+}
+
+void ContactsManager::User::set_restriction_reasons(vector<RestrictionReason> &&new_restriction_reasons) {
+  if (rare_fields == nullptr) {
+    if (new_restriction_reasons.empty()) {
+      return;
+    }
+    rare_fields = make_unique<RareFields>();
+  }
+  rare_fields->restriction_reasons = std::move(new_restriction_reasons);
+  if (rare_fields->restriction_reasons.empty() && rare_fields->inline_query_placeholder.empty()) {
+    rare_fields = nullptr;
+  }
+}
+
+const string &ContactsManager::User::get_inline_query_placeholder() const {
+  static const string empty_inline_query_placeholder;
+  if (rare_fields == nullptr) {
+    return empty_inline_query_placeholder;
+  }
+  return rare_fields->inline_query_placeholder;
+}
+
+void ContactsManager::User::set_inline_query_placeholder(string &&new_inline_query_placeholder) {
+  if (rare_fields == nullptr) {
+    if (new_inline_query_placeholder.empty()) {
+      return;
+    }
+    rare_fields = make_unique<RareFields>();
+  }
+  rare_fields->inline_query_placeholder = std::move(new_inline_query_placeholder);
+  if (rare_fields->restriction_reasons.empty() && rare_fields->inline_query_placeholder.empty()) {
+    rare_fields = nullptr;
+  }
+}
+
 template <class StorerT>
 void ContactsManager::User::store(StorerT &storer) const {
   using td::store;
@@ -3466,7 +3657,7 @@ void ContactsManager::User::store(StorerT &storer) const {
   bool have_access_hash = access_hash != -1;
   bool has_cache_version = cache_version != 0;
   bool has_is_contact = true;
-  bool has_restriction_reasons = !restriction_reasons.empty();
+  bool has_restriction_reasons = !get_restriction_reasons().empty();
   BEGIN_STORE_FLAGS();
   STORE_FLAG(is_received);
   STORE_FLAG(is_verified);
@@ -3509,10 +3700,10 @@ void ContactsManager::User::store(StorerT &storer) const {
   }
   store(was_online, storer);
   if (has_restriction_reasons) {
-    store(restriction_reasons, storer);
+    store(get_restriction_reasons(), storer);
   }
   if (is_inline_bot) {
-    store(inline_query_placeholder, storer);
+    store(get_inline_query_placeholder(), storer);
   }
   if (is_bot) {
     store(bot_info_version, storer);
@@ -3597,12 +3788,16 @@ void ContactsManager::User::parse(ParserT &parser) {
   if (legacy_is_restricted) {
     string restriction_reason;
     parse(restriction_reason, parser);
-    restriction_reasons = get_restriction_reasons(restriction_reason);
+    set_restriction_reasons(td::get_restriction_reasons(restriction_reason));
   } else if (has_restriction_reasons) {
+    vector<RestrictionReason> restriction_reasons;
     parse(restriction_reasons, parser);
+    set_restriction_reasons(std::move(restriction_reasons));
   }
   if (is_inline_bot) {
+    string inline_query_placeholder;
     parse(inline_query_placeholder, parser);
+    set_inline_query_placeholder(std::move(inline_query_placeholder));
   }
   if (is_bot) {
     parse(bot_info_version, parser);
@@ -3614,24 +3809,24 @@ void ContactsManager::User::parse(ParserT &parser) {
     parse(cache_version, parser);
   }
 
-  if (!check_utf8(first_name)) {
+  if (!check_utf8(first_name.str())) {
     LOG(ERROR) << "Have invalid first name \"" << first_name << '"';
     first_name.clear();
     cache_version = 0;
   }
-  if (!check_utf8(last_name)) {
+  if (!check_utf8(last_name.str())) {
     LOG(ERROR) << "Have invalid last name \"" << last_name << '"';
     last_name.clear();
     cache_version = 0;
   }
-  if (!check_utf8(username)) {
+  if (!check_utf8(username.str())) {
     LOG(ERROR) << "Have invalid username \"" << username << '"';
     username.clear();
     cache_version = 0;
   }
 
   if (first_name.empty() && last_name.empty()) {
-    first_name = phone_number;
+    first_name = InternedString(phone_number);
   }
   if (!is_contact && is_mutual_contact) {
     LOG(ERROR) << "Have invalid flag is_mutual_contact";
@@ -4076,7 +4271,7 @@ void ContactsManager::Channel::parse(ParserT &parser) {
     title.clear();
     cache_version = 0;
   }
-  if (!check_utf8(username)) {
+  if (!check_utf8(username.str())) {
     LOG(ERROR) << "Have invalid username \"" << username << '"';
     username.clear();
     cache_version = 0;
@@ -4640,10 +4835,10 @@ string ContactsManager::get_user_title(UserId user_id) const {
     return string();
   }
   if (u->last_name.empty()) {
-    return u->first_name;
+    return u->first_name.str();
   }
   if (u->first_name.empty()) {
-    return u->last_name;
+    return u->last_name.str();
   }
   return PSTRING() << u->first_name << ' ' << u->last_name;
 }
@@ -4794,7 +4989,7 @@ string ContactsManager::get_user_username(UserId user_id) const {
   if (u == nullptr) {
     return string();
   }
-  return u->username;
+  return u->username.str();
 }
 
 string ContactsManager::get_secret_chat_username(SecretChatId secret_chat_id) const {
@@ -4810,7 +5005,7 @@ string ContactsManager::get_channel_username(ChannelId channel_id) const {
   if (c == nullptr) {
     return string();
   }
-  return c->username;
+  return c->username.str();
 }
 
 UserId ContactsManager::get_secret_chat_user_id(SecretChatId secret_chat_id) const {
@@ -8260,6 +8455,64 @@ ChannelId ContactsManager::get_channel_id(const tl_object_ptr<telegram_api::Chat
   }
 }
 
+uint64 ContactsManager::get_user_fingerprint(const telegram_api::user *user) {
+  uint64 fingerprint = 0;
+  auto combine = [&fingerprint](uint64 value) {
+    fingerprint = fingerprint * 1000003 ^ value;
+  };
+  auto combine_string = [&combine](Slice str) {
+    combine(str.empty() ? 0 : crc64(str));
+  };
+
+  combine(static_cast<uint32>(user->flags_));
+  combine(static_cast<uint64>(user->access_hash_));
+  combine_string(user->first_name_);
+  combine_string(user->last_name_);
+  combine_string(user->username_);
+  combine_string(user->phone_);
+  if (user->photo_ == nullptr) {
+    combine(0);
+  } else {
+    combine(static_cast<uint32>(user->photo_->get_id()));
+    if (user->photo_->get_id() == telegram_api::userProfilePhoto::ID) {
+      auto photo = static_cast<const telegram_api::userProfilePhoto *>(user->photo_.get());
+      combine(static_cast<uint32>(photo->flags_));
+      combine(static_cast<uint64>(photo->photo_id_));
+      combine_string(photo->stripped_thumb_.as_slice());
+      combine(static_cast<uint32>(photo->dc_id_));
+    }
+  }
+  if (user->status_ == nullptr) {
+    combine(0);
+  } else {
+    combine(static_cast<uint32>(user->status_->get_id()));
+    switch (user->status_->get_id()) {
+      case telegram_api::userStatusOnline::ID: {
+        auto status = static_cast<const telegram_api::userStatusOnline *>(user->status_.get());
+        combine(static_cast<uint32>(status->expires_));
+        break;
+      }
+      case telegram_api::userStatusOffline::ID: {
+        auto status = static_cast<const telegram_api::userStatusOffline *>(user->status_.get());
+        combine(static_cast<uint32>(status->was_online_));
+        break;
+      }
+      default:
+        break;
+    }
+  }
+  combine(static_cast<uint32>(user->bot_info_version_));
+  combine(user->restriction_reason_.size());
+  for (auto &restriction_reason : user->restriction_reason_) {
+    combine_string(restriction_reason->platform_);
+    combine_string(restriction_reason->reason_);
+    combine_string(restriction_reason->text_);
+  }
+  combine_string(user->bot_inline_placeholder_);
+  combine_string(user->lang_code_);
+  return fingerprint == 0 ? 1 : fingerprint;
+}
+
 void ContactsManager::on_get_user(tl_object_ptr<telegram_api::User> &&user_ptr, const char *source, bool is_me,
                                   bool expect_support) {
   LOG(DEBUG) << "Receive from " << source << ' ' << to_string(user_ptr);
@@ -8288,6 +8541,17 @@ void ContactsManager::on_get_user(tl_object_ptr<telegram_api::User> &&user_ptr,
     LOG(ERROR) << "Receive invalid " << user_id;
     return;
   }
+
+  // the same users are often received many times, so skip applying users, which didn't change since the last time
+  auto fingerprint = get_user_fingerprint(user.get());
+  if (!is_me && !expect_support) {
+    const User *old_u = get_user(user_id);
+    if (old_u != nullptr && old_u->received_fingerprint == fingerprint) {
+      LOG(DEBUG) << "Skip unchanged " << user_id << " from " << source;
+      return;
+    }
+  }
+
   int32 flags = user->flags_;
   LOG(INFO) << "Receive " << user_id << " with flags " << flags << " from " << source;
   if (is_me && (flags & USER_FLAG_IS_ME) == 0) {
@@ -8390,8 +8654,8 @@ void ContactsManager::on_get_user(tl_object_ptr<telegram_api::User> &&user_ptr,
   int32 bot_info_version = has_bot_info_version ? user->bot_info_version_ : -1;
   if (is_verified != u->is_verified || is_support != u->is_support || is_bot != u->is_bot ||
       can_join_groups != u->can_join_groups || can_read_all_group_messages != u->can_read_all_group_messages ||
-      restriction_reasons != u->restriction_reasons || is_scam != u->is_scam || is_fake != u->is_fake ||
-      is_inline_bot != u->is_inline_bot || inline_query_placeholder != u->inline_query_placeholder ||
+      restriction_reasons != u->get_restriction_reasons() || is_scam != u->is_scam || is_fake != u->is_fake ||
+      is_inline_bot != u->is_inline_bot || inline_query_placeholder != u->get_inline_query_placeholder() ||
       need_location_bot != u->need_location_bot) {
     LOG_IF(ERROR, is_bot != u->is_bot && !is_deleted && !u->is_deleted && u->is_received)
         << "User.is_bot has changed for " << user_id << "/" << u->username << " from " << source << " from "
@@ -8401,11 +8665,11 @@ void ContactsManager::on_get_user(tl_object_ptr<telegram_api::User> &&user_ptr,
     u->is_bot = is_bot;
     u->can_join_groups = can_join_groups;
     u->can_read_all_group_messages = can_read_all_group_messages;
-    u->restriction_reasons = std::move(restriction_reasons);
+    u->set_restriction_reasons(std::move(restriction_reasons));
     u->is_scam = is_scam;
     u->is_fake = is_fake;
     u->is_inline_bot = is_inline_bot;
-    u->inline_query_placeholder = std::move(inline_query_placeholder);
+    u->set_inline_query_placeholder(std::move(inline_query_placeholder));
     u->need_location_bot = need_location_bot;
 
     LOG(DEBUG) << "Info has changed for " << user_id;
@@ -8441,7 +8705,7 @@ void ContactsManager::on_get_user(tl_object_ptr<telegram_api::User> &&user_ptr,
   LOG_IF(ERROR, has_language_code && !td_->auth_manager_->is_bot())
       << "Receive language code for " << user_id << " from " << source;
   if (u->language_code != user->lang_code_ && !user->lang_code_.empty()) {
-    u->language_code = user->lang_code_;
+    u->language_code = InternedString(user->lang_code_);
 
     LOG(DEBUG) << "Language code has changed for " << user_id << " to " << u->language_code;
     u->is_changed = true;
@@ -8453,28 +8717,30 @@ void ContactsManager::on_get_user(tl_object_ptr<telegram_api::User> &&user_ptr,
   }
   u->is_received_from_server = true;
   update_user(u, user_id);
+  u->received_fingerprint = fingerprint;
 }
 
 class ContactsManager::UserLogEvent {
  public:
   UserId user_id;
-  User u;
+  const User *u_in = nullptr;
+  User u_out;
 
   UserLogEvent() = default;
 
-  UserLogEvent(UserId user_id, const User &u) : user_id(user_id), u(u) {
+  UserLogEvent(UserId user_id, const User *u) : user_id(user_id), u_in(u) {
   }
 
   template <class StorerT>
   void store(StorerT &storer) const {
     td::store(user_id, storer);
-    td::store(u, storer);
+    td::store(*u_in, storer);
   }
 
   template <class ParserT>
   void parse(ParserT &parser) {
     td::parse(user_id, parser);
-    td::parse(u, parser);
+    td::parse(u_out, parser);
   }
 };
 
@@ -8485,7 +8751,7 @@ void ContactsManager::save_user(User *u, UserId user_id, bool from_binlog) {
   CHECK(u != nullptr);
   if (!u->is_saved || !u->is_status_saved) {  // TODO more effective handling of !u->is_status_saved
     if (!from_binlog) {
-      auto log_event = UserLogEvent(user_id, *u);
+      auto log_event = UserLogEvent(user_id, u);
       auto storer = get_log_event_storer(log_event);
       if (u->log_event_id == 0) {
         u->log_event_id = binlog_add(G()->td_db()->get_binlog(), LogEvent::HandlerType::Users, storer);
@@ -8498,6 +8764,34 @@ void ContactsManager::save_user(User *u, UserId user_id, bool from_binlog) {
   }
 }
 
+void ContactsManager::on_binlog_events(vector<BinlogEvent> &&user_events, vector<BinlogEvent> &&channel_events,
+                                       vector<BinlogEvent> &&chat_events, vector<BinlogEvent> &&secret_chat_events) {
+  if (G()->parameters().use_chat_info_db) {
+    // avoid rehashing of the tables during replay of big binlogs
+    users_.reserve(users_.size() + user_events.size());
+    channels_.reserve(channels_.size() + channel_events.size());
+    chats_.reserve(chats_.size() + chat_events.size());
+    secret_chats_.reserve(secret_chats_.size() + secret_chat_events.size());
+  }
+
+  for (auto &event : user_events) {
+    on_binlog_user_event(std::move(event));
+  }
+
+  for (auto &event : channel_events) {
+    on_binlog_channel_event(std::move(event));
+  }
+
+  // chats may contain links to channels, so should be inited after
+  for (auto &event : chat_events) {
+    on_binlog_chat_event(std::move(event));
+  }
+
+  for (auto &event : secret_chat_events) {
+    on_binlog_secret_chat_event(std::move(event));
+  }
+}
+
 void ContactsManager::on_binlog_user_event(BinlogEvent &&event) {
   if (!G()->parameters().use_chat_info_db) {
     binlog_erase(G()->td_db()->get_binlog(), event.id_);
@@ -8516,7 +8810,7 @@ void ContactsManager::on_binlog_user_event(BinlogEvent &&event) {
 
   LOG(INFO) << "Add " << user_id << " from binlog";
   User *u = add_user(user_id, "on_binlog_user_event");
-  *u = std::move(log_event.u);  // users come from binlog before all other events, so just add them
+  *u = std::move(log_event.u_out);  // users come from binlog before all other events, so just add them
 
   u->log_event_id = event.id_;
 
@@ -8537,7 +8831,8 @@ void ContactsManager::save_user_to_database(User *u, UserId user_id) {
     return;
   }
   if (loaded_from_database_users_.count(user_id)) {
-    save_user_to_database_impl(u, user_id, get_user_database_value(u));
+    pending_saved_users_.insert(user_id);
+    schedule_pending_database_saves();
     return;
   }
   if (load_user_from_database_queries_.count(user_id) != 0) {
@@ -8554,6 +8849,7 @@ void ContactsManager::save_user_to_database_impl(User *u, UserId user_id, string
   u->is_being_saved = true;
   u->is_saved = true;
   u->is_status_saved = true;
+  u->database_value_hash = crc64(value);
   LOG(INFO) << "Trying to save to database " << user_id;
   G()->td_db()->get_sqlite_pmc()->set(
       get_user_database_key(user_id), std::move(value), PromiseCreator::lambda([user_id](Result<> result) {
@@ -8580,6 +8876,7 @@ void ContactsManager::on_save_user_to_database(UserId user_id, bool success) {
   if (!success) {
     LOG(ERROR) << "Failed to save " << user_id << " to database";
     u->is_saved = false;
+    u->database_value_hash = 0;
     u->is_status_saved = false;
   } else {
     LOG(INFO) << "Successfully saved " << user_id << " to database";
@@ -8647,6 +8944,7 @@ void ContactsManager::on_load_user_from_database(UserId user_id, string value, b
       log_event_parse(*u, value).ensure();
 
       u->is_saved = true;
+      u->database_value_hash = crc64(value);
       u->is_status_saved = true;
       update_user(u, user_id, true, true);
     }
@@ -8656,9 +8954,9 @@ void ContactsManager::on_load_user_from_database(UserId user_id, string value, b
     auto new_value = get_user_database_value(u);
     if (value != new_value) {
       save_user_to_database_impl(u, user_id, std::move(new_value));
-    } else if (u->log_event_id != 0) {
-      binlog_erase(G()->td_db()->get_binlog(), u->log_event_id);
-      u->log_event_id = 0;
+    } else {
+      u->database_value_hash = crc64(value);
+      erase_saved_object_log_event(u->log_event_id);
     }
   }
 
@@ -8845,7 +9143,8 @@ void ContactsManager::save_chat_to_database(Chat *c, ChatId chat_id) {
     return;
   }
   if (loaded_from_database_chats_.count(chat_id)) {
-    save_chat_to_database_impl(c, chat_id, get_chat_database_value(c));
+    pending_saved_chats_.insert(chat_id);
+    schedule_pending_database_saves();
     return;
   }
   if (load_chat_from_database_queries_.count(chat_id) != 0) {
@@ -8861,6 +9160,7 @@ void ContactsManager::save_chat_to_database_impl(Chat *c, ChatId chat_id, string
   CHECK(!c->is_being_saved);
   c->is_being_saved = true;
   c->is_saved = true;
+  c->database_value_hash = crc64(value);
   LOG(INFO) << "Trying to save to database " << chat_id;
   G()->td_db()->get_sqlite_pmc()->set(
       get_chat_database_key(chat_id), std::move(value), PromiseCreator::lambda([chat_id](Result<> result) {
@@ -8882,6 +9182,7 @@ void ContactsManager::on_save_chat_to_database(ChatId chat_id, bool success) {
   if (!success) {
     LOG(ERROR) << "Failed to save " << chat_id << " to database";
     c->is_saved = false;
+    c->database_value_hash = 0;
   } else {
     LOG(INFO) << "Successfully saved " << chat_id << " to database";
   }
@@ -8948,6 +9249,7 @@ void ContactsManager::on_load_chat_from_database(ChatId chat_id, string value, b
       log_event_parse(*c, value).ensure();
 
       c->is_saved = true;
+      c->database_value_hash = crc64(value);
       update_chat(c, chat_id, true, true);
     }
   } else {
@@ -8956,9 +9258,9 @@ void ContactsManager::on_load_chat_from_database(ChatId chat_id, string value, b
     auto new_value = get_chat_database_value(c);
     if (value != new_value) {
       save_chat_to_database_impl(c, chat_id, std::move(new_value));
-    } else if (c->log_event_id != 0) {
-      binlog_erase(G()->td_db()->get_binlog(), c->log_event_id);
-      c->log_event_id = 0;
+    } else {
+      c->database_value_hash = crc64(value);
+      erase_saved_object_log_event(c->log_event_id);
     }
   }
 
@@ -9083,7 +9385,8 @@ void ContactsManager::save_channel_to_database(Channel *c, ChannelId channel_id)
     return;
   }
   if (loaded_from_database_channels_.count(channel_id)) {
-    save_channel_to_database_impl(c, channel_id, get_channel_database_value(c));
+    pending_saved_channels_.insert(channel_id);
+    schedule_pending_database_saves();
     return;
   }
   if (load_channel_from_database_queries_.count(channel_id) != 0) {
@@ -9099,6 +9402,7 @@ void ContactsManager::save_channel_to_database_impl(Channel *c, ChannelId channe
   CHECK(!c->is_being_saved);
   c->is_being_saved = true;
   c->is_saved = true;
+  c->database_value_hash = crc64(value);
   LOG(INFO) << "Trying to save to database " << channel_id;
   G()->td_db()->get_sqlite_pmc()->set(
       get_channel_database_key(channel_id), std::move(value), PromiseCreator::lambda([channel_id](Result<> result) {
@@ -9121,6 +9425,7 @@ void ContactsManager::on_save_channel_to_database(ChannelId channel_id, bool suc
   if (!success) {
     LOG(ERROR) << "Failed to save " << channel_id << " to database";
     c->is_saved = false;
+    c->database_value_hash = 0;
   } else {
     LOG(INFO) << "Successfully saved " << channel_id << " to database";
   }
@@ -9187,6 +9492,7 @@ void ContactsManager::on_load_channel_from_database(ChannelId channel_id, string
       log_event_parse(*c, value).ensure();
 
       c->is_saved = true;
+      c->database_value_hash = crc64(value);
       update_channel(c, channel_id, true, true);
     }
   } else {
@@ -9210,16 +9516,16 @@ void ContactsManager::on_load_channel_from_database(ChannelId channel_id, string
       }
 
       if (temp_c.username != c->username) {
-        on_channel_username_changed(c, channel_id, temp_c.username, c->username);
+        on_channel_username_changed(c, channel_id, temp_c.username.str(), c->username.str());
         CHECK(!c->is_being_saved);
       }
     }
     auto new_value = get_channel_database_value(c);
     if (value != new_value) {
       save_channel_to_database_impl(c, channel_id, std::move(new_value));
-    } else if (c->log_event_id != 0) {
-      binlog_erase(G()->td_db()->get_binlog(), c->log_event_id);
-      c->log_event_id = 0;
+    } else {
+      c->database_value_hash = crc64(value);
+      erase_saved_object_log_event(c->log_event_id);
     }
   }
 
@@ -9277,6 +9583,127 @@ class ContactsManager::SecretChatLogEvent {
   }
 };
 
+void ContactsManager::schedule_pending_database_saves() {
+  if (is_pending_database_save_scheduled_) {
+    return;
+  }
+  is_pending_database_save_scheduled_ = true;
+  send_closure_later(actor_id(this), &ContactsManager::save_pending_objects_to_database);
+}
+
+bool ContactsManager::update_database_value_hash(uint64 &database_value_hash, const string &value) {
+  // many changes of the objects don't affect their database representation, so it is rewritten only if it has changed
+  auto value_hash = crc64(value);
+  if (value_hash == database_value_hash) {
+    return false;
+  }
+  database_value_hash = value_hash;
+  return true;
+}
+
+void ContactsManager::erase_saved_object_log_event(uint64 &log_event_id) {
+  if (log_event_id != 0) {
+    binlog_erase(G()->td_db()->get_binlog(), log_event_id);
+    log_event_id = 0;
+  }
+}
+
+void ContactsManager::save_pending_objects_to_database() {
+  CHECK(is_pending_database_save_scheduled_);
+  is_pending_database_save_scheduled_ = false;
+  if (G()->close_flag()) {
+    // the objects are still in the binlog and will be saved after restart
+    return;
+  }
+
+  // every object is serialized once regardless of the number of changes, and all of them are saved in one transaction
+  std::unordered_map<string, string> key_values;
+  vector<UserId> user_ids;
+  for (auto user_id : pending_saved_users_) {
+    User *u = get_user(user_id);
+    CHECK(u != nullptr);
+    if (u->is_being_saved) {
+      continue;
+    }
+    u->is_saved = true;
+    u->is_status_saved = true;
+    auto value = get_user_database_value(u);
+    if (!update_database_value_hash(u->database_value_hash, value)) {
+      erase_saved_object_log_event(u->log_event_id);
+      continue;
+    }
+    u->is_being_saved = true;
+    key_values.emplace(get_user_database_key(user_id), std::move(value));
+    user_ids.push_back(user_id);
+  }
+  pending_saved_users_.clear();
+
+  vector<ChatId> chat_ids;
+  for (auto chat_id : pending_saved_chats_) {
+    Chat *c = get_chat(chat_id);
+    CHECK(c != nullptr);
+    if (c->is_being_saved) {
+      continue;
+    }
+    c->is_saved = true;
+    auto value = get_chat_database_value(c);
+    if (!update_database_value_hash(c->database_value_hash, value)) {
+      erase_saved_object_log_event(c->log_event_id);
+      continue;
+    }
+    c->is_being_saved = true;
+    key_values.emplace(get_chat_database_key(chat_id), std::move(value));
+    chat_ids.push_back(chat_id);
+  }
+  pending_saved_chats_.clear();
+
+  vector<ChannelId> channel_ids;
+  for (auto channel_id : pending_saved_channels_) {
+    Channel *c = get_channel(channel_id);
+    CHECK(c != nullptr);
+    if (c->is_being_saved) {
+      continue;
+    }
+    c->is_saved = true;
+    auto value = get_channel_database_value(c);
+    if (!update_database_value_hash(c->database_value_hash, value)) {
+      erase_saved_object_log_event(c->log_event_id);
+      continue;
+    }
+    c->is_being_saved = true;
+    key_values.emplace(get_channel_database_key(channel_id), std::move(value));
+    channel_ids.push_back(channel_id);
+  }
+  pending_saved_channels_.clear();
+
+  if (key_values.empty()) {
+    return;
+  }
+
+  LOG(INFO) << "Trying to save to database " << user_ids.size() << " users, " << chat_ids.size()
+            << " basic groups and " << channel_ids.size() << " supergroups";
+  G()->td_db()->get_sqlite_pmc()->set_all(
+      std::move(key_values),
+      PromiseCreator::lambda([user_ids = std::move(user_ids), chat_ids = std::move(chat_ids),
+                              channel_ids = std::move(channel_ids)](Result<> result) mutable {
+        send_closure(G()->contacts_manager(), &ContactsManager::on_save_pending_objects_to_database,
+                     std::move(user_ids), std::move(chat_ids), std::move(channel_ids), result.is_ok());
+      }));
+}
+
+void ContactsManager::on_save_pending_objects_to_database(vector<UserId> user_ids, vector<ChatId> chat_ids,
+                                                          vector<ChannelId> channel_ids, bool success) {
+  for (auto user_id : user_ids) {
+    on_save_user_to_database(user_id, success);
+  }
+  for (auto chat_id : chat_ids) {
+    on_save_chat_to_database(chat_id, success);
+  }
+  for (auto channel_id : channel_ids) {
+    on_save_channel_to_database(channel_id, success);
+  }
+}
+
 void ContactsManager::save_secret_chat(SecretChat *c, SecretChatId secret_chat_id, bool from_binlog) {
   if (!G()->parameters().use_chat_info_db) {
     return;
@@ -9851,6 +10278,7 @@ void ContactsManager::for_each_secret_chat_with_user(UserId user_id, const std::
 
 void ContactsManager::update_user(User *u, UserId user_id, bool from_binlog, bool from_database) {
   CHECK(u != nullptr);
+  u->received_fingerprint = 0;
   if (u->is_name_changed || u->is_username_changed || u->is_is_contact_changed) {
     update_contacts_hints(u, user_id, from_database);
     u->is_username_changed = false;
@@ -9904,7 +10332,7 @@ void ContactsManager::update_user(User *u, UserId user_id, bool from_binlog, boo
     }
   }
   if (!td_->auth_manager_->is_bot()) {
-    if (u->restriction_reasons.empty()) {
+    if (u->get_restriction_reasons().empty()) {
       restricted_user_ids_.erase(user_id);
     } else {
       restricted_user_ids_.insert(user_id);
@@ -9929,14 +10357,22 @@ void ContactsManager::update_user(User *u, UserId user_id, bool from_binlog, boo
     u->is_changed = false;
     u->is_status_changed = false;
     u->is_update_user_sent = true;
+    // the sent update already contains the current status
+    user_status_update_timeout_.cancel_timeout(user_id.get());
   }
   if (u->is_status_changed) {
     if (!from_database) {
       u->is_status_saved = false;
     }
     CHECK(u->is_update_user_sent);
-    send_closure(G()->td(), &Td::send_update,
-                 make_tl_object<td_api::updateUserStatus>(user_id.get(), get_user_status_object(user_id, u)));
+    if (user_id == get_my_id()) {
+      if (!td_->is_update_ignored(td_api::updateUserStatus::ID)) {
+        send_closure(G()->td(), &Td::send_update,
+                     make_tl_object<td_api::updateUserStatus>(user_id.get(), get_user_status_object(user_id, u)));
+      }
+    } else {
+      schedule_user_status_update(user_id);
+    }
     u->is_status_changed = false;
   }
   if (u->is_online_status_changed) {
@@ -11032,15 +11468,15 @@ void ContactsManager::on_update_user_name(User *u, UserId user_id, string &&firs
     first_name = u->phone_number;
   }
   if (u->first_name != first_name || u->last_name != last_name) {
-    u->first_name = std::move(first_name);
-    u->last_name = std::move(last_name);
+    u->first_name = InternedString(first_name);
+    u->last_name = InternedString(last_name);
     u->is_name_changed = true;
     LOG(DEBUG) << "Name has changed for " << user_id;
     u->is_changed = true;
   }
-  td_->messages_manager_->on_dialog_username_updated(DialogId(user_id), u->username, username);
+  td_->messages_manager_->on_dialog_username_updated(DialogId(user_id), u->username.str(), username);
   if (u->username != username) {
-    u->username = std::move(username);
+    u->username = InternedString(username);
     u->is_username_changed = true;
     LOG(DEBUG) << "Username has changed for " << user_id;
     u->is_changed = true;
@@ -11654,25 +12090,7 @@ void ContactsManager::update_user_online_member_count(User *u) {
       continue;
     }
 
-    switch (dialog_id.get_type()) {
-      case DialogType::Chat: {
-        auto chat_id = dialog_id.get_chat_id();
-        auto chat_full = get_chat_full(chat_id);
-        CHECK(chat_full != nullptr);
-        update_chat_online_member_count(chat_full, chat_id, false);
-        break;
-      }
-      case DialogType::Channel: {
-        auto channel_id = dialog_id.get_channel_id();
-        update_channel_online_member_count(channel_id, false);
-        break;
-      }
-      case DialogType::User:
-      case DialogType::SecretChat:
-      case DialogType::None:
-        UNREACHABLE();
-        break;
-    }
+    schedule_dialog_online_member_count_update(dialog_id);
   }
   for (auto &dialog_id : expired_dialog_ids) {
     u->online_member_dialogs.erase(dialog_id);
@@ -11682,6 +12100,20 @@ void ContactsManager::update_user_online_member_count(User *u) {
   }
 }
 
+void ContactsManager::schedule_user_status_update(UserId user_id) {
+  // updates are sent with the status at the time of the timeout, so all changes in between are combined
+  if (!user_status_update_timeout_.has_timeout(user_id.get())) {
+    user_status_update_timeout_.set_timeout_in(user_id.get(), USER_STATUS_UPDATE_DELAY);
+  }
+}
+
+void ContactsManager::schedule_dialog_online_member_count_update(DialogId dialog_id) {
+  CHECK(dialog_id.get_type() == DialogType::Chat || dialog_id.get_type() == DialogType::Channel);
+  if (!dialog_online_member_count_timeout_.has_timeout(dialog_id.get())) {
+    dialog_online_member_count_timeout_.set_timeout_in(dialog_id.get(), ONLINE_MEMBER_COUNT_UPDATE_DELAY);
+  }
+}
+
 void ContactsManager::update_chat_online_member_count(const ChatFull *chat_full, ChatId chat_id, bool is_from_server) {
   update_dialog_online_member_count(chat_full->participants, DialogId(chat_id), is_from_server);
 }
@@ -11933,7 +12365,7 @@ void ContactsManager::on_get_channel_participants(
 
   vector<DialogParticipant> result;
   for (auto &participant_ptr : participants) {
-    auto debug_participant = to_string(participant_ptr);
+    auto debug_participant = LOG_IS_ON(DEBUG) ? to_string(participant_ptr) : to_summary_string(participant_ptr);
     result.emplace_back(std::move(participant_ptr));
     const auto &participant = result.back();
     UserId participant_user_id;
@@ -13500,13 +13932,13 @@ void ContactsManager::on_update_channel_username(ChannelId channel_id, string &&
 }
 
 void ContactsManager::on_update_channel_username(Channel *c, ChannelId channel_id, string &&username) {
-  td_->messages_manager_->on_dialog_username_updated(DialogId(channel_id), c->username, username);
+  td_->messages_manager_->on_dialog_username_updated(DialogId(channel_id), c->username.str(), username);
   if (c->username != username) {
     if (c->is_update_supergroup_sent) {
-      on_channel_username_changed(c, channel_id, c->username, username);
+      on_channel_username_changed(c, channel_id, c->username.str(), username);
     }
 
-    c->username = std::move(username);
+    c->username = InternedString(username);
     c->is_username_changed = true;
     c->is_changed = true;
   }
@@ -13815,7 +14247,7 @@ void ContactsManager::update_contacts_hints(const User *u, UserId user_id, bool
 
   int64 key = user_id.get();
   string old_value = contacts_hints_.key_to_string(key);
-  string new_value = is_contact ? u->first_name + " " + u->last_name + " " + u->username : "";
+  string new_value = is_contact ? PSTRING() << u->first_name << ' ' << u->last_name << ' ' << u->username : string();
 
   if (new_value != old_value) {
     if (is_contact) {
@@ -13881,7 +14313,7 @@ Result<ContactsManager::BotData> ContactsManager::get_bot_data(UserId user_id) c
   }
 
   BotData bot_data;
-  bot_data.username = bot->username;
+  bot_data.username = bot->username.str();
   bot_data.can_join_groups = bot->can_join_groups;
   bot_data.can_read_all_group_messages = bot->can_read_all_group_messages;
   bot_data.is_inline = bot->is_inline_bot;
@@ -13999,9 +14431,16 @@ bool ContactsManager::get_user(UserId user_id, int left_tries, Promise<Unit> &&p
       return false;
     }
 
-    vector<tl_object_ptr<telegram_api::InputUser>> users;
-    users.push_back(r_input_user.move_as_ok());
-    td_->create_handler<GetUsersQuery>(std::move(promise))->send(std::move(users));
+    // concurrent requests for the same user wait for the first query
+    auto send_query = PromiseCreator::lambda(
+        [td = td_, input_user = r_input_user.move_as_ok()](Result<Promise<Unit>> &&promise) mutable {
+          if (promise.is_ok() && !G()->close_flag()) {
+            vector<tl_object_ptr<telegram_api::InputUser>> users;
+            users.push_back(std::move(input_user));
+            td->create_handler<GetUsersQuery>(promise.move_as_ok())->send(std::move(users));
+          }
+        });
+    get_user_queries_.add_query(user_id.get(), std::move(send_query), std::move(promise));
     return false;
   }
 
@@ -14032,6 +14471,7 @@ ContactsManager::UserFull *ContactsManager::get_user_full(UserId user_id) {
   if (p == users_full_.end()) {
     return nullptr;
   } else {
+    p->second->last_access_time = Time::now();
     return p->second.get();
   }
 }
@@ -14041,7 +14481,11 @@ ContactsManager::UserFull *ContactsManager::add_user_full(UserId user_id) {
   auto &user_full_ptr = users_full_[user_id];
   if (user_full_ptr == nullptr) {
     user_full_ptr = make_unique<UserFull>();
+    if (G()->parameters().use_chat_info_db && user_id != get_my_id()) {
+      user_full_unload_timeout_.set_timeout_in(user_id.get(), FULL_INFO_UNLOAD_DELAY);
+    }
   }
+  user_full_ptr->last_access_time = Time::now();
   return user_full_ptr.get();
 }
 
@@ -14287,7 +14731,12 @@ bool ContactsManager::get_chat(ChatId chat_id, int left_tries, Promise<Unit> &&p
     }
 
     if (left_tries > 1) {
-      td_->create_handler<GetChatsQuery>(std::move(promise))->send(vector<int64>{chat_id.get()});
+      auto send_query = PromiseCreator::lambda([td = td_, chat_id](Result<Promise<Unit>> &&promise) {
+        if (promise.is_ok() && !G()->close_flag()) {
+          td->create_handler<GetChatsQuery>(promise.move_as_ok())->send(vector<int64>{chat_id.get()});
+        }
+      });
+      get_chat_queries_.add_query(DialogId(chat_id).get(), std::move(send_query), std::move(promise));
       return false;
     }
 
@@ -14641,7 +15090,13 @@ bool ContactsManager::get_channel(ChannelId channel_id, int left_tries, Promise<
     }
 
     if (left_tries > 1 && td_->auth_manager_->is_bot()) {
-      td_->create_handler<GetChannelsQuery>(std::move(promise))->send(get_input_channel(channel_id));
+      auto send_query = PromiseCreator::lambda(
+          [td = td_, input_channel = get_input_channel(channel_id)](Result<Promise<Unit>> &&promise) mutable {
+            if (promise.is_ok() && !G()->close_flag()) {
+              td->create_handler<GetChannelsQuery>(promise.move_as_ok())->send(std::move(input_channel));
+            }
+          });
+      get_chat_queries_.add_query(DialogId(channel_id).get(), std::move(send_query), std::move(promise));
       return false;
     }
 
@@ -14690,6 +15145,7 @@ ContactsManager::ChannelFull *ContactsManager::get_channel_full(ChannelId channe
   }
 
   auto channel_full = p->second.get();
+  channel_full->last_access_time = Time::now();
   if (!only_local && channel_full->is_expired() && !td_->auth_manager_->is_bot()) {
     send_get_channel_full_query(channel_full, channel_id, Auto(), source);
   }
@@ -14702,7 +15158,11 @@ ContactsManager::ChannelFull *ContactsManager::add_channel_full(ChannelId channe
   auto &channel_full_ptr = channels_full_[channel_id];
   if (channel_full_ptr == nullptr) {
     channel_full_ptr = make_unique<ChannelFull>();
+    if (G()->parameters().use_chat_info_db) {
+      channel_full_unload_timeout_.set_timeout_in(channel_id.get(), FULL_INFO_UNLOAD_DELAY);
+    }
   }
+  channel_full_ptr->last_access_time = Time::now();
   return channel_full_ptr.get();
 }
 
@@ -15490,7 +15950,8 @@ void ContactsManager::on_chat_update(telegram_api::chatEmpty &chat, const char *
 }
 
 void ContactsManager::on_chat_update(telegram_api::chat &chat, const char *source) {
-  auto debug_str = PSTRING() << " from " << source << " in " << oneline(to_string(chat));
+  auto debug_str = PSTRING() << " from " << source << " in "
+                             << (LOG_IS_ON(DEBUG) ? oneline(to_string(chat)) : string(chat.get_name()));
   ChatId chat_id(chat.id_);
   if (!chat_id.is_valid()) {
     LOG(ERROR) << "Receive invalid " << chat_id << debug_str;
@@ -16050,16 +16511,17 @@ tl_object_ptr<td_api::user> ContactsManager::get_user_object(UserId user_id, con
     type = make_tl_object<td_api::userTypeDeleted>();
   } else if (u->is_bot) {
     type = make_tl_object<td_api::userTypeBot>(u->can_join_groups, u->can_read_all_group_messages, u->is_inline_bot,
-                                               u->inline_query_placeholder, u->need_location_bot);
+                                               u->get_inline_query_placeholder(), u->need_location_bot);
   } else {
     type = make_tl_object<td_api::userTypeRegular>();
   }
 
   return make_tl_object<td_api::user>(
-      user_id.get(), u->first_name, u->last_name, u->username, u->phone_number, get_user_status_object(user_id, u),
-      get_profile_photo_object(td_->file_manager_.get(), u->photo), u->is_contact, u->is_mutual_contact, u->is_verified,
-      u->is_support, get_restriction_reason_description(u->restriction_reasons), u->is_scam, u->is_fake, u->is_received,
-      std::move(type), u->language_code);
+      user_id.get(), u->first_name.str(), u->last_name.str(), u->username.str(), u->phone_number,
+      get_user_status_object(user_id, u), get_profile_photo_object(td_->file_manager_.get(), u->photo), u->is_contact,
+      u->is_mutual_contact, u->is_verified, u->is_support,
+      get_restriction_reason_description(u->get_restriction_reasons()), u->is_scam, u->is_fake, u->is_received,
+      std::move(type), u->language_code.str());
 }
 
 vector<int64> ContactsManager::get_user_ids_object(const vector<UserId> &user_ids, const char *source) const {
@@ -16174,7 +16636,7 @@ tl_object_ptr<td_api::supergroup> ContactsManager::get_supergroup_object(Channel
     return nullptr;
   }
   return td_api::make_object<td_api::supergroup>(
-      channel_id.get(), c->username, c->date, get_channel_status(c).get_chat_member_status_object(),
+      channel_id.get(), c->username.str(), c->date, get_channel_status(c).get_chat_member_status_object(),
       c->participant_count, c->has_linked_channel, c->has_location, c->sign_messages, c->is_slow_mode_enabled,
       !c->is_megagroup, c->is_gigagroup, c->is_verified, get_restriction_reason_description(c->restriction_reasons),
       c->is_scam, c->is_fake);
@@ -16377,6 +16839,78 @@ void ContactsManager::after_get_difference() {
   }
 }
 
+size_t ContactsManager::get_memory_usage() const {
+  return users_full_.size() * sizeof(UserFull) + channels_full_.size() * sizeof(ChannelFull);
+}
+
+void ContactsManager::reduce_memory_usage(size_t target_size) {
+  if (G()->close_flag() || !G()->parameters().use_chat_info_db) {
+    return;
+  }
+
+  auto memory_usage = get_memory_usage();
+  if (memory_usage <= target_size) {
+    return;
+  }
+
+  auto can_unload = [](const auto *full) {
+    return !full->is_changed && !full->need_send_update && !full->need_save_to_database;
+  };
+
+  // dialog_id, last_access_time
+  vector<std::pair<DialogId, double>> candidates;
+  auto my_id = get_my_id();
+  for (auto &it : users_full_) {
+    if (it.first != my_id && can_unload(it.second.get())) {
+      candidates.emplace_back(DialogId(it.first), it.second->last_access_time);
+    }
+  }
+  for (auto &it : channels_full_) {
+    if (can_unload(it.second.get())) {
+      candidates.emplace_back(DialogId(it.first), it.second->last_access_time);
+    }
+  }
+  std::sort(candidates.begin(), candidates.end(),
+            [](const auto &lhs, const auto &rhs) { return lhs.second < rhs.second; });
+
+  size_t unloaded_count = 0;
+  for (auto &candidate : candidates) {
+    if (memory_usage <= target_size) {
+      break;
+    }
+    auto dialog_id = candidate.first;
+    if (dialog_id.get_type() == DialogType::User) {
+      auto user_id = dialog_id.get_user_id();
+      users_full_.erase(user_id);
+      unavailable_user_fulls_.erase(user_id);
+      memory_usage -= sizeof(UserFull);
+    } else {
+      auto channel_id = dialog_id.get_channel_id();
+      channels_full_.erase(channel_id);
+      unavailable_channel_fulls_.erase(channel_id);
+      memory_usage -= sizeof(ChannelFull);
+    }
+    unloaded_count++;
+  }
+  LOG(INFO) << "Unloaded " << unloaded_count << " full infos to reduce memory usage";
+}
+
+void ContactsManager::memory_stats(MemoryStats &stats) const {
+  stats.add_container("users_", users_, sizeof(User));
+  stats.add_container("users_full_", users_full_, sizeof(UserFull));
+  stats.add_container("user_photos_", user_photos_);
+  stats.add_container("chats_", chats_, sizeof(Chat));
+  stats.add_container("chats_full_", chats_full_, sizeof(ChatFull));
+  stats.add_container("min_channels_", min_channels_, sizeof(MinChannel));
+  stats.add_container("channels_", channels_, sizeof(Channel));
+  stats.add_container("channels_full_", channels_full_, sizeof(ChannelFull));
+  stats.add_container("secret_chats_", secret_chats_, sizeof(SecretChat));
+  stats.add_container("invite_link_infos_", invite_link_infos_, sizeof(InviteLinkInfo));
+  stats.add_container("dialog_administrators_", dialog_administrators_);
+  stats.add_container("cached_channel_participants_", cached_channel_participants_);
+  stats.add_container("channel_participants_", channel_participants_);
+}
+
 void ContactsManager::get_current_state(vector<td_api::object_ptr<td_api::Update>> &updates) const {
   for (auto user_id : unknown_users_) {
     if (!have_min_user(user_id)) {
@@ -40,7 +40,10 @@
 #include "td/actor/Timeout.h"
 
 #include "td/utils/common.h"
+#include "td/utils/FlatHashMap.h"
+#include "td/utils/FlatHashSet.h"
 #include "td/utils/Hints.h"
+#include "td/utils/InternedString.h"
 #include "td/utils/Status.h"
 #include "td/utils/StringBuilder.h"
 #include "td/utils/Time.h"
@@ -57,6 +60,8 @@ struct BinlogEvent;
 
 struct MinChannel;
 
+class MemoryStats;
+
 class Td;
 
 class ContactsManager final : public Actor {
@@ -148,6 +153,9 @@ class ContactsManager final : public Actor {
                    bool expect_support = false);
   void on_get_users(vector<tl_object_ptr<telegram_api::User>> &&users, const char *source);
 
+  void on_binlog_events(vector<BinlogEvent> &&user_events, vector<BinlogEvent> &&channel_events,
+                        vector<BinlogEvent> &&chat_events, vector<BinlogEvent> &&secret_chat_events);
+
   void on_binlog_user_event(BinlogEvent &&event);
   void on_binlog_chat_event(BinlogEvent &&event);
   void on_binlog_channel_event(BinlogEvent &&event);
@@ -587,6 +595,13 @@ class ContactsManager final : public Actor {
 
   void get_current_state(vector<td_api::object_ptr<td_api::Update>> &updates) const;
 
+  size_t get_memory_usage() const;
+
+  // unloads least recently used full infos, which are saved in the database, to reduce memory usage
+  void reduce_memory_usage(size_t target_size);
+
+  void memory_stats(MemoryStats &stats) const;
+
   static tl_object_ptr<td_api::dateRange> convert_date_range(
       const tl_object_ptr<telegram_api::statsDateRangeDays> &obj);
 
@@ -608,22 +623,27 @@ class ContactsManager final : public Actor {
 
  private:
   struct User {
-    string first_name;
-    string last_name;
-    string username;
+    // names are often repeated between users, so they are interned to share their storage
+    InternedString first_name;
+    InternedString last_name;
+    InternedString username;
     string phone_number;
     int64 access_hash = -1;
 
     ProfilePhoto photo;
 
-    vector<RestrictionReason> restriction_reasons;
-    string inline_query_placeholder;
+    // fields, which are set only for bots and restricted users, are allocated only when needed
+    struct RareFields {
+      vector<RestrictionReason> restriction_reasons;
+      string inline_query_placeholder;
+    };
+    unique_ptr<RareFields> rare_fields;
     int32 bot_info_version = -1;
 
     int32 was_online = 0;
     int32 local_was_online = 0;
 
-    string language_code;
+    InternedString language_code;
 
     std::unordered_set<int64> photo_ids;
 
@@ -671,6 +691,18 @@ class ContactsManager final : public Actor {
 
     uint64 log_event_id = 0;
 
+    uint64 database_value_hash = 0;  // crc64 of the value last saved to or loaded from the database
+
+    uint64 received_fingerprint = 0;  // fingerprint of the last applied telegram_api::user; reset on any change
+
+    const vector<RestrictionReason> &get_restriction_reasons() const;
+
+    void set_restriction_reasons(vector<RestrictionReason> &&new_restriction_reasons);
+
+    const string &get_inline_query_placeholder() const;
+
+    void set_inline_query_placeholder(string &&new_inline_query_placeholder);
+
     template <class StorerT>
     void store(StorerT &storer) const;
 
@@ -704,6 +736,7 @@ class ContactsManager final : public Actor {
     bool is_update_user_full_sent = false;
 
     double expires_at = 0.0;
+    double last_access_time = 0.0;
 
     bool is_expired() const {
       return expires_at < Time::now();
@@ -754,6 +787,8 @@ class ContactsManager final : public Actor {
 
     uint64 log_event_id = 0;
 
+    uint64 database_value_hash = 0;  // crc64 of the value last saved to or loaded from the database
+
     template <class StorerT>
     void store(StorerT &storer) const;
 
@@ -795,7 +830,7 @@ class ContactsManager final : public Actor {
     int64 access_hash = 0;
     string title;
     DialogPhoto photo;
-    string username;
+    InternedString username;
     vector<RestrictionReason> restriction_reasons;
     DialogParticipantStatus status = DialogParticipantStatus::Banned(0);
     RestrictedRights default_permissions{false, false, false, false, false, false, false, false, false, false, false};
@@ -840,6 +875,8 @@ class ContactsManager final : public Actor {
 
     uint64 log_event_id = 0;
 
+    uint64 database_value_hash = 0;  // crc64 of the value last saved to or loaded from the database
+
     template <class StorerT>
     void store(StorerT &storer) const;
 
@@ -897,6 +934,7 @@ class ContactsManager final : public Actor {
     bool is_update_channel_full_sent = false;
 
     double expires_at = 0.0;
+    double last_access_time = 0.0;
 
     bool is_expired() const {
       return expires_at < Time::now();
@@ -1115,10 +1153,17 @@ class ContactsManager final : public Actor {
   static constexpr int32 USER_FULL_EXPIRE_TIME = 60;
   static constexpr int32 CHANNEL_FULL_EXPIRE_TIME = 60;
 
+  static constexpr int32 FULL_INFO_UNLOAD_DELAY = 3600;  // saved full info is unloaded if isn't accessed for this time
+
+  static constexpr double USER_STATUS_UPDATE_DELAY = 0.1;          // status changes are combined during this time
+  static constexpr double ONLINE_MEMBER_COUNT_UPDATE_DELAY = 0.5;  // member count recalculations are combined
+
   static constexpr int32 ACCOUNT_UPDATE_FIRST_NAME = 1 << 0;
   static constexpr int32 ACCOUNT_UPDATE_LAST_NAME = 1 << 1;
   static constexpr int32 ACCOUNT_UPDATE_ABOUT = 1 << 2;
 
+  static uint64 get_user_fingerprint(const telegram_api::user *user);
+
   static bool have_input_peer_user(const User *u, AccessRights access_rights);
   static bool have_input_peer_chat(const Chat *c, AccessRights access_rights);
   bool have_input_peer_channel(const Channel *c, ChannelId channel_id, AccessRights access_rights,
@@ -1289,6 +1334,10 @@ class ContactsManager final : public Actor {
   void do_invalidate_channel_full(ChannelFull *channel_full, ChannelId channel_id, bool need_drop_slow_mode_delay);
 
   void update_user_online_member_count(User *u);
+
+  void schedule_user_status_update(UserId user_id);
+
+  void schedule_dialog_online_member_count_update(DialogId dialog_id);
   void update_chat_online_member_count(const ChatFull *chat_full, ChatId chat_id, bool is_from_server);
   void update_channel_online_member_count(ChannelId channel_id, bool is_from_server);
   void update_dialog_online_member_count(const vector<DialogParticipant> &participants, DialogId dialog_id,
@@ -1330,6 +1379,14 @@ class ContactsManager final : public Actor {
   void load_channel_from_database_impl(ChannelId channel_id, Promise<Unit> promise);
   void on_load_channel_from_database(ChannelId channel_id, string value, bool force);
 
+  static bool update_database_value_hash(uint64 &database_value_hash, const string &value);
+  static void erase_saved_object_log_event(uint64 &log_event_id);
+
+  void schedule_pending_database_saves();
+  void save_pending_objects_to_database();
+  void on_save_pending_objects_to_database(vector<UserId> user_ids, vector<ChatId> chat_ids,
+                                           vector<ChannelId> channel_ids, bool success);
+
   void save_secret_chat(SecretChat *c, SecretChatId secret_chat_id, bool from_binlog);
   static string get_secret_chat_database_key(SecretChatId secret_chat_id);
   static string get_secret_chat_database_value(const SecretChat *c);
@@ -1614,6 +1671,14 @@ class ContactsManager final : public Actor {
 
   static void on_channel_participant_cache_timeout_callback(void *contacts_manager_ptr, int64 channel_id_long);
 
+  static void on_user_full_unload_timeout_callback(void *contacts_manager_ptr, int64 user_id_long);
+
+  static void on_channel_full_unload_timeout_callback(void *contacts_manager_ptr, int64 channel_id_long);
+
+  static void on_user_status_update_timeout_callback(void *contacts_manager_ptr, int64 user_id_long);
+
+  static void on_dialog_online_member_count_timeout_callback(void *contacts_manager_ptr, int64 dialog_id_long);
+
   void on_user_online_timeout(UserId user_id);
 
   void on_channel_unban_timeout(ChannelId channel_id);
@@ -1626,6 +1691,14 @@ class ContactsManager final : public Actor {
 
   void on_channel_participant_cache_timeout(ChannelId channel_id);
 
+  void on_user_full_unload_timeout(UserId user_id);
+
+  void on_channel_full_unload_timeout(ChannelId channel_id);
+
+  void on_user_status_update_timeout(UserId user_id);
+
+  void on_dialog_online_member_count_timeout(DialogId dialog_id);
+
   void tear_down() final;
 
   Td *td_;
@@ -1634,10 +1707,10 @@ class ContactsManager final : public Actor {
   UserId support_user_id_;
   int32 my_was_online_local_ = 0;
 
-  std::unordered_map<UserId, unique_ptr<User>, UserIdHash> users_;
+  FlatHashMap<UserId, unique_ptr<User>, UserIdHash> users_;
   std::unordered_map<UserId, unique_ptr<UserFull>, UserIdHash> users_full_;
   std::unordered_map<UserId, UserPhotos, UserIdHash> user_photos_;
-  mutable std::unordered_set<UserId, UserIdHash> unknown_users_;
+  mutable FlatHashSet<UserId, UserIdHash> unknown_users_;
   std::unordered_map<UserId, tl_object_ptr<telegram_api::UserProfilePhoto>, UserIdHash> pending_user_photos_;
   struct UserIdPhotoIdHash {
     std::size_t operator()(const std::pair<UserId, int64> &pair) const {
@@ -1647,20 +1720,20 @@ class ContactsManager final : public Actor {
   std::unordered_map<std::pair<UserId, int64>, FileSourceId, UserIdPhotoIdHash> user_profile_photo_file_source_ids_;
   std::unordered_map<int64, FileId> my_photo_file_id_;
 
-  std::unordered_map<ChatId, unique_ptr<Chat>, ChatIdHash> chats_;
+  FlatHashMap<ChatId, unique_ptr<Chat>, ChatIdHash> chats_;
   std::unordered_map<ChatId, unique_ptr<ChatFull>, ChatIdHash> chats_full_;
-  mutable std::unordered_set<ChatId, ChatIdHash> unknown_chats_;
+  mutable FlatHashSet<ChatId, ChatIdHash> unknown_chats_;
   std::unordered_map<ChatId, FileSourceId, ChatIdHash> chat_full_file_source_ids_;
 
-  std::unordered_map<ChannelId, unique_ptr<MinChannel>, ChannelIdHash> min_channels_;
-  std::unordered_map<ChannelId, unique_ptr<Channel>, ChannelIdHash> channels_;
+  FlatHashMap<ChannelId, unique_ptr<MinChannel>, ChannelIdHash> min_channels_;
+  FlatHashMap<ChannelId, unique_ptr<Channel>, ChannelIdHash> channels_;
   std::unordered_map<ChannelId, unique_ptr<ChannelFull>, ChannelIdHash> channels_full_;
-  mutable std::unordered_set<ChannelId, ChannelIdHash> unknown_channels_;
+  mutable FlatHashSet<ChannelId, ChannelIdHash> unknown_channels_;
   std::unordered_set<ChannelId, ChannelIdHash> invalidated_channels_full_;
   std::unordered_map<ChannelId, FileSourceId, ChannelIdHash> channel_full_file_source_ids_;
 
-  std::unordered_map<SecretChatId, unique_ptr<SecretChat>, SecretChatIdHash> secret_chats_;
-  mutable std::unordered_set<SecretChatId, SecretChatIdHash> unknown_secret_chats_;
+  FlatHashMap<SecretChatId, unique_ptr<SecretChat>, SecretChatIdHash> secret_chats_;
+  mutable FlatHashSet<SecretChatId, SecretChatIdHash> unknown_secret_chats_;
 
   std::unordered_map<UserId, vector<SecretChatId>, UserIdHash> secret_chats_with_user_;
 
@@ -1696,6 +1769,14 @@ class ContactsManager final : public Actor {
   std::unordered_map<SecretChatId, vector<Promise<Unit>>, SecretChatIdHash> load_secret_chat_from_database_queries_;
   std::unordered_set<SecretChatId, SecretChatIdHash> loaded_from_database_secret_chats_;
 
+  // objects, which need to be saved to the database at the end of the current update processing
+  FlatHashSet<UserId, UserIdHash> pending_saved_users_;
+  FlatHashSet<ChatId, ChatIdHash> pending_saved_chats_;
+  FlatHashSet<ChannelId, ChannelIdHash> pending_saved_channels_;
+  bool is_pending_database_save_scheduled_ = false;
+
+  QueryCombiner get_user_queries_{"GetUserCombiner", 0.0};
+  QueryCombiner get_chat_queries_{"GetChatCombiner", 0.0};
   QueryCombiner get_user_full_queries_{"GetUserFullCombiner", 2.0};
   QueryCombiner get_chat_full_queries_{"GetChatFullCombiner", 2.0};
 
@@ -1789,6 +1870,10 @@ class ContactsManager final : public Actor {
   MultiTimeout slow_mode_delay_timeout_{"SlowModeDelayTimeout"};
   MultiTimeout invite_link_info_expire_timeout_{"InviteLinkInfoExpireTimeout"};
   MultiTimeout channel_participant_cache_timeout_{"ChannelParticipantCacheTimeout"};
+  MultiTimeout user_full_unload_timeout_{"UserFullUnloadTimeout"};
+  MultiTimeout channel_full_unload_timeout_{"ChannelFullUnloadTimeout"};
+  MultiTimeout user_status_update_timeout_{"UserStatusUpdateTimeout"};
+  MultiTimeout dialog_online_member_count_timeout_{"DialogOnlineMemberCountTimeout"};
 };
 
 }  // namespace td
@@ -11,8 +11,38 @@
 
 #include "td/utils/common.h"
 
+#include <mutex>
+#include <unordered_map>
+
 namespace td {
 
+// the same primes are checked by all Td instances in the process, so results of the checks are shared between them
+struct SharedPrimeCache {
+  std::mutex mutex;
+  std::unordered_map<string, bool> is_good_prime;
+};
+
+static SharedPrimeCache &get_shared_prime_cache() {
+  static SharedPrimeCache cache;
+  return cache;
+}
+
+static int get_shared_prime_status(Slice prime_str) {
+  auto &cache = get_shared_prime_cache();
+  std::lock_guard<std::mutex> guard(cache.mutex);
+  auto it = cache.is_good_prime.find(prime_str.str());
+  if (it == cache.is_good_prime.end()) {
+    return -1;
+  }
+  return it->second ? 1 : 0;
+}
+
+static void set_shared_prime_status(Slice prime_str, bool is_good) {
+  auto &cache = get_shared_prime_cache();
+  std::lock_guard<std::mutex> guard(cache.mutex);
+  cache.is_good_prime[prime_str.str()] = is_good;
+}
+
 static string good_prime_key(Slice prime_str) {
   string key("good_prime:");
   key.append(prime_str.data(), prime_str.size());
@@ -22,20 +52,30 @@ static string good_prime_key(Slice prime_str) {
 int DhCache::is_good_prime(Slice prime_str) const {
   string value = G()->td_db()->get_binlog_pmc()->get(good_prime_key(prime_str));
   if (value == "good") {
+    set_shared_prime_status(prime_str, true);
     return 1;
   }
   if (value == "bad") {
+    set_shared_prime_status(prime_str, false);
     return 0;
   }
   CHECK(value.empty());
-  return -1;
+
+  auto result = get_shared_prime_status(prime_str);
+  if (result != -1) {
+    // the prime has already been checked by another Td instance; save the result to avoid checks after restart
+    G()->td_db()->get_binlog_pmc()->set(good_prime_key(prime_str), result == 1 ? "good" : "bad");
+  }
+  return result;
 }
 
 void DhCache::add_good_prime(Slice prime_str) const {
+  set_shared_prime_status(prime_str, true);
   G()->td_db()->get_binlog_pmc()->set(good_prime_key(prime_str), "good");
 }
 
 void DhCache::add_bad_prime(Slice prime_str) const {
+  set_shared_prime_status(prime_str, false);
   G()->td_db()->get_binlog_pmc()->set(good_prime_key(prime_str), "bad");
 }
 
@@ -12,6 +12,7 @@
 #include "td/db/SqliteDb.h"
 #include "td/db/SqliteKeyValue.h"
 #include "td/db/SqliteStatement.h"
+#include "td/db/WriteBatchPolicy.h"
 
 #include "td/actor/actor.h"
 #include "td/actor/SchedulerLocalStorage.h"
@@ -341,8 +342,9 @@ std::shared_ptr<DialogDbSyncSafeInterface> create_dialog_db_sync(
 
 class DialogDbAsync final : public DialogDbAsyncInterface {
  public:
-  DialogDbAsync(std::shared_ptr<DialogDbSyncSafeInterface> sync_db, int32 scheduler_id) {
-    impl_ = create_actor_on_scheduler<Impl>("DialogDbActor", scheduler_id, std::move(sync_db));
+  DialogDbAsync(std::shared_ptr<DialogDbSyncSafeInterface> sync_db, int32 scheduler_id)
+      : write_batch_policy_(std::make_shared<WriteBatchPolicy>()) {
+    impl_ = create_actor_on_scheduler<Impl>("DialogDbActor", scheduler_id, std::move(sync_db), write_batch_policy_);
   }
 
   void add_dialog(DialogId dialog_id, FolderId folder_id, int64 order, BufferSlice data,
@@ -378,10 +380,15 @@ class DialogDbAsync final : public DialogDbAsyncInterface {
     send_closure_later(impl_, &Impl::close, std::move(promise));
   }
 
+  WriteBatchPolicy::Stats get_write_batch_stats() const final {
+    return write_batch_policy_->get_stats();
+  }
+
  private:
   class Impl final : public Actor {
    public:
-    explicit Impl(std::shared_ptr<DialogDbSyncSafeInterface> sync_db_safe) : sync_db_safe_(std::move(sync_db_safe)) {
+    Impl(std::shared_ptr<DialogDbSyncSafeInterface> sync_db_safe, std::shared_ptr<WriteBatchPolicy> write_batch_policy)
+        : sync_db_safe_(std::move(sync_db_safe)), write_batch_policy_(std::move(write_batch_policy)) {
     }
 
     void add_dialog(DialogId dialog_id, FolderId folder_id, int64 order, BufferSlice data,
@@ -438,8 +445,7 @@ class DialogDbAsync final : public DialogDbAsyncInterface {
     std::shared_ptr<DialogDbSyncSafeInterface> sync_db_safe_;
     DialogDbSyncInterface *sync_db_ = nullptr;
 
-    static constexpr size_t MAX_PENDING_QUERIES_COUNT{50};
-    static constexpr double MAX_PENDING_QUERIES_DELAY{0.01};
+    std::shared_ptr<WriteBatchPolicy> write_batch_policy_;
 
     //NB: order is important, destructor of pending_writes_ will change pending_write_results_
     std::vector<std::pair<Promise<>, Status>> pending_write_results_;
@@ -448,12 +454,13 @@ class DialogDbAsync final : public DialogDbAsyncInterface {
 
     template <class F>
     void add_write_query(F &&f) {
+      auto now = Time::now_cached();
+      write_batch_policy_->on_query(now);
       pending_writes_.push_back(PromiseCreator::lambda(std::forward<F>(f), PromiseCreator::Ignore()));
-      if (pending_writes_.size() > MAX_PENDING_QUERIES_COUNT) {
+      if (write_batch_policy_->is_full(pending_writes_.size())) {
         do_flush();
-        wakeup_at_ = 0;
       } else if (wakeup_at_ == 0) {
-        wakeup_at_ = Time::now_cached() + MAX_PENDING_QUERIES_DELAY;
+        wakeup_at_ = now + write_batch_policy_->get_flush_delay();
       }
       if (wakeup_at_ != 0) {
         set_timeout_at(wakeup_at_);
@@ -468,16 +475,19 @@ class DialogDbAsync final : public DialogDbAsyncInterface {
       if (pending_writes_.empty()) {
         return;
       }
+      auto start_time = Time::now();
       sync_db_->begin_write_transaction().ensure();
       for (auto &query : pending_writes_) {
         query.set_value(Unit());
       }
       sync_db_->commit_transaction().ensure();
+      write_batch_policy_->on_commit(pending_writes_.size(), Time::now() - start_time);
       pending_writes_.clear();
       for (auto &p : pending_write_results_) {
         p.first.set_result(std::move(p.second));
       }
       pending_write_results_.clear();
+      wakeup_at_ = 0;
       cancel_timeout();
     }
 
@@ -489,6 +499,7 @@ class DialogDbAsync final : public DialogDbAsyncInterface {
       sync_db_ = &sync_db_safe_->get();
     }
   };
+  std::shared_ptr<WriteBatchPolicy> write_batch_policy_;
   ActorOwn<Impl> impl_;
 };
 
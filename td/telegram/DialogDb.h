@@ -12,6 +12,7 @@
 #include "td/telegram/NotificationGroupKey.h"
 
 #include "td/db/KeyValueSyncInterface.h"
+#include "td/db/WriteBatchPolicy.h"
 
 #include "td/actor/PromiseFuture.h"
 
@@ -95,6 +96,8 @@ class DialogDbAsyncInterface {
   virtual void get_secret_chat_count(FolderId folder_id, Promise<int32> promise) = 0;
 
   virtual void close(Promise<> promise) = 0;
+
+  virtual WriteBatchPolicy::Stats get_write_batch_stats() const = 0;
 };
 
 Status init_dialog_db(SqliteDb &db, int version, KeyValueSyncInterface &binlog_pmc,
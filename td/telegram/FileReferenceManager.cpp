@@ -21,6 +21,7 @@
 
 #include "td/utils/algorithm.h"
 #include "td/utils/common.h"
+#include "td/utils/format.h"
 #include "td/utils/logging.h"
 #include "td/utils/misc.h"
 #include "td/utils/overloaded.h"
@@ -251,8 +252,7 @@ void FileReferenceManager::send_query(Destination dest, FileSourceId file_source
   CHECK(index < file_sources_.size());
   file_sources_[index].visit(overloaded(
       [&](const FileSourceMessage &source) {
-        send_closure_later(G()->messages_manager(), &MessagesManager::get_message_from_server, source.full_message_id,
-                           std::move(promise), "FileSourceMessage", nullptr);
+        repair_message_file_source(source.full_message_id, std::move(promise));
       },
       [&](const FileSourceUserPhoto &source) {
         send_closure_later(G()->contacts_manager(), &ContactsManager::reload_user_profile_photo, source.user_id,
@@ -303,6 +303,87 @@ void FileReferenceManager::send_query(Destination dest, FileSourceId file_source
       }));
 }
 
+void FileReferenceManager::repair_message_file_source(FullMessageId full_message_id, Promise<Unit> promise) {
+  auto it = repaired_message_times_.find(full_message_id);
+  if (it != repaired_message_times_.end() && it->second >= Time::now() - REPAIRED_MESSAGE_CACHE_TIME) {
+    VLOG(file_references) << "Use recently repaired " << full_message_id;
+    return promise.set_value(Unit());
+  }
+
+  auto &promises = message_repair_queries_[full_message_id];
+  promises.push_back(std::move(promise));
+  if (promises.size() != 1) {
+    // the message is already being reloaded
+    return;
+  }
+
+  pending_repaired_messages_.push_back(full_message_id);
+  if (!are_message_repair_queries_scheduled_) {
+    are_message_repair_queries_scheduled_ = true;
+    send_closure_later(actor_id(this), &FileReferenceManager::send_message_repair_queries);
+  }
+}
+
+void FileReferenceManager::send_message_repair_queries() {
+  CHECK(are_message_repair_queries_scheduled_);
+  are_message_repair_queries_scheduled_ = false;
+
+  auto now = Time::now();
+  for (auto it = repaired_message_times_.begin(); it != repaired_message_times_.end();) {
+    if (it->second < now - REPAIRED_MESSAGE_CACHE_TIME) {
+      it = repaired_message_times_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+
+  // messages from all channels are requested using separate queries, so group them to not mix up errors
+  std::unordered_map<DialogId, vector<FullMessageId>, DialogIdHash> grouped_message_ids;
+  for (auto full_message_id : pending_repaired_messages_) {
+    auto dialog_id = full_message_id.get_dialog_id();
+    auto group_dialog_id = dialog_id.get_type() == DialogType::Channel ? dialog_id : DialogId();
+    grouped_message_ids[group_dialog_id].push_back(full_message_id);
+  }
+  pending_repaired_messages_.clear();
+
+  for (auto &it : grouped_message_ids) {
+    auto &message_ids = it.second;
+    for (size_t i = 0; i < message_ids.size(); i += MAX_REPAIRED_MESSAGES_PER_QUERY) {
+      auto end_i = min(i + MAX_REPAIRED_MESSAGES_PER_QUERY, message_ids.size());
+      vector<FullMessageId> query_message_ids(message_ids.begin() + i, message_ids.begin() + end_i);
+      VLOG(file_references) << "Repair file references from " << query_message_ids;
+      auto promise =
+          PromiseCreator::lambda([actor_id = actor_id(this), query_message_ids](Result<Unit> result) mutable {
+            send_closure(actor_id, &FileReferenceManager::on_repair_messages, std::move(query_message_ids),
+                         std::move(result));
+          });
+      send_closure(G()->messages_manager(), &MessagesManager::get_messages_from_server, std::move(query_message_ids),
+                   std::move(promise), "FileSourceMessage", nullptr);
+    }
+  }
+}
+
+void FileReferenceManager::on_repair_messages(vector<FullMessageId> full_message_ids, Result<Unit> result) {
+  auto now = Time::now();
+  for (auto full_message_id : full_message_ids) {
+    if (result.is_ok()) {
+      repaired_message_times_[full_message_id] = now;
+    }
+
+    auto it = message_repair_queries_.find(full_message_id);
+    CHECK(it != message_repair_queries_.end());
+    auto promises = std::move(it->second);
+    message_repair_queries_.erase(it);
+    for (auto &promise : promises) {
+      if (result.is_ok()) {
+        promise.set_value(Unit());
+      } else {
+        promise.set_error(result.error().clone());
+      }
+    }
+  }
+}
+
 FileReferenceManager::Destination FileReferenceManager::on_query_result(Destination dest, FileSourceId file_source_id,
                                                                         Status status, int32 sub) {
   if (G()->close_flag()) {
@@ -9,6 +9,7 @@
 #include "td/telegram/BackgroundId.h"
 #include "td/telegram/ChannelId.h"
 #include "td/telegram/ChatId.h"
+#include "td/telegram/DialogId.h"
 #include "td/telegram/files/FileId.h"
 #include "td/telegram/files/FileSourceId.h"
 #include "td/telegram/FullMessageId.h"
@@ -152,8 +153,20 @@ class FileReferenceManager final : public Actor {
 
   std::unordered_map<NodeId, Node, FileIdHash> nodes_;
 
+  static constexpr size_t MAX_REPAIRED_MESSAGES_PER_QUERY = 100;
+  static constexpr double REPAIRED_MESSAGE_CACHE_TIME = 30.0;
+
+  // messages which need to be reloaded or are being reloaded to repair file references with promises waiting for them
+  std::unordered_map<FullMessageId, vector<Promise<Unit>>, FullMessageIdHash> message_repair_queries_;
+  vector<FullMessageId> pending_repaired_messages_;
+  bool are_message_repair_queries_scheduled_ = false;
+  std::unordered_map<FullMessageId, double, FullMessageIdHash> repaired_message_times_;
+
   void run_node(NodeId node);
   void send_query(Destination dest, FileSourceId file_source_id);
+  void repair_message_file_source(FullMessageId full_message_id, Promise<Unit> promise);
+  void send_message_repair_queries();
+  void on_repair_messages(vector<FullMessageId> full_message_ids, Result<Unit> result);
   Destination on_query_result(Destination dest, FileSourceId file_source_id, Status status, int32 sub = 0);
 
   template <class T>
@@ -28,6 +28,7 @@
 #include "td/utils/SliceBuilder.h"
 
 #include <map>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 
@@ -874,6 +875,7 @@ struct GroupCallManager::GroupCall {
 
 struct GroupCallManager::GroupCallParticipants {
   vector<GroupCallParticipant> participants;
+  std::unordered_map<DialogId, size_t, DialogIdHash> participant_indexes;  // dialog_id -> index in participants
   string next_offset;
   GroupCallParticipantOrder min_order = GroupCallParticipantOrder::max();
   bool joined_date_asc = false;
@@ -887,6 +889,54 @@ struct GroupCallManager::GroupCallParticipants {
   };
   std::map<int32, PendingUpdates> pending_version_updates_;
   std::map<int32, PendingUpdates> pending_mute_updates_;
+
+  GroupCallParticipant *find_participant(DialogId dialog_id) {
+    auto it = participant_indexes.find(dialog_id);
+    if (it == participant_indexes.end()) {
+      return nullptr;
+    }
+    return &participants[it->second];
+  }
+
+  size_t find_participant_index(const GroupCallParticipant &participant) const {
+    auto it = participant_indexes.find(participant.dialog_id);
+    if (it != participant_indexes.end()) {
+      return it->second;
+    }
+    if (participant.is_self) {
+      for (size_t i = 0; i < participants.size(); i++) {
+        if (participants[i].is_self) {
+          return i;
+        }
+      }
+    }
+    return participants.size();
+  }
+
+  void add_participant(GroupCallParticipant &&participant) {
+    participant_indexes[participant.dialog_id] = participants.size();
+    participants.push_back(std::move(participant));
+  }
+
+  void replace_participant(size_t index, GroupCallParticipant &&participant) {
+    CHECK(index < participants.size());
+    if (participants[index].dialog_id != participant.dialog_id) {
+      participant_indexes.erase(participants[index].dialog_id);
+      participant_indexes[participant.dialog_id] = index;
+    }
+    participants[index] = std::move(participant);
+  }
+
+  // the last participant is moved to the place of the removed one
+  void remove_participant(size_t index) {
+    CHECK(index < participants.size());
+    participant_indexes.erase(participants[index].dialog_id);
+    if (index + 1 != participants.size()) {
+      participants[index] = std::move(participants.back());
+      participant_indexes[participants[index].dialog_id] = index;
+    }
+    participants.pop_back();
+  }
 };
 
 struct GroupCallManager::GroupCallRecentSpeakers {
@@ -1624,11 +1674,7 @@ GroupCallParticipant *GroupCallManager::get_group_call_participant(GroupCallPart
       }
     }
   } else {
-    for (auto &group_call_participant : group_call_participants->participants) {
-      if (group_call_participant.dialog_id == dialog_id) {
-        return &group_call_participant;
-      }
-    }
+    return group_call_participants->find_participant(dialog_id);
   }
   return nullptr;
 }
@@ -2021,11 +2067,11 @@ void GroupCallManager::process_group_call_participants(
   if (is_sync) {
     auto *group_call_participants = add_group_call_participants(input_group_call_id);
     auto &group_participants = group_call_participants->participants;
-    for (auto participant_it = group_participants.begin(); participant_it != group_participants.end();) {
-      auto &participant = *participant_it;
+    for (size_t i = 0; i < group_participants.size();) {
+      auto &participant = group_participants[i];
       if (old_participant_dialog_ids.count(participant.dialog_id) == 0) {
         // successfully synced old user
-        ++participant_it;
+        i++;
         continue;
       }
 
@@ -2034,7 +2080,7 @@ void GroupCallManager::process_group_call_participants(
           participant.order = min_order;
           send_update_group_call_participant(input_group_call_id, participant, "process_group_call_participants self");
         }
-        ++participant_it;
+        i++;
         continue;
       }
 
@@ -2046,7 +2092,8 @@ void GroupCallManager::process_group_call_participants(
       }
       on_remove_group_call_participant(input_group_call_id, participant.dialog_id);
       group_call_participants->local_unmuted_video_count -= participant.get_has_video();
-      participant_it = group_participants.erase(participant_it);
+      // the next participant to check is moved to the i-th place
+      group_call_participants->remove_participant(i);
     }
     if (group_call_participants->min_order < min_order) {
       // if previously known more users, adjust min_order
@@ -2148,48 +2195,47 @@ std::pair<int32, int32> GroupCallManager::process_group_call_participant(InputGr
   bool can_self_unmute = get_group_call_can_self_unmute(input_group_call_id);
   bool can_manage = can_manage_group_call(input_group_call_id);
   auto *participants = add_group_call_participants(input_group_call_id);
-  for (size_t i = 0; i < participants->participants.size(); i++) {
+  auto i = participants->find_participant_index(participant);
+  if (i != participants->participants.size()) {
     auto &old_participant = participants->participants[i];
-    if (old_participant.dialog_id == participant.dialog_id || (old_participant.is_self && participant.is_self)) {
-      if (participant.joined_date == 0) {
-        LOG(INFO) << "Remove " << old_participant;
-        if (old_participant.order.is_valid()) {
-          send_update_group_call_participant(input_group_call_id, participant, "process_group_call_participant remove");
-        }
-        on_remove_group_call_participant(input_group_call_id, old_participant.dialog_id);
-        remove_recent_group_call_speaker(input_group_call_id, old_participant.dialog_id);
-        int32 unmuted_video_diff = -old_participant.get_has_video();
-        participants->local_unmuted_video_count += unmuted_video_diff;
-        participants->participants.erase(participants->participants.begin() + i);
-        return {-1, unmuted_video_diff};
+    if (participant.joined_date == 0) {
+      LOG(INFO) << "Remove " << old_participant;
+      if (old_participant.order.is_valid()) {
+        send_update_group_call_participant(input_group_call_id, participant, "process_group_call_participant remove");
       }
+      on_remove_group_call_participant(input_group_call_id, old_participant.dialog_id);
+      remove_recent_group_call_speaker(input_group_call_id, old_participant.dialog_id);
+      int32 unmuted_video_diff = -old_participant.get_has_video();
+      participants->local_unmuted_video_count += unmuted_video_diff;
+      participants->remove_participant(i);
+      return {-1, unmuted_video_diff};
+    }
 
-      if (old_participant.version > participant.version) {
-        LOG(INFO) << "Ignore outdated update of " << old_participant.dialog_id;
-        return {0, 0};
-      }
+    if (old_participant.version > participant.version) {
+      LOG(INFO) << "Ignore outdated update of " << old_participant.dialog_id;
+      return {0, 0};
+    }
 
-      if (old_participant.dialog_id != participant.dialog_id) {
-        on_remove_group_call_participant(input_group_call_id, old_participant.dialog_id);
-        on_add_group_call_participant(input_group_call_id, participant.dialog_id);
-      }
+    if (old_participant.dialog_id != participant.dialog_id) {
+      on_remove_group_call_participant(input_group_call_id, old_participant.dialog_id);
+      on_add_group_call_participant(input_group_call_id, participant.dialog_id);
+    }
 
-      participant.update_from(old_participant);
+    participant.update_from(old_participant);
 
-      participant.is_just_joined = false;
-      participant.order = get_real_participant_order(can_self_unmute, participant, participants);
-      update_group_call_participant_can_be_muted(can_manage, participants, participant);
+    participant.is_just_joined = false;
+    participant.order = get_real_participant_order(can_self_unmute, participant, participants);
+    update_group_call_participant_can_be_muted(can_manage, participants, participant);
 
-      LOG(INFO) << "Edit " << old_participant << " to " << participant;
-      if (old_participant != participant && (old_participant.order.is_valid() || participant.order.is_valid())) {
-        send_update_group_call_participant(input_group_call_id, participant, "process_group_call_participant edit");
-      }
-      on_participant_speaking_in_group_call(input_group_call_id, participant);
-      int32 unmuted_video_diff = participant.get_has_video() - old_participant.get_has_video();
-      participants->local_unmuted_video_count += unmuted_video_diff;
-      old_participant = std::move(participant);
-      return {0, unmuted_video_diff};
+    LOG(INFO) << "Edit " << old_participant << " to " << participant;
+    if (old_participant != participant && (old_participant.order.is_valid() || participant.order.is_valid())) {
+      send_update_group_call_participant(input_group_call_id, participant, "process_group_call_participant edit");
     }
+    on_participant_speaking_in_group_call(input_group_call_id, participant);
+    int32 unmuted_video_diff = participant.get_has_video() - old_participant.get_has_video();
+    participants->local_unmuted_video_count += unmuted_video_diff;
+    participants->replace_participant(i, std::move(participant));
+    return {0, unmuted_video_diff};
   }
 
   if (participant.joined_date == 0) {
@@ -2209,7 +2255,7 @@ std::pair<int32, int32> GroupCallManager::process_group_call_participant(InputGr
   participant.is_just_joined = false;
   participants->local_unmuted_video_count += participant.get_has_video();
   update_group_call_participant_can_be_muted(can_manage, participants, participant);
-  participants->participants.push_back(std::move(participant));
+  participants->add_participant(std::move(participant));
   if (participants->participants.back().order.is_valid()) {
     send_update_group_call_participant(input_group_call_id, participants->participants.back(),
                                        "process_group_call_participant add");
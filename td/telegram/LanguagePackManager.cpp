@@ -9,6 +9,7 @@
 #include "td/telegram/ConfigShared.h"
 #include "td/telegram/Global.h"
 #include "td/telegram/logevent/LogEvent.h"
+#include "td/telegram/MemoryStats.h"
 #include "td/telegram/misc.h"
 #include "td/telegram/net/NetQueryDispatcher.h"
 #include "td/telegram/Td.h"
@@ -22,6 +23,7 @@
 #include "td/utils/ExitGuard.h"
 #include "td/utils/logging.h"
 #include "td/utils/misc.h"
+#include "td/utils/optional.h"
 #include "td/utils/SliceBuilder.h"
 #include "td/utils/Status.h"
 
@@ -40,6 +42,18 @@ struct LanguagePackManager::PluralizedString {
   string few_value_;
   string many_value_;
   string other_value_;
+
+  friend bool operator==(const PluralizedString &lhs, const PluralizedString &rhs) {
+    return lhs.zero_value_ == rhs.zero_value_ && lhs.one_value_ == rhs.one_value_ &&
+           lhs.two_value_ == rhs.two_value_ && lhs.few_value_ == rhs.few_value_ &&
+           lhs.many_value_ == rhs.many_value_ && lhs.other_value_ == rhs.other_value_;
+  }
+};
+
+// immutable strings of a full language, which are shared between all equal languages in all databases
+struct LanguagePackManager::LanguageStrings {
+  std::unordered_map<string, string> ordinary_strings_;
+  std::unordered_map<string, PluralizedString> pluralized_strings_;
 };
 
 struct LanguagePackManager::Language {
@@ -51,6 +65,9 @@ struct LanguagePackManager::Language {
   bool was_loaded_full_ = false;
   bool has_get_difference_query_ = false;
   vector<Promise<Unit>> get_difference_queries_;
+  string shared_strings_key_;  // language pack and language code
+  std::shared_ptr<const LanguageStrings> shared_strings_;
+  // changes on top of shared_strings_
   std::unordered_map<string, string> ordinary_strings_;
   std::unordered_map<string, PluralizedString> pluralized_strings_;
   std::unordered_set<string> deleted_strings_;
@@ -120,7 +137,8 @@ bool LanguagePackManager::is_custom_language_code(Slice language_code) {
 }
 
 static Result<SqliteDb> open_database(const string &path) {
-  TRY_RESULT(database, SqliteDb::open_with_key(path, true, DbKey::empty()));
+  TRY_RESULT(database, SqliteDb::open_with_key(path, true, DbKey::empty(), optional<int32>(),
+                                               G()->parameters().language_pack_database_profile));
   TRY_STATUS(database.exec("PRAGMA journal_mode=WAL"));
   return std::move(database);
 }
@@ -627,6 +645,7 @@ LanguagePackManager::Language *LanguagePackManager::add_language(LanguageDatabas
   auto code_it = pack->languages_.find(language_code);
   if (code_it == pack->languages_.end()) {
     auto language = make_unique<Language>();
+    language->shared_strings_key_ = PSTRING() << language_pack << '$' << language_code;
     if (!database->database_.empty()) {
       language->kv_
           .init_with_connection(database->database_.clone(), get_database_table_name(language_pack, language_code))
@@ -643,9 +662,89 @@ LanguagePackManager::Language *LanguagePackManager::add_language(LanguageDatabas
   return code_it->second.get();
 }
 
+const string *LanguagePackManager::get_ordinary_string_unsafe(const Language *language, const string &key) {
+  auto it = language->ordinary_strings_.find(key);
+  if (it != language->ordinary_strings_.end()) {
+    return &it->second;
+  }
+  if (language->shared_strings_ == nullptr || language->pluralized_strings_.count(key) != 0 ||
+      language->deleted_strings_.count(key) != 0) {
+    return nullptr;
+  }
+  auto shared_it = language->shared_strings_->ordinary_strings_.find(key);
+  if (shared_it != language->shared_strings_->ordinary_strings_.end()) {
+    return &shared_it->second;
+  }
+  return nullptr;
+}
+
+const LanguagePackManager::PluralizedString *LanguagePackManager::get_pluralized_string_unsafe(
+    const Language *language, const string &key) {
+  auto it = language->pluralized_strings_.find(key);
+  if (it != language->pluralized_strings_.end()) {
+    return &it->second;
+  }
+  if (language->shared_strings_ == nullptr || language->ordinary_strings_.count(key) != 0 ||
+      language->deleted_strings_.count(key) != 0) {
+    return nullptr;
+  }
+  auto shared_it = language->shared_strings_->pluralized_strings_.find(key);
+  if (shared_it != language->shared_strings_->pluralized_strings_.end()) {
+    return &shared_it->second;
+  }
+  return nullptr;
+}
+
+void LanguagePackManager::share_language_strings_unsafe(Language *language) {
+  CHECK(language->is_full_);
+  auto strings = std::make_shared<LanguageStrings>();
+  if (language->shared_strings_ == nullptr) {
+    strings->ordinary_strings_ = std::move(language->ordinary_strings_);
+    strings->pluralized_strings_ = std::move(language->pluralized_strings_);
+  } else {
+    for (auto &str : language->shared_strings_->ordinary_strings_) {
+      if (get_ordinary_string_unsafe(language, str.first) == &str.second) {
+        strings->ordinary_strings_.insert(str);
+      }
+    }
+    for (auto &str : language->shared_strings_->pluralized_strings_) {
+      if (get_pluralized_string_unsafe(language, str.first) == &str.second) {
+        strings->pluralized_strings_.insert(str);
+      }
+    }
+    for (auto &str : language->ordinary_strings_) {
+      strings->ordinary_strings_[str.first] = std::move(str.second);
+    }
+    for (auto &str : language->pluralized_strings_) {
+      strings->pluralized_strings_[str.first] = std::move(str.second);
+    }
+  }
+  language->ordinary_strings_.clear();
+  language->pluralized_strings_.clear();
+  language->deleted_strings_.clear();
+
+  // a language of the same version is likely to be already loaded by another client with a different database
+  auto key = PSTRING() << language->shared_strings_key_ << '$' << language->version_.load();
+  std::lock_guard<std::mutex> lock(shared_language_strings_mutex_);
+  auto &shared_strings = shared_language_strings_[key];
+  auto other_strings = shared_strings.lock();
+  if (other_strings != nullptr && other_strings->ordinary_strings_ == strings->ordinary_strings_ &&
+      other_strings->pluralized_strings_ == strings->pluralized_strings_) {
+    LOG(INFO) << "Reuse strings of language " << key;
+    language->shared_strings_ = std::move(other_strings);
+    return;
+  }
+  language->shared_strings_ = std::move(strings);
+  if (other_strings == nullptr) {
+    shared_strings = language->shared_strings_;
+  }
+}
+
 bool LanguagePackManager::language_has_string_unsafe(const Language *language, const string &key) {
   return language->ordinary_strings_.count(key) != 0 || language->pluralized_strings_.count(key) != 0 ||
-         language->deleted_strings_.count(key) != 0;
+         language->deleted_strings_.count(key) != 0 ||
+         (language->shared_strings_ != nullptr && (language->shared_strings_->ordinary_strings_.count(key) != 0 ||
+                                                   language->shared_strings_->pluralized_strings_.count(key) != 0));
 }
 
 bool LanguagePackManager::language_has_strings(Language *language, const vector<string> &keys) {
@@ -731,7 +830,7 @@ bool LanguagePackManager::load_language_strings(LanguageDatabase *database, Lang
     }
 
     language->is_full_ = true;
-    language->deleted_strings_.clear();
+    share_language_strings_unsafe(language);
     return true;
   }
 
@@ -787,13 +886,13 @@ td_api::object_ptr<td_api::languagePackString> LanguagePackManager::get_language
 td_api::object_ptr<td_api::LanguagePackStringValue> LanguagePackManager::get_language_pack_string_value_object(
     const Language *language, const string &key) {
   CHECK(language != nullptr);
-  auto ordinary_it = language->ordinary_strings_.find(key);
-  if (ordinary_it != language->ordinary_strings_.end()) {
-    return get_language_pack_string_value_object(ordinary_it->second);
+  auto ordinary_string = get_ordinary_string_unsafe(language, key);
+  if (ordinary_string != nullptr) {
+    return get_language_pack_string_value_object(*ordinary_string);
   }
-  auto pluralized_it = language->pluralized_strings_.find(key);
-  if (pluralized_it != language->pluralized_strings_.end()) {
-    return get_language_pack_string_value_object(pluralized_it->second);
+  auto pluralized_string = get_pluralized_string_unsafe(language, key);
+  if (pluralized_string != nullptr) {
+    return get_language_pack_string_value_object(*pluralized_string);
   }
   LOG_IF(ERROR, !language->is_full_ && language->deleted_strings_.count(key) == 0) << "Have no string for key " << key;
   return get_language_pack_string_value_object();
@@ -817,6 +916,18 @@ td_api::object_ptr<td_api::languagePackStrings> LanguagePackManager::get_languag
     for (auto &str : language->pluralized_strings_) {
       strings.push_back(get_language_pack_string_object(str));
     }
+    if (language->shared_strings_ != nullptr) {
+      for (auto &str : language->shared_strings_->ordinary_strings_) {
+        if (get_ordinary_string_unsafe(language, str.first) == &str.second) {
+          strings.push_back(get_language_pack_string_object(str));
+        }
+      }
+      for (auto &str : language->shared_strings_->pluralized_strings_) {
+        if (get_pluralized_string_unsafe(language, str.first) == &str.second) {
+          strings.push_back(get_language_pack_string_object(str));
+        }
+      }
+    }
   } else {
     for (auto &key : keys) {
       strings.push_back(get_language_pack_string_object(language, key));
@@ -1367,14 +1478,19 @@ void LanguagePackManager::on_get_language_pack_strings(
         switch (result->get_id()) {
           case telegram_api::langPackString::ID: {
             auto str = telegram_api::move_object_as<telegram_api::langPackString>(result);
+            if (get_ordinary_string_unsafe(language, str->key_) == nullptr) {
+              key_count_delta++;
+            }
+            if (get_pluralized_string_unsafe(language, str->key_) != nullptr) {
+              key_count_delta--;
+            }
             auto it = language->ordinary_strings_.find(str->key_);
             if (it == language->ordinary_strings_.end()) {
-              key_count_delta++;
               it = language->ordinary_strings_.emplace(str->key_, std::move(str->value_)).first;
             } else {
               it->second = std::move(str->value_);
             }
-            key_count_delta -= static_cast<int32>(language->pluralized_strings_.erase(str->key_));
+            language->pluralized_strings_.erase(str->key_);
             language->deleted_strings_.erase(str->key_);
             if (is_diff) {
               strings.push_back(get_language_pack_string_object(*it));
@@ -1387,14 +1503,19 @@ void LanguagePackManager::on_get_language_pack_strings(
             PluralizedString value{std::move(str->zero_value_), std::move(str->one_value_),
                                    std::move(str->two_value_),  std::move(str->few_value_),
                                    std::move(str->many_value_), std::move(str->other_value_)};
+            if (get_pluralized_string_unsafe(language, str->key_) == nullptr) {
+              key_count_delta++;
+            }
+            if (get_ordinary_string_unsafe(language, str->key_) != nullptr) {
+              key_count_delta--;
+            }
             auto it = language->pluralized_strings_.find(str->key_);
             if (it == language->pluralized_strings_.end()) {
-              key_count_delta++;
               it = language->pluralized_strings_.emplace(str->key_, std::move(value)).first;
             } else {
               it->second = std::move(value);
             }
-            key_count_delta -= static_cast<int32>(language->ordinary_strings_.erase(str->key_));
+            language->ordinary_strings_.erase(str->key_);
             language->deleted_strings_.erase(str->key_);
             if (is_diff) {
               strings.push_back(get_language_pack_string_object(*it));
@@ -1408,8 +1529,14 @@ void LanguagePackManager::on_get_language_pack_strings(
           }
           case telegram_api::langPackStringDeleted::ID: {
             auto str = telegram_api::move_object_as<telegram_api::langPackStringDeleted>(result);
-            key_count_delta -= static_cast<int32>(language->ordinary_strings_.erase(str->key_));
-            key_count_delta -= static_cast<int32>(language->pluralized_strings_.erase(str->key_));
+            if (get_ordinary_string_unsafe(language, str->key_) != nullptr) {
+              key_count_delta--;
+            }
+            if (get_pluralized_string_unsafe(language, str->key_) != nullptr) {
+              key_count_delta--;
+            }
+            language->ordinary_strings_.erase(str->key_);
+            language->pluralized_strings_.erase(str->key_);
             language->deleted_strings_.insert(str->key_);
             if (is_diff) {
               strings.push_back(get_language_pack_string_object(str->key_));
@@ -1449,7 +1576,7 @@ void LanguagePackManager::on_get_language_pack_strings(
       if (keys.empty() && !is_diff) {
         CHECK(new_database_version >= 0);
         language->is_full_ = true;
-        language->deleted_strings_.clear();
+        share_language_strings_unsafe(language);
       }
       new_is_full = language->is_full_;
     }
@@ -1797,6 +1924,24 @@ void LanguagePackManager::set_custom_language_string(string language_code,
   promise.set_value(Unit());
 }
 
+void LanguagePackManager::memory_stats(MemoryStats &stats) {
+  std::lock_guard<std::mutex> lock(shared_language_strings_mutex_);
+  size_t string_count = 0;
+  size_t size = 0;
+  for (auto &it : shared_language_strings_) {
+    auto strings = it.second.lock();
+    if (strings == nullptr) {
+      continue;
+    }
+    string_count += strings->ordinary_strings_.size() + strings->pluralized_strings_.size();
+    for (auto &str : strings->ordinary_strings_) {
+      size += sizeof(str) + str.first.size() + str.second.size();
+    }
+    size += strings->pluralized_strings_.size() * sizeof(std::pair<const string, PluralizedString>);
+  }
+  stats.add("shared_language_strings_", string_count, size);
+}
+
 void LanguagePackManager::delete_language(string language_code, Promise<Unit> &&promise) {
   if (language_pack_.empty()) {
     return promise.set_error(Status::Error(400, "Option \"localization_target\" needs to be set first"));
@@ -1846,6 +1991,7 @@ Status LanguagePackManager::do_delete_language(const string &language_code) {
   language->version_ = -1;
   language->key_count_ = load_database_language_key_count(&language->kv_);
   language->is_full_ = false;
+  language->shared_strings_ = nullptr;
   language->ordinary_strings_.clear();
   language->pluralized_strings_.clear();
   language->deleted_strings_.clear();
@@ -1877,5 +2023,8 @@ void LanguagePackManager::hangup() {
 int32 LanguagePackManager::manager_count_ = 0;
 std::mutex LanguagePackManager::language_database_mutex_;
 std::unordered_map<string, unique_ptr<LanguagePackManager::LanguageDatabase>> LanguagePackManager::language_databases_;
+std::mutex LanguagePackManager::shared_language_strings_mutex_;
+std::unordered_map<string, std::weak_ptr<const LanguagePackManager::LanguageStrings>>
+    LanguagePackManager::shared_language_strings_;
 
 }  // namespace td
@@ -18,12 +18,14 @@
 #include "td/utils/Slice.h"
 #include "td/utils/Status.h"
 
+#include <memory>
 #include <mutex>
 #include <unordered_map>
 #include <utility>
 
 namespace td {
 
+class MemoryStats;
 class SqliteKeyValue;
 
 class LanguagePackManager final : public NetQueryCallback {
@@ -82,8 +84,12 @@ class LanguagePackManager final : public NetQueryCallback {
 
   void delete_language(string language_code, Promise<Unit> &&promise);
 
+  // language strings are shared between all instances, so they are reported only once
+  static void memory_stats(MemoryStats &stats);
+
  private:
   struct PluralizedString;
+  struct LanguageStrings;
   struct Language;
   struct LanguageInfo;
   struct LanguagePack;
@@ -107,6 +113,9 @@ class LanguagePackManager final : public NetQueryCallback {
   static std::mutex language_database_mutex_;
   static std::unordered_map<string, unique_ptr<LanguageDatabase>> language_databases_;
 
+  static std::mutex shared_language_strings_mutex_;
+  static std::unordered_map<string, std::weak_ptr<const LanguageStrings>> shared_language_strings_;
+
   static LanguageDatabase *add_language_database(string path);
 
   static Language *get_language(LanguageDatabase *database, const string &language_pack, const string &language_code);
@@ -114,6 +123,11 @@ class LanguagePackManager final : public NetQueryCallback {
 
   static Language *add_language(LanguageDatabase *database, const string &language_pack, const string &language_code);
 
+  static const string *get_ordinary_string_unsafe(const Language *language, const string &key);
+  static const PluralizedString *get_pluralized_string_unsafe(const Language *language, const string &key);
+
+  static void share_language_strings_unsafe(Language *language);
+
   static bool language_has_string_unsafe(const Language *language, const string &key);
   static bool language_has_strings(Language *language, const vector<string> &keys);
 
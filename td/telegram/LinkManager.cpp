@@ -623,6 +623,52 @@ Result<string> LinkManager::check_link(Slice link) {
   return http_url.get_url();
 }
 
+static bool tolower_equals(Slice str, Slice lowered_str) {
+  return str.size() == lowered_str.size() && tolower_begins_with(str, lowered_str);
+}
+
+// quickly checks whether an HTTP URL can have one of the given hosts without parsing and decoding the URL
+static bool may_have_t_me_host(Slice link, const vector<Slice> &t_me_urls) {
+  size_t pos = 0;
+  while (pos < link.size() && Slice(":/?#@[]").find(link[pos]) == Slice::npos) {
+    pos++;
+  }
+  if (begins_with(link.substr(pos), "://")) {
+    link.remove_prefix(pos + 3);
+  }
+  size_t host_end = 0;
+  while (host_end < link.size() && Slice("/?#").find(link[host_end]) == Slice::npos) {
+    host_end++;
+  }
+  Slice host = link.substr(0, host_end);
+  for (size_t i = host.size(); i > 0; i--) {
+    auto c = host[i - 1];
+    if (c == ':') {
+      host.truncate(i - 1);
+    }
+    if (c == ':' || c == ']' || c == '@') {
+      break;
+    }
+  }
+  auto at_pos = host.rfind('@');
+  if (at_pos != Slice::npos) {
+    host.remove_prefix(at_pos + 1);
+  }
+  if (host.find('%') != Slice::npos || host.find('[') != Slice::npos) {
+    // the host needs to be decoded first
+    return true;
+  }
+  if (tolower_begins_with(host, "www.")) {
+    host.remove_prefix(4);
+  }
+  for (auto t_me_url : t_me_urls) {
+    if (tolower_equals(host, t_me_url)) {
+      return true;
+    }
+  }
+  return false;
+}
+
 LinkManager::LinkInfo LinkManager::get_link_info(Slice link) {
   LinkInfo result;
   if (link.empty()) {
@@ -639,6 +685,26 @@ LinkManager::LinkInfo LinkManager::get_link_info(Slice link) {
     is_tg = true;
   }
 
+  vector<Slice> t_me_urls;
+  string cur_t_me_url;
+  if (!is_tg) {
+    t_me_urls = {Slice("t.me"), Slice("telegram.me"), Slice("telegram.dog")};
+    if (Scheduler::context() != nullptr) {  // for tests only
+      cur_t_me_url = G()->shared_config().get_option_string("t_me_url");
+      if (tolower_begins_with(cur_t_me_url, "http://") || tolower_begins_with(cur_t_me_url, "https://")) {
+        Slice t_me_url = cur_t_me_url;
+        t_me_url = t_me_url.substr(t_me_url[4] == 's' ? 8 : 7);
+        if (!td::contains(t_me_urls, t_me_url)) {
+          t_me_urls.push_back(t_me_url);
+        }
+      }
+    }
+
+    if (!may_have_t_me_host(link, t_me_urls)) {
+      return result;
+    }
+  }
+
   auto r_http_url = parse_url(link);
   if (r_http_url.is_error()) {
     return result;
@@ -664,18 +730,6 @@ LinkManager::LinkInfo LinkManager::get_link_info(Slice link) {
       return result;
     }
 
-    vector<Slice> t_me_urls{Slice("t.me"), Slice("telegram.me"), Slice("telegram.dog")};
-    if (Scheduler::context() != nullptr) {  // for tests only
-      string cur_t_me_url = G()->shared_config().get_option_string("t_me_url");
-      if (tolower_begins_with(cur_t_me_url, "http://") || tolower_begins_with(cur_t_me_url, "https://")) {
-        Slice t_me_url = cur_t_me_url;
-        t_me_url = t_me_url.substr(t_me_url[4] == 's' ? 8 : 7);
-        if (!td::contains(t_me_urls, t_me_url)) {
-          t_me_urls.push_back(t_me_url);
-        }
-      }
-    }
-
     auto host = url_decode(http_url.host_, false);
     to_lower_inplace(host);
     if (begins_with(host, "www.")) {
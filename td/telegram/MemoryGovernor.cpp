@@ -0,0 +1,85 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2022
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "td/telegram/MemoryGovernor.h"
+
+#include "td/telegram/ConfigShared.h"
+#include "td/telegram/Global.h"
+
+#include "td/utils/logging.h"
+
+#include <algorithm>
+
+namespace td {
+
+constexpr double MemoryGovernor::MEMORY_CHECK_PERIOD;
+
+MemoryGovernor::MemoryGovernor(ActorShared<> parent) : parent_(std::move(parent)) {
+}
+
+void MemoryGovernor::register_cache(int32 priority, unique_ptr<Cache> cache) {
+  CHECK(cache != nullptr);
+  auto it = std::upper_bound(caches_.begin(), caches_.end(), priority,
+                             [](int32 priority, const CacheInfo &info) { return priority < info.priority; });
+  caches_.insert(it, CacheInfo{priority, std::move(cache)});
+}
+
+void MemoryGovernor::start_up() {
+  memory_limit_ = G()->shared_config().get_option_integer("memory_limit");
+  if (memory_limit_ > 0) {
+    set_timeout_in(MEMORY_CHECK_PERIOD);
+  }
+}
+
+void MemoryGovernor::on_memory_limit_changed() {
+  memory_limit_ = G()->shared_config().get_option_integer("memory_limit");
+  if (memory_limit_ > 0) {
+    check_memory_usage();
+  } else {
+    cancel_timeout();
+  }
+}
+
+void MemoryGovernor::timeout_expired() {
+  check_memory_usage();
+}
+
+void MemoryGovernor::check_memory_usage() {
+  if (G()->close_flag() || memory_limit_ <= 0) {
+    return;
+  }
+  set_timeout_in(MEMORY_CHECK_PERIOD);
+
+  size_t total_size = 0;
+  for (auto &info : caches_) {
+    total_size += info.cache->get_memory_usage();
+  }
+  auto memory_limit = static_cast<size_t>(memory_limit_);
+  if (total_size <= memory_limit) {
+    return;
+  }
+
+  // reduce memory usage to 3/4 of the limit, so the caches aren't reduced again right after they grow a bit
+  auto need_free_size = total_size - memory_limit / 4 * 3;
+  auto old_total_size = total_size;
+  for (auto &info : caches_) {
+    auto old_size = info.cache->get_memory_usage();
+    info.cache->reduce_memory_usage(old_size > need_free_size ? old_size - need_free_size : 0);
+    auto new_size = info.cache->get_memory_usage();
+    if (new_size < old_size) {
+      auto freed_size = old_size - new_size;
+      total_size -= freed_size;
+      if (freed_size >= need_free_size) {
+        break;
+      }
+      need_free_size -= freed_size;
+    }
+  }
+  LOG(INFO) << "Reduce memory usage from " << old_total_size << " to " << total_size << " bytes with limit "
+            << memory_limit;
+}
+
+}  // namespace td
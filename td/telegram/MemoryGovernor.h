@@ -0,0 +1,80 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2022
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#pragma once
+
+#include "td/actor/actor.h"
+
+#include "td/utils/common.h"
+
+namespace td {
+
+// keeps approximate total size of evictable in-memory caches of a Td instance below the option "memory_limit"
+class MemoryGovernor final : public Actor {
+ public:
+  class Cache {
+   public:
+    Cache() = default;
+    Cache(const Cache &) = delete;
+    Cache &operator=(const Cache &) = delete;
+    Cache(Cache &&) = delete;
+    Cache &operator=(Cache &&) = delete;
+    virtual ~Cache() = default;
+
+    // returns approximate size of memory used by the cache
+    virtual size_t get_memory_usage() const = 0;
+
+    // tries to reduce size of memory used by the cache to the specified value
+    virtual void reduce_memory_usage(size_t target_size) = 0;
+  };
+
+  explicit MemoryGovernor(ActorShared<> parent);
+
+  // caches with lower priority are reduced first; the caches must outlive the MemoryGovernor
+  void register_cache(int32 priority, unique_ptr<Cache> cache);
+
+  // registers a manager, which has methods get_memory_usage and reduce_memory_usage, as a cache
+  template <class ManagerT>
+  void register_manager(int32 priority, ManagerT *manager) {
+    class ManagerCache final : public Cache {
+     public:
+      explicit ManagerCache(ManagerT *manager) : manager_(manager) {
+      }
+      size_t get_memory_usage() const final {
+        return manager_->get_memory_usage();
+      }
+      void reduce_memory_usage(size_t target_size) final {
+        manager_->reduce_memory_usage(target_size);
+      }
+
+     private:
+      ManagerT *manager_;
+    };
+    register_cache(priority, make_unique<ManagerCache>(manager));
+  }
+
+  void on_memory_limit_changed();
+
+ private:
+  static constexpr double MEMORY_CHECK_PERIOD = 60.0;
+
+  struct CacheInfo {
+    int32 priority;
+    unique_ptr<Cache> cache;
+  };
+
+  void start_up() final;
+
+  void timeout_expired() final;
+
+  void check_memory_usage();
+
+  ActorShared<> parent_;
+  int64 memory_limit_ = 0;  // 0 if unlimited
+  vector<CacheInfo> caches_;
+};
+
+}  // namespace td
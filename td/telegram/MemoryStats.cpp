@@ -0,0 +1,46 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2022
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "td/telegram/MemoryStats.h"
+
+#include "td/utils/JsonBuilder.h"
+
+namespace td {
+
+void MemoryStats::add(Slice name, size_t count, size_t size) {
+  entries_.push_back(Entry{owner_, name.str(), count, size});
+  total_size_ += size;
+}
+
+td_api::object_ptr<td_api::memoryStatistics> MemoryStats::get_memory_statistics_object() const {
+  // {"total_size":...,"<owner>":{"total_size":...,"<container>":{"count":...,"size":...},...},...}
+  auto statistics = json_encode<string>(json_object([&](auto &o) {
+    o("total_size", JsonLong(static_cast<int64>(total_size_)));
+    size_t i = 0;
+    while (i < entries_.size()) {
+      size_t j = i;
+      size_t owner_size = 0;
+      while (j < entries_.size() && entries_[j].owner == entries_[i].owner) {
+        owner_size += entries_[j].size;
+        j++;
+      }
+      o(entries_[i].owner, json_object([&](auto &owner_object) {
+          owner_object("total_size", JsonLong(static_cast<int64>(owner_size)));
+          for (size_t k = i; k < j; k++) {
+            const auto &entry = entries_[k];
+            owner_object(entry.name, json_object([&entry](auto &container_object) {
+                           container_object("count", JsonLong(static_cast<int64>(entry.count)));
+                           container_object("size", JsonLong(static_cast<int64>(entry.size)));
+                         }));
+          }
+        }));
+      i = j;
+    }
+  }));
+  return td_api::make_object<td_api::memoryStatistics>(std::move(statistics));
+}
+
+}  // namespace td
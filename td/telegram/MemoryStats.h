@@ -0,0 +1,54 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2022
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#pragma once
+
+#include "td/telegram/td_api.h"
+
+#include "td/utils/common.h"
+#include "td/utils/Slice.h"
+
+namespace td {
+
+// approximate number of objects and memory usage of in-memory containers, grouped by their owner
+class MemoryStats {
+ public:
+  explicit MemoryStats(string owner) : owner_(std::move(owner)) {
+  }
+
+  // all subsequently added containers belong to the owner
+  void set_owner(string owner) {
+    owner_ = std::move(owner);
+  }
+
+  void add(Slice name, size_t count, size_t size);
+
+  // pointee_size is the size of objects owned by container elements, for example, through unique_ptr
+  template <class ContainerT>
+  void add_container(Slice name, const ContainerT &container, size_t pointee_size = 0) {
+    add(name, container.size(), container.size() * (sizeof(typename ContainerT::value_type) + pointee_size));
+  }
+
+  size_t get_total_size() const {
+    return total_size_;
+  }
+
+  td_api::object_ptr<td_api::memoryStatistics> get_memory_statistics_object() const;
+
+ private:
+  struct Entry {
+    string owner;
+    string name;
+    size_t count;
+    size_t size;
+  };
+
+  string owner_;
+  vector<Entry> entries_;
+  size_t total_size_ = 0;
+};
+
+}  // namespace td
@@ -5684,7 +5684,7 @@ void update_used_hashtags(Td *td, const MessageContent *content) {
     CHECK(utf16_pos == entity.offset + entity.length);
     auto to = ptr;
 
-    send_closure(td->hashtag_hints_, &HashtagHints::hashtag_used, Slice(from + 1, to).str());
+    send_closure(td->get_hashtag_hints(), &HashtagHints::hashtag_used, Slice(from + 1, to).str());
   }
 }
 
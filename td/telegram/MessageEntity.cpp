@@ -21,6 +21,7 @@
 #include "td/utils/utf8.h"
 
 #include <algorithm>
+#include <array>
 #include <cstring>
 #include <limits>
 #include <tuple>
@@ -1626,9 +1627,46 @@ static void fix_entity_offsets(Slice text, vector<MessageEntity> &entities) {
   }
 }
 
+// characters, without which the corresponding entities can't be found
+static constexpr uint8 ENTITY_TRIGGER_AT = 1 << 0;
+static constexpr uint8 ENTITY_TRIGGER_SLASH = 1 << 1;
+static constexpr uint8 ENTITY_TRIGGER_HASH = 1 << 2;
+static constexpr uint8 ENTITY_TRIGGER_DOLLAR = 1 << 3;
+static constexpr uint8 ENTITY_TRIGGER_DOT = 1 << 4;
+static constexpr uint8 ENTITY_TRIGGER_COLON = 1 << 5;
+static constexpr uint8 ENTITY_TRIGGER_DIGIT = 1 << 6;
+
+static uint8 get_entity_triggers(Slice text) {
+  static const auto trigger_table = [] {
+    std::array<uint8, 256> table{};
+    table['@'] = ENTITY_TRIGGER_AT;
+    table['/'] = ENTITY_TRIGGER_SLASH;
+    table['#'] = ENTITY_TRIGGER_HASH;
+    table['$'] = ENTITY_TRIGGER_DOLLAR;
+    table['.'] = ENTITY_TRIGGER_DOT;
+    table[':'] = ENTITY_TRIGGER_COLON;
+    for (int c = '0'; c <= '9'; c++) {
+      table[c] = ENTITY_TRIGGER_DIGIT;
+    }
+    return table;
+  }();
+
+  uint8 result = 0;
+  for (auto c : text) {
+    result |= trigger_table[static_cast<unsigned char>(c)];
+  }
+  return result;
+}
+
 vector<MessageEntity> find_entities(Slice text, bool skip_bot_commands, bool skip_media_timestamps) {
   vector<MessageEntity> entities;
 
+  // most texts contain no entities, so check once which of the finders can find something
+  auto triggers = get_entity_triggers(text);
+  if (triggers == 0) {
+    return entities;
+  }
+
   auto add_entities = [&entities, &text](MessageEntity::Type type, vector<Slice> (*find_entities_f)(Slice)) mutable {
     auto new_entities = find_entities_f(text);
     for (auto &entity : new_entities) {
@@ -1637,25 +1675,37 @@ vector<MessageEntity> find_entities(Slice text, bool skip_bot_commands, bool ski
       entities.emplace_back(type, offset, length);
     }
   };
-  add_entities(MessageEntity::Type::Mention, find_mentions);
-  if (!skip_bot_commands) {
+  if ((triggers & ENTITY_TRIGGER_AT) != 0) {
+    add_entities(MessageEntity::Type::Mention, find_mentions);
+  }
+  if (!skip_bot_commands && (triggers & ENTITY_TRIGGER_SLASH) != 0) {
     add_entities(MessageEntity::Type::BotCommand, find_bot_commands);
   }
-  add_entities(MessageEntity::Type::Hashtag, find_hashtags);
-  add_entities(MessageEntity::Type::Cashtag, find_cashtags);
+  if ((triggers & ENTITY_TRIGGER_HASH) != 0) {
+    add_entities(MessageEntity::Type::Hashtag, find_hashtags);
+  }
+  if ((triggers & ENTITY_TRIGGER_DOLLAR) != 0) {
+    add_entities(MessageEntity::Type::Cashtag, find_cashtags);
+  }
   // TODO find_phone_numbers
-  add_entities(MessageEntity::Type::BankCardNumber, find_bank_card_numbers);
-  add_entities(MessageEntity::Type::Url, find_tg_urls);
+  if ((triggers & ENTITY_TRIGGER_DIGIT) != 0) {
+    add_entities(MessageEntity::Type::BankCardNumber, find_bank_card_numbers);
+  }
+  if ((triggers & ENTITY_TRIGGER_COLON) != 0) {
+    add_entities(MessageEntity::Type::Url, find_tg_urls);
+  }
 
-  auto urls = find_urls(text);
-  for (auto &url : urls) {
-    auto type = url.second ? MessageEntity::Type::EmailAddress : MessageEntity::Type::Url;
-    auto offset = narrow_cast<int32>(url.first.begin() - text.begin());
-    auto length = narrow_cast<int32>(url.first.size());
-    entities.emplace_back(type, offset, length);
+  if ((triggers & ENTITY_TRIGGER_DOT) != 0) {
+    auto urls = find_urls(text);
+    for (auto &url : urls) {
+      auto type = url.second ? MessageEntity::Type::EmailAddress : MessageEntity::Type::Url;
+      auto offset = narrow_cast<int32>(url.first.begin() - text.begin());
+      auto length = narrow_cast<int32>(url.first.size());
+      entities.emplace_back(type, offset, length);
+    }
   }
 
-  if (!skip_media_timestamps) {
+  if (!skip_media_timestamps && (triggers & ENTITY_TRIGGER_COLON) != 0) {
     auto media_timestamps = find_media_timestamps(text);
     for (auto &entity : media_timestamps) {
       auto offset = narrow_cast<int32>(entity.first.begin() - text.begin());
@@ -1721,6 +1771,9 @@ static bool is_plain_domain(Slice url) {
 }
 
 string get_first_url(Slice text, const vector<MessageEntity> &entities) {
+  // entities are sorted by offset, so the text is scanned only once
+  Slice left_text = text;
+  int32 left_text_offset = 0;
   for (auto &entity : entities) {
     switch (entity.type) {
       case MessageEntity::Type::Mention:
@@ -1730,7 +1783,13 @@ string get_first_url(Slice text, const vector<MessageEntity> &entities) {
       case MessageEntity::Type::BotCommand:
         break;
       case MessageEntity::Type::Url: {
-        Slice url = utf8_utf16_substr(text, entity.offset, entity.length);
+        if (entity.offset < left_text_offset) {
+          left_text = text;
+          left_text_offset = 0;
+        }
+        left_text = utf8_utf16_substr(left_text, static_cast<size_t>(entity.offset - left_text_offset));
+        left_text_offset = entity.offset;
+        Slice url = utf8_utf16_substr(left_text, 0, entity.length);
         string scheme = to_lower(url.substr(0, 4));
         if (scheme == "ton:" || begins_with(scheme, "tg:") || scheme == "ftp:" || is_plain_domain(url)) {
           continue;
@@ -1786,6 +1845,7 @@ Result<vector<MessageEntity>> parse_markdown(string &text) {
   string result;
   vector<MessageEntity> entities;
   size_t size = text.size();
+  result.reserve(size);  // the result is never longer than the text
   int32 utf16_offset = 0;
   for (size_t i = 0; i < size; i++) {
     auto c = static_cast<unsigned char>(text[i]);
@@ -1897,7 +1957,7 @@ Result<vector<MessageEntity>> parse_markdown(string &text) {
       i += 2;
     }
   }
-  text = result;
+  text = std::move(result);
   return entities;
 }
 
@@ -2125,8 +2185,9 @@ static Result<vector<MessageEntity>> do_parse_markdown_v2(CSlice text, string &r
 
 Result<vector<MessageEntity>> parse_markdown_v2(string &text) {
   string result;
+  result.reserve(text.size());  // the result is never longer than the text
   TRY_RESULT(entities, do_parse_markdown_v2(text, result));
-  text = result;
+  text = std::move(result);
   return entities;
 }
 
@@ -3118,13 +3179,14 @@ static Result<vector<MessageEntity>> do_parse_html(CSlice text, string &result)
 
 Result<vector<MessageEntity>> parse_html(string &text) {
   string result;
+  result.reserve(text.size());  // the result is never longer than the text
   TRY_RESULT(entities, do_parse_html(text, result));
   if (!check_utf8(result)) {
     return Status::Error(400,
                          "Text contains invalid Unicode characters after decoding HTML entities, check for unmatched "
                          "surrogate code units");
   }
-  text = result;
+  text = std::move(result);
   return entities;
 }
 
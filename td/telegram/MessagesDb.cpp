@@ -12,11 +12,14 @@
 #include "td/db/SqliteConnectionSafe.h"
 #include "td/db/SqliteDb.h"
 #include "td/db/SqliteStatement.h"
+#include "td/db/WriteBatchPolicy.h"
 
 #include "td/actor/actor.h"
+#include "td/actor/MultiPromise.h"
 #include "td/actor/PromiseFuture.h"
 #include "td/actor/SchedulerLocalStorage.h"
 
+#include "td/utils/algorithm.h"
 #include "td/utils/format.h"
 #include "td/utils/logging.h"
 #include "td/utils/ScopeGuard.h"
@@ -845,6 +848,15 @@ class MessagesDbImpl final : public MessagesDbSyncInterface {
     return std::move(result);
   }
 
+  Result<bool> merge_fts(int32 page_count) final {
+    CHECK(page_count > 0);
+    auto old_total_changes = db_.get_total_changes();
+    TRY_STATUS(
+        db_.exec(PSLICE() << "INSERT INTO messages_fts(messages_fts, rank) VALUES('merge', " << page_count << ')'));
+    // according to FTS5 documentation, less than 2 changed rows mean that there is nothing left to merge
+    return db_.get_total_changes() - old_total_changes >= 2;
+  }
+
   Status begin_write_transaction() final {
     return db_.begin_write_transaction();
   }
@@ -1015,8 +1027,11 @@ std::shared_ptr<MessagesDbSyncSafeInterface> create_messages_db_sync(
 
 class MessagesDbAsync final : public MessagesDbAsyncInterface {
  public:
-  MessagesDbAsync(std::shared_ptr<MessagesDbSyncSafeInterface> sync_db, int32 scheduler_id) {
-    impl_ = create_actor_on_scheduler<Impl>("MessagesDbActor", scheduler_id, std::move(sync_db));
+  MessagesDbAsync(std::shared_ptr<MessagesDbSyncSafeInterface> sync_db, int32 scheduler_id,
+                  vector<int32> read_scheduler_ids)
+      : write_batch_policy_(std::make_shared<WriteBatchPolicy>()) {
+    impl_ = create_actor_on_scheduler<Impl>("MessagesDbActor", scheduler_id, std::move(sync_db), write_batch_policy_,
+                                            std::move(read_scheduler_ids));
   }
 
   void add_message(FullMessageId full_message_id, ServerMessageId unique_message_id, DialogId sender_dialog_id,
@@ -1091,14 +1106,35 @@ class MessagesDbAsync final : public MessagesDbAsyncInterface {
     send_closure_later(impl_, &Impl::close, std::move(promise));
   }
 
+  WriteBatchPolicy::Stats get_write_batch_stats() const final {
+    return write_batch_policy_->get_stats();
+  }
+
   void force_flush() final {
     send_closure_later(impl_, &Impl::force_flush);
   }
 
+  void set_fts_merge_budget(int32 page_count) final {
+    send_closure_later(impl_, &Impl::set_fts_merge_budget, page_count);
+  }
+
  private:
+  // runs read queries on its own scheduler using a separate SQLite connection
+  class Reader final : public Actor {
+   public:
+    void close(Promise<> promise) {
+      promise.set_value(Unit());
+      stop();
+    }
+  };
+
   class Impl final : public Actor {
    public:
-    explicit Impl(std::shared_ptr<MessagesDbSyncSafeInterface> sync_db_safe) : sync_db_safe_(std::move(sync_db_safe)) {
+    Impl(std::shared_ptr<MessagesDbSyncSafeInterface> sync_db_safe,
+         std::shared_ptr<WriteBatchPolicy> write_batch_policy, vector<int32> read_scheduler_ids)
+        : sync_db_safe_(std::move(sync_db_safe))
+        , write_batch_policy_(std::move(write_batch_policy))
+        , read_scheduler_ids_(std::move(read_scheduler_ids)) {
     }
     void add_message(FullMessageId full_message_id, ServerMessageId unique_message_id, DialogId sender_dialog_id,
                      int64 random_id, int32 ttl_expires_at, int32 index_mask, int64 search_id, string text,
@@ -1112,6 +1148,8 @@ class MessagesDbAsync final : public MessagesDbAsyncInterface {
                                               ttl_expires_at, index_mask, search_id, std::move(text), notification_id,
                                               top_thread_message_id, std::move(data)));
       });
+      // the message can replace an old message with a different text
+      on_dialog_fts_changed(full_message_id.get_dialog_id());
     }
     void add_scheduled_message(FullMessageId full_message_id, BufferSlice data, Promise<> promise) {
       add_write_query([this, full_message_id, promise = std::move(promise), data = std::move(data)](Unit) mutable {
@@ -1123,6 +1161,9 @@ class MessagesDbAsync final : public MessagesDbAsyncInterface {
       add_write_query([this, full_message_id, promise = std::move(promise)](Unit) mutable {
         on_write_result(std::move(promise), sync_db_->delete_message(full_message_id));
       });
+      if (!full_message_id.get_message_id().is_scheduled()) {
+        on_dialog_fts_changed(full_message_id.get_dialog_id());
+      }
     }
     void on_write_result(Promise<> promise, Status status) {
       // We are inside a transaction and don't know how to handle the error
@@ -1130,74 +1171,136 @@ class MessagesDbAsync final : public MessagesDbAsyncInterface {
       pending_write_results_.emplace_back(std::move(promise), std::move(status));
     }
     void delete_all_dialog_messages(DialogId dialog_id, MessageId from_message_id, Promise<> promise) {
-      add_read_query();
+      do_flush();
+      on_dialog_fts_changed(dialog_id);
       promise.set_result(sync_db_->delete_all_dialog_messages(dialog_id, from_message_id));
     }
     void delete_dialog_messages_by_sender(DialogId dialog_id, DialogId sender_dialog_id, Promise<> promise) {
-      add_read_query();
+      do_flush();
+      on_dialog_fts_changed(dialog_id);
       promise.set_result(sync_db_->delete_dialog_messages_by_sender(dialog_id, sender_dialog_id));
     }
 
     void get_message(FullMessageId full_message_id, Promise<MessagesDbDialogMessage> promise) {
-      add_read_query();
-      promise.set_result(sync_db_->get_message(full_message_id));
+      add_read_query([full_message_id, promise = std::move(promise)](MessagesDbSyncInterface &sync_db) mutable {
+        promise.set_result(sync_db.get_message(full_message_id));
+      });
     }
     void get_message_by_unique_message_id(ServerMessageId unique_message_id, Promise<MessagesDbMessage> promise) {
-      add_read_query();
-      promise.set_result(sync_db_->get_message_by_unique_message_id(unique_message_id));
+      add_read_query([unique_message_id, promise = std::move(promise)](MessagesDbSyncInterface &sync_db) mutable {
+        promise.set_result(sync_db.get_message_by_unique_message_id(unique_message_id));
+      });
     }
     void get_message_by_random_id(DialogId dialog_id, int64 random_id, Promise<MessagesDbDialogMessage> promise) {
-      add_read_query();
-      promise.set_result(sync_db_->get_message_by_random_id(dialog_id, random_id));
+      add_read_query([dialog_id, random_id, promise = std::move(promise)](MessagesDbSyncInterface &sync_db) mutable {
+        promise.set_result(sync_db.get_message_by_random_id(dialog_id, random_id));
+      });
     }
     void get_dialog_message_by_date(DialogId dialog_id, MessageId first_message_id, MessageId last_message_id,
                                     int32 date, Promise<MessagesDbDialogMessage> promise) {
-      add_read_query();
-      promise.set_result(sync_db_->get_dialog_message_by_date(dialog_id, first_message_id, last_message_id, date));
+      add_read_query([dialog_id, first_message_id, last_message_id, date,
+                      promise = std::move(promise)](MessagesDbSyncInterface &sync_db) mutable {
+        promise.set_result(sync_db.get_dialog_message_by_date(dialog_id, first_message_id, last_message_id, date));
+      });
     }
 
     void get_dialog_message_calendar(MessagesDbDialogCalendarQuery query, Promise<MessagesDbCalendar> promise) {
-      add_read_query();
-      promise.set_result(sync_db_->get_dialog_message_calendar(std::move(query)));
+      add_read_query(
+          [query = std::move(query), promise = std::move(promise)](MessagesDbSyncInterface &sync_db) mutable {
+            promise.set_result(sync_db.get_dialog_message_calendar(std::move(query)));
+          });
     }
 
     void get_dialog_sparse_message_positions(MessagesDbGetDialogSparseMessagePositionsQuery query,
                                              Promise<MessagesDbMessagePositions> promise) {
-      add_read_query();
-      promise.set_result(sync_db_->get_dialog_sparse_message_positions(std::move(query)));
+      add_read_query(
+          [query = std::move(query), promise = std::move(promise)](MessagesDbSyncInterface &sync_db) mutable {
+            promise.set_result(sync_db.get_dialog_sparse_message_positions(std::move(query)));
+          });
     }
 
     void get_messages(MessagesDbMessagesQuery query, Promise<vector<MessagesDbDialogMessage>> promise) {
-      add_read_query();
-      promise.set_result(sync_db_->get_messages(std::move(query)));
+      add_read_query(
+          [query = std::move(query), promise = std::move(promise)](MessagesDbSyncInterface &sync_db) mutable {
+            promise.set_result(sync_db.get_messages(std::move(query)));
+          });
     }
     void get_scheduled_messages(DialogId dialog_id, int32 limit, Promise<vector<MessagesDbDialogMessage>> promise) {
-      add_read_query();
-      promise.set_result(sync_db_->get_scheduled_messages(dialog_id, limit));
+      add_read_query([dialog_id, limit, promise = std::move(promise)](MessagesDbSyncInterface &sync_db) mutable {
+        promise.set_result(sync_db.get_scheduled_messages(dialog_id, limit));
+      });
     }
     void get_messages_from_notification_id(DialogId dialog_id, NotificationId from_notification_id, int32 limit,
                                            Promise<vector<MessagesDbDialogMessage>> promise) {
-      add_read_query();
-      promise.set_result(sync_db_->get_messages_from_notification_id(dialog_id, from_notification_id, limit));
+      add_read_query([dialog_id, from_notification_id, limit,
+                      promise = std::move(promise)](MessagesDbSyncInterface &sync_db) mutable {
+        promise.set_result(sync_db.get_messages_from_notification_id(dialog_id, from_notification_id, limit));
+      });
     }
     void get_calls(MessagesDbCallsQuery query, Promise<MessagesDbCallsResult> promise) {
-      add_read_query();
-      promise.set_result(sync_db_->get_calls(std::move(query)));
+      add_read_query(
+          [query = std::move(query), promise = std::move(promise)](MessagesDbSyncInterface &sync_db) mutable {
+            promise.set_result(sync_db.get_calls(std::move(query)));
+          });
     }
     void get_messages_fts(MessagesDbFtsQuery query, Promise<MessagesDbFtsResult> promise) {
-      add_read_query();
-      promise.set_result(sync_db_->get_messages_fts(std::move(query)));
+      // the query is cached after tokenization, so queries with the same words share the cached result
+      FtsCacheKey key{MessagesDbImpl::prepare_query(query.query), query.dialog_id, query.filter, query.from_search_id,
+                      query.limit};
+      for (auto it = fts_cache_.begin(); it != fts_cache_.end(); ++it) {
+        if (it->first == key) {
+          LOG(INFO) << "Found FTS query result in cache";
+          auto result = copy_fts_result(it->second);
+          std::rotate(it, it + 1, fts_cache_.end());
+          return promise.set_value(std::move(result));
+        }
+      }
+
+      add_read_query([actor_id = actor_id(this), generation = fts_cache_generation_, key = std::move(key),
+                      query = std::move(query),
+                      promise = std::move(promise)](MessagesDbSyncInterface &sync_db) mutable {
+        auto r_result = sync_db.get_messages_fts(std::move(query));
+        if (r_result.is_error()) {
+          return promise.set_error(r_result.move_as_error());
+        }
+        send_closure(actor_id, &Impl::on_get_messages_fts, generation, std::move(key), r_result.move_as_ok(),
+                     std::move(promise));
+      });
     }
     void get_expiring_messages(int32 expires_from, int32 expires_till, int32 limit,
                                Promise<std::pair<vector<MessagesDbMessage>, int32>> promise) {
-      add_read_query();
-      promise.set_result(sync_db_->get_expiring_messages(expires_from, expires_till, limit));
+      add_read_query(
+          [expires_from, expires_till, limit, promise = std::move(promise)](MessagesDbSyncInterface &sync_db) mutable {
+            promise.set_result(sync_db.get_expiring_messages(expires_from, expires_till, limit));
+          });
     }
 
     void close(Promise<> promise) {
       do_flush();
+      fts_merge_at_ = 0;
+      fts_cache_.clear();
+      cancel_timeout();
       sync_db_safe_.reset();
       sync_db_ = nullptr;
+
+      // wait for already sent read queries
+      MultiPromiseActorSafe mpas{"MessagesDbReadersCloseMultiPromiseActor"};
+      mpas.add_promise(PromiseCreator::lambda(
+          [actor_id = actor_id(this), promise = std::move(promise)](Unit) mutable {
+            send_closure(actor_id, &Impl::on_readers_closed, std::move(promise));
+          }));
+      auto lock = mpas.get_promise();
+      for (auto &reader : readers_) {
+        send_closure(reader, &Reader::close, mpas.get_promise());
+      }
+      lock.set_value(Unit());
+    }
+
+    void on_readers_closed(Promise<> promise) {
+      for (auto &reader : readers_) {
+        reader.release();
+      }
+      readers_.clear();
       promise.set_value(Unit());
       stop();
     }
@@ -1207,63 +1310,178 @@ class MessagesDbAsync final : public MessagesDbAsyncInterface {
       do_flush();
     }
 
+    void set_fts_merge_budget(int32 page_count) {
+      fts_merge_budget_ = page_count > 0 ? page_count : DEFAULT_FTS_MERGE_BUDGET;
+    }
+
    private:
     std::shared_ptr<MessagesDbSyncSafeInterface> sync_db_safe_;
     MessagesDbSyncInterface *sync_db_ = nullptr;
 
-    static constexpr size_t MAX_PENDING_QUERIES_COUNT{50};
-    static constexpr double MAX_PENDING_QUERIES_DELAY{0.01};
+    std::shared_ptr<WriteBatchPolicy> write_batch_policy_;
+
+    vector<int32> read_scheduler_ids_;
+    vector<ActorOwn<Reader>> readers_;
+    size_t next_reader_ = 0;
 
     //NB: order is important, destructor of pending_writes_ will change pending_write_results_
     vector<std::pair<Promise<>, Status>> pending_write_results_;
     vector<Promise<>> pending_writes_;
     double wakeup_at_ = 0;
+
+    static constexpr int32 DEFAULT_FTS_MERGE_BUDGET = 64;
+    static constexpr double FTS_MERGE_DELAY = 30.0;
+    static constexpr double FTS_MERGE_STEP_DELAY = 1.0;
+    static constexpr size_t MAX_FTS_CACHE_SIZE = 16;
+
+    int32 fts_merge_budget_ = DEFAULT_FTS_MERGE_BUDGET;
+    double fts_merge_at_ = 0;
+
+    struct FtsCacheKey {
+      string words;
+      DialogId dialog_id;
+      MessageSearchFilter filter;
+      int64 from_search_id;
+      int32 limit;
+
+      bool operator==(const FtsCacheKey &other) const {
+        return words == other.words && dialog_id == other.dialog_id && filter == other.filter &&
+               from_search_id == other.from_search_id && limit == other.limit;
+      }
+    };
+    // the most recently used results are at the end
+    vector<std::pair<FtsCacheKey, MessagesDbFtsResult>> fts_cache_;
+    uint64 fts_cache_generation_ = 0;
+
+    static MessagesDbFtsResult copy_fts_result(const MessagesDbFtsResult &result) {
+      MessagesDbFtsResult copy;
+      copy.next_search_id = result.next_search_id;
+      for (auto &message : result.messages) {
+        copy.messages.push_back(MessagesDbMessage{message.dialog_id, message.message_id, message.data.clone()});
+      }
+      return copy;
+    }
+
+    void on_get_messages_fts(uint64 generation, FtsCacheKey key, MessagesDbFtsResult result,
+                             Promise<MessagesDbFtsResult> promise) {
+      if (generation == fts_cache_generation_) {
+        if (fts_cache_.size() == MAX_FTS_CACHE_SIZE) {
+          fts_cache_.erase(fts_cache_.begin());
+        }
+        fts_cache_.emplace_back(std::move(key), copy_fts_result(result));
+      }
+      promise.set_value(std::move(result));
+    }
+
+    void on_dialog_fts_changed(DialogId dialog_id) {
+      fts_cache_generation_++;
+      td::remove_if(fts_cache_, [dialog_id](const auto &it) {
+        return !it.first.dialog_id.is_valid() || it.first.dialog_id == dialog_id;
+      });
+
+      if (fts_merge_at_ == 0) {
+        fts_merge_at_ = Time::now() + FTS_MERGE_DELAY;
+        update_timeout();
+      }
+    }
+
+    void run_fts_merge() {
+      fts_merge_at_ = 0;
+      if (sync_db_ == nullptr) {
+        return;
+      }
+      auto start_time = Time::now();
+      auto r_need_more = sync_db_->merge_fts(fts_merge_budget_);
+      if (r_need_more.is_error()) {
+        LOG(ERROR) << "Failed to merge FTS index: " << r_need_more.error();
+      } else {
+        LOG(INFO) << "Merged up to " << fts_merge_budget_ << " FTS index pages in " << Time::now() - start_time;
+        if (r_need_more.ok()) {
+          fts_merge_at_ = Time::now() + FTS_MERGE_STEP_DELAY;
+        }
+      }
+      update_timeout();
+    }
+
+    void update_timeout() {
+      double timeout_at = wakeup_at_;
+      if (fts_merge_at_ != 0 && (timeout_at == 0 || fts_merge_at_ < timeout_at)) {
+        timeout_at = fts_merge_at_;
+      }
+      if (timeout_at != 0) {
+        set_timeout_at(timeout_at);
+      } else {
+        cancel_timeout();
+      }
+    }
     template <class F>
     void add_write_query(F &&f) {
+      auto now = Time::now_cached();
+      write_batch_policy_->on_query(now);
       pending_writes_.push_back(PromiseCreator::lambda(std::forward<F>(f), PromiseCreator::Ignore()));
-      if (pending_writes_.size() > MAX_PENDING_QUERIES_COUNT) {
+      if (write_batch_policy_->is_full(pending_writes_.size())) {
         do_flush();
-        wakeup_at_ = 0;
       } else if (wakeup_at_ == 0) {
-        wakeup_at_ = Time::now_cached() + MAX_PENDING_QUERIES_DELAY;
-      }
-      if (wakeup_at_ != 0) {
-        set_timeout_at(wakeup_at_);
+        wakeup_at_ = now + write_batch_policy_->get_flush_delay();
       }
+      update_timeout();
     }
-    void add_read_query() {
+    template <class F>
+    void add_read_query(F &&f) {
+      // all previous writes must be visible to the query
       do_flush();
+      if (readers_.empty()) {
+        f(*sync_db_);
+        return;
+      }
+
+      auto &reader = readers_[next_reader_++ % readers_.size()];
+      send_lambda(reader, [sync_db_safe = sync_db_safe_, f = std::forward<F>(f)]() mutable { f(sync_db_safe->get()); });
     }
     void do_flush() {
       if (pending_writes_.empty()) {
         return;
       }
+      auto start_time = Time::now();
       sync_db_->begin_write_transaction().ensure();
       for (auto &query : pending_writes_) {
         query.set_value(Unit());
       }
       sync_db_->commit_transaction().ensure();
+      write_batch_policy_->on_commit(pending_writes_.size(), Time::now() - start_time);
       pending_writes_.clear();
       for (auto &p : pending_write_results_) {
         p.first.set_result(std::move(p.second));
       }
       pending_write_results_.clear();
-      cancel_timeout();
+      wakeup_at_ = 0;
+      update_timeout();
     }
     void timeout_expired() final {
-      do_flush();
+      if (wakeup_at_ != 0 && Time::now() >= wakeup_at_) {
+        do_flush();
+      }
+      if (fts_merge_at_ != 0 && Time::now() >= fts_merge_at_) {
+        do_flush();
+        run_fts_merge();
+      }
     }
 
     void start_up() final {
       sync_db_ = &sync_db_safe_->get();
+      for (auto scheduler_id : read_scheduler_ids_) {
+        readers_.push_back(create_actor_on_scheduler<Reader>("MessagesDbReader", scheduler_id));
+      }
     }
   };
+  std::shared_ptr<WriteBatchPolicy> write_batch_policy_;
   ActorOwn<Impl> impl_;
 };
 
 std::shared_ptr<MessagesDbAsyncInterface> create_messages_db_async(std::shared_ptr<MessagesDbSyncSafeInterface> sync_db,
-                                                                   int32 scheduler_id) {
-  return std::make_shared<MessagesDbAsync>(std::move(sync_db), scheduler_id);
+                                                                   int32 scheduler_id,
+                                                                   vector<int32> read_scheduler_ids) {
+  return std::make_shared<MessagesDbAsync>(std::move(sync_db), scheduler_id, std::move(read_scheduler_ids));
 }
 
 }  // namespace td
@@ -13,6 +13,8 @@
 #include "td/telegram/NotificationId.h"
 #include "td/telegram/ServerMessageId.h"
 
+#include "td/db/WriteBatchPolicy.h"
+
 #include "td/actor/PromiseFuture.h"
 
 #include "td/utils/buffer.h"
@@ -138,6 +140,9 @@ class MessagesDbSyncInterface {
   virtual Result<MessagesDbCallsResult> get_calls(MessagesDbCallsQuery query) = 0;
   virtual Result<MessagesDbFtsResult> get_messages_fts(MessagesDbFtsQuery query) = 0;
 
+  // merges at most page_count pages of full-text search index segments, returns true if there is more work to do
+  virtual Result<bool> merge_fts(int32 page_count) = 0;
+
   virtual Status begin_write_transaction() = 0;
   virtual Status commit_transaction() = 0;
 };
@@ -197,6 +202,11 @@ class MessagesDbAsyncInterface {
 
   virtual void close(Promise<> promise) = 0;
   virtual void force_flush() = 0;
+
+  // sets maximum number of full-text search index pages merged at once when the database is idle; 0 for default
+  virtual void set_fts_merge_budget(int32 page_count) = 0;
+
+  virtual WriteBatchPolicy::Stats get_write_batch_stats() const = 0;
 };
 
 Status init_messages_db(SqliteDb &db, int version) TD_WARN_UNUSED_RESULT;
@@ -205,7 +215,9 @@ Status drop_messages_db(SqliteDb &db, int version) TD_WARN_UNUSED_RESULT;
 std::shared_ptr<MessagesDbSyncSafeInterface> create_messages_db_sync(
     std::shared_ptr<SqliteConnectionSafe> sqlite_connection);
 
+// read queries are distributed between read_scheduler_ids if any, write queries are run only on scheduler_id
 std::shared_ptr<MessagesDbAsyncInterface> create_messages_db_async(std::shared_ptr<MessagesDbSyncSafeInterface> sync_db,
-                                                                   int32 scheduler_id);
+                                                                   int32 scheduler_id,
+                                                                   vector<int32> read_scheduler_ids = {});
 
 }  // namespace td
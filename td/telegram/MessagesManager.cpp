@@ -30,6 +30,7 @@
 #include "td/telegram/LinkManager.h"
 #include "td/telegram/Location.h"
 #include "td/telegram/logevent/LogEvent.h"
+#include "td/telegram/MemoryStats.h"
 #include "td/telegram/MessageContent.h"
 #include "td/telegram/MessageEntity.h"
 #include "td/telegram/MessageEntity.hpp"
@@ -5249,7 +5250,6 @@ void MessagesManager::Message::parse(ParserT &parser) {
   }
 
   parse(message_id, parser);
-  random_y = get_random_y(message_id);
   if (has_sender) {
     parse(sender_user_id, parser);
   }
@@ -5798,7 +5798,10 @@ void MessagesManager::Dialog::parse(ParserT &parser) {
   parse(last_clear_history_date, parser);
   parse(order, parser);
   if (has_last_database_message) {
-    parse(messages, parser);
+    unique_ptr<Message> last_database_message;
+    parse(last_database_message, parser);
+    auto last_database_message_id = last_database_message->message_id;
+    messages.insert(last_database_message_id, std::move(last_database_message));
   }
   if (has_first_database_message_id) {
     parse(first_database_message_id, parser);
@@ -8420,7 +8423,7 @@ void MessagesManager::set_dialog_available_reactions(Dialog *d, vector<string> &
 
 void MessagesManager::update_dialog_message_reactions_visibility(Dialog *d) {
   vector<MessageId> message_ids;
-  find_messages(d->messages.get(), message_ids,
+  find_messages(d->messages, message_ids,
                 [](const Message *m) { return m->reactions != nullptr && !m->reactions->reactions_.empty(); });
   int32 unread_reaction_count = 0;
   for (auto message_id : message_ids) {
@@ -9072,7 +9075,7 @@ void MessagesManager::do_send_media(DialogId dialog_id, Message *m, FileId file_
 
   MessageContent *content = nullptr;
   if (m->message_id.is_any_server()) {
-    content = m->edited_content.get();
+    content = get_message_edited_content(m);
     if (content == nullptr) {
       LOG(ERROR) << "Message has no edited content";
       return;
@@ -9214,7 +9217,7 @@ void MessagesManager::on_upload_thumbnail(FileId thumbnail_file_id,
   bool is_edit = m->message_id.is_any_server();
 
   if (thumbnail_input_file == nullptr) {
-    delete_message_content_thumbnail(is_edit ? m->edited_content.get() : m->content.get(), td_);
+    delete_message_content_thumbnail(is_edit ? get_message_edited_content(m) : m->content.get(), td_);
   }
 
   auto dialog_id = full_message_id.get_dialog_id();
@@ -9681,7 +9684,7 @@ void MessagesManager::on_get_messages(vector<tl_object_ptr<telegram_api::Message
 
 bool MessagesManager::delete_newer_server_messages_at_the_end(Dialog *d, MessageId max_message_id) {
   vector<MessageId> message_ids;
-  find_newer_messages(d->messages.get(), max_message_id, message_ids);
+  find_newer_messages(d->messages, max_message_id, message_ids);
   if (message_ids.empty()) {
     return false;
   }
@@ -9705,7 +9708,7 @@ bool MessagesManager::delete_newer_server_messages_at_the_end(Dialog *d, Message
     send_update_delete_messages(d->dialog_id, std::move(deleted_message_ids), true, false);
 
     message_ids.clear();
-    find_newer_messages(d->messages.get(), max_message_id, message_ids);
+    find_newer_messages(d->messages, max_message_id, message_ids);
   }
 
   // connect all messages with ID > max_message_id
@@ -9758,7 +9761,7 @@ void MessagesManager::on_get_history(DialogId dialog_id, MessageId from_message_
       on_dialog_updated(dialog_id, "set have_full_history");
     }
 
-    if (from_the_end && d->have_full_history && d->messages == nullptr) {
+    if (from_the_end && d->have_full_history && d->messages.empty()) {
       if (!d->last_database_message_id.is_valid()) {
         set_dialog_is_empty(d, "on_get_history empty");
       } else {
@@ -10385,7 +10388,7 @@ void MessagesManager::on_get_scheduled_server_messages(DialogId dialog_id, uint3
   }
 
   vector<MessageId> old_message_ids;
-  find_old_messages(d->scheduled_messages.get(),
+  find_old_messages(d->scheduled_messages,
                     MessageId(ScheduledServerMessageId(), std::numeric_limits<int32>::max(), true), old_message_ids);
   std::unordered_map<ScheduledServerMessageId, MessageId, ScheduledServerMessageIdHash> old_server_message_ids;
   for (auto &message_id : old_message_ids) {
@@ -11129,7 +11132,7 @@ void MessagesManager::delete_dialog_history(DialogId dialog_id, bool remove_from
     // TODO get dialog from the server and delete history from last message identifier
   }
 
-  bool allow_error = d->messages == nullptr;
+  bool allow_error = d->messages.empty();
   auto old_order = d->order;
 
   delete_all_dialog_messages(d, remove_from_dialog_list, true);
@@ -11264,72 +11267,48 @@ void MessagesManager::delete_all_call_messages_on_server(bool revoke, uint64 log
                                             get_erase_log_event_promise(log_event_id, std::move(promise)));
 }
 
-void MessagesManager::find_messages(const Message *m, vector<MessageId> &message_ids,
+void MessagesManager::find_messages(const MessagesIndex &messages, vector<MessageId> &message_ids,
                                     const std::function<bool(const Message *)> &condition) {
-  if (m == nullptr) {
-    return;
-  }
-
-  find_messages(m->left.get(), message_ids, condition);
-
-  if (condition(m)) {
-    message_ids.push_back(m->message_id);
+  for (auto &m : messages) {
+    if (condition(m.get())) {
+      message_ids.push_back(m->message_id);
+    }
   }
-
-  find_messages(m->right.get(), message_ids, condition);
 }
 
-void MessagesManager::find_old_messages(const Message *m, MessageId max_message_id, vector<MessageId> &message_ids) {
-  if (m == nullptr) {
-    return;
-  }
-
-  find_old_messages(m->left.get(), max_message_id, message_ids);
-
-  if (m->message_id <= max_message_id) {
-    message_ids.push_back(m->message_id);
-
-    find_old_messages(m->right.get(), max_message_id, message_ids);
+void MessagesManager::find_old_messages(const MessagesIndex &messages, MessageId max_message_id,
+                                        vector<MessageId> &message_ids) {
+  auto end = messages.upper_bound(max_message_id);
+  for (auto it = messages.begin(); it != end; ++it) {
+    message_ids.push_back(it.key());
   }
 }
 
-void MessagesManager::find_newer_messages(const Message *m, MessageId min_message_id, vector<MessageId> &message_ids) {
-  if (m == nullptr) {
-    return;
-  }
-
-  if (m->message_id > min_message_id) {
-    find_newer_messages(m->left.get(), min_message_id, message_ids);
-
-    message_ids.push_back(m->message_id);
+void MessagesManager::find_newer_messages(const MessagesIndex &messages, MessageId min_message_id,
+                                          vector<MessageId> &message_ids) {
+  for (auto it = messages.upper_bound(min_message_id); it != messages.end(); ++it) {
+    message_ids.push_back(it.key());
   }
-
-  find_newer_messages(m->right.get(), min_message_id, message_ids);
 }
 
-void MessagesManager::find_unloadable_messages(const Dialog *d, int32 unload_before_date, const Message *m,
+void MessagesManager::find_unloadable_messages(const Dialog *d, int32 unload_before_date,
                                                vector<MessageId> &message_ids,
                                                bool &has_left_to_unload_messages) const {
-  if (m == nullptr) {
-    return;
-  }
-
-  find_unloadable_messages(d, unload_before_date, m->left.get(), message_ids, has_left_to_unload_messages);
-
-  if (can_unload_message(d, m)) {
-    if (m->last_access_date <= unload_before_date) {
-      message_ids.push_back(m->message_id);
-    } else {
-      has_left_to_unload_messages = true;
+  for (auto &message : d->messages) {
+    const Message *m = message.get();
+    if (can_unload_message(d, m)) {
+      if (m->last_access_date <= unload_before_date) {
+        message_ids.push_back(m->message_id);
+      } else {
+        has_left_to_unload_messages = true;
+      }
     }
-  }
 
-  if (has_left_to_unload_messages && m->date > unload_before_date) {
-    // we aren't interested in unloading too new messages
-    return;
+    if (has_left_to_unload_messages && m->date > unload_before_date) {
+      // we aren't interested in unloading too new messages
+      return;
+    }
   }
-
-  find_unloadable_messages(d, unload_before_date, m->right.get(), message_ids, has_left_to_unload_messages);
 }
 
 void MessagesManager::delete_dialog_messages_by_sender(DialogId dialog_id, DialogId sender_dialog_id,
@@ -11389,7 +11368,7 @@ void MessagesManager::delete_dialog_messages_by_sender(DialogId dialog_id, Dialo
   }
 
   vector<MessageId> message_ids;
-  find_messages(d->messages.get(), message_ids,
+  find_messages(d->messages, message_ids,
                 [sender_dialog_id](const Message *m) { return sender_dialog_id == get_message_sender(m); });
 
   vector<int64> deleted_message_ids;
@@ -11517,7 +11496,7 @@ void MessagesManager::delete_dialog_messages_by_date(DialogId dialog_id, int32 m
   // TODO delete in database by dates
 
   vector<MessageId> message_ids;
-  find_messages_by_date(d->messages.get(), min_date, max_date, message_ids);
+  find_messages_by_date(d->messages, min_date, max_date, message_ids);
 
   bool need_update_dialog_pos = false;
   vector<int64> deleted_message_ids;
@@ -11623,8 +11602,8 @@ void MessagesManager::unload_dialog(DialogId dialog_id) {
 
   vector<MessageId> to_unload_message_ids;
   bool has_left_to_unload_messages = false;
-  find_unloadable_messages(d, G()->unix_time_cached() - get_unload_dialog_delay() + 2, d->messages.get(),
-                           to_unload_message_ids, has_left_to_unload_messages);
+  find_unloadable_messages(d, G()->unix_time_cached() - get_unload_dialog_delay() + 2, to_unload_message_ids,
+                           has_left_to_unload_messages);
 
   vector<int64> unloaded_message_ids;
   for (auto message_id : to_unload_message_ids) {
@@ -11650,6 +11629,128 @@ void MessagesManager::unload_dialog(DialogId dialog_id) {
   }
 }
 
+int32 MessagesManager::get_message_memory_size(const Message *m) {
+  // a rough estimate, which includes the message itself, its content and dynamically allocated strings
+  constexpr size_t MESSAGE_CONTENT_MEMORY_SIZE = 256;
+  size_t size = sizeof(Message) + MESSAGE_CONTENT_MEMORY_SIZE + m->author_signature.size();
+  auto text = get_message_content_text(m->content.get());
+  if (text != nullptr) {
+    size += text->text.size() + text->entities.size() * sizeof(MessageEntity);
+  }
+  return narrow_cast<int32>(size);
+}
+
+void MessagesManager::register_message_memory(Dialog *d, Message *m) {
+  CHECK(m->memory_size == 0);
+  m->memory_size = get_message_memory_size(m);
+  d->message_memory_size += m->memory_size;
+  message_memory_size_ += m->memory_size;
+  loaded_message_count_++;
+
+  if (message_memory_limit_ > 0 && message_memory_size_ > message_memory_limit_ &&
+      !is_message_memory_reduce_scheduled_) {
+    // messages can't be unloaded right now, because the caller can still use them
+    is_message_memory_reduce_scheduled_ = true;
+    send_closure_later(actor_id(this), &MessagesManager::reduce_message_memory);
+  }
+}
+
+void MessagesManager::unregister_message_memory(Dialog *d, Message *m) {
+  d->message_memory_size -= m->memory_size;
+  message_memory_size_ -= m->memory_size;
+  loaded_message_count_--;
+  m->memory_size = 0;  // the message can be added back to the dialog
+  CHECK(d->message_memory_size >= 0);
+  CHECK(message_memory_size_ >= 0);
+  CHECK(loaded_message_count_ >= 0);
+}
+
+void MessagesManager::memory_stats(MemoryStats &stats) const {
+  stats.add_container("dialogs_", dialogs_, sizeof(Dialog));
+  stats.add("messages", static_cast<size_t>(loaded_message_count_), static_cast<size_t>(message_memory_size_));
+  stats.add_container("dialog_lists_", dialog_lists_);
+  stats.add_container("resolved_usernames_", resolved_usernames_);
+  stats.add_container("found_public_dialogs_", found_public_dialogs_);
+  stats.add_container("found_on_server_dialogs_", found_on_server_dialogs_);
+  stats.add_container("found_common_dialogs_", found_common_dialogs_);
+  stats.add_container("active_dialog_actions_", active_dialog_actions_);
+  stats.add_container("postponed_channel_updates_", postponed_channel_updates_);
+}
+
+void MessagesManager::on_message_memory_limit_changed() {
+  message_memory_limit_ = G()->shared_config().get_option_integer("message_memory_limit");
+  if (message_memory_limit_ > 0 && message_memory_size_ > message_memory_limit_ &&
+      !is_message_memory_reduce_scheduled_) {
+    is_message_memory_reduce_scheduled_ = true;
+    send_closure_later(actor_id(this), &MessagesManager::reduce_message_memory);
+  }
+}
+
+void MessagesManager::reduce_message_memory() {
+  is_message_memory_reduce_scheduled_ = false;
+  if (message_memory_limit_ <= 0 || message_memory_size_ <= message_memory_limit_) {
+    return;
+  }
+
+  // unload messages until memory usage drops to 3/4 of the limit,
+  // so the next unload isn't needed right after the next message is loaded
+  reduce_memory_usage(static_cast<size_t>(message_memory_limit_ / 4 * 3));
+}
+
+size_t MessagesManager::get_memory_usage() const {
+  return static_cast<size_t>(message_memory_size_);
+}
+
+void MessagesManager::reduce_memory_usage(size_t target_size) {
+  auto target_memory_size = static_cast<int64>(target_size);
+  if (G()->close_flag() || message_memory_size_ <= target_memory_size || !is_message_unload_enabled()) {
+    return;
+  }
+
+  // unload least recently accessed messages from all chats
+  vector<std::pair<int32, FullMessageId>> unloadable_messages;
+  for (auto &dialog : dialogs_) {
+    const Dialog *d = dialog.second.get();
+    if (d->message_memory_size == 0 || d->is_opened || !d->suffix_load_queries_.empty()) {
+      continue;
+    }
+    for (auto &message : d->messages) {
+      const Message *m = message.get();
+      if (m->memory_size > 0 && can_unload_message(d, m)) {
+        unloadable_messages.emplace_back(m->last_access_date, FullMessageId{d->dialog_id, m->message_id});
+      }
+    }
+  }
+  std::sort(unloadable_messages.begin(), unloadable_messages.end(),
+            [](const auto &lhs, const auto &rhs) { return lhs.first < rhs.first; });
+
+  std::unordered_map<DialogId, vector<int64>, DialogIdHash> unloaded_message_ids;
+  for (auto &unloadable_message : unloadable_messages) {
+    if (message_memory_size_ <= target_memory_size) {
+      break;
+    }
+    auto full_message_id = unloadable_message.second;
+    Dialog *d = get_dialog(full_message_id.get_dialog_id());
+    CHECK(d != nullptr);
+    unload_message(d, full_message_id.get_message_id());
+    unloaded_message_ids[d->dialog_id].push_back(full_message_id.get_message_id().get());
+  }
+  LOG(INFO) << "Unloaded messages from " << unloaded_message_ids.size() << " chats to reduce memory usage to "
+            << message_memory_size_ << " bytes";
+
+  for (auto &it : unloaded_message_ids) {
+    auto dialog_id = it.first;
+    Dialog *d = get_dialog(dialog_id);
+    if (!G()->parameters().use_message_db && !d->is_empty) {
+      d->have_full_history = false;
+    }
+
+    send_closure_later(
+        G()->td(), &Td::send_update,
+        make_tl_object<td_api::updateDeleteMessages>(dialog_id.get(), std::move(it.second), false, true));
+  }
+}
+
 void MessagesManager::delete_all_dialog_messages(Dialog *d, bool remove_from_dialog_list, bool is_permanently_deleted) {
   CHECK(d != nullptr);
   LOG(INFO) << "Delete all messages in " << d->dialog_id
@@ -11696,7 +11797,7 @@ void MessagesManager::delete_all_dialog_messages(Dialog *d, bool remove_from_dia
   }
 
   vector<int64> deleted_message_ids;
-  do_delete_all_dialog_messages(d, d->messages, is_permanently_deleted, deleted_message_ids);
+  do_delete_all_dialog_messages(d, is_permanently_deleted, deleted_message_ids);
   delete_all_dialog_messages_from_database(d, MessageId::max(), "delete_all_dialog_messages 3");
   if (is_permanently_deleted) {
     for (auto id : deleted_message_ids) {
@@ -11792,7 +11893,7 @@ void MessagesManager::read_all_dialog_mentions(DialogId dialog_id, Promise<Unit>
   }
 
   vector<MessageId> message_ids;
-  find_messages(d->messages.get(), message_ids, [](const Message *m) { return m->contains_unread_mention; });
+  find_messages(d->messages, message_ids, [](const Message *m) { return m->contains_unread_mention; });
 
   LOG(INFO) << "Found " << message_ids.size() << " messages with unread mentions in memory";
   bool is_update_sent = false;
@@ -11876,7 +11977,7 @@ void MessagesManager::read_all_dialog_reactions(DialogId dialog_id, Promise<Unit
   }
 
   vector<MessageId> message_ids;
-  find_messages(d->messages.get(), message_ids,
+  find_messages(d->messages, message_ids,
                 [this, dialog_id](const Message *m) { return has_unread_message_reactions(dialog_id, m); });
 
   LOG(INFO) << "Found " << message_ids.size() << " messages with unread reactions in memory";
@@ -12629,7 +12730,7 @@ void MessagesManager::set_dialog_max_unavailable_message_id(DialogId dialog_id,
     d->max_unavailable_message_id = max_unavailable_message_id;
 
     vector<MessageId> message_ids;
-    find_old_messages(d->messages.get(), max_unavailable_message_id, message_ids);
+    find_old_messages(d->messages, max_unavailable_message_id, message_ids);
 
     vector<int64> deleted_message_ids;
     bool need_update_dialog_pos = false;
@@ -13090,6 +13191,7 @@ void MessagesManager::init() {
     disable_get_dialog_filter_ = true;
   }
   authorization_date_ = G()->shared_config().get_option_integer("authorization_date");
+  message_memory_limit_ = G()->shared_config().get_option_integer("message_memory_limit");
 
   if (was_authorized_user) {
     vector<NotificationSettingsScope> scopes{NotificationSettingsScope::Private, NotificationSettingsScope::Group,
@@ -13373,13 +13475,10 @@ void MessagesManager::init() {
       bool have_next;
     };
     vector<MessageBasicInfo> messages_info;
-    std::function<void(Message *m)> get_messages_info = [&](Message *m) {
-      if (m == nullptr) {
-        return;
+    auto get_messages_info = [&](const MessagesIndex &messages) {
+      for (auto &m : messages) {
+        messages_info.push_back(MessageBasicInfo{m->message_id, m->have_previous, m->have_next});
       }
-      get_messages_info(m->left.get());
-      messages_info.push_back(MessageBasicInfo{m->message_id, m->have_previous, m->have_next});
-      get_messages_info(m->right.get());
     };
 
     char buf[1280];
@@ -13465,7 +13564,7 @@ void MessagesManager::init() {
       }
 
       messages_info.clear();
-      get_messages_info(d->messages.get());
+      get_messages_info(d->messages);
 
       for (size_t i = 0; i + 1 < messages_info.size(); i++) {
         if (messages_info[i].have_next != messages_info[i + 1].have_previous) {
@@ -13485,7 +13584,7 @@ void MessagesManager::init() {
     }
 
     messages_info.clear();
-    get_messages_info(d->messages.get());
+    get_messages_info(d->messages);
     for (auto &info : messages_info) {
       bool need_update_dialog_pos = false;
       auto m = delete_message(d, info.message_id, true, &need_update_dialog_pos, "Unknown source");
@@ -14588,7 +14687,7 @@ FullMessageId MessagesManager::on_get_message(MessageInfo &&message_info, bool f
   if (dialog_id.get_type() == DialogType::Channel && !have_input_peer(dialog_id, AccessRights::Read)) {
     auto p = delete_message(d, message_id, false, &need_update_dialog_pos, "get a message in inaccessible chat");
     CHECK(p.get() == m);
-    // CHECK(d->messages == nullptr);
+    // CHECK(d->messages.empty());
     send_update_delete_messages(dialog_id, {p->message_id.get()}, false, false);
     // don't need to update dialog pos
     return FullMessageId();
@@ -14675,7 +14774,7 @@ void MessagesManager::remove_dialog_newer_messages(Dialog *d, MessageId from_mes
   invalidate_message_indexes(d);
 
   vector<MessageId> to_delete_message_ids;
-  find_newer_messages(d->messages.get(), from_message_id, to_delete_message_ids);
+  find_newer_messages(d->messages, from_message_id, to_delete_message_ids);
   td::remove_if(to_delete_message_ids, [](MessageId message_id) { return message_id.is_yet_unsent(); });
   if (!to_delete_message_ids.empty()) {
     LOG(INFO) << "Delete " << format::as_array(to_delete_message_ids) << " newer than " << from_message_id << " in "
@@ -15024,7 +15123,7 @@ void MessagesManager::remove_dialog_mention_notifications(Dialog *d) {
 
   vector<MessageId> message_ids;
   std::unordered_set<NotificationId, NotificationIdHash> removed_notification_ids_set;
-  find_messages(d->messages.get(), message_ids, [](const Message *m) { return m->contains_unread_mention; });
+  find_messages(d->messages, message_ids, [](const Message *m) { return m->contains_unread_mention; });
   VLOG(notifications) << "Found unread mentions in " << message_ids;
   for (auto &message_id : message_ids) {
     auto m = get_message(d, message_id);
@@ -15639,7 +15738,7 @@ bool MessagesManager::can_unload_message(const Dialog *d, const Message *m) cons
   FullMessageId full_message_id{d->dialog_id, m->message_id};
   return !d->is_opened && m->message_id != d->last_message_id && m->message_id != d->last_database_message_id &&
          !m->message_id.is_yet_unsent() && active_live_location_full_message_ids_.count(full_message_id) == 0 &&
-         replied_by_yet_unsent_messages_.count(full_message_id) == 0 && m->edited_content == nullptr &&
+         replied_by_yet_unsent_messages_.count(full_message_id) == 0 && m->edited_message == nullptr &&
          d->suffix_load_queries_.empty() && m->message_id != d->reply_markup_message_id &&
          m->message_id != d->last_pinned_message_id && m->message_id != d->last_edited_message_id;
 }
@@ -15861,8 +15960,8 @@ unique_ptr<MessagesManager::Message> MessagesManager::do_delete_message(Dialog *
   }
 
   FullMessageId full_message_id(d->dialog_id, message_id);
-  unique_ptr<Message> *v = treap_find_message(&d->messages, message_id);
-  if (*v == nullptr) {
+  auto *v = d->messages.find(message_id);
+  if (v == nullptr) {
     LOG(INFO) << message_id << " is not found in " << d->dialog_id << " to be deleted from " << source;
     if (only_from_memory) {
       return nullptr;
@@ -15899,8 +15998,8 @@ unique_ptr<MessagesManager::Message> MessagesManager::do_delete_message(Dialog *
       */
       return nullptr;
     }
-    v = treap_find_message(&d->messages, message_id);
-    CHECK(*v != nullptr);
+    v = d->messages.find(message_id);
+    CHECK(v != nullptr);
   }
 
   const Message *m = v->get();
@@ -16028,7 +16127,7 @@ unique_ptr<MessagesManager::Message> MessagesManager::do_delete_message(Dialog *
       dump_debug_message_op(d);
     }
   }
-  if ((*v)->have_next && (only_from_memory || !(*v)->have_previous)) {
+  if (m->have_next && (only_from_memory || !m->have_previous)) {
     MessagesIterator it(d, message_id);
     CHECK(*it == m);
     ++it;
@@ -16041,7 +16140,9 @@ unique_ptr<MessagesManager::Message> MessagesManager::do_delete_message(Dialog *
     }
   }
 
-  auto result = treap_delete_message(v);
+  auto result = d->messages.erase(message_id);
+  CHECK(result.get() == m);
+  unregister_message_memory(d, result.get());
 
   d->being_deleted_message_id = MessageId();
 
@@ -16124,7 +16225,7 @@ void MessagesManager::on_message_deleted(Dialog *d, Message *m, bool is_permanen
     case DialogType::User:
     case DialogType::Chat:
       if (m->message_id.is_server()) {
-        message_id_to_dialog_id_.erase(m->message_id);
+        message_id_to_dialog_id_.erase(m->message_id.get_server_message_id().get());
       }
       break;
     case DialogType::Channel:
@@ -16153,8 +16254,8 @@ unique_ptr<MessagesManager::Message> MessagesManager::do_delete_scheduled_messag
   CHECK(d != nullptr);
   LOG_CHECK(message_id.is_valid_scheduled()) << d->dialog_id << ' ' << message_id << ' ' << source;
 
-  unique_ptr<Message> *v = treap_find_message(&d->scheduled_messages, message_id);
-  if (*v == nullptr) {
+  auto *v = d->scheduled_messages.find(message_id);
+  if (v == nullptr) {
     LOG(INFO) << message_id << " is not found in " << d->dialog_id << " to be deleted from " << source;
     auto message = get_message_force(d, message_id, "do_delete_scheduled_message");
     if (message == nullptr) {
@@ -16165,8 +16266,8 @@ unique_ptr<MessagesManager::Message> MessagesManager::do_delete_scheduled_messag
     }
 
     message_id = message->message_id;
-    v = treap_find_message(&d->scheduled_messages, message_id);
-    CHECK(*v != nullptr);
+    v = d->scheduled_messages.find(message_id);
+    CHECK(v != nullptr);
   }
 
   const Message *m = v->get();
@@ -16178,7 +16279,8 @@ unique_ptr<MessagesManager::Message> MessagesManager::do_delete_scheduled_messag
 
   remove_message_file_sources(d->dialog_id, m);
 
-  auto result = treap_delete_message(v);
+  auto result = d->scheduled_messages.erase(message_id);
+  CHECK(result.get() == m);
 
   if (message_id.is_scheduled_server()) {
     size_t erased_count = d->scheduled_message_date.erase(message_id.get_scheduled_server_message_id());
@@ -16193,31 +16295,31 @@ unique_ptr<MessagesManager::Message> MessagesManager::do_delete_scheduled_messag
   return result;
 }
 
-void MessagesManager::do_delete_all_dialog_messages(Dialog *d, unique_ptr<Message> &message,
-                                                    bool is_permanently_deleted, vector<int64> &deleted_message_ids) {
-  if (message == nullptr) {
-    return;
-  }
-  const Message *m = message.get();
-  MessageId message_id = m->message_id;
-
-  if (is_debug_message_op_enabled()) {
-    d->debug_message_op.emplace_back(Dialog::MessageOp::Delete, m->message_id, m->content->get_type(), false,
-                                     m->have_previous, m->have_next, "delete all messages");
-  }
+void MessagesManager::do_delete_all_dialog_messages(Dialog *d, bool is_permanently_deleted,
+                                                    vector<int64> &deleted_message_ids) {
+  // delete messages starting from the newest, because erasure from the end of the index is the cheapest
+  while (!d->messages.empty()) {
+    auto it = d->messages.end();
+    --it;
+    Message *m = get_message(d, it.key());
+    MessageId message_id = m->message_id;
 
-  LOG(INFO) << "Delete " << message_id;
-  deleted_message_ids.push_back(message_id.get());
+    if (is_debug_message_op_enabled()) {
+      d->debug_message_op.emplace_back(Dialog::MessageOp::Delete, m->message_id, m->content->get_type(), false,
+                                       m->have_previous, m->have_next, "delete all messages");
+    }
 
-  do_delete_all_dialog_messages(d, message->right, is_permanently_deleted, deleted_message_ids);
-  do_delete_all_dialog_messages(d, message->left, is_permanently_deleted, deleted_message_ids);
+    LOG(INFO) << "Delete " << message_id;
+    deleted_message_ids.push_back(message_id.get());
 
-  delete_active_live_location(d->dialog_id, m);
-  remove_message_file_sources(d->dialog_id, m);
+    delete_active_live_location(d->dialog_id, m);
+    remove_message_file_sources(d->dialog_id, m);
 
-  on_message_deleted(d, message.get(), is_permanently_deleted, "do_delete_all_dialog_messages");
+    on_message_deleted(d, m, is_permanently_deleted, "do_delete_all_dialog_messages");
 
-  message = nullptr;
+    unregister_message_memory(d, m);
+    d->messages.erase(message_id);
+  }
 }
 
 bool MessagesManager::have_dialog(DialogId dialog_id) const {
@@ -16551,7 +16653,7 @@ vector<DialogId> MessagesManager::get_dialogs(DialogListId dialog_list_id, Dialo
   update_list_last_pinned_dialog_date(list);
 
   vector<const DialogFolder *> folders;
-  vector<std::set<DialogDate>::const_iterator> folder_iterators;
+  vector<ChunkedSortedSet<DialogDate>::Iterator> folder_iterators;
   for (auto folder_id : get_dialog_list_folder_ids(list)) {
     folders.push_back(get_dialog_folder(folder_id));
     folder_iterators.push_back(folders.back()->ordered_dialogs_.upper_bound(offset));
@@ -16915,6 +17017,52 @@ void MessagesManager::on_get_dialogs_from_list(int64 task_id, Result<Unit> &&res
   get_dialogs_from_list_impl(task_id);
 }
 
+void MessagesManager::get_chat_list_snapshot(DialogListId dialog_list_id, int32 limit,
+                                             Promise<td_api::object_ptr<td_api::chatListSnapshot>> &&promise) {
+  auto query_promise = PromiseCreator::lambda([actor_id = actor_id(this), dialog_list_id, promise = std::move(promise)](
+                                                  Result<td_api::object_ptr<td_api::chats>> result) mutable {
+    if (result.is_error()) {
+      return promise.set_error(result.move_as_error());
+    }
+    send_closure(actor_id, &MessagesManager::on_get_chat_list_snapshot, dialog_list_id, result.move_as_ok(),
+                 std::move(promise));
+  });
+  get_dialogs_from_list(dialog_list_id, limit, std::move(query_promise));
+}
+
+void MessagesManager::on_get_chat_list_snapshot(DialogListId dialog_list_id, td_api::object_ptr<td_api::chats> &&chats,
+                                                Promise<td_api::object_ptr<td_api::chatListSnapshot>> &&promise) {
+  TRY_STATUS_PROMISE(promise, G()->close_status());
+
+  const auto *list = get_dialog_list(dialog_list_id);
+  if (list == nullptr) {
+    return promise.set_error(Status::Error(400, "Chat list not found"));
+  }
+
+  // positions are taken at the time of the response, so the snapshot is consistent with already sent updates
+  auto snapshot = td_api::make_object<td_api::chatListSnapshot>();
+  snapshot->total_count_ = chats->total_count_;
+  for (auto chat_id : chats->chat_ids_) {
+    const Dialog *d = get_dialog(DialogId(chat_id));
+    if (d == nullptr) {
+      continue;
+    }
+    auto position = get_dialog_position_in_list(list, d);
+    if (position.public_order == 0) {
+      continue;
+    }
+    snapshot->chat_ids_.push_back(chat_id);
+    snapshot->orders_.push_back(position.public_order);
+    snapshot->unread_counts_.push_back(d->server_unread_count + d->local_unread_count);
+    snapshot->unread_mention_counts_.push_back(d->unread_mention_count);
+    snapshot->last_message_ids_.push_back(d->last_message_id.get());
+    if (position.is_pinned) {
+      snapshot->pinned_chat_ids_.push_back(chat_id);
+    }
+  }
+  promise.set_value(std::move(snapshot));
+}
+
 vector<DialogId> MessagesManager::get_pinned_dialog_ids(DialogListId dialog_list_id) const {
   CHECK(!td_->auth_manager_->is_bot());
   if (dialog_list_id.is_filter()) {
@@ -17566,7 +17714,7 @@ void MessagesManager::block_message_sender_from_replies(MessageId message_id, bo
   }
   if (need_delete_all_messages && sender_user_id.is_valid()) {
     vector<MessageId> message_ids;
-    find_messages(d->messages.get(), message_ids, [sender_user_id](const Message *m) {
+    find_messages(d->messages, message_ids, [sender_user_id](const Message *m) {
       return !m->is_outgoing && m->forward_info != nullptr && m->forward_info->sender_user_id == sender_user_id;
     });
 
@@ -18328,7 +18476,39 @@ bool MessagesManager::get_messages(DialogId dialog_id, const vector<MessageId> &
 void MessagesManager::get_message_from_server(FullMessageId full_message_id, Promise<Unit> &&promise,
                                               const char *source,
                                               tl_object_ptr<telegram_api::InputMessage> input_message) {
-  get_messages_from_server({full_message_id}, std::move(promise), source, std::move(input_message));
+  if (input_message != nullptr) {
+    return get_messages_from_server({full_message_id}, std::move(promise), source, std::move(input_message));
+  }
+
+  auto &promises = get_message_from_server_queries_[full_message_id];
+  promises.push_back(std::move(promise));
+  if (promises.size() != 1) {
+    // query has already been sent, just wait for the result
+    return;
+  }
+
+  get_messages_from_server({full_message_id},
+                           PromiseCreator::lambda([actor_id = actor_id(this), full_message_id](Result<Unit> &&result) {
+                             send_closure(actor_id, &MessagesManager::on_get_message_from_server, full_message_id,
+                                          std::move(result));
+                           }),
+                           source);
+}
+
+void MessagesManager::on_get_message_from_server(FullMessageId full_message_id, Result<Unit> &&result) {
+  auto it = get_message_from_server_queries_.find(full_message_id);
+  CHECK(it != get_message_from_server_queries_.end());
+  CHECK(!it->second.empty());
+  auto promises = std::move(it->second);
+  get_message_from_server_queries_.erase(it);
+
+  for (auto &promise : promises) {
+    if (result.is_ok()) {
+      promise.set_value(Unit());
+    } else {
+      promise.set_error(result.error().clone());
+    }
+  }
 }
 
 void MessagesManager::get_messages_from_server(vector<FullMessageId> &&message_ids, Promise<Unit> &&promise,
@@ -20711,15 +20891,16 @@ void MessagesManager::open_dialog(Dialog *d) {
   d->is_opened = true;
   d->was_opened = true;
 
+  if (dialog_id.get_type() == DialogType::Channel) {
+    run_pending_get_channel_difference_query(dialog_id);
+  }
+
   auto min_message_id = MessageId(ServerMessageId(1));
-  if (d->last_message_id == MessageId() && d->last_read_outbox_message_id < min_message_id && d->messages != nullptr &&
-      d->messages->message_id < min_message_id) {
-    Message *m = d->messages.get();
-    while (m->right != nullptr) {
-      m = m->right.get();
-    }
-    if (m->message_id < min_message_id) {
-      read_history_inbox(dialog_id, m->message_id, -1, "open_dialog");
+  if (d->last_message_id == MessageId() && d->last_read_outbox_message_id < min_message_id && !d->messages.empty()) {
+    auto it = d->messages.end();
+    --it;
+    if (it.key() < min_message_id) {
+      read_history_inbox(dialog_id, it.key(), -1, "open_dialog");
     }
   }
 
@@ -21460,13 +21641,10 @@ tl_object_ptr<td_api::messages> MessagesManager::get_dialog_history(DialogId dia
     bool have_a_gap = false;
     if (*p == nullptr) {
       // there is no gap if from_message_id is less than first message in the dialog
-      if (left_tries == 0 && d->messages != nullptr && offset < 0) {
-        const Message *cur = d->messages.get();
-        while (cur->left != nullptr) {
-          cur = cur->left.get();
-        }
-        CHECK(cur->message_id > from_message_id);
-        from_message_id = cur->message_id;
+      if (left_tries == 0 && !d->messages.empty() && offset < 0) {
+        auto first_message_id = d->messages.begin().key();
+        CHECK(first_message_id > from_message_id);
+        from_message_id = first_message_id;
         p = MessagesConstIterator(d, from_message_id);
       } else {
         have_a_gap = true;
@@ -23114,7 +23292,7 @@ int64 MessagesManager::get_dialog_message_by_date(DialogId dialog_id, int32 date
            get_dialog_message_by_date_results_.find(random_id) != get_dialog_message_by_date_results_.end());
   get_dialog_message_by_date_results_[random_id];  // reserve place for result
 
-  auto message_id = find_message_by_date(d->messages.get(), date);
+  auto message_id = find_message_by_date(d->messages, date);
   if (message_id.is_valid() && (message_id == d->last_message_id || get_message(d, message_id)->have_next)) {
     get_dialog_message_by_date_results_[random_id] = {dialog_id, message_id};
     promise.set_value(Unit());
@@ -23181,37 +23359,21 @@ void MessagesManager::on_get_affected_history(DialogId dialog_id, AffectedHistor
   }
 }
 
-MessageId MessagesManager::find_message_by_date(const Message *m, int32 date) {
-  if (m == nullptr) {
+MessageId MessagesManager::find_message_by_date(const MessagesIndex &messages, int32 date) {
+  // message dates are expected to be non-decreasing with message identifiers
+  auto it = messages.partition_point([date](const unique_ptr<Message> &m) { return m->date <= date; });
+  --it;
+  if (it.is_end()) {
     return MessageId();
   }
-
-  if (m->date > date) {
-    return find_message_by_date(m->left.get(), date);
-  }
-
-  auto message_id = find_message_by_date(m->right.get(), date);
-  if (message_id.is_valid()) {
-    return message_id;
-  }
-
-  return m->message_id;
+  return it.key();
 }
 
-void MessagesManager::find_messages_by_date(const Message *m, int32 min_date, int32 max_date,
+void MessagesManager::find_messages_by_date(const MessagesIndex &messages, int32 min_date, int32 max_date,
                                             vector<MessageId> &message_ids) {
-  if (m == nullptr) {
-    return;
-  }
-
-  if (m->date >= min_date) {
-    find_messages_by_date(m->left.get(), min_date, max_date, message_ids);
-    if (m->date <= max_date) {
-      message_ids.push_back(m->message_id);
-    }
-  }
-  if (m->date <= max_date) {
-    find_messages_by_date(m->right.get(), min_date, max_date, message_ids);
+  for (auto it = messages.partition_point([min_date](const unique_ptr<Message> &m) { return m->date < min_date; });
+       it != messages.end() && (*it)->date <= max_date; ++it) {
+    message_ids.push_back(it.key());
   }
 }
 
@@ -23225,7 +23387,7 @@ void MessagesManager::on_get_dialog_message_by_date_from_database(DialogId dialo
   if (result.is_ok()) {
     Message *m = on_get_message_from_database(d, result.ok(), false, "on_get_dialog_message_by_date_from_database");
     if (m != nullptr) {
-      auto message_id = find_message_by_date(d->messages.get(), date);
+      auto message_id = find_message_by_date(d->messages, date);
       if (!message_id.is_valid()) {
         LOG(ERROR) << "Failed to find " << m->message_id << " in " << dialog_id << " by date " << date;
         message_id = m->message_id;
@@ -23249,7 +23411,7 @@ void MessagesManager::get_dialog_message_by_date_from_server(const Dialog *d, in
       return promise.set_value(Unit());
     }
 
-    auto message_id = find_message_by_date(d->messages.get(), date);
+    auto message_id = find_message_by_date(d->messages, date);
     if (message_id.is_valid()) {
       get_dialog_message_by_date_results_[random_id] = {d->dialog_id, message_id};
     }
@@ -23287,7 +23449,7 @@ void MessagesManager::on_get_dialog_message_by_date_success(DialogId dialog_id,
       if (result != FullMessageId()) {
         const Dialog *d = get_dialog(dialog_id);
         CHECK(d != nullptr);
-        auto message_id = find_message_by_date(d->messages.get(), date);
+        auto message_id = find_message_by_date(d->messages, date);
         if (!message_id.is_valid()) {
           LOG(ERROR) << "Failed to find " << result.get_message_id() << " in " << dialog_id << " by date " << date;
           message_id = result.get_message_id();
@@ -23445,7 +23607,7 @@ void MessagesManager::get_dialog_message_count(DialogId dialog_id, MessageSearch
 void MessagesManager::preload_newer_messages(const Dialog *d, MessageId max_message_id) {
   CHECK(d != nullptr);
   CHECK(max_message_id.is_valid());
-  if (td_->auth_manager_->is_bot()) {
+  if (td_->auth_manager_->is_bot() || G()->shared_config().get_option_boolean("disable_history_preload")) {
     return;
   }
 
@@ -23467,7 +23629,7 @@ void MessagesManager::preload_newer_messages(const Dialog *d, MessageId max_mess
 void MessagesManager::preload_older_messages(const Dialog *d, MessageId min_message_id) {
   CHECK(d != nullptr);
   CHECK(min_message_id.is_valid());
-  if (td_->auth_manager_->is_bot()) {
+  if (td_->auth_manager_->is_bot() || G()->shared_config().get_option_boolean("disable_history_preload")) {
     return;
   }
 
@@ -23569,7 +23731,7 @@ void MessagesManager::on_get_history_from_database(DialogId dialog_id, MessageId
     return;
   }
 
-  if (messages.empty() && from_the_end && d->messages == nullptr) {
+  if (messages.empty() && from_the_end && d->messages.empty()) {
     if (d->have_full_history) {
       set_dialog_is_empty(d, "on_get_history_from_database empty");
     } else if (d->last_database_message_id.is_valid()) {
@@ -23866,6 +24028,11 @@ void MessagesManager::get_history_impl(const Dialog *d, MessageId from_message_i
       return promise.set_value(Unit());
     }
 
+    if (!promise) {
+      // noone waits for the result, so this is a preload, which can be delayed
+      return preload_history_from_server(d, from_message_id, offset, limit);
+    }
+
     LOG(INFO) << "Get history in " << dialog_id << " from " << from_message_id << " with offset " << offset
               << " and limit " << limit << " from server";
     td_->create_handler<GetHistoryQuery>(std::move(promise))
@@ -23873,6 +24040,64 @@ void MessagesManager::get_history_impl(const Dialog *d, MessageId from_message_i
   }
 }
 
+void MessagesManager::preload_history_from_server(const Dialog *d, MessageId from_message_id, int32 offset,
+                                                  int32 limit) {
+  // newer messages are preloaded with offset less than -1, see load_messages_impl
+  bool is_newer = offset < -1;
+  auto query_id = d->dialog_id.get() * 2 + (is_newer ? 1 : 0);
+  LOG(INFO) << "Schedule preload of " << (is_newer ? "newer" : "older") << " history in " << d->dialog_id << " from "
+            << from_message_id;
+
+  // only the last scheduled preload will be sent; the previous ones are stale
+  auto &query = pending_preload_history_queries_[query_id];
+  query.dialog_id = d->dialog_id;
+  query.from_message_id = from_message_id;
+  query.offset = offset;
+  query.limit = limit;
+
+  auto send_query = PromiseCreator::lambda([actor_id = actor_id(this), query_id](Result<Promise<Unit>> &&promise) {
+    if (promise.is_ok()) {
+      send_closure(actor_id, &MessagesManager::send_preload_history_query, query_id, promise.move_as_ok());
+    }
+  });
+  preload_history_queries_.add_query(query_id, std::move(send_query), Promise<Unit>());
+}
+
+void MessagesManager::send_preload_history_query(int64 query_id, Promise<Unit> &&promise) {
+  TRY_STATUS_PROMISE(promise, G()->close_status());
+
+  auto it = pending_preload_history_queries_.find(query_id);
+  if (it == pending_preload_history_queries_.end()) {
+    return promise.set_value(Unit());
+  }
+  auto query = it->second;
+  pending_preload_history_queries_.erase(it);
+
+  const Dialog *d = get_dialog(query.dialog_id);
+  CHECK(d != nullptr);
+  bool is_newer = query.offset < -1;
+  const Message *m = get_message(d, query.from_message_id);
+  bool is_stale = m == nullptr || !have_input_peer(d->dialog_id, AccessRights::Read);
+  if (!is_stale) {
+    if (is_newer) {
+      is_stale = m->have_next || (d->last_message_id.is_valid() && query.from_message_id >= d->last_message_id);
+    } else {
+      is_stale = m->have_previous || d->have_full_history;
+    }
+  }
+  if (is_stale) {
+    // the messages were loaded in some other way or aren't needed anymore
+    LOG(INFO) << "Skip stale preload of history in " << d->dialog_id << " from " << query.from_message_id;
+    return promise.set_value(Unit());
+  }
+
+  LOG(INFO) << "Preload history in " << d->dialog_id << " from " << query.from_message_id << " with offset "
+            << query.offset << " and limit " << query.limit << " from server";
+  td_->create_handler<GetHistoryQuery>(std::move(promise))
+      ->send(d->dialog_id, query.from_message_id.get_next_server_message_id(), d->last_new_message_id, query.offset,
+             query.limit);
+}
+
 void MessagesManager::load_messages(DialogId dialog_id, MessageId from_message_id, int32 offset, int32 limit,
                                     int left_tries, bool only_local, Promise<Unit> &&promise) {
   load_messages_impl(get_dialog(dialog_id), from_message_id, offset, limit, left_tries, only_local, std::move(promise));
@@ -23944,7 +24169,7 @@ vector<MessageId> MessagesManager::get_dialog_scheduled_messages(DialogId dialog
   }
 
   vector<MessageId> message_ids;
-  find_old_messages(d->scheduled_messages.get(),
+  find_old_messages(d->scheduled_messages,
                     MessageId(ScheduledServerMessageId(), std::numeric_limits<int32>::max(), true), message_ids);
   std::reverse(message_ids.begin(), message_ids.end());
 
@@ -24818,7 +25043,7 @@ void MessagesManager::cancel_send_message_query(DialogId dialog_id, Message *m)
 
   cancel_upload_message_content_files(m->content.get());
 
-  CHECK(m->edited_content == nullptr);
+  CHECK(m->edited_message == nullptr);
 
   if (!m->send_query_ref.empty()) {
     LOG(INFO) << "Cancel send query for " << m->message_id;
@@ -25117,14 +25342,22 @@ Result<td_api::object_ptr<td_api::message>> MessagesManager::send_message(
   TRY_STATUS(can_use_message_send_options(message_send_options, message_content));
   TRY_STATUS(can_use_top_thread_message_id(d, top_thread_message_id, reply_to_message_id));
 
+  return send_processed_message(d, top_thread_message_id, reply_to_message_id, message_send_options, message_content,
+                                std::move(message_reply_markup));
+}
+
+td_api::object_ptr<td_api::message> MessagesManager::send_processed_message(
+    Dialog *d, MessageId top_thread_message_id, MessageId reply_to_message_id, const MessageSendOptions &options,
+    const InputMessageContent &message_content, unique_ptr<ReplyMarkup> &&reply_markup) {
   // there must be no errors after get_message_to_send call
 
+  auto dialog_id = d->dialog_id;
   bool need_update_dialog_pos = false;
-  Message *m = get_message_to_send(d, top_thread_message_id, reply_to_message_id, message_send_options,
+  Message *m = get_message_to_send(d, top_thread_message_id, reply_to_message_id, options,
                                    dup_message_content(td_, dialog_id, message_content.content.get(),
                                                        MessageContentDupType::Send, MessageCopyOptions()),
                                    &need_update_dialog_pos, false, nullptr, message_content.via_bot_user_id.is_valid());
-  m->reply_markup = std::move(message_reply_markup);
+  m->reply_markup = std::move(reply_markup);
   m->via_bot_user_id = message_content.via_bot_user_id;
   m->disable_web_page_preview = message_content.disable_web_page_preview;
   m->clear_draft = message_content.clear_draft;
@@ -25132,7 +25365,7 @@ Result<td_api::object_ptr<td_api::message>> MessagesManager::send_message(
     m->ttl = message_content.ttl;
     m->is_content_secret = is_secret_message_content(m->ttl, m->content->get_type());
   }
-  m->send_emoji = std::move(message_content.emoji);
+  m->send_emoji = message_content.emoji;
 
   if (message_content.clear_draft) {
     if (top_thread_message_id.is_valid()) {
@@ -25153,6 +25386,50 @@ Result<td_api::object_ptr<td_api::message>> MessagesManager::send_message(
   return get_message_object(dialog_id, m, "send_message");
 }
 
+Result<td_api::object_ptr<td_api::messageBroadcastResults>> MessagesManager::send_message_broadcast(
+    vector<DialogId> dialog_ids, tl_object_ptr<td_api::messageSendOptions> &&options,
+    tl_object_ptr<td_api::InputMessageContent> &&input_message_content) {
+  if (dialog_ids.empty()) {
+    return Status::Error(400, "Chats to send the message to must be specified");
+  }
+
+  // the content and the options are processed once, only chat-specific checks are done for every chat
+  TRY_RESULT(message_content, process_input_message_content(DialogId(), std::move(input_message_content)));
+  TRY_RESULT(message_send_options, get_message_send_options(std::move(options)));
+  TRY_STATUS(can_use_message_send_options(message_send_options, message_content));
+
+  LOG(INFO) << "Begin to send message to " << dialog_ids.size() << " chats";
+
+  auto results = transform(dialog_ids, [&](DialogId dialog_id) {
+    auto r_message = send_broadcast_message(dialog_id, message_send_options, message_content);
+    if (r_message.is_error()) {
+      auto error = r_message.move_as_error();
+      return td_api::make_object<td_api::messageBroadcastResult>(
+          dialog_id.get(), nullptr, td_api::make_object<td_api::error>(error.code(), error.message().str()));
+    }
+    return td_api::make_object<td_api::messageBroadcastResult>(dialog_id.get(), r_message.move_as_ok(), nullptr);
+  });
+  return td_api::make_object<td_api::messageBroadcastResults>(std::move(results));
+}
+
+Result<td_api::object_ptr<td_api::message>> MessagesManager::send_broadcast_message(
+    DialogId dialog_id, const MessageSendOptions &options, const InputMessageContent &message_content) {
+  Dialog *d = get_dialog_force(dialog_id, "send_broadcast_message");
+  if (d == nullptr) {
+    return Status::Error(400, "Chat not found");
+  }
+
+  TRY_STATUS(can_send_message(dialog_id));
+  if (message_content.ttl > 0 && dialog_id.get_type() != DialogType::User) {
+    return Status::Error(400, "Message content TTL can be specified only in private chats");
+  }
+  TRY_STATUS(can_send_message_content(dialog_id, message_content.content.get(), false, td_));
+  auto message_send_options = options;
+  TRY_STATUS(check_message_send_options(dialog_id, message_send_options));
+
+  return send_processed_message(d, MessageId(), MessageId(), message_send_options, message_content, nullptr);
+}
+
 Result<InputMessageContent> MessagesManager::process_input_message_content(
     DialogId dialog_id, tl_object_ptr<td_api::InputMessageContent> &&input_message_content) {
   if (input_message_content == nullptr) {
@@ -25235,6 +25512,13 @@ Result<MessageCopyOptions> MessagesManager::process_message_copy_options(
 
 Result<MessagesManager::MessageSendOptions> MessagesManager::process_message_send_options(
     DialogId dialog_id, tl_object_ptr<td_api::messageSendOptions> &&options) const {
+  TRY_RESULT(result, get_message_send_options(std::move(options)));
+  TRY_STATUS(check_message_send_options(dialog_id, result));
+  return result;
+}
+
+Result<MessagesManager::MessageSendOptions> MessagesManager::get_message_send_options(
+    tl_object_ptr<td_api::messageSendOptions> &&options) {
   MessageSendOptions result;
   if (options != nullptr) {
     result.disable_notification = options->disable_notification_;
@@ -25242,9 +25526,12 @@ Result<MessagesManager::MessageSendOptions> MessagesManager::process_message_sen
     result.protect_content = options->protect_content_;
     TRY_RESULT_ASSIGN(result.schedule_date, get_message_schedule_date(std::move(options->scheduling_state_)));
   }
+  return result;
+}
 
+Status MessagesManager::check_message_send_options(DialogId dialog_id, MessageSendOptions &options) const {
   auto dialog_type = dialog_id.get_type();
-  if (result.schedule_date != 0) {
+  if (options.schedule_date != 0) {
     if (dialog_type == DialogType::SecretChat) {
       return Status::Error(400, "Can't schedule messages in secret chats");
     }
@@ -25252,7 +25539,7 @@ Result<MessagesManager::MessageSendOptions> MessagesManager::process_message_sen
       return Status::Error(400, "Bots can't send scheduled messages");
     }
   }
-  if (result.schedule_date == SCHEDULE_WHEN_ONLINE_DATE) {
+  if (options.schedule_date == SCHEDULE_WHEN_ONLINE_DATE) {
     if (dialog_type != DialogType::User) {
       return Status::Error(400, "Messages can be scheduled till online only in private chats");
     }
@@ -25261,11 +25548,11 @@ Result<MessagesManager::MessageSendOptions> MessagesManager::process_message_sen
     }
   }
 
-  if (result.protect_content && !td_->auth_manager_->is_bot()) {
-    result.protect_content = false;
+  if (options.protect_content && !td_->auth_manager_->is_bot()) {
+    options.protect_content = false;
   }
 
-  return result;
+  return Status::OK();
 }
 
 Status MessagesManager::can_use_message_send_options(const MessageSendOptions &options,
@@ -25432,7 +25719,7 @@ void MessagesManager::do_send_message(DialogId dialog_id, const Message *m, vect
     request.results.push_back(Status::OK());
   }
 
-  auto content = is_edit ? m->edited_content.get() : m->content.get();
+  auto content = is_edit ? get_message_edited_content(m) : m->content.get();
   CHECK(content != nullptr);
   auto content_type = content->get_type();
   if (content_type == MessageContentType::Text) {
@@ -25493,8 +25780,9 @@ void MessagesManager::on_message_media_uploaded(DialogId dialog_id, const Messag
 
   auto message_id = m->message_id;
   if (message_id.is_any_server()) {
-    const FormattedText *caption = get_message_content_caption(m->edited_content.get());
-    auto input_reply_markup = get_input_reply_markup(m->edited_reply_markup);
+    CHECK(m->edited_message != nullptr);
+    const FormattedText *caption = get_message_content_caption(m->edited_message->content.get());
+    auto input_reply_markup = get_input_reply_markup(m->edited_message->reply_markup);
     bool was_uploaded = FileManager::extract_was_uploaded(input_media);
     bool was_thumbnail_uploaded = FileManager::extract_was_thumbnail_uploaded(input_media);
 
@@ -25502,7 +25790,7 @@ void MessagesManager::on_message_media_uploaded(DialogId dialog_id, const Messag
     auto schedule_date = get_message_schedule_date(m);
     auto promise = PromiseCreator::lambda(
         [actor_id = actor_id(this), dialog_id, message_id, file_id, thumbnail_file_id, schedule_date,
-         generation = m->edit_generation, was_uploaded, was_thumbnail_uploaded,
+         generation = m->edited_message->generation, was_uploaded, was_thumbnail_uploaded,
          file_reference = FileManager::extract_file_reference(input_media)](Result<int32> result) mutable {
           send_closure(actor_id, &MessagesManager::on_message_media_edited, dialog_id, message_id, file_id,
                        thumbnail_file_id, was_uploaded, was_thumbnail_uploaded, std::move(file_reference),
@@ -26531,7 +26819,7 @@ bool MessagesManager::is_deleted_secret_chat(const Dialog *d) const {
     return false;
   }
 
-  if (d->order != DEFAULT_ORDER || d->messages != nullptr) {
+  if (d->order != DEFAULT_ORDER || !d->messages.empty()) {
     return false;
   }
 
@@ -26698,17 +26986,29 @@ void MessagesManager::edit_message_live_location(FullMessageId full_message_id,
                get_sequence_dispatcher_id(dialog_id, MessageContentType::None));
 }
 
+MessageContent *MessagesManager::get_message_edited_content(Message *m) {
+  if (m->edited_message == nullptr) {
+    return nullptr;
+  }
+  return m->edited_message->content.get();
+}
+
+const MessageContent *MessagesManager::get_message_edited_content(const Message *m) {
+  if (m->edited_message == nullptr) {
+    return nullptr;
+  }
+  return m->edited_message->content.get();
+}
+
 void MessagesManager::cancel_edit_message_media(DialogId dialog_id, Message *m, Slice error_message) {
-  if (m->edited_content == nullptr) {
+  if (m->edited_message == nullptr) {
     return;
   }
 
-  cancel_upload_message_content_files(m->edited_content.get());
+  cancel_upload_message_content_files(m->edited_message->content.get());
 
-  m->edited_content = nullptr;
-  m->edited_reply_markup = nullptr;
-  m->edit_generation = 0;
-  m->edit_promise.set_error(Status::Error(400, error_message));
+  auto edited_message = std::move(m->edited_message);
+  edited_message->promise.set_error(Status::Error(400, error_message));
 }
 
 void MessagesManager::on_message_media_edited(DialogId dialog_id, MessageId message_id, FileId file_id,
@@ -26719,12 +27019,12 @@ void MessagesManager::on_message_media_edited(DialogId dialog_id, MessageId mess
 
   CHECK(message_id.is_any_server());
   auto m = get_message({dialog_id, message_id});
-  if (m == nullptr || m->edit_generation != generation) {
+  if (m == nullptr || m->edited_message == nullptr || m->edited_message->generation != generation) {
     // message is already deleted or was edited again
     return;
   }
 
-  CHECK(m->edited_content != nullptr);
+  CHECK(m->edited_message->content != nullptr);
   if (result.is_ok()) {
     // message content has already been replaced from updateEdit{Channel,}Message
     // need only merge files from edited_content with their uploaded counterparts
@@ -26733,11 +27033,11 @@ void MessagesManager::on_message_media_edited(DialogId dialog_id, MessageId mess
     auto pts = result.ok();
     LOG(INFO) << "Successfully edited " << message_id << " in " << dialog_id << " with pts = " << pts
               << " and last edit pts = " << m->last_edit_pts;
-    std::swap(m->content, m->edited_content);
-    bool need_send_update_message_content = m->edited_content->get_type() == MessageContentType::Photo &&
+    std::swap(m->content, m->edited_message->content);
+    bool need_send_update_message_content = m->edited_message->content->get_type() == MessageContentType::Photo &&
                                             m->content->get_type() == MessageContentType::Photo;
     bool need_merge_files = pts != 0 && pts == m->last_edit_pts;
-    update_message_content(dialog_id, m, std::move(m->edited_content), need_send_update_message_content,
+    update_message_content(dialog_id, m, std::move(m->edited_message->content), need_send_update_message_content,
                            need_merge_files, true);
   } else {
     LOG(INFO) << "Failed to edit " << message_id << " in " << dialog_id << ": " << result.error();
@@ -26768,7 +27068,7 @@ void MessagesManager::on_message_media_edited(DialogId dialog_id, MessageId mess
       }
     }
 
-    cancel_upload_message_content_files(m->edited_content.get());
+    cancel_upload_message_content_files(m->edited_message->content.get());
 
     if (dialog_id.get_type() != DialogType::SecretChat) {
       get_message_from_server({dialog_id, m->message_id}, Auto(), "on_message_media_edited");
@@ -26778,13 +27078,11 @@ void MessagesManager::on_message_media_edited(DialogId dialog_id, MessageId mess
   if (m->edited_schedule_date == schedule_date) {
     m->edited_schedule_date = 0;
   }
-  m->edited_content = nullptr;
-  m->edited_reply_markup = nullptr;
-  m->edit_generation = 0;
+  auto edited_message = std::move(m->edited_message);
   if (result.is_ok()) {
-    m->edit_promise.set_value(Unit());
+    edited_message->promise.set_value(Unit());
   } else {
-    m->edit_promise.set_error(result.move_as_error());
+    edited_message->promise.set_error(result.move_as_error());
   }
 }
 
@@ -26866,12 +27164,14 @@ void MessagesManager::edit_message_media(FullMessageId full_message_id,
 
   cancel_edit_message_media(dialog_id, m, "Canceled by new editMessageMedia request");
 
-  m->edited_content =
+  CHECK(m->edited_message == nullptr);
+  m->edited_message = make_unique<EditedMessage>();
+  m->edited_message->content =
       dup_message_content(td_, dialog_id, content.content.get(), MessageContentDupType::Send, MessageCopyOptions());
-  CHECK(m->edited_content != nullptr);
-  m->edited_reply_markup = r_new_reply_markup.move_as_ok();
-  m->edit_generation = ++current_message_edit_generation_;
-  m->edit_promise = std::move(promise);
+  CHECK(m->edited_message->content != nullptr);
+  m->edited_message->reply_markup = r_new_reply_markup.move_as_ok();
+  m->edited_message->generation = ++current_message_edit_generation_;
+  m->edited_message->promise = std::move(promise);
 
   do_send_message(dialog_id, m);
 }
@@ -30103,7 +30403,7 @@ void MessagesManager::send_update_delete_messages(DialogId dialog_id, vector<int
 
 void MessagesManager::send_update_new_chat(Dialog *d) {
   CHECK(d != nullptr);
-  CHECK(d->messages == nullptr);
+  CHECK(d->messages.empty());
   auto chat_object = get_chat_object(d);
   bool has_action_bar = chat_object->action_bar_ != nullptr;
   bool has_theme = !chat_object->theme_name_.empty();
@@ -30503,7 +30803,7 @@ void MessagesManager::send_update_chat_has_scheduled_messages(Dialog *d, bool fr
     return;
   }
 
-  if (d->scheduled_messages == nullptr) {
+  if (d->scheduled_messages.empty()) {
     if (d->has_scheduled_database_messages) {
       if (d->has_loaded_scheduled_messages_from_database) {
         set_dialog_has_scheduled_database_messages_impl(d, false);
@@ -30524,7 +30824,7 @@ void MessagesManager::send_update_chat_has_scheduled_messages(Dialog *d, bool fr
 
   LOG(INFO) << "In " << d->dialog_id << " have scheduled messages on server = " << d->has_scheduled_server_messages
             << ", in database = " << d->has_scheduled_database_messages
-            << " and in memory = " << (d->scheduled_messages != nullptr)
+            << " and in memory = " << (!d->scheduled_messages.empty())
             << "; was loaded from database = " << d->has_loaded_scheduled_messages_from_database;
   bool has_scheduled_messages = get_dialog_has_scheduled_messages(d);
   if (has_scheduled_messages == d->last_sent_has_scheduled_messages) {
@@ -30539,7 +30839,7 @@ void MessagesManager::send_update_chat_has_scheduled_messages(Dialog *d, bool fr
 
 void MessagesManager::send_update_chat_action(DialogId dialog_id, MessageId top_thread_message_id,
                                               DialogId typing_dialog_id, const DialogAction &action) {
-  if (td_->auth_manager_->is_bot()) {
+  if (td_->auth_manager_->is_bot() || td_->is_update_ignored(td_api::updateChatAction::ID)) {
     return;
   }
 
@@ -31175,8 +31475,8 @@ void MessagesManager::fail_edit_message_media(FullMessageId full_message_id, Sta
     // message has already been deleted by the user or sent to inaccessible channel
     return;
   }
-  CHECK(m->edited_content != nullptr);
-  m->edit_promise.set_error(std::move(error));
+  CHECK(m->edited_message != nullptr);
+  m->edited_message->promise.set_error(std::move(error));
   cancel_edit_message_media(dialog_id, m, "Failed to edit message. MUST BE IGNORED");
 }
 
@@ -31642,7 +31942,7 @@ void MessagesManager::on_update_dialog_has_scheduled_server_messages(DialogId di
   if (d->has_scheduled_server_messages != has_scheduled_server_messages) {
     set_dialog_has_scheduled_server_messages(d, has_scheduled_server_messages);
   } else if (has_scheduled_server_messages !=
-             (d->has_scheduled_database_messages || d->scheduled_messages != nullptr)) {
+             (d->has_scheduled_database_messages || !d->scheduled_messages.empty())) {
     repair_dialog_scheduled_messages(d);
   }
 }
@@ -31673,8 +31973,8 @@ void MessagesManager::set_dialog_has_scheduled_database_messages_impl(Dialog *d,
     return;
   }
 
-  if (d->has_scheduled_database_messages && d->scheduled_messages != nullptr &&
-      !d->scheduled_messages->message_id.is_yet_unsent()) {
+  if (d->has_scheduled_database_messages && !d->scheduled_messages.empty() &&
+      !d->scheduled_messages.begin().key().is_yet_unsent()) {
     // to prevent race between add_message_to_database and check of has_scheduled_database_messages
     return;
   }
@@ -32158,7 +32458,7 @@ void MessagesManager::on_dialog_linked_channel_updated(DialogId dialog_id, Chann
   auto d = get_dialog(dialog_id);  // no need to create the dialog
   if (d != nullptr && d->is_update_new_chat_sent) {
     vector<MessageId> message_ids;
-    find_messages(d->messages.get(), message_ids, [old_linked_channel_id, new_linked_channel_id](const Message *m) {
+    find_messages(d->messages, message_ids, [old_linked_channel_id, new_linked_channel_id](const Message *m) {
       return !m->reply_info.is_empty() && m->reply_info.channel_id.is_valid() &&
              (m->reply_info.channel_id == old_linked_channel_id || m->reply_info.channel_id == new_linked_channel_id);
     });
@@ -32558,7 +32858,7 @@ bool MessagesManager::get_dialog_has_scheduled_messages(const Dialog *d) const {
   }
   // TODO send updateChatHasScheduledMessage when can_post_messages changes
 
-  return d->has_scheduled_server_messages || d->has_scheduled_database_messages || d->scheduled_messages != nullptr;
+  return d->has_scheduled_server_messages || d->has_scheduled_database_messages || !d->scheduled_messages.empty();
 }
 
 bool MessagesManager::is_dialog_action_unneeded(DialogId dialog_id) const {
@@ -33416,7 +33716,7 @@ void MessagesManager::unpin_all_dialog_messages(DialogId dialog_id, Promise<Unit
   TRY_STATUS_PROMISE(promise, can_pin_messages(dialog_id));
 
   vector<MessageId> message_ids;
-  find_messages(d->messages.get(), message_ids, [](const Message *m) { return m->is_pinned; });
+  find_messages(d->messages, message_ids, [](const Message *m) { return m->is_pinned; });
 
   vector<int64> deleted_message_ids;
   for (auto message_id : message_ids) {
@@ -33472,79 +33772,6 @@ void MessagesManager::unpin_all_dialog_messages_on_server(DialogId dialog_id, ui
                                             get_erase_log_event_promise(log_event_id, std::move(promise)));
 }
 
-unique_ptr<MessagesManager::Message> *MessagesManager::treap_find_message(unique_ptr<Message> *v,
-                                                                          MessageId message_id) {
-  return const_cast<unique_ptr<Message> *>(treap_find_message(static_cast<const unique_ptr<Message> *>(v), message_id));
-}
-
-const unique_ptr<MessagesManager::Message> *MessagesManager::treap_find_message(const unique_ptr<Message> *v,
-                                                                                MessageId message_id) {
-  while (*v != nullptr) {
-    if ((*v)->message_id < message_id) {
-      v = &(*v)->right;
-    } else if ((*v)->message_id > message_id) {
-      v = &(*v)->left;
-    } else {
-      break;
-    }
-  }
-  return v;
-}
-
-MessagesManager::Message *MessagesManager::treap_insert_message(unique_ptr<Message> *v, unique_ptr<Message> message) {
-  auto message_id = message->message_id;
-  while (*v != nullptr && (*v)->random_y >= message->random_y) {
-    if ((*v)->message_id < message_id) {
-      v = &(*v)->right;
-    } else if ((*v)->message_id == message_id) {
-      UNREACHABLE();
-    } else {
-      v = &(*v)->left;
-    }
-  }
-
-  unique_ptr<Message> *left = &message->left;
-  unique_ptr<Message> *right = &message->right;
-
-  unique_ptr<Message> cur = std::move(*v);
-  while (cur != nullptr) {
-    if (cur->message_id < message_id) {
-      *left = std::move(cur);
-      left = &((*left)->right);
-      cur = std::move(*left);
-    } else {
-      *right = std::move(cur);
-      right = &((*right)->left);
-      cur = std::move(*right);
-    }
-  }
-  CHECK(*left == nullptr);
-  CHECK(*right == nullptr);
-  *v = std::move(message);
-  return v->get();
-}
-
-unique_ptr<MessagesManager::Message> MessagesManager::treap_delete_message(unique_ptr<Message> *v) {
-  unique_ptr<Message> result = std::move(*v);
-  unique_ptr<Message> left = std::move(result->left);
-  unique_ptr<Message> right = std::move(result->right);
-
-  while (left != nullptr || right != nullptr) {
-    if (left == nullptr || (right != nullptr && right->random_y > left->random_y)) {
-      *v = std::move(right);
-      v = &((*v)->left);
-      right = std::move(*v);
-    } else {
-      *v = std::move(left);
-      v = &((*v)->right);
-      left = std::move(*v);
-    }
-  }
-  CHECK(*v == nullptr);
-
-  return result;
-}
-
 MessagesManager::Message *MessagesManager::get_message(Dialog *d, MessageId message_id) {
   return const_cast<Message *>(get_message(static_cast<const Dialog *>(d), message_id));
 }
@@ -33565,7 +33792,8 @@ const MessagesManager::Message *MessagesManager::get_message(const Dialog *d, Me
       CHECK(message_id.is_scheduled_server());
     }
   }
-  auto result = treap_find_message(is_scheduled ? &d->scheduled_messages : &d->messages, message_id)->get();
+  auto *message = (is_scheduled ? d->scheduled_messages : d->messages).find(message_id);
+  auto result = message == nullptr ? nullptr : message->get();
   if (result != nullptr && !is_scheduled) {
     result->last_access_date = G()->unix_time_cached();
   }
@@ -33630,6 +33858,18 @@ MessagesManager::Message *MessagesManager::on_get_message_from_database(Dialog *
     return nullptr;
   }
 
+  if (d != nullptr) {
+    // data in the database is always outdated, so there is no need to parse the message if it is already in memory
+    auto old_message = get_message(d, expected_message_id);
+    if (old_message != nullptr) {
+      if (!have_input_peer(dialog_id, AccessRights::Read)) {
+        return nullptr;
+      }
+      restore_message_correspondences(d, old_message, is_scheduled);
+      return old_message;
+    }
+  }
+
   auto m = parse_message(dialog_id, expected_message_id, value, is_scheduled);
   if (m == nullptr) {
     return nullptr;
@@ -33659,17 +33899,7 @@ MessagesManager::Message *MessagesManager::on_get_message_from_database(Dialog *
   auto old_message = get_message(d, m->message_id);
   if (old_message != nullptr) {
     // data in the database is always outdated, so return a message from the memory
-    if (dialog_id.get_type() == DialogType::SecretChat) {
-      CHECK(!is_scheduled);
-      // just in case restore random_id to message_id corespondence
-      // can be needed if there was newer unloaded message with the same random_id
-      add_random_id_to_message_id_correspondence(d, old_message->random_id, old_message->message_id);
-    }
-
-    if (old_message->notification_id.is_valid() && !is_scheduled) {
-      add_notification_id_to_message_id_correspondence(d, old_message->notification_id, old_message->message_id);
-    }
-
+    restore_message_correspondences(d, old_message, is_scheduled);
     return old_message;
   }
 
@@ -33694,13 +33924,21 @@ MessagesManager::Message *MessagesManager::on_get_message_from_database(Dialog *
   return result;
 }
 
-int32 MessagesManager::get_random_y(MessageId message_id) {
-  return static_cast<int32>(static_cast<uint32>(message_id.get() * 2101234567u));
+void MessagesManager::restore_message_correspondences(Dialog *d, const Message *m, bool is_scheduled) {
+  if (d->dialog_id.get_type() == DialogType::SecretChat) {
+    CHECK(!is_scheduled);
+    // just in case restore random_id to message_id corespondence
+    // can be needed if there was newer unloaded message with the same random_id
+    add_random_id_to_message_id_correspondence(d, m->random_id, m->message_id);
+  }
+
+  if (m->notification_id.is_valid() && !is_scheduled) {
+    add_notification_id_to_message_id_correspondence(d, m->notification_id, m->message_id);
+  }
 }
 
 void MessagesManager::set_message_id(unique_ptr<Message> &message, MessageId message_id) {
   message->message_id = message_id;
-  message->random_y = get_random_y(message_id);
 }
 
 MessagesManager::Message *MessagesManager::add_message_to_dialog(DialogId dialog_id, unique_ptr<Message> message,
@@ -34092,7 +34330,7 @@ MessagesManager::Message *MessagesManager::add_message_to_dialog(Dialog *d, uniq
     on_dialog_updated(dialog_id, "drop have_full_history");
   }
 
-  if (!d->is_opened && d->messages != nullptr && is_message_unload_enabled() && !d->has_unload_timeout) {
+  if (!d->is_opened && !d->messages.empty() && is_message_unload_enabled() && !d->has_unload_timeout) {
     LOG(INFO) << "Schedule unload of " << dialog_id;
     pending_unload_dialog_timeout_.add_timeout_in(dialog_id.get(), get_next_unload_dialog_delay());
     d->has_unload_timeout = true;
@@ -34224,16 +34462,8 @@ MessagesManager::Message *MessagesManager::add_message_to_dialog(Dialog *d, uniq
     }
     if (!is_attached && !message_id.is_yet_unsent()) {
       // message may be attached to the next message if there is no previous message
-      Message *cur = d->messages.get();
-      Message *next_message = nullptr;
-      while (cur != nullptr) {
-        if (cur->message_id < message_id) {
-          cur = cur->right.get();
-        } else {
-          next_message = cur;
-          cur = cur->left.get();
-        }
-      }
+      auto next_it = d->messages.lower_bound(message_id);
+      Message *next_message = next_it.is_end() ? nullptr : get_message(d, next_it.key());
       if (next_message != nullptr) {
         CHECK(!next_message->have_previous);
         LOG(INFO) << "Attach " << message_id << " to the next " << next_message->message_id << " in " << dialog_id;
@@ -34417,7 +34647,7 @@ MessagesManager::Message *MessagesManager::add_message_to_dialog(Dialog *d, uniq
     cancel_dialog_action(dialog_id, m);
     update_has_outgoing_messages(dialog_id, m);
 
-    if (!td_->auth_manager_->is_bot() && d->messages == nullptr && !m->is_outgoing && dialog_id != get_my_dialog_id()) {
+    if (!td_->auth_manager_->is_bot() && d->messages.empty() && !m->is_outgoing && dialog_id != get_my_dialog_id()) {
       switch (dialog_type) {
         case DialogType::User:
           td_->contacts_manager_->invalidate_user_full(dialog_id.get_user_id());
@@ -34442,10 +34672,13 @@ MessagesManager::Message *MessagesManager::add_message_to_dialog(Dialog *d, uniq
     }
   }
 
-  Message *result_message = treap_insert_message(&d->messages, std::move(message));
+  auto insert_result = d->messages.insert(m->message_id, std::move(message));
+  CHECK(insert_result.second);
+  Message *result_message = insert_result.first->get();
   CHECK(result_message != nullptr);
   CHECK(result_message == m);
-  CHECK(d->messages != nullptr);
+  CHECK(!d->messages.empty());
+  register_message_memory(d, result_message);
 
   if (!is_attached) {
     if (m->have_next) {
@@ -34469,7 +34702,7 @@ MessagesManager::Message *MessagesManager::add_message_to_dialog(Dialog *d, uniq
     case DialogType::User:
     case DialogType::Chat:
       if (m->message_id.is_server()) {
-        message_id_to_dialog_id_[m->message_id] = dialog_id;
+        *message_id_to_dialog_id_.insert(m->message_id.get_server_message_id().get(), dialog_id).first = dialog_id;
       }
       break;
     case DialogType::Channel:
@@ -34636,9 +34869,11 @@ MessagesManager::Message *MessagesManager::add_scheduled_message_to_dialog(Dialo
     date = m->date;
   }
 
-  Message *result_message = treap_insert_message(&d->scheduled_messages, std::move(message));
+  auto insert_result = d->scheduled_messages.insert(m->message_id, std::move(message));
+  CHECK(insert_result.second);
+  Message *result_message = insert_result.first->get();
   CHECK(result_message != nullptr);
-  CHECK(d->scheduled_messages != nullptr);
+  CHECK(!d->scheduled_messages.empty());
   being_readded_message_id_ = FullMessageId();
   return result_message;
 }
@@ -35053,7 +35288,6 @@ bool MessagesManager::update_message(Dialog *d, Message *old_message, unique_ptr
   LOG_CHECK(old_message->message_id == new_message->message_id)
       << d->dialog_id << ' ' << old_message->message_id << ' ' << new_message->message_id << ' '
       << is_message_in_dialog;
-  CHECK(old_message->random_y == new_message->random_y);
   CHECK(need_update_dialog_pos != nullptr);
 
   DialogId dialog_id = d->dialog_id;
@@ -35593,19 +35827,21 @@ bool MessagesManager::update_message_content(DialogId dialog_id, Message *old_me
 
 MessagesManager::Dialog *MessagesManager::get_dialog_by_message_id(MessageId message_id) {
   CHECK(message_id.is_valid() && message_id.is_server());
-  auto it = message_id_to_dialog_id_.find(message_id);
-  if (it == message_id_to_dialog_id_.end()) {
+  auto server_message_id = message_id.get_server_message_id();
+  auto dialog_id_ptr = message_id_to_dialog_id_.find(server_message_id.get());
+  if (dialog_id_ptr == nullptr) {
     if (G()->parameters().use_message_db) {
       auto r_value =
-          G()->td_db()->get_messages_db_sync()->get_message_by_unique_message_id(message_id.get_server_message_id());
+          G()->td_db()->get_messages_db_sync()->get_message_by_unique_message_id(server_message_id);
       if (r_value.is_ok()) {
         Message *m = on_get_message_from_database(r_value.ok(), false, "get_dialog_by_message_id");
         if (m != nullptr) {
           auto dialog_id = r_value.ok().dialog_id;
           CHECK(m->message_id == message_id);
-          LOG_CHECK(message_id_to_dialog_id_[message_id] == dialog_id)
-              << message_id << ' ' << dialog_id << ' ' << message_id_to_dialog_id_[message_id] << ' '
-              << m->debug_source;
+          dialog_id_ptr = message_id_to_dialog_id_.find(server_message_id.get());
+          LOG_CHECK(dialog_id_ptr != nullptr && *dialog_id_ptr == dialog_id)
+              << message_id << ' ' << dialog_id << ' ' << (dialog_id_ptr == nullptr ? DialogId() : *dialog_id_ptr)
+              << ' ' << m->debug_source;
           Dialog *d = get_dialog(dialog_id);
           CHECK(d != nullptr);
           return d;
@@ -35617,7 +35853,7 @@ MessagesManager::Dialog *MessagesManager::get_dialog_by_message_id(MessageId mes
     return nullptr;
   }
 
-  return get_dialog(it->second);
+  return get_dialog(*dialog_id_ptr);
 }
 
 MessageId MessagesManager::get_message_id_by_random_id(Dialog *d, int64 random_id, const char *source) {
@@ -35838,7 +36074,12 @@ MessagesManager::Dialog *MessagesManager::add_new_dialog(unique_ptr<Dialog> &&d,
     d->is_channel_difference_finished = true;
   }
 
-  unique_ptr<Message> last_database_message = std::move(d->messages);
+  unique_ptr<Message> last_database_message;
+  if (!d->messages.empty()) {
+    CHECK(d->messages.size() == 1);
+    auto message_id = d->messages.begin().key();
+    last_database_message = d->messages.erase(message_id);
+  }
   MessageId last_database_message_id = d->last_database_message_id;
   d->last_database_message_id = MessageId();
   int64 order = d->order;
@@ -36258,10 +36499,9 @@ void MessagesManager::fix_new_dialog(Dialog *d, unique_ptr<Message> &&last_datab
                       << ", last_new_message_id = " << d->last_new_message_id
                       << ", max_notification_message_id = " << d->max_notification_message_id;
 
-  if (d->messages != nullptr) {
-    CHECK(d->messages->message_id == last_message_id);
-    CHECK(d->messages->left == nullptr);
-    CHECK(d->messages->right == nullptr);
+  if (!d->messages.empty()) {
+    CHECK(d->messages.size() == 1);
+    CHECK(d->messages.begin().key() == last_message_id);
   }
 
   // must be after update_dialog_pos, because uses d->order
@@ -36301,8 +36541,6 @@ void MessagesManager::fix_new_dialog(Dialog *d, unique_ptr<Message> &&last_datab
 void MessagesManager::add_dialog_last_database_message(Dialog *d, unique_ptr<Message> &&last_database_message) {
   CHECK(d != nullptr);
   CHECK(last_database_message != nullptr);
-  CHECK(last_database_message->left == nullptr);
-  CHECK(last_database_message->right == nullptr);
 
   auto dialog_id = d->dialog_id;
   auto message_id = last_database_message->message_id;
@@ -36575,7 +36813,7 @@ bool MessagesManager::set_dialog_order(Dialog *d, int64 new_order, bool need_sen
   if (old_date == new_date) {
     if (new_order == DEFAULT_ORDER) {
       // first addition of a new left dialog
-      if (folder.ordered_dialogs_.insert(new_date).second) {
+      if (folder.ordered_dialogs_.insert(new_date)) {
         for (const auto &dialog_list : dialog_lists_) {
           if (get_dialog_pinned_order(&dialog_list.second, d->dialog_id) != DEFAULT_ORDER) {
             set_dialog_is_pinned(dialog_list.first, d, false);
@@ -36990,8 +37228,8 @@ unique_ptr<MessagesManager::Dialog> MessagesManager::parse_dialog(DialogId dialo
   if (d->default_send_message_as_dialog_id != dialog_id) {
     add_message_sender_dependencies(dependencies, d->default_send_message_as_dialog_id);
   }
-  if (d->messages != nullptr) {
-    add_message_dependencies(dependencies, d->messages.get());
+  if (!d->messages.empty()) {
+    add_message_dependencies(dependencies, d->messages.begin()->get());
   }
   if (d->draft_message != nullptr) {
     add_formatted_text_dependencies(dependencies, &d->draft_message->input_message_text.text);
@@ -37552,9 +37790,67 @@ void MessagesManager::do_get_channel_difference(DialogId dialog_id, int32 pts, b
   LOG(INFO) << "-----BEGIN GET CHANNEL DIFFERENCE----- for " << dialog_id << " with pts " << pts << " and limit "
             << limit << " from " << source;
 
+  // opened chats are never delayed; other chats are caught up by priority with limited number of concurrent queries
+  if (running_get_channel_difference_query_count_ < MAX_CONCURRENT_GET_CHANNEL_DIFFERENCE_QUERIES ||
+      (d != nullptr && d->is_opened)) {
+    return send_get_channel_difference_query(dialog_id, pts, limit, force, std::move(input_channel));
+  }
+
+  int32 priority_class = 0;
+  int64 order = 0;
+  if (d != nullptr) {
+    if (d->was_opened) {
+      priority_class += 4;
+    }
+    if (d->unread_mention_count > 0) {
+      priority_class += 2;
+    }
+    if (d->server_unread_count + d->local_unread_count > 0) {
+      priority_class += 1;
+    }
+    order = get_dialog_base_order(d);
+  }
+  PendingGetChannelDifferenceQueryKey key(-priority_class, -order,
+                                          ++pending_get_channel_difference_query_sequence_number_);
+  LOG(INFO) << "Delay channels.getDifference for " << dialog_id << " with priority " << priority_class << " and order "
+            << order;
+  PendingGetChannelDifferenceQuery query;
+  query.dialog_id = dialog_id;
+  query.pts = pts;
+  query.limit = limit;
+  query.force = force;
+  query.input_channel = std::move(input_channel);
+  pending_get_channel_difference_queries_.emplace(key, std::move(query));
+  pending_get_channel_difference_query_keys_.emplace(dialog_id, key);
+}
+
+void MessagesManager::send_get_channel_difference_query(DialogId dialog_id, int32 pts, int32 limit, bool force,
+                                                        tl_object_ptr<telegram_api::InputChannel> &&input_channel) {
+  running_get_channel_difference_query_count_++;
   td_->create_handler<GetChannelDifferenceQuery>()->send(dialog_id, std::move(input_channel), pts, limit, force);
 }
 
+void MessagesManager::run_pending_get_channel_difference_queries() {
+  while (running_get_channel_difference_query_count_ < MAX_CONCURRENT_GET_CHANNEL_DIFFERENCE_QUERIES &&
+         !pending_get_channel_difference_queries_.empty()) {
+    run_pending_get_channel_difference_query(pending_get_channel_difference_queries_.begin()->second.dialog_id);
+  }
+}
+
+void MessagesManager::run_pending_get_channel_difference_query(DialogId dialog_id) {
+  auto key_it = pending_get_channel_difference_query_keys_.find(dialog_id);
+  if (key_it == pending_get_channel_difference_query_keys_.end()) {
+    return;
+  }
+  auto it = pending_get_channel_difference_queries_.find(key_it->second);
+  CHECK(it != pending_get_channel_difference_queries_.end());
+  auto query = std::move(it->second);
+  pending_get_channel_difference_queries_.erase(it);
+  pending_get_channel_difference_query_keys_.erase(key_it);
+
+  send_get_channel_difference_query(dialog_id, query.pts, query.limit, query.force, std::move(query.input_channel));
+}
+
 void MessagesManager::process_get_channel_difference_updates(
     DialogId dialog_id, int32 new_pts, vector<tl_object_ptr<telegram_api::Message>> &&new_messages,
     vector<tl_object_ptr<telegram_api::Update>> &&other_updates) {
@@ -37834,6 +38130,9 @@ void MessagesManager::on_get_channel_difference(
   LOG(INFO) << "----- END  GET CHANNEL DIFFERENCE----- for " << dialog_id;
   CHECK(active_get_channel_differencies_.count(dialog_id) == 1);
   active_get_channel_differencies_.erase(dialog_id);
+  CHECK(running_get_channel_difference_query_count_ > 0);
+  running_get_channel_difference_query_count_--;
+  run_pending_get_channel_difference_queries();
   auto d = get_dialog_force(dialog_id, "on_get_channel_difference");
 
   if (difference_ptr == nullptr) {
@@ -39165,6 +39464,7 @@ void MessagesManager::on_binlog_events(vector<BinlogEvent> &&events) {
         LOG(FATAL) << "Unsupported log event type " << event.type_;
     }
   }
+  td_->on_startup_phase_finished("replay_message_binlog_events");
 }
 
 Status MessagesManager::add_recently_found_dialog(DialogId dialog_id) {
@@ -44,6 +44,7 @@
 #include "td/telegram/NotificationGroupType.h"
 #include "td/telegram/NotificationId.h"
 #include "td/telegram/NotificationSettings.h"
+#include "td/telegram/QueryCombiner.h"
 #include "td/telegram/RecentDialogList.h"
 #include "td/telegram/ReplyMarkup.h"
 #include "td/telegram/ReportReason.h"
@@ -66,7 +67,10 @@
 
 #include "td/utils/buffer.h"
 #include "td/utils/ChangesProcessor.h"
+#include "td/utils/ChunkedSortedMap.h"
+#include "td/utils/ChunkedSortedSet.h"
 #include "td/utils/common.h"
+#include "td/utils/FlatHashMap.h"
 #include "td/utils/Heap.h"
 #include "td/utils/Hints.h"
 #include "td/utils/logging.h"
@@ -79,6 +83,7 @@
 #include <map>
 #include <memory>
 #include <set>
+#include <tuple>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -91,6 +96,8 @@ class DialogActionBar;
 class DialogFilter;
 class DraftMessage;
 struct InputMessageContent;
+class MemoryStats;
+
 class MessageContent;
 struct MessageReactions;
 class Td;
@@ -419,6 +426,10 @@ class MessagesManager final : public Actor {
       tl_object_ptr<td_api::messageSendOptions> &&options,
       vector<tl_object_ptr<td_api::InputMessageContent>> &&input_message_contents) TD_WARN_UNUSED_RESULT;
 
+  Result<td_api::object_ptr<td_api::messageBroadcastResults>> send_message_broadcast(
+      vector<DialogId> dialog_ids, tl_object_ptr<td_api::messageSendOptions> &&options,
+      tl_object_ptr<td_api::InputMessageContent> &&input_message_content) TD_WARN_UNUSED_RESULT;
+
   Result<MessageId> send_bot_start_message(UserId bot_user_id, DialogId dialog_id,
                                            const string &parameter) TD_WARN_UNUSED_RESULT;
 
@@ -558,6 +569,9 @@ class MessagesManager final : public Actor {
   void get_dialogs_from_list(DialogListId dialog_list_id, int32 limit,
                              Promise<td_api::object_ptr<td_api::chats>> &&promise);
 
+  void get_chat_list_snapshot(DialogListId dialog_list_id, int32 limit,
+                              Promise<td_api::object_ptr<td_api::chatListSnapshot>> &&promise);
+
   vector<DialogId> search_public_dialogs(const string &query, Promise<Unit> &&promise);
 
   std::pair<int32, vector<DialogId>> search_dialogs(const string &query, int32 limit, Promise<Unit> &&promise);
@@ -601,6 +615,8 @@ class MessagesManager final : public Actor {
   void get_messages_from_server(vector<FullMessageId> &&message_ids, Promise<Unit> &&promise, const char *source,
                                 tl_object_ptr<telegram_api::InputMessage> input_message = nullptr);
 
+  void on_get_message_from_server(FullMessageId full_message_id, Result<Unit> &&result);
+
   void get_message_thread(DialogId dialog_id, MessageId message_id, Promise<MessageThreadInfo> &&promise);
 
   td_api::object_ptr<td_api::messageThreadInfo> get_message_thread_info_object(const MessageThreadInfo &info);
@@ -862,6 +878,15 @@ class MessagesManager final : public Actor {
 
   void on_authorization_success();
 
+  void on_message_memory_limit_changed();
+
+  // returns approximate size of memory used by loaded messages
+  size_t get_memory_usage() const;
+
+  void reduce_memory_usage(size_t target_size);
+
+  void memory_stats(MemoryStats &stats) const;
+
   void before_get_difference();
 
   void after_get_difference();
@@ -1070,10 +1095,17 @@ class MessagesManager final : public Actor {
     }
   };
 
+  // state of an editMessageMedia request, which is kept only until the request is finished
+  struct EditedMessage {
+    unique_ptr<MessageContent> content;
+    unique_ptr<ReplyMarkup> reply_markup;
+    uint64 generation = 0;
+    Promise<Unit> promise;
+  };
+
   // Do not forget to update MessagesManager::update_message and all make_unique<Message> when this class is changed
+  // fields are ordered to avoid padding between them
   struct Message {
-    int32 random_y = 0;
-
     MessageId message_id;
     UserId sender_user_id;
     DialogId sender_dialog_id;
@@ -1081,23 +1113,6 @@ class MessagesManager final : public Actor {
     int32 edit_date = 0;
     int32 send_date = 0;
 
-    int64 random_id = 0;
-
-    unique_ptr<MessageForwardInfo> forward_info;
-
-    MessageId reply_to_message_id;
-    int64 reply_to_random_id = 0;  // for send_message
-    DialogId reply_in_dialog_id;
-    MessageId top_thread_message_id;
-    MessageId linked_top_thread_message_id;
-    vector<MessageId> local_thread_message_ids;
-
-    UserId via_bot_user_id;
-
-    vector<RestrictionReason> restriction_reasons;
-
-    string author_signature;
-
     bool is_channel_post = false;
     bool is_outgoing = false;
     bool is_failed_to_send = false;
@@ -1127,6 +1142,25 @@ class MessagesManager final : public Actor {
     bool have_next = false;
     bool from_database = false;
 
+    mutable bool is_update_sent = false;  // whether the message is known to the app
+
+    int64 random_id = 0;
+
+    unique_ptr<MessageForwardInfo> forward_info;
+
+    MessageId reply_to_message_id;
+    int64 reply_to_random_id = 0;  // for send_message
+    DialogId reply_in_dialog_id;
+    MessageId top_thread_message_id;
+    MessageId linked_top_thread_message_id;
+    vector<MessageId> local_thread_message_ids;
+
+    UserId via_bot_user_id;
+
+    vector<RestrictionReason> restriction_reasons;
+
+    string author_signature;
+
     DialogId real_forward_from_dialog_id;    // for resend_message
     MessageId real_forward_from_message_id;  // for resend_message
 
@@ -1148,6 +1182,7 @@ class MessagesManager final : public Actor {
     int32 legacy_layer = 0;
 
     int32 send_error_code = 0;
+    int32 edited_schedule_date = 0;
     string send_error_message;
     double try_resend_at = 0;
 
@@ -1161,21 +1196,14 @@ class MessagesManager final : public Actor {
 
     unique_ptr<ReplyMarkup> reply_markup;
 
-    int32 edited_schedule_date = 0;
-    unique_ptr<MessageContent> edited_content;
-    unique_ptr<ReplyMarkup> edited_reply_markup;
-    uint64 edit_generation = 0;
-    Promise<Unit> edit_promise;
+    unique_ptr<EditedMessage> edited_message;
 
     int32 last_edit_pts = 0;
+    mutable int32 last_access_date = 0;
 
     const char *debug_source = "null";
 
-    unique_ptr<Message> left;
-    unique_ptr<Message> right;
-
-    mutable int32 last_access_date = 0;
-    mutable bool is_update_sent = false;  // whether the message is known to the app
+    int32 memory_size = 0;  // approximate size of the message in memory, if it is accounted in the memory budget
 
     mutable uint64 send_message_log_event_id = 0;
 
@@ -1188,6 +1216,9 @@ class MessagesManager final : public Actor {
     void parse(ParserT &parser);
   };
 
+  // messages of a dialog ordered by message identifier
+  using MessagesIndex = ChunkedSortedMap<MessageId, unique_ptr<Message>>;
+
   struct NotificationGroupInfo {
     NotificationGroupId group_id;
     int32 last_notification_date = 0;            // date of last notification in the group
@@ -1367,8 +1398,9 @@ class MessagesManager final : public Actor {
     std::unordered_map<MessageId, int64, MessageIdHash> pending_viewed_live_locations;  // message_id -> task_id
     std::unordered_set<MessageId, MessageIdHash> pending_viewed_message_ids;
 
-    unique_ptr<Message> messages;
-    unique_ptr<Message> scheduled_messages;
+    MessagesIndex messages;
+    MessagesIndex scheduled_messages;
+    int64 message_memory_size = 0;  // approximate size of all loaded messages
 
     struct MessageOp {
       enum : int8 { Add, SetPts, Delete, DeleteAll } type;
@@ -1458,7 +1490,7 @@ class MessagesManager final : public Actor {
     // date of the last loaded dialog in the folder
     DialogDate folder_last_dialog_date_{MAX_ORDINARY_DIALOG_ORDER, DialogId()};  // in memory
 
-    std::set<DialogDate> ordered_dialogs_;  // all known dialogs, including with default order
+    ChunkedSortedSet<DialogDate> ordered_dialogs_;  // all known dialogs, including with default order
 
     // date of last known user/group/channel dialog in the right order
     DialogDate last_server_dialog_date_{MAX_ORDINARY_DIALOG_ORDER, DialogId()};
@@ -1532,31 +1564,19 @@ class MessagesManager final : public Actor {
   };
 
   class MessagesIteratorBase {
-    vector<const Message *> stack_;
+    MessagesIndex::Iterator it_;
 
    protected:
     MessagesIteratorBase() = default;
 
     // points iterator to message with greatest id which is less or equal than message_id
-    MessagesIteratorBase(const Message *root, MessageId message_id) {
-      size_t last_right_pos = 0;
-      while (root != nullptr) {
-        //        LOG(DEBUG) << "Have root->message_id = " << root->message_id;
-        stack_.push_back(root);
-        if (root->message_id <= message_id) {
-          //          LOG(DEBUG) << "Go right";
-          last_right_pos = stack_.size();
-          root = root->right.get();
-        } else {
-          //          LOG(DEBUG) << "Go left";
-          root = root->left.get();
-        }
-      }
-      stack_.resize(last_right_pos);
+    MessagesIteratorBase(const MessagesIndex &messages, MessageId message_id) {
+      it_ = messages.upper_bound(message_id);
+      --it_;
     }
 
     const Message *operator*() const {
-      return stack_.empty() ? nullptr : stack_.back();
+      return it_.is_end() ? nullptr : it_->get();
     }
 
     ~MessagesIteratorBase() = default;
@@ -1568,65 +1588,27 @@ class MessagesManager final : public Actor {
     MessagesIteratorBase &operator=(MessagesIteratorBase &&other) = default;
 
     void operator++() {
-      if (stack_.empty()) {
+      if (it_.is_end()) {
         return;
       }
 
-      const Message *cur = stack_.back();
-      if (!cur->have_next) {
-        stack_.clear();
+      if (!(*it_)->have_next) {
+        it_ = MessagesIndex::Iterator();
         return;
       }
-      if (cur->right == nullptr) {
-        while (true) {
-          stack_.pop_back();
-          if (stack_.empty()) {
-            return;
-          }
-          const Message *new_cur = stack_.back();
-          if (new_cur->left.get() == cur) {
-            return;
-          }
-          cur = new_cur;
-        }
-      }
-
-      cur = cur->right.get();
-      while (cur != nullptr) {
-        stack_.push_back(cur);
-        cur = cur->left.get();
-      }
+      ++it_;
     }
 
     void operator--() {
-      if (stack_.empty()) {
+      if (it_.is_end()) {
         return;
       }
 
-      const Message *cur = stack_.back();
-      if (!cur->have_previous) {
-        stack_.clear();
+      if (!(*it_)->have_previous) {
+        it_ = MessagesIndex::Iterator();
         return;
       }
-      if (cur->left == nullptr) {
-        while (true) {
-          stack_.pop_back();
-          if (stack_.empty()) {
-            return;
-          }
-          const Message *new_cur = stack_.back();
-          if (new_cur->right.get() == cur) {
-            return;
-          }
-          cur = new_cur;
-        }
-      }
-
-      cur = cur->left.get();
-      while (cur != nullptr) {
-        stack_.push_back(cur);
-        cur = cur->right.get();
-      }
+      --it_;
     }
   };
 
@@ -1635,8 +1617,7 @@ class MessagesManager final : public Actor {
     MessagesIterator() = default;
 
     MessagesIterator(Dialog *d, MessageId message_id)
-        : MessagesIteratorBase(message_id.is_scheduled() ? d->scheduled_messages.get() : d->messages.get(),
-                               message_id) {
+        : MessagesIteratorBase(message_id.is_scheduled() ? d->scheduled_messages : d->messages, message_id) {
     }
 
     Message *operator*() const {
@@ -1649,8 +1630,7 @@ class MessagesManager final : public Actor {
     MessagesConstIterator() = default;
 
     MessagesConstIterator(const Dialog *d, MessageId message_id)
-        : MessagesIteratorBase(message_id.is_scheduled() ? d->scheduled_messages.get() : d->messages.get(),
-                               message_id) {
+        : MessagesIteratorBase(message_id.is_scheduled() ? d->scheduled_messages : d->messages, message_id) {
     }
 
     const Message *operator*() const {
@@ -1733,6 +1713,7 @@ class MessagesManager final : public Actor {
   static constexpr int32 MIN_CHANNEL_DIFFERENCE = 1;
   static constexpr int32 MAX_CHANNEL_DIFFERENCE = 100;
   static constexpr int32 MAX_BOT_CHANNEL_DIFFERENCE = 100000;   // server side limit
+  static constexpr size_t MAX_CONCURRENT_GET_CHANNEL_DIFFERENCE_QUERIES = 10;  // some reasonable value
   static constexpr int32 MAX_RECENT_DIALOGS = 50;               // some reasonable value
   static constexpr size_t MAX_TITLE_LENGTH = 128;               // server side limit for chat title
   static constexpr size_t MAX_DESCRIPTION_LENGTH = 255;         // server side limit for chat description
@@ -1840,6 +1821,10 @@ class MessagesManager final : public Actor {
   Result<MessageSendOptions> process_message_send_options(DialogId dialog_id,
                                                           tl_object_ptr<td_api::messageSendOptions> &&options) const;
 
+  static Result<MessageSendOptions> get_message_send_options(tl_object_ptr<td_api::messageSendOptions> &&options);
+
+  Status check_message_send_options(DialogId dialog_id, MessageSendOptions &options) const;
+
   static Status can_use_message_send_options(const MessageSendOptions &options,
                                              const unique_ptr<MessageContent> &content, int32 ttl);
   static Status can_use_message_send_options(const MessageSendOptions &options, const InputMessageContent &content);
@@ -1861,6 +1846,16 @@ class MessagesManager final : public Actor {
                                unique_ptr<MessageForwardInfo> forward_info = nullptr, bool is_copy = false,
                                DialogId sender_dialog_id = DialogId());
 
+  td_api::object_ptr<td_api::message> send_processed_message(Dialog *d, MessageId top_thread_message_id,
+                                                             MessageId reply_to_message_id,
+                                                             const MessageSendOptions &options,
+                                                             const InputMessageContent &message_content,
+                                                             unique_ptr<ReplyMarkup> &&reply_markup);
+
+  Result<td_api::object_ptr<td_api::message>> send_broadcast_message(DialogId dialog_id,
+                                                                     const MessageSendOptions &options,
+                                                                     const InputMessageContent &message_content);
+
   int64 begin_send_message(DialogId dialog_id, const Message *m);
 
   Status can_send_message(DialogId dialog_id) const TD_WARN_UNUSED_RESULT;
@@ -1883,6 +1878,9 @@ class MessagesManager final : public Actor {
 
   void cancel_edit_message_media(DialogId dialog_id, Message *m, Slice error_message);
 
+  static MessageContent *get_message_edited_content(Message *m);
+  static const MessageContent *get_message_edited_content(const Message *m);
+
   void on_message_media_edited(DialogId dialog_id, MessageId message_id, FileId file_id, FileId thumbnail_file_id,
                                bool was_uploaded, bool was_thumbnail_uploaded, string file_reference,
                                int32 schedule_date, uint64 generation, Result<int32> &&result);
@@ -2040,10 +2038,17 @@ class MessagesManager final : public Actor {
 
   void unload_dialog(DialogId dialog_id);
 
+  static int32 get_message_memory_size(const Message *m);
+
+  void register_message_memory(Dialog *d, Message *m);
+
+  void unregister_message_memory(Dialog *d, Message *m);
+
+  void reduce_message_memory();
+
   void delete_all_dialog_messages(Dialog *d, bool remove_from_dialog_list, bool is_permanently_deleted);
 
-  void do_delete_all_dialog_messages(Dialog *d, unique_ptr<Message> &message, bool is_permanently_deleted,
-                                     vector<int64> &deleted_message_ids);
+  void do_delete_all_dialog_messages(Dialog *d, bool is_permanently_deleted, vector<int64> &deleted_message_ids);
 
   void erase_delete_messages_log_event(uint64 log_event_id);
 
@@ -2084,19 +2089,22 @@ class MessagesManager final : public Actor {
   void on_get_affected_history(DialogId dialog_id, AffectedHistoryQuery query, bool get_affected_messages,
                                AffectedHistory affected_history, Promise<Unit> &&promise);
 
-  static MessageId find_message_by_date(const Message *m, int32 date);
+  static MessageId find_message_by_date(const MessagesIndex &messages, int32 date);
 
-  static void find_messages_by_date(const Message *m, int32 min_date, int32 max_date, vector<MessageId> &message_ids);
+  static void find_messages_by_date(const MessagesIndex &messages, int32 min_date, int32 max_date,
+                                    vector<MessageId> &message_ids);
 
-  static void find_messages(const Message *m, vector<MessageId> &message_ids,
+  static void find_messages(const MessagesIndex &messages, vector<MessageId> &message_ids,
                             const std::function<bool(const Message *)> &condition);
 
-  static void find_old_messages(const Message *m, MessageId max_message_id, vector<MessageId> &message_ids);
+  static void find_old_messages(const MessagesIndex &messages, MessageId max_message_id,
+                                vector<MessageId> &message_ids);
 
-  static void find_newer_messages(const Message *m, MessageId min_message_id, vector<MessageId> &message_ids);
+  static void find_newer_messages(const MessagesIndex &messages, MessageId min_message_id,
+                                  vector<MessageId> &message_ids);
 
-  void find_unloadable_messages(const Dialog *d, int32 unload_before_date, const Message *m,
-                                vector<MessageId> &message_ids, bool &has_left_to_unload_messages) const;
+  void find_unloadable_messages(const Dialog *d, int32 unload_before_date, vector<MessageId> &message_ids,
+                                bool &has_left_to_unload_messages) const;
 
   void on_pending_message_views_timeout(DialogId dialog_id);
 
@@ -2202,6 +2210,10 @@ class MessagesManager final : public Actor {
   void get_history_impl(const Dialog *d, MessageId from_message_id, int32 offset, int32 limit, bool from_database,
                         bool only_local, Promise<Unit> &&promise);
 
+  void preload_history_from_server(const Dialog *d, MessageId from_message_id, int32 offset, int32 limit);
+
+  void send_preload_history_query(int64 query_id, Promise<Unit> &&promise);
+
   void load_messages(DialogId dialog_id, MessageId from_message_id, int32 offset, int32 limit, int left_tries,
                      bool only_local, Promise<Unit> &&promise);
 
@@ -2212,8 +2224,6 @@ class MessagesManager final : public Actor {
 
   void on_get_scheduled_messages_from_database(DialogId dialog_id, vector<MessagesDbDialogMessage> &&messages);
 
-  static int32 get_random_y(MessageId message_id);
-
   static void set_message_id(unique_ptr<Message> &message, MessageId message_id);
 
   static bool is_allowed_useless_update(const tl_object_ptr<telegram_api::Update> &update);
@@ -2250,6 +2260,9 @@ class MessagesManager final : public Actor {
 
   void on_get_dialogs_from_list(int64 task_id, Result<Unit> &&result);
 
+  void on_get_chat_list_snapshot(DialogListId dialog_list_id, td_api::object_ptr<td_api::chats> &&chats,
+                                 Promise<td_api::object_ptr<td_api::chatListSnapshot>> &&promise);
+
   static void invalidate_message_indexes(Dialog *d);
 
   void update_message_count_by_index(Dialog *d, int diff, const Message *m);
@@ -2790,12 +2803,6 @@ class MessagesManager final : public Actor {
   DialogFolder *get_dialog_folder(FolderId folder_id);
   const DialogFolder *get_dialog_folder(FolderId folder_id) const;
 
-  static unique_ptr<Message> *treap_find_message(unique_ptr<Message> *v, MessageId message_id);
-  static const unique_ptr<Message> *treap_find_message(const unique_ptr<Message> *v, MessageId message_id);
-
-  static Message *treap_insert_message(unique_ptr<Message> *v, unique_ptr<Message> message);
-  static unique_ptr<Message> treap_delete_message(unique_ptr<Message> *v);
-
   static Message *get_message(Dialog *d, MessageId message_id);
   static const Message *get_message(const Dialog *d, MessageId message_id);
 
@@ -2819,6 +2826,8 @@ class MessagesManager final : public Actor {
   Message *on_get_message_from_database(Dialog *d, DialogId dialog_id, MessageId message_id, const BufferSlice &value,
                                         bool is_scheduled, const char *source);
 
+  void restore_message_correspondences(Dialog *d, const Message *m, bool is_scheduled);
+
   void get_dialog_message_by_date_from_server(const Dialog *d, int32 date, int64 random_id, bool after_database_search,
                                               Promise<Unit> &&promise);
 
@@ -3059,6 +3068,13 @@ class MessagesManager final : public Actor {
   void do_get_channel_difference(DialogId dialog_id, int32 pts, bool force,
                                  tl_object_ptr<telegram_api::InputChannel> &&input_channel, const char *source);
 
+  void send_get_channel_difference_query(DialogId dialog_id, int32 pts, int32 limit, bool force,
+                                         tl_object_ptr<telegram_api::InputChannel> &&input_channel);
+
+  void run_pending_get_channel_difference_queries();
+
+  void run_pending_get_channel_difference_query(DialogId dialog_id);
+
   void process_get_channel_difference_updates(DialogId dialog_id, int32 new_pts,
                                               vector<tl_object_ptr<telegram_api::Message>> &&new_messages,
                                               vector<tl_object_ptr<telegram_api::Update>> &&other_updates);
@@ -3400,8 +3416,19 @@ class MessagesManager final : public Actor {
   };
   std::unordered_map<int64, PendingMessageGroupSend> pending_message_group_sends_;  // media_album_id -> ...
 
-  std::unordered_map<MessageId, DialogId, MessageIdHash> message_id_to_dialog_id_;
-  std::unordered_map<MessageId, DialogId, MessageIdHash> last_clear_history_message_id_to_dialog_id_;
+  struct PendingPreloadHistoryQuery {
+    DialogId dialog_id;
+    MessageId from_message_id;
+    int32 offset = 0;
+    int32 limit = 0;
+  };
+  FlatHashMap<int64, PendingPreloadHistoryQuery> pending_preload_history_queries_;  // dialog_id * 2 + is_newer -> ...
+  QueryCombiner preload_history_queries_{"PreloadHistoryCombiner", 1.0};
+
+  // server message identifiers in private chats and basic groups are allocated sequentially for the whole account,
+  // so the mapping is mostly appended to and can be stored compactly in sorted arrays
+  ChunkedSortedMap<int32, DialogId> message_id_to_dialog_id_;  // server message ID -> dialog_id
+  FlatHashMap<MessageId, DialogId, MessageIdHash> last_clear_history_message_id_to_dialog_id_;
 
   bool created_public_broadcasts_inited_ = false;
   vector<ChannelId> created_public_broadcasts_;
@@ -3462,6 +3489,7 @@ class MessagesManager final : public Actor {
   std::unordered_map<DialogId, vector<Promise<Unit>>, DialogIdHash> get_dialog_notification_settings_queries_;
 
   std::unordered_map<DialogId, vector<Promise<Unit>>, DialogIdHash> get_dialog_queries_;
+  std::unordered_map<FullMessageId, vector<Promise<Unit>>, FullMessageIdHash> get_message_from_server_queries_;
   std::unordered_map<DialogId, uint64, DialogIdHash> get_dialog_query_log_event_id_;
 
   std::unordered_map<FullMessageId, int32, FullMessageIdHash> replied_by_yet_unsent_messages_;
@@ -3515,6 +3543,22 @@ class MessagesManager final : public Actor {
   vector<Promise<Unit>> dialog_filter_reload_queries_;
 
   std::unordered_map<DialogId, string, DialogIdHash> active_get_channel_differencies_;
+
+  // channels.getDifference queries waiting for a free slot; key is (-priority class, -chat list order, sequence number)
+  struct PendingGetChannelDifferenceQuery {
+    DialogId dialog_id;
+    int32 pts = 0;
+    int32 limit = 0;
+    bool force = false;
+    tl_object_ptr<telegram_api::InputChannel> input_channel;
+  };
+  using PendingGetChannelDifferenceQueryKey = std::tuple<int32, int64, uint64>;
+  std::map<PendingGetChannelDifferenceQueryKey, PendingGetChannelDifferenceQuery>
+      pending_get_channel_difference_queries_;
+  std::unordered_map<DialogId, PendingGetChannelDifferenceQueryKey, DialogIdHash>
+      pending_get_channel_difference_query_keys_;
+  uint64 pending_get_channel_difference_query_sequence_number_ = 0;
+  size_t running_get_channel_difference_query_count_ = 0;
   std::unordered_map<DialogId, uint64, DialogIdHash> get_channel_difference_to_log_event_id_;
   std::unordered_map<DialogId, int32, DialogIdHash> channel_get_difference_retry_timeouts_;
   std::unordered_map<DialogId, std::multimap<int32, PendingPtsUpdate>, DialogIdHash> postponed_channel_updates_;
@@ -3657,6 +3701,11 @@ class MessagesManager final : public Actor {
 
   DialogId debug_channel_difference_dialog_;
 
+  int64 message_memory_limit_ = 0;  // 0 if unlimited
+  int64 message_memory_size_ = 0;   // approximate size of all loaded messages
+  int64 loaded_message_count_ = 0;
+  bool is_message_memory_reduce_scheduled_ = false;
+
   double start_time_ = 0;
   bool is_inited_ = false;
 
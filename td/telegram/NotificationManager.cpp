@@ -142,9 +142,12 @@ void NotificationManager::on_flush_pending_notifications_timeout_callback(void *
   auto notification_manager = static_cast<NotificationManager *>(notification_manager_ptr);
   VLOG(notifications) << "Ready to flush pending notifications for notification group " << group_id_int;
   if (group_id_int > 0) {
-    send_closure_later(notification_manager->actor_id(notification_manager),
-                       &NotificationManager::flush_pending_notifications,
-                       NotificationGroupId(narrow_cast<int32>(group_id_int)));
+    auto &group_ids = notification_manager->expired_pending_notification_group_ids_;
+    if (group_ids.empty()) {
+      send_closure_later(notification_manager->actor_id(notification_manager),
+                         &NotificationManager::flush_expired_pending_notifications);
+    }
+    group_ids.push_back(NotificationGroupId(narrow_cast<int32>(group_id_int)));
   } else if (group_id_int == 0) {
     send_closure_later(notification_manager->actor_id(notification_manager),
                        &NotificationManager::after_get_difference_impl);
@@ -162,8 +165,12 @@ void NotificationManager::on_flush_pending_updates_timeout_callback(void *notifi
   }
 
   auto notification_manager = static_cast<NotificationManager *>(notification_manager_ptr);
-  send_closure_later(notification_manager->actor_id(notification_manager), &NotificationManager::flush_pending_updates,
-                     narrow_cast<int32>(group_id_int), "timeout");
+  auto &group_ids = notification_manager->expired_pending_update_group_ids_;
+  if (group_ids.empty()) {
+    send_closure_later(notification_manager->actor_id(notification_manager),
+                       &NotificationManager::flush_expired_pending_updates);
+  }
+  group_ids.push_back(narrow_cast<int32>(group_id_int));
 }
 
 bool NotificationManager::is_disabled() const {
@@ -1337,6 +1344,15 @@ void NotificationManager::flush_pending_updates(int32 group_id, const char *sour
   }
 }
 
+void NotificationManager::flush_expired_pending_updates() {
+  auto group_ids = std::move(expired_pending_update_group_ids_);
+  expired_pending_update_group_ids_.clear();
+  VLOG(notifications) << "Flush pending updates in " << group_ids.size() << " notification groups";
+  for (auto group_id : group_ids) {
+    flush_pending_updates(group_id, "timeout");
+  }
+}
+
 void NotificationManager::force_flush_pending_updates(NotificationGroupId group_id, const char *source) {
   flush_pending_updates_timeout_.cancel_timeout(group_id.get());
   flush_pending_updates(group_id.get(), source);
@@ -1576,6 +1592,15 @@ void NotificationManager::flush_pending_notifications(NotificationGroupId group_
   }
 }
 
+void NotificationManager::flush_expired_pending_notifications() {
+  auto group_ids = std::move(expired_pending_notification_group_ids_);
+  expired_pending_notification_group_ids_.clear();
+  VLOG(notifications) << "Flush expired pending notifications in " << group_ids.size() << " notification groups";
+  for (auto group_id : group_ids) {
+    flush_pending_notifications(group_id);
+  }
+}
+
 void NotificationManager::flush_all_pending_notifications() {
   std::multimap<int32, NotificationGroupId> group_ids;
   for (auto &group_it : groups_) {
@@ -282,6 +282,8 @@ class NotificationManager final : public Actor {
 
   void flush_pending_notifications(NotificationGroupId group_id);
 
+  void flush_expired_pending_notifications();
+
   void flush_all_pending_notifications();
 
   void on_notification_processed(NotificationId notification_id);
@@ -298,6 +300,8 @@ class NotificationManager final : public Actor {
 
   void flush_pending_updates(int32 group_id, const char *source);
 
+  void flush_expired_pending_updates();
+
   void force_flush_pending_updates(NotificationGroupId group_id, const char *source);
 
   void flush_all_pending_updates(bool include_delayed_chats, const char *source);
@@ -382,6 +386,10 @@ class NotificationManager final : public Actor {
   MultiTimeout flush_pending_notifications_timeout_{"FlushPendingNotificationsTimeout"};
   MultiTimeout flush_pending_updates_timeout_{"FlushPendingUpdatesTimeout"};
 
+  // groups with expired flush timeouts, which are flushed together in one pass
+  vector<NotificationGroupId> expired_pending_notification_group_ids_;
+  vector<int32> expired_pending_update_group_ids_;
+
   vector<NotificationGroupId> call_notification_group_ids_;
   std::unordered_set<NotificationGroupId, NotificationGroupIdHash> available_call_notification_group_ids_;
   std::unordered_map<DialogId, NotificationGroupId, DialogIdHash> dialog_id_to_call_notification_group_id_;
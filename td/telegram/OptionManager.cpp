@@ -15,6 +15,9 @@
 #include "td/telegram/Global.h"
 #include "td/telegram/JsonValue.h"
 #include "td/telegram/LanguagePackManager.h"
+#include "td/telegram/MemoryGovernor.h"
+#include "td/telegram/MessagesDb.h"
+#include "td/telegram/MessagesManager.h"
 #include "td/telegram/net/MtprotoHeader.h"
 #include "td/telegram/net/NetQueryDispatcher.h"
 #include "td/telegram/NotificationManager.h"
@@ -238,6 +241,18 @@ void OptionManager::on_option_updated(const string &name) {
       }
       break;
     case 'm':
+      if (name == "message_fts_merge_budget") {
+        if (G()->parameters().use_message_db) {
+          G()->td_db()->get_messages_db_async()->set_fts_merge_budget(
+              narrow_cast<int32>(G()->shared_config().get_option_integer(name)));
+        }
+      }
+      if (name == "memory_limit") {
+        send_closure(td_->memory_governor_, &MemoryGovernor::on_memory_limit_changed);
+      }
+      if (name == "message_memory_limit") {
+        send_closure(td_->messages_manager_actor_, &MessagesManager::on_message_memory_limit_changed);
+      }
       if (name == "my_id") {
         G()->set_my_id(G()->shared_config().get_option_integer(name));
       }
@@ -294,6 +309,13 @@ void OptionManager::on_option_updated(const string &name) {
       if (name == "use_storage_optimizer") {
         send_closure(td_->storage_manager_, &StorageManager::update_use_storage_optimizer);
       }
+      if (name == "use_update_batches") {
+        td_->set_use_update_batches(G()->shared_config().get_option_boolean(name));
+      }
+      if (name == "update_file_coalescing_delay" || name == "update_chat_action_coalescing_delay" ||
+          name == "update_user_status_coalescing_delay" || name == "update_chat_online_member_count_coalescing_delay") {
+        td_->update_update_coalescing_delays();
+      }
       if (name == "utc_time_offset") {
         if (G()->mtproto_header().set_tz_offset(static_cast<int32>(G()->shared_config().get_option_integer(name)))) {
           G()->net_query_dispatcher().update_mtproto_header();
@@ -488,6 +510,9 @@ void OptionManager::set_option(const string &name, td_api::object_ptr<td_api::Op
       if (!is_bot && set_boolean_option("disable_contact_registered_notifications")) {
         return;
       }
+      if (!is_bot && set_boolean_option("disable_history_preload")) {
+        return;
+      }
       if (!is_bot && set_boolean_option("disable_sent_scheduled_message_notifications")) {
         return;
       }
@@ -557,6 +582,15 @@ void OptionManager::set_option(const string &name, td_api::object_ptr<td_api::Op
       }
       break;
     case 'm':
+      if (set_integer_option("memory_limit", 0, std::numeric_limits<int64>::max())) {
+        return;
+      }
+      if (set_integer_option("message_fts_merge_budget", 0, 1000000)) {
+        return;
+      }
+      if (set_integer_option("message_memory_limit", 0, std::numeric_limits<int64>::max())) {
+        return;
+      }
       if (set_integer_option("message_unload_delay", 60, 86400)) {
         return;
       }
@@ -595,12 +629,18 @@ void OptionManager::set_option(const string &name, td_api::object_ptr<td_api::Op
       }
       break;
     case 'r':
+      if (set_integer_option("request_queue_delay_limit_ms", 0, 3600000)) {
+        return;
+      }
       // temporary option
       if (set_boolean_option("reuse_uploaded_photos_by_hash")) {
         return;
       }
       break;
     case 's':
+      if (set_string_option("shared_files_directory", [](Slice value) { return true; })) {
+        return;
+      }
       if (set_integer_option("storage_max_files_size")) {
         return;
       }
@@ -623,6 +663,24 @@ void OptionManager::set_option(const string &name, td_api::object_ptr<td_api::Op
       }
       break;
     case 'u':
+      if (set_integer_option("update_chat_action_coalescing_delay", 0, 10000)) {
+        return;
+      }
+      if (set_integer_option("update_chat_online_member_count_coalescing_delay", 0, 10000)) {
+        return;
+      }
+      if (set_integer_option("update_file_coalescing_delay", 0, 10000)) {
+        return;
+      }
+      if (set_integer_option("update_user_status_coalescing_delay", 0, 10000)) {
+        return;
+      }
+      if (set_boolean_option("use_adaptive_file_transfers")) {
+        return;
+      }
+      if (set_boolean_option("use_async_file_writes")) {
+        return;
+      }
       if (set_boolean_option("use_pfs")) {
         return;
       }
@@ -632,6 +690,9 @@ void OptionManager::set_option(const string &name, td_api::object_ptr<td_api::Op
       if (set_boolean_option("use_storage_optimizer")) {
         return;
       }
+      if (set_boolean_option("use_update_batches")) {
+        return;
+      }
       if (set_integer_option("utc_time_offset", -12 * 60 * 60, 14 * 60 * 60)) {
         return;
       }
@@ -29,6 +29,9 @@
 #include "td/utils/SliceBuilder.h"
 #include "td/utils/Time.h"
 
+#include <type_traits>
+#include <utility>
+
 namespace td {
 
 tl_object_ptr<td_api::temporaryPasswordState> TempPasswordState::get_temporary_password_state_object() const {
@@ -42,6 +45,40 @@ static void hash_sha256(Slice data, Slice salt, MutableSlice dest) {
   sha256(PSLICE() << salt << data << salt, dest);
 }
 
+template <class T, class FunctionT>
+class PasswordCalculationActor final : public Actor {
+ public:
+  PasswordCalculationActor(ActorId<> parent, FunctionT function, Promise<T> promise)
+      : parent_(std::move(parent)), function_(std::move(function)), promise_(std::move(promise)) {
+  }
+
+ private:
+  ActorId<> parent_;
+  FunctionT function_;
+  Promise<T> promise_;
+
+  void start_up() final {
+    Result<T> result = function_();
+    send_lambda(parent_, [promise = std::move(promise_), result = std::move(result)]() mutable {
+      promise.set_result(std::move(result));
+    });
+    stop();
+  }
+};
+
+// password hashes are calculated using PBKDF2 with 100000 iterations, which takes tens of milliseconds,
+// so they are calculated on the scheduler for slow cryptographic operations, which is shared by all Td instances;
+// the promise is set in the context of the current actor
+template <class T, class FunctionT>
+static void run_password_calculation(FunctionT &&function, Promise<T> &&promise) {
+  auto parent = Scheduler::instance()->get_current_actor_id();
+  CHECK(!parent.empty());
+  create_actor_on_scheduler<PasswordCalculationActor<T, std::decay_t<FunctionT>>>(
+      "PasswordCalculationActor", G()->get_slow_net_scheduler_id(), std::move(parent),
+      std::forward<FunctionT>(function), std::move(promise))
+      .release();
+}
+
 BufferSlice PasswordManager::calc_password_hash(Slice password, Slice client_salt, Slice server_salt) {
   LOG(INFO) << "Begin password hash calculation";
   BufferSlice buf(32);
@@ -151,6 +188,24 @@ tl_object_ptr<telegram_api::InputCheckPasswordSRP> PasswordManager::get_input_ch
                                   state.current_srp_p, state.current_srp_B, state.current_srp_id);
 }
 
+void PasswordManager::calc_input_check_password(string password, string client_salt, string server_salt, int32 g,
+                                                string p, string B, int64 id,
+                                                Promise<tl_object_ptr<telegram_api::InputCheckPasswordSRP>> promise) {
+  run_password_calculation(
+      [password = std::move(password), client_salt = std::move(client_salt), server_salt = std::move(server_salt), g,
+       p = std::move(p), B = std::move(B), id] {
+        return get_input_check_password(password, client_salt, server_salt, g, p, B, id);
+      },
+      std::move(promise));
+}
+
+void PasswordManager::calc_input_check_password(string password, PasswordState state,
+                                                Promise<tl_object_ptr<telegram_api::InputCheckPasswordSRP>> promise) {
+  run_password_calculation(
+      [password = std::move(password), state = std::move(state)] { return get_input_check_password(password, state); },
+      std::move(promise));
+}
+
 void PasswordManager::get_input_check_password_srp(
     string password, Promise<tl_object_ptr<telegram_api::InputCheckPasswordSRP>> &&promise) {
   do_get_state(PromiseCreator::lambda(
@@ -158,7 +213,7 @@ void PasswordManager::get_input_check_password_srp(
         if (r_state.is_error()) {
           return promise.set_error(r_state.move_as_error());
         }
-        promise.set_value(PasswordManager::get_input_check_password(password, r_state.move_as_ok()));
+        calc_input_check_password(std::move(password), r_state.move_as_ok(), std::move(promise));
       }));
 }
 
@@ -279,7 +334,20 @@ void PasswordManager::drop_temp_password() {
 
 void PasswordManager::do_create_temp_password(string password, int32 timeout, PasswordState &&password_state,
                                               Promise<TempPasswordState> promise) {
-  auto hash = get_input_check_password(password, password_state);
+  calc_input_check_password(
+      std::move(password), std::move(password_state),
+      PromiseCreator::lambda([actor_id = actor_id(this), timeout, promise = std::move(promise)](
+                                 Result<tl_object_ptr<telegram_api::InputCheckPasswordSRP>> r_hash) mutable {
+        if (r_hash.is_error()) {
+          return promise.set_error(r_hash.move_as_error());
+        }
+        send_closure(actor_id, &PasswordManager::do_create_temp_password_with_hash, r_hash.move_as_ok(), timeout,
+                     std::move(promise));
+      }));
+}
+
+void PasswordManager::do_create_temp_password_with_hash(tl_object_ptr<telegram_api::InputCheckPasswordSRP> hash,
+                                                        int32 timeout, Promise<TempPasswordState> promise) {
   send_with_promise(G()->net_query_creator().create(telegram_api::account_getTmpPassword(std::move(hash), timeout)),
                     PromiseCreator::lambda([promise = std::move(promise)](Result<NetQueryPtr> r_query) mutable {
                       auto r_result = fetch_result<telegram_api::account_getTmpPassword>(std::move(r_query));
@@ -358,29 +426,49 @@ void PasswordManager::do_get_full_state(string password, PasswordState state, Pr
     return promise.set_value(std::move(result));
   }
 
-  auto hash = get_input_check_password(password, state);
-  send_with_promise(G()->net_query_creator().create(telegram_api::account_getPasswordSettings(std::move(hash))),
-                    PromiseCreator::lambda([promise = std::move(promise), state = std::move(state),
-                                            password](Result<NetQueryPtr> r_query) mutable {
-                      promise.set_result([&]() -> Result<PasswordFullState> {
-                        TRY_RESULT(result, fetch_result<telegram_api::account_getPasswordSettings>(std::move(r_query)));
-                        LOG(INFO) << "Receive password settings: " << to_string(result);
-                        PasswordPrivateState private_state;
-                        private_state.email = std::move(result->email_);
-
-                        if (result->secure_settings_ != nullptr) {
-                          auto r_secret =
-                              decrypt_secure_secret(password, std::move(result->secure_settings_->secure_algo_),
-                                                    result->secure_settings_->secure_secret_.as_slice(),
-                                                    result->secure_settings_->secure_secret_id_);
-                          if (r_secret.is_ok()) {
-                            private_state.secret = r_secret.move_as_ok();
-                          }
-                        }
+  calc_input_check_password(
+      password, state,
+      PromiseCreator::lambda([actor_id = actor_id(this), password, state, promise = std::move(promise)](
+                                 Result<tl_object_ptr<telegram_api::InputCheckPasswordSRP>> r_hash) mutable {
+        if (r_hash.is_error()) {
+          return promise.set_error(r_hash.move_as_error());
+        }
+        send_closure(actor_id, &PasswordManager::do_get_full_state_with_hash, std::move(password), std::move(state),
+                     r_hash.move_as_ok(), std::move(promise));
+      }));
+}
 
-                        return PasswordFullState{std::move(state), std::move(private_state)};
-                      }());
-                    }));
+void PasswordManager::do_get_full_state_with_hash(string password, PasswordState state,
+                                                  tl_object_ptr<telegram_api::InputCheckPasswordSRP> hash,
+                                                  Promise<PasswordFullState> promise) {
+  send_with_promise(
+      G()->net_query_creator().create(telegram_api::account_getPasswordSettings(std::move(hash))),
+      PromiseCreator::lambda([promise = std::move(promise), state = std::move(state),
+                              password = std::move(password)](Result<NetQueryPtr> r_query) mutable {
+        auto r_result = fetch_result<telegram_api::account_getPasswordSettings>(std::move(r_query));
+        if (r_result.is_error()) {
+          return promise.set_error(r_result.move_as_error());
+        }
+        auto result = r_result.move_as_ok();
+        LOG(INFO) << "Receive password settings: " << to_string(result);
+        run_password_calculation(
+            [password = std::move(password), state = std::move(state), result = std::move(result)]() mutable {
+              PasswordPrivateState private_state;
+              private_state.email = std::move(result->email_);
+
+              if (result->secure_settings_ != nullptr) {
+                auto r_secret = decrypt_secure_secret(password, std::move(result->secure_settings_->secure_algo_),
+                                                      result->secure_settings_->secure_secret_.as_slice(),
+                                                      result->secure_settings_->secure_secret_id_);
+                if (r_secret.is_ok()) {
+                  private_state.secret = r_secret.move_as_ok();
+                }
+              }
+
+              return PasswordFullState{std::move(state), std::move(private_state)};
+            },
+            std::move(promise));
+      }));
 }
 
 void PasswordManager::get_recovery_email_address(string password,
@@ -513,12 +601,18 @@ void PasswordManager::recover_password(string code, string new_password, string
       return promise.set_error(r_state.move_as_error());
     }
 
-    TRY_RESULT_PROMISE(
-        promise, new_settings,
-        get_password_input_settings(update_settings, r_state.ok().has_password, r_state.ok().new_state, nullptr));
-
-    send_closure(actor_id, &PasswordManager::do_recover_password, std::move(code), std::move(new_settings),
-                 std::move(promise));
+    run_password_calculation(
+        [update_settings = std::move(update_settings), state = r_state.move_as_ok()] {
+          return get_password_input_settings(update_settings, state.has_password, state.new_state, nullptr);
+        },
+        PromiseCreator::lambda([actor_id, code = std::move(code),
+                                promise = std::move(promise)](Result<PasswordInputSettings> r_new_settings) mutable {
+          if (r_new_settings.is_error()) {
+            return promise.set_error(r_new_settings.move_as_error());
+          }
+          send_closure(actor_id, &PasswordManager::do_recover_password, std::move(code), r_new_settings.move_as_ok(),
+                       std::move(promise));
+        }));
   }));
 }
 
@@ -700,9 +794,30 @@ Result<PasswordManager::PasswordInputSettings> PasswordManager::get_password_inp
 
 void PasswordManager::do_update_password_settings_impl(UpdateSettings update_settings, PasswordState state,
                                                        PasswordPrivateState private_state, Promise<bool> promise) {
-  TRY_RESULT_PROMISE(promise, new_settings,
-                     get_password_input_settings(update_settings, state.has_password, state.new_state, &private_state));
-  auto current_hash = get_input_check_password(state.has_password ? update_settings.current_password : Slice(), state);
+  using PasswordSettingsUpdate = std::pair<PasswordInputSettings, tl_object_ptr<telegram_api::InputCheckPasswordSRP>>;
+  run_password_calculation(
+      [update_settings = std::move(update_settings), state = std::move(state),
+       private_state = std::move(private_state)]() -> Result<PasswordSettingsUpdate> {
+        TRY_RESULT(new_settings, get_password_input_settings(update_settings, state.has_password, state.new_state,
+                                                             &private_state));
+        auto current_hash =
+            get_input_check_password(state.has_password ? update_settings.current_password : Slice(), state);
+        return PasswordSettingsUpdate(std::move(new_settings), std::move(current_hash));
+      },
+      PromiseCreator::lambda([actor_id = actor_id(this),
+                              promise = std::move(promise)](Result<PasswordSettingsUpdate> r_update) mutable {
+        if (r_update.is_error()) {
+          return promise.set_error(r_update.move_as_error());
+        }
+        auto update = r_update.move_as_ok();
+        send_closure(actor_id, &PasswordManager::do_update_password_settings_with_hash, std::move(update.first),
+                     std::move(update.second), std::move(promise));
+      }));
+}
+
+void PasswordManager::do_update_password_settings_with_hash(
+    PasswordInputSettings new_settings, tl_object_ptr<telegram_api::InputCheckPasswordSRP> current_hash,
+    Promise<bool> promise) {
   auto query = G()->net_query_creator().create(
       telegram_api::account_updatePasswordSettings(std::move(current_hash), std::move(new_settings)));
 
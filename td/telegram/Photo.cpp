@@ -88,8 +88,16 @@ td_api::object_ptr<td_api::minithumbnail> get_minithumbnail_object(const string
     auto result = td_api::make_object<td_api::minithumbnail>();
     result->height_ = static_cast<unsigned char>(packed[1]);
     result->width_ = static_cast<unsigned char>(packed[2]);
-    result->data_ = PSTRING() << header.substr(0, 164) << packed[1] << header[165] << packed[2] << header.substr(167)
-                              << packed.substr(3) << footer;
+    // the JPEG is built in place to avoid temporary strings, because it is done every time an object is returned
+    auto &data = result->data_;
+    data.reserve(header.size() + packed.size() - 3 + footer.size());
+    data.append(header, 0, 164);
+    data += packed[1];
+    data += header[165];
+    data += packed[2];
+    data.append(header, 167, string::npos);
+    data.append(packed, 3, string::npos);
+    data += footer;
     return result;
   }
   return nullptr;
@@ -245,6 +245,9 @@ PollManager::PollManager(Td *td, ActorShared<> parent) : td_(td), parent_(std::m
 
   close_poll_timeout_.set_callback(on_close_poll_timeout_callback);
   close_poll_timeout_.set_callback_data(static_cast<void *>(this));
+
+  notify_poll_update_timeout_.set_callback(on_notify_poll_update_timeout_callback);
+  notify_poll_update_timeout_.set_callback_data(static_cast<void *>(this));
 }
 
 void PollManager::start_up() {
@@ -289,6 +292,16 @@ void PollManager::on_close_poll_timeout_callback(void *poll_manager_ptr, int64 p
   send_closure_later(poll_manager->actor_id(poll_manager), &PollManager::on_close_poll_timeout, PollId(poll_id_int));
 }
 
+void PollManager::on_notify_poll_update_timeout_callback(void *poll_manager_ptr, int64 poll_id_int) {
+  if (G()->close_flag()) {
+    return;
+  }
+
+  auto poll_manager = static_cast<PollManager *>(poll_manager_ptr);
+  send_closure_later(poll_manager->actor_id(poll_manager), &PollManager::on_notify_poll_update_timeout,
+                     PollId(poll_id_int));
+}
+
 bool PollManager::is_local_poll_id(PollId poll_id) {
   return poll_id.get() < 0 && poll_id.get() > std::numeric_limits<int32>::min();
 }
@@ -326,6 +339,40 @@ void PollManager::notify_on_poll_update(PollId poll_id) {
   }
 }
 
+void PollManager::schedule_poll_update_notification(PollId poll_id, bool need_update_poll) {
+  if (notify_poll_update_timeout_.has_timeout(poll_id.get())) {
+    // the poll was updated recently, so only the latest state will be sent after the timeout
+    LOG(INFO) << "Delay notification about changed " << poll_id;
+    auto &pending_need_update_poll = pending_poll_update_notifications_[poll_id];
+    pending_need_update_poll = pending_need_update_poll || need_update_poll;
+    return;
+  }
+
+  do_notify_on_poll_update(poll_id, need_update_poll);
+  notify_poll_update_timeout_.set_timeout_in(poll_id.get(), MIN_POLL_UPDATE_NOTIFICATION_DELAY);
+}
+
+void PollManager::do_notify_on_poll_update(PollId poll_id, bool need_update_poll) {
+  notify_on_poll_update(poll_id);
+  if (need_update_poll) {
+    auto poll = get_poll(poll_id);
+    CHECK(poll != nullptr);
+    send_closure(G()->td(), &Td::send_update, td_api::make_object<td_api::updatePoll>(get_poll_object(poll_id, poll)));
+  }
+}
+
+void PollManager::on_notify_poll_update_timeout(PollId poll_id) {
+  auto it = pending_poll_update_notifications_.find(poll_id);
+  if (it == pending_poll_update_notifications_.end()) {
+    return;
+  }
+  auto need_update_poll = it->second;
+  pending_poll_update_notifications_.erase(it);
+
+  do_notify_on_poll_update(poll_id, need_update_poll);
+  notify_poll_update_timeout_.set_timeout_in(poll_id.get(), MIN_POLL_UPDATE_NOTIFICATION_DELAY);
+}
+
 string PollManager::get_poll_database_key(PollId poll_id) {
   return PSTRING() << "poll" << poll_id.get();
 }
@@ -1634,13 +1681,12 @@ PollId PollManager::on_get_poll(PollId poll_id, tl_object_ptr<telegram_api::poll
     LOG(INFO) << "Schedule updating of " << poll_id << " in " << timeout;
     update_poll_timeout_.set_timeout_in(poll_id.get(), timeout);
   }
-  if (is_changed) {
-    notify_on_poll_update(poll_id);
-  }
   if (is_changed || need_save_to_database) {
     save_poll(poll, poll_id);
   }
-  if (need_update_poll && (is_changed || (poll->is_closed && being_closed_polls_.erase(poll_id) != 0))) {
+  if (is_changed) {
+    schedule_poll_update_notification(poll_id, need_update_poll);
+  } else if (need_update_poll && poll->is_closed && being_closed_polls_.erase(poll_id) != 0) {
     send_closure(G()->td(), &Td::send_update, td_api::make_object<td_api::updatePoll>(get_poll_object(poll_id, poll)));
   }
   return poll_id;
@@ -147,6 +147,8 @@ class PollManager final : public Actor {
 
   static void on_close_poll_timeout_callback(void *poll_manager_ptr, int64 poll_id_int);
 
+  static void on_notify_poll_update_timeout_callback(void *poll_manager_ptr, int64 poll_id_int);
+
   static td_api::object_ptr<td_api::pollOption> get_poll_option_object(const PollOption &poll_option);
 
   static telegram_api::object_ptr<telegram_api::pollAnswer> get_input_poll_option(const PollOption &poll_option);
@@ -163,6 +165,12 @@ class PollManager final : public Actor {
 
   void notify_on_poll_update(PollId poll_id);
 
+  void schedule_poll_update_notification(PollId poll_id, bool need_update_poll);
+
+  void do_notify_on_poll_update(PollId poll_id, bool need_update_poll);
+
+  void on_notify_poll_update_timeout(PollId poll_id);
+
   static string get_poll_database_key(PollId poll_id);
 
   static void save_poll(const Poll *poll, PollId poll_id);
@@ -204,6 +212,10 @@ class PollManager final : public Actor {
 
   MultiTimeout update_poll_timeout_{"UpdatePollTimeout"};
   MultiTimeout close_poll_timeout_{"ClosePollTimeout"};
+  MultiTimeout notify_poll_update_timeout_{"NotifyPollUpdateTimeout"};
+
+  static constexpr double MIN_POLL_UPDATE_NOTIFICATION_DELAY = 0.5;  // minimum delay between notifications about
+                                                                      // changed results of the same poll
 
   Td *td_;
   ActorShared<> parent_;
@@ -211,6 +223,9 @@ class PollManager final : public Actor {
 
   std::unordered_map<PollId, std::unordered_set<FullMessageId, FullMessageIdHash>, PollIdHash> poll_messages_;
 
+  // polls changed while notify_poll_update_timeout_ is set; the value is whether updatePoll needs to be sent
+  std::unordered_map<PollId, bool, PollIdHash> pending_poll_update_notifications_;
+
   struct PendingPollAnswer {
     vector<string> options_;
     vector<Promise<Unit>> promises_;
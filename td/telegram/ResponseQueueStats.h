@@ -0,0 +1,55 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2022
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#pragma once
+
+#include "td/utils/common.h"
+
+#include <atomic>
+
+namespace td {
+
+// state of the queue of responses and updates, which were sent by Td instances, but weren't received by the client yet
+class ResponseQueueStats {
+ public:
+  void on_response_sent(size_t count) {
+    size_.fetch_add(count, std::memory_order_relaxed);
+  }
+
+  void on_response_received() {
+    size_.fetch_sub(1, std::memory_order_relaxed);
+  }
+
+  size_t get_size() const {
+    return size_.load(std::memory_order_relaxed);
+  }
+
+  // zero means that there is no limit
+  void set_max_size(size_t max_size) {
+    max_size_.store(max_size, std::memory_order_relaxed);
+  }
+
+  // returns true and counts the postponement, if the queue is too big and fetching of missed updates must be postponed
+  bool need_postpone_update_fetching() {
+    auto max_size = max_size_.load(std::memory_order_relaxed);
+    if (max_size == 0 || get_size() <= max_size) {
+      return false;
+    }
+    postponed_update_fetching_count_.fetch_add(1, std::memory_order_relaxed);
+    return true;
+  }
+
+  uint64 get_postponed_update_fetching_count() const {
+    return postponed_update_fetching_count_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  std::atomic<size_t> size_{0};
+  std::atomic<size_t> max_size_{0};
+  std::atomic<uint64> postponed_update_fetching_count_{0};
+};
+
+}  // namespace td
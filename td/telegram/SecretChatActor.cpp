@@ -1341,18 +1341,34 @@ void SecretChatActor::on_save_changes_start(ChangesProcessor<StateChange>::Id sa
   if (close_flag_) {
     return;
   }
-  SeqNoStateChange seq_no_state_change;
-  PfsStateChange pfs_state_change;
-  std::vector<Promise<Unit>> save_changes_finish_promises;
   changes_processor_.finish(save_changes_token, [&](StateChange &&change) {
-    save_changes_finish_promises.emplace_back(std::move(change.save_changes_finish));
+    pending_save_changes_finish_promises_.emplace_back(std::move(change.save_changes_finish));
     if (change.seq_no_state_change) {
-      seq_no_state_change = std::move(change.seq_no_state_change);
+      pending_seq_no_state_change_ = std::move(change.seq_no_state_change);
     }
     if (change.pfs_state_change) {
-      pfs_state_change = std::move(change.pfs_state_change);
+      pending_pfs_state_change_ = std::move(change.pfs_state_change);
     }
   });
+  if (!is_pending_changes_save_scheduled_ && !pending_save_changes_finish_promises_.empty()) {
+    // promises of other log events synced together are already queued, so save their changes at once
+    is_pending_changes_save_scheduled_ = true;
+    send_closure_later(actor_id(this), &SecretChatActor::save_pending_changes);
+  }
+}
+
+void SecretChatActor::save_pending_changes() {
+  CHECK(is_pending_changes_save_scheduled_);
+  is_pending_changes_save_scheduled_ = false;
+  if (close_flag_) {
+    return;
+  }
+  auto seq_no_state_change = std::move(pending_seq_no_state_change_);
+  auto pfs_state_change = std::move(pending_pfs_state_change_);
+  auto save_changes_finish_promises = std::move(pending_save_changes_finish_promises_);
+  pending_seq_no_state_change_ = SeqNoStateChange();
+  pending_pfs_state_change_ = PfsStateChange();
+  pending_save_changes_finish_promises_.clear();
   if (seq_no_state_change) {
     LOG(INFO) << "SAVE SeqNoState " << seq_no_state_change;
     context_->secret_chat_db()->set_value(seq_no_state_change);
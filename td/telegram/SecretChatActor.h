@@ -540,6 +540,12 @@ class SecretChatActor final : public NetQueryCallback {
   ChangesProcessor<StateChange> changes_processor_;
   int32 saved_pfs_state_message_id_ = 0;
 
+  // changes, whose log events were synced together, are saved to the database at once
+  SeqNoStateChange pending_seq_no_state_change_;
+  PfsStateChange pending_pfs_state_change_;
+  std::vector<Promise<Unit>> pending_save_changes_finish_promises_;
+  bool is_pending_changes_save_scheduled_ = false;
+
   SeqNoState seq_no_state_;
   bool seq_no_state_changed_ = false;
   int32 last_binlog_message_id_ = -1;
@@ -554,6 +560,7 @@ class SecretChatActor final : public NetQueryCallback {
   Promise<> add_changes(Promise<> save_changes_finish = Promise<>());
   // called only via Promise
   void on_save_changes_start(ChangesProcessor<StateChange>::Id save_changes_token);
+  void save_pending_changes();
 
   // InboundMessage
   struct InboundMessageState {
@@ -90,34 +90,6 @@ BufferSlice gen_random_prefix(int64 data_size) {
   return buff;
 }
 
-class FileDataView final : public DataView {
- public:
-  FileDataView(FileFd &fd, int64 size);
-
-  int64 size() const final;
-  Result<BufferSlice> pread(int64 offset, int64 size) const final;
-
- private:
-  FileFd &fd_;
-  int64 size_;
-};
-
-FileDataView::FileDataView(FileFd &fd, int64 size) : fd_(fd), size_(size) {
-}
-
-int64 FileDataView::size() const {
-  return size_;
-}
-
-Result<BufferSlice> FileDataView::pread(int64 offset, int64 size) const {
-  auto slice = BufferSlice(narrow_cast<size_t>(size));
-  TRY_RESULT(actual_size, fd_.pread(slice.as_slice(), offset));
-  if (static_cast<int64>(actual_size) != size) {
-    return Status::Error("Not enough data in file");
-  }
-  return std::move(slice);
-}
-
 BufferSliceDataView::BufferSliceDataView(BufferSlice buffer_slice) : buffer_slice_(std::move(buffer_slice)) {
 }
 
@@ -340,15 +312,16 @@ Result<BufferSlice> Encryptor::pread(int64 offset, int64 size) const {
 }
 
 Result<EncryptedValue> encrypt_value(const Secret &secret, Slice data) {
-  BufferSliceDataView random_prefix_view{gen_random_prefix(data.size())};
-  BufferSliceDataView data_view{BufferSlice(data)};
-  ConcatDataView full_view{random_prefix_view, data_view};
+  // the value is hashed and encrypted in place in a single buffer
+  auto random_prefix = gen_random_prefix(data.size());
+  BufferSlice encrypted_data(random_prefix.size() + data.size());
+  encrypted_data.as_slice().copy_from(random_prefix.as_slice());
+  encrypted_data.as_slice().substr(random_prefix.size()).copy_from(data);
 
-  TRY_RESULT(hash, calc_value_hash(full_view));
+  auto hash = calc_value_hash(encrypted_data.as_slice());
 
   auto aes_cbc_state = calc_aes_cbc_state_sha512(PSLICE() << secret.as_slice() << hash.as_slice());
-  Encryptor encryptor(std::move(aes_cbc_state), full_view);
-  TRY_RESULT(encrypted_data, encryptor.pread(0, encryptor.size()));
+  aes_cbc_state.encrypt(encrypted_data.as_slice(), encrypted_data.as_slice());
   return EncryptedValue{std::move(encrypted_data), std::move(hash)};
 }
 
@@ -364,21 +337,54 @@ Result<BufferSlice> decrypt_value(const Secret &secret, const ValueHash &hash, S
   return std::move(decrypted_value);
 }
 
+static constexpr size_t FILE_CHUNK_SIZE = 128 << 10;
+
+// calls f for consecutive chunks of prefix and the first file_size bytes of the file, reusing the buffer for all chunks
+template <class F>
+static Status file_for_each(Slice prefix, const FileFd &fd, int64 file_size, MutableSlice buffer, F &&f) {
+  CHECK(prefix.size() <= buffer.size());
+  buffer.copy_from(prefix);
+  size_t filled_size = prefix.size();
+  int64 offset = 0;
+  while (filled_size != 0 || offset < file_size) {
+    auto read_size = narrow_cast<size_t>(min(static_cast<int64>(buffer.size() - filled_size), file_size - offset));
+    TRY_RESULT(actual_size, fd.pread(buffer.substr(filled_size, read_size), offset));
+    if (actual_size != read_size) {
+      return Status::Error("Not enough data in file");
+    }
+    offset += static_cast<int64>(read_size);
+    TRY_STATUS(f(buffer.substr(0, filled_size + read_size)));
+    filled_size = 0;
+  }
+  return Status::OK();
+}
+
 Result<ValueHash> encrypt_file(const Secret &secret, const string &src, const string &dest) {
   TRY_RESULT(src_file, FileFd::open(src, FileFd::Flags::Read));
   TRY_RESULT(dest_file, FileFd::open(dest, FileFd::Flags::Truncate | FileFd::Flags::Write | FileFd::Create));
   TRY_RESULT(src_file_size, src_file.get_size());
 
-  BufferSliceDataView random_prefix_view(gen_random_prefix(src_file_size));
-  FileDataView data_view(src_file, src_file_size);
-  ConcatDataView full_view(random_prefix_view, data_view);
-
-  TRY_RESULT(hash, calc_value_hash(full_view));
+  // the encryption key depends on the hash of the whole value, so the file has to be read twice
+  auto random_prefix = gen_random_prefix(src_file_size);
+  BufferSlice buffer(FILE_CHUNK_SIZE);
+
+  Sha256State sha256_state;
+  sha256_state.init();
+  TRY_STATUS(file_for_each(random_prefix.as_slice(), src_file, src_file_size, buffer.as_slice(),
+                           [&sha256_state](MutableSlice bytes) {
+                             sha256_state.feed(bytes);
+                             return Status::OK();
+                           }));
+  UInt256 hash_value;
+  sha256_state.extract(as_slice(hash_value), true);
+  ValueHash hash(hash_value);
 
   auto aes_cbc_state = calc_aes_cbc_state_sha512(PSLICE() << secret.as_slice() << hash.as_slice());
-  Encryptor encryptor(std::move(aes_cbc_state), full_view);
-  TRY_STATUS(
-      data_view_for_each(encryptor, [&dest_file](BufferSlice bytes) { return dest_file.write(bytes.as_slice()); }));
+  TRY_STATUS(file_for_each(random_prefix.as_slice(), src_file, src_file_size, buffer.as_slice(),
+                           [&aes_cbc_state, &dest_file](MutableSlice bytes) {
+                             aes_cbc_state.encrypt(bytes, bytes);
+                             return dest_file.write(bytes);
+                           }));
   return std::move(hash);
 }
 
@@ -387,15 +393,15 @@ Status decrypt_file(const Secret &secret, const ValueHash &hash, const string &s
   TRY_RESULT(dest_file, FileFd::open(dest, FileFd::Flags::Truncate | FileFd::Flags::Write | FileFd::Create));
   TRY_RESULT(src_file_size, src_file.get_size());
 
-  FileDataView src_file_view(src_file, src_file_size);
-
   auto aes_cbc_state = calc_aes_cbc_state_sha512(PSLICE() << secret.as_slice() << hash.as_slice());
   Decryptor decryptor(std::move(aes_cbc_state));
-  TRY_STATUS(data_view_for_each(src_file_view, [&decryptor, &dest_file](BufferSlice bytes) {
-    TRY_RESULT(decrypted_bytes, decryptor.append(std::move(bytes)));
-    TRY_STATUS(dest_file.write(decrypted_bytes.as_slice()));
-    return Status::OK();
-  }));
+  BufferSlice buffer(FILE_CHUNK_SIZE);
+  TRY_STATUS(file_for_each(Slice(), src_file, src_file_size, buffer.as_slice(),
+                           [&buffer, &decryptor, &dest_file](MutableSlice bytes) {
+                             TRY_RESULT(decrypted_bytes, decryptor.append(buffer.from_slice(bytes)));
+                             TRY_STATUS(dest_file.write(decrypted_bytes.as_slice()));
+                             return Status::OK();
+                           }));
 
   TRY_RESULT(got_hash, decryptor.finish());
 
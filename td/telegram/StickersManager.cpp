@@ -21,6 +21,7 @@
 #include "td/telegram/Global.h"
 #include "td/telegram/LanguagePackManager.h"
 #include "td/telegram/logevent/LogEvent.h"
+#include "td/telegram/MemoryStats.h"
 #include "td/telegram/MessagesManager.h"
 #include "td/telegram/misc.h"
 #include "td/telegram/net/DcId.h"
@@ -7134,23 +7135,56 @@ string StickersManager::get_language_emojis_database_key(const string &language_
   return PSTRING() << "emoji$" << language_code << '$' << text;
 }
 
+StickersManager::EmojiKeywords &StickersManager::get_emoji_keywords(const string &language_code) {
+  auto it = emoji_keywords_.find(language_code);
+  if (it != emoji_keywords_.end()) {
+    return it->second;
+  }
+
+  // the keywords are loaded only after all changes of the current version have been saved to the database,
+  // all subsequent changes are applied both to the database and to the loaded keywords
+  auto &keywords = emoji_keywords_[language_code];
+  auto prefix = get_language_emojis_database_key(language_code, string());
+  auto prefix_size = prefix.size();
+  G()->td_db()->get_sqlite_sync_pmc()->get_by_prefix(prefix, [&keywords, prefix_size](Slice key, Slice value) {
+    keywords.emplace_back(key.substr(prefix_size).str(), value.str());
+    return true;
+  });
+  std::sort(keywords.begin(), keywords.end());
+  LOG(INFO) << "Loaded " << keywords.size() << " emoji keywords for language " << language_code;
+  return keywords;
+}
+
+void StickersManager::set_emoji_keyword(EmojiKeywords &keywords, const string &text, string emojis) {
+  auto it = std::lower_bound(keywords.begin(), keywords.end(), text,
+                             [](const std::pair<string, string> &keyword, const string &text) {
+                               return keyword.first < text;
+                             });
+  if (it != keywords.end() && it->first == text) {
+    it->second = std::move(emojis);
+  } else {
+    keywords.emplace(it, text, std::move(emojis));
+  }
+}
+
 vector<string> StickersManager::search_language_emojis(const string &language_code, const string &text,
                                                        bool exact_match) {
   LOG(INFO) << "Search for \"" << text << "\" in language " << language_code;
-  auto key = get_language_emojis_database_key(language_code, text);
-  if (exact_match) {
-    string emojis = G()->td_db()->get_sqlite_sync_pmc()->get(key);
-    return full_split(emojis, '$');
-  } else {
-    vector<string> result;
-    G()->td_db()->get_sqlite_sync_pmc()->get_by_prefix(key, [&result](Slice key, Slice value) {
-      for (auto &emoji : full_split(value, '$')) {
-        result.push_back(emoji.str());
-      }
-      return true;
-    });
-    return result;
+  const auto &keywords = get_emoji_keywords(language_code);
+  auto it = std::lower_bound(keywords.begin(), keywords.end(), text,
+                             [](const std::pair<string, string> &keyword, const string &text) {
+                               return keyword.first < text;
+                             });
+  vector<string> result;
+  for (; it != keywords.end() && begins_with(it->first, text); ++it) {
+    if (exact_match && it->first != text) {
+      break;
+    }
+    for (auto &emoji : full_split(Slice(it->second), '$')) {
+      result.push_back(emoji.str());
+    }
   }
+  return result;
 }
 
 string StickersManager::get_emoji_language_codes_database_key(const vector<string> &language_codes) {
@@ -7335,6 +7369,7 @@ void StickersManager::on_get_emoji_keywords(
     LOG(ERROR) << "Receive keywords of version " << version;
     version = 1;
   }
+  EmojiKeywords emoji_keywords;
   for (auto &keyword_ptr : keywords->keywords_) {
     switch (keyword_ptr->get_id()) {
       case telegram_api::emojiKeyword::ID: {
@@ -7349,8 +7384,10 @@ void StickersManager::on_get_emoji_keywords(
         }
         if (is_good && !G()->close_flag()) {
           CHECK(G()->parameters().use_file_db);
-          G()->td_db()->get_sqlite_pmc()->set(get_language_emojis_database_key(language_code, text),
-                                              implode(keyword->emoticons_, '$'), mpas.get_promise());
+          auto emojis = implode(keyword->emoticons_, '$');
+          G()->td_db()->get_sqlite_pmc()->set(get_language_emojis_database_key(language_code, text), emojis,
+                                              mpas.get_promise());
+          emoji_keywords.emplace_back(std::move(text), std::move(emojis));
         }
         break;
       }
@@ -7371,6 +7408,21 @@ void StickersManager::on_get_emoji_keywords(
   emoji_language_code_versions_[language_code] = version;
   emoji_language_code_last_difference_times_[language_code] = static_cast<int32>(Time::now_cached());
 
+  // the last value for a keyword is saved to the database, so the same one must be kept in memory
+  std::stable_sort(emoji_keywords.begin(), emoji_keywords.end(),
+                   [](const std::pair<string, string> &lhs, const std::pair<string, string> &rhs) {
+                     return lhs.first < rhs.first;
+                   });
+  size_t keyword_count = 0;
+  for (size_t i = 0; i < emoji_keywords.size(); i++) {
+    if (i + 1 < emoji_keywords.size() && emoji_keywords[i + 1].first == emoji_keywords[i].first) {
+      continue;
+    }
+    emoji_keywords[keyword_count++] = std::move(emoji_keywords[i]);
+  }
+  emoji_keywords.resize(keyword_count);
+  emoji_keywords_[language_code] = std::move(emoji_keywords);
+
   lock.set_value(Unit());
 }
 
@@ -7416,6 +7468,7 @@ void StickersManager::on_get_emoji_keywords_difference(
     keywords->version_ = version;
   }
   version = keywords->version_;
+  auto &emoji_keywords = get_emoji_keywords(language_code);
   std::unordered_map<string, string> key_values;
   key_values.emplace(get_emoji_language_code_version_database_key(language_code), to_string(version));
   key_values.emplace(get_emoji_language_code_last_difference_time_database_key(language_code),
@@ -7442,7 +7495,9 @@ void StickersManager::on_get_emoji_keywords_difference(
             }
           }
           if (is_changed) {
-            key_values.emplace(get_language_emojis_database_key(language_code, text), implode(emojis, '$'));
+            auto new_emojis = implode(emojis, '$');
+            key_values[get_language_emojis_database_key(language_code, text)] = new_emojis;
+            set_emoji_keyword(emoji_keywords, text, std::move(new_emojis));
           } else {
             LOG(INFO) << "Emoji keywords not changed for \"" << text << "\" from version " << from_version
                       << " to version " << version;
@@ -7461,7 +7516,9 @@ void StickersManager::on_get_emoji_keywords_difference(
           }
         }
         if (is_changed) {
-          key_values.emplace(get_language_emojis_database_key(language_code, text), implode(emojis, '$'));
+          auto new_emojis = implode(emojis, '$');
+          key_values[get_language_emojis_database_key(language_code, text)] = new_emojis;
+          set_emoji_keyword(emoji_keywords, text, std::move(new_emojis));
         } else {
           LOG(INFO) << "Emoji keywords not changed for \"" << text << "\" from version " << from_version
                     << " to version " << version;
@@ -7603,6 +7660,13 @@ void StickersManager::after_get_difference() {
   }
 }
 
+void StickersManager::memory_stats(MemoryStats &stats) const {
+  stats.add_container("stickers_", stickers_, sizeof(Sticker));
+  stats.add_container("sticker_sets_", sticker_sets_, sizeof(StickerSet));
+  stats.add_container("attached_sticker_sets_", attached_sticker_sets_);
+  stats.add_container("found_sticker_sets_", found_sticker_sets_);
+}
+
 void StickersManager::get_current_state(vector<td_api::object_ptr<td_api::Update>> &updates) const {
   if (td_->auth_manager_->is_bot()) {
     return;
@@ -37,6 +37,8 @@
 
 namespace td {
 
+class MemoryStats;
+
 class Td;
 
 class StickersManager final : public Actor {
@@ -321,6 +323,8 @@ class StickersManager final : public Actor {
 
   void get_current_state(vector<td_api::object_ptr<td_api::Update>> &updates) const;
 
+  void memory_stats(MemoryStats &stats) const;
+
   template <class StorerT>
   void store_sticker_set_id(StickerSetId sticker_set_id, StorerT &storer) const;
 
@@ -733,7 +737,13 @@ class StickersManager final : public Actor {
 
   void on_get_language_codes(const string &key, Result<vector<string>> &&result);
 
-  static vector<string> search_language_emojis(const string &language_code, const string &text, bool exact_match);
+  using EmojiKeywords = vector<std::pair<string, string>>;  // sorted keyword -> '$'-separated list of emojis
+
+  EmojiKeywords &get_emoji_keywords(const string &language_code);
+
+  static void set_emoji_keyword(EmojiKeywords &keywords, const string &text, string emojis);
+
+  vector<string> search_language_emojis(const string &language_code, const string &text, bool exact_match);
 
   void load_emoji_keywords(const string &language_code, Promise<Unit> &&promise);
 
@@ -872,6 +882,7 @@ class StickersManager final : public Actor {
   std::unordered_map<string, int32> emoji_language_code_versions_;
   std::unordered_map<string, double> emoji_language_code_last_difference_times_;
   std::unordered_set<string> reloaded_emoji_keywords_;
+  std::unordered_map<string, EmojiKeywords> emoji_keywords_;  // in-memory copy of the database for fast prefix search
   std::unordered_map<string, vector<Promise<Unit>>> load_emoji_keywords_queries_;
   std::unordered_map<string, vector<Promise<Unit>>> load_language_codes_queries_;
   std::unordered_map<int64, string> emoji_suggestions_urls_;
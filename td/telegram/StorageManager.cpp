@@ -42,9 +42,11 @@ void StorageManager::start_up() {
   schedule_next_gc();
 
   load_fast_stat();
+  load_cached_stats();
 }
 
-void StorageManager::on_new_file(int64 size, int64 real_size, int32 cnt) {
+void StorageManager::on_new_file(FileType file_type, DialogId owner_dialog_id, int64 size, int64 real_size,
+                                 int32 cnt) {
   LOG(INFO) << "Add " << cnt << " file of size " << size << " with real size " << real_size
             << " to fast storage statistics";
   fast_stat_.cnt += cnt;
@@ -60,12 +62,35 @@ void StorageManager::on_new_file(int64 size, int64 real_size, int32 cnt) {
     fast_stat_ = FileTypeStat();
   }
   save_fast_stat();
+
+  if (has_cached_stats_) {
+    if (!G()->parameters().use_chat_info_db) {
+      owner_dialog_id = DialogId();
+    }
+    if (!cached_stats_.add_file_stat(get_main_file_type(file_type), owner_dialog_id, add_size, cnt)) {
+      LOG(INFO) << "Drop inconsistent cached storage statistics after adding size " << add_size << " and cnt " << cnt;
+      drop_cached_stats();
+    } else if (save_cached_stats_at_ == 0) {
+      save_cached_stats_at_ = Time::now() + SAVE_CACHED_STATS_DELAY;
+      update_timeout();
+    }
+  }
 }
 
 void StorageManager::get_storage_stats(bool need_all_files, int32 dialog_limit, Promise<FileStats> promise) {
   if (is_closed_) {
     return promise.set_error(Global::request_aborted_error());
   }
+  if (!need_all_files && has_cached_stats_) {
+    std::vector<Promise<FileStats>> promises;
+    promises.push_back(std::move(promise));
+    send_stats(cached_stats_.get_stats_by_owner_dialog_id(), dialog_limit, std::move(promises));
+
+    if (cached_stats_date_ + RECONCILE_STATS_EACH < static_cast<int32>(Clocks::system())) {
+      reconcile_cached_stats();
+    }
+    return;
+  }
   if (!pending_storage_stats_.empty()) {
     if (stats_dialog_limit_ == dialog_limit && need_all_files == stats_need_all_files_) {
       pending_storage_stats_.emplace_back(std::move(promise));
@@ -73,6 +98,8 @@ void StorageManager::get_storage_stats(bool need_all_files, int32 dialog_limit,
     }
     //TODO group same queries
     close_stats_worker();
+  } else if (is_reconciling_stats_) {
+    close_stats_worker();
   }
   if (!pending_run_gc_[0].empty() || !pending_run_gc_[1].empty()) {
     close_gc_worker();
@@ -81,8 +108,9 @@ void StorageManager::get_storage_stats(bool need_all_files, int32 dialog_limit,
   stats_need_all_files_ = need_all_files;
   pending_storage_stats_.emplace_back(std::move(promise));
 
+  // statistics split by owner dialog identifier are needed to fill the cache
   create_stats_worker();
-  send_closure(stats_worker_, &FileStatsWorker::get_stats, need_all_files, stats_dialog_limit_ != 0,
+  send_closure(stats_worker_, &FileStatsWorker::get_stats, need_all_files, !need_all_files || stats_dialog_limit_ != 0,
                PromiseCreator::lambda(
                    [actor_id = actor_id(this), stats_generation = stats_generation_](Result<FileStats> file_stats) {
                      send_closure(actor_id, &StorageManager::on_file_stats, std::move(file_stats), stats_generation);
@@ -130,10 +158,29 @@ void StorageManager::run_gc(FileGcParameters parameters, bool return_deleted_fil
   pending_run_gc_[return_deleted_file_statistics].push_back(std::move(promise));
 }
 
+void StorageManager::reconcile_cached_stats() {
+  if (is_reconciling_stats_ || !pending_storage_stats_.empty() || !pending_run_gc_[0].empty() ||
+      !pending_run_gc_[1].empty()) {
+    return;
+  }
+  LOG(INFO) << "Reconcile cached storage statistics";
+  is_reconciling_stats_ = true;
+  stats_dialog_limit_ = 0;
+  stats_need_all_files_ = false;
+
+  create_stats_worker();
+  send_closure(stats_worker_, &FileStatsWorker::get_stats, false, true,
+               PromiseCreator::lambda(
+                   [actor_id = actor_id(this), stats_generation = stats_generation_](Result<FileStats> file_stats) {
+                     send_closure(actor_id, &StorageManager::on_file_stats, std::move(file_stats), stats_generation);
+                   }));
+}
+
 void StorageManager::on_file_stats(Result<FileStats> r_file_stats, uint32 generation) {
   if (generation != stats_generation_) {
     return;
   }
+  is_reconciling_stats_ = false;
   if (r_file_stats.is_error()) {
     auto promises = std::move(pending_storage_stats_);
     for (auto &promise : promises) {
@@ -143,6 +190,9 @@ void StorageManager::on_file_stats(Result<FileStats> r_file_stats, uint32 genera
   }
 
   update_fast_stats(r_file_stats.ok());
+  if (r_file_stats.ok().is_split_by_owner_dialog_id() || !G()->parameters().use_chat_info_db) {
+    update_cached_stats(r_file_stats.ok());
+  }
   send_stats(r_file_stats.move_as_ok(), stats_dialog_limit_, std::move(pending_storage_stats_));
 }
 
@@ -230,6 +280,11 @@ void StorageManager::on_gc_finished(int32 dialog_limit, Result<FileGcResult> r_f
   }
 
   update_fast_stats(r_file_gc_result.ok().kept_file_stats_);
+  if (r_file_gc_result.ok().kept_file_stats_.is_split_by_owner_dialog_id() || !G()->parameters().use_chat_info_db) {
+    update_cached_stats(r_file_gc_result.ok().kept_file_stats_);
+  } else {
+    drop_cached_stats();
+  }
 
   auto kept_file_promises = std::move(pending_run_gc_[0]);
   auto removed_file_promises = std::move(pending_run_gc_[1]);
@@ -256,6 +311,51 @@ void StorageManager::update_fast_stats(const FileStats &stats) {
   save_fast_stat();
 }
 
+void StorageManager::update_cached_stats(const FileStats &stats) {
+  cached_stats_ = stats.get_stats_by_owner_dialog_id();
+  has_cached_stats_ = true;
+  cached_stats_date_ = static_cast<int32>(Clocks::system());
+  LOG(INFO) << "Recalculate cached storage statistics";
+  save_cached_stats();
+}
+
+void StorageManager::drop_cached_stats() {
+  if (!has_cached_stats_) {
+    return;
+  }
+  cached_stats_ = FileStats(false, true);
+  has_cached_stats_ = false;
+  cached_stats_date_ = 0;
+  save_cached_stats();
+}
+
+void StorageManager::save_cached_stats() {
+  save_cached_stats_at_ = 0;
+  update_timeout();
+  if (has_cached_stats_) {
+    G()->td_db()->get_binlog_pmc()->set("file_stats_date", to_string(cached_stats_date_));
+    G()->td_db()->get_binlog_pmc()->set("file_stats", log_event_store(cached_stats_).as_slice().str());
+  } else {
+    G()->td_db()->get_binlog_pmc()->erase("file_stats_date");
+    G()->td_db()->get_binlog_pmc()->erase("file_stats");
+  }
+}
+
+void StorageManager::load_cached_stats() {
+  cached_stats_date_ = to_integer<int32>(G()->td_db()->get_binlog_pmc()->get("file_stats_date"));
+  auto value = G()->td_db()->get_binlog_pmc()->get("file_stats");
+  if (cached_stats_date_ <= 0 || value.empty()) {
+    return;
+  }
+  if (log_event_parse(cached_stats_, value).is_error()) {
+    cached_stats_ = FileStats(false, true);
+    cached_stats_date_ = 0;
+    return;
+  }
+  has_cached_stats_ = true;
+  LOG(INFO) << "Loaded cached storage statistics calculated at " << cached_stats_date_;
+}
+
 void StorageManager::send_stats(FileStats &&stats, int32 dialog_limit, std::vector<Promise<FileStats>> &&promises) {
   if (promises.empty()) {
     return;
@@ -293,6 +393,7 @@ void StorageManager::close_stats_worker() {
   for (auto &promise : promises) {
     promise.set_error(Global::request_aborted_error());
   }
+  is_reconciling_stats_ = false;
   stats_generation_++;
   stats_worker_.reset();
   stats_cancellation_token_source_.cancel();
@@ -312,6 +413,9 @@ void StorageManager::close_gc_worker() {
 
 void StorageManager::hangup() {
   is_closed_ = true;
+  if (save_cached_stats_at_ != 0) {
+    save_cached_stats();
+  }
   close_stats_worker();
   close_gc_worker();
   hangup_shared();
@@ -331,7 +435,7 @@ void StorageManager::schedule_next_gc() {
   if (!G()->shared_config().get_option_boolean("use_storage_optimizer") &&
       !G()->parameters().enable_storage_optimizer) {
     next_gc_at_ = 0;
-    cancel_timeout();
+    update_timeout();
     LOG(INFO) << "No next file clean up is scheduled";
     return;
   }
@@ -350,18 +454,35 @@ void StorageManager::schedule_next_gc() {
 
   LOG(INFO) << "Schedule next file clean up in " << next_gc_in;
   next_gc_at_ = Time::now() + next_gc_in;
-  set_timeout_at(next_gc_at_);
+  update_timeout();
+}
+
+void StorageManager::update_timeout() {
+  auto timeout_at = next_gc_at_;
+  if (save_cached_stats_at_ != 0 && (timeout_at == 0 || save_cached_stats_at_ < timeout_at)) {
+    timeout_at = save_cached_stats_at_;
+  }
+  if (timeout_at == 0) {
+    cancel_timeout();
+  } else {
+    set_timeout_at(timeout_at);
+  }
 }
 
 void StorageManager::timeout_expired() {
-  if (next_gc_at_ == 0) {
-    return;
+  auto now = Time::now();
+  if (save_cached_stats_at_ != 0 && save_cached_stats_at_ <= now) {
+    save_cached_stats();
+  }
+  if (next_gc_at_ == 0 || next_gc_at_ > now) {
+    return update_timeout();
   }
   if (!pending_run_gc_[0].empty() || !pending_run_gc_[1].empty() || !pending_storage_stats_.empty()) {
-    set_timeout_in(60);
-    return;
+    next_gc_at_ = now + 60;
+    return update_timeout();
   }
   next_gc_at_ = 0;
+  update_timeout();
   run_gc({}, false, PromiseCreator::lambda([actor_id = actor_id(this)](Result<FileStats> r_stats) {
            if (!r_stats.is_error() || r_stats.error().code() != 500) {
              // do not save garbage collection timestamp if request was canceled
@@ -6,9 +6,11 @@
 //
 #pragma once
 
+#include "td/telegram/DialogId.h"
 #include "td/telegram/files/FileGcWorker.h"
 #include "td/telegram/files/FileStats.h"
 #include "td/telegram/files/FileStatsWorker.h"
+#include "td/telegram/files/FileType.h"
 #include "td/telegram/td_api.h"
 
 #include "td/actor/actor.h"
@@ -38,12 +40,14 @@ class StorageManager final : public Actor {
   void run_gc(FileGcParameters parameters, bool return_deleted_file_statistics, Promise<FileStats> promise);
   void update_use_storage_optimizer();
 
-  void on_new_file(int64 size, int64 real_size, int32 cnt);
+  void on_new_file(FileType file_type, DialogId owner_dialog_id, int64 size, int64 real_size, int32 cnt);
 
  private:
   static constexpr int GC_EACH = 60 * 60 * 24;  // 1 day
   static constexpr int GC_DELAY = 60;
   static constexpr int GC_RAND_DELAY = 60 * 15;
+  static constexpr int32 RECONCILE_STATS_EACH = 60 * 60 * 24;  // 1 day
+  static constexpr double SAVE_CACHED_STATS_DELAY = 10.0;
 
   ActorShared<> parent_;
 
@@ -58,6 +62,13 @@ class StorageManager final : public Actor {
 
   FileTypeStat fast_stat_;
 
+  // incrementally updated statistics split by owner dialog identifier, which are recalculated from time to time
+  FileStats cached_stats_{false, true};
+  bool has_cached_stats_{false};
+  bool is_reconciling_stats_{false};
+  int32 cached_stats_date_{0};
+  double save_cached_stats_at_{0};
+
   CancellationTokenSource stats_cancellation_token_source_;
   CancellationTokenSource gc_cancellation_token_source_;
 
@@ -68,6 +79,12 @@ class StorageManager final : public Actor {
 
   void save_fast_stat();
   void load_fast_stat();
+
+  void update_cached_stats(const FileStats &stats);
+  void drop_cached_stats();
+  void reconcile_cached_stats();
+  void save_cached_stats();
+  void load_cached_stats();
   static int64 get_database_size();
   static int64 get_language_pack_database_size();
   static int64 get_log_size();
@@ -99,6 +116,8 @@ class StorageManager final : public Actor {
   void save_last_gc_timestamp();
   void schedule_next_gc();
 
+  void update_timeout();
+
   void timeout_expired() final;
 };
 
@@ -55,6 +55,8 @@
 #include "td/telegram/LinkManager.h"
 #include "td/telegram/Location.h"
 #include "td/telegram/Logging.h"
+#include "td/telegram/MemoryGovernor.h"
+#include "td/telegram/MemoryStats.h"
 #include "td/telegram/MessageCopyOptions.h"
 #include "td/telegram/MessageEntity.h"
 #include "td/telegram/MessageId.h"
@@ -143,6 +145,8 @@
 #include "td/utils/Slice.h"
 #include "td/utils/SliceBuilder.h"
 #include "td/utils/Status.h"
+#include "td/utils/ThreadSafeCounter.h"
+#include "td/utils/Time.h"
 #include "td/utils/Timer.h"
 #include "td/utils/tl_parsers.h"
 #include "td/utils/utf8.h"
@@ -2700,6 +2704,16 @@ void Td::on_alarm_timeout(int64 alarm_id) {
     }
     return;
   }
+  if (alarm_id == QUEUE_DELAY_PROBE_ALARM_ID) {
+    if (!close_flag_) {
+      send_queue_delay_probe();
+    }
+    return;
+  }
+  if (alarm_id <= COALESCED_UPDATES_ALARM_ID && alarm_id > COALESCED_UPDATES_ALARM_ID - COALESCED_UPDATE_TYPE_COUNT) {
+    flush_coalesced_updates(static_cast<int32>(COALESCED_UPDATES_ALARM_ID - alarm_id));
+    return;
+  }
   if (alarm_id == PROMO_DATA_ALARM_ID) {
     if (!close_flag_ && !auth_manager_->is_bot()) {
       auto promise = PromiseCreator::lambda(
@@ -2722,6 +2736,41 @@ void Td::on_alarm_timeout(int64 alarm_id) {
   send_result(request_id, make_tl_object<td_api::ok>());
 }
 
+void Td::send_queue_delay_probe() {
+  queue_delay_probe_send_time_ = Time::now();
+  send_closure_later(actor_id(this), &Td::on_queue_delay_probe);
+}
+
+void Td::on_queue_delay_probe() {
+  queue_delay_ = Time::now() - queue_delay_probe_send_time_;
+  queue_delay_probe_send_time_ = 0.0;
+  if (!close_flag_ && G()->shared_config().get_option_integer("request_queue_delay_limit_ms") > 0) {
+    // the queue delay is measured only while it is needed
+    alarm_timeout_.set_timeout_in(QUEUE_DELAY_PROBE_ALARM_ID, QUEUE_DELAY_PROBE_PERIOD);
+  }
+}
+
+double Td::get_queue_delay() const {
+  if (queue_delay_probe_send_time_ > 0.0) {
+    // the probe is still waiting in the mailbox
+    return td::max(queue_delay_, Time::now() - queue_delay_probe_send_time_);
+  }
+  return queue_delay_;
+}
+
+bool Td::is_overloaded() {
+  auto max_queue_delay_ms = G()->shared_config().get_option_integer("request_queue_delay_limit_ms");
+  if (max_queue_delay_ms <= 0) {
+    return false;
+  }
+  if (queue_delay_probe_send_time_ == 0.0 && !alarm_timeout_.has_timeout(QUEUE_DELAY_PROBE_ALARM_ID)) {
+    // the queue delay wasn't measured recently
+    queue_delay_ = 0.0;
+    send_queue_delay_probe();
+  }
+  return get_queue_delay() * 1000 > static_cast<double>(max_queue_delay_ms);
+}
+
 void Td::on_online_updated(bool force, bool send_update) {
   if (close_flag_ >= 2 || !auth_manager_->is_authorized() || auth_manager_->is_bot()) {
     return;
@@ -2840,6 +2889,11 @@ bool Td::is_online() const {
   return is_online_;
 }
 
+bool Td::need_postpone_update_fetching() {
+  return td_options_.response_queue_stats != nullptr &&
+         td_options_.response_queue_stats->need_postpone_update_fetching();
+}
+
 void Td::set_is_online(bool is_online) {
   if (is_online == is_online_) {
     return;
@@ -2851,6 +2905,26 @@ void Td::set_is_online(bool is_online) {
   }
 }
 
+void Td::set_use_update_batches(bool use_update_batches) {
+  use_update_batches_ = use_update_batches;
+  if (!use_update_batches_) {
+    flush_pending_updates();
+  }
+}
+
+void Td::update_update_coalescing_delays() {
+  static const char *const option_names[COALESCED_UPDATE_TYPE_COUNT] = {
+      "update_file_coalescing_delay", "update_chat_action_coalescing_delay", "update_user_status_coalescing_delay",
+      "update_chat_online_member_count_coalescing_delay"};
+  for (int32 type = 0; type < COALESCED_UPDATE_TYPE_COUNT; type++) {
+    auto delay_ms = narrow_cast<int32>(G()->shared_config().get_option_integer(Slice(option_names[type])));
+    coalesced_updates_[type].delay_ms_ = delay_ms;
+    if (delay_ms == 0) {
+      flush_coalesced_updates(type);
+    }
+  }
+}
+
 void Td::set_is_bot_online(bool is_bot_online) {
   if (G()->shared_config().get_option_integer("session_count") > 1) {
     is_bot_online = false;
@@ -2913,6 +2987,7 @@ bool Td::is_synchronous_request(int32 id) {
     case td_api::setLogTagVerbosityLevel::ID:
     case td_api::getLogTagVerbosityLevel::ID:
     case td_api::addLogMessage::ID:
+    case td_api::getRuntimeMetrics::ID:
     case td_api::testReturnError::ID:
       return true;
     default:
@@ -2923,6 +2998,7 @@ bool Td::is_synchronous_request(int32 id) {
 bool Td::is_preinitialization_request(int32 id) {
   switch (id) {
     case td_api::getCurrentState::ID:
+    case td_api::setUpdateFilter::ID:
     case td_api::setAlarm::ID:
     case td_api::testUseUpdate::ID:
     case td_api::testCallEmpty::ID:
@@ -2934,6 +3010,7 @@ bool Td::is_preinitialization_request(int32 id) {
     case td_api::testCallVectorString::ID:
     case td_api::testCallVectorStringObject::ID:
     case td_api::testProxy::ID:
+    case td_api::getStartupStatistics::ID:
       return true;
     default:
       return false;
@@ -2962,6 +3039,7 @@ bool Td::is_preauthentication_request(int32 id) {
     case td_api::getNetworkStatistics::ID:
     case td_api::addNetworkStatistics::ID:
     case td_api::resetNetworkStatistics::ID:
+    case td_api::getNetworkRequestLatencyStatistics::ID:
     case td_api::getCountries::ID:
     case td_api::getCountryCode::ID:
     case td_api::getPhoneNumberInfo::ID:
@@ -2983,6 +3061,49 @@ bool Td::is_preauthentication_request(int32 id) {
   }
 }
 
+// requests, which can be rejected if Td is overloaded: searches, statistics and other non-interactive getters
+bool Td::is_low_priority_request(int32 id) {
+  switch (id) {
+    case td_api::searchMessages::ID:
+    case td_api::searchChatMessages::ID:
+    case td_api::searchSecretMessages::ID:
+    case td_api::searchCallMessages::ID:
+    case td_api::searchChatRecentLocationMessages::ID:
+    case td_api::searchPublicChats::ID:
+    case td_api::searchChatsOnServer::ID:
+    case td_api::searchChatsNearby::ID:
+    case td_api::searchChatMembers::ID:
+    case td_api::searchHashtags::ID:
+    case td_api::searchStickerSets::ID:
+    case td_api::searchInstalledStickerSets::ID:
+    case td_api::searchEmojis::ID:
+    case td_api::searchBackground::ID:
+    case td_api::getChatStatistics::ID:
+    case td_api::getMessageStatistics::ID:
+    case td_api::getStatisticalGraph::ID:
+    case td_api::getMessagePublicForwards::ID:
+    case td_api::getStorageStatistics::ID:
+    case td_api::getStorageStatisticsFast::ID:
+    case td_api::getDatabaseStatistics::ID:
+    case td_api::getNetworkStatistics::ID:
+    case td_api::getChatMessageCalendar::ID:
+    case td_api::getChatSparseMessagePositions::ID:
+    case td_api::getChatMessageCount::ID:
+    case td_api::getChatEventLog::ID:
+    case td_api::getSupergroupMembers::ID:
+    case td_api::getTopChats::ID:
+    case td_api::getRecentlyVisitedTMeUrls::ID:
+    case td_api::getTrendingStickerSets::ID:
+    case td_api::getRecommendedChatFilters::ID:
+    case td_api::getInactiveSupergroupChats::ID:
+    case td_api::getSuitableDiscussionChats::ID:
+    case td_api::getChatSponsoredMessage::ID:
+      return true;
+    default:
+      return false;
+  }
+}
+
 td_api::object_ptr<td_api::AuthorizationState> Td::get_fake_authorization_state_object() const {
   switch (state_) {
     case State::WaitParameters:
@@ -3028,7 +3149,8 @@ void Td::request(uint64 id, tl_object_ptr<td_api::Function> function) {
 
   VLOG(td_requests) << "Receive request " << id << ": " << to_string(function);
   int32 function_id = function->get_id();
-  if (is_synchronous_request(function_id)) {
+  auto &request_info = get_request_info(*function);
+  if (request_info.is_synchronous_) {
     // send response synchronously
     return send_result(id, static_request(std::move(function)));
   }
@@ -3061,10 +3183,10 @@ void Td::request(uint64 id, tl_object_ptr<td_api::Function> function) {
           return answer_ok_query(
               id, set_parameters(std::move(move_tl_object_as<td_api::setTdlibParameters>(function)->parameters_)));
         default:
-          if (is_preinitialization_request(function_id)) {
+          if (request_info.is_preinitialization_) {
             break;
           }
-          if (is_preauthentication_request(function_id)) {
+          if (request_info.is_preauthentication_) {
             pending_preauthentication_requests_.emplace_back(id, std::move(function));
             return;
           }
@@ -3089,10 +3211,10 @@ void Td::request(uint64 id, tl_object_ptr<td_api::Function> function) {
           send_closure(actor_id(this), &Td::destroy);
           return;
         default:
-          if (is_preinitialization_request(function_id)) {
+          if (request_info.is_preinitialization_) {
             break;
           }
-          if (is_preauthentication_request(function_id)) {
+          if (request_info.is_preauthentication_) {
             pending_preauthentication_requests_.emplace_back(id, std::move(function));
             return;
           }
@@ -3111,11 +3233,36 @@ void Td::request(uint64 id, tl_object_ptr<td_api::Function> function) {
       break;
   }
 
-  if ((auth_manager_ == nullptr || !auth_manager_->is_authorized()) && !is_preauthentication_request(function_id) &&
-      !is_preinitialization_request(function_id) && !is_authentication_request(function_id)) {
+  if ((auth_manager_ == nullptr || !auth_manager_->is_authorized()) && !request_info.is_preauthentication_ &&
+      !request_info.is_preinitialization_ && !request_info.is_authentication_) {
     return send_error_impl(id, make_error(401, "Unauthorized"));
   }
-  downcast_call(*function, [this, id](auto &request) { this->on_request(id, request); });
+  if (request_info.is_low_priority_ && is_overloaded()) {
+    LOG(INFO) << "Reject request " << id << " of type " << function_id << ", because queue delay is "
+              << get_queue_delay();
+    return send_error_impl(id, make_error(503, "Request rejected: TDLib is overloaded"));
+  }
+  request_info.handler_(this, id, *function);
+}
+
+const Td::RequestInfo &Td::get_request_info(td_api::Function &function) {
+  auto function_id = function.get_id();
+  auto it = request_infos_.find(function_id);
+  if (it != request_infos_.end()) {
+    return it->second;
+  }
+
+  RequestInfo request_info;
+  downcast_call(function, [&request_info](auto &request) {
+    request_info.handler_ = &Td::run_request_handler<std::decay_t<decltype(request)>>;
+  });
+  CHECK(request_info.handler_ != nullptr);
+  request_info.is_synchronous_ = is_synchronous_request(function_id);
+  request_info.is_preinitialization_ = is_preinitialization_request(function_id);
+  request_info.is_preauthentication_ = is_preauthentication_request(function_id);
+  request_info.is_authentication_ = is_authentication_request(function_id);
+  request_info.is_low_priority_ = is_low_priority_request(function_id);
+  return request_infos_.emplace(function_id, request_info).first->second;
 }
 
 td_api::object_ptr<td_api::Object> Td::static_request(td_api::object_ptr<td_api::Function> function) {
@@ -3221,10 +3368,38 @@ void Td::on_connection_state_changed(ConnectionState new_state) {
     return;
   }
   connection_state_ = new_state;
+  if (connection_state_ == ConnectionState::Ready) {
+    on_startup_phase_finished("connect");
+  }
 
   send_closure(actor_id(this), &Td::send_update, get_update_connection_state_object(connection_state_));
 }
 
+void Td::on_startup_phase_finished(Slice phase_name) {
+  for (auto &phase : startup_phases_) {
+    if (phase.first == phase_name) {
+      return;
+    }
+  }
+  auto now = Time::now();
+  auto previous_finish_time = startup_phases_.empty() ? startup_time_ : startup_phases_.back().second;
+  LOG(INFO) << "Startup phase " << phase_name << " finished in " << now - previous_finish_time
+            << " seconds; total startup time is " << now - startup_time_ << " seconds";
+  startup_phases_.emplace_back(phase_name.str(), now);
+}
+
+string Td::get_startup_statistics() const {
+  string result = "TDLib startup phases:\n";
+  auto previous_finish_time = startup_time_;
+  for (auto &phase : startup_phases_) {
+    result += PSTRING() << phase.first << ": finished after " << phase.second - startup_time_ << " seconds, took "
+                        << phase.second - previous_finish_time << " seconds\n";
+    previous_finish_time = phase.second;
+  }
+  result += PSTRING() << "Time since start: " << Time::now() - startup_time_ << " seconds\n";
+  return result;
+}
+
 void Td::start_up() {
   always_wait_for_mailbox();
 
@@ -3244,6 +3419,8 @@ void Td::start_up() {
   alarm_timeout_.set_callback(on_alarm_timeout_callback);
   alarm_timeout_.set_callback_data(static_cast<void *>(this));
 
+  startup_time_ = Time::now();
+
   CHECK(state_ == State::WaitParameters);
   send_update(td_api::make_object<td_api::updateOption>("version",
                                                         td_api::make_object<td_api::optionValueString>(TDLIB_VERSION)));
@@ -3450,6 +3627,10 @@ void Td::clear() {
   alarm_timeout_.cancel_timeout(PING_SERVER_ALARM_ID);
   alarm_timeout_.cancel_timeout(TERMS_OF_SERVICE_ALARM_ID);
   alarm_timeout_.cancel_timeout(PROMO_DATA_ALARM_ID);
+  alarm_timeout_.cancel_timeout(QUEUE_DELAY_PROBE_ALARM_ID);
+  for (int32 type = 0; type < COALESCED_UPDATE_TYPE_COUNT; type++) {
+    alarm_timeout_.cancel_timeout(COALESCED_UPDATES_ALARM_ID - type);
+  }
   LOG(DEBUG) << "Requests were answered" << timer;
 
   // close all pure actors
@@ -3467,6 +3648,8 @@ void Td::clear() {
   LOG(DEBUG) << "HashtagHints was cleared" << timer;
   language_pack_manager_.reset();
   LOG(DEBUG) << "LanguagePackManager was cleared" << timer;
+  memory_governor_.reset();
+  LOG(DEBUG) << "MemoryGovernor was cleared" << timer;
   net_stats_manager_.reset();
   LOG(DEBUG) << "NetStatsManager was cleared" << timer;
   password_manager_.reset();
@@ -3623,12 +3806,23 @@ void Td::complete_pending_preauthentication_requests(const T &func) {
 }
 
 Status Td::init(DbKey key) {
+  on_startup_phase_finished("receive_encryption_key");
+
   auto current_scheduler_id = Scheduler::instance()->sched_id();
   auto scheduler_count = Scheduler::instance()->sched_count();
 
   VLOG(td_init) << "Begin to init database";
   TdDb::Events events;
-  auto r_td_db = TdDb::open(min(current_scheduler_id + 1, scheduler_count - 1), parameters_, std::move(key), events);
+  auto database_scheduler_id = min(current_scheduler_id + 1, scheduler_count - 1);
+  // long message database reads are run on GC and slow network schedulers
+  vector<int32> database_read_scheduler_ids;
+  for (auto scheduler_id = current_scheduler_id + 2; scheduler_id <= current_scheduler_id + 3; scheduler_id++) {
+    if (scheduler_id < scheduler_count && scheduler_id != database_scheduler_id) {
+      database_read_scheduler_ids.push_back(scheduler_id);
+    }
+  }
+  auto r_td_db =
+      TdDb::open(database_scheduler_id, std::move(database_read_scheduler_ids), parameters_, std::move(key), events);
   if (r_td_db.is_error()) {
     LOG(WARNING) << "Failed to open database: " << r_td_db.error();
     return Status::Error(400, r_td_db.error().message());
@@ -3636,6 +3830,7 @@ Status Td::init(DbKey key) {
   LOG(INFO) << "Successfully inited database in " << tag("database_directory", parameters_.database_directory)
             << " and " << tag("files_directory", parameters_.files_directory);
   VLOG(td_init) << "Successfully inited database";
+  on_startup_phase_finished("open_database");
 
   G()->init(parameters_, actor_id(this), r_td_db.move_as_ok()).ensure();
 
@@ -3656,6 +3851,8 @@ Status Td::init(DbKey key) {
   options_.parameters = G()->shared_config().get_option_string("connection_parameters");
   options_.tz_offset = static_cast<int32>(G()->shared_config().get_option_integer("utc_time_offset"));
   options_.is_emulator = G()->shared_config().get_option_boolean("is_emulator");
+  use_update_batches_ = G()->shared_config().get_option_boolean("use_update_batches");
+  update_update_coalescing_delays();
   // options_.proxy = Proxy();
   G()->set_mtproto_header(make_unique<MtprotoHeader>(options_));
   G()->set_store_all_files_in_files_directory(
@@ -3669,6 +3866,7 @@ Status Td::init(DbKey key) {
     // pingProxy uses NetQueryDispatcher to get main_dc_id, so must be called after NetQueryDispatcher is created
     return id == td_api::pingProxy::ID;
   });
+  on_startup_phase_finished("init_network");
 
   VLOG(td_init) << "Create AuthManager";
   auth_manager_ = td::make_unique<AuthManager>(parameters_.api_id, parameters_.api_hash, create_reference());
@@ -3683,28 +3881,13 @@ Status Td::init(DbKey key) {
   storage_manager_ = create_actor<StorageManager>("StorageManager", create_reference(),
                                                   min(current_scheduler_id + 2, scheduler_count - 1));
   G()->set_storage_manager(storage_manager_.get());
+  on_startup_phase_finished("init_managers");
 
   VLOG(td_init) << "Send binlog events";
-  for (auto &event : events.user_events) {
-    contacts_manager_->on_binlog_user_event(std::move(event));
-  }
+  contacts_manager_->on_binlog_events(std::move(events.user_events), std::move(events.channel_events),
+                                     std::move(events.chat_events), std::move(events.secret_chat_events));
 
-  for (auto &event : events.channel_events) {
-    contacts_manager_->on_binlog_channel_event(std::move(event));
-  }
-
-  // chats may contain links to channels, so should be inited after
-  for (auto &event : events.chat_events) {
-    contacts_manager_->on_binlog_chat_event(std::move(event));
-  }
-
-  for (auto &event : events.secret_chat_events) {
-    contacts_manager_->on_binlog_secret_chat_event(std::move(event));
-  }
-
-  for (auto &event : events.web_page_events) {
-    web_pages_manager_->on_binlog_web_page_event(std::move(event));
-  }
+  web_pages_manager_->on_binlog_web_page_events(std::move(events.web_page_events));
 
   if (is_online_) {
     on_online_updated(true, true);
@@ -3743,6 +3926,7 @@ Status Td::init(DbKey key) {
                      std::move(events.to_notification_manager));
 
   send_closure(secret_chats_manager_, &SecretChatsManager::binlog_replay_finish);
+  on_startup_phase_finished("send_binlog_events");
 
   VLOG(td_init) << "Ping datacenter";
   if (!auth_manager_->is_authorized()) {
@@ -3756,6 +3940,9 @@ Status Td::init(DbKey key) {
   complete_pending_preauthentication_requests([](int32 id) { return true; });
 
   VLOG(td_init) << "Finish initialization";
+  if (auth_manager_->is_authorized()) {
+    on_startup_phase_finished("authorize");
+  }
 
   state_ = State::Run;
   return Status::OK();
@@ -3893,11 +4080,15 @@ void Td::init_file_manager() {
     explicit FileManagerContext(Td *td) : td_(td) {
     }
 
-    void on_new_file(int64 size, int64 real_size, int32 cnt) final {
-      send_closure(G()->storage_manager(), &StorageManager::on_new_file, size, real_size, cnt);
+    void on_new_file(FileType file_type, DialogId owner_dialog_id, int64 size, int64 real_size, int32 cnt) final {
+      send_closure(G()->storage_manager(), &StorageManager::on_new_file, file_type, owner_dialog_id, size, real_size,
+                   cnt);
     }
 
     void on_file_updated(FileId file_id) final {
+      if (td_->is_update_ignored(td_api::updateFile::ID)) {
+        return;
+      }
       send_closure(G()->td(), &Td::send_update,
                    make_tl_object<td_api::updateFile>(td_->file_manager_->get_file_object(file_id)));
     }
@@ -4005,22 +4196,84 @@ void Td::init_managers() {
 
   call_manager_ = create_actor<CallManager>("CallManager", create_reference());
   G()->set_call_manager(call_manager_.get());
-  change_phone_number_manager_ = create_actor<PhoneNumberManager>(
-      "ChangePhoneNumberManager", PhoneNumberManager::Type::ChangePhone, create_reference());
-  confirm_phone_number_manager_ = create_actor<PhoneNumberManager>(
-      "ConfirmPhoneNumberManager", PhoneNumberManager::Type::ConfirmPhone, create_reference());
   device_token_manager_ = create_actor<DeviceTokenManager>("DeviceTokenManager", create_reference());
-  hashtag_hints_ = create_actor<HashtagHints>("HashtagHints", "text", create_reference());
   language_pack_manager_ = create_actor<LanguagePackManager>("LanguagePackManager", create_reference());
   G()->set_language_pack_manager(language_pack_manager_.get());
+  memory_governor_ = create_actor<MemoryGovernor>("MemoryGovernor", create_reference());
+  auto memory_governor = memory_governor_.get().get_actor_unsafe();
+  memory_governor->register_manager(0, web_pages_manager_.get());
+  memory_governor->register_manager(1, contacts_manager_.get());
+  memory_governor->register_manager(2, messages_manager_.get());
   password_manager_ = create_actor<PasswordManager>("PasswordManager", create_reference());
   G()->set_password_manager(password_manager_.get());
-  privacy_manager_ = create_actor<PrivacyManager>("PrivacyManager", create_reference());
   secret_chats_manager_ = create_actor<SecretChatsManager>("SecretChatsManager", create_reference());
   G()->set_secret_chats_manager(secret_chats_manager_.get());
-  secure_manager_ = create_actor<SecureManager>("SecureManager", create_reference());
-  verify_phone_number_manager_ = create_actor<PhoneNumberManager>(
-      "VerifyPhoneNumberManager", PhoneNumberManager::Type::VerifyPhone, create_reference());
+  // HashtagHints, PrivacyManager, SecureManager and PhoneNumberManagers are created on first use,
+  // because most of them are never used by bots and during short sessions
+}
+
+ActorId<HashtagHints> Td::get_hashtag_hints() {
+  if (hashtag_hints_.empty() && close_flag_ == 0) {
+    hashtag_hints_ = create_actor<HashtagHints>("HashtagHints", "text", create_reference());
+  }
+  return hashtag_hints_.get();
+}
+
+ActorId<PrivacyManager> Td::get_privacy_manager() {
+  if (privacy_manager_.empty() && close_flag_ == 0) {
+    privacy_manager_ = create_actor<PrivacyManager>("PrivacyManager", create_reference());
+  }
+  return privacy_manager_.get();
+}
+
+ActorId<SecureManager> Td::get_secure_manager() {
+  if (secure_manager_.empty() && close_flag_ == 0) {
+    secure_manager_ = create_actor<SecureManager>("SecureManager", create_reference());
+  }
+  return secure_manager_.get();
+}
+
+ActorId<PhoneNumberManager> Td::get_change_phone_number_manager() {
+  if (change_phone_number_manager_.empty() && close_flag_ == 0) {
+    change_phone_number_manager_ = create_actor<PhoneNumberManager>(
+        "ChangePhoneNumberManager", PhoneNumberManager::Type::ChangePhone, create_reference());
+  }
+  return change_phone_number_manager_.get();
+}
+
+ActorId<PhoneNumberManager> Td::get_confirm_phone_number_manager() {
+  if (confirm_phone_number_manager_.empty() && close_flag_ == 0) {
+    confirm_phone_number_manager_ = create_actor<PhoneNumberManager>(
+        "ConfirmPhoneNumberManager", PhoneNumberManager::Type::ConfirmPhone, create_reference());
+  }
+  return confirm_phone_number_manager_.get();
+}
+
+ActorId<PhoneNumberManager> Td::get_verify_phone_number_manager() {
+  if (verify_phone_number_manager_.empty() && close_flag_ == 0) {
+    verify_phone_number_manager_ = create_actor<PhoneNumberManager>(
+        "VerifyPhoneNumberManager", PhoneNumberManager::Type::VerifyPhone, create_reference());
+  }
+  return verify_phone_number_manager_.get();
+}
+
+template <class T>
+static auto get_update_chat_id(const T &update, int) -> decltype(static_cast<int64>(update.chat_id_)) {
+  return update.chat_id_;
+}
+
+template <class T>
+static int64 get_update_chat_id(const T &update, long) {
+  return 0;
+}
+
+bool Td::is_update_chat_allowed(td_api::Update &update) const {
+  if (allowed_update_chat_ids_.empty()) {
+    return true;
+  }
+  int64 chat_id = 0;
+  downcast_call(update, [&chat_id](const auto &object) { chat_id = get_update_chat_id(object, 0); });
+  return chat_id == 0 || allowed_update_chat_ids_.count(chat_id) != 0;
 }
 
 void Td::send_update(tl_object_ptr<td_api::Update> &&object) {
@@ -4030,7 +4283,92 @@ void Td::send_update(tl_object_ptr<td_api::Update> &&object) {
     // just in case
     return;
   }
+  if (is_update_ignored(object_id) || !is_update_chat_allowed(*object)) {
+    return;
+  }
+
+  auto coalesced_update_type = get_coalesced_update_type(object_id);
+  if (coalesced_update_type >= 0 && coalesced_updates_[coalesced_update_type].delay_ms_ > 0 && close_flag_ == 0) {
+    return add_coalesced_update(coalesced_update_type, std::move(object));
+  }
+  do_send_update(std::move(object));
+}
+
+int32 Td::get_coalesced_update_type(int32 update_id) {
+  switch (update_id) {
+    case td_api::updateFile::ID:
+      return 0;
+    case td_api::updateChatAction::ID:
+      return 1;
+    case td_api::updateUserStatus::ID:
+      return 2;
+    case td_api::updateChatOnlineMemberCount::ID:
+      return 3;
+    default:
+      return -1;
+  }
+}
+
+static std::tuple<int64, int64, int64> get_coalesced_update_key(const td_api::Update &update) {
+  switch (update.get_id()) {
+    case td_api::updateFile::ID:
+      return std::make_tuple(static_cast<const td_api::updateFile &>(update).file_->id_, 0, 0);
+    case td_api::updateChatAction::ID: {
+      auto &chat_action = static_cast<const td_api::updateChatAction &>(update);
+      int64 sender_id = 0;
+      if (chat_action.sender_id_ != nullptr) {
+        if (chat_action.sender_id_->get_id() == td_api::messageSenderUser::ID) {
+          sender_id = static_cast<const td_api::messageSenderUser *>(chat_action.sender_id_.get())->user_id_;
+        } else {
+          sender_id = static_cast<const td_api::messageSenderChat *>(chat_action.sender_id_.get())->chat_id_;
+        }
+      }
+      return std::make_tuple(chat_action.chat_id_, chat_action.message_thread_id_, sender_id);
+    }
+    case td_api::updateUserStatus::ID:
+      return std::make_tuple(static_cast<const td_api::updateUserStatus &>(update).user_id_, 0, 0);
+    case td_api::updateChatOnlineMemberCount::ID:
+      return std::make_tuple(static_cast<const td_api::updateChatOnlineMemberCount &>(update).chat_id_, 0, 0);
+    default:
+      UNREACHABLE();
+      return {};
+  }
+}
 
+void Td::add_coalesced_update(int32 type, tl_object_ptr<td_api::Update> &&object) {
+  auto &coalesced_updates = coalesced_updates_[type];
+  auto it = coalesced_updates.update_pos_.emplace(get_coalesced_update_key(*object), coalesced_updates.updates_.size());
+  if (!it.second) {
+    // replace the previous update; the new update contains the latest state
+    coalesced_updates.updates_[it.first->second] = std::move(object);
+    return;
+  }
+  if (coalesced_updates.updates_.empty()) {
+    alarm_timeout_.set_timeout_in(COALESCED_UPDATES_ALARM_ID - type, coalesced_updates.delay_ms_ * 1e-3);
+  }
+  coalesced_updates.updates_.push_back(std::move(object));
+}
+
+void Td::flush_coalesced_updates(int32 type) {
+  auto &coalesced_updates = coalesced_updates_[type];
+  if (coalesced_updates.updates_.empty()) {
+    return;
+  }
+  alarm_timeout_.cancel_timeout(COALESCED_UPDATES_ALARM_ID - type);
+  auto updates = std::move(coalesced_updates.updates_);
+  coalesced_updates.updates_.clear();
+  coalesced_updates.update_pos_.clear();
+  for (auto &update : updates) {
+    do_send_update(std::move(update));
+  }
+}
+
+void Td::do_send_update(tl_object_ptr<td_api::Update> &&object) {
+  if (close_flag_ >= 5 && object->get_id() != td_api::updateAuthorizationState::ID) {
+    // just in case
+    return;
+  }
+  auto object_id = object->get_id();
   switch (object_id) {
     case td_api::updateChatThemes::ID:
     case td_api::updateFavoriteStickers::ID:
@@ -4061,7 +4399,65 @@ void Td::send_update(tl_object_ptr<td_api::Update> &&object) {
       VLOG(td_requests) << "Sending update: " << to_string(object);
   }
 
-  callback_->on_result(0, std::move(object));
+  if (!use_update_batches_ || object_id == td_api::updateAuthorizationState::ID) {
+    flush_pending_updates();
+    callback_->on_result(0, std::move(object));
+    return;
+  }
+
+  // drop previous pending updates, which are superseded by the new update
+  auto remove_superseded_update = [this](size_t &pos) {
+    if (pos < pending_updates_.size()) {
+      pending_updates_[pos] = nullptr;
+    }
+    pos = pending_updates_.size();
+  };
+  switch (object_id) {
+    case td_api::updateChatLastMessage::ID: {
+      auto chat_id = static_cast<const td_api::updateChatLastMessage *>(object.get())->chat_id_;
+      remove_superseded_update(
+          pending_chat_last_message_update_pos_.emplace(chat_id, pending_updates_.size()).first->second);
+      break;
+    }
+    case td_api::updateMessageInteractionInfo::ID: {
+      auto update = static_cast<const td_api::updateMessageInteractionInfo *>(object.get());
+      remove_superseded_update(
+          pending_message_interaction_info_update_pos_
+              .emplace(std::make_pair(update->chat_id_, update->message_id_), pending_updates_.size())
+              .first->second);
+      break;
+    }
+    default:
+      break;
+  }
+
+  if (pending_updates_.empty()) {
+    send_closure_later(actor_id(this), &Td::flush_pending_updates);
+  }
+  pending_updates_.push_back(std::move(object));
+}
+
+void Td::flush_pending_updates() {
+  if (pending_updates_.empty()) {
+    return;
+  }
+
+  vector<tl_object_ptr<td_api::Update>> updates;
+  updates.reserve(pending_updates_.size());
+  for (auto &update : pending_updates_) {
+    if (update != nullptr) {
+      updates.push_back(std::move(update));
+    }
+  }
+  pending_updates_.clear();
+  pending_chat_last_message_update_pos_.clear();
+  pending_message_interaction_info_update_pos_.clear();
+
+  if (updates.size() == 1) {
+    callback_->on_result(0, std::move(updates[0]));
+  } else {
+    callback_->on_result(0, td_api::make_object<td_api::updates>(std::move(updates)));
+  }
 }
 
 void Td::send_result(uint64 id, tl_object_ptr<td_api::Object> object) {
@@ -4077,6 +4473,8 @@ void Td::send_result(uint64 id, tl_object_ptr<td_api::Object> object) {
     if (object == nullptr) {
       object = make_tl_object<td_api::error>(404, "Not Found");
     }
+    // all updates must be received before the response to the request
+    flush_pending_updates();
     callback_->on_result(id, std::move(object));
   }
 }
@@ -4088,6 +4486,7 @@ void Td::send_error_impl(uint64 id, tl_object_ptr<td_api::error> error) {
   if (it != request_set_.end()) {
     request_set_.erase(it);
     VLOG(td_requests) << "Sending error for request " << id << ": " << oneline(to_string(error));
+    flush_pending_updates();
     callback_->on_error(id, std::move(error));
   }
 }
@@ -4204,6 +4603,7 @@ Status Td::fix_parameters(TdParameters &parameters) {
 
 Status Td::set_parameters(td_api::object_ptr<td_api::tdlibParameters> parameters) {
   VLOG(td_init) << "Begin to set TDLib parameters";
+  on_startup_phase_finished("receive_parameters");
   if (parameters == nullptr) {
     VLOG(td_init) << "Empty parameters";
     return Status::Error(400, "Parameters aren't specified");
@@ -4407,6 +4807,12 @@ void Td::on_request(uint64 id, const td_api::getCurrentState &request) {
   send_result(id, td_api::make_object<td_api::updates>(std::move(updates)));
 }
 
+void Td::on_request(uint64 id, const td_api::setUpdateFilter &request) {
+  allowed_update_types_ = std::unordered_set<int32>(request.update_types_.begin(), request.update_types_.end());
+  allowed_update_chat_ids_ = std::unordered_set<int64>(request.chat_ids_.begin(), request.chat_ids_.end());
+  send_closure(actor_id(this), &Td::send_result, id, td_api::make_object<td_api::ok>());
+}
+
 void Td::on_request(uint64 id, td_api::getPasswordState &request) {
   CHECK_IS_USER();
   CREATE_REQUEST_PROMISE();
@@ -4527,14 +4933,14 @@ void Td::on_request(uint64 id, td_api::registerDevice &request) {
 void Td::on_request(uint64 id, td_api::getUserPrivacySettingRules &request) {
   CHECK_IS_USER();
   CREATE_REQUEST_PROMISE();
-  send_closure(privacy_manager_, &PrivacyManager::get_privacy, std::move(request.setting_), std::move(promise));
+  send_closure(get_privacy_manager(), &PrivacyManager::get_privacy, std::move(request.setting_), std::move(promise));
 }
 
 void Td::on_request(uint64 id, td_api::setUserPrivacySettingRules &request) {
   CHECK_IS_USER();
   CREATE_OK_REQUEST_PROMISE();
-  send_closure(privacy_manager_, &PrivacyManager::set_privacy, std::move(request.setting_), std::move(request.rules_),
-               std::move(promise));
+  send_closure(get_privacy_manager(), &PrivacyManager::set_privacy, std::move(request.setting_),
+               std::move(request.rules_), std::move(promise));
 }
 
 void Td::on_request(uint64 id, const td_api::getAccountTtl &request) {
@@ -4568,19 +4974,19 @@ void Td::on_request(uint64 id, td_api::deleteAccount &request) {
 void Td::on_request(uint64 id, td_api::changePhoneNumber &request) {
   CHECK_IS_USER();
   CLEAN_INPUT_STRING(request.phone_number_);
-  send_closure(change_phone_number_manager_, &PhoneNumberManager::set_phone_number, id,
+  send_closure(get_change_phone_number_manager(), &PhoneNumberManager::set_phone_number, id,
                std::move(request.phone_number_), std::move(request.settings_));
 }
 
 void Td::on_request(uint64 id, td_api::checkChangePhoneNumberCode &request) {
   CHECK_IS_USER();
   CLEAN_INPUT_STRING(request.code_);
-  send_closure(change_phone_number_manager_, &PhoneNumberManager::check_code, id, std::move(request.code_));
+  send_closure(get_change_phone_number_manager(), &PhoneNumberManager::check_code, id, std::move(request.code_));
 }
 
 void Td::on_request(uint64 id, td_api::resendChangePhoneNumberCode &request) {
   CHECK_IS_USER();
-  send_closure(change_phone_number_manager_, &PhoneNumberManager::resend_authentication_code, id);
+  send_closure(get_change_phone_number_manager(), &PhoneNumberManager::resend_authentication_code, id);
 }
 
 void Td::on_request(uint64 id, const td_api::getActiveSessions &request) {
@@ -4802,6 +5208,31 @@ void Td::on_request(uint64 id, td_api::getDatabaseStatistics &request) {
   send_closure(storage_manager_, &StorageManager::get_database_stats, std::move(query_promise));
 }
 
+void Td::on_request(uint64 id, const td_api::getMemoryStatistics &request) {
+  MemoryStats stats("ContactsManager");
+  contacts_manager_->memory_stats(stats);
+  stats.set_owner("FileManager");
+  file_manager_->memory_stats(stats);
+  stats.set_owner("LanguagePackManager");
+  LanguagePackManager::memory_stats(stats);
+  stats.set_owner("MessagesManager");
+  messages_manager_->memory_stats(stats);
+  stats.set_owner("StickersManager");
+  stickers_manager_->memory_stats(stats);
+  stats.set_owner("WebPagesManager");
+  web_pages_manager_->memory_stats(stats);
+
+  // buffers are shared between all Td instances
+  stats.set_owner("BufferAllocator");
+  size_t buffer_count = 0;
+  for (auto &size_class_stats : BufferAllocator::get_size_class_stats()) {
+    buffer_count += static_cast<size_t>(size_class_stats.live_count);
+  }
+  stats.add("buffers", buffer_count, BufferAllocator::get_buffer_mem());
+
+  send_closure(actor_id(this), &Td::send_result, id, stats.get_memory_statistics_object());
+}
+
 void Td::on_request(uint64 id, td_api::optimizeStorage &request) {
   std::vector<FileType> file_types;
   for (auto &file_type : request.file_types_) {
@@ -4865,6 +5296,16 @@ void Td::on_request(uint64 id, td_api::resetNetworkStatistics &request) {
   promise.set_value(Unit());
 }
 
+void Td::on_request(uint64 id, const td_api::getNetworkRequestLatencyStatistics &request) {
+  CHECK(td_options_.net_query_stats != nullptr);
+  td_options_.net_query_stats->dump_latency_statistics();
+  send_result(id, td_api::make_object<td_api::text>(td_options_.net_query_stats->get_latency_statistics()));
+}
+
+void Td::on_request(uint64 id, const td_api::getStartupStatistics &request) {
+  send_result(id, td_api::make_object<td_api::text>(get_startup_statistics()));
+}
+
 void Td::on_request(uint64 id, td_api::addNetworkStatistics &request) {
   if (request.entry_ == nullptr) {
     return send_error_raw(id, 400, "Network statistics entry must be non-empty");
@@ -4978,7 +5419,21 @@ void Td::on_request(uint64 id, const td_api::loadChats &request) {
 void Td::on_request(uint64 id, const td_api::getChats &request) {
   CHECK_IS_USER();
   CREATE_REQUEST_PROMISE();
-  messages_manager_->get_dialogs_from_list(DialogListId(request.chat_list_), request.limit_, std::move(promise));
+  auto query_promise = PromiseCreator::lambda([actor_id = actor_id(this), promise = std::move(promise)](
+                                                  Result<td_api::object_ptr<td_api::chats>> result) mutable {
+    if (result.is_ok()) {
+      send_closure(actor_id, &Td::on_startup_phase_finished, Slice("get_chats"));
+    }
+    promise.set_result(std::move(result));
+  });
+  messages_manager_->get_dialogs_from_list(DialogListId(request.chat_list_), request.limit_,
+                                           std::move(query_promise));
+}
+
+void Td::on_request(uint64 id, const td_api::getChatListSnapshot &request) {
+  CHECK_IS_USER();
+  CREATE_REQUEST_PROMISE();
+  messages_manager_->get_chat_list_snapshot(DialogListId(request.chat_list_), request.limit_, std::move(promise));
 }
 
 void Td::on_request(uint64 id, td_api::searchPublicChat &request) {
@@ -5355,6 +5810,17 @@ void Td::on_request(uint64 id, td_api::sendMessage &request) {
   }
 }
 
+void Td::on_request(uint64 id, td_api::sendMessageBroadcast &request) {
+  auto r_results = messages_manager_->send_message_broadcast(
+      transform(request.chat_ids_, [](int64 chat_id) { return DialogId(chat_id); }), std::move(request.options_),
+      std::move(request.input_message_content_));
+  if (r_results.is_error()) {
+    send_closure(actor_id(this), &Td::send_error, id, r_results.move_as_error());
+  } else {
+    send_closure(actor_id(this), &Td::send_result, id, r_results.move_as_ok());
+  }
+}
+
 void Td::on_request(uint64 id, td_api::sendMessageAlbum &request) {
   DialogId dialog_id(request.chat_id_);
   auto r_message_ids = messages_manager_->send_message_group(
@@ -7303,7 +7769,7 @@ void Td::on_request(uint64 id, td_api::getPassportElement &request) {
     return send_error_raw(id, 400, "Type must be non-empty");
   }
   CREATE_REQUEST_PROMISE();
-  send_closure(secure_manager_, &SecureManager::get_secure_value, std::move(request.password_),
+  send_closure(get_secure_manager(), &SecureManager::get_secure_value, std::move(request.password_),
                get_secure_value_type_td_api(request.type_), std::move(promise));
 }
 
@@ -7311,7 +7777,7 @@ void Td::on_request(uint64 id, td_api::getAllPassportElements &request) {
   CHECK_IS_USER();
   CLEAN_INPUT_STRING(request.password_);
   CREATE_REQUEST_PROMISE();
-  send_closure(secure_manager_, &SecureManager::get_all_secure_values, std::move(request.password_),
+  send_closure(get_secure_manager(), &SecureManager::get_all_secure_values, std::move(request.password_),
                std::move(promise));
 }
 
@@ -7323,7 +7789,7 @@ void Td::on_request(uint64 id, td_api::setPassportElement &request) {
     return send_error_raw(id, 400, r_secure_value.error().message());
   }
   CREATE_REQUEST_PROMISE();
-  send_closure(secure_manager_, &SecureManager::set_secure_value, std::move(request.password_),
+  send_closure(get_secure_manager(), &SecureManager::set_secure_value, std::move(request.password_),
                r_secure_value.move_as_ok(), std::move(promise));
 }
 
@@ -7333,7 +7799,7 @@ void Td::on_request(uint64 id, const td_api::deletePassportElement &request) {
     return send_error_raw(id, 400, "Type must be non-empty");
   }
   CREATE_OK_REQUEST_PROMISE();
-  send_closure(secure_manager_, &SecureManager::delete_secure_value, get_secure_value_type_td_api(request.type_),
+  send_closure(get_secure_manager(), &SecureManager::delete_secure_value, get_secure_value_type_td_api(request.type_),
                std::move(promise));
 }
 
@@ -7344,7 +7810,7 @@ void Td::on_request(uint64 id, td_api::setPassportElementErrors &request) {
     return send_error_raw(id, r_input_user.error().code(), r_input_user.error().message());
   }
   CREATE_OK_REQUEST_PROMISE();
-  send_closure(secure_manager_, &SecureManager::set_secure_value_errors, this, r_input_user.move_as_ok(),
+  send_closure(get_secure_manager(), &SecureManager::set_secure_value_errors, this, r_input_user.move_as_ok(),
                std::move(request.errors_), std::move(promise));
 }
 
@@ -7352,26 +7818,26 @@ void Td::on_request(uint64 id, td_api::getPreferredCountryLanguage &request) {
   CHECK_IS_USER();
   CLEAN_INPUT_STRING(request.country_code_);
   CREATE_REQUEST_PROMISE();
-  send_closure(secure_manager_, &SecureManager::get_preferred_country_language, std::move(request.country_code_),
+  send_closure(get_secure_manager(), &SecureManager::get_preferred_country_language, std::move(request.country_code_),
                std::move(promise));
 }
 
 void Td::on_request(uint64 id, td_api::sendPhoneNumberVerificationCode &request) {
   CHECK_IS_USER();
   CLEAN_INPUT_STRING(request.phone_number_);
-  send_closure(verify_phone_number_manager_, &PhoneNumberManager::set_phone_number, id,
+  send_closure(get_verify_phone_number_manager(), &PhoneNumberManager::set_phone_number, id,
                std::move(request.phone_number_), std::move(request.settings_));
 }
 
 void Td::on_request(uint64 id, const td_api::resendPhoneNumberVerificationCode &request) {
   CHECK_IS_USER();
-  send_closure(verify_phone_number_manager_, &PhoneNumberManager::resend_authentication_code, id);
+  send_closure(get_verify_phone_number_manager(), &PhoneNumberManager::resend_authentication_code, id);
 }
 
 void Td::on_request(uint64 id, td_api::checkPhoneNumberVerificationCode &request) {
   CHECK_IS_USER();
   CLEAN_INPUT_STRING(request.code_);
-  send_closure(verify_phone_number_manager_, &PhoneNumberManager::check_code, id, std::move(request.code_));
+  send_closure(get_verify_phone_number_manager(), &PhoneNumberManager::check_code, id, std::move(request.code_));
 }
 
 void Td::on_request(uint64 id, td_api::sendEmailAddressVerificationCode &request) {
@@ -7409,15 +7875,16 @@ void Td::on_request(uint64 id, td_api::getPassportAuthorizationForm &request) {
     return send_error_raw(id, 400, "Nonce must be non-empty");
   }
   CREATE_REQUEST_PROMISE();
-  send_closure(secure_manager_, &SecureManager::get_passport_authorization_form, bot_user_id, std::move(request.scope_),
-               std::move(request.public_key_), std::move(request.nonce_), std::move(promise));
+  send_closure(get_secure_manager(), &SecureManager::get_passport_authorization_form, bot_user_id,
+               std::move(request.scope_), std::move(request.public_key_), std::move(request.nonce_),
+               std::move(promise));
 }
 
 void Td::on_request(uint64 id, td_api::getPassportAuthorizationFormAvailableElements &request) {
   CHECK_IS_USER();
   CLEAN_INPUT_STRING(request.password_);
   CREATE_REQUEST_PROMISE();
-  send_closure(secure_manager_, &SecureManager::get_passport_authorization_form_available_elements,
+  send_closure(get_secure_manager(), &SecureManager::get_passport_authorization_form_available_elements,
                request.autorization_form_id_, std::move(request.password_), std::move(promise));
 }
 
@@ -7430,7 +7897,7 @@ void Td::on_request(uint64 id, td_api::sendPassportAuthorizationForm &request) {
   }
 
   CREATE_OK_REQUEST_PROMISE();
-  send_closure(secure_manager_, &SecureManager::send_passport_authorization_form, request.autorization_form_id_,
+  send_closure(get_secure_manager(), &SecureManager::send_passport_authorization_form, request.autorization_form_id_,
                get_secure_value_types_td_api(request.types_), std::move(promise));
 }
 
@@ -7438,19 +7905,19 @@ void Td::on_request(uint64 id, td_api::sendPhoneNumberConfirmationCode &request)
   CHECK_IS_USER();
   CLEAN_INPUT_STRING(request.phone_number_);
   CLEAN_INPUT_STRING(request.hash_);
-  send_closure(confirm_phone_number_manager_, &PhoneNumberManager::set_phone_number_and_hash, id,
+  send_closure(get_confirm_phone_number_manager(), &PhoneNumberManager::set_phone_number_and_hash, id,
                std::move(request.hash_), std::move(request.phone_number_), std::move(request.settings_));
 }
 
 void Td::on_request(uint64 id, const td_api::resendPhoneNumberConfirmationCode &request) {
   CHECK_IS_USER();
-  send_closure(confirm_phone_number_manager_, &PhoneNumberManager::resend_authentication_code, id);
+  send_closure(get_confirm_phone_number_manager(), &PhoneNumberManager::resend_authentication_code, id);
 }
 
 void Td::on_request(uint64 id, td_api::checkPhoneNumberConfirmationCode &request) {
   CHECK_IS_USER();
   CLEAN_INPUT_STRING(request.code_);
-  send_closure(confirm_phone_number_manager_, &PhoneNumberManager::check_code, id, std::move(request.code_));
+  send_closure(get_confirm_phone_number_manager(), &PhoneNumberManager::check_code, id, std::move(request.code_));
 }
 
 void Td::on_request(uint64 id, const td_api::getSupportUser &request) {
@@ -7550,7 +8017,7 @@ void Td::on_request(uint64 id, td_api::searchHashtags &request) {
           promise.set_value(make_tl_object<td_api::hashtags>(result.move_as_ok()));
         }
       });
-  send_closure(hashtag_hints_, &HashtagHints::query, std::move(request.prefix_), request.limit_,
+  send_closure(get_hashtag_hints(), &HashtagHints::query, std::move(request.prefix_), request.limit_,
                std::move(query_promise));
 }
 
@@ -7558,7 +8025,7 @@ void Td::on_request(uint64 id, td_api::removeRecentHashtag &request) {
   CHECK_IS_USER();
   CLEAN_INPUT_STRING(request.hashtag_);
   CREATE_OK_REQUEST_PROMISE();
-  send_closure(hashtag_hints_, &HashtagHints::remove_hashtag, std::move(request.hashtag_), std::move(promise));
+  send_closure(get_hashtag_hints(), &HashtagHints::remove_hashtag, std::move(request.hashtag_), std::move(promise));
 }
 
 void Td::on_request(uint64 id, td_api::acceptTermsOfService &request) {
@@ -7776,6 +8243,10 @@ void Td::on_request(uint64 id, const td_api::addLogMessage &request) {
   UNREACHABLE();
 }
 
+void Td::on_request(uint64 id, const td_api::getRuntimeMetrics &request) {
+  UNREACHABLE();
+}
+
 td_api::object_ptr<td_api::Object> Td::do_static_request(const td_api::getTextEntities &request) {
   if (!check_utf8(request.text_)) {
     return make_error(400, "Text must be encoded in UTF-8");
@@ -7983,6 +8454,14 @@ td_api::object_ptr<td_api::Object> Td::do_static_request(const td_api::addLogMes
   return td_api::make_object<td_api::ok>();
 }
 
+td_api::object_ptr<td_api::Object> Td::do_static_request(const td_api::getRuntimeMetrics &request) {
+  string result;
+  NamedThreadSafeCounter::get_default().for_each([&result](Slice name, int64 value) {
+    result += PSTRING() << "# TYPE td_" << name << " counter\ntd_" << name << ' ' << value << '\n';
+  });
+  return td_api::make_object<td_api::text>(std::move(result));
+}
+
 td_api::object_ptr<td_api::Object> Td::do_static_request(td_api::testReturnError &request) {
   if (request.error_ == nullptr) {
     return td_api::make_object<td_api::error>(404, "Not Found");
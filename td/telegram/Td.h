@@ -11,6 +11,7 @@
 #include "td/telegram/net/MtprotoHeader.h"
 #include "td/telegram/net/NetQuery.h"
 #include "td/telegram/net/NetQueryStats.h"
+#include "td/telegram/ResponseQueueStats.h"
 #include "td/telegram/td_api.h"
 #include "td/telegram/TdCallback.h"
 #include "td/telegram/TdParameters.h"
@@ -30,7 +31,10 @@
 #include "td/utils/Slice.h"
 #include "td/utils/Status.h"
 
+#include <array>
+#include <map>
 #include <memory>
+#include <tuple>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -56,6 +60,7 @@ class InlineQueriesManager;
 class HashtagHints;
 class LanguagePackManager;
 class LinkManager;
+class MemoryGovernor;
 class MessagesManager;
 class NetStatsManager;
 class NotificationManager;
@@ -102,6 +107,7 @@ class Td final : public Actor {
 
   struct Options {
     std::shared_ptr<NetQueryStats> net_query_stats;
+    std::shared_ptr<ResponseQueueStats> response_queue_stats;
   };
 
   Td(unique_ptr<TdCallback> callback, Options options);
@@ -128,6 +134,13 @@ class Td final : public Actor {
 
   void set_is_bot_online(bool is_bot_online);
 
+  void set_use_update_batches(bool use_update_batches);
+
+  void update_update_coalescing_delays();
+
+  // returns true, if the client doesn't keep up with received updates and fetching of missed updates must be postponed
+  bool need_postpone_update_fetching();
+
   template <class ActorT, class... ArgsT>
   ActorId<ActorT> create_net_actor(ArgsT &&...args) {
     LOG_CHECK(close_flag_ < 1) << close_flag_
@@ -203,6 +216,7 @@ class Td final : public Actor {
   ActorOwn<DeviceTokenManager> device_token_manager_;
   ActorOwn<HashtagHints> hashtag_hints_;
   ActorOwn<LanguagePackManager> language_pack_manager_;
+  ActorOwn<MemoryGovernor> memory_governor_;
   ActorOwn<NetStatsManager> net_stats_manager_;
   ActorOwn<PasswordManager> password_manager_;
   ActorOwn<PrivacyManager> privacy_manager_;
@@ -253,6 +267,24 @@ class Td final : public Actor {
 
   void send_update(tl_object_ptr<td_api::Update> &&object);
 
+  // records finish time of a startup phase, which began when the previous startup phase finished
+  // only the first finish of each phase is recorded
+  void on_startup_phase_finished(Slice phase_name);
+
+  // returns true, if updates of the type must not be sent; it is cheaper to check this before creating the update
+  bool is_update_ignored(int32 update_id) const {
+    return !allowed_update_types_.empty() && update_id != td_api::updateAuthorizationState::ID &&
+           allowed_update_types_.count(update_id) == 0;
+  }
+
+  // managers, which have no startup work, are created on first use; returns empty actor identifier while closing
+  ActorId<HashtagHints> get_hashtag_hints();
+  ActorId<PrivacyManager> get_privacy_manager();
+  ActorId<SecureManager> get_secure_manager();
+  ActorId<PhoneNumberManager> get_change_phone_number_manager();
+  ActorId<PhoneNumberManager> get_confirm_phone_number_manager();
+  ActorId<PhoneNumberManager> get_verify_phone_number_manager();
+
   static td_api::object_ptr<td_api::Object> static_request(td_api::object_ptr<td_api::Function> function);
 
  private:
@@ -261,9 +293,26 @@ class Td final : public Actor {
   static constexpr int32 PING_SERVER_TIMEOUT = 300;
   static constexpr int64 TERMS_OF_SERVICE_ALARM_ID = -2;
   static constexpr int64 PROMO_DATA_ALARM_ID = -3;
+  static constexpr int64 COALESCED_UPDATES_ALARM_ID = -4;  // -4 - coalesced update type
+  static constexpr int64 QUEUE_DELAY_PROBE_ALARM_ID = -8;  // after all coalesced update types
+  static constexpr double QUEUE_DELAY_PROBE_PERIOD = 1.0;
 
   void on_connection_state_changed(ConnectionState new_state);
 
+  string get_startup_statistics() const;
+
+  void flush_pending_updates();
+
+  bool is_update_chat_allowed(td_api::Update &update) const;
+
+  void do_send_update(tl_object_ptr<td_api::Update> &&object);
+
+  static int32 get_coalesced_update_type(int32 update_id);
+
+  void add_coalesced_update(int32 type, tl_object_ptr<td_api::Update> &&object);
+
+  void flush_coalesced_updates(int32 type);
+
   void send_result(uint64 id, tl_object_ptr<td_api::Object> object);
   void send_error(uint64 id, Status error);
   void send_error_impl(uint64 id, tl_object_ptr<td_api::error> error);
@@ -292,6 +341,9 @@ class Td final : public Actor {
 
   ConnectionState connection_state_ = ConnectionState::Empty;
 
+  double startup_time_ = 0.0;
+  vector<std::pair<string, double>> startup_phases_;  // phase name and its finish time
+
   std::unordered_multiset<uint64> request_set_;
   int actor_refcnt_ = 0;
   int request_actor_refcnt_ = 0;
@@ -310,10 +362,33 @@ class Td final : public Actor {
   bool is_bot_online_ = false;
   NetQueryRef update_status_query_;
 
+  // updates collected during the current scheduler tick, if update batches are enabled
+  bool use_update_batches_ = false;
+  vector<tl_object_ptr<td_api::Update>> pending_updates_;
+  std::unordered_map<int64, size_t> pending_chat_last_message_update_pos_;                 // chat_id -> position
+  std::map<std::pair<int64, int64>, size_t> pending_message_interaction_info_update_pos_;  // message -> position
+
+  // high-frequency updates, for which only the last update with the same key is sent at the end of each delay
+  static constexpr int32 COALESCED_UPDATE_TYPE_COUNT = 4;
+  struct CoalescedUpdates {
+    int32 delay_ms_ = 0;
+    vector<tl_object_ptr<td_api::Update>> updates_;
+    std::map<std::tuple<int64, int64, int64>, size_t> update_pos_;  // key -> position
+  };
+  std::array<CoalescedUpdates, COALESCED_UPDATE_TYPE_COUNT> coalesced_updates_;
+
+  // filter set by setUpdateFilter; empty sets allow everything
+  std::unordered_set<int32> allowed_update_types_;
+  std::unordered_set<int64> allowed_update_chat_ids_;
+
   int64 alarm_id_ = 1;
   std::unordered_map<int64, uint64> pending_alarms_;
   MultiTimeout alarm_timeout_{"AlarmTimeout"};
 
+  // time spent in the Td mailbox by the last probe and send time of the probe, which wasn't processed yet
+  double queue_delay_ = 0.0;
+  double queue_delay_probe_send_time_ = 0.0;
+
   TermsOfService pending_terms_of_service_;
 
   struct DownloadInfo {
@@ -333,6 +408,14 @@ class Td final : public Actor {
   static void on_alarm_timeout_callback(void *td_ptr, int64 alarm_id);
   void on_alarm_timeout(int64 alarm_id);
 
+  void send_queue_delay_probe();
+
+  void on_queue_delay_probe();
+
+  double get_queue_delay() const;
+
+  bool is_overloaded();
+
   td_api::object_ptr<td_api::updateTermsOfService> get_update_terms_of_service_object() const;
 
   void on_get_terms_of_service(Result<std::pair<int32, TermsOfService>> result, bool dummy);
@@ -386,6 +469,26 @@ class Td final : public Actor {
 
   static bool is_preauthentication_request(int32 id);
 
+  static bool is_low_priority_request(int32 id);
+
+  // request kind and handler, cached for each request type to avoid repeated switches over the function identifier
+  struct RequestInfo {
+    void (*handler_)(Td *td, uint64 id, td_api::Function &function) = nullptr;
+    bool is_synchronous_ = false;
+    bool is_preinitialization_ = false;
+    bool is_preauthentication_ = false;
+    bool is_authentication_ = false;
+    bool is_low_priority_ = false;
+  };
+  std::unordered_map<int32, RequestInfo> request_infos_;
+
+  const RequestInfo &get_request_info(td_api::Function &function);
+
+  template <class T>
+  static void run_request_handler(Td *td, uint64 id, td_api::Function &function) {
+    td->on_request(id, static_cast<T &>(function));
+  }
+
   template <class T>
   void on_request(uint64 id, const T &request) = delete;
 
@@ -427,6 +530,8 @@ class Td final : public Actor {
 
   void on_request(uint64 id, const td_api::getCurrentState &request);
 
+  void on_request(uint64 id, const td_api::setUpdateFilter &request);
+
   void on_request(uint64 id, td_api::getPasswordState &request);
 
   void on_request(uint64 id, td_api::setPassword &request);
@@ -545,12 +650,18 @@ class Td final : public Actor {
 
   void on_request(uint64 id, td_api::getDatabaseStatistics &request);
 
+  void on_request(uint64 id, const td_api::getMemoryStatistics &request);
+
   void on_request(uint64 id, td_api::optimizeStorage &request);
 
   void on_request(uint64 id, td_api::getNetworkStatistics &request);
 
   void on_request(uint64 id, td_api::resetNetworkStatistics &request);
 
+  void on_request(uint64 id, const td_api::getNetworkRequestLatencyStatistics &request);
+
+  void on_request(uint64 id, const td_api::getStartupStatistics &request);
+
   void on_request(uint64 id, td_api::addNetworkStatistics &request);
 
   void on_request(uint64 id, const td_api::setNetworkType &request);
@@ -567,6 +678,8 @@ class Td final : public Actor {
 
   void on_request(uint64 id, const td_api::getChats &request);
 
+  void on_request(uint64 id, const td_api::getChatListSnapshot &request);
+
   void on_request(uint64 id, td_api::searchPublicChat &request);
 
   void on_request(uint64 id, td_api::searchPublicChats &request);
@@ -675,6 +788,8 @@ class Td final : public Actor {
 
   void on_request(uint64 id, td_api::sendMessageAlbum &request);
 
+  void on_request(uint64 id, td_api::sendMessageBroadcast &request);
+
   void on_request(uint64 id, td_api::sendBotStartMessage &request);
 
   void on_request(uint64 id, td_api::sendInlineQueryResultMessage &request);
@@ -1303,6 +1418,8 @@ class Td final : public Actor {
 
   void on_request(uint64 id, const td_api::addLogMessage &request);
 
+  void on_request(uint64 id, const td_api::getRuntimeMetrics &request);
+
   // test
   void on_request(uint64 id, const td_api::testNetwork &request);
   void on_request(uint64 id, td_api::testProxy &request);
@@ -1343,6 +1460,7 @@ class Td final : public Actor {
   static td_api::object_ptr<td_api::Object> do_static_request(const td_api::setLogTagVerbosityLevel &request);
   static td_api::object_ptr<td_api::Object> do_static_request(const td_api::getLogTagVerbosityLevel &request);
   static td_api::object_ptr<td_api::Object> do_static_request(const td_api::addLogMessage &request);
+  static td_api::object_ptr<td_api::Object> do_static_request(const td_api::getRuntimeMetrics &request);
   static td_api::object_ptr<td_api::Object> do_static_request(td_api::testReturnError &request);
 
   static DbKey as_db_key(string key);
@@ -31,6 +31,7 @@
 #include "td/utils/logging.h"
 #include "td/utils/misc.h"
 #include "td/utils/port/path.h"
+#include "td/utils/port/thread.h"
 #include "td/utils/Random.h"
 #include "td/utils/SliceBuilder.h"
 #include "td/utils/StringBuilder.h"
@@ -145,6 +146,16 @@ Status init_binlog(Binlog &binlog, string path, BinlogKeyValue<Binlog> &binlog_p
   return Status::OK();
 }
 
+// opens the database and applies connection settings without touching the schema
+Result<SqliteDb> open_sqlite_db(CSlice path, const DbKey &key, const DbKey &old_key,
+                                const SqliteDb::PerformanceProfile &profile) {
+  TRY_RESULT(db, SqliteDb::change_key(path, true, key, old_key));
+  TRY_STATUS(db.exec("PRAGMA journal_mode=WAL"));
+  TRY_STATUS(db.exec("PRAGMA secure_delete=1"));
+  TRY_STATUS(db.set_performance_profile(profile));
+  return std::move(db);
+}
+
 }  // namespace
 
 std::shared_ptr<FileDbInterface> TdDb::get_file_db_shared() {
@@ -283,8 +294,9 @@ void TdDb::do_close(Promise<> on_finished, bool destroy_flag) {
   lock.set_value(Unit());
 }
 
-Status TdDb::init_sqlite(int32 scheduler_id, const TdParameters &parameters, const DbKey &key, const DbKey &old_key,
-                         BinlogKeyValue<Binlog> &binlog_pmc) {
+Status TdDb::init_sqlite(int32 scheduler_id, const vector<int32> &read_scheduler_ids, const TdParameters &parameters,
+                         const DbKey &key, const DbKey &old_key, BinlogKeyValue<Binlog> &binlog_pmc,
+                         SqliteDb opened_db) {
   CHECK(!parameters.use_message_db || parameters.use_chat_info_db);
   CHECK(!parameters.use_chat_info_db || parameters.use_file_db);
 
@@ -300,12 +312,13 @@ Status TdDb::init_sqlite(int32 scheduler_id, const TdParameters &parameters, con
   }
 
   sqlite_path_ = sql_database_path;
-  TRY_RESULT(db_instance, SqliteDb::change_key(sqlite_path_, true, key, old_key));
-  sql_connection_ = std::make_shared<SqliteConnectionSafe>(sql_database_path, key, db_instance.get_cipher_version());
-  sql_connection_->set(std::move(db_instance));
+  if (opened_db.empty()) {
+    TRY_RESULT_ASSIGN(opened_db, open_sqlite_db(sqlite_path_, key, old_key, parameters.database_profile));
+  }
+  sql_connection_ = std::make_shared<SqliteConnectionSafe>(sql_database_path, key, opened_db.get_cipher_version(),
+                                                           parameters.database_profile);
+  sql_connection_->set(std::move(opened_db));
   auto &db = sql_connection_->get();
-  TRY_STATUS(db.exec("PRAGMA journal_mode=WAL"));
-  TRY_STATUS(db.exec("PRAGMA secure_delete=1"));
 
   // Init databases
   // Do initialization once and before everything else to avoid "database is locked" error.
@@ -377,13 +390,14 @@ Status TdDb::init_sqlite(int32 scheduler_id, const TdParameters &parameters, con
 
   if (use_message_db) {
     messages_db_sync_safe_ = create_messages_db_sync(sql_connection_);
-    messages_db_async_ = create_messages_db_async(messages_db_sync_safe_, scheduler_id);
+    messages_db_async_ = create_messages_db_async(messages_db_sync_safe_, scheduler_id, read_scheduler_ids);
   }
 
   return Status::OK();
 }
 
-Status TdDb::init(int32 scheduler_id, const TdParameters &parameters, DbKey key, Events &events) {
+Status TdDb::init(int32 scheduler_id, const vector<int32> &read_scheduler_ids, const TdParameters &parameters,
+                  DbKey key, Events &events) {
   // Init pmc
   Binlog *binlog_ptr = nullptr;
   auto binlog = std::shared_ptr<Binlog>(new Binlog, [&](Binlog *ptr) { binlog_ptr = ptr; });
@@ -394,6 +408,21 @@ Status TdDb::init(int32 scheduler_id, const TdParameters &parameters, DbKey key,
   config_pmc->external_init_begin(static_cast<int32>(LogEvent::HandlerType::ConfigPmcMagic));
 
   bool encrypt_binlog = !key.is_empty();
+
+  // the SQLite database key is stored in the binlog, but if the binlog isn't encrypted, then the database is
+  // almost always unencrypted too, so it can be opened concurrently with binlog loading and the key checked later
+  Result<SqliteDb> r_preopened_sqlite_db = Status::Error("Not opened");
+#if !TD_THREAD_UNSUPPORTED
+  thread preopen_sqlite_thread;  // must be destroyed first to join the thread before other locals are destroyed
+  if (!encrypt_binlog && parameters.use_file_db) {
+    VLOG(td_init) << "Start to open database concurrently";
+    preopen_sqlite_thread = thread([&r_preopened_sqlite_db, path = get_sqlite_path(parameters),
+                                    profile = parameters.database_profile] {
+      r_preopened_sqlite_db = open_sqlite_db(path, DbKey::empty(), DbKey::empty(), profile);
+    });
+  }
+#endif
+
   VLOG(td_init) << "Start binlog loading";
   TRY_STATUS(init_binlog(*binlog, get_binlog_path(parameters), *binlog_pmc, *config_pmc, events, std::move(key)));
   VLOG(td_init) << "Finish binlog loading";
@@ -422,8 +451,19 @@ Status TdDb::init(int32 scheduler_id, const TdParameters &parameters, DbKey key,
       drop_sqlite_key = true;
     }
   }
+#if !TD_THREAD_UNSUPPORTED
+  preopen_sqlite_thread.join();
+#endif
+  SqliteDb preopened_sqlite_db;
+  if (r_preopened_sqlite_db.is_ok() && new_sqlite_key.is_empty() && old_sqlite_key.is_empty()) {
+    VLOG(td_init) << "Use concurrently opened database";
+    preopened_sqlite_db = r_preopened_sqlite_db.move_as_ok();
+  }
+  r_preopened_sqlite_db = Status::Error("Not opened");  // close the database if it was opened with a wrong key
+
   VLOG(td_init) << "Start to init database";
-  auto init_sqlite_status = init_sqlite(scheduler_id, parameters, new_sqlite_key, old_sqlite_key, *binlog_pmc);
+  auto init_sqlite_status = init_sqlite(scheduler_id, read_scheduler_ids, parameters, new_sqlite_key, old_sqlite_key,
+                                        *binlog_pmc, std::move(preopened_sqlite_db));
   VLOG(td_init) << "Finish to init database";
   if (init_sqlite_status.is_error()) {
     LOG(ERROR) << "Destroy bad SQLite database because of " << init_sqlite_status;
@@ -431,7 +471,7 @@ Status TdDb::init(int32 scheduler_id, const TdParameters &parameters, DbKey key,
       sql_connection_->get().close();
     }
     SqliteDb::destroy(get_sqlite_path(parameters)).ignore();
-    TRY_STATUS(init_sqlite(scheduler_id, parameters, new_sqlite_key, old_sqlite_key, *binlog_pmc));
+    TRY_STATUS(init_sqlite(scheduler_id, read_scheduler_ids, parameters, new_sqlite_key, old_sqlite_key, *binlog_pmc));
   }
   if (drop_sqlite_key) {
     binlog_pmc->erase("sqlite_key");
@@ -471,9 +511,10 @@ Status TdDb::init(int32 scheduler_id, const TdParameters &parameters, DbKey key,
 TdDb::TdDb() = default;
 TdDb::~TdDb() = default;
 
-Result<unique_ptr<TdDb>> TdDb::open(int32 scheduler_id, const TdParameters &parameters, DbKey key, Events &events) {
+Result<unique_ptr<TdDb>> TdDb::open(int32 scheduler_id, vector<int32> read_scheduler_ids,
+                                    const TdParameters &parameters, DbKey key, Events &events) {
   auto db = make_unique<TdDb>();
-  TRY_STATUS(db->init(scheduler_id, parameters, std::move(key), events));
+  TRY_STATUS(db->init(scheduler_id, read_scheduler_ids, parameters, std::move(key), events));
   return std::move(db);
 }
 
@@ -568,7 +609,19 @@ Result<string> TdDb::get_stats() {
   }
   sb << "Max file database depth out of " << prev.size() << '/' << count
      << " elements: " << *std::max_element(prev.begin(), prev.end()) << "\n";
-  sb << "Have " << bad_count << " forward references with maximum reference to " << max_bad_to;
+  sb << "Have " << bad_count << " forward references with maximum reference to " << max_bad_to << "\n";
+
+  auto statement_cache_stats = sql.get_statement_cache_stats();
+  sb << "Prepared statement cache: " << statement_cache_stats.hit_count << " hits, "
+     << statement_cache_stats.miss_count << " misses, " << statement_cache_stats.size << " cached statements\n";
+
+  sb << "File database write batches: " << file_db_->get_write_batch_stats() << "\n";
+  if (dialog_db_async_ != nullptr) {
+    sb << "Dialog database write batches: " << dialog_db_async_->get_write_batch_stats() << "\n";
+  }
+  if (messages_db_async_ != nullptr) {
+    sb << "Message database write batches: " << messages_db_async_->get_write_batch_stats() << "\n";
+  }
 
   return sb.as_cslice().str();
 }
@@ -59,7 +59,9 @@ class TdDb {
     vector<BinlogEvent> to_messages_manager;
     vector<BinlogEvent> to_notification_manager;
   };
-  static Result<unique_ptr<TdDb>> open(int32 scheduler_id, const TdParameters &parameters, DbKey key, Events &events);
+  // read_scheduler_ids are schedulers, on which concurrent read queries to the message database can be run
+  static Result<unique_ptr<TdDb>> open(int32 scheduler_id, vector<int32> read_scheduler_ids,
+                                       const TdParameters &parameters, DbKey key, Events &events);
 
   struct EncryptionInfo {
     bool is_encrypted{false};
@@ -120,9 +122,11 @@ class TdDb {
   std::shared_ptr<BinlogKeyValue<ConcurrentBinlog>> config_pmc_;
   std::shared_ptr<ConcurrentBinlog> binlog_;
 
-  Status init(int32 scheduler_id, const TdParameters &parameters, DbKey key, Events &events);
-  Status init_sqlite(int32 scheduler_id, const TdParameters &parameters, const DbKey &key, const DbKey &old_key,
-                     BinlogKeyValue<Binlog> &binlog_pmc);
+  Status init(int32 scheduler_id, const vector<int32> &read_scheduler_ids, const TdParameters &parameters, DbKey key,
+              Events &events);
+  Status init_sqlite(int32 scheduler_id, const vector<int32> &read_scheduler_ids, const TdParameters &parameters,
+                     const DbKey &key, const DbKey &old_key, BinlogKeyValue<Binlog> &binlog_pmc,
+                     SqliteDb opened_db = SqliteDb());
 
   void do_close(Promise<> on_finished, bool destroy_flag);
 };
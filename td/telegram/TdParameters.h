@@ -6,6 +6,8 @@
 //
 #pragma once
 
+#include "td/db/SqliteDb.h"
+
 #include <cstdint>
 #include <string>
 
@@ -23,6 +25,10 @@ struct TdParameters {
   bool use_secret_chats = false;
   bool use_chat_info_db = false;
   bool use_message_db = false;
+
+  // used for the main database, which contains the file, chat info and message databases
+  SqliteDb::PerformanceProfile database_profile;
+  SqliteDb::PerformanceProfile language_pack_database_profile;
 };
 
 }  // namespace td
@@ -62,6 +62,7 @@
 #include "td/utils/StringBuilder.h"
 #include "td/utils/Time.h"
 
+#include <algorithm>
 #include <iterator>
 #include <limits>
 
@@ -167,6 +168,7 @@ class GetDifferenceQuery final : public Td::ResultHandler {
 
 const double UpdatesManager::MAX_UNFILLED_GAP_TIME = 0.7;
 const double UpdatesManager::MAX_PTS_SAVE_DELAY = 0.05;
+const double UpdatesManager::PACED_GET_DIFFERENCE_DELAY = 0.1;
 
 UpdatesManager::UpdatesManager(Td *td, ActorShared<> parent) : td_(td), parent_(std::move(parent)) {
   last_pts_save_time_ = last_qts_save_time_ = Time::now() - 2 * MAX_PTS_SAVE_DELAY;
@@ -257,6 +259,26 @@ void UpdatesManager::fill_get_difference_gap(void *td) {
   fill_gap(td, nullptr);
 }
 
+void UpdatesManager::run_paced_get_difference(void *td) {
+  CHECK(td != nullptr);
+  if (G()->close_flag() || !static_cast<Td *>(td)->auth_manager_->is_authorized()) {
+    return;
+  }
+  auto updates_manager = static_cast<Td *>(td)->updates_manager_.get();
+  if (static_cast<Td *>(td)->need_postpone_update_fetching()) {
+    return updates_manager->schedule_paced_get_difference();
+  }
+
+  updates_manager->get_difference("run_paced_get_difference");
+}
+
+void UpdatesManager::schedule_paced_get_difference() {
+  VLOG(get_difference) << "Postpone getDifference, because the client doesn't keep up with updates";
+  paced_get_difference_timeout_.set_callback(std::move(run_paced_get_difference));
+  paced_get_difference_timeout_.set_callback_data(static_cast<void *>(td_));
+  paced_get_difference_timeout_.set_timeout_in(PACED_GET_DIFFERENCE_DELAY);
+}
+
 void UpdatesManager::fill_gap(void *td, const char *source) {
   CHECK(td != nullptr);
   if (G()->close_flag() || !static_cast<Td *>(td)->auth_manager_->is_authorized()) {
@@ -294,6 +316,7 @@ void UpdatesManager::run_get_difference(bool is_recursive, const char *source) {
   CHECK(!running_get_difference_);
 
   running_get_difference_ = true;
+  paced_get_difference_timeout_.cancel_timeout();
 
   int32 pts = get_pts();
   int32 date = get_date();
@@ -312,6 +335,12 @@ void UpdatesManager::run_get_difference(bool is_recursive, const char *source) {
     min_postponed_update_qts_ = 0;
   }
 
+  last_get_difference_pts_ = pts;
+  last_get_difference_qts_ = qts;
+  if (use_prefetched_difference(pts, date, qts)) {
+    return;
+  }
+
   auto promise = PromiseCreator::lambda([](Result<tl_object_ptr<telegram_api::updates_Difference>> result) {
     if (result.is_ok()) {
       send_closure(G()->updates_manager(), &UpdatesManager::on_get_difference, result.move_as_ok());
@@ -320,8 +349,83 @@ void UpdatesManager::run_get_difference(bool is_recursive, const char *source) {
     }
   });
   td_->create_handler<GetDifferenceQuery>(std::move(promise))->send(pts, date, qts);
-  last_get_difference_pts_ = pts;
-  last_get_difference_qts_ = qts;
+}
+
+void UpdatesManager::prefetch_get_difference(int32 pts, int32 date, int32 qts) {
+  drop_prefetched_difference();
+  if (pts <= 0) {
+    return;
+  }
+
+  VLOG(get_difference) << "Prefetch getDifference with pts = " << pts << ", qts = " << qts << ", date = " << date;
+  is_get_difference_prefetched_ = true;
+  prefetched_difference_pts_ = pts;
+  prefetched_difference_date_ = date;
+  prefetched_difference_qts_ = qts;
+  auto promise = PromiseCreator::lambda([generation = prefetched_difference_generation_](
+                                            Result<tl_object_ptr<telegram_api::updates_Difference>> result) {
+    send_closure(G()->updates_manager(), &UpdatesManager::on_get_prefetched_difference, generation,
+                 std::move(result));
+  });
+  td_->create_handler<GetDifferenceQuery>(std::move(promise))->send(pts, date, qts);
+}
+
+void UpdatesManager::on_get_prefetched_difference(uint64 generation,
+                                                  Result<tl_object_ptr<telegram_api::updates_Difference>> result) {
+  if (generation != prefetched_difference_generation_ || !is_get_difference_prefetched_) {
+    VLOG(get_difference) << "Ignore outdated prefetched getDifference result";
+    return;
+  }
+  CHECK(!is_prefetched_difference_received_);
+  if (is_prefetched_difference_awaited_) {
+    CHECK(running_get_difference_);
+    drop_prefetched_difference();
+    return on_get_difference_result(std::move(result));
+  }
+  is_prefetched_difference_received_ = true;
+  prefetched_difference_ = std::move(result);
+}
+
+bool UpdatesManager::use_prefetched_difference(int32 pts, int32 date, int32 qts) {
+  if (!is_get_difference_prefetched_) {
+    return false;
+  }
+  if (is_prefetched_difference_awaited_ || pts != prefetched_difference_pts_ || date != prefetched_difference_date_ ||
+      qts != prefetched_difference_qts_) {
+    drop_prefetched_difference();
+    return false;
+  }
+
+  VLOG(get_difference) << "Use prefetched getDifference";
+  if (!is_prefetched_difference_received_) {
+    is_prefetched_difference_awaited_ = true;
+    return true;
+  }
+
+  auto result = std::move(prefetched_difference_);
+  drop_prefetched_difference();
+  // the result must be processed after the current difference slice is fully applied
+  send_closure_later(actor_id(this), &UpdatesManager::on_get_difference_result, std::move(result));
+  return true;
+}
+
+void UpdatesManager::drop_prefetched_difference() {
+  if (!is_get_difference_prefetched_) {
+    return;
+  }
+  is_get_difference_prefetched_ = false;
+  is_prefetched_difference_received_ = false;
+  is_prefetched_difference_awaited_ = false;
+  prefetched_difference_generation_++;
+  prefetched_difference_ = Result<tl_object_ptr<telegram_api::updates_Difference>>();
+}
+
+void UpdatesManager::on_get_difference_result(Result<tl_object_ptr<telegram_api::updates_Difference>> result) {
+  if (result.is_ok()) {
+    on_get_difference(result.move_as_ok());
+  } else {
+    on_failed_get_difference(result.move_as_error());
+  }
 }
 
 void UpdatesManager::before_get_difference(bool is_initial) {
@@ -370,7 +474,14 @@ void UpdatesManager::save_pts(int32 pts) {
   } else if (!G()->ignore_background_updates()) {
     auto now = Time::now();
     auto delay = last_pts_save_time_ + MAX_PTS_SAVE_DELAY - now;
-    if (delay <= 0 || !td_->auth_manager_->is_bot()) {
+    if (!td_->auth_manager_->is_bot()) {
+      // acknowledgements of all updates from the same batch are already queued, so save only the last pts
+      pending_pts_ = pts;
+      if (!is_pending_pts_save_scheduled_) {
+        is_pending_pts_save_scheduled_ = true;
+        send_closure_later(actor_id(this), &UpdatesManager::save_pending_pts);
+      }
+    } else if (delay <= 0) {
       last_pts_save_time_ = now;
       pending_pts_ = 0;
       G()->td_db()->get_binlog_pmc()->set("updates.pts", to_string(pts));
@@ -383,6 +494,16 @@ void UpdatesManager::save_pts(int32 pts) {
   }
 }
 
+void UpdatesManager::save_pending_pts() {
+  CHECK(is_pending_pts_save_scheduled_);
+  is_pending_pts_save_scheduled_ = false;
+  if (pending_pts_ != 0 && !td_->auth_manager_->is_bot()) {
+    last_pts_save_time_ = Time::now();
+    G()->td_db()->get_binlog_pmc()->set("updates.pts", to_string(pending_pts_));
+    pending_pts_ = 0;
+  }
+}
+
 void UpdatesManager::save_qts(int32 qts) {
   if (!G()->ignore_background_updates()) {
     auto now = Time::now();
@@ -1427,7 +1548,9 @@ void UpdatesManager::on_get_difference(tl_object_ptr<telegram_api::updates_Diffe
       if (difference->intermediate_state_->pts_ >= get_pts() && get_pts() != std::numeric_limits<int32>::max() &&
           difference->intermediate_state_->date_ >= date_ && difference->intermediate_state_->qts_ == get_qts() &&
           !is_pts_changed) {
-        // TODO send new getDifference request and apply difference slice only after that
+        // request the next slice while the current one is being applied
+        prefetch_get_difference(difference->intermediate_state_->pts_, difference->intermediate_state_->date_,
+                                difference->intermediate_state_->qts_);
       }
 
       VLOG(get_difference) << "In get difference receive " << difference->users_.size() << " users and "
@@ -1465,6 +1588,11 @@ void UpdatesManager::on_get_difference(tl_object_ptr<telegram_api::updates_Diffe
       }
 
       if (new_pts != -1) {  // just in case
+        if (td_->need_postpone_update_fetching()) {
+          // the next slice will be requested after the client receives already sent updates
+          schedule_paced_get_difference();
+          break;
+        }
         run_get_difference(true, "on updates_differenceSlice");
       }
       break;
@@ -1489,6 +1617,8 @@ void UpdatesManager::on_get_difference(tl_object_ptr<telegram_api::updates_Diffe
 void UpdatesManager::after_get_difference() {
   CHECK(!running_get_difference_);
 
+  drop_prefetched_difference();
+
   retry_timeout_.cancel_timeout();
   retry_time_ = 1;
 
@@ -1872,6 +2002,8 @@ void UpdatesManager::process_updates(vector<tl_object_ptr<telegram_api::Update>>
   mpas.add_promise(std::move(promise));
   auto lock = mpas.get_promise();
 
+  sort_pts_updates(updates);
+
   /*
     for (auto &update : updates) {
       if (update != nullptr) {
@@ -2843,6 +2975,40 @@ bool UpdatesManager::is_qts_update(const telegram_api::Update *update) {
   }
 }
 
+void UpdatesManager::sort_pts_updates(vector<tl_object_ptr<telegram_api::Update>> &updates) {
+  // pts updates from the same batch are applied in the order of their pts to avoid waiting for gaps to be filled;
+  // relative order of pts updates and other updates is kept
+  vector<size_t> positions;
+  int32 last_pts = 0;
+  bool is_sorted = true;
+  for (size_t i = 0; i < updates.size(); i++) {
+    if (updates[i] != nullptr && is_pts_update(updates[i].get())) {
+      auto pts = get_update_pts(updates[i].get());
+      if (pts < last_pts) {
+        is_sorted = false;
+      }
+      last_pts = pts;
+      positions.push_back(i);
+    }
+  }
+  if (is_sorted) {
+    return;
+  }
+
+  vector<tl_object_ptr<telegram_api::Update>> pts_updates;
+  pts_updates.reserve(positions.size());
+  for (auto position : positions) {
+    pts_updates.push_back(std::move(updates[position]));
+  }
+  std::stable_sort(pts_updates.begin(), pts_updates.end(),
+                   [](const tl_object_ptr<telegram_api::Update> &lhs, const tl_object_ptr<telegram_api::Update> &rhs) {
+                     return get_update_pts(lhs.get()) < get_update_pts(rhs.get());
+                   });
+  for (size_t i = 0; i < positions.size(); i++) {
+    updates[positions[i]] = std::move(pts_updates[i]);
+  }
+}
+
 int32 UpdatesManager::get_update_qts(const telegram_api::Update *update) {
   switch (update->get_id()) {
     case telegram_api::updateNewEncryptedMessage::ID:
@@ -3082,7 +3248,7 @@ void UpdatesManager::on_update(tl_object_ptr<telegram_api::updateEncryptedMessag
 }
 
 void UpdatesManager::on_update(tl_object_ptr<telegram_api::updatePrivacy> update, Promise<Unit> &&promise) {
-  send_closure(td_->privacy_manager_, &PrivacyManager::update_privacy, std::move(update));
+  send_closure(td_->get_privacy_manager(), &PrivacyManager::update_privacy, std::move(update));
   promise.set_value(Unit());
 }
 
@@ -49,6 +49,10 @@ class dummyUpdate final : public telegram_api::Update {
     UNREACHABLE();
   }
 
+  const char *get_name() const final {
+    return "dummyUpdate";
+  }
+
   void store(TlStorerToString &s, const char *field_name) const final {
     s.store_class_begin(field_name, "dummyUpdate");
     s.store_class_end();
@@ -79,6 +83,10 @@ class updateSentMessage final : public telegram_api::Update {
     UNREACHABLE();
   }
 
+  const char *get_name() const final {
+    return "updateSentMessage";
+  }
+
   void store(TlStorerToString &s, const char *field_name) const final {
     s.store_class_begin(field_name, "updateSentMessage");
     s.store_field("random_id", random_id_);
@@ -130,6 +138,7 @@ class UpdatesManager final : public Actor {
   static constexpr int32 GAP_TIMEOUT_UPDATE_COUNT = 20;
   static const double MAX_UNFILLED_GAP_TIME;
   static const double MAX_PTS_SAVE_DELAY;
+  static const double PACED_GET_DIFFERENCE_DELAY;
   static constexpr bool DROP_PTS_UPDATES = false;
 
   friend class OnUpdate;
@@ -193,6 +202,7 @@ class UpdatesManager final : public Actor {
   double last_qts_save_time_ = 0;
   int32 pending_pts_ = 0;
   int32 pending_qts_ = 0;
+  bool is_pending_pts_save_scheduled_ = false;
 
   int32 short_update_date_ = 0;
 
@@ -218,12 +228,24 @@ class UpdatesManager final : public Actor {
   int32 retry_time_ = 1;
   Timeout retry_timeout_;
 
+  Timeout paced_get_difference_timeout_;
+
   bool running_get_difference_ = false;
   int32 last_get_difference_pts_ = 0;
   int32 last_get_difference_qts_ = 0;
   int32 min_postponed_update_pts_ = 0;
   int32 min_postponed_update_qts_ = 0;
 
+  // getDifference, sent with the intermediate state of the difference slice while the slice is being applied
+  bool is_get_difference_prefetched_ = false;
+  bool is_prefetched_difference_received_ = false;
+  bool is_prefetched_difference_awaited_ = false;
+  int32 prefetched_difference_pts_ = 0;
+  int32 prefetched_difference_date_ = 0;
+  int32 prefetched_difference_qts_ = 0;
+  uint64 prefetched_difference_generation_ = 0;
+  Result<tl_object_ptr<telegram_api::updates_Difference>> prefetched_difference_;
+
   void tear_down() final;
 
   void hangup_shared() final;
@@ -247,6 +269,8 @@ class UpdatesManager final : public Actor {
   void on_pts_ack(PtsManager::PtsId ack_token);
   void save_pts(int32 pts);
 
+  void save_pending_pts();
+
   Promise<> add_qts(int32 qts);
   void on_qts_ack(PtsManager::PtsId ack_token);
   void save_qts(int32 qts);
@@ -310,6 +334,10 @@ class UpdatesManager final : public Actor {
 
   static void fill_get_difference_gap(void *td);
 
+  static void run_paced_get_difference(void *td);
+
+  void schedule_paced_get_difference();
+
   static void fill_gap(void *td, const char *source);
 
   void set_pts_gap_timeout(double timeout);
@@ -320,6 +348,16 @@ class UpdatesManager final : public Actor {
 
   void run_get_difference(bool is_recursive, const char *source);
 
+  void prefetch_get_difference(int32 pts, int32 date, int32 qts);
+
+  void on_get_prefetched_difference(uint64 generation, Result<tl_object_ptr<telegram_api::updates_Difference>> result);
+
+  bool use_prefetched_difference(int32 pts, int32 date, int32 qts);
+
+  void drop_prefetched_difference();
+
+  void on_get_difference_result(Result<tl_object_ptr<telegram_api::updates_Difference>> result);
+
   void on_failed_get_updates_state(Status &&error);
 
   void on_failed_get_difference(Status &&error);
@@ -338,6 +376,8 @@ class UpdatesManager final : public Actor {
 
   static int32 get_update_pts(const telegram_api::Update *update);
 
+  static void sort_pts_updates(vector<tl_object_ptr<telegram_api::Update>> &updates);
+
   static bool is_qts_update(const telegram_api::Update *update);
 
   static int32 get_update_qts(const telegram_api::Update *update);
@@ -18,6 +18,7 @@
 #include "td/telegram/files/FileSourceId.h"
 #include "td/telegram/Global.h"
 #include "td/telegram/logevent/LogEvent.h"
+#include "td/telegram/MemoryStats.h"
 #include "td/telegram/MessageEntity.h"
 #include "td/telegram/MessagesManager.h"
 #include "td/telegram/Photo.h"
@@ -46,9 +47,11 @@
 #include "td/utils/Slice.h"
 #include "td/utils/SliceBuilder.h"
 #include "td/utils/StringBuilder.h"
+#include "td/utils/Time.h"
 #include "td/utils/tl_helpers.h"
 #include "td/utils/utf8.h"
 
+#include <algorithm>
 #include <limits>
 
 namespace td {
@@ -150,6 +153,7 @@ class WebPagesManager::WebPageInstantView {
   bool is_full = false;
   bool is_loaded = false;
   bool was_loaded_from_database = false;
+  size_t database_size = 0;  // size of the instant view in the database, isn't stored
 
   template <class StorerT>
   void store(StorerT &storer) const {
@@ -437,6 +441,7 @@ WebPageId WebPagesManager::on_get_web_page(tl_object_ptr<telegram_api::WebPage>
                                                   get_web_page_file_ids(web_page_to_delete), vector<FileId>());
         }
         web_pages_.erase(web_page_id);
+        remove_loaded_instant_view(web_page_id);
       }
 
       on_web_page_changed(web_page_id, false);
@@ -584,6 +589,8 @@ void WebPagesManager::update_web_page_instant_view(WebPageId web_page_id, WebPag
                                                    WebPageInstantView &&old_instant_view) {
   LOG(INFO) << "Merge new " << new_instant_view << " and old " << old_instant_view;
 
+  remove_loaded_instant_view(web_page_id);
+
   bool new_from_database = new_instant_view.was_loaded_from_database;
   bool old_from_database = old_instant_view.was_loaded_from_database;
 
@@ -631,12 +638,127 @@ void WebPagesManager::update_web_page_instant_view(WebPageId web_page_id, WebPag
       }
       */
       new_instant_view.was_loaded_from_database = true;
-      G()->td_db()->get_sqlite_pmc()->set(get_web_page_instant_view_database_key(web_page_id),
-                                          log_event_store(new_instant_view).as_slice().str(), Auto());
+      auto value = log_event_store(new_instant_view).as_slice().str();
+      new_instant_view.database_size = value.size();
+      G()->td_db()->get_sqlite_pmc()->set(get_web_page_instant_view_database_key(web_page_id), std::move(value),
+                                          Auto());
     }
+
+    add_loaded_instant_view(web_page_id, new_instant_view.database_size);
+  }
+}
+
+void WebPagesManager::add_loaded_instant_view(WebPageId web_page_id, size_t size) {
+  auto &loaded_instant_view = loaded_instant_views_[web_page_id];
+  CHECK(loaded_instant_view.size == 0);
+  loaded_instant_view.size = max(size, static_cast<size_t>(1));
+  loaded_instant_view.last_access_time = Time::now();
+  loaded_instant_view_size_ += loaded_instant_view.size;
+
+  if (loaded_instant_view_size_ > MAX_LOADED_INSTANT_VIEW_SIZE) {
+    evict_loaded_instant_views(MAX_LOADED_INSTANT_VIEW_SIZE / 4 * 3);
   }
 }
 
+void WebPagesManager::remove_loaded_instant_view(WebPageId web_page_id) {
+  auto it = loaded_instant_views_.find(web_page_id);
+  if (it == loaded_instant_views_.end()) {
+    return;
+  }
+  CHECK(loaded_instant_view_size_ >= it->second.size);
+  loaded_instant_view_size_ -= it->second.size;
+  loaded_instant_views_.erase(it);
+}
+
+void WebPagesManager::on_get_loaded_instant_view(WebPageId web_page_id) {
+  auto it = loaded_instant_views_.find(web_page_id);
+  if (it != loaded_instant_views_.end()) {
+    it->second.last_access_time = Time::now();
+  }
+}
+
+void WebPagesManager::evict_loaded_instant_views(size_t target_size) {
+  // evict least recently used instant views; among instant views used at the same time evict bigger first
+  auto now = Time::now();
+  struct Candidate {
+    double last_access_time;
+    size_t size;
+    WebPageId web_page_id;
+  };
+  vector<Candidate> candidates;
+  for (auto &it : loaded_instant_views_) {
+    if (it.second.last_access_time > now - MIN_LOADED_INSTANT_VIEW_KEEP_TIME ||
+        load_web_page_instant_view_queries_.count(it.first) != 0) {
+      continue;
+    }
+    candidates.push_back({it.second.last_access_time, it.second.size, it.first});
+  }
+  std::sort(candidates.begin(), candidates.end(), [](const Candidate &lhs, const Candidate &rhs) {
+    if (lhs.last_access_time != rhs.last_access_time) {
+      return lhs.last_access_time < rhs.last_access_time;
+    }
+    return lhs.size > rhs.size;
+  });
+
+  auto old_size = loaded_instant_view_size_;
+  size_t evicted_count = 0;
+  for (auto &candidate : candidates) {
+    if (loaded_instant_view_size_ <= target_size) {
+      break;
+    }
+
+    auto web_page_id = candidate.web_page_id;
+    remove_loaded_instant_view(web_page_id);
+
+    auto web_page_it = web_pages_.find(web_page_id);
+    if (web_page_it == web_pages_.end()) {
+      continue;
+    }
+    auto *web_page = web_page_it->second.get();
+    auto &instant_view = web_page->instant_view;
+    if (instant_view.is_empty || !instant_view.is_loaded || !instant_view.was_loaded_from_database) {
+      continue;
+    }
+
+    // the instant view will be reloaded from the database on demand, exactly like after restart
+    auto old_file_ids = get_web_page_file_ids(web_page);
+    instant_view.page_blocks.clear();
+    instant_view.is_loaded = false;
+    instant_view.was_loaded_from_database = false;
+    instant_view.database_size = 0;
+    auto new_file_ids = get_web_page_file_ids(web_page);
+    if (old_file_ids != new_file_ids) {
+      td_->file_manager_->change_files_source(get_web_page_file_source_id(web_page), old_file_ids, new_file_ids);
+    }
+    evicted_count++;
+  }
+
+  LOG(INFO) << "Evicted " << evicted_count << " instant views, reducing their size from " << old_size << " to "
+            << loaded_instant_view_size_ << " in " << loaded_instant_views_.size() << " instant views";
+}
+
+size_t WebPagesManager::get_memory_usage() const {
+  return web_pages_.size() * (sizeof(WebPageId) + sizeof(WebPage)) + loaded_instant_view_size_;
+}
+
+void WebPagesManager::reduce_memory_usage(size_t target_size) {
+  auto memory_usage = get_memory_usage();
+  if (memory_usage <= target_size) {
+    return;
+  }
+  auto need_free_size = memory_usage - target_size;
+  evict_loaded_instant_views(loaded_instant_view_size_ > need_free_size ? loaded_instant_view_size_ - need_free_size
+                                                                         : 0);
+}
+
+void WebPagesManager::memory_stats(MemoryStats &stats) const {
+  stats.add_container("web_pages_", web_pages_, sizeof(WebPage));
+  stats.add("loaded_instant_views_", loaded_instant_views_.size(), loaded_instant_view_size_);
+  stats.add_container("web_page_messages_", web_page_messages_);
+  stats.add_container("url_to_web_page_id_", url_to_web_page_id_);
+  stats.add_container("url_to_file_source_id_", url_to_file_source_id_);
+}
+
 bool WebPagesManager::need_use_old_instant_view(const WebPageInstantView &new_instant_view,
                                                 const WebPageInstantView &old_instant_view) {
   if (old_instant_view.is_empty || !old_instant_view.is_loaded) {
@@ -669,7 +791,7 @@ void WebPagesManager::on_get_web_page_instant_view_view_count(WebPageId web_page
     return;
   }
   instant_view->view_count = view_count;
-  if (G()->parameters().use_message_db) {
+  if (G()->parameters().use_message_db && instant_view->is_loaded) {
     LOG(INFO) << "Save instant view of " << web_page_id << " to database after updating view count to " << view_count;
     G()->td_db()->get_sqlite_pmc()->set(get_web_page_instant_view_database_key(web_page_id),
                                         log_event_store(*instant_view).as_slice().str(), Auto());
@@ -857,6 +979,8 @@ void WebPagesManager::get_web_page_instant_view(WebPageId web_page_id, bool forc
     return load_web_page_instant_view(web_page_id, force_full, std::move(promise));
   }
 
+  on_get_loaded_instant_view(web_page_id);
+
   if (force_full) {
     reload_web_page_instant_view(web_page_id);
   }
@@ -948,6 +1072,7 @@ void WebPagesManager::on_load_web_page_instant_view_from_database(WebPageId web_
     }
   }
   result.was_loaded_from_database = true;
+  result.database_size = value.size();
 
   auto old_file_ids = get_web_page_file_ids(web_page);
 
@@ -1528,6 +1653,15 @@ string WebPagesManager::get_web_page_url_database_key(const string &url) {
   return "wpurl" + url;
 }
 
+void WebPagesManager::on_binlog_web_page_events(vector<BinlogEvent> &&events) {
+  if (G()->parameters().use_message_db) {
+    web_pages_.reserve(web_pages_.size() + events.size());
+  }
+  for (auto &event : events) {
+    on_binlog_web_page_event(std::move(event));
+  }
+}
+
 void WebPagesManager::on_binlog_web_page_event(BinlogEvent &&event) {
   if (!G()->parameters().use_message_db) {
     binlog_erase(G()->td_db()->get_binlog(), event.id_);
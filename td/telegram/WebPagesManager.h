@@ -30,6 +30,8 @@ namespace td {
 
 struct BinlogEvent;
 
+class MemoryStats;
+
 class Td;
 
 class WebPagesManager final : public Actor {
@@ -58,6 +60,14 @@ class WebPagesManager final : public Actor {
 
   tl_object_ptr<td_api::webPage> get_web_page_object(WebPageId web_page_id) const;
 
+  // returns approximate size of memory used by web pages and their instant views
+  size_t get_memory_usage() const;
+
+  // evicts least recently used instant views, which are saved in the database, to reduce memory usage
+  void reduce_memory_usage(size_t target_size);
+
+  void memory_stats(MemoryStats &stats) const;
+
   tl_object_ptr<td_api::webPageInstantView> get_web_page_instant_view_object(WebPageId web_page_id) const;
 
   int64 get_web_page_preview(td_api::object_ptr<td_api::formattedText> &&text, Promise<Unit> &&promise);
@@ -80,6 +90,8 @@ class WebPagesManager final : public Actor {
 
   SecretInputMedia get_secret_input_media(WebPageId web_page_id) const;
 
+  void on_binlog_web_page_events(vector<BinlogEvent> &&events);
+
   void on_binlog_web_page_event(BinlogEvent &&event);
 
   FileSourceId get_url_file_source_id(const string &url);
@@ -116,6 +128,14 @@ class WebPagesManager final : public Actor {
   static bool need_use_old_instant_view(const WebPageInstantView &new_instant_view,
                                         const WebPageInstantView &old_instant_view);
 
+  void add_loaded_instant_view(WebPageId web_page_id, size_t size);
+
+  void remove_loaded_instant_view(WebPageId web_page_id);
+
+  void on_get_loaded_instant_view(WebPageId web_page_id);
+
+  void evict_loaded_instant_views(size_t target_size);
+
   void on_web_page_changed(WebPageId web_page_id, bool have_web_page);
 
   const WebPage *get_web_page(WebPageId web_page_id) const;
@@ -177,6 +197,9 @@ class WebPagesManager final : public Actor {
 
   vector<FileId> get_web_page_file_ids(const WebPage *web_page) const;
 
+  static constexpr size_t MAX_LOADED_INSTANT_VIEW_SIZE = 16 << 20;  // approximate size of kept instant view blocks
+  static constexpr double MIN_LOADED_INSTANT_VIEW_KEEP_TIME = 10.0;   // instant views used recently aren't evicted
+
   Td *td_;
   ActorShared<> parent_;
   std::unordered_map<WebPageId, unique_ptr<WebPage>, WebPageIdHash> web_pages_;
@@ -202,6 +225,14 @@ class WebPagesManager final : public Actor {
 
   std::unordered_map<string, FileSourceId> url_to_file_source_id_;
 
+  // instant views, which are saved in the database and can be evicted from memory
+  struct LoadedInstantView {
+    size_t size = 0;
+    double last_access_time = 0.0;
+  };
+  std::unordered_map<WebPageId, LoadedInstantView, WebPageIdHash> loaded_instant_views_;
+  size_t loaded_instant_view_size_ = 0;
+
   MultiTimeout pending_web_pages_timeout_{"PendingWebPagesTimeout"};
 };
 
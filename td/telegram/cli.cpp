@@ -101,6 +101,50 @@ static void dump_memory_usage() {
   }
 }
 
+// saves sampled allocations in the legacy pprof heap profile format
+static Status save_memory_profile(CSlice path) {
+  if (!is_memprof_on()) {
+    return Status::Error("Memory profiler is disabled");
+  }
+  clear_thread_locals();
+  std::vector<AllocInfo> alloc_info;
+  dump_alloc([&](const AllocInfo &info) { alloc_info.push_back(info); });
+  size_t total_count = 0;
+  size_t total_size = 0;
+  for (auto &info : alloc_info) {
+    total_count += info.count;
+    total_size += info.size;
+  }
+
+  string result = PSTRING() << "heap profile: " << total_count << ": " << total_size << " [" << total_count << ": "
+                            << total_size << "] @ heap_v2/" << get_memprof_sample_rate() << '\n';
+  for (auto &info : alloc_info) {
+    result += PSTRING() << info.count << ": " << info.size << " [" << info.count << ": " << info.size << "] @";
+    for (auto *ptr : info.backtrace) {
+      if (ptr == nullptr) {
+        break;
+      }
+      result += PSTRING() << ' ' << ptr;
+    }
+    result += '\n';
+  }
+
+  result += "\nMAPPED_LIBRARIES:\n";
+  auto r_maps_fd = FileFd::open("/proc/self/maps", FileFd::Read);
+  if (r_maps_fd.is_ok()) {
+    auto maps_fd = r_maps_fd.move_as_ok();
+    char buf[4096];
+    while (true) {
+      TRY_RESULT(read_size, maps_fd.read(MutableSlice(buf, sizeof(buf))));
+      if (read_size == 0) {
+        break;
+      }
+      result.append(buf, read_size);
+    }
+  }
+  return write_file(path, result);
+}
+
 #ifdef USE_READLINE
 const char *prompt = "td_cli> ";
 static int32 saved_point;
@@ -1733,6 +1777,12 @@ class CliClient final : public Actor {
       send_request(td_api::make_object<td_api::confirmQrCodeAuthentication>(args));
     } else if (op == "gcs") {
       send_request(td_api::make_object<td_api::getCurrentState>());
+    } else if (op == "suf") {
+      string update_types;
+      string chat_ids;
+      get_args(args, update_types, chat_ids);
+      send_request(
+          td_api::make_object<td_api::setUpdateFilter>(to_integers<int32>(update_types), as_chat_ids(chat_ids)));
     } else if (op == "rapr") {
       send_request(td_api::make_object<td_api::requestAuthenticationPasswordRecovery>());
     } else if (op == "caprc") {
@@ -2049,6 +2099,8 @@ class CliClient final : public Actor {
 
     if (op == "gc" || op == "gca" || begins_with(op, "gc-")) {
       send_request(td_api::make_object<td_api::getChats>(as_chat_list(op), as_limit(args, 10000)));
+    } else if (op == "gcls" || op == "gclsa" || begins_with(op, "gcls-")) {
+      send_request(td_api::make_object<td_api::getChatListSnapshot>(as_chat_list(op), as_limit(args, 10000)));
     } else if (op == "lc" || op == "lca" || begins_with(op, "lc-")) {
       send_request(td_api::make_object<td_api::loadChats>(as_chat_list(op), as_limit(args, 10000)));
     } else if (op == "gctest") {
@@ -2506,6 +2558,8 @@ class CliClient final : public Actor {
       send_request(td_api::make_object<td_api::getStorageStatisticsFast>());
     } else if (op == "database") {
       send_request(td_api::make_object<td_api::getDatabaseStatistics>());
+    } else if (op == "memory") {
+      send_request(td_api::make_object<td_api::getMemoryStatistics>());
     } else if (op == "optimize_storage" || op == "optimize_storage_all") {
       string chat_ids;
       string exclude_chat_ids;
@@ -2544,6 +2598,10 @@ class CliClient final : public Actor {
       send_request(td_api::make_object<td_api::getNetworkStatistics>(true));
     } else if (op == "reset_network") {
       send_request(td_api::make_object<td_api::resetNetworkStatistics>());
+    } else if (op == "network_latency") {
+      send_request(td_api::make_object<td_api::getNetworkRequestLatencyStatistics>());
+    } else if (op == "startup") {
+      send_request(td_api::make_object<td_api::getStartupStatistics>());
     } else if (op == "snt") {
       send_request(td_api::make_object<td_api::setNetworkType>(get_network_type(args)));
     } else if (op == "gadsp") {
@@ -4594,6 +4652,17 @@ class CliClient final : public Actor {
       } else {
         execute(std::move(request));
       }
+    } else if (op == "smpsr") {
+      int64 sample_rate;
+      get_args(args, sample_rate);
+      set_memprof_sample_rate(static_cast<size_t>(max(sample_rate, static_cast<int64>(0))));
+    } else if (op == "smp") {
+      auto status = save_memory_profile(args);
+      if (status.is_error()) {
+        LOG(ERROR) << "Failed to save memory profile: " << status;
+      }
+    } else if (op == "grtm") {
+      execute(td_api::make_object<td_api::getRuntimeMetrics>());
     } else if (op == "q" || op == "Quit") {
       quit();
     } else if (op == "dnq") {
@@ -0,0 +1,23 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2022
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "td/telegram/files/AsyncFileWriter.h"
+
+#include "td/utils/logging.h"
+#include "td/utils/Status.h"
+
+namespace td {
+
+void AsyncFileWriter::pwrite(BufferSlice data, int64 offset, Promise<size_t> promise) {
+  if (fd_.empty()) {
+    TRY_RESULT_PROMISE_ASSIGN(promise, fd_, FileFd::open(path_, FileFd::Write));
+  }
+  TRY_RESULT_PROMISE(promise, written, fd_.pwrite(data.as_slice(), offset));
+  LOG(DEBUG) << "Written " << written << " bytes at offset " << offset << " to \"" << path_ << '"';
+  promise.set_value(std::move(written));
+}
+
+}  // namespace td
@@ -0,0 +1,32 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2022
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#pragma once
+
+#include "td/actor/actor.h"
+#include "td/actor/PromiseFuture.h"
+
+#include "td/utils/buffer.h"
+#include "td/utils/common.h"
+#include "td/utils/port/FileFd.h"
+
+namespace td {
+
+// Writes file parts on its own scheduler to not block the scheduler of the caller by slow storage access
+class AsyncFileWriter final : public Actor {
+ public:
+  explicit AsyncFileWriter(string path) : path_(std::move(path)) {
+  }
+
+  // returns the number of written bytes
+  void pwrite(BufferSlice data, int64 offset, Promise<size_t> promise);
+
+ private:
+  string path_;
+  FileFd fd_;
+};
+
+}  // namespace td
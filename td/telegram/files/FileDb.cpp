@@ -17,15 +17,18 @@
 #include "td/db/SqliteDb.h"
 #include "td/db/SqliteKeyValue.h"
 #include "td/db/SqliteKeyValueSafe.h"
+#include "td/db/WriteBatchPolicy.h"
 
 #include "td/actor/actor.h"
 
+#include "td/utils/FlatHashMap.h"
 #include "td/utils/format.h"
 #include "td/utils/logging.h"
 #include "td/utils/misc.h"
 #include "td/utils/Slice.h"
 #include "td/utils/SliceBuilder.h"
 #include "td/utils/Status.h"
+#include "td/utils/Time.h"
 #include "td/utils/tl_helpers.h"
 #include "td/utils/tl_parsers.h"
 
@@ -60,11 +63,15 @@ class FileDb final : public FileDbInterface {
  public:
   class FileDbActor final : public Actor {
    public:
-    FileDbActor(FileDbId current_pmc_id, std::shared_ptr<SqliteKeyValueSafe> file_kv_safe)
-        : current_pmc_id_(current_pmc_id), file_kv_safe_(std::move(file_kv_safe)) {
+    FileDbActor(FileDbId current_pmc_id, std::shared_ptr<SqliteKeyValueSafe> file_kv_safe,
+                std::shared_ptr<WriteBatchPolicy> write_batch_policy)
+        : current_pmc_id_(current_pmc_id)
+        , file_kv_safe_(std::move(file_kv_safe))
+        , write_batch_policy_(std::move(write_batch_policy)) {
     }
 
     void close(Promise<> promise) {
+      do_flush();
       file_kv_safe_.reset();
       LOG(INFO) << "FileDb is closed";
       promise.set_value(Unit());
@@ -72,89 +79,119 @@ class FileDb final : public FileDbInterface {
     }
 
     void load_file_data(const string &key, Promise<FileData> promise) {
+      do_flush();
       promise.set_result(load_file_data_impl(actor_id(this), file_pmc(), key, current_pmc_id_));
     }
 
     void clear_file_data(FileDbId id, const string &remote_key, const string &local_key, const string &generate_key) {
-      auto &pmc = file_pmc();
-      pmc.begin_write_transaction().ensure();
+      add_write_query([this, id, remote_key, local_key, generate_key](Unit) {
+        auto &pmc = file_pmc();
+        update_pmc_id(id);
+
+        pmc.erase(PSTRING() << "file" << id.get());
+        // LOG(DEBUG) << "ERASE " << format::as_hex_dump<4>(Slice(PSLICE() << "file" << id.get()));
+
+        if (!remote_key.empty()) {
+          pmc.erase(remote_key);
+          // LOG(DEBUG) << "ERASE remote " << format::as_hex_dump<4>(Slice(remote_key));
+        }
+        if (!local_key.empty()) {
+          pmc.erase(local_key);
+          // LOG(DEBUG) << "ERASE local " << format::as_hex_dump<4>(Slice(local_key));
+        }
+        if (!generate_key.empty()) {
+          pmc.erase(generate_key);
+        }
+      });
+    }
+    void store_file_data(FileDbId id, string file_data, string remote_key, string local_key, string generate_key) {
+      add_write_query([this, id, file_data = std::move(file_data), remote_key = std::move(remote_key),
+                       local_key = std::move(local_key), generate_key = std::move(generate_key)](Unit) {
+        auto &pmc = file_pmc();
+        update_pmc_id(id);
+
+        pmc.set(PSTRING() << "file" << id.get(), file_data);
+
+        if (!remote_key.empty()) {
+          pmc.set(remote_key, to_string(id.get()));
+        }
+        if (!local_key.empty()) {
+          pmc.set(local_key, to_string(id.get()));
+        }
+        if (!generate_key.empty()) {
+          pmc.set(generate_key, to_string(id.get()));
+        }
+      });
+    }
+    void store_file_data_ref(FileDbId id, FileDbId new_id) {
+      add_write_query([this, id, new_id](Unit) {
+        update_pmc_id(id);
+        do_store_file_data_ref(id, new_id);
+      });
+    }
 
-      if (id > current_pmc_id_) {
-        pmc.set("file_id", to_string(id.get()));
-        current_pmc_id_ = id;
-      }
+    void optimize_refs(std::vector<FileDbId> ids, FileDbId main_id) {
+      LOG(INFO) << "Optimize " << ids.size() << " ids in file database to " << main_id.get();
+      add_write_query([this, ids = std::move(ids), main_id](Unit) {
+        for (size_t i = 0; i + 1 < ids.size(); i++) {
+          do_store_file_data_ref(ids[i], main_id);
+        }
+      });
+    }
 
-      pmc.erase(PSTRING() << "file" << id.get());
-      // LOG(DEBUG) << "ERASE " << format::as_hex_dump<4>(Slice(PSLICE() << "file" << id.get()));
+   private:
+    FileDbId current_pmc_id_;
+    std::shared_ptr<SqliteKeyValueSafe> file_kv_safe_;
+    std::shared_ptr<WriteBatchPolicy> write_batch_policy_;
 
-      if (!remote_key.empty()) {
-        pmc.erase(remote_key);
-        // LOG(DEBUG) << "ERASE remote " << format::as_hex_dump<4>(Slice(remote_key));
-      }
-      if (!local_key.empty()) {
-        pmc.erase(local_key);
-        // LOG(DEBUG) << "ERASE local " << format::as_hex_dump<4>(Slice(local_key));
-      }
-      if (!generate_key.empty()) {
-        pmc.erase(generate_key);
-      }
+    vector<Promise<>> pending_writes_;
+    double wakeup_at_ = 0;
 
-      pmc.commit_transaction().ensure();
+    SqliteKeyValue &file_pmc() {
+      return file_kv_safe_->get();
     }
-    void store_file_data(FileDbId id, const string &file_data, const string &remote_key, const string &local_key,
-                         const string &generate_key) {
-      auto &pmc = file_pmc();
-      pmc.begin_write_transaction().ensure();
 
+    void update_pmc_id(FileDbId id) {
       if (id > current_pmc_id_) {
-        pmc.set("file_id", to_string(id.get()));
+        file_pmc().set("file_id", to_string(id.get()));
         current_pmc_id_ = id;
       }
+    }
 
-      pmc.set(PSTRING() << "file" << id.get(), file_data);
-
-      if (!remote_key.empty()) {
-        pmc.set(remote_key, to_string(id.get()));
+    template <class F>
+    void add_write_query(F &&f) {
+      auto now = Time::now_cached();
+      write_batch_policy_->on_query(now);
+      pending_writes_.push_back(PromiseCreator::lambda(std::forward<F>(f), PromiseCreator::Ignore()));
+      if (write_batch_policy_->is_full(pending_writes_.size())) {
+        do_flush();
+      } else if (wakeup_at_ == 0) {
+        wakeup_at_ = now + write_batch_policy_->get_flush_delay();
       }
-      if (!local_key.empty()) {
-        pmc.set(local_key, to_string(id.get()));
+      if (wakeup_at_ != 0) {
+        set_timeout_at(wakeup_at_);
       }
-      if (!generate_key.empty()) {
-        pmc.set(generate_key, to_string(id.get()));
-      }
-
-      pmc.commit_transaction().ensure();
     }
-    void store_file_data_ref(FileDbId id, FileDbId new_id) {
-      auto &pmc = file_pmc();
-      pmc.begin_write_transaction().ensure();
 
-      if (id > current_pmc_id_) {
-        pmc.set("file_id", to_string(id.get()));
-        current_pmc_id_ = id;
+    void do_flush() {
+      if (pending_writes_.empty()) {
+        return;
       }
-
-      do_store_file_data_ref(id, new_id);
-
-      pmc.commit_transaction().ensure();
-    }
-
-    void optimize_refs(std::vector<FileDbId> ids, FileDbId main_id) {
-      LOG(INFO) << "Optimize " << ids.size() << " ids in file database to " << main_id.get();
+      auto start_time = Time::now();
       auto &pmc = file_pmc();
       pmc.begin_write_transaction().ensure();
-      for (size_t i = 0; i + 1 < ids.size(); i++) {
-        do_store_file_data_ref(ids[i], main_id);
+      for (auto &query : pending_writes_) {
+        query.set_value(Unit());
       }
       pmc.commit_transaction().ensure();
+      write_batch_policy_->on_commit(pending_writes_.size(), Time::now() - start_time);
+      pending_writes_.clear();
+      wakeup_at_ = 0;
+      cancel_timeout();
     }
 
-   private:
-    FileDbId current_pmc_id_;
-    std::shared_ptr<SqliteKeyValueSafe> file_kv_safe_;
-
-    SqliteKeyValue &file_pmc() {
-      return file_kv_safe_->get();
+    void timeout_expired() final {
+      do_flush();
     }
 
     void do_store_file_data_ref(FileDbId id, FileDbId new_id) {
@@ -166,8 +203,9 @@ class FileDb final : public FileDbInterface {
     file_kv_safe_ = std::move(kv_safe);
     CHECK(file_kv_safe_);
     current_pmc_id_ = FileDbId(to_integer<uint64>(file_kv_safe_->get().get("file_id")));
-    file_db_actor_ =
-        create_actor_on_scheduler<FileDbActor>("FileDbActor", scheduler_id, current_pmc_id_, file_kv_safe_);
+    write_batch_policy_ = std::make_shared<WriteBatchPolicy>();
+    file_db_actor_ = create_actor_on_scheduler<FileDbActor>("FileDbActor", scheduler_id, current_pmc_id_,
+                                                            file_kv_safe_, write_batch_policy_);
   }
 
   FileDbId create_pmc_id() final {
@@ -179,12 +217,25 @@ class FileDb final : public FileDbInterface {
     send_closure(std::move(file_db_actor_), &FileDbActor::close, std::move(promise));
   }
 
+  WriteBatchPolicy::Stats get_write_batch_stats() const final {
+    return write_batch_policy_->get_stats();
+  }
+
   void get_file_data_impl(string key, Promise<FileData> promise) final {
     send_closure(file_db_actor_, &FileDbActor::load_file_data, std::move(key), std::move(promise));
   }
 
   Result<FileData> get_file_data_sync_impl(string key) final {
-    return load_file_data_impl(file_db_actor_.get(), file_kv_safe_->get(), key, current_pmc_id_);
+    FileDbId id;
+    if (!key_cache_.get(key, id)) {
+      auto r_id = get_id(file_kv_safe_->get(), key);
+      id = r_id.is_ok() ? r_id.ok() : FileDbId();
+      key_cache_.set(key, id);
+    }
+    if (!id.is_valid()) {
+      return Status::Error("There is no such a key in database");
+    }
+    return load_file_data_by_id_impl(file_db_actor_.get(), file_kv_safe_->get(), id, key, current_pmc_id_);
   }
 
   void clear_file_data(FileDbId id, const FileData &file_data) final {
@@ -200,6 +251,9 @@ class FileDb final : public FileDbInterface {
     if (file_data.generate_ != nullptr) {
       generate_key = as_key(*file_data.generate_);
     }
+    key_cache_.set(remote_key, FileDbId());
+    key_cache_.set(local_key, FileDbId());
+    key_cache_.set(generate_key, FileDbId());
     send_closure(file_db_actor_, &FileDbActor::clear_file_data, id, remote_key, local_key, generate_key);
   }
   void set_file_data(FileDbId id, const FileData &file_data, bool new_remote, bool new_local, bool new_generate) final {
@@ -219,6 +273,9 @@ class FileDb final : public FileDbInterface {
     //            << tag("remote_key", format::as_hex_dump<4>(Slice(remote_key)))
     //            << tag("local_key", format::as_hex_dump<4>(Slice(local_key)))
     //            << tag("generate_key", format::as_hex_dump<4>(Slice(generate_key)));
+    key_cache_.set(remote_key, id);
+    key_cache_.set(local_key, id);
+    key_cache_.set(generate_key, id);
     send_closure(file_db_actor_, &FileDbActor::store_file_data, id, serialize(file_data), remote_key, local_key,
                  generate_key);
   }
@@ -231,15 +288,58 @@ class FileDb final : public FileDbInterface {
   }
 
  private:
+  // bounded cache of FileDbId by location key, which also remembers keys known to be absent from the database
+  class KeyCache {
+   public:
+    bool get(const string &key, FileDbId &id) {
+      auto it = ids_[0].find(key);
+      if (it != ids_[0].end()) {
+        id = it->second;
+        return true;
+      }
+      it = ids_[1].find(key);
+      if (it == ids_[1].end()) {
+        return false;
+      }
+      id = it->second;
+      set(key, id);
+      return true;
+    }
+
+    void set(const string &key, FileDbId id) {
+      if (key.empty()) {
+        return;
+      }
+      if (ids_[0].size() >= MAX_GENERATION_SIZE) {
+        // the least recently used generation is dropped as a whole
+        ids_[1] = std::move(ids_[0]);
+        ids_[0] = FlatHashMap<string, FileDbId>();
+      }
+      ids_[0][key] = id;
+      ids_[1].erase(key);
+    }
+
+   private:
+    static constexpr size_t MAX_GENERATION_SIZE = 1 << 14;
+
+    FlatHashMap<string, FileDbId> ids_[2];
+  };
+
   ActorOwn<FileDbActor> file_db_actor_;
   FileDbId current_pmc_id_;
   std::shared_ptr<SqliteKeyValueSafe> file_kv_safe_;
+  std::shared_ptr<WriteBatchPolicy> write_batch_policy_;
+  KeyCache key_cache_;
 
   static Result<FileData> load_file_data_impl(ActorId<FileDbActor> file_db_actor_id, SqliteKeyValue &pmc,
                                               const string &key, FileDbId current_pmc_id) {
     // LOG(DEBUG) << "Load by key " << format::as_hex_dump<4>(Slice(key));
     TRY_RESULT(id, get_id(pmc, key));
+    return load_file_data_by_id_impl(file_db_actor_id, pmc, id, key, current_pmc_id);
+  }
 
+  static Result<FileData> load_file_data_by_id_impl(ActorId<FileDbActor> file_db_actor_id, SqliteKeyValue &pmc,
+                                                    FileDbId id, const string &key, FileDbId current_pmc_id) {
     vector<FileDbId> ids;
     string data_str;
     int attempt_count = 0;
@@ -9,6 +9,8 @@
 #include "td/telegram/files/FileData.h"
 #include "td/telegram/files/FileDbId.h"
 
+#include "td/db/WriteBatchPolicy.h"
+
 #include "td/actor/PromiseFuture.h"
 
 #include "td/utils/buffer.h"
@@ -45,6 +47,9 @@ class FileDbInterface {
   // thread safe
   virtual void close(Promise<> promise) = 0;
 
+  // thread safe
+  virtual WriteBatchPolicy::Stats get_write_batch_stats() const = 0;
+
   template <class LocationT>
   static string as_key(const LocationT &object) {
     TlStorerCalcLength calc_length;
@@ -65,6 +70,7 @@ class FileDbInterface {
     get_file_data_impl(as_key(location), std::move(promise));
   }
 
+  // non thread safe
   template <class LocationT>
   Result<FileData> get_file_data_sync(const LocationT &location) {
     auto res = get_file_data_sync_impl(as_key(location));
@@ -76,6 +82,7 @@ class FileDbInterface {
     return res;
   }
 
+  // non thread safe
   virtual void clear_file_data(FileDbId id, const FileData &file_data) = 0;
   virtual void set_file_data(FileDbId id, const FileData &file_data, bool new_remote, bool new_local,
                              bool new_generate) = 0;
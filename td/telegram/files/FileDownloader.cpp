@@ -6,6 +6,7 @@
 //
 #include "td/telegram/files/FileDownloader.h"
 
+#include "td/telegram/ConfigShared.h"
 #include "td/telegram/FileReferenceManager.h"
 #include "td/telegram/files/FileLoaderUtils.h"
 #include "td/telegram/files/FileType.h"
@@ -123,6 +124,7 @@ Status FileDownloader::on_ok(int64 size) {
 
   std::string path;
   fd_.close();
+  async_file_writer_.reset();
   if (encryption_key_.is_secure()) {
     TRY_RESULT(file_path, open_temp_file(remote_.file_type_));
     string tmp_path;
@@ -144,6 +146,7 @@ Status FileDownloader::on_ok(int64 size) {
 
 void FileDownloader::on_error(Status status) {
   fd_.close();
+  async_file_writer_.reset();
   callback_->on_error(std::move(status));
 }
 
@@ -298,7 +301,7 @@ Status FileDownloader::check_net_query(NetQueryPtr &net_query) {
   return Status::OK();
 }
 
-Result<size_t> FileDownloader::process_part(Part part, NetQueryPtr net_query) {
+Result<BufferSlice> FileDownloader::get_part_bytes(Part part, NetQueryPtr net_query) {
   TRY_STATUS(check_net_query(net_query));
 
   BufferSlice bytes;
@@ -339,7 +342,7 @@ Result<size_t> FileDownloader::process_part(Part part, NetQueryPtr net_query) {
     return Status::Error("Part size is more than requested");
   }
   if (bytes.empty()) {
-    return 0;
+    return std::move(bytes);
   }
 
   // Encryption
@@ -366,7 +369,19 @@ Result<size_t> FileDownloader::process_part(Part part, NetQueryPtr net_query) {
                     bytes.as_slice());
   }
 
-  auto slice = bytes.as_slice().substr(0, part.size);
+  if (bytes.size() > part.size) {
+    bytes.truncate(part.size);
+  }
+  return std::move(bytes);
+}
+
+Result<size_t> FileDownloader::process_part(Part part, NetQueryPtr net_query) {
+  TRY_RESULT(bytes, get_part_bytes(part, std::move(net_query)));
+  if (bytes.empty()) {
+    return 0;
+  }
+
+  auto slice = bytes.as_slice();
   TRY_STATUS(acquire_fd());
   LOG(INFO) << "Got " << slice.size() << " bytes at offset " << part.offset << " for \"" << path_ << '"';
   TRY_RESULT(written, fd_.pwrite(slice, part.offset));
@@ -378,6 +393,37 @@ Result<size_t> FileDownloader::process_part(Part part, NetQueryPtr net_query) {
   return written;
 }
 
+bool FileDownloader::need_async_process_part(const Part &part) {
+  // parts of secret files must be saved in order, because the current IV is saved in partial local location
+  return !encryption_key_.is_secret() && !only_check_ &&
+         G()->shared_config().get_option_boolean("use_async_file_writes", true);
+}
+
+void FileDownloader::process_part_async(Part part, NetQueryPtr net_query, Promise<size_t> promise) {
+  TRY_RESULT_PROMISE(promise, bytes, get_part_bytes(part, std::move(net_query)));
+  if (bytes.empty()) {
+    return promise.set_value(0);
+  }
+
+  // the file is created synchronously, because its path is needed
+  TRY_STATUS_PROMISE(promise, acquire_fd());
+  if (async_file_writer_.empty()) {
+    async_file_writer_ =
+        create_actor_on_scheduler<AsyncFileWriter>("AsyncFileWriter", G()->get_gc_scheduler_id(), path_);
+  }
+  LOG(INFO) << "Got " << bytes.size() << " bytes at offset " << part.offset << " for \"" << path_ << '"';
+  auto size = bytes.size();
+  send_closure(async_file_writer_, &AsyncFileWriter::pwrite, std::move(bytes), part.offset,
+               PromiseCreator::lambda([size, promise = std::move(promise)](Result<size_t> r_written) mutable {
+                 TRY_RESULT_PROMISE(promise, written, std::move(r_written));
+                 // may write less than part.size, when size of downloadable file is unknown
+                 if (written != size) {
+                   return promise.set_error(Status::Error("Failed to save file part to the file"));
+                 }
+                 promise.set_value(std::move(written));
+               }));
+}
+
 void FileDownloader::on_progress(Progress progress) {
   if (progress.is_ready) {
     // do not send partial location. will lead to wrong local_size
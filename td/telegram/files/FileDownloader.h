@@ -6,6 +6,7 @@
 //
 #pragma once
 
+#include "td/telegram/files/AsyncFileWriter.h"
 #include "td/telegram/files/FileEncryptionKey.h"
 #include "td/telegram/files/FileLoader.h"
 #include "td/telegram/files/FileLocation.h"
@@ -13,6 +14,10 @@
 #include "td/telegram/net/NetQuery.h"
 #include "td/telegram/telegram_api.h"
 
+#include "td/actor/actor.h"
+#include "td/actor/PromiseFuture.h"
+
+#include "td/utils/buffer.h"
 #include "td/utils/common.h"
 #include "td/utils/port/FileFd.h"
 #include "td/utils/Status.h"
@@ -51,6 +56,7 @@ class FileDownloader final : public FileLoader {
 
   string path_;
   FileFd fd_;
+  ActorOwn<AsyncFileWriter> async_file_writer_;
 
   int32 next_part_ = 0;
   bool next_part_stop_ = false;
@@ -87,6 +93,9 @@ class FileDownloader final : public FileLoader {
   Result<std::pair<NetQueryPtr, bool>> start_part(Part part, int32 part_count,
                                                   int64 streaming_offset) final TD_WARN_UNUSED_RESULT;
   Result<size_t> process_part(Part part, NetQueryPtr net_query) final TD_WARN_UNUSED_RESULT;
+  bool need_async_process_part(const Part &part) final;
+  void process_part_async(Part part, NetQueryPtr net_query, Promise<size_t> promise) final;
+  Result<BufferSlice> get_part_bytes(Part part, NetQueryPtr net_query) TD_WARN_UNUSED_RESULT;
   void on_progress(Progress progress) final;
   FileLoader::Callback *get_callback() final;
   Status process_check_query(NetQueryPtr net_query) final;
@@ -6,6 +6,7 @@
 //
 #include "td/telegram/files/FileGcWorker.h"
 
+#include "td/telegram/files/FileLoaderUtils.h"
 #include "td/telegram/files/FileLocation.h"
 #include "td/telegram/files/FileManager.h"
 #include "td/telegram/files/FileType.h"
@@ -18,6 +19,7 @@
 #include "td/utils/misc.h"
 #include "td/utils/port/Clocks.h"
 #include "td/utils/port/path.h"
+#include "td/utils/port/Stat.h"
 #include "td/utils/Time.h"
 
 #include <algorithm>
@@ -27,13 +29,48 @@ namespace td {
 
 int VERBOSITY_NAME(file_gc) = VERBOSITY_NAME(INFO);
 
+struct FileGcWorker::GcState {
+  vector<FullFileInfo> files_to_remove;
+  size_t removed_file_count = 0;
+  FileStats kept_file_stats;
+  FileStats removed_file_stats;
+  Promise<FileGcResult> promise;
+
+  double begin_time = 0.0;
+  size_t total_file_count = 0;
+  int64 total_size = 0;
+  int64 total_removed_size = 0;
+  int32 type_immunity_ignored_cnt = 0;
+  int32 time_immunity_ignored_cnt = 0;
+  int32 exclude_owner_dialog_id_ignored_cnt = 0;
+  int32 owner_dialog_id_ignored_cnt = 0;
+  int32 remove_by_atime_cnt = 0;
+  int32 remove_by_count_cnt = 0;
+  int32 remove_by_size_cnt = 0;
+
+  GcState(bool split_by_owner_dialog_id, Promise<FileGcResult> promise)
+      : kept_file_stats(false, split_by_owner_dialog_id)
+      , removed_file_stats(false, split_by_owner_dialog_id)
+      , promise(std::move(promise)) {
+  }
+};
+
+FileGcWorker::FileGcWorker(ActorShared<> parent, CancellationToken token)
+    : parent_(std::move(parent)), token_(std::move(token)) {
+}
+
+FileGcWorker::~FileGcWorker() = default;
+
 void FileGcWorker::run_gc(const FileGcParameters &parameters, std::vector<FullFileInfo> files,
                           Promise<FileGcResult> promise) {
-  auto begin_time = Time::now();
+  if (state_ != nullptr) {
+    state_->promise.set_error(Global::request_aborted_error());
+    state_ = nullptr;
+  }
+  state_ = make_unique<GcState>(parameters.dialog_limit_ != 0, std::move(promise));
+  auto &state = *state_;
+  state.begin_time = Time::now();
   VLOG(file_gc) << "Start files gc with " << parameters;
-  // quite stupid implementations
-  // needs a lot of memory
-  // may write something more clever, but i will need at least 2 passes over the files
   // TODO update atime for all files in android (?)
 
   std::array<bool, MAX_FILE_TYPE> immune_types{{false}};
@@ -64,79 +101,62 @@ void FileGcWorker::run_gc(const FileGcParameters &parameters, std::vector<FullFi
     immune_types[narrow_cast<size_t>(FileType::EncryptedThumbnail)] = true;
   }
 
-  auto file_cnt = files.size();
-  int32 type_immunity_ignored_cnt = 0;
-  int32 time_immunity_ignored_cnt = 0;
-  int32 exclude_owner_dialog_id_ignored_cnt = 0;
-  int32 owner_dialog_id_ignored_cnt = 0;
-  int32 remove_by_atime_cnt = 0;
-  int32 remove_by_count_cnt = 0;
-  int32 remove_by_size_cnt = 0;
-  int64 total_removed_size = 0;
-  int64 total_size = 0;
+  state.total_file_count = files.size();
   for (auto &info : files) {
     if (info.atime_nsec < info.mtime_nsec) {
       info.atime_nsec = info.mtime_nsec;
     }
-    total_size += info.size;
+    state.total_size += info.size;
   }
 
-  FileStats new_stats(false, parameters.dialog_limit_ != 0);
-  FileStats removed_stats(false, parameters.dialog_limit_ != 0);
-
-  auto do_remove_file = [&removed_stats](const FullFileInfo &info) {
-    removed_stats.add_copy(info);
-    auto status = unlink(info.path);
-    LOG_IF(WARNING, status.is_error()) << "Failed to unlink file \"" << info.path << "\" during files gc: " << status;
-    send_closure(G()->file_manager(), &FileManager::on_file_unlink,
-                 FullLocalFileLocation(info.file_type, info.path, info.mtime_nsec));
+  auto add_file_to_remove = [&state](FullFileInfo &info) {
+    state.total_removed_size += info.size;
+    state.files_to_remove.push_back(std::move(info));
   };
 
   double now = Clocks::system();
 
   // Keep all immune files
   // Remove all files with (atime > now - max_time_from_last_access)
-  td::remove_if(files, [&](const FullFileInfo &info) {
+  td::remove_if(files, [&](FullFileInfo &info) {
     if (token_) {
       return false;
     }
     if (immune_types[narrow_cast<size_t>(info.file_type)]) {
-      type_immunity_ignored_cnt++;
-      new_stats.add_copy(info);
+      state.type_immunity_ignored_cnt++;
+      state.kept_file_stats.add_copy(info);
       return true;
     }
     if (td::contains(parameters.exclude_owner_dialog_ids_, info.owner_dialog_id)) {
-      exclude_owner_dialog_id_ignored_cnt++;
-      new_stats.add_copy(info);
+      state.exclude_owner_dialog_id_ignored_cnt++;
+      state.kept_file_stats.add_copy(info);
       return true;
     }
     if (!parameters.owner_dialog_ids_.empty() && !td::contains(parameters.owner_dialog_ids_, info.owner_dialog_id)) {
-      owner_dialog_id_ignored_cnt++;
-      new_stats.add_copy(info);
+      state.owner_dialog_id_ignored_cnt++;
+      state.kept_file_stats.add_copy(info);
       return true;
     }
     if (static_cast<double>(info.mtime_nsec) * 1e-9 > now - parameters.immunity_delay_) {
       // new files are immune to gc
-      time_immunity_ignored_cnt++;
-      new_stats.add_copy(info);
+      state.time_immunity_ignored_cnt++;
+      state.kept_file_stats.add_copy(info);
       return true;
     }
 
     if (static_cast<double>(info.atime_nsec) * 1e-9 < now - parameters.max_time_from_last_access_) {
-      do_remove_file(info);
-      total_removed_size += info.size;
-      remove_by_atime_cnt++;
+      add_file_to_remove(info);
+      state.remove_by_atime_cnt++;
       return true;
     }
     return false;
   });
   if (token_) {
-    return promise.set_error(Global::request_aborted_error());
+    state_->promise.set_error(Global::request_aborted_error());
+    state_ = nullptr;
+    return;
   }
 
-  // sort by max(atime, mtime)
-  std::sort(files.begin(), files.end(), [](const auto &a, const auto &b) { return a.atime_nsec < b.atime_nsec; });
-
   // 1. Total size must be less than parameters.max_files_size_
   // 2. Total file count must be less than parameters.max_file_count_
   size_t remove_count = 0;
@@ -148,45 +168,117 @@ void FileGcWorker::run_gc(const FileGcParameters &parameters, std::vector<FullFi
     remove_size += file.size;
   }
 
-  size_t pos = 0;
-  while (pos < files.size() && (remove_count > 0 || remove_size > 0)) {
-    if (token_) {
-      return promise.set_error(Global::request_aborted_error());
-    }
+  // extract files with the least max(atime, mtime) only until the limits are satisfied instead of sorting all of them
+  auto is_newer = [](const FullFileInfo &lhs, const FullFileInfo &rhs) {
+    return lhs.atime_nsec > rhs.atime_nsec;
+  };
+  auto heap_end = files.end();
+  if (remove_count > 0 || remove_size > 0) {
+    std::make_heap(files.begin(), heap_end, is_newer);
+  }
+  while (heap_end != files.begin() && (remove_count > 0 || remove_size > 0)) {
     if (remove_count > 0) {
-      remove_by_count_cnt++;
+      state.remove_by_count_cnt++;
+      remove_count--;
     } else {
-      remove_by_size_cnt++;
+      state.remove_by_size_cnt++;
     }
+    std::pop_heap(files.begin(), heap_end, is_newer);
+    --heap_end;
+    remove_size -= heap_end->size;
+    add_file_to_remove(*heap_end);
+  }
+  files.erase(heap_end, files.end());
 
-    if (remove_count > 0) {
-      remove_count--;
+  for (auto &file : files) {
+    state.kept_file_stats.add(std::move(file));
+  }
+  reset_to_empty(files);
+
+  loop();
+}
+
+void FileGcWorker::loop() {
+  if (state_ == nullptr) {
+    return;
+  }
+  if (token_) {
+    state_->promise.set_error(Global::request_aborted_error());
+    state_ = nullptr;
+    return;
+  }
+
+  auto &state = *state_;
+  auto end_time = Time::now() + MAX_LOOP_TIME;
+  for (size_t i = 0; i < MAX_REMOVED_FILES_PER_LOOP && state.removed_file_count < state.files_to_remove.size();
+       i++) {
+    auto &info = state.files_to_remove[state.removed_file_count++];
+    state.removed_file_stats.add_copy(info);
+    auto status = unlink(info.path);
+    LOG_IF(WARNING, status.is_error()) << "Failed to unlink file \"" << info.path << "\" during files gc: " << status;
+    send_closure(G()->file_manager(), &FileManager::on_file_unlink,
+                 FullLocalFileLocation(info.file_type, std::move(info.path), info.mtime_nsec));
+    if (Time::now() > end_time) {
+      break;
     }
-    remove_size -= files[pos].size;
+  }
 
-    total_removed_size += files[pos].size;
-    do_remove_file(files[pos]);
-    pos++;
+  if (state.removed_file_count < state.files_to_remove.size()) {
+    return yield();
   }
+  finish_gc();
+}
 
-  while (pos < files.size()) {
-    new_stats.add_copy(files[pos]);
-    pos++;
+void FileGcWorker::hangup() {
+  if (state_ != nullptr) {
+    state_->promise.set_error(Global::request_aborted_error());
+    state_ = nullptr;
   }
+  stop();
+}
 
+// a file in the shared files directory is referenced by hard links from files directories of accounts,
+// so it isn't needed anymore if it has no other hard links
+void FileGcWorker::remove_unused_shared_files() {
+  auto shared_dir = get_shared_files_dir();
+  if (shared_dir.empty()) {
+    return;
+  }
+  size_t removed_file_count = 0;
+  WalkPath::run(shared_dir, [&](CSlice path, WalkPath::Type type) {
+    if (token_) {
+      return WalkPath::Action::Abort;
+    }
+    if (type != WalkPath::Type::NotDir) {
+      return WalkPath::Action::Continue;
+    }
+    auto r_stat = stat(path);
+    if (r_stat.is_ok() && r_stat.ok().is_reg_ && r_stat.ok().link_count_ == 1 && unlink(path).is_ok()) {
+      removed_file_count++;
+    }
+    return WalkPath::Action::Continue;
+  }).ignore();
+  VLOG(file_gc) << "Removed " << removed_file_count << " unused shared files";
+}
+
+void FileGcWorker::finish_gc() {
+  CHECK(state_ != nullptr);
+  auto state = std::move(state_);
+  remove_unused_shared_files();
   auto end_time = Time::now();
 
-  VLOG(file_gc) << "Finish files gc: " << tag("time", end_time - begin_time) << tag("total", file_cnt)
-                << tag("removed", remove_by_atime_cnt + remove_by_count_cnt + remove_by_size_cnt)
-                << tag("total_size", format::as_size(total_size))
-                << tag("total_removed_size", format::as_size(total_removed_size))
-                << tag("by_atime", remove_by_atime_cnt) << tag("by_count", remove_by_count_cnt)
-                << tag("by_size", remove_by_size_cnt) << tag("type_immunity", type_immunity_ignored_cnt)
-                << tag("time_immunity", time_immunity_ignored_cnt)
-                << tag("owner_dialog_id_immunity", owner_dialog_id_ignored_cnt)
-                << tag("exclude_owner_dialog_id_immunity", exclude_owner_dialog_id_ignored_cnt);
-
-  promise.set_value({std::move(new_stats), std::move(removed_stats)});
+  VLOG(file_gc) << "Finish files gc: " << tag("time", end_time - state->begin_time)
+                << tag("total", state->total_file_count)
+                << tag("removed", state->remove_by_atime_cnt + state->remove_by_count_cnt + state->remove_by_size_cnt)
+                << tag("total_size", format::as_size(state->total_size))
+                << tag("total_removed_size", format::as_size(state->total_removed_size))
+                << tag("by_atime", state->remove_by_atime_cnt) << tag("by_count", state->remove_by_count_cnt)
+                << tag("by_size", state->remove_by_size_cnt) << tag("type_immunity", state->type_immunity_ignored_cnt)
+                << tag("time_immunity", state->time_immunity_ignored_cnt)
+                << tag("owner_dialog_id_immunity", state->owner_dialog_id_ignored_cnt)
+                << tag("exclude_owner_dialog_id_immunity", state->exclude_owner_dialog_id_ignored_cnt);
+
+  state->promise.set_value({std::move(state->kept_file_stats), std::move(state->removed_file_stats)});
 }
 
 }  // namespace td
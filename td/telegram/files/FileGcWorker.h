@@ -13,6 +13,7 @@
 #include "td/actor/PromiseFuture.h"
 
 #include "td/utils/CancellationToken.h"
+#include "td/utils/common.h"
 #include "td/utils/logging.h"
 
 namespace td {
@@ -26,13 +27,32 @@ struct FileGcResult {
 
 class FileGcWorker final : public Actor {
  public:
-  FileGcWorker(ActorShared<> parent, CancellationToken token) : parent_(std::move(parent)), token_(std::move(token)) {
-  }
+  FileGcWorker(ActorShared<> parent, CancellationToken token);
+  FileGcWorker(const FileGcWorker &) = delete;
+  FileGcWorker &operator=(const FileGcWorker &) = delete;
+  FileGcWorker(FileGcWorker &&) = delete;
+  FileGcWorker &operator=(FileGcWorker &&) = delete;
+  ~FileGcWorker() final;
+
   void run_gc(const FileGcParameters &parameters, std::vector<FullFileInfo> files, Promise<FileGcResult> promise);
 
  private:
+  // files are removed in batches to not block the scheduler for a long time
+  static constexpr size_t MAX_REMOVED_FILES_PER_LOOP = 256;
+  static constexpr double MAX_LOOP_TIME = 0.02;
+
+  struct GcState;
+
   ActorShared<> parent_;
   CancellationToken token_;
+  unique_ptr<GcState> state_;
+
+  void loop() final;
+  void hangup() final;
+
+  void remove_unused_shared_files();
+
+  void finish_gc();
 };
 
 }  // namespace td
@@ -40,6 +40,7 @@ Status FileHashUploader::init() {
   if (file_size != size_) {
     return Status::Error("Size mismatch");
   }
+  fd.advise(FileFd::Advice::Sequential, 0, 0).ignore();
   fd_ = BufferedFd<FileFd>(std::move(fd));
   sha256_state_.init();
 
@@ -111,6 +112,12 @@ Status FileHashUploader::loop_sha() {
     state_ = State::NetRequest;
     return Status::OK();
   }
+
+  // return used resources to ResourceManager to receive resources for the next chunk without waiting for
+  // other workers, which would delay start of the upload for big files
+  if (!resource_manager_.empty()) {
+    send_closure(resource_manager_, &ResourceManager::update_resources, resource_state_);
+  }
   return Status::OK();
 }
 
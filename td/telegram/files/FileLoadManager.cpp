@@ -6,6 +6,7 @@
 //
 #include "td/telegram/files/FileLoadManager.h"
 
+#include "td/telegram/ConfigShared.h"
 #include "td/telegram/Global.h"
 #include "td/telegram/net/DcId.h"
 #include "td/telegram/TdParameters.h"
@@ -33,7 +34,8 @@ ActorOwn<ResourceManager> &FileLoadManager::get_download_resource_manager(bool i
   if (actor.empty()) {
     actor = create_actor<ResourceManager>(
         PSLICE() << "DownloadResourceManager " << tag("is_small", is_small) << tag("dc_id", dc_id),
-        ResourceManager::Mode::Baseline);
+        G()->shared_config().get_option_boolean("use_adaptive_file_transfers") ? ResourceManager::Mode::Fair
+                                                                                : ResourceManager::Mode::Baseline);
   }
   return actor;
 }
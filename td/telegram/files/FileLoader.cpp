@@ -6,6 +6,7 @@
 //
 #include "td/telegram/files/FileLoader.h"
 
+#include "td/telegram/ConfigShared.h"
 #include "td/telegram/files/FileLoaderUtils.h"
 #include "td/telegram/files/ResourceManager.h"
 #include "td/telegram/Global.h"
@@ -17,11 +18,28 @@
 #include "td/utils/logging.h"
 #include "td/utils/misc.h"
 #include "td/utils/ScopeGuard.h"
+#include "td/utils/ThreadSafeCounter.h"
+#include "td/utils/Time.h"
 
+#include <atomic>
+#include <cmath>
 #include <tuple>
 
 namespace td {
 
+// the last measured bandwidth-delay products of downloads and uploads; used to choose part size for new files
+static std::atomic<int64> bandwidth_delay_products[2];
+
+static size_t get_preferred_part_size(bool is_upload) {
+  auto bandwidth_delay_product = bandwidth_delay_products[is_upload].load(std::memory_order_relaxed);
+  // the server allows parts of size up to 512 KB; prefer at least 8 parts in flight
+  size_t part_size = 32 << 10;
+  while (part_size < (512 << 10) && static_cast<int64>(part_size) * 8 <= bandwidth_delay_product) {
+    part_size *= 2;
+  }
+  return part_size;
+}
+
 void FileLoader::set_resource_manager(ActorShared<ResourceManager> resource_manager) {
   resource_manager_ = std::move(resource_manager);
   send_closure(resource_manager_, &ResourceManager::update_resources, resource_state_);
@@ -73,12 +91,21 @@ void FileLoader::update_local_file_location(const LocalFileLocation &local) {
 }
 
 void FileLoader::update_downloaded_part(int64 offset, int64 limit) {
+  if (streaming_read_ahead_size_ > 0) {
+    update_streaming_read_ahead(offset);
+  }
   if (parts_manager_.get_streaming_offset() != offset) {
     auto begin_part_id = parts_manager_.set_streaming_offset(offset, limit);
-    auto new_end_part_id = limit <= 0 ? parts_manager_.get_part_count()
-                                      : static_cast<int32>((offset + limit - 1) / parts_manager_.get_part_size()) + 1;
+    auto protected_limit = limit <= 0 ? limit : limit + streaming_read_ahead_size_;
+    auto new_end_part_id =
+        protected_limit <= 0 ? parts_manager_.get_part_count()
+                             : static_cast<int32>((offset + protected_limit - 1) / parts_manager_.get_part_size()) + 1;
     auto max_parts = static_cast<int32>(ResourceManager::MAX_RESOURCE_LIMIT / parts_manager_.get_part_size());
     auto end_part_id = begin_part_id + td::min(max_parts, new_end_part_id - begin_part_id);
+    if (streaming_read_ahead_size_ > 0) {
+      // keep a small backward buffer to make short seeks back cheap
+      begin_part_id = td::max(0, begin_part_id - STREAMING_BACKWARD_PART_COUNT);
+    }
     VLOG(file_loader) << "Protect parts " << begin_part_id << " ... " << end_part_id - 1;
     for (auto &it : part_map_) {
       if (!it.second.second.empty() && !(begin_part_id <= it.second.first.id && it.second.first.id < end_part_id)) {
@@ -109,6 +136,15 @@ void FileLoader::start_up() {
   auto use_part_count_limit = file_info.use_part_count_limit;
   bool is_upload = file_info.is_upload;
 
+  is_upload_ = is_upload;
+  use_adaptive_parameters_ = G()->shared_config().get_option_boolean("use_adaptive_file_transfers");
+  if (use_adaptive_parameters_) {
+    if (part_size == 0 && ready_parts.empty()) {
+      parts_manager_.set_preferred_part_size(get_preferred_part_size(is_upload));
+    }
+    max_in_flight_part_count_ = INITIAL_IN_FLIGHT_PART_COUNT;
+  }
+
   // Two cases when FILE_UPLOAD_RESTART will happen
   // 1. File is ready, size is final. But there are more uploaded parts than size of the file
   // pm.init(1, 100000, true, 10, {0, 1, 2}, false, true).ensure_error();
@@ -134,6 +170,12 @@ void FileLoader::start_up() {
     parts_manager_.set_checked_prefix_size(0);
   }
   parts_manager_.set_streaming_offset(file_info.offset, file_info.limit);
+  if (use_adaptive_parameters_ && !is_upload) {
+    streaming_read_ahead_size_ = MIN_STREAMING_READ_AHEAD_SIZE;
+    last_streaming_offset_ = file_info.offset;
+    last_streaming_offset_time_ = Time::now();
+    parts_manager_.set_streaming_read_ahead_size(streaming_read_ahead_size_);
+  }
   if (ordered_flag_) {
     ordered_parts_ = OrderedEventsProcessor<std::pair<Part, NetQueryPtr>>(parts_manager_.get_ready_prefix_count());
   }
@@ -196,6 +238,10 @@ Status FileLoader::do_loop() {
     if (blocking_id_ != 0) {
       break;
     }
+    if (max_in_flight_part_count_ > 0 && part_map_.size() >= static_cast<size_t>(max_in_flight_part_count_)) {
+      VLOG(file_loader) << "Have " << part_map_.size() << " parts in flight";
+      break;
+    }
     if (resource_state_.unused() < static_cast<int64>(parts_manager_.get_part_size())) {
       VLOG(file_loader) << "Got only " << resource_state_.unused() << " resource";
       break;
@@ -216,6 +262,15 @@ Status FileLoader::do_loop() {
       CHECK(blocking_id_ == 0);
       blocking_id_ = id;
     }
+    if (use_adaptive_parameters_) {
+      auto now = Time::now();
+      if (part_map_.empty()) {
+        // throughput can't be measured while there are no parts in flight
+        throughput_sample_start_time_ = now;
+        throughput_sample_size_ = 0;
+      }
+      part_start_time_[id] = now;
+    }
     part_map_[id] = std::make_pair(part, query->cancel_slot_.get_signal_new());
     // part_map_[id] = std::make_pair(part, query.get_weak());
 
@@ -247,7 +302,13 @@ void FileLoader::update_estimated_limit() {
     return;
   }
   auto estimated_extra = parts_manager_.get_estimated_extra();
+  if (max_in_flight_part_count_ > 0) {
+    // there is no need to reserve resources for parts, which will not be started
+    estimated_extra = min(estimated_extra, static_cast<int64>(max_in_flight_part_count_) *
+                                               static_cast<int64>(parts_manager_.get_part_size()));
+  }
   resource_state_.update_estimated_limit(estimated_extra);
+  resource_state_.set_is_streaming(parts_manager_.is_streaming());
   VLOG(file_loader) << "Update estimated limit " << estimated_extra;
   if (!resource_manager_.empty()) {
     keep_fd_flag(narrow_cast<uint64>(resource_state_.active_limit()) >= parts_manager_.get_part_size());
@@ -255,6 +316,59 @@ void FileLoader::update_estimated_limit() {
   }
 }
 
+void FileLoader::update_adaptive_parameters(size_t part_size, double latency) {
+  CHECK(use_adaptive_parameters_);
+  auto now = Time::now();
+  // the minimum is slowly forgotten to adapt to changed network conditions
+  min_part_latency_ = min_part_latency_ == 0.0 ? latency : min(latency, min_part_latency_ * 1.02);
+
+  throughput_sample_size_ += static_cast<int64>(part_size);
+  auto elapsed = now - throughput_sample_start_time_;
+  if (elapsed < max(min_part_latency_, 0.1)) {
+    return;
+  }
+  max_throughput_ = max(static_cast<double>(throughput_sample_size_) / elapsed, max_throughput_ * 0.9);
+  throughput_sample_start_time_ = now;
+  throughput_sample_size_ = 0;
+
+  auto bandwidth_delay_product = max_throughput_ * min_part_latency_;
+  bandwidth_delay_products[is_upload_].store(static_cast<int64>(bandwidth_delay_product), std::memory_order_relaxed);
+
+  // keep in flight twice the bandwidth-delay product to be able to notice that more bandwidth became available
+  auto part_count = std::ceil(2 * bandwidth_delay_product / static_cast<double>(parts_manager_.get_part_size()));
+  auto new_max_in_flight_part_count = static_cast<int32>(
+      clamp(part_count, static_cast<double>(MIN_IN_FLIGHT_PART_COUNT), static_cast<double>(MAX_IN_FLIGHT_PART_COUNT)));
+  if (new_max_in_flight_part_count != max_in_flight_part_count_) {
+    VLOG(file_loader) << "Change maximum number of parts in flight from " << max_in_flight_part_count_ << " to "
+                      << new_max_in_flight_part_count << " with " << tag("latency", min_part_latency_)
+                      << tag("throughput", max_throughput_);
+    max_in_flight_part_count_ = new_max_in_flight_part_count;
+  }
+}
+
+void FileLoader::update_streaming_read_ahead(int64 offset) {
+  auto now = Time::now();
+  auto passed_time = now - last_streaming_offset_time_;
+  auto offset_delta = offset - last_streaming_offset_;
+  last_streaming_offset_ = offset;
+  last_streaming_offset_time_ = now;
+  if (offset_delta <= 0 || offset_delta > MAX_STREAMING_READ_AHEAD_SIZE || passed_time < 0.1) {
+    // seek or too frequent offset change; it can't be used to estimate the playback rate
+    return;
+  }
+
+  auto rate = static_cast<double>(offset_delta) / passed_time;
+  playback_rate_ = playback_rate_ == 0.0 ? rate : 0.7 * playback_rate_ + 0.3 * rate;
+  auto read_ahead_size = clamp(static_cast<int64>(playback_rate_ * STREAMING_READ_AHEAD_TIME),
+                               MIN_STREAMING_READ_AHEAD_SIZE, MAX_STREAMING_READ_AHEAD_SIZE);
+  if (read_ahead_size != streaming_read_ahead_size_) {
+    VLOG(file_loader) << "Change streaming read-ahead size from " << streaming_read_ahead_size_ << " to "
+                      << read_ahead_size << " with " << tag("playback_rate", playback_rate_);
+    streaming_read_ahead_size_ = read_ahead_size;
+    parts_manager_.set_streaming_read_ahead_size(read_ahead_size);
+  }
+}
+
 void FileLoader::on_result(NetQueryPtr query) {
   if (stop_flag_) {
     return;
@@ -278,6 +392,13 @@ void FileLoader::on_result(NetQueryPtr query) {
   CHECK(query->is_ready());
   part_map_.erase(it);
 
+  double part_start_time = 0.0;
+  auto start_time_it = part_start_time_.find(id);
+  if (start_time_it != part_start_time_.end()) {
+    part_start_time = start_time_it->second;
+    part_start_time_.erase(start_time_it);
+  }
+
   bool next = false;
   auto status = [&] {
     TRY_RESULT(should_restart, should_restart_part(part, query));
@@ -289,6 +410,9 @@ void FileLoader::on_result(NetQueryPtr query) {
       resource_state_.stop_use(static_cast<int64>(part.size));
       parts_manager_.on_part_failed(part.id);
     } else {
+      if (part_start_time != 0.0 && query->is_ok()) {
+        update_adaptive_parameters(part.size, Time::now() - part_start_time);
+      }
       next = true;
     }
     return Status::OK();
@@ -318,6 +442,13 @@ void FileLoader::on_part_query(Part part, NetQueryPtr query) {
     // important for secret files
     return;
   }
+  if (need_async_process_part(part)) {
+    process_part_async(part, std::move(query),
+                       PromiseCreator::lambda([actor_id = actor_id(this), part](Result<size_t> r_size) {
+                         send_closure(actor_id, &FileLoader::on_part_processed, part, std::move(r_size));
+                       }));
+    return;
+  }
   auto status = try_on_part_query(part, std::move(query));
   if (status.is_error()) {
     on_error(std::move(status));
@@ -325,6 +456,23 @@ void FileLoader::on_part_query(Part part, NetQueryPtr query) {
   }
 }
 
+void FileLoader::on_part_processed(Part part, Result<size_t> r_size) {
+  if (stop_flag_) {
+    return;
+  }
+  auto status = [&] {
+    TRY_RESULT(size, std::move(r_size));
+    return try_on_part_processed(part, size);
+  }();
+  if (status.is_error()) {
+    on_error(std::move(status));
+    stop_flag_ = true;
+    return;
+  }
+  update_estimated_limit();
+  loop();
+}
+
 void FileLoader::on_common_query(NetQueryPtr query) {
   auto status = process_check_query(std::move(query));
   if (status.is_error()) {
@@ -335,8 +483,17 @@ void FileLoader::on_common_query(NetQueryPtr query) {
 
 Status FileLoader::try_on_part_query(Part part, NetQueryPtr query) {
   TRY_RESULT(size, process_part(part, std::move(query)));
+  return try_on_part_processed(part, size);
+}
+
+Status FileLoader::try_on_part_processed(Part part, size_t size) {
   VLOG(file_loader) << "Ok part " << tag("id", part.id) << tag("size", part.size);
   resource_state_.stop_use(static_cast<int64>(part.size));
+  resource_state_.add_transferred_size(static_cast<int64>(size));
+  static auto part_counter = NamedThreadSafeCounter::get_default().get_counter("file_transferred_parts");
+  static auto size_counter = NamedThreadSafeCounter::get_default().get_counter("file_transferred_bytes");
+  part_counter.add(1);
+  size_counter.add(static_cast<int64>(size));
   auto old_ready_prefix_count = parts_manager_.get_unchecked_ready_prefix_count();
   TRY_STATUS(parts_manager_.on_part_ok(part.id, part.size, size));
   auto new_ready_prefix_count = parts_manager_.get_unchecked_ready_prefix_count();
@@ -358,6 +515,7 @@ void FileLoader::on_progress_impl() {
   progress.is_ready = parts_manager_.ready();
   progress.ready_size = parts_manager_.get_ready_size();
   progress.size = parts_manager_.get_size_or_zero();
+  progress.max_in_flight_part_count = max_in_flight_part_count_;
   on_progress(std::move(progress));
 }
 
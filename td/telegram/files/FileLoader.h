@@ -15,7 +15,10 @@
 #include "td/telegram/net/NetQuery.h"
 
 #include "td/actor/actor.h"
+#include "td/actor/PromiseFuture.h"
 
+#include "td/utils/common.h"
+#include "td/utils/FlatHashMap.h"
 #include "td/utils/OrderedEventsProcessor.h"
 #include "td/utils/Status.h"
 
@@ -72,6 +75,13 @@ class FileLoader : public FileLoaderActor {
   virtual void after_start_parts() {
   }
   virtual Result<size_t> process_part(Part part, NetQueryPtr net_query) TD_WARN_UNUSED_RESULT = 0;
+  // if returns true, process_part_async is used instead of process_part
+  virtual bool need_async_process_part(const Part &part) {
+    return false;
+  }
+  virtual void process_part_async(Part part, NetQueryPtr net_query, Promise<size_t> promise) {
+    UNREACHABLE();
+  }
   struct Progress {
     int32 part_count{0};
     int32 part_size{0};
@@ -80,6 +90,7 @@ class FileLoader : public FileLoaderActor {
     bool is_ready{false};
     int64 ready_size{0};
     int64 size{0};
+    int32 max_in_flight_part_count{0};  // 0 if the number of simultaneously loaded parts isn't tuned
   };
   virtual void on_progress(Progress progress) = 0;
   virtual Callback *get_callback() = 0;
@@ -109,6 +120,13 @@ class FileLoader : public FileLoaderActor {
 
  private:
   static constexpr uint8 COMMON_QUERY_KEY = 2;
+  static constexpr int32 MIN_IN_FLIGHT_PART_COUNT = 2;
+  static constexpr int32 INITIAL_IN_FLIGHT_PART_COUNT = 4;
+  static constexpr int32 MAX_IN_FLIGHT_PART_COUNT = 64;
+  static constexpr double STREAMING_READ_AHEAD_TIME = 10.0;
+  static constexpr int64 MIN_STREAMING_READ_AHEAD_SIZE = 1 << 20;
+  static constexpr int64 MAX_STREAMING_READ_AHEAD_SIZE = 16 << 20;
+  static constexpr int32 STREAMING_BACKWARD_PART_COUNT = 2;
   bool stop_flag_ = false;
   ActorShared<ResourceManager> resource_manager_;
   ResourceState resource_state_;
@@ -120,6 +138,22 @@ class FileLoader : public FileLoaderActor {
   ActorOwn<DelayDispatcher> delay_dispatcher_;
   double next_delay_ = 0;
 
+  // transfer parameters auto-tuning using the measured per-part latency and throughput
+  bool is_upload_ = false;
+  bool use_adaptive_parameters_ = false;
+  int32 max_in_flight_part_count_ = 0;
+  double min_part_latency_ = 0.0;
+  double max_throughput_ = 0.0;
+  double throughput_sample_start_time_ = 0.0;
+  int64 throughput_sample_size_ = 0;
+  FlatHashMap<uint64, double> part_start_time_;
+
+  // streaming read-ahead sized by the playback rate estimated from streaming offset changes
+  int64 streaming_read_ahead_size_ = 0;
+  int64 last_streaming_offset_ = 0;
+  double last_streaming_offset_time_ = 0.0;
+  double playback_rate_ = 0.0;
+
   uint32 debug_total_parts_ = 0;
   uint32 debug_bad_part_order_ = 0;
   std::vector<int32> debug_bad_parts_;
@@ -132,12 +166,16 @@ class FileLoader : public FileLoaderActor {
   void tear_down() final;
 
   void update_estimated_limit();
+  void update_adaptive_parameters(size_t part_size, double latency);
+  void update_streaming_read_ahead(int64 offset);
   void on_progress_impl();
 
   void on_result(NetQueryPtr query) final;
   void on_part_query(Part part, NetQueryPtr query);
+  void on_part_processed(Part part, Result<size_t> r_size);
   void on_common_query(NetQueryPtr query);
   Status try_on_part_query(Part part, NetQueryPtr query);
+  Status try_on_part_processed(Part part, size_t size);
 };
 
 }  // namespace td
@@ -6,6 +6,7 @@
 //
 #include "td/telegram/files/FileLoaderUtils.h"
 
+#include "td/telegram/ConfigShared.h"
 #include "td/telegram/files/FileLocation.h"
 #include "td/telegram/Global.h"
 #include "td/telegram/TdDb.h"
@@ -234,4 +235,16 @@ string get_files_dir(FileType file_type) {
   return PSTRING() << get_files_base_dir(file_type) << get_file_type_name(file_type) << TD_DIR_SLASH;
 }
 
+string get_shared_files_dir() {
+  auto dir = G()->shared_config().get_option_string("shared_files_directory");
+  if (!dir.empty() && dir.back() != TD_DIR_SLASH) {
+    dir += TD_DIR_SLASH;
+  }
+  return dir;
+}
+
+string get_shared_file_path(Slice unique_file_id) {
+  return PSTRING() << get_shared_files_dir() << unique_file_id;
+}
+
 }  // namespace td
@@ -38,4 +38,9 @@ string get_files_temp_dir(FileType file_type);
 
 string get_files_dir(FileType file_type);
 
+// returns the directory of the content store shared between accounts, or an empty string if there is none
+string get_shared_files_dir();
+
+string get_shared_file_path(Slice unique_file_id);
+
 }  // namespace td
@@ -15,6 +15,7 @@
 #include "td/telegram/files/FileLocation.hpp"
 #include "td/telegram/Global.h"
 #include "td/telegram/logevent/LogEvent.h"
+#include "td/telegram/MemoryStats.h"
 #include "td/telegram/misc.h"
 #include "td/telegram/SecureStorage.h"
 #include "td/telegram/TdDb.h"
@@ -1039,6 +1040,62 @@ bool FileManager::try_fix_partial_local_location(FileNodePtr node) {
   return true;
 }
 
+const std::shared_ptr<FileManager::DownloadCallback> &FileManager::FileIdInfo::get_download_callback() const {
+  static const std::shared_ptr<DownloadCallback> empty_callback;
+  return callbacks_ == nullptr ? empty_callback : callbacks_->download_callback_;
+}
+
+std::shared_ptr<FileManager::DownloadCallback> FileManager::FileIdInfo::extract_download_callback() {
+  if (callbacks_ == nullptr) {
+    return nullptr;
+  }
+  auto result = std::move(callbacks_->download_callback_);
+  try_drop_callbacks();
+  return result;
+}
+
+void FileManager::FileIdInfo::set_download_callback(std::shared_ptr<DownloadCallback> callback) {
+  if (callbacks_ == nullptr) {
+    if (callback == nullptr) {
+      return;
+    }
+    callbacks_ = make_unique<FileIdCallbacks>();
+  }
+  callbacks_->download_callback_ = std::move(callback);
+  try_drop_callbacks();
+}
+
+const std::shared_ptr<FileManager::UploadCallback> &FileManager::FileIdInfo::get_upload_callback() const {
+  static const std::shared_ptr<UploadCallback> empty_callback;
+  return callbacks_ == nullptr ? empty_callback : callbacks_->upload_callback_;
+}
+
+std::shared_ptr<FileManager::UploadCallback> FileManager::FileIdInfo::extract_upload_callback() {
+  if (callbacks_ == nullptr) {
+    return nullptr;
+  }
+  auto result = std::move(callbacks_->upload_callback_);
+  try_drop_callbacks();
+  return result;
+}
+
+void FileManager::FileIdInfo::set_upload_callback(std::shared_ptr<UploadCallback> callback) {
+  if (callbacks_ == nullptr) {
+    if (callback == nullptr) {
+      return;
+    }
+    callbacks_ = make_unique<FileIdCallbacks>();
+  }
+  callbacks_->upload_callback_ = std::move(callback);
+  try_drop_callbacks();
+}
+
+void FileManager::FileIdInfo::try_drop_callbacks() {
+  if (callbacks_ != nullptr && callbacks_->download_callback_ == nullptr && callbacks_->upload_callback_ == nullptr) {
+    callbacks_ = nullptr;
+  }
+}
+
 FileManager::FileIdInfo *FileManager::get_file_id_info(FileId file_id) {
   CHECK(static_cast<size_t>(file_id.get()) < file_id_info_.size());
   return &file_id_info_[file_id.get()];
@@ -1664,21 +1721,23 @@ Result<FileId> FileManager::merge(FileId x_file_id, FileId y_file_id, bool no_sy
     auto *info = get_file_id_info(file_id);
     if (info->download_priority_ != 0 && file_view.has_local_location()) {
       info->download_priority_ = 0;
-      if (info->download_callback_) {
-        info->download_callback_->on_download_ok(file_id);
-        info->download_callback_.reset();
+      auto callback = info->extract_download_callback();
+      if (callback) {
+        callback->on_download_ok(file_id);
       }
     }
     if (info->upload_priority_ != 0 && file_view.has_active_upload_remote_location()) {
       info->upload_priority_ = 0;
-      if (info->upload_callback_) {
-        info->upload_callback_->on_upload_ok(file_id, nullptr);
-        info->upload_callback_.reset();
+      auto callback = info->extract_upload_callback();
+      if (callback) {
+        callback->on_upload_ok(file_id, nullptr);
       }
     }
   }
 
+  // no file identifiers refer to the other node anymore, so it can be reused
   file_nodes_[node_ids[other_node_i]] = nullptr;
+  empty_file_node_ids_.push_back(node_ids[other_node_i]);
 
   run_generate(node);
   run_download(node, false);
@@ -2119,7 +2178,8 @@ void FileManager::delete_file(FileId file_id, Promise<Unit> promise, const char
       LOG(INFO) << "Unlink file " << file_id << " at " << file_view.local_location().path_;
       clear_from_pmc(node);
 
-      context_->on_new_file(-file_view.size(), -file_view.get_allocated_local_size(), -1);
+      context_->on_new_file(file_view.get_type(), file_view.owner_dialog_id(), -file_view.size(),
+                            -file_view.get_allocated_local_size(), -1);
       unlink(file_view.local_location().path_).ignore();
       node->drop_local_location();
       try_flush_node(node, "delete_file 1");
@@ -2191,15 +2251,16 @@ void FileManager::download(FileId file_id, std::shared_ptr<DownloadCallback> cal
   node->set_download_limit(limit);
   auto *file_info = get_file_id_info(file_id);
   CHECK(new_priority == 0 || callback);
-  if (file_info->download_callback_ != nullptr && file_info->download_callback_.get() != callback.get()) {
+  const auto &old_callback = file_info->get_download_callback();
+  if (old_callback != nullptr && old_callback.get() != callback.get()) {
     // the callback will be destroyed soon and lost forever
     // this would be an error and should never happen, unless we cancel previous download query
     // in that case we send an error to the callback
     CHECK(new_priority == 0);
-    file_info->download_callback_->on_download_error(file_id, Status::Error(200, "Canceled"));
+    old_callback->on_download_error(file_id, Status::Error(200, "Canceled"));
   }
   file_info->download_priority_ = narrow_cast<int8>(new_priority);
-  file_info->download_callback_ = std::move(callback);
+  file_info->set_download_callback(std::move(callback));
   // TODO: send current progress?
 
   run_generate(node);
@@ -2273,6 +2334,18 @@ void FileManager::run_download(FileNodePtr node, bool force_update_priority) {
   CHECK(!node->file_ids_.empty());
   auto file_id = node->main_file_id_;
 
+  if (node->local_.type() == LocalFileLocation::Type::Empty) {
+    auto r_local = get_shared_local_location(file_view);
+    if (r_local.is_ok()) {
+      LOG(INFO) << "Use copy of file " << file_id << " from the shared files directory";
+      QueryId id = queries_container_.create(Query{file_id, Query::Type::Download});
+      node->download_id_ = id;
+      node->is_download_started_ = false;
+      send_closure_later(actor_id(this), &FileManager::on_download_ok, id, r_local.move_as_ok(), node->size_, true);
+      return;
+    }
+  }
+
   if (node->need_reload_photo_ && file_view.may_reload_photo()) {
     LOG(INFO) << "Reload photo from file " << node->main_file_id_;
     QueryId id = queries_container_.create(Query{file_id, Query::Type::DownloadReloadDialog});
@@ -2337,6 +2410,53 @@ void FileManager::run_download(FileNodePtr node, bool force_update_priority) {
                download_limit, priority);
 }
 
+Result<FullLocalFileLocation> FileManager::get_shared_local_location(const FileView &file_view) {
+  if (get_shared_files_dir().empty()) {
+    return Status::Error("There is no shared files directory");
+  }
+  auto unique_file_id = file_view.get_unique_file_id();
+  if (unique_file_id.empty() || !file_view.has_remote_location() || file_view.is_encrypted_any() ||
+      file_view.size() == 0) {
+    return Status::Error("File can't be shared");
+  }
+  auto shared_path = get_shared_file_path(unique_file_id);
+  TRY_RESULT(shared_stat, stat(shared_path));
+  if (!shared_stat.is_reg_ || shared_stat.size_ != file_view.size()) {
+    return Status::Error("Shared file has wrong size");
+  }
+
+  // the file is hard linked to a temporary path first, because link can't replace the file created by create_from_temp
+  auto file_type = file_view.get_type();
+  TRY_RESULT(temp_file, open_temp_file(file_type));
+  temp_file.first.close();
+  auto temp_path = std::move(temp_file.second);
+  TRY_STATUS(unlink(temp_path));
+  TRY_STATUS(link(shared_path, temp_path));
+  auto r_path = create_from_temp(temp_path, get_files_dir(file_type), file_view.suggested_path());
+  if (r_path.is_error()) {
+    unlink(temp_path).ignore();
+    return r_path.move_as_error();
+  }
+  return FullLocalFileLocation(file_type, r_path.move_as_ok(), 0);
+}
+
+void FileManager::add_shared_file(const FileView &file_view) {
+  auto shared_dir = get_shared_files_dir();
+  if (shared_dir.empty() || !file_view.has_local_location() || !file_view.has_remote_location() ||
+      file_view.is_encrypted_any()) {
+    return;
+  }
+  auto unique_file_id = file_view.get_unique_file_id();
+  if (unique_file_id.empty()) {
+    return;
+  }
+  auto status = mkpath(shared_dir);
+  if (status.is_ok()) {
+    status = link(file_view.local_location().path_, get_shared_file_path(unique_file_id));
+  }
+  LOG_IF(INFO, status.is_error()) << "Failed to add file to the shared files directory: " << status;
+}
+
 class FileManager::ForceUploadActor final : public Actor {
  public:
   ForceUploadActor(FileManager *file_manager, FileId file_id, std::shared_ptr<FileManager::UploadCallback> callback,
@@ -2550,7 +2670,7 @@ void FileManager::resume_upload(FileId file_id, std::vector<int> bad_parts, std:
   CHECK(new_priority == 0 || callback);
   file_info->upload_order_ = upload_order;
   file_info->upload_priority_ = narrow_cast<int8>(new_priority);
-  file_info->upload_callback_ = std::move(callback);
+  file_info->set_upload_callback(std::move(callback));
   // TODO: send current progress?
 
   run_generate(node);
@@ -3277,6 +3397,17 @@ vector<tl_object_ptr<telegram_api::InputDocument>> FileManager::get_input_docume
   return result;
 }
 
+void FileManager::memory_stats(MemoryStats &stats) const {
+  auto file_node_count = file_nodes_.size() - empty_file_node_ids_.size();
+  stats.add("file_nodes_", file_node_count,
+            file_nodes_.size() * sizeof(unique_ptr<FileNode>) + file_node_count * sizeof(FileNode));
+  stats.add_container("file_id_info_", file_id_info_);
+  stats.add_container("file_hash_to_file_id_", file_hash_to_file_id_);
+  stats.add_container("local_location_to_file_id_", local_location_to_file_id_);
+  stats.add_container("generate_location_to_file_id_", generate_location_to_file_id_);
+  stats.add_container("pmc_id_to_file_node_id_", pmc_id_to_file_node_id_);
+}
+
 bool FileManager::extract_was_uploaded(const tl_object_ptr<telegram_api::InputMedia> &input_media) {
   if (input_media == nullptr) {
     return false;
@@ -3351,6 +3482,12 @@ FileId FileManager::next_file_id() {
 }
 
 FileManager::FileNodeId FileManager::next_file_node_id() {
+  if (!empty_file_node_ids_.empty()) {
+    auto res = empty_file_node_ids_.back();
+    empty_file_node_ids_.pop_back();
+    CHECK(file_nodes_[res] == nullptr);
+    return res;
+  }
   auto res = static_cast<FileNodeId>(file_nodes_.size());
   file_nodes_.emplace_back(nullptr);
   return res;
@@ -3469,11 +3606,15 @@ void FileManager::on_download_ok(QueryId query_id, FullLocalFileLocation local,
     status = Status::Error(PSLICE() << "Can't register local file after download: " << r_new_file_id.error().message());
   } else {
     if (is_new) {
-      context_->on_new_file(size, get_file_view(r_new_file_id.ok()).get_allocated_local_size(), 1);
+      auto new_file_view = get_file_view(r_new_file_id.ok());
+      context_->on_new_file(new_file_view.get_type(), get_file_view(file_id).owner_dialog_id(), size,
+                            new_file_view.get_allocated_local_size(), 1);
     }
     auto r_file_id = merge(r_new_file_id.ok(), file_id);
     if (r_file_id.is_error()) {
       status = r_file_id.move_as_error();
+    } else if (is_new) {
+      add_shared_file(get_file_view(r_file_id.ok()));
     }
   }
   if (status.is_error()) {
@@ -3527,20 +3668,20 @@ void FileManager::on_upload_ok(QueryId query_id, FileType file_type, PartialRemo
       input_file = make_tl_object<telegram_api::inputEncryptedFileUploaded>(
           partial_remote.file_id_, partial_remote.part_count_, "", file_view.encryption_key().calc_fingerprint());
     }
-    if (file_info->upload_callback_) {
-      file_info->upload_callback_->on_upload_encrypted_ok(file_id, std::move(input_file));
+    auto callback = file_info->extract_upload_callback();
+    if (callback) {
+      callback->on_upload_encrypted_ok(file_id, std::move(input_file));
       file_node->set_upload_pause(file_id);
-      file_info->upload_callback_.reset();
     }
   } else if (file_view.is_secure()) {
     tl_object_ptr<telegram_api::InputSecureFile> input_file;
     input_file = make_tl_object<telegram_api::inputSecureFileUploaded>(
         partial_remote.file_id_, partial_remote.part_count_, "" /*md5*/, BufferSlice() /*file_hash*/,
         BufferSlice() /*encrypted_secret*/);
-    if (file_info->upload_callback_) {
-      file_info->upload_callback_->on_upload_secure_ok(file_id, std::move(input_file));
+    auto callback = file_info->extract_upload_callback();
+    if (callback) {
+      callback->on_upload_secure_ok(file_id, std::move(input_file));
       file_node->upload_pause_ = file_id;
-      file_info->upload_callback_.reset();
     }
   } else {
     tl_object_ptr<telegram_api::InputFile> input_file;
@@ -3551,10 +3692,10 @@ void FileManager::on_upload_ok(QueryId query_id, FileType file_type, PartialRemo
       input_file = make_tl_object<telegram_api::inputFile>(partial_remote.file_id_, partial_remote.part_count_,
                                                            std::move(file_name), "");
     }
-    if (file_info->upload_callback_) {
-      file_info->upload_callback_->on_upload_ok(file_id, std::move(input_file));
+    auto callback = file_info->extract_upload_callback();
+    if (callback) {
+      callback->on_upload_ok(file_id, std::move(input_file));
       file_node->set_upload_pause(file_id);
-      file_info->upload_callback_.reset();
     }
   }
 }
@@ -3642,7 +3783,8 @@ void FileManager::on_generate_ok(QueryId query_id, FullLocalFileLocation local)
 
   FileView file_view(file_node);
   if (!file_view.has_generate_location() || !begins_with(file_view.generate_location().conversion_, "#file_id#")) {
-    context_->on_new_file(file_view.size(), file_view.get_allocated_local_size(), 1);
+    context_->on_new_file(file_view.get_type(), file_view.owner_dialog_id(), file_view.size(),
+                          file_view.get_allocated_local_size(), 1);
   }
 
   run_upload(file_node, {});
@@ -3791,16 +3933,16 @@ void FileManager::on_error_impl(FileNodePtr node, Query::Type type, bool was_act
     auto *info = get_file_id_info(file_id);
     if (info->download_priority_ != 0) {
       info->download_priority_ = 0;
-      if (info->download_callback_) {
-        info->download_callback_->on_download_error(file_id, status.clone());
-        info->download_callback_.reset();
+      auto callback = info->extract_download_callback();
+      if (callback) {
+        callback->on_download_error(file_id, status.clone());
       }
     }
     if (info->upload_priority_ != 0) {
       info->upload_priority_ = 0;
-      if (info->upload_callback_) {
-        info->upload_callback_->on_upload_error(file_id, status.clone());
-        info->upload_callback_.reset();
+      auto callback = info->extract_upload_callback();
+      if (callback) {
+        callback->on_upload_error(file_id, status.clone());
       }
     }
   }
@@ -27,6 +27,7 @@
 #include "td/utils/common.h"
 #include "td/utils/Container.h"
 #include "td/utils/Enumerator.h"
+#include "td/utils/FlatHashMap.h"
 #include "td/utils/logging.h"
 #include "td/utils/optional.h"
 #include "td/utils/Slice.h"
@@ -36,7 +37,6 @@
 #include <map>
 #include <memory>
 #include <set>
-#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 
@@ -46,6 +46,7 @@ extern int VERBOSITY_NAME(update_file);
 
 class FileData;
 class FileDbInterface;
+class MemoryStats;
 
 enum class FileLocationSource : int8 { None, FromUser, FromBinlog, FromDatabase, FromServer };
 
@@ -376,7 +377,7 @@ class FileManager final : public FileLoadManager::Callback {
 
   class Context {
    public:
-    virtual void on_new_file(int64 size, int64 real_size, int32 cnt) = 0;
+    virtual void on_new_file(FileType file_type, DialogId owner_dialog_id, int64 size, int64 real_size, int32 cnt) = 0;
 
     virtual void on_file_updated(FileId size) = 0;
 
@@ -481,6 +482,8 @@ class FileManager final : public FileLoadManager::Callback {
 
   vector<tl_object_ptr<telegram_api::InputDocument>> get_input_documents(const vector<FileId> &file_ids);
 
+  void memory_stats(MemoryStats &stats) const;
+
   static bool extract_was_uploaded(const tl_object_ptr<telegram_api::InputMedia> &input_media);
   static bool extract_was_thumbnail_uploaded(const tl_object_ptr<telegram_api::InputMedia> &input_media);
   static string extract_file_reference(const tl_object_ptr<telegram_api::InputMedia> &input_media);
@@ -529,6 +532,11 @@ class FileManager final : public FileLoadManager::Callback {
 
   friend StringBuilder &operator<<(StringBuilder &string_builder, Query::Type type);
 
+  struct FileIdCallbacks {
+    std::shared_ptr<DownloadCallback> download_callback_;
+    std::shared_ptr<UploadCallback> upload_callback_;
+  };
+
   struct FileIdInfo {
     FileNodeId node_id_{0};
     bool send_updates_flag_{false};
@@ -540,8 +548,18 @@ class FileManager final : public FileLoadManager::Callback {
 
     uint64 upload_order_{0};
 
-    std::shared_ptr<DownloadCallback> download_callback_;
-    std::shared_ptr<UploadCallback> upload_callback_;
+    // callbacks are allocated only while there is an active download or upload
+    unique_ptr<FileIdCallbacks> callbacks_;
+
+    const std::shared_ptr<DownloadCallback> &get_download_callback() const;
+    std::shared_ptr<DownloadCallback> extract_download_callback();
+    void set_download_callback(std::shared_ptr<DownloadCallback> callback);
+
+    const std::shared_ptr<UploadCallback> &get_upload_callback() const;
+    std::shared_ptr<UploadCallback> extract_upload_callback();
+    void set_upload_callback(std::shared_ptr<UploadCallback> callback);
+
+    void try_drop_callbacks();
   };
 
   class ForceUploadActor;
@@ -566,7 +584,7 @@ class FileManager final : public FileLoadManager::Callback {
   };
   Enumerator<RemoteInfo> remote_location_info_;
 
-  std::unordered_map<string, FileId> file_hash_to_file_id_;
+  FlatHashMap<string, FileId> file_hash_to_file_id_;
 
   std::map<FullLocalFileLocation, FileId> local_location_to_file_id_;
   std::map<FullGenerateFileLocation, FileId> generate_location_to_file_id_;
@@ -575,6 +593,7 @@ class FileManager final : public FileLoadManager::Callback {
   vector<FileIdInfo> file_id_info_;
   vector<int32> empty_file_ids_;
   vector<unique_ptr<FileNode>> file_nodes_;
+  vector<FileNodeId> empty_file_node_ids_;
   ActorOwn<FileLoadManager> file_load_manager_;
   ActorOwn<FileGenerateManager> file_generate_manager_;
 
@@ -637,6 +656,9 @@ class FileManager final : public FileLoadManager::Callback {
   void run_download(FileNodePtr node, bool force_update_priority);
   void run_generate(FileNodePtr node);
 
+  static Result<FullLocalFileLocation> get_shared_local_location(const FileView &file_view);
+  static void add_shared_file(const FileView &file_view);
+
   void on_start_download(QueryId query_id) final;
   void on_partial_download(QueryId query_id, PartialLocalFileLocation partial_local, int64 ready_size,
                            int64 size) final;
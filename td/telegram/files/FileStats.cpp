@@ -196,6 +196,37 @@ vector<DialogId> FileStats::get_dialog_ids() const {
   return res;
 }
 
+FileStats FileStats::get_stats_by_owner_dialog_id() const {
+  FileStats result(false, true);
+  if (split_by_owner_dialog_id_) {
+    result.stat_by_owner_dialog_id_ = stat_by_owner_dialog_id_;
+  } else {
+    DialogId dialog_id;
+    result.stat_by_owner_dialog_id_[dialog_id] = stat_by_type_;
+  }
+  return result;
+}
+
+bool FileStats::add_file_stat(FileType file_type, DialogId owner_dialog_id, int64 size, int32 cnt) {
+  CHECK(split_by_owner_dialog_id_);
+  auto pos = static_cast<size_t>(file_type);
+  CHECK(pos < stat_by_type_.size());
+  auto &stat = stat_by_owner_dialog_id_[owner_dialog_id][pos];
+  stat.size += size;
+  stat.cnt += cnt;
+  if (stat.size < 0 || stat.cnt < 0) {
+    return false;
+  }
+  if (stat.cnt == 0) {
+    stat.size = 0;
+    const auto &by_type = stat_by_owner_dialog_id_[owner_dialog_id];
+    if (std::all_of(by_type.begin(), by_type.end(), [](const FileTypeStat &stat) { return stat.cnt == 0; })) {
+      stat_by_owner_dialog_id_.erase(owner_dialog_id);
+    }
+  }
+  return true;
+}
+
 vector<FullFileInfo> FileStats::get_all_files() {
   return std::move(all_files_);
 }
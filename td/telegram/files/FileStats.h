@@ -10,6 +10,7 @@
 #include "td/telegram/files/FileType.h"
 
 #include "td/utils/common.h"
+#include "td/utils/misc.h"
 #include "td/utils/StringBuilder.h"
 #include "td/utils/tl_helpers.h"
 
@@ -88,6 +89,8 @@ class FileStats {
   friend StringBuilder &operator<<(StringBuilder &sb, const FileStats &file_stats);
 
  public:
+  FileStats() = default;
+
   FileStats(bool need_all_files, bool split_by_owner_dialog_id)
       : need_all_files_(need_all_files), split_by_owner_dialog_id_(split_by_owner_dialog_id) {
   }
@@ -104,9 +107,48 @@ class FileStats {
 
   vector<DialogId> get_dialog_ids() const;
 
+  bool is_split_by_owner_dialog_id() const {
+    return split_by_owner_dialog_id_;
+  }
+
   FileTypeStat get_total_nontemp_stat() const;
 
   vector<FullFileInfo> get_all_files();
+
+  // returns a copy of the statistics without the list of files, split by owner dialog identifier
+  FileStats get_stats_by_owner_dialog_id() const;
+
+  // applies a change of cnt files with the given total size; returns false if the statistics became inconsistent
+  bool add_file_stat(FileType file_type, DialogId owner_dialog_id, int64 size, int32 cnt);
+
+  template <class StorerT>
+  void store(StorerT &storer) const {
+    using ::td::store;
+    CHECK(split_by_owner_dialog_id_);
+    store(narrow_cast<int32>(stat_by_owner_dialog_id_.size()), storer);
+    for (auto &by_dialog : stat_by_owner_dialog_id_) {
+      store(by_dialog.first, storer);
+      store(vector<FileTypeStat>(by_dialog.second.begin(), by_dialog.second.end()), storer);
+    }
+  }
+
+  template <class ParserT>
+  void parse(ParserT &parser) {
+    using ::td::parse;
+    split_by_owner_dialog_id_ = true;
+    int32 dialog_count;
+    parse(dialog_count, parser);
+    for (int32 i = 0; i < dialog_count && parser.get_error() == nullptr; i++) {
+      DialogId dialog_id;
+      vector<FileTypeStat> stats;
+      parse(dialog_id, parser);
+      parse(stats, parser);
+      auto &by_type = stat_by_owner_dialog_id_[dialog_id];
+      for (size_t pos = 0; pos < stats.size() && pos < by_type.size(); pos++) {
+        by_type[pos] = stats[pos];
+      }
+    }
+  }
 };
 
 StringBuilder &operator<<(StringBuilder &sb, const FileStats &file_stats);
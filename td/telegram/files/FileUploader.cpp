@@ -162,8 +162,10 @@ Result<FileLoader::PrefixInfo> FileUploader::on_update_local_location(const Loca
 
     fd_.close();
     fd_ = res_fd.move_as_ok();
+    fd_.advise(FileFd::Advice::Sequential, 0, 0).ignore();
     fd_path_ = path;
     is_temp_ = is_temp;
+    read_ahead_offset_ = 0;
   }
   if (local_is_ready) {
     CHECK(!fd_.empty());
@@ -273,6 +275,7 @@ Result<std::pair<NetQueryPtr, bool>> FileUploader::start_part(Part part, int32 p
   if (size != part.size) {
     return Status::Error("Failed to read file part");
   }
+  read_ahead(part);
 
   NetQueryPtr net_query;
   if (big_flag_) {
@@ -287,6 +290,20 @@ Result<std::pair<NetQueryPtr, bool>> FileUploader::start_part(Part part, int32 p
   return std::make_pair(std::move(net_query), false);
 }
 
+void FileUploader::read_ahead(const Part &part) {
+  // ask the OS to read next parts in background, so they are already in memory when they will be started
+  auto read_ahead_end = part.offset + static_cast<int64>(get_part_size()) * (READ_AHEAD_PART_COUNT + 1);
+  if (local_is_ready_) {
+    read_ahead_end = min(read_ahead_end, local_size_);
+  }
+  auto read_ahead_begin = max(read_ahead_offset_, part.offset + static_cast<int64>(part.size));
+  if (read_ahead_begin >= read_ahead_end) {
+    return;
+  }
+  fd_.advise(FileFd::Advice::WillNeed, read_ahead_begin, read_ahead_end - read_ahead_begin).ignore();
+  read_ahead_offset_ = read_ahead_end;
+}
+
 Result<size_t> FileUploader::process_part(Part part, NetQueryPtr net_query) {
   if (net_query->is_error()) {
     return std::move(net_query->error());
@@ -338,6 +355,7 @@ void FileUploader::try_release_fd() {
 Status FileUploader::acquire_fd() {
   if (fd_.empty()) {
     TRY_RESULT_ASSIGN(fd_, FileFd::open(fd_path_, FileFd::Read));
+    fd_.advise(FileFd::Advice::Sequential, 0, 0).ignore();
   }
   return Status::OK();
 }
@@ -52,8 +52,11 @@ class FileUploader final : public FileLoader {
   int64 generate_offset_ = 0;
   int64 next_offset_ = 0;
 
+  static constexpr int32 READ_AHEAD_PART_COUNT = 8;
+
   FileFd fd_;
   string fd_path_;
+  int64 read_ahead_offset_ = 0;
   bool is_temp_ = false;
   int64 file_id_ = 0;
   bool big_flag_ = false;
@@ -72,6 +75,7 @@ class FileUploader final : public FileLoader {
                                               int64 file_size) final TD_WARN_UNUSED_RESULT;
 
   Status generate_iv_map();
+  void read_ahead(const Part &part);
 
   bool keep_fd_ = false;
   void keep_fd_flag(bool keep_fd) final;
@@ -70,7 +70,16 @@ int32 PartsManager::get_pending_count() const {
 }
 
 void PartsManager::set_streaming_limit(int64 limit) {
+  requested_streaming_limit_ = limit;
   streaming_limit_ = limit;
+  if (limit > 0 && streaming_read_ahead_size_ > 0) {
+    auto read_ahead_size = streaming_read_ahead_size_;
+    if (!unknown_size_flag_) {
+      // read ahead must not wrap around the end of the file
+      read_ahead_size = clamp(get_size() - streaming_offset_ - limit, static_cast<int64>(0), read_ahead_size);
+    }
+    streaming_limit_ += read_ahead_size;
+  }
   streaming_ready_size_ = 0;
   if (streaming_limit_ == 0) {
     return;
@@ -82,6 +91,15 @@ void PartsManager::set_streaming_limit(int64 limit) {
   }
 }
 
+void PartsManager::set_streaming_read_ahead_size(int64 size) {
+  CHECK(size >= 0);
+  if (size == streaming_read_ahead_size_) {
+    return;
+  }
+  streaming_read_ahead_size_ = size;
+  set_streaming_limit(requested_streaming_limit_);
+}
+
 Status PartsManager::init_no_size(size_t part_size, const std::vector<int> &ready_parts) {
   unknown_size_flag_ = true;
   size_ = 0;
@@ -91,7 +109,7 @@ Status PartsManager::init_no_size(size_t part_size, const std::vector<int> &read
   if (part_size != 0) {
     part_size_ = part_size;
   } else {
-    part_size_ = 32 << 10;
+    part_size_ = max(static_cast<size_t>(32 << 10), preferred_part_size_);
     while (calc_part_count(expected_size_, part_size_) > MAX_PART_COUNT) {
       part_size_ *= 2;
       CHECK(part_size_ <= MAX_PART_SIZE);
@@ -107,6 +125,11 @@ Status PartsManager::init_no_size(size_t part_size, const std::vector<int> &read
   return init_common(ready_parts);
 }
 
+void PartsManager::set_preferred_part_size(size_t part_size) {
+  CHECK(part_size <= MAX_PART_SIZE && (part_size & (part_size - 1)) == 0);
+  preferred_part_size_ = part_size;
+}
+
 Status PartsManager::init(int64 size, int64 expected_size, bool is_size_final, size_t part_size,
                           const std::vector<int> &ready_parts, bool use_part_count_limit, bool is_upload) {
   CHECK(expected_size >= size);
@@ -133,7 +156,7 @@ Status PartsManager::init(int64 size, int64 expected_size, bool is_size_final, s
       return Status::Error("FILE_UPLOAD_RESTART");
     }
   } else {
-    part_size_ = 64 << 10;
+    part_size_ = max(static_cast<size_t>(64 << 10), preferred_part_size_);
     while (calc_part_count(expected_size_, part_size_) > MAX_PART_COUNT) {
       part_size_ *= 2;
       CHECK(part_size_ <= MAX_PART_SIZE);
@@ -224,6 +247,10 @@ int64 PartsManager::get_streaming_offset() const {
   return streaming_offset_;
 }
 
+bool PartsManager::is_streaming() const {
+  return streaming_offset_ != 0 || streaming_limit_ != 0;
+}
+
 string PartsManager::get_bitmask() {
   int32 prefix_count = -1;
   if (need_check_) {
@@ -23,6 +23,8 @@ class PartsManager {
  public:
   Status init(int64 size, int64 expected_size, bool is_size_final, size_t part_size,
               const std::vector<int> &ready_parts, bool use_part_count_limit, bool is_upload) TD_WARN_UNUSED_RESULT;
+  // must be called before init; used only if part size isn't specified explicitly
+  void set_preferred_part_size(size_t part_size);
   bool may_finish();
   bool ready();
   bool unchecked_ready();
@@ -37,6 +39,8 @@ class PartsManager {
   void set_checked_prefix_size(int64 size);
   int32 set_streaming_offset(int64 offset, int64 limit);
   void set_streaming_limit(int64 limit);
+  // extends non-zero streaming limit by the given number of bytes, which are downloaded after the requested ones
+  void set_streaming_read_ahead_size(int64 size);
 
   int64 get_checked_prefix_size() const;
   int64 get_unchecked_ready_prefix_size();
@@ -50,6 +54,7 @@ class PartsManager {
   int32 get_unchecked_ready_prefix_count();
   int32 get_ready_prefix_count();
   int64 get_streaming_offset() const;
+  bool is_streaming() const;
   string get_bitmask();
   int32 get_pending_count() const;
 
@@ -76,12 +81,15 @@ class PartsManager {
   int64 streaming_ready_size_{0};
 
   size_t part_size_{0};
+  size_t preferred_part_size_{0};
   int part_count_{0};
   int pending_count_{0};
   int first_empty_part_{0};
   int first_not_ready_part_{0};
   int64 streaming_offset_{0};
   int64 streaming_limit_{0};
+  int64 requested_streaming_limit_{0};
+  int64 streaming_read_ahead_size_{0};
   int first_streaming_empty_part_{0};
   int first_streaming_not_ready_part_{0};
   vector<PartStatus> part_status_;
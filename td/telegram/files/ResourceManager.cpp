@@ -13,8 +13,10 @@
 #include "td/utils/logging.h"
 #include "td/utils/misc.h"
 #include "td/utils/ScopeGuard.h"
+#include "td/utils/Time.h"
 
 #include <algorithm>
+#include <tuple>
 
 namespace td {
 
@@ -54,6 +56,7 @@ void ResourceManager::update_resources(const ResourceState &resource_state) {
   auto node = (*node_ptr).get();
   CHECK(node);
   VLOG(file_loader) << "Before total: " << resource_state_ << "; node " << node_id << ": " << node->resource_state_;
+  update_bandwidth(resource_state.get_transferred_size() - node->resource_state_.get_transferred_size());
   resource_state_ -= node->resource_state_;
   node->resource_state_.update_master(resource_state);
   resource_state_ += node->resource_state_;
@@ -124,6 +127,75 @@ bool ResourceManager::satisfy_node(NodeId file_node_id) {
   return true;
 }
 
+int64 ResourceManager::get_resource_limit() const {
+  if (mode_ != Mode::Fair) {
+    return MAX_RESOURCE_LIMIT;
+  }
+  // allow to have in flight data for 2 seconds at the estimated bandwidth to notice when it grows
+  return clamp(static_cast<int64>(bandwidth_ * 2.0), MIN_RESOURCE_LIMIT, MAX_RESOURCE_LIMIT);
+}
+
+void ResourceManager::update_bandwidth(int64 transferred_size) {
+  if (mode_ != Mode::Fair) {
+    return;
+  }
+  auto now = Time::now();
+  if (bandwidth_sample_start_time_ == 0.0) {
+    bandwidth_sample_start_time_ = now;
+    return;
+  }
+  bandwidth_sample_size_ += transferred_size;
+  auto elapsed = now - bandwidth_sample_start_time_;
+  if (elapsed < 1.0) {
+    return;
+  }
+  // the maximum is slowly forgotten, so idle periods don't reduce the estimate too much
+  bandwidth_ = max(static_cast<double>(bandwidth_sample_size_) / elapsed, bandwidth_ * 0.9);
+  bandwidth_sample_start_time_ = now;
+  bandwidth_sample_size_ = 0;
+  VLOG(file_loader) << "Estimated bandwidth is " << static_cast<int64>(bandwidth_) << " bytes per second";
+}
+
+void ResourceManager::loop_fair() {
+  // give resources one unit at a time to the node with the least virtual time; streaming nodes have the nearest
+  // deadline, because the data is needed for playback right now, so they are served first
+  vector<Node *> changed_nodes;
+  while (true) {
+    auto unused = resource_state_.unused();
+    Node *best_node = nullptr;
+    for (auto &it : to_xload_) {
+      auto node_ptr = nodes_container_.get(it.second);
+      CHECK(node_ptr != nullptr);
+      auto node = (*node_ptr).get();
+      CHECK(node);
+      auto unit_size = narrow_cast<int64>(node->resource_state_.unit_size());
+      if (node->resource_state_.estimated_extra() <= 0 || unit_size > unused) {
+        continue;
+      }
+      if (best_node == nullptr ||
+          std::make_tuple(!node->resource_state_.is_streaming(), node->virtual_time_) <
+              std::make_tuple(!best_node->resource_state_.is_streaming(), best_node->virtual_time_)) {
+        best_node = node;
+      }
+    }
+    if (best_node == nullptr) {
+      break;
+    }
+
+    auto unit_size = narrow_cast<int64>(best_node->resource_state_.unit_size());
+    resource_state_.start_use(unit_size);
+    best_node->resource_state_.update_limit(unit_size);
+    virtual_time_ = best_node->virtual_time_;
+    best_node->virtual_time_ += static_cast<double>(unit_size) / (best_node->priority_ + 1);
+    if (std::find(changed_nodes.begin(), changed_nodes.end(), best_node) == changed_nodes.end()) {
+      changed_nodes.push_back(best_node);
+    }
+  }
+  for (auto *node : changed_nodes) {
+    send_closure(node->callback_, &FileLoaderActor::update_resources, node->resource_state_);
+  }
+}
+
 void ResourceManager::loop() {
   if (stop_flag_) {
     if (nodes_container_.empty()) {
@@ -132,7 +204,7 @@ void ResourceManager::loop() {
     return;
   }
   auto active_limit = resource_state_.active_limit();
-  resource_state_.update_limit(MAX_RESOURCE_LIMIT - active_limit);
+  resource_state_.update_limit(get_resource_limit() - active_limit);
   LOG(INFO) << tag("unused", resource_state_.unused());
 
   if (mode_ == Mode::Greedy) {
@@ -157,10 +229,20 @@ void ResourceManager::loop() {
         break;
       }
     }
+  } else if (mode_ == Mode::Fair) {
+    loop_fair();
   }
 }
 
 void ResourceManager::add_node(NodeId node_id, int8 priority) {
+  auto node_ptr = nodes_container_.get(node_id);
+  CHECK(node_ptr != nullptr);
+  auto node = (*node_ptr).get();
+  CHECK(node);
+  node->priority_ = static_cast<int8>(priority >= 0 ? priority : -priority);
+  // a new node must not be able to get all resources because of its small virtual time
+  node->virtual_time_ = max(node->virtual_time_, virtual_time_);
+
   if (priority >= 0) {
     auto it = std::find_if(to_xload_.begin(), to_xload_.end(), [&](auto &x) { return x.first <= priority; });
     to_xload_.insert(it, std::make_pair(priority, node_id));
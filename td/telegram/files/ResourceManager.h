@@ -20,7 +20,8 @@ namespace td {
 
 class ResourceManager final : public Actor {
  public:
-  enum class Mode : int32 { Baseline, Greedy };
+  // Fair mode estimates available bandwidth and splits resources between workers using weighted fair queuing
+  enum class Mode : int32 { Baseline, Greedy, Fair };
   explicit ResourceManager(Mode mode) : mode_(mode) {
   }
   // use through ActorShared
@@ -30,6 +31,7 @@ class ResourceManager final : public Actor {
   void register_worker(ActorShared<FileLoaderActor> callback, int8 priority);
 
   static constexpr int64 MAX_RESOURCE_LIMIT = 1 << 21;
+  static constexpr int64 MIN_RESOURCE_LIMIT = 1 << 19;
 
  private:
   Mode mode_;
@@ -40,6 +42,9 @@ class ResourceManager final : public Actor {
     ResourceState resource_state_;
     ActorShared<FileLoaderActor> callback_;
 
+    int8 priority_ = 0;
+    double virtual_time_ = 0.0;  // resources given to the node divided by its weight
+
     HeapNode *as_heap_node() {
       return static_cast<HeapNode *>(this);
     }
@@ -53,6 +58,12 @@ class ResourceManager final : public Actor {
   KHeap<int64> by_estimated_extra_;
   ResourceState resource_state_;
 
+  // bandwidth estimation for the Fair mode
+  double virtual_time_ = 0.0;
+  double bandwidth_ = 0.0;
+  double bandwidth_sample_start_time_ = 0.0;
+  int64 bandwidth_sample_size_ = 0;
+
   ActorShared<> parent_;
   bool stop_flag_ = false;
 
@@ -60,6 +71,10 @@ class ResourceManager final : public Actor {
 
   void loop() final;
 
+  int64 get_resource_limit() const;
+  void update_bandwidth(int64 transferred_size);
+  void loop_fair();
+
   void add_to_heap(Node *node);
   bool satisfy_node(NodeId file_node_id);
   void add_node(NodeId node_id, int8 priority);
@@ -53,6 +53,22 @@ class ResourceState {
     unit_size_ = new_unit_size;
   }
 
+  void add_transferred_size(int64 size) {
+    transferred_size_ += size;
+  }
+
+  int64 get_transferred_size() const {
+    return transferred_size_;
+  }
+
+  void set_is_streaming(bool is_streaming) {
+    is_streaming_ = is_streaming;
+  }
+
+  bool is_streaming() const {
+    return is_streaming_;
+  }
+
   int64 active_limit() const {
     return limit_ - used_;
   }
@@ -92,6 +108,8 @@ class ResourceState {
     used_ = other.used_;
     using_ = other.using_;
     unit_size_ = other.unit_size_;
+    transferred_size_ = other.transferred_size_;
+    is_streaming_ = other.is_streaming_;
   }
 
   void update_slave(const ResourceState &other) {
@@ -109,6 +127,8 @@ class ResourceState {
   int64 used_ = 0;             // me
   int64 using_ = 0;            // me
   size_t unit_size_ = 1;       // me
+  int64 transferred_size_ = 0;  // me
+  bool is_streaming_ = false;   // me
 };
 
 }  // namespace td
@@ -164,6 +164,7 @@ void ConnectionCreator::add_proxy(int32 old_proxy_id, string server, int32 port,
     G()->td_db()->get_binlog_pmc()->erase(get_proxy_used_database_key(old_proxy_id));
     proxy_last_used_date_.erase(old_proxy_id);
     proxy_last_used_saved_date_.erase(old_proxy_id);
+    proxy_latency_.erase(old_proxy_id);
   }
 
   auto proxy_id = [&] {
@@ -216,6 +217,7 @@ void ConnectionCreator::remove_proxy(int32 proxy_id, Promise<Unit> promise) {
   }
 
   proxies_.erase(proxy_id);
+  proxy_latency_.erase(proxy_id);
 
   G()->td_db()->get_binlog_pmc()->erase(get_proxy_database_key(proxy_id));
   G()->td_db()->get_binlog_pmc()->erase(get_proxy_used_database_key(proxy_id));
@@ -328,7 +330,7 @@ void ConnectionCreator::ping_proxy(int32 proxy_id, Promise<double> promise) {
         continue;
       }
 
-      ping_proxy_buffered_socket_fd(std::move(ip_address), BufferedFd<SocketFd>(r_socket_fd.move_as_ok()),
+      ping_proxy_buffered_socket_fd(0, std::move(ip_address), BufferedFd<SocketFd>(r_socket_fd.move_as_ok()),
                                     r_transport_type.move_as_ok(), PSTRING() << info.option->get_ip_address(),
                                     PromiseCreator::lambda([actor_id = actor_id(this), token](Result<double> result) {
                                       send_closure(actor_id, &ConnectionCreator::on_ping_main_dc_result, token,
@@ -370,13 +372,14 @@ void ConnectionCreator::ping_proxy_resolved(int32 proxy_id, IPAddress ip_address
   auto socket_fd = r_socket_fd.move_as_ok();
 
   auto connection_promise = PromiseCreator::lambda(
-      [ip_address, promise = std::move(promise), actor_id = actor_id(this), transport_type = extra.transport_type,
+      [proxy_id, ip_address, promise = std::move(promise), actor_id = actor_id(this),
+       transport_type = extra.transport_type,
        debug_str = extra.debug_str](Result<ConnectionData> r_connection_data) mutable {
         if (r_connection_data.is_error()) {
           return promise.set_error(Status::Error(400, r_connection_data.error().public_message()));
         }
         auto connection_data = r_connection_data.move_as_ok();
-        send_closure(actor_id, &ConnectionCreator::ping_proxy_buffered_socket_fd, ip_address,
+        send_closure(actor_id, &ConnectionCreator::ping_proxy_buffered_socket_fd, proxy_id, ip_address,
                      std::move(connection_data.buffered_socket_fd), std::move(transport_type), std::move(debug_str),
                      std::move(promise));
       });
@@ -390,23 +393,26 @@ void ConnectionCreator::ping_proxy_resolved(int32 proxy_id, IPAddress ip_address
   }
 }
 
-void ConnectionCreator::ping_proxy_buffered_socket_fd(IPAddress ip_address, BufferedFd<SocketFd> buffered_socket_fd,
+void ConnectionCreator::ping_proxy_buffered_socket_fd(int32 proxy_id, IPAddress ip_address,
+                                                      BufferedFd<SocketFd> buffered_socket_fd,
                                                       mtproto::TransportType transport_type, string debug_str,
                                                       Promise<double> promise) {
   auto token = next_token();
   auto raw_connection =
       mtproto::RawConnection::create(ip_address, std::move(buffered_socket_fd), std::move(transport_type), nullptr);
-  children_[token] = {
-      false, create_ping_actor(debug_str, std::move(raw_connection), nullptr,
-                               PromiseCreator::lambda([promise = std::move(promise)](
-                                                          Result<unique_ptr<mtproto::RawConnection>> result) mutable {
-                                 if (result.is_error()) {
-                                   return promise.set_error(Status::Error(400, result.error().public_message()));
-                                 }
-                                 auto ping_time = result.ok()->extra().rtt;
-                                 promise.set_value(std::move(ping_time));
-                               }),
-                               create_reference(token))};
+  auto ping_promise = PromiseCreator::lambda([actor_id = actor_id(this), proxy_id, promise = std::move(promise)](
+                                                 Result<unique_ptr<mtproto::RawConnection>> result) mutable {
+    if (result.is_error()) {
+      return promise.set_error(Status::Error(400, result.error().public_message()));
+    }
+    auto ping_time = result.ok()->extra().rtt;
+    if (proxy_id != 0) {
+      send_closure(actor_id, &ConnectionCreator::on_proxy_latency, proxy_id, ping_time);
+    }
+    promise.set_value(std::move(ping_time));
+  });
+  children_[token] = {false, create_ping_actor(debug_str, std::move(raw_connection), nullptr, std::move(ping_promise),
+                                               create_reference(token))};
 }
 
 void ConnectionCreator::set_active_proxy_id(int32 proxy_id, bool from_binlog) {
@@ -540,7 +546,25 @@ td_api::object_ptr<td_api::proxy> ConnectionCreator::get_proxy_object(int32 prox
   auto last_used_date_it = proxy_last_used_date_.find(proxy_id);
   auto last_used_date = last_used_date_it == proxy_last_used_date_.end() ? 0 : last_used_date_it->second;
   return make_tl_object<td_api::proxy>(proxy_id, proxy.server().str(), proxy.port(), last_used_date,
-                                       proxy_id == active_proxy_id_, std::move(type));
+                                       proxy_id == active_proxy_id_, std::move(type), get_proxy_latency(proxy_id));
+}
+
+void ConnectionCreator::on_proxy_latency(int32 proxy_id, double latency) {
+  if (proxies_.count(proxy_id) == 0) {
+    return;
+  }
+  auto &average_latency = proxy_latency_[proxy_id];
+  if (average_latency == 0.0) {
+    average_latency = latency;
+  } else {
+    average_latency = 0.7 * average_latency + 0.3 * latency;
+  }
+  VLOG(connections) << "Average latency of proxy " << proxy_id << " is " << average_latency << " after " << latency;
+}
+
+double ConnectionCreator::get_proxy_latency(int32 proxy_id) const {
+  auto it = proxy_latency_.find(proxy_id);
+  return it == proxy_latency_.end() ? 0.0 : it->second;
 }
 
 void ConnectionCreator::on_network(bool network_flag, uint32 network_generation) {
@@ -631,6 +655,7 @@ void ConnectionCreator::request_raw_connection(DcId dc_id, bool allow_media_only
   }
   client.auth_data = std::move(auth_data);
   client.auth_data_generation++;
+  client.last_query_time = Time::now();
   VLOG(connections) << "Request connection for " << tag("client", format::as_hex(client.hash)) << " to " << dc_id << " "
                     << tag("allow_media_only", allow_media_only);
   client.queries.push_back(std::move(promise));
@@ -843,11 +868,15 @@ void ConnectionCreator::client_loop(ClientInfo &client) {
 
   VLOG(connections) << "In client_loop: " << tag("client", format::as_hex(client.hash));
 
-  // Remove expired ready connections
+  // Remove expired ready connections and connections, which can't be used anymore
   td::remove_if(client.ready_connections,
                 [&, expires_at = Time::now_cached() - ClientInfo::READY_CONNECTIONS_TIMEOUT](auto &v) {
                   bool drop = v.second < expires_at;
                   VLOG_IF(connections, drop) << "Drop expired " << tag("connection", v.first.get());
+                  if (!drop && (v.first->has_error() || v.first->extra().extra != network_generation_)) {
+                    VLOG(connections) << "Drop stale " << tag("connection", v.first.get());
+                    drop = true;
+                  }
                   return drop;
                 });
 
@@ -866,22 +895,43 @@ void ConnectionCreator::client_loop(ClientInfo &client) {
     client.queries.erase(begin, it);
   }
 
+  // Keep some ready connections to not wait for a new connection after a connection error or a network change
+  auto warm_connection_count = get_warm_connection_count(client);
+  auto refresh_at = Time::now_cached() - ClientInfo::READY_CONNECTIONS_REFRESH_TIME;
+  size_t fresh_connection_count = 0;
+  double ready_connections_timeout_at = 0;
+  for (auto &ready_connection : client.ready_connections) {
+    double timeout_at = ready_connection.second + ClientInfo::READY_CONNECTIONS_TIMEOUT;
+    if (warm_connection_count > 0 && ready_connection.second >= refresh_at) {
+      fresh_connection_count++;
+      timeout_at = ready_connection.second + ClientInfo::READY_CONNECTIONS_REFRESH_TIME;
+    }
+    if (ready_connections_timeout_at == 0 || timeout_at < ready_connections_timeout_at) {
+      ready_connections_timeout_at = timeout_at;
+    }
+  }
+  auto need_connection_count = client.queries.size();
+  if (warm_connection_count > fresh_connection_count) {
+    need_connection_count += warm_connection_count - fresh_connection_count;
+  }
+
   // Main loop. Create new connections till needed
   bool check_mode = client.checking_connections != 0 && !proxy.use_proxy();
   while (true) {
     // Check if we need new connections
-    if (client.queries.empty()) {
+    if (need_connection_count == 0) {
       if (!client.ready_connections.empty()) {
-        client_set_timeout_at(client, Time::now() + ClientInfo::READY_CONNECTIONS_TIMEOUT);
+        client_set_timeout_at(client, ready_connections_timeout_at);
       }
       return;
     }
     if (check_mode) {
+      // connections are checked in parallel and DcOptionsSet chooses different options for them
       if (client.checking_connections >= 3) {
         return;
       }
     } else {
-      if (client.pending_connections >= client.queries.size()) {
+      if (client.pending_connections >= need_connection_count) {
         return;
       }
     }
@@ -936,10 +986,17 @@ void ConnectionCreator::client_loop(ClientInfo &client) {
       client.checking_connections++;
     }
 
+    // time of negotiation with the proxy is the latency of the proxy
+    bool is_negotiated =
+        proxy.use_socks5_proxy() || proxy.use_http_tcp_proxy() || extra.transport_type.secret.emulate_tls();
     auto promise = PromiseCreator::lambda(
         [actor_id = actor_id(this), check_mode, transport_type = extra.transport_type, hash = client.hash,
-         debug_str = extra.debug_str,
-         network_generation = network_generation_](Result<ConnectionData> r_connection_data) mutable {
+         debug_str = extra.debug_str, network_generation = network_generation_,
+         proxy_id = is_negotiated ? active_proxy_id_ : 0,
+         begin_time = Time::now()](Result<ConnectionData> r_connection_data) mutable {
+          if (proxy_id != 0 && r_connection_data.is_ok()) {
+            send_closure(actor_id, &ConnectionCreator::on_proxy_latency, proxy_id, Time::now() - begin_time);
+          }
           send_closure(actor_id, &ConnectionCreator::client_create_raw_connection, std::move(r_connection_data),
                        check_mode, std::move(transport_type), hash, std::move(debug_str), network_generation);
         });
@@ -957,6 +1014,22 @@ void ConnectionCreator::client_loop(ClientInfo &client) {
   }
 }
 
+size_t ConnectionCreator::get_warm_connection_count(const ClientInfo &client) const {
+  if (!online_flag_ || client.last_query_time < Time::now_cached() - ClientInfo::WARM_CONNECTIONS_IDLE_TIME) {
+    return 0;
+  }
+  auto warm_connection_count =
+      client.is_media ? G()->shared_config().get_option_integer("warm_media_connection_count", 0)
+                      : G()->shared_config().get_option_integer("warm_connection_count", 1);
+  if (warm_connection_count == 0 && active_proxy_id_ != 0 &&
+      get_proxy_latency(active_proxy_id_) >= SLOW_PROXY_LATENCY) {
+    // keep a pre-negotiated connection through a slow proxy to not wait for the negotiation after a connection error
+    warm_connection_count = 1;
+  }
+  return static_cast<size_t>(
+      clamp(warm_connection_count, static_cast<int64>(0), static_cast<int64>(ClientInfo::MAX_WARM_CONNECTION_COUNT)));
+}
+
 void ConnectionCreator::client_create_raw_connection(Result<ConnectionData> r_connection_data, bool check_mode,
                                                      mtproto::TransportType transport_type, size_t hash,
                                                      string debug_str, uint32 network_generation) {
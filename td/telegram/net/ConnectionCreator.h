@@ -109,6 +109,9 @@ class ConnectionCreator final : public NetQueryCallback {
   std::map<int32, Proxy> proxies_;
   std::unordered_map<int32, int32> proxy_last_used_date_;
   std::unordered_map<int32, int32> proxy_last_used_saved_date_;
+  std::unordered_map<int32, double> proxy_latency_;
+  // reconnection through a proxy with bigger latency is slow, so warm connections are always kept for it
+  static constexpr double SLOW_PROXY_LATENCY = 0.5;
   int32 max_proxy_id_ = 0;
   int32 active_proxy_id_ = 0;
   ActorOwn<GetHostByNameActor> get_host_by_name_actor_;
@@ -157,6 +160,13 @@ class ConnectionCreator final : public NetQueryCallback {
     std::vector<Promise<unique_ptr<mtproto::RawConnection>>> queries;
 
     static constexpr double READY_CONNECTIONS_TIMEOUT = 10;
+    // ready connections are replaced with new ones before they expire to always have a warm connection
+    static constexpr double READY_CONNECTIONS_REFRESH_TIME = 7;
+    // warm connections are kept only for clients, which requested a connection recently
+    static constexpr double WARM_CONNECTIONS_IDLE_TIME = 60;
+    static constexpr int32 MAX_WARM_CONNECTION_COUNT = 3;
+
+    double last_query_time{0};
 
     bool inited{false};
     size_t hash{0};
@@ -197,6 +207,8 @@ class ConnectionCreator final : public NetQueryCallback {
   static string get_proxy_database_key(int32 proxy_id);
   static string get_proxy_used_database_key(int32 proxy_id);
   void save_proxy_last_used_date(int32 delay);
+  void on_proxy_latency(int32 proxy_id, double latency);
+  double get_proxy_latency(int32 proxy_id) const;
   td_api::object_ptr<td_api::proxy> get_proxy_object(int32 proxy_id) const;
 
   void start_up() final;
@@ -218,6 +230,7 @@ class ConnectionCreator final : public NetQueryCallback {
 
   void client_wakeup(size_t hash);
   void client_loop(ClientInfo &client);
+  size_t get_warm_connection_count(const ClientInfo &client) const;
   void client_create_raw_connection(Result<ConnectionData> r_connection_data, bool check_mode,
                                     mtproto::TransportType transport_type, size_t hash, string debug_str,
                                     uint32 network_generation);
@@ -246,7 +259,7 @@ class ConnectionCreator final : public NetQueryCallback {
 
   void ping_proxy_resolved(int32 proxy_id, IPAddress ip_address, Promise<double> promise);
 
-  void ping_proxy_buffered_socket_fd(IPAddress ip_address, BufferedFd<SocketFd> buffered_socket_fd,
+  void ping_proxy_buffered_socket_fd(int32 proxy_id, IPAddress ip_address, BufferedFd<SocketFd> buffered_socket_fd,
                                      mtproto::TransportType transport_type, string debug_str, Promise<double> promise);
 
   void on_ping_main_dc_result(uint64 token, Result<double> result);
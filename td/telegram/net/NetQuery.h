@@ -224,6 +224,9 @@ class NetQuery final : public TsListNode<NetQueryDebug> {
     }
     // TODO: CHECK if net_query is lost here
     cancel_slot_.close();
+    if (stats_ != nullptr) {
+      stats_->on_query_finished(tl_constructor_, timings_, Time::now());
+    }
     *this = NetQuery();
   }
   bool empty() const {
@@ -232,6 +235,7 @@ class NetQuery final : public TsListNode<NetQueryDebug> {
 
   void stop_track() {
     nq_counter_ = NetQueryCounter();
+    stats_ = nullptr;
     remove();
   }
 
@@ -269,6 +273,11 @@ class NetQuery final : public TsListNode<NetQueryDebug> {
     finish_migrate(cancel_slot_);
   }
 
+  // queries with bigger priority are sent first
+  static constexpr int8 BACKGROUND_PRIORITY = -1;
+  static constexpr int8 DEFAULT_PRIORITY = 0;
+  static constexpr int8 INTERACTIVE_PRIORITY = 1;
+
   int8 priority() const {
     return priority_;
   }
@@ -284,6 +293,7 @@ class NetQuery final : public TsListNode<NetQueryDebug> {
   DcId dc_id_;
 
   NetQueryCounter nq_counter_;
+  NetQueryStats *stats_ = nullptr;
   Status status_;
   uint64 id_ = 0;
   BufferSlice query_;
@@ -294,7 +304,7 @@ class NetQuery final : public TsListNode<NetQueryDebug> {
   uint32 session_rand_ = 0;
 
   bool may_be_lost_ = false;
-  int8 priority_{0};
+  int8 priority_{DEFAULT_PRIORITY};
 
   template <class T>
   struct movable_atomic final : public std::atomic<T> {
@@ -341,6 +351,7 @@ class NetQuery final : public TsListNode<NetQueryDebug> {
   Slot cancel_slot_;                 // for Session and to be set by caller
   Promise<> quick_ack_promise_;      // for Session and to be set by caller
   int32 file_type_ = -1;             // to be set by caller
+  NetQueryTimings timings_;          // for NetQueryStats
 
   NetQuery(State state, uint64 id, BufferSlice &&query, BufferSlice &&answer, DcId dc_id, Type type, AuthFlag auth_flag,
            GzipFlag gzip_flag, int32 tl_constructor, double total_timeout_limit, NetQueryStats *stats)
@@ -359,9 +370,11 @@ class NetQuery final : public TsListNode<NetQueryDebug> {
     auto &data = get_data_unsafe();
     data.my_id_ = get_my_id();
     data.start_timestamp_ = data.state_timestamp_ = Time::now();
+    timings_.create_time_ = data.start_timestamp_;
     LOG(INFO) << *this;
     if (stats) {
       nq_counter_ = stats->register_query(this);
+      stats_ = stats;
     }
   }
 };
@@ -12,6 +12,7 @@
 #include "td/telegram/telegram_api.h"
 
 #include "td/utils/buffer.h"
+#include "td/utils/crypto.h"
 #include "td/utils/format.h"
 #include "td/utils/Gzip.h"
 #include "td/utils/logging.h"
@@ -40,22 +41,11 @@ NetQueryPtr NetQueryCreator::create(uint64 id, const telegram_api::Function &fun
 
   int32 tl_constructor = function.get_id();
 
-  size_t MIN_GZIPPED_SIZE = 128;
-  auto gzip_flag = slice.size() < MIN_GZIPPED_SIZE ? NetQuery::GzipFlag::Off : NetQuery::GzipFlag::On;
-  if (slice.size() >= 16384) {
-    // test compression ratio for the middle part
-    // if it is less than 0.9, then try to compress the whole request
-    size_t TESTED_SIZE = 1024;
-    BufferSlice compressed_part = gzencode(slice.as_slice().substr((slice.size() - TESTED_SIZE) / 2, TESTED_SIZE), 0.9);
-    if (compressed_part.empty()) {
-      gzip_flag = NetQuery::GzipFlag::Off;
-    }
-  }
-  if (gzip_flag == NetQuery::GzipFlag::On) {
-    BufferSlice compressed = gzencode(slice.as_slice(), 0.9);
-    if (compressed.empty()) {
-      gzip_flag = NetQuery::GzipFlag::Off;
-    } else {
+  auto gzip_flag = NetQuery::GzipFlag::Off;
+  if (need_compress(tl_constructor, slice.size())) {
+    BufferSlice compressed = get_compressed_query(tl_constructor, slice, type);
+    if (!compressed.empty()) {
+      gzip_flag = NetQuery::GzipFlag::On;
       slice = std::move(compressed);
     }
   }
@@ -78,7 +68,133 @@ NetQueryPtr NetQueryCreator::create(uint64 id, const telegram_api::Function &fun
   auto query = object_pool_.create(NetQuery::State::Query, id, std::move(slice), BufferSlice(), dc_id, type, auth_flag,
                                    gzip_flag, tl_constructor, total_timeout_limit, net_query_stats_.get());
   query->set_cancellation_token(query.generation());
+  query->set_priority(get_default_priority(tl_constructor));
   return query;
 }
 
+int8 NetQueryCreator::get_default_priority(int32 tl_constructor) {
+  switch (tl_constructor) {
+    // direct user actions must not wait for background synchronization
+    case telegram_api::messages_sendMessage::ID:
+    case telegram_api::messages_sendMedia::ID:
+    case telegram_api::messages_sendMultiMedia::ID:
+    case telegram_api::messages_sendInlineBotResult::ID:
+    case telegram_api::messages_forwardMessages::ID:
+    case telegram_api::messages_editMessage::ID:
+    case telegram_api::messages_deleteMessages::ID:
+    case telegram_api::channels_deleteMessages::ID:
+    case telegram_api::messages_readHistory::ID:
+    case telegram_api::channels_readHistory::ID:
+    case telegram_api::messages_setTyping::ID:
+    case telegram_api::messages_sendReaction::ID:
+    case telegram_api::messages_sendVote::ID:
+      return NetQuery::INTERACTIVE_PRIORITY;
+    // periodic reloading of data, which isn't needed immediately
+    case telegram_api::messages_getAllStickers::ID:
+    case telegram_api::messages_getSavedGifs::ID:
+    case telegram_api::messages_getRecentStickers::ID:
+    case telegram_api::messages_getFavedStickers::ID:
+    case telegram_api::messages_getFeaturedStickers::ID:
+    case telegram_api::messages_getAllDrafts::ID:
+    case telegram_api::messages_getEmojiKeywordsDifference::ID:
+    case telegram_api::messages_getSuggestedDialogFilters::ID:
+    case telegram_api::contacts_getTopPeers::ID:
+    case telegram_api::help_getAppConfig::ID:
+    case telegram_api::help_getPromoData::ID:
+    case telegram_api::help_getRecentMeUrls::ID:
+    case telegram_api::account_getContentSettings::ID:
+      return NetQuery::BACKGROUND_PRIORITY;
+    default:
+      return NetQuery::DEFAULT_PRIORITY;
+  }
+}
+
+bool NetQueryCreator::need_compress(int32 tl_constructor, size_t size) {
+  constexpr size_t MIN_GZIPPED_SIZE = 128;
+  if (size < MIN_GZIPPED_SIZE) {
+    return false;
+  }
+  if (tl_constructor == telegram_api::upload_saveFilePart::ID ||
+      tl_constructor == telegram_api::upload_saveBigFilePart::ID) {
+    // uploaded files are almost always already compressed
+    return false;
+  }
+
+  // skip compression of queries, which are rarely compressible, but try to compress them from time to time
+  constexpr int32 MIN_ATTEMPT_COUNT = 8;
+  constexpr int32 RETRY_PERIOD = 16;
+  auto &stat = compression_stats_[tl_constructor];
+  if (stat.attempt_count >= MIN_ATTEMPT_COUNT && stat.success_count * 4 < stat.attempt_count &&
+      ++stat.skip_count % RETRY_PERIOD != 0) {
+    return false;
+  }
+  return true;
+}
+
+BufferSlice NetQueryCreator::get_compressed_query(int32 tl_constructor, const BufferSlice &data, NetQuery::Type type) {
+  constexpr size_t MAX_CACHED_QUERY_SIZE = 16384;
+  if (data.size() > MAX_CACHED_QUERY_SIZE) {
+    return compress(tl_constructor, data.as_slice(), type);
+  }
+
+  auto key = crc64(data.as_slice()) ^ static_cast<uint32>(tl_constructor);
+  if (key == 0) {
+    key = 1;
+  }
+  auto it = compressed_queries_.find(key);
+  if (it != compressed_queries_.end() && it->second.data.as_slice() == data.as_slice()) {
+    return it->second.compressed.clone();
+  }
+
+  auto compressed = compress(tl_constructor, data.as_slice(), type);
+
+  constexpr size_t MAX_CACHED_QUERIES_SIZE = 1 << 20;
+  if (it != compressed_queries_.end()) {
+    compressed_queries_size_ -= it->second.data.size() + it->second.compressed.size();
+    compressed_queries_.erase(it);
+  }
+  if (compressed_queries_size_ + 2 * data.size() > MAX_CACHED_QUERIES_SIZE) {
+    compressed_queries_.clear();
+    compressed_queries_size_ = 0;
+  }
+  compressed_queries_size_ += data.size() + compressed.size();
+  auto &compressed_query = compressed_queries_[key];
+  compressed_query.data = data.clone();
+  compressed_query.compressed = compressed.clone();
+  return compressed;
+}
+
+BufferSlice NetQueryCreator::compress(int32 tl_constructor, Slice data, NetQuery::Type type) {
+  // time spent on compression of big interactive queries is more important than their size
+  constexpr size_t MIN_FAST_GZIPPED_SIZE = 16384;
+  auto compression_level = type == NetQuery::Type::Common && data.size() >= MIN_FAST_GZIPPED_SIZE ? 1 : 6;
+
+  BufferSlice result;
+  if (data.size() >= 16384) {
+    // test compression ratio for the middle part
+    // if it is less than 0.9, then try to compress the whole request
+    size_t TESTED_SIZE = 1024;
+    BufferSlice compressed_part =
+        gzip_compressor_.compress(data.substr((data.size() - TESTED_SIZE) / 2, TESTED_SIZE), 0.9, compression_level);
+    if (!compressed_part.empty()) {
+      result = gzip_compressor_.compress(data, 0.9, compression_level);
+    }
+  } else {
+    result = gzip_compressor_.compress(data, 0.9, compression_level);
+  }
+
+  auto &stat = compression_stats_[tl_constructor];
+  stat.attempt_count++;
+  if (!result.empty()) {
+    stat.success_count++;
+  }
+  constexpr int32 MAX_ATTEMPT_COUNT = 64;
+  if (stat.attempt_count >= MAX_ATTEMPT_COUNT) {
+    // forget old attempts to adapt to changes in the compressed data
+    stat.attempt_count /= 2;
+    stat.success_count /= 2;
+  }
+  return result;
+}
+
 }  // namespace td
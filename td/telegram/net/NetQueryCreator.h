@@ -11,7 +11,12 @@
 #include "td/telegram/net/NetQueryStats.h"
 #include "td/telegram/UniqueId.h"
 
+#include "td/utils/buffer.h"
+#include "td/utils/common.h"
+#include "td/utils/FlatHashMap.h"
+#include "td/utils/Gzip.h"
 #include "td/utils/ObjectPool.h"
+#include "td/utils/Slice.h"
 
 #include <memory>
 
@@ -42,6 +47,30 @@ class NetQueryCreator {
  private:
   std::shared_ptr<NetQueryStats> net_query_stats_;
   ObjectPool<NetQuery> object_pool_;
+
+  struct CompressionStat {
+    int32 attempt_count = 0;
+    int32 success_count = 0;
+    int32 skip_count = 0;
+  };
+  FlatHashMap<int32, CompressionStat> compression_stats_;
+  GzipCompressor gzip_compressor_;
+
+  // results of compression of recently sent queries; the same queries are often sent many times
+  struct CompressedQuery {
+    BufferSlice data;
+    BufferSlice compressed;  // empty, if the query isn't compressible
+  };
+  FlatHashMap<uint64, CompressedQuery> compressed_queries_;
+  size_t compressed_queries_size_ = 0;
+
+  BufferSlice get_compressed_query(int32 tl_constructor, const BufferSlice &data, NetQuery::Type type);
+
+  static int8 get_default_priority(int32 tl_constructor);
+
+  bool need_compress(int32 tl_constructor, size_t size);
+
+  BufferSlice compress(int32 tl_constructor, Slice data, NetQuery::Type type);
 };
 
 }  // namespace td
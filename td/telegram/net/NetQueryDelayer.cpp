@@ -16,6 +16,7 @@
 #include "td/utils/Slice.h"
 #include "td/utils/SliceBuilder.h"
 #include "td/utils/Status.h"
+#include "td/utils/Time.h"
 
 namespace td {
 
@@ -85,6 +86,7 @@ void NetQueryDelayer::delay(NetQueryPtr query) {
   query->debug(PSTRING() << "delay for " << format::as_time(timeout));
   auto id = container_.create(QuerySlot());
   auto *query_slot = container_.get(id);
+  query->timings_.delay_start_time_ = Time::now();
   query_slot->query_ = std::move(query);
   query_slot->timeout_.set_event(EventCreator::yield(actor_shared(this, id)));
   query_slot->timeout_.set_timeout_in(timeout);
@@ -104,6 +106,7 @@ void NetQueryDelayer::on_slot_event(uint64 id) {
     return;
   }
   auto query = std::move(slot->query_);
+  query->timings_.delay_time_ += Time::now() - query->timings_.delay_start_time_;
   if (!query->invoke_after().empty()) {
     // Fail query after timeout expired if it is a part of an invokeAfter chain.
     // It is not necessary but helps to avoid server problems, when previous query was lost.
@@ -26,6 +26,8 @@
 #include "td/utils/port/thread.h"
 #include "td/utils/Slice.h"
 #include "td/utils/SliceBuilder.h"
+#include "td/utils/ThreadSafeCounter.h"
+#include "td/utils/Time.h"
 
 namespace td {
 
@@ -42,6 +44,11 @@ void NetQueryDispatcher::complete_net_query(NetQueryPtr net_query) {
 
 void NetQueryDispatcher::dispatch(NetQueryPtr net_query) {
   // net_query->debug("dispatch");
+  if (net_query->timings_.dispatch_time_ == 0) {
+    net_query->timings_.dispatch_time_ = Time::now();
+    static auto query_counter = NamedThreadSafeCounter::get_default().get_counter("net_dispatched_queries");
+    query_counter.add(1);
+  }
   if (stop_flag_.load(std::memory_order_relaxed)) {
     net_query->set_error(Global::request_aborted_error());
     return complete_net_query(std::move(net_query));
@@ -284,7 +291,7 @@ NetQueryDispatcher::NetQueryDispatcher(const std::function<ActorShared<>()> &cre
   LOG(INFO) << tag("main_dc_id", main_dc_id_.load(std::memory_order_relaxed));
   delayer_ = create_actor<NetQueryDelayer>("NetQueryDelayer", create_reference());
   dc_auth_manager_ = create_actor<DcAuthManager>("DcAuthManager", create_reference());
-  common_public_rsa_key_ = std::make_shared<PublicRsaKeyShared>(DcId::empty(), G()->is_test_dc());
+  common_public_rsa_key_ = PublicRsaKeyShared::get_common(G()->is_test_dc());
   public_rsa_key_watchdog_ = create_actor<PublicRsaKeyWatchdog>("PublicRsaKeyWatchdog", create_reference());
 
   td_guard_ = create_shared_lambda_guard([actor = create_reference()] {});
@@ -14,6 +14,9 @@
 #include "td/utils/SliceBuilder.h"
 #include "td/utils/Time.h"
 
+#include <algorithm>
+#include <utility>
+
 namespace td {
 
 uint64 NetQueryStats::get_count() const {
@@ -53,4 +56,98 @@ void NetQueryStats::dump_pending_network_queries() {
     }
   }
 }
+
+void NetQueryStats::LatencyHistogram::add(double latency) {
+  latency = max(latency, 0.0);
+  size_t bucket = 0;
+  auto latency_ms = latency * 1000;
+  while (bucket + 1 < BUCKET_COUNT && latency_ms >= static_cast<double>(static_cast<uint64>(1) << bucket)) {
+    bucket++;
+  }
+  buckets_[bucket]++;
+  count_++;
+  total_latency_ += latency;
+}
+
+double NetQueryStats::LatencyHistogram::get_percentile(int32 percent) const {
+  auto need_count = (count_ * static_cast<uint64>(percent) + 99) / 100;
+  uint64 current_count = 0;
+  for (size_t bucket = 0; bucket < BUCKET_COUNT; bucket++) {
+    current_count += buckets_[bucket];
+    if (current_count >= need_count) {
+      return static_cast<double>(static_cast<uint64>(1) << bucket) * 1e-3;
+    }
+  }
+  return static_cast<double>(static_cast<uint64>(1) << (BUCKET_COUNT - 1)) * 1e-3;
+}
+
+void NetQueryStats::on_query_finished(int32 tl_constructor, const NetQueryTimings &timings, double finish_time) {
+  if (tl_constructor == 0 || timings.send_time_ == 0 || timings.result_time_ < timings.send_time_) {
+    // the query wasn't sent to the server or its result wasn't received from the server
+    return;
+  }
+  auto dispatch_time = timings.dispatch_time_ == 0 ? timings.create_time_ : timings.dispatch_time_;
+
+  std::lock_guard<std::mutex> guard(latency_stats_mutex_);
+  auto &phases = latency_stats_[tl_constructor].phases_;
+  auto add = [&phases](LatencyPhase phase, double latency) {
+    phases[static_cast<size_t>(phase)].add(latency);
+  };
+  add(LatencyPhase::Dispatch, dispatch_time - timings.create_time_);
+  add(LatencyPhase::Queue, timings.send_time_ - dispatch_time - timings.delay_time_);
+  add(LatencyPhase::Delay, timings.delay_time_);
+  if (timings.ack_time_ >= timings.send_time_) {
+    add(LatencyPhase::Ack, timings.ack_time_ - timings.send_time_);
+  }
+  add(LatencyPhase::Server, timings.result_time_ - timings.send_time_);
+  add(LatencyPhase::Callback, finish_time - timings.result_time_);
+  add(LatencyPhase::Total, finish_time - timings.create_time_);
+}
+
+string NetQueryStats::get_latency_statistics() const {
+  static const char *phase_names[] = {"dispatch", "queue", "delay", "ack", "server", "callback", "total"};
+  static_assert(sizeof(phase_names) / sizeof(phase_names[0]) == static_cast<size_t>(LatencyPhase::Size), "");
+
+  vector<std::pair<int32, QueryLatencyStats>> stats;
+  {
+    std::lock_guard<std::mutex> guard(latency_stats_mutex_);
+    for (auto &it : latency_stats_) {
+      stats.emplace_back(it.first, it.second);
+    }
+  }
+  auto get_count = [](const QueryLatencyStats &query_stats) {
+    return query_stats.phases_[static_cast<size_t>(LatencyPhase::Total)].get_count();
+  };
+  std::sort(stats.begin(), stats.end(), [&](const auto &lhs, const auto &rhs) {
+    return get_count(lhs.second) > get_count(rhs.second);
+  });
+
+  string result;
+  for (auto &it : stats) {
+    result += PSTRING() << "[Query:" << tag("tl", format::as_hex(it.first)) << tag("count", get_count(it.second))
+                        << "]\n";
+    for (size_t i = 0; i < it.second.phases_.size(); i++) {
+      auto &histogram = it.second.phases_[i];
+      if (histogram.get_count() == 0) {
+        continue;
+      }
+      result += PSTRING() << "  " << rpad(phase_names[i], 8, ' ') << tag("count", histogram.get_count())
+                          << tag("average", format::as_time(histogram.get_average()))
+                          << tag("p50", format::as_time(histogram.get_percentile(50)))
+                          << tag("p90", format::as_time(histogram.get_percentile(90)))
+                          << tag("p99", format::as_time(histogram.get_percentile(99))) << '\n';
+    }
+  }
+  return result;
+}
+
+void NetQueryStats::dump_latency_statistics() const {
+  auto statistics = get_latency_statistics();
+  for (auto &line : full_split(statistics, '\n')) {
+    if (!line.empty()) {
+      LOG(WARNING) << line;
+    }
+  }
+}
+
 }  // namespace td
@@ -9,9 +9,12 @@
 #include "td/telegram/net/NetQueryCounter.h"
 
 #include "td/utils/common.h"
+#include "td/utils/FlatHashMap.h"
 #include "td/utils/TsList.h"
 
+#include <array>
 #include <atomic>
+#include <mutex>
 
 namespace td {
 
@@ -27,6 +30,17 @@ struct NetQueryDebug {
   bool unknown_state_ = false;
 };
 
+// times of the main events in a query lifetime
+struct NetQueryTimings {
+  double create_time_ = 0;
+  double dispatch_time_ = 0;     // the first dispatch by NetQueryDispatcher
+  double delay_start_time_ = 0;  // start of the current delay in NetQueryDelayer
+  double delay_time_ = 0;        // total time spent in NetQueryDelayer
+  double send_time_ = 0;         // the last sending by Session
+  double ack_time_ = 0;          // receiving of acknowledgement for the last sending
+  double result_time_ = 0;       // receiving of the result from the server
+};
+
 class NetQueryStats {
  public:
   NetQueryCounter register_query(TsListNode<NetQueryDebug> *query) {
@@ -40,7 +54,44 @@ class NetQueryStats {
 
   void dump_pending_network_queries();
 
+  void on_query_finished(int32 tl_constructor, const NetQueryTimings &timings, double finish_time);
+
+  string get_latency_statistics() const;
+
+  void dump_latency_statistics() const;
+
  private:
+  // number of queries with latency in [2^(i-1), 2^i) milliseconds
+  class LatencyHistogram {
+   public:
+    void add(double latency);
+
+    uint64 get_count() const {
+      return count_;
+    }
+
+    double get_average() const {
+      return count_ == 0 ? 0.0 : total_latency_ / static_cast<double>(count_);
+    }
+
+    double get_percentile(int32 percent) const;
+
+   private:
+    static constexpr size_t BUCKET_COUNT = 24;
+    std::array<uint64, BUCKET_COUNT> buckets_{};
+    uint64 count_ = 0;
+    double total_latency_ = 0;
+  };
+
+  enum class LatencyPhase : int32 { Dispatch, Queue, Delay, Ack, Server, Callback, Total, Size };
+
+  struct QueryLatencyStats {
+    std::array<LatencyHistogram, static_cast<size_t>(LatencyPhase::Size)> phases_;
+  };
+
+  mutable std::mutex latency_stats_mutex_;
+  FlatHashMap<int32, QueryLatencyStats> latency_stats_;
+
   NetQueryCounter::Counter count_{0};
   std::atomic<bool> use_list_{true};
   TsList<NetQueryDebug> list_;
@@ -54,6 +54,12 @@ PublicRsaKeyShared::PublicRsaKeyShared(DcId dc_id, bool is_test) : dc_id_(dc_id)
       "-----END RSA PUBLIC KEY-----");
 }
 
+std::shared_ptr<PublicRsaKeyShared> PublicRsaKeyShared::get_common(bool is_test) {
+  static auto test_public_rsa_key = std::make_shared<PublicRsaKeyShared>(DcId::empty(), true);
+  static auto public_rsa_key = std::make_shared<PublicRsaKeyShared>(DcId::empty(), false);
+  return is_test ? test_public_rsa_key : public_rsa_key;
+}
+
 void PublicRsaKeyShared::add_rsa(mtproto::RSA rsa) {
   auto lock = rw_mutex_.lock_write();
   auto fingerprint = rsa.get_fingerprint();
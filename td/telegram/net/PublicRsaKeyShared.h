@@ -14,12 +14,17 @@
 #include "td/utils/port/RwMutex.h"
 #include "td/utils/Status.h"
 
+#include <memory>
+
 namespace td {
 
 class PublicRsaKeyShared final : public mtproto::PublicRsaKeyInterface {
  public:
   PublicRsaKeyShared(DcId dc_id, bool is_test);
 
+  // returns main public RSA keys; they never change, so they are shared between all Td instances
+  static std::shared_ptr<PublicRsaKeyShared> get_common(bool is_test);
+
   class Listener {
    public:
     Listener() = default;
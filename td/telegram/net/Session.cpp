@@ -141,6 +141,11 @@ bool Session::PriorityQueue::empty() const {
   return queries_.empty();
 }
 
+int8 Session::PriorityQueue::top_priority() const {
+  CHECK(!empty());
+  return queries_.begin()->first;
+}
+
 Session::Session(unique_ptr<Callback> callback, std::shared_ptr<AuthDataShared> shared_auth_data, int32 raw_dc_id,
                  int32 dc_id, bool is_main, bool use_pfs, bool is_cdn, bool need_destroy,
                  const mtproto::AuthKey &tmp_auth_key, const vector<mtproto::ServerSalt> &server_salts)
@@ -659,6 +664,7 @@ void Session::on_message_ack_impl_inner(uint64 id, int32 type, bool in_container
   }
   VLOG(net_query) << "Ack " << tag("msg_id", id) << it->second.query;
   it->second.ack = true;
+  it->second.query->timings_.ack_time_ = Time::now_cached();
   {
     auto lock = it->second.query->lock();
     it->second.query->get_data_unsafe().ack_state_ |= type;
@@ -779,6 +785,7 @@ Status Session::on_message_result_ok(uint64 id, BufferSlice packet, size_t origi
   cleanup_container(id, query_ptr);
   mark_as_known(id, query_ptr);
   query_ptr->query->on_net_read(original_size);
+  query_ptr->query->timings_.result_time_ = Time::now_cached();
   query_ptr->query->set_ok(std::move(packet));
   query_ptr->query->set_message_id(0);
   query_ptr->query->cancel_slot_.clear_event();
@@ -862,6 +869,7 @@ void Session::on_message_result_error(uint64 id, int error_code, string message)
 
   cleanup_container(id, query_ptr);
   mark_as_known(id, query_ptr);
+  query_ptr->query->timings_.result_time_ = Time::now_cached();
   query_ptr->query->set_error(Status::Error(error_code, message), current_info_->connection_->get_name().str());
   query_ptr->query->set_message_id(0);
   query_ptr->query->cancel_slot_.clear_event();
@@ -1041,12 +1049,17 @@ void Session::connection_send_query(ConnectionInfo *info, NetQueryPtr &&net_quer
     LOG(DEBUG) << "Set event for net_query cancellation " << tag("message_id", format::as_hex(message_id));
     net_query->cancel_slot_.set_event(EventCreator::raw(actor_id(), message_id));
   }
+  net_query->timings_.send_time_ = Time::now_cached();
+  net_query->timings_.ack_time_ = 0;
   auto status = sent_queries_.emplace(
       message_id, Query{message_id, std::move(net_query), main_connection_.connection_id_, Time::now_cached()});
   sent_queries_list_.put(status.first->second.get_list_node());
   if (!status.second) {
     LOG(FATAL) << "Duplicate message_id [message_id = " << message_id << "]";
   }
+  if (status.first->second.query->priority() <= NetQuery::BACKGROUND_PRIORITY) {
+    status.first->second.background_query_counter = NetQueryCounter(&background_query_count_);
+  }
   if (immediately_fail_query) {
     on_message_result_error(message_id, 401, "TEST_ERROR");
   }
@@ -1412,6 +1425,11 @@ void Session::loop() {
       if (auth_data_.is_ready(Time::now_cached())) {
         if (need_send_query()) {
           while (!pending_queries_.empty() && sent_queries_.size() < MAX_INFLIGHT_QUERIES) {
+            if (pending_queries_.top_priority() <= NetQuery::BACKGROUND_PRIORITY &&
+                background_query_count_.load(std::memory_order_relaxed) >= MAX_INFLIGHT_BACKGROUND_QUERIES) {
+              // all remaining queries are background queries
+              break;
+            }
             auto query = pending_queries_.pop();
             connection_send_query(&main_connection_, std::move(query));
             need_flush = true;
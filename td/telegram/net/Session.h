@@ -8,6 +8,7 @@
 
 #include "td/telegram/net/AuthDataShared.h"
 #include "td/telegram/net/NetQuery.h"
+#include "td/telegram/net/NetQueryCounter.h"
 #include "td/telegram/net/TempAuthKeyWatchdog.h"
 
 #include "td/mtproto/AuthData.h"
@@ -84,6 +85,7 @@ class Session final
 
     int8 connection_id;
     double sent_at_;
+    NetQueryCounter background_query_counter;
     Query(uint64 message_id, NetQueryPtr &&q, int8 connection_id, double sent_at)
         : container_id(message_id), query(std::move(q)), connection_id(connection_id), sent_at_(sent_at) {
     }
@@ -131,11 +133,13 @@ class Session final
     void push(NetQueryPtr query);
     NetQueryPtr pop();
     bool empty() const;
+    int8 top_priority() const;
 
    private:
     std::map<int8, VectorQueue<NetQueryPtr>, std::greater<>> queries_;
   };
   PriorityQueue pending_queries_;
+  NetQueryCounter::Counter background_query_count_{0};
   std::map<uint64, Query> sent_queries_;
   std::deque<NetQueryPtr> pending_invoke_after_queries_;
   ListNode sent_queries_list_;
@@ -169,6 +173,7 @@ class Session final
 
   static constexpr double ACTIVITY_TIMEOUT = 60 * 5;
   static constexpr size_t MAX_INFLIGHT_QUERIES = 1024;
+  static constexpr uint64 MAX_INFLIGHT_BACKGROUND_QUERIES = 32;
 
   struct ContainerInfo {
     size_t ref_cnt;
@@ -13,6 +13,7 @@
 #include "td/utils/logging.h"
 #include "td/utils/Slice.h"
 #include "td/utils/SliceBuilder.h"
+#include "td/utils/Time.h"
 
 #include <algorithm>
 
@@ -43,13 +44,13 @@ void SessionMultiProxy::send(NetQueryPtr query) {
     if (query->session_rand()) {
       pos = query->session_rand() % sessions_.size();
     } else {
-      pos = std::min_element(sessions_.begin(), sessions_.end(),
-                             [](const auto &a, const auto &b) { return a.queries_count < b.queries_count; }) -
-            sessions_.begin();
+      pos = choose_session();
     }
   }
   // query->debug(PSTRING() << get_name() << ": send to proxy #" << pos);
-  sessions_[pos].queries_count++;
+  if (sessions_[pos].queries_count++ == 0) {
+    sessions_[pos].busy_since = Time::now();
+  }
   send_closure(sessions_[pos].proxy, &SessionProxy::send, std::move(query));
 }
 
@@ -114,6 +115,29 @@ bool SessionMultiProxy::get_pfs_flag() const {
   return use_pfs_ && !is_cdn_;
 }
 
+size_t SessionMultiProxy::choose_session() const {
+  // parts of big files are spread over all sessions, but a session with a slow connection receives fewer of them,
+  // because the query is sent to the session, which is expected to finish it first
+  // a session without finished queries for a long time is considered slow
+  auto get_expected_time = [now = Time::now()](const SessionInfo &info) {
+    auto query_time = info.query_time;
+    if (info.queries_count > 0) {
+      query_time = max(query_time, now - info.busy_since);
+    }
+    return (info.queries_count + 1) * query_time;
+  };
+  return std::min_element(sessions_.begin(), sessions_.end(),
+                          [&](const auto &a, const auto &b) {
+                            auto a_time = get_expected_time(a);
+                            auto b_time = get_expected_time(b);
+                            if (a_time != b_time) {
+                              return a_time < b_time;
+                            }
+                            return a.queries_count < b.queries_count;
+                          }) -
+         sessions_.begin();
+}
+
 void SessionMultiProxy::init() {
   sessions_generation_++;
   sessions_.clear();
@@ -150,8 +174,14 @@ void SessionMultiProxy::on_query_finished(uint32 generation, int session_id) {
   if (generation != sessions_generation_) {
     return;
   }
-  sessions_.at(session_id).queries_count--;
-  CHECK(sessions_.at(session_id).queries_count >= 0);
+  auto &info = sessions_.at(session_id);
+  info.queries_count--;
+  CHECK(info.queries_count >= 0);
+
+  auto now = Time::now();
+  auto query_time = now - info.busy_since;
+  info.query_time = info.query_time == 0 ? query_time : 0.8 * info.query_time + 0.2 * query_time;
+  info.busy_since = now;
 }
 
 }  // namespace td
@@ -48,6 +48,8 @@ class SessionMultiProxy final : public Actor {
   struct SessionInfo {
     ActorOwn<SessionProxy> proxy;
     int queries_count{0};
+    double query_time{0};  // smoothed interval between finished queries while the session is busy
+    double busy_since{0};  // time of the last finished query or of the first sent query
   };
   uint32 sessions_generation_{0};
   std::vector<SessionInfo> sessions_;
@@ -57,6 +59,8 @@ class SessionMultiProxy final : public Actor {
 
   bool get_pfs_flag() const;
 
+  size_t choose_session() const;
+
   void on_query_finished(uint32 generation, int session_id);
 };
 
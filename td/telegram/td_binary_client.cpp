@@ -0,0 +1,38 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2022
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "td/telegram/td_binary_client.h"
+
+#include "td/telegram/ClientBinary.h"
+
+#include "td/utils/common.h"
+#include "td/utils/Slice.h"
+
+static td::Slice to_slice(const void *data, int length) {
+  if (data == nullptr || length <= 0) {
+    return td::Slice();
+  }
+  return td::Slice(static_cast<const char *>(data), static_cast<size_t>(length));
+}
+
+int td_binary_create_client_id() {
+  return td::binary_create_client_id();
+}
+
+void td_binary_send(int client_id, long long request_id, const void *request, int request_length) {
+  td::binary_send(client_id, static_cast<td::int64>(request_id), to_slice(request, request_length));
+}
+
+const void *td_binary_receive(double timeout, int *client_id, long long *request_id, int *response_length) {
+  td::int64 received_request_id = 0;
+  auto result = td::binary_receive(timeout, client_id, &received_request_id, response_length);
+  *request_id = static_cast<long long>(received_request_id);
+  return result;
+}
+
+const void *td_binary_execute(const void *request, int request_length, int *response_length) {
+  return td::binary_execute(to_slice(request, request_length), response_length);
+}
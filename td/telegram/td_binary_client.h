@@ -0,0 +1,77 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2022
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#pragma once
+
+/**
+ * \file
+ * C interface for interaction with TDLib via TL-serialized objects.
+ * Can be used to integrate TDLib with any programming language which supports calling C functions without the cost
+ * of JSON encoding and decoding.
+ *
+ * Requests and responses are serialized in the boxed TL binary format: the 32-bit little-endian constructor
+ * identifier of the object, followed by its fields in the order they are declared in td_api.tl. Fields of int32 type
+ * are stored as 4 bytes, fields of int53 and int64 types are stored as 8 bytes, fields of double type are stored as
+ * 8-byte IEEE 754 numbers, fields of Bool type are stored as boolTrue or boolFalse constructor identifiers, fields of
+ * string and bytes types are stored as TL strings, fields of array type are stored as a 4-byte element count followed
+ * by the elements, and fields of object types are stored boxed, with the constructor identifier 0x56730bcc for null.
+ *
+ * The interface uses the same TDLib instances as the JSON interface, so a client created via td_create_client_id
+ * can be used here and vice versa. Instead of the "@extra" field, each request is sent with a positive request
+ * identifier, which is returned together with the corresponding response. Updates have zero request identifier.
+ * Responses must be received either through td_binary_receive or through td_receive, but not both.
+ */
+
+#include "td/telegram/tdjson_export.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Returns an opaque identifier of a new TDLib instance.
+ * The TDLib instance will not send updates until the first request is sent to it.
+ * \return Opaque identifier of a new TDLib instance.
+ */
+TDJSON_EXPORT int td_binary_create_client_id();
+
+/**
+ * Sends request to the TDLib client. May be called from any thread.
+ * \param[in] client_id TDLib client identifier.
+ * \param[in] request_id Positive identifier of the request, which will be returned with the response.
+ * \param[in] request TL-serialized request to TDLib.
+ * \param[in] request_length Length of the request in bytes.
+ */
+TDJSON_EXPORT void td_binary_send(int client_id, long long request_id, const void *request, int request_length);
+
+/**
+ * Receives incoming updates and request responses. Must not be called simultaneously from two different threads.
+ * The returned pointer can be used until the next call to td_binary_receive or td_binary_execute in the same thread,
+ * after which it will be deallocated by TDLib.
+ * \param[in] timeout The maximum number of seconds allowed for this function to wait for new data.
+ * \param[out] client_id Identifier of the client for which the response or the update was received.
+ * \param[out] request_id Identifier of the request, or 0 for updates.
+ * \param[out] response_length Length of the response in bytes.
+ * \return TL-serialized incoming update or request response. May be NULL if the timeout expires.
+ */
+TDJSON_EXPORT const void *td_binary_receive(double timeout, int *client_id, long long *request_id,
+                                            int *response_length);
+
+/**
+ * Synchronously executes a TDLib request.
+ * A request can be executed synchronously, only if it is documented with "Can be called synchronously".
+ * The returned pointer can be used until the next call to td_binary_receive or td_binary_execute in the same thread,
+ * after which it will be deallocated by TDLib.
+ * \param[in] request TL-serialized request to TDLib.
+ * \param[in] request_length Length of the request in bytes.
+ * \param[out] response_length Length of the response in bytes.
+ * \return TL-serialized request response.
+ */
+TDJSON_EXPORT const void *td_binary_execute(const void *request, int request_length, int *response_length);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
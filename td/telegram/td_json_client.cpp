@@ -39,10 +39,22 @@ void td_send(int client_id, const char *request) {
   td::json_send(client_id, td::Slice(request == nullptr ? "" : request));
 }
 
+void td_send_batch(int client_id, const char *const *requests, int request_count) {
+  td::vector<td::Slice> request_slices;
+  for (int i = 0; i < request_count; i++) {
+    request_slices.emplace_back(requests[i] == nullptr ? "" : requests[i]);
+  }
+  td::json_send_batch(client_id, request_slices);
+}
+
 const char *td_receive(double timeout) {
   return td::json_receive(timeout);
 }
 
+const char *td_receive_batch(double timeout, int max_count, int *response_count, const int **response_offsets) {
+  return td::json_receive_batch(timeout, max_count, response_count, response_offsets);
+}
+
 const char *td_execute(const char *request) {
   return td::json_execute(td::Slice(request == nullptr ? "" : request));
 }
@@ -68,6 +68,15 @@ TDJSON_EXPORT int td_create_client_id();
  */
 TDJSON_EXPORT void td_send(int client_id, const char *request);
 
+/**
+ * Sends many requests to the TDLib client at once. May be called from any thread.
+ * The requests are processed in the order they are specified.
+ * \param[in] client_id TDLib client identifier.
+ * \param[in] requests Array of JSON-serialized null-terminated requests to TDLib.
+ * \param[in] request_count Number of requests in the array.
+ */
+TDJSON_EXPORT void td_send_batch(int client_id, const char *const *requests, int request_count);
+
 /**
  * Receives incoming updates and request responses. Must not be called simultaneously from two different threads.
  * The returned pointer can be used until the next call to td_receive or td_execute, after which it will be deallocated by TDLib.
@@ -76,6 +85,21 @@ TDJSON_EXPORT void td_send(int client_id, const char *request);
  */
 TDJSON_EXPORT const char *td_receive(double timeout);
 
+/**
+ * Receives up to max_count incoming updates and request responses at once. Must not be called simultaneously from two
+ * different threads or simultaneously with td_receive. Waits only for the first response; other responses are returned
+ * only if they are immediately available.
+ * The responses are stored one after another in a single buffer. The returned pointer can be used until the next call
+ * to td_receive_batch, after which it will be deallocated by TDLib.
+ * \param[in] timeout The maximum number of seconds allowed for this function to wait for new data.
+ * \param[in] max_count The maximum number of responses to receive.
+ * \param[out] response_count Number of received responses.
+ * \param[out] response_offsets Offsets of JSON-serialized null-terminated responses from the beginning of the buffer.
+ * \return The buffer with received updates and request responses. May be NULL if the timeout expires.
+ */
+TDJSON_EXPORT const char *td_receive_batch(double timeout, int max_count, int *response_count,
+                                           const int **response_offsets);
+
 /**
  * Synchronously executes a TDLib request.
  * A request can be executed synchronously, only if it is documented with "Can be called synchronously".
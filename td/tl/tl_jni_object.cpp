@@ -29,6 +29,7 @@ static jclass ObjectClass;
 jclass ArrayKeyboardButtonClass;
 jclass ArrayInlineKeyboardButtonClass;
 jclass ArrayPageBlockTableCellClass;
+jstring EmptyString;
 jmethodID GetConstructorID;
 jmethodID BooleanGetValueMethodID;
 jmethodID IntegerGetValueMethodID;
@@ -111,6 +112,17 @@ void init_vars(JNIEnv *env, const char *td_api_java_package) {
       get_jclass(env, (PSLICE() << "[L" << td_api_java_package << "/TdApi$InlineKeyboardButton;").c_str());
   ArrayPageBlockTableCellClass =
       get_jclass(env, (PSLICE() << "[L" << td_api_java_package << "/TdApi$PageBlockTableCell;").c_str());
+
+  jstring empty_string = env->NewStringUTF("");
+  if (!empty_string) {
+    fatal_error(env, "Can't create an empty string");
+  }
+  EmptyString = (jstring)env->NewGlobalRef(empty_string);
+  env->DeleteLocalRef(empty_string);
+  if (!EmptyString) {
+    fatal_error(env, "Can't create global reference to an empty string");
+  }
+
   GetConstructorID = get_method_id(env, ObjectClass, "getConstructor", "()I");
   BooleanGetValueMethodID = get_method_id(env, BooleanClass, "booleanValue", "()Z");
   IntegerGetValueMethodID = get_method_id(env, IntegerClass, "intValue", "()I");
@@ -123,7 +135,7 @@ static size_t get_utf8_from_utf16_length(const jchar *p, jsize len) {
   for (jsize i = 0; i < len; i++) {
     uint32 cur = p[i];
     if ((cur & 0xF800) == 0xD800) {
-      if (i < len) {
+      if (i + 1 < len) {
         uint32 next = p[++i];
         if ((next & 0xFC00) == 0xDC00 && (cur & 0x400) == 0) {
           result += 4;
@@ -165,14 +177,22 @@ static void utf16_to_utf8(const jchar *p, jsize len, char *res) {
   }
 }
 
-static jsize get_utf16_from_utf8_length(const char *p, size_t len, jsize *surrogates) {
+// returns true, if the string consists only of non-zero ASCII characters, which can be passed to NewStringUTF as is
+static bool get_utf16_from_utf8_length(const char *p, size_t len, jsize *result) {
   // UTF-8 correctness is supposed
-  jsize result = 0;
+  jsize length = 0;
+  jsize surrogates = 0;
+  unsigned char all_chars = 0;
+  bool has_zero = false;
   for (size_t i = 0; i < len; i++) {
-    result += ((p[i] & 0xc0) != 0x80);
-    *surrogates += ((p[i] & 0xf8) == 0xf0);
+    auto c = static_cast<unsigned char>(p[i]);
+    all_chars |= c;
+    has_zero |= c == 0;
+    length += ((c & 0xc0) != 0x80);
+    surrogates += ((c & 0xf8) == 0xf0);
   }
-  return result;
+  *result = length + surrogates;
+  return all_chars < 0x80 && !has_zero;
 }
 
 static void utf8_to_utf16(const char *p, size_t len, jchar *res) {
@@ -216,7 +236,11 @@ std::string from_jstring(JNIEnv *env, jstring s) {
     return std::string();
   }
   jsize s_len = env->GetStringLength(s);
-  const jchar *p = env->GetStringChars(s, nullptr);
+  if (s_len == 0) {
+    return std::string();
+  }
+  // no JNI calls are made until the characters are released, so the string can be accessed without a copy
+  const jchar *p = env->GetStringCritical(s, nullptr);
   if (p == nullptr) {
     parse_error = true;
     return std::string();
@@ -226,18 +250,17 @@ std::string from_jstring(JNIEnv *env, jstring s) {
   if (len) {
     utf16_to_utf8(p, s_len, &res[0]);
   }
-  env->ReleaseStringChars(s, p);
+  env->ReleaseStringCritical(s, p);
   return res;
 }
 
 jstring to_jstring(JNIEnv *env, const std::string &s) {
-  jsize surrogates = 0;
-  jsize unicode_len = get_utf16_from_utf8_length(s.c_str(), s.size(), &surrogates);
-  if (surrogates == 0) {
-    // TODO '\0'
+  jsize result_len = 0;
+  if (get_utf16_from_utf8_length(s.c_str(), s.size(), &result_len)) {
+    // ASCII strings have the same representation in modified UTF-8
     return env->NewStringUTF(s.c_str());
   }
-  jsize result_len = surrogates + unicode_len;
+  // other strings are converted directly to UTF-16 to avoid modified UTF-8 validation and conversion by the JVM
   if (result_len <= 256) {
     jchar result[256];
     utf8_to_utf16(s.c_str(), s.size(), result);
@@ -307,6 +330,10 @@ jobjectArray store_vector(JNIEnv *env, const std::vector<std::string> &v) {
   jobjectArray arr = env->NewObjectArray(length, StringClass, 0);
   if (arr != nullptr) {
     for (jsize i = 0; i < length; i++) {
+      if (v[i].empty()) {
+        env->SetObjectArrayElement(arr, i, EmptyString);
+        continue;
+      }
       jstring str = to_jstring(env, v[i]);
       if (str) {
         env->SetObjectArrayElement(arr, i, str);
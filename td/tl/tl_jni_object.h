@@ -27,6 +27,7 @@ extern thread_local bool parse_error;
 extern jclass ArrayKeyboardButtonClass;
 extern jclass ArrayInlineKeyboardButtonClass;
 extern jclass ArrayPageBlockTableCellClass;
+extern jstring EmptyString;
 extern jmethodID GetConstructorID;
 extern jmethodID BooleanGetValueMethodID;
 extern jmethodID IntegerGetValueMethodID;
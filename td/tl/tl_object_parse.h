@@ -13,6 +13,7 @@
 
 #include <cstdint>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 namespace td {
@@ -135,6 +136,33 @@ class TlFetchVector {
   }
 };
 
+// vectors of fixed-size numbers are fetched at once after a single length check
+template <class T>
+class TlFetchBinaryVector {
+ public:
+  template <class ParserT>
+  static std::vector<T> parse(ParserT &parser) {
+    const std::uint32_t multiplicity = parser.fetch_int();
+    std::vector<T> v;
+    if (parser.get_left_len() / sizeof(T) < multiplicity) {
+      parser.set_error("Wrong vector length");
+    } else {
+      v.resize(multiplicity);
+      parser.fetch_binary_array(v.data(), v.size());
+    }
+    return v;
+  }
+};
+
+template <>
+class TlFetchVector<TlFetchInt> final : public TlFetchBinaryVector<std::int32_t> {};
+
+template <>
+class TlFetchVector<TlFetchLong> final : public TlFetchBinaryVector<std::int64_t> {};
+
+template <>
+class TlFetchVector<TlFetchDouble> final : public TlFetchBinaryVector<double> {};
+
 template <class T>
 class TlFetchObject {
  public:
@@ -144,4 +172,35 @@ class TlFetchObject {
   }
 };
 
+// fetches an object stored by TlStoreNullableObject
+template <class T>
+class TlFetchNullableObject {
+  template <class ParserT>
+  static tl_object_ptr<T> fetch(ParserT &parser, std::true_type /*is_abstract*/) {
+    return T::fetch(parser);
+  }
+
+  template <class ParserT>
+  static tl_object_ptr<T> fetch(ParserT &parser, std::false_type /*is_abstract*/) {
+    auto constructor = parser.fetch_int();
+    if (constructor != T::ID) {
+      parser.set_error(PSTRING() << "Wrong constructor " << constructor << " found instead of " << T::ID);
+      return nullptr;
+    }
+    return T::fetch(parser);
+  }
+
+ public:
+  template <class ParserT>
+  static tl_object_ptr<T> parse(ParserT &parser) {
+    constexpr std::int32_t ID_NULL = 0x56730bcc;
+
+    if (parser.can_prefetch_int() && parser.prefetch_int_unsafe() == ID_NULL) {
+      parser.fetch_int();
+      return nullptr;
+    }
+    return fetch(parser, std::is_abstract<T>());
+  }
+};
+
 }  // namespace td
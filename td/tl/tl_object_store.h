@@ -75,6 +75,17 @@ class TlStoreVector {
   }
 };
 
+// vectors of fixed-size numbers are stored at once
+template <>
+class TlStoreVector<TlStoreBinary> {
+ public:
+  template <class T, class StorerT>
+  static void store(const std::vector<T> &vec, StorerT &storer) {
+    storer.store_binary(narrow_cast<int32>(vec.size()));
+    storer.store_binary_array(vec.data(), vec.size());
+  }
+};
+
 class TlStoreObject {
  public:
   template <class T, class StorerT>
@@ -83,4 +94,20 @@ class TlStoreObject {
   }
 };
 
+// stores the object with its constructor identifier or the "null" constructor identifier if there is no object
+class TlStoreNullableObject {
+ public:
+  template <class T, class StorerT>
+  static void store(const tl_object_ptr<T> &obj, StorerT &storer) {
+    constexpr std::int32_t ID_NULL = 0x56730bcc;
+
+    if (obj == nullptr) {
+      storer.store_binary(ID_NULL);
+      return;
+    }
+    storer.store_binary(obj->get_id());
+    obj->store(storer);
+  }
+};
+
 }  // namespace td
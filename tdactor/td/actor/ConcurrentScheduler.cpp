@@ -7,15 +7,19 @@
 #include "td/actor/ConcurrentScheduler.h"
 
 #include "td/utils/ExitGuard.h"
+#include "td/utils/logging.h"
+#include "td/utils/misc.h"
 #include "td/utils/MpscPollableQueue.h"
+#include "td/utils/port/FileFd.h"
 #include "td/utils/port/thread_local.h"
 #include "td/utils/ScopeGuard.h"
+#include "td/utils/SliceBuilder.h"
 
 #include <memory>
 
 namespace td {
 
-void ConcurrentScheduler::init(int32 threads_n) {
+void ConcurrentScheduler::init(int32 threads_n, const Options &options) {
 #if TD_THREAD_UNSUPPORTED || TD_EVENTFD_UNSUPPORTED
   threads_n = 0;
 #endif
@@ -51,8 +55,29 @@ void ConcurrentScheduler::init(int32 threads_n) {
 #endif
 
     sched->init(i, outbound, static_cast<Scheduler::Callback *>(this));
+    if (options.batch_outbound_events) {
+      sched->enable_outbound_event_batching();
+    }
+    if (options.max_spin_poll_time > 0) {
+      sched->enable_spin_poll(options.max_spin_poll_time, options.spin_poll_cpu_share);
+    }
+    sched->set_max_mailbox_flush_size(options.max_mailbox_flush_size);
+  }
+
+  // the extra scheduler doesn't participate in work stealing
+  if (options.enable_work_stealing && threads_n > 1) {
+    auto work_stealing_state = std::make_shared<Scheduler::WorkStealingState>();
+    for (int32 i = 0; i < threads_n; i++) {
+      work_stealing_state->schedulers.push_back(make_unique<Scheduler::WorkStealingState::SchedulerState>());
+    }
+    for (int32 i = 0; i < threads_n; i++) {
+      schedulers_[i]->enable_work_stealing(work_stealing_state);
+    }
   }
 
+  thread_affinity_masks_ = options.thread_affinity_masks;
+  is_main_thread_pinned_ = false;
+
 #if TD_PORT_WINDOWS
   iocp_ = make_unique<detail::Iocp>();
   iocp_->init();
@@ -61,6 +86,49 @@ void ConcurrentScheduler::init(int32 threads_n) {
   state_ = State::Start;
 }
 
+void ConcurrentScheduler::set_thread_affinity(int32 sched_id) {
+#if !TD_THREAD_UNSUPPORTED
+  if (static_cast<size_t>(sched_id) >= thread_affinity_masks_.size() || thread_affinity_masks_[sched_id] == 0) {
+    return;
+  }
+  auto status = thread::set_affinity_mask(this_thread::get_id(), thread_affinity_masks_[sched_id]);
+  if (status.is_error()) {
+    LOG(ERROR) << "Failed to pin thread of scheduler " << sched_id << ": " << status;
+  }
+#endif
+}
+
+uint64 ConcurrentScheduler::get_numa_node_affinity_mask(int32 node_id) {
+#if TD_LINUX
+  auto r_fd = FileFd::open(PSLICE() << "/sys/devices/system/node/node" << node_id << "/cpulist", FileFd::Read);
+  if (r_fd.is_error()) {
+    return 0;
+  }
+  char buf[1024];
+  auto r_size = r_fd.ok_ref().read(MutableSlice(buf, sizeof(buf)));
+  if (r_size.is_error()) {
+    return 0;
+  }
+
+  // the list has format "0-3,8,10-11"
+  uint64 mask = 0;
+  for (auto range : full_split(trim(Slice(buf, r_size.ok())), ',')) {
+    auto first_last = split(range, '-');
+    auto r_first = to_integer_safe<int32>(first_last.first);
+    auto r_last = first_last.second.empty() ? r_first.clone() : to_integer_safe<int32>(first_last.second);
+    if (r_first.is_error() || r_last.is_error()) {
+      return 0;
+    }
+    for (auto cpu = r_first.ok(); cpu <= r_last.ok() && cpu < 64; cpu++) {
+      mask |= static_cast<uint64>(1) << cpu;
+    }
+  }
+  return mask;
+#else
+  return 0;
+#endif
+}
+
 void ConcurrentScheduler::test_one_thread_run() {
   do {
     for (auto &sched : schedulers_) {
@@ -75,10 +143,11 @@ void ConcurrentScheduler::start() {
 #if !TD_THREAD_UNSUPPORTED && !TD_EVENTFD_UNSUPPORTED
   for (size_t i = 1; i + extra_scheduler_ < schedulers_.size(); i++) {
     auto &sched = schedulers_[i];
-    threads_.push_back(td::thread([&] {
+    threads_.push_back(td::thread([&, sched_id = static_cast<int32>(i)] {
 #if TD_PORT_WINDOWS
       detail::Iocp::Guard iocp_guard(iocp_.get());
 #endif
+      set_thread_affinity(sched_id);
       while (!is_finished()) {
         sched->run(Timestamp::in(10));
       }
@@ -100,6 +169,10 @@ bool ConcurrentScheduler::run_main(Timestamp timeout) {
   CHECK(state_ == State::Run);
   // run main scheduler in same thread
   auto &main_sched = schedulers_[0];
+  if (!is_main_thread_pinned_) {
+    is_main_thread_pinned_ = true;
+    set_thread_affinity(0);
+  }
   if (!is_finished()) {
 #if TD_PORT_WINDOWS
     detail::Iocp::Guard iocp_guard(iocp_.get());
@@ -26,7 +26,34 @@ namespace td {
 
 class ConcurrentScheduler final : private Scheduler::Callback {
  public:
-  void init(int32 threads_n);
+  struct Options {
+    // idle schedulers take over actors, which allowed stealing, from busy schedulers
+    bool enable_work_stealing = false;
+
+    // events sent to other schedulers during one pass over ready actors are delivered at once
+    // the order of events sent from one scheduler to another is preserved
+    bool batch_outbound_events = false;
+
+    // thread of the scheduler i is pinned to CPUs from the mask i; bit j of a mask allows to use CPU j
+    // an absent or zero mask leaves the thread unpinned; the main scheduler is pinned on the first run_main call
+    vector<uint64> thread_affinity_masks;
+
+    // before blocking in poll, idle schedulers busy-wait for events from other schedulers for up to
+    // max_spin_poll_time seconds; the spin time adapts to the arrival rate of the events
+    // at most spin_poll_cpu_share of the thread's time is spent on busy-waiting
+    double max_spin_poll_time = 0.0;
+    double spin_poll_cpu_share = 0.1;
+
+    // at most max_mailbox_flush_size events of an actor are handled in a row, then the actor is moved to the end of
+    // the ready actor queue, so an actor with a long mailbox doesn't delay other actors on the same scheduler;
+    // the order of events is preserved; zero means that there is no limit
+    size_t max_mailbox_flush_size = 0;
+  };
+
+  void init(int32 threads_n) {
+    init(threads_n, Options());
+  }
+  void init(int32 threads_n, const Options &options);
 
   void finish_async() {
     schedulers_[0]->finish();
@@ -59,6 +86,9 @@ class ConcurrentScheduler final : private Scheduler::Callback {
   static double emscripten_get_main_timeout();
   static void emscripten_clear_main_timeout();
 
+  // returns mask of CPUs of the NUMA node or 0 if the node is unknown
+  static uint64 get_numa_node_affinity_mask(int32 node_id);
+
   void finish();
 
   template <class ActorT, class... Args>
@@ -96,6 +126,10 @@ class ConcurrentScheduler final : private Scheduler::Callback {
   td::thread iocp_thread_;
 #endif
   int32 extra_scheduler_ = 0;
+  vector<uint64> thread_affinity_masks_;
+  bool is_main_thread_pinned_ = false;
+
+  void set_thread_affinity(int32 sched_id);
 
   void on_finish() final;
 
@@ -13,13 +13,19 @@
 #include "td/utils/common.h"
 #include "td/utils/invoke.h"
 #include "td/utils/MovableValue.h"
+#include "td/utils/port/thread_local.h"
 #include "td/utils/ScopeGuard.h"
 #include "td/utils/Status.h"
 
+#include <array>
 #include <tuple>
 #include <type_traits>
 #include <utility>
 
+#if TD_HAVE_COROUTINES
+#include <coroutine>
+#endif
+
 namespace td {
 
 template <class T = Unit>
@@ -723,4 +729,369 @@ class PromiseCreator {
   }
 };
 
+#if TD_HAVE_COROUTINES
+// Coroutine layer over Promise and FutureActor
+//
+// Task<T> is a lazily started coroutine, which returns Result<T>. It can be started from an actor
+// with std::move(task).start(promise) or awaited from another Task. Awaiting of a Promise-based operation
+// or of a FutureActor suspends the coroutine until the result is received by the currently running actor,
+// so the coroutine is always resumed on the scheduler of the actor, which started it.
+// If the actor is destroyed before the result is received, the whole chain of coroutine frames is destroyed.
+//
+// Task<int> get_next_value(ActorId<Calculator> calculator) {
+//   auto r_value = co_await await_promise<int>([&](Promise<int> promise) {
+//     send_closure(calculator, &Calculator::get_value, std::move(promise));
+//   });
+//   if (r_value.is_error()) {
+//     co_return r_value.move_as_error();
+//   }
+//   co_return r_value.ok() + 1;
+// }
+
+template <class T = Unit>
+class Task;
+
+namespace detail {
+
+// thread-local cache of coroutine frames, which avoids malloc calls for every started coroutine
+class CoroutineFramePool {
+ public:
+  static void *allocate(size_t size) {
+    auto size_class = get_size_class(size);
+    if (size_class >= SIZE_CLASS_COUNT) {
+      return ::operator new(size);
+    }
+    auto &free_list = get_pool().free_lists_[size_class];
+    if (free_list.head == nullptr) {
+      return ::operator new((size_class + 1) * GRANULARITY);
+    }
+    auto *result = free_list.head;
+    free_list.head = result->next;
+    free_list.size--;
+    return result;
+  }
+
+  static void deallocate(void *ptr, size_t size) {
+    auto size_class = get_size_class(size);
+    if (size_class >= SIZE_CLASS_COUNT) {
+      ::operator delete(ptr);
+      return;
+    }
+    auto &free_list = get_pool().free_lists_[size_class];
+    if (free_list.size >= MAX_FREE_LIST_SIZE) {
+      ::operator delete(ptr);
+      return;
+    }
+    auto *node = static_cast<FreeNode *>(ptr);
+    node->next = free_list.head;
+    free_list.head = node;
+    free_list.size++;
+  }
+
+  CoroutineFramePool() = default;
+  CoroutineFramePool(const CoroutineFramePool &) = delete;
+  CoroutineFramePool &operator=(const CoroutineFramePool &) = delete;
+  CoroutineFramePool(CoroutineFramePool &&) = delete;
+  CoroutineFramePool &operator=(CoroutineFramePool &&) = delete;
+  ~CoroutineFramePool() {
+    for (auto &free_list : free_lists_) {
+      while (free_list.head != nullptr) {
+        auto *next = free_list.head->next;
+        ::operator delete(free_list.head);
+        free_list.head = next;
+      }
+    }
+  }
+
+ private:
+  static constexpr size_t GRANULARITY = 64;
+  static constexpr size_t SIZE_CLASS_COUNT = 32;
+  static constexpr size_t MAX_FREE_LIST_SIZE = 256;
+
+  struct FreeNode {
+    FreeNode *next;
+  };
+  struct FreeList {
+    FreeNode *head = nullptr;
+    size_t size = 0;
+  };
+  std::array<FreeList, SIZE_CLASS_COUNT> free_lists_;
+
+  static size_t get_size_class(size_t size) {
+    return size == 0 ? 0 : (size - 1) / GRANULARITY;
+  }
+
+  static CoroutineFramePool &get_pool() {
+    static TD_THREAD_LOCAL CoroutineFramePool *pool;  // static zero-initialized
+    init_thread_local<CoroutineFramePool>(pool);
+    return *pool;
+  }
+};
+
+class TaskPromiseBase {
+ public:
+  static void *operator new(size_t size) {
+    return CoroutineFramePool::allocate(size);
+  }
+  static void operator delete(void *ptr, size_t size) {
+    CoroutineFramePool::deallocate(ptr, size);
+  }
+
+  std::suspend_always initial_suspend() noexcept {
+    return {};
+  }
+
+  void unhandled_exception() noexcept {
+    LOG(FATAL) << "Unhandled exception in a coroutine";
+  }
+
+  // the coroutine to resume after the task is finished; empty for started tasks
+  std::coroutine_handle<> continuation_;
+  // the started task, which transitively owns frames of all awaited tasks
+  std::coroutine_handle<> root_;
+};
+
+template <class T>
+class TaskPromise final : public TaskPromiseBase {
+ public:
+  Task<T> get_return_object() noexcept;
+
+  auto final_suspend() noexcept {
+    struct FinalAwaiter {
+      bool await_ready() noexcept {
+        return false;
+      }
+      std::coroutine_handle<> await_suspend(std::coroutine_handle<TaskPromise> handle) noexcept {
+        auto &task_promise = handle.promise();
+        if (task_promise.continuation_) {
+          return task_promise.continuation_;
+        }
+        auto promise = std::move(task_promise.promise_);
+        auto result = std::move(task_promise.result_);
+        handle.destroy();
+        promise.set_result(std::move(result));
+        return std::noop_coroutine();
+      }
+      void await_resume() noexcept {
+      }
+    };
+    return FinalAwaiter{};
+  }
+
+  void return_value(Result<T> &&result) {
+    result_ = std::move(result);
+  }
+
+  Result<T> result_;
+  Promise<T> promise_;
+};
+
+// owns the chain of suspended coroutines and destroys it if the coroutine will never be resumed
+class CoroutineResumeGuard {
+ public:
+  CoroutineResumeGuard(std::coroutine_handle<> root, std::coroutine_handle<> handle) : root_(root), handle_(handle) {
+  }
+  CoroutineResumeGuard(const CoroutineResumeGuard &) = delete;
+  CoroutineResumeGuard &operator=(const CoroutineResumeGuard &) = delete;
+  CoroutineResumeGuard(CoroutineResumeGuard &&other) noexcept
+      : root_(std::exchange(other.root_, nullptr)), handle_(std::exchange(other.handle_, nullptr)) {
+  }
+  CoroutineResumeGuard &operator=(CoroutineResumeGuard &&) = delete;
+  ~CoroutineResumeGuard() {
+    if (root_) {
+      root_.destroy();
+    }
+  }
+
+  void resume() {
+    CHECK(handle_);
+    root_ = nullptr;
+    std::exchange(handle_, nullptr).resume();
+  }
+
+ private:
+  std::coroutine_handle<> root_;
+  std::coroutine_handle<> handle_;
+};
+
+inline ActorId<> get_coroutine_actor_id() {
+  auto actor_id = Scheduler::instance()->get_current_actor_id();
+  LOG_CHECK(!actor_id.empty()) << "Coroutine must be resumed by an actor";
+  return actor_id;
+}
+
+template <class T>
+void resume_coroutine(ActorId<> actor_id, CoroutineResumeGuard &&guard, Result<T> *result_ptr, Result<T> &&result) {
+  send_lambda(actor_id, [guard = std::move(guard), result_ptr, result = std::move(result)]() mutable {
+    *result_ptr = std::move(result);
+    guard.resume();
+  });
+}
+
+template <class T>
+class CoroutinePromise final : public PromiseInterface<T> {
+ public:
+  CoroutinePromise(ActorId<> actor_id, CoroutineResumeGuard &&guard, Result<T> *result_ptr)
+      : actor_id_(std::move(actor_id)), guard_(std::move(guard)), result_ptr_(result_ptr) {
+  }
+  CoroutinePromise(const CoroutinePromise &) = delete;
+  CoroutinePromise &operator=(const CoroutinePromise &) = delete;
+  CoroutinePromise(CoroutinePromise &&) = delete;
+  CoroutinePromise &operator=(CoroutinePromise &&) = delete;
+  ~CoroutinePromise() final {
+    if (result_ptr_ != nullptr) {
+      do_set_result(Status::Error("Lost promise"));
+    }
+  }
+
+  void set_value(T &&value) final {
+    do_set_result(std::move(value));
+  }
+  void set_error(Status &&error) final {
+    do_set_result(std::move(error));
+  }
+
+ private:
+  ActorId<> actor_id_;
+  CoroutineResumeGuard guard_;
+  Result<T> *result_ptr_;
+
+  void do_set_result(Result<T> &&result) {
+    CHECK(result_ptr_ != nullptr);
+    resume_coroutine(std::move(actor_id_), std::move(guard_), std::exchange(result_ptr_, nullptr), std::move(result));
+  }
+};
+
+template <class T, class F>
+class PromiseAwaiter {
+ public:
+  explicit PromiseAwaiter(F f) : f_(std::move(f)) {
+  }
+
+  bool await_ready() noexcept {
+    return false;
+  }
+  template <class PromiseT>
+  void await_suspend(std::coroutine_handle<PromiseT> handle) {
+    static_assert(std::is_base_of<TaskPromiseBase, PromiseT>::value, "Promise can be awaited only from a Task");
+    // the promise can be set before f_ returns, but the coroutine will be resumed only by a separate event
+    f_(Promise<T>(td::make_unique<CoroutinePromise<T>>(
+        get_coroutine_actor_id(), CoroutineResumeGuard(handle.promise().root_, handle), &result_)));
+  }
+  Result<T> await_resume() {
+    return std::move(result_);
+  }
+
+ private:
+  F f_;
+  Result<T> result_;
+};
+
+template <class T>
+class FutureActorAwaiter {
+ public:
+  explicit FutureActorAwaiter(FutureActor<T> &future) : future_(future) {
+  }
+
+  bool await_ready() noexcept {
+    return future_.is_ready();
+  }
+  template <class PromiseT>
+  void await_suspend(std::coroutine_handle<PromiseT> handle) {
+    static_assert(std::is_base_of<TaskPromiseBase, PromiseT>::value, "FutureActor can be awaited only from a Task");
+    future_.set_event(EventCreator::lambda(
+        get_coroutine_actor_id(),
+        [guard = CoroutineResumeGuard(handle.promise().root_, handle)]() mutable { guard.resume(); }));
+  }
+  Result<T> await_resume() {
+    return future_.move_as_result();
+  }
+
+ private:
+  FutureActor<T> &future_;
+};
+
+}  // namespace detail
+
+template <class T>
+class Task {
+ public:
+  using promise_type = detail::TaskPromise<T>;
+
+  Task() = default;
+  Task(const Task &) = delete;
+  Task &operator=(const Task &) = delete;
+  Task(Task &&other) noexcept : handle_(std::exchange(other.handle_, nullptr)) {
+  }
+  Task &operator=(Task &&other) noexcept {
+    if (this != &other) {
+      reset();
+      handle_ = std::exchange(other.handle_, nullptr);
+    }
+    return *this;
+  }
+  ~Task() {
+    reset();
+  }
+
+  bool empty() const {
+    return !handle_;
+  }
+
+  // runs the task until its first suspension; the promise will receive the result of the task
+  void start(Promise<T> promise) && {
+    CHECK(handle_);
+    auto handle = std::exchange(handle_, nullptr);
+    handle.promise().promise_ = std::move(promise);
+    handle.promise().root_ = handle;
+    handle.resume();
+  }
+
+  bool await_ready() const noexcept {
+    return false;
+  }
+  template <class PromiseT>
+  std::coroutine_handle<> await_suspend(std::coroutine_handle<PromiseT> continuation) noexcept {
+    static_assert(std::is_base_of<detail::TaskPromiseBase, PromiseT>::value, "Task can be awaited only from a Task");
+    auto &task_promise = handle_.promise();
+    task_promise.continuation_ = continuation;
+    task_promise.root_ = continuation.promise().root_;
+    return handle_;
+  }
+  Result<T> await_resume() {
+    return std::move(handle_.promise().result_);
+  }
+
+ private:
+  friend promise_type;
+
+  explicit Task(std::coroutine_handle<promise_type> handle) : handle_(handle) {
+  }
+
+  void reset() {
+    if (handle_) {
+      std::exchange(handle_, nullptr).destroy();
+    }
+  }
+
+  std::coroutine_handle<promise_type> handle_;
+};
+
+template <class T>
+Task<T> detail::TaskPromise<T>::get_return_object() noexcept {
+  return Task<T>(std::coroutine_handle<TaskPromise>::from_promise(*this));
+}
+
+// returns an awaitable, which calls f with a Promise<T> and returns Result<T>, received by the promise
+template <class T, class F>
+auto await_promise(F &&f) {
+  return detail::PromiseAwaiter<T, std::decay_t<F>>(std::forward<F>(f));
+}
+
+template <class T>
+auto operator co_await(FutureActor<T> &future) {
+  return detail::FutureActorAwaiter<T>(future);
+}
+#endif
+
 }  // namespace td
@@ -81,6 +81,10 @@ class Actor : public ObserverBase {
 
   void always_wait_for_mailbox();
 
+  // allows an idle scheduler to take the actor over, if work stealing is enabled in ConcurrentScheduler
+  // the actor must not own file descriptors and must not rely on the scheduler it was created on
+  void allow_stealing();
+
   // for ActorInfo mostly
   void init(ObjectPool<ActorInfo>::OwnerPtr &&info);
   ActorInfo *get_info();
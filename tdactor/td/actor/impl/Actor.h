@@ -52,7 +52,7 @@ inline void Actor::do_stop() {
   CHECK(empty());
 }
 inline bool Actor::has_timeout() const {
-  return get_info()->get_heap_node()->in_heap();
+  return get_info()->has_timeout();
 }
 inline double Actor::get_timeout() const {
   return Scheduler::instance()->get_actor_timeout(this);
@@ -168,4 +168,8 @@ inline void Actor::always_wait_for_mailbox() {
   info_->always_wait_for_mailbox();
 }
 
+inline void Actor::allow_stealing() {
+  info_->allow_stealing();
+}
+
 }  // namespace td
@@ -7,7 +7,9 @@
 #pragma once
 
 #include "td/actor/impl/ActorId-decl.h"
+#include "td/actor/impl/ActorStats.h"
 #include "td/actor/impl/Event.h"
+#include "td/actor/impl/EventTrace.h"
 
 #include "td/utils/common.h"
 #include "td/utils/Heap.h"
@@ -15,15 +17,26 @@
 #include "td/utils/ObjectPool.h"
 #include "td/utils/Slice.h"
 #include "td/utils/StringBuilder.h"
+#include "td/utils/TimingWheel.h"
 
 #include <atomic>
 #include <memory>
 #include <utility>
 
+#ifndef TD_ACTOR_TIMING_WHEEL
+#define TD_ACTOR_TIMING_WHEEL 0
+#endif
+
 namespace td {
 
 class Actor;
 
+#if TD_ACTOR_TIMING_WHEEL
+using ActorTimeoutNode = TimingWheelNode;
+#else
+using ActorTimeoutNode = HeapNode;
+#endif
+
 class ActorContext {
  public:
   ActorContext() = default;
@@ -47,9 +60,15 @@ class ActorContext {
   std::weak_ptr<ActorContext> this_ptr_;
 };
 
+// node of an intrusive list of events, sent to a migrating actor on its destination scheduler
+struct ActorPendingEvent {
+  Event event;
+  ActorPendingEvent *next = nullptr;
+};
+
 class ActorInfo final
     : private ListNode
-    , private HeapNode {
+    , private ActorTimeoutNode {
  public:
   enum class Deleter : uint8 { Destroy, None };
 
@@ -91,9 +110,10 @@ class ActorInfo final
   const ActorContext *get_context() const;
   CSlice get_name() const;
 
-  HeapNode *get_heap_node();
-  const HeapNode *get_heap_node() const;
-  static ActorInfo *from_heap_node(HeapNode *node);
+  ActorTimeoutNode *get_timeout_node();
+  const ActorTimeoutNode *get_timeout_node() const;
+  static ActorInfo *from_timeout_node(ActorTimeoutNode *node);
+  bool has_timeout() const;
 
   ListNode *get_list_node();
   const ListNode *get_list_node() const;
@@ -105,6 +125,14 @@ class ActorInfo final
 
   vector<Event> mailbox_;
 
+  // can be used only by the scheduler, to which the actor is migrating
+  void add_pending_event(ActorPendingEvent *pending_event);
+  ActorPendingEvent *extract_pending_events();
+
+#if TD_ACTOR_STATS
+  ActorStats stats_;
+#endif
+
   bool need_context() const;
   bool need_start_up() const;
 
@@ -112,18 +140,25 @@ class ActorInfo final
   bool must_wait(uint32 wait_generation) const;
   void always_wait_for_mailbox();
 
+  void allow_stealing();
+  bool can_be_stolen() const;
+
  private:
   Deleter deleter_ = Deleter::None;
   bool need_context_ = true;
   bool need_start_up_ = true;
   bool is_running_ = false;
   bool always_wait_for_mailbox_{false};
+  bool can_be_stolen_{false};
   uint32 wait_generation_{0};
 
   std::atomic<int32> sched_id_{0};
   Actor *actor_ = nullptr;
 
-#ifdef TD_DEBUG
+  ActorPendingEvent *pending_events_head_ = nullptr;
+  ActorPendingEvent *pending_events_tail_ = nullptr;
+
+#if defined(TD_DEBUG) || TD_ACTOR_STATS || TD_ACTOR_TRACE
   string name_;
 #endif
   std::shared_ptr<ActorContext> context_;
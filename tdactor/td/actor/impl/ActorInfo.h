@@ -17,6 +17,7 @@
 #include "td/utils/ObjectPool.h"
 #include "td/utils/Slice.h"
 #include "td/utils/StringBuilder.h"
+#include "td/utils/TimingWheel.h"
 
 #include <atomic>
 #include <memory>
@@ -41,9 +42,12 @@ inline void ActorInfo::init(int32 sched_id, Slice name, ObjectPool<ActorInfo>::O
     context_ = Scheduler::context()->this_ptr_.lock();
     VLOG(actor) << "Set context " << context_.get() << " for " << name;
   }
-#ifdef TD_DEBUG
+#if defined(TD_DEBUG) || TD_ACTOR_STATS || TD_ACTOR_TRACE
   name_.assign(name.data(), name.size());
 #endif
+#if TD_ACTOR_STATS
+  stats_.clear();
+#endif
 
   actor_->init(std::move(this_ptr));
   deleter_ = deleter;
@@ -73,18 +77,28 @@ inline void ActorInfo::always_wait_for_mailbox() {
   always_wait_for_mailbox_ = true;
 }
 
+inline void ActorInfo::allow_stealing() {
+  can_be_stolen_ = true;
+}
+
+inline bool ActorInfo::can_be_stolen() const {
+  return can_be_stolen_;
+}
+
 inline void ActorInfo::on_actor_moved(Actor *actor_new_ptr) {
   actor_ = actor_new_ptr;
 }
 
 inline void ActorInfo::clear() {
   CHECK(mailbox_.empty());
+  CHECK(pending_events_head_ == nullptr);
   CHECK(!actor_);
   CHECK(!is_running());
   CHECK(!is_migrating());
   // NB: must be in non migrating state
   // store invalid scheduler id.
   sched_id_.store((1 << 30) - 1, std::memory_order_relaxed);
+  can_be_stolen_ = false;
   VLOG(actor) << "Clear context " << context_.get() << " for " << get_name();
   context_.reset();
 }
@@ -177,7 +191,7 @@ inline ActorContext *ActorInfo::get_context() {
 }
 
 inline CSlice ActorInfo::get_name() const {
-#ifdef TD_DEBUG
+#if defined(TD_DEBUG) || TD_ACTOR_STATS || TD_ACTOR_TRACE
   return name_;
 #else
   return "";
@@ -200,15 +214,39 @@ inline bool ActorInfo::is_running() const {
   return is_running_;
 }
 
-inline HeapNode *ActorInfo::get_heap_node() {
+inline ActorTimeoutNode *ActorInfo::get_timeout_node() {
   return this;
 }
-inline const HeapNode *ActorInfo::get_heap_node() const {
+inline const ActorTimeoutNode *ActorInfo::get_timeout_node() const {
   return this;
 }
-inline ActorInfo *ActorInfo::from_heap_node(HeapNode *node) {
+inline ActorInfo *ActorInfo::from_timeout_node(ActorTimeoutNode *node) {
   return static_cast<ActorInfo *>(node);
 }
+inline bool ActorInfo::has_timeout() const {
+#if TD_ACTOR_TIMING_WHEEL
+  return get_timeout_node()->in_wheel();
+#else
+  return get_timeout_node()->in_heap();
+#endif
+}
+inline void ActorInfo::add_pending_event(ActorPendingEvent *pending_event) {
+  CHECK(pending_event->next == nullptr);
+  if (pending_events_tail_ == nullptr) {
+    pending_events_head_ = pending_event;
+  } else {
+    pending_events_tail_->next = pending_event;
+  }
+  pending_events_tail_ = pending_event;
+}
+
+inline ActorPendingEvent *ActorInfo::extract_pending_events() {
+  auto result = pending_events_head_;
+  pending_events_head_ = nullptr;
+  pending_events_tail_ = nullptr;
+  return result;
+}
+
 inline ListNode *ActorInfo::get_list_node() {
   return this;
 }
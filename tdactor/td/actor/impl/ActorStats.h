@@ -0,0 +1,101 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2022
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#pragma once
+
+#include "td/utils/common.h"
+#include "td/utils/StringBuilder.h"
+
+#include <array>
+
+#ifndef TD_ACTOR_STATS
+#define TD_ACTOR_STATS 0
+#endif
+
+namespace td {
+
+// per-actor statistics, which are collected only if TD_ACTOR_STATS is enabled
+class ActorStats {
+ public:
+  // bucket i holds number of events, which waited in the mailbox less than 2^i microseconds
+  static constexpr size_t DELAY_BUCKET_COUNT = 24;
+
+  void clear() {
+    *this = ActorStats();
+  }
+
+  void on_event() {
+    event_count_++;
+  }
+
+  void on_run(double run_time) {
+    run_count_++;
+    run_time_ += run_time;
+    if (run_time > max_run_time_) {
+      max_run_time_ = run_time;
+    }
+  }
+
+  void on_mailbox_delay(double delay) {
+    size_t bucket = 0;
+    auto delay_us = static_cast<uint64>(delay > 0 ? delay * 1e6 : 0);
+    while (bucket + 1 < DELAY_BUCKET_COUNT && (static_cast<uint64>(1) << bucket) <= delay_us) {
+      bucket++;
+    }
+    mailbox_delay_[bucket]++;
+    delayed_event_count_++;
+  }
+
+  uint64 get_event_count() const {
+    return event_count_;
+  }
+  uint64 get_run_count() const {
+    return run_count_;
+  }
+  double get_run_time() const {
+    return run_time_;
+  }
+  double get_max_run_time() const {
+    return max_run_time_;
+  }
+
+  // returns an upper bound of the given quantile of the mailbox delay in microseconds
+  uint64 get_mailbox_delay_quantile(double quantile) const {
+    auto need = static_cast<uint64>(static_cast<double>(delayed_event_count_) * quantile);
+    uint64 count = 0;
+    for (size_t i = 0; i < DELAY_BUCKET_COUNT; i++) {
+      count += mailbox_delay_[i];
+      if (count > need) {
+        return static_cast<uint64>(1) << i;
+      }
+    }
+    return static_cast<uint64>(1) << (DELAY_BUCKET_COUNT - 1);
+  }
+
+  uint64 get_delayed_event_count() const {
+    return delayed_event_count_;
+  }
+
+ private:
+  uint64 event_count_ = 0;
+  uint64 run_count_ = 0;
+  double run_time_ = 0.0;
+  double max_run_time_ = 0.0;
+  uint64 delayed_event_count_ = 0;
+  std::array<uint64, DELAY_BUCKET_COUNT> mailbox_delay_{};
+};
+
+inline StringBuilder &operator<<(StringBuilder &sb, const ActorStats &stats) {
+  sb << "[events:" << stats.get_event_count() << "][runs:" << stats.get_run_count()
+     << "][run_time:" << stats.get_run_time() << "][max_run_time:" << stats.get_max_run_time() << ']';
+  if (stats.get_delayed_event_count() != 0) {
+    sb << "[mailbox_delay_us p50:" << stats.get_mailbox_delay_quantile(0.5)
+       << " p99:" << stats.get_mailbox_delay_quantile(0.99) << ']';
+  }
+  return sb;
+}
+
+}  // namespace td
@@ -6,6 +6,8 @@
 //
 #pragma once
 
+#include "td/actor/impl/ActorStats.h"
+
 #include "td/utils/Closure.h"
 #include "td/utils/common.h"
 #include "td/utils/logging.h"
@@ -39,6 +41,11 @@ template <class T>
 std::enable_if_t<!std::is_base_of<Actor, T>::value> finish_migrate(T &obj) {
 }
 
+// Priority of an event in the mailbox of an actor
+// Events with higher priority can overtake events with lower priority, but each priority class still gets
+// a fixed share of the processed events. Events with the same priority are always processed in order.
+enum class EventPriority : uint8 { Interactive, Normal, Background };
+
 class CustomEvent {
  public:
   CustomEvent() = default;
@@ -109,6 +116,7 @@ class Event {
  public:
   enum class Type { NoType, Start, Stop, Yield, Timeout, Hangup, Raw, Custom };
   Type type;
+  EventPriority priority = EventPriority::Normal;
   uint64 link_token = 0;
   union Raw {
     void *ptr;
@@ -116,6 +124,9 @@ class Event {
     uint32 u32;
     uint64 u64;
   } data{};
+#if TD_ACTOR_STATS
+  double enqueue_time = 0.0;
+#endif
 
   // factory functions
   static Event start() {
@@ -166,14 +177,22 @@ class Event {
   }
   Event(const Event &other) = delete;
   Event &operator=(const Event &) = delete;
-  Event(Event &&other) noexcept : type(other.type), link_token(other.link_token), data(other.data) {
+  Event(Event &&other) noexcept
+      : type(other.type), priority(other.priority), link_token(other.link_token), data(other.data) {
+#if TD_ACTOR_STATS
+    enqueue_time = other.enqueue_time;
+#endif
     other.type = Type::NoType;
   }
   Event &operator=(Event &&other) noexcept {
     destroy();
     type = other.type;
+    priority = other.priority;
     link_token = other.link_token;
     data = other.data;
+#if TD_ACTOR_STATS
+    enqueue_time = other.enqueue_time;
+#endif
     other.type = Type::NoType;
     return *this;
   }
@@ -184,6 +203,7 @@ class Event {
   Event clone() const {
     Event res;
     res.type = type;
+    res.priority = priority;
     if (type == Type::Custom) {
       res.data.custom_event = data.custom_event->clone();
     } else {
@@ -206,6 +226,11 @@ class Event {
     return *this;
   }
 
+  Event &set_priority(EventPriority new_priority) {
+    priority = new_priority;
+    return *this;
+  }
+
   friend void start_migrate(Event &obj, int32 sched_id) {
     if (obj.type == Type::Custom) {
       obj.data.custom_event->start_migrate(sched_id);
@@ -0,0 +1,89 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2022
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#pragma once
+
+#include "td/utils/common.h"
+#include "td/utils/Slice.h"
+#include "td/utils/StringBuilder.h"
+
+#include <array>
+#include <cstring>
+
+#ifndef TD_ACTOR_TRACE
+#define TD_ACTOR_TRACE 0
+#endif
+
+namespace td {
+
+// ring buffer with the last events processed by a scheduler, which is filled only if TD_ACTOR_TRACE is enabled
+// must be accessed only from the thread of the scheduler
+class EventTrace {
+ public:
+  static constexpr size_t MAX_RECORD_COUNT = 1 << 14;
+  static constexpr size_t MAX_NAME_LENGTH = 31;
+
+  // returns identifier of the record, which must be passed to finish_record
+  size_t start_record(Slice actor_name, Slice event_type, double start_time) {
+    if (records_.empty()) {
+      records_.resize(MAX_RECORD_COUNT);
+    }
+    auto record_id = next_record_id_++;
+    auto &record = records_[record_id % MAX_RECORD_COUNT];
+    auto name_length = min(actor_name.size(), MAX_NAME_LENGTH);
+    std::memcpy(record.actor_name.data(), actor_name.data(), name_length);
+    record.actor_name[name_length] = '\0';
+    record.event_type = event_type;
+    record.start_time = start_time;
+    record.duration = 0.0;
+    return record_id;
+  }
+
+  void finish_record(size_t record_id, double finish_time) {
+    if (record_id + MAX_RECORD_COUNT < next_record_id_) {
+      // the record has already been overwritten
+      return;
+    }
+    auto &record = records_[record_id % MAX_RECORD_COUNT];
+    record.duration = finish_time - record.start_time;
+  }
+
+  // appends the recorded events in Chrome trace event format to a JSON array; thread_id is used as "tid"
+  void store_chrome_trace_events(StringBuilder &sb, int32 thread_id, bool &is_first) const {
+    auto record_count = min(next_record_id_, MAX_RECORD_COUNT);
+    for (auto record_id = next_record_id_ - record_count; record_id < next_record_id_; record_id++) {
+      const auto &record = records_[record_id % MAX_RECORD_COUNT];
+      if (!is_first) {
+        sb << ',';
+      }
+      is_first = false;
+      sb << "{\"name\":\"";
+      for (const char *c = record.actor_name.data(); *c != '\0'; c++) {
+        auto code = static_cast<unsigned char>(*c);
+        if (code < 0x20 || code >= 0x7F || *c == '"' || *c == '\\') {
+          sb << '?';
+        } else {
+          sb << *c;
+        }
+      }
+      sb << "\",\"cat\":\"" << record.event_type << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << thread_id
+         << ",\"ts\":" << static_cast<int64>(record.start_time * 1e6)
+         << ",\"dur\":" << static_cast<int64>(record.duration * 1e6) << '}';
+    }
+  }
+
+ private:
+  struct Record {
+    std::array<char, MAX_NAME_LENGTH + 1> actor_name;
+    Slice event_type;
+    double start_time;
+    double duration;
+  };
+  vector<Record> records_;
+  size_t next_record_id_ = 0;
+};
+
+}  // namespace td
@@ -9,6 +9,7 @@
 #include "td/actor/impl/Actor-decl.h"
 #include "td/actor/impl/ActorId-decl.h"
 #include "td/actor/impl/EventFull-decl.h"
+#include "td/actor/impl/EventTrace.h"
 
 #include "td/utils/Closure.h"
 #include "td/utils/Heap.h"
@@ -22,18 +23,24 @@
 #include "td/utils/port/PollFlags.h"
 #include "td/utils/port/thread_local.h"
 #include "td/utils/Slice.h"
+#include "td/utils/StealingQueue.h"
 #include "td/utils/Time.h"
+#include "td/utils/TimingWheel.h"
 #include "td/utils/type_traits.h"
 
+#include <array>
+#include <atomic>
 #include <functional>
 #include <memory>
 #include <type_traits>
-#include <unordered_map>
 #include <utility>
 
 namespace td {
 
 extern int VERBOSITY_NAME(actor);
+#if TD_ACTOR_STATS
+extern int VERBOSITY_NAME(actor_stats);
+#endif
 
 class ActorInfo;
 
@@ -69,6 +76,16 @@ class Scheduler {
     virtual void on_finish() = 0;
     virtual void register_at_finish(std::function<void()>) = 0;
   };
+
+  // shared between all schedulers, which can steal actors from each other
+  struct WorkStealingState {
+    struct SchedulerState {
+      StealingQueue<ActorInfo *> ready_actors;
+      std::atomic<bool> is_idle{false};
+    };
+    vector<unique_ptr<SchedulerState>> schedulers;
+  };
+
   Scheduler() = default;
   Scheduler(const Scheduler &) = delete;
   Scheduler &operator=(const Scheduler &) = delete;
@@ -80,6 +97,11 @@ class Scheduler {
   void init(int32 id, std::vector<std::shared_ptr<MpscPollableQueue<EventFull>>> outbound, Callback *callback);
   void clear();
 
+  void enable_work_stealing(std::shared_ptr<WorkStealingState> work_stealing_state);
+  void enable_outbound_event_batching();
+  void enable_spin_poll(double max_spin_time, double cpu_share);
+  void set_max_mailbox_flush_size(size_t max_mailbox_flush_size);
+
   int32 sched_id() const;
   int32 sched_count() const;
 
@@ -107,6 +129,10 @@ class Scheduler {
   template <ActorSendType send_type>
   void send(ActorRef actor_ref, Event &&event);
 
+  // default priority of events, which are sent from the scheduler's thread
+  EventPriority get_send_priority() const;
+  void set_send_priority(EventPriority priority);
+
   void before_tail_send(const ActorId<> &actor_id);
 
   static void subscribe(PollableFd fd, PollFlags flags = PollFlags::ReadWrite());
@@ -135,6 +161,7 @@ class Scheduler {
   void wakeup();
 
   static Scheduler *instance();
+  ActorId<> get_current_actor_id();
   static ActorContext *&context();
   static void on_context_updated();
 
@@ -143,6 +170,12 @@ class Scheduler {
 
   Timestamp get_timeout();
 
+#if TD_ACTOR_TRACE
+  // returns the last events processed by the scheduler as a JSON object in Chrome trace event format,
+  // which can be opened in chrome://tracing or Perfetto
+  string get_event_trace() const;
+#endif
+
  private:
   static void set_scheduler(Scheduler *scheduler);
 
@@ -179,21 +212,39 @@ class Scheduler {
   void cancel_actor_timeout(ActorInfo *actor_info);
 
   void register_migrated_actor(ActorInfo *actor_info);
+
+  void offer_actors_for_stealing();
+  void steal_actors();
+  void request_stolen_actor(ActorInfo *actor_info);
+  void on_steal_request(ActorInfo *actor_info, int32 thief_sched_id);
+
   void add_to_mailbox(ActorInfo *actor_info, Event &&event);
   void clear_mailbox(ActorInfo *actor_info);
 
+  void sort_mailbox_by_priority(vector<Event> &mailbox, size_t mailbox_size);
+
   template <class RunFuncT, class EventFuncT>
   void flush_mailbox(ActorInfo *actor_info, const RunFuncT &run_func, const EventFuncT &event_func);
 
   template <ActorSendType send_type, class RunFuncT, class EventFuncT>
   void send_impl(const ActorId<> &actor_id, const RunFuncT &run_func, const EventFuncT &event_func);
 
+  void flush_outbound_events();
+
+  void add_pending_event(ActorInfo *actor_info, Event &&event);
+
+#if TD_ACTOR_STATS
+  static void stamp_enqueue_time(Event &event);
+  void dump_actor_stats();
+#endif
+
   void inc_wait_generation();
 
   Timestamp run_timeout();
   void run_mailbox();
   Timestamp run_events(Timestamp timeout);
   void run_poll(Timestamp timeout);
+  bool spin_poll(Timestamp timeout);
 
   template <class ActorT>
   ActorOwn<ActorT> register_actor_impl(Slice name, ActorT *actor_ptr, Actor::Deleter deleter, int32 sched_id);
@@ -208,9 +259,20 @@ class Scheduler {
   int32 actor_count_ = 0;
   ListNode pending_actors_list_;
   ListNode ready_actors_list_;
+#if TD_ACTOR_TIMING_WHEEL
+  TimingWheel timeout_queue_;
+#else
   KHeap<double> timeout_queue_;
+#endif
+
+  // all allocated pending event nodes; unused nodes are linked through next in free_pending_events_
+  std::vector<unique_ptr<ActorPendingEvent>> pending_event_pool_;
+  ActorPendingEvent *free_pending_events_ = nullptr;
+  size_t pending_event_count_ = 0;
 
-  std::unordered_map<ActorInfo *, std::vector<Event>> pending_events_;
+  static constexpr size_t EVENT_PRIORITY_COUNT = 3;
+  EventPriority send_priority_ = EventPriority::Normal;
+  std::array<std::vector<Event>, EVENT_PRIORITY_COUNT> mailbox_lanes_;
 
   ServiceActor service_actor_;
   Poll poll_;
@@ -225,8 +287,24 @@ class Scheduler {
   std::shared_ptr<MpscPollableQueue<EventFull>> inbound_queue_;
   std::vector<std::shared_ptr<MpscPollableQueue<EventFull>>> outbound_queues_;
 
+  bool batch_outbound_events_ = false;
+  bool is_batching_outbound_events_ = false;
+
+  size_t max_mailbox_flush_size_ = 0;
+
+  double max_spin_poll_time_ = 0.0;
+  double spin_poll_cpu_share_ = 0.0;
+  double spin_poll_time_ = 0.0;
+  double spin_poll_period_end_time_ = 0.0;
+  double spin_poll_period_spent_time_ = 0.0;
+  std::vector<std::vector<EventFull>> outbound_batches_;
+  std::vector<int32> outbound_batch_sched_ids_;
+
   std::shared_ptr<ActorContext> save_context_;
 
+  std::shared_ptr<WorkStealingState> work_stealing_state_;
+  bool has_offered_actors_ = false;
+
   struct EventContext {
     int32 dest_sched_id{0};
     enum Flags { Stop = 1, Migrate = 2 };
@@ -237,11 +315,34 @@ class Scheduler {
   };
   EventContext *event_context_ptr_{nullptr};
 
+#if TD_ACTOR_STATS
+  double next_actor_stats_dump_time_ = 0.0;
+#endif
+
+#if TD_ACTOR_TRACE
+  EventTrace event_trace_;
+#endif
+
   friend class GlobalScheduler;
   friend class SchedulerGuard;
   friend class EventGuard;
 };
 
+// sets default priority of all events sent from the current thread while the guard is alive
+class EventPriorityGuard {
+ public:
+  explicit EventPriorityGuard(EventPriority priority);
+  ~EventPriorityGuard();
+  EventPriorityGuard(const EventPriorityGuard &other) = delete;
+  EventPriorityGuard &operator=(const EventPriorityGuard &other) = delete;
+  EventPriorityGuard(EventPriorityGuard &&other) = delete;
+  EventPriorityGuard &operator=(EventPriorityGuard &&other) = delete;
+
+ private:
+  Scheduler *scheduler_;
+  EventPriority save_priority_;
+};
+
 /*** Interface to current scheduler ***/
 template <class ActorT, class... Args>
 TD_WARN_UNUSED_RESULT ActorOwn<ActorT> create_actor(Slice name, Args &&...args);
@@ -22,16 +22,21 @@
 #include "td/utils/ObjectPool.h"
 #include "td/utils/port/thread_local.h"
 #include "td/utils/ScopeGuard.h"
+#include "td/utils/ThreadSafeCounter.h"
 #include "td/utils/Time.h"
 
+#include <algorithm>
 #include <functional>
-#include <iterator>
 #include <memory>
+#include <tuple>
 #include <utility>
 
 namespace td {
 
 int VERBOSITY_NAME(actor) = VERBOSITY_NAME(DEBUG) + 10;
+#if TD_ACTOR_STATS
+int VERBOSITY_NAME(actor_stats) = VERBOSITY_NAME(WARNING);
+#endif
 
 TD_THREAD_LOCAL Scheduler *Scheduler::scheduler_;   // static zero-initialized
 TD_THREAD_LOCAL ActorContext *Scheduler::context_;  // static zero-initialized
@@ -67,7 +72,7 @@ void Scheduler::ServiceActor::start_up() {
   if (!inbound_) {
     return;
   }
-#if !TD_PORT_WINDOWS
+#if !TD_PORT_WINDOWS && !TD_EVENTFD_EMSCRIPTEN
   auto &fd = inbound_->reader_get_event_fd();
   Scheduler::subscribe(fd.get_poll_info().extract_pollable_fd(this), PollFlags::Read());
   subscribed_ = true;
@@ -82,11 +87,17 @@ void Scheduler::ServiceActor::loop() {
   if (ready_n == 0) {
     return;
   }
+  // events from other threads must be handled with time not less than the time of their sending
+  Time::update_cached_now();
   while (ready_n-- > 0) {
     EventFull event = queue->reader_get_unsafe();
     if (event.actor_id().empty()) {
       if (event.data().empty()) {
         yield_scheduler();
+      } else if (event.data().link_token != 0) {
+        // an idle scheduler asks to give it an actor, which was offered for stealing
+        Scheduler::instance()->on_steal_request(static_cast<ActorInfo *>(event.data().data.ptr),
+                                                narrow_cast<int32>(event.data().link_token - 1));
       } else {
         Scheduler::instance()->register_migrated_actor(static_cast<ActorInfo *>(event.data().data.ptr));
       }
@@ -146,6 +157,17 @@ SchedulerGuard::~SchedulerGuard() {
   }
 }
 
+/*** EventPriorityGuard ***/
+EventPriorityGuard::EventPriorityGuard(EventPriority priority) : scheduler_(Scheduler::instance()) {
+  CHECK(scheduler_ != nullptr);
+  save_priority_ = scheduler_->get_send_priority();
+  scheduler_->set_send_priority(priority);
+}
+
+EventPriorityGuard::~EventPriorityGuard() {
+  scheduler_->set_send_priority(save_priority_);
+}
+
 /*** EventGuard ***/
 EventGuard::EventGuard(Scheduler *scheduler, ActorInfo *actor_info) : scheduler_(scheduler) {
   actor_info->start_run();
@@ -157,10 +179,16 @@ EventGuard::EventGuard(Scheduler *scheduler, ActorInfo *actor_info) : scheduler_
   save_log_tag2_ = actor_info->get_name().c_str();
 #endif
   swap_context(actor_info);
+#if TD_ACTOR_STATS
+  start_time_ = Time::now();
+#endif
 }
 
 EventGuard::~EventGuard() {
   auto info = event_context_.actor_info;
+#if TD_ACTOR_STATS
+  info->stats_.on_run(Time::now() - start_time_);
+#endif
   auto node = info->get_list_node();
   node->remove();
   if (info->mailbox_.empty()) {
@@ -230,6 +258,28 @@ void Scheduler::init(int32 id, std::vector<std::shared_ptr<MpscPollableQueue<Eve
   register_actor("ServiceActor", &service_actor_).release();
 }
 
+void Scheduler::enable_work_stealing(std::shared_ptr<WorkStealingState> work_stealing_state) {
+  CHECK(work_stealing_state != nullptr);
+  CHECK(0 <= sched_id_ && sched_id_ < static_cast<int32>(work_stealing_state->schedulers.size()));
+  work_stealing_state_ = std::move(work_stealing_state);
+}
+
+void Scheduler::enable_outbound_event_batching() {
+  batch_outbound_events_ = true;
+  outbound_batches_.resize(outbound_queues_.size());
+}
+
+void Scheduler::enable_spin_poll(double max_spin_time, double cpu_share) {
+  CHECK(max_spin_time >= 0);
+  max_spin_poll_time_ = max_spin_time;
+  spin_poll_cpu_share_ = clamp(cpu_share, 0.0, 1.0);
+  spin_poll_time_ = max_spin_time;
+}
+
+void Scheduler::set_max_mailbox_flush_size(size_t max_mailbox_flush_size) {
+  max_mailbox_flush_size_ = max_mailbox_flush_size;
+}
+
 void Scheduler::clear() {
   if (service_actor_.empty()) {
     return;
@@ -260,10 +310,54 @@ void Scheduler::clear() {
   }
 }
 
+#if TD_ACTOR_TRACE
+static Slice get_event_type_name(Event::Type type) {
+  switch (type) {
+    case Event::Type::Start:
+      return Slice("start");
+    case Event::Type::Stop:
+      return Slice("stop");
+    case Event::Type::Yield:
+      return Slice("yield");
+    case Event::Type::Hangup:
+      return Slice("hangup");
+    case Event::Type::Timeout:
+      return Slice("timeout");
+    case Event::Type::Raw:
+      return Slice("raw");
+    case Event::Type::Custom:
+      return Slice("custom");
+    case Event::Type::NoType:
+    default:
+      return Slice("none");
+  }
+}
+
+string Scheduler::get_event_trace() const {
+  StringBuilder sb(MutableSlice(), true);
+  sb << "{\"traceEvents\":[";
+  bool is_first = true;
+  event_trace_.store_chrome_trace_events(sb, sched_id_, is_first);
+  sb << "]}";
+  return sb.as_cslice().str();
+}
+#endif
+
 void Scheduler::do_event(ActorInfo *actor_info, Event &&event) {
+  static auto event_counter = NamedThreadSafeCounter::get_default().get_counter("actor_events");
+  event_counter.add(1);
+
   event_context_ptr_->link_token = event.link_token;
   auto actor = actor_info->get_actor_unsafe();
   VLOG(actor) << *actor_info << ' ' << event;
+#if TD_ACTOR_TRACE
+  // the actor can be destroyed by the event, so its name must be saved beforehand
+  auto trace_record_id =
+      event_trace_.start_record(actor_info->get_name(), get_event_type_name(event.type), Time::now());
+  SCOPE_EXIT {
+    event_trace_.finish_record(trace_record_id, Time::now());
+  };
+#endif
   switch (event.type) {
     case Event::Type::Start:
       actor->start_up();
@@ -310,11 +404,14 @@ void Scheduler::register_migrated_actor(ActorInfo *actor_info) {
   for (auto &event : actor_info->mailbox_) {
     finish_migrate(event);
   }
-  auto it = pending_events_.find(actor_info);
-  if (it != pending_events_.end()) {
-    actor_info->mailbox_.insert(actor_info->mailbox_.end(), std::make_move_iterator(it->second.begin()),
-                                std::make_move_iterator(it->second.end()));
-    pending_events_.erase(it);
+  auto pending_event = actor_info->extract_pending_events();
+  while (pending_event != nullptr) {
+    actor_info->mailbox_.push_back(std::move(pending_event->event));
+    auto next = pending_event->next;
+    pending_event->next = free_pending_events_;
+    free_pending_events_ = pending_event;
+    pending_event_count_--;
+    pending_event = next;
   }
   if (actor_info->mailbox_.empty()) {
     pending_actors_list_.put(actor_info->get_list_node());
@@ -324,6 +421,114 @@ void Scheduler::register_migrated_actor(ActorInfo *actor_info) {
   actor_info->get_actor_unsafe()->on_finish_migrate();
 }
 
+void Scheduler::add_pending_event(ActorInfo *actor_info, Event &&event) {
+  auto pending_event = free_pending_events_;
+  if (pending_event == nullptr) {
+    pending_event_pool_.push_back(make_unique<ActorPendingEvent>());
+    pending_event = pending_event_pool_.back().get();
+  } else {
+    free_pending_events_ = pending_event->next;
+    pending_event->next = nullptr;
+  }
+  pending_event->event = std::move(event);
+  pending_event_count_++;
+  actor_info->add_pending_event(pending_event);
+}
+
+void Scheduler::offer_actors_for_stealing() {
+  if (has_offered_actors_) {
+    // steal requests must be handled even if the scheduler has no time to poll
+    yield_actor(&service_actor_);
+  }
+
+  auto &schedulers = work_stealing_state_->schedulers;
+  auto sched_n = static_cast<int32>(schedulers.size());
+  int32 idle_sched_id = -1;
+  for (int32 i = 1; i < sched_n; i++) {
+    auto sched_id = (sched_id_ + i) % sched_n;
+    if (schedulers[sched_id]->is_idle.load(std::memory_order_relaxed)) {
+      idle_sched_id = sched_id;
+      break;
+    }
+  }
+  if (idle_sched_id == -1) {
+    return;
+  }
+
+  constexpr size_t MAX_OFFERED_ACTORS = 16;
+  auto &ready_actors = schedulers[sched_id_]->ready_actors;
+  size_t offered_actor_count = 0;
+  ListNode *end = &ready_actors_list_;
+  // the first ready actor is always left to the current scheduler
+  for (ListNode *it = end->next->next; it != end; it = it->next) {
+    auto actor_info = ActorInfo::from_list_node(it);
+    if (!actor_info->can_be_stolen() || actor_info->has_timeout()) {
+      continue;
+    }
+    // outdated offers can be safely dropped
+    ready_actors.local_push(actor_info, [](ActorInfo *) {});
+    if (++offered_actor_count == MAX_OFFERED_ACTORS) {
+      break;
+    }
+  }
+  if (offered_actor_count == 0) {
+    return;
+  }
+
+  VLOG(actor) << "Offer " << offered_actor_count << " actors for stealing to scheduler " << idle_sched_id;
+  has_offered_actors_ = true;
+  if (schedulers[idle_sched_id]->is_idle.exchange(false)) {
+    outbound_queues_[idle_sched_id]->writer_put({});
+  }
+}
+
+void Scheduler::steal_actors() {
+  auto &schedulers = work_stealing_state_->schedulers;
+  auto sched_n = static_cast<int32>(schedulers.size());
+  auto &ready_actors = schedulers[sched_id_]->ready_actors;
+  ActorInfo *actor_info = nullptr;
+  for (int32 i = 1; i < sched_n; i++) {
+    if (ready_actors.steal(actor_info, schedulers[(sched_id_ + i) % sched_n]->ready_actors)) {
+      request_stolen_actor(actor_info);
+      break;
+    }
+  }
+  // the rest of the queue consists of other stolen actors and of outdated offers of the current scheduler
+  while (ready_actors.local_pop(actor_info)) {
+    request_stolen_actor(actor_info);
+  }
+  has_offered_actors_ = false;
+}
+
+void Scheduler::request_stolen_actor(ActorInfo *actor_info) {
+  int32 owner_sched_id;
+  bool is_migrating;
+  std::tie(owner_sched_id, is_migrating) = actor_info->migrate_dest_flag_atomic();
+  if (is_migrating || owner_sched_id == sched_id_ ||
+      owner_sched_id >= static_cast<int32>(work_stealing_state_->schedulers.size())) {
+    // the offer is outdated
+    return;
+  }
+
+  // only the owner can migrate the actor, so ask it to do that
+  auto event = Event::raw(static_cast<void *>(actor_info));
+  event.set_link_token(static_cast<uint64>(sched_id_) + 1);
+  outbound_queues_[owner_sched_id]->writer_put(EventCreator::event_unsafe(ActorId<>(), std::move(event)));
+}
+
+void Scheduler::on_steal_request(ActorInfo *actor_info, int32 thief_sched_id) {
+  if (actor_info->migrate_dest_flag_atomic() != std::make_pair(sched_id_, false)) {
+    // the actor was destroyed or has already been migrated to another scheduler
+    return;
+  }
+  if (actor_info->empty() || !actor_info->can_be_stolen() || actor_info->is_running() ||
+      actor_info->mailbox_.empty() || actor_info->has_timeout()) {
+    return;
+  }
+  VLOG(actor) << "Give " << *actor_info << " to scheduler " << thief_sched_id;
+  do_migrate_actor(actor_info, thief_sched_id);
+}
+
 void Scheduler::send_to_other_scheduler(int32 sched_id, const ActorId<> &actor_id, Event &&event) {
   if (sched_id < sched_count()) {
     auto actor_info = actor_id.get_actor_info();
@@ -333,11 +538,34 @@ void Scheduler::send_to_other_scheduler(int32 sched_id, const ActorId<> &actor_i
       VLOG(actor) << "Send to scheduler " << sched_id << ": " << event;
     }
     start_migrate(event, sched_id);
+#if TD_ACTOR_STATS
+    stamp_enqueue_time(event);
+#endif
+    if (is_batching_outbound_events_) {
+      auto &batch = outbound_batches_[sched_id];
+      if (batch.empty()) {
+        outbound_batch_sched_ids_.push_back(sched_id);
+      }
+      batch.push_back(EventCreator::event_unsafe(actor_id, std::move(event)));
+      constexpr size_t MAX_OUTBOUND_BATCH_SIZE = 256;
+      if (batch.size() >= MAX_OUTBOUND_BATCH_SIZE) {
+        outbound_queues_[sched_id]->writer_put_batch(batch);
+      }
+      return;
+    }
     outbound_queues_[sched_id]->writer_put(EventCreator::event_unsafe(actor_id, std::move(event)));
     outbound_queues_[sched_id]->writer_flush();
   }
 }
 
+void Scheduler::flush_outbound_events() {
+  for (auto sched_id : outbound_batch_sched_ids_) {
+    outbound_queues_[sched_id]->writer_put_batch(outbound_batches_[sched_id]);
+    outbound_queues_[sched_id]->writer_flush();
+  }
+  outbound_batch_sched_ids_.clear();
+}
+
 void Scheduler::add_to_mailbox(ActorInfo *actor_info, Event &&event) {
   if (!actor_info->is_running()) {
     auto node = actor_info->get_list_node();
@@ -345,9 +573,50 @@ void Scheduler::add_to_mailbox(ActorInfo *actor_info, Event &&event) {
     ready_actors_list_.put(node);
   }
   VLOG(actor) << "Add to mailbox: " << *actor_info << " " << event;
+#if TD_ACTOR_STATS
+  stamp_enqueue_time(event);
+#endif
   actor_info->mailbox_.push_back(std::move(event));
 }
 
+void Scheduler::sort_mailbox_by_priority(vector<Event> &mailbox, size_t mailbox_size) {
+  CHECK(mailbox_size <= mailbox.size());
+  bool has_priorities = false;
+  for (size_t i = 0; i < mailbox_size; i++) {
+    if (mailbox[i].priority != EventPriority::Normal) {
+      has_priorities = true;
+      break;
+    }
+  }
+  if (!has_priorities) {
+    return;
+  }
+
+  for (size_t i = 0; i < mailbox_size; i++) {
+    auto priority = static_cast<size_t>(mailbox[i].priority);
+    CHECK(priority < EVENT_PRIORITY_COUNT);
+    mailbox_lanes_[priority].push_back(std::move(mailbox[i]));
+  }
+
+  // weighted round-robin between the priorities; events of lower priorities can't be starved,
+  // because they receive a fixed share of all processed events
+  static constexpr size_t max_consecutive_events[EVENT_PRIORITY_COUNT] = {8, 4, 1};
+  size_t lane_pos[EVENT_PRIORITY_COUNT] = {};
+  size_t i = 0;
+  while (i < mailbox_size) {
+    for (size_t priority = 0; priority < EVENT_PRIORITY_COUNT; priority++) {
+      auto &lane = mailbox_lanes_[priority];
+      auto &pos = lane_pos[priority];
+      for (size_t left = max_consecutive_events[priority]; left > 0 && pos < lane.size(); left--) {
+        mailbox[i++] = std::move(lane[pos++]);
+      }
+    }
+  }
+  for (auto &lane : mailbox_lanes_) {
+    lane.clear();
+  }
+}
+
 void Scheduler::do_stop_actor(Actor *actor) {
   return do_stop_actor(actor->get_info());
 }
@@ -414,8 +683,7 @@ void Scheduler::start_migrate_actor(ActorInfo *actor_info, int32 dest_sched_id)
 }
 
 double Scheduler::get_actor_timeout(const ActorInfo *actor_info) const {
-  const HeapNode *heap_node = actor_info->get_heap_node();
-  return heap_node->in_heap() ? timeout_queue_.get_key(heap_node) - Time::now() : 0.0;
+  return actor_info->has_timeout() ? timeout_queue_.get_key(actor_info->get_timeout_node()) - Time::now() : 0.0;
 }
 
 void Scheduler::set_actor_timeout_in(ActorInfo *actor_info, double timeout) {
@@ -430,35 +698,91 @@ void Scheduler::set_actor_timeout_in(ActorInfo *actor_info, double timeout) {
 }
 
 void Scheduler::set_actor_timeout_at(ActorInfo *actor_info, double timeout_at) {
-  HeapNode *heap_node = actor_info->get_heap_node();
+  ActorTimeoutNode *timeout_node = actor_info->get_timeout_node();
   VLOG(actor) << "Set actor " << *actor_info << " timeout in " << timeout_at - Time::now_cached();
-  if (heap_node->in_heap()) {
-    timeout_queue_.fix(timeout_at, heap_node);
+  if (actor_info->has_timeout()) {
+    timeout_queue_.fix(timeout_at, timeout_node);
+  } else {
+    timeout_queue_.insert(timeout_at, timeout_node);
+  }
+}
+
+// returns true if new events can be received from other schedulers without waiting
+bool Scheduler::spin_poll(Timestamp timeout) {
+  constexpr double SPIN_POLL_PERIOD = 1.0;
+  constexpr double MIN_SPIN_POLL_TIME = 1e-6;
+
+  auto start_time = Time::now();
+  if (start_time >= spin_poll_period_end_time_) {
+    spin_poll_period_end_time_ = start_time + SPIN_POLL_PERIOD;
+    spin_poll_period_spent_time_ = 0.0;
+  }
+  auto spin_time = td::min(spin_poll_time_, spin_poll_cpu_share_ * SPIN_POLL_PERIOD - spin_poll_period_spent_time_);
+  auto end_time = td::min(start_time + spin_time, timeout.at());
+  if (end_time <= start_time) {
+    return false;
+  }
+
+  bool has_events = false;
+  auto now = start_time;
+  do {
+    if (inbound_queue_->reader_has_values()) {
+      has_events = true;
+      break;
+    }
+    now = Time::now();
+  } while (now < end_time);
+  spin_poll_period_spent_time_ += now - start_time;
+
+  // spin longer while events keep arriving soon enough, and back off when spinning is useless
+  if (has_events) {
+    spin_poll_time_ = td::min(max_spin_poll_time_, td::max(spin_poll_time_, MIN_SPIN_POLL_TIME) * 2);
   } else {
-    timeout_queue_.insert(timeout_at, heap_node);
+    spin_poll_time_ = td::max(spin_poll_time_ * 0.5, MIN_SPIN_POLL_TIME);
   }
+  return has_events;
 }
 
 void Scheduler::run_poll(Timestamp timeout) {
-  // we can't wait for less than 1ms
-  auto timeout_ms = static_cast<int>(clamp(timeout.in(), 0.0, 1000000.0) * 1000 + 1);
+  auto timeout_in = clamp(timeout.in(), 0.0, 1000000.0);
+  if (max_spin_poll_time_ > 0 && inbound_queue_ != nullptr && spin_poll(timeout)) {
+    timeout_in = 0.0;
+  }
 #if TD_PORT_WINDOWS
   CHECK(inbound_queue_);
-  inbound_queue_->reader_get_event_fd().wait(timeout_ms);
+  // we can't wait for less than 1ms
+  inbound_queue_->reader_get_event_fd().wait(timeout_in <= 0.0 ? 0 : static_cast<int>(timeout_in * 1000 + 1));
+  service_actor_.notify();
+#elif TD_EVENTFD_EMSCRIPTEN
+  CHECK(inbound_queue_);
+  // poll doesn't block in a browser, so the main scheduler just checks sockets and is woken up from JavaScript,
+  // while schedulers in Web Workers wait for events from other schedulers and check their sockets periodically
+  constexpr double WORKER_SOCKET_CHECK_PERIOD = 0.01;
+  poll_.run(0);
+  if (sched_id_ == 0) {
+    timeout_in = 0.0;
+  } else if (!poll_.empty()) {
+    timeout_in = min(timeout_in, WORKER_SOCKET_CHECK_PERIOD);
+  }
+  inbound_queue_->reader_get_event_fd().wait(timeout_in <= 0.0 ? 0 : static_cast<int>(timeout_in * 1000 + 1));
   service_actor_.notify();
 #elif TD_PORT_POSIX
-  poll_.run(timeout_ms);
+  poll_.run_precise(timeout_in);
 #endif
 }
 
 void Scheduler::run_mailbox() {
   VLOG(actor) << "Run mailbox : begin";
+  if (work_stealing_state_ != nullptr && !ready_actors_list_.empty()) {
+    offer_actors_for_stealing();
+  }
   ListNode actors_list = std::move(ready_actors_list_);
   while (!actors_list.empty()) {
     ListNode *node = actors_list.get();
     CHECK(node);
     auto actor_info = ActorInfo::from_list_node(node);
     inc_wait_generation();
+    Time::update_cached_now();
     flush_mailbox(actor_info, static_cast<void (*)(ActorInfo *)>(nullptr), static_cast<Event (*)()>(nullptr));
   }
   VLOG(actor) << "Run mailbox : finish " << actor_count_;
@@ -482,11 +806,17 @@ void Scheduler::run_mailbox() {
 }
 
 Timestamp Scheduler::run_timeout() {
-  double now = Time::now();
+  // timeout handlers are run immediately and must see that their timeout has expired
+  Time::update_cached_now();
+  double now = Time::now_cached();
+#if TD_ACTOR_TIMING_WHEEL
+  while (auto *node = timeout_queue_.pop_expired(now)) {
+#else
   //TODO: use Timestamp().is_in_past()
   while (!timeout_queue_.empty() && timeout_queue_.top_key() < now) {
     HeapNode *node = timeout_queue_.pop();
-    ActorInfo *actor_info = ActorInfo::from_heap_node(node);
+#endif
+    ActorInfo *actor_info = ActorInfo::from_timeout_node(node);
     inc_wait_generation();
     send<ActorSendType::Immediate>(actor_info->actor_id(), Event::timeout());
   }
@@ -495,17 +825,56 @@ Timestamp Scheduler::run_timeout() {
 
 Timestamp Scheduler::run_events(Timestamp timeout) {
   Timestamp res;
-  VLOG(actor) << "Run events " << sched_id_ << " " << tag("pending", pending_events_.size())
+  VLOG(actor) << "Run events " << sched_id_ << " " << tag("pending", pending_event_count_)
               << tag("actors", actor_count_);
+  is_batching_outbound_events_ = batch_outbound_events_;
   do {
     run_mailbox();
     res = run_timeout();
+    flush_outbound_events();
   } while (!ready_actors_list_.empty() && !timeout.is_in_past());
+  is_batching_outbound_events_ = false;
+#if TD_ACTOR_STATS
+  if (Time::now() >= next_actor_stats_dump_time_) {
+    dump_actor_stats();
+  }
+#endif
   return res;
 }
 
+#if TD_ACTOR_STATS
+void Scheduler::dump_actor_stats() {
+  constexpr double ACTOR_STATS_DUMP_PERIOD = 60.0;
+  constexpr size_t MAX_DUMPED_ACTORS = 20;
+  bool is_first_dump = next_actor_stats_dump_time_ == 0.0;
+  next_actor_stats_dump_time_ = Time::now() + ACTOR_STATS_DUMP_PERIOD;
+  if (is_first_dump) {
+    return;
+  }
+
+  vector<const ActorInfo *> actor_infos;
+  for (auto *list : {&pending_actors_list_, &ready_actors_list_}) {
+    for (ListNode *end = list, *it = list->next; it != end; it = it->next) {
+      actor_infos.push_back(ActorInfo::from_list_node(it));
+    }
+  }
+  auto dumped_actor_count = td::min(actor_infos.size(), MAX_DUMPED_ACTORS);
+  std::partial_sort(actor_infos.begin(), actor_infos.begin() + dumped_actor_count, actor_infos.end(),
+                    [](const ActorInfo *lhs, const ActorInfo *rhs) {
+                      return lhs->stats_.get_run_time() > rhs->stats_.get_run_time();
+                    });
+
+  VLOG(actor_stats) << "Scheduler " << sched_id_ << " has " << actor_infos.size() << " actors";
+  for (size_t i = 0; i < dumped_actor_count; i++) {
+    VLOG(actor_stats) << "Actor " << actor_infos[i]->get_name() << ": " << actor_infos[i]->stats_
+                      << "[mailbox:" << actor_infos[i]->mailbox_.size() << ']';
+  }
+}
+#endif
+
 void Scheduler::run_no_guard(Timestamp timeout) {
   CHECK(has_guard_);
+  Time::CachedNowGuard cached_now_guard;
   SCOPE_EXIT {
     yield_flag_ = false;
   };
@@ -514,7 +883,16 @@ void Scheduler::run_no_guard(Timestamp timeout) {
   if (yield_flag_) {
     return;
   }
+  bool is_idle = work_stealing_state_ != nullptr && ready_actors_list_.empty();
+  if (is_idle) {
+    steal_actors();
+    work_stealing_state_->schedulers[sched_id_]->is_idle.store(true, std::memory_order_relaxed);
+  }
   run_poll(timeout);
+  Time::update_cached_now();
+  if (is_idle) {
+    work_stealing_state_->schedulers[sched_id_]->is_idle.store(false, std::memory_order_relaxed);
+  }
   run_events(timeout);
 }
 
@@ -525,7 +903,11 @@ Timestamp Scheduler::get_timeout() {
   if (timeout_queue_.empty()) {
     return Timestamp::in(10000);
   }
+#if TD_ACTOR_TIMING_WHEEL
+  return Timestamp::at(timeout_queue_.get_wakeup_at());
+#else
   return Timestamp::at(timeout_queue_.top_key());
+#endif
 }
 
 }  // namespace td
@@ -45,6 +45,9 @@ class EventGuard {
   Scheduler *scheduler_;
   ActorContext *save_context_;
   const char *save_log_tag2_;
+#if TD_ACTOR_STATS
+  double start_time_;
+#endif
 
   void swap_context(ActorInfo *info);
 };
@@ -146,16 +149,34 @@ void Scheduler::flush_mailbox(ActorInfo *actor_info, const RunFuncT &run_func, c
   auto &mailbox = actor_info->mailbox_;
   size_t mailbox_size = mailbox.size();
   CHECK(mailbox_size != 0);
+  if (mailbox_size > 1) {
+    sort_mailbox_by_priority(mailbox, mailbox_size);
+  }
+  size_t run_event_count = mailbox_size;
+  if (max_mailbox_flush_size_ != 0 && run_event_count > max_mailbox_flush_size_) {
+    // the rest of the events will be handled after other ready actors get their turn
+    run_event_count = max_mailbox_flush_size_;
+  }
   EventGuard guard(this, actor_info);
   size_t i = 0;
-  for (; i < mailbox_size && guard.can_run(); i++) {
+  for (; i < run_event_count && guard.can_run(); i++) {
+#if TD_ACTOR_STATS
+    actor_info->stats_.on_event();
+    actor_info->stats_.on_mailbox_delay(Time::now() - mailbox[i].enqueue_time);
+#endif
     do_event(actor_info, std::move(mailbox[i]));
   }
   if (run_func) {
-    if (guard.can_run()) {
-      (*run_func)(actor_info);
-    } else {
+    if (!guard.can_run()) {
       mailbox.insert(mailbox.begin() + i, (*event_func)());
+    } else if (i < mailbox_size) {
+      // the new event must not overtake the postponed ones
+      mailbox.insert(mailbox.begin() + mailbox_size, (*event_func)());
+    } else {
+#if TD_ACTOR_STATS
+      actor_info->stats_.on_event();
+#endif
+      (*run_func)(actor_info);
     }
   }
   mailbox.erase(mailbox.begin(), mailbox.begin() + i);
@@ -164,7 +185,10 @@ void Scheduler::flush_mailbox(ActorInfo *actor_info, const RunFuncT &run_func, c
 inline void Scheduler::send_to_scheduler(int32 sched_id, const ActorId<> &actor_id, Event &&event) {
   if (sched_id == sched_id_) {
     ActorInfo *actor_info = actor_id.get_actor_info();
-    pending_events_[actor_info].push_back(std::move(event));
+#if TD_ACTOR_STATS
+    stamp_enqueue_time(event);
+#endif
+    add_pending_event(actor_info, std::move(event));
   } else {
     send_to_other_scheduler(sched_id, actor_id, std::move(event));
   }
@@ -174,6 +198,29 @@ inline void Scheduler::before_tail_send(const ActorId<> &actor_id) {
   // TODO
 }
 
+#if TD_ACTOR_STATS
+inline void Scheduler::stamp_enqueue_time(Event &event) {
+  if (event.enqueue_time == 0.0) {
+    event.enqueue_time = Time::now();
+  }
+}
+#endif
+
+inline EventPriority Scheduler::get_send_priority() const {
+  return send_priority_;
+}
+
+inline void Scheduler::set_send_priority(EventPriority priority) {
+  send_priority_ = priority;
+}
+
+inline ActorId<> Scheduler::get_current_actor_id() {
+  if (event_context_ptr_ == nullptr || event_context_ptr_->actor_info == nullptr) {
+    return ActorId<>();
+  }
+  return event_context_ptr_->actor_info->actor_id();
+}
+
 inline void Scheduler::inc_wait_generation() {
   wait_generation_ += 2;
 }
@@ -196,6 +243,9 @@ void Scheduler::send_impl(const ActorId<> &actor_id, const RunFuncT &run_func, c
              !actor_info->must_wait(wait_generation_))) {  // run immediately
     if (likely(actor_info->mailbox_.empty())) {
       EventGuard guard(this, actor_info);
+#if TD_ACTOR_STATS
+      actor_info->stats_.on_event();
+#endif
       run_func(actor_info);
     } else {
       flush_mailbox(actor_info, &run_func, &event_func);
@@ -223,6 +273,7 @@ void Scheduler::send_lambda(ActorRef actor_ref, EventT &&lambda) {
       [&] {
         auto event = Event::lambda(std::forward<EventT>(lambda));
         event.set_link_token(actor_ref.token());
+        event.set_priority(send_priority_);
         return event;
       });
 }
@@ -238,6 +289,7 @@ void Scheduler::send_closure(ActorRef actor_ref, EventT &&closure) {
       [&] {
         auto event = Event::immediate_closure(std::forward<EventT>(closure));
         event.set_link_token(actor_ref.token());
+        event.set_priority(send_priority_);
         return event;
       });
 }
@@ -245,6 +297,9 @@ void Scheduler::send_closure(ActorRef actor_ref, EventT &&closure) {
 template <ActorSendType send_type>
 void Scheduler::send(ActorRef actor_ref, Event &&event) {
   event.set_link_token(actor_ref.token());
+  if (event.priority == EventPriority::Normal) {
+    event.set_priority(send_priority_);
+  }
   return send_impl<send_type>(
       actor_ref.get(), [&](ActorInfo *actor_info) { do_event(actor_info, std::move(event)); },
       [&] { return std::move(event); });
@@ -303,9 +358,8 @@ inline void Scheduler::cancel_actor_timeout(Actor *actor) {
 }
 
 inline void Scheduler::cancel_actor_timeout(ActorInfo *actor_info) {
-  HeapNode *heap_node = actor_info->get_heap_node();
-  if (heap_node->in_heap()) {
-    timeout_queue_.erase(heap_node);
+  if (actor_info->has_timeout()) {
+    timeout_queue_.erase(actor_info->get_timeout_node());
   }
 }
 
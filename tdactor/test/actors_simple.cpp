@@ -22,8 +22,10 @@
 #include "td/utils/tests.h"
 #include "td/utils/Time.h"
 
+#include <atomic>
 #include <memory>
 #include <tuple>
+#include <utility>
 
 static const size_t BUF_SIZE = 1024 * 1024;
 static char buf[BUF_SIZE];
@@ -687,3 +689,239 @@ TEST(Actors, MultiPromiseSendClosureLater) {
   }
   scheduler.finish();
 }
+
+class EventPriorityTest final : public td::Actor {
+ public:
+  void event(char priority, int id) {
+    order_.emplace_back(priority, id);
+    if (order_.size() == 2 * N + 2) {
+      check_order();
+      td::Scheduler::instance()->finish();
+      stop();
+    }
+  }
+
+ private:
+  static constexpr int N = 20;
+  td::vector<std::pair<char, int>> order_;
+
+  void start_up() final {
+    {
+      td::EventPriorityGuard guard(td::EventPriority::Background);
+      for (int i = 0; i < N; i++) {
+        send_closure_later(actor_id(this), &EventPriorityTest::event, 'B', i);
+      }
+    }
+    for (int i = 0; i < N; i++) {
+      send_closure(actor_id(this), &EventPriorityTest::event, 'N', i);
+    }
+    td::EventPriorityGuard guard(td::EventPriority::Interactive);
+    send_closure_later(actor_id(this), &EventPriorityTest::event, 'I', 0);
+    send_lambda(actor_id(this), [actor = this] { actor->event('I', 1); });
+  }
+
+  void check_order() {
+    ASSERT_EQ('I', order_[0].first);
+    ASSERT_EQ('I', order_[1].first);
+    int next_id[256] = {};
+    size_t last_normal_pos = 0;
+    size_t first_background_pos = order_.size();
+    for (size_t i = 0; i < order_.size(); i++) {
+      auto priority = static_cast<unsigned char>(order_[i].first);
+      ASSERT_EQ(next_id[priority]++, order_[i].second);
+      if (order_[i].first == 'N') {
+        last_normal_pos = i;
+      }
+      if (order_[i].first == 'B') {
+        first_background_pos = td::min(first_background_pos, i);
+      }
+    }
+    ASSERT_TRUE(first_background_pos < last_normal_pos);
+  }
+};
+
+TEST(Actors, event_priority) {
+  td::ConcurrentScheduler scheduler;
+  scheduler.init(0);
+  scheduler.create_actor_unsafe<EventPriorityTest>(0, "EventPriorityTest").release();
+  scheduler.start();
+  while (scheduler.run_main(10)) {
+  }
+  scheduler.finish();
+}
+
+class MailboxFlushRecorder final : public td::Actor {
+ public:
+  MailboxFlushRecorder(char name, std::shared_ptr<td::vector<std::pair<char, int>>> order)
+      : name_(name), order_(std::move(order)) {
+  }
+
+  void event(int id) {
+    order_->emplace_back(name_, id);
+    if (order_->size() == 11) {
+      check_order();
+      td::Scheduler::instance()->finish();
+    }
+  }
+
+ private:
+  char name_;
+  std::shared_ptr<td::vector<std::pair<char, int>>> order_;
+
+  void check_order() const {
+    size_t b_pos = 0;
+    int next_a_id = 0;
+    for (size_t i = 0; i < order_->size(); i++) {
+      if ((*order_)[i].first == 'A') {
+        ASSERT_EQ(next_a_id++, (*order_)[i].second);
+      } else {
+        b_pos = i;
+      }
+    }
+    // A handles at most 3 events in a row before B gets its turn
+    ASSERT_TRUE(b_pos <= 3);
+  }
+};
+
+class MailboxFlushTest final : public td::Actor {
+  void start_up() final {
+    auto order = std::make_shared<td::vector<std::pair<char, int>>>();
+    auto a = td::create_actor<MailboxFlushRecorder>("A", 'A', order).release();
+    auto b = td::create_actor<MailboxFlushRecorder>("B", 'B', order).release();
+    for (int i = 0; i < 10; i++) {
+      send_closure_later(a, &MailboxFlushRecorder::event, i);
+    }
+    send_closure_later(b, &MailboxFlushRecorder::event, 0);
+    stop();
+  }
+};
+
+TEST(Actors, max_mailbox_flush_size) {
+  td::ConcurrentScheduler scheduler;
+  td::ConcurrentScheduler::Options options;
+  options.max_mailbox_flush_size = 3;
+  scheduler.init(0, options);
+  scheduler.create_actor_unsafe<MailboxFlushTest>(0, "MailboxFlushTest").release();
+  scheduler.start();
+  while (scheduler.run_main(10)) {
+  }
+  scheduler.finish();
+}
+
+#if TD_LINUX && !TD_THREAD_UNSUPPORTED && !TD_EVENTFD_UNSUPPORTED
+class AffinityChecker final : public td::Actor {
+ public:
+  AffinityChecker(td::uint64 expected_mask, std::shared_ptr<std::atomic<int>> left)
+      : expected_mask_(expected_mask), left_(std::move(left)) {
+  }
+
+ private:
+  td::uint64 expected_mask_;
+  std::shared_ptr<std::atomic<int>> left_;
+
+  void start_up() final {
+    ASSERT_EQ(expected_mask_, td::thread::get_affinity_mask(td::this_thread::get_id()));
+    if (--*left_ == 0) {
+      td::Scheduler::instance()->finish();
+    }
+    stop();
+  }
+};
+
+TEST(Actors, thread_affinity) {
+  auto mask = td::thread::get_affinity_mask(td::this_thread::get_id());
+  if (mask == 0) {
+    return;
+  }
+  LOG(INFO) << "NUMA node 0 CPU mask: " << td::ConcurrentScheduler::get_numa_node_affinity_mask(0);
+  auto first_cpu_mask = mask & ~(mask - 1);
+
+  td::ConcurrentScheduler scheduler;
+  td::ConcurrentScheduler::Options options;
+  options.thread_affinity_masks = {0, first_cpu_mask, mask};
+  scheduler.init(2, options);
+  auto left = std::make_shared<std::atomic<int>>(2);
+  scheduler.create_actor_unsafe<AffinityChecker>(1, "AffinityChecker", first_cpu_mask, left).release();
+  scheduler.create_actor_unsafe<AffinityChecker>(2, "AffinityChecker", mask, left).release();
+  scheduler.start();
+  while (scheduler.run_main(10)) {
+  }
+  scheduler.finish();
+  ASSERT_EQ(mask, td::thread::get_affinity_mask(td::this_thread::get_id()));
+}
+#endif
+
+#if TD_HAVE_COROUTINES
+class CoroutineCalculator final : public td::Actor {
+ public:
+  void double_value(int value, td::Promise<int> promise) {
+    if (value < 0) {
+      return promise.set_error(td::Status::Error("Negative value"));
+    }
+    promise.set_value(value * 2);
+  }
+
+  void lose_promise(td::Promise<int> promise) {
+  }
+
+  void double_value_actor(int value, td::PromiseActor<int> &&promise) {
+    promise.set_value(value * 2);
+  }
+};
+
+class CoroutineTest final : public td::Actor {
+ public:
+  explicit CoroutineTest(td::ActorId<CoroutineCalculator> calculator) : calculator_(calculator) {
+  }
+
+ private:
+  td::ActorId<CoroutineCalculator> calculator_;
+
+  td::Task<int> double_value(int value) {
+    co_return co_await td::await_promise<int>([&](td::Promise<int> promise) {
+      td::send_closure(calculator_, &CoroutineCalculator::double_value, value, std::move(promise));
+    });
+  }
+
+  td::Task<int> run() {
+    int sum = 0;
+    for (int i = 0; i < 100; i++) {
+      auto r_value = co_await double_value(i);
+      CHECK(r_value.is_ok());
+      sum += r_value.ok();
+    }
+    CHECK((co_await double_value(-1)).is_error());
+
+    auto r_lost = co_await td::await_promise<int>([&](td::Promise<int> promise) {
+      td::send_closure(calculator_, &CoroutineCalculator::lose_promise, std::move(promise));
+    });
+    CHECK(r_lost.is_error());
+
+    td::PromiseFuture<int> pf;
+    auto future = pf.move_future();
+    td::send_closure(calculator_, &CoroutineCalculator::double_value_actor, 21, pf.move_promise());
+    auto r_future = co_await future;
+    CHECK(r_future.is_ok());
+    co_return sum + r_future.ok();
+  }
+
+  void start_up() final {
+    run().start([](td::Result<int> result) {
+      CHECK(result.is_ok());
+      CHECK(result.ok() == 100 * 99 + 42);
+      td::Scheduler::instance()->finish();
+    });
+  }
+};
+
+TEST(Actors, coroutines) {
+  td::ConcurrentScheduler scheduler;
+  scheduler.init(2);
+  auto calculator = scheduler.create_actor_unsafe<CoroutineCalculator>(2, "CoroutineCalculator").release();
+  scheduler.create_actor_unsafe<CoroutineTest>(1, "CoroutineTest", calculator).release();
+  scheduler.start();
+  while (scheduler.run_main(10)) {
+  }
+  scheduler.finish();
+}
+#endif
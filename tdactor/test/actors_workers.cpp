@@ -7,7 +7,9 @@
 #include "td/actor/actor.h"
 #include "td/actor/ConcurrentScheduler.h"
 
+#include "td/utils/benchmark.h"
 #include "td/utils/common.h"
+#include "td/utils/logging.h"
 #include "td/utils/SliceBuilder.h"
 #include "td/utils/tests.h"
 
@@ -105,9 +107,10 @@ class Manager final : public td::Actor {
   int query_size_;
 };
 
-static void test_workers(int threads_n, int workers_n, int queries_n, int query_size) {
+static void test_workers(int threads_n, int workers_n, int queries_n, int query_size,
+                         const td::ConcurrentScheduler::Options &options = td::ConcurrentScheduler::Options()) {
   td::ConcurrentScheduler sched;
-  sched.init(threads_n);
+  sched.init(threads_n, options);
 
   td::vector<td::ActorId<PowerWorker>> workers;
   for (int i = 0; i < workers_n; i++) {
@@ -148,3 +151,115 @@ TEST(Actors, workers_small_query_two_threads) {
 TEST(Actors, workers_small_query_nine_threads) {
   test_workers(9, 10, 1000000, 1);
 }
+
+static td::ConcurrentScheduler::Options get_batched_options() {
+  td::ConcurrentScheduler::Options options;
+  options.batch_outbound_events = true;
+  return options;
+}
+
+TEST(Actors, workers_small_query_two_threads_batched) {
+  test_workers(2, 10, 1000000, 1, get_batched_options());
+}
+
+TEST(Actors, workers_small_query_nine_threads_batched) {
+  test_workers(9, 10, 1000000, 1, get_batched_options());
+}
+
+TEST(Actors, workers_small_query_two_threads_spin_poll) {
+  td::ConcurrentScheduler::Options options;
+  options.max_spin_poll_time = 50e-6;
+  options.spin_poll_cpu_share = 0.5;
+  test_workers(2, 10, 1000000, 1, options);
+}
+
+class StealableWorker final : public td::Actor {
+ public:
+  StealableWorker(td::ActorShared<> parent, int tasks_n) : parent_(std::move(parent)), left_tasks_(tasks_n) {
+  }
+
+  void task(int task_id, td::uint32 x, td::uint32 p) {
+    CHECK(task_id == next_task_id_);
+    next_task_id_++;
+    td::uint32 res = 1;
+    for (td::uint32 i = 0; i < p; i++) {
+      res *= x;
+    }
+    td::do_not_optimize_away(res);
+    if (--left_tasks_ == 0) {
+      stop();
+    }
+  }
+
+ private:
+  td::ActorShared<> parent_;
+  int next_task_id_ = 0;
+  int left_tasks_;
+
+  void start_up() final {
+    allow_stealing();
+  }
+};
+
+class StealingManager final : public td::Actor {
+ public:
+  StealingManager(int workers_n, int tasks_n, int task_size)
+      : workers_n_(workers_n), tasks_n_(tasks_n), task_size_(task_size) {
+  }
+
+ private:
+  int workers_n_;
+  int tasks_n_;
+  int task_size_;
+  int ref_cnt_ = 0;
+  td::vector<td::ActorOwn<StealableWorker>> workers_;
+
+  void start_up() final {
+    for (int i = 0; i < workers_n_; i++) {
+      ref_cnt_++;
+      workers_.push_back(
+          td::create_actor<StealableWorker>(PSLICE() << "StealableWorker" << i, actor_shared(this), tasks_n_));
+    }
+    send_tasks(0);
+  }
+
+  void send_tasks(int task_id) {
+    for (auto &worker : workers_) {
+      td::send_closure_later(worker, &StealableWorker::task, task_id, 3, task_size_);
+    }
+    if (task_id + 1 < tasks_n_) {
+      td::send_closure_later(actor_id(this), &StealingManager::send_tasks, task_id + 1);
+    }
+  }
+
+  void hangup_shared() final {
+    if (--ref_cnt_ == 0) {
+      td::Scheduler::instance()->finish();
+      stop();
+    }
+  }
+};
+
+static void test_work_stealing(int threads_n, int workers_n, int tasks_n, int task_size) {
+  td::ConcurrentScheduler::Options options;
+  options.enable_work_stealing = true;
+  td::ConcurrentScheduler sched;
+  sched.init(threads_n, options);
+
+  sched.create_actor_unsafe<StealingManager>(threads_n ? 1 : 0, "StealingManager", workers_n, tasks_n, task_size)
+      .release();
+
+  sched.start();
+  while (sched.run_main(10)) {
+    // empty
+  }
+  sched.finish();
+}
+
+TEST(Actors, work_stealing_one_thread) {
+  test_work_stealing(0, 10, 100, 10000);
+}
+
+TEST(Actors, work_stealing_four_threads) {
+  test_work_stealing(4, 32, 300, 30000);
+}
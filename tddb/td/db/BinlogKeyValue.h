@@ -15,6 +15,7 @@
 
 #include "td/utils/buffer.h"
 #include "td/utils/common.h"
+#include "td/utils/FlatHashMap.h"
 #include "td/utils/logging.h"
 #include "td/utils/misc.h"
 #include "td/utils/port/RwMutex.h"
@@ -80,9 +81,7 @@ class BinlogKeyValue final : public KeyValueSyncInterface {
     TRY_STATUS(binlog_->init(
         name,
         [&](const BinlogEvent &binlog_event) {
-          Event event;
-          event.parse(TlParser(binlog_event.data_));
-          map_.emplace(event.key.str(), std::make_pair(event.value.str(), binlog_event.id_));
+          add_loaded_event(binlog_event);
         },
         std::move(db_key), DbKey::empty(), scheduler_id));
     return Status::OK();
@@ -101,9 +100,7 @@ class BinlogKeyValue final : public KeyValueSyncInterface {
   }
 
   void external_init_handle(const BinlogEvent &binlog_event) {
-    Event event;
-    event.parse(TlParser(binlog_event.data_));
-    map_.emplace(event.key.str(), std::make_pair(event.value.str(), binlog_event.id_));
+    add_loaded_event(binlog_event);
   }
 
   void external_init_finish(std::shared_ptr<BinlogT> binlog) {
@@ -120,7 +117,7 @@ class BinlogKeyValue final : public KeyValueSyncInterface {
   SeqNo set(string key, string value) final {
     auto lock = rw_mutex_.lock_write().move_as_ok();
     uint64 old_id = 0;
-    auto it_ok = map_.insert({key, {value, 0}});
+    auto it_ok = map_.emplace(key, value, 0);
     if (!it_ok.second) {
       if (it_ok.first->second.first == value) {
         return 0;
@@ -215,14 +212,13 @@ class BinlogKeyValue final : public KeyValueSyncInterface {
   void erase_by_prefix(Slice prefix) final {
     auto lock = rw_mutex_.lock_write().move_as_ok();
     std::vector<uint64> ids;
-    for (auto it = map_.begin(); it != map_.end();) {
-      if (begins_with(it->first, prefix)) {
-        ids.push_back(it->second.second);
-        it = map_.erase(it);
-      } else {
-        ++it;
+    map_.remove_if([&](const auto &it) {
+      if (begins_with(it.first, prefix)) {
+        ids.push_back(it.second.second);
+        return true;
       }
-    }
+      return false;
+    });
     auto seq_no = binlog_->next_id(narrow_cast<int32>(ids.size()));
     lock.reset();
     for (auto id : ids) {
@@ -239,7 +235,18 @@ class BinlogKeyValue final : public KeyValueSyncInterface {
   }
 
  private:
-  std::unordered_map<string, std::pair<string, uint64>> map_;
+  void add_loaded_event(const BinlogEvent &binlog_event) {
+    Event event;
+    event.parse(TlParser(binlog_event.data_));
+    if (event.key.empty()) {
+      LOG(ERROR) << "Ignore value with an empty key";
+      return;
+    }
+    map_.emplace(event.key.str(), event.value.str(), binlog_event.id_);
+  }
+
+  // open-addressing index; the binlog itself drops rewritten values during compaction
+  FlatHashMap<string, std::pair<string, uint64>> map_;
   std::shared_ptr<BinlogT> binlog_;
   RwMutex rw_mutex_;
   int32 magic_ = MAGIC;
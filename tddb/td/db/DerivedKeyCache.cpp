@@ -0,0 +1,107 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2022
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "td/db/DerivedKeyCache.h"
+
+#include "td/utils/crypto.h"
+#include "td/utils/logging.h"
+#include "td/utils/Random.h"
+#include "td/utils/SharedSlice.h"
+#include "td/utils/StringBuilder.h"
+
+#include <mutex>
+#include <unordered_map>
+
+namespace td {
+
+namespace {
+
+struct CachedKeys {
+  std::mutex mutex;
+  std::unordered_map<string, SecureString> masked_keys;  // identifier -> derived key XOR mask
+};
+
+CachedKeys &get_cached_keys() {
+  static CachedKeys cached_keys;
+  return cached_keys;
+}
+
+Slice get_process_secret() {
+  static const string secret = [] {
+    string result(32, '\0');
+    Random::secure_bytes(result);
+    return result;
+  }();
+  return secret;
+}
+
+}  // namespace
+
+constexpr size_t DerivedKeyCache::MAX_KEY_SIZE;
+constexpr size_t DerivedKeyCache::MAX_CACHED_KEY_COUNT;
+
+void DerivedKeyCache::pbkdf2(Hash hash, Slice password, Slice salt, int iteration_count, MutableSlice dest) {
+  CHECK(dest.size() <= MAX_KEY_SIZE);
+  auto secret = get_process_secret();
+
+  // the identifier depends on all derivation parameters, but doesn't allow to check a password without the secret
+  SecureString parameters(64 + salt.size() + password.size());
+  StringBuilder sb(parameters.as_mutable_slice());
+  sb << static_cast<int32>(hash) << ' ' << iteration_count << ' ' << dest.size() << ' ' << salt.size() << ' ';
+  CHECK(!sb.is_error());
+  auto header_size = sb.as_cslice().size();
+  parameters.as_mutable_slice().substr(header_size).copy_from(salt);
+  parameters.as_mutable_slice().substr(header_size + salt.size()).copy_from(password);
+  string id(32, '\0');
+  hmac_sha256(secret, parameters.as_slice().substr(0, header_size + salt.size() + password.size()), id);
+
+  SecureString mask(64);
+  hmac_sha512(secret, id, mask.as_mutable_slice());
+
+  auto &cached_keys = get_cached_keys();
+  {
+    std::lock_guard<std::mutex> lock(cached_keys.mutex);
+    auto it = cached_keys.masked_keys.find(id);
+    if (it != cached_keys.masked_keys.end()) {
+      CHECK(it->second.size() == dest.size());
+      for (size_t i = 0; i < dest.size(); i++) {
+        dest[i] = static_cast<char>(it->second[i] ^ mask[i]);
+      }
+      return;
+    }
+  }
+
+  // a shorter PBKDF2 output is a prefix of the output with the hash size
+  switch (hash) {
+    case Hash::Sha256: {
+      CHECK(dest.size() <= 32);
+      SecureString key(32);
+      pbkdf2_sha256(password, salt, iteration_count, key.as_mutable_slice());
+      dest.copy_from(key.as_slice().substr(0, dest.size()));
+      break;
+    }
+    case Hash::Sha512: {
+      SecureString key(64);
+      pbkdf2_sha512(password, salt, iteration_count, key.as_mutable_slice());
+      dest.copy_from(key.as_slice().substr(0, dest.size()));
+      break;
+    }
+    default:
+      UNREACHABLE();
+  }
+
+  SecureString masked_key(dest.size());
+  for (size_t i = 0; i < dest.size(); i++) {
+    masked_key.as_mutable_slice()[i] = static_cast<char>(dest[i] ^ mask[i]);
+  }
+  std::lock_guard<std::mutex> lock(cached_keys.mutex);
+  if (cached_keys.masked_keys.size() >= MAX_CACHED_KEY_COUNT) {
+    cached_keys.masked_keys.clear();
+  }
+  cached_keys.masked_keys.emplace(std::move(id), std::move(masked_key));
+}
+
+}  // namespace td
@@ -0,0 +1,28 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2022
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#pragma once
+
+#include "td/utils/common.h"
+#include "td/utils/Slice.h"
+
+namespace td {
+
+// process-wide cache of keys derived from passwords with PBKDF2, which allows to skip the slow key derivation
+// when the same database is opened again; passwords aren't stored and derived keys are stored masked
+class DerivedKeyCache {
+ public:
+  enum class Hash : int32 { Sha256, Sha512 };
+
+  static constexpr size_t MAX_KEY_SIZE = 64;
+
+  static void pbkdf2(Hash hash, Slice password, Slice salt, int iteration_count, MutableSlice dest);
+
+ private:
+  static constexpr size_t MAX_CACHED_KEY_COUNT = 256;
+};
+
+}  // namespace td
@@ -12,10 +12,12 @@
 
 namespace td {
 
-SqliteConnectionSafe::SqliteConnectionSafe(string path, DbKey key, optional<int32> cipher_version)
+SqliteConnectionSafe::SqliteConnectionSafe(string path, DbKey key, optional<int32> cipher_version,
+                                           SqliteDb::PerformanceProfile profile)
     : path_(std::move(path))
-    , lsls_connection_([path = path_, key = std::move(key), cipher_version = std::move(cipher_version)] {
-      auto r_db = SqliteDb::open_with_key(path, false, key, cipher_version.copy());
+    , lsls_connection_([path = path_, key = std::move(key), cipher_version = std::move(cipher_version),
+                        profile = std::move(profile)] {
+      auto r_db = SqliteDb::open_with_key(path, false, key, cipher_version.copy(), profile);
       if (r_db.is_error()) {
         LOG(FATAL) << "Can't open database: " << r_db.error().message();
       }
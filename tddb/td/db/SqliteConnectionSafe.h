@@ -19,7 +19,8 @@ namespace td {
 class SqliteConnectionSafe {
  public:
   SqliteConnectionSafe() = default;
-  SqliteConnectionSafe(string path, DbKey key, optional<int32> cipher_version = {});
+  SqliteConnectionSafe(string path, DbKey key, optional<int32> cipher_version = {},
+                       SqliteDb::PerformanceProfile profile = SqliteDb::PerformanceProfile());
 
   SqliteDb &get();
   void set(SqliteDb &&db);
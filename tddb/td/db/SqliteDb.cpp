@@ -6,14 +6,19 @@
 //
 #include "td/db/SqliteDb.h"
 
+#include "td/db/DerivedKeyCache.h"
+
 #include "td/utils/common.h"
 #include "td/utils/format.h"
 #include "td/utils/logging.h"
+#include "td/utils/misc.h"
+#include "td/utils/port/FileFd.h"
 #include "td/utils/port/path.h"
 #include "td/utils/port/Stat.h"
 #include "td/utils/SliceBuilder.h"
 #include "td/utils/Status.h"
 #include "td/utils/StringBuilder.h"
+#include "td/utils/SharedSlice.h"
 #include "td/utils/Timer.h"
 
 #include "sqlite/sqlite3.h"
@@ -67,6 +72,36 @@ string db_key_to_sqlcipher_key(const DbKey &db_key) {
   res.resize(expected_size);
   return res;
 }
+
+// default key derivation parameters of SQLCipher 4
+constexpr int SQLCIPHER_KDF_ITERATION_COUNT = 256000;
+constexpr size_t SQLCIPHER_KEY_SIZE = 32;
+constexpr size_t SQLCIPHER_SALT_SIZE = 16;
+
+// returns a raw key with salt for an existing database encrypted with the password using default SQLCipher settings
+Result<string> get_sqlcipher_derived_key(CSlice path, Slice password) {
+  TRY_RESULT(fd, FileFd::open(path, FileFd::Read));
+  string salt(SQLCIPHER_SALT_SIZE, '\0');
+  TRY_RESULT(read_size, fd.pread(salt, 0));
+  fd.close();
+  if (read_size != salt.size()) {
+    return Status::Error("Database is too small");
+  }
+
+  SecureString key(SQLCIPHER_KEY_SIZE);
+  DerivedKeyCache::pbkdf2(DerivedKeyCache::Hash::Sha512, password, salt, SQLCIPHER_KDF_ITERATION_COUNT,
+                          key.as_mutable_slice());
+  return PSTRING() << "\"x'" << format::as_hex_dump<0>(key.as_slice()) << format::as_hex_dump<0>(Slice(salt))
+                   << "'\"";
+}
+
+bool is_schema_change_query(Slice query) {
+  while (!query.empty() && is_space(query[0])) {
+    query.remove_prefix(1);
+  }
+  auto prefix = to_lower(query.substr(0, 6));
+  return begins_with(prefix, "create") || begins_with(prefix, "drop") || begins_with(prefix, "alter");
+}
 }  // namespace
 
 SqliteDb::~SqliteDb() = default;
@@ -130,6 +165,10 @@ Status SqliteDb::exec(CSlice cmd) {
     return Status::Error(PSLICE() << tag("query", cmd) << " to database \"" << raw_->path() << "\" failed: " << msg);
   }
   CHECK(msg == nullptr);
+  if (is_schema_change_query(cmd)) {
+    // SQLite recompiles statements after schema change itself, but there is no reason to keep the old statements
+    raw_->clear_statement_cache();
+  }
   return Status::OK();
 }
 
@@ -162,6 +201,41 @@ Result<string> SqliteDb::get_pragma_string(Slice name) {
   return std::move(res);
 }
 
+SqliteDb::StatementCacheStats SqliteDb::get_statement_cache_stats() const {
+  CHECK(!empty());
+  return raw_->get_statement_cache_stats();
+}
+
+int64 SqliteDb::get_total_changes() const {
+  CHECK(!empty());
+  return sqlite3_total_changes(raw_->db());
+}
+
+Status SqliteDb::set_performance_profile(const PerformanceProfile &profile) {
+  if (profile.synchronous && (profile.synchronous.value() < 0 || profile.synchronous.value() > 3)) {
+    return Status::Error(PSLICE() << "Wrong synchronous level " << profile.synchronous.value());
+  }
+  if (profile.temp_store && (profile.temp_store.value() < 0 || profile.temp_store.value() > 2)) {
+    return Status::Error(PSLICE() << "Wrong temp_store value " << profile.temp_store.value());
+  }
+  if (profile.mmap_size) {
+    TRY_STATUS(exec(PSLICE() << "PRAGMA mmap_size = " << profile.mmap_size.value()));
+  }
+  if (profile.cache_size) {
+    TRY_STATUS(exec(PSLICE() << "PRAGMA cache_size = " << profile.cache_size.value()));
+  }
+  if (profile.wal_autocheckpoint) {
+    TRY_STATUS(exec(PSLICE() << "PRAGMA wal_autocheckpoint = " << profile.wal_autocheckpoint.value()));
+  }
+  if (profile.synchronous) {
+    TRY_STATUS(exec(PSLICE() << "PRAGMA synchronous = " << profile.synchronous.value()));
+  }
+  if (profile.temp_store) {
+    TRY_STATUS(exec(PSLICE() << "PRAGMA temp_store = " << profile.temp_store.value()));
+  }
+  return Status::OK();
+}
+
 Result<int32> SqliteDb::user_version() {
   TRY_RESULT(get_version_stmt, get_statement("PRAGMA user_version"));
   TRY_STATUS(get_version_stmt.step());
@@ -206,23 +280,42 @@ Status SqliteDb::check_encryption() {
 }
 
 Result<SqliteDb> SqliteDb::open_with_key(CSlice path, bool allow_creation, const DbKey &db_key,
-                                         optional<int32> cipher_version) {
+                                         optional<int32> cipher_version, const PerformanceProfile &profile) {
   auto res = do_open_with_key(path, allow_creation, db_key, cipher_version ? cipher_version.value() : 0);
   if (res.is_error() && !cipher_version && !db_key.is_empty()) {
-    return do_open_with_key(path, false, db_key, 3);
+    res = do_open_with_key(path, false, db_key, 3);
+  }
+  if (res.is_ok()) {
+    TRY_STATUS(res.ok_ref().set_performance_profile(profile));
   }
   return res;
 }
 
 Result<SqliteDb> SqliteDb::do_open_with_key(CSlice path, bool allow_creation, const DbKey &db_key,
                                             int32 cipher_version) {
+  if (db_key.is_password() && cipher_version == 0) {
+    // SQLCipher derives the key from the password on every open, so the key derived once is passed instead
+    auto r_key = get_sqlcipher_derived_key(path, db_key.data());
+    if (r_key.is_ok()) {
+      auto r_db = do_open_with_sqlcipher_key(path, false, r_key.ok(), cipher_version);
+      if (r_db.is_ok()) {
+        return r_db;
+      }
+      LOG(INFO) << "Failed to open database with derived key: " << r_db.error();
+    }
+  }
+  auto key = db_key.is_empty() ? string() : db_key_to_sqlcipher_key(db_key);
+  return do_open_with_sqlcipher_key(path, allow_creation, key, cipher_version);
+}
+
+Result<SqliteDb> SqliteDb::do_open_with_sqlcipher_key(CSlice path, bool allow_creation, const string &key,
+                                                      int32 cipher_version) {
   SqliteDb db;
   TRY_STATUS(db.init(path, allow_creation));
-  if (!db_key.is_empty()) {
+  if (!key.empty()) {
     if (db.check_encryption().is_ok()) {
       return Status::Error(PSLICE() << "No key is needed for database \"" << path << '"');
     }
-    auto key = db_key_to_sqlcipher_key(db_key);
     TRY_STATUS(db.exec(PSLICE() << "PRAGMA key = " << key));
     if (cipher_version != 0) {
       LOG(INFO) << "Trying SQLCipher compatibility mode with version = " << cipher_version;
@@ -304,6 +397,11 @@ Status SqliteDb::destroy(Slice path) {
 }
 
 Result<SqliteStatement> SqliteDb::get_statement(CSlice statement) {
+  auto *cached_stmt = raw_->get_cached_statement(statement);
+  if (cached_stmt != nullptr) {
+    return SqliteStatement(cached_stmt, raw_);
+  }
+
   sqlite3_stmt *stmt = nullptr;
   auto rc = sqlite3_prepare_v2(get_native(), statement.c_str(), static_cast<int>(statement.size()) + 1, &stmt, nullptr);
   if (rc != SQLITE_OK) {
@@ -23,6 +23,15 @@ namespace td {
 
 class SqliteDb {
  public:
+  // performance-related settings of a connection; settings, which aren't set, are left as is
+  struct PerformanceProfile {
+    optional<int64> mmap_size;           // maximum number of bytes of the database file to access through mmap
+    optional<int64> cache_size;          // page cache size in pages if positive or in KiB if negative
+    optional<int32> wal_autocheckpoint;  // number of WAL pages after which checkpoint is done automatically
+    optional<int32> synchronous;         // 0 - OFF, 1 - NORMAL, 2 - FULL, 3 - EXTRA
+    optional<int32> temp_store;          // 0 - DEFAULT, 1 - FILE, 2 - MEMORY
+  };
+
   SqliteDb() = default;
   SqliteDb(SqliteDb &&) = default;
   SqliteDb &operator=(SqliteDb &&) = default;
@@ -51,6 +60,15 @@ class SqliteDb {
   Status begin_write_transaction() TD_WARN_UNUSED_RESULT;
   Status commit_transaction() TD_WARN_UNUSED_RESULT;
 
+  Status set_performance_profile(const PerformanceProfile &profile) TD_WARN_UNUSED_RESULT;
+
+  // prepared statements are cached after destruction and reused by get_statement with the same query
+  using StatementCacheStats = detail::RawSqliteDb::StatementCacheStats;
+  StatementCacheStats get_statement_cache_stats() const;
+
+  // number of rows changed by all INSERT, UPDATE and DELETE statements since the connection was opened
+  int64 get_total_changes() const;
+
   Result<int32> user_version();
   Status set_user_version(int32 version) TD_WARN_UNUSED_RESULT;
   void trace(bool flag);
@@ -59,7 +77,8 @@ class SqliteDb {
 
   // we can't change the key on the fly, so static functions are more than enough
   static Result<SqliteDb> open_with_key(CSlice path, bool allow_creation, const DbKey &db_key,
-                                        optional<int32> cipher_version = {});
+                                        optional<int32> cipher_version = {},
+                                        const PerformanceProfile &profile = PerformanceProfile());
   static Result<SqliteDb> change_key(CSlice path, bool allow_creation, const DbKey &new_db_key,
                                      const DbKey &old_db_key);
 
@@ -88,6 +107,8 @@ class SqliteDb {
 
   Status check_encryption();
   static Result<SqliteDb> do_open_with_key(CSlice path, bool allow_creation, const DbKey &db_key, int32 cipher_version);
+  static Result<SqliteDb> do_open_with_sqlcipher_key(CSlice path, bool allow_creation, const string &key,
+                                                     int32 cipher_version);
   void set_cipher_version(int32 cipher_version);
 };
 
@@ -11,9 +11,13 @@
 #include "td/actor/actor.h"
 
 #include "td/utils/common.h"
+#include "td/utils/misc.h"
 #include "td/utils/optional.h"
 #include "td/utils/Time.h"
 
+#include <iterator>
+#include <list>
+
 namespace td {
 
 class SqliteKeyValueAsync final : public SqliteKeyValueAsyncInterface {
@@ -63,6 +67,9 @@ class SqliteKeyValueAsync final : public SqliteKeyValueAsyncInterface {
     void set_all(std::unordered_map<string, string> key_values, Promise<Unit> promise) {
       do_flush(true /*force*/);
       kv_->set_all(key_values);
+      for (auto &key_value : key_values) {
+        cache_put(key_value.first, std::move(key_value.second));
+      }
       promise.set_value(Unit());
     }
 
@@ -83,6 +90,7 @@ class SqliteKeyValueAsync final : public SqliteKeyValueAsyncInterface {
     void erase_by_prefix(string key_prefix, Promise<Unit> promise) {
       do_flush(true /*force*/);
       kv_->erase_by_prefix(key_prefix);
+      cache_erase_by_prefix(key_prefix);
       promise.set_value(Unit());
     }
 
@@ -91,13 +99,23 @@ class SqliteKeyValueAsync final : public SqliteKeyValueAsyncInterface {
       if (it != buffer_.end()) {
         return promise.set_value(it->second ? it->second.value() : "");
       }
-      promise.set_value(kv_->get(key));
+      auto cache_it = cache_by_key_.find(key);
+      if (cache_it != cache_by_key_.end()) {
+        cache_.splice(cache_.begin(), cache_, cache_it->second);
+        return promise.set_value(string(cache_it->second->value));
+      }
+      auto value = kv_->get(key);
+      cache_put(key, value);
+      promise.set_value(std::move(value));
     }
 
     void close(Promise<Unit> promise) {
       do_flush(true /*force*/);
       kv_safe_.reset();
       kv_ = nullptr;
+      cache_.clear();
+      cache_by_key_.clear();
+      cache_size_ = 0;
       stop();
       promise.set_value(Unit());
     }
@@ -112,6 +130,55 @@ class SqliteKeyValueAsync final : public SqliteKeyValueAsyncInterface {
     std::vector<Promise<Unit>> buffer_promises_;
     size_t cnt_ = 0;
 
+    // bounded LRU cache of values, which were recently read from or written to the database;
+    // an empty value means that there is no such key in the database
+    static constexpr size_t MAX_CACHE_SIZE = 1 << 20;
+    static constexpr size_t MAX_CACHED_VALUE_SIZE = 1 << 12;
+    struct CachedValue {
+      string key;
+      string value;
+    };
+    std::list<CachedValue> cache_;
+    std::unordered_map<string, std::list<CachedValue>::iterator> cache_by_key_;
+    size_t cache_size_ = 0;
+
+    static size_t get_cached_value_size(const CachedValue &cached_value) {
+      return cached_value.key.size() + cached_value.value.size();
+    }
+
+    void cache_erase(std::unordered_map<string, std::list<CachedValue>::iterator>::iterator it) {
+      cache_size_ -= get_cached_value_size(*it->second);
+      cache_.erase(it->second);
+      cache_by_key_.erase(it);
+    }
+
+    void cache_put(const string &key, string value) {
+      auto it = cache_by_key_.find(key);
+      if (it != cache_by_key_.end()) {
+        cache_erase(it);
+      }
+      if (value.size() > MAX_CACHED_VALUE_SIZE) {
+        return;
+      }
+
+      cache_.push_front(CachedValue{key, std::move(value)});
+      cache_by_key_.emplace(key, cache_.begin());
+      cache_size_ += get_cached_value_size(cache_.front());
+      while (cache_size_ > MAX_CACHE_SIZE) {
+        cache_erase(cache_by_key_.find(cache_.back().key));
+      }
+    }
+
+    void cache_erase_by_prefix(Slice key_prefix) {
+      for (auto it = cache_by_key_.begin(); it != cache_by_key_.end();) {
+        auto next_it = std::next(it);
+        if (begins_with(it->first, key_prefix)) {
+          cache_erase(it);
+        }
+        it = next_it;
+      }
+    }
+
     double wakeup_at_ = 0;
     void do_flush(bool force) {
       if (buffer_.empty()) {
@@ -136,8 +203,10 @@ class SqliteKeyValueAsync final : public SqliteKeyValueAsyncInterface {
       for (auto &it : buffer_) {
         if (it.second) {
           kv_->set(it.first, it.second.value());
+          cache_put(it.first, std::move(it.second.value()));
         } else {
           kv_->erase(it.first);
+          cache_put(it.first, string());
         }
       }
       kv_->commit_transaction().ensure();
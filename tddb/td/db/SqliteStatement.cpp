@@ -54,7 +54,12 @@ SqliteStatement::SqliteStatement(sqlite3_stmt *stmt, std::shared_ptr<detail::Raw
     : stmt_(stmt), db_(std::move(db)) {
   CHECK(stmt != nullptr);
 }
-SqliteStatement::~SqliteStatement() = default;
+SqliteStatement::~SqliteStatement() {
+  if (stmt_ != nullptr && db_ != nullptr) {
+    // the statement can be reused by the next SqliteDb::get_statement with the same query
+    db_->return_statement(stmt_.release());
+  }
+}
 
 Result<string> SqliteStatement::explain() {
   if (empty()) {
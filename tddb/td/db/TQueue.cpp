@@ -18,6 +18,7 @@
 #include "td/utils/tl_parsers.h"
 #include "td/utils/tl_storers.h"
 
+#include <limits>
 #include <set>
 #include <unordered_map>
 
@@ -144,6 +145,15 @@ class TQueueImpl final : public TQueue {
     if (q.events.size() >= MAX_QUEUE_EVENTS) {
       return Status::Error("Queue is full");
     }
+    if (q.max_total_event_length != 0) {
+      if (data.size() > q.max_total_event_length) {
+        return Status::Error("Data is too big for the queue");
+      }
+      for (auto it = q.events.begin();
+           it != q.events.end() && q.total_event_length > q.max_total_event_length - data.size();) {
+        pop(q, queue_id, it, q.tail_id);
+      }
+    }
     if (q.total_event_length > MAX_TOTAL_EVENT_LENGTH - data.size()) {
       return Status::Error("Queue size is too big");
     }
@@ -232,8 +242,12 @@ class TQueueImpl final : public TQueue {
   }
 
   int64 run_gc(int32 unix_time_now) final {
+    return run_gc(unix_time_now, std::numeric_limits<int64>::max());
+  }
+
+  int64 run_gc(int32 unix_time_now, int64 max_deleted_events) final {
     int64 deleted_events = 0;
-    while (!queue_gc_at_.empty()) {
+    while (!queue_gc_at_.empty() && deleted_events < max_deleted_events) {
       auto it = queue_gc_at_.begin();
       if (it->first >= unix_time_now) {
         break;
@@ -241,28 +255,31 @@ class TQueueImpl final : public TQueue {
       auto queue_id = it->second;
       auto &q = queues_[queue_id];
       CHECK(q.gc_at == it->first);
-      int32 new_gc_at = 0;
 
-      if (!q.events.empty()) {
-        auto head_id = q.events.begin()->first;
-        Event event;
-        MutableSpan<Event> span{&event, 1};
-        size_t size_before = get_size(q);
-        do_get(queue_id, q, head_id, false, unix_time_now, span);
-        size_t size_after = get_size(q);
-        CHECK(size_after <= size_before);
-        deleted_events += size_before - size_after;
-        if (!span.empty()) {
-          CHECK(!event.data.empty());
-          new_gc_at = event.expires_at;
-          CHECK(new_gc_at >= unix_time_now);
-        }
+      size_t size_before = get_size(q);
+      bool is_finished = delete_expired_head_events(queue_id, q, unix_time_now, max_deleted_events - deleted_events);
+      size_t size_after = get_size(q);
+      CHECK(size_after <= size_before);
+      deleted_events += size_before - size_after;
+      if (!is_finished) {
+        // the queue stays scheduled and will be processed by the next call
+        break;
+      }
+
+      int32 new_gc_at = 0;
+      if (!q.events.empty() && !q.events.begin()->second.data.empty()) {
+        new_gc_at = q.events.begin()->second.expires_at;
+        CHECK(new_gc_at >= unix_time_now);
       }
       schedule_queue_gc(queue_id, q, new_gc_at);
     }
     return deleted_events;
   }
 
+  void set_max_total_event_length(QueueId queue_id, size_t max_total_event_length) final {
+    queues_[queue_id].max_total_event_length = max_total_event_length;
+  }
+
   size_t get_size(QueueId queue_id) const final {
     auto it = queues_.find(queue_id);
     if (it == queues_.end()) {
@@ -283,6 +300,7 @@ class TQueueImpl final : public TQueue {
     EventId tail_id;
     std::map<EventId, RawEvent> events;
     size_t total_event_length = 0;
+    size_t max_total_event_length = 0;
     int32 gc_at = 0;
   };
 
@@ -366,6 +384,23 @@ class TQueueImpl final : public TQueue {
     result_events.truncate(ready_n);
   }
 
+  // returns false if there can be more expired events in the beginning of the queue
+  bool delete_expired_head_events(QueueId queue_id, Queue &q, int32 unix_time_now, int64 max_deleted_events) {
+    int64 deleted_events = 0;
+    for (auto it = q.events.begin(); it != q.events.end();) {
+      auto &event = it->second;
+      if (event.expires_at >= unix_time_now && !event.data.empty()) {
+        return true;
+      }
+      if (deleted_events == max_deleted_events) {
+        return false;
+      }
+      pop(q, queue_id, it, q.tail_id);
+      deleted_events++;
+    }
+    return true;
+  }
+
   void schedule_queue_gc(QueueId queue_id, Queue &q, int32 gc_at) {
     if (q.gc_at != 0) {
       bool is_deleted = queue_gc_at_.erase({q.gc_at, queue_id}) > 0;
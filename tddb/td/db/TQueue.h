@@ -113,7 +113,14 @@ class TQueue {
 
   virtual size_t get_size(QueueId queue_id) const = 0;
 
+  // limits total length of data of events in the queue; the oldest events are deleted to free space for new events
+  // 0 means that only the default limit is applied
+  virtual void set_max_total_event_length(QueueId queue_id, size_t max_total_event_length) = 0;
+
   virtual int64 run_gc(int32 unix_time_now) = 0;
+
+  // deletes at most max_deleted_events expired events; the remaining events will be deleted by subsequent calls
+  virtual int64 run_gc(int32 unix_time_now, int64 max_deleted_events) = 0;
   virtual void close(Promise<> promise) = 0;
 };
 
@@ -0,0 +1,83 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2022
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "td/db/WriteBatchPolicy.h"
+
+#include "td/utils/misc.h"
+
+namespace td {
+
+WriteBatchPolicy::WriteBatchPolicy() {
+  published_flush_delay_.store(get_flush_delay(), std::memory_order_relaxed);
+}
+
+void WriteBatchPolicy::on_query(double now) {
+  if (last_query_time_ != 0.0) {
+    auto interval = clamp(now - last_query_time_, 0.0, 1.0);
+    average_query_interval_ = 0.9 * average_query_interval_ + 0.1 * interval;
+  }
+  last_query_time_ = now;
+}
+
+double WriteBatchPolicy::get_flush_delay() const {
+  if (average_query_interval_ >= MAX_FLUSH_DELAY) {
+    // queries are sparse, so waiting for the next query will not make batches bigger
+    return MIN_FLUSH_DELAY;
+  }
+  // there is no reason to wait for new queries much longer than the commit takes
+  return clamp(2 * average_commit_time_, MIN_FLUSH_DELAY, MAX_FLUSH_DELAY);
+}
+
+void WriteBatchPolicy::on_commit(size_t batch_size, double commit_time) {
+  average_commit_time_ = average_commit_time_ == 0.0 ? commit_time : 0.9 * average_commit_time_ + 0.1 * commit_time;
+
+  if (commit_time > MAX_COMMIT_TIME) {
+    // too long transactions delay all other queries
+    batch_size_limit_ = max(batch_size_limit_ / 2, MIN_BATCH_SIZE_LIMIT);
+  } else if (batch_size > batch_size_limit_) {
+    // queries come faster than they can be committed in batches of the current size
+    batch_size_limit_ = min(batch_size_limit_ * 2, MAX_BATCH_SIZE_LIMIT);
+  } else if (batch_size * 4 < batch_size_limit_) {
+    batch_size_limit_ = max(batch_size_limit_ / 2, MIN_BATCH_SIZE_LIMIT);
+  }
+
+  batch_count_.store(batch_count_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+  query_count_.store(query_count_.load(std::memory_order_relaxed) + batch_size, std::memory_order_relaxed);
+  if (batch_size > max_batch_size_.load(std::memory_order_relaxed)) {
+    max_batch_size_.store(batch_size, std::memory_order_relaxed);
+  }
+  total_commit_time_.store(total_commit_time_.load(std::memory_order_relaxed) + commit_time,
+                           std::memory_order_relaxed);
+  if (commit_time > max_commit_time_.load(std::memory_order_relaxed)) {
+    max_commit_time_.store(commit_time, std::memory_order_relaxed);
+  }
+  published_batch_size_limit_.store(batch_size_limit_, std::memory_order_relaxed);
+  published_flush_delay_.store(get_flush_delay(), std::memory_order_relaxed);
+}
+
+WriteBatchPolicy::Stats WriteBatchPolicy::get_stats() const {
+  Stats stats;
+  stats.batch_count = batch_count_.load(std::memory_order_relaxed);
+  stats.query_count = query_count_.load(std::memory_order_relaxed);
+  stats.max_batch_size = max_batch_size_.load(std::memory_order_relaxed);
+  stats.total_commit_time = total_commit_time_.load(std::memory_order_relaxed);
+  stats.max_commit_time = max_commit_time_.load(std::memory_order_relaxed);
+  stats.batch_size_limit = published_batch_size_limit_.load(std::memory_order_relaxed);
+  stats.flush_delay = published_flush_delay_.load(std::memory_order_relaxed);
+  return stats;
+}
+
+StringBuilder &operator<<(StringBuilder &string_builder, const WriteBatchPolicy::Stats &stats) {
+  auto batch_count = static_cast<double>(stats.batch_count == 0 ? 1 : stats.batch_count);
+  return string_builder << "[batches:" << stats.batch_count << "][queries:" << stats.query_count
+                        << "][average_batch_size:" << static_cast<double>(stats.query_count) / batch_count
+                        << "][max_batch_size:" << stats.max_batch_size
+                        << "][average_commit_time:" << stats.total_commit_time / batch_count
+                        << "][max_commit_time:" << stats.max_commit_time << "][batch_size_limit:"
+                        << stats.batch_size_limit << "][flush_delay:" << stats.flush_delay << ']';
+}
+
+}  // namespace td
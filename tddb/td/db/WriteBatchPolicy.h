@@ -0,0 +1,72 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2022
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#pragma once
+
+#include "td/utils/common.h"
+#include "td/utils/StringBuilder.h"
+
+#include <atomic>
+
+namespace td {
+
+// chooses size and delay of transactions, in which pending write queries are committed,
+// using observed rate of the queries and commit time
+// all methods except get_stats must be called from the thread, which commits the queries
+class WriteBatchPolicy {
+ public:
+  struct Stats {
+    uint64 batch_count = 0;
+    uint64 query_count = 0;
+    uint64 max_batch_size = 0;
+    double total_commit_time = 0.0;
+    double max_commit_time = 0.0;
+    size_t batch_size_limit = 0;
+    double flush_delay = 0.0;
+  };
+
+  WriteBatchPolicy();
+
+  // must be called for each added write query
+  void on_query(double now);
+
+  // returns true if the pending queries must be committed immediately
+  bool is_full(size_t pending_query_count) const {
+    return pending_query_count > batch_size_limit_;
+  }
+
+  // returns maximum time for which the first pending query can wait for the commit
+  double get_flush_delay() const;
+
+  void on_commit(size_t batch_size, double commit_time);
+
+  // can be called from any thread
+  Stats get_stats() const;
+
+ private:
+  static constexpr size_t MIN_BATCH_SIZE_LIMIT = 50;
+  static constexpr size_t MAX_BATCH_SIZE_LIMIT = 5000;
+  static constexpr double MIN_FLUSH_DELAY = 0.001;
+  static constexpr double MAX_FLUSH_DELAY = 0.01;
+  static constexpr double MAX_COMMIT_TIME = 0.05;
+
+  size_t batch_size_limit_ = MIN_BATCH_SIZE_LIMIT;
+  double last_query_time_ = 0.0;
+  double average_query_interval_ = MAX_FLUSH_DELAY;
+  double average_commit_time_ = 0.0;
+
+  std::atomic<uint64> batch_count_{0};
+  std::atomic<uint64> query_count_{0};
+  std::atomic<uint64> max_batch_size_{0};
+  std::atomic<double> total_commit_time_{0.0};
+  std::atomic<double> max_commit_time_{0.0};
+  std::atomic<size_t> published_batch_size_limit_{MIN_BATCH_SIZE_LIMIT};
+  std::atomic<double> published_flush_delay_{MAX_FLUSH_DELAY};
+};
+
+StringBuilder &operator<<(StringBuilder &string_builder, const WriteBatchPolicy::Stats &stats);
+
+}  // namespace td
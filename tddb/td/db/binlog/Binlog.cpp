@@ -8,12 +8,14 @@
 
 #include "td/db/binlog/detail/BinlogEventsBuffer.h"
 #include "td/db/binlog/detail/BinlogEventsProcessor.h"
+#include "td/db/DerivedKeyCache.h"
 
 #include "td/utils/buffer.h"
 #include "td/utils/format.h"
 #include "td/utils/misc.h"
 #include "td/utils/port/Clocks.h"
 #include "td/utils/port/FileFd.h"
+#include "td/utils/port/MemoryMapping.h"
 #include "td/utils/port/path.h"
 #include "td/utils/port/PollFlags.h"
 #include "td/utils/port/sleep.h"
@@ -22,10 +24,13 @@
 #include "td/utils/ScopeGuard.h"
 #include "td/utils/SliceBuilder.h"
 #include "td/utils/Status.h"
+#include "td/utils/ThreadSafeCounter.h"
 #include "td/utils/Time.h"
 #include "td/utils/tl_helpers.h"
 #include "td/utils/tl_parsers.h"
 
+#include <limits>
+
 namespace td {
 namespace detail {
 struct AesCtrEncryptionEvent {
@@ -58,11 +63,13 @@ struct AesCtrEncryptionEvent {
   BufferSlice generate_key(const DbKey &db_key) const {
     CHECK(!db_key.is_empty());
     BufferSlice key(key_size());
-    size_t iteration_count = kdf_iteration_count();
     if (db_key.is_raw_key()) {
-      iteration_count = kdf_fast_iteration_count();
+      pbkdf2_sha256(db_key.data(), key_salt_.as_slice(), narrow_cast<int>(kdf_fast_iteration_count()), key.as_slice());
+    } else {
+      // the slow derivation is done once per process for every password and salt
+      DerivedKeyCache::pbkdf2(DerivedKeyCache::Hash::Sha256, db_key.data(), key_salt_.as_slice(),
+                              narrow_cast<int>(kdf_iteration_count()), key.as_slice());
     }
-    pbkdf2_sha256(db_key.data(), key_salt_.as_slice(), narrow_cast<int>(iteration_count), key.as_slice());
     return key;
   }
 
@@ -156,6 +163,104 @@ class BinlogReader {
   bool is_encrypted_{false};
 };
 
+// writes events to a new binlog file in chunks
+class BinlogCompactor {
+ public:
+  BinlogCompactor(FileFd fd, string path) : fd_(std::move(fd)), path_(std::move(path)) {
+    reader_ = writer_.extract_reader();
+    fd_.set_output_reader(&reader_);
+  }
+
+  void init_encryption(BufferSlice &&encryption_event, AesCtrState &&aes_ctr_state) {
+    // the encryption event itself isn't encrypted
+    add_event(std::move(encryption_event));
+    write(std::numeric_limits<size_t>::max());
+    flush();
+
+    byte_flow_source_ = ByteFlowSource(&reader_);
+    aes_xcode_byte_flow_.init(std::move(aes_ctr_state));
+    byte_flow_source_ >> aes_xcode_byte_flow_ >> byte_flow_sink_;
+    is_encrypted_ = true;
+    fd_.set_output_reader(byte_flow_sink_.get_output());
+  }
+
+  void add_event(BufferSlice &&raw_event) {
+    events_.push_back(std::move(raw_event));
+  }
+
+  bool is_finished() const {
+    return next_event_ == events_.size();
+  }
+
+  // writes events of total size at least max_size or until all added events are written
+  void write(size_t max_size) {
+    size_t written_size = 0;
+    while (next_event_ < events_.size() && written_size < max_size) {
+      auto &raw_event = events_[next_event_++];
+      if (is_encrypted_) {
+        writer_.append(raw_event.as_slice());
+      } else {
+        writer_.append(raw_event.clone());
+      }
+      written_size += raw_event.size();
+      size_ += static_cast<int64>(raw_event.size());
+      event_count_++;
+      raw_event = BufferSlice();
+    }
+    if (next_event_ == events_.size()) {
+      events_.clear();
+      next_event_ = 0;
+    }
+    flush();
+  }
+
+  void sync() {
+    flush();
+    auto status = fd_.sync();
+    LOG_IF(FATAL, status.is_error()) << "Failed to sync new binlog: " << status;
+  }
+
+  const string &get_path() const {
+    return path_;
+  }
+  int64 get_size() const {
+    return size_;
+  }
+  uint64 get_event_count() const {
+    return event_count_;
+  }
+
+  BufferedFdBase<FileFd> move_fd() {
+    return std::move(fd_);
+  }
+  AesCtrState move_aes_ctr_state() {
+    return aes_xcode_byte_flow_.move_aes_ctr_state();
+  }
+
+ private:
+  BufferedFdBase<FileFd> fd_;
+  string path_;
+  ChainBufferWriter writer_;
+  ChainBufferReader reader_;
+  bool is_encrypted_ = false;
+  ByteFlowSource byte_flow_source_;
+  AesCtrByteFlow aes_xcode_byte_flow_;
+  ByteFlowSink byte_flow_sink_;
+
+  std::vector<BufferSlice> events_;
+  size_t next_event_ = 0;
+  int64 size_ = 0;
+  uint64 event_count_ = 0;
+
+  void flush() {
+    if (is_encrypted_) {
+      byte_flow_source_.wakeup();
+    }
+    fd_.flush_write().ensure();
+    LOG_IF(FATAL, fd_.need_flush_write()) << "Failed to flush new binlog";
+  }
+};
+
 static int64 file_size(CSlice path) {
   auto r_stat = stat(path);
   if (r_stat.is_error()) {
@@ -228,6 +333,7 @@ void Binlog::add_event(BinlogEvent &&event) {
   if (event.size_ % 4 != 0) {
     LOG(FATAL) << "Trying to add event with bad size " << event.public_to_string();
   }
+  auto event_size = event.size_;
 
   if (!events_buffer_) {
     do_add_event(std::move(event));
@@ -237,21 +343,46 @@ void Binlog::add_event(BinlogEvent &&event) {
   lazy_flush();
 
   if (state_ == State::Run) {
+    if (compactor_ != nullptr) {
+      // copy at least twice more than was added to guarantee that the compaction will finish
+      continue_compaction(2 * static_cast<size_t>(event_size));
+      return;
+    }
+
     auto fd_size = fd_size_;
     if (events_buffer_) {
       fd_size += events_buffer_->size();
     }
-    auto need_reindex = [&](int64 min_size, int rate) {
-      return fd_size > min_size && fd_size / rate > processor_->total_raw_events_size();
-    };
-    if (need_reindex(50000, 5) || need_reindex(100000, 4) || need_reindex(300000, 3) || need_reindex(500000, 2)) {
+    if (need_compaction(fd_size)) {
       LOG(INFO) << tag("fd_size", format::as_size(fd_size))
                 << tag("total events size", format::as_size(processor_->total_raw_events_size()));
-      do_reindex();
+      if (fd_size > compaction_options_.incremental_min_size) {
+        start_compaction();
+      } else {
+        do_reindex();
+      }
     }
   }
 }
 
+bool Binlog::need_compaction(int64 fd_size) const {
+  auto live_size = processor_->total_raw_events_size();
+  if (fd_size <= compaction_options_.min_size) {
+    return false;
+  }
+  if (compaction_options_.max_dead_size > 0 && fd_size - live_size > compaction_options_.max_dead_size) {
+    return true;
+  }
+  if (compaction_options_.max_dead_to_live_ratio > 0) {
+    return static_cast<double>(fd_size - live_size) >
+           static_cast<double>(live_size) * compaction_options_.max_dead_to_live_ratio;
+  }
+  auto need_reindex = [&](int64 min_size, int rate) {
+    return fd_size > min_size && fd_size / rate > live_size;
+  };
+  return need_reindex(50000, 5) || need_reindex(100000, 4) || need_reindex(300000, 3) || need_reindex(500000, 2);
+}
+
 size_t Binlog::flush_events_buffer(bool force) {
   if (!events_buffer_) {
     return 0;
@@ -283,6 +414,10 @@ Status Binlog::close(bool need_sync) {
   if (fd_.empty()) {
     return Status::OK();
   }
+  if (need_sync) {
+    compact_on_close();
+  }
+  cancel_compaction();
   if (need_sync) {
     sync();
   } else {
@@ -303,6 +438,7 @@ void Binlog::close(Promise<> promise) {
 }
 
 void Binlog::change_key(DbKey new_db_key) {
+  cancel_compaction();
   db_key_ = std::move(new_db_key);
   aes_ctr_key_salt_ = BufferSlice();
   do_reindex();
@@ -332,6 +468,13 @@ void Binlog::do_event(BinlogEvent &&event) {
     }
     VLOG(binlog) << "Write binlog event: " << format::cond(state_ == State::Reindex, "[reindex] ")
                  << event.public_to_string();
+    static auto event_counter = NamedThreadSafeCounter::get_default().get_counter("binlog_written_events");
+    static auto size_counter = NamedThreadSafeCounter::get_default().get_counter("binlog_written_bytes");
+    event_counter.add(1);
+    size_counter.add(static_cast<int64>(event_size));
+    if (compactor_ != nullptr) {
+      compactor_->add_event(event.raw_event_.clone());
+    }
     switch (encryption_type_) {
       case EncryptionType::None: {
         buffer_writer_.append(event.raw_event_.clone());
@@ -508,6 +651,33 @@ Status Binlog::load_binlog(const Callback &callback, const Callback &debug_callb
 
   update_read_encryption();
 
+  // big binlogs are mapped into memory and fed to the reader in big chunks instead of small reads,
+  // so events are almost never split between chain buffer nodes and aren't copied once more to be glued
+  TRY_RESULT(file_size, fd_.get_size());
+  Result<MemoryMapping> r_mapping = Status::Error("Binlog isn't mapped");
+  if (file_size >= REPLAY_MAPPING_MIN_SIZE) {
+    r_mapping = MemoryMapping::create_from_file(fd_);
+    if (r_mapping.is_error()) {
+      LOG(INFO) << "Failed to map binlog " << path_ << ": " << r_mapping.error();
+    }
+  }
+  Slice mapped_data;
+  if (r_mapping.is_ok()) {
+    mapped_data = r_mapping.ok().as_slice();
+    // the file descriptor must be positioned after the data as if it was read
+    TRY_STATUS(fd_.seek(narrow_cast<int64>(mapped_data.size())));
+  }
+  auto read_more = [&](size_t need_size) -> Status {
+    if (r_mapping.is_ok()) {
+      auto chunk = mapped_data.substr(0, max(need_size, static_cast<size_t>(REPLAY_CHUNK_SIZE)));
+      mapped_data.remove_prefix(chunk.size());
+      buffer_writer_.append(chunk);
+      return Status::OK();
+    }
+    TRY_STATUS(fd_.flush_read(max(need_size, static_cast<size_t>(4096))));
+    return Status::OK();
+  };
+
   fd_.get_poll_info().add_flags(PollFlags::Read());
   info_.wrong_password = false;
   while (true) {
@@ -540,7 +710,7 @@ Status Binlog::load_binlog(const Callback &callback, const Callback &debug_callb
         return Status::OK();
       }
     } else {
-      TRY_STATUS(fd_.flush_read(max(need_size, static_cast<size_t>(4096))));
+      TRY_STATUS(read_more(need_size));
       buffer_reader_.sync_with_writer();
       if (byte_flow_flag_) {
         byte_flow_source_.wakeup();
@@ -569,6 +739,7 @@ Status Binlog::load_binlog(const Callback &callback, const Callback &debug_callb
   LOG_CHECK(fd_size_ == offset) << fd_size << " " << fd_size_ << " " << offset;
   binlog_reader_ptr_ = nullptr;
   state_ = State::Run;
+  r_mapping = Status::Error("Binlog isn't mapped");
 
   buffer_writer_ = ChainBufferWriter();
   buffer_reader_ = buffer_writer_.extract_reader();
@@ -622,6 +793,7 @@ void Binlog::reset_encryption() {
 }
 
 void Binlog::do_reindex() {
+  cancel_compaction();
   flush_events_buffer(true);
   // start reindex
   CHECK(state_ == State::Run);
@@ -708,6 +880,118 @@ void Binlog::do_reindex() {
   update_write_encryption();
 }
 
+void Binlog::start_compaction() {
+  CHECK(state_ == State::Run);
+  CHECK(compactor_ == nullptr);
+  flush_events_buffer(true);
+
+  string new_path = path_ + ".new";
+  auto r_opened_file = open_binlog(new_path, FileFd::Flags::Write | FileFd::Flags::Create | FileFd::Truncate);
+  if (r_opened_file.is_error()) {
+    LOG(ERROR) << "Can't open new binlog for compaction: " << r_opened_file.error();
+    return;
+  }
+  LOG(INFO) << "Start incremental compaction of " << tag("name", path_) << tag("size", format::as_size(fd_size_));
+  compactor_ = td::make_unique<detail::BinlogCompactor>(r_opened_file.move_as_ok(), std::move(new_path));
+
+  if (encryption_type_ == EncryptionType::AesCtr) {
+    // continue to use the same key, but with a new IV
+    using EncryptionEvent = detail::AesCtrEncryptionEvent;
+    EncryptionEvent event;
+    event.key_salt_ = aes_ctr_key_salt_.clone();
+    event.iv_ = BufferSlice(EncryptionEvent::iv_size());
+    Random::secure_bytes(event.iv_.as_slice());
+    event.key_hash_ = EncryptionEvent::generate_hash(as_slice(aes_ctr_key_));
+
+    AesCtrState aes_ctr_state;
+    aes_ctr_state.init(as_slice(aes_ctr_key_), event.iv_.as_slice());
+    compactor_->init_encryption(
+        BinlogEvent::create_raw(0, BinlogEvent::ServiceTypes::AesCtrEncryption, 0, create_default_storer(event)),
+        std::move(aes_ctr_state));
+  }
+
+  // references to the current live events; events added later are appended by do_event
+  processor_->for_each([&](BinlogEvent &event) { compactor_->add_event(event.raw_event_.clone()); });
+}
+
+void Binlog::compaction_step() {
+  if (compactor_ != nullptr && state_ == State::Run) {
+    continue_compaction(COMPACTION_STEP_SIZE);
+  }
+}
+
+void Binlog::continue_compaction(size_t max_size) {
+  CHECK(compactor_ != nullptr);
+  compactor_->write(max(max_size, static_cast<size_t>(1)));
+  if (compactor_->is_finished()) {
+    finish_compaction();
+  }
+}
+
+void Binlog::finish_compaction() {
+  auto start_size = fd_size_;
+  auto start_events = fd_events_;
+
+  // all events are already written to the new file, so unflushed data of the old file can be dropped
+  compactor_->sync();
+  auto new_path = compactor_->get_path();
+  auto old_fd = std::move(fd_);  // can't close fd_ now, because it will release file lock
+  fd_ = compactor_->move_fd();
+  fd_size_ = compactor_->get_size();
+  fd_events_ = compactor_->get_event_count();
+  if (encryption_type_ == EncryptionType::AesCtr) {
+    aes_ctr_state_ = compactor_->move_aes_ctr_state();
+  }
+  compactor_ = nullptr;
+  need_sync_ = false;
+  need_flush_since_ = 0;
+
+  auto status = unlink(path_);
+  LOG_IF(FATAL, status.is_error()) << "Failed to unlink old binlog: " << status;
+  old_fd.close();  // now we can close old file and release the system lock
+  status = rename(new_path, path_);
+  FileFd::remove_local_lock(new_path);  // now we can release local lock for temporary file
+  LOG_IF(FATAL, status.is_error()) << "Failed to rename binlog: " << status;
+
+  LOG(INFO) << "Finish incremental compaction of " << tag("name", path_)
+            << tag("before_size", format::as_size(start_size)) << tag("after_size", format::as_size(fd_size_))
+            << tag("before_events", start_events) << tag("after_events", fd_events_);
+
+  buffer_writer_ = ChainBufferWriter();
+  buffer_reader_ = buffer_writer_.extract_reader();
+  update_write_encryption();
+}
+
+void Binlog::cancel_compaction() {
+  if (compactor_ == nullptr) {
+    return;
+  }
+  auto new_path = compactor_->get_path();
+  compactor_->move_fd().close();
+  compactor_ = nullptr;
+  FileFd::remove_local_lock(new_path);
+  unlink(new_path).ignore();
+  LOG(INFO) << "Cancel incremental compaction of " << tag("name", path_);
+}
+
+void Binlog::compact_on_close() {
+  if (state_ != State::Run || compaction_options_.max_close_compaction_size <= 0) {
+    return;
+  }
+  flush_events_buffer(true);
+  auto live_size = processor_->total_raw_events_size();
+  if (live_size > compaction_options_.max_close_compaction_size) {
+    return;
+  }
+  if (compactor_ != nullptr) {
+    continue_compaction(std::numeric_limits<size_t>::max());
+    return;
+  }
+  if (fd_size_ - live_size >= max(live_size / 2, static_cast<int64>(1 << 16))) {
+    do_reindex();
+  }
+}
+
 string Binlog::debug_get_binlog_data(int64 begin_offset, int64 end_offset) {
   if (begin_offset > end_offset) {
     return "Begin offset is bigger than end_offset";
@@ -36,12 +36,22 @@ struct BinlogInfo {
   bool is_encrypted{false};
   bool wrong_password{false};
   bool is_opened{false};
+
+  // group commit statistics, which are collected only by ConcurrentBinlog
+  uint64 sync_count{0};
+  uint64 synced_request_count{0};  // number of sync requests, completed by the syncs
+  uint64 max_sync_batch_size{0};
+  double total_sync_time{0.0};
+  double max_sync_time{0.0};
+  double total_sync_latency{0.0};  // total time from a sync request to its completion
+  double max_sync_latency{0.0};
 };
 
 namespace detail {
 class BinlogReader;
 class BinlogEventsProcessor;
 class BinlogEventsBuffer;
+class BinlogCompactor;
 }  // namespace detail
 
 class Binlog {
@@ -99,6 +109,32 @@ class Binlog {
   }
 
   void add_event(BinlogEvent &&event);
+
+  // Binlog is compacted when it is bigger than min_size and either the ratio of dead bytes to live bytes is bigger
+  // than max_dead_to_live_ratio, or the total size of dead events is bigger than max_dead_size.
+  // Zero max_dead_to_live_ratio means a size-dependent ratio from 4 for small binlogs to 1 for binlogs over 500KB;
+  // zero max_dead_size disables the absolute limit.
+  // Binlogs bigger than incremental_min_size are compacted incrementally: live events are copied to a new file
+  // in chunks between writes of new events, and the new file replaces the old one after all events are copied.
+  struct CompactionOptions {
+    int64 min_size = 50000;
+    double max_dead_to_live_ratio = 0.0;
+    int64 max_dead_size = 0;
+    int64 incremental_min_size = 1 << 22;
+    // the binlog is fully replayed on every start, so on a clean close it is compacted if the wasted space is at
+    // least a half of the live size and the live size doesn't exceed the limit; zero disables the compaction
+    int64 max_close_compaction_size = 1 << 24;
+  };
+  void set_compaction_options(const CompactionOptions &options) {
+    compaction_options_ = options;
+  }
+  bool is_compaction_in_progress() const {
+    return compactor_ != nullptr;
+  }
+  // copies next chunk of events to the new binlog; there is no need to call it, because compaction also progresses
+  // on every added event, but calling it when idle makes the compaction finish faster
+  void compaction_step();
+
   void sync();
   void flush();
   void lazy_flush();
@@ -148,18 +184,30 @@ class Binlog {
   std::vector<BinlogEvent> pending_events_;
   unique_ptr<detail::BinlogEventsProcessor> processor_;
   unique_ptr<detail::BinlogEventsBuffer> events_buffer_;
+  unique_ptr<detail::BinlogCompactor> compactor_;
+  CompactionOptions compaction_options_;
   bool in_flush_events_buffer_{false};
   uint64 last_id_{0};
   double need_flush_since_ = 0;
   bool need_sync_{false};
   enum class State { Empty, Load, Reindex, Run } state_{State::Empty};
 
+  static constexpr size_t COMPACTION_STEP_SIZE = 1 << 20;
+  static constexpr int64 REPLAY_MAPPING_MIN_SIZE = 1 << 20;
+  static constexpr size_t REPLAY_CHUNK_SIZE = 1 << 20;
+
   static Result<FileFd> open_binlog(const string &path, int32 flags);
   size_t flush_events_buffer(bool force);
   void do_add_event(BinlogEvent &&event);
   void do_event(BinlogEvent &&event);
   Status load_binlog(const Callback &callback, const Callback &debug_callback = Callback()) TD_WARN_UNUSED_RESULT;
   void do_reindex();
+  bool need_compaction(int64 fd_size) const;
+  void start_compaction();
+  void continue_compaction(size_t max_size);
+  void finish_compaction();
+  void cancel_compaction();
+  void compact_on_close();
 
   void update_encryption(Slice key, Slice iv);
   void reset_encryption();
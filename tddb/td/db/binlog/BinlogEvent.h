@@ -76,10 +76,11 @@ struct BinlogEvent {
   bool empty() const {
     return raw_event_.empty();
   }
+  // returns a view of the same event data; CRC of the event was already checked when it was read
   BinlogEvent clone() const {
     BinlogEvent result;
     result.debug_info_ = BinlogDebugInfo{__FILE__, __LINE__};
-    result.init(raw_event_.clone()).ensure();
+    result.init(raw_event_.clone(), false).ensure();
     return result;
   }
 
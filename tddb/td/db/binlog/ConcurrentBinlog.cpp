@@ -48,14 +48,16 @@ class BinlogActor final : public Actor {
     });
     flush_immediate_sync();
     try_flush();
+    try_compact();
   }
 
   void force_sync(Promise<> &&promise) {
     auto seq_no = processor_.max_unfinished_seq_no();
+    SyncRequest request{std::move(promise), Time::now_cached()};
     if (processor_.max_finished_seq_no() == seq_no) {
-      do_immediate_sync(std::move(promise));
+      do_immediate_sync(std::move(request));
     } else {
-      immediate_sync_promises_.emplace(seq_no, std::move(promise));
+      immediate_sync_requests_.emplace(seq_no, std::move(request));
     }
   }
 
@@ -70,20 +72,55 @@ class BinlogActor final : public Actor {
     promise.set_value(Unit());
   }
 
+  void get_info(Promise<BinlogInfo> promise) {
+    auto info = binlog_->get_info();
+    info.sync_count = sync_stats_.sync_count;
+    info.synced_request_count = sync_stats_.synced_request_count;
+    info.max_sync_batch_size = sync_stats_.max_sync_batch_size;
+    info.total_sync_time = sync_stats_.total_sync_time;
+    info.max_sync_time = sync_stats_.max_sync_time;
+    info.total_sync_latency = sync_stats_.total_sync_latency;
+    info.max_sync_latency = sync_stats_.max_sync_latency;
+    promise.set_value(std::move(info));
+  }
+
  private:
   unique_ptr<Binlog> binlog_;
 
   OrderedEventsProcessor<Event> processor_;
 
-  std::multimap<uint64, Promise<>> immediate_sync_promises_;
-  std::vector<Promise<>> sync_promises_;
+  struct SyncRequest {
+    Promise<> promise;
+    double request_time;
+  };
+
+  struct SyncStats {
+    uint64 sync_count = 0;
+    uint64 synced_request_count = 0;
+    uint64 max_sync_batch_size = 0;
+    double total_sync_time = 0.0;
+    double max_sync_time = 0.0;
+    double total_sync_latency = 0.0;
+    double max_sync_latency = 0.0;
+  };
+
+  std::multimap<uint64, SyncRequest> immediate_sync_requests_;
+  std::vector<SyncRequest> sync_requests_;
+  SyncStats sync_stats_;
   bool force_sync_flag_ = false;
   bool lazy_sync_flag_ = false;
   bool flush_flag_ = false;
+  bool compaction_flag_ = false;
   double wakeup_at_ = 0;
 
   static constexpr double FLUSH_TIMEOUT = 0.001;  // 1ms
 
+  // delay between background compaction steps, which allows to process new events in between
+  static constexpr double COMPACTION_STEP_DELAY = 0.001;  // 1ms
+
+  // all sync requests received during the window after the first one are completed by a single sync
+  static constexpr double GROUP_COMMIT_WINDOW = 0.003;  // 3ms
+
   void wakeup_after(double after) {
     auto now = Time::now_cached();
     wakeup_at(now + after);
@@ -113,21 +150,28 @@ class BinlogActor final : public Actor {
     }
   }
 
+  void try_compact() {
+    if (!compaction_flag_ && binlog_->is_compaction_in_progress()) {
+      compaction_flag_ = true;
+      wakeup_after(COMPACTION_STEP_DELAY);
+    }
+  }
+
   void flush_immediate_sync() {
     auto seq_no = processor_.max_finished_seq_no();
-    for (auto it = immediate_sync_promises_.begin(), end = immediate_sync_promises_.end();
-         it != end && it->first <= seq_no; it = immediate_sync_promises_.erase(it)) {
+    for (auto it = immediate_sync_requests_.begin(), end = immediate_sync_requests_.end();
+         it != end && it->first <= seq_no; it = immediate_sync_requests_.erase(it)) {
       do_immediate_sync(std::move(it->second));
     }
   }
 
-  void do_immediate_sync(Promise<> &&promise) {
-    if (promise) {
-      sync_promises_.emplace_back(std::move(promise));
+  void do_immediate_sync(SyncRequest &&request) {
+    if (request.promise) {
+      sync_requests_.push_back(std::move(request));
     }
     if (!force_sync_flag_) {
       force_sync_flag_ = true;
-      wakeup_after(0.003);
+      wakeup_after(GROUP_COMMIT_WINDOW);
     }
   }
 
@@ -135,7 +179,7 @@ class BinlogActor final : public Actor {
     if (!promise) {
       return;
     }
-    sync_promises_.emplace_back(std::move(promise));
+    sync_requests_.push_back(SyncRequest{std::move(promise), Time::now_cached()});
     if (!lazy_sync_flag_ && !force_sync_flag_) {
       wakeup_after(30);
       lazy_sync_flag_ = true;
@@ -148,19 +192,42 @@ class BinlogActor final : public Actor {
     force_sync_flag_ = false;
     bool need_flush = flush_flag_;
     flush_flag_ = false;
+    bool need_compaction_step = compaction_flag_;
+    compaction_flag_ = false;
     wakeup_at_ = 0;
+    if (need_compaction_step) {
+      binlog_->compaction_step();
+      try_compact();
+    }
     if (need_sync) {
-      binlog_->sync();
-      // LOG(ERROR) << "BINLOG SYNC";
-      for (auto &promise : sync_promises_) {
-        promise.set_value(Unit());
-      }
-      sync_promises_.clear();
+      do_sync();
     } else if (need_flush) {
       try_flush();
       // LOG(ERROR) << "BINLOG FLUSH";
     }
   }
+
+  void do_sync() {
+    auto start_time = Time::now();
+    binlog_->sync();
+    auto finish_time = Time::now();
+
+    auto sync_time = finish_time - start_time;
+    sync_stats_.sync_count++;
+    sync_stats_.total_sync_time += sync_time;
+    sync_stats_.max_sync_time = max(sync_stats_.max_sync_time, sync_time);
+    sync_stats_.synced_request_count += sync_requests_.size();
+    sync_stats_.max_sync_batch_size = max(sync_stats_.max_sync_batch_size, static_cast<uint64>(sync_requests_.size()));
+    for (auto &request : sync_requests_) {
+      auto latency = finish_time - request.request_time;
+      sync_stats_.total_sync_latency += latency;
+      sync_stats_.max_sync_latency = max(sync_stats_.max_sync_latency, latency);
+      request.promise.set_value(Unit());
+    }
+    sync_requests_.clear();
+    VLOG(binlog) << "Synced " << sync_stats_.sync_count << " times in " << sync_stats_.total_sync_time
+                 << " seconds, completing " << sync_stats_.synced_request_count << " requests";
+  }
 };
 }  // namespace detail
 
@@ -204,4 +271,7 @@ void ConcurrentBinlog::force_flush() {
 void ConcurrentBinlog::change_key(DbKey db_key, Promise<> promise) {
   send_closure(binlog_actor_, &detail::BinlogActor::change_key, std::move(db_key), std::move(promise));
 }
+void ConcurrentBinlog::get_info(Promise<BinlogInfo> promise) {
+  send_closure(binlog_actor_, &detail::BinlogActor::get_info, std::move(promise));
+}
 }  // namespace td
@@ -45,6 +45,9 @@ class ConcurrentBinlog final : public BinlogInterface {
   void force_flush() final;
   void change_key(DbKey db_key, Promise<> promise) final;
 
+  // returns current binlog info with group commit statistics
+  void get_info(Promise<BinlogInfo> promise);
+
   uint64 next_id() final {
     return last_id_.fetch_add(1, std::memory_order_relaxed);
   }
@@ -42,7 +42,57 @@ Status RawSqliteDb::last_error() {
   return last_error(db_, path());
 }
 
+sqlite3_stmt *RawSqliteDb::get_cached_statement(CSlice sql) {
+  auto it = cached_statement_by_sql_.find(sql.str());
+  if (it == cached_statement_by_sql_.end()) {
+    statement_cache_miss_count_++;
+    return nullptr;
+  }
+  statement_cache_hit_count_++;
+  auto stmt = it->second->stmt;
+  cached_statements_.erase(it->second);
+  cached_statement_by_sql_.erase(it);
+  return stmt;
+}
+
+void RawSqliteDb::return_statement(sqlite3_stmt *stmt) {
+  CHECK(stmt != nullptr);
+  sqlite3_reset(stmt);
+  sqlite3_clear_bindings(stmt);
+  string sql = sqlite3_sql(stmt);
+  if (cached_statement_by_sql_.count(sql) != 0) {
+    // the same query was used simultaneously; one unused statement is enough
+    sqlite3_finalize(stmt);
+    return;
+  }
+  cached_statements_.push_front(CachedStatement{sql, stmt});
+  cached_statement_by_sql_.emplace(std::move(sql), cached_statements_.begin());
+  if (cached_statements_.size() > MAX_CACHED_STATEMENTS) {
+    auto &oldest = cached_statements_.back();
+    cached_statement_by_sql_.erase(oldest.sql);
+    sqlite3_finalize(oldest.stmt);
+    cached_statements_.pop_back();
+  }
+}
+
+void RawSqliteDb::clear_statement_cache() {
+  for (auto &cached_statement : cached_statements_) {
+    sqlite3_finalize(cached_statement.stmt);
+  }
+  cached_statements_.clear();
+  cached_statement_by_sql_.clear();
+}
+
+RawSqliteDb::StatementCacheStats RawSqliteDb::get_statement_cache_stats() const {
+  StatementCacheStats stats;
+  stats.hit_count = statement_cache_hit_count_;
+  stats.miss_count = statement_cache_miss_count_;
+  stats.size = cached_statements_.size();
+  return stats;
+}
+
 RawSqliteDb::~RawSqliteDb() {
+  clear_statement_cache();
   auto rc = sqlite3_close(db_);
   LOG_IF(FATAL, rc != SQLITE_OK) << last_error(db_, path());
 }
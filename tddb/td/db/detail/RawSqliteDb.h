@@ -6,12 +6,17 @@
 //
 #pragma once
 
+#include "td/utils/common.h"
 #include "td/utils/optional.h"
 #include "td/utils/Slice.h"
 #include "td/utils/SliceBuilder.h"
 #include "td/utils/Status.h"
 
+#include <list>
+#include <unordered_map>
+
 struct sqlite3;
+struct sqlite3_stmt;
 
 namespace td {
 namespace detail {
@@ -65,11 +70,39 @@ class RawSqliteDb {
     return cipher_version_.copy();
   }
 
+  struct StatementCacheStats {
+    uint64 hit_count = 0;
+    uint64 miss_count = 0;
+    size_t size = 0;
+  };
+
+  // returns an unused prepared statement with the given text or nullptr, if there is none
+  sqlite3_stmt *get_cached_statement(CSlice sql);
+
+  // takes ownership of a statement, which isn't used anymore
+  void return_statement(sqlite3_stmt *stmt);
+
+  void clear_statement_cache();
+
+  StatementCacheStats get_statement_cache_stats() const;
+
  private:
+  static constexpr size_t MAX_CACHED_STATEMENTS = 64;
+
   sqlite3 *db_;
   std::string path_;
   size_t begin_cnt_{0};
   optional<int32> cipher_version_;
+
+  struct CachedStatement {
+    std::string sql;
+    sqlite3_stmt *stmt;
+  };
+  // the most recently returned statements are in the front
+  std::list<CachedStatement> cached_statements_;
+  std::unordered_map<std::string, std::list<CachedStatement>::iterator> cached_statement_by_sql_;
+  uint64 statement_cache_hit_count_ = 0;
+  uint64 statement_cache_miss_count_ = 0;
 };
 
 }  // namespace detail
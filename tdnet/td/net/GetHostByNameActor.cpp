@@ -23,21 +23,23 @@ namespace detail {
 
 class GoogleDnsResolver final : public Actor {
  public:
-  GoogleDnsResolver(std::string host, bool prefer_ipv6, Promise<IPAddress> promise)
+  GoogleDnsResolver(std::string host, bool prefer_ipv6, Promise<DnsResolverResult> promise)
       : host_(std::move(host)), prefer_ipv6_(prefer_ipv6), promise_(std::move(promise)) {
   }
 
  private:
   std::string host_;
   bool prefer_ipv6_;
-  Promise<IPAddress> promise_;
+  Promise<DnsResolverResult> promise_;
   ActorOwn<Wget> wget_;
   double begin_time_ = 0;
 
   void start_up() final {
     auto r_address = IPAddress::get_ip_address(host_);
     if (r_address.is_ok()) {
-      promise_.set_value(r_address.move_as_ok());
+      DnsResolverResult result;
+      result.ip_address = r_address.move_as_ok();
+      promise_.set_value(std::move(result));
       return stop();
     }
 
@@ -54,7 +56,7 @@ class GoogleDnsResolver final : public Actor {
         SslStream::VerifyPeer::Off);
   }
 
-  static Result<IPAddress> get_ip_address(Result<unique_ptr<HttpQuery>> r_http_query) {
+  static Result<DnsResolverResult> get_ip_address(Result<unique_ptr<HttpQuery>> r_http_query, bool prefer_ipv6) {
     TRY_RESULT(http_query, std::move(r_http_query));
     TRY_RESULT(json_value, json_decode(http_query->content_));
     if (json_value.type() != JsonValue::Type::Object) {
@@ -65,22 +67,34 @@ class GoogleDnsResolver final : public Actor {
     if (array.empty()) {
       return Status::Error("Failed to parse DNS result: Answer is an empty array");
     }
-    if (array[0].type() != JsonValue::Type::Object) {
-      return Status::Error("Failed to parse DNS result: Answer[0] is not an object");
+    // the answer can begin with CNAME records, which must be skipped
+    const int32 expected_type = prefer_ipv6 ? 28 : 1;
+    for (auto &record : array) {
+      if (record.type() != JsonValue::Type::Object) {
+        return Status::Error("Failed to parse DNS result: Answer record is not an object");
+      }
+      auto &record_object = record.get_object();
+      TRY_RESULT(type, get_json_object_int_field(record_object, "type", false));
+      if (type != expected_type) {
+        continue;
+      }
+      TRY_RESULT(ip_str, get_json_object_string_field(record_object, "data", false));
+      TRY_RESULT(ttl, get_json_object_int_field(record_object, "TTL", true, 0));
+      DnsResolverResult result;
+      TRY_STATUS(result.ip_address.init_host_port(ip_str, 0));
+      result.ttl = max(ttl, 0);
+      return std::move(result);
     }
-    auto &answer_0 = array[0].get_object();
-    TRY_RESULT(ip_str, get_json_object_string_field(answer_0, "data", false));
-    IPAddress ip;
-    TRY_STATUS(ip.init_host_port(ip_str, 0));
-    return ip;
+    return Status::Error("Failed to parse DNS result: Answer has no address records");
   }
 
   void on_result(Result<unique_ptr<HttpQuery>> r_http_query) {
     auto end_time = Time::now();
-    auto result = get_ip_address(std::move(r_http_query));
+    auto result = get_ip_address(std::move(r_http_query), prefer_ipv6_);
     VLOG(dns_resolver) << "Init IPv" << (prefer_ipv6_ ? "6" : "4") << " host = " << host_ << " in "
                        << end_time - begin_time_ << " seconds to "
-                       << (result.is_ok() ? (PSLICE() << result.ok()) : CSlice("[invalid]"));
+                       << (result.is_ok() ? (PSLICE() << result.ok().ip_address << " with TTL " << result.ok().ttl)
+                                          : CSlice("[invalid]"));
     promise_.set_result(std::move(result));
     stop();
   }
@@ -88,14 +102,14 @@ class GoogleDnsResolver final : public Actor {
 
 class NativeDnsResolver final : public Actor {
  public:
-  NativeDnsResolver(std::string host, bool prefer_ipv6, Promise<IPAddress> promise)
+  NativeDnsResolver(std::string host, bool prefer_ipv6, Promise<DnsResolverResult> promise)
       : host_(std::move(host)), prefer_ipv6_(prefer_ipv6), promise_(std::move(promise)) {
   }
 
  private:
   std::string host_;
   bool prefer_ipv6_;
-  Promise<IPAddress> promise_;
+  Promise<DnsResolverResult> promise_;
 
   void start_up() final {
     IPAddress ip;
@@ -106,7 +120,10 @@ class NativeDnsResolver final : public Actor {
     if (status.is_error()) {
       promise_.set_error(std::move(status));
     } else {
-      promise_.set_value(std::move(ip));
+      // the system resolver doesn't return TTL of the records
+      DnsResolverResult result;
+      result.ip_address = std::move(ip);
+      promise_.set_value(std::move(result));
     }
     stop();
   }
@@ -132,30 +149,45 @@ void GetHostByNameActor::run(string host, int port, bool prefer_ipv6, Promise<IP
   auto ascii_host = r_ascii_host.move_as_ok();
 
   auto begin_time = Time::now();
-  auto &value = cache_[prefer_ipv6].emplace(ascii_host, Value{{}, begin_time - 1.0}).first->second;
+  auto &value =
+      cache_[prefer_ipv6].emplace(ascii_host, Value{{}, begin_time - 1.0, begin_time - 1.0}).first->second;
   if (value.expires_at > begin_time) {
+    if (value.ip.is_ok() && value.refresh_at <= begin_time && active_queries_[prefer_ipv6].count(ascii_host) == 0) {
+      // the host is still used, so refresh the result in background before it expires
+      VLOG(dns_resolver) << "Refresh host = " << host << " in background";
+      start_query(ascii_host, host, prefer_ipv6);
+    }
     return promise.set_result(value.get_ip_port(port));
   }
 
-  auto &query = active_queries_[prefer_ipv6][ascii_host];
-  query.promises.emplace_back(port, std::move(promise));
-  if (query.query.empty()) {
-    CHECK(query.promises.size() == 1);
-    query.real_host = std::move(host);
-    query.begin_time = Time::now();
-    run_query(std::move(ascii_host), prefer_ipv6, query);
+  auto query_it = active_queries_[prefer_ipv6].find(ascii_host);
+  if (query_it == active_queries_[prefer_ipv6].end()) {
+    start_query(ascii_host, std::move(host), prefer_ipv6);
+    query_it = active_queries_[prefer_ipv6].find(ascii_host);
+    CHECK(query_it != active_queries_[prefer_ipv6].end());
   }
+  query_it->second.promises.emplace_back(port, std::move(promise));
+}
+
+void GetHostByNameActor::start_query(std::string host, string real_host, bool prefer_ipv6) {
+  auto &query = active_queries_[prefer_ipv6][host];
+  CHECK(query.resolvers.empty());
+  query.query_id = ++last_query_id_;
+  query.real_host = std::move(real_host);
+  query.begin_time = Time::now();
+  start_next_resolver(std::move(host), prefer_ipv6, query);
 }
 
-void GetHostByNameActor::run_query(std::string host, bool prefer_ipv6, Query &query) {
-  auto promise = PromiseCreator::lambda([actor_id = actor_id(this), host, prefer_ipv6](Result<IPAddress> res) mutable {
-    send_closure(actor_id, &GetHostByNameActor::on_query_result, std::move(host), prefer_ipv6, std::move(res));
+void GetHostByNameActor::start_next_resolver(std::string host, bool prefer_ipv6, Query &query) {
+  CHECK(query.resolvers.size() < options_.resolver_types.size());
+  auto resolver_type = options_.resolver_types[query.resolvers.size()];
+  auto promise = PromiseCreator::lambda([actor_id = actor_id(this), host, prefer_ipv6, query_id = query.query_id](
+                                            Result<detail::DnsResolverResult> res) mutable {
+    send_closure(actor_id, &GetHostByNameActor::on_query_result, std::move(host), prefer_ipv6, query_id,
+                 std::move(res));
   });
 
-  CHECK(query.query.empty());
-  CHECK(query.pos < options_.resolver_types.size());
-  auto resolver_type = options_.resolver_types[query.pos++];
-  query.query = [&] {
+  query.resolvers.push_back([&] {
     switch (resolver_type) {
       case ResolverType::Native:
         return ActorOwn<>(create_actor_on_scheduler<detail::NativeDnsResolver>(
@@ -167,34 +199,101 @@ void GetHostByNameActor::run_query(std::string host, bool prefer_ipv6, Query &qu
         UNREACHABLE();
         return ActorOwn<>();
     }
-  }();
+  }());
+  query.next_resolver_start_time = Time::now() + options_.resolver_start_delay;
+  update_timeout();
+}
+
+void GetHostByNameActor::update_timeout() {
+  double next_start_time = 0.0;
+  for (auto &queries : active_queries_) {
+    for (auto &it : queries) {
+      auto &query = it.second;
+      if (query.resolvers.size() < options_.resolver_types.size() &&
+          (next_start_time == 0.0 || query.next_resolver_start_time < next_start_time)) {
+        next_start_time = query.next_resolver_start_time;
+      }
+    }
+  }
+  if (next_start_time == 0.0) {
+    cancel_timeout();
+  } else {
+    set_timeout_at(next_start_time);
+  }
+}
+
+void GetHostByNameActor::timeout_expired() {
+  auto now = Time::now();
+  for (int prefer_ipv6 = 0; prefer_ipv6 < 2; prefer_ipv6++) {
+    for (auto &it : active_queries_[prefer_ipv6]) {
+      auto &query = it.second;
+      if (query.resolvers.size() < options_.resolver_types.size() && query.next_resolver_start_time <= now) {
+        VLOG(dns_resolver) << "Start next resolver for host = " << query.real_host << " after "
+                           << now - query.begin_time << " seconds";
+        start_next_resolver(it.first, prefer_ipv6 != 0, query);
+      }
+    }
+  }
+  update_timeout();
 }
 
-void GetHostByNameActor::on_query_result(std::string host, bool prefer_ipv6, Result<IPAddress> result) {
+void GetHostByNameActor::on_query_result(std::string host, bool prefer_ipv6, uint64 query_id,
+                                         Result<detail::DnsResolverResult> result) {
   auto query_it = active_queries_[prefer_ipv6].find(host);
-  CHECK(query_it != active_queries_[prefer_ipv6].end());
+  if (query_it == active_queries_[prefer_ipv6].end() || query_it->second.query_id != query_id) {
+    // a result from a resolver, which has lost the race
+    return;
+  }
   auto &query = query_it->second;
-  CHECK(!query.promises.empty());
-  CHECK(!query.query.empty());
+  CHECK(!query.resolvers.empty());
 
-  if (result.is_error() && query.pos < options_.resolver_types.size()) {
-    query.query.reset();
-    return run_query(std::move(host), prefer_ipv6, query);
+  if (result.is_error()) {
+    query.failed_resolver_count++;
+    if (query.error.is_ok()) {
+      query.error = result.move_as_error();
+    }
+    if (query.failed_resolver_count < options_.resolver_types.size()) {
+      if (query.failed_resolver_count == query.resolvers.size()) {
+        // all started resolvers have failed, so there is no reason to wait for the delay
+        start_next_resolver(std::move(host), prefer_ipv6, query);
+      }
+      return;
+    }
   }
 
   auto end_time = Time::now();
+  Result<IPAddress> r_ip_address;
+  int32 cache_timeout = options_.error_timeout;
+  if (result.is_ok()) {
+    auto dns_result = result.move_as_ok();
+    r_ip_address = std::move(dns_result.ip_address);
+    cache_timeout = options_.ok_timeout;
+    if (dns_result.ttl > 0) {
+      cache_timeout = min(max(dns_result.ttl, static_cast<int32>(MIN_CACHE_TIME)), cache_timeout);
+    }
+  } else {
+    r_ip_address = std::move(query.error);
+  }
   VLOG(dns_resolver) << "Init host = " << query.real_host << " in total of " << end_time - query.begin_time
-                     << " seconds to " << (result.is_ok() ? (PSLICE() << result.ok()) : CSlice("[invalid]"));
+                     << " seconds to " << (r_ip_address.is_ok() ? (PSLICE() << r_ip_address.ok()) : CSlice("[invalid]"))
+                     << " for " << cache_timeout << " seconds";
 
   auto promises = std::move(query.promises);
+  active_queries_[prefer_ipv6].erase(query_it);
+  update_timeout();
+
   auto value_it = cache_[prefer_ipv6].find(host);
   CHECK(value_it != cache_[prefer_ipv6].end());
-  auto cache_timeout = result.is_ok() ? options_.ok_timeout : options_.error_timeout;
-  value_it->second = Value{std::move(result), end_time + cache_timeout};
-  active_queries_[prefer_ipv6].erase(query_it);
+  auto &value = value_it->second;
+  if (r_ip_address.is_ok() || value.ip.is_error() || value.expires_at <= end_time) {
+    // a failed background refresh keeps the previous result until it expires
+    value = Value{std::move(r_ip_address), end_time + cache_timeout, end_time + cache_timeout * REFRESH_TIME_PART};
+  } else {
+    CHECK(promises.empty());
+  }
 
   for (auto &promise : promises) {
-    promise.second.set_result(value_it->second.get_ip_port(promise.first));
+    promise.second.set_result(value.get_ip_port(promise.first));
   }
 }
 
@@ -20,6 +20,13 @@ namespace td {
 
 extern int VERBOSITY_NAME(dns_resolver);
 
+namespace detail {
+struct DnsResolverResult {
+  IPAddress ip_address;
+  int32 ttl = 0;  // 0 if unknown
+};
+}  // namespace detail
+
 class GetHostByNameActor final : public Actor {
  public:
   enum class ResolverType { Native, Google };
@@ -27,11 +34,14 @@ class GetHostByNameActor final : public Actor {
   struct Options {
     static constexpr int32 DEFAULT_CACHE_TIME = 60 * 29;       // 29 minutes
     static constexpr int32 DEFAULT_ERROR_CACHE_TIME = 60 * 5;  // 5 minutes
+    static constexpr double DEFAULT_RESOLVER_START_DELAY = 1.0;
 
     vector<ResolverType> resolver_types{ResolverType::Native};
     int32 scheduler_id{-1};
-    int32 ok_timeout{DEFAULT_CACHE_TIME};
+    int32 ok_timeout{DEFAULT_CACHE_TIME};  // maximum cache time; smaller TTL returned by the resolver is respected
     int32 error_timeout{DEFAULT_ERROR_CACHE_TIME};
+    // the next resolver is started concurrently if previous resolvers have returned no result during the delay
+    double resolver_start_delay{DEFAULT_RESOLVER_START_DELAY};
   };
 
   explicit GetHostByNameActor(Options options);
@@ -39,13 +49,20 @@ class GetHostByNameActor final : public Actor {
   void run(std::string host, int port, bool prefer_ipv6, Promise<IPAddress> promise);
 
  private:
-  void on_query_result(std::string host, bool prefer_ipv6, Result<IPAddress> result);
+  static constexpr int32 MIN_CACHE_TIME = 60;
+
+  // results are refreshed in background if they are used after REFRESH_TIME_PART of their cache time
+  static constexpr double REFRESH_TIME_PART = 0.75;
+
+  void on_query_result(std::string host, bool prefer_ipv6, uint64 query_id, Result<detail::DnsResolverResult> result);
 
   struct Value {
     Result<IPAddress> ip;
     double expires_at;
+    double refresh_at;
 
-    Value(Result<IPAddress> ip, double expires_at) : ip(std::move(ip)), expires_at(expires_at) {
+    Value(Result<IPAddress> ip, double expires_at, double refresh_at)
+        : ip(std::move(ip)), expires_at(expires_at), refresh_at(refresh_at) {
     }
 
     Result<IPAddress> get_ip_port(int port) const {
@@ -59,17 +76,27 @@ class GetHostByNameActor final : public Actor {
   std::unordered_map<string, Value> cache_[2];
 
   struct Query {
-    ActorOwn<> query;
-    size_t pos = 0;
+    uint64 query_id = 0;
+    vector<ActorOwn<>> resolvers;
+    size_t failed_resolver_count = 0;
+    double next_resolver_start_time = 0.0;
+    Status error;
     string real_host;
     double begin_time = 0.0;
-    std::vector<std::pair<int, Promise<IPAddress>>> promises;
+    std::vector<std::pair<int, Promise<IPAddress>>> promises;  // empty for background refresh queries
   };
   std::unordered_map<string, Query> active_queries_[2];
+  uint64 last_query_id_ = 0;
 
   Options options_;
 
-  void run_query(std::string host, bool prefer_ipv6, Query &query);
+  void start_query(std::string host, string real_host, bool prefer_ipv6);
+
+  void start_next_resolver(std::string host, bool prefer_ipv6, Query &query);
+
+  void update_timeout();
+
+  void timeout_expired() final;
 };
 
 }  // namespace td
@@ -9,6 +9,7 @@
 #include "td/utils/find_boundary.h"
 #include "td/utils/format.h"
 #include "td/utils/misc.h"
+#include "td/utils/Slice.h"
 #include "td/utils/SliceBuilder.h"
 #include "td/utils/Status.h"
 
@@ -17,6 +18,14 @@ namespace td {
 bool HttpChunkedByteFlow::loop() {
   bool result = false;
   do {
+    if (state_ == State::ReadChunkLength && parse_chunk_length_inplace()) {
+      if (len_ > MAX_CHUNK_SIZE) {
+        finish(Status::Error(PSLICE() << "Invalid chunk size " << tag("size", len_)));
+        return false;
+      }
+      save_len_ = len_;
+      state_ = State::ReadChunkContent;
+    }
     if (state_ == State::ReadChunkLength) {
       bool ok = find_boundary(input_->clone(), "\r\n", len_);
       if (len_ > 10) {
@@ -53,7 +62,7 @@ bool HttpChunkedByteFlow::loop() {
       return false;
     }
 
-    output_.append(input_->cut_head(ready));
+    output_.append_without_copy(input_->cut_head(ready));
     result = true;
     len_ -= ready;
     if (uncommited_size_ >= MIN_UPDATE_SIZE) {
@@ -81,4 +90,17 @@ bool HttpChunkedByteFlow::loop() {
   return result;
 }
 
+bool HttpChunkedByteFlow::parse_chunk_length_inplace() {
+  // the chunk length line is almost always in the first buffer, so it can be parsed without copying
+  auto head = input_->prepare_read();
+  head.truncate(MAX_CHUNK_LENGTH_LINE_SIZE);
+  auto end_pos = head.find('\r');
+  if (end_pos == Slice::npos || end_pos + 1 == head.size() || head[end_pos + 1] != '\n') {
+    return false;
+  }
+  len_ = hex_to_integer<size_t>(head.substr(0, end_pos));
+  input_->advance(end_pos + 2);
+  return true;
+}
+
 }  // namespace td
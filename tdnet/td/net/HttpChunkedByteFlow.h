@@ -20,12 +20,15 @@ class HttpChunkedByteFlow final : public ByteFlowBase {
   static constexpr int MAX_CHUNK_SIZE = 15 << 20;                     // some reasonable limit
   static constexpr int MAX_SIZE = std::numeric_limits<int32>::max();  // some reasonable limit
   static constexpr size_t MIN_UPDATE_SIZE = 1 << 14;
+  static constexpr size_t MAX_CHUNK_LENGTH_LINE_SIZE = 12;
   enum class State { ReadChunkLength, ReadChunkContent, OK };
   State state_ = State::ReadChunkLength;
   size_t len_ = 0;
   size_t save_len_ = 0;
   size_t total_size_ = 0;
   size_t uncommited_size_ = 0;
+
+  bool parse_chunk_length_inplace();
 };
 
 }  // namespace td
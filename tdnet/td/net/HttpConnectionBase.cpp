@@ -74,6 +74,15 @@ void HttpConnectionBase::write_ok() {
   loop();
 }
 
+void HttpConnectionBase::set_idle_timeout(int32 idle_timeout) {
+  idle_timeout_ = idle_timeout;
+  if (idle_timeout_ == 0) {
+    cancel_timeout();
+  } else {
+    live_event();
+  }
+}
+
 void HttpConnectionBase::write_error(Status error) {
   CHECK(state_ == State::Write);
   LOG(WARNING) << "Close HTTP connection: " << error;
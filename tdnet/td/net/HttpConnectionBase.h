@@ -30,11 +30,16 @@ class HttpConnectionBase : public Actor {
   void write_ok();
   void write_error(Status error);
 
+  // 0 means no timeout
+  void set_idle_timeout(int32 idle_timeout);
+
  protected:
   enum class State { Read, Write, Close };
   HttpConnectionBase(State state, BufferedFd<SocketFd> fd, SslStream ssl_stream, size_t max_post_size, size_t max_files,
                      int32 idle_timeout, int32 slow_scheduler_id);
 
+  void tear_down() override;
+
  private:
   State state_;
 
@@ -62,7 +67,6 @@ class HttpConnectionBase : public Actor {
   void live_event();
 
   void start_up() final;
-  void tear_down() final;
   void timeout_expired() final;
   void loop() final;
 
@@ -0,0 +1,103 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2022
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "td/net/HttpConnectionPool.h"
+
+#include "td/utils/logging.h"
+
+#include <mutex>
+
+namespace td {
+
+namespace {
+
+struct IdleConnection {
+  string key;
+  Scheduler *scheduler;
+  ActorId<HttpOutboundConnection> connection;
+};
+
+std::mutex idle_connections_mutex;
+// sorted by the time when the connection has become idle
+vector<IdleConnection> idle_connections;
+
+}  // namespace
+
+constexpr int32 HttpConnectionPool::IDLE_TIMEOUT;
+constexpr size_t HttpConnectionPool::MAX_HOST_IDLE_CONNECTION_COUNT;
+constexpr size_t HttpConnectionPool::MAX_IDLE_CONNECTION_COUNT;
+
+ActorOwn<HttpOutboundConnection> HttpConnectionPool::get_connection(Slice key) {
+  auto scheduler = Scheduler::instance();
+  ActorOwn<HttpOutboundConnection> result;
+  {
+    std::lock_guard<std::mutex> guard(idle_connections_mutex);
+    // the most recently used connection is the most likely to be still alive
+    for (auto it = idle_connections.rbegin(); it != idle_connections.rend(); ++it) {
+      if (it->scheduler == scheduler && it->key == key) {
+        result = ActorOwn<HttpOutboundConnection>(it->connection);
+        idle_connections.erase(std::next(it).base());
+        break;
+      }
+    }
+  }
+  if (!result.empty()) {
+    LOG(DEBUG) << "Reuse idle HTTP connection to " << key;
+    send_closure(result, &HttpOutboundConnection::set_idle_timeout, 0);
+  }
+  return result;
+}
+
+void HttpConnectionPool::put_connection(string key, ActorOwn<HttpOutboundConnection> connection) {
+  CHECK(!connection.empty());
+  send_closure(connection, &HttpOutboundConnection::set_idle_timeout, IDLE_TIMEOUT);
+
+  auto scheduler = Scheduler::instance();
+  vector<ActorOwn<HttpOutboundConnection>> closed_connections;
+  {
+    std::lock_guard<std::mutex> guard(idle_connections_mutex);
+    // the connections can be closed only from their scheduler, so only connections from the same scheduler are limited
+    auto close_oldest_connection = [&](size_t max_count, bool is_same_host) {
+      size_t count = 0;
+      for (auto &idle_connection : idle_connections) {
+        if (idle_connection.scheduler == scheduler && (!is_same_host || idle_connection.key == key)) {
+          count++;
+        }
+      }
+      for (auto it = idle_connections.begin(); it != idle_connections.end() && count >= max_count;) {
+        if (it->scheduler == scheduler && (!is_same_host || it->key == key)) {
+          count--;
+          closed_connections.emplace_back(it->connection);
+          it = idle_connections.erase(it);
+        } else {
+          ++it;
+        }
+      }
+    };
+    close_oldest_connection(MAX_HOST_IDLE_CONNECTION_COUNT, true);
+    close_oldest_connection(MAX_IDLE_CONNECTION_COUNT, false);
+    idle_connections.push_back(IdleConnection{std::move(key), scheduler, connection.release()});
+  }
+  // the connections are closed without the mutex, because it is needed in on_connection_closed
+  closed_connections.clear();
+}
+
+void HttpConnectionPool::on_connection_closed(ActorId<HttpOutboundConnection> connection) {
+  std::lock_guard<std::mutex> guard(idle_connections_mutex);
+  for (auto it = idle_connections.begin(); it != idle_connections.end(); ++it) {
+    if (it->connection.get_actor_info() == connection.get_actor_info()) {
+      idle_connections.erase(it);
+      return;
+    }
+  }
+}
+
+size_t HttpConnectionPool::get_idle_connection_count() {
+  std::lock_guard<std::mutex> guard(idle_connections_mutex);
+  return idle_connections.size();
+}
+
+}  // namespace td
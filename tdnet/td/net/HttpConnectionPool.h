@@ -0,0 +1,40 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2022
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#pragma once
+
+#include "td/net/HttpOutboundConnection.h"
+
+#include "td/actor/actor.h"
+
+#include "td/utils/common.h"
+#include "td/utils/Slice.h"
+
+namespace td {
+
+// process-wide pool of idle keep-alive outbound HTTP connections
+// a connection can be reused only by actors running on the same scheduler as the connection
+class HttpConnectionPool {
+ public:
+  static constexpr int32 IDLE_TIMEOUT = 30;
+  static constexpr size_t MAX_HOST_IDLE_CONNECTION_COUNT = 4;
+  static constexpr size_t MAX_IDLE_CONNECTION_COUNT = 32;
+
+  // returns an idle connection to the host identified by the key or an empty ActorOwn
+  // the connection's callback must be changed with HttpOutboundConnection::set_callback before the connection is used
+  static ActorOwn<HttpOutboundConnection> get_connection(Slice key);
+
+  // the connection must be in the ready to write state after the whole response has been received
+  // the connection is closed by the pool after IDLE_TIMEOUT seconds or if there are too many idle connections
+  static void put_connection(string key, ActorOwn<HttpOutboundConnection> connection);
+
+  // must be called when the connection is closed
+  static void on_connection_closed(ActorId<HttpOutboundConnection> connection);
+
+  static size_t get_idle_connection_count();
+};
+
+}  // namespace td
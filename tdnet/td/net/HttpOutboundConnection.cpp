@@ -6,6 +6,8 @@
 //
 #include "td/net/HttpOutboundConnection.h"
 
+#include "td/net/HttpConnectionPool.h"
+
 #include "td/utils/common.h"
 
 namespace td {
@@ -20,4 +22,9 @@ void HttpOutboundConnection::on_error(Status error) {
   send_closure(callback_, &Callback::on_connection_error, std::move(error));
 }
 
+void HttpOutboundConnection::tear_down() {
+  HttpConnectionPool::on_connection_closed(actor_id(this));
+  HttpConnectionBase::tear_down();
+}
+
 }  // namespace td
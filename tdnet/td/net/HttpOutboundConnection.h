@@ -35,10 +35,17 @@ class HttpOutboundConnection final : public detail::HttpConnectionBase {
   // void write_next(BufferSlice buffer);
   // void write_ok();
   // void write_error(Status error);
+  // void set_idle_timeout(int32 idle_timeout);
+
+  // can be called only if the connection is ready to write, for example, after it was returned by HttpConnectionPool
+  void set_callback(ActorShared<Callback> callback) {
+    callback_ = std::move(callback);
+  }
 
  private:
   void on_query(unique_ptr<HttpQuery> query) final;
   void on_error(Status error) final;
+  void tear_down() final;
   void hangup() final {
     callback_.release();
     HttpConnectionBase::hangup();
@@ -15,6 +15,7 @@
 #include "td/utils/port/wstring_convert.h"
 #include "td/utils/SliceBuilder.h"
 #include "td/utils/Status.h"
+#include "td/utils/ThreadSafeCounter.h"
 #include "td/utils/Time.h"
 
 #include <openssl/err.h>
@@ -24,9 +25,11 @@
 #include <openssl/x509v3.h>
 
 #include <cstring>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <unordered_map>
+#include <utility>
 
 #if TD_PORT_WINDOWS
 #include <wincrypt.h>
@@ -98,6 +101,11 @@ long strm_ctrl(BIO *b, int cmd, long num, void *ptr) {
     case BIO_CTRL_PUSH:
     case BIO_CTRL_POP:
       return 0;
+#if defined(BIO_CTRL_GET_KTLS_SEND) && defined(BIO_CTRL_GET_KTLS_RECV)
+    case BIO_CTRL_GET_KTLS_SEND:
+    case BIO_CTRL_GET_KTLS_RECV:
+      return 0;
+#endif
     default:
       LOG(FATAL) << b << " " << cmd << " " << num << " " << ptr;
   }
@@ -158,6 +166,73 @@ struct SslHandleDeleter {
 
 using SslHandle = std::unique_ptr<SSL, SslHandleDeleter>;
 
+struct SslSessionDeleter {
+  void operator()(SSL_SESSION *session) {
+    SSL_SESSION_free(session);
+  }
+};
+
+using SslSession = std::unique_ptr<SSL_SESSION, SslSessionDeleter>;
+
+// process-wide cache of the last TLS sessions received from servers, which is used to resume sessions;
+// sessions are bound to the SSL_CTX, so the SSL_CTX address is a part of the key
+class SslSessionCache {
+ public:
+  static SslSessionCache &get() {
+    static SslSessionCache cache;
+    return cache;
+  }
+
+  static string get_key(SSL_CTX *ssl_ctx, Slice host) {
+    return PSTRING() << static_cast<const void *>(ssl_ctx) << ' ' << host;
+  }
+
+  void set_session(string key, SslSession session) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (sessions_.size() >= MAX_SESSION_COUNT && sessions_.count(key) == 0) {
+      sessions_.clear();
+    }
+    sessions_[std::move(key)] = std::move(session);
+  }
+
+  // the caller must call SSL_SESSION_free for the returned session
+  SSL_SESSION *get_session(const string &key) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto it = sessions_.find(key);
+    if (it == sessions_.end()) {
+      return nullptr;
+    }
+#if OPENSSL_VERSION_NUMBER >= 0x10100000L
+    SSL_SESSION_up_ref(it->second.get());
+#else
+    CRYPTO_add(&it->second->references, 1, CRYPTO_LOCK_SSL_SESSION);
+#endif
+    return it->second.get();
+  }
+
+ private:
+  static constexpr size_t MAX_SESSION_COUNT = 1000;
+
+  std::mutex mutex_;
+  std::unordered_map<string, SslSession> sessions_;
+};
+
+int get_ssl_stream_ex_data_index() {
+  static int index = SSL_get_ex_new_index(0, nullptr, nullptr, nullptr, nullptr);
+  return index;
+}
+
+// called by OpenSSL for each new session received from the server, including TLS 1.3 session tickets
+int on_new_ssl_session(SSL *ssl_handle, SSL_SESSION *session) {
+  auto *session_key = static_cast<const string *>(SSL_get_ex_data(ssl_handle, get_ssl_stream_ex_data_index()));
+  if (session_key == nullptr) {
+    return 0;
+  }
+  SslSessionCache::get().set_session(*session_key, SslSession(session));
+  // the ownership of the session has been taken
+  return 1;
+}
+
 Result<SslCtx> do_create_ssl_ctx(CSlice cert_file, SslStream::VerifyPeer verify_peer) {
   auto ssl_method =
 #if OPENSSL_VERSION_NUMBER >= 0x10100000L
@@ -185,6 +260,8 @@ Result<SslCtx> do_create_ssl_ctx(CSlice cert_file, SslStream::VerifyPeer verify_
   SSL_CTX_set_min_proto_version(ssl_ctx, TLS1_VERSION);
 #endif
   SSL_CTX_set_mode(ssl_ctx, SSL_MODE_ACCEPT_MOVING_WRITE_BUFFER | SSL_MODE_ENABLE_PARTIAL_WRITE);
+  SSL_CTX_set_session_cache_mode(ssl_ctx, SSL_SESS_CACHE_CLIENT | SSL_SESS_CACHE_NO_INTERNAL_STORE);
+  SSL_CTX_sess_set_new_cb(ssl_ctx, on_new_ssl_session);
 
   if (cert_file.empty()) {
 #if TD_PORT_WINDOWS
@@ -284,7 +361,19 @@ Result<SslCtx> create_ssl_ctx(CSlice cert_file, SslStream::VerifyPeer verify_pee
       return get_default_unverified_ssl_ctx();
     }
   }
-  return do_create_ssl_ctx(cert_file, verify_peer);
+
+  // loading of certificates is slow, so contexts are reused; failures aren't cached to allow fixing the file
+  static std::mutex ssl_ctxs_mutex;
+  static std::map<std::pair<string, SslStream::VerifyPeer>, SslCtx> ssl_ctxs;
+  auto key = std::make_pair(cert_file.str(), verify_peer);
+  std::lock_guard<std::mutex> guard(ssl_ctxs_mutex);
+  auto it = ssl_ctxs.find(key);
+  if (it != ssl_ctxs.end()) {
+    return it->second;
+  }
+  TRY_RESULT(ssl_ctx, do_create_ssl_ctx(cert_file, verify_peer));
+  ssl_ctxs.emplace(std::move(key), ssl_ctx);
+  return std::move(ssl_ctx);
 }
 
 }  // namespace
@@ -341,6 +430,15 @@ class SslStreamImpl {
 #endif
     SSL_set_connect_state(ssl_handle.get());
 
+    session_key_ = SslSessionCache::get_key(ssl_ctx.get(), host);
+    SSL_set_ex_data(ssl_handle.get(), get_ssl_stream_ex_data_index(), static_cast<void *>(&session_key_));
+    auto *session = SslSessionCache::get().get_session(session_key_);
+    if (session != nullptr) {
+      LOG(DEBUG) << "Try to resume TLS session with " << host;
+      is_resumption_attempted_ = SSL_set_session(ssl_handle.get(), session) == 1;
+      SSL_SESSION_free(session);
+    }
+
     ssl_handle_ = std::move(ssl_handle);
 
     return Status::OK();
@@ -360,14 +458,38 @@ class SslStreamImpl {
   }
 
  private:
+  string session_key_;  // must be destroyed after ssl_handle_
   SslHandle ssl_handle_;
+  bool is_resumption_attempted_ = false;
+  bool is_handshake_finished_ = false;
 
   friend class SslReadByteFlow;
   friend class SslWriteByteFlow;
 
+  void check_handshake_finished() {
+    if (is_handshake_finished_ || !SSL_is_init_finished(ssl_handle_.get())) {
+      return;
+    }
+    is_handshake_finished_ = true;
+
+    static auto full_handshake_counter = NamedThreadSafeCounter::get_default().get_counter("tls_full_handshakes");
+    static auto resumed_handshake_counter = NamedThreadSafeCounter::get_default().get_counter("tls_resumed_handshakes");
+    static auto failed_resumption_counter =
+        NamedThreadSafeCounter::get_default().get_counter("tls_failed_session_resumptions");
+    if (SSL_session_reused(ssl_handle_.get())) {
+      resumed_handshake_counter.add(1);
+    } else {
+      full_handshake_counter.add(1);
+      if (is_resumption_attempted_) {
+        failed_resumption_counter.add(1);
+      }
+    }
+  }
+
   Result<size_t> write(Slice slice) {
     clear_openssl_errors("Before SslFd::write");
     auto size = SSL_write(ssl_handle_.get(), slice.data(), static_cast<int>(slice.size()));
+    check_handshake_finished();
     if (size <= 0) {
       return process_ssl_error(size);
     }
@@ -377,6 +499,7 @@ class SslStreamImpl {
   Result<size_t> read(MutableSlice slice) {
     clear_openssl_errors("Before SslFd::read");
     auto size = SSL_read(ssl_handle_.get(), slice.data(), static_cast<int>(slice.size()));
+    check_handshake_finished();
     if (size <= 0) {
       return process_ssl_error(size);
     }
@@ -388,7 +511,7 @@ class SslStreamImpl {
     explicit SslReadByteFlow(SslStreamImpl *stream) : stream_(stream) {
     }
     bool loop() final {
-      auto to_read = output_.prepare_append();
+      auto to_read = output_.prepare_append(read_size_hint_);
       auto r_size = stream_->read(to_read);
       if (r_size.is_error()) {
         finish(r_size.move_as_error());
@@ -398,6 +521,12 @@ class SslStreamImpl {
       if (size == 0) {
         return false;
       }
+      if (size == to_read.size()) {
+        // a big response is being received, so allocate buffers, which can hold a whole TLS record
+        read_size_hint_ = 1 << 15;
+      } else if (size < (1 << 10)) {
+        read_size_hint_ = 0;
+      }
       output_.confirm_append(size);
       return true;
     }
@@ -408,6 +537,7 @@ class SslStreamImpl {
 
    private:
     SslStreamImpl *stream_;
+    size_t read_size_hint_ = 0;
   };
 
   class SslWriteByteFlow final : public ByteFlowBase {
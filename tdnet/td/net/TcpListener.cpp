@@ -8,6 +8,7 @@
 
 #include "td/utils/logging.h"
 #include "td/utils/port/detail/PollableFd.h"
+#include "td/utils/port/platform.h"
 
 namespace td {
 
@@ -61,4 +62,34 @@ void TcpListener::loop() {
   }
 }
 
+ShardedTcpListener::ShardedTcpListener(int port, vector<int32> scheduler_ids, CallbackFactory callback_factory,
+                                       Slice server_address)
+    : port_(port)
+    , scheduler_ids_(std::move(scheduler_ids))
+    , callback_factory_(std::move(callback_factory))
+    , server_address_(server_address.str()) {
+  CHECK(!scheduler_ids_.empty());
+}
+
+bool ShardedTcpListener::is_supported() {
+  // other systems either don't balance connections between sockets with SO_REUSEPORT or don't support it at all
+#if TD_LINUX || TD_ANDROID
+  return true;
+#else
+  return false;
+#endif
+}
+
+void ShardedTcpListener::start_up() {
+  if (!is_supported()) {
+    scheduler_ids_.resize(1);
+  }
+  for (auto scheduler_id : scheduler_ids_) {
+    auto callback = callback_factory_(scheduler_id);
+    listeners_.push_back(create_actor_on_scheduler<TcpListener>(
+        "TcpListener", scheduler_id, port_, std::move(callback), Slice(server_address_)));
+  }
+  callback_factory_ = nullptr;
+}
+
 }  // namespace td
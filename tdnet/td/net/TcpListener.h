@@ -8,10 +8,13 @@
 
 #include "td/actor/actor.h"
 
+#include "td/utils/common.h"
 #include "td/utils/port/ServerSocketFd.h"
 #include "td/utils/port/SocketFd.h"
 #include "td/utils/Slice.h"
 
+#include <functional>
+
 namespace td {
 
 class TcpListener final : public Actor {
@@ -34,4 +37,27 @@ class TcpListener final : public Actor {
   void loop() final;
 };
 
+// listens to the port on each of the specified schedulers; the kernel balances incoming connections between
+// the listening sockets using SO_REUSEPORT, so connections can be created on the accepting scheduler
+// if the balancing isn't supported, the only listener is created on the first scheduler
+class ShardedTcpListener final : public Actor {
+ public:
+  // returns callback for the listener on the scheduler; accepted sockets are passed to the callback on the scheduler
+  using CallbackFactory = std::function<ActorOwn<TcpListener::Callback>(int32 scheduler_id)>;
+
+  ShardedTcpListener(int port, vector<int32> scheduler_ids, CallbackFactory callback_factory,
+                     Slice server_address = Slice("0.0.0.0"));
+
+  static bool is_supported();
+
+ private:
+  int port_;
+  vector<int32> scheduler_ids_;
+  CallbackFactory callback_factory_;
+  const string server_address_;
+  vector<ActorOwn<TcpListener>> listeners_;
+
+  void start_up() final;
+};
+
 }  // namespace td
@@ -6,6 +6,7 @@
 //
 #include "td/net/Wget.h"
 
+#include "td/net/HttpConnectionPool.h"
 #include "td/net/HttpHeaderCreator.h"
 #include "td/net/HttpOutboundConnection.h"
 #include "td/net/SslStream.h"
@@ -72,22 +73,35 @@ Status Wget::try_init() {
   }
   TRY_RESULT(header, hc.finish(content_));
 
-  IPAddress addr;
-  TRY_STATUS(addr.init_host_port(url.host_, url.port_, prefer_ipv6_));
-
-  TRY_RESULT(fd, SocketFd::open(addr));
-  if (fd.empty()) {
-    return Status::Error("Sockets are not supported");
+  connection_key_ = PSTRING() << (url.protocol_ == HttpUrl::Protocol::Http ? "http" : "https") << "://" << url.host_
+                              << ':' << url.port_ << (prefer_ipv6_ ? " IPv6" : "")
+                              << (verify_peer_ == SslStream::VerifyPeer::On ? "" : " unverified");
+  ActorShared<HttpOutboundConnection::Callback> callback = actor_shared(this, ++connection_generation_);
+  is_connection_reused_ = false;
+  if (can_reuse_connection_) {
+    connection_ = HttpConnectionPool::get_connection(connection_key_);
   }
-  if (url.protocol_ == HttpUrl::Protocol::Http) {
-    connection_ = create_actor<HttpOutboundConnection>("Connect", BufferedFd<SocketFd>(std::move(fd)), SslStream{},
-                                                       std::numeric_limits<std::size_t>::max(), 0, 0,
-                                                       ActorOwn<HttpOutboundConnection::Callback>(actor_id(this)));
+  if (!connection_.empty()) {
+    is_connection_reused_ = true;
+    send_closure(connection_, &HttpOutboundConnection::set_callback, std::move(callback));
   } else {
-    TRY_RESULT(ssl_stream, SslStream::create(url.host_, CSlice() /* certificate */, verify_peer_));
-    connection_ = create_actor<HttpOutboundConnection>(
-        "Connect", BufferedFd<SocketFd>(std::move(fd)), std::move(ssl_stream), std::numeric_limits<std::size_t>::max(),
-        0, 0, ActorOwn<HttpOutboundConnection::Callback>(actor_id(this)));
+    IPAddress addr;
+    TRY_STATUS(addr.init_host_port(url.host_, url.port_, prefer_ipv6_));
+
+    TRY_RESULT(fd, SocketFd::open(addr));
+    if (fd.empty()) {
+      return Status::Error("Sockets are not supported");
+    }
+    if (url.protocol_ == HttpUrl::Protocol::Http) {
+      connection_ = create_actor<HttpOutboundConnection>("Connect", BufferedFd<SocketFd>(std::move(fd)), SslStream{},
+                                                         std::numeric_limits<std::size_t>::max(), 0, 0,
+                                                         std::move(callback));
+    } else {
+      TRY_RESULT(ssl_stream, SslStream::create(url.host_, CSlice() /* certificate */, verify_peer_));
+      connection_ = create_actor<HttpOutboundConnection>("Connect", BufferedFd<SocketFd>(std::move(fd)),
+                                                         std::move(ssl_stream), std::numeric_limits<std::size_t>::max(),
+                                                         0, 0, std::move(callback));
+    }
   }
 
   send_closure(connection_, &HttpOutboundConnection::write_next, BufferSlice(header));
@@ -104,11 +118,57 @@ void Wget::loop() {
   }
 }
 
+// the connection can be reused only if the end of the response is known without closing the connection
+static bool can_keep_connection_alive(const HttpQuery &http_query) {
+  if (!http_query.keep_alive_) {
+    return false;
+  }
+  auto transfer_encoding = http_query.get_header("transfer-encoding");
+  if (!transfer_encoding.empty()) {
+    return to_lower(transfer_encoding) == "chunked";
+  }
+  return !http_query.get_header("content-length").empty();
+}
+
+bool Wget::is_current_connection() {
+  return !connection_.empty() && get_link_token() == connection_generation_;
+}
+
 void Wget::handle(unique_ptr<HttpQuery> result) {
+  if (!is_current_connection()) {
+    return;
+  }
+  CHECK(result);
+  if (can_keep_connection_alive(*result)) {
+    HttpConnectionPool::put_connection(std::move(connection_key_), std::move(connection_));
+  } else {
+    connection_.reset();
+  }
   on_ok(std::move(result));
 }
 
 void Wget::on_connection_error(Status error) {
+  if (!is_current_connection()) {
+    return;
+  }
+  on_connection_lost(std::move(error));
+}
+
+void Wget::hangup_shared() {
+  if (!is_current_connection()) {
+    return;
+  }
+  on_connection_lost(Status::Error("Connection closed"));
+}
+
+void Wget::on_connection_lost(Status error) {
+  connection_.reset();
+  if (is_connection_reused_) {
+    // the idle connection could have been closed by the server, so the request is repeated using a new connection
+    LOG(INFO) << "Reused HTTP connection has failed: " << error;
+    can_reuse_connection_ = false;
+    return loop();
+  }
   on_error(std::move(error));
 }
 
@@ -122,7 +182,6 @@ void Wget::on_ok(unique_ptr<HttpQuery> http_query_ptr) {
     input_url_ = http_query_ptr->get_header("location").str();
     LOG(DEBUG) << input_url_;
     ttl_--;
-    connection_.reset();
     yield();
   } else if (http_query_ptr->code_ >= 200 && http_query_ptr->code_ < 300) {
     promise_.set_value(std::move(http_query_ptr));
@@ -32,6 +32,9 @@ class Wget final : public HttpOutboundConnection::Callback {
   void loop() final;
   void handle(unique_ptr<HttpQuery> result) final;
   void on_connection_error(Status error) final;
+  void hangup_shared() final;
+  bool is_current_connection();
+  void on_connection_lost(Status error);
   void on_ok(unique_ptr<HttpQuery> http_query_ptr);
   void on_error(Status error);
 
@@ -41,6 +44,10 @@ class Wget final : public HttpOutboundConnection::Callback {
 
   Promise<unique_ptr<HttpQuery>> promise_;
   ActorOwn<HttpOutboundConnection> connection_;
+  uint64 connection_generation_ = 0;
+  string connection_key_;
+  bool is_connection_reused_ = false;
+  bool can_reuse_connection_ = true;
   string input_url_;
   std::vector<std::pair<string, string>> headers_;
   int32 timeout_in_;
@@ -0,0 +1,3761 @@
+// This file is automatically generated by generate_emoji_table from emoji.txt; don't edit it manually
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+static constexpr std::size_t MAX_EMOJI_LENGTH = 35;
+static constexpr std::size_t EMOJI_BUCKET_COUNT = 1171;
+static constexpr std::size_t EMOJI_SLOT_COUNT = 5268;
+
+static constexpr std::uint16_t emoji_seeds[] = {
+    2, 1, 1, 30, 1, 0, 1, 50, 12, 46, 20, 1, 1, 7, 14, 4,
+    2, 1, 62, 25, 48, 1, 0, 1, 1, 10, 5, 4, 4, 1, 5, 134,
+    14, 5, 14, 1, 68, 15, 1, 36, 6, 1, 16, 1, 17, 21, 10, 0,
+    8, 1, 2, 21, 9, 14, 4, 14, 19, 72, 2, 12, 30, 6, 19, 13,
+    1, 31, 1, 32, 11, 11, 7, 26, 3, 9, 17, 34, 12, 117, 1, 2,
+    1, 40, 3, 5, 16, 1, 6, 0, 43, 10, 1, 24, 1, 20, 3, 1,
+    1, 2, 1, 7, 8, 19, 1, 2, 18, 3, 7, 9, 16, 1, 57, 2,
+    1, 3, 106, 4, 5, 4, 19, 2, 1, 36, 1, 22, 1, 15, 5, 1,
+    32, 2, 52, 68, 27, 4, 50, 0, 1, 19, 21, 1, 2, 30, 2, 13,
+    9, 1, 4, 9, 2, 2, 38, 20, 2, 1, 1, 14, 2, 2, 127, 45,
+    20, 2, 36, 9, 36, 8, 27, 21, 13, 9, 13, 72, 28, 5, 7, 7,
+    4, 7, 71, 1, 21, 6, 21, 12, 43, 8, 197, 42, 1, 2, 7, 25,
+    3, 73, 1, 19, 170, 3, 7, 91, 5, 23, 6, 62, 52, 2, 1, 3,
+    130, 16, 71, 9, 5, 4, 10, 2, 63, 3, 15, 15, 8, 10, 1, 54,
+    4, 19, 5, 12, 34, 9, 25, 4, 0, 10, 26, 1, 4, 8, 11, 44,
+    2, 10, 1, 1, 17, 5, 13, 4, 2, 13, 3, 26, 35, 3, 16, 25,
+    36, 5, 73, 20, 15, 16, 1, 1, 19, 2, 48, 0, 14, 71, 17, 128,
+    6, 80, 57, 11, 1, 2, 7, 4, 5, 54, 10, 4, 44, 19, 75, 0,
+    1, 31, 1, 13, 53, 16, 25, 26, 6, 0, 14, 19, 24, 2, 0, 9,
+    3, 1, 2, 3, 2, 44, 19, 10, 1, 1, 2, 17, 37, 6, 128, 6,
+    27, 19, 2, 3, 70, 1, 11, 5, 16, 97, 176, 5, 22, 22, 1, 10,
+    56, 7, 1, 66, 1, 22, 8, 13, 3, 2, 10, 1, 7, 13, 1, 6,
+    4, 5, 12, 49, 36, 104, 0, 15, 37, 1, 1, 28, 5, 50, 4, 15,
+    22, 5, 26, 63, 2, 49, 5, 6, 144, 8, 65, 32, 13, 1, 2, 12,
+    8, 187, 22, 6, 3, 4, 30, 1, 4, 26, 48, 90, 6, 9, 29, 0,
+    15, 91, 6, 24, 1, 5, 10, 48, 20, 24, 5, 7, 3, 36, 7, 0,
+    52, 5, 97, 32, 15, 3, 2, 85, 2, 10, 31, 34, 8, 9, 2, 10,
+    5, 23, 46, 3, 5, 32, 72, 20, 1, 17, 2, 14, 30, 22, 88, 3,
+    1, 88, 12, 7, 52, 2, 1, 27, 28, 10, 10, 54, 27, 19, 6, 98,
+    3, 18, 30, 25, 94, 56, 11, 6, 10, 51, 1, 14, 5, 34, 4, 4,
+    17, 14, 36, 16, 2, 18, 0, 2, 30, 35, 7, 20, 22, 3, 120, 10,
+    9, 13, 0, 1, 1, 12, 17, 8, 3, 106, 0, 3, 29, 3, 7, 89,
+    78, 74, 1, 3, 89, 13, 11, 14, 110, 26, 7, 2, 34, 98, 4, 40,
+    55, 1, 6, 55, 173, 42, 19, 1, 12, 1, 13, 7, 5, 3, 5, 6,
+    4, 103, 54, 187, 6, 23, 3, 17, 2, 9, 3, 80, 202, 3, 9, 20,
+    14, 7, 34, 4, 25, 15, 102, 22, 82, 21, 1, 49, 1, 4, 7, 2,
+    9, 42, 94, 2, 28, 2, 1, 20, 16, 1, 80, 4, 12, 21, 4, 68,
+    2, 119, 80, 6, 58, 60, 1, 34, 2, 78, 2, 4, 4, 4, 1, 3,
+    7, 2, 4, 28, 20, 0, 1, 2, 11, 15, 19, 178, 4, 25, 6, 5,
+    15, 23, 6, 47, 19, 2, 36, 160, 19, 132, 42, 8, 13, 60, 2, 5,
+    5, 2, 38, 129, 111, 84, 13, 91, 115, 68, 32, 70, 56, 30, 13, 9,
+    21, 56, 1, 113, 16, 78, 55, 27, 80, 30, 65, 32, 0, 10, 33, 94,
+    8, 2, 10, 102, 10, 0, 45, 4, 41, 7, 3, 13, 2, 5, 13, 16,
+    2, 13, 6, 1, 55, 16, 9, 1, 61, 39, 10, 5, 41, 72, 15, 15,
+    16, 27, 27, 17, 2, 87, 16, 63, 27, 1, 14, 11, 26, 1, 92, 4,
+    11, 5, 2, 82, 87, 2, 225, 49, 1, 3, 8, 27, 47, 34, 3, 12,
+    2, 0, 2, 4, 4, 2, 6, 33, 53, 4, 3, 26, 86, 1, 41, 8,
+    3, 95, 4, 151, 1, 4, 10, 5, 16, 12, 25, 16, 14, 37, 11, 79,
+    3, 27, 6, 2, 1, 4, 80, 1, 128, 87, 4, 29, 2, 126, 9, 0,
+    37, 137, 40, 0, 1, 3, 241, 17, 98, 5, 14, 5, 49, 4, 9, 28,
+    23, 99, 9, 16, 24, 10, 27, 89, 31, 13, 6, 21, 3, 42, 20, 124,
+    2, 1, 36, 11, 19, 9, 1, 51, 1, 8, 34, 48, 115, 5, 1, 12,
+    3, 13, 9, 181, 81, 18, 14, 143, 1, 6, 39, 1, 62, 9, 3, 52,
+    90, 48, 6, 65, 27, 34, 4, 1, 1, 72, 16, 93, 71, 1, 48, 7,
+    36, 2, 2, 34, 17, 2, 31, 22, 34, 11, 1, 117, 4, 70, 74, 5,
+    107, 44, 48, 4, 32, 3, 29, 20, 1, 3, 2, 6, 48, 62, 4, 85,
+    7, 19, 5, 2, 126, 25, 15, 11, 8, 165, 4, 16, 257, 19, 6, 297,
+    102, 83, 15, 6, 8, 74, 244, 34, 37, 50, 1, 1, 59, 42, 1, 112,
+    15, 42, 22, 0, 59, 8, 5, 45, 314, 1, 270, 6, 95, 71, 1, 53,
+    109, 8, 6, 37, 3, 90, 101, 6, 15, 12, 20, 15, 0, 115, 83, 2,
+    116, 3, 0, 73, 26, 37, 115, 11, 6, 17, 127, 29, 88, 9, 51, 233,
+    5, 1, 17, 3, 4, 5, 307, 1, 24, 11, 4, 7, 91, 30, 10, 4,
+    21, 7, 55, 1, 1, 27, 7, 101, 25, 2, 85, 121, 27, 58, 34, 2,
+    4, 130, 13, 9, 20, 23, 28, 38, 49, 26, 16, 19, 77, 69, 3, 164,
+    80, 1, 64, 238, 23, 51, 2, 133, 134, 160, 19, 18, 55, 281, 268, 84,
+    30, 68, 19, 93, 79, 32, 11, 12, 135, 65, 3, 60, 89, 38, 9, 10,
+    129, 30, 16, 64, 23, 104, 12, 31, 35, 78, 49, 385, 210, 20, 58, 34,
+    49, 26, 7, 123, 25, 29, 46, 14, 21, 19, 79, 36, 51, 31, 21, 408,
+    192, 145, 216, 52, 1, 3, 4, 14, 41, 60, 202, 123, 11, 120, 9, 70,
+    89, 20, 39, 26, 105, 25, 23, 0, 120, 264, 6, 699, 42, 14, 57, 1,
+    107, 108, 7, 9, 41, 5, 17, 63, 7, 66, 94, 561, 58, 11, 1, 32,
+    22, 63, 40, 11, 88, 14, 43, 7, 12, 9, 283, 190, 2, 4, 27, 114,
+    1, 1, 4, 101, 2, 60, 10, 31, 3, 4, 20, 8, 187, 48, 115, 61,
+    3, 71, 202,
+};
+
+static constexpr std::uint16_t emoji_offsets[] = {
+    0, 17, 34, 42, 57, 65, 65, 69, 73, 90, 98, 112, 119, 119, 122, 139,
+    154, 158, 166, 173, 176, 191, 216, 224, 238, 253, 259, 274, 282, 285, 310, 310,
+    325, 328, 335, 339, 343, 358, 361, 378, 381, 395, 398, 408, 412, 440, 475, 510,
+    514, 522, 533, 550, 565, 579, 605, 616, 620, 655, 662, 668, 685, 692, 702, 710,
+    718, 746, 754, 758, 762, 766, 769, 784, 809, 823, 827, 835, 835, 863, 874, 889,
+    903, 917, 917, 921, 931, 935, 952, 966, 992, 992, 1009, 1034, 1042, 1046, 1046, 1052,
+    1056, 1056, 1066, 1083, 1087, 1095, 1099, 1116, 1120, 1124, 1128, 1143, 1158, 1193, 1199, 1207,
+    1210, 1218, 1226, 1229, 1261, 1287, 1287, 1319, 1319, 1319, 1323, 1331, 1331, 1334, 1334, 1351,
+    1383, 1396, 1411, 1415, 1441, 1445, 1459, 1467, 1467, 1480, 1480, 1484, 1488, 1488, 1492, 1506,
+    1525, 1538, 1573, 1598, 1602, 1637, 1637, 1641, 1655, 1687, 1693, 1712, 1744, 1748, 1752, 1767,
+    1784, 1784, 1812, 1816, 1823, 1837, 1845, 1858, 1865, 1868, 1875, 1883, 1900, 1928, 1932, 1940,
+    1948, 1956, 1973, 1981, 1996, 2004, 2030, 2030, 2034, 2034, 2034, 2053, 2061, 2071, 2075, 2075,
+    2092, 2102, 2116, 2120, 2123, 2140, 2148, 2154, 2164, 2164, 2178, 2213, 2227, 2252, 2256, 2270,
+    2287, 2291, 2291, 2305, 2305, 2309, 2323, 2334, 2349, 2363, 2367, 2371, 2375, 2383, 2383, 2387,
+    2395, 2403, 2420, 2433, 2446, 2460, 2467, 2475, 2492, 2507, 2515, 2532, 2540, 2546, 2546, 2556,
+    2564, 2581, 2598, 2630, 2633, 2633, 2641, 2649, 2674, 2678, 2684, 2701, 2716, 2716, 2724, 2752,
+    2756, 2770, 2785, 2793, 2797, 2801, 2816, 2816, 2819, 2845, 2859, 2859, 2863, 2867, 2871, 2871,
+    2882, 2914, 2940, 2954, 2968, 2976, 2986, 2990, 3016, 3024, 3052, 3060, 3064, 3074, 3078, 3093,
+    3101, 3116, 3141, 3145, 3145, 3159, 3167, 3175, 3179, 3187, 3191, 3199, 3213, 3217, 3231, 3234,
+    3234, 3247, 3251, 3259, 3263, 3271, 3289, 3289, 3304, 3319, 3347, 3355, 3363, 3371, 3388, 3402,
+    3402, 3402, 3406, 3420, 3427, 3435, 3439, 3447, 3451, 3454, 3454, 3458, 3475, 3475, 3485, 3495,
+    3499, 3503, 3507, 3511, 3519, 3534, 3538, 3542, 3542, 3574, 3578, 3586, 3590, 3605, 3622, 3630,
+    3641, 3673, 3681, 3684, 3684, 3701, 3715, 3715, 3723, 3731, 3748, 3756, 3764, 3781, 3785, 3789,
+    3803, 3811, 3837, 3854, 3869, 3873, 3881, 3885, 3899, 3907, 3915, 3943, 3958, 3962, 3966, 3980,
+    3986, 4003, 4018, 4044, 4052, 4069, 4077, 4095, 4095, 4112, 4129, 4144, 4154, 4158, 4162, 4170,
+    4174, 4189, 4197, 4211, 4225, 4229, 4237, 4241, 4245, 4259, 4262, 4266, 4301, 4305, 4313, 4348,
+    4352, 4356, 4364, 4378, 4392, 4406, 4409, 4409, 4417, 4423, 4438, 4452, 4467, 4484, 4488, 4488,
+    4492, 4500, 4514, 4514, 4518, 4532, 4540, 4540, 4540, 4548, 4565, 4600, 4604, 4604, 4608, 4615,
+    4619, 4654, 4671, 4703, 4718, 4722, 4726, 4743, 4747, 4755, 4765, 4768, 4782, 4808, 4816, 4824,
+    4828, 4843, 4847, 4855, 4890, 4901, 4926, 4930, 4937, 4945, 4945, 4945, 4949, 4957, 4961, 4978,
+    4986, 4996, 5000, 5032, 5032, 5046, 5061, 5065, 5080, 5084, 5101, 5129, 5146, 5150, 5185, 5199,
+    5199, 5214, 5242, 5259, 5274, 5278, 5313, 5313, 5316, 5324, 5338, 5344, 5379, 5379, 5390, 5415,
+    5423, 5437, 5440, 5453, 5457, 5461, 5464, 5477, 5485, 5510, 5514, 5517, 5527, 5541, 5573, 5581,
+    5598, 5598, 5598, 5601, 5607, 5617, 5645, 5653, 5681, 5681, 5689, 5697, 5701, 5729, 5746, 5749,
+    5753, 5778, 5795, 5823, 5829, 5829, 5837, 5837, 5844, 5876, 5880, 5888, 5902, 5908, 5912, 5938,
+    5955, 5955, 5959, 5974, 5978, 5991, 5997, 6011, 6019, 6023, 6031, 6037, 6041, 6045, 6062, 6077,
+    6085, 6093, 6093, 6093, 6101, 6105, 6109, 6117, 6123, 6131, 6139, 6143, 6157, 6183, 6183, 6183,
+    6187, 6198, 6198, 6201, 6201, 6201, 6205, 6213, 6239, 6239, 6239, 6274, 6278, 6286, 6286, 6314,
+    6320, 6334, 6351, 6368, 6368, 6371, 6375, 6375, 6379, 6379, 6392, 6396, 6404, 6408, 6440, 6454,
+    6458, 6486, 6490, 6507, 6515, 6519, 6526, 6534, 6549, 6566, 6601, 6605, 6630, 6634, 6642, 6656,
+    6670, 6687, 6691, 6691, 6694, 6711, 6715, 6732, 6746, 6746, 6761, 6761, 6765, 6772, 6780, 6787,
+    6812, 6812, 6826, 6826, 6843, 6847, 6851, 6855, 6863, 6867, 6875, 6892, 6896, 6904, 6912, 6920,
+    6926, 6943, 6958, 6975, 6990, 6994, 7008, 7025, 7029, 7033, 7037, 7045, 7059, 7076, 7084, 7098,
+    7106, 7106, 7120, 7134, 7147, 7151, 7168, 7172, 7180, 7184, 7192, 7200, 7208, 7215, 7229, 7229,
+    7243, 7268, 7272, 7289, 7303, 7320, 7324, 7341, 7345, 7370, 7387, 7391, 7406, 7420, 7436, 7442,
+    7457, 7467, 7481, 7498, 7506, 7512, 7526, 7551, 7565, 7569, 7575, 7590, 7598, 7606, 7610, 7645,
+    7653, 7661, 7669, 7669, 7673, 7681, 7681, 7689, 7706, 7706, 7706, 7710, 7710, 7742, 7752, 7756,
+    7764, 7790, 7794, 7802, 7806, 7820, 7820, 7837, 7845, 7853, 7868, 7903, 7911, 7911, 7917, 7931,
+    7937, 7937, 7941, 7966, 7981, 7981, 8007, 8011, 8028, 8045, 8049, 8064, 8072, 8087, 8095, 8112,
+    8129, 8140, 8140, 8155, 8169, 8169, 8186, 8199, 8203, 8217, 8231, 8235, 8239, 8243, 8250, 8261,
+    8276, 8292, 8306, 8314, 8328, 8341, 8341, 8345, 8349, 8352, 8377, 8381, 8389, 8424, 8424, 8432,
+    8449, 8453, 8461, 8465, 8476, 8480, 8488, 8502, 8506, 8510, 8510, 8527, 8544, 8551, 8555, 8558,
+    8562, 8562, 8566, 8577, 8581, 8585, 8589, 8602, 8627, 8644, 8644, 8644, 8648, 8673, 8681, 8698,
+    8713, 8717, 8725, 8742, 8742, 8746, 8749, 8752, 8766, 8780, 8784, 8799, 8803, 8820, 8824, 8828,
+    8836, 8836, 8840, 8853, 8860, 8860, 8864, 8881, 8896, 8899, 8902, 8916, 8920, 8924, 8938, 8945,
+    8977, 8991, 8995, 8995, 9003, 9017, 9017, 9021, 9035, 9061, 9065, 9073, 9077, 9085, 9089, 9103,
+    9111, 9118, 9144, 9179, 9183, 9197, 9232, 9240, 9254, 9269, 9277, 9277, 9285, 9299, 9316, 9320,
+    9320, 9324, 9328, 9332, 9345, 9345, 9349, 9363, 9370, 9374, 9377, 9394, 9398, 9406, 9406, 9409,
+    9434, 9442, 9456, 9456, 9456, 9464, 9468, 9483, 9493, 9501, 9505, 9511, 9518, 9532, 9536, 9540,
+    9543, 9551, 9565, 9569, 9573, 9581, 9581, 9585, 9602, 9605, 9613, 9630, 9634, 9634, 9634, 9648,
+    9652, 9667, 9675, 9675, 9690, 9698, 9713, 9721, 9729, 9737, 9752, 9752, 9777, 9781, 9795, 9795,
+    9803, 9831, 9845, 9855, 9872, 9872, 9889, 9899, 9916, 9916, 9920, 9934, 9941, 9945, 9951, 9959,
+    9967, 9971, 9990, 9998, 10015, 10023, 10029, 10033, 10037, 10047, 10057, 10072, 10080, 10083, 10083, 10091,
+    10117, 10121, 10135, 10143, 10156, 10170, 10178, 10186, 10190, 10200, 10208, 10233, 10247, 10251, 10255, 10269,
+    10273, 10301, 10315, 10330, 10337, 10340, 10355, 10359, 10363, 10371, 10399, 10413, 10413, 10432, 10436, 10436,
+    10450, 10450, 10458, 10466, 10480, 10488, 10492, 10506, 10514, 10517, 10517, 10528, 10541, 10545, 10549, 10566,
+    10591, 10591, 10591, 10606, 10613, 10613, 10621, 10636, 10644, 10644, 10679, 10683, 10691, 10705, 10732, 10732,
+    10742, 10746, 10759, 10762, 10776, 10780, 10797, 10812, 10816, 10844, 10848, 10851, 10866, 10866, 10894, 10898,
+    10913, 10921, 10936, 10951, 10959, 10963, 10977, 10981, 11006, 11010, 11018, 11022, 11026, 11034, 11038, 11053,
+    11061, 11061, 11078, 11086, 11090, 11107, 11117, 11125, 11129, 11157, 11171, 11186, 11190, 11198, 11233, 11250,
+    11267, 11275, 11279, 11279, 11296, 11313, 11338, 11346, 11360, 11385, 11389, 11397, 11401, 11418, 11443, 11457,
+    11460, 11477, 11492, 11520, 11524, 11530, 11538, 11546, 11550, 11567, 11580, 11615, 11619, 11623, 11627, 11642,
+    11674, 11682, 11689, 11715, 11731, 11748, 11752, 11756, 11773, 11784, 11784, 11790, 11794, 11808, 11812, 11816,
+    11819, 11834, 11838, 11842, 11867, 11884, 11887, 11895, 11909, 11913, 11919, 11919, 11919, 11927, 11942, 11946,
+    11981, 11995, 12010, 12014, 12028, 12060, 12060, 12064, 12072, 12080, 12087, 12093, 12101, 12126, 12158, 12162,
+    12166, 12170, 12184, 12188, 12196, 12200, 12213, 12213, 12217, 12252, 12259, 12274, 12282, 12290, 12307, 12315,
+    12319, 12326, 12330, 12334, 12342, 12377, 12394, 12398, 12411, 12426, 12439, 12439, 12442, 12457, 12461, 12465,
+    12473, 12481, 12489, 12493, 12503, 12510, 12538, 12555, 12570, 12585, 12600, 12617, 12621, 12636, 12668, 12672,
+    12672, 12676, 12684, 12711, 12715, 12732, 12736, 12740, 12748, 12752, 12760, 12775, 12786, 12786, 12799, 12803,
+    12807, 12815, 12830, 12834, 12838, 12842, 12859, 12869, 12876, 12889, 12897, 12914, 12918, 12926, 12929, 12937,
+    12940, 12948, 12956, 12960, 12995, 13023, 13037, 13054, 13065, 13080, 13087, 13087, 13091, 13095, 13106, 13106,
+    13116, 13124, 13124, 13152, 13166, 13170, 13187, 13187, 13195, 13203, 13203, 13207, 13207, 13224, 13224, 13239,
+    13274, 13288, 13288, 13302, 13309, 13313, 13330, 13343, 13351, 13364, 13364, 13368, 13374, 13389, 13403, 13413,
+    13417, 13449, 13453, 13479, 13479, 13493, 13497, 13501, 13518, 13518, 13526, 13534, 13534, 13538, 13541, 13551,
+    13579, 13596, 13611, 13611, 13626, 13652, 13656, 13673, 13673, 13691, 13699, 13709, 13717, 13717, 13724, 13728,
+    13745, 13749, 13757, 13776, 13804, 13804, 13821, 13825, 13842, 13846, 13859, 13859, 13863, 13867, 13867, 13884,
+    13887, 13891, 13899, 13907, 13921, 13924, 13928, 13932, 13932, 13936, 13953, 13960, 13968, 13973, 13973, 13977,
+    13985, 13996, 13996, 14004, 14012, 14026, 14034, 14048, 14052, 14056, 14064, 14068, 14082, 14086, 14103, 14116,
+    14116, 14120, 14124, 14128, 14132, 14140, 14166, 14172, 14180, 14194, 14211, 14228, 14228, 14242, 14246, 14253,
+    14261, 14265, 14283, 14287, 14322, 14339, 14339, 14354, 14354, 14358, 14366, 14374, 14374, 14380, 14391, 14399,
+    14407, 14424, 14456, 14473, 14477, 14481, 14498, 14513, 14517, 14521, 14525, 14533, 14548, 14552, 14552, 14566,
+    14570, 14570, 14576, 14584, 14588, 14592, 14592, 14592, 14596, 14613, 14617, 14621, 14625, 14629, 14637, 14643,
+    14651, 14655, 14659, 14663, 14667, 14684, 14698, 14724, 14730, 14755, 14770, 14776, 14780, 14791, 14799, 14809,
+    14820, 14837, 14841, 14849, 14868, 14883, 14898, 14898, 14916, 14916, 14920, 14934, 14934, 14938, 14953, 14979,
+    14979, 14996, 15004, 15018, 15018, 15026, 15030, 15034, 15042, 15056, 15062, 15077, 15081, 15096, 15104, 15112,
+    15129, 15140, 15148, 15156, 15160, 15160, 15168, 15172, 15176, 15201, 15201, 15201, 15209, 15209, 15213, 15213,
+    15248, 15252, 15252, 15256, 15260, 15268, 15272, 15286, 15321, 15321, 15338, 15351, 15365, 15379, 15379, 15407,
+    15439, 15443, 15454, 15462, 15466, 15466, 15470, 15487, 15500, 15500, 15500, 15504, 15521, 15546, 15550, 15564,
+    15578, 15586, 15586, 15593, 15610, 15620, 15624, 15634, 15651, 15659, 15667, 15671, 15675, 15679, 15687, 15698,
+    15702, 15710, 15718, 15722, 15757, 15757, 15765, 15769, 15775, 15782, 15790, 15790, 15794, 15808, 15808, 15825,
+    15832, 15836, 15840, 15854, 15858, 15862, 15870, 15880, 15915, 15923, 15923, 15923, 15938, 15946, 15950, 15960,
+    15960, 15970, 15984, 15998, 16013, 16030, 16034, 16042, 16052, 16060, 16068, 16085, 16102, 16106, 16120, 16124,
+    16128, 16136, 16140, 16144, 16152, 16152, 16167, 16184, 16212, 16216, 16224, 16252, 16256, 16264, 16299, 16307,
+    16311, 16315, 16318, 16326, 16341, 16358, 16383, 16398, 16398, 16405, 16405, 16405, 16413, 16413, 16428, 16436,
+    16440, 16444, 16444, 16444, 16448, 16474, 16488, 16494, 16494, 16502, 16530, 16534, 16534, 16542, 16557, 16582,
+    16582, 16582, 16608, 16622, 16626, 16661, 16675, 16675, 16688, 16702, 16706, 16710, 16718, 16725, 16739, 16742,
+    16746, 16761, 16765, 16765, 16781, 16796, 16811, 16811, 16815, 16823, 16827, 16840, 16857, 16874, 16874, 16874,
+    16887, 16891, 16891, 16895, 16909, 16913, 16913, 16927, 16942, 16956, 16981, 17016, 17044, 17059, 17059, 17073,
+    17084, 17099, 17116, 17130, 17130, 17134, 17142, 17159, 17163, 17166, 17181, 17181, 17181, 17195, 17199, 17199,
+    17203, 17203, 17220, 17234, 17250, 17264, 17268, 17271, 17279, 17294, 17304, 17329, 17337, 17340, 17357, 17365,
+    17378, 17378, 17406, 17420, 17428, 17432, 17440, 17444, 17452, 17469, 17483, 17498, 17513, 17548, 17548, 17565,
+    17579, 17587, 17601, 17615, 17647, 17651, 17677, 17692, 17709, 17744, 17748, 17752, 17766, 17766, 17776, 17790,
+    17790, 17822, 17822, 17822, 17832, 17847, 17851, 17866, 17891, 17905, 17909, 17913, 17931, 17934, 17938, 17938,
+    17946, 17950, 17950, 17964, 17972, 17972, 18000, 18004, 18004, 18015, 18021, 18038, 18038, 18055, 18059, 18072,
+    18086, 18094, 18102, 18119, 18136, 18144, 18147, 18151, 18155, 18163, 18171, 18182, 18214, 18218, 18226, 18229,
+    18229, 18237, 18241, 18245, 18249, 18249, 18253, 18253, 18270, 18270, 18285, 18302, 18306, 18306, 18314, 18314,
+    18322, 18329, 18342, 18342, 18342, 18356, 18360, 18388, 18414, 18422, 18430, 18438, 18452, 18452, 18459, 18459,
+    18463, 18471, 18488, 18492, 18500, 18508, 18522, 18526, 18554, 18554, 18567, 18571, 18579, 18582, 18586, 18586,
+    18590, 18594, 18619, 18619, 18627, 18653, 18657, 18682, 18708, 18716, 18720, 18755, 18763, 18767, 18770, 18770,
+    18789, 18797, 18814, 18817, 18834, 18842, 18849, 18857, 18857, 18865, 18872, 18886, 18892, 18896, 18904, 18919,
+    18923, 18926, 18930, 18947, 18962, 18977, 18994, 19011, 19037, 19051, 19059, 19076, 19087, 19087, 19091, 19109,
+    19112, 19129, 19137, 19145, 19148, 19156, 19182, 19189, 19204, 19211, 19219, 19233, 19241, 19252, 19267, 19271,
+    19288, 19305, 19313, 19317, 19342, 19361, 19376, 19380, 19388, 19405, 19430, 19434, 19438, 19452, 19459, 19487,
+    19504, 19508, 19519, 19519, 19534, 19538, 19542, 19550, 19575, 19578, 19585, 19596, 19613, 19617, 19620, 19623,
+    19631, 19648, 19652, 19656, 19659, 19676, 19683, 19686, 19714, 19718, 19722, 19739, 19743, 19757, 19765, 19800,
+    19800, 19808, 19816, 19816, 19816, 19826, 19840, 19844, 19852, 19867, 19902, 19917, 19932, 19936, 19968, 19971,
+    19979, 19996, 20000, 20004, 20021, 20021, 20049, 20063, 20076, 20089, 20089, 20106, 20123, 20123, 20131, 20145,
+    20158, 20173, 20187, 20195, 20202, 20237, 20251, 20251, 20251, 20255, 20263, 20271, 20271, 20271, 20275, 20289,
+    20289, 20317, 20321, 20353, 20361, 20378, 20378, 20413, 20424, 20441, 20441, 20458, 20462, 20477, 20494, 20498,
+    20530, 20547, 20553, 20585, 20620, 20624, 20639, 20667, 20667, 20682, 20682, 20686, 20690, 20707, 20742, 20768,
+    20779, 20794, 20811, 20811, 20811, 20811, 20811, 20843, 20851, 20857, 20874, 20882, 20889, 20893, 20897, 20901,
+    20904, 20912, 20922, 20948, 20952, 20984, 21001, 21004, 21008, 21016, 21024, 21024, 21038, 21055, 21055, 21073,
+    21077, 21094, 21098, 21102, 21105, 21109, 21137, 21140, 21148, 21156, 21160, 21164, 21164, 21199, 21203, 21213,
+    21227, 21231, 21235, 21239, 21256, 21270, 21298, 21311, 21319, 21319, 21329, 21337, 21351, 21355, 21363, 21371,
+    21379, 21379, 21387, 21404, 21410, 21414, 21424, 21428, 21428, 21432, 21439, 21443, 21447, 21451, 21468, 21478,
+    21486, 21486, 21492, 21500, 21506, 21506, 21519, 21523, 21537, 21551, 21555, 21563, 21567, 21571, 21575, 21579,
+    21593, 21600, 21603, 21607, 21610, 21635, 21650, 21664, 21678, 21693, 21697, 21701, 21705, 21709, 21713, 21716,
+    21748, 21765, 21776, 21793, 21810, 21827, 21844, 21848, 21852, 21860, 21877, 21891, 21891, 21895, 21903, 21938,
+    21942, 21950, 21960, 21968, 21976, 21984, 21988, 22002, 22010, 22010, 22010, 22017, 22021, 22021, 22038, 22045,
+    22070, 22074, 22078, 22082, 22090, 22094, 22102, 22102, 22106, 22106, 22123, 22123, 22127, 22141, 22145, 22162,
+    22179, 22183, 22194, 22194, 22202, 22219, 22223, 22237, 22272, 22300, 22308, 22316, 22333, 22337, 22345, 22360,
+    22367, 22384, 22388, 22388, 22402, 22406, 22420, 22424, 22428, 22442, 22446, 22460, 22468, 22468, 22475, 22479,
+    22494, 22494, 22511, 22515, 22523, 22523, 22540, 22544, 22548, 22563, 22573, 22579, 22579, 22579, 22594, 22594,
+    22611, 22631, 22631, 22646, 22654, 22662, 22662, 22662, 22672, 22676, 22676, 22691, 22697, 22701, 22716, 22716,
+    22720, 22734, 22742, 22759, 22767, 22771, 22779, 22783, 22787, 22819, 22833, 22850, 22861, 22869, 22873, 22881,
+    22895, 22902, 22917, 22930, 22930, 22958, 22983, 22987, 22995, 23002, 23013, 23013, 23027, 23031, 23039, 23043,
+    23047, 23051, 23054, 23067, 23075, 23078, 23082, 23095, 23095, 23095, 23099, 23113, 23117, 23125, 23140, 23146,
+    23153, 23167, 23199, 23207, 23221, 23221, 23235, 23249, 23266, 23280, 23284, 23287, 23291, 23299, 23303, 23307,
+    23315, 23315, 23328, 23336, 23344, 23358, 23362, 23377, 23381, 23389, 23406, 23421, 23425, 23433, 23447, 23451,
+    23468, 23476, 23484, 23484, 23501, 23505, 23530, 23534, 23551, 23564, 23583, 23583, 23587, 23595, 23599, 23599,
+    23599, 23616, 23620, 23636, 23640, 23644, 23648, 23665, 23679, 23689, 23695, 23703, 23703, 23717, 23725, 23729,
+    23733, 23768, 23775, 23800, 23817, 23825, 23833, 23865, 23865, 23882, 23890, 23894, 23902, 23910, 23927, 23931,
+    23939, 23943, 23947, 23951, 23955, 23981, 24006, 24021, 24038, 24052, 24069, 24083, 24100, 24104, 24118, 24131,
+    24139, 24153, 24161, 24165, 24172, 24189, 24197, 24197, 24207, 24224, 24252, 24284, 24292, 24300, 24314, 24331,
+    24348, 24363, 24366, 24370, 24384, 24394, 24398, 24426, 24454, 24458, 24466, 24466, 24466, 24480, 24488, 24516,
+    24529, 24529, 24533, 24547, 24547, 24550, 24554, 24558, 24568, 24600, 24604, 24623, 24631, 24635, 24639, 24647,
+    24664, 24664, 24668, 24672, 24686, 24686, 24690, 24690, 24690, 24698, 24698, 24724, 24739, 24756, 24756, 24770,
+    24783, 24787, 24804, 24808, 24822, 24848, 24852, 24856, 24860, 24868, 24893, 24893, 24907, 24911, 24915, 24929,
+    24933, 24950, 24964, 24964, 24989, 25004, 25019, 25044, 25069, 25083, 25098, 25112, 25120, 25130, 25138, 25155,
+    25159, 25174, 25178, 25191, 25195, 25199, 25203, 25217, 25231, 25259, 25273, 25286, 25303, 25338, 25342, 25356,
+    25363, 25367, 25371, 25388, 25404, 25412, 25420, 25445, 25460, 25464, 25481, 25491, 25506, 25509, 25534, 25562,
+    25562, 25562, 25578, 25593, 25597, 25601, 25601, 25611, 25615, 25632, 25646, 25654, 25665, 25682, 25682, 25689,
+    25697, 25705, 25705, 25722, 25736, 25746, 25760, 25760, 25767, 25775, 25775, 25792, 25800, 25807, 25811, 25811,
+    25818, 25825, 25828, 25836, 25853, 25878, 25881, 25909, 25941, 25948, 25952, 25956, 25991, 25991, 25995, 26010,
+    26016, 26044, 26048, 26052, 26056, 26063, 26073, 26081, 26089, 26114, 26131, 26145, 26153, 26153, 26157, 26174,
+    26188, 26192, 26200, 26203, 26216, 26216, 26220, 26246, 26262, 26270, 26278, 26295, 26309, 26317, 26332, 26346,
+    26360, 26364, 26364, 26372, 26372, 26400, 26417, 26425, 26440, 26472, 26480, 26484, 26488, 26513, 26513, 26517,
+    26525, 26533, 26550, 26558, 26566, 26581, 26585, 26585, 26585, 26599, 26603, 26607, 26611, 26619, 26654, 26658,
+    26690, 26722, 26730, 26734, 26742, 26759, 26763, 26767, 26773, 26777, 26785, 26789, 26793, 26797, 26801, 26818,
+    26818, 26822, 26826, 26830, 26836, 26844, 26852, 26856, 26864, 26879, 26896, 26900, 26908, 26925, 26933, 26933,
+    26939, 26952, 26960, 26964, 26968, 26976, 26980, 26988, 27016, 27033, 27041, 27066, 27066, 27070, 27080, 27083,
+    27100, 27104, 27104, 27108, 27116, 27133, 27147, 27155, 27163, 27167, 27181, 27185, 27196, 27211, 27211, 27230,
+    27234, 27247, 27262, 27270, 27278, 27284, 27288, 27292, 27292, 27306, 27320, 27324, 27349, 27362, 27379, 27393,
+    27404, 27412, 27412, 27420, 27420, 27423, 27437, 27441, 27449, 27464, 27468, 27476, 27483, 27487, 27495, 27509,
+    27535, 27539, 27542, 27542, 27549, 27553, 27568, 27575, 27589, 27603, 27607, 27624, 27641, 27654, 27658, 27672,
+    27686, 27692, 27695, 27712, 27720, 27730, 27730, 27734, 27769, 27786, 27790, 27807, 27811, 27828, 27843, 27847,
+    27851, 27855, 27872, 27878, 27878, 27895, 27909, 27913, 27921, 27925, 27929, 27937, 27947, 27958, 27958, 27962,
+    27966, 27980, 27987, 27991, 27994, 28009, 28023, 28027, 28041, 28041, 28049, 28057, 28082, 28099, 28105, 28105,
+    28109, 28144, 28148, 28165, 28193, 28201, 28205, 28231, 28248, 28255, 28259, 28263, 28267, 28271, 28285, 28293,
+    28293, 28297, 28305, 28309, 28313, 28345, 28352, 28380, 28405, 28419, 28433, 28465, 28500, 28500, 28500, 28504,
+    28519, 28536, 28562, 28565, 28573, 28608, 28622, 28636, 28642, 28646, 28661, 28669, 28669, 28673, 28690, 28707,
+    28721, 28725, 28729, 28729, 28742, 28768, 28782, 28799, 28803, 28803, 28820, 28855, 28872, 28880, 28895, 28930,
+    28945, 28955, 28966, 28973, 28977, 28981, 28984, 28998, 29006, 29006, 29009, 29024, 29028, 29031, 29035, 29060,
+    29063, 29063, 29071, 29088, 29098, 29098, 29113, 29117, 29130, 29144, 29159, 29163, 29180, 29184, 29188, 29205,
+    29211, 29214, 29218, 29218, 29233, 29241, 29245, 29253, 29261, 29269, 29295, 29309, 29313, 29329, 29333, 29341,
+    29355, 29359, 29367, 29375, 29375, 29390, 29390, 29404, 29412, 29416, 29424, 29438, 29446, 29450, 29463, 29467,
+    29475, 29486, 29486, 29500, 29504, 29512, 29547, 29573, 29577, 29581, 29588, 29596, 29604, 29619, 29636, 29644,
+    29652, 29687, 29695, 29703, 29707, 29715, 29723, 29727, 29741, 29741, 29773, 29777, 29781, 29784, 29790, 29794,
+    29811, 29826, 29840, 29866, 29883, 29894, 29911, 29928, 29945, 29951, 29951, 29955, 29990, 30007, 30013, 30021,
+    30047, 30055, 30059, 30067, 30084, 30098, 30106, 30120, 30137, 30141, 30155, 30159, 30163, 30167, 30171, 30188,
+    30214, 30246, 30260, 30275, 30290, 30294, 30311, 30311, 30319, 30333, 30333, 30358, 30362, 30370, 30378, 30395,
+    30403, 30418, 30426, 30432, 30440, 30448, 30452, 30460, 30468, 30472, 30476, 30484, 30501, 30505, 30522, 30547,
+    30561, 30565, 30582, 30599, 30607, 30615, 30630, 30647, 30655, 30668, 30672, 30683, 30698, 30708, 30716, 30733,
+    30741, 30755, 30770, 30805, 30809, 30826, 30834, 30838, 30853, 30861, 30861, 30861, 30896, 30911, 30937, 30944,
+    30948, 30952, 30963, 30980, 30984, 30998, 31001, 31005, 31009, 31013, 31028, 31036, 31040, 31048, 31052, 31060,
+    31060, 31074, 31082, 31096, 31111, 31125, 31129, 31146, 31146, 31160, 31174, 31182, 31186, 31190, 31204, 31220,
+    31224, 31224, 31228, 31263, 31267, 31275, 31310, 31318, 31332, 31357, 31389, 31393, 31404, 31412, 31426, 31426,
+    31436, 31439, 31443, 31468, 31482, 31514, 31528, 31536, 31549, 31553, 31553, 31561, 31561, 31565, 31569, 31576,
+    31608, 31608, 31618, 31635, 31652, 31655, 31655, 31658, 31666, 31670, 31684, 31698, 31712, 31719, 31727, 31741,
+    31748, 31748, 31763, 31778, 31788, 31796, 31800, 31814, 31846, 31863, 31880, 31895, 31909, 31913, 31920, 31928,
+    31945, 31958, 31964, 31978, 31993, 31997, 32016, 32020, 32033, 32036, 32040, 32064, 32099, 32125, 32139, 32154,
+    32162, 32176, 32179, 32183, 32197, 32207, 32218, 32235, 32239, 32239, 32243, 32247, 32261, 32265, 32280, 32290,
+    32318, 32326, 32330, 32355, 32359, 32359, 32373, 32384, 32397, 32405, 32413, 32430, 32440, 32448, 32452, 32456,
+    32460, 32460, 32464, 32481, 32489, 32506, 32514, 32517, 32531, 32531, 32534, 32549, 32553, 32573, 32577, 32603,
+    32603, 32617, 32625, 32629, 32664, 32668, 32676, 32684, 32701, 32709, 32734, 32742, 32746, 32778, 32795, 32827,
+    32835, 32843, 32862, 32866, 32869, 32873, 32905, 32905, 32920, 32927, 32942, 32959, 32973, 32977, 32992, 32992,
+    32999, 33007, 33021, 33047, 33055, 33059, 33076, 33089, 33092, 33096, 33110, 33118, 33125, 33135, 33138, 33153,
+    33157, 33160, 33188, 33196, 33211, 33219, 33232, 33246, 33246, 33254, 33254, 33271, 33286, 33294, 33298, 33315,
+    33350, 33358, 33366, 33370, 33402, 33410, 33418, 33432, 33446, 33454, 33467, 33471, 33485, 33502, 33502, 33506,
+    33514, 33522, 33526, 33540, 33544, 33544, 33572, 33580, 33580, 33606, 33610, 33614, 33622, 33626, 33658, 33666,
+    33683, 33697, 33701, 33714, 33714, 33728, 33736, 33751, 33751, 33759, 33773, 33781, 33795, 33823, 33848, 33852,
+    33869, 33873, 33908, 33936, 33940, 33965, 33973, 33977, 33994, 34002, 34009, 34013, 34017, 34027, 34031, 34039,
+    34053, 34070, 34080, 34097, 34105, 34115, 34129, 34133, 34137, 34154, 34169, 34183, 34191, 34199, 34203, 34211,
+    34215, 34230, 34238, 34246, 34249, 34262, 34266, 34270, 34273, 34288, 34305, 34313, 34317, 34334, 34351, 34368,
+    34368, 34376, 34384, 34388, 34394, 34426, 34430, 34444, 34452, 34466, 34481, 34489, 34508, 34512, 34544, 34544,
+    34555, 34569, 34573, 34590, 34594, 34602, 34604, 34608, 34612, 34615, 34618, 34626, 34626, 34634, 34642, 34646,
+    34660, 34668, 34683, 34700, 34708, 34736, 34744, 34758, 34762, 34762, 34770, 34776, 34776, 34780, 34787, 34795,
+    34795, 34809, 34813, 34813, 34813, 34813, 34824, 34852, 34856, 34863, 34871, 34879, 34907, 34923, 34940, 34957,
+    34971, 34985, 34993, 35003, 35031, 35039, 35056, 35075, 35079, 35096, 35096, 35096, 35100, 35114, 35117, 35134,
+    35151, 35151, 35155, 35169, 35186, 35190, 35198, 35202, 35216, 35233, 35250, 35256, 35256, 35266, 35274, 35282,
+    35286, 35294, 35294, 35298, 35309, 35324, 35338, 35351, 35358, 35368, 35385, 35399, 35399, 35403, 35417, 35432,
+    35440, 35453, 35457, 35471, 35475, 35489, 35489, 35496, 35503, 35520, 35526, 35530, 35534, 35542, 35570, 35578,
+    35597, 35611, 35628, 35636, 35640, 35654, 35662, 35688, 35692, 35696, 35704, 35714, 35742, 35742, 35746, 35750,
+    35764, 35771, 35771, 35799, 35805, 35813, 35817, 35821, 35838, 35855, 35869, 35879, 35887, 35901, 35915, 35923,
+    35958, 35972, 35972, 35983, 35997, 36010, 36025, 36029, 36037, 36041, 36044, 36047, 36047, 36054, 36067, 36071,
+    36075, 36083, 36087, 36087, 36091, 36095, 36099, 36116, 36133, 36137, 36147, 36161, 36176, 36184, 36188, 36223,
+    36234, 36259, 36263, 36277, 36285, 36296, 36304, 36308, 36308, 36312, 36326, 36340, 36355, 36359, 36363, 36377,
+    36381, 36385, 36417, 36421, 36425, 36429, 36433, 36433, 36446, 36449, 36466, 36474, 36482, 36490, 36507, 36521,
+    36538, 36542, 36559, 36574, 36582, 36596, 36602, 36610, 36614, 36614, 36631, 36631, 36639, 36641, 36649, 36649,
+    36649, 36666, 36670, 36684, 36692, 36702, 36702, 36710, 36718, 36722, 36730, 36737, 36752, 36766, 36781, 36813,
+    36817, 36834, 36845, 36845, 36853, 36861, 36868, 36876, 36893, 36910, 36942, 36942, 36946, 36960, 36978, 36982,
+    36982, 36999, 37012, 37016, 37031, 37046, 37050, 37076, 37084, 37088, 37092, 37096, 37111, 37114, 37122, 37139,
+    37150, 37163, 37170, 37185, 37188, 37223, 37237, 37246, 37250, 37250, 37250, 37258, 37266, 37276, 37276, 37289,
+    37297, 37301, 37329, 37329, 37333, 37341, 37341, 37360, 37368, 37368, 37368, 37385, 37400, 37408, 37421, 37438,
+    37442, 37442, 37446, 37450, 37450, 37458, 37462, 37470, 37474, 37478, 37486, 37492, 37527, 37531, 37535, 37538,
+    37563, 37571, 37575, 37579, 37579, 37604, 37607, 37611, 37617, 37624, 37624, 37628, 37636, 37661, 37686, 37694,
+    37694, 37694, 37700, 37714, 37722, 37730, 37734, 37742, 37742, 37750, 37758, 37758, 37766, 37783, 37787, 37801,
+    37805, 37831, 37847, 37882, 37886, 37886, 37899, 37907, 37911, 37911, 37911, 37925, 37940, 37954, 37960, 37964,
+    37981, 37992, 37999, 38007, 38035, 38050, 38058, 38058, 38062, 38094, 38108, 38116, 38124, 38131, 38141, 38158,
+    38172, 38179, 38193, 38193, 38201, 38218, 38226, 38233, 38241, 38256, 38260, 38264, 38278, 38285, 38295, 38298,
+    38315, 38323, 38327, 38335, 38335, 38339, 38356, 38360, 38364, 38372, 38380, 38380, 38386, 38390, 38407, 38415,
+    38443, 38447, 38461, 38486, 38486, 38490, 38507, 38511, 38539, 38556, 38581, 38585, 38620, 38620, 38635, 38667,
+    38692, 38706, 38714, 38722, 38736, 38744, 38744, 38748, 38756, 38770, 38778, 38795, 38803, 38820, 38820, 38846,
+    38861, 38865, 38882, 38882, 38890, 38890, 38898, 38902, 38906, 38910, 38921, 38956, 38960, 38995, 39010, 39024,
+    39032, 39035, 39049, 39066, 39080, 39090, 39098, 39112, 39120, 39128, 39160, 39175, 39190, 39207, 39211, 39224,
+    39239, 39243, 39251, 39255, 39272, 39289, 39297, 39311, 39325, 39329, 39333, 39347, 39351, 39386, 39403, 39417,
+    39425, 39442, 39474, 39488, 39501, 39533, 39533, 39547, 39557, 39565, 39572, 39579, 39583, 39591, 39598, 39630,
+    39662, 39679, 39694, 39698, 39702, 39706, 39710, 39714, 39714, 39718, 39732, 39736, 39740, 39746, 39760, 39764,
+    39768, 39776, 39780, 39783, 39787, 39791, 39808, 39818, 39827, 39835, 39839, 39843, 39847, 39864, 39872, 39876,
+    39884, 39892, 39892, 39907, 39911, 39921, 39925, 39942, 39957, 39972, 39996, 40020, 40027, 40044, 40048, 40062,
+    40070, 40084, 40092, 40127, 40159, 40159, 40163, 40171, 40179, 40183, 40183, 40186, 40200, 40204, 40219, 40227,
+    40231, 40245, 40249, 40249, 40253, 40270, 40270, 40274, 40278, 40303, 40307, 40321, 40338, 40338, 40346, 40363,
+    40378, 40413, 40430, 40456, 40464, 40492, 40492, 40500, 40508, 40512, 40516, 40524, 40527, 40542, 40542, 40542,
+    40546, 40581, 40596, 40600, 40611, 40624, 40628, 40636, 40640, 40675, 40689, 40702, 40706, 40720, 40724, 40739,
+    40771, 40785, 40793, 40808, 40808, 40834, 40848, 40856, 40863, 40863, 40874, 40878, 40891, 40905, 40919, 40934,
+    40938, 40942, 40959, 40973, 40980, 40988, 41002, 41017, 41017, 41025, 41039, 41056, 41062, 41062, 41066, 41083,
+    41102, 41106, 41106, 41110, 41127, 41135, 41148, 41163, 41167, 41167, 41175, 41185, 41185, 41189, 41189, 41206,
+    41214, 41218, 41231, 41245, 41245, 41277, 41291, 41298, 41315, 41332, 41336, 41344, 41348, 41348, 41365, 41379,
+    41383, 41387, 41391, 41408, 41425, 41433, 41433, 41447, 41464, 41464, 41467, 41495, 41509, 41513, 41513, 41527,
+    41535, 41560, 41564, 41564, 41589, 41595, 41609, 41641, 41649, 41657, 41671, 41675, 41681, 41695, 41703, 41703,
+    41707, 41739, 41753, 41761, 41765, 41769, 41777, 41794, 41822, 41838, 41842, 41846, 41860, 41868, 41872, 41876,
+    41880, 41880, 41884, 41898, 41901, 41901, 41915, 41941, 41949, 41949, 41959, 41974, 41988, 42001, 42005, 42022,
+    42030, 42030, 42038, 42049, 42063, 42080, 42097, 42101, 42109, 42113, 42113, 42127, 42141, 42149, 42157, 42161,
+    42178, 42182, 42196, 42200, 42208, 42208, 42222, 42236, 42240, 42244, 42252, 42266, 42280, 42308, 42312, 42316,
+    42320, 42328, 42328, 42328, 42336, 42340, 42372, 42376, 42391, 42399, 42416, 42416, 42424, 42438, 42455, 42480,
+    42484, 42484, 42498, 42513, 42521, 42534, 42538, 42546, 42574, 42591, 42595, 42599, 42603, 42607, 42611, 42615,
+    42618, 42624, 42634, 42642, 42659, 42674, 42700, 42700, 42717, 42732, 42740, 42744, 42744, 42752, 42756, 42773,
+    42773, 42788, 42798, 42823, 42823, 42827, 42835, 42861, 42876, 42880, 42884, 42897, 42905, 42913, 42938, 42952,
+    42984, 42987, 42987, 43013, 43026, 43043, 43047, 43055, 43055, 43087, 43115, 43130, 43134, 43160, 43164, 43178,
+    43186, 43201, 43218, 43222, 43236, 43243, 43257, 43274, 43274, 43274, 43282, 43297, 43297, 43325, 43335, 43339,
+    43343, 43360, 43360, 43377, 43381, 43398, 43406, 43414, 43429, 43443, 43447, 43462, 43479, 43506, 43513, 43513,
+    43517, 43528, 43542, 43546, 43554, 43558, 43575, 43583, 43583, 43600, 43608, 43622, 43622, 43632, 43649, 43664,
+    43672, 43678, 43678, 43682, 43695, 43695, 43699, 43714, 43714, 43717, 43721, 43756, 43769, 43779, 43783, 43800,
+    43808, 43834, 43848, 43876, 43891, 43894, 43898, 43923, 43949, 43953, 43957, 43961, 43965, 43969, 43983, 43991,
+    44026, 44040, 44040, 44057, 44060, 44063, 44067, 44067, 44084, 44088, 44092, 44095, 44112, 44126, 44130, 44134,
+    44151, 44166, 44183, 44191, 44195, 44203, 44216, 44220, 44252, 44277, 44277, 44280, 44288, 44292, 44306, 44312,
+    44319, 44323, 44355, 44355, 44363, 44367, 44384, 44388, 44402, 44406, 44423, 44427, 44431, 44446, 44450, 44450,
+    44458, 44473, 44481, 44495, 44509, 44513, 44521, 44524, 44528, 44545, 44549, 44574, 44578, 44592, 44596, 44604,
+    44607, 44615, 44632, 44667, 44681, 44685, 44689, 44695, 44710, 44717, 44742, 44750, 44765, 44779, 44779, 44783,
+    44797, 44808, 44816, 44824, 44832, 44845, 44849, 44884, 44892, 44896, 44904, 44921, 44925, 44940, 44954, 44958,
+    44962, 44976, 44980, 44980, 44988, 44988, 44991, 45006, 45006, 45014, 45029, 45029, 45044, 45058, 45075, 45089,
+    45089, 45109, 45109, 45117, 45131, 45142, 45159, 45173, 45183, 45183, 45187, 45193, 45197, 45201, 45201, 45207,
+    45221, 45238, 45253, 45267, 45282, 45310, 45327, 45331, 45346, 45372, 45376, 45380, 45388, 45416, 45424, 45441,
+    45445, 45453, 45453, 45453, 45457, 45457, 45457, 45460, 45468, 45474, 45482, 45514, 45528, 45532, 45536, 45536,
+    45542, 45550, 45578, 45586, 45594, 45609, 45613, 45631, 45659, 45676, 45684, 45701, 45715, 45715, 45732, 45736,
+    45744, 45758, 45772, 45776, 45789, 45797, 45812, 45816, 45851, 45866, 45883, 45891, 45891, 45895, 45899, 45907,
+    45907, 45911, 45926, 45930, 45936, 45936, 45940, 45944, 45947, 45954, 45954, 45968, 45976, 45991, 45995, 46012,
+    46015, 46022, 46030, 46044, 46051, 46067, 46084, 46098, 46102, 46106, 46110, 46110, 46124, 46128, 46128, 46132,
+    46158, 46158, 46166, 46166, 46173, 46176, 46186, 46190, 46205, 46237, 46245, 46248, 46258, 46266, 46280, 46286,
+    46290, 46304, 46321, 46325, 46329, 46329, 46361, 46369, 46397, 46403, 46418, 46422, 46448, 46452, 46452, 46467,
+    46502, 46509, 46523, 46523, 46538, 46563, 46563, 46566, 46579, 46596, 46610, 46635, 46648, 46665, 46682, 46699,
+    46703, 46729, 46729, 46757, 46765, 46775, 46779, 46793, 46797, 46801, 46818, 46835, 46843, 46851, 46855, 46872,
+    46880, 46897, 46901, 46909, 46924, 46928, 46945, 46959, 46967, 46967, 46984, 46984, 47019, 47036, 47039, 47056,
+    47064, 47070, 47084, 47099, 47113, 47127, 47144, 47148, 47165, 47171, 47175, 47188, 47201, 47215, 47232, 47260,
+    47264, 47264, 47278, 47293, 47307, 47311, 47311, 47319, 47351, 47351, 47362, 47366, 47369, 47373, 47377, 47385,
+    47399, 47409, 47413, 47421, 47429, 47440, 47444, 47452, 47467, 47467, 47486, 47490, 47498, 47508, 47525, 47535,
+    47548, 47548, 47574, 47587, 47595, 47610, 47624, 47627, 47642, 47646, 47653, 47670, 47674, 47680, 47694, 47698,
+    47701, 47705, 47705, 47720, 47734, 47742, 47759, 47776, 47791, 47808, 47825, 47829, 47855, 47872, 47876, 47880,
+    47893, 47901, 47909, 47913, 47921, 47925, 47925, 47929, 47933, 47933, 47937, 47947, 47951, 47962, 47966, 47970,
+    47977, 47981, 47985, 47999, 48003, 48007, 48017, 48025, 48029, 48055, 48055, 48059, 48084, 48092, 48092, 48095,
+    48103, 48107, 48115, 48123, 48131, 48148, 48162, 48166, 48174, 48182, 48186, 48203, 48207, 48207, 48213, 48239,
+    48243, 48257, 48265, 48280, 48286, 48300, 48304, 48312, 48320, 48323, 48337, 48337, 48345, 48380, 48384, 48401,
+    48415, 48430, 48455, 48463, 48467, 48481, 48489, 48497, 48511, 48515, 48522, 48526, 48534, 48534, 48542, 48546,
+    48571, 48575, 48592, 48605, 48612, 48612, 48612, 48629, 48637, 48672, 48676, 48692, 48692, 48720, 48734, 48749,
+    48749, 48766, 48770, 48795, 48812, 48825, 48833, 48848, 48862, 48870, 48876, 48880, 48894, 48926, 48934, 48938,
+    48946, 48950, 48965, 48971, 48988, 48988, 48988, 49003, 49020, 49024, 49028, 49054, 49058, 49071, 49085, 49093,
+    49093, 49107, 49111, 49125, 49132, 49140, 49144, 49151, 49159, 49163, 49167, 49199, 49217, 49242, 49256, 49256,
+    49270, 49274, 49278, 49295, 49299, 49306, 49316, 49333, 49337, 49341, 49345, 49360, 49370, 49378, 49393, 49397,
+    49412, 49420, 49437, 49445, 49462, 49488, 49492, 49506, 49523, 49523, 49530, 49538, 49555, 49569, 49573, 49581,
+    49585, 49613, 49630, 49634, 49642, 49659, 49691, 49723, 49727, 49753, 49757, 49757, 49761, 49769, 49784, 49795,
+    49803, 49807, 49839, 49847, 49862, 49894, 49898, 49902, 49919, 49923, 49923, 49940, 49948, 49956, 49960, 49967,
+    49970, 49987, 49995, 50001, 50005, 50018, 50018, 50018, 50026, 50040, 50048, 50061, 50069, 50073, 50077, 50085,
+    50113, 50121, 50125, 50157, 50161, 50176, 50189, 50189, 50199, 50203, 50218, 50221, 50236, 50242, 50274, 50285,
+    50298, 50301, 50305, 50313, 50317, 50332, 50347, 50361, 50361, 50369, 50384, 50391, 50399, 50407, 50411, 50428,
+    50432, 50436, 50450, 50458, 50464, 50464, 50478, 50482, 50490, 50504, 50509, 50512, 50515, 50519, 50523, 50538,
+    50552, 50560, 50568, 50582, 50586, 50590, 50597, 50610, 50610, 50626, 50630, 50638, 50655, 50663, 50663, 50677,
+    50685, 50711, 50725, 50750, 50754, 50780, 50794, 50811, 50815, 50819, 50834, 50849, 50863, 50867, 50867, 50899,
+    50903, 50903, 50920, 50924, 50941, 50967, 50971, 50979, 50983, 50998, 50998, 50998, 51013, 51021, 51021, 51025,
+    51032, 51040, 51048, 51063, 51076, 51091, 51099, 51116, 51133, 51159, 51163, 51188, 51188, 51188, 51205, 51209,
+    51217, 51225, 51229, 51232, 51235, 51239, 51239, 51256, 51267, 51275, 51283, 51283, 51300, 51315, 51332, 51357,
+    51374, 51391, 51395, 51403, 51406, 51414, 51429, 51429, 51433, 51441, 51455, 51463, 51463, 51463, 51463, 51471,
+    51488, 51496, 51524, 51531, 51539, 51543, 51554, 51572, 51589, 51607, 51639, 51649, 51681, 51687, 51695, 51699,
+    51703, 51711, 51728, 51732, 51736, 51761, 51778, 51784, 51809, 51813, 51823, 51840, 51848, 51852, 51855, 51870,
+    51898, 51906, 51923, 51931, 51935, 51939, 51943, 51957, 51974, 51982, 51990, 52004, 52021, 52047, 52058, 52071,
+    52071, 52074, 52074, 52091, 52106, 52120, 52124, 52132, 52146, 52152, 52152, 52169, 52195, 52203, 52238, 52246,
+    52278, 52291, 52323, 52333, 52341, 52345, 52362, 52390, 52407, 52411, 52419, 52436, 52444, 52447, 52447, 52479,
+    52479, 52493, 52506, 52510, 52516, 52533, 52537, 52544, 52551, 52555, 52563, 52598, 52624, 52624, 52638, 52653,
+    52661, 52678, 52678, 52695, 52698, 52715, 52721, 52728, 52742, 52756, 52760, 52788, 52813, 52821, 52835, 52863,
+    52880, 52895, 52895, 52899, 52906, 52916, 52920, 52928, 52936, 52950, 52954, 52954, 52962, 52972, 52976, 53002,
+    53006, 53020, 53045, 53049, 53057,
+};
+
+static constexpr unsigned char emoji_data[] = {
+    0xf0, 0x9f, 0x8f, 0x84, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8,
+    0x8f, 0xf0, 0x9f, 0x91, 0xb7, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef,
+    0xb8, 0x8f, 0xf0, 0x9f, 0xab, 0xb0, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f,
+    0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xb0, 0xf0, 0x9f, 0x87, 0xb2, 0xf0, 0x9f, 0x87,
+    0xb2, 0xf0, 0x9f, 0x9a, 0x9b, 0xf0, 0x9f, 0xa9, 0xb1, 0xf0, 0x9f, 0xa7, 0x9a, 0xf0, 0x9f, 0x8f,
+    0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x87, 0xa6, 0xf0, 0x9f,
+    0x87, 0xb7, 0xf0, 0x9f, 0x92, 0x82, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82,
+    0x31, 0xef, 0xb8, 0x8f, 0xe2, 0x83, 0xa3, 0xe2, 0x9e, 0xbf, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f,
+    0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x9a, 0x96, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x91, 0xf0,
+    0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xb1, 0xf0, 0x9f, 0xa7, 0xb0, 0xf0, 0x9f,
+    0x92, 0x86, 0xf0, 0x9f, 0x8f, 0xbb, 0x36, 0xef, 0xb8, 0x8f, 0xe2, 0x83, 0xa3, 0xe2, 0x9c, 0x8c,
+    0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8e, 0xa4, 0xf0,
+    0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x87, 0xae, 0xf0, 0x9f, 0x87, 0xb4,
+    0xf0, 0x9f, 0xa7, 0x97, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f,
+    0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xb1, 0xe2, 0x9d, 0x87,
+    0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0xa6, 0xaf, 0xf0, 0x9f, 0x87, 0xa8, 0xf0, 0x9f, 0x87, 0xbc, 0xe2, 0x9b, 0xb7, 0xf0, 0x9f, 0x91,
+    0xa9, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80,
+    0x8d, 0xf0, 0x9f, 0x8e, 0x93, 0xe2, 0x9a, 0xaa, 0xf0, 0x9f, 0x8c, 0xa6, 0xef, 0xb8, 0x8f, 0xf0,
+    0x9f, 0x94, 0xa5, 0xf0, 0x9f, 0x8c, 0x84, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2,
+    0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xb0, 0xe2, 0x9d, 0x93, 0xf0, 0x9f, 0x92, 0x87, 0xf0, 0x9f, 0x8f,
+    0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xe2, 0x98, 0xb9, 0xf0, 0x9f, 0x92,
+    0x87, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xe2, 0x81, 0x89, 0xf0, 0x9f,
+    0x8f, 0xb3, 0xe2, 0x80, 0x8d, 0xe2, 0x9a, 0xa7, 0xf0, 0x9f, 0xa4, 0xa6, 0xf0, 0x9f, 0x91, 0xa9,
+    0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbf,
+    0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b,
+    0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x91, 0xa9, 0xf0,
+    0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f,
+    0x96, 0xa5, 0xf0, 0x9f, 0x96, 0x90, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x91, 0xa8, 0xe2, 0x80,
+    0x8d, 0xf0, 0x9f, 0x8e, 0xa4, 0xf0, 0x9f, 0xa7, 0x9d, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d,
+    0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80,
+    0x8d, 0xf0, 0x9f, 0x92, 0xbb, 0xf0, 0x9f, 0x9a, 0xb5, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d,
+    0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0xa4, 0x9d, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x91,
+    0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8c, 0xbe, 0xf0, 0x9f, 0x8e, 0xa7, 0xf0, 0x9f, 0x91, 0xa9,
+    0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0,
+    0x9f, 0x8f, 0x99, 0xef, 0xb8, 0x8f, 0xe2, 0xac, 0x85, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x8e,
+    0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x8f,
+    0x98, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x99, 0x8e, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f,
+    0x91, 0xac, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f,
+    0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2,
+    0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x91, 0x83, 0xf0, 0x9f,
+    0x8f, 0xbe, 0xf0, 0x9f, 0x98, 0xad, 0xf0, 0x9f, 0x94, 0x90, 0xf0, 0x9f, 0xa5, 0xa8, 0xe2, 0x9c,
+    0x89, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8c, 0xbe,
+    0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80,
+    0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0xa4, 0xa6, 0xf0, 0x9f, 0x8f,
+    0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x8c, 0xae, 0xf0, 0x9f, 0x91, 0x88, 0xf0,
+    0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x9d,
+    0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0,
+    0x9f, 0xa7, 0x91, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xb2, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f,
+    0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8e, 0xa8, 0xf0, 0x9f, 0xa4, 0xb7, 0xf0, 0x9f, 0x8f,
+    0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0xa7, 0x8d, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2,
+    0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0xab, 0x97, 0xf0, 0x9f, 0x92, 0x86, 0xe2, 0x80, 0x8d,
+    0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x8f, 0x92, 0xf0, 0x9f, 0x8f, 0x83, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2,
+    0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xb7, 0xf0, 0x9f, 0x8f, 0xbb,
+    0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80,
+    0x8d, 0xf0, 0x9f, 0xa4, 0x9d, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbf,
+    0xf0, 0x9f, 0xa7, 0x9d, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8,
+    0x8f, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2,
+    0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0xab, 0xb3, 0xf0, 0x9f,
+    0x8f, 0xbb, 0xf0, 0x9f, 0x93, 0x9c, 0xe2, 0x9d, 0x84, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x8f, 0x85,
+    0xf0, 0x9f, 0xa7, 0x99, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0xa4, 0xbe, 0xf0, 0x9f,
+    0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x93, 0xa6, 0xf0,
+    0x9f, 0xa4, 0xb0, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x97, 0xa8, 0xf0, 0x9f, 0xa7, 0x8f, 0xf0,
+    0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa4, 0xb6,
+    0xf0, 0x9f, 0x99, 0x8b, 0xf0, 0x9f, 0xaa, 0x85, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbb,
+    0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8d, 0xbc, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2,
+    0x80, 0x8d, 0xf0, 0x9f, 0x8d, 0xb3, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80,
+    0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80,
+    0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0,
+    0x9f, 0x87, 0xb1, 0xf0, 0x9f, 0x87, 0xba, 0xe2, 0x9a, 0x94, 0xf0, 0x9f, 0x87, 0xac, 0xf0, 0x9f,
+    0x87, 0xac, 0xf0, 0x9f, 0xa7, 0x93, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x99, 0x89, 0xf0, 0x9f, 0x91,
+    0xa9, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x91,
+    0xa8, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa4, 0x9d, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2,
+    0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0xa4, 0xaa, 0xf0, 0x9f, 0x87, 0xaf, 0xf0,
+    0x9f, 0x87, 0xaa, 0xe2, 0x99, 0xa8, 0xf0, 0x9f, 0xa7, 0x8d, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80,
+    0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2,
+    0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x91, 0xae, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0x8e, 0x93, 0xf0, 0x9f, 0x8c, 0xa0, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2,
+    0x80, 0x8d, 0xf0, 0x9f, 0xa4, 0x9d, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f,
+    0xbb, 0xf0, 0x9f, 0x8c, 0xb4, 0xf0, 0x9f, 0x99, 0x8d, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d,
+    0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x91, 0xb8, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x91, 0xa9, 0xe2,
+    0x80, 0x8d, 0xe2, 0x9a, 0x96, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x98, 0x89, 0x31, 0xe2, 0x83, 0xa3,
+    0xf0, 0x9f, 0xa5, 0x99, 0xf0, 0x9f, 0xa4, 0xbe, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2,
+    0x99, 0x82, 0xf0, 0x9f, 0xab, 0xb1, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xab,
+    0xb2, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0xa4, 0xb7, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef,
+    0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4,
+    0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91,
+    0xa9, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d,
+    0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f,
+    0x93, 0x84, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4,
+    0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91,
+    0xa8, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0xab, 0xa2, 0xf0, 0x9f, 0x9a, 0xa3, 0xf0, 0x9f, 0x8f,
+    0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2,
+    0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xab,
+    0xb1, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xab, 0xb2, 0xf0, 0x9f, 0x8f, 0xbd,
+    0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80,
+    0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbf,
+    0xf0, 0x9f, 0xaa, 0xb0, 0xf0, 0x9f, 0xa7, 0xb7, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbb,
+    0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xbc, 0xf0, 0x9f, 0x9a, 0xb5, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2,
+    0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbf,
+    0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8,
+    0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0xa6, 0x80, 0xf0, 0x9f, 0x97, 0xa1, 0xef, 0xb8, 0x8f, 0xf0,
+    0x9f, 0xa7, 0x9b, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x87,
+    0xb3, 0xf0, 0x9f, 0x87, 0xb4, 0xe2, 0x9b, 0xb9, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2,
+    0x99, 0x80, 0xf0, 0x9f, 0x9b, 0xb3, 0xef, 0xb8, 0x8f, 0xe2, 0x98, 0x94, 0xe2, 0x9c, 0x8a, 0xf0,
+    0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x96, 0x90, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0xa4, 0xa6, 0xf0,
+    0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x91,
+    0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x9f, 0xa6, 0xf0, 0x9f, 0xa4, 0xa6,
+    0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x96, 0x95, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0xa4, 0x9c,
+    0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x9a, 0xa3, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2,
+    0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x87, 0xa9, 0xf0, 0x9f, 0x87, 0xb4, 0xf0, 0x9f, 0x91,
+    0xa9, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8c, 0xbe, 0xf0, 0x9f, 0x91, 0xb1,
+    0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0xa4, 0x9d, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f,
+    0x9a, 0xad, 0xf0, 0x9f, 0xab, 0xb1, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xab,
+    0xb2, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x91, 0x87, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x99,
+    0x8e, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x8e, 0x93, 0xf0, 0x9f, 0x99, 0x86, 0xf0,
+    0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x99, 0x8b,
+    0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x9a, 0xb4, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80,
+    0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x93, 0x97, 0xe2, 0x98, 0x9d, 0xf0, 0x9f, 0x92, 0x82, 0xf0,
+    0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa4, 0xb7,
+    0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x9a, 0xa0, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x8f, 0x8c, 0xe2, 0x80,
+    0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0xa4, 0xb9, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2,
+    0x99, 0x80, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4,
+    0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91,
+    0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d,
+    0xe2, 0x9a, 0x96, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x9d,
+    0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x8f, 0xa3,
+    0xf0, 0x9f, 0xa4, 0xb7, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f,
+    0x8f, 0x8c, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0,
+    0x9f, 0x94, 0x89, 0xf0, 0x9f, 0xa7, 0x98, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x82, 0xf0, 0x9f, 0x9a, 0xa0, 0xf0, 0x9f, 0x99, 0x8d, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d,
+    0xe2, 0x99, 0x80, 0xf0, 0x9f, 0xa7, 0x91, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8c, 0xbe, 0xf0, 0x9f,
+    0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xbd, 0xf0, 0x9f, 0xa7,
+    0x9a, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x90, 0x90, 0xf0,
+    0x9f, 0xab, 0x84, 0xf0, 0x9f, 0x9b, 0x82, 0xf0, 0x9f, 0x91, 0xac, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0,
+    0x9f, 0x8e, 0xb0, 0xf0, 0x9f, 0x95, 0xb4, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x87, 0xb0, 0xf0,
+    0x9f, 0x87, 0xb3, 0xf0, 0x9f, 0x92, 0x81, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x82, 0xef, 0xb8, 0x8f, 0xe2, 0x9b, 0xb9, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x80, 0xe2, 0x9b, 0xb9, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f,
+    0xa4, 0xb8, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xe2, 0x9c, 0x8b, 0xf0,
+    0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x91, 0x90, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x9a, 0xa3, 0xf0,
+    0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa9,
+    0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x9a, 0x80, 0xf0, 0x9f, 0x91, 0x8e, 0xf0,
+    0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x91, 0xb0, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x87, 0xb0, 0xf0, 0x9f, 0x87, 0xbc, 0xe2, 0x9a, 0x9c, 0xef,
+    0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x99, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0xa7, 0x96,
+    0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0xa7, 0x9b, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2,
+    0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d,
+    0xe2, 0x9a, 0x95, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80,
+    0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x98, 0x82, 0xf0, 0x9f, 0x87, 0xb9, 0xf0, 0x9f, 0x87,
+    0xb4, 0xf0, 0x9f, 0xab, 0xb2, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa7, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0x91, 0xa6, 0xf0, 0x9f, 0x96, 0x8b, 0xe2, 0x98, 0xa3, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x92, 0x87,
+    0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91,
+    0xa8, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x94, 0xac, 0xf0, 0x9f, 0x95, 0xba,
+    0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2,
+    0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbd,
+    0xf0, 0x9f, 0x9b, 0xb7, 0xf0, 0x9f, 0xa4, 0xb5, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2,
+    0x99, 0x80, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92,
+    0xbb, 0xf0, 0x9f, 0xa6, 0xb5, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x8e, 0x83, 0xf0, 0x9f, 0x9a,
+    0xb2, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xb0,
+    0xe2, 0x9b, 0xaa, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0xa4, 0x9d, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0xa6,
+    0xb9, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x97, 0xbf, 0xf0,
+    0x9f, 0x88, 0xba, 0xf0, 0x9f, 0xa6, 0x90, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0x9a, 0x92, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4,
+    0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f,
+    0x8f, 0xbe, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa4,
+    0x9d, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0xa4, 0xb7,
+    0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0xa7, 0x9b, 0xf0, 0x9f,
+    0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x87, 0xbf, 0xf0, 0x9f, 0x87, 0xb2,
+    0xf0, 0x9f, 0x8f, 0x8a, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x8d, 0xa2, 0xf0, 0x9f,
+    0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa4, 0x9d, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0xa4, 0x9e, 0xf0, 0x9f, 0x8f, 0xbd,
+    0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8,
+    0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0xa4, 0x99,
+    0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x94, 0xaa, 0xf0, 0x9f, 0xa6, 0xb9, 0xe2, 0x80, 0x8d, 0xe2,
+    0x99, 0x80, 0xf0, 0x9f, 0xa4, 0xb1, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80,
+    0x8d, 0xf0, 0x9f, 0x8e, 0x84, 0xf0, 0x9f, 0x99, 0x8d, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x91,
+    0xa9, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8d, 0xbc, 0xf0, 0x9f, 0x91, 0xa9,
+    0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91,
+    0xa8, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x90, 0xa7, 0xf0, 0x9f, 0xa4, 0xb9, 0xf0, 0x9f, 0x8f,
+    0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x87, 0xb2, 0xf0, 0x9f, 0x87, 0xb9, 0xf0,
+    0x9f, 0xab, 0xb1, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x95, 0xb8, 0xf0, 0x9f, 0x91, 0x87, 0xf0,
+    0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0xab, 0xb6, 0xf0, 0x9f, 0xa4, 0x8c, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0,
+    0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x9a, 0x95, 0x35, 0xe2, 0x83,
+    0xa3, 0xf0, 0x9f, 0x95, 0xb5, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xe2,
+    0x93, 0x82, 0xf0, 0x9f, 0xa7, 0x9a, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0,
+    0x9f, 0x8d, 0xa9, 0xf0, 0x9f, 0xa7, 0x92, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0xa5, 0xb7, 0xf0,
+    0x9f, 0xab, 0x85, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x91, 0xa8, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa6, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f,
+    0xbe, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x94, 0xac, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbc,
+    0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8c, 0xbe, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2,
+    0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0,
+    0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x8e, 0x85, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0xa7, 0x8d, 0xf0,
+    0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x92, 0x81, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x99, 0x8d, 0xf0,
+    0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa6, 0xb9,
+    0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x90, 0x89, 0xf0, 0x9f,
+    0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x9a, 0x96, 0xf0, 0x9f, 0x95, 0xb8,
+    0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa4, 0x9c, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x94, 0xa2, 0xf0,
+    0x9f, 0x87, 0xba, 0xf0, 0x9f, 0x87, 0xbe, 0xf0, 0x9f, 0xa6, 0x8e, 0xe2, 0xa4, 0xb5, 0xf0, 0x9f,
+    0x8e, 0x9a, 0xf0, 0x9f, 0x92, 0x87, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80,
+    0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa4, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0xa4,
+    0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x94, 0xa0, 0xf0, 0x9f, 0x90, 0xb9, 0xf0,
+    0x9f, 0x90, 0x8d, 0xf0, 0x9f, 0x90, 0xa5, 0xf0, 0x9f, 0x91, 0x83, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0,
+    0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8e, 0xa8, 0xf0, 0x9f,
+    0x8c, 0xb6, 0xf0, 0x9f, 0xa7, 0xaf, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80,
+    0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x8f, 0x95, 0xf0, 0x9f, 0xa4, 0x9c, 0xf0, 0x9f,
+    0x8f, 0xbc, 0xf0, 0x9f, 0x9a, 0x82, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80,
+    0x8d, 0xf0, 0x9f, 0x94, 0xac, 0xf0, 0x9f, 0x92, 0x81, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d,
+    0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x92, 0x81, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f,
+    0x91, 0xa8, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0xbb, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f,
+    0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80,
+    0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x9b, 0x8c, 0xf0, 0x9f, 0x8f,
+    0xbb, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x99, 0x87, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2,
+    0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x9b, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d,
+    0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x91, 0xab, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x99, 0x85, 0xf0,
+    0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0xa7, 0x97, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0x89, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x87, 0xa8,
+    0xf0, 0x9f, 0x87, 0xa8, 0xf0, 0x9f, 0x95, 0xb5, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2,
+    0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x94, 0xbc, 0xf0, 0x9f, 0x98, 0xb0, 0xf0, 0x9f, 0xa7,
+    0x94, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x96, 0x95, 0xf0,
+    0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0xa4, 0x9d, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0xa6,
+    0xb8, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f,
+    0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xb1, 0xf0, 0x9f, 0x8e,
+    0xb5, 0xf0, 0x9f, 0xab, 0xb4, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x98, 0x82, 0xf0, 0x9f, 0xa4,
+    0xbe, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x87, 0xa8, 0xf0,
+    0x9f, 0x87, 0xad, 0xf0, 0x9f, 0x8f, 0x8b, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x91, 0xa8, 0xf0,
+    0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2,
+    0x80, 0x8d, 0xf0, 0x9f, 0x8e, 0xa8, 0xf0, 0x9f, 0xa7, 0xad, 0x34, 0xe2, 0x83, 0xa3, 0xf0, 0x9f,
+    0xa7, 0x9a, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xe2, 0xac, 0x87, 0xef,
+    0xb8, 0x8f, 0xf0, 0x9f, 0xa4, 0xbd, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82,
+    0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0xa6, 0xaf, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa4,
+    0x9d, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0xab, 0x85,
+    0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0xa4, 0xa6, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2,
+    0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x87, 0xad, 0xf0, 0x9f, 0x87, 0xba, 0xf0, 0x9f, 0x91,
+    0xa8, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa6, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa6, 0xf0,
+    0x9f, 0x99, 0x87, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f,
+    0xf0, 0x9f, 0x92, 0x86, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8,
+    0x8f, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8d, 0xb3,
+    0xf0, 0x9f, 0x8f, 0x8a, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x94, 0x94, 0xf0, 0x9f,
+    0xa4, 0x90, 0xf0, 0x9f, 0x91, 0x88, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x97, 0xbc, 0xf0, 0x9f,
+    0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x94, 0xac, 0xf0, 0x9f, 0x92,
+    0x81, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x99, 0x8d, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d,
+    0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x9c,
+    0x88, 0xf0, 0x9f, 0x93, 0x8a, 0xf0, 0x9f, 0x87, 0xb0, 0xf0, 0x9f, 0x87, 0xb7, 0xf0, 0x9f, 0x8f,
+    0x9e, 0xf0, 0x9f, 0x8f, 0x80, 0xf0, 0x9f, 0xa7, 0x9b, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d,
+    0xe2, 0x99, 0x80, 0xe2, 0x9b, 0xb0, 0xf0, 0x9f, 0x8e, 0x81, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f,
+    0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x8e,
+    0xa2, 0xf0, 0x9f, 0xab, 0xb2, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f,
+    0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92,
+    0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x8c, 0x9e,
+    0xf0, 0x9f, 0xa4, 0xa5, 0xf0, 0x9f, 0xab, 0x84, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0xa7, 0x9d,
+    0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0xa4, 0xb7, 0xf0, 0x9f,
+    0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x91, 0xb1, 0xf0, 0x9f, 0x8f, 0xbe,
+    0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xe2, 0x8f, 0xb3, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f,
+    0xbc, 0xe2, 0x9b, 0xb8, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2,
+    0x80, 0x8d, 0xf0, 0x9f, 0x8f, 0xad, 0xf0, 0x9f, 0xa4, 0xa6, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80,
+    0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0x9a, 0x92, 0xf0, 0x9f, 0x9a, 0xb5, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x93, 0x87, 0xf0, 0x9f, 0x98, 0x92, 0xf0, 0x9f, 0x87, 0xa6,
+    0xf0, 0x9f, 0x87, 0xb8, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2,
+    0x9a, 0x95, 0xf0, 0x9f, 0x9b, 0xb4, 0xf0, 0x9f, 0x99, 0x8d, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80,
+    0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x92, 0x86, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0xab, 0xb6,
+    0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x8f, 0x8b, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2,
+    0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d,
+    0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x85, 0xb0, 0xf0, 0x9f, 0xa7, 0xb9,
+    0xf0, 0x9f, 0x95, 0xb7, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x90, 0xa3, 0xf0, 0x9f, 0x91, 0xa8, 0xf0,
+    0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f,
+    0x91, 0xb7, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0,
+    0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0,
+    0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xb2, 0xf0, 0x9f,
+    0x90, 0xb2, 0xf0, 0x9f, 0x8f, 0xa8, 0xf0, 0x9f, 0xa4, 0xb5, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80,
+    0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x95, 0x8b, 0xf0, 0x9f, 0x87, 0xa6, 0xf0,
+    0x9f, 0x87, 0xb6, 0xf0, 0x9f, 0x99, 0x86, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xe2, 0x98, 0xae,
+    0xf0, 0x9f, 0x92, 0x82, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f,
+    0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa4, 0x9d, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0xa4, 0xb7, 0xf0, 0x9f, 0x8f, 0xbc,
+    0xf0, 0x9f, 0x91, 0xb8, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0xaa, 0xa1, 0xf0, 0x9f, 0xa7, 0x91,
+    0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8e, 0x93, 0xf0, 0x9f, 0x99, 0x8c, 0xf0,
+    0x9f, 0x87, 0xa6, 0xf0, 0x9f, 0x87, 0xba, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2,
+    0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2,
+    0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0xa7, 0x91, 0xe2, 0x80,
+    0x8d, 0xf0, 0x9f, 0x94, 0xa7, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d,
+    0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f,
+    0x93, 0x9d, 0xf0, 0x9f, 0x96, 0x87, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x99, 0x8b, 0xf0, 0x9f, 0x8f,
+    0xbc, 0xf0, 0x9f, 0x9b, 0xbc, 0xf0, 0x9f, 0x87, 0xb8, 0xf0, 0x9f, 0x87, 0xb1, 0xf0, 0x9f, 0x96,
+    0x8d, 0xf0, 0x9f, 0x91, 0xb7, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef,
+    0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x97, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0xa7, 0x9f, 0xe2, 0x80,
+    0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x8d, 0x94, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe,
+    0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x9a, 0xa3, 0xf0, 0x9f, 0x8f, 0xbb,
+    0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80,
+    0x8d, 0xf0, 0x9f, 0x8f, 0xad, 0xf0, 0x9f, 0x8e, 0x82, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f,
+    0xbe, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xb3, 0xf0, 0x9f, 0x8d, 0x8d, 0xf0, 0x9f, 0x91, 0xb3,
+    0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91,
+    0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80,
+    0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0xa4, 0xbd, 0xf0, 0x9f, 0x8f,
+    0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x95, 0xa2, 0xf0, 0x9f,
+    0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2,
+    0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f,
+    0xbe, 0xf0, 0x9f, 0x99, 0x86, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0,
+    0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xaf, 0xf0, 0x9f,
+    0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2,
+    0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0xa6, 0xb9, 0xf0, 0x9f,
+    0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa8, 0xf0,
+    0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xaf, 0xf0, 0x9f, 0x92, 0xb9, 0xf0, 0x9f,
+    0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2,
+    0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f,
+    0xbd, 0xe2, 0x9c, 0x9d, 0xf0, 0x9f, 0x87, 0xbc, 0xf0, 0x9f, 0x87, 0xb8, 0xf0, 0x9f, 0xa4, 0xb7,
+    0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xe2, 0x8f, 0xad, 0xef, 0xb8, 0x8f,
+    0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8,
+    0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0,
+    0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xaf, 0xf0, 0x9f,
+    0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x87, 0xbb, 0xf0, 0x9f, 0x87, 0xba, 0xf0,
+    0x9f, 0x8f, 0x83, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xe2, 0x97, 0xbb,
+    0xf0, 0x9f, 0x91, 0xaf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x8c,
+    0xaf, 0xf0, 0x9f, 0x8d, 0x85, 0xe2, 0x8c, 0x9b, 0xf0, 0x9f, 0xa6, 0xb8, 0xe2, 0x80, 0x8d, 0xe2,
+    0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x87, 0xad, 0xf0, 0x9f, 0x87, 0xb7, 0xf0, 0x9f, 0x91,
+    0xa9, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x88, 0xb3, 0xe3, 0x80, 0xbd, 0xf0, 0x9f, 0xa7,
+    0x94, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x8f, 0x8b, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2,
+    0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d,
+    0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91,
+    0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0xa7,
+    0x8e, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xe2, 0x9b,
+    0x91, 0xe2, 0x86, 0x97, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x9a, 0xb5, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x82, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef,
+    0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x91,
+    0xb3, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d,
+    0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f,
+    0xbe, 0xf0, 0x9f, 0x9a, 0xb4, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0xa4, 0xbe, 0xf0, 0x9f, 0x8f,
+    0xbe, 0xf0, 0x9f, 0x9b, 0x9f, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d,
+    0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f,
+    0xbc, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x9c, 0x88, 0xef,
+    0xb8, 0x8f, 0xe2, 0x9b, 0x8f, 0xf0, 0x9f, 0x98, 0xb9, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f,
+    0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f,
+    0x8f, 0xbc, 0xf0, 0x9f, 0xa4, 0xa6, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80,
+    0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x9d,
+    0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbd, 0xe3,
+    0x80, 0xb0, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x98, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x96,
+    0xbc, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2,
+    0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8,
+    0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x98, 0x86, 0xf0, 0x9f, 0xab, 0x83, 0xf0, 0x9f, 0x8f, 0xbc,
+    0xf0, 0x9f, 0x9a, 0xb5, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xe2, 0x99,
+    0xa5, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x8e, 0x92, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbb,
+    0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa4, 0x9d, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f,
+    0x8f, 0xbf, 0xf0, 0x9f, 0x9a, 0xa3, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80,
+    0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x9a, 0x81, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2,
+    0x80, 0x8d, 0xf0, 0x9f, 0x8e, 0xa4, 0xf0, 0x9f, 0x88, 0xb9, 0xf0, 0x9f, 0xa4, 0xbe, 0xe2, 0x80,
+    0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xe2, 0x9a, 0x92, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x99,
+    0x8b, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0xa4, 0xb7, 0xf0,
+    0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0xa4, 0xbe, 0xf0, 0x9f, 0x92, 0x86, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2,
+    0x98, 0xaf, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x8c, 0x86, 0xf0, 0x9f, 0x90, 0xaa, 0xf0, 0x9f, 0xa4,
+    0xb9, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f,
+    0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xb1, 0xf0, 0x9f, 0x87,
+    0xa9, 0xf0, 0x9f, 0x87, 0xb2, 0xf0, 0x9f, 0x87, 0xb3, 0xf0, 0x9f, 0x87, 0xab, 0xf0, 0x9f, 0xa7,
+    0x8d, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x9b, 0x9e, 0xf0, 0x9f, 0x8d, 0x98, 0xf0, 0x9f, 0x87,
+    0xba, 0xf0, 0x9f, 0x87, 0xbf, 0xe3, 0x8a, 0x99, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xb0, 0xf0,
+    0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0xa7, 0x8d, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0xa6, 0xb3, 0xf0,
+    0x9f, 0x99, 0x85, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0xa7,
+    0x91, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa4, 0x9d, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x98, 0x80, 0xf0, 0x9f, 0xa7, 0x91, 0xe2,
+    0x80, 0x8d, 0xf0, 0x9f, 0x8e, 0x84, 0xe2, 0x9d, 0x95, 0xf0, 0x9f, 0x9a, 0xaa, 0xf0, 0x9f, 0x87,
+    0xaa, 0xf0, 0x9f, 0x87, 0xaa, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0xa4, 0x9d, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0,
+    0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f,
+    0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f,
+    0x8f, 0xbf, 0xf0, 0x9f, 0x8f, 0xa6, 0xf0, 0x9f, 0x87, 0xac, 0xf0, 0x9f, 0x87, 0xab, 0xf0, 0x9f,
+    0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2,
+    0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x81, 0x89, 0xef, 0xb8, 0x8f,
+    0xf0, 0x9f, 0xa7, 0x8d, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f,
+    0xa7, 0x99, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0,
+    0x9f, 0x92, 0x82, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f,
+    0xe2, 0x9d, 0x8c, 0xf0, 0x9f, 0x99, 0x85, 0xf0, 0x9f, 0x91, 0x96, 0xf0, 0x9f, 0x91, 0xb3, 0xe2,
+    0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x98, 0xa4, 0xf0, 0x9f, 0x87, 0xba,
+    0xf0, 0x9f, 0x87, 0xac, 0xf0, 0x9f, 0x92, 0xbe, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe,
+    0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x91, 0xb0, 0xf0, 0x9f, 0x8f, 0xbc,
+    0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0xaa, 0x81, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f,
+    0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x9a, 0x86, 0xf0, 0x9f, 0xa4, 0xb7, 0xf0, 0x9f,
+    0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x87, 0xa8, 0xf0,
+    0x9f, 0x87, 0xba, 0xf0, 0x9f, 0x94, 0xa1, 0x34, 0xef, 0xb8, 0x8f, 0xe2, 0x83, 0xa3, 0xf0, 0x9f,
+    0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80,
+    0x8d, 0xf0, 0x9f, 0x92, 0xbc, 0xf0, 0x9f, 0x99, 0x8d, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d,
+    0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80,
+    0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80,
+    0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0xa6, 0xad, 0xf0, 0x9f, 0x91,
+    0xa9, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x99, 0x80, 0xf0, 0x9f, 0x99, 0x8d, 0xf0, 0x9f,
+    0x8f, 0xbb, 0xf0, 0x9f, 0x8f, 0x84, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80,
+    0xf0, 0x9f, 0x99, 0x8e, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f,
+    0xa6, 0xb9, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0,
+    0x9f, 0x93, 0x81, 0xe2, 0x99, 0x8e, 0xf0, 0x9f, 0x99, 0x8e, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80,
+    0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x96, 0xa4, 0xf0, 0x9f, 0x99, 0x8b, 0xf0,
+    0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xae,
+    0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f,
+    0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xb3, 0xf0, 0x9f, 0xa5, 0x9a, 0xe2, 0x9b, 0xb9,
+    0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x87, 0xab, 0xf0, 0x9f, 0x87, 0xb7, 0xf0, 0x9f, 0x8f, 0x9a,
+    0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x9d,
+    0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0xa7, 0x9d,
+    0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x99, 0x87, 0xf0, 0x9f,
+    0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x94, 0x86, 0xf0,
+    0x9f, 0x9a, 0xac, 0xf0, 0x9f, 0x91, 0xad, 0xf0, 0x9f, 0x99, 0x8b, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0,
+    0x9f, 0x8e, 0xa3, 0xf0, 0x9f, 0x87, 0xb9, 0xf0, 0x9f, 0x87, 0xbf, 0xf0, 0x9f, 0xa4, 0xbd, 0xf0,
+    0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0xa1,
+    0xf0, 0x9f, 0x99, 0x8e, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x91, 0x86, 0xf0, 0x9f, 0x8f, 0xbd,
+    0xf0, 0x9f, 0xa4, 0x9a, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0xa4, 0xb5, 0xef, 0xb8, 0x8f, 0xf0, 0x9f,
+    0x8f, 0x8a, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0,
+    0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8d, 0xb3, 0xf0, 0x9f,
+    0x99, 0x8e, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0,
+    0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x94, 0xac, 0xf0, 0x9f,
+    0x98, 0xbe, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x9a, 0x96,
+    0xf0, 0x9f, 0x99, 0x8d, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8,
+    0x8f, 0xf0, 0x9f, 0x8d, 0x8c, 0xf0, 0x9f, 0x94, 0xac, 0xf0, 0x9f, 0x8d, 0x8b, 0xf0, 0x9f, 0xa6,
+    0xbb, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0xa7, 0x99, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d,
+    0xe2, 0x99, 0x82, 0xf0, 0x9f, 0xa7, 0x94, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x8f, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x91, 0xae,
+    0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x91, 0xb8, 0xf0, 0x9f,
+    0x8f, 0xbd, 0xf0, 0x9f, 0x92, 0x87, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82,
+    0xf0, 0x9f, 0x99, 0x8b, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f,
+    0x99, 0x85, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x93, 0x8f, 0xf0,
+    0x9f, 0xa4, 0xb9, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f,
+    0xf0, 0x9f, 0x97, 0xa1, 0xf0, 0x9f, 0x96, 0x96, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0xa5, 0x96,
+    0xf0, 0x9f, 0x87, 0xb0, 0xf0, 0x9f, 0x87, 0xaa, 0xf0, 0x9f, 0x92, 0x82, 0xf0, 0x9f, 0x8f, 0xbe,
+    0xf0, 0x9f, 0x91, 0xbc, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x88, 0x82, 0xef, 0xb8, 0x8f, 0xf0,
+    0x9f, 0x99, 0x8e, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0xa4,
+    0xa6, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x91, 0xa9, 0xf0,
+    0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8,
+    0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0xa4, 0xa1, 0xf0, 0x9f, 0x91, 0xb0, 0xf0, 0x9f, 0x8f, 0xbc,
+    0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x99, 0x8d, 0xf0, 0x9f, 0x8f,
+    0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x91, 0xae, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2,
+    0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x8d, 0x80, 0xf0, 0x9f, 0xa7, 0x8f,
+    0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x92,
+    0x94, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2,
+    0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0xa4, 0xbe, 0xf0, 0x9f,
+    0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x95, 0xa6, 0xf0,
+    0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xbd, 0xf0, 0x9f,
+    0xa7, 0x9a, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xe2, 0x9b, 0xb9, 0xf0,
+    0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xe2, 0x9b, 0x88, 0xef,
+    0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8e,
+    0x93, 0xf0, 0x9f, 0x9a, 0xa3, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0xa7, 0x98, 0xf0,
+    0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x91, 0xb1, 0xf0, 0x9f, 0x8f,
+    0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x87, 0xb2, 0xf0, 0x9f,
+    0x87, 0xbb, 0xe2, 0x9b, 0xb9, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x9a, 0xa3, 0xf0, 0x9f, 0x8f, 0xbe,
+    0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80,
+    0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0,
+    0x9f, 0x8f, 0x8b, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x98,
+    0x94, 0xe2, 0x8f, 0xaf, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2,
+    0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xaf, 0xf0, 0x9f, 0x87, 0xa7, 0xf0, 0x9f, 0x87, 0xa7, 0xf0, 0x9f,
+    0x87, 0xac, 0xf0, 0x9f, 0x87, 0xb5, 0xf0, 0x9f, 0xa6, 0x9d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f,
+    0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0xab,
+    0xb3, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x8f, 0x8b, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x87,
+    0xb2, 0xf0, 0x9f, 0x87, 0xb6, 0xf0, 0x9f, 0xa9, 0xb0, 0xf0, 0x9f, 0x87, 0xb2, 0xf0, 0x9f, 0x87,
+    0xbd, 0xf0, 0x9f, 0x87, 0xb3, 0xf0, 0x9f, 0x87, 0xa6, 0xf0, 0x9f, 0x91, 0xae, 0xf0, 0x9f, 0x8f,
+    0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x98, 0xa5, 0xf0, 0x9f,
+    0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f,
+    0x99, 0x87, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x8d, 0x8e, 0xf0, 0x9f, 0x87, 0xac,
+    0xf0, 0x9f, 0x87, 0xb7, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0xa4, 0x9d, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f,
+    0x9f, 0xa0, 0xf0, 0x9f, 0x87, 0xb1, 0xf0, 0x9f, 0x87, 0xae, 0xf0, 0x9f, 0x91, 0x9f, 0xf0, 0x9f,
+    0xa6, 0xb8, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x8f, 0x84,
+    0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xab,
+    0xb0, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x87, 0xb5, 0xf0, 0x9f, 0x87, 0xb1, 0xf0, 0x9f, 0x91,
+    0xa8, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8e, 0xa4, 0xf0, 0x9f, 0xa7, 0x91,
+    0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0,
+    0x9f, 0x87, 0xa6, 0xf0, 0x9f, 0x87, 0xae, 0xe2, 0x98, 0x83, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91,
+    0xb3, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xe2, 0x9b, 0x93, 0xef, 0xb8,
+    0x8f, 0xf0, 0x9f, 0xa7, 0xbb, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d,
+    0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f,
+    0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8e, 0xa8, 0xf0, 0x9f, 0xa7,
+    0x91, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa4, 0x9d, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x91, 0x87, 0xf0, 0x9f, 0x8f, 0x83, 0xf0,
+    0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x9a, 0xb4,
+    0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x95,
+    0x9a, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x9a, 0x80,
+    0xf0, 0x9f, 0x9a, 0xb4, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbe,
+    0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x9a, 0x80, 0xf0, 0x9f, 0x87, 0xbc, 0xf0, 0x9f, 0x87, 0xab, 0xf0,
+    0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x9a, 0x95, 0xef, 0xb8, 0x8f,
+    0xf0, 0x9f, 0xa4, 0xbe, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8,
+    0x8f, 0xf0, 0x9f, 0x91, 0x81, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x97, 0xa8, 0xf0, 0x9f, 0xa7, 0x91,
+    0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8f, 0xab, 0xf0, 0x9f, 0xa7, 0x96, 0xf0,
+    0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0xa4, 0xb9, 0xf0, 0x9f, 0x8f,
+    0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa4, 0xb8, 0xe2, 0x80,
+    0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa4, 0x9c, 0xf0, 0x9f, 0xa7, 0x97, 0xf0,
+    0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0xa4, 0xbd, 0xf0, 0x9f, 0x8f,
+    0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x91, 0x8e, 0xf0, 0x9f, 0x93, 0xb6, 0xf0,
+    0x9f, 0x92, 0x80, 0xf0, 0x9f, 0x96, 0x8d, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80,
+    0x8d, 0xf0, 0x9f, 0x8f, 0xad, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0x8d, 0xbc, 0xe2, 0x9b, 0xb9, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa4, 0xbd, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2,
+    0x99, 0x82, 0xf0, 0x9f, 0x91, 0xb4, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x91, 0xb3, 0xf0, 0x9f,
+    0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0xa7, 0x97, 0xe2, 0x80, 0x8d, 0xe2,
+    0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa4, 0xbd, 0xf0, 0x9f, 0x8f, 0xb4, 0xe2, 0x9c, 0x8f,
+    0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80,
+    0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x93, 0x93, 0xf0, 0x9f, 0x91,
+    0x8e, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d,
+    0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0xa7, 0x9c, 0xf0, 0x9f, 0x8f, 0xbd,
+    0xf0, 0x9f, 0x91, 0xb7, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8,
+    0x8f, 0xf0, 0x9f, 0xa6, 0xb7, 0xf0, 0x9f, 0xa4, 0xa6, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x92,
+    0xb3, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8e, 0x93, 0xf0, 0x9f, 0x9a, 0xbf,
+    0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbd,
+    0xe2, 0x80, 0x8d, 0xe2, 0x9c, 0x88, 0xf0, 0x9f, 0x8f, 0x8f, 0xf0, 0x9f, 0x92, 0x81, 0xf0, 0x9f,
+    0x9a, 0xb4, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0,
+    0x9f, 0x8f, 0x8b, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f,
+    0xf0, 0x9f, 0x8f, 0x97, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x8c, 0x9c, 0xe2, 0x8c, 0x9a, 0xf0, 0x9f,
+    0x88, 0xaf, 0xf0, 0x9f, 0x93, 0xb3, 0xf0, 0x9f, 0x8f, 0xb3, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8c,
+    0x88, 0xf0, 0x9f, 0x90, 0xb3, 0xf0, 0x9f, 0x94, 0xa7, 0xf0, 0x9f, 0x8c, 0x8e, 0xf0, 0x9f, 0x99,
+    0x87, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f,
+    0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0,
+    0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0xa7, 0x8d, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x94, 0xa4, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb,
+    0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f,
+    0xbd, 0xf0, 0x9f, 0xa4, 0xbe, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0xa7, 0x98, 0xf0, 0x9f, 0x8f,
+    0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f,
+    0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xb0, 0xf0, 0x9f, 0xa4, 0xa8, 0xf0, 0x9f, 0x91,
+    0xa7, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0xa4, 0xbe, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d,
+    0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x9f, 0xa1, 0xe2, 0x9d, 0x8e, 0xe2, 0x98, 0xaf,
+    0xf0, 0x9f, 0x91, 0xb3, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f,
+    0x8f, 0x84, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x90, 0x95,
+    0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xaf, 0xf0,
+    0x9f, 0x9b, 0x90, 0xf0, 0x9f, 0xa7, 0x99, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x8e, 0x86, 0xf0, 0x9f, 0xa9, 0xbb, 0xf0, 0x9f, 0x87, 0xaa,
+    0xf0, 0x9f, 0x87, 0xba, 0xf0, 0x9f, 0xaa, 0x99, 0xf0, 0x9f, 0x99, 0x8e, 0xe2, 0x80, 0x8d, 0xe2,
+    0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x97, 0x9e, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x95, 0xb0,
+    0xf0, 0x9f, 0x99, 0x85, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8,
+    0x8f, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8c, 0xbe,
+    0xe2, 0x99, 0x8d, 0xe2, 0x9a, 0x9c, 0xf0, 0x9f, 0x99, 0x8e, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80,
+    0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x9a, 0x9a, 0xf0, 0x9f, 0x8c, 0x85, 0xf0, 0x9f, 0xa7, 0x9c,
+    0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x8f, 0x8b, 0xef, 0xb8,
+    0x8f, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2,
+    0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f,
+    0xbf, 0xf0, 0x9f, 0x99, 0x8d, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0,
+    0x9f, 0x91, 0xaa, 0xf0, 0x9f, 0xa7, 0x9a, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0xa4, 0xa6, 0xf0,
+    0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x92, 0x8c, 0xf0, 0x9f, 0xa4,
+    0xbe, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x91, 0xa9, 0xf0,
+    0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa4, 0x9d, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91,
+    0xa9, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0xa6, 0x89, 0xf0, 0x9f, 0x91, 0x82, 0xf0, 0x9f, 0x8f,
+    0xbd, 0xf0, 0x9f, 0x9a, 0x88, 0xf0, 0x9f, 0xa7, 0x8e, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x98,
+    0x87, 0xf0, 0x9f, 0x99, 0x85, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0,
+    0x9f, 0xa7, 0x93, 0xf0, 0x9f, 0x8f, 0xbe, 0x2a, 0xef, 0xb8, 0x8f, 0xe2, 0x83, 0xa3, 0xf0, 0x9f,
+    0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa4, 0x9d, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbe,
+    0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b,
+    0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x8f, 0x98, 0xf0,
+    0x9f, 0x95, 0xb5, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x91,
+    0xa9, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80,
+    0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbf,
+    0xf0, 0x9f, 0xa7, 0x96, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x99, 0x8d, 0xf0, 0x9f, 0x8f, 0xbe,
+    0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80,
+    0x8d, 0xf0, 0x9f, 0x8f, 0xad, 0xf0, 0x9f, 0x87, 0xa9, 0xf0, 0x9f, 0x87, 0xaf, 0xf0, 0x9f, 0xab,
+    0x84, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x92, 0x81, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d,
+    0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x91, 0xb1, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa5, 0x8d, 0xf0, 0x9f, 0x92, 0xa3, 0xf0, 0x9f, 0x91, 0xa9,
+    0xf0, 0x9f, 0xab, 0x94, 0xf0, 0x9f, 0x9a, 0xa3, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8,
+    0x8f, 0xf0, 0x9f, 0x9b, 0xa1, 0xf0, 0x9f, 0x91, 0xb0, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d,
+    0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x96, 0xa5, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x8c, 0x8b, 0xe2, 0x9b,
+    0x88, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x9a, 0x95, 0xef,
+    0xb8, 0x8f, 0xf0, 0x9f, 0x92, 0x89, 0xf0, 0x9f, 0x87, 0xa6, 0xf0, 0x9f, 0x87, 0xbf, 0xe2, 0x84,
+    0xa2, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2,
+    0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0xa4, 0xb0, 0xf0, 0x9f,
+    0x8f, 0xbb, 0xf0, 0x9f, 0xa4, 0xb8, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82,
+    0xf0, 0x9f, 0x91, 0x8b, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0xab, 0x93, 0xf0, 0x9f, 0x91, 0xa8,
+    0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xb1, 0xf0, 0x9f, 0x91, 0xb7, 0xe2,
+    0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0xa7, 0x9d, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x91,
+    0xa2, 0xe2, 0x86, 0x96, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x8c, 0xa8, 0xef, 0xb8, 0x8f, 0xf0, 0x9f,
+    0xa7, 0x96, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x95, 0xaf,
+    0xf0, 0x9f, 0x9f, 0xa8, 0xe2, 0x9e, 0xb0, 0xf0, 0x9f, 0x87, 0xb3, 0xf0, 0x9f, 0x87, 0xb5, 0xf0,
+    0x9f, 0x99, 0x85, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x9a,
+    0x96, 0xf0, 0x9f, 0xa9, 0xb3, 0xf0, 0x9f, 0xa4, 0xb0, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x8c,
+    0x90, 0xf0, 0x9f, 0x8f, 0x8c, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef,
+    0xb8, 0x8f, 0xe2, 0x98, 0x8e, 0xf0, 0x9f, 0x87, 0xa6, 0xf0, 0x9f, 0x87, 0xb4, 0xf0, 0x9f, 0x91,
+    0xa8, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x9a, 0x95, 0xef, 0xb8, 0x8f, 0xf0, 0x9f,
+    0xab, 0xa0, 0xf0, 0x9f, 0x95, 0xb5, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82,
+    0xf0, 0x9f, 0xa7, 0xa5, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0x94, 0xa7, 0xf0, 0x9f, 0x87, 0xa6, 0xf0, 0x9f, 0x87, 0xac, 0xf0, 0x9f, 0x91, 0xa9, 0xf0,
+    0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x9a, 0x92, 0xf0, 0x9f, 0xa4, 0xb9, 0xf0, 0x9f,
+    0x8f, 0xbd, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6,
+    0xbc, 0xf0, 0x9f, 0x87, 0xac, 0xf0, 0x9f, 0x87, 0xa9, 0xf0, 0x9f, 0x9a, 0xa3, 0xf0, 0x9f, 0x8f,
+    0xbe, 0xf0, 0x9f, 0xab, 0xb0, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f,
+    0xbb, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xb3, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbf,
+    0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f,
+    0xbf, 0xf0, 0x9f, 0x8e, 0x9e, 0xf0, 0x9f, 0x8f, 0x83, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d,
+    0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x96, 0x90, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x91, 0xa9, 0xf0,
+    0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0xa6, 0xb8, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2,
+    0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x99, 0x8b, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0,
+    0x9f, 0xa7, 0x8d, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f,
+    0xf0, 0x9f, 0xa7, 0x8d, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8,
+    0x8f, 0xf0, 0x9f, 0xa7, 0x9e, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x95, 0xb5, 0xf0,
+    0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xaa, 0x9a,
+    0xf0, 0x9f, 0x8f, 0x83, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f,
+    0x8c, 0xb6, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x8e, 0xad, 0xe2, 0x99, 0xa6, 0xef, 0xb8, 0x8f, 0xf0,
+    0x9f, 0x87, 0xa8, 0xf0, 0x9f, 0x87, 0xa9, 0xf0, 0x9f, 0x87, 0xb5, 0xf0, 0x9f, 0x87, 0xbe, 0xf0,
+    0x9f, 0xab, 0x91, 0xf0, 0x9f, 0xab, 0xb1, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0xab, 0xb2, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x87, 0xb8, 0xf0, 0x9f, 0x87, 0xb9, 0xf0, 0x9f,
+    0xa7, 0x9a, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0,
+    0x9f, 0x87, 0xae, 0xf0, 0x9f, 0x87, 0xb1, 0xe2, 0x98, 0xa2, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x8d,
+    0xa6, 0xf0, 0x9f, 0xa7, 0xa8, 0xf0, 0x9f, 0x8f, 0x8b, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0,
+    0x9f, 0x91, 0xb3, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f,
+    0xbf, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0xbc, 0xf0, 0x9f, 0xa4, 0xb2, 0xf0, 0x9f, 0x8f, 0xbe,
+    0xe2, 0x98, 0x98, 0xf0, 0x9f, 0x96, 0x95, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x91, 0xa9, 0xf0,
+    0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa4, 0x9d, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91,
+    0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x80, 0x84, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f,
+    0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x9a, 0x96, 0xf0, 0x9f, 0xa4, 0xb5, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2,
+    0x9b, 0xb9, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0xa7, 0x8e,
+    0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x91, 0xb1, 0xf0, 0x9f,
+    0x8f, 0xbf, 0xf0, 0x9f, 0x87, 0xb4, 0xf0, 0x9f, 0x87, 0xb2, 0xf0, 0x9f, 0x94, 0x87, 0xf0, 0x9f,
+    0xa4, 0xb8, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x87, 0xb7, 0xf0, 0x9f, 0x87, 0xbc,
+    0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80,
+    0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x91, 0xb3, 0xf0, 0x9f, 0x8f,
+    0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0xa5, 0x87, 0xf0, 0x9f, 0x95, 0xb3, 0xf0,
+    0x9f, 0xa4, 0xb9, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0xaa,
+    0x94, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef,
+    0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x91,
+    0xb7, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0xa7, 0x91, 0xf0,
+    0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8e, 0x84, 0xf0, 0x9f, 0x8e, 0x9e, 0xef, 0xb8,
+    0x8f, 0xe2, 0x86, 0x96, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0x8e, 0xa4, 0xf0, 0x9f, 0x91, 0xb6, 0xf0, 0x9f, 0x92, 0x87, 0xf0, 0x9f, 0x87, 0xae, 0xf0,
+    0x9f, 0x87, 0xb3, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x9d,
+    0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0,
+    0x9f, 0xa4, 0xbd, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0xab,
+    0xb1, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xab, 0xb2, 0xf0, 0x9f, 0x8f, 0xbc,
+    0xf0, 0x9f, 0xa7, 0x97, 0xf0, 0x9f, 0xa6, 0xb9, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2,
+    0x99, 0x82, 0xf0, 0x9f, 0x99, 0x8c, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x91, 0x83, 0xf0, 0x9f,
+    0x8f, 0xbd, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x9a, 0x95,
+    0xf0, 0x9f, 0xa4, 0xb6, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x90, 0xbd, 0xf0, 0x9f, 0xa7, 0x8e,
+    0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x96, 0x96, 0xf0, 0x9f,
+    0x8f, 0xbf, 0xe2, 0x9d, 0xa3, 0xf0, 0x9f, 0xa7, 0x91, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8d, 0xb3,
+    0xf0, 0x9f, 0x92, 0x81, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa5,
+    0x81, 0xf0, 0x9f, 0x95, 0xa3, 0xf0, 0x9f, 0x99, 0x86, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d,
+    0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80,
+    0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0,
+    0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xbc, 0xf0, 0x9f,
+    0x85, 0xbe, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa4, 0xb1, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x91,
+    0xa9, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8d, 0xb3, 0xf0, 0x9f, 0x99, 0x8b,
+    0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2,
+    0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0xa5, 0xb6, 0xf0, 0x9f, 0xa4, 0x9f, 0xf0,
+    0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0xa7, 0x9d, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x80, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80,
+    0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0xa7, 0x9d,
+    0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x8f, 0x87, 0xf0, 0x9f, 0x99, 0x87, 0xe2, 0x80,
+    0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xe2, 0x99, 0x88, 0xf0, 0x9f, 0x92, 0x86, 0xf0, 0x9f,
+    0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x99, 0x84, 0xf0, 0x9f, 0x9a, 0xa3,
+    0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91,
+    0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8d, 0xbc, 0xf0, 0x9f, 0x93, 0xbf,
+    0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8,
+    0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x92, 0xac,
+    0xe2, 0x8f, 0xb0, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0x8e, 0xa4, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4,
+    0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f,
+    0xa6, 0xac, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8d,
+    0xbc, 0xf0, 0x9f, 0x99, 0x87, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f,
+    0xbe, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8e, 0xa8, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbf,
+    0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8f, 0xab, 0xf0, 0x9f, 0x87, 0xb2, 0xf0, 0x9f, 0x87, 0xbf, 0xf0,
+    0x9f, 0x91, 0xbf, 0xf0, 0x9f, 0xa7, 0x98, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x82, 0xf0, 0x9f, 0xaa, 0xb3, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d,
+    0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f,
+    0x8c, 0xbe, 0xf0, 0x9f, 0x87, 0xa7, 0xf0, 0x9f, 0x87, 0xb6, 0xf0, 0x9f, 0x90, 0x8a, 0xf0, 0x9f,
+    0x9f, 0xa7, 0xf0, 0x9f, 0x87, 0xa8, 0xf0, 0x9f, 0x87, 0xae, 0xf0, 0x9f, 0x9b, 0xb9, 0xf0, 0x9f,
+    0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xb2, 0xf0, 0x9f, 0x92,
+    0x87, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0xa7, 0x9a, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d,
+    0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa6, 0xb5, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f,
+    0x8e, 0xb9, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x9c, 0x88,
+    0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x8d, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x87,
+    0xb9, 0xf0, 0x9f, 0x87, 0xb7, 0xf0, 0x9f, 0x92, 0x9d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f,
+    0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91,
+    0xa9, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x95, 0xb5, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d,
+    0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0x8e, 0x93, 0xf0, 0x9f, 0xa9, 0xb9, 0xf0, 0x9f, 0x91, 0x8c, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f,
+    0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2,
+    0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f,
+    0xbe, 0xf0, 0x9f, 0xa7, 0x8e, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef,
+    0xb8, 0x8f, 0xf0, 0x9f, 0xa4, 0xb9, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82,
+    0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x9a, 0xb6, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x92, 0x9f, 0xf0,
+    0x9f, 0xa7, 0x8e, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f,
+    0xf0, 0x9f, 0xa7, 0x9d, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8,
+    0x8f, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2,
+    0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x87, 0xae, 0xf0, 0x9f,
+    0x87, 0xb6, 0xf0, 0x9f, 0x8f, 0x8b, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80,
+    0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80,
+    0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x91, 0x80, 0xf0, 0x9f, 0x91,
+    0xac, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x90, 0x80, 0xf0, 0x9f, 0xa6, 0xb8, 0xf0, 0x9f, 0x8f,
+    0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f,
+    0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0,
+    0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x99, 0x86, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x80, 0xe2, 0xac, 0x9b, 0xf0, 0x9f, 0x91, 0xae, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2,
+    0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0xa6, 0xbd, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2,
+    0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb,
+    0xf0, 0x9f, 0x8e, 0x9f, 0xe2, 0x99, 0xa8, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x99, 0x86, 0xf0, 0x9f,
+    0x8f, 0xbf, 0xf0, 0x9f, 0x8f, 0x82, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x93, 0x94, 0xf0, 0x9f,
+    0x9a, 0xb6, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0,
+    0x9f, 0x9a, 0xa3, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa9,
+    0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0,
+    0x9f, 0xa6, 0xb6, 0xf0, 0x9f, 0x8e, 0xb1, 0xf0, 0x9f, 0x94, 0x88, 0xf0, 0x9f, 0xa7, 0x91, 0xf0,
+    0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x94, 0xa7, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f,
+    0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2,
+    0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0xab, 0xb5, 0xf0, 0x9f,
+    0x8f, 0xbc, 0xf0, 0x9f, 0x96, 0xb2, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f,
+    0xbb, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa4, 0x9d, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0,
+    0x9f, 0x8f, 0xbe, 0xe2, 0x9b, 0xb9, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82,
+    0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x99, 0x8b, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa6, 0xba, 0xf0, 0x9f, 0xa7, 0x81, 0xf0, 0x9f, 0x91, 0xb1,
+    0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91,
+    0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xb3, 0xe2, 0x8f, 0xb9, 0xef, 0xb8, 0x8f, 0xf0, 0x9f,
+    0xaa, 0x82, 0xf0, 0x9f, 0x91, 0xb3, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82,
+    0xf0, 0x9f, 0x93, 0x9b, 0xf0, 0x9f, 0x9a, 0x80, 0xe2, 0x9a, 0xab, 0xf0, 0x9f, 0xa7, 0x91, 0xf0,
+    0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xbd, 0xf0, 0x9f, 0x9a, 0xbc, 0xf0, 0x9f,
+    0x95, 0x99, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4,
+    0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0xa7, 0x94, 0xf0,
+    0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xe3, 0x8a, 0x97, 0xf0,
+    0x9f, 0x87, 0xb9, 0xf0, 0x9f, 0x87, 0xbc, 0xf0, 0x9f, 0x8f, 0x8a, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2,
+    0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0xaa, 0xb2, 0xe2, 0x9c, 0x94, 0xef, 0xb8, 0x8f, 0xf0,
+    0x9f, 0xa4, 0x98, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2,
+    0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xbd, 0xf0, 0x9f, 0x91, 0x85, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f,
+    0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x91,
+    0xb1, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x91, 0xa9, 0xf0,
+    0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0xbc, 0xf0, 0x9f, 0x94, 0x8f, 0xf0, 0x9f,
+    0x9a, 0xb5, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0xa7, 0x91,
+    0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92,
+    0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x93, 0xb5,
+    0xf0, 0x9f, 0xab, 0xb3, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x87, 0xb5, 0xf0, 0x9f, 0x87, 0xaa,
+    0xf0, 0x9f, 0x8e, 0x99, 0xef, 0xb8, 0x8f, 0xe2, 0x9a, 0x99, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x87,
+    0xb2, 0xf0, 0x9f, 0x87, 0xad, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d,
+    0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f,
+    0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f,
+    0xa7, 0xa0, 0xf0, 0x9f, 0xa5, 0x8a, 0xf0, 0x9f, 0x98, 0x95, 0xf0, 0x9f, 0xa7, 0x97, 0xf0, 0x9f,
+    0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x8e, 0x88, 0xf0, 0x9f, 0xa4, 0x99,
+    0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x92, 0xa6, 0xf0, 0x9f, 0x91, 0xb1, 0xe2, 0x80, 0x8d, 0xe2,
+    0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x8f, 0x97, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f,
+    0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92,
+    0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x8f, 0xb7,
+    0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0x8f, 0xad, 0xf0, 0x9f, 0xa4, 0x98, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0xa6, 0xbb, 0xf0, 0x9f,
+    0x8f, 0xbe, 0xf0, 0x9f, 0x9a, 0xb4, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82,
+    0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa5, 0xb7, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0xaa, 0x86, 0xf0,
+    0x9f, 0x8f, 0x9e, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa5, 0xf0, 0x9f, 0x98, 0x9f, 0xf0, 0x9f,
+    0xa4, 0xbe, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80,
+    0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80,
+    0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x9a, 0xb4, 0xf0, 0x9f, 0x8f,
+    0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa5, 0x84, 0xf0, 0x9f,
+    0x99, 0x85, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa8, 0xf0,
+    0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xaf, 0xf0, 0x9f, 0xa7, 0x9b, 0xe2, 0x80,
+    0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xe3, 0x8a, 0x99, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f,
+    0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xbc, 0xf0, 0x9f, 0x9b, 0xb8, 0xf0, 0x9f, 0x91,
+    0x9a, 0xf0, 0x9f, 0x87, 0xac, 0xf0, 0x9f, 0x87, 0xbe, 0xf0, 0x9f, 0x87, 0xb1, 0xf0, 0x9f, 0x87,
+    0xa7, 0xf0, 0x9f, 0x99, 0x8e, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x8e, 0x96, 0xf0, 0x9f, 0x91,
+    0xaf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xe2, 0x9c, 0x8c, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f,
+    0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2,
+    0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0xa7, 0x8f, 0xf0, 0x9f,
+    0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x91, 0xf0,
+    0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8e, 0xa4, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f,
+    0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0xbb, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f,
+    0xbf, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8c, 0xbe, 0xf0, 0x9f, 0x9a, 0xb6, 0xf0, 0x9f, 0x8f, 0xbe,
+    0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x95, 0xa0, 0xf0, 0x9f, 0xa7,
+    0x91, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x9a, 0x92, 0xf0, 0x9f, 0x91, 0xa8,
+    0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92,
+    0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0xa6, 0xb0,
+    0xf0, 0x9f, 0x98, 0xbf, 0xf0, 0x9f, 0xa6, 0xb5, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x91, 0xa9,
+    0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b,
+    0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x93, 0x9a, 0xf0, 0x9f, 0x99, 0x8d, 0xf0,
+    0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x90, 0x92,
+    0xf0, 0x9f, 0x95, 0x95, 0xf0, 0x9f, 0x95, 0xb5, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x92, 0x8b,
+    0xf0, 0x9f, 0xa7, 0x92, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbb,
+    0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8e, 0xa4, 0xf0, 0x9f, 0xa7, 0x91, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0x9a, 0x80, 0xf0, 0x9f, 0x9a, 0xb4, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0,
+    0x9f, 0x98, 0xb5, 0xf0, 0x9f, 0x91, 0x94, 0xf0, 0x9f, 0x8f, 0x8c, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0,
+    0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8f, 0xad, 0xf0, 0x9f,
+    0x94, 0xbb, 0xf0, 0x9f, 0x8c, 0xbb, 0xf0, 0x9f, 0x97, 0x92, 0xf0, 0x9f, 0x8f, 0x8c, 0xf0, 0x9f,
+    0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa4, 0xb5, 0xe2,
+    0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x95, 0xaf, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa4, 0xb7,
+    0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x87, 0xa9, 0xf0, 0x9f, 0x87,
+    0xac, 0xf0, 0x9f, 0x99, 0x85, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef,
+    0xb8, 0x8f, 0xf0, 0x9f, 0x8e, 0xaf, 0xf0, 0x9f, 0x95, 0xb5, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0xac,
+    0x87, 0xf0, 0x9f, 0x87, 0xb5, 0xf0, 0x9f, 0x87, 0xb0, 0xe2, 0x99, 0xbf, 0xf0, 0x9f, 0x91, 0x8a,
+    0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0xa4, 0xb4, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x98, 0x8b,
+    0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8,
+    0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0,
+    0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x9d,
+    0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0,
+    0x9f, 0xa7, 0x8d, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x91,
+    0xa8, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f,
+    0x91, 0xa8, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x94, 0xac, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f,
+    0xbe, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8e, 0xa8, 0xe2, 0x9c, 0x8d, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0,
+    0x9f, 0x8d, 0xb1, 0xf0, 0x9f, 0x8c, 0x82, 0xf0, 0x9f, 0x91, 0xa8, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0x8d, 0xbc, 0xf0, 0x9f, 0xa4, 0xb9, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x87, 0xb7,
+    0xf0, 0x9f, 0x87, 0xba, 0xf0, 0x9f, 0x8f, 0xb4, 0xf3, 0xa0, 0x81, 0xa7, 0xf3, 0xa0, 0x81, 0xa2,
+    0xf3, 0xa0, 0x81, 0xb3, 0xf3, 0xa0, 0x81, 0xa3, 0xf3, 0xa0, 0x81, 0xb4, 0xf3, 0xa0, 0x81, 0xbf,
+    0xf0, 0x9f, 0xa4, 0xb7, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f,
+    0xa6, 0x87, 0xf0, 0x9f, 0xa7, 0x99, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82,
+    0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x87, 0xa7, 0xf0, 0x9f, 0x87, 0xae, 0xf0, 0x9f, 0x96, 0x96, 0xf0,
+    0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x97, 0xa3, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2,
+    0x80, 0x8d, 0xe2, 0x9a, 0x95, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbe,
+    0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8e, 0xa4, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2,
+    0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2,
+    0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x9a, 0xb4, 0xf0, 0x9f,
+    0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x91, 0xae, 0xf0, 0x9f, 0x8f, 0xbe,
+    0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x96, 0x8a, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xaa,
+    0xa7, 0xf0, 0x9f, 0xa7, 0x94, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef,
+    0xb8, 0x8f, 0xe2, 0x9b, 0xb9, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0,
+    0x9f, 0x91, 0xb5, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0xa7, 0x98, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x92, 0x97, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xf0, 0x9f,
+    0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x94, 0xac, 0xf0, 0x9f, 0x8f,
+    0x8c, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x91, 0xb0, 0xe2,
+    0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x95, 0xb7, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f,
+    0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80,
+    0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x86, 0x92, 0xf0, 0x9f, 0xa7,
+    0x91, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa4, 0x9d, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0xa7, 0x8f, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2,
+    0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0xa6, 0xbb, 0xf0, 0x9f, 0x8c, 0x99, 0xf0, 0x9f, 0x8f,
+    0x83, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f,
+    0x91, 0xae, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0xa4, 0x8f, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f,
+    0x99, 0x8a, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0xa4, 0xb7, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0,
+    0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f,
+    0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0xa4, 0xb8, 0xf0,
+    0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa9,
+    0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xb3, 0xf0, 0x9f, 0x91, 0xa8, 0xf0,
+    0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8c, 0xbe, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f,
+    0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa4, 0x9d, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8,
+    0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x91, 0xbb, 0xf0, 0x9f, 0xa4, 0xb8, 0xf0, 0x9f, 0x8f, 0xbf,
+    0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0x91, 0xa6, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa6, 0xf0, 0x9f, 0x91, 0x8e, 0xf0,
+    0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x8f, 0x83, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x91,
+    0xab, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x8f, 0x9b, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x90, 0x9b,
+    0xf0, 0x9f, 0xa7, 0x94, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8,
+    0x8f, 0xf0, 0x9f, 0x9a, 0xa9, 0xf0, 0x9f, 0x87, 0xa7, 0xf0, 0x9f, 0x87, 0xbe, 0xf0, 0x9f, 0xab,
+    0xb1, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xab, 0xb2, 0xf0, 0x9f, 0x8f, 0xbf,
+    0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8,
+    0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0xa4, 0xb9,
+    0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x8e,
+    0xae, 0xf0, 0x9f, 0xa7, 0x8e, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef,
+    0xb8, 0x8f, 0xf0, 0x9f, 0xa6, 0xa8, 0xf0, 0x9f, 0xa7, 0x9b, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80,
+    0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xaa, 0xa9, 0xf0, 0x9f, 0x8d, 0x99, 0xf0, 0x9f, 0x91, 0xb0, 0xf0,
+    0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xe2, 0x86, 0x98, 0xf0,
+    0x9f, 0xa4, 0x8e, 0xf0, 0x9f, 0xa4, 0x9f, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x87, 0xad, 0xf0,
+    0x9f, 0x87, 0xb3, 0xf0, 0x9f, 0xa4, 0xb5, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x80, 0xe2, 0x99, 0x8b, 0xf0, 0x9f, 0xa6, 0xab, 0xf0, 0x9f, 0x94, 0xa9, 0xf0, 0x9f, 0xa4, 0xb2,
+    0xf0, 0x9f, 0xa6, 0xb9, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8,
+    0x8f, 0xf0, 0x9f, 0x9b, 0xb0, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x87, 0xa8, 0xf0, 0x9f, 0x87, 0xbd,
+    0xc2, 0xae, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x94, 0x85, 0xf0, 0x9f, 0x91, 0xb2, 0xf0, 0x9f, 0x8f,
+    0xbf, 0xf0, 0x9f, 0xa7, 0x91, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8e, 0xa8, 0xf0, 0x9f, 0x92, 0x85,
+    0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x91, 0xa6, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0xa7, 0x91,
+    0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x9a, 0x95, 0xf0, 0x9f, 0x92, 0x83, 0xf0, 0x9f,
+    0x8f, 0xbc, 0xf0, 0x9f, 0x91, 0xb1, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82,
+    0xf0, 0x9f, 0x92, 0xb6, 0xf0, 0x9f, 0xa7, 0x88, 0xf0, 0x9f, 0xa4, 0x8f, 0xf0, 0x9f, 0x8f, 0xbf,
+    0xf0, 0x9f, 0x90, 0xb6, 0xf0, 0x9f, 0x95, 0xb5, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2,
+    0x99, 0x82, 0xf0, 0x9f, 0xab, 0xb1, 0xf0, 0x9f, 0x8f, 0x8c, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80,
+    0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa4, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xaa, 0xb8, 0xf0, 0x9f, 0x8f, 0xa9, 0xf0, 0x9f, 0x90, 0x8c,
+    0xf0, 0x9f, 0xa7, 0x86, 0xf0, 0x9f, 0x91, 0x82, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0xa7, 0x91,
+    0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa4, 0x9d, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x98, 0xb8, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xb5,
+    0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x92, 0x82, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2,
+    0x99, 0x80, 0xf0, 0x9f, 0xa7, 0x9b, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80,
+    0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x9d, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x99, 0x8e, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2,
+    0x99, 0x82, 0xf0, 0x9f, 0x95, 0xb5, 0xf0, 0x9f, 0x8f, 0x8c, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7,
+    0x98, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x98, 0x8f, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0x91, 0xa7, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa7, 0xf0, 0x9f, 0x98, 0x8a, 0xf0,
+    0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f,
+    0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f,
+    0x8f, 0xbe, 0xf0, 0x9f, 0xa4, 0xb9, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82,
+    0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0x8c, 0xbe, 0xf0, 0x9f, 0x8d, 0x9a, 0xf0, 0x9f, 0x87, 0xb2, 0xf0, 0x9f, 0x87, 0xbe, 0xf0, 0x9f,
+    0x87, 0xa8, 0xf0, 0x9f, 0x87, 0xab, 0xe2, 0x84, 0xa2, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa8,
+    0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xb1, 0xf0, 0x9f, 0xa7, 0x94, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0,
+    0x9f, 0x87, 0xaf, 0xf0, 0x9f, 0x87, 0xb4, 0xf0, 0x9f, 0x91, 0xae, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2,
+    0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbe,
+    0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0xa4, 0xb7, 0xf0, 0x9f, 0x8f, 0xbe,
+    0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa5, 0xad, 0xf0, 0x9f, 0x94,
+    0xa3, 0xf0, 0x9f, 0xa4, 0xb5, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef,
+    0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8d,
+    0xbc, 0xf0, 0x9f, 0x91, 0xaf, 0xf0, 0x9f, 0xa5, 0xa1, 0xf0, 0x9f, 0x93, 0xb1, 0xf0, 0x9f, 0x87,
+    0xab, 0xf0, 0x9f, 0x87, 0xb2, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0x9a, 0x92, 0xf0, 0x9f, 0x9b, 0x91, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbc,
+    0xe2, 0x80, 0x8d, 0xe2, 0x9a, 0x96, 0xf0, 0x9f, 0xa6, 0xa5, 0xe2, 0x9a, 0xb0, 0xef, 0xb8, 0x8f,
+    0xf0, 0x9f, 0x9a, 0xa3, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x97, 0x83, 0xf0, 0x9f, 0x94, 0x91,
+    0xf0, 0x9f, 0x9f, 0xa3, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2,
+    0x9a, 0x96, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x8e, 0x8f, 0xf0, 0x9f, 0x98, 0xb3, 0xf0, 0x9f, 0xa4,
+    0x95, 0xf0, 0x9f, 0x93, 0xbd, 0xf0, 0x9f, 0xa4, 0x8f, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x9a, 0xb1,
+    0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x87, 0xaa, 0xf0, 0x9f, 0x87, 0xb9, 0xf0, 0x9f, 0x96, 0x96, 0xf0,
+    0x9f, 0xa9, 0xb2, 0xf0, 0x9f, 0x98, 0xbd, 0xf0, 0x9f, 0xa7, 0xab, 0xf0, 0x9f, 0xa7, 0x8f, 0xf0,
+    0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x97,
+    0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f,
+    0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa4, 0x9d, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9,
+    0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x99, 0xbe, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80,
+    0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa7, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0x91, 0xa7, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0xa6, 0xb2, 0xe2, 0x98, 0xa0, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x86, 0x97, 0xf0, 0x9f, 0x91, 0xa9,
+    0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8f, 0xab, 0xf0, 0x9f, 0xa4, 0x9a, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0,
+    0x9f, 0xa7, 0x9f, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0x8d, 0xb3, 0xf0, 0x9f, 0x9a, 0xb4, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2,
+    0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa5, 0xa7, 0xf0, 0x9f, 0x87, 0xba, 0xf0, 0x9f, 0x87,
+    0xb2, 0xf0, 0x9f, 0xab, 0xb1, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xab, 0xb2,
+    0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0xa6, 0xbc, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0x94, 0xa7, 0xf0, 0x9f, 0x91, 0xa8, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa7, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0x91, 0xa6, 0xf0, 0x9f, 0xa9, 0xb4, 0xf0, 0x9f, 0x8f, 0x84, 0xf0, 0x9f, 0x8f, 0xbf,
+    0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0xa5, 0x9f, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f,
+    0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xb1, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f,
+    0xbe, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa4, 0x9d, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0,
+    0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0xa7, 0x99, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xb4, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0xa4, 0xbe,
+    0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0xa4, 0x99, 0xf0, 0x9f,
+    0x8f, 0xbd, 0xf0, 0x9f, 0x92, 0x90, 0xf0, 0x9f, 0x98, 0x9c, 0xf0, 0x9f, 0x91, 0xb1, 0xf0, 0x9f,
+    0x8f, 0xbd, 0xf0, 0x9f, 0x99, 0x8e, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80,
+    0xe2, 0x97, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80,
+    0x8d, 0xf0, 0x9f, 0xa6, 0xbd, 0xf0, 0x9f, 0x90, 0x99, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f,
+    0xbc, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8d, 0xbc, 0xf0, 0x9f, 0x99, 0x86, 0xf0, 0x9f, 0x8f, 0xbe,
+    0xf0, 0x9f, 0x87, 0xaa, 0xf0, 0x9f, 0x87, 0xa8, 0xf0, 0x9f, 0x92, 0x81, 0xf0, 0x9f, 0x8f, 0xbb,
+    0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x91, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0xa6, 0xbc, 0xf0, 0x9f, 0xa4, 0xb3, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0xab, 0xb0,
+    0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x8e, 0xba, 0xf0, 0x9f, 0x87, 0xab, 0xf0, 0x9f, 0x87, 0xb0,
+    0xf0, 0x9f, 0xa5, 0xa4, 0xf0, 0x9f, 0xa4, 0xa7, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbb,
+    0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f,
+    0xbd, 0xf0, 0x9f, 0x91, 0x8f, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0xa4, 0xaf, 0xf0, 0x9f, 0x91,
+    0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80,
+    0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbc,
+    0xf0, 0x9f, 0x9a, 0x91, 0xf0, 0x9f, 0x98, 0x9e, 0xf0, 0x9f, 0x9a, 0xa6, 0xf0, 0x9f, 0x8f, 0x8c,
+    0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x93, 0x85, 0xf0, 0x9f, 0x9a, 0xb4, 0xf0, 0x9f, 0x8f, 0xbb,
+    0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80,
+    0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80,
+    0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0xa7, 0x99, 0xf0, 0x9f, 0x8f,
+    0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x8e, 0xe2, 0x80,
+    0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x92, 0x87, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2,
+    0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x9a, 0xb6, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d,
+    0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x9d,
+    0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0,
+    0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0,
+    0x9f, 0x91, 0x90, 0xf0, 0x9f, 0xa7, 0x91, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xb1, 0xf0, 0x9f,
+    0x92, 0x83, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0xa7, 0x99, 0xf0, 0x9f, 0x8d, 0xab, 0xf0, 0x9f,
+    0x91, 0xb3, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xe2,
+    0x9b, 0xb9, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x99, 0x8f,
+    0xf0, 0x9f, 0xa7, 0x96, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8,
+    0x8f, 0xf0, 0x9f, 0x91, 0xa8, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0x91, 0xa6, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa6, 0xf0, 0x9f, 0x91, 0x93, 0xf0, 0x9f,
+    0xa7, 0x8e, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x9a, 0xb6,
+    0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x87, 0xa6, 0xf0, 0x9f,
+    0x87, 0xa9, 0x35, 0xef, 0xb8, 0x8f, 0xe2, 0x83, 0xa3, 0xf0, 0x9f, 0xa4, 0xb8, 0xf0, 0x9f, 0x8f,
+    0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x99, 0x8d, 0xe2, 0x80,
+    0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0xa4, 0x96, 0xf0, 0x9f, 0xa4, 0xbe, 0xe2, 0x80, 0x8d, 0xe2,
+    0x99, 0x82, 0xf0, 0x9f, 0x8f, 0x84, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82,
+    0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x99, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0xa4, 0x9b, 0xf0,
+    0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x8c, 0x97, 0xf0, 0x9f, 0x91, 0x9b, 0x33, 0xe2, 0x83, 0xa3, 0xf0,
+    0x9f, 0x91, 0xb3, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0x94, 0xa7, 0xf0, 0x9f, 0xa4, 0x8f, 0xf0, 0x9f, 0x87, 0xa8, 0xf0, 0x9f, 0x87, 0xb1, 0xf0, 0x9f,
+    0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x90, 0xbe, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f,
+    0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x95,
+    0xba, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x8d, 0xa8, 0xe2, 0x9c, 0x8f, 0xef, 0xb8, 0x8f, 0xe2,
+    0x98, 0x9d, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x91, 0xb7, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f,
+    0xa6, 0xb8, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x9a, 0x95,
+    0xf0, 0x9f, 0x92, 0x86, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8,
+    0x8f, 0xf0, 0x9f, 0x9b, 0xa4, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x8d, 0xa4, 0xf0, 0x9f, 0x8f, 0xb0,
+    0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x9a, 0x95, 0xf0, 0x9f,
+    0x8d, 0x9b, 0xf0, 0x9f, 0x92, 0x84, 0xf0, 0x9f, 0x87, 0xb2, 0xf0, 0x9f, 0x87, 0xb1, 0xf0, 0x9f,
+    0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xe2, 0x9a, 0x95, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbd,
+    0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b,
+    0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0xa4, 0x8f, 0xf0,
+    0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0x9a, 0x80, 0xf0, 0x9f, 0x87, 0xb9, 0xf0, 0x9f, 0x87, 0xb1, 0xf0, 0x9f, 0x93, 0xb8, 0xf0, 0x9f,
+    0x92, 0x82, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0xa9, 0xb9, 0xf0, 0x9f, 0x9a, 0xa3, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80,
+    0xf0, 0x9f, 0x91, 0xb1, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f,
+    0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8f, 0xab, 0xf0, 0x9f, 0xa7,
+    0x96, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f,
+    0x8d, 0xb0, 0xf0, 0x9f, 0x91, 0xa7, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x8f, 0xb4, 0xe2, 0x80,
+    0x8d, 0xe2, 0x98, 0xa0, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x87, 0xb5,
+    0xf0, 0x9f, 0x87, 0xa6, 0xf0, 0x9f, 0xa7, 0x96, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2,
+    0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x9a, 0xa3, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d,
+    0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x8c, 0xa7, 0xf0, 0x9f, 0xa7, 0x9b, 0xf0, 0x9f,
+    0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x92, 0xbb, 0xf0, 0x9f, 0x94, 0xb1,
+    0xf0, 0x9f, 0x87, 0xac, 0xf0, 0x9f, 0x87, 0xbc, 0xf0, 0x9f, 0x8f, 0x82, 0xf0, 0x9f, 0x95, 0xa4,
+    0xf0, 0x9f, 0xab, 0xb5, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbc,
+    0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8e, 0xa4, 0xf0, 0x9f, 0x99, 0x87, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2,
+    0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbf,
+    0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8,
+    0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0xa5, 0xb8, 0xf0, 0x9f, 0xa7, 0x92, 0xf0, 0x9f, 0x8f, 0xbb,
+    0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8,
+    0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0xa6, 0x97,
+    0xf0, 0x9f, 0x92, 0x82, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbf,
+    0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b,
+    0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0xa4, 0xb6, 0xf0,
+    0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0xa5, 0x9b, 0xf0, 0x9f, 0x95, 0xa7, 0xe2, 0x99, 0xa0, 0xf0, 0x9f,
+    0x87, 0xa8, 0xf0, 0x9f, 0x87, 0xbf, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80,
+    0x8d, 0xf0, 0x9f, 0x8d, 0xb3, 0xf0, 0x9f, 0x91, 0xb1, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d,
+    0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80,
+    0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0,
+    0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xb2, 0xf0, 0x9f,
+    0x8c, 0xa5, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x87, 0xb5, 0xf0, 0x9f, 0x87, 0xb9, 0xf0, 0x9f, 0xa7,
+    0x91, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xb0, 0xf0, 0x9f, 0xa4, 0xb4,
+    0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x92, 0x95, 0xf0, 0x9f, 0xa6, 0xb1, 0xf0, 0x9f, 0xa6, 0xbf,
+    0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa4, 0x9d, 0xe2,
+    0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x99, 0x86, 0xf0, 0x9f,
+    0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xe2, 0x8c, 0xa8, 0xef, 0xb8, 0x8f, 0xf0, 0x9f,
+    0x8e, 0x85, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80,
+    0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f,
+    0x8f, 0xbd, 0xf0, 0x9f, 0x92, 0x99, 0xf0, 0x9f, 0x87, 0xb3, 0xf0, 0x9f, 0x87, 0xac, 0xf0, 0x9f,
+    0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8f, 0xab, 0xf0, 0x9f, 0x91,
+    0xa9, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80,
+    0x8d, 0xf0, 0x9f, 0xa4, 0x9d, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbd,
+    0xf0, 0x9f, 0xa7, 0x8f, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f,
+    0x93, 0xbb, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4,
+    0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91,
+    0xa8, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x8f, 0x84, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d,
+    0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x99, 0x8d, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f,
+    0xf0, 0x9f, 0xa4, 0xb9, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f,
+    0x98, 0x8d, 0xf0, 0x9f, 0x93, 0xa9, 0xf0, 0x9f, 0xa4, 0xb8, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f,
+    0x8c, 0xac, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa4, 0xb9, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d,
+    0xe2, 0x99, 0x82, 0xe2, 0x86, 0x99, 0xf0, 0x9f, 0x8c, 0xab, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f,
+    0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0xbb, 0xf0, 0x9f, 0xa5, 0x93, 0xe2, 0x9b, 0xb9,
+    0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7,
+    0x91, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xb3, 0xf0, 0x9f, 0xa7, 0x91,
+    0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8e, 0x84, 0xf0, 0x9f, 0xa7, 0x9a, 0xf0,
+    0x9f, 0x96, 0x90, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x99, 0x88, 0xf0, 0x9f, 0xa7, 0x9a, 0xe2,
+    0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x9a, 0xa3, 0xf0, 0x9f, 0x8f, 0xbe,
+    0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x94, 0xf0, 0x9f, 0x8f,
+    0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x92, 0x81, 0xe2, 0x80,
+    0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0x88, 0xf0, 0x9f, 0x8e, 0x8c, 0xf0,
+    0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x9a, 0x95, 0xf0, 0x9f, 0x8c,
+    0xa5, 0xf0, 0x9f, 0xa7, 0x8e, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0,
+    0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xaf, 0xf0, 0x9f,
+    0xa7, 0x9c, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x91, 0xa9,
+    0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91,
+    0xa8, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d,
+    0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbf,
+    0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8,
+    0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0x8f, 0xab, 0xf0, 0x9f, 0x99, 0x8e, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x82, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xb1, 0xf0, 0x9f, 0x91, 0xa9,
+    0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xb3, 0xf0, 0x9f, 0x8f, 0x8c, 0xf0,
+    0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa4, 0xbe,
+    0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0xaa, 0x9d, 0xf0, 0x9f,
+    0x87, 0xaa, 0xf0, 0x9f, 0x87, 0xac, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80,
+    0x8d, 0xe2, 0x9a, 0x96, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa5, 0x9c, 0xe2, 0x9d, 0x87, 0xf0, 0x9f,
+    0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8e, 0x93, 0xf0, 0x9f, 0x92,
+    0x87, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x91, 0xa6, 0xf0,
+    0x9f, 0xa6, 0x93, 0xf0, 0x9f, 0xa6, 0xb8, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xae, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2,
+    0x99, 0x82, 0xe2, 0x9b, 0xb9, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef,
+    0xb8, 0x8f, 0xf0, 0x9f, 0x92, 0x86, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80,
+    0xf0, 0x9f, 0x98, 0xbb, 0xe2, 0x9c, 0x8a, 0xf0, 0x9f, 0xa7, 0x9a, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0,
+    0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x9a, 0x92, 0xf0, 0x9f,
+    0x99, 0x85, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbd,
+    0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f,
+    0xbc, 0xf0, 0x9f, 0x87, 0xa7, 0xf0, 0x9f, 0x87, 0xb8, 0xe2, 0x99, 0x91, 0xf0, 0x9f, 0x91, 0xa8,
+    0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x9c, 0x88, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x87,
+    0xac, 0xf0, 0x9f, 0x87, 0xa6, 0xf0, 0x9f, 0x90, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0x84, 0xef,
+    0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4,
+    0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f,
+    0x91, 0xb3, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x91, 0xa9,
+    0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0xa6, 0x94, 0xf0, 0x9f, 0x92, 0x83, 0xf0, 0x9f, 0x8f, 0xbe,
+    0x39, 0xe2, 0x83, 0xa3, 0xf0, 0x9f, 0x99, 0x87, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0xa7, 0x9c,
+    0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa4,
+    0xbd, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x91, 0xa8, 0xf0,
+    0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xaf, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f,
+    0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xbc, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f,
+    0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92,
+    0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x91, 0xae,
+    0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91,
+    0xae, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x92, 0x83, 0xf0,
+    0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0xa7, 0x98, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x80, 0xf0, 0x9f, 0x99, 0x87, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0,
+    0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0,
+    0x9f, 0x93, 0x9f, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0xa4, 0x9d, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x91,
+    0xa9, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8d, 0xbc, 0xf0, 0x9f, 0xa4, 0xb8,
+    0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91,
+    0xa9, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80,
+    0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbd,
+    0xf0, 0x9f, 0x94, 0xb4, 0xf0, 0x9f, 0x97, 0x9c, 0xf0, 0x9f, 0xa4, 0xb8, 0xf0, 0x9f, 0x8f, 0xbb,
+    0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0xa7, 0x9a, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82,
+    0xf0, 0x9f, 0xa7, 0x8e, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f,
+    0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f,
+    0xa4, 0xa6, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbe,
+    0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xb0, 0xf0, 0x9f, 0xaa, 0xba, 0xf0, 0x9f, 0xa7, 0x91, 0xf0,
+    0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8d, 0xbc, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f,
+    0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0,
+    0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0xa4, 0xb5, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x80, 0xf0, 0x9f, 0x9b, 0xac, 0xf0, 0x9f, 0xa4, 0xb7, 0xf0, 0x9f, 0x91, 0xa8, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa7, 0xe2, 0x8f, 0xac, 0xf0, 0x9f,
+    0x8f, 0x88, 0xf0, 0x9f, 0x87, 0xb9, 0xf0, 0x9f, 0x87, 0xb9, 0xf0, 0x9f, 0x8f, 0x96, 0xf0, 0x9f,
+    0x8f, 0x84, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0xa6, 0xbb,
+    0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2,
+    0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb,
+    0xf0, 0x9f, 0xa4, 0xb0, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x94, 0xac, 0xe2,
+    0x9c, 0x89, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x97, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d,
+    0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x99, 0x86, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80,
+    0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x94, 0x8d, 0xf0, 0x9f, 0xa7, 0x8f, 0xe2,
+    0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x92, 0x81, 0xf0, 0x9f, 0x8f, 0xbe,
+    0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0xab, 0xb4, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f,
+    0xa4, 0xb4, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80,
+    0x8d, 0xe2, 0x9c, 0x88, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x92, 0x87, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2,
+    0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xab, 0xb0, 0xf0, 0x9f, 0x8f, 0xbe,
+    0xe2, 0x86, 0x97, 0xf0, 0x9f, 0x9b, 0xbb, 0xf0, 0x9f, 0x8c, 0x95, 0xf0, 0x9f, 0xa7, 0x94, 0xf0,
+    0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x99, 0x8d, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x91, 0xa9, 0xe2,
+    0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xbc, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80,
+    0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x8d, 0xaf, 0xf0, 0x9f, 0x91, 0x8d, 0xf0, 0x9f,
+    0x8f, 0xbe, 0xe2, 0x8f, 0xb1, 0xf0, 0x9f, 0x91, 0x8f, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x8c,
+    0xb1, 0xf0, 0x9f, 0x8d, 0xa7, 0xf0, 0x9f, 0x9a, 0xba, 0xf0, 0x9f, 0xa4, 0x91, 0xf0, 0x9f, 0x8f,
+    0x8b, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f,
+    0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xb2, 0xf0, 0x9f, 0xa7,
+    0x96, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f,
+    0x93, 0xa4, 0xf0, 0x9f, 0x87, 0xa7, 0xf0, 0x9f, 0x87, 0xac, 0xf0, 0x9f, 0x9a, 0xb5, 0xf0, 0x9f,
+    0x8f, 0xbc, 0xf0, 0x9f, 0x95, 0xb0, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x99, 0x86, 0xe2, 0x80, 0x8d,
+    0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x9b, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80,
+    0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x8c, 0xb9, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe,
+    0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9,
+    0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0xa4, 0x9d, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f,
+    0x87, 0xac, 0xf0, 0x9f, 0x87, 0xb1, 0xf0, 0x9f, 0x91, 0xb0, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f,
+    0x87, 0xa9, 0xf0, 0x9f, 0x87, 0xb0, 0xf0, 0x9f, 0x9a, 0xa3, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80,
+    0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x97, 0x9d, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x8d, 0xf0,
+    0x9f, 0x87, 0xb8, 0xf0, 0x9f, 0x87, 0xb2, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2,
+    0x80, 0x8d, 0xe2, 0x9a, 0x95, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x99, 0x81, 0xf0, 0x9f, 0xa7, 0x8f,
+    0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x91, 0xbc, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x95, 0xb5,
+    0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x9a, 0x87, 0xf0, 0x9f,
+    0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2,
+    0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0xa4, 0xb8, 0xe2, 0x80,
+    0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x9f, 0xb0, 0xf0, 0x9f, 0x87, 0xb9, 0xf0,
+    0x9f, 0x87, 0xb3, 0xe2, 0x9c, 0x82, 0xf0, 0x9f, 0xab, 0xb4, 0xf0, 0x9f, 0x95, 0x9e, 0xf0, 0x9f,
+    0x8e, 0xa5, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4,
+    0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x91, 0xb3, 0xf0,
+    0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0xa4, 0x9d, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x98,
+    0xa8, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2,
+    0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f,
+    0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa4, 0x9d, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91,
+    0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x91, 0xb6, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x8e, 0xb2,
+    0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8,
+    0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0,
+    0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x91, 0xa7, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x91, 0x82, 0xe2,
+    0x9c, 0xa1, 0xf0, 0x9f, 0xab, 0xb1, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xab,
+    0xb2, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x99, 0x86, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0xa6,
+    0xb9, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xe2, 0x9c,
+    0x8b, 0xf0, 0x9f, 0x9a, 0xa3, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef,
+    0xb8, 0x8f, 0xf0, 0x9f, 0x87, 0xaa, 0xf0, 0x9f, 0x87, 0xb8, 0xf0, 0x9f, 0x9b, 0x8d, 0xef, 0xb8,
+    0x8f, 0xf0, 0x9f, 0xa7, 0x99, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x91, 0x87, 0xf0, 0x9f, 0x8f,
+    0xbc, 0xf0, 0x9f, 0x8f, 0x8d, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa6, 0xb8, 0xf0, 0x9f, 0x8f, 0xbd,
+    0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xe2, 0x9b, 0xb4, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x92, 0xb8,
+    0xf0, 0x9f, 0x87, 0xb8, 0xf0, 0x9f, 0x87, 0xac, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbb,
+    0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8e, 0x93, 0xf0, 0x9f, 0xaa, 0x97, 0xe2, 0x9e, 0xa1, 0xf0, 0x9f,
+    0xa7, 0x89, 0xf0, 0x9f, 0xa6, 0xb8, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80,
+    0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0x94, 0xac, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6,
+    0xb3, 0xf0, 0x9f, 0xa7, 0x97, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef,
+    0xb8, 0x8f, 0xf0, 0x9f, 0x8f, 0x84, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80,
+    0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0xa4, 0x9d, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x91,
+    0xb1, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x9a, 0xb5, 0xf0,
+    0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0xa4, 0xb7, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa8, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xb0, 0xf0,
+    0x9f, 0x98, 0xb6, 0xf0, 0x9f, 0xa7, 0x91, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa4, 0x9d, 0xe2, 0x80,
+    0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xe2, 0x8f, 0xb2, 0xf0, 0x9f, 0x95, 0xb5, 0xf0, 0x9f, 0x8f, 0xbb,
+    0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x8f, 0x83, 0xf0, 0x9f, 0x8f,
+    0xbf, 0xf0, 0x9f, 0x87, 0xb2, 0xf0, 0x9f, 0x87, 0xbc, 0xe2, 0x8f, 0xaf, 0xf0, 0x9f, 0x87, 0xa7,
+    0xf0, 0x9f, 0x87, 0xbb, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0xa4, 0x9d, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x9c,
+    0x8c, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0xa6, 0xb2, 0x33, 0xef, 0xb8, 0x8f, 0xe2, 0x83, 0xa3, 0xf0, 0x9f, 0xab, 0xb6, 0xf0,
+    0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x92, 0x82, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x82, 0xf0, 0x9f, 0x91, 0x83, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0xa7, 0x91, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0x8e, 0xa4, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0x8e, 0x84, 0xf0, 0x9f, 0x88, 0xb5, 0xf0, 0x9f, 0xa4, 0xb7, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2,
+    0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x97, 0xf0, 0x9f, 0x8f, 0xbf,
+    0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xab, 0x84, 0xf0, 0x9f, 0x8f,
+    0xbb, 0xf0, 0x9f, 0x8c, 0x9f, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d,
+    0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f,
+    0xab, 0xb1, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xab, 0xb2, 0xf0, 0x9f, 0x8f,
+    0xbd, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8e, 0x93,
+    0xf0, 0x9f, 0x91, 0xbd, 0xf0, 0x9f, 0x8f, 0x8a, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x92, 0x87,
+    0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91,
+    0xa8, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x9b, 0xa4, 0xf0, 0x9f, 0x97, 0x93, 0xf0, 0x9f,
+    0x91, 0xb0, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x95, 0xb4,
+    0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x9d,
+    0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0,
+    0x9f, 0xa6, 0xb8, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f,
+    0xf0, 0x9f, 0xaa, 0xb4, 0xf0, 0x9f, 0x98, 0xb6, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8c, 0xab, 0xf0,
+    0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xbd, 0xf0, 0x9f,
+    0x90, 0xa9, 0xf0, 0x9f, 0x91, 0xba, 0xf0, 0x9f, 0x87, 0xa8, 0xf0, 0x9f, 0x87, 0xb2, 0xf0, 0x9f,
+    0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x99, 0xa5, 0xf0, 0x9f, 0x97, 0x83, 0xef, 0xb8,
+    0x8f, 0xf0, 0x9f, 0x91, 0xa8, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xbd, 0xf0, 0x9f, 0xa4, 0xb7,
+    0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x90,
+    0xb7, 0xe2, 0x9c, 0x92, 0xe2, 0x99, 0x8f, 0xf0, 0x9f, 0x87, 0xae, 0xf0, 0x9f, 0x87, 0xa8, 0xf0,
+    0x9f, 0xa4, 0xbe, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f,
+    0xf0, 0x9f, 0x98, 0xb7, 0xf0, 0x9f, 0xa5, 0xba, 0xe2, 0x9e, 0x95, 0xf0, 0x9f, 0x99, 0x8e, 0xf0,
+    0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x9b, 0xa1,
+    0xef, 0xb8, 0x8f, 0xe2, 0x9e, 0x96, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80,
+    0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f,
+    0x8f, 0xbc, 0xf0, 0x9f, 0x8d, 0xb5, 0xf0, 0x9f, 0x9f, 0xa5, 0xf0, 0x9f, 0x9a, 0xb5, 0xf0, 0x9f,
+    0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x98, 0xbc, 0xf0,
+    0x9f, 0x92, 0x81, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x99,
+    0x8c, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d,
+    0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0xa7, 0x98, 0xf0, 0x9f, 0x8f, 0xbe,
+    0xf0, 0x9f, 0xab, 0x85, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x92, 0x81, 0xe2, 0x80, 0x8d, 0xe2,
+    0x99, 0x82, 0xf0, 0x9f, 0xa7, 0x97, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80,
+    0xf0, 0x9f, 0x8f, 0xa2, 0xf0, 0x9f, 0x87, 0xba, 0xf0, 0x9f, 0x87, 0xb3, 0xf0, 0x9f, 0xa7, 0x91,
+    0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xbc, 0xf0, 0x9f, 0xa7, 0x91, 0xf0,
+    0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f,
+    0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0xbb, 0xf0, 0x9f, 0xa7,
+    0x91, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0xbb, 0xf0, 0x9f, 0x98, 0xaa,
+    0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80,
+    0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbc,
+    0xe2, 0x9b, 0xb5, 0xf0, 0x9f, 0x87, 0xbd, 0xf0, 0x9f, 0x87, 0xb0, 0xf0, 0x9f, 0xa4, 0xa6, 0xf0,
+    0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xb3,
+    0xf0, 0x9f, 0x92, 0xaa, 0xf0, 0x9f, 0x8f, 0x8a, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2,
+    0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d,
+    0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f,
+    0xbb, 0xf0, 0x9f, 0x98, 0xb6, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8c, 0xab, 0xef, 0xb8, 0x8f, 0xf0,
+    0x9f, 0xa4, 0xb5, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xe2, 0x9d, 0xa4, 0xef,
+    0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa9, 0xb9, 0xf0, 0x9f, 0xa4, 0xb5, 0xf0, 0x9f, 0x8f,
+    0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x98, 0xf0, 0x9f,
+    0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x92, 0x8f, 0xf0,
+    0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x99, 0x8d, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x82, 0xf0, 0x9f, 0xa4, 0xa6, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f,
+    0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x9a, 0x92, 0xf0, 0x9f, 0x92,
+    0x86, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x87, 0xa7, 0xf0,
+    0x9f, 0x87, 0xb7, 0xe2, 0x9c, 0x8a, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f,
+    0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0xa6,
+    0xb8, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0xa6, 0x8f, 0xf0,
+    0x9f, 0x92, 0x86, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x91, 0x89, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0,
+    0x9f, 0x90, 0x9d, 0xf0, 0x9f, 0x99, 0x86, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x80, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef,
+    0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x91,
+    0xb2, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2,
+    0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f,
+    0xbf, 0xf0, 0x9f, 0x91, 0xb5, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x8f, 0x8c, 0xf0, 0x9f, 0x8f,
+    0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f,
+    0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0xa7,
+    0x91, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xaf, 0xf0, 0x9f, 0x91, 0xb0, 0xf0, 0x9f, 0x8f, 0xbb,
+    0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x8f, 0x83, 0xf0, 0x9f, 0x8f,
+    0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x90, 0xad, 0xf0, 0x9f,
+    0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xb0, 0xf0, 0x9f, 0xa6,
+    0xb9, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f,
+    0x97, 0x9d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4,
+    0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f,
+    0x8f, 0xbc, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x9c, 0x88,
+    0xef, 0xb8, 0x8f, 0xe3, 0x8a, 0x97, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f,
+    0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80,
+    0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f,
+    0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92,
+    0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x88, 0xb6,
+    0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xb3, 0xf0,
+    0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f,
+    0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x91, 0xa9, 0xf0,
+    0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xb1, 0xf0, 0x9f, 0xa6, 0x83, 0xf0, 0x9f,
+    0x8d, 0x8f, 0xf0, 0x9f, 0x99, 0x86, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80,
+    0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x9d,
+    0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80,
+    0x8d, 0xf0, 0x9f, 0xa4, 0x9d, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbe,
+    0xf0, 0x9f, 0xa7, 0x91, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x94, 0xac, 0xf0, 0x9f, 0x91, 0xa9, 0xf0,
+    0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x9a, 0x80, 0xf0, 0x9f, 0x92, 0x86, 0xf0, 0x9f,
+    0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa9, 0xf0,
+    0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b,
+    0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x87, 0xae, 0xf0,
+    0x9f, 0x87, 0xb7, 0xe2, 0x99, 0xa0, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa6, 0xb9, 0xf0, 0x9f, 0x8f,
+    0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x87, 0xb8, 0xf0, 0x9f,
+    0x87, 0xa7, 0xf0, 0x9f, 0x97, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0x9c, 0xf0, 0x9f, 0x8c,
+    0x8d, 0xf0, 0x9f, 0x9a, 0xa8, 0xe2, 0x9d, 0x94, 0xf0, 0x9f, 0x91, 0x82, 0xf0, 0x9f, 0x8f, 0xbc,
+    0xf0, 0x9f, 0xa7, 0x8d, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f,
+    0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa4, 0x9d, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8,
+    0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x98, 0xaf, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe,
+    0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0xa4, 0xb7, 0xf0, 0x9f, 0x8f, 0xbc,
+    0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xe2, 0x8f, 0xad, 0xf0, 0x9f, 0x9a, 0xb9,
+    0xf0, 0x9f, 0x9b, 0x8c, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x87, 0xb2, 0xf0, 0x9f, 0x87, 0xb8,
+    0xf0, 0x9f, 0x99, 0x8b, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f,
+    0x91, 0xae, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0,
+    0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa7, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91,
+    0xa6, 0xf0, 0x9f, 0x9b, 0x97, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d,
+    0xe2, 0x9a, 0x96, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa6, 0xa1, 0xf0, 0x9f, 0xa7, 0x8e, 0xe2, 0x9a,
+    0xb0, 0xf0, 0x9f, 0x8e, 0xbd, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d,
+    0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f,
+    0xbc, 0xe2, 0x98, 0x91, 0xf0, 0x9f, 0xa4, 0xb8, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x91, 0xad,
+    0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x9a, 0xb1, 0xf0, 0x9f, 0x8f, 0xac, 0xf0, 0x9f, 0x91, 0xa8,
+    0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0,
+    0x9f, 0x8d, 0xa1, 0xf0, 0x9f, 0xa7, 0x97, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x91,
+    0xb0, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x91, 0x95, 0xf0,
+    0x9f, 0x92, 0xa8, 0xf0, 0x9f, 0xa6, 0xa6, 0xf0, 0x9f, 0x9a, 0xa3, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2,
+    0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x99, 0x8b, 0xf0, 0x9f, 0x8f, 0xbb,
+    0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80,
+    0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f,
+    0x8f, 0xbd, 0xf0, 0x9f, 0x91, 0xaf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0,
+    0x9f, 0x87, 0xac, 0xf0, 0x9f, 0x87, 0xb8, 0xf0, 0x9f, 0xa7, 0x94, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x80, 0xf0, 0x9f, 0x87, 0xae, 0xf0, 0x9f, 0x87, 0xb8, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f,
+    0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x9c, 0x88, 0xf0, 0x9f, 0x83, 0x8f, 0xf0, 0x9f, 0x8f, 0x84, 0xf0,
+    0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x87, 0xa9, 0xf0, 0x9f, 0x87, 0xaa, 0xf0, 0x9f, 0x8f, 0x87, 0xf0,
+    0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0xa4, 0xb1, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x92, 0x81, 0xf0,
+    0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xe2, 0x98, 0x8e, 0xef,
+    0xb8, 0x8f, 0xf0, 0x9f, 0x95, 0xb6, 0xf0, 0x9f, 0x8f, 0x84, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82,
+    0xf0, 0x9f, 0x93, 0xb4, 0xf0, 0x9f, 0x98, 0x9b, 0xf0, 0x9f, 0x8e, 0x97, 0xef, 0xb8, 0x8f, 0xf0,
+    0x9f, 0xa7, 0xa9, 0xf0, 0x9f, 0x94, 0xae, 0xf0, 0x9f, 0x9a, 0x99, 0xf0, 0x9f, 0xa7, 0x8e, 0xf0,
+    0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x9a, 0xb6,
+    0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0xa7, 0x96, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x9b,
+    0x8f, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x99, 0x87, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x9a, 0x9b, 0xef,
+    0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xb7, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0,
+    0x9f, 0x8d, 0x8a, 0xf0, 0x9f, 0x9a, 0xa3, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x82, 0xf0, 0x9f, 0xa4, 0xb9, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0,
+    0x9f, 0xa5, 0xaa, 0xf0, 0x9f, 0xa4, 0xb9, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0xa7, 0xa4, 0xf0,
+    0x9f, 0xab, 0xa5, 0xf0, 0x9f, 0x9b, 0x83, 0xf0, 0x9f, 0x91, 0x83, 0xf0, 0x9f, 0xa7, 0x9b, 0xf0,
+    0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x8f, 0x8e, 0xef, 0xb8, 0x8f,
+    0xe2, 0x9a, 0x97, 0xf0, 0x9f, 0x8c, 0xa9, 0xe2, 0x9c, 0xb3, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f,
+    0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0,
+    0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0x8d, 0xb3, 0xf0, 0x9f, 0x8f, 0x84, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80,
+    0xf0, 0x9f, 0x99, 0x87, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f,
+    0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xb0, 0xf0, 0x9f, 0x8e,
+    0xb4, 0xf0, 0x9f, 0xa7, 0x8b, 0xf0, 0x9f, 0x8f, 0x9a, 0xf0, 0x9f, 0x94, 0xb5, 0xf0, 0x9f, 0x92,
+    0x86, 0xe2, 0x96, 0xab, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2,
+    0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91,
+    0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x92, 0x86, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2,
+    0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa8, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x9a, 0x92,
+    0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x9a, 0x95, 0xef, 0xb8,
+    0x8f, 0xf0, 0x9f, 0x8f, 0x8b, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef,
+    0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x9d, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82,
+    0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x92, 0x86, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x8d, 0x89, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x87, 0xb5,
+    0xf0, 0x9f, 0x87, 0xb7, 0xf0, 0x9f, 0xa7, 0x9a, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2,
+    0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x8e, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d,
+    0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x86, 0x94, 0xf0, 0x9f, 0x91, 0xad, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0,
+    0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f,
+    0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f,
+    0x8f, 0xbc, 0xf0, 0x9f, 0xaa, 0x95, 0xf0, 0x9f, 0x91, 0xb8, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f,
+    0x95, 0xb5, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0xa4, 0xbd, 0xf0, 0x9f, 0x8f, 0xbd,
+    0xf0, 0x9f, 0x9a, 0xb5, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0xa4, 0x9f, 0xf0, 0x9f, 0x8f, 0xbb,
+    0xf0, 0x9f, 0x98, 0xa3, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2,
+    0x9a, 0x95, 0xf0, 0x9f, 0x8f, 0x8b, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x9c, 0x8d, 0xf0, 0x9f, 0x8f,
+    0xbe, 0xf0, 0x9f, 0xaa, 0xa6, 0xf0, 0x9f, 0x92, 0x82, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d,
+    0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x9b, 0x8e, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91,
+    0xa9, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x98, 0x99, 0xf0, 0x9f, 0xa7, 0x8c, 0xf0, 0x9f,
+    0xa7, 0xbc, 0xf0, 0x9f, 0x87, 0xb1, 0xf0, 0x9f, 0x87, 0xa6, 0xf0, 0x9f, 0xab, 0xa6, 0xf0, 0x9f,
+    0x87, 0xb0, 0xf0, 0x9f, 0x87, 0xad, 0xf0, 0x9f, 0x8f, 0x9d, 0xf0, 0x9f, 0x91, 0xb7, 0xf0, 0x9f,
+    0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x99, 0x87, 0xf0,
+    0x9f, 0x92, 0x86, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x8c,
+    0xb8, 0xf0, 0x9f, 0xa7, 0x8d, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef,
+    0xb8, 0x8f, 0xf0, 0x9f, 0x9a, 0xb6, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82,
+    0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x9b, 0xba, 0xf0, 0x9f, 0xa7, 0x91, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0x8d, 0xbc, 0xf0, 0x9f, 0xa7, 0x8f, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0xa4, 0xb9, 0xf0, 0x9f,
+    0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x9b, 0xb3, 0xf0,
+    0x9f, 0xa7, 0x8d, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0xa7,
+    0x91, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80,
+    0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbe,
+    0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8,
+    0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x91, 0x8d,
+    0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x87, 0xb1, 0xf0, 0x9f, 0x87, 0xb8, 0xf0, 0x9f, 0xa7, 0x9b,
+    0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x93,
+    0xa8, 0xf0, 0x9f, 0xa7, 0x9b, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f,
+    0xbc, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8e, 0xa8, 0xf0, 0x9f, 0x8f, 0x96, 0xef, 0xb8, 0x8f, 0xf0,
+    0x9f, 0x91, 0xb3, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f,
+    0xf0, 0x9f, 0x8e, 0xbb, 0xf0, 0x9f, 0x91, 0xb7, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2,
+    0x99, 0x80, 0xf0, 0x9f, 0xa6, 0x85, 0xf0, 0x9f, 0x99, 0x8d, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80,
+    0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x9b, 0xa9, 0xf0, 0x9f, 0x8f, 0xb5, 0xf0, 0x9f, 0x92, 0x82,
+    0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x9a, 0x98, 0xf0, 0x9f,
+    0x92, 0x86, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x87, 0xa7,
+    0xf0, 0x9f, 0x87, 0xa9, 0xf0, 0x9f, 0x85, 0xbf, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xaa, 0x80, 0xf0,
+    0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8f, 0xad, 0xf0, 0x9f,
+    0x99, 0x8e, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0,
+    0x9f, 0xa6, 0xa0, 0xf0, 0x9f, 0x87, 0xb2, 0xf0, 0x9f, 0x87, 0xa9, 0xf0, 0x9f, 0xa7, 0x8d, 0xf0,
+    0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x98, 0xa0,
+    0xf0, 0x9f, 0x97, 0xbb, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0xa6, 0xbd, 0xf0, 0x9f, 0x9a, 0xa3, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xe2, 0x8f, 0xb8,
+    0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0x9a, 0x80, 0xf0, 0x9f, 0x8f, 0x8b, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80,
+    0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f,
+    0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2,
+    0x80, 0x8d, 0xf0, 0x9f, 0x9a, 0x80, 0xf0, 0x9f, 0x92, 0x83, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f,
+    0x87, 0xa8, 0xf0, 0x9f, 0x87, 0xa6, 0xf0, 0x9f, 0xa7, 0x98, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80,
+    0xf0, 0x9f, 0xa4, 0xa9, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0x92, 0xbb, 0xe2, 0x96, 0xab, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x90, 0xa8, 0xf0, 0x9f, 0xa7,
+    0x91, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xb1, 0xf0, 0x9f, 0x90, 0xac,
+    0xf0, 0x9f, 0x99, 0x8e, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f,
+    0x87, 0xb7, 0xf0, 0x9f, 0x87, 0xb4, 0xf0, 0x9f, 0x99, 0x8d, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80,
+    0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x99, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0,
+    0x9f, 0x98, 0x85, 0xf0, 0x9f, 0x92, 0x91, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x93, 0x99, 0xf0,
+    0x9f, 0x8f, 0xab, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x9d,
+    0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0,
+    0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x9c,
+    0x88, 0xf0, 0x9f, 0x91, 0xb3, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef,
+    0xb8, 0x8f, 0xf0, 0x9f, 0x98, 0xae, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0xa8, 0xf0, 0x9f, 0xa4,
+    0x9c, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x90, 0xb5, 0xf0, 0x9f, 0x87, 0xaa, 0xf0, 0x9f, 0x87,
+    0xa6, 0xf0, 0x9f, 0xa4, 0xb8, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xe2,
+    0x9c, 0x8d, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80,
+    0x8d, 0xf0, 0x9f, 0x8e, 0xa8, 0xf0, 0x9f, 0x91, 0xb0, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef,
+    0xb8, 0x8f, 0xf0, 0x9f, 0x8f, 0xb4, 0xf3, 0xa0, 0x81, 0xa7, 0xf3, 0xa0, 0x81, 0xa2, 0xf3, 0xa0,
+    0x81, 0xb7, 0xf3, 0xa0, 0x81, 0xac, 0xf3, 0xa0, 0x81, 0xb3, 0xf3, 0xa0, 0x81, 0xbf, 0xf0, 0x9f,
+    0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x8c, 0xad, 0xf0, 0x9f, 0x92, 0xaa, 0xf0,
+    0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x96, 0x90, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80,
+    0x8d, 0xf0, 0x9f, 0x8d, 0xbc, 0xf0, 0x9f, 0xa7, 0x94, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d,
+    0xe2, 0x99, 0x80, 0xf0, 0x9f, 0xa7, 0x82, 0xf0, 0x9f, 0x87, 0xa8, 0xf0, 0x9f, 0x87, 0xb7, 0xf0,
+    0x9f, 0x9a, 0xaf, 0xf0, 0x9f, 0x95, 0xba, 0xf0, 0x9f, 0x98, 0x84, 0xe2, 0x99, 0x9f, 0xf0, 0x9f,
+    0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xe2, 0x9c, 0x88, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x87, 0xb9, 0xf0,
+    0x9f, 0x87, 0xa9, 0xe2, 0x98, 0x95, 0xf0, 0x9f, 0xa6, 0x9c, 0xf0, 0x9f, 0x9a, 0xb6, 0xe2, 0x80,
+    0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x94, 0x96, 0xf0, 0x9f, 0x91, 0xa9, 0xf0,
+    0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x9a, 0x96, 0xf0, 0x9f, 0xa4, 0xbf, 0xf0, 0x9f, 0x92,
+    0xaa, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0xa6, 0xb0, 0xe2, 0x99, 0x9f, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x8f, 0xb5, 0xef, 0xb8,
+    0x8f, 0xf0, 0x9f, 0xa7, 0x99, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0,
+    0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0,
+    0x9f, 0x91, 0x89, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x92, 0x86, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2,
+    0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d,
+    0xe2, 0x9c, 0x88, 0xf0, 0x9f, 0xa7, 0x9a, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x82, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x9a, 0x96, 0xef,
+    0xb8, 0x8f, 0xf0, 0x9f, 0xa6, 0xb8, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80,
+    0xf0, 0x9f, 0x90, 0x9e, 0xe2, 0x97, 0xbe, 0xf0, 0x9f, 0x92, 0x9c, 0xf0, 0x9f, 0xa7, 0x93, 0xf0,
+    0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x9a, 0xab, 0xf0, 0x9f, 0x96, 0x90, 0xf0, 0x9f, 0xa7, 0x91, 0xf0,
+    0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0xa7, 0x8d, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f,
+    0xf0, 0x9f, 0x87, 0xb8, 0xf0, 0x9f, 0x87, 0xb4, 0xf0, 0x9f, 0x91, 0xb3, 0xf0, 0x9f, 0x8f, 0xbc,
+    0xf0, 0x9f, 0x91, 0xae, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f,
+    0xa7, 0x9d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x94,
+    0xac, 0xf0, 0x9f, 0x93, 0x95, 0xf0, 0x9f, 0xa4, 0x9d, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0xa4,
+    0xb5, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f,
+    0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xbc, 0xf0, 0x9f, 0xa6,
+    0xae, 0xf0, 0x9f, 0x99, 0x8b, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x9a, 0xb5, 0xf0, 0x9f, 0x8f,
+    0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x9a, 0xb3, 0xf0, 0x9f, 0x95, 0xb5, 0xf0,
+    0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x87, 0xb2,
+    0xf0, 0x9f, 0x87, 0xaa, 0xf0, 0x9f, 0x87, 0xb3, 0xf0, 0x9f, 0x87, 0xb1, 0xf0, 0x9f, 0x9a, 0xb4,
+    0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x8d,
+    0xb7, 0xf0, 0x9f, 0x91, 0xa8, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0x91, 0xa7, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa7, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f,
+    0x99, 0x8d, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0,
+    0x9f, 0xa7, 0x9d, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xab, 0xb1,
+    0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xab, 0xb2, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0,
+    0x9f, 0xa5, 0xbf, 0xf0, 0x9f, 0x87, 0xb9, 0xf0, 0x9f, 0x87, 0xaf, 0xf0, 0x9f, 0x8e, 0xaa, 0xf0,
+    0x9f, 0x9a, 0xb6, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f,
+    0xf0, 0x9f, 0x8f, 0x89, 0xe2, 0x9b, 0xb9, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa5, 0xb0, 0xf0, 0x9f, 0x86, 0x9a, 0xf0, 0x9f, 0x94, 0x8b,
+    0xf0, 0x9f, 0x91, 0xb0, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8,
+    0x8f, 0xf0, 0x9f, 0x8f, 0x8a, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0,
+    0x9f, 0x92, 0x86, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xe2, 0x98, 0xb9, 0xef, 0xb8, 0x8f, 0xf0,
+    0x9f, 0x99, 0x8f, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x91, 0xb3, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2,
+    0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x92, 0x91, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0xa5,
+    0x8f, 0xf0, 0x9f, 0x91, 0xbc, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d,
+    0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x9c, 0x8a, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0,
+    0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0xa7, 0x9d, 0xf0, 0x9f, 0x8f, 0xbf,
+    0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xab, 0x85, 0xf0, 0x9f, 0x8f,
+    0xbc, 0xf0, 0x9f, 0x91, 0x83, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f,
+    0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80,
+    0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0xa7, 0x9a, 0xf0, 0x9f, 0x8f,
+    0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa4, 0x9a, 0xf0, 0x9f,
+    0x8f, 0xbd, 0xf0, 0x9f, 0x8f, 0x90, 0xf0, 0x9f, 0x8f, 0x8b, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f,
+    0x91, 0xb3, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x8f, 0x8a, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80,
+    0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa4, 0xae, 0xf0, 0x9f, 0x87, 0xae, 0xf0,
+    0x9f, 0x87, 0xaa, 0xf0, 0x9f, 0xa4, 0x9d, 0xf0, 0x9f, 0x98, 0x8e, 0xf0, 0x9f, 0x94, 0xb9, 0xf0,
+    0x9f, 0xa4, 0x98, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0xa4, 0x9d, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x91,
+    0xa8, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa6, 0xe2,
+    0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa6, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80,
+    0x8d, 0xf0, 0x9f, 0x9a, 0x92, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d,
+    0xe2, 0x9a, 0x95, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x9c, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80,
+    0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x99, 0x8e, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2,
+    0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa4, 0xb9, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d,
+    0xe2, 0x99, 0x80, 0xf0, 0x9f, 0xa4, 0xb7, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xab, 0xb0, 0xf0, 0x9f, 0x92, 0x86, 0xf0, 0x9f, 0x8f, 0xbd,
+    0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x91, 0xb7, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80,
+    0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xb1, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x99, 0x85, 0xf0,
+    0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0xa7, 0x9b, 0xf0, 0x9f, 0x8f,
+    0xbc, 0xf0, 0x9f, 0x8e, 0xbe, 0xf0, 0x9f, 0x97, 0xba, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x9a, 0xb5,
+    0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7,
+    0x9d, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x8f, 0x84, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0,
+    0x9f, 0x8f, 0x8a, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f,
+    0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8,
+    0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x91, 0xa9,
+    0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92,
+    0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0xa6, 0xb6,
+    0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x8f, 0x83, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x9a, 0xb5,
+    0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0xa7, 0x97, 0xf0, 0x9f,
+    0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x8f, 0x83, 0xf0,
+    0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa9,
+    0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xb1, 0xe2, 0xad, 0x90, 0xf0, 0x9f,
+    0x8e, 0x8a, 0xf0, 0x9f, 0x8f, 0x8c, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82,
+    0xf0, 0x9f, 0xa7, 0x9c, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x90, 0x9a, 0xf0, 0x9f,
+    0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2,
+    0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f,
+    0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0xaa, 0xb1, 0xf0, 0x9f, 0x91, 0x89, 0xf0, 0x9f,
+    0x8f, 0xbc, 0xf0, 0x9f, 0x92, 0x81, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80,
+    0xf0, 0x9f, 0xab, 0xb5, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbc,
+    0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9,
+    0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0xa7, 0x9c, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8,
+    0x8f, 0xf0, 0x9f, 0x91, 0x86, 0xf0, 0x9f, 0xa7, 0x96, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d,
+    0xe2, 0x99, 0x82, 0xe2, 0x9b, 0x8e, 0xf0, 0x9f, 0xa5, 0xae, 0xf0, 0x9f, 0xa4, 0xa3, 0xf0, 0x9f,
+    0x91, 0xb7, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbd,
+    0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x86, 0x91, 0xf0, 0x9f, 0xab, 0xb1,
+    0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xab, 0xb2, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0,
+    0x9f, 0x87, 0xac, 0xf0, 0x9f, 0x87, 0xb3, 0xf0, 0x9f, 0x95, 0x9d, 0xf0, 0x9f, 0x8e, 0x8b, 0xf0,
+    0x9f, 0x87, 0xb6, 0xf0, 0x9f, 0x87, 0xa6, 0xf0, 0x9f, 0xa7, 0x97, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2,
+    0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x8d, 0x83, 0xf0, 0x9f, 0x8f, 0x83,
+    0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x9a, 0x95, 0xf0, 0x9f,
+    0x95, 0xb4, 0xf0, 0x9f, 0x8f, 0x87, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f,
+    0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa4, 0x9d, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8,
+    0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0x8e, 0xa8, 0xf0, 0x9f, 0x91, 0xb1, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x99, 0x85, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2,
+    0x99, 0x80, 0xe2, 0x9b, 0xb9, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0,
+    0x9f, 0x92, 0xa0, 0xf0, 0x9f, 0x99, 0x8e, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x92, 0xa1, 0xf0, 0x9f, 0xa7, 0x99, 0xf0, 0x9f, 0x8f, 0xbb,
+    0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80,
+    0x8d, 0xf0, 0x9f, 0xa4, 0x9d, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbb,
+    0xf0, 0x9f, 0x90, 0x83, 0xf0, 0x9f, 0xa6, 0xbe, 0xf0, 0x9f, 0x94, 0x8c, 0xf0, 0x9f, 0xa4, 0xb3,
+    0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2,
+    0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0xa4,
+    0xbd, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x93, 0xab, 0xf0,
+    0x9f, 0x93, 0x90, 0xf0, 0x9f, 0xa7, 0x97, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x82, 0xf0, 0x9f, 0x9a, 0xa4, 0xf0, 0x9f, 0x92, 0x81, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d,
+    0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x8f, 0x8b, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80,
+    0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2,
+    0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x91,
+    0xa9, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x9a, 0x80, 0xf0, 0x9f, 0x91, 0xa8,
+    0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xaf, 0xf0, 0x9f, 0x91, 0xa9, 0xf0,
+    0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8,
+    0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2,
+    0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x9a,
+    0xb5, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x91, 0xa8, 0xf0,
+    0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xaf, 0xf0, 0x9f, 0xa4, 0xb7, 0xf0, 0x9f,
+    0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x91, 0x8d, 0xf0, 0x9f, 0x8f, 0xbc,
+    0xf0, 0x9f, 0xa7, 0x96, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x87, 0xad, 0xf0, 0x9f,
+    0x87, 0xb0, 0xf0, 0x9f, 0xa7, 0x97, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82,
+    0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x94, 0x95, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2,
+    0x80, 0x8d, 0xf0, 0x9f, 0x8d, 0xb3, 0xf0, 0x9f, 0x8e, 0xa4, 0xf0, 0x9f, 0xa7, 0x99, 0xe2, 0x80,
+    0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x8c, 0xb0, 0xf0, 0x9f, 0x91, 0xb9, 0xf0,
+    0x9f, 0x9a, 0x9d, 0xf0, 0x9f, 0x8f, 0x83, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x82, 0xf0, 0x9f, 0x8f, 0x8c, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0,
+    0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f,
+    0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x8f, 0x8b, 0xf0,
+    0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0xa4, 0xbc, 0xe2, 0x80, 0x8d,
+    0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x8f, 0x83, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80,
+    0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2,
+    0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2,
+    0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x94, 0x92, 0xf0, 0x9f,
+    0x99, 0x8e, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xe2, 0x9c, 0x8c, 0xf0,
+    0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0xa6, 0xbd, 0xf0, 0x9f, 0x8d, 0x88, 0xf0, 0x9f, 0x9a, 0xb6, 0xf0,
+    0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x8f, 0x8c,
+    0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0x89,
+    0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x99, 0x85, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x91, 0xa9,
+    0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91,
+    0xa9, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0x8f, 0xad, 0xf0, 0x9f, 0xa7, 0x8f, 0xf0, 0x9f, 0xa7, 0x96, 0xf0, 0x9f, 0x8f, 0xbc,
+    0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x9b, 0xe2, 0x80, 0x8d,
+    0xe2, 0x99, 0x80, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0x94, 0xac, 0xe2, 0x8f, 0xba, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d,
+    0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f,
+    0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2,
+    0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x95, 0xb5, 0xef, 0xb8,
+    0x8f, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f,
+    0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8f, 0xad, 0xf0, 0x9f, 0xa5, 0x91, 0xf0, 0x9f, 0x8f,
+    0x8e, 0xf0, 0x9f, 0xa7, 0x8f, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x8f, 0x84, 0xf0,
+    0x9f, 0x99, 0x85, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f,
+    0xf0, 0x9f, 0x99, 0x86, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f,
+    0xa7, 0x8e, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92,
+    0xbc, 0xf0, 0x9f, 0x9a, 0xa3, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef,
+    0xb8, 0x8f, 0xf0, 0x9f, 0x97, 0x93, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x87, 0xab, 0xf0, 0x9f, 0x87,
+    0xb4, 0xf0, 0x9f, 0xa4, 0x9f, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0xa7, 0x9a, 0xf0, 0x9f, 0x8f,
+    0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x8f, 0x8a, 0xf0, 0x9f,
+    0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x99, 0x87, 0xe2, 0x80, 0x8d, 0xe2,
+    0x99, 0x82, 0xf0, 0x9f, 0x92, 0x87, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80,
+    0xf0, 0x9f, 0x93, 0xbd, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x87, 0xb3, 0xf0, 0x9f, 0x87, 0xaa, 0xf0,
+    0x9f, 0xa7, 0x9d, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f,
+    0xf0, 0x9f, 0x92, 0xaa, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x97, 0x9c, 0xef, 0xb8, 0x8f, 0xf0,
+    0x9f, 0x8c, 0x80, 0xf0, 0x9f, 0x96, 0xa8, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x95, 0xb6, 0xef, 0xb8,
+    0x8f, 0xe2, 0x9a, 0xa0, 0xf0, 0x9f, 0xab, 0x83, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0xa7, 0x99,
+    0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91,
+    0xa8, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x98, 0xa0, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f,
+    0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91,
+    0xa8, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d,
+    0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91,
+    0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x98, 0x9d, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x9b, 0xab,
+    0xf0, 0x9f, 0x98, 0xa9, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2,
+    0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x8c, 0xa8, 0xf0, 0x9f, 0x91, 0xa8, 0xf0,
+    0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xbd, 0xe2, 0x9c, 0x88, 0xef, 0xb8, 0x8f,
+    0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8,
+    0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x8c, 0x83,
+    0xf0, 0x9f, 0x90, 0x8e, 0xf0, 0x9f, 0xa6, 0xaf, 0xf0, 0x9f, 0x9b, 0xa0, 0xef, 0xb8, 0x8f, 0xf0,
+    0x9f, 0xa7, 0x9e, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x91, 0x8b, 0xf0, 0x9f, 0x8f,
+    0xbf, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f,
+    0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f,
+    0x8f, 0xbd, 0xf0, 0x9f, 0xa7, 0x98, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80,
+    0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x99, 0x8b, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x80, 0xf0, 0x9f, 0x8f, 0x83, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x91,
+    0xae, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f,
+    0xa7, 0x9a, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0xa4, 0x9e,
+    0xf0, 0x9f, 0x8e, 0x85, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x86, 0xa9, 0xf0, 0x9f, 0x9a, 0xb5, 0xe2,
+    0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x95, 0x98, 0xf0, 0x9f, 0x91, 0xa8,
+    0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa4, 0x9d, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x8f, 0x8b, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d,
+    0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x9a, 0xb5, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f,
+    0xa7, 0x93, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0xa4, 0xbd, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80,
+    0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x9a, 0xb4, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2,
+    0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0xa4, 0xb1, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x91,
+    0xa8, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xb2, 0xf0, 0x9f, 0x8f, 0x8b,
+    0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x8f, 0x84, 0xf0, 0x9f,
+    0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x8d, 0xb3, 0xf0, 0x9f, 0x87, 0xab,
+    0xf0, 0x9f, 0x87, 0xae, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2,
+    0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbc,
+    0xf0, 0x9f, 0x95, 0xb5, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8,
+    0x8f, 0xf0, 0x9f, 0x8f, 0x82, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f,
+    0xbe, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x94, 0xa7, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbe,
+    0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0xa7, 0x93, 0xf0, 0x9f, 0x8f, 0xbf,
+    0xf0, 0x9f, 0x8c, 0xbd, 0xf0, 0x9f, 0xaa, 0x98, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbd,
+    0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f,
+    0xbb, 0xf0, 0x9f, 0x9b, 0x95, 0xf0, 0x9f, 0x95, 0xb4, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x91,
+    0xb7, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d,
+    0xe2, 0x9c, 0x88, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xb6, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f,
+    0xa4, 0xb9, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80,
+    0x8d, 0xf0, 0x9f, 0x94, 0xac, 0xf0, 0x9f, 0x94, 0x80, 0xf0, 0x9f, 0x9a, 0xb5, 0xf0, 0x9f, 0x8f,
+    0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x90, 0x93, 0xf0, 0x9f, 0x92, 0xbd, 0xf0,
+    0x9f, 0x8d, 0xa3, 0xf0, 0x9f, 0x87, 0xb0, 0xf0, 0x9f, 0x87, 0xac, 0xf0, 0x9f, 0x91, 0xa8, 0xf0,
+    0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f,
+    0x8c, 0x8f, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4,
+    0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f,
+    0x8f, 0xbc, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4,
+    0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f,
+    0x8f, 0xbc, 0xf0, 0x9f, 0x87, 0xa7, 0xf0, 0x9f, 0x87, 0xb9, 0xf0, 0x9f, 0xa6, 0xa4, 0xf0, 0x9f,
+    0x87, 0xb7, 0xf0, 0x9f, 0x87, 0xaa, 0xf0, 0x9f, 0xa7, 0x99, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80,
+    0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xaa, 0x91, 0xf0, 0x9f, 0x91, 0xb8, 0xe2,
+    0x86, 0x98, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x93, 0x86, 0xf0, 0x9f, 0x91, 0xb0, 0xf0, 0x9f, 0x8f,
+    0xbc, 0xf0, 0x9f, 0x96, 0x8a, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xb9, 0xf0, 0x9f, 0xa4,
+    0x97, 0xf0, 0x9f, 0xa7, 0x98, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef,
+    0xb8, 0x8f, 0xf0, 0x9f, 0xaa, 0x84, 0xf0, 0x9f, 0x8d, 0xb8, 0xf0, 0x9f, 0xa4, 0xa2, 0xe2, 0x9a,
+    0x94, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x8f, 0x8a, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x91, 0x8f,
+    0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x95, 0x8d, 0xf0, 0x9f, 0xa4, 0xb0, 0xf0, 0x9f, 0x8f, 0xbf,
+    0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xb3, 0xf0,
+    0x9f, 0x8f, 0x8a, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f,
+    0xf0, 0x9f, 0x91, 0xa3, 0xf0, 0x9f, 0xa4, 0x8f, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0xa4, 0xbe,
+    0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xab,
+    0xb2, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x8f, 0xb2, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x8f, 0x83, 0xe2,
+    0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x87, 0xa7, 0xf0, 0x9f, 0x87, 0xb4,
+    0xf0, 0x9f, 0xa7, 0x83, 0xf0, 0x9f, 0x9b, 0x80, 0xf0, 0x9f, 0xa4, 0xb2, 0xf0, 0x9f, 0x8f, 0xbd,
+    0xf0, 0x9f, 0x8c, 0x8c, 0xf0, 0x9f, 0xa7, 0x95, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x91, 0xa9,
+    0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x92, 0x87, 0xf0, 0x9f, 0x8f, 0xbd,
+    0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa4, 0xa6, 0xf0, 0x9f, 0x8f,
+    0xbb, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2,
+    0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x90, 0x9c, 0xf0, 0x9f,
+    0xa7, 0x9a, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xe2, 0x96, 0xaa, 0xf0, 0x9f, 0xa7, 0x8f, 0xf0,
+    0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x9a, 0xbe,
+    0xf0, 0x9f, 0x92, 0xb0, 0xf0, 0x9f, 0xab, 0xb5, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0xa7, 0x98,
+    0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x99,
+    0x87, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x87, 0xb8, 0xf0,
+    0x9f, 0x87, 0xaa, 0xf0, 0x9f, 0xa4, 0x9e, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0xa6, 0x91, 0xf0,
+    0x9f, 0x8f, 0x8a, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0xa7,
+    0x94, 0xf0, 0x9f, 0x91, 0xa8, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8e, 0xa8, 0xf0, 0x9f, 0xa7, 0x91,
+    0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8c, 0xbe, 0xf0, 0x9f, 0xab, 0xb1, 0xf0,
+    0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xab, 0xb2, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f,
+    0xa6, 0x8d, 0xf0, 0x9f, 0x99, 0x8b, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0,
+    0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xb2, 0xf0, 0x9f,
+    0x87, 0xbb, 0xf0, 0x9f, 0x87, 0xa6, 0xf0, 0x9f, 0xa5, 0xb7, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x9d,
+    0xa3, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x8c, 0x87, 0xf0, 0x9f, 0x8d, 0x92, 0xf0, 0x9f, 0xa7, 0x98,
+    0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0xa7, 0x9c, 0xf0, 0x9f,
+    0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0xa7, 0x90, 0xf0, 0x9f, 0x91, 0xa8,
+    0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91,
+    0xa8, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0xa7, 0x9e, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef,
+    0xb8, 0x8f, 0xf0, 0x9f, 0x92, 0x86, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82,
+    0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x9c,
+    0x88, 0xf0, 0x9f, 0x91, 0xa8, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xaf, 0xf0, 0x9f, 0xa4, 0x99,
+    0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0xa7, 0x9c, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x86, 0xaa, 0xf0,
+    0x9f, 0xa7, 0x94, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x9a,
+    0x92, 0xf0, 0x9f, 0xab, 0xb1, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f,
+    0xbb, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8f, 0xab, 0xf0, 0x9f, 0x90, 0x91, 0xf0, 0x9f, 0x91, 0xae,
+    0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x8c, 0xa1, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa6, 0x84, 0xf0,
+    0x9f, 0xab, 0xb4, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0xa7, 0x9d, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2,
+    0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0xa4, 0x9d, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0,
+    0x9f, 0x8e, 0x85, 0xe2, 0x99, 0xbe, 0xe2, 0x9b, 0xb9, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x95,
+    0x9c, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8e, 0xa4,
+    0x30, 0xef, 0xb8, 0x8f, 0xe2, 0x83, 0xa3, 0xf0, 0x9f, 0xa4, 0xbd, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2,
+    0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0xa7, 0x97, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d,
+    0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x9a, 0x90, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2,
+    0x80, 0x8d, 0xe2, 0x9a, 0x96, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbc,
+    0xe2, 0x80, 0x8d, 0xe2, 0x9a, 0x96, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x96, 0xe2, 0x80, 0x8d,
+    0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x9a, 0xb8, 0xf0, 0x9f, 0xa4, 0xb8, 0xf0, 0x9f,
+    0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x92, 0x87, 0xf0, 0x9f, 0x8f, 0xbf,
+    0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xe2, 0x97, 0xbb, 0xef, 0xb8, 0x8f, 0xe2, 0x96, 0xb6, 0xf0,
+    0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x9c, 0x88, 0xef, 0xb8, 0x8f,
+    0xf0, 0x9f, 0x91, 0x8b, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0xa6, 0xb9, 0xe2, 0x80, 0x8d, 0xe2,
+    0x99, 0x82, 0xf0, 0x9f, 0x8c, 0x8a, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80,
+    0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80,
+    0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0xa4, 0xb5, 0xf0, 0x9f, 0x8f,
+    0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x92, 0x8d, 0xf0, 0x9f,
+    0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x9a, 0x96, 0xef, 0xb8, 0x8f, 0xf0,
+    0x9f, 0x93, 0xaf, 0xf0, 0x9f, 0x99, 0x87, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0x8f, 0xab, 0xf0, 0x9f, 0x94, 0x93, 0xf0, 0x9f, 0x8c, 0xbf, 0xf0, 0x9f, 0x97, 0x9e, 0xf0,
+    0x9f, 0xa4, 0xb8, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f,
+    0xe2, 0x9c, 0x8c, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x99, 0x8b, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80,
+    0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x96, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2,
+    0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x9a, 0x85, 0xf0, 0x9f, 0x87, 0xb0, 0xf0, 0x9f, 0x87,
+    0xbe, 0xf0, 0x9f, 0x86, 0x93, 0xf0, 0x9f, 0x89, 0x91, 0xf0, 0x9f, 0x96, 0x95, 0xf0, 0x9f, 0x8f,
+    0xbd, 0xf0, 0x9f, 0xa7, 0x91, 0xe2, 0x80, 0x8d, 0xe2, 0x9a, 0x95, 0xf0, 0x9f, 0xa7, 0x91, 0xe2,
+    0x80, 0x8d, 0xf0, 0x9f, 0x9a, 0x92, 0xf0, 0x9f, 0x97, 0x91, 0xf0, 0x9f, 0xab, 0xb2, 0xf0, 0x9f,
+    0xa7, 0x99, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x8e, 0x9a,
+    0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x94, 0xad, 0xe2, 0x9b, 0xb2, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f,
+    0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x94, 0xa7, 0xf0, 0x9f, 0x8f, 0x8b, 0xf0, 0x9f, 0x8f,
+    0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x93, 0x80, 0xf0, 0x9f, 0xa4, 0xb8, 0xf0,
+    0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0xa7, 0x98, 0xf0, 0x9f, 0x8f,
+    0xbb, 0xf0, 0x9f, 0x87, 0xb5, 0xf0, 0x9f, 0x87, 0xac, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f,
+    0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f,
+    0x8f, 0xbf, 0xf0, 0x9f, 0x91, 0xb3, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80,
+    0xef, 0xb8, 0x8f, 0xe2, 0x8f, 0xb1, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa5, 0x95, 0xf0, 0x9f, 0xa7,
+    0x91, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80,
+    0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbb,
+    0xf0, 0x9f, 0xa5, 0x8c, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2,
+    0x9c, 0x88, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d,
+    0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f,
+    0xbd, 0xf0, 0x9f, 0x92, 0x81, 0xf0, 0x9f, 0x8f, 0xbd, 0x23, 0xe2, 0x83, 0xa3, 0xf0, 0x9f, 0x91,
+    0xa8, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa4, 0x9d, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x92, 0x82, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2,
+    0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x8c, 0xab, 0xef, 0xb8, 0x8f, 0x32,
+    0xe2, 0x83, 0xa3, 0xf0, 0x9f, 0xa6, 0x9b, 0xf0, 0x9f, 0xa7, 0x80, 0xf0, 0x9f, 0xaa, 0x9b, 0xf0,
+    0x9f, 0xa7, 0x8d, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0xab,
+    0x83, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0xa5, 0x9d, 0xf0, 0x9f, 0x87, 0xb3, 0xf0, 0x9f, 0x87,
+    0xb7, 0xf0, 0x9f, 0x92, 0xba, 0xf0, 0x9f, 0x93, 0x8c, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f,
+    0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80,
+    0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x95, 0xb9, 0xef, 0xb8, 0x8f,
+    0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8,
+    0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x91, 0xa9,
+    0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91,
+    0xa8, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x9a, 0xa3, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d,
+    0xe2, 0x99, 0x80, 0xf0, 0x9f, 0xa4, 0xa6, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x80, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2,
+    0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f,
+    0xbe, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef,
+    0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8,
+    0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x8d, 0xbc, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbb,
+    0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x94, 0xac, 0xf0, 0x9f, 0x99, 0x85, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2,
+    0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbf,
+    0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa4, 0x9d, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f,
+    0x8f, 0xbb, 0xe2, 0x9a, 0xbe, 0xf0, 0x9f, 0x87, 0xb5, 0xf0, 0x9f, 0x87, 0xb2, 0xf0, 0x9f, 0x91,
+    0xa9, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80,
+    0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb,
+    0xf0, 0x9f, 0xa4, 0xa6, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f,
+    0xa4, 0xa6, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xe2, 0x86, 0x95, 0xef,
+    0xb8, 0x8f, 0xf0, 0x9f, 0x93, 0x88, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80,
+    0x8d, 0xf0, 0x9f, 0xa6, 0xb2, 0xf0, 0x9f, 0xa7, 0x97, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x9b,
+    0x8c, 0xf0, 0x9f, 0x92, 0x82, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef,
+    0xb8, 0x8f, 0xf0, 0x9f, 0x99, 0x8b, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82,
+    0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x99, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x80, 0xf0, 0x9f, 0x94, 0x9e, 0xf0, 0x9f, 0x8c, 0xba, 0xf0, 0x9f, 0xa7, 0x8e, 0xe2, 0x80, 0x8d,
+    0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80,
+    0x8d, 0xf0, 0x9f, 0xa4, 0x9d, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbd,
+    0xf0, 0x9f, 0xa7, 0x8f, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f,
+    0xa7, 0x9d, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0,
+    0x9f, 0xa4, 0x9b, 0xf0, 0x9f, 0x91, 0xb7, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2,
+    0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x9a, 0xb4, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2,
+    0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x95, 0xb5, 0xf0, 0x9f, 0x8f, 0xbf,
+    0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xb0, 0xf0,
+    0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f,
+    0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f,
+    0x8f, 0xbc, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6,
+    0xbc, 0xf0, 0x9f, 0xa7, 0x8f, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0xa7, 0x91, 0xe2,
+    0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xb3, 0xf0, 0x9f, 0x96, 0x8b, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa5,
+    0xb2, 0xf0, 0x9f, 0xa4, 0xbc, 0xe2, 0x9a, 0xa7, 0xf0, 0x9f, 0x8f, 0x8a, 0xf0, 0x9f, 0x8f, 0xbb,
+    0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x87, 0xb3, 0xf0, 0x9f, 0x87, 0xa8, 0xe2, 0x98,
+    0xba, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8c, 0xbe,
+    0xf0, 0x9f, 0xa7, 0xae, 0xe2, 0x97, 0xbd, 0xf0, 0x9f, 0xa5, 0xa0, 0xf0, 0x9f, 0x91, 0xa8, 0xf0,
+    0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8,
+    0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x99, 0xa3, 0xf0, 0x9f, 0x91, 0xbc, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0,
+    0x9f, 0xa4, 0xb7, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f,
+    0xf0, 0x9f, 0xa7, 0x8e, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f,
+    0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8d, 0xbc, 0xf0, 0x9f, 0x8e, 0xb6, 0xf0, 0x9f, 0x8f,
+    0x84, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x99, 0x8e, 0xf0, 0x9f,
+    0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbc,
+    0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0xbc, 0xf0, 0x9f, 0x9f, 0xaa, 0xf0, 0x9f, 0x99, 0x8d, 0xf0,
+    0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x8f, 0xa1,
+    0xf0, 0x9f, 0x94, 0xbd, 0xf0, 0x9f, 0x91, 0xb0, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2,
+    0x99, 0x80, 0xef, 0xb8, 0x8f, 0xe2, 0x9c, 0x8d, 0xef, 0xb8, 0x8f, 0xe2, 0x9a, 0x99, 0xf0, 0x9f,
+    0x92, 0xb4, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8e,
+    0xa4, 0xf0, 0x9f, 0x91, 0x86, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x8d, 0xac, 0xf0, 0x9f, 0x91,
+    0x8a, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x91, 0xbc, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x87,
+    0xaf, 0xf0, 0x9f, 0x87, 0xb5, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0xa4, 0x9d, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0,
+    0x9f, 0xa7, 0x9b, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x98,
+    0xb2, 0xf0, 0x9f, 0x95, 0xb5, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8,
+    0x8f, 0xf0, 0x9f, 0x9b, 0x8d, 0xf0, 0x9f, 0x9b, 0x80, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0xa4,
+    0xb9, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x8e, 0xa8, 0xf0,
+    0x9f, 0x91, 0xab, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x91, 0xa6, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0,
+    0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xbd, 0xf0, 0x9f,
+    0xa6, 0xb9, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x99, 0x8d,
+    0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x9f, 0xa9, 0xf0, 0x9f, 0x9a, 0xb4, 0xf0, 0x9f, 0x8f, 0xbc,
+    0xf0, 0x9f, 0x91, 0xb1, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f,
+    0x91, 0xb7, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x8d, 0xbf, 0xf0, 0x9f, 0x91, 0xa8, 0xe2, 0x80,
+    0x8d, 0xe2, 0x9a, 0x96, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa6, 0x88, 0xf0, 0x9f, 0x99, 0x8f, 0xf0,
+    0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa6, 0xf0, 0x9f,
+    0x9a, 0xb6, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x9a, 0xa5,
+    0xf0, 0x9f, 0xab, 0xb4, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbb,
+    0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b,
+    0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x91, 0xa9, 0xf0,
+    0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa4, 0x9d, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91,
+    0xa9, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x98, 0xb8, 0xf0, 0x9f, 0xa7, 0xb8, 0xf0, 0x9f, 0x9b,
+    0x8f, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xb2, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x87, 0xb2,
+    0xf0, 0x9f, 0x87, 0xac, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0x8e, 0xa8, 0xf0, 0x9f, 0x9a, 0xb4, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x87, 0xb2, 0xf0, 0x9f, 0x87, 0xa6, 0xf0, 0x9f, 0x9a, 0xa3,
+    0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2,
+    0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0xa7, 0x8e, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0,
+    0x9f, 0xa4, 0x8c, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x94, 0xb0, 0xf0, 0x9f, 0x8f, 0x82, 0xf0,
+    0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x8f, 0x8c, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x8f, 0x9b, 0xf0,
+    0x9f, 0x95, 0xb5, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x91,
+    0xa9, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x8e,
+    0x80, 0xf0, 0x9f, 0x8f, 0xae, 0xe2, 0xac, 0x85, 0xe2, 0x9c, 0x96, 0xef, 0xb8, 0x8f, 0xf0, 0x9f,
+    0xaa, 0xa0, 0xf0, 0x9f, 0xa7, 0x97, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80,
+    0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0x92, 0xbc, 0xf0, 0x9f, 0xa7, 0x8f, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82,
+    0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa4, 0x9d, 0xe2,
+    0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0xa4, 0xa6, 0xf0, 0x9f,
+    0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x91, 0xe2,
+    0x80, 0x8d, 0xf0, 0x9f, 0x92, 0xbb, 0xf0, 0x9f, 0x99, 0x86, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80,
+    0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa4, 0xbe, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2,
+    0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbe,
+    0xe2, 0x80, 0x8d, 0xe2, 0x9a, 0x96, 0xef, 0xb8, 0x8f, 0xe2, 0x8f, 0xae, 0xef, 0xb8, 0x8f, 0xf0,
+    0x9f, 0x91, 0x84, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x9d,
+    0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x92, 0x81, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80,
+    0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xe2, 0x9c, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x92,
+    0x82, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0xa4, 0x9d, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0,
+    0x9f, 0xa7, 0x9a, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0xa5, 0xbd, 0xf0, 0x9f, 0xa6, 0xb9, 0xf0,
+    0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x9a, 0xb4, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x99, 0x87, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2,
+    0x99, 0x82, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x92, 0x82, 0xf0, 0x9f,
+    0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x9a, 0xb5, 0xf0, 0x9f, 0x8f, 0xbb,
+    0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x98, 0xa1, 0xf0, 0x9f, 0x91,
+    0xb7, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x97, 0xbd, 0xf0,
+    0x9f, 0x9a, 0xae, 0xf0, 0x9f, 0xa5, 0x90, 0xf0, 0x9f, 0x98, 0x81, 0xf0, 0x9f, 0xa6, 0xb8, 0xf0,
+    0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa9,
+    0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa4, 0x9d, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80,
+    0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x8f, 0x8c, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80,
+    0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0xa6, 0xaf, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0x9a, 0x92, 0xf0, 0x9f, 0xab, 0x85, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80,
+    0x8d, 0xe2, 0x9c, 0x88, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x8e, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0,
+    0x9f, 0x91, 0xae, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x91,
+    0xa9, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x8f, 0x94, 0xf0, 0x9f, 0x99, 0x87, 0xf0, 0x9f,
+    0x8f, 0xbd, 0xf0, 0x9f, 0x87, 0xa9, 0xf0, 0x9f, 0x87, 0xbf, 0xf0, 0x9f, 0xa7, 0x97, 0xf0, 0x9f,
+    0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xb4, 0xf0,
+    0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0xa6, 0xbc, 0xf0, 0x9f, 0x87, 0xa7, 0xf0, 0x9f, 0x87, 0xaa, 0xe2, 0x8f, 0xba, 0xef, 0xb8, 0x8f,
+    0xf0, 0x9f, 0x87, 0xb5, 0xf0, 0x9f, 0x87, 0xab, 0xf0, 0x9f, 0xa7, 0x9b, 0xf0, 0x9f, 0x8f, 0xbb,
+    0xf0, 0x9f, 0xa4, 0xac, 0xf0, 0x9f, 0xa4, 0xb1, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0xa4, 0xbd,
+    0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x9a, 0x8a, 0xf0, 0x9f, 0x86, 0x96, 0xf0, 0x9f, 0x91, 0xb6,
+    0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0xa7, 0x9c, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2,
+    0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x88, 0x81, 0xf0, 0x9f, 0xa7, 0x9c, 0xf0, 0x9f, 0x8f,
+    0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f,
+    0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0,
+    0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x9c,
+    0x88, 0xf0, 0x9f, 0x90, 0x82, 0xf0, 0x9f, 0xa6, 0xb8, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d,
+    0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x8f, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80,
+    0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xab, 0xb1, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0,
+    0x9f, 0x95, 0xb4, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2,
+    0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xb3, 0xf0, 0x9f, 0x8f, 0x84, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80,
+    0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x94, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0,
+    0x9f, 0x9a, 0xb6, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa6, 0xb9,
+    0xf0, 0x9f, 0x91, 0xa8, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa6, 0xf0, 0x9f, 0x91, 0xa8, 0xf0,
+    0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0xbb, 0xf0, 0x9f, 0x99, 0x85, 0xe2, 0x80,
+    0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x87, 0xb9, 0xf0, 0x9f, 0x87, 0xa6, 0xf0, 0x9f, 0xa7, 0x9d,
+    0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91,
+    0x82, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x8f, 0x8b, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d,
+    0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0x9a, 0x92, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4,
+    0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91,
+    0xa9, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x8f, 0xb7, 0xf0, 0x9f, 0x99, 0x87, 0xf0, 0x9f, 0x8f,
+    0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x87, 0xb1, 0xf0, 0x9f,
+    0x87, 0xa8, 0xf0, 0x9f, 0x91, 0xb4, 0xe2, 0x9b, 0xb9, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xe2,
+    0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x92, 0x87, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x91,
+    0xa8, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80,
+    0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbc,
+    0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x94, 0xa7, 0xf0,
+    0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa4, 0x9d, 0xe2, 0x80,
+    0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x9c, 0x8d, 0xf0, 0x9f, 0x8f, 0xbf,
+    0xf0, 0x9f, 0x8d, 0xa5, 0xf0, 0x9f, 0xa6, 0x92, 0xf0, 0x9f, 0x91, 0xa8, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0xa6, 0xb3, 0xf0, 0x9f, 0xa7, 0x9a, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x94, 0xba, 0xf0, 0x9f, 0xa4, 0xb9, 0xf0, 0x9f, 0x8f, 0xbd,
+    0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xe2, 0x9a, 0x9b, 0xf0, 0x9f, 0x92, 0x83, 0xf0, 0x9f, 0x88,
+    0xb4, 0xf0, 0x9f, 0x9a, 0x97, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0x8f, 0xad, 0xf0, 0x9f, 0x91, 0x86, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x8d, 0xaa,
+    0xf0, 0x9f, 0x99, 0x8e, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0xa5, 0x98, 0xf0, 0x9f, 0xa7, 0x96,
+    0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0xa7, 0x99, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2,
+    0x99, 0x80, 0xf0, 0x9f, 0xab, 0x85, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0xa7, 0x97, 0xf0, 0x9f,
+    0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbf,
+    0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xbd, 0xf0, 0x9f, 0x92, 0x87, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2,
+    0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0xa4, 0xb4, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f,
+    0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x9c, 0x88, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x92, 0x82, 0xf0, 0x9f,
+    0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x95, 0xb5, 0xf0, 0x9f, 0x8f, 0xbe,
+    0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0xa7, 0x97, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f,
+    0x9b, 0xa2, 0xf0, 0x9f, 0x9a, 0x8d, 0xf0, 0x9f, 0xa4, 0xb5, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80,
+    0x8d, 0xe2, 0x99, 0x82, 0xe2, 0x9b, 0xb9, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x97, 0x82, 0xf0, 0x9f, 0x91, 0x8b, 0xf0, 0x9f, 0x91, 0xa9,
+    0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0,
+    0x9f, 0x9f, 0xab, 0xf0, 0x9f, 0x91, 0xb6, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0xa7, 0x91, 0xf0,
+    0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f,
+    0xa4, 0x98, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80,
+    0x8d, 0xe2, 0x9a, 0x95, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2,
+    0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x91,
+    0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x90,
+    0x87, 0xf0, 0x9f, 0x91, 0xa8, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa7, 0xf0, 0x9f, 0xa6, 0xb8,
+    0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x91, 0xb7, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2,
+    0x99, 0x82, 0xf0, 0x9f, 0x91, 0xae, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xe2, 0x9c, 0xa8, 0xf0,
+    0x9f, 0xa7, 0x9e, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x9d,
+    0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x91, 0xa8,
+    0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x9c, 0x88, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f,
+    0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2,
+    0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x95, 0xb5, 0xf0, 0x9f,
+    0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x8f, 0x82, 0xf0, 0x9f, 0x8f, 0xbd,
+    0xf0, 0x9f, 0x92, 0x87, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x9a,
+    0x8e, 0xf0, 0x9f, 0xa4, 0x99, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x92, 0x92, 0xf0, 0x9f, 0x8e,
+    0x87, 0xf0, 0x9f, 0x97, 0xb3, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb,
+    0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x95, 0xb5, 0xe2, 0x80, 0x8d, 0xe2,
+    0x99, 0x80, 0xf0, 0x9f, 0xa7, 0x8f, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80,
+    0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x9a, 0xb6, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x80, 0xef, 0xb8, 0x8f, 0xe2, 0x9b, 0xb3, 0xe2, 0x9a, 0xa1, 0xf0, 0x9f, 0xa4, 0x9e, 0xf0, 0x9f,
+    0x8f, 0xbc, 0xf0, 0x9f, 0x90, 0xab, 0xf0, 0x9f, 0xa4, 0xbd, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80,
+    0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x9a, 0xb4, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2,
+    0x99, 0x80, 0xf0, 0x9f, 0x9a, 0xb4, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80,
+    0xe2, 0x98, 0x9d, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x99, 0x86, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0,
+    0x9f, 0xa7, 0x8d, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x91,
+    0x81, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0xa6, 0xbc, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0x9a, 0x80, 0xf0, 0x9f, 0x91, 0xa8, 0xe2, 0x80, 0x8d, 0xe2, 0x9a, 0x95, 0xf0, 0x9f, 0xab, 0xb5,
+    0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0xa5, 0x89, 0xf0, 0x9f, 0xa7, 0x8e, 0xf0, 0x9f, 0x8f, 0xbb,
+    0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80,
+    0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0xa4, 0xb8, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80,
+    0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x92, 0x87, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2,
+    0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbd,
+    0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xb0, 0xf0, 0x9f, 0x8f, 0x84, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2,
+    0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x96, 0x87, 0xf0, 0x9f, 0x8e, 0x96, 0xef, 0xb8, 0x8f,
+    0xf0, 0x9f, 0xa7, 0x9a, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0xa4, 0xb8, 0xf0, 0x9f, 0x8f, 0xbc,
+    0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa4, 0xbc, 0xe2, 0x80, 0x8d,
+    0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xe2, 0x98, 0xba, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x8d,
+    0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f,
+    0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x94, 0xa7, 0xf0, 0x9f, 0x8f, 0x91, 0xf0, 0x9f, 0xab,
+    0xb1, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xab, 0xb2, 0xf0, 0x9f, 0x8f, 0xbb,
+    0xf0, 0x9f, 0x9b, 0xa0, 0xf0, 0x9f, 0xa4, 0xb9, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8,
+    0x8f, 0xe2, 0x98, 0xa2, 0xf0, 0x9f, 0x94, 0x9b, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xe2,
+    0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9,
+    0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8,
+    0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0,
+    0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0xa4, 0x9d, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0xa7,
+    0x97, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x91, 0xa8, 0xf0,
+    0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x9a, 0x80, 0xf0, 0x9f, 0x91, 0x8e, 0xf0, 0x9f,
+    0x8f, 0xbc, 0xf0, 0x9f, 0x91, 0xb0, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82,
+    0xe2, 0x9a, 0x93, 0xf0, 0x9f, 0x93, 0xba, 0xf0, 0x9f, 0xa7, 0x99, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2,
+    0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0xa4, 0xa6, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0,
+    0x9f, 0x91, 0xa8, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x94, 0xa7, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f,
+    0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x9a, 0x95, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x90, 0x86, 0xf0,
+    0x9f, 0xa6, 0x9a, 0xf0, 0x9f, 0x8c, 0xac, 0xf0, 0x9f, 0x92, 0x87, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2,
+    0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x92, 0x82, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f,
+    0xbc, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xb1, 0xf0, 0x9f, 0x91, 0xa8, 0xe2, 0x80, 0x8d, 0xe2,
+    0x9a, 0x96, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4,
+    0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f,
+    0x92, 0x91, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x8c, 0x93, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f,
+    0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0,
+    0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x8c, 0x88, 0xf0, 0x9f, 0x99, 0x86, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2,
+    0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x91, 0xa8, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8e, 0x93,
+    0xf0, 0x9f, 0xa7, 0x99, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x9a,
+    0xb4, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x87, 0xac, 0xf0, 0x9f, 0x87, 0xba, 0xf0, 0x9f, 0x9a,
+    0xb6, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f,
+    0x91, 0xa8, 0xe2, 0x80, 0x8d, 0xe2, 0x9c, 0x88, 0xf0, 0x9f, 0x9b, 0x80, 0xf0, 0x9f, 0x8f, 0xbc,
+    0xf0, 0x9f, 0x9a, 0xa1, 0xf0, 0x9f, 0x9b, 0x96, 0xf0, 0x9f, 0xa7, 0x92, 0xf0, 0x9f, 0xa7, 0x96,
+    0xf0, 0x9f, 0x91, 0xb7, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8,
+    0x8f, 0xf0, 0x9f, 0x87, 0xbb, 0xf0, 0x9f, 0x87, 0xae, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f,
+    0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x9a, 0x95, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x87, 0xac, 0xf0, 0x9f,
+    0x87, 0xb6, 0xe2, 0x98, 0x83, 0xf0, 0x9f, 0xa7, 0x99, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d,
+    0xe2, 0x99, 0x80, 0xe2, 0x9c, 0x96, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80,
+    0x8d, 0xf0, 0x9f, 0xa6, 0xb2, 0xf0, 0x9f, 0x92, 0xb7, 0xf0, 0x9f, 0x91, 0xa8, 0xe2, 0x80, 0x8d,
+    0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x90,
+    0x84, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa4, 0x9d,
+    0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x9a, 0xb6, 0xf0,
+    0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0xa4, 0x9d, 0xf0, 0x9f, 0x8f,
+    0xbc, 0xf0, 0x9f, 0x8c, 0xaa, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d,
+    0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x91, 0x98, 0xf0, 0x9f, 0x87, 0xbe,
+    0xf0, 0x9f, 0x87, 0xb9, 0xf0, 0x9f, 0x87, 0xae, 0xf0, 0x9f, 0x87, 0xb9, 0xf0, 0x9f, 0x99, 0x85,
+    0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa6,
+    0xb9, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d,
+    0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f,
+    0x8f, 0x84, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x93, 0x82, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f,
+    0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2,
+    0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x99, 0x8d, 0xf0, 0x9f,
+    0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa8, 0xf0,
+    0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b,
+    0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x87, 0xbe, 0xf0,
+    0x9f, 0x87, 0xaa, 0xf0, 0x9f, 0xab, 0xb3, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0xab, 0xb1, 0xf0,
+    0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xab, 0xb2, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f,
+    0x94, 0xb2, 0xe2, 0x99, 0xa6, 0xf0, 0x9f, 0x8f, 0x86, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f,
+    0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80,
+    0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x9b, 0xb9, 0xef, 0xb8, 0x8f, 0xe2,
+    0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x95, 0xb3, 0xef, 0xb8, 0x8f, 0xf0,
+    0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8e, 0x93, 0xf0, 0x9f,
+    0xa6, 0xb9, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0,
+    0x9f, 0x91, 0xb7, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x94,
+    0xaf, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8f, 0xad,
+    0xf0, 0x9f, 0x9b, 0xa5, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x87, 0xb2, 0xf0, 0x9f, 0x87, 0xb0, 0xf0,
+    0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x9a, 0x95, 0xf0, 0x9f, 0x91,
+    0xa9, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa4, 0x9d, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0xa4, 0x9d, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0,
+    0x9f, 0x92, 0xa4, 0xf0, 0x9f, 0x8f, 0x83, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa6, 0xb9, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8,
+    0x8f, 0xe2, 0x9a, 0x95, 0xf0, 0x9f, 0x8c, 0xb2, 0xf0, 0x9f, 0xa7, 0x9a, 0xf0, 0x9f, 0x8f, 0xbc,
+    0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0xa4, 0xb3, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f,
+    0x85, 0xb1, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x8e, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xe2,
+    0x9b, 0xbd, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x94,
+    0xa7, 0xf0, 0x9f, 0x98, 0x96, 0xe2, 0x98, 0xa3, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbf,
+    0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8,
+    0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x91, 0x8d, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x91, 0xa8,
+    0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0xbb, 0xf0, 0x9f, 0xa4, 0xbd, 0xf0,
+    0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0xa7, 0x98, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f,
+    0xf0, 0x9f, 0xa7, 0x97, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f,
+    0x9a, 0xb4, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80,
+    0x8d, 0xe2, 0x9c, 0x88, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2,
+    0x80, 0x8d, 0xf0, 0x9f, 0x92, 0xbc, 0xf0, 0x9f, 0x99, 0x8e, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f,
+    0x94, 0x81, 0xf0, 0x9f, 0x91, 0xb3, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82,
+    0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x9d,
+    0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0xab, 0xb3, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f,
+    0x91, 0xac, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x92, 0xa9, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f,
+    0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2,
+    0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0xa7, 0x8f, 0xf0, 0x9f,
+    0x8f, 0xbe, 0xf0, 0x9f, 0x87, 0xb3, 0xf0, 0x9f, 0x87, 0xae, 0xf0, 0x9f, 0x9a, 0xb5, 0xf0, 0x9f,
+    0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0xa6, 0xb9, 0xf0, 0x9f, 0x8f, 0xbc,
+    0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0xa4, 0xb5, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f,
+    0xa7, 0x96, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0xb2, 0xf0,
+    0x9f, 0x8f, 0x83, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0xa7,
+    0x96, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f,
+    0x91, 0x8d, 0xf0, 0x9f, 0xa7, 0x95, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x8e, 0x85, 0xf0, 0x9f,
+    0x8f, 0xbc, 0xf0, 0x9f, 0x8e, 0x91, 0xf0, 0x9f, 0xa4, 0xbd, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80,
+    0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0xa6, 0xa7, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbe,
+    0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8,
+    0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0xa7, 0x94, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x91, 0xa8,
+    0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa4, 0x9d, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x8f, 0xaf, 0xf0, 0x9f, 0x94, 0x82, 0xf0, 0x9f,
+    0x87, 0xb2, 0xf0, 0x9f, 0x87, 0xb5, 0xf0, 0x9f, 0xa5, 0xb9, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f,
+    0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2,
+    0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x92, 0x87, 0xf0, 0x9f,
+    0x8f, 0xbd, 0xf0, 0x9f, 0x9a, 0xb5, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82,
+    0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x8f, 0x8c, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x82, 0xf0, 0x9f, 0x98, 0xae, 0xf0, 0x9f, 0x99, 0x86, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef,
+    0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x9c, 0x88,
+    0xf0, 0x9f, 0xa4, 0xb5, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbd,
+    0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8e, 0xa8, 0xf0, 0x9f, 0xa4, 0xb7, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0,
+    0x9f, 0x92, 0x81, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x99,
+    0x85, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0xa7, 0x8d, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d,
+    0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x9d,
+    0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0,
+    0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x8f, 0xba, 0xf0, 0x9f, 0x92, 0x86,
+    0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7,
+    0xb1, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef,
+    0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8,
+    0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2,
+    0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbb,
+    0xf0, 0x9f, 0x92, 0xa7, 0xf0, 0x9f, 0x91, 0xa8, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xe2,
+    0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa7, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa6, 0xf0, 0x9f, 0x91,
+    0xb4, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x8f, 0xad, 0xf0, 0x9f, 0xa6, 0xb9, 0xf0, 0x9f, 0x8f,
+    0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x9c, 0xf0, 0x9f,
+    0x8f, 0xbf, 0xf0, 0x9f, 0x95, 0x8a, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa4, 0x9a, 0xf0, 0x9f, 0x92,
+    0x96, 0xf0, 0x9f, 0xa7, 0x9b, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x90, 0xbc, 0xf0,
+    0x9f, 0x92, 0x81, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0xa7, 0x98, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2,
+    0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x91, 0xb1, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d,
+    0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x90, 0x88, 0xe2, 0x80, 0x8d, 0xe2, 0xac, 0x9b,
+    0xf0, 0x9f, 0x91, 0xb3, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8,
+    0x8f, 0xf0, 0x9f, 0x87, 0xaa, 0xf0, 0x9f, 0x87, 0xb7, 0xf0, 0x9f, 0x8f, 0x8c, 0xe2, 0x80, 0x8d,
+    0xe2, 0x99, 0x82, 0xf0, 0x9f, 0xa7, 0x94, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x82, 0xf0, 0x9f, 0x86, 0x8e, 0xf0, 0x9f, 0xa5, 0x9e, 0xf0, 0x9f, 0x91, 0xb3, 0xf0, 0x9f, 0x8f,
+    0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f,
+    0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xbd, 0xf0, 0x9f, 0x92, 0x87, 0xf0, 0x9f, 0x8f,
+    0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0xa4, 0xb6, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0,
+    0x9f, 0x91, 0x8a, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0xa7, 0xa7, 0xf0, 0x9f, 0x91, 0x88, 0xf0,
+    0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0xa7, 0x9f, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2,
+    0x80, 0x8d, 0xf0, 0x9f, 0x8d, 0xb3, 0xf0, 0x9f, 0xa6, 0xb6, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f,
+    0x96, 0x95, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x9c, 0xb4, 0xf0, 0x9f, 0x92, 0x82, 0xe2, 0x80, 0x8d,
+    0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x96, 0x8c, 0xf0, 0x9f, 0x9a, 0xb7, 0xe2, 0x9b,
+    0x85, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0xbb,
+    0xf0, 0x9f, 0x99, 0x8e, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8,
+    0x8f, 0xf0, 0x9f, 0x9a, 0xb5, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x90, 0xb8, 0xf0, 0x9f, 0xa4,
+    0xa6, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f,
+    0x8f, 0x84, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0,
+    0x9f, 0x8f, 0x8b, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f,
+    0xf0, 0x9f, 0x87, 0xb8, 0xf0, 0x9f, 0x87, 0xa8, 0xf0, 0x9f, 0x87, 0xb2, 0xf0, 0x9f, 0x87, 0xba,
+    0xf0, 0x9f, 0xab, 0x90, 0xe2, 0x9c, 0xa1, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f,
+    0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2,
+    0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x90, 0xb4, 0xf0, 0x9f,
+    0xa6, 0xb8, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x91, 0xb2,
+    0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2,
+    0x9c, 0x88, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92,
+    0xbc, 0xf0, 0x9f, 0x96, 0x96, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0xab, 0xb1, 0xf0, 0x9f, 0x8f,
+    0xbc, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xab, 0xb2, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x94, 0xab,
+    0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80,
+    0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbc,
+    0xf0, 0x9f, 0x91, 0xa8, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0xbc, 0xf0, 0x9f, 0x8f, 0x83, 0xf0,
+    0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x96, 0xa8, 0xf0, 0x9f, 0x91,
+    0xa9, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f,
+    0x98, 0x90, 0xf0, 0x9f, 0xa7, 0x94, 0xf0, 0x9f, 0x8f, 0xbd, 0xc2, 0xa9, 0xf0, 0x9f, 0x91, 0x8c,
+    0xf0, 0x9f, 0x8c, 0xb7, 0xe2, 0x9e, 0x97, 0xe2, 0x98, 0xb8, 0xf0, 0x9f, 0x91, 0x90, 0xf0, 0x9f,
+    0x8f, 0xbc, 0xf0, 0x9f, 0x87, 0xa7, 0xf0, 0x9f, 0x87, 0xb1, 0xf0, 0x9f, 0x91, 0x8c, 0xf0, 0x9f,
+    0x8f, 0xbc, 0xf0, 0x9f, 0x93, 0xa1, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80,
+    0x8d, 0xe2, 0x9c, 0x88, 0xf0, 0x9f, 0x87, 0xb8, 0xf0, 0x9f, 0x87, 0xbe, 0xf0, 0x9f, 0x91, 0xa9,
+    0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x9a, 0x80, 0xf0, 0x9f, 0xa4, 0xb9, 0xf0,
+    0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0x86,
+    0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2,
+    0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbd,
+    0xf0, 0x9f, 0xab, 0x83, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0xa7, 0x9c, 0xf0, 0x9f, 0x8f, 0xbe,
+    0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0xab, 0x83, 0xf0, 0x9f, 0x96, 0x90, 0xf0, 0x9f,
+    0x8f, 0xbb, 0xe2, 0x9b, 0xa9, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x98, 0xac, 0xf0, 0x9f, 0x8e, 0x9f,
+    0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x87, 0xa7, 0xf0, 0x9f, 0x87, 0xb2, 0xf0, 0x9f, 0x9a, 0xb4, 0xf0,
+    0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0xa7, 0x95, 0xf0, 0x9f, 0x91,
+    0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xb0, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbf,
+    0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9,
+    0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0xaa, 0x9c, 0xf0, 0x9f, 0x8c, 0xa7, 0xef, 0xb8, 0x8f, 0xf0,
+    0x9f, 0x91, 0xb7, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0xa7, 0x9c, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0,
+    0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f,
+    0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x9b, 0xb9, 0xf0, 0x9f,
+    0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x8f, 0x8b, 0xf0,
+    0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa4, 0xb5,
+    0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91,
+    0xb0, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0xa7, 0x9d, 0xf0,
+    0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0xab, 0xb2, 0xf0, 0x9f, 0x8f,
+    0xbd, 0xf0, 0x9f, 0xa6, 0xb8, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x91, 0xa9, 0xf0,
+    0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0xa4, 0xb2, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0,
+    0x9f, 0xa7, 0x8e, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f,
+    0xf0, 0x9f, 0xab, 0xb1, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xab, 0xb2, 0xf0,
+    0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x8d, 0x9d, 0xf0, 0x9f, 0x99, 0x8d, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2,
+    0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x8f, 0xa5, 0xf0, 0x9f, 0x8f, 0x83,
+    0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xe2, 0x9d, 0x97, 0xf0, 0x9f, 0xa7,
+    0x97, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f,
+    0xa4, 0xbd, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0,
+    0x9f, 0x8d, 0x84, 0xf0, 0x9f, 0x8f, 0x8a, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x80, 0xf0, 0x9f, 0xa4, 0xa6, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef,
+    0xb8, 0x8f, 0xf0, 0x9f, 0x95, 0x8a, 0xf0, 0x9f, 0xa4, 0x9b, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f,
+    0x8f, 0xa4, 0xf0, 0x9f, 0x99, 0x8d, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80,
+    0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x9a, 0x96, 0xef, 0xb8,
+    0x8f, 0xf0, 0x9f, 0x92, 0x81, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef,
+    0xb8, 0x8f, 0xe2, 0x9b, 0xb1, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x8f, 0x8b, 0xe2, 0x80, 0x8d, 0xe2,
+    0x99, 0x82, 0xf0, 0x9f, 0x91, 0x8c, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x99, 0x8c, 0xf0, 0x9f,
+    0x8f, 0xbb, 0xf0, 0x9f, 0xab, 0x80, 0xf0, 0x9f, 0xa4, 0xbd, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f,
+    0x94, 0x9c, 0xf0, 0x9f, 0x91, 0xa8, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xb2, 0xf0, 0x9f, 0x91,
+    0xa8, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xb0, 0xf0, 0x9f, 0xa7, 0x8d,
+    0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x91, 0xa8, 0xe2, 0x80,
+    0x8d, 0xe2, 0x9c, 0x88, 0xef, 0xb8, 0x8f, 0xe2, 0x9c, 0x8a, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f,
+    0x99, 0x8d, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x99, 0x8d, 0xf0, 0x9f, 0x8f, 0xbc,
+    0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x8e, 0xf0, 0x9f, 0x8f,
+    0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0xa5, 0xbc, 0xf0, 0x9f, 0x92, 0x87, 0xf0,
+    0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f,
+    0xbd, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8f, 0xab, 0xf0, 0x9f, 0xa6, 0xb6, 0xf0, 0x9f, 0x8f, 0xbd,
+    0xf0, 0x9f, 0xa7, 0x94, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa4,
+    0xba, 0xf0, 0x9f, 0x99, 0x86, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0,
+    0x9f, 0xaa, 0x93, 0xf0, 0x9f, 0x91, 0xb1, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x80, 0xf0, 0x9f, 0x97, 0x84, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x8f, 0x9d, 0xef, 0xb8, 0x8f, 0xf0,
+    0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x9a, 0x95, 0xef, 0xb8, 0x8f,
+    0xe2, 0x9c, 0xb4, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x88, 0xb2, 0xf0, 0x9f, 0xa6, 0xa9, 0xf0, 0x9f,
+    0x87, 0xac, 0xf0, 0x9f, 0x87, 0xaa, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80,
+    0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f,
+    0x8f, 0xbd, 0xf0, 0x9f, 0x9a, 0xb6, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0xab, 0xb1, 0xf0, 0x9f,
+    0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xab, 0xb2, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0xa4,
+    0xb7, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0xa7, 0x98, 0xf0,
+    0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x87, 0xa8,
+    0xf0, 0x9f, 0x87, 0xb3, 0xf0, 0x9f, 0x9a, 0xb5, 0xf0, 0x9f, 0xa7, 0x98, 0xf0, 0x9f, 0x8f, 0xbb,
+    0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0xa4, 0x9c, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f,
+    0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa4, 0x9d, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0xa9, 0xba, 0xf0, 0x9f, 0xa7, 0xbf,
+    0xf0, 0x9f, 0x87, 0xac, 0xf0, 0x9f, 0x87, 0xad, 0xf0, 0x9f, 0x9a, 0xb4, 0xe2, 0x80, 0x8d, 0xe2,
+    0x99, 0x80, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4,
+    0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f,
+    0x86, 0x95, 0xf0, 0x9f, 0x90, 0xa4, 0xf0, 0x9f, 0x99, 0x85, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80,
+    0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x96, 0xb1, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa8, 0xf0,
+    0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbf, 0xe3, 0x80, 0xbd, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa5,
+    0xb7, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x9b, 0x8e, 0xf0, 0x9f, 0x91, 0x81, 0xf0, 0x9f, 0x99,
+    0x85, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f,
+    0x91, 0xb3, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0,
+    0x9f, 0x91, 0xb7, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0xa7,
+    0x97, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x91, 0xa6, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0,
+    0x9f, 0xa6, 0xb9, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0xa7,
+    0x91, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x9a, 0x96, 0xf0, 0x9f, 0x91, 0xad, 0xf0,
+    0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x9d,
+    0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x8f, 0x8a, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80,
+    0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0xbb, 0xf0,
+    0x9f, 0xa4, 0xb5, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x92,
+    0x82, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f,
+    0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0xbc, 0xf0, 0x9f, 0x8d, 0x91, 0xf0, 0x9f, 0x91,
+    0xb1, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0xa5, 0x8e, 0xe2, 0x99, 0x92, 0xe2, 0xac, 0x9c, 0xf0,
+    0x9f, 0x8f, 0x9f, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x8f, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82,
+    0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa5, 0xab, 0xf0, 0x9f, 0x85, 0xb1, 0xf0, 0x9f, 0x87, 0xbb, 0xf0,
+    0x9f, 0x87, 0xaa, 0xf0, 0x9f, 0x93, 0xbc, 0xf0, 0x9f, 0x92, 0xae, 0xf0, 0x9f, 0xab, 0xa7, 0xf0,
+    0x9f, 0x92, 0x85, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x9c,
+    0x88, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x9b, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2,
+    0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x8f, 0x8c, 0xf0, 0x9f, 0x9a, 0xb4, 0xe2, 0x80, 0x8d,
+    0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x99, 0x87, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x80, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8c, 0xbe,
+    0xf0, 0x9f, 0x87, 0xb9, 0xf0, 0x9f, 0x87, 0xb2, 0xf0, 0x9f, 0x8c, 0x94, 0xf0, 0x9f, 0x91, 0xa8,
+    0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0,
+    0x9f, 0x91, 0xa8, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xbc, 0xf0, 0x9f, 0x91, 0xa8, 0xe2, 0x80,
+    0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa7, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0x91, 0xa6, 0xf0, 0x9f, 0x8e, 0xab, 0xf0, 0x9f, 0xa7, 0x9d, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2,
+    0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0xab, 0xb2, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x91,
+    0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa7, 0xf0, 0x9f, 0x8f, 0x82, 0xf0, 0x9f, 0x8f, 0xbe,
+    0xf0, 0x9f, 0x9a, 0x94, 0xf0, 0x9f, 0x91, 0xa1, 0xf0, 0x9f, 0x99, 0x85, 0xf0, 0x9f, 0x8f, 0xbc,
+    0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x91, 0xb3, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80,
+    0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0x8f, 0xab, 0xf0, 0x9f, 0xa6, 0x8a, 0xf0, 0x9f, 0x91, 0xae, 0xf0, 0x9f, 0x91, 0xa8, 0xf0,
+    0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x9a, 0x96, 0xf0, 0x9f, 0x8c, 0x98, 0xf0, 0x9f, 0x8d,
+    0x90, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2,
+    0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f,
+    0xbc, 0xf0, 0x9f, 0x92, 0xab, 0xf0, 0x9f, 0x95, 0xa5, 0xf0, 0x9f, 0x8d, 0xb4, 0xf0, 0x9f, 0x8e,
+    0x9b, 0xf0, 0x9f, 0x99, 0x8d, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xe2, 0x99,
+    0x8c, 0xf0, 0x9f, 0x99, 0x8b, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef,
+    0xb8, 0x8f, 0xf0, 0x9f, 0x99, 0x8c, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0xa4, 0xb3, 0xf0, 0x9f,
+    0x8f, 0xbf, 0xf0, 0x9f, 0x91, 0x90, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x9a, 0xb6, 0xf0, 0x9f,
+    0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa6, 0xb9, 0xf0,
+    0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f,
+    0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x9c, 0x88, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x8c, 0xbc, 0xf0, 0x9f,
+    0xa7, 0x9a, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0,
+    0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8f, 0xad, 0xf0, 0x9f,
+    0xa4, 0xb6, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80,
+    0x8d, 0xe2, 0x9a, 0x96, 0xe2, 0x9c, 0x9d, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa6, 0xbb, 0xf0, 0x9f,
+    0x8f, 0xbd, 0xf0, 0x9f, 0xab, 0xb3, 0xf0, 0x9f, 0xa4, 0xb7, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80,
+    0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xac, 0xf0, 0x9f, 0x8f, 0xbc, 0xc2,
+    0xae, 0xf0, 0x9f, 0x87, 0xa7, 0xf0, 0x9f, 0x87, 0xbf, 0xf0, 0x9f, 0x99, 0x86, 0xf0, 0x9f, 0x8f,
+    0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x9a, 0x8b, 0xf0, 0x9f,
+    0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x9c, 0x88, 0xf0, 0x9f, 0x9b, 0x80,
+    0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x92, 0x87, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f,
+    0x87, 0xb8, 0xf0, 0x9f, 0x87, 0xae, 0xf0, 0x9f, 0xa4, 0x8c, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f,
+    0x98, 0xab, 0xf0, 0x9f, 0x92, 0x86, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x8f, 0x95, 0xef, 0xb8,
+    0x8f, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8d, 0xb3,
+    0xf0, 0x9f, 0xa7, 0x94, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f,
+    0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x9a, 0x80, 0xf0, 0x9f, 0x91,
+    0xa9, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x8f,
+    0x81, 0xf0, 0x9f, 0x8f, 0x84, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef,
+    0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8e, 0xa4, 0xf0, 0x9f, 0x87,
+    0xb7, 0xf0, 0x9f, 0x87, 0xb8, 0xf0, 0x9f, 0x91, 0xb8, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x95,
+    0x89, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x87, 0xa6, 0xf0, 0x9f, 0x87, 0xb9, 0xf0, 0x9f, 0x99, 0x87,
+    0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x92,
+    0x86, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f,
+    0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f,
+    0x94, 0xb8, 0xf0, 0x9f, 0xa4, 0xb5, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80,
+    0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0x91, 0xa6, 0xf0, 0x9f, 0xa4, 0x9f, 0xf0, 0x9f, 0x91, 0xb1, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80,
+    0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x94, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x98, 0xa2, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbf,
+    0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x9a, 0x92, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2,
+    0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xb2, 0xf0, 0x9f, 0x9b, 0x92, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f,
+    0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa4, 0x9d, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8,
+    0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x92, 0x85, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0xa6, 0x81,
+    0xf0, 0x9f, 0xa4, 0x92, 0xf0, 0x9f, 0x95, 0x94, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbd,
+    0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0xbc, 0xe2, 0xa4, 0xb4, 0xf0, 0x9f, 0x91, 0xab, 0xf0, 0x9f,
+    0x8f, 0xbb, 0xf0, 0x9f, 0xa7, 0x96, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80,
+    0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa8, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8c, 0xbe, 0xf0, 0x9f,
+    0x8f, 0x8a, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0x23, 0xef, 0xb8, 0x8f, 0xe2,
+    0x83, 0xa3, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x9a,
+    0x92, 0xe3, 0x80, 0xb0, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2,
+    0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0xa7, 0x8d, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2,
+    0x80, 0x8d, 0xe2, 0x99, 0x80, 0xe2, 0x9b, 0xb9, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f,
+    0x9a, 0x93, 0xf0, 0x9f, 0x99, 0x8c, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x91, 0xb2, 0xf0, 0x9f,
+    0x8f, 0xbb, 0xf0, 0x9f, 0x91, 0xb1, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x91, 0xa9,
+    0xe2, 0x80, 0x8d, 0xe2, 0x9a, 0x95, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xab, 0xb6, 0xf0, 0x9f, 0x8f,
+    0xbe, 0xf0, 0x9f, 0x93, 0xb0, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d,
+    0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f,
+    0xbf, 0xf0, 0x9f, 0xaa, 0x90, 0xf0, 0x9f, 0x91, 0x8f, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0xab,
+    0xb1, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xab, 0xb2, 0xf0, 0x9f, 0x8f, 0xbb,
+    0xf0, 0x9f, 0x91, 0xb6, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0xa7, 0x9c, 0xf0, 0x9f, 0x8f, 0xbb,
+    0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f,
+    0xbd, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x94, 0xa7, 0xf0, 0x9f, 0xa4, 0xb7, 0xf0, 0x9f, 0x8f, 0xbe,
+    0xf0, 0x9f, 0x91, 0xb3, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7,
+    0x91, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x9a, 0x96, 0xef, 0xb8, 0x8f, 0xf0, 0x9f,
+    0x8d, 0xb9, 0xf0, 0x9f, 0x9a, 0x9c, 0xf0, 0x9f, 0xa7, 0xb6, 0xf0, 0x9f, 0x87, 0xba, 0xf0, 0x9f,
+    0x87, 0xb8, 0xf0, 0x9f, 0xa6, 0x96, 0xf0, 0x9f, 0x87, 0xb8, 0xf0, 0x9f, 0x87, 0xb7, 0xf0, 0x9f,
+    0x9a, 0x9e, 0xf0, 0x9f, 0x88, 0xb7, 0xf0, 0x9f, 0x87, 0xac, 0xf0, 0x9f, 0x87, 0xb9, 0xe2, 0x98,
+    0x98, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2,
+    0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x9a, 0xbd, 0xf0, 0x9f, 0xa7, 0xba, 0xe2,
+    0x8f, 0xae, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4,
+    0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x87, 0xb1, 0xf0,
+    0x9f, 0x87, 0xb0, 0xf0, 0x9f, 0x8f, 0x9c, 0xf0, 0x9f, 0x93, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0,
+    0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91,
+    0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x99, 0x90, 0xf0, 0x9f, 0xa6, 0x8b, 0xe2, 0xa4, 0xb4, 0xef, 0xb8,
+    0x8f, 0xf0, 0x9f, 0x96, 0x8c, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xab, 0x99, 0xf0, 0x9f, 0xa6, 0xb9,
+    0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2,
+    0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x91,
+    0xa9, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0xa4, 0x9e, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x98,
+    0x81, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa6, 0xb9, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2,
+    0x99, 0x80, 0xf0, 0x9f, 0xa4, 0xa6, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x87, 0xb8, 0xf0, 0x9f,
+    0x87, 0xaf, 0xf0, 0x9f, 0xa5, 0xa6, 0xf0, 0x9f, 0xab, 0xb6, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f,
+    0x87, 0xa6, 0xf0, 0x9f, 0x87, 0xb2, 0xf0, 0x9f, 0x92, 0x8f, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f,
+    0xa6, 0xb9, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x8f, 0x8a, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80,
+    0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa6, 0x9f, 0xf0, 0x9f, 0x9a, 0xb6, 0xf0,
+    0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x91, 0x97, 0xf0, 0x9f, 0x91,
+    0xa9, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa4, 0x9d, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x8f, 0x8c, 0xef, 0xb8, 0x8f, 0xe2, 0x80,
+    0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2,
+    0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2,
+    0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0xa7, 0xb5, 0xe2, 0x9b,
+    0xb9, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x92, 0x8f, 0xf0,
+    0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0xa6, 0x82, 0xf0, 0x9f, 0x91, 0xae, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2,
+    0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0x8d, 0xbc, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2,
+    0x9c, 0x88, 0xe2, 0x9b, 0x91, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x9b, 0x85, 0xf0, 0x9f, 0x99, 0x8b,
+    0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7,
+    0x91, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8f, 0xad, 0xf0, 0x9f, 0x88, 0xb7, 0xef, 0xb8, 0x8f, 0xf0,
+    0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2,
+    0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0,
+    0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0xa6, 0xb1, 0xf0, 0x9f, 0x87, 0xb0, 0xf0, 0x9f, 0x87, 0xb2, 0xf0, 0x9f, 0x8e, 0x90, 0xf0, 0x9f,
+    0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f,
+    0xa7, 0x9c, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x91, 0x90,
+    0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x87, 0xa6, 0xf0, 0x9f, 0x87, 0xa8, 0xe2, 0x9b, 0xb9, 0xf0,
+    0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0xa7, 0x96, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x99,
+    0x85, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f,
+    0x92, 0x81, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x97, 0x91,
+    0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x8e, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x80, 0xf0, 0x9f, 0x87, 0xb1, 0xf0, 0x9f, 0x87, 0xb9, 0xf0, 0x9f, 0xa4, 0xbd, 0xf0, 0x9f, 0x8f,
+    0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xad, 0xf0, 0x9f,
+    0x8f, 0xbf, 0xf0, 0x9f, 0x8c, 0xa9, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x8f, 0x87, 0xf0, 0x9f, 0x8f,
+    0xbd, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xb0,
+    0xf0, 0x9f, 0x97, 0xbe, 0xf0, 0x9f, 0x90, 0x81, 0xf0, 0x9f, 0xa7, 0x9a, 0xf0, 0x9f, 0x8f, 0xbd,
+    0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x8c, 0xa4, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x92,
+    0x81, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xe2, 0x86, 0x94, 0xf0, 0x9f, 0x9a, 0xb5, 0xf0, 0x9f,
+    0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x99, 0x85, 0xf0,
+    0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x9b, 0x84, 0xf0, 0x9f, 0xa4, 0x8c, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0,
+    0x9f, 0xa5, 0x97, 0xf0, 0x9f, 0xa6, 0xb8, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xbe, 0xf0, 0x9f, 0x8e, 0x97, 0xf0, 0x9f, 0xa4, 0xa6,
+    0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0xa4, 0xb1, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x98, 0x80, 0xef,
+    0xb8, 0x8f, 0xf0, 0x9f, 0xaa, 0xaa, 0xf0, 0x9f, 0x95, 0xb5, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80,
+    0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x92, 0x85, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0,
+    0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f,
+    0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x9b, 0xa3, 0xf0,
+    0x9f, 0x99, 0x8b, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x91,
+    0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x91, 0xb0, 0xf0, 0x9f, 0x91, 0xae, 0xf0, 0x9f,
+    0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x97, 0x84, 0xf0,
+    0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f,
+    0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0xa7, 0x99, 0xf0,
+    0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa8,
+    0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91,
+    0xa8, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x91, 0xb1, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f,
+    0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92,
+    0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0xa7, 0x91,
+    0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0xbb, 0xf0, 0x9f, 0x91, 0xa9, 0xf0,
+    0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b,
+    0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0xa7, 0x91, 0xf0,
+    0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91,
+    0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x9a, 0xb5, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2,
+    0x99, 0x82, 0xf0, 0x9f, 0x92, 0x91, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x87, 0xb2, 0xf0, 0x9f,
+    0x87, 0xb7, 0xf0, 0x9f, 0xa7, 0x8f, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82,
+    0xf0, 0x9f, 0xa7, 0x9c, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x98, 0xb4, 0xf0, 0x9f, 0x87, 0xa7,
+    0xf0, 0x9f, 0x87, 0xa6, 0xf0, 0x9f, 0x91, 0xae, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2,
+    0x99, 0x82, 0xf0, 0x9f, 0x8f, 0x8b, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x91, 0xb1, 0xf0, 0x9f,
+    0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x87, 0xb5, 0xf0,
+    0x9f, 0x87, 0xad, 0xf0, 0x9f, 0x8f, 0x83, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0xa4, 0x9d, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f,
+    0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xb0, 0xf0, 0x9f, 0xa7,
+    0x8a, 0xf0, 0x9f, 0xa7, 0x9b, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef,
+    0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xad, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x8f, 0x84, 0xf0, 0x9f,
+    0x8f, 0xbf, 0x36, 0xe2, 0x83, 0xa3, 0xf0, 0x9f, 0x9b, 0xb6, 0xf0, 0x9f, 0x8d, 0xbb, 0xf0, 0x9f,
+    0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x9a, 0x80, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f,
+    0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92,
+    0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0xa7, 0xa6,
+    0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8,
+    0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0,
+    0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0x8f, 0xad, 0xf0, 0x9f, 0x8f, 0x84, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82,
+    0xf0, 0x9f, 0xa7, 0x9d, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0xbc, 0xf0, 0x9f, 0xa4, 0xa6, 0xf0,
+    0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f,
+    0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x9a, 0x96, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x99, 0x85, 0xf0, 0x9f,
+    0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x9a, 0xb5, 0xe2, 0x80, 0x8d, 0xe2,
+    0x99, 0x80, 0xf0, 0x9f, 0x87, 0xa8, 0xf0, 0x9f, 0x87, 0xac, 0xf0, 0x9f, 0xa4, 0xb5, 0xf0, 0x9f,
+    0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x8f, 0x83, 0xf0, 0x9f, 0x8f, 0xbb,
+    0xf0, 0x9f, 0x87, 0xab, 0xf0, 0x9f, 0x87, 0xaf, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbd,
+    0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbd,
+    0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xb1, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2,
+    0x80, 0x8d, 0xf0, 0x9f, 0x8e, 0x93, 0xf0, 0x9f, 0x8f, 0x84, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80,
+    0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0xbd, 0xf0, 0x9f, 0xa4, 0xbd, 0xe2,
+    0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbb,
+    0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0xbb, 0xf0, 0x9f, 0xaa, 0xb6, 0xf0, 0x9f, 0x87, 0xb1, 0xf0,
+    0x9f, 0x87, 0xb7, 0xf0, 0x9f, 0x9b, 0xa5, 0xf0, 0x9f, 0xa7, 0x9a, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2,
+    0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x9a, 0xb5, 0xf0, 0x9f, 0x8f, 0xbc,
+    0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x87, 0xb8, 0xf0, 0x9f, 0x87,
+    0xa9, 0xf0, 0x9f, 0x9a, 0xb6, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0,
+    0x9f, 0xa4, 0xbe, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0xa5,
+    0x8b, 0xf0, 0x9f, 0xa5, 0x92, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d,
+    0xe2, 0x9a, 0x95, 0xf0, 0x9f, 0x98, 0x93, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2,
+    0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2,
+    0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0xa4, 0xbe, 0xf0, 0x9f,
+    0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa4, 0xbe, 0xf0,
+    0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x87, 0xb5, 0xf0, 0x9f, 0x87,
+    0xb8, 0xf0, 0x9f, 0x92, 0x81, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef,
+    0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4,
+    0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f,
+    0x8f, 0xbc, 0xf0, 0x9f, 0xa7, 0x96, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80,
+    0xe2, 0x9b, 0xb9, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0xa7,
+    0x91, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0xa4,
+    0xbd, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x90, 0xbb, 0xe2,
+    0x80, 0x8d, 0xe2, 0x9d, 0x84, 0xf0, 0x9f, 0x87, 0xb5, 0xf0, 0x9f, 0x87, 0xb3, 0xf0, 0x9f, 0x97,
+    0xa3, 0xef, 0xb8, 0x8f, 0xe2, 0x9b, 0xb9, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x91, 0x91, 0xf0,
+    0x9f, 0x87, 0xb2, 0xf0, 0x9f, 0x87, 0xb4, 0xe2, 0x9b, 0xb9, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f,
+    0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f,
+    0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f,
+    0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x9c, 0x88, 0xef, 0xb8, 0x8f, 0xf0,
+    0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x9a, 0x92, 0xf0, 0x9f,
+    0x8f, 0x9f, 0xf0, 0x9f, 0xab, 0x96, 0xf0, 0x9f, 0x9b, 0x8b, 0xf0, 0x9f, 0x95, 0xa1, 0xf0, 0x9f,
+    0x92, 0x8a, 0xf0, 0x9f, 0xab, 0xa1, 0xf0, 0x9f, 0xa7, 0x9a, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80,
+    0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x99, 0x86, 0xf0, 0x9f, 0x91, 0xac, 0xe2, 0x86, 0xaa, 0xef,
+    0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x98, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80,
+    0xf0, 0x9f, 0x8c, 0x91, 0xf0, 0x9f, 0x97, 0xba, 0xf0, 0x9f, 0xa4, 0x9a, 0xf0, 0x9f, 0x8f, 0xbb,
+    0xf0, 0x9f, 0x9a, 0x95, 0xe2, 0x9b, 0xa9, 0xf0, 0x9f, 0x93, 0x92, 0xf0, 0x9f, 0x8e, 0xa0, 0xf0,
+    0x9f, 0x92, 0x86, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f,
+    0xf0, 0x9f, 0xa7, 0x9d, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xe2, 0x9b, 0xb9, 0xe2, 0x80, 0x8d,
+    0xe2, 0x99, 0x80, 0xf0, 0x9f, 0xa4, 0xb4, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x90, 0x9f, 0xf0,
+    0x9f, 0x9a, 0x9f, 0xf0, 0x9f, 0xab, 0x95, 0xf0, 0x9f, 0x99, 0x8b, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2,
+    0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x87, 0xa7, 0xf0, 0x9f, 0x87, 0xb3,
+    0xf0, 0x9f, 0x93, 0x83, 0xf0, 0x9f, 0x9b, 0x8c, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0xa4, 0x9e,
+    0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0x8f, 0xab, 0xf0, 0x9f, 0x88, 0xb8, 0xf0, 0x9f, 0xa4, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x80, 0xf0, 0x9f, 0xa4, 0xb5, 0xf0, 0x9f, 0x91, 0xb3, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d,
+    0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80,
+    0x8d, 0xf0, 0x9f, 0x8e, 0x93, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0x8e, 0xa8, 0xf0, 0x9f, 0x91, 0xa8, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80,
+    0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x91, 0xa9,
+    0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0x91, 0xa8, 0xe2, 0x9c, 0x8d, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x99, 0x8e, 0xf0,
+    0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x8d, 0xbe,
+    0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x9a, 0x96, 0xf0, 0x9f,
+    0x99, 0x8f, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x9a, 0xa3, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80,
+    0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x87, 0xae, 0xf0, 0x9f, 0x87, 0xb2, 0xf0, 0x9f, 0x91, 0xa9,
+    0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0,
+    0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0,
+    0x9f, 0xa5, 0xb5, 0xf0, 0x9f, 0x91, 0x8d, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x91, 0xb0, 0xf0,
+    0x9f, 0x8f, 0xbe, 0x30, 0xe2, 0x83, 0xa3, 0xe2, 0x98, 0xa6, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f,
+    0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x9a, 0x95, 0xf0, 0x9f, 0x90, 0x88, 0xf0, 0x9f, 0x91, 0xa9,
+    0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0xbb, 0xf0, 0x9f, 0x87, 0xbf, 0xf0,
+    0x9f, 0x87, 0xa6, 0xf0, 0x9f, 0x91, 0x8a, 0xf0, 0x9f, 0x92, 0x82, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2,
+    0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0xa4, 0xa0, 0xf0, 0x9f, 0x94, 0xb7, 0xf0, 0x9f, 0xa4,
+    0xb5, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f,
+    0xa7, 0xaa, 0xf0, 0x9f, 0x91, 0x9d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80,
+    0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0,
+    0x9f, 0x88, 0x9a, 0xf0, 0x9f, 0xa7, 0x96, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x80, 0xf0, 0x9f, 0xa7, 0x98, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef,
+    0xb8, 0x8f, 0xf0, 0x9f, 0x87, 0xb2, 0xf0, 0x9f, 0x87, 0xa8, 0xf0, 0x9f, 0x92, 0x82, 0xf0, 0x9f,
+    0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa9, 0xf0,
+    0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x94, 0xa7, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f,
+    0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0xa7,
+    0x9c, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f,
+    0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa4, 0x9d, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x87, 0xac, 0xf0, 0x9f, 0x87, 0xb2,
+    0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8,
+    0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0xa7, 0x95,
+    0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0xab, 0xb6, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0xaa, 0xa2,
+    0xf0, 0x9f, 0x93, 0xb9, 0xf0, 0x9f, 0x87, 0xad, 0xf0, 0x9f, 0x87, 0xb2, 0xe2, 0x98, 0x81, 0xf0,
+    0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8c, 0xbe, 0xf0, 0x9f,
+    0x8e, 0xbf, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4,
+    0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91,
+    0xa8, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0xa6, 0xb3, 0xf0, 0x9f, 0xa4, 0xa4, 0xf0, 0x9f, 0x98, 0xb5, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0x92, 0xab, 0xf0, 0x9f, 0x8f, 0xb4, 0xe2, 0x80, 0x8d, 0xe2, 0x98, 0xa0, 0xef, 0xb8, 0x8f,
+    0xf0, 0x9f, 0x8e, 0xb7, 0xf0, 0x9f, 0x91, 0x8b, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0xa5, 0xaf,
+    0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8,
+    0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0,
+    0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0xa4, 0xb7, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x80, 0xf0, 0x9f, 0xa4, 0xa6, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f,
+    0x92, 0xbc, 0xf0, 0x9f, 0x8f, 0x84, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80,
+    0xf0, 0x9f, 0xa5, 0xa5, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0xa6, 0xb3, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x9d,
+    0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0,
+    0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0xa7, 0x94, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x82, 0xf0, 0x9f, 0x87, 0xa7, 0xf0, 0x9f, 0x87, 0xad, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f,
+    0xbf, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x94, 0xa7, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbd,
+    0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa4, 0x9d, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f,
+    0x8f, 0xbd, 0xf0, 0x9f, 0x91, 0xb3, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82,
+    0xf0, 0x9f, 0xa7, 0x8d, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x9c, 0x8c, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0,
+    0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xbd, 0xf0, 0x9f, 0x9a, 0x8c, 0xf0, 0x9f,
+    0xa4, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x8f, 0xf0,
+    0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x92, 0x86, 0xf0, 0x9f, 0x8f,
+    0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2,
+    0x80, 0x8d, 0xf0, 0x9f, 0x8c, 0xbe, 0xf0, 0x9f, 0x92, 0x8f, 0xf0, 0x9f, 0x90, 0xbf, 0xf0, 0x9f,
+    0xa4, 0xb5, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0,
+    0x9f, 0x8f, 0x83, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0x32, 0xef, 0xb8,
+    0x8f, 0xe2, 0x83, 0xa3, 0xf0, 0x9f, 0xa6, 0xb6, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0xa7, 0x9a,
+    0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f,
+    0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xaf, 0xf0, 0x9f, 0x87, 0xb8, 0xf0, 0x9f, 0x87,
+    0xb8, 0xf0, 0x9f, 0x91, 0xb1, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0,
+    0x9f, 0x99, 0x87, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f,
+    0xe2, 0x9e, 0xa1, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xab, 0xb5, 0xf0, 0x9f, 0x99, 0x8b, 0xf0, 0x9f,
+    0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xab, 0xb1, 0xf0,
+    0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xab, 0xb2, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f,
+    0x94, 0x9f, 0xf0, 0x9f, 0x95, 0x92, 0xf0, 0x9f, 0x99, 0x8b, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80,
+    0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x8f, 0x8a, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0,
+    0x9f, 0x92, 0x86, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa8,
+    0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8c, 0xbe, 0xf0, 0x9f, 0x92, 0xb1, 0xf0,
+    0x9f, 0xab, 0xb1, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x94,
+    0xa5, 0x2a, 0xe2, 0x83, 0xa3, 0xf0, 0x9f, 0xa7, 0x94, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d,
+    0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x8f, 0x83, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f,
+    0x8f, 0xbf, 0xf0, 0x9f, 0xa7, 0x91, 0xe2, 0x80, 0x8d, 0xe2, 0x9a, 0x95, 0xef, 0xb8, 0x8f, 0xf0,
+    0x9f, 0x8f, 0x8c, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x91,
+    0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0xa7,
+    0x8f, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xe2, 0x9c, 0x8b, 0xf0, 0x9f,
+    0x8f, 0xbe, 0xf0, 0x9f, 0x91, 0xae, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82,
+    0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x8e, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x95, 0x8e, 0xf0, 0x9f, 0xa7, 0x8e, 0xf0, 0x9f, 0x8f, 0xbf,
+    0xf0, 0x9f, 0xaa, 0xab, 0xf0, 0x9f, 0x92, 0x87, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2,
+    0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa4, 0xb5, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d,
+    0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x8d, 0x96, 0xf0, 0x9f, 0x99, 0x89, 0xf0, 0x9f, 0x90, 0x96, 0xf0,
+    0x9f, 0x9a, 0xb6, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f,
+    0xf0, 0x9f, 0x92, 0x82, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8,
+    0x8f, 0xf0, 0x9f, 0x87, 0xb2, 0xf0, 0x9f, 0x87, 0xab, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f,
+    0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x9a, 0x96, 0xf0, 0x9f, 0xa4, 0xb8, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2,
+    0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xe2, 0x9b, 0xb8, 0xf0, 0x9f, 0x91, 0xa9, 0xf0,
+    0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0xa7, 0x94, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2,
+    0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x9a, 0x89, 0xf0, 0x9f, 0xa6, 0xb8, 0xf0, 0x9f, 0x8f,
+    0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x99, 0x8f, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0,
+    0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x8e, 0xb8, 0xf0, 0x9f, 0xa7, 0x91,
+    0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7,
+    0x91, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x9a, 0x95, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x9d, 0xf0,
+    0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f,
+    0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80,
+    0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x95, 0xb5, 0xf0, 0x9f, 0x8f,
+    0xbb, 0xf0, 0x9f, 0xa7, 0x99, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x99, 0x87, 0xf0, 0x9f, 0x8f,
+    0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0xa5, 0xa2, 0xe2, 0x9c, 0x92, 0xef, 0xb8,
+    0x8f, 0xf0, 0x9f, 0x9a, 0xb6, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0,
+    0x9f, 0x91, 0x88, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x98, 0x9d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0,
+    0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b,
+    0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x99, 0x86, 0xf0,
+    0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x96, 0x96, 0xf0, 0x9f, 0x8f,
+    0xbb, 0xf0, 0x9f, 0x94, 0x9a, 0xf0, 0x9f, 0x99, 0x8d, 0xf0, 0x9f, 0xa4, 0x98, 0xf0, 0x9f, 0x8f,
+    0xbb, 0xf0, 0x9f, 0x99, 0x86, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef,
+    0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4,
+    0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f,
+    0x8f, 0xb3, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xe2, 0x9a, 0xa7, 0xef, 0xb8, 0x8f, 0xf0, 0x9f,
+    0x8c, 0x9d, 0xf0, 0x9f, 0x95, 0x9f, 0xf0, 0x9f, 0xa4, 0xa6, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80,
+    0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0xa4, 0xb8, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x93, 0x8e,
+    0xf0, 0x9f, 0xaa, 0xb9, 0xf0, 0x9f, 0xa5, 0x82, 0xf0, 0x9f, 0x99, 0x83, 0xf0, 0x9f, 0xa6, 0xb9,
+    0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xe2, 0x9a, 0xb1, 0xf0, 0x9f, 0xa6,
+    0xb8, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x91, 0xa9, 0xf0,
+    0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa4, 0x9d, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91,
+    0xa8, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x92, 0x87, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x92,
+    0x87, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2,
+    0x80, 0x8d, 0xf0, 0x9f, 0x92, 0xbc, 0xf0, 0x9f, 0x8f, 0x8c, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80,
+    0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x92, 0x87, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8,
+    0x8f, 0xf0, 0x9f, 0x93, 0xa7, 0xf0, 0x9f, 0xa7, 0x9d, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d,
+    0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x87, 0xb9, 0xf0, 0x9f, 0x87, 0xbb, 0xf0, 0x9f,
+    0x91, 0xa6, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x91, 0xa8, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8f,
+    0xad, 0xf0, 0x9f, 0xa4, 0xa6, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0,
+    0x9f, 0xa6, 0xb9, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f,
+    0xf0, 0x9f, 0x95, 0xb5, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8,
+    0x8f, 0x37, 0xe2, 0x83, 0xa3, 0xf0, 0x9f, 0xa4, 0xb5, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x92,
+    0xbf, 0xf0, 0x9f, 0xa6, 0xb9, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0,
+    0x9f, 0x99, 0x8b, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x87,
+    0xbb, 0xf0, 0x9f, 0x87, 0xac, 0xf0, 0x9f, 0x87, 0xaa, 0xf0, 0x9f, 0x87, 0xad, 0xf0, 0x9f, 0x8f,
+    0x8b, 0xf0, 0x9f, 0xa7, 0x9c, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef,
+    0xb8, 0x8f, 0xf0, 0x9f, 0x93, 0xb2, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80,
+    0x8d, 0xe2, 0x9a, 0x95, 0xf0, 0x9f, 0xa4, 0x94, 0xf0, 0x9f, 0xa7, 0x95, 0xf0, 0x9f, 0x8f, 0xbb,
+    0xf0, 0x9f, 0x9a, 0xa3, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f,
+    0x9a, 0xb5, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0xa4, 0xb8,
+    0xf0, 0x9f, 0x8c, 0x81, 0xf0, 0x9f, 0x87, 0xa8, 0xf0, 0x9f, 0x87, 0xb4, 0xf0, 0x9f, 0xa4, 0xb7,
+    0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x99, 0x86, 0xf0, 0x9f,
+    0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbf,
+    0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9,
+    0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x90, 0xaf, 0xf0, 0x9f, 0x9a, 0xa3, 0xf0, 0x9f, 0xa6, 0xaa,
+    0xf0, 0x9f, 0xa6, 0xb8, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x8f, 0x8a, 0xf0, 0x9f, 0x8f, 0xbf,
+    0xf0, 0x9f, 0x91, 0xab, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2,
+    0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91,
+    0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0xa5, 0xb3, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbe,
+    0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8f, 0xab, 0xf0, 0x9f, 0x99, 0x85, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0,
+    0x9f, 0xa7, 0x8d, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f,
+    0xf0, 0x9f, 0xa4, 0x9b, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0xa7, 0x9c, 0xf0, 0x9f, 0x8f, 0xbc,
+    0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0xa4, 0xb5, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80,
+    0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2,
+    0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbb,
+    0xf0, 0x9f, 0x91, 0xb5, 0xf0, 0x9f, 0x99, 0x8b, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2,
+    0x99, 0x80, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8e,
+    0x93, 0xf0, 0x9f, 0x87, 0xb2, 0xf0, 0x9f, 0x87, 0xb3, 0xf0, 0x9f, 0xa7, 0x9d, 0xe2, 0x80, 0x8d,
+    0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x85, 0xbe, 0xf0, 0x9f, 0x91, 0xae, 0xf0, 0x9f,
+    0x8f, 0xbe, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4,
+    0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f,
+    0x91, 0xb7, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0,
+    0x9f, 0xa5, 0xa9, 0xf0, 0x9f, 0xa4, 0xb3, 0xf0, 0x9f, 0xaa, 0x96, 0xf0, 0x9f, 0x9a, 0xa7, 0xf0,
+    0x9f, 0xaa, 0xa3, 0xf0, 0x9f, 0x90, 0xa6, 0xe2, 0x9a, 0x96, 0xe2, 0x98, 0x84, 0xef, 0xb8, 0x8f,
+    0xf0, 0x9f, 0x91, 0xb0, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x92, 0x87, 0xf0, 0x9f,
+    0x8f, 0xbf, 0xf0, 0x9f, 0xa4, 0xa6, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80,
+    0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0x8d, 0xbc, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa4,
+    0x9d, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0xa7, 0x9c,
+    0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91,
+    0xa8, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xb3, 0xf0, 0x9f, 0x9b, 0x80,
+    0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x98, 0x98, 0xf0, 0x9f, 0x8f, 0x87, 0xf0, 0x9f, 0x8f, 0xbe,
+    0xf0, 0x9f, 0x8e, 0x8d, 0xf0, 0x9f, 0x8f, 0x8c, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2,
+    0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0xa6, 0xaf, 0xf0, 0x9f, 0x8f, 0x83, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f,
+    0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0xaa, 0x83, 0xf0, 0x9f, 0xab, 0xb4, 0xf0,
+    0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0xa4, 0x9d, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0xa7,
+    0x91, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xbc, 0xf0, 0x9f, 0xa5, 0x88,
+    0xf0, 0x9f, 0xa7, 0x84, 0xf0, 0x9f, 0x8f, 0x83, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8,
+    0x8f, 0xf0, 0x9f, 0x87, 0xb9, 0xf0, 0x9f, 0x87, 0xb0, 0xf0, 0x9f, 0xa4, 0xb0, 0xf0, 0x9f, 0x8f,
+    0xbc, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2,
+    0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x92, 0x86, 0xf0, 0x9f,
+    0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbb,
+    0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x9b, 0xba, 0xf0, 0x9f, 0x91, 0xa9, 0xf0,
+    0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa4, 0x9d, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91,
+    0xa9, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x9a, 0xb5, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef,
+    0xb8, 0x8f, 0xf0, 0x9f, 0x99, 0x86, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82,
+    0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa6, 0x86, 0xf0, 0x9f, 0x87, 0xac, 0xf0, 0x9f, 0x87, 0xae, 0xf0,
+    0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0,
+    0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f,
+    0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x91, 0xa8, 0xf0,
+    0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xbc, 0xf0, 0x9f, 0x92, 0x9a, 0xf0, 0x9f,
+    0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa4, 0x9d, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x92, 0x9b, 0xf0, 0x9f, 0xa4, 0xb5,
+    0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x91, 0x8f, 0xf0, 0x9f,
+    0x8f, 0xbc, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8d,
+    0xb3, 0xf0, 0x9f, 0xa4, 0xb8, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef,
+    0xb8, 0x8f, 0xf0, 0x9f, 0x90, 0x97, 0xf0, 0x9f, 0xa4, 0xb8, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80,
+    0x8d, 0xe2, 0x99, 0x80, 0xe2, 0x9c, 0x8b, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0xa7, 0x91, 0xf0,
+    0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x9a, 0x96, 0xf0, 0x9f, 0xa7, 0x8f, 0xf0, 0x9f, 0x8f,
+    0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x87, 0xa7, 0xf0, 0x9f,
+    0x87, 0xbc, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8e,
+    0xa4, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef,
+    0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0xa7,
+    0x91, 0xe2, 0x80, 0x8d, 0xe2, 0x9c, 0x88, 0xf0, 0x9f, 0x92, 0xad, 0xf0, 0x9f, 0xab, 0x81, 0xf0,
+    0x9f, 0xa7, 0x8e, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f,
+    0xf0, 0x9f, 0x92, 0x87, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8,
+    0x8f, 0xf0, 0x9f, 0x86, 0x98, 0xf0, 0x9f, 0xa7, 0x8d, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d,
+    0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x87, 0xad, 0xf0, 0x9f, 0x87, 0xb9, 0xf0, 0x9f,
+    0xa6, 0xb8, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80,
+    0x8d, 0xf0, 0x9f, 0x9a, 0x80, 0xf0, 0x9f, 0xa7, 0x99, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d,
+    0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x8e, 0xac, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2,
+    0x80, 0x8d, 0xf0, 0x9f, 0x8f, 0xab, 0xf0, 0x9f, 0x91, 0xb1, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80,
+    0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa8, 0xe2, 0x80, 0x8d, 0xe2, 0x9d,
+    0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0x91, 0xa8, 0xf0, 0x9f, 0x8d, 0xbd, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa6, 0xb5, 0xf0, 0x9f, 0xa7,
+    0x91, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xb0, 0xf0, 0x9f, 0xa7, 0x8f, 0xf0, 0x9f, 0x8f, 0xbc,
+    0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0xa5, 0xbe, 0xf0, 0x9f, 0x87, 0xa6, 0xf0, 0x9f,
+    0x87, 0xbc, 0xf0, 0x9f, 0xa6, 0xbc, 0xf0, 0x9f, 0xa4, 0xbd, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80,
+    0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa4, 0x9b, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0,
+    0x9f, 0x9a, 0xb4, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f,
+    0xf0, 0x9f, 0x87, 0xa6, 0xf0, 0x9f, 0x87, 0xab, 0xf0, 0x9f, 0xa7, 0x94, 0xf0, 0x9f, 0x8f, 0xbc,
+    0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0xa7, 0x91, 0xe2, 0x80, 0x8d, 0xe2, 0x9a, 0x96,
+    0xf0, 0x9f, 0x91, 0xb1, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8,
+    0x8f, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x9a, 0x92,
+    0xf0, 0x9f, 0x87, 0xae, 0xf0, 0x9f, 0x87, 0xa9, 0xe2, 0x86, 0xa9, 0xef, 0xb8, 0x8f, 0xf0, 0x9f,
+    0xa4, 0xab, 0xf0, 0x9f, 0x8f, 0x84, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0,
+    0x9f, 0x8f, 0x99, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0x92, 0xbc, 0xe2, 0x8f, 0xaa, 0xf0, 0x9f, 0x94, 0x84, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f,
+    0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92,
+    0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x9b, 0xb9, 0xf0,
+    0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0xa6, 0xb8, 0xe2, 0x80, 0x8d,
+    0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x96, 0xbc, 0xf0, 0x9f, 0xa7, 0x9c, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2,
+    0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x9a, 0xb6, 0xf0, 0x9f, 0x8f, 0xbe,
+    0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa4, 0x9d, 0xe2,
+    0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f,
+    0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x9a, 0x96, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbb,
+    0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91,
+    0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0x94, 0xa7, 0xe2, 0x97, 0xbc, 0xf0, 0x9f, 0x9a, 0xb0, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f,
+    0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0,
+    0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0xa4, 0x9d, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x93,
+    0x89, 0xf0, 0x9f, 0xa9, 0xb8, 0xf0, 0x9f, 0x8d, 0xbd, 0xf0, 0x9f, 0x90, 0xb0, 0xf0, 0x9f, 0x92,
+    0xa5, 0xf0, 0x9f, 0xa7, 0x9b, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0,
+    0x9f, 0x92, 0xaa, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2,
+    0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2,
+    0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x91, 0xb7, 0xf0, 0x9f,
+    0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x99, 0x85, 0xf0, 0x9f, 0x8f, 0xbd,
+    0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xe2, 0x84, 0xb9, 0xe2, 0x9a, 0xbd, 0xf0,
+    0x9f, 0xa7, 0xac, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x9a,
+    0x96, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x8f, 0xb8, 0xf0, 0x9f, 0xa6, 0x98, 0xe2, 0x9b, 0xb1, 0xf0,
+    0x9f, 0x99, 0x86, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f,
+    0xf0, 0x9f, 0x92, 0x81, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f,
+    0x9f, 0xa4, 0xf0, 0x9f, 0x8d, 0xae, 0xf0, 0x9f, 0xa7, 0x96, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80,
+    0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2,
+    0x80, 0x8d, 0xf0, 0x9f, 0x8d, 0xb3, 0xf0, 0x9f, 0x8f, 0x8a, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80,
+    0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x9d, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0,
+    0x9f, 0x88, 0x82, 0xf0, 0x9f, 0x91, 0xa6, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x92, 0x86, 0xe2,
+    0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x98, 0x83, 0xf0, 0x9f, 0x91, 0xa8,
+    0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92,
+    0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x91, 0xa9,
+    0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91,
+    0xa8, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x98, 0x84, 0xf0, 0x9f, 0x91, 0xa7, 0xf0, 0x9f, 0x8f, 0xbc,
+    0xf0, 0x9f, 0x90, 0x85, 0xf0, 0x9f, 0x8f, 0x8b, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2,
+    0x99, 0x82, 0xe2, 0x9b, 0xb0, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x9b, 0xa9, 0xef, 0xb8, 0x8f, 0xf0,
+    0x9f, 0x9b, 0x81, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x9d,
+    0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0,
+    0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x87, 0xa6, 0xf0, 0x9f, 0x87, 0xbd, 0xf0, 0x9f, 0xa7, 0xbe, 0xf0,
+    0x9f, 0x92, 0x87, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f,
+    0xf0, 0x9f, 0x93, 0xa3, 0xf0, 0x9f, 0x91, 0xb7, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2,
+    0x99, 0x82, 0xf0, 0x9f, 0x91, 0xb7, 0xf0, 0x9f, 0x8f, 0x8b, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80,
+    0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xab, 0x82, 0xf0, 0x9f, 0x93, 0x96, 0xf0,
+    0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x9a, 0x92, 0xf0, 0x9f,
+    0x90, 0x98, 0xf0, 0x9f, 0x87, 0xb1, 0xf0, 0x9f, 0x87, 0xbb, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f,
+    0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0xbc, 0xf0, 0x9f, 0x9b, 0x8c, 0xf0, 0x9f, 0x8f,
+    0xbf, 0xf0, 0x9f, 0x99, 0x8b, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0,
+    0x9f, 0xa4, 0xb9, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x9a,
+    0x83, 0xf0, 0x9f, 0xa6, 0xb9, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x86, 0x95, 0xf0, 0x9f, 0xa6, 0xb2,
+    0xf0, 0x9f, 0xa6, 0xb8, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8,
+    0x8f, 0xf0, 0x9f, 0xa5, 0x83, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d,
+    0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f,
+    0x8c, 0xa1, 0xf0, 0x9f, 0x8f, 0x8c, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80,
+    0xf0, 0x9f, 0x93, 0x8b, 0xf0, 0x9f, 0xa4, 0x9d, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x8f, 0xb8, 0xf0,
+    0x9f, 0x91, 0xa7, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x8f, 0x8a, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2,
+    0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbc,
+    0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b,
+    0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x9a, 0xb6, 0xf0,
+    0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x8d, 0x9f, 0xf0, 0x9f, 0x8d,
+    0x95, 0xe2, 0x98, 0x91, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2,
+    0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xbc, 0xf0, 0x9f, 0x8e, 0x9b, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7,
+    0x91, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0xa7, 0x98, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f,
+    0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8f, 0xad, 0xf0, 0x9f, 0x91,
+    0xa8, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x9a, 0x96, 0xf0, 0x9f, 0x8d, 0x97, 0xf0,
+    0x9f, 0x92, 0x81, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x91,
+    0xa8, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8d, 0xb3, 0xf0, 0x9f, 0x92, 0xaa, 0xf0, 0x9f, 0x8f, 0xbe,
+    0xf0, 0x9f, 0x99, 0x8b, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x99, 0x8d, 0xf0, 0x9f, 0x8f, 0xbc,
+    0xf0, 0x9f, 0x9a, 0xb4, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa4,
+    0x99, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef,
+    0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91,
+    0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0xa4, 0xb2, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x90, 0x8f,
+    0xf0, 0x9f, 0x95, 0xb4, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0xa7, 0x9b, 0xf0, 0x9f, 0x8f, 0xbb,
+    0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa4, 0x8d, 0xf0, 0x9f, 0x91,
+    0xa9, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0xbc, 0xf0, 0x9f, 0xa4, 0xbe,
+    0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x98, 0xa6, 0xf0, 0x9f,
+    0x93, 0x91, 0xf0, 0x9f, 0x8f, 0x8c, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80,
+    0xf0, 0x9f, 0xa6, 0xb4, 0xf0, 0x9f, 0x92, 0x85, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x9d, 0xa4, 0xf0,
+    0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8e, 0xa4, 0xf0, 0x9f,
+    0x91, 0x86, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80,
+    0x8d, 0xf0, 0x9f, 0x8e, 0xa8, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0x8d, 0xbc, 0xf0, 0x9f, 0x91, 0xb0, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2,
+    0x99, 0x82, 0xf0, 0x9f, 0x8f, 0x84, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82,
+    0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x92, 0x81, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x80, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80,
+    0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x91, 0xb5, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0xa4,
+    0xb5, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0xa7, 0x91, 0xe2,
+    0x80, 0x8d, 0xf0, 0x9f, 0x8e, 0x93, 0xf0, 0x9f, 0x9a, 0xb5, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80,
+    0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x8e, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2,
+    0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x9a, 0xb6, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0,
+    0x9f, 0xa7, 0x85, 0xe2, 0x9c, 0xb3, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa5, 0xb1, 0xf0, 0x9f, 0x90,
+    0xbb, 0xe2, 0x86, 0x99, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xb1, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2,
+    0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0xa4, 0xb8, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d,
+    0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80,
+    0x8d, 0xf0, 0x9f, 0x92, 0xbc, 0xf0, 0x9f, 0xa7, 0x98, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d,
+    0xe2, 0x99, 0x80, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0xa6, 0xb3, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4,
+    0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f,
+    0x8f, 0x8c, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0,
+    0x9f, 0x96, 0xb2, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0x94, 0xa7, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa4,
+    0x9d, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x90, 0x94,
+    0xf0, 0x9f, 0x89, 0x90, 0xf0, 0x9f, 0xa4, 0xb6, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x91, 0xa8,
+    0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x87, 0xb8, 0xf0, 0x9f, 0x87, 0xad,
+    0xf0, 0x9f, 0xa7, 0x9c, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8,
+    0x8f, 0xf0, 0x9f, 0x91, 0xa0, 0xf0, 0x9f, 0x87, 0xb8, 0xf0, 0x9f, 0x87, 0xbf, 0xf0, 0x9f, 0x90,
+    0xb1, 0xe2, 0x9c, 0x8d, 0xf0, 0x9f, 0xa7, 0x92, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x96, 0xb6, 0xef,
+    0xb8, 0x8f, 0xf0, 0x9f, 0xa4, 0x9a, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f,
+    0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2,
+    0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x99, 0x85, 0xf0, 0x9f,
+    0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0xa6, 0x95, 0xf0, 0x9f, 0x94, 0x98,
+    0xe2, 0x99, 0xa3, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0x8a, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f,
+    0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2,
+    0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0xa7, 0x9a, 0xf0, 0x9f,
+    0x8f, 0xbf, 0xf0, 0x9f, 0x8f, 0x84, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f,
+    0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x94, 0xa7, 0xf0, 0x9f, 0xa7, 0xa2, 0xf0, 0x9f, 0x91,
+    0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa7, 0xf0,
+    0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f,
+    0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0xa7, 0x8f, 0xf0,
+    0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x8d,
+    0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0xa7, 0x98, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2,
+    0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x8f, 0x83, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d,
+    0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x92, 0x86, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0xa7, 0x9d, 0xf0, 0x9f, 0x8f, 0xbe,
+    0xf0, 0x9f, 0xa7, 0x96, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f,
+    0xa7, 0x98, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0xa9, 0xbc,
+    0xf0, 0x9f, 0xa7, 0x8d, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x87,
+    0xa8, 0xf0, 0x9f, 0x87, 0xbb, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0xa6, 0xb1, 0x38, 0xe2, 0x83, 0xa3, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbc,
+    0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b,
+    0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x91, 0xa8, 0xf0,
+    0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x94, 0xac, 0xf0, 0x9f, 0xa4, 0xbe, 0xf0, 0x9f,
+    0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x87, 0xb8, 0xf0,
+    0x9f, 0x87, 0xb3, 0xf0, 0x9f, 0x8c, 0x9a, 0xf0, 0x9f, 0x93, 0xac, 0xf0, 0x9f, 0xa6, 0xb8, 0xf0,
+    0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x92, 0xb5, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2,
+    0x80, 0x8d, 0xf0, 0x9f, 0x8f, 0xad, 0xf0, 0x9f, 0x92, 0x98, 0xe2, 0x99, 0xbb, 0xef, 0xb8, 0x8f,
+    0xf0, 0x9f, 0x97, 0xaf, 0xf0, 0x9f, 0xa7, 0x93, 0xe2, 0x9c, 0x94, 0xe2, 0x98, 0x9d, 0xf0, 0x9f,
+    0x8f, 0xbb, 0xf0, 0x9f, 0x91, 0xb0, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82,
+    0xf0, 0x9f, 0xa6, 0xb5, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbe,
+    0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8e, 0x84, 0xf0, 0x9f, 0x92, 0xb2, 0xf0, 0x9f, 0x91, 0xa9, 0xf0,
+    0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x9a, 0x95, 0xef, 0xb8, 0x8f, 0xe2, 0x8f, 0xa9, 0xe2,
+    0x9c, 0x8b, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x87, 0xba, 0xf0, 0x9f, 0x87, 0xa6, 0xf0, 0x9f,
+    0xa7, 0x9d, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x8f, 0x94,
+    0xef, 0xb8, 0x8f, 0xe2, 0x9b, 0xb9, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80,
+    0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xb7, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2,
+    0x9a, 0x95, 0xf0, 0x9f, 0xaa, 0x9e, 0xf0, 0x9f, 0xab, 0xa4, 0xf0, 0x9f, 0xa5, 0xac, 0xf0, 0x9f,
+    0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x9a, 0x96, 0xf0, 0x9f, 0x92, 0x8e,
+    0xf0, 0x9f, 0x9a, 0x84, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0xa4, 0x9d, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f,
+    0x87, 0xb9, 0xf0, 0x9f, 0x87, 0xac, 0xf0, 0x9f, 0x8f, 0xb3, 0xef, 0xb8, 0x8f, 0xe2, 0xad, 0x95,
+    0xf0, 0x9f, 0xa4, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x95, 0x89, 0xf0, 0x9f,
+    0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xb3, 0xf0, 0x9f, 0x91,
+    0xa9, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x91,
+    0xb2, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x98, 0x80, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xe2,
+    0x9c, 0x88, 0xf0, 0x9f, 0xa4, 0x8c, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x91, 0xae, 0xf0, 0x9f,
+    0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xe2, 0x8f, 0x8f, 0xef, 0xb8, 0x8f, 0xf0, 0x9f,
+    0x9b, 0xb0, 0xf0, 0x9f, 0x8f, 0x83, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80,
+    0xf0, 0x9f, 0xa7, 0x8e, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8,
+    0x8f, 0xf0, 0x9f, 0x8d, 0x9e, 0xf0, 0x9f, 0x8d, 0xb6, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f,
+    0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80,
+    0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x91, 0x90, 0xf0, 0x9f, 0x8f,
+    0xbf, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef,
+    0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x9b, 0xb7,
+    0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0x8f, 0xab, 0xf0, 0x9f, 0x94, 0x97, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80,
+    0x8d, 0xf0, 0x9f, 0xa4, 0x9d, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbc,
+    0xf0, 0x9f, 0xa5, 0x94, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0x8c, 0xbe, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x9d,
+    0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x9c, 0x8a, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0xa4,
+    0xbe, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x91, 0xa9, 0xf0,
+    0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xbc, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f,
+    0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0,
+    0x9f, 0x8f, 0xbb, 0xe2, 0x99, 0x8a, 0xf0, 0x9f, 0xa7, 0x91, 0xe2, 0x80, 0x8d, 0xe2, 0x9c, 0x88,
+    0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0x81, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x97,
+    0xa8, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x8f, 0x8a, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2,
+    0x99, 0x80, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0x91, 0xa6, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa6, 0xf0, 0x9f, 0x99, 0x8b, 0xe2,
+    0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xb0, 0xf0, 0x9f, 0x8f, 0xbd,
+    0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f,
+    0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x9c, 0x88, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xb0, 0xf0, 0x9f,
+    0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x8f, 0x8a, 0xf0,
+    0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa4, 0x9d, 0xe2, 0x80,
+    0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f,
+    0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91,
+    0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x92, 0x8f, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x91,
+    0xa9, 0xe2, 0x80, 0x8d, 0xe2, 0x9a, 0x96, 0xf0, 0x9f, 0x91, 0x9e, 0xf0, 0x9f, 0xa4, 0xb8, 0xf0,
+    0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x95, 0x96, 0xf0, 0x9f, 0x90,
+    0xa1, 0xf0, 0x9f, 0xa4, 0xa6, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef,
+    0xb8, 0x8f, 0xf0, 0x9f, 0x99, 0x8b, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82,
+    0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x87, 0xb9, 0xf0, 0x9f, 0x87, 0xad, 0xf0, 0x9f, 0x87, 0xbb, 0xf0,
+    0x9f, 0x87, 0xb3, 0xf0, 0x9f, 0xa5, 0x80, 0xf0, 0x9f, 0xa7, 0x96, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2,
+    0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x99, 0x8e, 0xf0, 0x9f, 0x8f, 0xbf,
+    0xf0, 0x9f, 0x99, 0x8e, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8,
+    0x8f, 0xf0, 0x9f, 0x93, 0xad, 0xf0, 0x9f, 0xab, 0x84, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0xa7,
+    0x91, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8f, 0xad, 0xf0, 0x9f, 0x98, 0x8c,
+    0xf0, 0x9f, 0xa7, 0x99, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8,
+    0x8f, 0xf0, 0x9f, 0x91, 0xb0, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0,
+    0x9f, 0xa4, 0xb8, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0xa4, 0xbd, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2,
+    0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbc,
+    0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b,
+    0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x8f, 0x83, 0xf0,
+    0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xe2, 0x9b, 0x84, 0xf0,
+    0x9f, 0xa4, 0xbd, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f,
+    0xf0, 0x9f, 0x9a, 0xb6, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x97, 0xbc, 0xef, 0xb8, 0x8f, 0xf0, 0x9f,
+    0xa6, 0xb8, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x91, 0xa8,
+    0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x94, 0xac, 0xf0, 0x9f, 0xa4, 0xb8, 0xf0,
+    0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x9a, 0xb4, 0xf0, 0x9f, 0x8f,
+    0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0xa7, 0x9b, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2,
+    0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0x92, 0xf0, 0x9f, 0xa7, 0x99,
+    0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xe2, 0x9a, 0x97,
+    0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xaa, 0xa5, 0xf0, 0x9f, 0xa7, 0x9f, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x9e, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8,
+    0x8f, 0xf0, 0x9f, 0xa7, 0x96, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0,
+    0x9f, 0x91, 0xb0, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f,
+    0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8,
+    0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x8f, 0xaa,
+    0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x9c, 0x88, 0xf0, 0x9f,
+    0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0xbc, 0xf0, 0x9f, 0x92,
+    0x82, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x98, 0xa7, 0xf0,
+    0x9f, 0x87, 0xa7, 0xf0, 0x9f, 0x87, 0xaf, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2,
+    0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x90, 0x95, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0xa6, 0xba, 0xf0, 0x9f, 0x93, 0x9e, 0xe2, 0x9b, 0x93, 0xf0, 0x9f, 0x90, 0xa0, 0xf0, 0x9f, 0x8f,
+    0x93, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x9a, 0xb6, 0xf0, 0x9f, 0x8f,
+    0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x91, 0xb3, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x82, 0xf0, 0x9f, 0x90, 0xae, 0xf0, 0x9f, 0xa4, 0xb9, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x87,
+    0xb0, 0xf0, 0x9f, 0x87, 0xae, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xb2,
+    0xf0, 0x9f, 0x91, 0xa4, 0xf0, 0x9f, 0x92, 0x85, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x91, 0xa8,
+    0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x9a, 0x80, 0xf0, 0x9f, 0xab, 0xb1, 0xf0,
+    0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xab, 0xb2, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f,
+    0x8c, 0x92, 0xf0, 0x9f, 0x91, 0x8a, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0xa4, 0xb9, 0xe2, 0x80,
+    0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0xa7, 0x94, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2,
+    0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xb1, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0,
+    0x9f, 0x91, 0xb1, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa8,
+    0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa4, 0x9d, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x91, 0xa8, 0xe2, 0x80, 0x8d, 0xe2, 0x9a, 0x95,
+    0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa4, 0x98, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x91, 0xa9, 0xf0,
+    0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xb2, 0xf0, 0x9f, 0x9a, 0xb6, 0xf0, 0x9f,
+    0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xe2, 0x9b, 0xb9, 0xf0, 0x9f, 0x91, 0xa9, 0xf0,
+    0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xbd, 0xf0, 0x9f, 0xa7, 0xa3, 0x39, 0xef,
+    0xb8, 0x8f, 0xe2, 0x83, 0xa3, 0xf0, 0x9f, 0x91, 0xb7, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d,
+    0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x8e, 0xa6, 0xe2, 0x98, 0x9d, 0xef, 0xb8, 0x8f,
+    0xf0, 0x9f, 0xa4, 0xbd, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f,
+    0xaa, 0x92, 0xe2, 0x8c, 0xa8, 0xf0, 0x9f, 0x8c, 0xb3, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f,
+    0xbf, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0xbb, 0xf0, 0x9f, 0x91, 0xb7, 0xf0, 0x9f, 0x8f, 0xbe,
+    0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0xa4, 0xb2, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f,
+    0xa6, 0xb8, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0,
+    0x9f, 0x92, 0x81, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f,
+    0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8e, 0x93, 0xf0,
+    0x9f, 0x99, 0x85, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f,
+    0xf0, 0x9f, 0x99, 0x86, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8,
+    0x8f, 0xf0, 0x9f, 0x8d, 0xa0, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0xa4, 0x9d, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0,
+    0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x9a, 0x96, 0xef, 0xb8, 0x8f,
+    0xf0, 0x9f, 0x99, 0x8e, 0xf0, 0x9f, 0x98, 0xb1, 0xf0, 0x9f, 0xa6, 0xb9, 0xe2, 0x80, 0x8d, 0xe2,
+    0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa6, 0xb6, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x87,
+    0xb3, 0xf0, 0x9f, 0x87, 0xbf, 0xf0, 0x9f, 0x9b, 0x9d, 0xf0, 0x9f, 0xa4, 0xb8, 0xf0, 0x9f, 0x8f,
+    0xbf, 0xf0, 0x9f, 0xa5, 0xbb, 0xf0, 0x9f, 0xaa, 0xb5, 0xf0, 0x9f, 0x8d, 0x9c, 0xf0, 0x9f, 0x9a,
+    0xb6, 0xf0, 0x9f, 0x92, 0x82, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x90, 0x8b, 0xf0,
+    0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8e, 0xa8, 0xf0, 0x9f, 0xaa, 0xac, 0xf0, 0x9f,
+    0x94, 0x8e, 0x38, 0xef, 0xb8, 0x8f, 0xe2, 0x83, 0xa3, 0xf0, 0x9f, 0x8f, 0xa0, 0xf0, 0x9f, 0xa4,
+    0x8c, 0xf0, 0x9f, 0xa4, 0xbe, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0,
+    0x9f, 0xa4, 0xad, 0xf0, 0x9f, 0xa5, 0xa3, 0xf0, 0x9f, 0xa7, 0x9c, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x82, 0xf0, 0x9f, 0xa4, 0x9d, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x96, 0xb1, 0xf0, 0x9f, 0xa7,
+    0x91, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa4, 0x9d, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0xa4, 0xb9, 0xf0, 0x9f, 0x91, 0xa8, 0xf0,
+    0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8,
+    0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0xa7, 0x97, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x99, 0xbb, 0xf0,
+    0x9f, 0x87, 0xa8, 0xf0, 0x9f, 0x87, 0xbe, 0xf0, 0x9f, 0x98, 0x91, 0xf0, 0x9f, 0x87, 0xb8, 0xf0,
+    0x9f, 0x87, 0xbb, 0xf0, 0x9f, 0x91, 0x8b, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x8e, 0x85, 0xf0,
+    0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x91, 0xa9, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x99, 0x85, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2,
+    0x99, 0x82, 0xf0, 0x9f, 0x93, 0xa2, 0xf0, 0x9f, 0x91, 0x8e, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f,
+    0x87, 0xbb, 0xf0, 0x9f, 0x87, 0xa8, 0xf0, 0x9f, 0x97, 0xb3, 0xf0, 0x9f, 0x8f, 0x84, 0xf0, 0x9f,
+    0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x98, 0xba, 0xe2,
+    0x9a, 0x96, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0xa4, 0x9d, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0,
+    0x9f, 0x8d, 0xb2, 0xf0, 0x9f, 0x99, 0x8e, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x82, 0xf0, 0x9f, 0x8f, 0x84, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f,
+    0xbd, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8e, 0xa4, 0xe2, 0x98, 0xaa, 0xef, 0xb8, 0x8f, 0xf0, 0x9f,
+    0xa7, 0x9c, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x95, 0x9b,
+    0xf0, 0x9f, 0x8f, 0x8c, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x9a, 0xb6, 0xf0, 0x9f, 0x8f, 0xbc,
+    0xe2, 0x9b, 0xb4, 0xf0, 0x9f, 0x92, 0x81, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x82, 0xf0, 0x9f, 0x87, 0xa6, 0xf0, 0x9f, 0x87, 0xb1, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f,
+    0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92,
+    0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0xab, 0x92,
+    0xf0, 0x9f, 0x99, 0x87, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8,
+    0x8f, 0xf0, 0x9f, 0x91, 0xb0, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0,
+    0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8e, 0x93, 0xf0, 0x9f,
+    0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0,
+    0x9f, 0x91, 0x89, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x9c,
+    0x88, 0xf0, 0x9f, 0x91, 0xae, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x87, 0xb9, 0xf0, 0x9f, 0x87,
+    0xa8, 0xf0, 0x9f, 0x9a, 0xb4, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0,
+    0x9f, 0x93, 0xb7, 0xf0, 0x9f, 0x97, 0xaf, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x8d, 0x82, 0xf0, 0x9f,
+    0xa7, 0x9b, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x91, 0x87, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f,
+    0xa7, 0xb4, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4,
+    0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x94, 0xb6, 0xf0,
+    0x9f, 0x91, 0xae, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f,
+    0xf0, 0x9f, 0xa6, 0xb8, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x97,
+    0x92, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x95, 0xb5, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2,
+    0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0x87, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x91,
+    0xa9, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80,
+    0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbb,
+    0xf0, 0x9f, 0x8d, 0x87, 0xf0, 0x9f, 0x8f, 0x8b, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2,
+    0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbf,
+    0xf0, 0x9f, 0xa7, 0x94, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f,
+    0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x9a, 0x80, 0xf0, 0x9f, 0x8f,
+    0x8b, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f,
+    0x8e, 0xbc, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4,
+    0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x9a, 0xb6, 0xf0,
+    0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xe2, 0x9d, 0xa4, 0xef,
+    0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x94, 0xa5, 0xf0, 0x9f, 0xa7, 0x99, 0xf0, 0x9f, 0x8f,
+    0xbc, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xb2,
+    0xf0, 0x9f, 0x99, 0x87, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f,
+    0x8f, 0x8c, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x98, 0xae, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x9a, 0xb4,
+    0xf0, 0x9f, 0xa7, 0x9a, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f,
+    0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f,
+    0xa7, 0x96, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x8e, 0xa9, 0xf0, 0x9f, 0x87, 0xbf, 0xf0, 0x9f,
+    0x87, 0xbc, 0xf0, 0x9f, 0xa4, 0x93, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80,
+    0x8d, 0xf0, 0x9f, 0xa6, 0xb2, 0xe2, 0x9a, 0xa7, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x8f, 0xf0,
+    0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa8,
+    0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x94, 0xac, 0xf0, 0x9f, 0xa6, 0xb9, 0xf0,
+    0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x8c, 0x9b,
+    0xf0, 0x9f, 0x8e, 0xa1, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0xa4, 0x9d, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f,
+    0x92, 0x93, 0xf0, 0x9f, 0x8f, 0x8a, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0,
+    0x9f, 0xa7, 0x9c, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x91,
+    0xab, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x8f, 0xb3, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0x8c, 0x88, 0xf0, 0x9f, 0x95, 0x91, 0xf0, 0x9f, 0xa4, 0xb8, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2,
+    0x80, 0x8d, 0xe2, 0x99, 0x82, 0xe2, 0x9c, 0x8b, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x99, 0x86,
+    0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x8d, 0x93, 0xf0, 0x9f, 0x85, 0xb0, 0xef, 0xb8, 0x8f, 0xf0,
+    0x9f, 0xa4, 0xbe, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x9f, 0xa2, 0xf0, 0x9f, 0x9b, 0x8f, 0xf0,
+    0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0,
+    0x9f, 0x91, 0xa8, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa7, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91,
+    0xa7, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2,
+    0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0xa6, 0xb8, 0xf0, 0x9f,
+    0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0xa7, 0x9d, 0xf0, 0x9f, 0x8f, 0xbc,
+    0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x92, 0x91, 0xf0, 0x9f, 0x8c, 0xb5, 0xf0, 0x9f,
+    0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x9a, 0x95, 0xef, 0xb8, 0x8f, 0xf0,
+    0x9f, 0x85, 0xbf, 0xf0, 0x9f, 0x90, 0xbf, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa4, 0xb7, 0xe2, 0x80,
+    0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x95, 0xb5, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2,
+    0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x8d, 0x81, 0xf0, 0x9f, 0xa7, 0xb3, 0xf0, 0x9f, 0x95,
+    0x97, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8e, 0xa8,
+    0xf0, 0x9f, 0x91, 0xaf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0xab, 0x83, 0xf0, 0x9f,
+    0x8f, 0xbb, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8f,
+    0xab, 0xf0, 0x9f, 0x98, 0x9a, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0xa6, 0xbd, 0xf0, 0x9f, 0xa4, 0xb9, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0xa7, 0x9b,
+    0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa6,
+    0xb8, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0xa7, 0x9b, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d,
+    0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80,
+    0x8d, 0xf0, 0x9f, 0xa4, 0x9d, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbf,
+    0xf0, 0x9f, 0x8e, 0x99, 0xf0, 0x9f, 0xa7, 0x99, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2,
+    0x99, 0x82, 0xf0, 0x9f, 0x8f, 0x83, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80,
+    0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x95, 0xb5, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0x88, 0xf0, 0x9f,
+    0x8f, 0xbd, 0xf0, 0x9f, 0xa4, 0xbe, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82,
+    0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x8f, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x82, 0xf0, 0x9f, 0xa7, 0x9c, 0xf0, 0x9f, 0x87, 0xb5, 0xf0, 0x9f, 0x87, 0xbc, 0xf0, 0x9f, 0x8c,
+    0x96, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef,
+    0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x92,
+    0x82, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f,
+    0xa7, 0x87, 0xf0, 0x9f, 0xa4, 0xb5, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x8f, 0x8b, 0xf0, 0x9f,
+    0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x91, 0xf0,
+    0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b,
+    0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0xa7, 0x91, 0xf0,
+    0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b,
+    0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0xa6, 0x9e, 0xf0,
+    0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa4, 0x9d, 0xe2, 0x80,
+    0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0xa6, 0x8c, 0xf0, 0x9f, 0xab,
+    0x98, 0xf0, 0x9f, 0xa7, 0x9b, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f,
+    0xbf, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xbd, 0xf0, 0x9f, 0x91, 0xa8, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0x8f, 0xab, 0xf0, 0x9f, 0x9b, 0x8c, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0xaa, 0xa8, 0xf0,
+    0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0,
+    0x9f, 0x87, 0xb8, 0xf0, 0x9f, 0x87, 0xa6, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2,
+    0x80, 0x8d, 0xf0, 0x9f, 0x8d, 0xbc, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80,
+    0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x95, 0x8c, 0xf0, 0x9f, 0x94, 0x8a, 0xf0, 0x9f,
+    0x8f, 0x8c, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0,
+    0x9f, 0x8e, 0x8e, 0xf0, 0x9f, 0xa4, 0xb5, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x95, 0xba, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x87, 0xb8,
+    0xf0, 0x9f, 0x87, 0xbd, 0xf0, 0x9f, 0xa6, 0x99, 0xf0, 0x9f, 0x97, 0xa8, 0xef, 0xb8, 0x8f, 0xe2,
+    0x98, 0xaa, 0xf0, 0x9f, 0xa7, 0x9a, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82,
+    0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa4, 0xbe, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x96, 0xaa, 0xef, 0xb8,
+    0x8f, 0xf0, 0x9f, 0xab, 0xa3, 0xf0, 0x9f, 0xa7, 0x9c, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef,
+    0xb8, 0x8f, 0xf0, 0x9f, 0xa5, 0xb7, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0xa7, 0x96, 0xf0, 0x9f,
+    0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x92, 0x8f, 0xf0, 0x9f, 0x8f, 0xbe,
+    0xf0, 0x9f, 0xa7, 0x91, 0xe2, 0x80, 0x8d, 0xe2, 0x9a, 0x96, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x87,
+    0xa8, 0xf0, 0x9f, 0x87, 0xb5, 0xf0, 0x9f, 0x92, 0xa2, 0xf0, 0x9f, 0x8d, 0xba, 0xf0, 0x9f, 0x87,
+    0xaf, 0xf0, 0x9f, 0x87, 0xb2, 0xf0, 0x9f, 0x8f, 0xb4, 0xf3, 0xa0, 0x81, 0xa7, 0xf3, 0xa0, 0x81,
+    0xa2, 0xf3, 0xa0, 0x81, 0xa5, 0xf3, 0xa0, 0x81, 0xae, 0xf3, 0xa0, 0x81, 0xa7, 0xf3, 0xa0, 0x81,
+    0xbf, 0xf0, 0x9f, 0x92, 0x82, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x8e, 0x89, 0xf0, 0x9f, 0x91,
+    0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x90,
+    0xba, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xb0,
+    0xf0, 0x9f, 0x91, 0xae, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x99,
+    0x86, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x8e, 0x84, 0xf0, 0x9f, 0xa7, 0x91, 0xf0,
+    0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xaf, 0xe2, 0x9b, 0x94, 0xf0, 0x9f, 0x91,
+    0xa8, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8d, 0xb3, 0xe2, 0xac, 0x86, 0xef,
+    0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4,
+    0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f,
+    0x8f, 0xbf, 0xf0, 0x9f, 0xa7, 0x91, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0xbc, 0xf0, 0x9f, 0x91,
+    0xb0, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xe2, 0x8f, 0xb9, 0xf0, 0x9f, 0x91,
+    0x8f, 0xf0, 0x9f, 0x91, 0xb5, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0xaa, 0xb7, 0xf0, 0x9f, 0x91,
+    0xa9, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8e, 0xa4, 0xf0, 0x9f, 0xa7, 0x91,
+    0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8e, 0xa8, 0xf0, 0x9f, 0x9a, 0xb4, 0xf0,
+    0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x87, 0xb1, 0xf0, 0x9f, 0x87,
+    0xbe, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xb1,
+    0xf0, 0x9f, 0x9b, 0x8b, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x87, 0xa7, 0xf0, 0x9f, 0x87, 0xab, 0xf0,
+    0x9f, 0xa5, 0xb7, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x95, 0x93, 0xf0, 0x9f, 0xa7, 0x9c, 0xf0,
+    0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa5, 0x85,
+    0xf0, 0x9f, 0x98, 0x88, 0xf0, 0x9f, 0xa7, 0x94, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2,
+    0x99, 0x80, 0xf0, 0x9f, 0x8f, 0x87, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0xbc, 0xef, 0xb8, 0x8f,
+    0xf0, 0x9f, 0xa7, 0x8f, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f,
+    0xaa, 0xa4, 0xf0, 0x9f, 0x91, 0x8c, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0xa7, 0x9b, 0xf0, 0x9f,
+    0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xc2, 0xa9, 0xef, 0xb8, 0x8f, 0xe2, 0x9c, 0x85,
+    0xe2, 0x9c, 0x88, 0xf0, 0x9f, 0x93, 0xa0, 0xf0, 0x9f, 0x8d, 0x86, 0xf0, 0x9f, 0xa7, 0x91, 0xf0,
+    0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x9a, 0x92, 0xf0, 0x9f, 0x91, 0xb1, 0xf0, 0x9f,
+    0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0xa7, 0x92, 0xf0, 0x9f, 0x8f, 0xbc,
+    0xf0, 0x9f, 0x87, 0xac, 0xf0, 0x9f, 0x87, 0xa7, 0xf0, 0x9f, 0xa7, 0x9c, 0xf0, 0x9f, 0x8f, 0xbd,
+    0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x8e, 0xb3, 0xf0, 0x9f, 0x94, 0xa8, 0xf0, 0x9f,
+    0x9b, 0xa3, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa4, 0xb5, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef,
+    0xb8, 0x8f, 0xe2, 0x9b, 0xb9, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef,
+    0xb8, 0x8f, 0xf0, 0x9f, 0x93, 0xa5, 0xf0, 0x9f, 0x91, 0x82, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f,
+    0x8f, 0x8a, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0,
+    0x9f, 0xa6, 0xbb, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x91, 0xb3, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2,
+    0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0xa6, 0xb5, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x91,
+    0xa9, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa4, 0x9d, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0xa7, 0x96, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2,
+    0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d,
+    0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f,
+    0x8d, 0xad, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa4,
+    0x9d, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x8f, 0x8c,
+    0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0xa4, 0xb9, 0xf0, 0x9f,
+    0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa5, 0xb4, 0xf0,
+    0x9f, 0x93, 0xaa, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0x8f, 0xab, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8c,
+    0xbe, 0xf0, 0x9f, 0x8f, 0x8a, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0,
+    0x9f, 0x92, 0x88, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x9d,
+    0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0,
+    0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x94, 0x83, 0xf0, 0x9f, 0xa7, 0x94, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2,
+    0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x9b, 0xf0, 0x9f, 0x9a, 0xa3,
+    0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91,
+    0xa9, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa4, 0x9d, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x91, 0x99, 0xf0, 0x9f, 0x9b, 0x80, 0xf0,
+    0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x93, 0xae, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2,
+    0x80, 0x8d, 0xf0, 0x9f, 0x92, 0xbb, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80,
+    0x8d, 0xf0, 0x9f, 0x8d, 0xb3, 0xf0, 0x9f, 0x9a, 0xa3, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0xa6,
+    0xa3, 0x37, 0xef, 0xb8, 0x8f, 0xe2, 0x83, 0xa3, 0xf0, 0x9f, 0xa7, 0x95, 0xf0, 0x9f, 0x8f, 0xbc,
+    0xf0, 0x9f, 0x95, 0xba, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbe,
+    0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8e, 0x93, 0xf0, 0x9f, 0xa4, 0xb9, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0x8d, 0xb3, 0xf0, 0x9f, 0x91, 0xae, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0xa7, 0x8d, 0xf0,
+    0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x8f, 0x8c,
+    0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7,
+    0x91, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa4, 0x9d, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x8f, 0xa7, 0xf0, 0x9f, 0x91, 0xa9, 0xf0,
+    0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9,
+    0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x99, 0x87, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2,
+    0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x8f, 0x8d, 0xf0, 0x9f, 0xa4, 0x9b, 0xf0, 0x9f, 0x8f,
+    0xbb, 0xf0, 0x9f, 0x87, 0xb8, 0xf0, 0x9f, 0x87, 0xb0, 0xf0, 0x9f, 0x94, 0xb3, 0xe2, 0x9a, 0x92,
+    0xe2, 0x8f, 0x8f, 0xf0, 0x9f, 0x96, 0x95, 0xf0, 0x9f, 0x8f, 0x8a, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2,
+    0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa8, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0x9a, 0x80, 0xf0, 0x9f, 0xa4, 0xb4, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0x91, 0xb0, 0xf0,
+    0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x9a,
+    0x96, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0xa6, 0xb1, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x9a,
+    0x95, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2,
+    0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0xa7,
+    0x94, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f,
+    0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x9a, 0x95, 0xef, 0xb8, 0x8f, 0xf0,
+    0x9f, 0x9a, 0xa2, 0xf0, 0x9f, 0x87, 0xb3, 0xf0, 0x9f, 0x87, 0xba, 0xe2, 0x99, 0x93, 0xf0, 0x9f,
+    0x87, 0xa8, 0xf0, 0x9f, 0x87, 0xb0, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80,
+    0x8d, 0xf0, 0x9f, 0x94, 0xac, 0xf0, 0x9f, 0x95, 0x90, 0xf0, 0x9f, 0x92, 0x91, 0xf0, 0x9f, 0x8f,
+    0xbe, 0xf0, 0x9f, 0x92, 0x86, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0,
+    0x9f, 0x99, 0x8f, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x95, 0xba, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0,
+    0x9f, 0xa4, 0xb9, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f,
+    0xf0, 0x9f, 0x95, 0xb5, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbf,
+    0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91,
+    0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x98, 0x9d, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0xab, 0xb1, 0xf0,
+    0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x8c, 0xa6, 0xf0, 0x9f, 0xa7, 0x91, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0xa6, 0xbd, 0xf0, 0x9f, 0x91, 0xa8, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0x91, 0xa7, 0xf0, 0x9f, 0x92, 0x82, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2,
+    0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa8, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8,
+    0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa6, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2,
+    0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0xa4, 0xb5, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x80, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2,
+    0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f,
+    0xbb, 0xe2, 0x86, 0x94, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x87, 0xa6, 0xf0, 0x9f, 0x87, 0xaa, 0xf0,
+    0x9f, 0x94, 0xa6, 0xf0, 0x9f, 0x8c, 0x89, 0xf0, 0x9f, 0xab, 0x84, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0,
+    0x9f, 0xa7, 0x96, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f,
+    0xf0, 0x9f, 0x9a, 0x8f, 0xf0, 0x9f, 0x95, 0xb9, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbb,
+    0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f,
+    0xbc, 0xf0, 0x9f, 0xa4, 0xbd, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef,
+    0xb8, 0x8f, 0xe2, 0x84, 0xb9, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa8, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0x91, 0xa8, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa7, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91,
+    0xa7, 0xf0, 0x9f, 0xa6, 0xa2, 0xf0, 0x9f, 0xa4, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0,
+    0x9f, 0xa4, 0xb7, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f,
+    0xf0, 0x9f, 0x8f, 0x8a, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x94, 0x99, 0xe2, 0x8f, 0xab, 0xf0,
+    0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x94, 0xa7, 0xf0, 0x9f,
+    0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2,
+    0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x91, 0xb4, 0xf0, 0x9f,
+    0x8f, 0xbd, 0xf0, 0x9f, 0x91, 0xb0, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80,
+    0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0x86, 0x99, 0xf0,
+    0x9f, 0xaa, 0x9f, 0xf0, 0x9f, 0x9a, 0xbb, 0xf0, 0x9f, 0x8f, 0x8b, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2,
+    0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x99, 0x85, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d,
+    0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xbc, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f,
+    0xa4, 0x9f, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x99, 0x87, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80,
+    0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x92, 0x81, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2,
+    0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0xa4, 0x9d, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0,
+    0x9f, 0xa7, 0x91, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8f, 0xab, 0xf0, 0x9f, 0x99, 0x8e, 0xe2, 0x80,
+    0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xe2, 0xac, 0x86, 0xf0, 0x9f, 0xa4, 0xa6, 0xf0, 0x9f,
+    0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x91, 0xf0,
+    0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8d, 0xbc, 0xf0, 0x9f, 0x9a, 0xa3, 0xf0, 0x9f,
+    0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x94, 0x9d, 0xf0, 0x9f, 0xa7, 0x97,
+    0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x95, 0xb5, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2,
+    0x99, 0x82, 0xe2, 0x98, 0xa6, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x98, 0xf0, 0x9f, 0x8f, 0xbb,
+    0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f,
+    0xbe, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa4, 0x9d, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0,
+    0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x87, 0xb0, 0xf0, 0x9f, 0x87, 0xb5, 0xf0, 0x9f, 0x91, 0xa9, 0xf0,
+    0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0,
+    0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f,
+    0x87, 0xb9, 0xf0, 0x9f, 0x87, 0xab, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80,
+    0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbe, 0xf0, 0x9f, 0xa7, 0x9f, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80,
+    0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x9d,
+    0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0,
+    0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0xa4, 0xb8, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x95,
+    0xb4, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0xa7, 0x98, 0xf0, 0x9f, 0xa7, 0x94, 0xf0, 0x9f, 0x8f,
+    0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f,
+    0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x9a, 0xb5, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80,
+    0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x98, 0x97, 0xf0, 0x9f, 0x91, 0x8c, 0xf0,
+    0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0xa7, 0x9b, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99,
+    0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x92, 0x82, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x9d, 0x84, 0xf0,
+    0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d,
+    0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0,
+    0x9f, 0x92, 0x82, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0xa7,
+    0x97, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x91, 0xa7, 0xe2, 0x98,
+    0x82, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x99, 0x8e, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2,
+    0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x8f, 0xbd, 0xe2, 0x9c, 0x8c, 0xf0, 0x9f, 0x8f, 0xbe,
+    0xf0, 0x9f, 0x8f, 0x9c, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x9b, 0xb5, 0xf0, 0x9f, 0x9a, 0xa3, 0xf0,
+    0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x9d,
+    0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x92, 0x8b, 0xe2, 0x80, 0x8d, 0xf0, 0x9f,
+    0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbd, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80,
+    0x8d, 0xf0, 0x9f, 0xa4, 0x9d, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbc,
+    0xf0, 0x9f, 0x8f, 0x8a, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f,
+    0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa6, 0xb2, 0xf0, 0x9f, 0xa7,
+    0x8f, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0xa7, 0x98, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d,
+    0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x8d, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80,
+    0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f, 0xe2, 0x97, 0x80, 0xf0, 0x9f, 0x95, 0xb5, 0xf0, 0x9f,
+    0x8f, 0xbd, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xef, 0xb8, 0x8f, 0xe2, 0x93, 0x82, 0xef, 0xb8,
+    0x8f, 0xf0, 0x9f, 0x9b, 0xa2, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0x99, 0x87, 0xf0, 0x9f, 0x8f, 0xbb,
+    0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x99, 0x86, 0xf0, 0x9f, 0x8f, 0xbb, 0xe2, 0x80,
+    0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x92, 0xaf, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbe,
+    0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91,
+    0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2,
+    0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa8, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x91,
+    0xb7, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0, 0x9f, 0x99, 0x8b, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d,
+    0xe2, 0x99, 0x80, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x9d,
+    0xa4, 0xef, 0xb8, 0x8f, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa7, 0x91, 0xf0, 0x9f, 0x8f, 0xbc, 0xf0,
+    0x9f, 0x92, 0x82, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xef, 0xb8, 0x8f,
+    0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbc, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x8d, 0xb3, 0xf0,
+    0x9f, 0x90, 0xa2, 0xf0, 0x9f, 0x8c, 0xaa, 0xef, 0xb8, 0x8f, 0xf0, 0x9f, 0xa7, 0x98, 0xe2, 0x80,
+    0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x92, 0x9e, 0xf0, 0x9f, 0xa4, 0xbd, 0xf0, 0x9f, 0x8f, 0xbf,
+    0xf0, 0x9f, 0x87, 0xb0, 0xf0, 0x9f, 0x87, 0xbf, 0xf0, 0x9f, 0xa7, 0x9d, 0xf0, 0x9f, 0x8f, 0xbf,
+    0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x8c, 0xa4, 0xf0, 0x9f, 0x99, 0x87, 0xf0, 0x9f,
+    0x8f, 0xbb, 0xf0, 0x9f, 0x91, 0xae, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x82, 0xf0, 0x9f, 0x8f, 0xb3,
+    0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbe, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0xa4, 0x9d, 0xe2,
+    0x80, 0x8d, 0xf0, 0x9f, 0x91, 0xa9, 0xf0, 0x9f, 0x8f, 0xbf, 0xf0, 0x9f, 0x93, 0x98, 0xf0, 0x9f,
+    0x99, 0x87, 0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x99, 0x80, 0xf0, 0x9f, 0x91, 0xa8,
+    0xf0, 0x9f, 0x8f, 0xbf, 0xe2, 0x80, 0x8d, 0xe2, 0x9d, 0xa4, 0xe2, 0x80, 0x8d, 0xf0, 0x9f, 0x91,
+    0xa8, 0xf0, 0x9f, 0x8f, 0xbb, 0xf0, 0x9f, 0x99, 0x82, 0xf0, 0x9f, 0xa4, 0xb3, 0xf0, 0x9f, 0x8f,
+    0xbd,
+};
+
+static std::uint32_t emoji_hash(const char *str, std::size_t len, std::uint32_t seed) {
+  std::uint32_t hash = 2166136261u ^ seed;
+  for (std::size_t i = 0; i < len; i++) {
+    hash ^= static_cast<unsigned char>(str[i]);
+    hash *= 16777619u;
+  }
+  hash ^= hash >> 15;
+  hash *= 0x2c1b3c6du;
+  hash ^= hash >> 12;
+  return hash;
+}
+
+bool is_emoji_string(const char *str, std::size_t len) {
+  if (len == 0 || len > MAX_EMOJI_LENGTH) {
+    return false;
+  }
+  std::uint32_t seed = emoji_seeds[emoji_hash(str, len, 0) % EMOJI_BUCKET_COUNT];
+  auto slot = emoji_hash(str, len, seed) % EMOJI_SLOT_COUNT;
+  std::size_t begin = emoji_offsets[slot];
+  std::size_t end = emoji_offsets[slot + 1];
+  return end - begin == len && std::memcmp(emoji_data + begin, str, len) == 0;
+}
@@ -0,0 +1,200 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2022
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <set>
+#include <string>
+#include <vector>
+
+// must be kept in sync with the hash function in the generated file
+static std::uint32_t emoji_hash(const std::string &str, std::uint32_t seed) {
+  std::uint32_t hash = 2166136261u ^ seed;
+  for (auto c : str) {
+    hash ^= static_cast<unsigned char>(c);
+    hash *= 16777619u;
+  }
+  hash ^= hash >> 15;
+  hash *= 0x2c1b3c6du;
+  hash ^= hash >> 12;
+  return hash;
+}
+
+// builds a perfect hash function using "hash and displace" scheme: keys are split into buckets by the first hash,
+// then for each bucket, starting from the biggest, a seed is found, which puts all keys of the bucket to empty slots
+static bool build_perfect_hash(const std::vector<std::string> &keys, std::size_t bucket_count, std::size_t slot_count,
+                               std::vector<std::uint32_t> &seeds, std::vector<int> &slots) {
+  std::vector<std::vector<int>> buckets(bucket_count);
+  for (std::size_t i = 0; i < keys.size(); i++) {
+    buckets[emoji_hash(keys[i], 0) % bucket_count].push_back(static_cast<int>(i));
+  }
+  std::vector<std::size_t> order(bucket_count);
+  for (std::size_t i = 0; i < bucket_count; i++) {
+    order[i] = i;
+  }
+  std::stable_sort(order.begin(), order.end(),
+                   [&](std::size_t lhs, std::size_t rhs) { return buckets[lhs].size() > buckets[rhs].size(); });
+
+  seeds.assign(bucket_count, 0);
+  slots.assign(slot_count, -1);
+  for (auto bucket_id : order) {
+    const auto &bucket = buckets[bucket_id];
+    if (bucket.empty()) {
+      break;
+    }
+    bool found = false;
+    for (std::uint32_t seed = 1; seed < 1000000 && !found; seed++) {
+      std::vector<std::size_t> bucket_slots;
+      found = true;
+      for (auto key_id : bucket) {
+        auto slot = emoji_hash(keys[key_id], seed) % slot_count;
+        if (slots[slot] != -1 || std::find(bucket_slots.begin(), bucket_slots.end(), slot) != bucket_slots.end()) {
+          found = false;
+          break;
+        }
+        bucket_slots.push_back(slot);
+      }
+      if (found) {
+        seeds[bucket_id] = seed;
+        for (std::size_t i = 0; i < bucket.size(); i++) {
+          slots[bucket_slots[i]] = bucket[i];
+        }
+      }
+    }
+    if (!found) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static const char *get_array_type(const std::vector<std::uint32_t> &values) {
+  auto max_value = *std::max_element(values.begin(), values.end());
+  return max_value <= 0xFFFF ? "std::uint16_t" : "std::uint32_t";
+}
+
+static void write_array(std::ostream &out, const char *type, const char *name, const std::vector<std::uint32_t> &values,
+                        bool is_hex) {
+  out << "static constexpr " << type << ' ' << name << "[] = {";
+  for (std::size_t i = 0; i < values.size(); i++) {
+    if (i % 16 == 0) {
+      out << "\n   ";
+    }
+    out << ' ';
+    if (is_hex) {
+      out << "0x" << std::hex << std::setw(2) << std::setfill('0') << values[i] << std::dec;
+    } else {
+      out << values[i];
+    }
+    out << ',';
+  }
+  out << "\n};\n\n";
+}
+
+int main(int argc, char *argv[]) {
+  if (argc != 3) {
+    std::cerr << "Wrong number of arguments supplied. Expected 'generate_emoji_table <emoji.txt> <emoji_table.cpp>'"
+              << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::ifstream emoji_file(argv[1], std::ios_base::binary);
+  if (!emoji_file) {
+    std::cerr << "Can't open input file \"" << argv[1] << '"' << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::vector<std::string> keys;
+  std::set<std::string> unique_keys;
+  std::size_t max_length = 0;
+  std::string line;
+  while (std::getline(emoji_file, line)) {
+    while (!line.empty() && (line.back() == '\r' || line.back() == '\n')) {
+      line.pop_back();
+    }
+    if (line.empty()) {
+      continue;
+    }
+    if (!unique_keys.insert(line).second) {
+      std::cerr << "Duplicate emoji \"" << line << '"' << std::endl;
+      return EXIT_FAILURE;
+    }
+    max_length = std::max(max_length, line.size());
+    keys.push_back(std::move(line));
+  }
+  if (keys.empty()) {
+    std::cerr << "No emoji found in \"" << argv[1] << '"' << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  auto bucket_count = keys.size() / 4 + 1;
+  auto slot_count = keys.size() + keys.size() / 8 + 1;
+  std::vector<std::uint32_t> seeds;
+  std::vector<int> slots;
+  while (!build_perfect_hash(keys, bucket_count, slot_count, seeds, slots)) {
+    slot_count += keys.size() / 16 + 1;
+  }
+
+  std::vector<std::uint32_t> offsets;
+  std::vector<std::uint32_t> data;
+  for (auto key_id : slots) {
+    offsets.push_back(static_cast<std::uint32_t>(data.size()));
+    if (key_id != -1) {
+      for (auto c : keys[key_id]) {
+        data.push_back(static_cast<unsigned char>(c));
+      }
+    }
+  }
+  offsets.push_back(static_cast<std::uint32_t>(data.size()));
+
+  // binary mode is needed to generate the same file on all platforms
+  std::ofstream out(argv[2], std::ios_base::trunc | std::ios_base::binary);
+  if (!out) {
+    std::cerr << "Can't open output file \"" << argv[2] << '"' << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  out << "// This file is automatically generated by generate_emoji_table from emoji.txt; don't edit it manually\n";
+  out << "#include <cstddef>\n";
+  out << "#include <cstdint>\n";
+  out << "#include <cstring>\n\n";
+  out << "static constexpr std::size_t MAX_EMOJI_LENGTH = " << max_length << ";\n";
+  out << "static constexpr std::size_t EMOJI_BUCKET_COUNT = " << bucket_count << ";\n";
+  out << "static constexpr std::size_t EMOJI_SLOT_COUNT = " << slot_count << ";\n\n";
+  write_array(out, get_array_type(seeds), "emoji_seeds", seeds, false);
+  write_array(out, get_array_type(offsets), "emoji_offsets", offsets, false);
+  write_array(out, "unsigned char", "emoji_data", data, true);
+
+  out << "static std::uint32_t emoji_hash(const char *str, std::size_t len, std::uint32_t seed) {\n";
+  out << "  std::uint32_t hash = 2166136261u ^ seed;\n";
+  out << "  for (std::size_t i = 0; i < len; i++) {\n";
+  out << "    hash ^= static_cast<unsigned char>(str[i]);\n";
+  out << "    hash *= 16777619u;\n";
+  out << "  }\n";
+  out << "  hash ^= hash >> 15;\n";
+  out << "  hash *= 0x2c1b3c6du;\n";
+  out << "  hash ^= hash >> 12;\n";
+  out << "  return hash;\n";
+  out << "}\n\n";
+
+  out << "bool is_emoji_string(const char *str, std::size_t len) {\n";
+  out << "  if (len == 0 || len > MAX_EMOJI_LENGTH) {\n";
+  out << "    return false;\n";
+  out << "  }\n";
+  out << "  std::uint32_t seed = emoji_seeds[emoji_hash(str, len, 0) % EMOJI_BUCKET_COUNT];\n";
+  out << "  auto slot = emoji_hash(str, len, seed) % EMOJI_SLOT_COUNT;\n";
+  out << "  std::size_t begin = emoji_offsets[slot];\n";
+  out << "  std::size_t end = emoji_offsets[slot + 1];\n";
+  out << "  return end - begin == len && std::memcmp(emoji_data + begin, str, len) == 0;\n";
+  out << "}\n";
+
+  return EXIT_SUCCESS;
+}
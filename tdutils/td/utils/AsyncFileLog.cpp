@@ -0,0 +1,177 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2022
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "td/utils/AsyncFileLog.h"
+
+#include "td/utils/common.h"
+#include "td/utils/FileLog.h"
+#include "td/utils/logging.h"
+#include "td/utils/port/sleep.h"
+#include "td/utils/port/thread.h"
+#include "td/utils/port/thread_local.h"
+#include "td/utils/Slice.h"
+#include "td/utils/SliceBuilder.h"
+#include "td/utils/ThreadSafeCounter.h"
+
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <mutex>
+
+namespace td {
+
+#if !TD_THREAD_UNSUPPORTED
+namespace detail {
+class AsyncFileLog final : public LogInterface {
+ public:
+  AsyncFileLog() = default;
+  AsyncFileLog(const AsyncFileLog &) = delete;
+  AsyncFileLog &operator=(const AsyncFileLog &) = delete;
+  AsyncFileLog(AsyncFileLog &&) = delete;
+  AsyncFileLog &operator=(AsyncFileLog &&) = delete;
+  ~AsyncFileLog() final {
+    // all messages must be written before the log is destroyed
+    is_closed_.store(true, std::memory_order_release);
+    writer_thread_.join();
+  }
+
+  Status init(string path, int64 rotate_threshold, bool redirect_stderr, size_t thread_buffer_size) {
+    TRY_STATUS(file_log_.init(std::move(path), rotate_threshold, redirect_stderr));
+    buffer_size_ = 1;
+    while (buffer_size_ < thread_buffer_size) {
+      buffer_size_ *= 2;
+    }
+    writer_thread_ = thread([this] { run_writer(); });
+    return Status::OK();
+  }
+
+  vector<string> get_file_paths() final {
+    return file_log_.get_file_paths();
+  }
+
+  void after_rotation() final {
+    // the file will be reopened by the writer thread
+    file_log_.lazy_rotate();
+  }
+
+ private:
+  struct ThreadBuffer {
+    std::atomic<bool> is_inited{false};
+    string data;
+    std::atomic<uint64> write_pos{0};  // changed only by the owner thread
+    std::atomic<uint64> read_pos{0};   // changed only by the writer thread
+    std::atomic<uint64> dropped_message_count{0};
+    char pad[TD_CONCURRENCY_PAD];
+  };
+
+  static constexpr size_t MAX_THREAD_ID = 128;
+  static constexpr int32 MAX_WRITER_SLEEP_TIME = 10000;
+
+  FileLog file_log_;
+  std::mutex file_log_mutex_;
+  size_t buffer_size_ = 0;
+  std::array<ThreadBuffer, MAX_THREAD_ID> buffers_;
+  std::atomic<bool> is_closed_{false};
+  thread writer_thread_;
+  string chunk_;
+
+  void do_append(int log_level, CSlice slice) final {
+    if (log_level == VERBOSITY_NAME(FATAL)) {
+      // the process is going to be aborted, so the message must be written immediately
+      std::lock_guard<std::mutex> guard(file_log_mutex_);
+      static_cast<LogInterface &>(file_log_).do_append(log_level, slice);
+      return;
+    }
+
+    auto thread_id = static_cast<size_t>(get_thread_id());
+    CHECK(thread_id < MAX_THREAD_ID);
+    auto &buffer = buffers_[thread_id];
+    if (!buffer.is_inited.load(std::memory_order_relaxed)) {
+      buffer.data.resize(buffer_size_);
+      buffer.is_inited.store(true, std::memory_order_release);
+    }
+
+    auto write_pos = buffer.write_pos.load(std::memory_order_relaxed);
+    auto read_pos = buffer.read_pos.load(std::memory_order_acquire);
+    if (slice.size() > buffer_size_ - static_cast<size_t>(write_pos - read_pos)) {
+      buffer.dropped_message_count.store(buffer.dropped_message_count.load(std::memory_order_relaxed) + 1,
+                                         std::memory_order_relaxed);
+      return;
+    }
+    auto offset = static_cast<size_t>(write_pos & (buffer_size_ - 1));
+    auto first_part_size = min(slice.size(), buffer_size_ - offset);
+    std::memcpy(&buffer.data[offset], slice.data(), first_part_size);
+    std::memcpy(&buffer.data[0], slice.data() + first_part_size, slice.size() - first_part_size);
+    buffer.write_pos.store(write_pos + slice.size(), std::memory_order_release);
+  }
+
+  void run_writer() {
+    int32 sleep_time = 1;
+    while (true) {
+      auto is_closed = is_closed_.load(std::memory_order_acquire);
+      if (flush_buffers()) {
+        sleep_time = 1;
+        continue;
+      }
+      if (is_closed) {
+        break;
+      }
+      usleep_for(sleep_time);
+      sleep_time = min(sleep_time * 2, MAX_WRITER_SLEEP_TIME);
+    }
+  }
+
+  // returns true, if something was written
+  bool flush_buffers() {
+    chunk_.clear();
+    uint64 dropped_message_count = 0;
+    for (auto &buffer : buffers_) {
+      if (!buffer.is_inited.load(std::memory_order_acquire)) {
+        continue;
+      }
+      dropped_message_count += buffer.dropped_message_count.exchange(0, std::memory_order_relaxed);
+
+      auto read_pos = buffer.read_pos.load(std::memory_order_relaxed);
+      auto write_pos = buffer.write_pos.load(std::memory_order_acquire);
+      if (read_pos == write_pos) {
+        continue;
+      }
+      auto size = static_cast<size_t>(write_pos - read_pos);
+      auto offset = static_cast<size_t>(read_pos & (buffer_size_ - 1));
+      auto first_part_size = min(size, buffer_size_ - offset);
+      chunk_.append(buffer.data, offset, first_part_size);
+      chunk_.append(buffer.data, 0, size - first_part_size);
+      buffer.read_pos.store(write_pos, std::memory_order_release);
+    }
+    if (dropped_message_count != 0) {
+      static auto dropped_message_counter = NamedThreadSafeCounter::get_default().get_counter("log_dropped_messages");
+      dropped_message_counter.add(static_cast<int64>(dropped_message_count));
+      chunk_ += PSTRING() << "[AsyncFileLog dropped " << dropped_message_count << " messages]\n";
+    }
+    if (chunk_.empty()) {
+      return false;
+    }
+
+    std::lock_guard<std::mutex> guard(file_log_mutex_);
+    static_cast<LogInterface &>(file_log_).do_append(VERBOSITY_NAME(PLAIN), chunk_);
+    return true;
+  }
+};
+}  // namespace detail
+#endif
+
+Result<unique_ptr<LogInterface>> AsyncFileLog::create(string path, int64 rotate_threshold, bool redirect_stderr,
+                                                      size_t thread_buffer_size) {
+#if TD_THREAD_UNSUPPORTED
+  return Status::Error("Asynchronous log requires threads");
+#else
+  auto res = make_unique<detail::AsyncFileLog>();
+  TRY_STATUS(res->init(std::move(path), rotate_threshold, redirect_stderr, thread_buffer_size));
+  return std::move(res);
+#endif
+}
+
+}  // namespace td
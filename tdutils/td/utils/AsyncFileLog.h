@@ -0,0 +1,29 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2022
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#pragma once
+
+#include "td/utils/common.h"
+#include "td/utils/logging.h"
+#include "td/utils/Status.h"
+
+namespace td {
+
+// log, which never blocks the logging threads
+// messages are copied to per-thread ring buffers and are written to the file by a dedicated thread,
+// which also performs log rotation; messages, which don't fit in the buffer, are dropped
+// number of dropped messages is written to the log and added to the "log_dropped_messages" counter
+class AsyncFileLog {
+  static constexpr int64 DEFAULT_ROTATE_THRESHOLD = 10 * (1 << 20);
+  static constexpr size_t DEFAULT_THREAD_BUFFER_SIZE = 1 << 20;
+
+ public:
+  static Result<unique_ptr<LogInterface>> create(string path, int64 rotate_threshold = DEFAULT_ROTATE_THRESHOLD,
+                                                 bool redirect_stderr = true,
+                                                 size_t thread_buffer_size = DEFAULT_THREAD_BUFFER_SIZE);
+};
+
+}  // namespace td
@@ -10,6 +10,7 @@
 #include "td/utils/common.h"
 #include "td/utils/format.h"
 #include "td/utils/logging.h"
+#include "td/utils/misc.h"
 #include "td/utils/port/detail/PollableFd.h"
 #include "td/utils/port/IoSlice.h"
 #include "td/utils/Slice.h"
@@ -99,11 +100,18 @@ BufferedFdBase<FdT>::BufferedFdBase(FdT &&fd_) : FdT(std::move(fd_)) {
 template <class FdT>
 Result<size_t> BufferedFdBase<FdT>::flush_read(size_t max_read) {
   CHECK(read_);
+  constexpr size_t MIN_READ_SIZE_HINT = 1 << 14;
+  constexpr size_t MAX_READ_SIZE_HINT = 1 << 16;
+  size_t read_size_hint = 0;
   size_t result = 0;
   while (::td::can_read_local(*this) && max_read) {
-    MutableSlice slice = read_->prepare_append();
+    MutableSlice slice = read_->prepare_append(read_size_hint);
     slice.truncate(max_read);
     TRY_RESULT(x, FdT::read(slice));
+    if (x == slice.size()) {
+      // more data is likely to be available, so read it into bigger buffers with fewer system calls
+      read_size_hint = clamp(read_size_hint * 2, MIN_READ_SIZE_HINT, MAX_READ_SIZE_HINT);
+    }
     slice.truncate(x);
     read_->confirm_append(x);
     result += x;
@@ -118,7 +126,9 @@ Result<size_t> BufferedFdBase<FdT>::flush_write() {
   write_->sync_with_writer();
   size_t result = 0;
   while (!write_->empty() && ::td::can_write_local(*this)) {
-    constexpr size_t BUF_SIZE = 20;
+    // every packet usually occupies at least one slice, so write many of them in one system call;
+    // the value must not exceed IOV_MAX, which is at least 1024 on all supported systems
+    constexpr size_t BUF_SIZE = 128;
     IoSlice buf[BUF_SIZE];
 
     auto it = write_->clone();
@@ -0,0 +1,377 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2022
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#pragma once
+
+#include "td/utils/common.h"
+#include "td/utils/logging.h"
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+namespace td {
+
+// Ordered map, which stores keys and values in sorted chunks of bounded size.
+// Search is a binary search over maximum keys of chunks followed by a binary search inside a chunk,
+// and in-order iteration is sequential access to arrays, so both are cache-friendly.
+// Order statistics are answered in O(log n) using a Fenwick tree over sizes of chunks.
+// All iterators and pointers to values are invalidated by insertion and erasure.
+template <class KeyT, class ValueT, size_t MAX_CHUNK_SIZE = 128>
+class ChunkedSortedMap {
+  static_assert(MAX_CHUNK_SIZE >= 4, "Too small chunk size");
+
+  struct Chunk {
+    vector<KeyT> keys_;
+    vector<ValueT> values_;
+  };
+
+ public:
+  class Iterator {
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = ValueT;
+    using pointer = const ValueT *;
+    using reference = const ValueT &;
+
+    Iterator() = default;
+
+    const KeyT &key() const {
+      DCHECK(!is_end());
+      return map_->chunks_[chunk_].keys_[pos_];
+    }
+
+    reference operator*() const {
+      DCHECK(!is_end());
+      return map_->chunks_[chunk_].values_[pos_];
+    }
+    pointer operator->() const {
+      return &**this;
+    }
+
+    // incrementing of the end iterator returns the end iterator
+    Iterator &operator++() {
+      if (is_end()) {
+        return *this;
+      }
+      if (++pos_ == map_->chunks_[chunk_].keys_.size()) {
+        chunk_++;
+        pos_ = 0;
+      }
+      return *this;
+    }
+
+    // decrementing of the first element returns the end iterator
+    Iterator &operator--() {
+      if (map_ == nullptr || map_->empty()) {
+        return *this;
+      }
+      if (is_end()) {
+        chunk_ = map_->chunks_.size() - 1;
+        pos_ = map_->chunks_[chunk_].keys_.size() - 1;
+        return *this;
+      }
+      if (pos_ == 0) {
+        if (chunk_ == 0) {
+          chunk_ = map_->chunks_.size();
+          return *this;
+        }
+        chunk_--;
+        pos_ = map_->chunks_[chunk_].keys_.size();
+      }
+      pos_--;
+      return *this;
+    }
+
+    bool is_end() const {
+      return map_ == nullptr || chunk_ >= map_->chunks_.size();
+    }
+
+    bool operator==(const Iterator &other) const {
+      if (is_end() || other.is_end()) {
+        return is_end() == other.is_end();
+      }
+      return map_ == other.map_ && chunk_ == other.chunk_ && pos_ == other.pos_;
+    }
+    bool operator!=(const Iterator &other) const {
+      return !(*this == other);
+    }
+
+   private:
+    friend class ChunkedSortedMap;
+
+    Iterator(const ChunkedSortedMap *map, size_t chunk, size_t pos) : map_(map), chunk_(chunk), pos_(pos) {
+      if (chunk_ < map_->chunks_.size() && pos_ == map_->chunks_[chunk_].keys_.size()) {
+        chunk_++;
+        pos_ = 0;
+      }
+    }
+
+    const ChunkedSortedMap *map_ = nullptr;
+    size_t chunk_ = 0;
+    size_t pos_ = 0;
+  };
+
+  size_t size() const {
+    return size_;
+  }
+
+  bool empty() const {
+    return size_ == 0;
+  }
+
+  void clear() {
+    chunks_.clear();
+    chunk_max_keys_.clear();
+    size_ = 0;
+    is_rank_tree_valid_ = false;
+  }
+
+  Iterator begin() const {
+    return Iterator(this, 0, 0);
+  }
+  Iterator end() const {
+    return Iterator(this, chunks_.size(), 0);
+  }
+
+  // returns iterator to the first element with key not less than the given key
+  Iterator lower_bound(const KeyT &key) const {
+    auto chunk = find_chunk(key);
+    if (chunk == chunks_.size()) {
+      return end();
+    }
+    const auto &keys = chunks_[chunk].keys_;
+    return Iterator(this, chunk, std::lower_bound(keys.begin(), keys.end(), key) - keys.begin());
+  }
+
+  // returns iterator to the first element with key greater than the given key
+  Iterator upper_bound(const KeyT &key) const {
+    auto chunk = static_cast<size_t>(std::upper_bound(chunk_max_keys_.begin(), chunk_max_keys_.end(), key) -
+                                     chunk_max_keys_.begin());
+    if (chunk == chunks_.size()) {
+      return end();
+    }
+    const auto &keys = chunks_[chunk].keys_;
+    return Iterator(this, chunk, std::upper_bound(keys.begin(), keys.end(), key) - keys.begin());
+  }
+
+  // returns iterator to the first element, for which the predicate is false,
+  // if the predicate is true for all elements before it and is false for all elements after it
+  template <class F>
+  Iterator partition_point(F &&predicate) const {
+    auto chunk_it = std::partition_point(chunks_.begin(), chunks_.end(),
+                                         [&predicate](const Chunk &chunk) { return predicate(chunk.values_.back()); });
+    if (chunk_it == chunks_.end()) {
+      return end();
+    }
+    const auto &values = chunk_it->values_;
+    return Iterator(this, static_cast<size_t>(chunk_it - chunks_.begin()),
+                    std::partition_point(values.begin(), values.end(), predicate) - values.begin());
+  }
+
+  const ValueT *find(const KeyT &key) const {
+    auto chunk = find_chunk(key);
+    if (chunk == chunks_.size()) {
+      return nullptr;
+    }
+    const auto &keys = chunks_[chunk].keys_;
+    auto it = std::lower_bound(keys.begin(), keys.end(), key);
+    if (it == keys.end() || key < *it) {
+      return nullptr;
+    }
+    return &chunks_[chunk].values_[it - keys.begin()];
+  }
+  ValueT *find(const KeyT &key) {
+    return const_cast<ValueT *>(static_cast<const ChunkedSortedMap *>(this)->find(key));
+  }
+
+  // returns number of elements with key less than the given key
+  size_t get_rank(const KeyT &key) const {
+    auto chunk = find_chunk(key);
+    if (chunk == chunks_.size()) {
+      return size_;
+    }
+    const auto &keys = chunks_[chunk].keys_;
+    return get_chunk_offset(chunk) +
+           static_cast<size_t>(std::lower_bound(keys.begin(), keys.end(), key) - keys.begin());
+  }
+
+  // returns iterator to the element with the given zero-based position or the end iterator
+  Iterator get_nth(size_t position) const {
+    if (position >= size_) {
+      return end();
+    }
+    prepare_rank_tree();
+    size_t chunk = 0;
+    size_t bit = 1;
+    while (bit * 2 <= chunks_.size()) {
+      bit *= 2;
+    }
+    for (; bit > 0; bit /= 2) {
+      if (chunk + bit <= chunks_.size() && rank_tree_[chunk + bit] <= position) {
+        chunk += bit;
+        position -= rank_tree_[chunk];
+      }
+    }
+    return Iterator(this, chunk, position);
+  }
+
+  // returns pointer to the value with the given key and whether the value was inserted
+  std::pair<ValueT *, bool> insert(KeyT key, ValueT value) {
+    if (chunks_.empty()) {
+      chunks_.emplace_back();
+      chunk_max_keys_.push_back(key);
+      is_rank_tree_valid_ = false;
+    }
+    auto chunk = find_chunk(key);
+    if (chunk == chunks_.size()) {
+      // the key is greater than all existing keys
+      chunk--;
+      chunk_max_keys_[chunk] = key;
+    }
+    auto &keys = chunks_[chunk].keys_;
+    auto pos = static_cast<size_t>(std::lower_bound(keys.begin(), keys.end(), key) - keys.begin());
+    if (pos < keys.size() && !(key < keys[pos])) {
+      return {&chunks_[chunk].values_[pos], false};
+    }
+
+    keys.insert(keys.begin() + pos, std::move(key));
+    auto &values = chunks_[chunk].values_;
+    values.insert(values.begin() + pos, std::move(value));
+    size_++;
+    update_rank_tree(chunk, true);
+
+    if (keys.size() > MAX_CHUNK_SIZE) {
+      split_chunk(chunk);
+      if (pos >= chunks_[chunk].keys_.size()) {
+        pos -= chunks_[chunk].keys_.size();
+        chunk++;
+      }
+    }
+    return {&chunks_[chunk].values_[pos], true};
+  }
+
+  // returns the erased value or ValueT() if there is no value with the given key
+  ValueT erase(const KeyT &key) {
+    auto chunk = find_chunk(key);
+    if (chunk == chunks_.size()) {
+      return ValueT();
+    }
+    auto &keys = chunks_[chunk].keys_;
+    auto it = std::lower_bound(keys.begin(), keys.end(), key);
+    if (it == keys.end() || key < *it) {
+      return ValueT();
+    }
+    auto pos = it - keys.begin();
+    auto &values = chunks_[chunk].values_;
+    auto result = std::move(values[pos]);
+    keys.erase(it);
+    values.erase(values.begin() + pos);
+    size_--;
+    update_rank_tree(chunk, false);
+
+    if (keys.empty()) {
+      chunks_.erase(chunks_.begin() + chunk);
+      chunk_max_keys_.erase(chunk_max_keys_.begin() + chunk);
+      is_rank_tree_valid_ = false;
+    } else {
+      chunk_max_keys_[chunk] = keys.back();
+      if (chunk + 1 < chunks_.size() && keys.size() + chunks_[chunk + 1].keys_.size() <= MAX_CHUNK_SIZE / 2) {
+        merge_chunks(chunk);
+      } else if (chunk > 0 && keys.size() + chunks_[chunk - 1].keys_.size() <= MAX_CHUNK_SIZE / 2) {
+        merge_chunks(chunk - 1);
+      }
+    }
+    return result;
+  }
+
+ private:
+  vector<Chunk> chunks_;
+  vector<KeyT> chunk_max_keys_;
+  size_t size_ = 0;
+
+  // Fenwick tree over sizes of chunks; it is rebuilt lazily after chunks are split, merged, added or removed
+  mutable vector<size_t> rank_tree_;
+  mutable bool is_rank_tree_valid_ = false;
+
+  void prepare_rank_tree() const {
+    if (is_rank_tree_valid_) {
+      return;
+    }
+    auto chunk_count = chunks_.size();
+    rank_tree_.assign(chunk_count + 1, 0);
+    for (size_t i = 1; i <= chunk_count; i++) {
+      rank_tree_[i] += chunks_[i - 1].keys_.size();
+      auto parent = i + (i & (~i + 1));
+      if (parent <= chunk_count) {
+        rank_tree_[parent] += rank_tree_[i];
+      }
+    }
+    is_rank_tree_valid_ = true;
+  }
+
+  void update_rank_tree(size_t chunk, bool is_added) {
+    if (!is_rank_tree_valid_) {
+      return;
+    }
+    for (auto i = chunk + 1; i < rank_tree_.size(); i += i & (~i + 1)) {
+      if (is_added) {
+        rank_tree_[i]++;
+      } else {
+        rank_tree_[i]--;
+      }
+    }
+  }
+
+  // returns total number of elements in chunks before the given chunk
+  size_t get_chunk_offset(size_t chunk) const {
+    prepare_rank_tree();
+    size_t result = 0;
+    for (auto i = chunk; i > 0; i -= i & (~i + 1)) {
+      result += rank_tree_[i];
+    }
+    return result;
+  }
+
+  // returns the first chunk, which can contain the key
+  size_t find_chunk(const KeyT &key) const {
+    return static_cast<size_t>(std::lower_bound(chunk_max_keys_.begin(), chunk_max_keys_.end(), key) -
+                               chunk_max_keys_.begin());
+  }
+
+  void split_chunk(size_t chunk) {
+    Chunk new_chunk;
+    auto &keys = chunks_[chunk].keys_;
+    auto &values = chunks_[chunk].values_;
+    auto middle = keys.size() / 2;
+    new_chunk.keys_.reserve(MAX_CHUNK_SIZE);
+    new_chunk.values_.reserve(MAX_CHUNK_SIZE);
+    std::move(keys.begin() + middle, keys.end(), std::back_inserter(new_chunk.keys_));
+    std::move(values.begin() + middle, values.end(), std::back_inserter(new_chunk.values_));
+    keys.erase(keys.begin() + middle, keys.end());
+    values.erase(values.begin() + middle, values.end());
+
+    chunk_max_keys_[chunk] = keys.back();
+    chunk_max_keys_.insert(chunk_max_keys_.begin() + chunk + 1, new_chunk.keys_.back());
+    chunks_.insert(chunks_.begin() + chunk + 1, std::move(new_chunk));
+    is_rank_tree_valid_ = false;
+  }
+
+  void merge_chunks(size_t chunk) {
+    auto &next = chunks_[chunk + 1];
+    auto &keys = chunks_[chunk].keys_;
+    auto &values = chunks_[chunk].values_;
+    std::move(next.keys_.begin(), next.keys_.end(), std::back_inserter(keys));
+    std::move(next.values_.begin(), next.values_.end(), std::back_inserter(values));
+    chunk_max_keys_[chunk] = keys.back();
+    chunks_.erase(chunks_.begin() + chunk + 1);
+    chunk_max_keys_.erase(chunk_max_keys_.begin() + chunk + 1);
+    is_rank_tree_valid_ = false;
+  }
+};
+
+}  // namespace td
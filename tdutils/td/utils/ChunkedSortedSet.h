@@ -0,0 +1,122 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2022
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#pragma once
+
+#include "td/utils/ChunkedSortedMap.h"
+#include "td/utils/common.h"
+
+#include <cstddef>
+#include <iterator>
+#include <utility>
+
+namespace td {
+
+// Ordered set with the same properties as ChunkedSortedMap
+template <class KeyT, size_t MAX_CHUNK_SIZE = 128>
+class ChunkedSortedSet {
+  using MapT = ChunkedSortedMap<KeyT, Unit, MAX_CHUNK_SIZE>;
+
+ public:
+  class Iterator {
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = KeyT;
+    using pointer = const KeyT *;
+    using reference = const KeyT &;
+
+    Iterator() = default;
+
+    reference operator*() const {
+      return it_.key();
+    }
+    pointer operator->() const {
+      return &it_.key();
+    }
+
+    Iterator &operator++() {
+      ++it_;
+      return *this;
+    }
+    Iterator &operator--() {
+      --it_;
+      return *this;
+    }
+
+    bool operator==(const Iterator &other) const {
+      return it_ == other.it_;
+    }
+    bool operator!=(const Iterator &other) const {
+      return it_ != other.it_;
+    }
+
+   private:
+    friend class ChunkedSortedSet;
+
+    explicit Iterator(typename MapT::Iterator it) : it_(std::move(it)) {
+    }
+
+    typename MapT::Iterator it_;
+  };
+
+  size_t size() const {
+    return map_.size();
+  }
+
+  bool empty() const {
+    return map_.empty();
+  }
+
+  void clear() {
+    map_.clear();
+  }
+
+  Iterator begin() const {
+    return Iterator(map_.begin());
+  }
+  Iterator end() const {
+    return Iterator(map_.end());
+  }
+
+  Iterator lower_bound(const KeyT &key) const {
+    return Iterator(map_.lower_bound(key));
+  }
+
+  Iterator upper_bound(const KeyT &key) const {
+    return Iterator(map_.upper_bound(key));
+  }
+
+  size_t count(const KeyT &key) const {
+    return map_.find(key) != nullptr;
+  }
+
+  size_t get_rank(const KeyT &key) const {
+    return map_.get_rank(key);
+  }
+
+  Iterator get_nth(size_t position) const {
+    return Iterator(map_.get_nth(position));
+  }
+
+  // returns whether the key was inserted
+  bool insert(KeyT key) {
+    return map_.insert(std::move(key), Unit()).second;
+  }
+
+  size_t erase(const KeyT &key) {
+    if (map_.find(key) == nullptr) {
+      return 0;
+    }
+    map_.erase(key);
+    return 1;
+  }
+
+ private:
+  MapT map_;
+};
+
+}  // namespace td
@@ -0,0 +1,19 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2022
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#pragma once
+
+#include "td/utils/FlatHashTable.h"
+#include "td/utils/SetNode.h"
+
+#include <functional>
+
+namespace td {
+
+template <class KeyT, class HashT = std::hash<KeyT>, class EqT = std::equal_to<KeyT>>
+using FlatHashSet = FlatHashTable<SetNode<KeyT>, HashT, EqT>;
+
+}  // namespace td
@@ -0,0 +1,399 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2022
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#pragma once
+
+#include "td/utils/common.h"
+#include "td/utils/HashTableUtils.h"
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <utility>
+
+namespace td {
+
+// Open-addressing hash table with linear probing and backward shift deletion, so no tombstones are needed.
+// Nodes are stored inline in a single array, so there is no stability of references and all iterators
+// are invalidated by insertion. Iterators except the erased one are also invalidated by erasure.
+// Keys equal to KeyT() can't be inserted.
+template <class NodeT, class HashT, class EqT>
+class FlatHashTable {
+ public:
+  using KeyT = typename NodeT::public_key_type;
+  using key_type = typename NodeT::public_key_type;
+  using value_type = typename NodeT::public_type;
+
+  class Iterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = typename NodeT::public_type;
+    using pointer = value_type *;
+    using reference = value_type &;
+
+    Iterator() = default;
+    Iterator(NodeT *it, NodeT *end) : it_(it), end_(end) {
+    }
+
+    Iterator &operator++() {
+      DCHECK(it_ != end_);
+      do {
+        ++it_;
+      } while (it_ != end_ && it_->empty());
+      return *this;
+    }
+    reference operator*() const {
+      return it_->get_public();
+    }
+    pointer operator->() const {
+      return &it_->get_public();
+    }
+
+    bool operator==(const Iterator &other) const {
+      return it_ == other.it_;
+    }
+    bool operator!=(const Iterator &other) const {
+      return it_ != other.it_;
+    }
+
+    NodeT *get_node() const {
+      return it_;
+    }
+
+   private:
+    NodeT *it_ = nullptr;
+    NodeT *end_ = nullptr;
+  };
+
+  class ConstIterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = const typename NodeT::public_type;
+    using pointer = value_type *;
+    using reference = value_type &;
+
+    ConstIterator() = default;
+    ConstIterator(Iterator it) : it_(std::move(it)) {
+    }
+
+    ConstIterator &operator++() {
+      ++it_;
+      return *this;
+    }
+    reference operator*() const {
+      return *it_;
+    }
+    pointer operator->() const {
+      return &*it_;
+    }
+
+    bool operator==(const ConstIterator &other) const {
+      return it_ == other.it_;
+    }
+    bool operator!=(const ConstIterator &other) const {
+      return it_ != other.it_;
+    }
+
+   private:
+    Iterator it_;
+  };
+
+  using iterator = Iterator;
+  using const_iterator = ConstIterator;
+
+  FlatHashTable() = default;
+  FlatHashTable(const FlatHashTable &other) {
+    assign(other);
+  }
+  FlatHashTable &operator=(const FlatHashTable &other) {
+    if (this != &other) {
+      clear();
+      assign(other);
+    }
+    return *this;
+  }
+  FlatHashTable(FlatHashTable &&other) noexcept
+      : nodes_(other.nodes_), used_node_count_(other.used_node_count_), bucket_count_(other.bucket_count_) {
+    other.nodes_ = nullptr;
+    other.used_node_count_ = 0;
+    other.bucket_count_ = 0;
+  }
+  FlatHashTable &operator=(FlatHashTable &&other) noexcept {
+    if (this != &other) {
+      clear();
+      std::swap(nodes_, other.nodes_);
+      std::swap(used_node_count_, other.used_node_count_);
+      std::swap(bucket_count_, other.bucket_count_);
+    }
+    return *this;
+  }
+  ~FlatHashTable() {
+    clear();
+  }
+
+  void swap(FlatHashTable &other) noexcept {
+    std::swap(nodes_, other.nodes_);
+    std::swap(used_node_count_, other.used_node_count_);
+    std::swap(bucket_count_, other.bucket_count_);
+  }
+
+  size_t bucket_count() const {
+    return bucket_count_;
+  }
+
+  size_t size() const {
+    return used_node_count_;
+  }
+
+  bool empty() const {
+    return used_node_count_ == 0;
+  }
+
+  Iterator begin() {
+    if (empty()) {
+      return end();
+    }
+    auto *it = nodes_;
+    while (it->empty()) {
+      ++it;
+    }
+    return Iterator(it, nodes_ + bucket_count_);
+  }
+  Iterator end() {
+    return Iterator(nodes_ + bucket_count_, nodes_ + bucket_count_);
+  }
+
+  ConstIterator begin() const {
+    return ConstIterator(const_cast<FlatHashTable *>(this)->begin());
+  }
+  ConstIterator end() const {
+    return ConstIterator(const_cast<FlatHashTable *>(this)->end());
+  }
+
+  Iterator find(const KeyT &key) {
+    auto *node = find_impl(key);
+    if (node == nullptr) {
+      return end();
+    }
+    return Iterator(node, nodes_ + bucket_count_);
+  }
+  ConstIterator find(const KeyT &key) const {
+    return ConstIterator(const_cast<FlatHashTable *>(this)->find(key));
+  }
+
+  size_t count(const KeyT &key) const {
+    return find_impl(key) != nullptr;
+  }
+
+  void reserve(size_t size) {
+    if (size == 0) {
+      return;
+    }
+    CHECK(size <= (static_cast<size_t>(1) << 29));
+    auto want_bucket_count = normalize_bucket_count(size * 5 / 3 + 1);
+    if (want_bucket_count > bucket_count_) {
+      resize(want_bucket_count);
+    }
+  }
+
+  template <class... ArgsT>
+  std::pair<Iterator, bool> emplace(KeyT key, ArgsT &&...args) {
+    CHECK(!is_hash_table_key_empty(key));
+    if (nodes_ == nullptr) {
+      resize(MIN_BUCKET_COUNT);
+    }
+    while (true) {
+      auto bucket = calc_bucket(key);
+      while (true) {
+        auto &node = nodes_[bucket];
+        if (EqT()(node.key(), key)) {
+          return {Iterator(&node, nodes_ + bucket_count_), false};
+        }
+        if (node.empty()) {
+          break;
+        }
+        next_bucket(bucket);
+      }
+      // the maximum load factor is 0.6
+      if (static_cast<size_t>(used_node_count_) * 5 >= static_cast<size_t>(bucket_count_) * 3) {
+        resize(bucket_count_ * 2);
+        continue;
+      }
+
+      auto &node = nodes_[bucket];
+      node.emplace(std::move(key), std::forward<ArgsT>(args)...);
+      used_node_count_++;
+      return {Iterator(&node, nodes_ + bucket_count_), true};
+    }
+  }
+
+  std::pair<Iterator, bool> insert(KeyT key) {
+    return emplace(std::move(key));
+  }
+
+  template <class ItT>
+  void insert(ItT begin, ItT end) {
+    for (; begin != end; ++begin) {
+      emplace(*begin);
+    }
+  }
+
+  template <class N = NodeT>
+  typename N::second_type &operator[](const KeyT &key) {
+    return emplace(key).first->second;
+  }
+
+  size_t erase(const KeyT &key) {
+    auto *node = find_impl(key);
+    if (node == nullptr) {
+      return 0;
+    }
+    erase_node(node);
+    return 1;
+  }
+
+  void erase(Iterator it) {
+    DCHECK(it != end());
+    erase_node(it.get_node());
+  }
+
+  // removes all nodes satisfying the predicate; the only way to erase nodes while iterating over the table
+  template <class F>
+  void remove_if(F &&f) {
+    if (empty()) {
+      return;
+    }
+
+    // start from the first empty bucket to not move the same node twice
+    uint32 first_empty = 0;
+    while (!nodes_[first_empty].empty()) {
+      first_empty++;
+    }
+    auto bucket = first_empty;
+    do {
+      next_bucket(bucket);
+      auto &node = nodes_[bucket];
+      // a node moved to the current bucket by erase_node must be checked too
+      while (!node.empty() && f(node.get_public())) {
+        erase_node(&node);
+      }
+    } while (bucket != first_empty);
+  }
+
+  void clear() {
+    if (nodes_ != nullptr) {
+      delete[] nodes_;
+      nodes_ = nullptr;
+      used_node_count_ = 0;
+      bucket_count_ = 0;
+    }
+  }
+
+ private:
+  static constexpr uint32 MIN_BUCKET_COUNT = 8;
+
+  NodeT *nodes_ = nullptr;
+  uint32 used_node_count_ = 0;
+  uint32 bucket_count_ = 0;
+
+  static uint32 normalize_bucket_count(size_t bucket_count) {
+    uint32 result = MIN_BUCKET_COUNT;
+    while (result < bucket_count) {
+      result *= 2;
+    }
+    return result;
+  }
+
+  uint32 calc_bucket(const KeyT &key) const {
+    return randomize_hash(HashT()(key)) & (bucket_count_ - 1);
+  }
+
+  void next_bucket(uint32 &bucket) const {
+    bucket = (bucket + 1) & (bucket_count_ - 1);
+  }
+
+  NodeT *find_impl(const KeyT &key) const {
+    if (nodes_ == nullptr || is_hash_table_key_empty(key)) {
+      return nullptr;
+    }
+    auto bucket = calc_bucket(key);
+    while (true) {
+      auto &node = nodes_[bucket];
+      if (node.empty()) {
+        return nullptr;
+      }
+      if (EqT()(node.key(), key)) {
+        return &node;
+      }
+      next_bucket(bucket);
+    }
+  }
+
+  void assign(const FlatHashTable &other) {
+    CHECK(nodes_ == nullptr);
+    if (other.empty()) {
+      return;
+    }
+    nodes_ = new NodeT[other.bucket_count_];
+    bucket_count_ = other.bucket_count_;
+    used_node_count_ = other.used_node_count_;
+    for (uint32 i = 0; i < bucket_count_; i++) {
+      if (!other.nodes_[i].empty()) {
+        nodes_[i].copy_from(other.nodes_[i]);
+      }
+    }
+  }
+
+  void resize(uint32 new_bucket_count) {
+    CHECK(new_bucket_count >= MIN_BUCKET_COUNT);
+    CHECK((new_bucket_count & (new_bucket_count - 1)) == 0);
+    auto *old_nodes = nodes_;
+    auto old_bucket_count = bucket_count_;
+
+    nodes_ = new NodeT[new_bucket_count];
+    bucket_count_ = new_bucket_count;
+    for (uint32 i = 0; i < old_bucket_count; i++) {
+      auto &old_node = old_nodes[i];
+      if (old_node.empty()) {
+        continue;
+      }
+      auto bucket = calc_bucket(old_node.key());
+      while (!nodes_[bucket].empty()) {
+        next_bucket(bucket);
+      }
+      nodes_[bucket] = std::move(old_node);
+    }
+    delete[] old_nodes;
+  }
+
+  void erase_node(NodeT *node) {
+    auto empty_bucket = static_cast<uint32>(node - nodes_);
+    nodes_[empty_bucket].clear();
+    used_node_count_--;
+
+    // move back nodes, which can't be found anymore because of the new hole in their probe sequence
+    auto bucket = empty_bucket;
+    while (true) {
+      next_bucket(bucket);
+      auto &test_node = nodes_[bucket];
+      if (test_node.empty()) {
+        break;
+      }
+      auto want_bucket = calc_bucket(test_node.key());
+      // the node can be moved only if its preferred bucket isn't in the cyclic range (empty_bucket, bucket]
+      auto distance_to_empty = (bucket - empty_bucket) & (bucket_count_ - 1);
+      auto distance_to_want = (bucket - want_bucket) & (bucket_count_ - 1);
+      if (distance_to_want >= distance_to_empty) {
+        nodes_[empty_bucket] = std::move(test_node);
+        empty_bucket = bucket;
+      }
+    }
+  }
+};
+
+}  // namespace td
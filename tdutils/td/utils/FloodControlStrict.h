@@ -8,28 +8,39 @@
 
 #include "td/utils/common.h"
 
-#include <limits>
-
 namespace td {
 
 // More strict implementaions of flood control than FloodControlFast.
-// Should be just fine for small counters.
+// Each event is processed in O(1) for each limit and memory usage is bounded by the sum of the limit counts.
 class FloodControlStrict {
  public:
   // there is no reason to return wakeup_at_, because it will be a time before the next allowed event, not current
   void add_event(int32 now) {
-    events_.push_back(Event{now});
-    if (without_update_ > 0) {
-      without_update_--;
-    } else {
-      update(now);
+    for (auto &limit : limits_) {
+      if (limit.timestamps_.size() < limit.count_) {
+        limit.timestamps_.push_back(now);
+        if (limit.timestamps_.size() < limit.count_) {
+          continue;
+        }
+      } else {
+        limit.timestamps_[limit.pos_] = now;
+        if (++limit.pos_ == limit.count_) {
+          limit.pos_ = 0;
+        }
+      }
+
+      // timestamps_[pos_] is the oldest of the last count_ events
+      auto wakeup_at = limit.timestamps_[limit.pos_] + limit.duration_;
+      if (wakeup_at >= now) {
+        wakeup_at_ = max(wakeup_at_, wakeup_at);
+      }
     }
   }
 
-  // no more than count in each duration
+  // no more than count in each duration; must be called before the first event is added
   void add_limit(int32 duration, size_t count) {
-    limits_.push_back(Limit{duration, count, 0});
-    without_update_ = 0;
+    CHECK(count > 0);
+    limits_.push_back(Limit{duration, count, 0, {}});
   }
 
   int32 get_wakeup_at() const {
@@ -37,61 +48,22 @@ class FloodControlStrict {
   }
 
   void clear_events() {
-    events_.clear();
     for (auto &limit : limits_) {
+      limit.timestamps_.clear();
       limit.pos_ = 0;
     }
-    without_update_ = 0;
     wakeup_at_ = 1;
   }
 
-  int32 update(int32 now) {
-    size_t min_pos = events_.size();
-
-    without_update_ = std::numeric_limits<size_t>::max();
-    for (auto &limit : limits_) {
-      if (limit.count_ < events_.size() - limit.pos_) {
-        limit.pos_ = events_.size() - limit.count_;
-      }
-
-      // binary-search? :D
-      while (limit.pos_ < events_.size() && events_[limit.pos_].timestamp_ + limit.duration_ < now) {
-        limit.pos_++;
-      }
-
-      if (limit.count_ + limit.pos_ <= events_.size()) {
-        CHECK(limit.count_ + limit.pos_ == events_.size());
-        wakeup_at_ = max(wakeup_at_, events_[limit.pos_].timestamp_ + limit.duration_);
-        without_update_ = 0;
-      } else {
-        without_update_ = min(without_update_, limit.count_ + limit.pos_ - events_.size() - 1);
-      }
-
-      min_pos = min(min_pos, limit.pos_);
-    }
-
-    if (min_pos * 2 > events_.size()) {
-      for (auto &limit : limits_) {
-        limit.pos_ -= min_pos;
-      }
-      events_.erase(events_.begin(), events_.begin() + min_pos);
-    }
-    return wakeup_at_;
-  }
-
  private:
   int32 wakeup_at_ = 1;
-  struct Event {
-    int32 timestamp_;
-  };
   struct Limit {
     int32 duration_;
     size_t count_;
     size_t pos_;
+    vector<int32> timestamps_;  // cyclic buffer with timestamps of the last count_ events
   };
-  size_t without_update_ = 0;
-  std::vector<Event> events_;
-  std::vector<Limit> limits_;
+  vector<Limit> limits_;
 };
 
 }  // namespace td
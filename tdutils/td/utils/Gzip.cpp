@@ -9,6 +9,8 @@
 char disable_linker_warning_about_empty_file_gzip_cpp TD_UNUSED;
 
 #if TD_HAVE_ZLIB
+#include "td/utils/as.h"
+#include "td/utils/port/thread_local.h"
 #include "td/utils/SliceBuilder.h"
 
 #include <cstring>
@@ -155,53 +157,207 @@ Gzip::~Gzip() {
 }
 
 BufferSlice gzdecode(Slice s) {
-  Gzip gzip;
-  gzip.init_decode().ensure();
-  ChainBufferWriter message;
-  gzip.set_input(s);
-  gzip.close_input();
-  double k = 2;
-  gzip.set_output(message.prepare_append(static_cast<size_t>(static_cast<double>(s.size()) * k)));
-  while (true) {
-    auto r_state = gzip.run();
-    if (r_state.is_error()) {
-      return BufferSlice();
+  static TD_THREAD_LOCAL GzipDecompressor *decompressor;
+  init_thread_local<GzipDecompressor>(decompressor);
+  return decompressor->decompress(s);
+}
+
+BufferSlice gzencode(Slice s, double max_compression_ratio) {
+  static TD_THREAD_LOCAL GzipCompressor *compressor;
+  init_thread_local<GzipCompressor>(compressor);
+  return compressor->compress(s, max_compression_ratio);
+}
+
+class GzipCompressor::Impl {
+ public:
+  z_stream stream_;
+  bool is_inited_ = false;
+  int32 compression_level_ = 6;
+
+  Impl() = default;
+  Impl(const Impl &other) = delete;
+  Impl &operator=(const Impl &other) = delete;
+  Impl(Impl &&other) = delete;
+  Impl &operator=(Impl &&other) = delete;
+  ~Impl() {
+    if (is_inited_) {
+      deflateEnd(&stream_);
     }
-    auto state = r_state.ok();
-    if (state == Gzip::State::Done) {
-      message.confirm_append(gzip.flush_output());
-      break;
+  }
+
+  bool prepare(int32 compression_level) {
+    if (!is_inited_) {
+      std::memset(&stream_, 0, sizeof(stream_));
+      stream_.zalloc = Z_NULL;
+      stream_.zfree = Z_NULL;
+      stream_.opaque = Z_NULL;
+      if (deflateInit2(&stream_, compression_level, Z_DEFLATED, 15, MAX_MEM_LEVEL, Z_DEFAULT_STRATEGY) != Z_OK) {
+        return false;
+      }
+      is_inited_ = true;
+      compression_level_ = compression_level;
+      return true;
     }
-    if (gzip.need_input()) {
-      return BufferSlice();
+    if (deflateReset(&stream_) != Z_OK) {
+      return false;
     }
-    if (gzip.need_output()) {
-      message.confirm_append(gzip.flush_output());
-      k *= 1.5;
-      gzip.set_output(message.prepare_append(static_cast<size_t>(static_cast<double>(gzip.left_input()) * k)));
+    if (compression_level != compression_level_) {
+      // the stream has no pending output after reset, so the parameters can be changed safely
+      if (deflateParams(&stream_, compression_level, Z_DEFAULT_STRATEGY) != Z_OK) {
+        return false;
+      }
+      compression_level_ = compression_level;
     }
+    return true;
   }
-  return message.extract_reader().move_as_buffer_slice();
+};
+
+GzipCompressor::GzipCompressor() : impl_(make_unique<Impl>()) {
 }
 
-BufferSlice gzencode(Slice s, double max_compression_ratio) {
-  Gzip gzip;
-  gzip.init_encode().ensure();
-  gzip.set_input(s);
-  gzip.close_input();
+GzipCompressor::GzipCompressor(GzipCompressor &&other) noexcept = default;
+
+GzipCompressor &GzipCompressor::operator=(GzipCompressor &&other) noexcept = default;
+
+GzipCompressor::~GzipCompressor() = default;
+
+BufferSlice GzipCompressor::compress(Slice s, double max_compression_ratio, int32 compression_level) {
+  CHECK(1 <= compression_level && compression_level <= 9);
+  CHECK(s.size() <= std::numeric_limits<uInt>::max());
+  if (impl_ == nullptr) {
+    impl_ = make_unique<Impl>();
+  }
+  if (!impl_->prepare(compression_level)) {
+    impl_ = nullptr;
+    return BufferSlice();
+  }
+
   auto max_size = static_cast<size_t>(static_cast<double>(s.size()) * max_compression_ratio);
   BufferWriter message{max_size};
-  gzip.set_output(message.prepare_append());
-  auto r_state = gzip.run();
-  if (r_state.is_error()) {
+  auto output = message.prepare_append();
+  output.truncate(max_size);
+  CHECK(output.size() <= std::numeric_limits<uInt>::max());
+  auto &stream = impl_->stream_;
+  stream.avail_in = static_cast<uInt>(s.size());
+  stream.next_in = reinterpret_cast<Bytef *>(const_cast<char *>(s.data()));
+  stream.avail_out = static_cast<uInt>(output.size());
+  stream.next_out = reinterpret_cast<Bytef *>(output.data());
+  auto ret = deflate(&stream, Z_FINISH);
+  auto compressed_size = output.size() - stream.avail_out;
+  stream.avail_in = 0;
+  stream.next_in = nullptr;
+  stream.avail_out = 0;
+  stream.next_out = nullptr;
+  if (ret != Z_STREAM_END) {
+    return BufferSlice();
+  }
+  message.confirm_append(compressed_size);
+  return message.as_buffer_slice();
+}
+
+class GzipDecompressor::Impl {
+ public:
+  z_stream stream_;
+  bool is_inited_ = false;
+
+  Impl() = default;
+  Impl(const Impl &other) = delete;
+  Impl &operator=(const Impl &other) = delete;
+  Impl(Impl &&other) = delete;
+  Impl &operator=(Impl &&other) = delete;
+  ~Impl() {
+    if (is_inited_) {
+      inflateEnd(&stream_);
+    }
+  }
+
+  bool prepare() {
+    if (is_inited_) {
+      return inflateReset(&stream_) == Z_OK;
+    }
+    std::memset(&stream_, 0, sizeof(stream_));
+    stream_.zalloc = Z_NULL;
+    stream_.zfree = Z_NULL;
+    stream_.opaque = Z_NULL;
+    if (inflateInit2(&stream_, MAX_WBITS + 32) != Z_OK) {
+      return false;
+    }
+    is_inited_ = true;
+    return true;
+  }
+};
+
+GzipDecompressor::GzipDecompressor() : impl_(make_unique<Impl>()) {
+}
+
+GzipDecompressor::GzipDecompressor(GzipDecompressor &&other) noexcept = default;
+
+GzipDecompressor &GzipDecompressor::operator=(GzipDecompressor &&other) noexcept = default;
+
+GzipDecompressor::~GzipDecompressor() = default;
+
+// returns expected size of decompressed data, if it is known and looks plausible, or 0 otherwise
+static size_t get_decompressed_size_hint(Slice s) {
+  // gzip stores the size modulo 2^32 in the last 4 bytes; zlib format has no such field
+  if (s.size() < 18 || static_cast<unsigned char>(s[0]) != 0x1f || static_cast<unsigned char>(s[1]) != 0x8b) {
+    return 0;
+  }
+  auto size = static_cast<size_t>(as<uint32>(s.uend() - 4));
+  // the hint can't be trusted, so it is used only if the compression ratio isn't too big
+  const size_t MAX_HINTED_COMPRESSION_RATIO = 64;
+  if (size / MAX_HINTED_COMPRESSION_RATIO > s.size()) {
+    return 0;
+  }
+  return size;
+}
+
+BufferSlice GzipDecompressor::decompress(Slice s) {
+  CHECK(s.size() <= std::numeric_limits<uInt>::max());
+  if (impl_ == nullptr) {
+    impl_ = make_unique<Impl>();
+  }
+  if (!impl_->prepare()) {
+    impl_ = nullptr;
     return BufferSlice();
   }
-  auto state = r_state.ok();
-  if (state != Gzip::State::Done) {
+
+  auto &stream = impl_->stream_;
+  stream.avail_in = static_cast<uInt>(s.size());
+  stream.next_in = reinterpret_cast<Bytef *>(const_cast<char *>(s.data()));
+
+  // if the size is known, then all data is decompressed into a single buffer, which is returned without copying
+  ChainBufferWriter message;
+  auto size_hint = get_decompressed_size_hint(s);
+  double k = 2;
+  auto output_size = size_hint != 0 ? size_hint + 1 : static_cast<size_t>(static_cast<double>(s.size()) * k);
+  bool is_ok = false;
+  while (true) {
+    auto output = message.prepare_append(output_size);
+    output.truncate(std::numeric_limits<uInt>::max());
+    stream.avail_out = static_cast<uInt>(output.size());
+    stream.next_out = reinterpret_cast<Bytef *>(output.data());
+    auto ret = inflate(&stream, Z_NO_FLUSH);
+    message.confirm_append(output.size() - stream.avail_out);
+    if (ret == Z_STREAM_END) {
+      is_ok = true;
+      break;
+    }
+    if (ret != Z_OK || (stream.avail_in == 0 && stream.avail_out != 0)) {
+      break;
+    }
+    if (stream.avail_out == 0) {
+      k *= 1.5;
+      output_size = static_cast<size_t>(static_cast<double>(stream.avail_in) * k);
+    }
+  }
+  stream.avail_in = 0;
+  stream.next_in = nullptr;
+  stream.avail_out = 0;
+  stream.next_out = nullptr;
+  if (!is_ok) {
     return BufferSlice();
   }
-  message.confirm_append(gzip.flush_output());
-  return message.as_buffer_slice();
+  return message.extract_reader().move_as_buffer_slice();
 }
 
 }  // namespace td
@@ -97,10 +97,49 @@ class Gzip {
   void swap(Gzip &other);
 };
 
+// uses zlib state cached for the current thread
 BufferSlice gzdecode(Slice s);
 
+// uses zlib state cached for the current thread
 BufferSlice gzencode(Slice s, double max_compression_ratio);
 
+// compresses independent inputs in the same format as gzencode, reusing zlib state between them
+class GzipCompressor {
+ public:
+  GzipCompressor();
+  GzipCompressor(const GzipCompressor &) = delete;
+  GzipCompressor &operator=(const GzipCompressor &) = delete;
+  GzipCompressor(GzipCompressor &&other) noexcept;
+  GzipCompressor &operator=(GzipCompressor &&other) noexcept;
+  ~GzipCompressor();
+
+  // compression_level is from 1 (fastest) to 9 (best compression)
+  // returns empty BufferSlice if the input can't be compressed with the ratio not exceeding max_compression_ratio
+  BufferSlice compress(Slice s, double max_compression_ratio, int32 compression_level = 6);
+
+ private:
+  class Impl;
+  unique_ptr<Impl> impl_;
+};
+
+// decompresses independent inputs in the same way as gzdecode, reusing zlib state between them
+class GzipDecompressor {
+ public:
+  GzipDecompressor();
+  GzipDecompressor(const GzipDecompressor &) = delete;
+  GzipDecompressor &operator=(const GzipDecompressor &) = delete;
+  GzipDecompressor(GzipDecompressor &&other) noexcept;
+  GzipDecompressor &operator=(GzipDecompressor &&other) noexcept;
+  ~GzipDecompressor();
+
+  // returns empty BufferSlice if the input is invalid
+  BufferSlice decompress(Slice s);
+
+ private:
+  class Impl;
+  unique_ptr<Impl> impl_;
+};
+
 }  // namespace td
 
 #endif
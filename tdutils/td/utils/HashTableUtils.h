@@ -0,0 +1,30 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2022
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#pragma once
+
+#include "td/utils/common.h"
+
+namespace td {
+
+// default-constructed keys are used to mark empty buckets, so they can't be stored in hash tables
+template <class KeyT>
+bool is_hash_table_key_empty(const KeyT &key) {
+  return key == KeyT();
+}
+
+// many hash functions, for example std::hash<int64>, are identity functions, so bits of the hash must be mixed
+inline uint32 randomize_hash(size_t h) {
+  auto result = static_cast<uint64>(h);
+  result ^= result >> 33;
+  result *= 0xff51afd7ed558ccdULL;
+  result ^= result >> 33;
+  result *= 0xc4ceb9fe1a85ec53ULL;
+  result ^= result >> 33;
+  return static_cast<uint32>(result);
+}
+
+}  // namespace td
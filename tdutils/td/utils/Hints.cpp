@@ -42,7 +42,11 @@ vector<string> Hints::get_words(Slice name, bool is_search) {
   auto end = name.uend();
   while (pos != end) {
     uint32 code;
-    pos = next_utf8_unsafe(pos, &code, is_search ? "get_words_search" : "get_words_add");
+    if (*pos < 0x80) {
+      code = *pos++;
+    } else {
+      pos = next_utf8_unsafe(pos, &code, is_search ? "get_words_search" : "get_words_add");
+    }
 
     code = prepare_search_character(code);
     if (code == 0) {
@@ -57,7 +61,11 @@ vector<string> Hints::get_words(Slice name, bool is_search) {
     } else {
       in_word = true;
       code = remove_diacritics(code);
-      append_utf8_character(word, code);
+      if (code < 0x80) {
+        word += static_cast<char>(code);
+      } else {
+        append_utf8_character(word, code);
+      }
     }
   }
   if (in_word) {
@@ -67,69 +75,225 @@ vector<string> Hints::get_words(Slice name, bool is_search) {
   return fix_words(std::move(words));
 }
 
-void Hints::add_word(const string &word, KeyT key, std::map<string, vector<KeyT>> &word_to_keys) {
-  vector<KeyT> &keys = word_to_keys[word];
-  CHECK(!td::contains(keys, key));
-  keys.push_back(key);
+constexpr size_t Hints::WordIndex::MIN_DELTA_KEY_COUNT;
+
+size_t Hints::WordIndex::lower_bound(Slice word) const {
+  size_t left = 0;
+  size_t right = get_word_count();
+  while (left < right) {
+    auto middle = left + (right - left) / 2;
+    if (get_word(middle) < word) {
+      left = middle + 1;
+    } else {
+      right = middle;
+    }
+  }
+  return left;
 }
 
-void Hints::delete_word(const string &word, KeyT key, std::map<string, vector<KeyT>> &word_to_keys) {
-  vector<KeyT> &keys = word_to_keys[word];
-  auto key_it = std::find(keys.begin(), keys.end(), key);
-  CHECK(key_it != keys.end());
-  if (keys.size() == 1) {
-    word_to_keys.erase(word);
-  } else {
-    CHECK(keys.size() > 1);
-    *key_it = keys.back();
-    keys.pop_back();
+size_t Hints::WordIndex::find_key(Slice word, KeyT key) const {
+  auto word_id = lower_bound(word);
+  if (word_id == get_word_count() || get_word(word_id) != word) {
+    return keys_.size();
   }
+  auto begin = keys_.begin() + key_begins_[word_id];
+  auto end = keys_.begin() + key_begins_[word_id + 1];
+  auto it = std::lower_bound(begin, end, key);
+  if (it == end || *it != key) {
+    return keys_.size();
+  }
+  auto pos = static_cast<size_t>(it - keys_.begin());
+  if (is_key_removed_[pos]) {
+    return keys_.size();
+  }
+  return pos;
 }
 
-void Hints::add(KeyT key, Slice name) {
-  // LOG(ERROR) << "Add " << key << ": " << name;
-  auto it = key_to_name_.find(key);
-  if (it != key_to_name_.end()) {
-    if (it->second == name) {
+void Hints::WordIndex::add(const string &word, KeyT key) {
+  CHECK(find_key(word, key) == keys_.size());
+  vector<KeyT> &keys = delta_[word];
+  DCHECK(!td::contains(keys, key));  // the check is linear in the number of keys of the word
+  keys.push_back(key);
+  delta_key_count_++;
+
+  if (delta_key_count_ > td::max(MIN_DELTA_KEY_COUNT, keys_.size() / 4)) {
+    rebuild();
+  }
+}
+
+void Hints::WordIndex::remove(const string &word, KeyT key) {
+  auto it = delta_.find(word);
+  if (it != delta_.end()) {
+    auto &keys = it->second;
+    auto key_it = std::find(keys.begin(), keys.end(), key);
+    if (key_it != keys.end()) {
+      if (keys.size() == 1) {
+        delta_.erase(it);
+      } else {
+        *key_it = keys.back();
+        keys.pop_back();
+      }
+      delta_key_count_--;
       return;
     }
-    vector<string> old_transliterations;
-    for (auto &old_word : get_words(it->second, false)) {
-      delete_word(old_word, key, word_to_keys_);
+  }
+
+  auto pos = find_key(word, key);
+  CHECK(pos != keys_.size());
+  is_key_removed_[pos] = true;
+  removed_key_count_++;
+
+  if (removed_key_count_ > td::max(MIN_DELTA_KEY_COUNT, keys_.size() / 4)) {
+    rebuild();
+  }
+}
+
+void Hints::WordIndex::rebuild() {
+  string new_words;
+  vector<uint32> new_word_begins;
+  vector<uint32> new_key_begins;
+  vector<KeyT> new_keys;
+  new_words.reserve(words_.size());
+  new_word_begins.reserve(get_word_count() + delta_.size() + 1);
+  new_key_begins.reserve(get_word_count() + delta_.size() + 1);
+  new_keys.reserve(keys_.size() - removed_key_count_ + delta_key_count_);
 
-      for (auto &w : get_word_transliterations(old_word, false)) {
-        if (w != old_word) {
-          old_transliterations.push_back(std::move(w));
-        }
+  auto add_word = [&](Slice word) {
+    new_word_begins.push_back(narrow_cast<uint32>(new_words.size()));
+    new_key_begins.push_back(narrow_cast<uint32>(new_keys.size()));
+    new_words.append(word.begin(), word.size());
+  };
+  auto add_keys = [&](size_t word_id) {
+    for (auto i = key_begins_[word_id]; i < key_begins_[word_id + 1]; i++) {
+      if (!is_key_removed_[i]) {
+        new_keys.push_back(keys_[i]);
       }
     }
-    for (auto &word : fix_words(old_transliterations)) {
-      delete_word(word, key, translit_word_to_keys_);
+  };
+  auto finish_word = [&] {
+    std::sort(new_keys.begin() + new_key_begins.back(), new_keys.end());
+    if (new_keys.size() == new_key_begins.back()) {
+      // all keys of the word were removed
+      new_words.resize(new_word_begins.back());
+      new_word_begins.pop_back();
+      new_key_begins.pop_back();
     }
+  };
+
+  // merge sorted words from the arrays with sorted words from the delta
+  auto word_count = get_word_count();
+  size_t word_id = 0;
+  auto delta_it = delta_.begin();
+  while (word_id < word_count || delta_it != delta_.end()) {
+    if (delta_it == delta_.end() || (word_id < word_count && get_word(word_id) < Slice(delta_it->first))) {
+      add_word(get_word(word_id));
+      add_keys(word_id);
+      word_id++;
+    } else {
+      add_word(delta_it->first);
+      if (word_id < word_count && get_word(word_id) == Slice(delta_it->first)) {
+        add_keys(word_id);
+        word_id++;
+      }
+      append(new_keys, delta_it->second);
+      ++delta_it;
+    }
+    finish_word();
   }
-  if (name.empty()) {
-    if (it != key_to_name_.end()) {
-      key_to_name_.erase(it);
+  new_word_begins.push_back(narrow_cast<uint32>(new_words.size()));
+  new_key_begins.push_back(narrow_cast<uint32>(new_keys.size()));
+
+  words_ = std::move(new_words);
+  word_begins_ = std::move(new_word_begins);
+  key_begins_ = std::move(new_key_begins);
+  keys_ = std::move(new_keys);
+  is_key_removed_.assign(keys_.size(), false);
+  removed_key_count_ = 0;
+  delta_.clear();
+  delta_key_count_ = 0;
+}
+
+void Hints::WordIndex::add_search_results(vector<KeyT> &results, Slice prefix) const {
+  auto word_count = get_word_count();
+  for (auto word_id = lower_bound(prefix); word_id < word_count && begins_with(get_word(word_id), prefix);
+       word_id++) {
+    for (auto i = key_begins_[word_id]; i < key_begins_[word_id + 1]; i++) {
+      if (!is_key_removed_[i]) {
+        results.push_back(keys_[i]);
+      }
     }
-    key_to_rating_.erase(key);
-    return;
   }
 
-  vector<string> transliterations;
-  for (auto &word : get_words(name, false)) {
-    add_word(word, key, word_to_keys_);
+  auto it = delta_.lower_bound(prefix.str());
+  while (it != delta_.end() && begins_with(it->first, prefix)) {
+    append(results, it->second);
+    ++it;
+  }
+}
 
+void Hints::get_name_words(Slice name, vector<string> &words, vector<string> &transliterations) {
+  words = get_words(name, false);
+  transliterations.clear();
+  for (auto &word : words) {
     for (auto &w : get_word_transliterations(word, false)) {
       if (w != word) {
         transliterations.push_back(std::move(w));
       }
     }
   }
-  for (auto &word : fix_words(transliterations)) {
-    add_word(word, key, translit_word_to_keys_);
+  transliterations = fix_words(std::move(transliterations));
+}
+
+void Hints::update_word_index(WordIndex &index, const vector<string> &old_words, const vector<string> &new_words,
+                              KeyT key) {
+  // both lists are sorted, so only the words, which actually changed, are removed from or added to the index
+  size_t old_pos = 0;
+  size_t new_pos = 0;
+  while (old_pos != old_words.size() || new_pos != new_words.size()) {
+    if (new_pos == new_words.size() || (old_pos != old_words.size() && old_words[old_pos] < new_words[new_pos])) {
+      index.remove(old_words[old_pos++], key);
+    } else if (old_pos == old_words.size() || new_words[new_pos] < old_words[old_pos]) {
+      index.add(new_words[new_pos++], key);
+    } else {
+      old_pos++;
+      new_pos++;
+    }
+  }
+}
+
+void Hints::add(KeyT key, Slice name) {
+  // LOG(ERROR) << "Add " << key << ": " << name;
+  vector<string> old_words;
+  vector<string> old_transliterations;
+  auto it = key_to_name_.find(key);
+  if (it != key_to_name_.end()) {
+    if (it->second == name) {
+      return;
+    }
+    get_name_words(it->second, old_words, old_transliterations);
   }
 
-  key_to_name_[key] = name.str();
+  vector<string> new_words;
+  vector<string> new_transliterations;
+  if (!name.empty()) {
+    get_name_words(name, new_words, new_transliterations);
+  }
+  update_word_index(word_to_keys_, old_words, new_words, key);
+  update_word_index(translit_word_to_keys_, old_transliterations, new_transliterations, key);
+
+  if (name.empty()) {
+    if (it != key_to_name_.end()) {
+      key_to_name_.erase(it);
+    }
+    key_to_rating_.erase(key);
+    return;
+  }
+
+  if (it != key_to_name_.end()) {
+    it->second = name.str();
+  } else {
+    key_to_name_.emplace(key, name.str());
+  }
 }
 
 void Hints::set_rating(KeyT key, RatingT rating) {
@@ -137,21 +301,12 @@ void Hints::set_rating(KeyT key, RatingT rating) {
   key_to_rating_[key] = rating;
 }
 
-void Hints::add_search_results(vector<KeyT> &results, const string &word,
-                               const std::map<string, vector<KeyT>> &word_to_keys) {
-  LOG(DEBUG) << "Search for word " << word;
-  auto it = word_to_keys.lower_bound(word);
-  while (it != word_to_keys.end() && begins_with(it->first, word)) {
-    results.insert(results.end(), it->second.begin(), it->second.end());
-    ++it;
-  }
-}
-
 vector<Hints::KeyT> Hints::search_word(const string &word) const {
   vector<KeyT> results;
-  add_search_results(results, word, translit_word_to_keys_);
+  LOG(DEBUG) << "Search for word " << word;
+  translit_word_to_keys_.add_search_results(results, word);
   for (const auto &w : get_word_transliterations(word, true)) {
-    add_search_results(results, w, word_to_keys_);
+    word_to_keys_.add_search_results(results, w);
   }
 
   td::unique(results);
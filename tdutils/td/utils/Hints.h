@@ -42,20 +42,62 @@ class Hints {
   size_t size() const;
 
  private:
-  std::map<string, vector<KeyT>> word_to_keys_;
-  std::map<string, vector<KeyT>> translit_word_to_keys_;
+  // Maps words to keys and allows to find keys of all words with a given prefix.
+  // Most words are stored in sorted arrays without per-word allocations. Recently added words are kept
+  // in a small map, which is merged into the arrays, when it becomes big enough.
+  class WordIndex {
+   public:
+    void add(const string &word, KeyT key);
+
+    void remove(const string &word, KeyT key);
+
+    void add_search_results(vector<KeyT> &results, Slice prefix) const;
+
+   private:
+    static constexpr size_t MIN_DELTA_KEY_COUNT = 1000;
+
+    // sorted distinct words concatenated together; the word i is in [word_begins_[i], word_begins_[i + 1])
+    string words_;
+    vector<uint32> word_begins_;
+    // sorted keys of the word i are in [key_begins_[i], key_begins_[i + 1]); removed keys are only marked as removed
+    vector<uint32> key_begins_;
+    vector<KeyT> keys_;
+    vector<bool> is_key_removed_;
+    size_t removed_key_count_ = 0;
+
+    std::map<string, vector<KeyT>> delta_;
+    size_t delta_key_count_ = 0;
+
+    size_t get_word_count() const {
+      return key_begins_.empty() ? 0 : key_begins_.size() - 1;
+    }
+
+    Slice get_word(size_t word_id) const {
+      return Slice(words_).substr(word_begins_[word_id], word_begins_[word_id + 1] - word_begins_[word_id]);
+    }
+
+    // returns the first word not less than the given word
+    size_t lower_bound(Slice word) const;
+
+    // returns position of the key in keys_ or keys_.size() if the key isn't found
+    size_t find_key(Slice word, KeyT key) const;
+
+    void rebuild();
+  };
+
+  WordIndex word_to_keys_;
+  WordIndex translit_word_to_keys_;
   std::unordered_map<KeyT, string> key_to_name_;
   std::unordered_map<KeyT, RatingT> key_to_rating_;
 
-  static void add_word(const string &word, KeyT key, std::map<string, vector<KeyT>> &word_to_keys);
-  static void delete_word(const string &word, KeyT key, std::map<string, vector<KeyT>> &word_to_keys);
-
   static vector<string> fix_words(vector<string> words);
 
   static vector<string> get_words(Slice name, bool is_search);
 
-  static void add_search_results(vector<KeyT> &results, const string &word,
-                                 const std::map<string, vector<KeyT>> &word_to_keys);
+  static void get_name_words(Slice name, vector<string> &words, vector<string> &transliterations);
+
+  static void update_word_index(WordIndex &index, const vector<string> &old_words, const vector<string> &new_words,
+                                KeyT key);
 
   vector<KeyT> search_word(const string &word) const;
 
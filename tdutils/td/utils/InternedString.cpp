@@ -0,0 +1,61 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2022
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "td/utils/InternedString.h"
+
+#include "td/utils/FlatHashMap.h"
+#include "td/utils/port/thread_local.h"
+
+namespace td {
+
+using InternedStringPool = FlatHashMap<Slice, detail::InternedStringNode *, SliceHash>;
+
+// keys point to the strings owned by the nodes, nodes are owned by the InternedString objects
+static TD_THREAD_LOCAL InternedStringPool *interned_string_pool;
+
+InternedString::InternedString(Slice str) {
+  if (str.empty()) {
+    return;
+  }
+  init_thread_local<InternedStringPool>(interned_string_pool);
+  auto it = interned_string_pool->find(str);
+  if (it != interned_string_pool->end()) {
+    node_ = it->second;
+    node_->ref_cnt_++;
+    return;
+  }
+  node_ = new detail::InternedStringNode();
+  node_->str_ = str.str();
+  interned_string_pool->emplace(Slice(node_->str_), node_);
+}
+
+const string &InternedString::str() const {
+  static const string empty_string;
+  if (node_ == nullptr) {
+    return empty_string;
+  }
+  return node_->str_;
+}
+
+size_t InternedString::get_interned_string_count() {
+  if (interned_string_pool == nullptr) {
+    return 0;
+  }
+  return interned_string_pool->size();
+}
+
+void InternedString::destroy_node(detail::InternedStringNode *node) {
+  // the pool could have been already destroyed together with other thread local objects
+  if (interned_string_pool != nullptr) {
+    auto it = interned_string_pool->find(Slice(node->str_));
+    if (it != interned_string_pool->end() && it->second == node) {
+      interned_string_pool->erase(it);
+    }
+  }
+  delete node;
+}
+
+}  // namespace td
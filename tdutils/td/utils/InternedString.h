@@ -0,0 +1,124 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2022
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#pragma once
+
+#include "td/utils/common.h"
+#include "td/utils/Slice.h"
+#include "td/utils/StringBuilder.h"
+
+#include <utility>
+
+namespace td {
+
+namespace detail {
+struct InternedStringNode {
+  string str_;
+  uint32 ref_cnt_ = 1;
+};
+}  // namespace detail
+
+// Immutable string, which shares its storage with all equal strings interned by the same thread.
+// The storage is reference counted and is freed as soon as the last copy is destroyed.
+// Takes one pointer, which is null for the empty string. Must be used and destroyed only by the thread,
+// which created it, so it is intended for per-scheduler objects, like cached users and chats.
+class InternedString {
+ public:
+  InternedString() = default;
+
+  explicit InternedString(Slice str);
+
+  InternedString(const InternedString &other) : node_(other.node_) {
+    if (node_ != nullptr) {
+      node_->ref_cnt_++;
+    }
+  }
+  InternedString &operator=(const InternedString &other) {
+    InternedString copy(other);
+    std::swap(node_, copy.node_);
+    return *this;
+  }
+  InternedString(InternedString &&other) noexcept : node_(other.node_) {
+    other.node_ = nullptr;
+  }
+  InternedString &operator=(InternedString &&other) noexcept {
+    std::swap(node_, other.node_);
+    return *this;
+  }
+  ~InternedString() {
+    clear();
+  }
+
+  void clear() {
+    if (node_ != nullptr) {
+      CHECK(node_->ref_cnt_ > 0);
+      if (--node_->ref_cnt_ == 0) {
+        destroy_node(node_);
+      }
+      node_ = nullptr;
+    }
+  }
+
+  bool empty() const {
+    return node_ == nullptr;
+  }
+
+  size_t size() const {
+    return str().size();
+  }
+
+  const string &str() const;
+
+  Slice as_slice() const {
+    return str();
+  }
+
+  // returns number of distinct strings interned by the current thread
+  static size_t get_interned_string_count();
+
+  friend bool operator==(const InternedString &lhs, const InternedString &rhs) {
+    return lhs.node_ == rhs.node_;
+  }
+  friend bool operator==(const InternedString &lhs, Slice rhs) {
+    return lhs.as_slice() == rhs;
+  }
+  friend bool operator==(Slice lhs, const InternedString &rhs) {
+    return lhs == rhs.as_slice();
+  }
+
+ private:
+  detail::InternedStringNode *node_ = nullptr;
+
+  static void destroy_node(detail::InternedStringNode *node);
+};
+
+inline bool operator!=(const InternedString &lhs, const InternedString &rhs) {
+  return !(lhs == rhs);
+}
+
+inline bool operator!=(const InternedString &lhs, Slice rhs) {
+  return !(lhs == rhs);
+}
+
+inline bool operator!=(Slice lhs, const InternedString &rhs) {
+  return !(lhs == rhs);
+}
+
+inline StringBuilder &operator<<(StringBuilder &string_builder, const InternedString &str) {
+  return string_builder << str.as_slice();
+}
+
+template <class StorerT>
+void store(const InternedString &str, StorerT &storer) {
+  storer.store_string(str.as_slice());
+}
+
+template <class ParserT>
+void parse(InternedString &str, ParserT &parser) {
+  str = InternedString(parser.template fetch_string<Slice>());
+}
+
+}  // namespace td
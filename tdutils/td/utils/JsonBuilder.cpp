@@ -6,14 +6,51 @@
 //
 #include "td/utils/JsonBuilder.h"
 
+#include "td/utils/bits.h"
 #include "td/utils/misc.h"
 #include "td/utils/ScopeGuard.h"
 #include "td/utils/SliceBuilder.h"
 
 #include <cstring>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define TD_JSON_SSE2 1
+#include <emmintrin.h>
+#endif
+
 namespace td {
 
+// returns length of the longest prefix, which can be copied to a JSON string as is
+template <bool escape_non_ascii>
+static size_t get_json_string_safe_prefix_length(const char *s, size_t len) {
+  size_t pos = 0;
+#if TD_JSON_SSE2
+  const __m128i min_safe = _mm_set1_epi8(0x20);
+  const __m128i quote = _mm_set1_epi8('"');
+  const __m128i backslash = _mm_set1_epi8('\\');
+  for (; pos + 16 <= len; pos += 16) {
+    auto block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + pos));
+    // as signed bytes, non-ASCII characters are less than 0x20 too
+    auto is_unsafe = _mm_cmplt_epi8(block, min_safe);
+    if (!escape_non_ascii) {
+      is_unsafe = _mm_andnot_si128(_mm_cmplt_epi8(block, _mm_setzero_si128()), is_unsafe);
+    }
+    is_unsafe = _mm_or_si128(is_unsafe, _mm_or_si128(_mm_cmpeq_epi8(block, quote), _mm_cmpeq_epi8(block, backslash)));
+    auto mask = _mm_movemask_epi8(is_unsafe);
+    if (mask != 0) {
+      return pos + count_trailing_zeroes32(static_cast<uint32>(mask));
+    }
+  }
+#endif
+  for (; pos < len; pos++) {
+    auto ch = static_cast<unsigned char>(s[pos]);
+    if (ch < 0x20 || ch == '"' || ch == '\\' || (escape_non_ascii && ch >= 0x80)) {
+      break;
+    }
+  }
+  return pos;
+}
+
 StringBuilder &operator<<(StringBuilder &sb, const JsonRawString &val) {
   sb << '"';
   SCOPE_EXIT {
@@ -23,6 +60,15 @@ StringBuilder &operator<<(StringBuilder &sb, const JsonRawString &val) {
   auto len = val.value_.size();
 
   for (size_t pos = 0; pos < len; pos++) {
+    auto safe_length = get_json_string_safe_prefix_length<false>(s + pos, len - pos);
+    if (safe_length != 0) {
+      sb << Slice(s + pos, safe_length);
+      pos += safe_length;
+      if (pos == len) {
+        break;
+      }
+    }
+
     auto ch = static_cast<unsigned char>(s[pos]);
     switch (ch) {
       case '"':
@@ -67,6 +113,15 @@ StringBuilder &operator<<(StringBuilder &sb, const JsonString &val) {
   auto len = val.str_.size();
 
   for (size_t pos = 0; pos < len; pos++) {
+    auto safe_length = get_json_string_safe_prefix_length<true>(s + pos, len - pos);
+    if (safe_length != 0) {
+      sb << Slice(s + pos, safe_length);
+      pos += safe_length;
+      if (pos == len) {
+        break;
+      }
+    }
+
     auto ch = static_cast<unsigned char>(s[pos]);
     switch (ch) {
       case '"':
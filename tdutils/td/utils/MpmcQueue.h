@@ -19,6 +19,7 @@
 
 #include <array>
 #include <atomic>
+#include <vector>
 
 namespace td {
 
@@ -458,4 +459,121 @@ class MpmcQueue {
   //Got pad in HazardPointers
 };
 
+// Bounded MPMC ring buffer with a sequence number in every cell.
+// The capacity is rounded up to a power of two. Push fails instead of blocking when the queue is full.
+// Batch operations claim several consecutive cells at once with a single CAS, so producers and consumers
+// that move values in batches contend on the shared positions only once per batch.
+template <class T>
+class MpmcBoundedQueue {
+ public:
+  explicit MpmcBoundedQueue(size_t capacity) {
+    size_t size = 2;
+    while (size < capacity) {
+      size *= 2;
+    }
+    capacity_mask_ = size - 1;
+    cells_ = std::vector<Cell>(size);
+    for (size_t i = 0; i < size; i++) {
+      cells_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+  static std::string get_description() {
+    return "Bounded Mpmc queue (ring buffer with sequence numbers)";
+  }
+
+  MpmcBoundedQueue(const MpmcBoundedQueue &other) = delete;
+  MpmcBoundedQueue &operator=(const MpmcBoundedQueue &other) = delete;
+  MpmcBoundedQueue(MpmcBoundedQueue &&other) = delete;
+  MpmcBoundedQueue &operator=(MpmcBoundedQueue &&other) = delete;
+  ~MpmcBoundedQueue() = default;
+
+  size_t capacity() const {
+    return capacity_mask_ + 1;
+  }
+
+  bool try_push(T &value) {
+    return try_push_batch(&value, 1) == 1;
+  }
+  bool try_push(T &&value) {
+    return try_push(value);
+  }
+
+  bool try_pop(T &value) {
+    return try_pop_batch(&value, 1) == 1;
+  }
+
+  // moves up to count values to the queue; returns number of pushed values, which may be 0 if the queue is full
+  size_t try_push_batch(T *values, size_t count) {
+    auto pos = push_pos_.load(std::memory_order_relaxed);
+    while (true) {
+      auto ready = count_ready_cells(pos, 0, count);
+      if (ready == 0) {
+        auto new_pos = push_pos_.load(std::memory_order_relaxed);
+        if (new_pos == pos) {
+          return 0;
+        }
+        pos = new_pos;
+        continue;
+      }
+      if (push_pos_.compare_exchange_weak(pos, pos + ready, std::memory_order_relaxed)) {
+        for (size_t i = 0; i < ready; i++) {
+          auto &cell = cells_[(pos + i) & capacity_mask_];
+          cell.value = std::move(values[i]);
+          cell.sequence.store(pos + i + 1, std::memory_order_release);
+        }
+        return ready;
+      }
+    }
+  }
+
+  // moves up to max_count values from the queue; returns number of popped values, which may be 0 if the queue is empty
+  size_t try_pop_batch(T *values, size_t max_count) {
+    auto pos = pop_pos_.load(std::memory_order_relaxed);
+    while (true) {
+      auto ready = count_ready_cells(pos, 1, max_count);
+      if (ready == 0) {
+        auto new_pos = pop_pos_.load(std::memory_order_relaxed);
+        if (new_pos == pos) {
+          return 0;
+        }
+        pos = new_pos;
+        continue;
+      }
+      if (pop_pos_.compare_exchange_weak(pos, pos + ready, std::memory_order_relaxed)) {
+        for (size_t i = 0; i < ready; i++) {
+          auto &cell = cells_[(pos + i) & capacity_mask_];
+          values[i] = std::move(cell.value);
+          cell.sequence.store(pos + i + capacity_mask_ + 1, std::memory_order_release);
+        }
+        return ready;
+      }
+    }
+  }
+
+ private:
+  struct Cell {
+    std::atomic<size_t> sequence{0};
+    T value{};
+  };
+
+  // returns number of consecutive cells starting from pos, which are ready for the operation
+  // cell for position pos is ready to be written if its sequence is pos and ready to be read if its sequence is pos + 1
+  size_t count_ready_cells(size_t pos, size_t shift, size_t max_count) const {
+    size_t ready = 0;
+    while (ready < max_count &&
+           cells_[(pos + ready) & capacity_mask_].sequence.load(std::memory_order_acquire) == pos + ready + shift) {
+      ready++;
+    }
+    return ready;
+  }
+
+  std::atomic<size_t> push_pos_{0};
+  char pad[TD_CONCURRENCY_PAD - sizeof(std::atomic<size_t>)];
+  std::atomic<size_t> pop_pos_{0};
+  char pad2[TD_CONCURRENCY_PAD - sizeof(std::atomic<size_t>)];
+  size_t capacity_mask_ = 0;
+  std::vector<Cell> cells_;
+  char pad3[TD_CONCURRENCY_PAD - sizeof(size_t) - sizeof(std::vector<Cell>)];
+};
+
 }  // namespace td
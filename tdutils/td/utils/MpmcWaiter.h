@@ -8,6 +8,7 @@
 
 #include "td/utils/common.h"
 #include "td/utils/logging.h"
+#include "td/utils/port/platform.h"
 #include "td/utils/port/thread.h"
 
 #include <algorithm>
@@ -15,6 +16,12 @@
 #include <condition_variable>
 #include <mutex>
 
+#if TD_LINUX
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
 namespace td {
 
 class MpmcEagerWaiter {
@@ -327,6 +334,99 @@ class MpmcSleepyWaiter {
   bool closed_ = false;
 };
 
+// Waiter, which parks workers on a futex on Linux and on a condition variable elsewhere.
+// It keeps track of parked workers, so notify is just a fence and a load when nobody sleeps,
+// and wakes up only one worker per notification to avoid thundering herd.
+//
+// Before parking a worker announces itself and returns once to let the caller recheck the queue.
+// The announcement and the producer's notify are both ordered by sequentially consistent fences,
+// so either the worker sees the new work or notify sees the worker and changes the epoch it will wait on.
+class MpmcFutexWaiter {
+ public:
+  struct Slot {
+   private:
+    friend class MpmcFutexWaiter;
+    int32 yields;
+    uint32 epoch;
+    uint32 worker_id;
+  };
+  static void init_slot(Slot &slot, uint32 worker_id) {
+    slot.yields = 0;
+    slot.epoch = 0;
+    slot.worker_id = worker_id;
+  }
+
+  void wait(Slot &slot) {
+    if (slot.yields < RoundsTillSleepy) {
+      td::this_thread::yield();
+      slot.yields++;
+      return;
+    }
+    if (slot.yields == RoundsTillSleepy) {
+      slot.epoch = epoch_.load(std::memory_order_acquire);
+      sleeper_count_.fetch_add(1, std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      slot.yields++;
+      return;
+    }
+    park(slot.epoch);
+    sleeper_count_.fetch_sub(1, std::memory_order_relaxed);
+    slot.yields = 0;
+  }
+
+  void stop_wait(Slot &slot) {
+    if (slot.yields > RoundsTillSleepy) {
+      sleeper_count_.fetch_sub(1, std::memory_order_relaxed);
+    }
+    slot.yields = 0;
+  }
+
+  void notify() {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (sleeper_count_.load(std::memory_order_relaxed) == 0) {
+      return;
+    }
+    epoch_.fetch_add(1, std::memory_order_release);
+    unpark();
+  }
+
+  void close() {
+    auto sleeper_count = sleeper_count_.load();
+    LOG_CHECK(sleeper_count == 0) << sleeper_count;
+  }
+
+ private:
+  enum { RoundsTillSleepy = 32 };
+  std::atomic<uint32> epoch_{0};
+  char pad[TD_CONCURRENCY_PAD - sizeof(std::atomic<uint32>)];
+  std::atomic<uint32> sleeper_count_{0};
+  char pad2[TD_CONCURRENCY_PAD - sizeof(std::atomic<uint32>)];
+
+#if TD_LINUX
+  void park(uint32 epoch) {
+    // returns immediately if the epoch has already changed; spurious wakeups are fine
+    syscall(SYS_futex, reinterpret_cast<uint32 *>(&epoch_), FUTEX_WAIT_PRIVATE, epoch, nullptr, nullptr, 0);
+  }
+
+  void unpark() {
+    syscall(SYS_futex, reinterpret_cast<uint32 *>(&epoch_), FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0);
+  }
+#else
+  std::mutex mutex_;
+  std::condition_variable condition_variable_;
+
+  void park(uint32 epoch) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    condition_variable_.wait(lock, [&] { return epoch_.load(std::memory_order_relaxed) != epoch; });
+  }
+
+  void unpark() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    condition_variable_.notify_one();
+  }
+#endif
+};
+
 using MpmcWaiter = MpmcSleepyWaiter;
 
 }  // namespace td
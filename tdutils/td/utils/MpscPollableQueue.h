@@ -14,6 +14,7 @@
 
 #include "td/utils/SpinLock.h"
 
+#include <atomic>
 #include <utility>
 
 namespace td {
@@ -40,6 +41,7 @@ class MpscPollableQueue {
         reader_vector_.clear();
         reader_pos_ = 0;
         std::swap(writer_vector_, reader_vector_);
+        has_writer_values_.store(false, std::memory_order_relaxed);
         return narrow_cast<int>(reader_vector_.size());
       }
       event_fd_.acquire();
@@ -52,9 +54,35 @@ class MpscPollableQueue {
   void reader_flush() {
     //nop
   }
+  // can be used by the reader to busy-wait for new values without taking the lock
+  bool reader_has_values() const {
+    return reader_pos_ != reader_vector_.size() || has_writer_values_.load(std::memory_order_acquire);
+  }
   void writer_put(ValueType value) {
     auto guard = lock_.lock();
     writer_vector_.push_back(std::move(value));
+    has_writer_values_.store(true, std::memory_order_release);
+    if (wait_event_fd_) {
+      wait_event_fd_ = false;
+      guard.reset();
+      event_fd_.release();
+    }
+  }
+  // moves all values to the queue at once, leaving the vector empty
+  void writer_put_batch(std::vector<ValueType> &values) {
+    if (values.empty()) {
+      return;
+    }
+    auto guard = lock_.lock();
+    if (writer_vector_.empty()) {
+      std::swap(writer_vector_, values);
+    } else {
+      for (auto &value : values) {
+        writer_vector_.push_back(std::move(value));
+      }
+      values.clear();
+    }
+    has_writer_values_.store(true, std::memory_order_release);
     if (wait_event_fd_) {
       wait_event_fd_ = false;
       guard.reset();
@@ -75,6 +103,7 @@ class MpscPollableQueue {
     if (!event_fd_.empty()) {
       event_fd_.close();
       wait_event_fd_ = false;
+      has_writer_values_.store(false, std::memory_order_relaxed);
       writer_vector_.clear();
       reader_vector_.clear();
       reader_pos_ = 0;
@@ -93,6 +122,7 @@ class MpscPollableQueue {
  private:
   SpinLock lock_;
   bool wait_event_fd_{false};
+  std::atomic<bool> has_writer_values_{false};
   EventFd event_fd_;
   std::vector<ValueType> writer_vector_;
   std::vector<ValueType> reader_vector_;
@@ -121,6 +151,15 @@ class MpscPollableQueue {
     UNREACHABLE();
   }
 
+  void writer_put_batch(std::vector<ValueType> &values) {
+    UNREACHABLE();
+  }
+
+  bool reader_has_values() const {
+    UNREACHABLE();
+    return false;
+  }
+
   void writer_flush() {
     UNREACHABLE();
   }
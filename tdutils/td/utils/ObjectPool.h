@@ -183,13 +183,11 @@ class ObjectPool {
   ObjectPool(ObjectPool &&other) = delete;
   ObjectPool &operator=(ObjectPool &&other) = delete;
   ~ObjectPool() {
-    while (head_.load()) {
-      auto to_delete = head_.load();
-      head_ = to_delete->next;
-      delete to_delete;
-      storage_count_--;
+    int32 free_storage_count = 0;
+    for (auto *storage = head_.load(); storage != nullptr; storage = storage->next) {
+      free_storage_count++;
     }
-    LOG_CHECK(storage_count_.load() == 0) << storage_count_.load();
+    LOG_CHECK(storage_count_.load() == free_storage_count) << storage_count_.load() << ' ' << free_storage_count;
   }
 
  private:
@@ -216,14 +214,30 @@ class ObjectPool {
   std::atomic<Storage *> head_{static_cast<Storage *>(nullptr)};
   bool check_empty_flag_ = false;
 
-  // TODO(perf): allocation Storages in chunks? Anyway we won't be able to release them.
+  // Storages can't be released before the pool is destroyed anyway, so they are allocated in slabs of growing size
+  static constexpr size_t MIN_SLAB_SIZE = 16;
+  static constexpr size_t MAX_SLAB_SIZE_LOG = 6;
+  vector<std::unique_ptr<Storage[]>> slabs_;
+  Storage *next_slab_storage_ = nullptr;
+  Storage *slab_end_ = nullptr;
+
+  void allocate_slab() {
+    auto slab_size = MIN_SLAB_SIZE << min(slabs_.size(), MAX_SLAB_SIZE_LOG);
+    slabs_.push_back(std::unique_ptr<Storage[]>(new Storage[slab_size]));
+    next_slab_storage_ = slabs_.back().get();
+    slab_end_ = next_slab_storage_ + slab_size;
+  }
+
   // TODO(perf): memory order
   // TODO(perf): use another non lockfree list for release on the same thread
   // only one thread, so no aba problem
   Storage *get_storage() {
     if (head_.load() == nullptr) {
+      if (next_slab_storage_ == slab_end_) {
+        allocate_slab();
+      }
       storage_count_++;
-      return new Storage();
+      return next_slab_storage_++;
     }
     Storage *res;
     while (true) {
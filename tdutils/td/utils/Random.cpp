@@ -10,7 +10,17 @@
 #include "td/utils/port/thread_local.h"
 
 #if TD_HAVE_OPENSSL
+#include <openssl/evp.h>
+#include <openssl/opensslv.h>
 #include <openssl/rand.h>
+
+#if OPENSSL_VERSION_NUMBER >= 0x10100000L && !defined(OPENSSL_NO_CHACHA)
+#define TD_SECURE_RANDOM_CHACHA20 1
+#endif
+#endif
+
+#if TD_PORT_POSIX
+#include <pthread.h>
 #endif
 
 #include <atomic>
@@ -24,6 +34,99 @@ namespace td {
 
 namespace {
 std::atomic<int64> random_seed_generation{0};
+
+#if TD_PORT_POSIX
+// a forked child process must not produce the same random bytes as its parent
+const bool is_fork_handler_registered = [] {
+  return pthread_atfork(nullptr, nullptr, [] { random_seed_generation++; }) == 0;
+}();
+#endif
+
+// Generates secure random bytes in chunks of BUF_SIZE for the current thread, taking OpenSSL's RAND lock only on
+// reseed. If supported, chunks are generated with ChaCha20 keyed by RAND_bytes. The first bytes of each ChaCha20
+// output replace the key, so already returned bytes can't be restored from the state.
+class SecureRandomBuffer {
+ public:
+  static constexpr size_t BUF_SIZE = 512;
+
+  unsigned char buf[BUF_SIZE];
+  size_t buf_pos = BUF_SIZE;
+  int64 generation = 0;
+
+  SecureRandomBuffer() = default;
+  SecureRandomBuffer(const SecureRandomBuffer &) = delete;
+  SecureRandomBuffer &operator=(const SecureRandomBuffer &) = delete;
+  SecureRandomBuffer(SecureRandomBuffer &&) = delete;
+  SecureRandomBuffer &operator=(SecureRandomBuffer &&) = delete;
+  ~SecureRandomBuffer() {
+    clear();
+#if TD_SECURE_RANDOM_CHACHA20
+    if (ctx_ != nullptr) {
+      EVP_CIPHER_CTX_free(ctx_);
+    }
+#endif
+  }
+
+  void refill() {
+#if TD_SECURE_RANDOM_CHACHA20
+    if (chunks_before_reseed_ == 0) {
+      reseed();
+    }
+    chunks_before_reseed_--;
+
+    // the key changes after each chunk, so the nonce can be constant
+    static const unsigned char iv[16] = {};
+    LOG_IF(FATAL, EVP_EncryptInit_ex(ctx_, EVP_chacha20(), nullptr, key_, iv) != 1);
+    std::memset(key_, 0, KEY_SIZE);
+    std::memset(buf, 0, BUF_SIZE);
+    int len = 0;
+    LOG_IF(FATAL, EVP_EncryptUpdate(ctx_, key_, &len, key_, static_cast<int>(KEY_SIZE)) != 1);
+    LOG_IF(FATAL, EVP_EncryptUpdate(ctx_, buf, &len, buf, static_cast<int>(BUF_SIZE)) != 1);
+#else
+    int err = RAND_bytes(buf, static_cast<int>(BUF_SIZE));
+    // TODO: it CAN fail
+    LOG_IF(FATAL, err != 1);
+#endif
+    buf_pos = 0;
+  }
+
+  // drops all buffered bytes and forces reseed
+  void reset() {
+    buf_pos = BUF_SIZE;
+#if TD_SECURE_RANDOM_CHACHA20
+    chunks_before_reseed_ = 0;
+#endif
+  }
+
+  void clear() {
+    MutableSlice(buf, BUF_SIZE).fill_zero_secure();
+#if TD_SECURE_RANDOM_CHACHA20
+    MutableSlice(key_, KEY_SIZE).fill_zero_secure();
+#endif
+    reset();
+  }
+
+ private:
+#if TD_SECURE_RANDOM_CHACHA20
+  static constexpr size_t KEY_SIZE = 32;
+  static constexpr int32 RESEED_PERIOD = 1 << 11;  // in chunks, i.e. after each 1 MB
+
+  EVP_CIPHER_CTX *ctx_ = nullptr;
+  unsigned char key_[KEY_SIZE];
+  int32 chunks_before_reseed_ = 0;
+
+  void reseed() {
+    if (ctx_ == nullptr) {
+      ctx_ = EVP_CIPHER_CTX_new();
+      LOG_IF(FATAL, ctx_ == nullptr);
+    }
+    int err = RAND_bytes(key_, static_cast<int>(KEY_SIZE));
+    // TODO: it CAN fail
+    LOG_IF(FATAL, err != 1);
+    chunks_before_reseed_ = RESEED_PERIOD;
+  }
+#endif
+};
 }  // namespace
 
 void Random::secure_bytes(MutableSlice dest) {
@@ -31,28 +134,22 @@ void Random::secure_bytes(MutableSlice dest) {
 }
 
 void Random::secure_bytes(unsigned char *ptr, size_t size) {
-  constexpr size_t BUF_SIZE = 512;
-  static TD_THREAD_LOCAL unsigned char *buf;  // static zero-initialized
-  static TD_THREAD_LOCAL size_t buf_pos;
-  static TD_THREAD_LOCAL int64 generation;
-  if (init_thread_local<unsigned char[]>(buf, BUF_SIZE)) {
-    buf_pos = BUF_SIZE;
-    generation = 0;
-  }
+  constexpr size_t BUF_SIZE = SecureRandomBuffer::BUF_SIZE;
+  static TD_THREAD_LOCAL SecureRandomBuffer *state;
+  init_thread_local<SecureRandomBuffer>(state);
   if (ptr == nullptr) {
-    MutableSlice(buf, BUF_SIZE).fill_zero_secure();
-    buf_pos = BUF_SIZE;
+    state->clear();
     return;
   }
-  if (generation != random_seed_generation.load(std::memory_order_relaxed)) {
-    generation = random_seed_generation.load(std::memory_order_acquire);
-    buf_pos = BUF_SIZE;
+  if (state->generation != random_seed_generation.load(std::memory_order_relaxed)) {
+    state->generation = random_seed_generation.load(std::memory_order_acquire);
+    state->reset();
   }
 
-  auto ready = min(size, BUF_SIZE - buf_pos);
+  auto ready = min(size, BUF_SIZE - state->buf_pos);
   if (ready != 0) {
-    std::memcpy(ptr, buf + buf_pos, ready);
-    buf_pos += ready;
+    std::memcpy(ptr, state->buf + state->buf_pos, ready);
+    state->buf_pos += ready;
     ptr += ready;
     size -= ready;
     if (size == 0) {
@@ -60,11 +157,9 @@ void Random::secure_bytes(unsigned char *ptr, size_t size) {
     }
   }
   if (size < BUF_SIZE) {
-    int err = RAND_bytes(buf, static_cast<int>(BUF_SIZE));
-    // TODO: it CAN fail
-    LOG_IF(FATAL, err != 1);
-    buf_pos = size;
-    std::memcpy(ptr, buf, size);
+    state->refill();
+    state->buf_pos = size;
+    std::memcpy(ptr, state->buf, size);
     return;
   }
 
@@ -0,0 +1,113 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2022
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "td/utils/SmallObjectAllocator.h"
+
+#include <new>
+
+namespace td {
+
+constexpr size_t SmallObjectAllocator::MAX_SIZE;
+constexpr size_t SmallObjectAllocator::ALIGNMENT;
+constexpr size_t SmallObjectAllocator::SIZE_CLASS_COUNT;
+
+TD_THREAD_LOCAL SmallObjectAllocator::FreeLists *SmallObjectAllocator::free_lists_;  // static zero-initialized
+std::atomic<SmallObjectAllocator::FreeBlock *> SmallObjectAllocator::shared_blocks_[SIZE_CLASS_COUNT];
+std::atomic<size_t> SmallObjectAllocator::shared_block_count_[SIZE_CLASS_COUNT];
+
+// maximum total size of cached memory blocks of one size class in a thread
+static constexpr size_t MAX_CACHED_SIZE_CLASS_SIZE = 1 << 16;
+
+SmallObjectAllocator::FreeLists::~FreeLists() {
+  for (auto &block : blocks) {
+    while (block != nullptr) {
+      auto *next = block->next;
+      ::operator delete(block);
+      block = next;
+    }
+  }
+}
+
+void *SmallObjectAllocator::allocate_small(size_t size_class) {
+  // free lists are created only on allocation, because objects can be destroyed after destruction of thread locals
+  init_thread_local<FreeLists>(free_lists_);
+  auto *block = acquire_shared(free_lists_, size_class);
+  if (block != nullptr) {
+    return block;
+  }
+  return ::operator new(get_size_class_max_size(size_class));
+}
+
+void SmallObjectAllocator::deallocate_small(void *ptr, size_t size_class) {
+  auto *free_lists = free_lists_;
+  if (free_lists == nullptr) {
+    return deallocate_shared(ptr, size_class);
+  }
+  if (free_lists->block_count[size_class] * get_size_class_max_size(size_class) >= MAX_CACHED_SIZE_CLASS_SIZE) {
+    return ::operator delete(ptr);
+  }
+  free_lists->blocks[size_class] = new (ptr) FreeBlock{free_lists->blocks[size_class]};
+  free_lists->block_count[size_class]++;
+}
+
+void SmallObjectAllocator::deallocate_shared(void *ptr, size_t size_class) {
+  auto &count = shared_block_count_[size_class];
+  if (count.load(std::memory_order_relaxed) * get_size_class_max_size(size_class) >= MAX_CACHED_SIZE_CLASS_SIZE) {
+    return ::operator delete(ptr);
+  }
+  count.fetch_add(1, std::memory_order_relaxed);
+
+  // blocks are only pushed one by one and taken all at once, so there is no ABA problem
+  auto &head = shared_blocks_[size_class];
+  auto *block = new (ptr) FreeBlock{head.load(std::memory_order_relaxed)};
+  while (!head.compare_exchange_weak(block->next, block, std::memory_order_release, std::memory_order_relaxed)) {
+  }
+}
+
+SmallObjectAllocator::FreeBlock *SmallObjectAllocator::acquire_shared(FreeLists *free_lists, size_t size_class) {
+  auto &head = shared_blocks_[size_class];
+  if (head.load(std::memory_order_relaxed) == nullptr) {
+    return nullptr;
+  }
+  auto *result = head.exchange(nullptr, std::memory_order_acquire);
+  if (result == nullptr) {
+    return nullptr;
+  }
+
+  size_t taken_count = 1;
+  auto *block = result->next;
+  while (block != nullptr) {
+    auto *next = block->next;
+    block->next = free_lists->blocks[size_class];
+    free_lists->blocks[size_class] = block;
+    free_lists->block_count[size_class]++;
+    taken_count++;
+    block = next;
+  }
+  shared_block_count_[size_class].fetch_sub(taken_count, std::memory_order_relaxed);
+  return result;
+}
+
+size_t SmallObjectAllocator::get_cached_block_count() {
+  if (free_lists_ == nullptr) {
+    return 0;
+  }
+  size_t result = 0;
+  for (auto count : free_lists_->block_count) {
+    result += count;
+  }
+  return result;
+}
+
+size_t SmallObjectAllocator::get_shared_block_count() {
+  size_t result = 0;
+  for (auto &count : shared_block_count_) {
+    result += count.load(std::memory_order_relaxed);
+  }
+  return result;
+}
+
+}  // namespace td
@@ -0,0 +1,110 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2022
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#pragma once
+
+#include "td/utils/common.h"
+#include "td/utils/port/thread_local.h"
+
+#include <atomic>
+#include <cstddef>
+
+#ifndef TD_SMALL_OBJECT_POOL
+#define TD_SMALL_OBJECT_POOL 1
+#endif
+
+namespace td {
+
+// Allocator for short-lived small objects, which are created and destroyed in big batches, like TL objects.
+// Freed memory blocks are cached in thread-local free lists of the destroying thread and reused for the next
+// allocations of the same size class, so bursts of allocations don't contend for the global heap.
+// The size passed to deallocate must be equal to the size passed to allocate.
+class SmallObjectAllocator {
+ public:
+  static constexpr size_t MAX_SIZE = 512;
+
+  static void *allocate(size_t size) {
+#if TD_SMALL_OBJECT_POOL
+    if (size <= MAX_SIZE && size != 0) {
+      auto size_class = get_size_class(size);
+      auto *free_lists = free_lists_;
+      if (free_lists != nullptr) {
+        auto *block = free_lists->blocks[size_class];
+        if (block != nullptr) {
+          free_lists->blocks[size_class] = block->next;
+          free_lists->block_count[size_class]--;
+          return block;
+        }
+      }
+      return allocate_small(size_class);
+    }
+#endif
+    return ::operator new(size);
+  }
+
+  static void deallocate(void *ptr, size_t size) {
+    if (ptr == nullptr) {
+      return;
+    }
+#if TD_SMALL_OBJECT_POOL
+    if (size <= MAX_SIZE && size != 0) {
+      return deallocate_small(ptr, get_size_class(size));
+    }
+#endif
+    ::operator delete(ptr);
+  }
+
+  // returns number of cached memory blocks in the current thread
+  static size_t get_cached_block_count();
+
+  // returns number of memory blocks freed by threads without own cache, which can be reused by any thread
+  static size_t get_shared_block_count();
+
+ private:
+  static constexpr size_t ALIGNMENT = 16;
+  static constexpr size_t SIZE_CLASS_COUNT = MAX_SIZE / ALIGNMENT;
+
+  struct FreeBlock {
+    FreeBlock *next;
+  };
+
+  struct FreeLists {
+    FreeBlock *blocks[SIZE_CLASS_COUNT] = {};
+    size_t block_count[SIZE_CLASS_COUNT] = {};
+
+    FreeLists() = default;
+    FreeLists(const FreeLists &) = delete;
+    FreeLists &operator=(const FreeLists &) = delete;
+    FreeLists(FreeLists &&) = delete;
+    FreeLists &operator=(FreeLists &&) = delete;
+    ~FreeLists();
+  };
+
+  static TD_THREAD_LOCAL FreeLists *free_lists_;
+
+  // objects are often created in one thread and destroyed in another, for example, responses and updates sent
+  // to clients, so blocks freed in a thread without own cache are returned to shared lists
+  static std::atomic<FreeBlock *> shared_blocks_[SIZE_CLASS_COUNT];
+  static std::atomic<size_t> shared_block_count_[SIZE_CLASS_COUNT];
+
+  static size_t get_size_class(size_t size) {
+    return (size - 1) / ALIGNMENT;
+  }
+
+  static size_t get_size_class_max_size(size_t size_class) {
+    return (size_class + 1) * ALIGNMENT;
+  }
+
+  static void *allocate_small(size_t size_class);
+
+  static void deallocate_small(void *ptr, size_t size_class);
+
+  static void deallocate_shared(void *ptr, size_t size_class);
+
+  static FreeBlock *acquire_shared(FreeLists *free_lists, size_t size_class);
+};
+
+}  // namespace td
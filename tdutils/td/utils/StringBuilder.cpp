@@ -10,6 +10,7 @@
 #include "td/utils/port/thread_local.h"
 #include "td/utils/Slice.h"
 
+#include <algorithm>
 #include <cstdio>
 #include <cstring>
 #include <limits>
@@ -20,11 +21,80 @@
 
 namespace td {
 
+namespace {
+
+class StringBuilderBufferCache {
+ public:
+  std::unique_ptr<char[]> get(size_t &size) {
+    size_t best_i = CACHE_SIZE;
+    for (size_t i = 0; i < CACHE_SIZE; i++) {
+      if (buffers_[i] != nullptr && sizes_[i] >= size && (best_i == CACHE_SIZE || sizes_[i] < sizes_[best_i])) {
+        best_i = i;
+      }
+    }
+    if (best_i == CACHE_SIZE) {
+      return nullptr;
+    }
+    size = sizes_[best_i];
+    return std::move(buffers_[best_i]);
+  }
+
+  void put(std::unique_ptr<char[]> buffer, size_t size) {
+    if (size > MAX_BUFFER_SIZE) {
+      return;
+    }
+    // replace an empty slot or the smallest buffer
+    size_t min_i = 0;
+    for (size_t i = 0; i < CACHE_SIZE; i++) {
+      if (buffers_[i] == nullptr) {
+        min_i = i;
+        break;
+      }
+      if (sizes_[i] < sizes_[min_i]) {
+        min_i = i;
+      }
+    }
+    if (buffers_[min_i] == nullptr || sizes_[min_i] < size) {
+      buffers_[min_i] = std::move(buffer);
+      sizes_[min_i] = size;
+    }
+  }
+
+ private:
+  static constexpr size_t CACHE_SIZE = 4;
+  static constexpr size_t MAX_BUFFER_SIZE = 1 << 20;
+
+  std::unique_ptr<char[]> buffers_[CACHE_SIZE];
+  size_t sizes_[CACHE_SIZE] = {};
+};
+
+TD_THREAD_LOCAL StringBuilderBufferCache *string_builder_buffer_cache;  // static zero-initialized
+
+}  // namespace
+
+std::unique_ptr<char[]> StringBuilder::allocate_buffer(size_t &size) {
+  init_thread_local<StringBuilderBufferCache>(string_builder_buffer_cache);
+  auto buffer = string_builder_buffer_cache->get(size);
+  if (buffer == nullptr) {
+    buffer = std::make_unique<char[]>(size);
+  }
+  return buffer;
+}
+
+void StringBuilder::free_buffer() {
+  // the cache can be already destroyed at thread exit
+  if (string_builder_buffer_cache != nullptr) {
+    CHECK(begin_ptr_ == buffer_.get());
+    string_builder_buffer_cache->put(std::move(buffer_), end_ptr_ + RESERVED_SIZE - begin_ptr_);
+  }
+  buffer_ = nullptr;
+}
+
 StringBuilder::StringBuilder(MutableSlice slice, bool use_buffer)
     : begin_ptr_(slice.begin()), current_ptr_(begin_ptr_), use_buffer_(use_buffer) {
   if (slice.size() <= RESERVED_SIZE) {
-    auto buffer_size = RESERVED_SIZE + 100;
-    buffer_ = std::make_unique<char[]>(buffer_size);
+    size_t buffer_size = RESERVED_SIZE + 100;
+    buffer_ = allocate_buffer(buffer_size);
     begin_ptr_ = buffer_.get();
     current_ptr_ = begin_ptr_;
     end_ptr_ = begin_ptr_ + buffer_size - RESERVED_SIZE;
@@ -51,30 +121,43 @@ StringBuilder &StringBuilder::operator<<(Slice slice) {
   return *this;
 }
 
+static const char DIGIT_PAIRS[] =
+    "00010203040506070809101112131415161718192021222324252627282930313233343536373839404142434445464748495051525354"
+    "555657585960616263646566676869707172737475767778798081828384858687888990919293949596979899";
+
 template <class T>
 static char *print_uint(char *current_ptr, T x) {
   if (x < 100) {
     if (x < 10) {
       *current_ptr++ = static_cast<char>('0' + x);
     } else {
-      *current_ptr++ = static_cast<char>('0' + x / 10);
-      *current_ptr++ = static_cast<char>('0' + x % 10);
+      std::memcpy(current_ptr, DIGIT_PAIRS + 2 * x, 2);
+      current_ptr += 2;
     }
     return current_ptr;
   }
 
-  auto begin_ptr = current_ptr;
-  do {
-    *current_ptr++ = static_cast<char>('0' + x % 10);
-    x /= 10;
-  } while (x > 0);
-
-  auto end_ptr = current_ptr - 1;
-  while (begin_ptr < end_ptr) {
-    std::swap(*begin_ptr++, *end_ptr--);
+  size_t length = 3;
+  for (T y = x / 1000; y != 0; y /= 10) {
+    length++;
   }
 
-  return current_ptr;
+  // print two digits at a time from the end
+  auto end_ptr = current_ptr + length;
+  auto ptr = end_ptr;
+  while (x >= 100) {
+    ptr -= 2;
+    std::memcpy(ptr, DIGIT_PAIRS + 2 * static_cast<size_t>(x % 100), 2);
+    x /= 100;
+  }
+  if (x < 10) {
+    *--ptr = static_cast<char>('0' + x);
+  } else {
+    ptr -= 2;
+    std::memcpy(ptr, DIGIT_PAIRS + 2 * static_cast<size_t>(x), 2);
+  }
+  DCHECK(ptr == current_ptr);
+  return end_ptr;
 }
 
 template <class T>
@@ -116,8 +199,11 @@ bool StringBuilder::reserve_inner(size_t size) {
     new_buffer_size = 100;
   }
   new_buffer_size += RESERVED_SIZE;
-  auto new_buffer = std::make_unique<char[]>(new_buffer_size);
+  auto new_buffer = allocate_buffer(new_buffer_size);
   std::memcpy(new_buffer.get(), begin_ptr_, old_data_size);
+  if (buffer_ != nullptr) {
+    free_buffer();
+  }
   buffer_ = std::move(new_buffer);
   begin_ptr_ = buffer_.get();
   current_ptr_ = begin_ptr_ + old_data_size;
@@ -175,6 +261,28 @@ StringBuilder &StringBuilder::operator<<(long long unsigned int x) {
   return *this;
 }
 
+IntegerString IntegerString::from_int(int64 x) {
+  IntegerString result;
+  result.size_ = static_cast<size_t>(print_int(result.data_, x) - result.data_);
+  return result;
+}
+
+IntegerString IntegerString::from_uint(uint64 x) {
+  IntegerString result;
+  result.size_ = static_cast<size_t>(print_uint(result.data_, x) - result.data_);
+  return result;
+}
+
+IntegerString IntegerString::from_uint_hex(uint64 x) {
+  IntegerString result;
+  do {
+    result.data_[result.size_++] = "0123456789abcdef"[x & 15];
+    x >>= 4;
+  } while (x != 0);
+  std::reverse(result.data_, result.data_ + result.size_);
+  return result;
+}
+
 StringBuilder &StringBuilder::operator<<(FixedDouble x) {
   if (unlikely(!reserve(std::numeric_limits<double>::max_exponent10 + x.precision + 4))) {
     return on_error();
@@ -21,6 +21,15 @@ class StringBuilder {
   explicit StringBuilder(MutableSlice slice, bool use_buffer = false);
   StringBuilder() : StringBuilder({}, true) {
   }
+  StringBuilder(const StringBuilder &) = delete;
+  StringBuilder &operator=(const StringBuilder &) = delete;
+  StringBuilder(StringBuilder &&) = default;
+  StringBuilder &operator=(StringBuilder &&) = default;
+  ~StringBuilder() {
+    if (buffer_ != nullptr) {
+      free_buffer();
+    }
+  }
 
   void clear() {
     current_ptr_ = begin_ptr_;
@@ -139,8 +148,35 @@ class StringBuilder {
     return reserve_inner(size);
   }
   bool reserve_inner(size_t size);
+
+  // heap buffers are taken from and returned to a small thread-local cache to avoid allocations on hot paths
+  static std::unique_ptr<char[]> allocate_buffer(size_t &size);
+  void free_buffer();
+};
+
+// decimal or hexadecimal representation of an integer, which is formatted without memory allocations
+class IntegerString {
+ public:
+  static IntegerString from_int(int64 x);
+
+  static IntegerString from_uint(uint64 x);
+
+  // lowercase hexadecimal representation without leading zeroes
+  static IntegerString from_uint_hex(uint64 x);
+
+  Slice as_slice() const {
+    return Slice(data_, size_);
+  }
+
+ private:
+  char data_[24];
+  size_t size_ = 0;
 };
 
+inline StringBuilder &operator<<(StringBuilder &sb, const IntegerString &str) {
+  return sb << str.as_slice();
+}
+
 template <class T>
 std::enable_if_t<std::is_arithmetic<T>::value, string> to_string(const T &x) {
   const size_t buf_size = 1000;
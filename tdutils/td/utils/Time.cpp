@@ -17,6 +17,8 @@ bool operator==(Timestamp a, Timestamp b) {
 
 static std::atomic<double> time_diff;
 
+TD_THREAD_LOCAL double Time::cached_now_;
+
 double Time::now() {
   auto result = now_unadjusted() + time_diff.load(std::memory_order_relaxed);
   while (result < 0) {
@@ -39,6 +41,7 @@ void Time::jump_in_future(double at) {
       return;
     }
     if (time_diff.compare_exchange_strong(old_time_diff, old_time_diff + diff)) {
+      update_cached_now();
       return;
     }
   }
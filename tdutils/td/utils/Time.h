@@ -8,30 +8,60 @@
 
 #include "td/utils/common.h"
 #include "td/utils/port/Clocks.h"
+#include "td/utils/port/thread_local.h"
 
 namespace td {
 
 class Time {
  public:
   static double now();
+
+  // returns a thread local copy of now(), which is updated by a scheduler on entering and after blocking, and before
+  // running of every actor; outside of schedulers it is the same as now()
+  //
+  // now() and now_cached() are monotonic: if a=now[_cached]() happens before b=now[_cached]() then a <= b, because
+  // events from other threads are received by an actor only after the copy is updated
   static double now_cached() {
-    // Temporary(?) use now in now_cached
-    // Problem:
-    //   thread A: check that now() > timestamp and notifies thread B
-    //   thread B: must see that now() > timestamp()
-    //
-    //   now() and now_cached() must be monotonic
-    //
-    //   if a=now[_cached]() happens before b=now[_cached] than
-    //     a <= b
-    //
-    // As an alternative we may say that now_cached is a thread local copy of now
-    return now();
+    auto result = cached_now_;
+    return result > 0 ? result : now();
   }
+
+  // enables now_cached() caching for the current thread while exists
+  class CachedNowGuard {
+   public:
+    CachedNowGuard() : was_enabled_(cached_now_ > 0) {
+      cached_now_ = now();
+    }
+    CachedNowGuard(const CachedNowGuard &) = delete;
+    CachedNowGuard &operator=(const CachedNowGuard &) = delete;
+    CachedNowGuard(CachedNowGuard &&) = delete;
+    CachedNowGuard &operator=(CachedNowGuard &&) = delete;
+    ~CachedNowGuard() {
+      if (was_enabled_) {
+        cached_now_ = now();
+      } else {
+        cached_now_ = 0.0;
+      }
+    }
+
+   private:
+    bool was_enabled_;
+  };
+
+  // updates the value returned by now_cached() for the current thread if it is cached
+  static void update_cached_now() {
+    if (cached_now_ > 0) {
+      cached_now_ = now();
+    }
+  }
+
   static double now_unadjusted();
 
   // Used for testing. After jump_in_future(at) is called, now() >= at.
   static void jump_in_future(double at);
+
+ private:
+  static TD_THREAD_LOCAL double cached_now_;
 };
 
 inline void relax_timeout_at(double *timeout, double new_timeout) {
@@ -0,0 +1,240 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2022
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#pragma once
+
+#include "td/utils/bits.h"
+#include "td/utils/common.h"
+#include "td/utils/logging.h"
+
+#include <array>
+#include <limits>
+
+namespace td {
+
+struct TimingWheelNode {
+  bool in_wheel() const {
+    return prev_ != nullptr;
+  }
+
+  TimingWheelNode *prev_ = nullptr;
+  TimingWheelNode *next_ = nullptr;
+  double key_ = 0.0;
+  uint64 tick_ = 0;
+  uint32 bucket_ = 0;
+};
+
+// Hierarchical timing wheel with O(1) insert and erase
+// Keys are times in seconds. Expired nodes are returned with precision of TICKS_PER_SECOND,
+// but never before their key. Long timeouts are kept in coarse-grained buckets on upper levels
+// and moved to lower levels when their time approaches.
+class TimingWheel {
+ public:
+  static constexpr int32 TICKS_PER_SECOND = 1000;
+
+  TimingWheel() {
+    for (auto &bucket : buckets_) {
+      bucket.prev_ = &bucket;
+      bucket.next_ = &bucket;
+    }
+    for (auto &level_bitmap : bitmap_) {
+      level_bitmap.fill(0);
+    }
+  }
+  TimingWheel(const TimingWheel &) = delete;
+  TimingWheel &operator=(const TimingWheel &) = delete;
+  TimingWheel(TimingWheel &&) = delete;
+  TimingWheel &operator=(TimingWheel &&) = delete;
+  ~TimingWheel() = default;
+
+  bool empty() const {
+    return size_ == 0;
+  }
+  size_t size() const {
+    return size_;
+  }
+
+  double get_key(const TimingWheelNode *node) const {
+    CHECK(node->in_wheel());
+    return node->key_;
+  }
+
+  void insert(double key, TimingWheelNode *node) {
+    CHECK(!node->in_wheel());
+    node->key_ = key;
+    node->tick_ = td::max(key_to_tick(key), current_tick_);
+    place(node);
+    size_++;
+  }
+
+  void fix(double key, TimingWheelNode *node) {
+    erase(node);
+    insert(key, node);
+  }
+
+  void erase(TimingWheelNode *node) {
+    CHECK(node->in_wheel());
+    unlink(node);
+    size_--;
+  }
+
+  // returns a node with key less than now or nullptr if there are no such nodes
+  TimingWheelNode *pop_expired(double now) {
+    auto now_tick = key_to_tick(now);
+    while (current_tick_ < now_tick) {
+      auto slot = static_cast<size_t>(current_tick_ & SLOT_MASK);
+      if (is_set(0, slot)) {
+        auto *result = buckets_[slot].next_;
+        CHECK(result != &buckets_[slot]);
+        unlink(result);
+        size_--;
+        return result;
+      }
+      set_current_tick(td::min(get_next_tick(), now_tick));
+    }
+    return nullptr;
+  }
+
+  // returns a time not later than the key of any node, at which the node can be popped
+  double get_wakeup_at() const {
+    CHECK(!empty());
+    return static_cast<double>(get_next_tick() + 1) / TICKS_PER_SECOND;
+  }
+
+ private:
+  static constexpr int32 SLOT_BITS = 8;
+  static constexpr size_t SLOT_COUNT = static_cast<size_t>(1) << SLOT_BITS;
+  static constexpr uint64 SLOT_MASK = SLOT_COUNT - 1;
+  static constexpr int32 LEVEL_COUNT = 4;
+  static constexpr uint32 OVERFLOW_BUCKET = LEVEL_COUNT * SLOT_COUNT;
+
+  std::array<TimingWheelNode, LEVEL_COUNT * SLOT_COUNT + 1> buckets_;
+  std::array<std::array<uint64, SLOT_COUNT / 64>, LEVEL_COUNT> bitmap_;
+  uint64 current_tick_ = 0;
+  size_t size_ = 0;
+
+  static uint64 key_to_tick(double key) {
+    if (!(key > 0.0)) {
+      return 0;
+    }
+    return static_cast<uint64>(key * TICKS_PER_SECOND);
+  }
+
+  bool is_set(int32 level, size_t slot) const {
+    return (bitmap_[level][slot / 64] >> (slot % 64)) & 1;
+  }
+
+  // returns the first non-empty slot of the level, which is not less than from_slot, or SLOT_COUNT
+  size_t find_slot(int32 level, size_t from_slot) const {
+    for (size_t word_id = from_slot / 64; word_id < SLOT_COUNT / 64; word_id++) {
+      auto word = bitmap_[level][word_id];
+      if (word_id == from_slot / 64) {
+        word &= std::numeric_limits<uint64>::max() << (from_slot % 64);
+      }
+      if (word != 0) {
+        return word_id * 64 + count_trailing_zeroes_non_zero64(word);
+      }
+    }
+    return SLOT_COUNT;
+  }
+
+  // returns the minimum tick, at which something can happen
+  uint64 get_next_tick() const {
+    for (int32 level = 0; level < LEVEL_COUNT; level++) {
+      auto shift = level * SLOT_BITS;
+      auto current_slot = static_cast<size_t>((current_tick_ >> shift) & SLOT_MASK);
+      auto slot = find_slot(level, level == 0 ? current_slot : current_slot + 1);
+      if (slot != SLOT_COUNT) {
+        return ((current_tick_ >> (shift + SLOT_BITS)) << (shift + SLOT_BITS)) | (static_cast<uint64>(slot) << shift);
+      }
+    }
+    if (buckets_[OVERFLOW_BUCKET].next_ != &buckets_[OVERFLOW_BUCKET]) {
+      return ((current_tick_ >> (LEVEL_COUNT * SLOT_BITS)) + 1) << (LEVEL_COUNT * SLOT_BITS);
+    }
+    return std::numeric_limits<uint64>::max() - 1;
+  }
+
+  void place(TimingWheelNode *node) {
+    auto bucket = OVERFLOW_BUCKET;
+    for (int32 level = 0; level < LEVEL_COUNT; level++) {
+      auto shift = (level + 1) * SLOT_BITS;
+      if ((node->tick_ >> shift) == (current_tick_ >> shift)) {
+        auto slot = static_cast<size_t>((node->tick_ >> (level * SLOT_BITS)) & SLOT_MASK);
+        bitmap_[level][slot / 64] |= static_cast<uint64>(1) << (slot % 64);
+        bucket = static_cast<uint32>(level * SLOT_COUNT + slot);
+        break;
+      }
+    }
+
+    auto *head = &buckets_[bucket];
+    node->bucket_ = bucket;
+    node->prev_ = head->prev_;
+    node->next_ = head;
+    head->prev_->next_ = node;
+    head->prev_ = node;
+  }
+
+  void unlink(TimingWheelNode *node) {
+    node->prev_->next_ = node->next_;
+    node->next_->prev_ = node->prev_;
+    node->prev_ = nullptr;
+    node->next_ = nullptr;
+
+    auto bucket = node->bucket_;
+    if (bucket != OVERFLOW_BUCKET && buckets_[bucket].next_ == &buckets_[bucket]) {
+      auto slot = bucket % SLOT_COUNT;
+      bitmap_[bucket / SLOT_COUNT][slot / 64] &= ~(static_cast<uint64>(1) << (slot % 64));
+    }
+  }
+
+  // moves all nodes from the bucket to the lower levels
+  void cascade(uint32 bucket) {
+    auto *head = &buckets_[bucket];
+    if (head->next_ == head) {
+      return;
+    }
+
+    // nodes from the overflow bucket can return to it, so the bucket must be emptied first
+    auto *node = head->next_;
+    head->prev_->next_ = nullptr;
+    head->prev_ = head;
+    head->next_ = head;
+    if (bucket != OVERFLOW_BUCKET) {
+      auto slot = bucket % SLOT_COUNT;
+      bitmap_[bucket / SLOT_COUNT][slot / 64] &= ~(static_cast<uint64>(1) << (slot % 64));
+    }
+    while (node != nullptr) {
+      auto *next = node->next_;
+      place(node);
+      node = next;
+    }
+  }
+
+  // the new tick must not be greater than get_next_tick()
+  void set_current_tick(uint64 tick) {
+    CHECK(tick > current_tick_);
+    current_tick_ = tick;
+    if ((tick & SLOT_MASK) != 0) {
+      return;
+    }
+
+    // buckets of upper levels must be cascaded first, because their nodes can move to the buckets of lower levels
+    int32 max_level = 1;
+    while (max_level < LEVEL_COUNT && ((tick >> (max_level * SLOT_BITS)) & SLOT_MASK) == 0) {
+      max_level++;
+    }
+    if (max_level == LEVEL_COUNT) {
+      cascade(OVERFLOW_BUCKET);
+      max_level--;
+    }
+    for (int32 level = max_level; level >= 1; level--) {
+      auto slot = static_cast<uint32>((tick >> (level * SLOT_BITS)) & SLOT_MASK);
+      cascade(static_cast<uint32>(level * SLOT_COUNT) + slot);
+    }
+  }
+};
+
+}  // namespace td
@@ -10,6 +10,7 @@
 #include "td/utils/SharedSlice.h"
 #include "td/utils/Slice.h"
 #include "td/utils/SliceBuilder.h"
+#include "td/utils/StringBuilder.h"
 #include "td/utils/UInt.h"
 
 namespace td {
@@ -31,7 +32,8 @@ class TlStorerToString {
   }
 
   void store_long(int64 value) {
-    result += (PSLICE() << value).c_str();
+    auto str = IntegerString::from_int(value).as_slice();
+    result.append(str.data(), str.size());
   }
 
   void store_binary(Slice data) {
@@ -153,7 +155,8 @@ class TlStorerToString {
   void store_vector_begin(const char *field_name, size_t vector_size) {
     store_field_begin(field_name);
     result += "vector[";
-    result += (PSLICE() << vector_size).c_str();
+    auto size_str = IntegerString::from_uint(vector_size).as_slice();
+    result.append(size_str.data(), size_str.size());
     result += "] {\n";
     shift += 2;
   }
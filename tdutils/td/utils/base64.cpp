@@ -13,6 +13,14 @@
 #include <algorithm>
 #include <iterator>
 
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define TD_BASE64_SSSE3 1
+#define TD_BASE64_SSSE3_TARGET __attribute__((target("ssse3")))
+#include <tmmintrin.h>
+#else
+#define TD_BASE64_SSSE3 0
+#endif
+
 namespace td {
 
 template <bool is_url>
@@ -36,33 +44,114 @@ static const unsigned char *get_character_table() {
   return char_to_value;
 }
 
+#if TD_BASE64_SSSE3
+static bool has_ssse3() {
+  static const bool result = __builtin_cpu_supports("ssse3") != 0;
+  return result;
+}
+
+// encodes 12 bytes from every 16 loaded to 16 characters; returns number of encoded bytes
+template <bool is_url>
+TD_BASE64_SSSE3_TARGET static size_t base64_encode_ssse3(const unsigned char *input, size_t size, char *output) {
+  const __m128i shuffle = _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+  const __m128i shift_lut = _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                          '0' - 52, '0' - 52, '0' - 52, '0' - 52, (is_url ? '-' : '+') - 62,
+                                          (is_url ? '_' : '/') - 63, 'A', 0, 0);
+  size_t i = 0;
+  for (; i + 16 <= size; i += 12) {
+    auto in = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(input + i)), shuffle);
+    // split every 3 bytes into 4 6-bit indices, each in its own byte
+    auto t0 = _mm_mulhi_epu16(_mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00)), _mm_set1_epi32(0x04000040));
+    auto t1 = _mm_mullo_epi16(_mm_and_si128(in, _mm_set1_epi32(0x003f03f0)), _mm_set1_epi32(0x01000010));
+    auto indices = _mm_or_si128(t0, t1);
+
+    // 0..25 -> 13, 26..51 -> 0, 52..61 -> 1..10, 62 -> 11, 63 -> 12
+    auto reduced = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+    auto is_upper = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+    reduced = _mm_or_si128(reduced, _mm_and_si128(is_upper, _mm_set1_epi8(13)));
+    auto result = _mm_add_epi8(_mm_shuffle_epi8(shift_lut, reduced), indices);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(output), result);
+    output += 16;
+  }
+  return i;
+}
+
+// decodes 16 characters to 12 bytes at a time, stopping before the first block with a wrong character;
+// writes 16 bytes for every block, so output must have 4 spare bytes; returns number of decoded characters
+template <bool is_url>
+TD_BASE64_SSSE3_TARGET static size_t base64_decode_ssse3(const unsigned char *input, size_t size, char *output) {
+  const char char62 = is_url ? '-' : '+';
+  const char char63 = is_url ? '_' : '/';
+  const __m128i shuffle = _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+  size_t i = 0;
+  for (; i + 16 <= size; i += 16) {
+    auto in = _mm_loadu_si128(reinterpret_cast<const __m128i *>(input + i));
+    // bytes bigger than 127 are negative and don't belong to any range
+    auto is_upper = _mm_and_si128(_mm_cmpgt_epi8(in, _mm_set1_epi8('A' - 1)), _mm_cmplt_epi8(in, _mm_set1_epi8('Z' + 1)));
+    auto is_lower = _mm_and_si128(_mm_cmpgt_epi8(in, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(in, _mm_set1_epi8('z' + 1)));
+    auto is_digit = _mm_and_si128(_mm_cmpgt_epi8(in, _mm_set1_epi8('0' - 1)), _mm_cmplt_epi8(in, _mm_set1_epi8('9' + 1)));
+    auto is_62 = _mm_cmpeq_epi8(in, _mm_set1_epi8(char62));
+    auto is_63 = _mm_cmpeq_epi8(in, _mm_set1_epi8(char63));
+    auto is_valid = _mm_or_si128(_mm_or_si128(_mm_or_si128(is_upper, is_lower), _mm_or_si128(is_digit, is_62)), is_63);
+    if (_mm_movemask_epi8(is_valid) != 0xffff) {
+      break;
+    }
+    auto shift = _mm_or_si128(
+        _mm_or_si128(_mm_and_si128(is_upper, _mm_set1_epi8(-'A')), _mm_and_si128(is_lower, _mm_set1_epi8(26 - 'a'))),
+        _mm_or_si128(_mm_and_si128(is_digit, _mm_set1_epi8(52 - '0')),
+                     _mm_or_si128(_mm_and_si128(is_62, _mm_set1_epi8(static_cast<char>(62 - char62))),
+                                  _mm_and_si128(is_63, _mm_set1_epi8(static_cast<char>(63 - char63))))));
+    auto values = _mm_add_epi8(in, shift);
+
+    // merge every 4 6-bit values into 3 bytes
+    auto merged = _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+    merged = _mm_madd_epi16(merged, _mm_set1_epi32(0x00011000));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(output), _mm_shuffle_epi8(merged, shuffle));
+    output += 12;
+  }
+  return i;
+}
+#endif
+
 template <bool is_url>
 string base64_encode_impl(Slice input) {
   auto characters = get_characters<is_url>();
-  string base64;
-  base64.reserve((input.size() + 2) / 3 * 4);
-  for (size_t i = 0; i < input.size();) {
-    size_t left = min(input.size() - i, static_cast<size_t>(3));
-    int c = input.ubegin()[i++] << 16;
-    base64 += characters[c >> 18];
-    if (left != 1) {
-      c |= input.ubegin()[i++] << 8;
-    }
-    base64 += characters[(c >> 12) & 63];
-    if (left == 3) {
-      c |= input.ubegin()[i++];
+  string base64(is_url ? (input.size() * 4 + 2) / 3 : (input.size() + 2) / 3 * 4, '\0');
+  auto *ptr = &base64[0];
+  const auto *data = input.ubegin();
+  size_t i = 0;
+#if TD_BASE64_SSSE3
+  if (input.size() >= 16 && has_ssse3()) {
+    i = base64_encode_ssse3<is_url>(data, input.size(), ptr);
+    ptr += i / 3 * 4;
+  }
+#endif
+  for (; i + 3 <= input.size(); i += 3) {
+    uint32 c = (static_cast<uint32>(data[i]) << 16) | (static_cast<uint32>(data[i + 1]) << 8) | data[i + 2];
+    ptr[0] = characters[c >> 18];
+    ptr[1] = characters[(c >> 12) & 63];
+    ptr[2] = characters[(c >> 6) & 63];
+    ptr[3] = characters[c & 63];
+    ptr += 4;
+  }
+  size_t left = input.size() - i;
+  if (left != 0) {
+    uint32 c = static_cast<uint32>(data[i]) << 16;
+    if (left == 2) {
+      c |= static_cast<uint32>(data[i + 1]) << 8;
     }
-    if (left != 1) {
-      base64 += characters[(c >> 6) & 63];
+    *ptr++ = characters[c >> 18];
+    *ptr++ = characters[(c >> 12) & 63];
+    if (left == 2) {
+      *ptr++ = characters[(c >> 6) & 63];
     } else if (!is_url) {
-      base64 += '=';
+      *ptr++ = '=';
     }
-    if (left == 3) {
-      base64 += characters[c & 63];
-    } else if (!is_url) {
-      base64 += '=';
+    if (!is_url) {
+      *ptr++ = '=';
     }
   }
+  CHECK(ptr == base64.data() + base64.size());
   return base64;
 }
 
@@ -93,12 +182,37 @@ Result<Slice> base64_drop_padding(Slice base64) {
   return base64;
 }
 
-static Status do_base64_decode_impl(Slice base64, const unsigned char *table, char *ptr) {
-  for (size_t i = 0; i < base64.size();) {
-    size_t left = min(base64.size() - i, static_cast<size_t>(4));
+template <bool is_url>
+static Status do_base64_decode_impl(Slice base64, char *ptr) {
+  auto table = get_character_table<is_url>();
+  const auto *data = base64.ubegin();
+  size_t i = 0;
+#if TD_BASE64_SSSE3
+  // the last block is always decoded without SIMD, so 4 spare output bytes are guaranteed
+  if (base64.size() >= 24 && has_ssse3()) {
+    i = base64_decode_ssse3<is_url>(data, base64.size() - 8, ptr);
+    ptr += i / 4 * 3;
+  }
+#endif
+  for (; i + 4 <= base64.size(); i += 4) {
+    auto a = table[data[i]];
+    auto b = table[data[i + 1]];
+    auto c = table[data[i + 2]];
+    auto d = table[data[i + 3]];
+    if (((a | b | c | d) & 64) != 0) {
+      return Status::Error("Wrong character in the string");
+    }
+    uint32 value = (static_cast<uint32>(a) << 18) | (static_cast<uint32>(b) << 12) | (static_cast<uint32>(c) << 6) | d;
+    ptr[0] = static_cast<char>(static_cast<unsigned char>(value >> 16));
+    ptr[1] = static_cast<char>(static_cast<unsigned char>(value >> 8));
+    ptr[2] = static_cast<char>(static_cast<unsigned char>(value));
+    ptr += 3;
+  }
+  size_t left = base64.size() - i;
+  if (left != 0) {
     int c = 0;
     for (size_t t = 0; t < left; t++) {
-      auto value = table[base64.ubegin()[i++]];
+      auto value = table[data[i++]];
       if (value == 64) {
         return Status::Error("Wrong character in the string");
       }
@@ -111,12 +225,8 @@ static Status do_base64_decode_impl(Slice base64, const unsigned char *table, ch
       }
     } else {
       *ptr++ = static_cast<char>(static_cast<unsigned char>(c >> 8));  // implementation-defined
-      if (left == 3) {
-        if ((c & ((1 << 8) - 1)) != 0) {
-          return Status::Error("Wrong padding in the string");
-        }
-      } else {
-        *ptr++ = static_cast<char>(static_cast<unsigned char>(c));  // implementation-defined
+      if ((c & ((1 << 8) - 1)) != 0) {
+        return Status::Error("Wrong padding in the string");
       }
     }
   }
@@ -141,7 +251,7 @@ static Result<T> base64_decode_impl(Slice base64) {
   TRY_RESULT_ASSIGN(base64, base64_drop_padding<is_url>(base64));
 
   T result = create_empty<T>(base64.size() / 4 * 3 + ((base64.size() & 3) + 1) / 2);
-  TRY_STATUS(do_base64_decode_impl(base64, get_character_table<is_url>(), as_mutable_slice(result).begin()));
+  TRY_STATUS(do_base64_decode_impl<is_url>(base64, as_mutable_slice(result).begin()));
   return std::move(result);
 }
 
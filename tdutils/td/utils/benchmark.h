@@ -6,12 +6,19 @@
 //
 #pragma once
 
+#include "td/utils/common.h"
 #include "td/utils/format.h"
+#include "td/utils/JsonBuilder.h"
 #include "td/utils/logging.h"
 #include "td/utils/port/Clocks.h"
+#include "td/utils/port/FileFd.h"
+#include "td/utils/Slice.h"
+#include "td/utils/SliceBuilder.h"
 #include "td/utils/StringBuilder.h"
 
+#include <algorithm>
 #include <cmath>
+#include <cstdlib>
 #include <tuple>
 #include <utility>
 
@@ -68,12 +75,26 @@ class Benchmark {
   virtual void run(int n) = 0;
 };
 
-inline std::pair<double, double> bench_n(Benchmark &b, int n) {
+// returns the total number of memory allocations made by the process
+using BenchmarkAllocationCounter = uint64 (*)();
+
+// if the counter is set, then the number of memory allocations per operation is reported for all benchmarks
+inline BenchmarkAllocationCounter &get_benchmark_allocation_counter() {
+  static BenchmarkAllocationCounter counter = nullptr;
+  return counter;
+}
+
+inline std::pair<double, double> bench_n(Benchmark &b, int n, uint64 *allocation_count = nullptr) {
+  auto allocation_counter = get_benchmark_allocation_counter();
   double total = -Clocks::monotonic();
   b.start_up_n(n);
+  uint64 allocation_count_begin = allocation_counter == nullptr ? 0 : allocation_counter();
   double t = -Clocks::monotonic();
   b.run(n);
   t += Clocks::monotonic();
+  if (allocation_count != nullptr) {
+    *allocation_count = allocation_counter == nullptr ? 0 : allocation_counter() - allocation_count_begin;
+  }
   b.tear_down();
   total += Clocks::monotonic();
 
@@ -84,24 +105,84 @@ inline std::pair<double, double> bench_n(Benchmark &&b, int n) {
   return bench_n(b, n);
 }
 
+namespace detail {
+
+// the number of passes can be increased with the environment variable TD_BENCHMARK_PASS_COUNT to get more precise
+// statistics; all results are appended as JSON lines to the file specified in TD_BENCHMARK_OUTPUT
+inline int get_benchmark_pass_count() {
+  auto pass_count = std::getenv("TD_BENCHMARK_PASS_COUNT");
+  if (pass_count == nullptr) {
+    return 2;
+  }
+  return std::max(std::atoi(pass_count), 1);
+}
+
+inline void store_benchmark_result(Slice description, int n, vector<double> pass_results, double average,
+                                   double stddev, double allocations_per_op) {
+  auto output_path = std::getenv("TD_BENCHMARK_OUTPUT");
+  if (output_path == nullptr || output_path[0] == '\0') {
+    return;
+  }
+  auto executable = std::getenv("TD_BENCHMARK_EXECUTABLE");
+  std::sort(pass_results.begin(), pass_results.end());
+  auto get_quantile = [&](double quantile) {
+    return pass_results[static_cast<size_t>(static_cast<double>(pass_results.size() - 1) * quantile)];
+  };
+  auto result = json_encode<std::string>(json_object([&](auto &o) {
+    o("executable", Slice(executable == nullptr ? "" : executable));
+    o("description", description);
+    o("n", n);
+    o("pass_count", static_cast<int32>(pass_results.size()));
+    o("average", average);
+    o("stddev", stddev);
+    o("min", pass_results[0]);
+    o("p50", get_quantile(0.5));
+    o("p90", get_quantile(0.9));
+    o("max", pass_results.back());
+    if (allocations_per_op >= 0) {
+      o("allocations_per_op", allocations_per_op);
+    }
+  }));
+  result += '\n';
+
+  auto r_fd = FileFd::open(CSlice(output_path), FileFd::Write | FileFd::Create | FileFd::Append);
+  if (r_fd.is_error()) {
+    LOG(ERROR) << "Can't open benchmark output file: " << r_fd.error();
+    return;
+  }
+  auto fd = r_fd.move_as_ok();
+  auto r_size = fd.write(result);
+  if (r_size.is_error() || r_size.ok() != result.size()) {
+    LOG(ERROR) << "Can't write benchmark result to " << output_path;
+  }
+  fd.close();
+}
+
+}  // namespace detail
+
 inline void bench(Benchmark &b, double max_time = 1.0) {
   int n = 1;
   double pass_time = 0;
   double total_pass_time = 0;
+  uint64 allocation_count = 0;
   while (pass_time < max_time && total_pass_time < max_time * 3 && n < (1 << 30)) {
     n *= 2;
-    std::tie(pass_time, total_pass_time) = bench_n(b, n);
+    std::tie(pass_time, total_pass_time) = bench_n(b, n, &allocation_count);
   }
   pass_time = n / pass_time;
 
-  int pass_cnt = 2;
+  int pass_cnt = detail::get_benchmark_pass_count();
   double sum = pass_time;
   double square_sum = pass_time * pass_time;
   double min_pass_time = pass_time;
   double max_pass_time = pass_time;
+  uint64 total_allocation_count = allocation_count;
+  vector<double> pass_results{pass_time};
 
   for (int i = 1; i < pass_cnt; i++) {
-    pass_time = n / bench_n(b, n).first;
+    pass_time = n / bench_n(b, n, &allocation_count).first;
+    total_allocation_count += allocation_count;
+    pass_results.push_back(pass_time);
     sum += pass_time;
     square_sum += pass_time * pass_time;
     if (pass_time < min_pass_time) {
@@ -112,9 +193,17 @@ inline void bench(Benchmark &b, double max_time = 1.0) {
     }
   }
   double average = sum / pass_cnt;
-  double d = sqrt(square_sum / pass_cnt - average * average);
+  double d = sqrt(std::max(square_sum / pass_cnt - average * average, 0.0));
+  double allocations_per_op = -1.0;
+  if (get_benchmark_allocation_counter() != nullptr) {
+    allocations_per_op = static_cast<double>(total_allocation_count) / (static_cast<double>(n) * pass_cnt);
+  }
 
   auto description = b.get_description();
+  string allocations;
+  if (allocations_per_op >= 0) {
+    allocations = PSTRING() << " [allocations per op = " << StringBuilder::FixedDouble(allocations_per_op, 3) << ']';
+  }
   std::string pad;
   if (description.size() < 40) {
     pad = std::string(40 - description.size(), ' ');
@@ -122,7 +211,10 @@ inline void bench(Benchmark &b, double max_time = 1.0) {
 
   LOG(ERROR) << "Bench [" << pad << description << "]: " << StringBuilder::FixedDouble(average, 3) << '['
              << StringBuilder::FixedDouble(min_pass_time, 3) << '-' << StringBuilder::FixedDouble(max_pass_time, 3)
-             << "] ops/sec,\t" << format::as_time(1 / average) << " [d = " << StringBuilder::FixedDouble(d, 6) << ']';
+             << "] ops/sec,\t" << format::as_time(1 / average) << " [d = " << StringBuilder::FixedDouble(d, 6) << ']'
+             << allocations;
+
+  detail::store_benchmark_result(description, n, std::move(pass_results), average, d, allocations_per_op);
 }
 
 inline void bench(Benchmark &&b, double max_time = 1.0) {
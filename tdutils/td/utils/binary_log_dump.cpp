@@ -0,0 +1,34 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2022
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "td/utils/common.h"
+#include "td/utils/filesystem.h"
+#include "td/utils/logging.h"
+#include "td/utils/port/StdStreams.h"
+#include "td/utils/Slice.h"
+
+int main(int argc, char *argv[]) {
+  if (argc < 2) {
+    LOG(PLAIN) << "Usage: binary_log_dump <log_file_name>";
+    return 1;
+  }
+  auto r_log = td::read_file_str(td::CSlice(argv[1]));
+  if (r_log.is_error()) {
+    LOG(PLAIN) << "Failed to read log file: " << r_log.error();
+    LOG(PLAIN) << "Usage: binary_log_dump <log_file_name>";
+    return 1;
+  }
+
+  auto result = td::render_binary_log(r_log.ok());
+  td::Slice text = result;
+  while (!text.empty()) {
+    auto r_size = td::Stdout().write(text);
+    if (r_size.is_error()) {
+      return 1;
+    }
+    text.remove_prefix(r_size.ok());
+  }
+}
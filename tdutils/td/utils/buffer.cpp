@@ -6,6 +6,7 @@
 //
 #include "td/utils/buffer.h"
 
+#include "td/utils/bits.h"
 #include "td/utils/logging.h"
 #include "td/utils/port/thread_local.h"
 
@@ -25,6 +26,111 @@ TD_THREAD_LOCAL BufferAllocator::BufferRawTls *BufferAllocator::buffer_raw_tls;
 
 std::atomic<size_t> BufferAllocator::buffer_mem;
 
+constexpr size_t BufferAllocator::SIZE_CLASS_COUNT;
+constexpr uint8 BufferAllocator::NO_SIZE_CLASS;
+
+namespace {
+
+// the smallest size class is for buffers with up to 512 bytes of data; every next power of two is split in two classes
+constexpr int32 MIN_SIZE_CLASS_LOG = 9;
+// maximum total size of memory blocks of one size class cached by a thread
+constexpr size_t MAX_SIZE_CLASS_CACHED_SIZE = 1 << 18;
+// maximum total size of memory blocks cached by a thread
+constexpr size_t MAX_THREAD_CACHED_SIZE = 1 << 22;
+
+struct SizeClassCounters {
+  std::atomic<int64> live_count{0};
+  std::atomic<int64> peak_live_count{0};
+  std::atomic<uint64> allocation_count{0};
+  std::atomic<uint64> reuse_count{0};
+};
+
+// the last element is for big buffers
+SizeClassCounters size_class_counters[BufferAllocator::SIZE_CLASS_COUNT + 1];
+
+}  // namespace
+
+uint8 BufferAllocator::get_size_class(size_t size) {
+  if (size <= (static_cast<size_t>(1) << MIN_SIZE_CLASS_LOG)) {
+    return 0;
+  }
+  // 2^size_log < size <= 2^(size_log + 1)
+  auto size_log = 63 - count_leading_zeroes64(static_cast<uint64>(size - 1));
+  size_t size_class = static_cast<size_t>(size_log - MIN_SIZE_CLASS_LOG) * 2 +
+                      (size > (static_cast<size_t>(3) << (size_log - 1)) ? 2 : 1);
+  if (size_class >= SIZE_CLASS_COUNT) {
+    return NO_SIZE_CLASS;
+  }
+  return static_cast<uint8>(size_class);
+}
+
+size_t BufferAllocator::get_size_class_max_size(uint8 size_class) {
+  CHECK(size_class < SIZE_CLASS_COUNT);
+  if (size_class == 0) {
+    return static_cast<size_t>(1) << MIN_SIZE_CLASS_LOG;
+  }
+  auto size_log = MIN_SIZE_CLASS_LOG + (size_class - 1) / 2;
+  if (size_class % 2 == 1) {
+    return static_cast<size_t>(3) << (size_log - 1);
+  }
+  return static_cast<size_t>(2) << size_log;
+}
+
+size_t BufferAllocator::get_buffer_raw_size(size_t data_size) {
+  return max(sizeof(BufferRaw), TD_OFFSETOF(BufferRaw, data_) + data_size);
+}
+
+BufferAllocator::BufferRawTls::~BufferRawTls() {
+  // the buffer can be returned to the free lists
+  buffer_raw.reset();
+  for (size_t size_class = 0; size_class < SIZE_CLASS_COUNT; size_class++) {
+    while (free_buffer_raws[size_class] != nullptr) {
+      auto *free_buffer_raw = free_buffer_raws[size_class];
+      free_buffer_raws[size_class] = free_buffer_raw->next;
+      destroy_buffer_raw(free_buffer_raw);
+    }
+    free_buffer_raw_count[size_class] = 0;
+  }
+  free_buffer_raw_size = 0;
+}
+
+void *BufferAllocator::BufferRawTls::get_free_buffer_raw(uint8 size_class) {
+  auto *free_buffer_raw = free_buffer_raws[size_class];
+  if (free_buffer_raw == nullptr) {
+    return nullptr;
+  }
+  free_buffer_raws[size_class] = free_buffer_raw->next;
+  free_buffer_raw_count[size_class]--;
+  free_buffer_raw_size -= get_size_class_max_size(size_class);
+  return free_buffer_raw;
+}
+
+bool BufferAllocator::BufferRawTls::put_free_buffer_raw(uint8 size_class, void *memory) {
+  auto max_size = get_size_class_max_size(size_class);
+  if ((free_buffer_raw_count[size_class] + 1) * max_size > max(MAX_SIZE_CLASS_CACHED_SIZE, max_size) ||
+      free_buffer_raw_size + max_size > MAX_THREAD_CACHED_SIZE) {
+    return false;
+  }
+  free_buffer_raws[size_class] = new (memory) FreeBufferRaw{free_buffer_raws[size_class]};
+  free_buffer_raw_count[size_class]++;
+  free_buffer_raw_size += max_size;
+  return true;
+}
+
+vector<BufferAllocator::SizeClassStats> BufferAllocator::get_size_class_stats() {
+  vector<SizeClassStats> result(SIZE_CLASS_COUNT + 1);
+  for (size_t i = 0; i <= SIZE_CLASS_COUNT; i++) {
+    auto &counters = size_class_counters[i];
+    auto &stats = result[i];
+    stats.max_size = i == SIZE_CLASS_COUNT ? 0 : get_size_class_max_size(static_cast<uint8>(i));
+    stats.live_count = counters.live_count.load(std::memory_order_relaxed);
+    stats.peak_live_count = counters.peak_live_count.load(std::memory_order_relaxed);
+    stats.allocation_count = counters.allocation_count.load(std::memory_order_relaxed);
+    stats.reuse_count = counters.reuse_count.load(std::memory_order_relaxed);
+  }
+  return result;
+}
+
 int64 BufferAllocator::get_buffer_slice_size() {
   return 0;
 }
@@ -92,10 +198,21 @@ BufferAllocator::ReaderPtr BufferAllocator::create_reader(const ReaderPtr &raw)
 void BufferAllocator::dec_ref_cnt(BufferRaw *ptr) {
   int left = ptr->ref_cnt_.fetch_sub(1, std::memory_order_acq_rel);
   if (left == 1) {
-    auto buf_size = max(sizeof(BufferRaw), TD_OFFSETOF(BufferRaw, data_) + ptr->data_size_);
-    buffer_mem -= buf_size;
+    auto size_class = ptr->size_class_;
+    auto data_size = size_class == NO_SIZE_CLASS ? ptr->data_size_ : get_size_class_max_size(size_class);
+    buffer_mem -= get_buffer_raw_size(data_size);
     ptr->~BufferRaw();
-    delete[] ptr;
+
+    if (size_class == NO_SIZE_CLASS) {
+      size_class_counters[SIZE_CLASS_COUNT].live_count.fetch_sub(1, std::memory_order_relaxed);
+      return destroy_buffer_raw(ptr);
+    }
+    size_class_counters[size_class].live_count.fetch_sub(1, std::memory_order_relaxed);
+    // the buffer can be destroyed by any thread, so the memory is reused by the thread, which destroyed the buffer
+    if (buffer_raw_tls != nullptr && buffer_raw_tls->put_free_buffer_raw(size_class, ptr)) {
+      return;
+    }
+    destroy_buffer_raw(ptr);
   }
 }
 
@@ -108,13 +225,35 @@ size_t ChainBufferReader::advance(size_t offset, MutableSlice dest) {
 BufferRaw *BufferAllocator::create_buffer_raw(size_t size) {
   size = (size + 7) & -8;
 
-  auto buf_size = TD_OFFSETOF(BufferRaw, data_) + size;
-  if (buf_size < sizeof(BufferRaw)) {
-    buf_size = sizeof(BufferRaw);
+  auto size_class = get_size_class(size);
+  auto &counters = size_class_counters[size_class == NO_SIZE_CLASS ? SIZE_CLASS_COUNT : size_class];
+  counters.allocation_count.fetch_add(1, std::memory_order_relaxed);
+  auto live_count = counters.live_count.fetch_add(1, std::memory_order_relaxed) + 1;
+  if (live_count > counters.peak_live_count.load(std::memory_order_relaxed)) {
+    // the peak can be a little bit inaccurate if buffers are created by several threads simultaneously
+    counters.peak_live_count.store(live_count, std::memory_order_relaxed);
   }
+
+  // buffer_mem accounts only memory of alive buffers, cached memory blocks aren't included
+  auto buf_size = get_buffer_raw_size(size_class == NO_SIZE_CLASS ? size : get_size_class_max_size(size_class));
   buffer_mem += buf_size;
-  auto *buffer_raw = reinterpret_cast<BufferRaw *>(new char[buf_size]);
-  return new (buffer_raw) BufferRaw(size);
+
+  void *memory = nullptr;
+  if (size_class != NO_SIZE_CLASS) {
+    init_thread_local<BufferRawTls>(buffer_raw_tls);
+    memory = buffer_raw_tls->get_free_buffer_raw(size_class);
+    if (memory != nullptr) {
+      counters.reuse_count.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+  if (memory == nullptr) {
+    memory = new char[buf_size];
+  }
+  return new (memory) BufferRaw(size, size_class);
+}
+
+void BufferAllocator::destroy_buffer_raw(void *memory) {
+  delete[] static_cast<char *>(memory);
 }
 
 void BufferBuilder::append(BufferSlice slice) {
@@ -17,7 +17,7 @@
 namespace td {
 
 struct BufferRaw {
-  explicit BufferRaw(size_t size) : data_size_(size) {
+  BufferRaw(size_t size, uint8 size_class) : data_size_(size), size_class_(size_class) {
   }
   size_t data_size_;
 
@@ -34,6 +34,9 @@ struct BufferRaw {
   std::atomic<bool> has_writer_{true};
   bool was_reader_{false};
 
+  // size class of the allocated memory block, which is used to reuse the block after the buffer is destroyed
+  uint8 size_class_;
+
   alignas(4) unsigned char data_[1];
 };
 
@@ -69,6 +72,20 @@ class BufferAllocator {
   static size_t get_buffer_mem();
   static int64 get_buffer_slice_size();
 
+  // number of size classes for buffers with up to 1 MB of data
+  static constexpr size_t SIZE_CLASS_COUNT = 23;
+
+  struct SizeClassStats {
+    size_t max_size = 0;  // 0 for big buffers, which have no size class
+    int64 live_count = 0;
+    int64 peak_live_count = 0;
+    uint64 allocation_count = 0;
+    uint64 reuse_count = 0;  // number of allocations from thread-local free lists
+  };
+
+  // returns statistics for all size classes; the last element is for big buffers, which are never reused
+  static vector<SizeClassStats> get_size_class_stats();
+
   static void clear_thread_local();
 
  private:
@@ -85,16 +102,47 @@ class BufferAllocator {
       dec_ref_cnt(ptr);
     }
   };
+
+  static constexpr uint8 NO_SIZE_CLASS = 255;
+
+  struct FreeBufferRaw {
+    FreeBufferRaw *next;
+  };
+
   struct BufferRawTls {
     std::unique_ptr<BufferRaw, BufferRawDeleter> buffer_raw;
+
+    // free memory blocks of each size class, which can be reused by the thread
+    FreeBufferRaw *free_buffer_raws[SIZE_CLASS_COUNT] = {};
+    size_t free_buffer_raw_count[SIZE_CLASS_COUNT] = {};
+    size_t free_buffer_raw_size = 0;
+
+    BufferRawTls() = default;
+    BufferRawTls(const BufferRawTls &) = delete;
+    BufferRawTls &operator=(const BufferRawTls &) = delete;
+    BufferRawTls(BufferRawTls &&) = delete;
+    BufferRawTls &operator=(BufferRawTls &&) = delete;
+    ~BufferRawTls();
+
+    void *get_free_buffer_raw(uint8 size_class);
+
+    bool put_free_buffer_raw(uint8 size_class, void *memory);
   };
 
   static TD_THREAD_LOCAL BufferRawTls *buffer_raw_tls;
 
   static void dec_ref_cnt(BufferRaw *ptr);
 
+  static uint8 get_size_class(size_t size);
+
+  static size_t get_size_class_max_size(uint8 size_class);
+
+  static size_t get_buffer_raw_size(size_t data_size);
+
   static BufferRaw *create_buffer_raw(size_t size);
 
+  static void destroy_buffer_raw(void *memory);
+
   static std::atomic<size_t> buffer_mem;
 };
 
@@ -742,10 +790,7 @@ class ChainBufferWriter {
       return append(slice.as_slice());
     }
 
-    auto new_tail = ChainBufferNodeAllocator::create(std::move(slice), false);
-    tail_->next_ = ChainBufferNodeAllocator::clone(new_tail);
-    writer_ = BufferWriter();
-    tail_ = std::move(new_tail);  // release tail_
+    append_node(std::move(slice));
   }
 
   void append(ChainBufferReader &&reader) {
@@ -759,12 +804,33 @@ class ChainBufferWriter {
     }
   }
 
+  // shares buffers of the reader instead of copying data even if there is enough space in the last buffer;
+  // only small pieces of data are copied
+  void append_without_copy(ChainBufferReader &&reader) {
+    while (!reader.empty()) {
+      auto slice = reader.read_as_buffer_slice();
+      if (slice.size() < (1 << 8)) {
+        append(slice.as_slice());
+      } else {
+        append_node(std::move(slice));
+      }
+    }
+  }
+
   ChainBufferReader extract_reader() {
     CHECK(head_);
     return ChainBufferReader(std::move(head_));
   }
 
  private:
+  void append_node(BufferSlice slice) {
+    CHECK(!empty());
+    auto new_tail = ChainBufferNodeAllocator::create(std::move(slice), false);
+    tail_->next_ = ChainBufferNodeAllocator::clone(new_tail);
+    writer_ = BufferWriter();
+    tail_ = std::move(new_tail);  // release tail_
+  }
+
   bool empty() const {
     return !tail_;
   }
@@ -39,6 +39,20 @@
 #include <openssl/params.h>
 #endif
 
+#if TD_HAVE_OPENSSL && (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define TD_AES_NI 1
+#include <cpuid.h>
+#include <emmintrin.h>
+#include <wmmintrin.h>
+#endif
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define TD_CRC64_PCLMUL 1
+#include <cpuid.h>
+#include <emmintrin.h>
+#include <wmmintrin.h>
+#endif
+
 #if TD_HAVE_ZLIB
 #include <zlib.h>
 #endif
@@ -422,15 +436,141 @@ void AesState::decrypt(const uint8 *src, uint8 *dst, int size) {
   impl_->evp.decrypt(src, dst, size);
 }
 
+#if TD_AES_NI
+namespace {
+
+// AES-NI isn't guaranteed to be available, so it is checked at runtime and used only in functions compiled for it
+#define TD_AES_NI_TARGET __attribute__((target("aes,sse2")))
+
+constexpr size_t AES_256_ROUND_KEY_COUNT = 15;
+
+bool is_aes_ni_supported() {
+  static const bool is_supported = [] {
+    unsigned int eax = 0;
+    unsigned int ebx = 0;
+    unsigned int ecx = 0;
+    unsigned int edx = 0;
+    return __get_cpuid(1, &eax, &ebx, &ecx, &edx) != 0 && (ecx & bit_AES) != 0 && (edx & bit_SSE2) != 0;
+  }();
+  return is_supported;
+}
+
+TD_AES_NI_TARGET __m128i aes_ni_expand_key_even(__m128i key, __m128i assist) {
+  assist = _mm_shuffle_epi32(assist, 0xff);
+  key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+  key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+  key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+  return _mm_xor_si128(key, assist);
+}
+
+TD_AES_NI_TARGET __m128i aes_ni_expand_key_odd(__m128i key, __m128i even_key) {
+  auto assist = _mm_shuffle_epi32(_mm_aeskeygenassist_si128(even_key, 0x00), 0xaa);
+  key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+  key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+  key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+  return _mm_xor_si128(key, assist);
+}
+
+// stores AES-256 encryption round keys or decryption round keys for the equivalent inverse cipher
+TD_AES_NI_TARGET void aes_ni_init_round_keys(const uint8 *key, bool encrypt, uint8 *round_keys) {
+  __m128i keys[AES_256_ROUND_KEY_COUNT];
+  keys[0] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(key));
+  keys[1] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(key + AES_BLOCK_SIZE));
+#define TD_AES_NI_EXPAND_KEY(i, rcon)                                                        \
+  keys[i] = aes_ni_expand_key_even(keys[i - 2], _mm_aeskeygenassist_si128(keys[i - 1], rcon)); \
+  if (i + 1 < AES_256_ROUND_KEY_COUNT) {                                                     \
+    keys[i + 1] = aes_ni_expand_key_odd(keys[i - 1], keys[i]);                               \
+  }
+  TD_AES_NI_EXPAND_KEY(2, 0x01);
+  TD_AES_NI_EXPAND_KEY(4, 0x02);
+  TD_AES_NI_EXPAND_KEY(6, 0x04);
+  TD_AES_NI_EXPAND_KEY(8, 0x08);
+  TD_AES_NI_EXPAND_KEY(10, 0x10);
+  TD_AES_NI_EXPAND_KEY(12, 0x20);
+  TD_AES_NI_EXPAND_KEY(14, 0x40);
+#undef TD_AES_NI_EXPAND_KEY
+
+  for (size_t i = 0; i < AES_256_ROUND_KEY_COUNT; i++) {
+    __m128i round_key;
+    if (encrypt) {
+      round_key = keys[i];
+    } else if (i == 0 || i + 1 == AES_256_ROUND_KEY_COUNT) {
+      round_key = keys[AES_256_ROUND_KEY_COUNT - 1 - i];
+    } else {
+      round_key = _mm_aesimc_si128(keys[AES_256_ROUND_KEY_COUNT - 1 - i]);
+    }
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(round_keys + i * AES_BLOCK_SIZE), round_key);
+  }
+}
+
+// IGE chaining makes every block dependent on the previous one in both directions, so blocks are processed serially,
+// but without any per-block call overhead and with all round keys kept in registers
+TD_AES_NI_TARGET void aes_ni_ige_encrypt(const uint8 *round_keys, uint8 *encrypted_iv, uint8 *plaintext_iv,
+                                         const uint8 *in, uint8 *out, size_t block_count) {
+  __m128i keys[AES_256_ROUND_KEY_COUNT];
+  for (size_t i = 0; i < AES_256_ROUND_KEY_COUNT; i++) {
+    keys[i] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(round_keys + i * AES_BLOCK_SIZE));
+  }
+  auto prev_encrypted = _mm_loadu_si128(reinterpret_cast<const __m128i *>(encrypted_iv));
+  auto prev_plaintext = _mm_loadu_si128(reinterpret_cast<const __m128i *>(plaintext_iv));
+  for (size_t i = 0; i < block_count; i++) {
+    auto plaintext = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i * AES_BLOCK_SIZE));
+    auto block = _mm_xor_si128(_mm_xor_si128(plaintext, prev_encrypted), keys[0]);
+    for (size_t j = 1; j + 1 < AES_256_ROUND_KEY_COUNT; j++) {
+      block = _mm_aesenc_si128(block, keys[j]);
+    }
+    block = _mm_aesenclast_si128(block, keys[AES_256_ROUND_KEY_COUNT - 1]);
+    prev_encrypted = _mm_xor_si128(block, prev_plaintext);
+    prev_plaintext = plaintext;
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i * AES_BLOCK_SIZE), prev_encrypted);
+  }
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(encrypted_iv), prev_encrypted);
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(plaintext_iv), prev_plaintext);
+}
+
+TD_AES_NI_TARGET void aes_ni_ige_decrypt(const uint8 *round_keys, uint8 *encrypted_iv, uint8 *plaintext_iv,
+                                         const uint8 *in, uint8 *out, size_t block_count) {
+  __m128i keys[AES_256_ROUND_KEY_COUNT];
+  for (size_t i = 0; i < AES_256_ROUND_KEY_COUNT; i++) {
+    keys[i] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(round_keys + i * AES_BLOCK_SIZE));
+  }
+  auto prev_encrypted = _mm_loadu_si128(reinterpret_cast<const __m128i *>(encrypted_iv));
+  auto prev_plaintext = _mm_loadu_si128(reinterpret_cast<const __m128i *>(plaintext_iv));
+  for (size_t i = 0; i < block_count; i++) {
+    auto encrypted = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i * AES_BLOCK_SIZE));
+    auto block = _mm_xor_si128(_mm_xor_si128(encrypted, prev_plaintext), keys[0]);
+    for (size_t j = 1; j + 1 < AES_256_ROUND_KEY_COUNT; j++) {
+      block = _mm_aesdec_si128(block, keys[j]);
+    }
+    block = _mm_aesdeclast_si128(block, keys[AES_256_ROUND_KEY_COUNT - 1]);
+    prev_plaintext = _mm_xor_si128(block, prev_encrypted);
+    prev_encrypted = encrypted;
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i * AES_BLOCK_SIZE), prev_plaintext);
+  }
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(encrypted_iv), prev_encrypted);
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(plaintext_iv), prev_plaintext);
+}
+
+}  // namespace
+#endif
+
 class AesIgeStateImpl {
  public:
   void init(Slice key, Slice iv, bool encrypt) {
     CHECK(key.size() == 32);
     CHECK(iv.size() == 32);
-    if (encrypt) {
-      evp_.init_encrypt_cbc(key);
-    } else {
-      evp_.init_decrypt_ecb(key);
+#if TD_AES_NI
+    use_aes_ni_ = is_aes_ni_supported();
+    if (use_aes_ni_) {
+      aes_ni_init_round_keys(key.ubegin(), encrypt, aes_ni_round_keys_);
+    }
+#endif
+    if (!use_aes_ni_) {
+      if (encrypt) {
+        evp_.init_encrypt_cbc(key);
+      } else {
+        evp_.init_decrypt_ecb(key);
+      }
     }
 
     encrypted_iv_.load(iv.ubegin());
@@ -449,6 +589,11 @@ class AesIgeStateImpl {
     auto len = to.size() / AES_BLOCK_SIZE;
     auto in = from.ubegin();
     auto out = to.ubegin();
+#if TD_AES_NI
+    if (use_aes_ni_) {
+      return aes_ni_ige_encrypt(aes_ni_round_keys_, encrypted_iv_.raw(), plaintext_iv_.raw(), in, out, len);
+    }
+#endif
 
     static constexpr size_t BLOCK_COUNT = 31;
     while (len != 0) {
@@ -489,6 +634,11 @@ class AesIgeStateImpl {
     auto len = to.size() / AES_BLOCK_SIZE;
     auto in = from.ubegin();
     auto out = to.ubegin();
+#if TD_AES_NI
+    if (use_aes_ni_) {
+      return aes_ni_ige_decrypt(aes_ni_round_keys_, encrypted_iv_.raw(), plaintext_iv_.raw(), in, out, len);
+    }
+#endif
 
     AesBlock encrypted;
 
@@ -512,6 +662,10 @@ class AesIgeStateImpl {
   Evp evp_;
   AesBlock encrypted_iv_;
   AesBlock plaintext_iv_;
+  bool use_aes_ni_ = false;
+#if TD_AES_NI
+  uint8 aes_ni_round_keys_[AES_256_ROUND_KEY_COUNT * AES_BLOCK_SIZE];
+#endif
 };
 
 AesIgeState::AesIgeState() = default;
@@ -624,7 +778,46 @@ void AesCbcState::decrypt(Slice from, MutableSlice to) {
 
 struct AesCtrState::Impl {
 #if OPENSSL_VERSION_NUMBER >= 0x10100000L
+  // keystream is generated in batches for small inputs, because each call to EVP has a noticeable overhead,
+  // while big inputs are passed directly to EVP, which processes many blocks in parallel
+  static constexpr size_t KEYSTREAM_SIZE = 512;
+  static constexpr size_t MIN_DIRECT_SIZE = 256;
+
   Evp evp_;
+  uint8 keystream_[KEYSTREAM_SIZE];
+  size_t keystream_pos_ = KEYSTREAM_SIZE;
+
+  static void xor_keystream(const uint8 *from, const uint8 *keystream, uint8 *to, size_t size) {
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+      as<uint64>(to + i) = as<uint64>(from + i) ^ as<uint64>(keystream + i);
+    }
+    for (; i < size; i++) {
+      to[i] = static_cast<uint8>(from[i] ^ keystream[i]);
+    }
+  }
+
+  void encrypt(const uint8 *from, uint8 *to, size_t size) {
+    auto buffered_size = td::min(size, KEYSTREAM_SIZE - keystream_pos_);
+    xor_keystream(from, keystream_ + keystream_pos_, to, buffered_size);
+    keystream_pos_ += buffered_size;
+    if (buffered_size == size) {
+      return;
+    }
+    from += buffered_size;
+    to += buffered_size;
+    size -= buffered_size;
+
+    // the keystream buffer is exhausted, so the EVP counter is synchronized with the current position
+    if (size >= MIN_DIRECT_SIZE) {
+      evp_.encrypt(from, to, narrow_cast<int>(size));
+      return;
+    }
+    std::fill(keystream_, keystream_ + KEYSTREAM_SIZE, static_cast<uint8>(0));
+    evp_.encrypt(keystream_, keystream_, static_cast<int>(KEYSTREAM_SIZE));
+    xor_keystream(from, keystream_, to, size);
+    keystream_pos_ = size;
+  }
 #else
   AES_KEY aes_key_;
   uint8 counter_[AES_BLOCK_SIZE];
@@ -657,7 +850,7 @@ void AesCtrState::init(Slice key, Slice iv) {
 void AesCtrState::encrypt(Slice from, MutableSlice to) {
   CHECK(from.size() <= to.size());
 #if OPENSSL_VERSION_NUMBER >= 0x10100000L
-  ctx_->evp_.encrypt(from.ubegin(), to.ubegin(), narrow_cast<int>(from.size()));
+  ctx_->encrypt(from.ubegin(), to.ubegin(), from.size());
 #else
   auto from_ptr = from.ubegin();
   auto to_ptr = to.ubegin();
@@ -841,6 +1034,20 @@ void md5(Slice input, MutableSlice output) {
 #endif
 }
 
+#if OPENSSL_VERSION_NUMBER >= 0x10100000L
+static void init_hmac_pad_state(EVP_MD_CTX *ctx, const EVP_MD *evp_md, const unsigned char *key, size_t block_size,
+                                unsigned char pad) {
+  unsigned char block[128];
+  for (size_t i = 0; i < block_size; i++) {
+    block[i] = static_cast<unsigned char>(key[i] ^ pad);
+  }
+  int err = EVP_DigestInit_ex(ctx, evp_md, nullptr);
+  LOG_IF(FATAL, err != 1);
+  err = EVP_DigestUpdate(ctx, block, block_size);
+  LOG_IF(FATAL, err != 1);
+}
+#endif
+
 static void pbkdf2_impl(Slice password, Slice salt, int iteration_count, MutableSlice dest, const EVP_MD *evp_md) {
   CHECK(evp_md != nullptr);
   int hash_size = EVP_MD_size(evp_md);
@@ -870,11 +1077,59 @@ static void pbkdf2_impl(Slice password, Slice salt, int iteration_count, Mutable
       }
     }
   }
-#else
+#elif OPENSSL_VERSION_NUMBER < 0x10100000L
   int err = PKCS5_PBKDF2_HMAC(password.data(), narrow_cast<int>(password.size()), salt.ubegin(),
                               narrow_cast<int>(salt.size()), iteration_count, evp_md, narrow_cast<int>(dest.size()),
                               dest.ubegin());
   LOG_IF(FATAL, err != 1);
+#else
+  // digest states after processing of the inner and the outer HMAC key blocks don't depend on the iteration,
+  // so they are computed once and only copied in the loop instead of reinitializing HMAC for every iteration
+  auto block_size = static_cast<size_t>(EVP_MD_block_size(evp_md));
+  CHECK(hash_size <= 64);
+  CHECK(block_size <= 128);
+
+  unsigned char key[128] = {};
+  if (password.size() > block_size) {
+    int err = EVP_Digest(password.ubegin(), password.size(), key, nullptr, evp_md, nullptr);
+    LOG_IF(FATAL, err != 1);
+  } else {
+    std::copy(password.ubegin(), password.uend(), key);
+  }
+
+  EVP_MD_CTX *inner_ctx = EVP_MD_CTX_new();
+  EVP_MD_CTX *outer_ctx = EVP_MD_CTX_new();
+  EVP_MD_CTX *ctx = EVP_MD_CTX_new();
+  LOG_IF(FATAL, inner_ctx == nullptr || outer_ctx == nullptr || ctx == nullptr);
+  SCOPE_EXIT {
+    EVP_MD_CTX_free(inner_ctx);
+    EVP_MD_CTX_free(outer_ctx);
+    EVP_MD_CTX_free(ctx);
+  };
+  init_hmac_pad_state(inner_ctx, evp_md, key, block_size, 0x36);
+  init_hmac_pad_state(outer_ctx, evp_md, key, block_size, 0x5c);
+
+  unsigned char buf[64];
+  auto calc_hmac = [&](Slice first, Slice second) {
+    int err = EVP_MD_CTX_copy_ex(ctx, inner_ctx);
+    err &= EVP_DigestUpdate(ctx, first.ubegin(), first.size());
+    err &= EVP_DigestUpdate(ctx, second.ubegin(), second.size());
+    err &= EVP_DigestFinal_ex(ctx, buf, nullptr);
+    err &= EVP_MD_CTX_copy_ex(ctx, outer_ctx);
+    err &= EVP_DigestUpdate(ctx, buf, hash_size);
+    err &= EVP_DigestFinal_ex(ctx, buf, nullptr);
+    LOG_IF(FATAL, err != 1);
+  };
+
+  unsigned char counter[4] = {0, 0, 0, 1};
+  calc_hmac(salt, Slice(counter, 4));
+  std::copy(buf, buf + hash_size, dest.ubegin());
+  for (int iter = 1; iter < iteration_count; iter++) {
+    calc_hmac(Slice(buf, hash_size), Slice());
+    for (int i = 0; i < hash_size; i++) {
+      dest[i] = static_cast<unsigned char>(dest[i] ^ buf[i]);
+    }
+  }
 #endif
 }
 
@@ -1258,8 +1513,84 @@ static uint64 crc64_partial(Slice data, uint64 crc) {
   return crc;
 }
 
+#if TD_CRC64_PCLMUL
+namespace {
+
+// PCLMULQDQ isn't guaranteed to be available, so it is checked at runtime and used only in functions compiled for it
+#define TD_CRC64_PCLMUL_TARGET __attribute__((target("pclmul,sse2")))
+
+bool is_pclmul_supported() {
+  static const bool is_supported = [] {
+    unsigned int eax = 0;
+    unsigned int ebx = 0;
+    unsigned int ecx = 0;
+    unsigned int edx = 0;
+    return __get_cpuid(1, &eax, &ebx, &ecx, &edx) != 0 && (ecx & bit_PCLMUL) != 0 && (edx & bit_SSE2) != 0;
+  }();
+  return is_supported;
+}
+
+TD_CRC64_PCLMUL_TARGET __m128i crc64_pclmul_load(const uint8 *ptr) {
+  return _mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr));
+}
+
+// returns a 128-bit value congruent to x * x^d, where k contains bit-reflected x^(d+63) and x^(d-1)
+// modulo the CRC polynomial in its low and high halves respectively
+TD_CRC64_PCLMUL_TARGET __m128i crc64_pclmul_fold(__m128i x, __m128i k) {
+  return _mm_xor_si128(_mm_clmulepi64_si128(x, k, 0x00), _mm_clmulepi64_si128(x, k, 0x11));
+}
+
+// size must be a multiple of 16 and not less than 64
+TD_CRC64_PCLMUL_TARGET uint64 crc64_pclmul_partial(const uint8 *ptr, size_t size, uint64 crc) {
+  const __m128i k512 = _mm_set_epi64x(0x081f6054a7842df4ll, 0x6ae3efbb9dd441f3ll);
+  const __m128i k384 = _mm_set_epi64x(0x69a35d91c3730254ll, static_cast<long long>(0xb5ea1af9c013aca4ull));
+  const __m128i k256 = _mm_set_epi64x(0x3be653a30fe1af51ll, 0x60095b008a9efa44ll);
+  const __m128i k128 = _mm_set_epi64x(static_cast<long long>(0xdabe95afc7875f40ull),
+                                      static_cast<long long>(0xe05dd497ca393ae4ull));
+
+  // four independent accumulators hide latency of carry-less multiplication
+  __m128i x0 = _mm_xor_si128(crc64_pclmul_load(ptr), _mm_set_epi64x(0, static_cast<long long>(crc)));
+  __m128i x1 = crc64_pclmul_load(ptr + 16);
+  __m128i x2 = crc64_pclmul_load(ptr + 32);
+  __m128i x3 = crc64_pclmul_load(ptr + 48);
+  ptr += 64;
+  size -= 64;
+  while (size >= 64) {
+    x0 = _mm_xor_si128(crc64_pclmul_fold(x0, k512), crc64_pclmul_load(ptr));
+    x1 = _mm_xor_si128(crc64_pclmul_fold(x1, k512), crc64_pclmul_load(ptr + 16));
+    x2 = _mm_xor_si128(crc64_pclmul_fold(x2, k512), crc64_pclmul_load(ptr + 32));
+    x3 = _mm_xor_si128(crc64_pclmul_fold(x3, k512), crc64_pclmul_load(ptr + 48));
+    ptr += 64;
+    size -= 64;
+  }
+
+  __m128i x = _mm_xor_si128(_mm_xor_si128(crc64_pclmul_fold(x0, k384), crc64_pclmul_fold(x1, k256)),
+                            _mm_xor_si128(crc64_pclmul_fold(x2, k128), x3));
+  while (size >= 16) {
+    x = _mm_xor_si128(crc64_pclmul_fold(x, k128), crc64_pclmul_load(ptr));
+    ptr += 16;
+    size -= 16;
+  }
+
+  // the remaining 128-bit value has the same CRC as all processed data
+  uint8 buf[16];
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(buf), x);
+  return crc64_partial(Slice(buf, 16), 0);
+}
+
+}  // namespace
+#endif
+
 uint64 crc64(Slice data) {
-  return crc64_partial(data, static_cast<uint64>(-1)) ^ static_cast<uint64>(-1);
+  auto crc = static_cast<uint64>(-1);
+#if TD_CRC64_PCLMUL
+  if (data.size() >= 128 && is_pclmul_supported()) {
+    auto size = data.size() & ~static_cast<size_t>(15);
+    crc = crc64_pclmul_partial(data.ubegin(), size, crc);
+    data.remove_prefix(size);
+  }
+#endif
+  return crc64_partial(data, crc) ^ static_cast<uint64>(-1);
 }
 
 static const uint16 crc16_table[256] = {
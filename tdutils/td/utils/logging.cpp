@@ -14,6 +14,7 @@
 
 #include <atomic>
 #include <cstdlib>
+#include <cstring>
 #include <limits>
 #include <mutex>
 
@@ -58,19 +59,18 @@ void LogInterface::append(int log_level, CSlice slice) {
 TD_THREAD_LOCAL const char *Logger::tag_ = nullptr;
 TD_THREAD_LOCAL const char *Logger::tag2_ = nullptr;
 
-Logger::Logger(LogInterface &log, const LogOptions &options, int log_level, Slice file_name, int line_num,
-               Slice comment)
-    : Logger(log, options, log_level) {
-  if (log_level == VERBOSITY_NAME(PLAIN) && &options == &log_options) {
-    return;
-  }
-  if (!options_.add_info) {
-    return;
-  }
-  if (ExitGuard::is_exited()) {
-    return;
+static constexpr char BINARY_RECORD_MAGIC = '\xBB';  // can't be the first byte of a UTF-8 text
+
+static Slice get_log_file_name(Slice file_name) {
+  auto last_slash_ = static_cast<int32>(file_name.size()) - 1;
+  while (last_slash_ >= 0 && file_name[last_slash_] != '/' && file_name[last_slash_] != '\\') {
+    last_slash_--;
   }
+  return file_name.substr(last_slash_ + 1);
+}
 
+static void store_log_header(StringBuilder &sb_, int log_level, int32 thread_id, double time, Slice file_name,
+                             int line_num, Slice tag, Slice tag2, Slice comment) {
   // log level
   sb_ << '[';
   if (static_cast<uint32>(log_level) < 10) {
@@ -81,7 +81,6 @@ Logger::Logger(LogInterface &log, const LogOptions &options, int log_level, Slic
   sb_ << ']';
 
   // thread id
-  auto thread_id = get_thread_id();
   sb_ << "[t";
   if (static_cast<uint32>(thread_id) < 10) {
     sb_ << ' ' << static_cast<char>('0' + thread_id);
@@ -91,7 +90,6 @@ Logger::Logger(LogInterface &log, const LogOptions &options, int log_level, Slic
   sb_ << ']';
 
   // timestamp
-  auto time = Clocks::system();
   auto unix_time = static_cast<uint32>(time);
   auto nanoseconds = static_cast<uint32>((time - unix_time) * 1e9);
   sb_ << '[' << unix_time << '.';
@@ -104,22 +102,17 @@ Logger::Logger(LogInterface &log, const LogOptions &options, int log_level, Slic
 
   // file : line
   if (!file_name.empty()) {
-    auto last_slash_ = static_cast<int32>(file_name.size()) - 1;
-    while (last_slash_ >= 0 && file_name[last_slash_] != '/' && file_name[last_slash_] != '\\') {
-      last_slash_--;
-    }
-    file_name = file_name.substr(last_slash_ + 1);
     sb_ << '[' << file_name << ':' << static_cast<uint32>(line_num) << ']';
   }
 
   // context from tag_
-  if (tag_ != nullptr && *tag_) {
-    sb_ << "[#" << Slice(tag_) << ']';
+  if (!tag.empty()) {
+    sb_ << "[#" << tag << ']';
   }
 
   // context from tag2_
-  if (tag2_ != nullptr && *tag2_) {
-    sb_ << "[!" << Slice(tag2_) << ']';
+  if (!tag2.empty()) {
+    sb_ << "[!" << tag2 << ']';
   }
 
   // comment (e.g. condition in LOG_IF)
@@ -130,10 +123,62 @@ Logger::Logger(LogInterface &log, const LogOptions &options, int log_level, Slic
   sb_ << '\t';
 }
 
+Logger::Logger(LogInterface &log, const LogOptions &options, int log_level, Slice file_name, int line_num,
+               Slice comment)
+    : Logger(log, options, log_level) {
+  if (log_level == VERBOSITY_NAME(PLAIN) && &options == &log_options) {
+    return;
+  }
+  if (!options_.add_info) {
+    return;
+  }
+  if (ExitGuard::is_exited()) {
+    return;
+  }
+
+  auto thread_id = get_thread_id();
+  auto time = Clocks::system();
+  file_name = get_log_file_name(file_name);
+  Slice tag = tag_ == nullptr ? Slice() : Slice(tag_);
+  Slice tag2 = tag2_ == nullptr ? Slice() : Slice(tag2_);
+  if (options_.binary_format && options_.fix_newlines && log_level >= VERBOSITY_NAME(INFO) &&
+      log_level > max_callback_verbosity_level.load(std::memory_order_relaxed)) {
+    is_binary_ = true;
+    sb_ << BINARY_RECORD_MAGIC;
+    store_binary_value('r', static_cast<uint32>(0));  // size of the record, which is set in the destructor
+    store_binary_value('l', static_cast<int32>(log_level));
+    store_binary_value('t', thread_id);
+    store_binary_value('d', time);
+    store_binary_value('n', static_cast<int32>(line_num));
+    store_binary_argument(file_name);
+    store_binary_argument(tag);
+    store_binary_argument(tag2);
+    store_binary_argument(comment);
+    return;
+  }
+
+  store_log_header(sb_, log_level, thread_id, time, file_name, line_num, tag, tag2, comment);
+}
+
+void Logger::set_binary_size(size_t size_end) {
+  auto slice = sb_.as_cslice();
+  if (size_end > slice.size()) {
+    // the buffer is full
+    return;
+  }
+  auto size = static_cast<uint32>(slice.size() - size_end);
+  std::memcpy(slice.begin() + size_end - sizeof(size), &size, sizeof(size));
+}
+
 Logger::~Logger() {
   if (ExitGuard::is_exited()) {
     return;
   }
+  if (is_binary_) {
+    set_binary_size(2 + sizeof(uint32));
+    log_.append(log_level_, as_cslice());
+    return;
+  }
   if (options_.fix_newlines) {
     sb_ << '\n';
     auto slice = as_cslice();
@@ -150,6 +195,124 @@ Logger::~Logger() {
   }
 }
 
+template <class T>
+static bool parse_binary_value(Slice &data, char type, T &value) {
+  if (data.size() < 1 + sizeof(T) || data[0] != type) {
+    return false;
+  }
+  std::memcpy(&value, data.data() + 1, sizeof(T));
+  data.remove_prefix(1 + sizeof(T));
+  return true;
+}
+
+static bool parse_binary_string(Slice &data, Slice &value) {
+  uint32 size = 0;
+  if (!parse_binary_value(data, 's', size)) {
+    return false;
+  }
+  // the string can be truncated if the record didn't fit in the buffer
+  value = data.substr(0, min(static_cast<size_t>(size), data.size()));
+  data.remove_prefix(value.size());
+  return true;
+}
+
+static void render_binary_record(Slice record, string &result) {
+  int32 log_level = 0;
+  int32 thread_id = 0;
+  double time = 0.0;
+  int32 line_num = 0;
+  Slice file_name;
+  Slice tag;
+  Slice tag2;
+  Slice comment;
+  if (!parse_binary_value(record, 'l', log_level) || !parse_binary_value(record, 't', thread_id) ||
+      !parse_binary_value(record, 'd', time) || !parse_binary_value(record, 'n', line_num) ||
+      !parse_binary_string(record, file_name) || !parse_binary_string(record, tag) ||
+      !parse_binary_string(record, tag2) || !parse_binary_string(record, comment)) {
+    result += "[malformed binary log record]\n";
+    return;
+  }
+
+  StringBuilder sb;
+  store_log_header(sb, log_level, thread_id, time, file_name, line_num, tag, tag2, comment);
+  bool is_ok = true;
+  while (is_ok && !record.empty()) {
+    switch (record[0]) {
+      case 'c': {
+        char c = '\0';
+        is_ok = parse_binary_value(record, 'c', c);
+        sb << c;
+        break;
+      }
+      case 'b': {
+        uint8 b = 0;
+        is_ok = parse_binary_value(record, 'b', b);
+        sb << (b != 0);
+        break;
+      }
+      case 'i': {
+        int64 x = 0;
+        is_ok = parse_binary_value(record, 'i', x);
+        sb << x;
+        break;
+      }
+      case 'u': {
+        uint64 x = 0;
+        is_ok = parse_binary_value(record, 'u', x);
+        sb << x;
+        break;
+      }
+      case 'd': {
+        double x = 0.0;
+        is_ok = parse_binary_value(record, 'd', x);
+        sb << x;
+        break;
+      }
+      case 's': {
+        Slice str;
+        is_ok = parse_binary_string(record, str);
+        sb << str;
+        break;
+      }
+      default:
+        is_ok = false;
+        break;
+    }
+  }
+
+  // the same as in Logger::~Logger
+  auto message = sb.as_cslice().str();
+  message += '\n';
+  while (message.size() > 1 && message[message.size() - 2] == '\n') {
+    message.pop_back();
+  }
+  result += message;
+}
+
+string render_binary_log(Slice log) {
+  string result;
+  while (!log.empty()) {
+    if (log[0] != BINARY_RECORD_MAGIC) {
+      auto text_size = log.find('\n');
+      text_size = text_size == Slice::npos ? log.size() : text_size + 1;
+      result.append(log.data(), text_size);
+      log.remove_prefix(text_size);
+      continue;
+    }
+
+    log.remove_prefix(1);
+    uint32 record_size = 0;
+    if (!parse_binary_value(log, 'r', record_size)) {
+      result += "[malformed binary log record]\n";
+      break;
+    }
+    auto record = log.substr(0, min(static_cast<size_t>(record_size), log.size()));
+    log.remove_prefix(record.size());
+    render_binary_record(record, result);
+  }
+  return result;
+}
+
 class DefaultLog final : public LogInterface {
   void do_append(int log_level, CSlice slice) final {
 #if TD_ANDROID
@@ -15,6 +15,8 @@
  * LOG(INFO) << "Hello " << 1234 << " world!";
  * LOG_IF(INFO, condition) << "Hello world if condition!";
  *
+ * if (LOG_IS_ON(DEBUG)) { ... }  // compute something needed only for debug logging
+ *
  * Custom log levels may be defined and used using VLOG:
  * int VERBOSITY_NAME(custom) = VERBOSITY_NAME(WARNING);
  * VLOG(custom) << "Hello custom world!"
@@ -38,11 +40,18 @@
 #define SET_VERBOSITY_LEVEL(new_level) (::td::set_verbosity_level(new_level))
 
 #ifndef STRIP_LOG
+#if TD_STRIP_DEBUG_LOG
+#define STRIP_LOG VERBOSITY_NAME(INFO)
+#else
 #define STRIP_LOG VERBOSITY_NAME(DEBUG)
 #endif
+#endif
 #define LOG_IS_STRIPPED(strip_level) \
   (::std::integral_constant<int, VERBOSITY_NAME(strip_level)>() > ::std::integral_constant<int, STRIP_LOG>())
 
+// whether a message of the given verbosity level would be logged; must guard computation of expensive debug dumps
+#define LOG_IS_ON(level) (!LOG_IS_STRIPPED(level) && VERBOSITY_NAME(level) <= ::td::log_options.get_level())
+
 #define LOGGER(interface, options, level, comment) ::td::Logger(interface, options, level, __FILE__, __LINE__, comment)
 
 #define LOG_IMPL_FULL(interface, options, strip_level, runtime_level, condition, comment) \
@@ -106,6 +115,9 @@ struct LogOptions {
   std::atomic<int> level{VERBOSITY_NAME(DEBUG) + 1};
   bool fix_newlines{true};
   bool add_info{true};
+  // if enabled, messages with verbosity level INFO and higher are stored as binary records, which are formatted
+  // only when the log is converted to text by render_binary_log; the messages must not be passed to log callbacks
+  bool binary_format{false};
 
   int get_level() const {
     return level.load(std::memory_order_relaxed);
@@ -125,6 +137,7 @@ struct LogOptions {
   }
 
   LogOptions(const LogOptions &other) : LogOptions(other.level.load(), other.fix_newlines, other.add_info) {
+    binary_format = other.binary_format;
   }
 
   LogOptions &operator=(const LogOptions &other) {
@@ -134,6 +147,7 @@ struct LogOptions {
     level = other.level.load();
     fix_newlines = other.fix_newlines;
     add_info = other.add_info;
+    binary_format = other.binary_format;
     return *this;
   }
   LogOptions(LogOptions &&) = delete;
@@ -194,7 +208,11 @@ class Logger {
 
   template <class T>
   Logger &operator<<(T &&other) {
-    sb_ << other;
+    if (is_binary_) {
+      store_binary_argument(other);
+    } else {
+      sb_ << other;
+    }
     return *this;
   }
 
@@ -219,8 +237,75 @@ class Logger {
   StringBuilder sb_;
   const LogOptions &options_;
   int log_level_;
+  bool is_binary_ = false;
+
+  template <class T>
+  void store_binary_value(char type, T value) {
+    sb_ << type << Slice(reinterpret_cast<const char *>(&value), sizeof(value));
+  }
+
+  void store_binary_argument(char c) {
+    store_binary_value('c', c);
+  }
+
+  void store_binary_argument(bool b) {
+    store_binary_value('b', static_cast<uint8>(b));
+  }
+
+  template <class T>
+  std::enable_if_t<std::is_integral<T>::value && std::is_signed<T>::value> store_binary_argument(T x) {
+    store_binary_value('i', static_cast<int64>(x));
+  }
+
+  template <class T>
+  std::enable_if_t<std::is_integral<T>::value && std::is_unsigned<T>::value> store_binary_argument(T x) {
+    store_binary_value('u', static_cast<uint64>(x));
+  }
+
+  template <class T>
+  std::enable_if_t<std::is_floating_point<T>::value> store_binary_argument(T x) {
+    store_binary_value('d', static_cast<double>(x));
+  }
+
+  void store_binary_argument(Slice slice) {
+    store_binary_value('s', static_cast<uint32>(slice.size()));
+    sb_ << slice;
+  }
+
+  // the same overloads as in StringBuilder to avoid conversion of string literals to bool
+  template <class T>
+  std::enable_if_t<std::is_same<char *, std::remove_const_t<T>>::value> store_binary_argument(T str) {
+    store_binary_argument(Slice(str));
+  }
+
+  template <class T>
+  std::enable_if_t<std::is_same<const char *, std::remove_const_t<T>>::value> store_binary_argument(T str) {
+    store_binary_argument(Slice(str));
+  }
+
+  template <size_t N>
+  void store_binary_argument(const char (&str)[N]) {
+    store_binary_argument(Slice(str, N - 1));
+  }
+
+  // arguments of other types are formatted immediately
+  template <class T>
+  std::enable_if_t<!std::is_arithmetic<T>::value && !std::is_convertible<const T &, Slice>::value &&
+                   !std::is_same<char *, std::remove_const_t<T>>::value &&
+                   !std::is_same<const char *, std::remove_const_t<T>>::value>
+  store_binary_argument(const T &x) {
+    store_binary_value('s', static_cast<uint32>(0));
+    auto size_end = sb_.as_cslice().size();
+    sb_ << x;
+    set_binary_size(size_end);
+  }
+
+  void set_binary_size(size_t size_end);
 };
 
+// converts a log, containing binary records, to the usual text format
+string render_binary_log(Slice log);
+
 class ScopedDisableLog {
  public:
   ScopedDisableLog();
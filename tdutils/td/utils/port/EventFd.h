@@ -10,6 +10,7 @@
 
 // include all and let config.h decide
 #include "td/utils/port/detail/EventFdBsd.h"
+#include "td/utils/port/detail/EventFdEmscripten.h"
 #include "td/utils/port/detail/EventFdLinux.h"
 #include "td/utils/port/detail/EventFdWindows.h"
 
@@ -23,6 +24,8 @@ namespace td {
   using EventFd = detail::EventFdBsd;
 #elif TD_EVENTFD_WINDOWS
   using EventFd = detail::EventFdWindows;
+#elif TD_EVENTFD_EMSCRIPTEN
+  using EventFd = detail::EventFdEmscripten;
 #elif TD_EVENTFD_UNSUPPORTED
 #else
   #error "EventFd's implementation is not defined"
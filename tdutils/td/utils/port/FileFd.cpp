@@ -537,6 +537,7 @@ uint64 filetime_to_unix_time_nsec(LONGLONG filetime) {
 struct FileSize {
   int64 size_;
   int64 real_size_;
+  int64 link_count_;
 };
 
 Result<FileSize> get_file_size(const FileFd &file_fd) {
@@ -548,6 +549,7 @@ Result<FileSize> get_file_size(const FileFd &file_fd) {
   FileSize res;
   res.size_ = standard_info.EndOfFile.QuadPart;
   res.real_size_ = standard_info.AllocationSize.QuadPart;
+  res.link_count_ = standard_info.NumberOfLinks;
 
   if (res.size_ > 0 && res.real_size_ <= 0) {  // just in case
     LOG(ERROR) << "Fix real file size from " << res.real_size_ << " to " << res.size_;
@@ -598,6 +600,7 @@ Result<Stat> FileFd::stat() const {
   TRY_RESULT(file_size, get_file_size(*this));
   res.size_ = file_size.size_;
   res.real_size_ = file_size.real_size_;
+  res.link_count_ = file_size.link_count_;
 
   return res;
 #endif
@@ -619,6 +622,36 @@ Status FileFd::sync() {
   return Status::OK();
 }
 
+Status FileFd::advise(Advice advice, int64 offset, int64 size) {
+  CHECK(!empty());
+  if (offset < 0 || size < 0) {
+    return Status::Error("Invalid file range");
+  }
+#if TD_PORT_POSIX && defined(POSIX_FADV_SEQUENTIAL)
+  TRY_RESULT(offset_off_t, narrow_cast_safe<off_t>(offset));
+  TRY_RESULT(size_off_t, narrow_cast_safe<off_t>(size));
+  auto posix_advice = advice == Advice::Sequential ? POSIX_FADV_SEQUENTIAL : POSIX_FADV_WILLNEED;
+  auto error_code = posix_fadvise(get_native_fd().fd(), offset_off_t, size_off_t, posix_advice);
+  if (error_code != 0) {
+    return Status::PosixError(error_code, "posix_fadvise failed");
+  }
+#elif TD_DARWIN
+  if (advice == Advice::Sequential) {
+    if (detail::skip_eintr([&] { return fcntl(get_native_fd().fd(), F_RDAHEAD, 1); }) == -1) {
+      return OS_ERROR("Failed to enable read-ahead");
+    }
+  } else {
+    struct radvisory advisory;
+    TRY_RESULT_ASSIGN(advisory.ra_offset, narrow_cast_safe<off_t>(offset));
+    TRY_RESULT_ASSIGN(advisory.ra_count, narrow_cast_safe<int>(size));
+    if (detail::skip_eintr([&] { return fcntl(get_native_fd().fd(), F_RDADVISE, &advisory); }) == -1) {
+      return OS_ERROR("Failed to advise read");
+    }
+  }
+#endif
+  return Status::OK();
+}
+
 Status FileFd::seek(int64 position) {
   CHECK(!empty());
 #if TD_PORT_POSIX
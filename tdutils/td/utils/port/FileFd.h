@@ -63,6 +63,10 @@ class FileFd {
 
   Status sync() TD_WARN_UNUSED_RESULT;
 
+  // hints the OS about future access to the file; the hints can be ignored
+  enum class Advice : int32 { Sequential, WillNeed };
+  Status advise(Advice advice, int64 offset, int64 size) TD_WARN_UNUSED_RESULT;
+
   Status seek(int64 position) TD_WARN_UNUSED_RESULT;
 
   Status truncate_to_current_position(int64 current_position) TD_WARN_UNUSED_RESULT;
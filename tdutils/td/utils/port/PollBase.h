@@ -24,5 +24,11 @@ class PollBase {
   virtual void unsubscribe(PollableFdRef fd) = 0;
   virtual void unsubscribe_before_close(PollableFdRef fd) = 0;
   virtual void run(int timeout_ms) = 0;
+
+  // timeout is in seconds; must be overridden by backends, which can wait with better than millisecond precision
+  virtual void run_precise(double timeout) {
+    // a positive timeout must not be rounded down to 0
+    run(timeout <= 0.0 ? 0 : static_cast<int>(timeout * 1000 + 1));
+  }
 };
 }  // namespace td
@@ -686,6 +686,19 @@ Status SocketFd::get_pending_error() {
   return impl_->get_pending_error();
 }
 
+Status SocketFd::set_busy_poll(int32 busy_poll_us) {
+  CHECK(!empty());
+#ifdef SO_BUSY_POLL
+  int value = busy_poll_us;
+  if (setsockopt(get_native_fd().socket(), SOL_SOCKET, SO_BUSY_POLL, &value, sizeof(value)) == -1) {
+    return OS_SOCKET_ERROR("Failed to set SO_BUSY_POLL");
+  }
+  return Status::OK();
+#else
+  return Status::Error("Busy polling is unsupported");
+#endif
+}
+
 Result<size_t> SocketFd::write(Slice slice) {
   CHECK(!empty());
   return impl_->write(slice);
@@ -44,6 +44,10 @@ class SocketFd {
 
   Status get_pending_error() TD_WARN_UNUSED_RESULT;
 
+  // enables busy polling of the network device for up to busy_poll_us microseconds when there is no data to read;
+  // decreases latency of latency-critical connections at the cost of CPU usage; supported only on Linux
+  Status set_busy_poll(int32 busy_poll_us) TD_WARN_UNUSED_RESULT;
+
   Result<size_t> write(Slice slice) TD_WARN_UNUSED_RESULT;
   Result<size_t> writev(Span<IoSlice> slices) TD_WARN_UNUSED_RESULT;
   Result<size_t> read(MutableSlice slice) TD_WARN_UNUSED_RESULT;
@@ -124,6 +124,7 @@ Stat from_native_stat(const struct ::stat &buf) {
   res.mtime_nsec_ = static_cast<uint64>(buf.st_mtime) * 1000000000 + time_nsec.second / 1000 * 1000;
   res.size_ = buf.st_size;
   res.real_size_ = buf.st_blocks * 512;
+  res.link_count_ = static_cast<int64>(buf.st_nlink);
   res.is_dir_ = (buf.st_mode & S_IFMT) == S_IFDIR;
   res.is_reg_ = (buf.st_mode & S_IFMT) == S_IFREG;
   return res;
@@ -19,6 +19,7 @@ struct Stat {
   bool is_reg_;
   int64 size_;
   int64 real_size_;
+  int64 link_count_;
   uint64 atime_nsec_;
   uint64 mtime_nsec_;
 };
@@ -34,9 +34,14 @@
 
 #if TD_LINUX
 #include <linux/errqueue.h>
+#include <netinet/udp.h>
 #endif
 #endif
 
+#if TD_HAS_MMSG && defined(UDP_SEGMENT)
+#define TD_HAS_UDP_GSO 1
+#endif
+
 #include <array>
 #include <atomic>
 #include <cstring>
@@ -458,8 +463,69 @@ class UdpSocketSendHelper {
     message_header.msg_flags = 0;
   }
 
+#if TD_HAS_UDP_GSO
+  // fills the header to send messages[pos] and the next messages to the same destination as segments of one datagram,
+  // which is split by the kernel or the network card; returns number of the messages, which will be sent
+  size_t to_native_segmented(Span<UdpSocketFd::OutboundMessage> messages, size_t pos, msghdr &message_header) {
+    const auto &first_message = messages[pos];
+    to_native(first_message, message_header);
+    auto segment_size = first_message.data.size();
+    if (segment_size > MAX_SEGMENT_SIZE) {
+      return 1;
+    }
+
+    size_t count = 1;
+    size_t total_size = segment_size;
+    segment_io_vecs_[0] = io_vec_;
+    while (pos + count < messages.size() && count < MAX_SEGMENT_COUNT) {
+      const auto &message = messages[pos + count];
+      auto size = message.data.size();
+      if (size > segment_size || total_size + size > MAX_TOTAL_SIZE ||
+          (message.to != first_message.to && !(*message.to == *first_message.to))) {
+        break;
+      }
+      segment_io_vecs_[count].iov_base = const_cast<char *>(message.data.begin());
+      segment_io_vecs_[count].iov_len = size;
+      count++;
+      total_size += size;
+      if (size < segment_size) {
+        // only the last segment can be smaller
+        break;
+      }
+    }
+    if (count == 1) {
+      return 1;
+    }
+
+    message_header.msg_iov = segment_io_vecs_.data();
+    message_header.msg_iovlen = count;
+    message_header.msg_control = control_buf_.buf;
+    message_header.msg_controllen = sizeof(control_buf_.buf);
+    auto *cmsg = CMSG_FIRSTHDR(&message_header);
+    cmsg->cmsg_level = SOL_UDP;
+    cmsg->cmsg_type = UDP_SEGMENT;
+    cmsg->cmsg_len = CMSG_LEN(sizeof(uint16_t));
+    auto gso_size = static_cast<uint16_t>(segment_size);
+    std::memcpy(CMSG_DATA(cmsg), &gso_size, sizeof(gso_size));
+    return count;
+  }
+#endif
+
  private:
   iovec io_vec_;
+
+#if TD_HAS_UDP_GSO
+  static constexpr size_t MAX_SEGMENT_COUNT = 64;
+  // bigger segments can exceed the path MTU, which is an error for GSO
+  static constexpr size_t MAX_SEGMENT_SIZE = 1200;
+  static constexpr size_t MAX_TOTAL_SIZE = 60000;
+
+  std::array<iovec, MAX_SEGMENT_COUNT> segment_io_vecs_;
+  union {
+    cmsghdr align;
+    char buf[CMSG_SPACE(sizeof(uint16_t))];
+  } control_buf_;
+#endif
 };
 
 class UdpSocketFdImpl {
@@ -656,10 +722,26 @@ class UdpSocketFdImpl {
     //};
     std::array<detail::UdpSocketSendHelper, 16> helpers;
     std::array<mmsghdr, 16> headers;
-    size_t to_send = min(messages.size(), headers.size());
-    for (size_t i = 0; i < to_send; i++) {
-      helpers[i].to_native(messages[i], headers[i].msg_hdr);
-      headers[i].msg_len = 0;
+    std::array<size_t, 16> header_message_counts;
+    size_t to_send = 0;
+    size_t message_pos = 0;
+#if TD_HAS_UDP_GSO
+    bool use_gso = is_gso_supported();
+#endif
+    while (message_pos < messages.size() && to_send < headers.size()) {
+      size_t message_count = 1;
+#if TD_HAS_UDP_GSO
+      if (use_gso) {
+        message_count = helpers[to_send].to_native_segmented(messages, message_pos, headers[to_send].msg_hdr);
+      } else
+#endif
+      {
+        helpers[to_send].to_native(messages[message_pos], headers[to_send].msg_hdr);
+      }
+      headers[to_send].msg_len = 0;
+      header_message_counts[to_send] = message_count;
+      message_pos += message_count;
+      to_send++;
     }
 
     auto native_fd = get_native_fd().socket();
@@ -667,10 +749,23 @@ class UdpSocketFdImpl {
         detail::skip_eintr([&] { return sendmmsg(native_fd, headers.data(), narrow_cast<unsigned int>(to_send), 0); });
     auto sendmmsg_errno = errno;
     if (sendmmsg_res >= 0) {
-      cnt = sendmmsg_res;
+      cnt = 0;
+      for (int i = 0; i < sendmmsg_res; i++) {
+        cnt += header_message_counts[i];
+      }
       return Status::OK();
     }
 
+#if TD_HAS_UDP_GSO
+    if (header_message_counts[0] > 1 && (sendmmsg_errno == EINVAL || sendmmsg_errno == EIO)) {
+      // the network interface doesn't support GSO; the messages will be resent without it
+      LOG(INFO) << "Disable UDP GSO: " << Status::PosixError(sendmmsg_errno, "sendmmsg failed");
+      gso_state_ = GsoState::Unsupported;
+      cnt = 0;
+      return Status::OK();
+    }
+#endif
+
     bool is_sent = false;
     auto status = process_sendmsg_error(sendmmsg_errno, is_sent);
     cnt = is_sent;
@@ -690,6 +785,22 @@ class UdpSocketFdImpl {
     return Status::OK();
   }
 
+#if TD_HAS_UDP_GSO
+  enum class GsoState : int8 { Unknown, Supported, Unsupported };
+  GsoState gso_state_ = GsoState::Unknown;
+
+  bool is_gso_supported() {
+    if (gso_state_ == GsoState::Unknown) {
+      // kernels without GSO support don't know the option and would ignore it in sendmsg
+      int gso_size = 0;
+      socklen_t gso_size_len = sizeof(gso_size);
+      auto res = getsockopt(get_native_fd().socket(), SOL_UDP, UDP_SEGMENT, &gso_size, &gso_size_len);
+      gso_state_ = res == 0 ? GsoState::Supported : GsoState::Unsupported;
+    }
+    return gso_state_ == GsoState::Supported;
+  }
+#endif
+
 #if TD_HAS_MMSG
   Status receive_messages_fast(MutableSpan<UdpSocketFd::InboundMessage> messages, size_t &cnt) {
     int flags = 0;
@@ -27,7 +27,11 @@
   #define TD_EVENTFD_BSD 1
 #elif TD_EMSCRIPTEN
   #define TD_POLL_POLL 1
-  #define TD_EVENTFD_UNSUPPORTED 1
+  #if defined(__EMSCRIPTEN_PTHREADS__)
+    #define TD_EVENTFD_EMSCRIPTEN 1
+  #else
+    #define TD_EVENTFD_UNSUPPORTED 1
+  #endif
 #elif TD_DARWIN
   #define TD_POLL_KQUEUE 1
   #define TD_EVENTFD_BSD 1
@@ -44,9 +48,9 @@
   #error "Poll's implementation is not defined"
 #endif
 
-#if TD_EMSCRIPTEN
+#if TD_EMSCRIPTEN && !defined(__EMSCRIPTEN_PTHREADS__)
   #define TD_THREAD_UNSUPPORTED 1
-#elif TD_TIZEN || TD_LINUX || TD_DARWIN
+#elif TD_TIZEN || TD_LINUX || TD_DARWIN || TD_EMSCRIPTEN
   #define TD_THREAD_PTHREAD 1
 #else
   #define TD_THREAD_STL 1
@@ -16,8 +16,13 @@ char disable_linker_warning_about_empty_file_epoll_cpp TD_UNUSED;
 
 #include <cerrno>
 
+#include <sys/syscall.h>
 #include <unistd.h>
 
+#ifdef SYS_epoll_pwait2
+#define TD_HAS_EPOLL_PWAIT2 1
+#endif
+
 namespace td {
 namespace detail {
 void Epoll::init() {
@@ -26,7 +31,7 @@ void Epoll::init() {
   auto epoll_create_errno = errno;
   LOG_IF(FATAL, !epoll_fd_) << Status::PosixError(epoll_create_errno, "epoll_create failed");
 
-  events_.resize(1000);
+  events_.resize(MIN_EVENT_COUNT);
 }
 
 void Epoll::clear() {
@@ -85,7 +90,36 @@ void Epoll::run(int timeout_ms) {
   auto epoll_wait_errno = errno;
   LOG_IF(FATAL, ready_n == -1 && epoll_wait_errno != EINTR)
       << Status::PosixError(epoll_wait_errno, "epoll_wait failed");
+  process_events(ready_n);
+}
+
+void Epoll::run_precise(double timeout) {
+#if TD_HAS_EPOLL_PWAIT2
+  if (is_epoll_pwait2_supported_ && timeout > 0.0) {
+    // epoll_pwait2 is available since Linux 5.11 and glibc 2.35, so it is called directly
+    struct {
+      int64 tv_sec;
+      int64 tv_nsec;
+    } kernel_timeout;
+    kernel_timeout.tv_sec = static_cast<int64>(timeout);
+    kernel_timeout.tv_nsec = static_cast<int64>((timeout - static_cast<double>(kernel_timeout.tv_sec)) * 1e9);
+    int ready_n = static_cast<int>(syscall(SYS_epoll_pwait2, epoll_fd_.fd(), &events_[0],
+                                           static_cast<int>(events_.size()), &kernel_timeout, nullptr, 0));
+    auto epoll_wait_errno = errno;
+    if (ready_n != -1 || (epoll_wait_errno != ENOSYS && epoll_wait_errno != EPERM)) {
+      LOG_IF(FATAL, ready_n == -1 && epoll_wait_errno != EINTR)
+          << Status::PosixError(epoll_wait_errno, "epoll_pwait2 failed");
+      process_events(ready_n);
+      return;
+    }
+    LOG(INFO) << "epoll_pwait2 is unsupported";
+    is_epoll_pwait2_supported_ = false;
+  }
+#endif
+  PollBase::run_precise(timeout);
+}
 
+void Epoll::process_events(int ready_n) {
   for (int i = 0; i < ready_n; i++) {
     PollFlags flags;
     epoll_event *event = &events_[i];
@@ -119,6 +153,11 @@ void Epoll::run(int timeout_ms) {
     pollable_fd.add_flags(flags);
     pollable_fd.release_as_list_node();
   }
+
+  // there can be more ready file descriptors, so they must be received in larger batches
+  if (static_cast<size_t>(ready_n) == events_.size() && events_.size() < MAX_EVENT_COUNT) {
+    events_.resize(events_.size() * 2);
+  }
 }
 }  // namespace detail
 }  // namespace td
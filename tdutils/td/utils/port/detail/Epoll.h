@@ -43,14 +43,22 @@ class Epoll final : public PollBase {
 
   void run(int timeout_ms) final;
 
+  void run_precise(double timeout) final;
+
   static bool is_edge_triggered() {
     return true;
   }
 
  private:
+  static constexpr size_t MIN_EVENT_COUNT = 1 << 10;
+  static constexpr size_t MAX_EVENT_COUNT = 1 << 14;
+
   NativeFd epoll_fd_;
   vector<struct epoll_event> events_;
   ListNode list_root_;
+  bool is_epoll_pwait2_supported_ = true;
+
+  void process_events(int ready_n);
 };
 
 }  // namespace detail
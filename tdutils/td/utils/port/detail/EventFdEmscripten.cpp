@@ -0,0 +1,91 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2022
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "td/utils/port/detail/EventFdEmscripten.h"
+
+char disable_linker_warning_about_empty_file_event_fd_emscripten_cpp TD_UNUSED;
+
+#ifdef TD_EVENTFD_EMSCRIPTEN
+
+#include "td/utils/logging.h"
+
+#include <chrono>
+
+#include <emscripten.h>
+#include <emscripten/threading.h>
+
+namespace td {
+namespace detail {
+
+static void on_main_thread_event() {
+  // the main thread can't wait for the event, so JavaScript code is notified that it must call td_receive
+  EM_ASM({
+    if (Module['onMainThreadEvent']) {
+      Module['onMainThreadEvent']();
+    }
+  });
+}
+
+void EventFdEmscripten::init() {
+  std::lock_guard<std::mutex> guard(mutex_);
+  is_inited_ = true;
+  is_set_ = false;
+}
+
+bool EventFdEmscripten::empty() {
+  std::lock_guard<std::mutex> guard(mutex_);
+  return !is_inited_;
+}
+
+void EventFdEmscripten::close() {
+  std::lock_guard<std::mutex> guard(mutex_);
+  is_inited_ = false;
+  is_set_ = false;
+}
+
+Status EventFdEmscripten::get_pending_error() {
+  return Status::OK();
+}
+
+PollableFdInfo &EventFdEmscripten::get_poll_info() {
+  UNREACHABLE();
+}
+
+void EventFdEmscripten::release() {
+  bool need_wake_up_main_thread = false;
+  {
+    std::lock_guard<std::mutex> guard(mutex_);
+    need_wake_up_main_thread = !is_set_ && is_waited_on_main_thread_ && !emscripten_is_main_runtime_thread();
+    is_set_ = true;
+  }
+  condition_.notify_one();
+  if (need_wake_up_main_thread) {
+    emscripten_async_run_in_main_runtime_thread(EM_FUNC_SIG_V, &on_main_thread_event);
+  }
+}
+
+void EventFdEmscripten::acquire() {
+  std::lock_guard<std::mutex> guard(mutex_);
+  is_set_ = false;
+}
+
+void EventFdEmscripten::wait(int timeout_ms) {
+  std::unique_lock<std::mutex> guard(mutex_);
+  if (emscripten_is_main_runtime_thread()) {
+    // the main browser thread must never block
+    is_waited_on_main_thread_ = true;
+    timeout_ms = 0;
+  }
+  if (timeout_ms > 0 && !is_set_) {
+    condition_.wait_for(guard, std::chrono::milliseconds(timeout_ms), [&] { return is_set_; });
+  }
+  is_set_ = false;
+}
+
+}  // namespace detail
+}  // namespace td
+
+#endif
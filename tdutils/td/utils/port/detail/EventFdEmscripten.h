@@ -0,0 +1,56 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2022
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#pragma once
+
+#include "td/utils/port/config.h"
+
+#ifdef TD_EVENTFD_EMSCRIPTEN
+
+#include "td/utils/common.h"
+#include "td/utils/port/detail/PollableFd.h"
+#include "td/utils/port/EventFdBase.h"
+#include "td/utils/Status.h"
+
+#include <condition_variable>
+#include <mutex>
+
+namespace td {
+namespace detail {
+
+// there are no file descriptors, which can be used for waking up Web Workers, so the event can't be polled
+// and must be waited for directly like on Windows
+class EventFdEmscripten final : public EventFdBase {
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  bool is_inited_ = false;
+  bool is_set_ = false;
+  bool is_waited_on_main_thread_ = false;
+
+ public:
+  EventFdEmscripten() = default;
+
+  void init() final;
+
+  bool empty() final;
+
+  void close() final;
+
+  Status get_pending_error() final TD_WARN_UNUSED_RESULT;
+
+  PollableFdInfo &get_poll_info() final;
+
+  void release() final;
+
+  void acquire() final;
+
+  void wait(int timeout_ms) final;
+};
+
+}  // namespace detail
+}  // namespace td
+
+#endif
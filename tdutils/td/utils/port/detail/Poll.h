@@ -41,6 +41,10 @@ class Poll final : public PollBase {
 
   void run(int timeout_ms) final;
 
+  bool empty() const {
+    return fds_.empty();
+  }
+
   static bool is_edge_triggered() {
     return false;
   }
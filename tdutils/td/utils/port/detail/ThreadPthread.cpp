@@ -68,6 +68,47 @@ void ThreadPthread::set_name(CSlice name) {
 #endif
 }
 
+Status ThreadPthread::set_affinity_mask(id thread_id, uint64 mask) {
+#if TD_LINUX
+  cpu_set_t cpuset;
+  CPU_ZERO(&cpuset);
+  for (int j = 0; j < 64 && j < CPU_SETSIZE; j++) {
+    if ((mask >> j) & 1) {
+      CPU_SET(j, &cpuset);
+    }
+  }
+
+  auto res = pthread_setaffinity_np(thread_id, sizeof(cpuset), &cpuset);
+  if (res != 0) {
+    return Status::PosixError(res, "Failed to set thread affinity mask");
+  }
+  return Status::OK();
+#else
+  return Status::Error("Unsupported");
+#endif
+}
+
+uint64 ThreadPthread::get_affinity_mask(id thread_id) {
+#if TD_LINUX
+  cpu_set_t cpuset;
+  CPU_ZERO(&cpuset);
+  auto res = pthread_getaffinity_np(thread_id, sizeof(cpuset), &cpuset);
+  if (res != 0) {
+    return 0;
+  }
+
+  uint64 mask = 0;
+  for (int j = 0; j < 64 && j < CPU_SETSIZE; j++) {
+    if (CPU_ISSET(j, &cpuset)) {
+      mask |= static_cast<uint64>(1) << j;
+    }
+  }
+  return mask;
+#else
+  return 0;
+#endif
+}
+
 void ThreadPthread::join() {
   if (is_inited_.get()) {
     is_inited_ = false;
@@ -17,6 +17,7 @@
 #include "td/utils/port/detail/ThreadIdGuard.h"
 #include "td/utils/port/thread_local.h"
 #include "td/utils/Slice.h"
+#include "td/utils/Status.h"
 
 #include <tuple>
 #include <type_traits>
@@ -63,6 +64,11 @@ class ThreadPthread {
 
   using id = pthread_t;
 
+  // bit i of the mask allows the thread to run on CPU i
+  static Status set_affinity_mask(id thread_id, uint64 mask) TD_WARN_UNUSED_RESULT;
+
+  static uint64 get_affinity_mask(id thread_id);
+
  private:
   MovableValue<bool> is_inited_;
   pthread_t thread_;
@@ -15,6 +15,7 @@
 #include "td/utils/port/detail/ThreadIdGuard.h"
 #include "td/utils/port/thread_local.h"
 #include "td/utils/Slice.h"
+#include "td/utils/Status.h"
 
 #include <thread>
 #include <tuple>
@@ -62,6 +63,14 @@ class ThreadStl {
 
   using id = std::thread::id;
 
+  static Status set_affinity_mask(id thread_id, uint64 mask) {
+    return Status::Error("Unsupported");
+  }
+
+  static uint64 get_affinity_mask(id thread_id) {
+    return 0;
+  }
+
  private:
   std::thread thread_;
 
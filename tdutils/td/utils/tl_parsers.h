@@ -133,6 +133,21 @@ class TlParser {
     return fetch_binary_unsafe<T>();
   }
 
+  // fetches an array of fixed-size values stored in the host byte order with a single length check
+  template <class T>
+  void fetch_binary_array(T *result, size_t count) {
+    if (unlikely(left_len / sizeof(T) < count)) {
+      set_error("Not enough data to read");
+      return;
+    }
+    auto size = sizeof(T) * count;
+    left_len -= size;
+    if (size != 0) {
+      std::memcpy(result, data, size);
+      data += size;
+    }
+  }
+
   template <class T>
   T fetch_string() {
     check_len(sizeof(int32));
@@ -202,9 +217,12 @@ class TlBufferParser : public TlParser {
   template <class T>
   T fetch_string() {
     auto result = TlParser::fetch_string<T>();
-    for (auto &c : result) {
-      if (c == '\0') {
-        c = ' ';
+    // null characters are very rare, so they are searched for by the fast memchr before replacing
+    if (std::memchr(result.data(), '\0', result.size()) != nullptr) {
+      for (auto &c : result) {
+        if (c == '\0') {
+          c = ' ';
+        }
       }
     }
     if (check_utf8(result)) {
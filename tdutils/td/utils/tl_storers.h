@@ -44,6 +44,14 @@ class TlStorerUnsafe {
     buf_ += slice.size();
   }
 
+  template <class T>
+  void store_binary_array(const T *data, size_t count) {
+    if (count != 0) {
+      std::memcpy(buf_, data, sizeof(T) * count);
+      buf_ += sizeof(T) * count;
+    }
+  }
+
   void store_storer(const Storer &storer) {
     size_t size = storer.store(buf_);
     buf_ += size;
@@ -117,6 +125,11 @@ class TlStorerCalcLength {
     length += slice.size();
   }
 
+  template <class T>
+  void store_binary_array(const T *data, size_t count) {
+    length += sizeof(T) * count;
+  }
+
   void store_storer(const Storer &storer) {
     length += storer.size();
   }
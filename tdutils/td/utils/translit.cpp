@@ -11,77 +11,114 @@
 #include "td/utils/utf8.h"
 
 #include <algorithm>
-#include <unordered_map>
 #include <utility>
 
 namespace td {
 
-static const std::unordered_map<uint32, string> &get_en_to_ru_simple_rules() {
-  static const std::unordered_map<uint32, string> rules{
-      {'a', "а"}, {'b', "б"}, {'c', "к"}, {'d', "д"}, {'e', "е"}, {'f', "ф"},  {'g', "г"}, {'h', "х"}, {'i', "и"},
-      {'j', "й"}, {'k', "к"}, {'l', "л"}, {'m', "м"}, {'n', "н"}, {'o', "о"},  {'p', "п"}, {'q', "к"}, {'r', "р"},
-      {'s', "с"}, {'t', "т"}, {'u', "у"}, {'v', "в"}, {'w', "в"}, {'x', "кс"}, {'y', "и"}, {'z', "з"}};
+namespace {
+
+// transliteration rules with direct lookup of simple rules by character code and complex rules by their first byte
+class TransliterationRules {
+ public:
+  TransliterationRules(uint32 first_code, vector<const char *> simple_rules,
+                       vector<std::pair<string, string>> complex_rules)
+      : first_code_(first_code), simple_rules_(std::move(simple_rules)), complex_rules_(std::move(complex_rules)) {
+    for (auto &rule : complex_rules_) {
+      CHECK(!rule.first.empty());
+      complex_rules_by_first_byte_[static_cast<unsigned char>(rule.first[0])].push_back(&rule);
+    }
+  }
+
+  // returns nullptr if there is no simple rule for the character
+  const char *get_simple_rule(uint32 code) const {
+    code -= first_code_;
+    return code < simple_rules_.size() ? simple_rules_[code] : nullptr;
+  }
+
+  // returns complex rules beginning with the byte in the original order
+  const vector<const std::pair<string, string> *> &get_complex_rules(unsigned char first_byte) const {
+    return complex_rules_by_first_byte_[first_byte];
+  }
+
+ private:
+  uint32 first_code_;
+  vector<const char *> simple_rules_;
+  vector<std::pair<string, string>> complex_rules_;
+  vector<const std::pair<string, string> *> complex_rules_by_first_byte_[256];
+};
+
+const TransliterationRules &get_en_to_ru_rules() {
+  static const TransliterationRules rules(
+      'a',
+      {"а", "б", "к", "д", "е", "ф", "г", "х", "и", "й", "к", "л", "м",
+       "н", "о", "п", "к", "р", "с", "т", "у", "в", "в", "кс", "и", "з"},
+      {{"ch", "ч"}, {"ei", "ей"}, {"ey", "ей"}, {"ia", "ия"},  {"iy", "ий"}, {"jo", "е"},
+       {"ju", "ю"}, {"ja", "я"},  {"kh", "х"},  {"shch", "щ"}, {"sh", "ш"},  {"sch", "щ"},
+       {"ts", "ц"}, {"yo", "е"},  {"yu", "ю"},  {"ya", "я"},   {"zh", "ж"}});
   return rules;
 }
 
-static const std::vector<std::pair<string, string>> &get_en_to_ru_complex_rules() {
-  static const std::vector<std::pair<string, string>> rules{
-      {"ch", "ч"}, {"ei", "ей"}, {"ey", "ей"}, {"ia", "ия"},  {"iy", "ий"}, {"jo", "е"},
-      {"ju", "ю"}, {"ja", "я"},  {"kh", "х"},  {"shch", "щ"}, {"sh", "ш"},  {"sch", "щ"},
-      {"ts", "ц"}, {"yo", "е"},  {"yu", "ю"},  {"ya", "я"},   {"zh", "ж"}};
+const TransliterationRules &get_ru_to_en_rules() {
+  static const TransliterationRules rules(
+      0x430,
+      {"a", "b", "v",  "g", "d",  "e",  "zh", "z",  "i",   "y", "k", "l", "m",  "n",  "o", "p",  "r",
+       "s", "t", "u",  "f", "kh", "ts", "ch", "sh", "sch", "",  "y", "",  "e",  "yu", "ya", nullptr, "e"},
+      {{"ий", "y"}, {"ия", "ia"}, {"кс", "x"}, {"yo", "e"}, {"jo", "e"}});
   return rules;
 }
 
-static const std::unordered_map<uint32, string> &get_ru_to_en_simple_rules() {
-  static const std::unordered_map<uint32, string> rules{
-      {0x430, "a"},  {0x431, "b"},  {0x432, "v"},  {0x433, "g"},  {0x434, "d"},  {0x435, "e"},   {0x451, "e"},
-      {0x436, "zh"}, {0x437, "z"},  {0x438, "i"},  {0x439, "y"},  {0x43a, "k"},  {0x43b, "l"},   {0x43c, "m"},
-      {0x43d, "n"},  {0x43e, "o"},  {0x43f, "p"},  {0x440, "r"},  {0x441, "s"},  {0x442, "t"},   {0x443, "u"},
-      {0x444, "f"},  {0x445, "kh"}, {0x446, "ts"}, {0x447, "ch"}, {0x448, "sh"}, {0x449, "sch"}, {0x44a, ""},
-      {0x44b, "y"},  {0x44c, ""},   {0x44d, "e"},  {0x44e, "yu"}, {0x44f, "ya"}};
-  return rules;
+void append_transliterated_character(string &s, uint32 code, const TransliterationRules &rules) {
+  auto rule = rules.get_simple_rule(code);
+  if (rule != nullptr) {
+    s += rule;
+  } else if (code < 0x80) {
+    s += static_cast<char>(code);
+  } else {
+    append_utf8_character(s, code);
+  }
 }
 
-static const std::vector<std::pair<string, string>> &get_ru_to_en_complex_rules() {
-  static const std::vector<std::pair<string, string>> rules{
-      {"ий", "y"}, {"ия", "ia"}, {"кс", "x"}, {"yo", "e"}, {"jo", "e"}};
-  return rules;
+const unsigned char *next_character(const unsigned char *pos, uint32 *code, const char *source) {
+  if (*pos < 0x80) {
+    *code = *pos;
+    return pos + 1;
+  }
+  return next_utf8_unsafe(pos, code, source);
 }
 
+}  // namespace
+
 static void add_word_transliterations(vector<string> &result, Slice word, bool allow_partial,
-                                      const std::unordered_map<uint32, string> &simple_rules,
-                                      const std::vector<std::pair<string, string>> &complex_rules) {
+                                      const TransliterationRules &rules) {
   string s;
+  s.reserve(word.size() * 2);
   auto pos = word.ubegin();
   auto end = word.uend();
   while (pos != end) {
     uint32 code;
-    pos = next_utf8_unsafe(pos, &code, "add_word_transliterations");
-    auto it = simple_rules.find(code);
-    if (it != simple_rules.end()) {
-      s += it->second;
-    } else {
-      append_utf8_character(s, code);
-    }
+    pos = next_character(pos, &code, "add_word_transliterations");
+    append_transliterated_character(s, code, rules);
   }
   if (!s.empty()) {
     result.push_back(std::move(s));
     s.clear();
+    s.reserve(word.size() * 2);
   }
 
   pos = word.ubegin();
   while (pos != end) {
     auto suffix = Slice(pos, end);
     bool found = false;
-    for (auto &rule : complex_rules) {
-      if (begins_with(suffix, rule.first)) {
+    // only rules beginning with the same byte as the non-empty suffix can match it or begin with it
+    for (auto rule : rules.get_complex_rules(*pos)) {
+      if (begins_with(suffix, rule->first)) {
         found = true;
-        pos += rule.first.size();
-        s.append(rule.second);
+        pos += rule->first.size();
+        s.append(rule->second);
         break;
       }
-      if (allow_partial && begins_with(rule.first, suffix)) {
-        result.push_back(s + rule.second);
+      if (allow_partial && begins_with(rule->first, suffix)) {
+        result.push_back(s + rule->second);
       }
     }
     if (found) {
@@ -89,13 +126,8 @@ static void add_word_transliterations(vector<string> &result, Slice word, bool a
     }
 
     uint32 code;
-    pos = next_utf8_unsafe(pos, &code, "add_word_transliterations 2");
-    auto it = simple_rules.find(code);
-    if (it != simple_rules.end()) {
-      s += it->second;
-    } else {
-      append_utf8_character(s, code);
-    }
+    pos = next_character(pos, &code, "add_word_transliterations 2");
+    append_transliterated_character(s, code, rules);
   }
   if (!s.empty()) {
     result.push_back(std::move(s));
@@ -105,8 +137,8 @@ static void add_word_transliterations(vector<string> &result, Slice word, bool a
 vector<string> get_word_transliterations(Slice word, bool allow_partial) {
   vector<string> result;
 
-  add_word_transliterations(result, word, allow_partial, get_en_to_ru_simple_rules(), get_en_to_ru_complex_rules());
-  add_word_transliterations(result, word, allow_partial, get_ru_to_en_simple_rules(), get_ru_to_en_complex_rules());
+  add_word_transliterations(result, word, allow_partial, get_en_to_ru_rules());
+  add_word_transliterations(result, word, allow_partial, get_ru_to_en_rules());
 
   td::unique(result);
   return result;
@@ -10,6 +10,8 @@
 
 #include <algorithm>
 #include <iterator>
+#include <limits>
+#include <map>
 
 namespace td {
 
@@ -1191,69 +1193,118 @@ UnicodeSimpleCategory get_unicode_simple_category(uint32 code) {
   return static_cast<UnicodeSimpleCategory>(*(it - 1) & 31);
 }
 
-/**
- * Search pregenerated ranges of pairs for the replacement of specified character
- */
-template <size_t N>
-static uint32 binary_search_ranges(const int32 (&ranges)[N], uint32 code) {
-  if (code > 0x10ffff) {
-    return 0;
-  }
+namespace {
+
+// Converts pregenerated direct table for the first TABLE_SIZE characters and ranges of pairs for the other characters
+// to a two-level lookup table. Blocks of BLOCK_SIZE consecutive characters store differences between replacement and
+// original characters, so identical blocks are stored only once.
+class UnicodeTable {
+ public:
+  template <size_t N>
+  UnicodeTable(const int16 (&table)[TABLE_SIZE], const int32 (&ranges)[N]) {
+    std::map<vector<int32>, uint8> block_ids;
+    vector<int32> block(BLOCK_SIZE);
+    vector<int32> prev_block(BLOCK_SIZE);
+    size_t range_pos = 0;
+    for (uint32 block_id = 0; block_id < BLOCK_COUNT; block_id++) {
+      for (uint32 i = 0; i < BLOCK_SIZE; i++) {
+        auto code = (block_id << BLOCK_SHIFT) + i;
+        uint32 result;
+        if (code < TABLE_SIZE) {
+          result = table[code];
+        } else {
+          while (ranges[range_pos + 2] <= static_cast<int32>(code)) {
+            range_pos += 2;
+          }
+          result = get_range_replacement(ranges[range_pos], ranges[range_pos + 1], code);
+        }
+        block[i] = result == 0 ? ZERO_RESULT : static_cast<int32>(result) - static_cast<int32>(code);
+      }
 
-  auto code_int = static_cast<int32>(code);
-  size_t l = 0;
-  size_t r = N;
-  while (l < r) {
-    size_t m = ((l + r + 2) >> 2) << 1;
-    if (ranges[m] <= code_int) {
-      l = m;
-    } else {
-      r = m - 2;
+      // most blocks are equal to the previous one
+      if (block_id > 0 && block == prev_block) {
+        block_index_[block_id] = block_index_[block_id - 1];
+        continue;
+      }
+      auto it = block_ids.find(block);
+      if (it == block_ids.end()) {
+        CHECK(block_ids.size() <= 255);
+        it = block_ids.emplace(block, static_cast<uint8>(block_ids.size())).first;
+        blocks_.insert(blocks_.end(), block.begin(), block.end());
+      }
+      block_index_[block_id] = it->second;
+      prev_block.swap(block);
     }
   }
 
-  int32 t = ranges[l + 1];
-  if (t < 0) {
-    return code - ranges[l] + (~t);
-  }
-  if (t <= 0x10ffff) {
-    return t;
-  }
-  switch (t - 0x200000) {
-    case 0:
-      return (code & -2);
-    case 1:
-      return (code | 1);
-    case 2:
-      return ((code - 1) | 1);
-    default:
-      LOG(FATAL) << code << " " << l << " " << r << " " << t;
+  uint32 get(uint32 code) const {
+    if (code > MAX_CODE) {
       return 0;
+    }
+    auto block_begin = static_cast<size_t>(block_index_[code >> BLOCK_SHIFT]) << BLOCK_SHIFT;
+    auto diff = blocks_[block_begin | (code & (BLOCK_SIZE - 1))];
+    if (diff == ZERO_RESULT) {
+      return 0;
+    }
+    return code + diff;
   }
-}
+
+ private:
+  static constexpr uint32 MAX_CODE = 0x10ffff;
+  static constexpr uint32 BLOCK_SHIFT = 7;
+  static constexpr uint32 BLOCK_SIZE = 1 << BLOCK_SHIFT;
+  static constexpr uint32 BLOCK_COUNT = (MAX_CODE + 1) >> BLOCK_SHIFT;
+  static constexpr int32 ZERO_RESULT = std::numeric_limits<int32>::min();
+
+  uint8 block_index_[BLOCK_COUNT];
+  vector<int32> blocks_;
+
+  // returns the replacement for the specified character from the range starting with range_begin
+  static uint32 get_range_replacement(int32 range_begin, int32 t, uint32 code) {
+    if (t < 0) {
+      return code - range_begin + (~t);
+    }
+    if (t <= 0x10ffff) {
+      return t;
+    }
+    switch (t - 0x200000) {
+      case 0:
+        return (code & -2);
+      case 1:
+        return (code | 1);
+      case 2:
+        return ((code - 1) | 1);
+      default:
+        LOG(FATAL) << code << " " << range_begin << " " << t;
+        return 0;
+    }
+  }
+};
+
+}  // namespace
 
 uint32 prepare_search_character(uint32 code) {
   if (code < TABLE_SIZE) {
     return prepare_search_character_table[code];
-  } else {
-    return binary_search_ranges(prepare_search_character_ranges, code);
   }
+  static const UnicodeTable table(prepare_search_character_table, prepare_search_character_ranges);
+  return table.get(code);
 }
 
 uint32 unicode_to_lower(uint32 code) {
   if (code < TABLE_SIZE) {
     return to_lower_table[code];
-  } else {
-    return binary_search_ranges(to_lower_ranges, code);
   }
+  static const UnicodeTable table(to_lower_table, to_lower_ranges);
+  return table.get(code);
 }
 
 uint32 remove_diacritics(uint32 code) {
   if (code < TABLE_SIZE) {
     return without_diacritics_table[code];
-  } else {
-    return binary_search_ranges(without_diacritics_ranges, code);
   }
+  static const UnicodeTable table(without_diacritics_table, without_diacritics_ranges);
+  return table.get(code);
 }
 
 }  // namespace td
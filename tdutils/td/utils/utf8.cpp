@@ -6,12 +6,127 @@
 //
 #include "td/utils/utf8.h"
 
+#include "td/utils/bits.h"
 #include "td/utils/logging.h"
+#include "td/utils/misc.h"
 #include "td/utils/unicode.h"
 
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define TD_UTF8_SSE2 1
+#include <emmintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#define TD_UTF8_NEON 1
+#include <arm_neon.h>
+#endif
+
 namespace td {
 
-bool check_utf8(CSlice str) {
+namespace {
+
+// SSE2 and NEON are always available on x86-64 and AArch64 respectively, so no runtime dispatch is needed;
+// other platforms process 8 bytes at a time in a general-purpose register
+#if TD_UTF8_SSE2 || TD_UTF8_NEON
+constexpr size_t UTF8_BLOCK_SIZE = 16;
+#else
+constexpr size_t UTF8_BLOCK_SIZE = 8;
+constexpr uint64 UTF8_HIGH_BITS = 0x8080808080808080ull;
+
+uint64 load_utf8_block(const unsigned char *data) {
+  uint64 result;
+  std::memcpy(&result, data, sizeof(result));
+  return result;
+}
+#endif
+
+bool is_ascii_utf8_block(const unsigned char *data) {
+#if TD_UTF8_SSE2
+  return _mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(data))) == 0;
+#elif TD_UTF8_NEON
+  return vmaxvq_u8(vld1q_u8(data)) < 0x80;
+#else
+  return (load_utf8_block(data) & UTF8_HIGH_BITS) == 0;
+#endif
+}
+
+// skips whole blocks of ASCII characters
+const char *skip_ascii_utf8_blocks(const char *data, const char *data_end) {
+  while (static_cast<size_t>(data_end - data) >= UTF8_BLOCK_SIZE &&
+         is_ascii_utf8_block(reinterpret_cast<const unsigned char *>(data))) {
+    data += UTF8_BLOCK_SIZE;
+  }
+  return data;
+}
+
+// returns number of first code units of UTF-8 characters plus number of first code units of 4-byte characters
+// if count_four_byte_characters is true in whole blocks, and moves data to the first unprocessed byte
+template <bool count_four_byte_characters>
+size_t count_utf8_blocks(const unsigned char *&data, size_t size) {
+  size_t block_count = size / UTF8_BLOCK_SIZE;
+  size_t result = block_count * UTF8_BLOCK_SIZE;
+#if TD_UTF8_SSE2 || TD_UTF8_NEON
+  while (block_count > 0) {
+    // per-byte counters must not overflow
+    auto chunk_block_count = block_count < 255 ? block_count : 255;
+    block_count -= chunk_block_count;
+#if TD_UTF8_SSE2
+    const __m128i min_first_code_unit = _mm_set1_epi8(static_cast<char>(0xC0));
+    const __m128i before_four_byte_first_code_unit = _mm_set1_epi8(static_cast<char>(0xEF));
+    const __m128i after_four_byte_first_code_unit = _mm_set1_epi8(static_cast<char>(0xF8));
+    __m128i continuation_count = _mm_setzero_si128();
+    __m128i four_byte_count = _mm_setzero_si128();
+    for (size_t i = 0; i < chunk_block_count; i++, data += UTF8_BLOCK_SIZE) {
+      auto block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data));
+      // continuation code units are 0x80-0xBF, i.e. less than -64 as signed bytes
+      continuation_count = _mm_sub_epi8(continuation_count, _mm_cmplt_epi8(block, min_first_code_unit));
+      if (count_four_byte_characters) {
+        // first code units of 4-byte characters are 0xF0-0xF7
+        four_byte_count = _mm_sub_epi8(four_byte_count,
+                                       _mm_and_si128(_mm_cmpgt_epi8(block, before_four_byte_first_code_unit),
+                                                     _mm_cmplt_epi8(block, after_four_byte_first_code_unit)));
+      }
+    }
+    auto sum_bytes = [](__m128i counts) {
+      auto sums = _mm_sad_epu8(counts, _mm_setzero_si128());
+      return static_cast<size_t>(_mm_cvtsi128_si32(sums)) +
+             static_cast<size_t>(_mm_cvtsi128_si32(_mm_srli_si128(sums, 8)));
+    };
+    result -= sum_bytes(continuation_count);
+    if (count_four_byte_characters) {
+      result += sum_bytes(four_byte_count);
+    }
+#else
+    uint8x16_t continuation_count = vdupq_n_u8(0);
+    uint8x16_t four_byte_count = vdupq_n_u8(0);
+    for (size_t i = 0; i < chunk_block_count; i++, data += UTF8_BLOCK_SIZE) {
+      auto block = vld1q_u8(data);
+      continuation_count = vsubq_u8(continuation_count, vceqq_u8(vandq_u8(block, vdupq_n_u8(0xC0)), vdupq_n_u8(0x80)));
+      if (count_four_byte_characters) {
+        four_byte_count = vsubq_u8(four_byte_count, vceqq_u8(vandq_u8(block, vdupq_n_u8(0xF8)), vdupq_n_u8(0xF0)));
+      }
+    }
+    result -= vaddlvq_u8(continuation_count);
+    if (count_four_byte_characters) {
+      result += vaddlvq_u8(four_byte_count);
+    }
+#endif
+  }
+#else
+  for (size_t i = 0; i < block_count; i++, data += UTF8_BLOCK_SIZE) {
+    auto block = load_utf8_block(data);
+    // the highest bit of each byte is moved to the same byte by the shifts, lower bits are masked out
+    result -= count_bits64(block & ~(block << 1) & UTF8_HIGH_BITS);
+    if (count_four_byte_characters) {
+      result += count_bits64(block & (block << 1) & (block << 2) & (block << 3) & ~(block << 4) & UTF8_HIGH_BITS);
+    }
+  }
+#endif
+  return result;
+}
+
+template <bool skip_ascii_blocks>
+bool check_utf8_impl(CSlice str) {
   const char *data = str.data();
   const char *data_end = data + str.size();
   do {
@@ -20,6 +135,9 @@ bool check_utf8(CSlice str) {
       if (data == data_end + 1) {
         return true;
       }
+      if (skip_ascii_blocks) {
+        data = skip_ascii_utf8_blocks(data, data_end);
+      }
       continue;
     }
 
@@ -61,6 +179,28 @@ bool check_utf8(CSlice str) {
   return false;
 }
 
+}  // namespace
+
+bool check_utf8(CSlice str) {
+  return check_utf8_impl<true>(str);
+}
+
+bool check_utf8_scalar(CSlice str) {
+  return check_utf8_impl<false>(str);
+}
+
+size_t utf8_length(Slice str) {
+  auto data = str.ubegin();
+  auto result = count_utf8_blocks<false>(data, str.size());
+  return result + utf8_length_scalar(Slice(data, str.uend()));
+}
+
+size_t utf8_utf16_length(Slice str) {
+  auto data = str.ubegin();
+  auto result = count_utf8_blocks<true>(data, str.size());
+  return result + utf8_utf16_length_scalar(Slice(data, str.uend()));
+}
+
 void append_utf8_character(string &str, uint32 ch) {
   if (ch <= 0x7f) {
     str.push_back(static_cast<char>(ch));
@@ -111,9 +251,24 @@ const unsigned char *next_utf8_unsafe(const unsigned char *ptr, uint32 *code, co
 
 string utf8_to_lower(Slice str) {
   string result;
+  result.reserve(str.size());
   auto pos = str.ubegin();
   auto end = str.uend();
   while (pos != end) {
+    if (*pos < 0x80) {
+      // copy whole run of ASCII characters and convert it to lower case at once
+      auto ascii_end = reinterpret_cast<const unsigned char *>(
+          skip_ascii_utf8_blocks(reinterpret_cast<const char *>(pos), reinterpret_cast<const char *>(end)));
+      while (ascii_end != end && *ascii_end < 0x80) {
+        ascii_end++;
+      }
+      auto old_size = result.size();
+      result.append(reinterpret_cast<const char *>(pos), ascii_end - pos);
+      to_lower_inplace(MutableSlice(&result[old_size], result.size() - old_size));
+      pos = ascii_end;
+      continue;
+    }
+
     uint32 code;
     pos = next_utf8_unsafe(pos, &code, "utf8_to_lower");
     append_utf8_character(result, unicode_to_lower(code));
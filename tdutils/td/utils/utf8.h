@@ -14,13 +14,19 @@ namespace td {
 /// checks UTF-8 string for correctness
 bool check_utf8(CSlice str);
 
+/// checks UTF-8 string for correctness byte by byte; reference implementation of check_utf8
+bool check_utf8_scalar(CSlice str);
+
 /// checks if a code unit is a first code unit of a UTF-8 character
 inline bool is_utf8_character_first_code_unit(unsigned char c) {
   return (c & 0xC0) != 0x80;
 }
 
 /// returns length of UTF-8 string in characters
-inline size_t utf8_length(Slice str) {
+size_t utf8_length(Slice str);
+
+/// returns length of UTF-8 string in characters byte by byte; reference implementation of utf8_length
+inline size_t utf8_length_scalar(Slice str) {
   size_t result = 0;
   for (auto c : str) {
     result += is_utf8_character_first_code_unit(c);
@@ -29,7 +35,10 @@ inline size_t utf8_length(Slice str) {
 }
 
 /// returns length of UTF-8 string in UTF-16 code units
-inline size_t utf8_utf16_length(Slice str) {
+size_t utf8_utf16_length(Slice str);
+
+/// returns length of UTF-8 string in UTF-16 code units byte by byte; reference implementation of utf8_utf16_length
+inline size_t utf8_utf16_length_scalar(Slice str) {
   size_t result = 0;
   for (auto c : str) {
     result += is_utf8_character_first_code_unit(c) + ((c & 0xf8) == 0xf0);
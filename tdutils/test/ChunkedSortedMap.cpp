@@ -0,0 +1,187 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2022
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "td/utils/ChunkedSortedMap.h"
+#include "td/utils/ChunkedSortedSet.h"
+#include "td/utils/common.h"
+#include "td/utils/Random.h"
+#include "td/utils/tests.h"
+
+#include <iterator>
+#include <map>
+#include <set>
+#include <utility>
+
+TEST(ChunkedSortedMap, basic) {
+  td::ChunkedSortedMap<td::int32, td::unique_ptr<td::int32>, 4> map;
+  ASSERT_TRUE(map.empty());
+  ASSERT_TRUE(map.begin() == map.end());
+  ASSERT_TRUE(map.find(1) == nullptr);
+  ASSERT_TRUE(map.erase(1) == nullptr);
+
+  for (td::int32 i = 20; i >= 1; i--) {
+    auto result = map.insert(i * 2, td::make_unique<td::int32>(i * 2));
+    ASSERT_TRUE(result.second);
+    ASSERT_EQ(i * 2, **result.first);
+  }
+  ASSERT_TRUE(!map.insert(10, nullptr).second);
+  ASSERT_EQ(20u, map.size());
+  ASSERT_EQ(10, **map.find(10));
+  ASSERT_TRUE(map.find(11) == nullptr);
+
+  td::int32 expected = 2;
+  for (auto &value : map) {
+    ASSERT_EQ(expected, *value);
+    expected += 2;
+  }
+
+  ASSERT_EQ(10, map.lower_bound(9).key());
+  ASSERT_EQ(10, map.lower_bound(10).key());
+  ASSERT_EQ(12, map.upper_bound(10).key());
+  ASSERT_TRUE(map.upper_bound(40) == map.end());
+  ASSERT_EQ(2, map.upper_bound(0).key());
+  ASSERT_EQ(30, map.partition_point([](const td::unique_ptr<td::int32> &value) { return *value < 29; }).key());
+
+  auto it = map.begin();
+  --it;
+  ASSERT_TRUE(it == map.end());
+  --it;
+  ASSERT_EQ(40, it.key());
+  ++it;
+  ASSERT_TRUE(it == map.end());
+
+  ASSERT_EQ(4u, map.get_rank(10));
+  ASSERT_EQ(5u, map.get_rank(11));
+  ASSERT_EQ(0u, map.get_rank(-1));
+  ASSERT_EQ(20u, map.get_rank(100));
+  ASSERT_EQ(2, map.get_nth(0).key());
+  ASSERT_EQ(22, map.get_nth(10).key());
+  ASSERT_TRUE(map.get_nth(20) == map.end());
+
+  ASSERT_EQ(10, *map.erase(10));
+  ASSERT_TRUE(map.find(10) == nullptr);
+  ASSERT_EQ(19u, map.size());
+  map.clear();
+  ASSERT_TRUE(map.empty());
+}
+
+TEST(ChunkedSortedMap, stress_test) {
+  td::Random::Xorshift128plus rnd(123);
+  td::ChunkedSortedMap<td::uint64, td::uint64, 8> map;
+  std::map<td::uint64, td::uint64> reference;
+
+  auto check_iterators = [&](td::uint64 key) {
+    auto it = map.lower_bound(key);
+    auto reference_it = reference.lower_bound(key);
+    ASSERT_EQ(reference_it == reference.end(), it == map.end());
+    if (it != map.end()) {
+      ASSERT_EQ(reference_it->first, it.key());
+      ASSERT_EQ(reference_it->second, *it);
+    }
+
+    it = map.upper_bound(key);
+    reference_it = reference.upper_bound(key);
+    ASSERT_EQ(reference_it == reference.end(), it == map.end());
+    if (reference_it != reference.begin()) {
+      --it;
+      --reference_it;
+      ASSERT_EQ(reference_it->first, it.key());
+      ++it;
+      ++reference_it;
+    }
+    for (int i = 0; i < 10 && reference_it != reference.end(); i++, ++it, ++reference_it) {
+      ASSERT_TRUE(it != map.end());
+      ASSERT_EQ(reference_it->first, it.key());
+    }
+  };
+
+  for (int i = 0; i < 300000; i++) {
+    auto key = rnd() % 2000;
+    switch (rnd.fast(0, 5)) {
+      case 0:
+      case 1: {
+        auto value = rnd();
+        auto result = map.insert(key, value);
+        auto reference_result = reference.emplace(key, value);
+        ASSERT_EQ(reference_result.second, result.second);
+        ASSERT_EQ(reference_result.first->second, *result.first);
+        break;
+      }
+      case 2: {
+        auto reference_it = reference.find(key);
+        auto value = map.erase(key);
+        if (reference_it == reference.end()) {
+          ASSERT_EQ(0u, value);
+        } else {
+          ASSERT_EQ(reference_it->second, value);
+          reference.erase(reference_it);
+        }
+        break;
+      }
+      case 3: {
+        auto reference_it = reference.find(key);
+        auto value = map.find(key);
+        ASSERT_EQ(reference_it == reference.end(), value == nullptr);
+        if (value != nullptr) {
+          ASSERT_EQ(reference_it->second, *value);
+        }
+        break;
+      }
+      case 4: {
+        auto rank = static_cast<size_t>(std::distance(reference.begin(), reference.lower_bound(key)));
+        ASSERT_EQ(rank, map.get_rank(key));
+        auto it = map.get_nth(rank);
+        ASSERT_EQ(rank == reference.size(), it == map.end());
+        if (it != map.end()) {
+          ASSERT_EQ(reference.lower_bound(key)->first, it.key());
+        }
+        break;
+      }
+      default:
+        check_iterators(key);
+        break;
+    }
+    ASSERT_EQ(reference.size(), map.size());
+  }
+
+  auto reference_it = reference.begin();
+  for (auto it = map.begin(); it != map.end(); ++it, ++reference_it) {
+    ASSERT_EQ(reference_it->first, it.key());
+    ASSERT_EQ(reference_it->second, *it);
+  }
+  ASSERT_TRUE(reference_it == reference.end());
+}
+
+TEST(ChunkedSortedSet, basic) {
+  td::ChunkedSortedSet<td::int32, 4> set;
+  std::set<td::int32> reference;
+  td::Random::Xorshift128plus rnd(123);
+  for (int i = 0; i < 10000; i++) {
+    auto key = rnd.fast(0, 100);
+    if (rnd.fast(0, 1) == 0) {
+      ASSERT_EQ(reference.insert(key).second, set.insert(key));
+    } else {
+      ASSERT_EQ(reference.erase(key), set.erase(key));
+    }
+    ASSERT_EQ(reference.count(key), set.count(key));
+    ASSERT_EQ(reference.size(), set.size());
+  }
+
+  auto it = set.begin();
+  for (auto key : reference) {
+    ASSERT_TRUE(it != set.end());
+    ASSERT_EQ(key, *it);
+    ++it;
+  }
+  ASSERT_TRUE(it == set.end());
+
+  if (!reference.empty()) {
+    auto last = *reference.rbegin();
+    ASSERT_EQ(reference.size() - 1, set.get_rank(last));
+    ASSERT_EQ(last, *set.get_nth(reference.size() - 1));
+    ASSERT_TRUE(set.upper_bound(last) == set.end());
+  }
+}
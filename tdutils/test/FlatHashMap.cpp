@@ -0,0 +1,174 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2022
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "td/utils/common.h"
+#include "td/utils/FlatHashMap.h"
+#include "td/utils/FlatHashSet.h"
+#include "td/utils/Random.h"
+#include "td/utils/tests.h"
+
+#include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+template <class T>
+static auto extract_kv(const T &reference) {
+  auto data = td::vector<std::pair<typename T::key_type, typename T::value_type::second_type>>();
+  for (auto &it : reference) {
+    data.emplace_back(it.first, it.second);
+  }
+  std::sort(data.begin(), data.end());
+  return data;
+}
+
+template <class T>
+static auto extract_k(const T &reference) {
+  auto data = td::vector<typename T::key_type>();
+  for (auto &it : reference) {
+    data.push_back(it);
+  }
+  std::sort(data.begin(), data.end());
+  return data;
+}
+
+TEST(FlatHashMap, basic) {
+  td::FlatHashMap<td::int32, td::string> map;
+  ASSERT_TRUE(map.empty());
+  ASSERT_TRUE(map.begin() == map.end());
+  ASSERT_TRUE(map.find(1) == map.end());
+  ASSERT_EQ(0u, map.count(0));
+
+  map[1] = "a";
+  ASSERT_TRUE(map.emplace(2, "b").second);
+  ASSERT_TRUE(!map.emplace(2, "c").second);
+  ASSERT_EQ(2u, map.size());
+  ASSERT_EQ("b", map[2]);
+  ASSERT_EQ("a", map.find(1)->second);
+  ASSERT_EQ(1u, map.count(1));
+
+  const auto &const_map = map;
+  ASSERT_EQ("b", const_map.find(2)->second);
+  ASSERT_TRUE(const_map.find(3) == const_map.end());
+
+  auto copy = map;
+  ASSERT_EQ(1u, map.erase(1));
+  ASSERT_EQ(0u, map.erase(1));
+  ASSERT_EQ(1u, map.size());
+  ASSERT_EQ(2u, copy.size());
+  ASSERT_EQ("a", copy[1]);
+
+  auto moved = std::move(copy);
+  ASSERT_EQ(2u, moved.size());
+  map.erase(map.find(2));
+  ASSERT_TRUE(map.empty());
+
+  td::FlatHashMap<td::int32, td::unique_ptr<td::int32>> ptr_map;
+  for (td::int32 i = 1; i <= 1000; i++) {
+    ptr_map[i] = td::make_unique<td::int32>(i);
+  }
+  ptr_map.remove_if([](auto &it) { return *it.second % 3 != 0; });
+  ASSERT_EQ(333u, ptr_map.size());
+  for (auto &it : ptr_map) {
+    ASSERT_EQ(it.first, *it.second);
+    ASSERT_EQ(0, it.first % 3);
+  }
+  ptr_map.clear();
+  ASSERT_TRUE(ptr_map.empty());
+}
+
+TEST(FlatHashSet, basic) {
+  td::FlatHashSet<td::string> set;
+  ASSERT_TRUE(set.insert("a").second);
+  ASSERT_TRUE(!set.insert("a").second);
+  ASSERT_TRUE(set.insert("b").second);
+  ASSERT_EQ(2u, set.size());
+  ASSERT_EQ(0u, set.count(td::string()));
+  ASSERT_EQ(1u, set.count("b"));
+  ASSERT_EQ(1u, set.erase("a"));
+  ASSERT_EQ("b", *set.begin());
+
+  td::vector<td::string> values{"c", "d", "b"};
+  set.insert(values.begin(), values.end());
+  ASSERT_EQ(3u, set.size());
+  ASSERT_EQ(values.size(), extract_k(set).size());
+}
+
+TEST(FlatHashMap, stress_test) {
+  td::Random::Xorshift128plus rnd(123);
+  td::FlatHashMap<td::uint64, td::uint64> map;
+  std::unordered_map<td::uint64, td::uint64> reference;
+  td::FlatHashSet<td::uint64> set;
+  std::unordered_set<td::uint64> reference_set;
+
+  auto random_key = [&] {
+    // keys with equal lower bits to check clustering
+    return (rnd() % 2 == 0 ? rnd() % 1000 : (rnd() % 1000) << 40) + 1;
+  };
+
+  for (int i = 0; i < 500000; i++) {
+    auto key = random_key();
+    switch (rnd.fast(0, 5)) {
+      case 0:
+      case 1: {
+        auto value = rnd();
+        map[key] = value;
+        reference[key] = value;
+        set.insert(key);
+        reference_set.insert(key);
+        break;
+      }
+      case 2:
+        ASSERT_EQ(reference.erase(key), map.erase(key));
+        ASSERT_EQ(reference_set.erase(key), set.erase(key));
+        break;
+      case 3: {
+        auto it = map.find(key);
+        auto reference_it = reference.find(key);
+        ASSERT_EQ(reference_it == reference.end(), it == map.end());
+        if (it != map.end()) {
+          ASSERT_EQ(reference_it->second, it->second);
+          reference.erase(reference_it);
+          map.erase(it);
+        }
+        break;
+      }
+      case 4:
+        ASSERT_EQ(reference.count(key), map.count(key));
+        ASSERT_EQ(reference_set.count(key), set.count(key));
+        break;
+      default:
+        if (rnd.fast(0, 1000) == 0) {
+          auto mod = rnd.fast(2, 5);
+          map.remove_if([mod](auto &it) { return it.second % mod == 0; });
+          for (auto it = reference.begin(); it != reference.end();) {
+            if (it->second % mod == 0) {
+              it = reference.erase(it);
+            } else {
+              ++it;
+            }
+          }
+          set.remove_if([mod](auto key) { return key % mod == 0; });
+          for (auto it = reference_set.begin(); it != reference_set.end();) {
+            if (*it % mod == 0) {
+              it = reference_set.erase(it);
+            } else {
+              ++it;
+            }
+          }
+        }
+        if (rnd.fast(0, 10000) == 0) {
+          ASSERT_TRUE(extract_kv(reference) == extract_kv(map));
+          ASSERT_TRUE(extract_k(reference_set) == extract_k(set));
+        }
+        break;
+    }
+    ASSERT_EQ(reference.size(), map.size());
+    ASSERT_EQ(reference_set.size(), set.size());
+  }
+  ASSERT_TRUE(extract_kv(reference) == extract_kv(map));
+  ASSERT_TRUE(extract_k(reference_set) == extract_k(set));
+}
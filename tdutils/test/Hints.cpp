@@ -0,0 +1,146 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2022
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "td/utils/common.h"
+#include "td/utils/Hints.h"
+#include "td/utils/misc.h"
+#include "td/utils/Random.h"
+#include "td/utils/tests.h"
+
+#include <algorithm>
+#include <map>
+#include <utility>
+
+TEST(Hints, simple) {
+  td::Hints hints;
+  hints.add(1, "Ivan Petrov");
+  hints.add(2, "Petr Ivanov");
+  hints.add(3, "Anna");
+  hints.set_rating(1, 2);
+  hints.set_rating(2, 1);
+  ASSERT_EQ(3u, hints.size());
+
+  auto result = hints.search("iv", 10);
+  ASSERT_EQ(2u, result.first);
+  ASSERT_TRUE(result.second == td::vector<td::int64>({2, 1}));
+
+  result = hints.search("iv pet", 1);
+  ASSERT_EQ(2u, result.first);
+  ASSERT_TRUE(result.second == td::vector<td::int64>({2}));
+
+  result = hints.search("ivan petrov", 10);
+  ASSERT_EQ(1u, result.first);
+  ASSERT_TRUE(result.second == td::vector<td::int64>({1}));
+
+  result = hints.search_empty(10);
+  ASSERT_EQ(3u, result.first);
+  ASSERT_TRUE(result.second == td::vector<td::int64>({3, 2, 1}));
+
+  hints.add(1, "Anna Ivanova");
+  result = hints.search("petr", 10);
+  ASSERT_TRUE(result.second == td::vector<td::int64>({2}));
+  result = hints.search("ann", 10);
+  ASSERT_TRUE(result.second == td::vector<td::int64>({3, 1}));
+  ASSERT_EQ("Anna Ivanova", hints.key_to_string(1));
+
+  hints.remove(3);
+  ASSERT_TRUE(!hints.has_key(3));
+  result = hints.search("ann", 10);
+  ASSERT_TRUE(result.second == td::vector<td::int64>({1}));
+}
+
+TEST(Hints, random) {
+  td::Random::Xorshift128plus rnd(123);
+  auto gen_word = [&] {
+    td::string word;
+    auto length = rnd.fast(1, 4);
+    for (int i = 0; i < length; i++) {
+      word += static_cast<char>('0' + rnd.fast(0, 4));
+    }
+    return word;
+  };
+  auto gen_name = [&] {
+    td::string name;
+    auto word_count = rnd.fast(1, 3);
+    for (int i = 0; i < word_count; i++) {
+      if (i != 0) {
+        name += ' ';
+      }
+      name += gen_word();
+    }
+    return name;
+  };
+
+  td::Hints hints;
+  std::map<td::int64, td::string> names;
+  std::map<td::int64, td::int64> ratings;
+
+  auto check_search = [&](const td::string &query, td::int32 limit) {
+    auto query_words = td::full_split(query, ' ');
+    td::vector<td::int64> expected;
+    for (auto &name : names) {
+      auto name_words = td::full_split(name.second, ' ');
+      bool is_found = true;
+      for (auto &query_word : query_words) {
+        bool is_word_found = false;
+        for (auto &name_word : name_words) {
+          if (td::begins_with(name_word, query_word)) {
+            is_word_found = true;
+          }
+        }
+        if (!is_word_found) {
+          is_found = false;
+        }
+      }
+      if (is_found) {
+        expected.push_back(name.first);
+      }
+    }
+    std::sort(expected.begin(), expected.end(), [&](td::int64 lhs, td::int64 rhs) {
+      return std::make_pair(ratings[lhs], lhs) < std::make_pair(ratings[rhs], rhs);
+    });
+    auto expected_size = expected.size();
+    if (expected.size() > static_cast<size_t>(limit)) {
+      expected.resize(limit);
+    }
+
+    auto result = hints.search(query, limit);
+    ASSERT_EQ(expected_size, result.first);
+    ASSERT_TRUE(expected == result.second);
+  };
+
+  for (int i = 0; i < 50000; i++) {
+    auto key = static_cast<td::int64>(rnd.fast(1, 3000));
+    switch (rnd.fast(0, 9)) {
+      case 0:
+        hints.remove(key);
+        names.erase(key);
+        ratings.erase(key);
+        break;
+      case 1: {
+        auto rating = static_cast<td::int64>(rnd.fast(0, 10));
+        hints.set_rating(key, rating);
+        ratings[key] = rating;
+        break;
+      }
+      case 2:
+        if (rnd.fast(0, 3) == 0) {
+          check_search(gen_word(), rnd.fast(1, 100));
+        }
+        if (rnd.fast(0, 30) == 0) {
+          check_search(gen_name(), rnd.fast(1, 100));
+        }
+        break;
+      default: {
+        auto name = gen_name();
+        hints.add(key, name);
+        names[key] = name;
+        break;
+      }
+    }
+    ASSERT_EQ(names.size(), hints.size());
+  }
+}
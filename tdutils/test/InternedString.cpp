@@ -0,0 +1,69 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2022
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "td/utils/common.h"
+#include "td/utils/InternedString.h"
+#include "td/utils/Slice.h"
+#include "td/utils/tests.h"
+#include "td/utils/tl_helpers.h"
+
+#include <utility>
+
+TEST(InternedString, simple) {
+  auto initial_count = td::InternedString::get_interned_string_count();
+
+  td::InternedString empty;
+  ASSERT_TRUE(empty.empty());
+  ASSERT_EQ("", empty.str());
+  ASSERT_TRUE(empty == td::InternedString(td::string()));
+  ASSERT_EQ(initial_count, td::InternedString::get_interned_string_count());
+
+  {
+    td::InternedString a("Alexander");
+    td::string b_str = "Alex";
+    b_str += "ander";
+    td::InternedString b(b_str);
+    ASSERT_TRUE(a == b);
+    ASSERT_EQ(&a.str(), &b.str());
+    ASSERT_TRUE(a == td::Slice("Alexander"));
+    ASSERT_TRUE(td::string("Alexander") == a);
+    ASSERT_TRUE(a != td::Slice("Alex"));
+    ASSERT_EQ(9u, a.size());
+    ASSERT_EQ(initial_count + 1, td::InternedString::get_interned_string_count());
+
+    td::InternedString c("Bob");
+    ASSERT_TRUE(a != c);
+    ASSERT_EQ(initial_count + 2, td::InternedString::get_interned_string_count());
+
+    auto d = c;
+    c = a;
+    ASSERT_TRUE(c == a);
+    ASSERT_EQ("Bob", d.str());
+    d.clear();
+    ASSERT_TRUE(d.empty());
+    ASSERT_EQ(initial_count + 1, td::InternedString::get_interned_string_count());
+
+    auto e = std::move(a);
+    ASSERT_TRUE(e == b);
+    ASSERT_EQ(initial_count + 1, td::InternedString::get_interned_string_count());
+    ASSERT_EQ("Alexander", PSTRING() << e);
+  }
+  ASSERT_EQ(initial_count, td::InternedString::get_interned_string_count());
+}
+
+TEST(InternedString, serialize) {
+  td::InternedString str("language");
+  auto serialized = td::serialize(str);
+  ASSERT_EQ(serialized, td::serialize(td::string("language")));
+
+  td::InternedString parsed;
+  ASSERT_TRUE(td::unserialize(parsed, serialized).is_ok());
+  ASSERT_TRUE(parsed == str);
+
+  td::string parsed_string;
+  ASSERT_TRUE(td::unserialize(parsed_string, td::serialize(str)).is_ok());
+  ASSERT_EQ("language", parsed_string);
+}
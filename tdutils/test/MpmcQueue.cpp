@@ -204,4 +204,116 @@ TEST(MpmcQueue, multi_thread) {
   }
   LOG_CHECK(q.hazard_pointers_to_delele_size_unsafe() == 0) << q.hazard_pointers_to_delele_size_unsafe();
 }
+
+TEST(MpmcBoundedQueue, simple) {
+  td::MpmcBoundedQueue<td::string> q(5);
+  ASSERT_EQ(8u, q.capacity());
+  td::string value;
+  ASSERT_TRUE(!q.try_pop(value));
+  for (int t = 0; t < 3; t++) {
+    for (int i = 0; i < 8; i++) {
+      ASSERT_TRUE(q.try_push(td::to_string(i)));
+    }
+    ASSERT_TRUE(!q.try_push(td::string("full")));
+    for (int i = 0; i < 8; i++) {
+      ASSERT_TRUE(q.try_pop(value));
+      ASSERT_EQ(td::to_string(i), value);
+    }
+    ASSERT_TRUE(!q.try_pop(value));
+  }
+
+  td::vector<td::string> values{"a", "b", "c", "d", "e", "f"};
+  ASSERT_EQ(6u, q.try_push_batch(values.data(), values.size()));
+  values = {"g", "h", "i"};
+  ASSERT_EQ(2u, q.try_push_batch(values.data(), values.size()));
+  td::vector<td::string> result(5);
+  ASSERT_EQ(5u, q.try_pop_batch(result.data(), result.size()));
+  ASSERT_TRUE(result == td::vector<td::string>({"a", "b", "c", "d", "e"}));
+  ASSERT_EQ(3u, q.try_pop_batch(result.data(), result.size()));
+  ASSERT_EQ("f", result[0]);
+  ASSERT_EQ("g", result[1]);
+  ASSERT_EQ("h", result[2]);
+  ASSERT_EQ(0u, q.try_pop_batch(result.data(), result.size()));
+}
+
+TEST(MpmcBoundedQueue, multi_thread) {
+  size_t n = 10;
+  size_t m = 10;
+  size_t qn = 100000;
+  td::MpmcBoundedQueue<td::uint64> q(256);
+  std::vector<td::thread> n_threads(n);
+  std::vector<td::thread> m_threads(m);
+  std::vector<std::vector<td::uint64>> thread_data(m);
+  for (size_t i = 0; i < m; i++) {
+    m_threads[i] = td::thread([&, i] {
+      td::uint64 values[7];
+      bool use_batch = i % 2 == 0;
+      while (true) {
+        size_t popped = use_batch ? q.try_pop_batch(values, 7) : static_cast<size_t>(q.try_pop(values[0]));
+        if (popped == 0) {
+          td::this_thread::yield();
+          continue;
+        }
+        for (size_t j = 0; j < popped; j++) {
+          if (values[j] == 0) {
+            // all sentinels are pushed after all values, so there are no values after the first sentinel
+            for (size_t k = j + 1; k < popped; k++) {
+              CHECK(values[k] == 0);
+              while (!q.try_push(static_cast<td::uint64>(0))) {
+                td::this_thread::yield();
+              }
+            }
+            return;
+          }
+          thread_data[i].push_back(values[j]);
+        }
+      }
+    });
+  }
+  for (size_t i = 0; i < n; i++) {
+    n_threads[i] = td::thread([&, i] {
+      td::uint64 values[5];
+      size_t pos = 0;
+      while (pos < qn) {
+        size_t count = 0;
+        while (count < 5 && pos + count < qn) {
+          values[count] = (static_cast<td::uint64>(i) << 32) + pos + count + 1;
+          count++;
+        }
+        auto pushed = i % 2 == 0 ? q.try_push_batch(values, count) : static_cast<size_t>(q.try_push(values[0]));
+        if (pushed == 0) {
+          td::this_thread::yield();
+        }
+        pos += pushed;
+      }
+    });
+  }
+  for (auto &thread : n_threads) {
+    thread.join();
+  }
+  for (size_t i = 0; i < m; i++) {
+    while (!q.try_push(static_cast<td::uint64>(0))) {
+      td::this_thread::yield();
+    }
+  }
+  for (auto &thread : m_threads) {
+    thread.join();
+  }
+
+  std::vector<td::uint64> all;
+  for (auto &data : thread_data) {
+    std::vector<td::uint64> last(n, 0);
+    for (auto value : data) {
+      auto from = static_cast<size_t>(value >> 32);
+      CHECK(value > last[from]);
+      last[from] = value;
+      all.push_back(value);
+    }
+  }
+  LOG_CHECK(all.size() == n * qn) << all.size();
+  std::sort(all.begin(), all.end());
+  for (size_t i = 0; i < n * qn; i++) {
+    CHECK(all[i] == (static_cast<td::uint64>(i / qn) << 32) + i % qn + 1);
+  }
+}
 #endif
@@ -69,6 +69,10 @@ TEST(MpmcSleepyWaiter, stress_one_one) {
   test_waiter_stress_one_one<td::MpmcSleepyWaiter>();
 }
 
+TEST(MpmcFutexWaiter, stress_one_one) {
+  test_waiter_stress_one_one<td::MpmcFutexWaiter>();
+}
+
 template <class W>
 static void test_waiter_stress() {
   td::Stage run;
@@ -140,4 +144,8 @@ TEST(MpmcEagerWaiter, stress_multi) {
 TEST(MpmcSleepyWaiter, stress_multi) {
   test_waiter_stress<td::MpmcSleepyWaiter>();
 }
+
+TEST(MpmcFutexWaiter, stress_multi) {
+  test_waiter_stress<td::MpmcFutexWaiter>();
+}
 #endif
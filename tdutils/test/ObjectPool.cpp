@@ -0,0 +1,87 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2022
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "td/utils/common.h"
+#include "td/utils/ObjectPool.h"
+#include "td/utils/Random.h"
+#include "td/utils/tests.h"
+
+#include <utility>
+
+namespace {
+class Node {
+ public:
+  Node() = default;
+  explicit Node(td::int32 value) : value_(value) {
+  }
+
+  td::int32 value() const {
+    return value_;
+  }
+
+  void clear() {
+    value_ = 0;
+  }
+
+ private:
+  td::int32 value_ = 0;
+};
+}  // namespace
+
+TEST(ObjectPool, simple) {
+  td::ObjectPool<Node> pool;
+  auto ptr = pool.create(1);
+  ASSERT_EQ(1, ptr->value());
+  auto weak_ptr = ptr.get_weak();
+  ASSERT_TRUE(weak_ptr.is_alive());
+  ASSERT_EQ(1, weak_ptr->value());
+
+  ptr.reset();
+  ASSERT_TRUE(ptr.empty());
+  ASSERT_TRUE(!weak_ptr.is_alive());
+
+  auto new_ptr = pool.create(2);
+  ASSERT_TRUE(!weak_ptr.is_alive());
+  ASSERT_TRUE(new_ptr.get_weak().is_alive());
+  ASSERT_EQ(2, new_ptr->value());
+}
+
+TEST(ObjectPool, stress) {
+  td::Random::Xorshift128plus rnd(123);
+  td::ObjectPool<Node> pool;
+  td::vector<std::pair<td::ObjectPool<Node>::OwnerPtr, td::int32>> objects;
+  td::vector<std::pair<td::ObjectPool<Node>::WeakPtr, td::int32>> weak_objects;
+  for (int i = 0; i < 100000; i++) {
+    if (objects.empty() || rnd.fast(0, 2) != 0) {
+      auto value = rnd.fast(1, 1000000);
+      objects.emplace_back(pool.create(value), value);
+      weak_objects.emplace_back(objects.back().first.get_weak(), value);
+    } else {
+      auto pos = static_cast<size_t>(rnd.fast(0, static_cast<int>(objects.size()) - 1));
+      std::swap(objects[pos], objects.back());
+      objects.pop_back();
+    }
+    if (weak_objects.size() > 1000) {
+      weak_objects.erase(weak_objects.begin(), weak_objects.begin() + 500);
+    }
+  }
+  for (auto &object : objects) {
+    ASSERT_EQ(object.second, object.first->value());
+    ASSERT_TRUE(object.first.get_weak().is_alive());
+  }
+  td::int32 alive_count = 0;
+  for (auto &weak_object : weak_objects) {
+    if (weak_object.first.is_alive()) {
+      ASSERT_EQ(weak_object.second, weak_object.first->value());
+      alive_count++;
+    }
+  }
+  ASSERT_TRUE(alive_count <= static_cast<td::int32>(objects.size()));
+  objects.clear();
+  for (auto &weak_object : weak_objects) {
+    ASSERT_TRUE(!weak_object.first.is_alive());
+  }
+}
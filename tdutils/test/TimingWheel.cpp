@@ -0,0 +1,108 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2022
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "td/utils/tests.h"
+
+#include "td/utils/common.h"
+#include "td/utils/logging.h"
+#include "td/utils/Random.h"
+#include "td/utils/TimingWheel.h"
+
+#include <set>
+#include <utility>
+
+TEST(TimingWheel, simple) {
+  td::TimingWheel wheel;
+  td::vector<td::TimingWheelNode> nodes(3);
+  wheel.insert(10.0, &nodes[0]);
+  wheel.insert(1.5, &nodes[1]);
+  wheel.insert(100000.0, &nodes[2]);
+  ASSERT_EQ(3u, wheel.size());
+  ASSERT_TRUE(wheel.get_wakeup_at() <= 1.5 + 1e-3);
+
+  ASSERT_TRUE(wheel.pop_expired(1.0) == nullptr);
+  ASSERT_TRUE(wheel.pop_expired(1.6) == &nodes[1]);
+  ASSERT_TRUE(wheel.pop_expired(1.6) == nullptr);
+  ASSERT_TRUE(!nodes[1].in_wheel());
+
+  wheel.fix(2.0, &nodes[0]);
+  ASSERT_EQ(2.0, wheel.get_key(&nodes[0]));
+  wheel.erase(&nodes[2]);
+  ASSERT_TRUE(wheel.pop_expired(1e9) == &nodes[0]);
+  ASSERT_TRUE(wheel.empty());
+}
+
+TEST(TimingWheel, random_events) {
+  td::Random::Xorshift128plus rnd(123);
+  constexpr int N = 1000;
+  td::vector<td::TimingWheelNode> nodes(N);
+  // nodes with keys in the past are expired as if they had the current time as the key
+  td::vector<double> expire_at(N);
+  std::set<std::pair<double, int>> expire_queue;
+  td::TimingWheel wheel;
+
+  double now = 1000.0;
+  auto random_key = [&] {
+    switch (rnd.fast(0, 3)) {
+      case 0:
+        return now - rnd.fast(0, 1000) * 1e-3;
+      case 1:
+        return now + rnd.fast(0, 1000) * 1e-3;
+      case 2:
+        return now + rnd.fast(0, 1000000) * 1e-1;
+      default:
+        return now + rnd.fast(0, 1000000) * 1e4;
+    }
+  };
+
+  for (int i = 0; i < 300000; i++) {
+    auto id = rnd.fast(0, N - 1);
+    auto &node = nodes[id];
+    switch (rnd.fast(0, 3)) {
+      case 0:
+      case 1: {
+        auto key = random_key();
+        if (node.in_wheel()) {
+          expire_queue.erase(std::make_pair(expire_at[id], id));
+          wheel.fix(key, &node);
+        } else {
+          wheel.insert(key, &node);
+        }
+        ASSERT_EQ(key, wheel.get_key(&node));
+        expire_at[id] = td::max(key, now);
+        expire_queue.emplace(expire_at[id], id);
+        break;
+      }
+      case 2:
+        if (node.in_wheel()) {
+          expire_queue.erase(std::make_pair(expire_at[id], id));
+          wheel.erase(&node);
+        }
+        break;
+      default: {
+        if (rnd.fast(0, 100) == 0 && !wheel.empty()) {
+          now = td::max(now, wheel.get_wakeup_at());
+        } else {
+          now += rnd.fast(0, 1000) * (rnd.fast(0, 10) == 0 ? 1e1 : 1e-3);
+        }
+        while (auto *expired = wheel.pop_expired(now)) {
+          auto expired_id = static_cast<int>(expired - &nodes[0]);
+          ASSERT_TRUE(expired->key_ < now);
+          ASSERT_EQ(1u, expire_queue.erase(std::make_pair(expire_at[expired_id], expired_id)));
+        }
+        if (!expire_queue.empty()) {
+          // all nodes must be expired with precision of one tick
+          auto min_expire_at = expire_queue.begin()->first;
+          ASSERT_TRUE(min_expire_at >= now - 1e-3 - 1e-6);
+          ASSERT_TRUE(wheel.get_wakeup_at() <= min_expire_at + 1e-3 + 1e-6);
+          ASSERT_TRUE(wheel.get_wakeup_at() > now - 1e-3);
+        }
+        break;
+      }
+    }
+    ASSERT_EQ(expire_queue.size(), wheel.size());
+  }
+}
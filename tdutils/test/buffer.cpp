@@ -54,3 +54,43 @@ TEST(Buffer, buffer_builder) {
     ASSERT_EQ(builder.extract().as_slice(), str);
   }
 }
+
+TEST(Buffer, size_class_reuse) {
+  auto get_stats = [](size_t size) {
+    for (auto &stats : td::BufferAllocator::get_size_class_stats()) {
+      if (stats.max_size >= size) {
+        return stats;
+      }
+    }
+    return td::BufferAllocator::get_size_class_stats().back();
+  };
+
+  auto start_mem = td::BufferAllocator::get_buffer_mem();
+  auto start_stats = get_stats(5000);
+  {
+    td::BufferWriter writer(5000);
+    ASSERT_TRUE(writer.prepare_append().size() >= 5000u);
+    auto stats = get_stats(5000);
+    ASSERT_EQ(start_stats.live_count + 1, stats.live_count);
+    ASSERT_TRUE(stats.peak_live_count >= stats.live_count);
+    ASSERT_EQ(start_stats.allocation_count + 1, stats.allocation_count);
+  }
+  ASSERT_EQ(start_mem, td::BufferAllocator::get_buffer_mem());
+  {
+    td::BufferWriter writer(4500);
+    auto stats = get_stats(4500);
+    ASSERT_EQ(start_stats.live_count + 1, stats.live_count);
+    ASSERT_EQ(start_stats.reuse_count + 1, stats.reuse_count);
+  }
+  ASSERT_EQ(start_stats.live_count, get_stats(5000).live_count);
+
+  auto big_stats = td::BufferAllocator::get_size_class_stats().back();
+  ASSERT_EQ(0u, big_stats.max_size);
+  {
+    td::BufferWriter writer(10 << 20);
+    ASSERT_EQ(big_stats.live_count + 1, td::BufferAllocator::get_size_class_stats().back().live_count);
+  }
+  ASSERT_EQ(big_stats.live_count, td::BufferAllocator::get_size_class_stats().back().live_count);
+  ASSERT_EQ(big_stats.reuse_count, td::BufferAllocator::get_size_class_stats().back().reuse_count);
+  ASSERT_EQ(start_mem, td::BufferAllocator::get_buffer_mem());
+}
@@ -15,6 +15,12 @@
 #include "td/utils/UInt.h"
 
 #include <limits>
+#include <set>
+
+#if TD_PORT_POSIX
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
 
 static td::vector<td::string> strings{"", "1", "short test string", td::string(1000000, 'a')};
 
@@ -103,6 +109,31 @@ TEST(Crypto, AesCtrState) {
   }
 }
 
+TEST(Crypto, AesCtrStateChunks) {
+  td::UInt256 key;
+  td::Random::secure_bytes(as_slice(key));
+  td::UInt128 iv;
+  td::Random::secure_bytes(as_slice(iv));
+  auto s = td::rand_string(std::numeric_limits<char>::min(), std::numeric_limits<char>::max(), 100000);
+
+  td::AesCtrState state;
+  state.init(as_slice(key), as_slice(iv));
+  td::string baseline(s.size(), '\0');
+  state.encrypt(s, baseline);
+
+  for (int max_chunk_size : {1, 7, 16, 255, 256, 257, 511, 512, 513, 2000}) {
+    state.init(as_slice(key), as_slice(iv));
+    td::string t = s;
+    std::size_t pos = 0;
+    while (pos < t.size()) {
+      auto len = td::min(static_cast<std::size_t>(td::Random::fast(1, max_chunk_size)), t.size() - pos);
+      state.encrypt(td::Slice(t).substr(pos, len), td::MutableSlice(t).substr(pos, len));
+      pos += len;
+    }
+    ASSERT_STREQ(td::base64_encode(baseline), td::base64_encode(t));
+  }
+}
+
 TEST(Crypto, AesIgeState) {
   td::vector<td::uint32> answers1{0u, 2045698207u, 2423540300u, 525522475u, 1545267325u, 724143417u};
 
@@ -270,6 +301,63 @@ TEST(Crypto, PBKDF) {
   }
 }
 
+TEST(Crypto, secure_bytes) {
+  std::set<td::uint64> values;
+  for (int i = 0; i < 100000; i++) {
+    if (i % 1000 == 0) {
+      td::Random::secure_cleanup();
+    }
+    if (i % 7 == 0) {
+      td::string buf(td::Random::fast(1, 2000), '\0');
+      td::Random::secure_bytes(buf);
+    }
+    ASSERT_TRUE(values.insert(td::Random::secure_uint64()).second);
+  }
+
+#if TD_PORT_POSIX
+  // buffered bytes must not be shared with a child process
+  td::Random::secure_uint64();
+  int fds[2];
+  ASSERT_EQ(0, pipe(fds));
+  auto pid = fork();
+  ASSERT_TRUE(pid >= 0);
+  if (pid == 0) {
+    auto value = td::Random::secure_uint64();
+    auto written = write(fds[1], &value, sizeof(value));
+    _exit(written == sizeof(value) ? 0 : 1);
+  }
+  td::uint64 child_value = 0;
+  ASSERT_EQ(static_cast<ssize_t>(sizeof(child_value)), read(fds[0], &child_value, sizeof(child_value)));
+  int status = 0;
+  ASSERT_EQ(pid, waitpid(pid, &status, 0));
+  close(fds[0]);
+  close(fds[1]);
+  ASSERT_TRUE(child_value != td::Random::secure_uint64());
+#endif
+}
+
+TEST(Crypto, pbkdf2_sha512) {
+  td::vector<td::Slice> answers{
+      "ESC+Uacnkj83z/4FOFPyYXNAGBhHMy6oHeaIYvpe1C4sECvMU0zOcvb43MQP5khORKoRFmsipCE92snlId2qkg==",
+      "bwxLl4XCr7xYlReA8Fc4Ld0vVYfW94BYPSBXYeZgLV5+vXAZF11gUV/4BegDCfhZdm2sBq3RYM4j1Y/epKud2Q==",
+      "ZG4ucVz+bHo44NQq5wbLn2phrOyyJt5/UG3eo3UoBd3/HEpwSbUJ2lDzOcGHmxeLDBFsDouA9DM7umfBBkH9yw==",
+      "5DAvlMPkO/mt4vC0yK8k/XyEQ6rZqj+IhgQkScQJi1WPyfwOlF75GFo6tx41SB8N5hx3+s7c4ILXS2MFezCCBA==",
+      "q3RCFxj92lYAlqExUWug4BW6w1i9wj3/vD6Nlv9Di5uk1ZBrHyloK+sTDNbN9o5NUgClJ3acwPaxEbQ3UVCArw==",
+      "1bqEp+/W72/2oVSiDYKegelRfSrW96db7dkdEk0y5uHpafpT6sSwIy17s/Z2OB7IS1y3oNzemu7zkfhGj+zwDQ==",
+      "MkrSYBg9DGbo/pDLmFM5sk4X01salY5Nh89KRkga7C3f8YA2maZit+/1hiAs83F+jiviAjNzf7jHfsCsiz+lhQ==",
+      "MB/cMvWZDElN6DfmxB9IHF317Xr+mTHevoRC6OUWctunGK24vScjFO8OR5YYWx60cjwu3/tFvtMB3/4/YKJ6Lg=="};
+
+  std::size_t pos = 0;
+  for (auto &password : strings) {
+    for (auto iteration_count : {1, 1000}) {
+      td::string output(64, '\0');
+      td::pbkdf2_sha512(password, "cucumber", iteration_count, output);
+      ASSERT_STREQ(answers[pos], td::base64_encode(output));
+      pos++;
+    }
+  }
+}
+
 TEST(Crypto, sha1) {
   td::vector<td::Slice> answers{"2jmj7l5rSw0yVb/vlWAYkK/YBwk=", "NWoZK3kTsExUV00Ywo1G5jlUKKs=",
                                 "uRysQwoax0pNJeBC3+zpQzJy1rA=", "NKqXPNTE2qT2Husr260nMWU0AW8="};
@@ -412,6 +500,27 @@ TEST(Crypto, crc64) {
   }
 }
 
+TEST(Crypto, crc64_long) {
+  auto slow_crc64 = [](td::Slice data) {
+    td::uint64 crc = static_cast<td::uint64>(-1);
+    for (auto c : data) {
+      crc ^= static_cast<unsigned char>(c);
+      for (int i = 0; i < 8; i++) {
+        crc = (crc >> 1) ^ ((crc & 1) != 0 ? 0xc96c5795d7870f42ull : 0);
+      }
+    }
+    return crc ^ static_cast<td::uint64>(-1);
+  };
+
+  auto str = td::rand_string(0, 255, 5000);
+  for (std::size_t offset = 0; offset < 16; offset++) {
+    for (std::size_t size = 0; offset + size <= str.size(); size += td::Random::fast(1, 100)) {
+      auto data = td::Slice(str).substr(offset, size);
+      ASSERT_EQ(slow_crc64(data), td::crc64(data));
+    }
+  }
+}
+
 TEST(Crypto, crc16) {
   td::vector<td::uint16> answers{0, 9842, 25046, 37023};
 
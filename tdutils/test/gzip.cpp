@@ -8,6 +8,7 @@
 #include "td/utils/buffer.h"
 #include "td/utils/ByteFlow.h"
 #include "td/utils/common.h"
+#include "td/utils/crypto.h"
 #include "td/utils/Gzip.h"
 #include "td/utils/GzipByteFlow.h"
 #include "td/utils/logging.h"
@@ -45,6 +46,67 @@ TEST(Gzip, gzencode) {
   }
 }
 
+TEST(Gzip, GzipCompressor) {
+  td::GzipCompressor compressor;
+  for (int i = 0; i < 100; i++) {
+    auto str = i % 3 == 0 ? td::rand_string(0, 255, i * 100 + 100) : td::rand_string('a', 'c', i * 1000 + 1);
+    for (td::int32 level : {1, 6, 9}) {
+      auto r = compressor.compress(str, 2, level);
+      ASSERT_TRUE(!r.empty());
+      ASSERT_EQ(str, td::gzdecode(r.as_slice()));
+      if (level == 6) {
+        ASSERT_EQ(td::gzencode(str, 2).as_slice(), r.as_slice());
+      }
+      if (i % 3 == 0) {
+        ASSERT_TRUE(compressor.compress(str, 0.9, level).empty());
+      }
+    }
+  }
+}
+
+static td::string make_gzip_stored(const td::string &s) {
+  // gzip header, a single stored deflate block, CRC32 and size of the original data
+  CHECK(s.size() < 65536);
+  td::string result("\x1f\x8b\x08\x00\x00\x00\x00\x00\x00\xff\x01", 11);
+  auto append_int = [&result](td::uint32 value, int size) {
+    for (int i = 0; i < size; i++) {
+      result += static_cast<char>((value >> (8 * i)) & 255);
+    }
+  };
+  auto size = static_cast<td::uint32>(s.size());
+  append_int(size, 2);
+  append_int(size ^ 0xFFFF, 2);
+  result += s;
+  append_int(td::crc32(s), 4);
+  append_int(size, 4);
+  return result;
+}
+
+TEST(Gzip, GzipDecompressor) {
+  td::GzipDecompressor decompressor;
+  for (int i = 0; i < 100; i++) {
+    auto str = i % 3 == 0 ? td::rand_string(0, 255, i * 100 + 100) : td::rand_string('a', 'c', i * 500 + 1);
+    ASSERT_EQ(str, decompressor.decompress(td::gzencode(str, 2).as_slice()));
+    auto gzip_str = make_gzip_stored(str);
+    ASSERT_EQ(str, decompressor.decompress(gzip_str));
+    ASSERT_EQ(str, td::gzdecode(gzip_str));
+
+    gzip_str.pop_back();
+    ASSERT_TRUE(decompressor.decompress(gzip_str).empty());
+    gzip_str[10] = '\x07';
+    ASSERT_TRUE(decompressor.decompress(gzip_str).empty());
+  }
+
+  // the size stored in gzip trailer is only a hint
+  auto str = td::rand_string('a', 'z', 10000);
+  auto gzip_str = make_gzip_stored(str);
+  for (int i = 1; i <= 4; i++) {
+    gzip_str[gzip_str.size() - i] = '\x01';
+    ASSERT_TRUE(decompressor.decompress(gzip_str).empty());
+  }
+  ASSERT_EQ(str, decompressor.decompress(make_gzip_stored(str)));
+}
+
 TEST(Gzip, flow) {
   auto str = td::rand_string('a', 'z', 1000000);
   auto parts = td::rand_split(str);
@@ -6,9 +6,11 @@
 //
 #include "td/utils/JsonBuilder.h"
 #include "td/utils/logging.h"
+#include "td/utils/Random.h"
 #include "td/utils/Slice.h"
 #include "td/utils/StringBuilder.h"
 #include "td/utils/tests.h"
+#include "td/utils/utf8.h"
 
 #include <utility>
 
@@ -68,6 +70,46 @@ TEST(JSON, nested) {
   decode_encode(encoded);
 }
 
+TEST(JSON, string_escape) {
+  td::Random::Xorshift128plus rnd(123);
+  for (int i = 0; i < 10000; i++) {
+    td::string str;
+    auto length = rnd.fast(0, 100);
+    for (int j = 0; j < length; j++) {
+      switch (rnd.fast(0, 9)) {
+        case 0:
+          str += static_cast<char>(rnd.fast(1, 31));
+          break;
+        case 1:
+          str += rnd.fast(0, 1) == 0 ? '"' : '\\';
+          break;
+        case 2:
+          td::append_utf8_character(str, rnd.fast(0x80, 0xD7FF));
+          break;
+        case 3:
+          td::append_utf8_character(str, rnd.fast(0x10000, 0x10FFFF));
+          break;
+        default:
+          str += static_cast<char>(rnd.fast(32, 127));
+          break;
+      }
+    }
+
+    for (auto is_raw : {false, true}) {
+      td::string encoded = is_raw ? PSTRING() << td::JsonRawString(str) : PSTRING() << td::JsonString(str);
+      if (!is_raw) {
+        for (auto c : encoded) {
+          ASSERT_TRUE(0x20 <= static_cast<unsigned char>(c) && static_cast<unsigned char>(c) < 0x80);
+        }
+      }
+      auto r_value = td::json_decode(encoded);
+      ASSERT_TRUE(r_value.is_ok());
+      ASSERT_TRUE(r_value.ok().type() == td::JsonValue::Type::String);
+      ASSERT_STREQ(str, r_value.ok().get_string());
+    }
+  }
+}
+
 TEST(JSON, kphp) {
   decode_encode("[]");
   decode_encode("[[]]");
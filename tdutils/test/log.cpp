@@ -4,12 +4,15 @@
 // Distributed under the Boost Software License, Version 1.0. (See accompanying
 // file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 //
+#include "td/utils/AsyncFileLog.h"
 #include "td/utils/benchmark.h"
 #include "td/utils/CombinedLog.h"
 #include "td/utils/FileLog.h"
+#include "td/utils/filesystem.h"
 #include "td/utils/format.h"
 #include "td/utils/logging.h"
 #include "td/utils/MemoryLog.h"
+#include "td/utils/misc.h"
 #include "td/utils/NullLog.h"
 #include "td/utils/port/path.h"
 #include "td/utils/port/thread.h"
@@ -24,6 +27,65 @@
 
 char disable_linker_warning_about_empty_file_tdutils_test_log_cpp TD_UNUSED;
 
+class StringLog final : public td::LogInterface {
+ public:
+  void do_append(int log_level, td::CSlice slice) final {
+    result_.append(slice.begin(), slice.size());
+  }
+
+  td::string result_;
+};
+
+// removes the timestamp, which is the third part of the header
+static td::string remove_log_timestamps(td::Slice log) {
+  td::string result;
+  for (auto line : td::full_split(log, '\n')) {
+    size_t pos = 0;
+    for (int i = 0; i < 2; i++) {
+      pos = line.substr(pos).find(']') + pos + 1;
+    }
+    auto timestamp_end = line.substr(pos).find(']') + pos + 1;
+    result += line.substr(0, pos).str() + line.substr(timestamp_end).str() + '\n';
+  }
+  return result;
+}
+
+TEST(Log, BinaryFormat) {
+  StringLog text_log;
+  StringLog binary_log;
+  td::LogOptions text_options;
+  td::LogOptions binary_options;
+  binary_options.binary_format = true;
+
+  auto log_all = [](td::LogInterface &log, const td::LogOptions &options) {
+    td::string str = "string";
+    LOG_IMPL_FULL(log, options, DEBUG, VERBOSITY_NAME(INFO), true, td::Slice())
+        << "Text " << 'c' << true << -123 << static_cast<td::uint64>(123456789012345) << ' ' << 1.5 << ' ' << str
+        << td::tag("tag", 1) << td::format::as_hex(255u) << td::CSlice("\x00\xBB");
+    LOG_IMPL_FULL(log, options, DEBUG, VERBOSITY_NAME(WARNING), true, td::Slice()) << "Warning is stored as text";
+    LOG_IMPL_FULL(log, options, DEBUG, VERBOSITY_NAME(DEBUG), 1 + 1 == 2, "1 + 1 == 2") << "Multiline\ntext\n\n";
+    LOG_IMPL_FULL(log, options, DEBUG, VERBOSITY_NAME(DEBUG), true, td::Slice()) << "";
+  };
+  log_all(text_log, text_options);
+  log_all(binary_log, binary_options);
+
+  ASSERT_TRUE(binary_log.result_ != text_log.result_);
+  ASSERT_TRUE(binary_log.result_.find("Warning is stored as text") != td::string::npos);
+  ASSERT_EQ(remove_log_timestamps(text_log.result_), remove_log_timestamps(td::render_binary_log(binary_log.result_)));
+}
+
+TEST(Log, IsOn) {
+  auto old_verbosity_level = GET_VERBOSITY_LEVEL();
+  SET_VERBOSITY_LEVEL(VERBOSITY_NAME(WARNING));
+  ASSERT_TRUE(LOG_IS_ON(ERROR));
+  ASSERT_TRUE(LOG_IS_ON(WARNING));
+  ASSERT_TRUE(!LOG_IS_ON(INFO));
+  SET_VERBOSITY_LEVEL(VERBOSITY_NAME(DEBUG));
+  ASSERT_TRUE(LOG_IS_ON(INFO));
+  ASSERT_EQ(!TD_STRIP_DEBUG_LOG, LOG_IS_ON(DEBUG));
+  SET_VERBOSITY_LEVEL(old_verbosity_level);
+}
+
 #if !TD_THREAD_UNSUPPORTED
 template <class Log>
 class LogBenchmark final : public td::Benchmark {
@@ -112,6 +174,10 @@ TEST(Log, Bench) {
     return result;
   });
 
+  bench_log("AsyncFileLog", [] {
+    return td::AsyncFileLog::create("tmplog", std::numeric_limits<td::int64>::max(), false).move_as_ok();
+  });
+
   bench_log("TsFileLog",
             [] { return td::TsFileLog::create("tmplog", std::numeric_limits<td::int64>::max(), false).move_as_ok(); });
 
@@ -155,4 +221,43 @@ TEST(Log, Bench) {
     return td::make_unique<FileLog>();
   });
 }
+
+TEST(Log, AsyncFileLog) {
+  td::string path = "tmp_async_log";
+  {
+    auto log = td::AsyncFileLog::create(path, std::numeric_limits<td::int64>::max(), false).move_as_ok();
+    td::vector<td::thread> threads(4);
+    for (size_t i = 0; i < threads.size(); i++) {
+      threads[i] = td::thread([&log, i] {
+        for (int j = 0; j < 1000; j++) {
+          log->append(VERBOSITY_NAME(PLAIN), PSLICE() << i << ' ' << j << '\n');
+        }
+      });
+    }
+    for (auto &thread : threads) {
+      thread.join();
+    }
+  }
+  auto lines = td::full_split(td::read_file_str(path).move_as_ok(), '\n');
+  ASSERT_EQ(4001u, lines.size());
+  td::vector<int> next_message(4);
+  for (size_t i = 0; i + 1 < lines.size(); i++) {
+    auto parts = td::split(lines[i]);
+    auto thread_id = td::to_integer<size_t>(parts.first);
+    ASSERT_TRUE(thread_id < next_message.size());
+    ASSERT_EQ(next_message[thread_id], td::to_integer<int>(parts.second));
+    next_message[thread_id]++;
+  }
+  td::unlink(path).ensure();
+
+  {
+    auto log = td::AsyncFileLog::create(path, std::numeric_limits<td::int64>::max(), false, 64).move_as_ok();
+    for (int i = 0; i < 1000; i++) {
+      log->append(VERBOSITY_NAME(PLAIN), "too many messages\n");
+    }
+  }
+  auto log_str = td::read_file_str(path).move_as_ok();
+  ASSERT_TRUE(log_str.find("[AsyncFileLog dropped ") != td::string::npos);
+  td::unlink(path).ensure();
+}
 #endif
@@ -13,6 +13,7 @@
 #include "td/utils/common.h"
 #include "td/utils/emoji.h"
 #include "td/utils/ExitGuard.h"
+#include "td/utils/FloodControlStrict.h"
 #include "td/utils/Hash.h"
 #include "td/utils/HashMap.h"
 #include "td/utils/HashSet.h"
@@ -31,11 +32,14 @@
 #include "td/utils/Random.h"
 #include "td/utils/Slice.h"
 #include "td/utils/SliceBuilder.h"
+#include "td/utils/SmallObjectAllocator.h"
 #include "td/utils/Status.h"
 #include "td/utils/StringBuilder.h"
 #include "td/utils/tests.h"
 #include "td/utils/Time.h"
 #include "td/utils/tl_helpers.h"
+#include "td/utils/tl_parsers.h"
+#include "td/utils/tl_storers.h"
 #include "td/utils/translit.h"
 #include "td/utils/uint128.h"
 #include "td/utils/unicode.h"
@@ -43,6 +47,7 @@
 
 #include <algorithm>
 #include <atomic>
+#include <cstring>
 #include <limits>
 #include <locale>
 #include <unordered_map>
@@ -160,6 +165,41 @@ TEST(Misc, errno_tls_bug) {
 #endif
 }
 
+TEST(Misc, FloodControlStrict) {
+  for (int test = 0; test < 100; test++) {
+    td::vector<std::pair<td::int32, std::size_t>> limits;
+    td::FloodControlStrict flood_control;
+    for (int i = td::Random::fast(1, 3); i > 0; i--) {
+      limits.emplace_back(td::Random::fast(1, 20), static_cast<std::size_t>(td::Random::fast(1, 10)));
+      flood_control.add_limit(limits.back().first, limits.back().second);
+    }
+
+    td::vector<td::int32> events;
+    td::int32 wakeup_at = 1;
+    td::int32 now = 1;
+    for (int i = 0; i < 1000; i++) {
+      now += td::Random::fast(0, 3);
+      if (td::Random::fast(0, 500) == 0) {
+        events.clear();
+        wakeup_at = 1;
+        flood_control.clear_events();
+      }
+      events.push_back(now);
+      flood_control.add_event(now);
+
+      for (auto &limit : limits) {
+        if (events.size() >= limit.second) {
+          auto limit_wakeup_at = events[events.size() - limit.second] + limit.first;
+          if (limit_wakeup_at >= now) {
+            wakeup_at = td::max(wakeup_at, limit_wakeup_at);
+          }
+        }
+      }
+      ASSERT_EQ(wakeup_at, flood_control.get_wakeup_at());
+    }
+  }
+}
+
 TEST(Misc, get_last_argument) {
   auto a = td::make_unique<int>(5);
   ASSERT_EQ(*td::get_last_argument(std::move(a)), 5);
@@ -262,6 +302,27 @@ TEST(Misc, base64) {
   ASSERT_TRUE(td::base64url_encode("ab><cd") == "YWI-PGNk");
 }
 
+TEST(Misc, base64_wrong_characters) {
+  for (int l = 0; l < 200; l++) {
+    for (int t = 0; t < 20; t++) {
+      auto s = td::rand_string(std::numeric_limits<char>::min(), std::numeric_limits<char>::max(), l);
+      for (auto is_url : {false, true}) {
+        auto encoded = is_url ? td::base64url_encode(s) : td::base64_encode(s);
+        if (encoded.empty()) {
+          continue;
+        }
+        encoded[td::Random::fast(0, static_cast<int>(encoded.size()) - 1)] =
+            static_cast<char>(td::Random::fast(std::numeric_limits<char>::min(), std::numeric_limits<char>::max()));
+        auto decoded = is_url ? td::base64url_decode(encoded) : td::base64_decode(encoded);
+        ASSERT_EQ(is_url ? td::is_base64url(encoded) : td::is_base64(encoded), decoded.is_ok());
+        if (decoded.is_ok()) {
+          ASSERT_STREQ(encoded, is_url ? td::base64url_encode(decoded.ok()) : td::base64_encode(decoded.ok()));
+        }
+      }
+    }
+  }
+}
+
 template <class T>
 static void test_remove_if(td::vector<int> v, const T &func, const td::vector<int> &expected) {
   td::remove_if(v, func);
@@ -484,6 +545,53 @@ TEST(Misc, to_double) {
   test_to_double();
 }
 
+TEST(Misc, SmallObjectAllocator) {
+  td::vector<std::pair<void *, size_t>> blocks;
+  for (size_t size = 1; size <= 1000; size++) {
+    auto *ptr = td::SmallObjectAllocator::allocate(size);
+    std::memset(ptr, 0, size);
+    blocks.emplace_back(ptr, size);
+  }
+  for (auto &block : blocks) {
+    td::SmallObjectAllocator::deallocate(block.first, block.second);
+  }
+  auto cached_block_count = td::SmallObjectAllocator::get_cached_block_count();
+  ASSERT_TRUE(cached_block_count >= td::SmallObjectAllocator::MAX_SIZE);
+
+  // blocks are reused for objects of the same size class
+  auto *ptr = td::SmallObjectAllocator::allocate(100);
+  ASSERT_EQ(cached_block_count - 1, td::SmallObjectAllocator::get_cached_block_count());
+  td::SmallObjectAllocator::deallocate(ptr, 100);
+  ASSERT_EQ(cached_block_count, td::SmallObjectAllocator::get_cached_block_count());
+  td::SmallObjectAllocator::deallocate(nullptr, 100);
+}
+
+#if !TD_THREAD_UNSUPPORTED
+TEST(Misc, SmallObjectAllocator_other_thread) {
+  td::vector<void *> blocks;
+  for (int i = 0; i < 100; i++) {
+    blocks.push_back(td::SmallObjectAllocator::allocate(40));
+  }
+  auto shared_block_count = td::SmallObjectAllocator::get_shared_block_count();
+
+  // blocks freed in a thread without own cache are returned to shared lists
+  td::thread thread([&blocks] {
+    for (auto *ptr : blocks) {
+      td::SmallObjectAllocator::deallocate(ptr, 40);
+    }
+  });
+  thread.join();
+  ASSERT_EQ(shared_block_count + blocks.size(), td::SmallObjectAllocator::get_shared_block_count());
+
+  // and are reused by the allocating thread
+  auto cached_block_count = td::SmallObjectAllocator::get_cached_block_count();
+  auto *ptr = td::SmallObjectAllocator::allocate(40);
+  ASSERT_TRUE(td::SmallObjectAllocator::get_shared_block_count() < shared_block_count + blocks.size());
+  ASSERT_TRUE(td::SmallObjectAllocator::get_cached_block_count() >= cached_block_count + blocks.size() - 1);
+  td::SmallObjectAllocator::deallocate(ptr, 40);
+}
+#endif
+
 TEST(Misc, print_int) {
   ASSERT_STREQ("-9223372036854775808", PSLICE() << -9223372036854775807 - 1);
   ASSERT_STREQ("-2147483649", PSLICE() << -2147483649ll);
@@ -510,6 +618,43 @@ TEST(Misc, print_uint) {
   ASSERT_STREQ("2147483648", PSLICE() << 2147483648u);
   ASSERT_STREQ("2147483649", PSLICE() << 2147483649u);
   ASSERT_STREQ("9223372036854775807", PSLICE() << 9223372036854775807u);
+  ASSERT_STREQ("18446744073709551615", PSLICE() << 18446744073709551615u);
+
+  td::Random::Xorshift128plus rnd(123);
+  for (int i = 0; i < 100000; i++) {
+    auto x = rnd() >> rnd.fast(0, 63);
+    ASSERT_STREQ(std::to_string(x), PSLICE() << x);
+    ASSERT_STREQ(std::to_string(static_cast<td::int64>(x)), PSLICE() << static_cast<td::int64>(x));
+  }
+}
+
+TEST(Misc, IntegerString) {
+  ASSERT_STREQ("0", td::IntegerString::from_int(0).as_slice());
+  ASSERT_STREQ("-9223372036854775808", td::IntegerString::from_int(-9223372036854775807 - 1).as_slice());
+  ASSERT_STREQ("18446744073709551615", td::IntegerString::from_uint(18446744073709551615u).as_slice());
+  ASSERT_STREQ("0", td::IntegerString::from_uint_hex(0).as_slice());
+  ASSERT_STREQ("ffffffffffffffff", td::IntegerString::from_uint_hex(18446744073709551615u).as_slice());
+  ASSERT_STREQ("12ab", PSLICE() << td::IntegerString::from_uint_hex(0x12ab));
+}
+
+TEST(Misc, StringBuilder_buffer_reuse) {
+  for (size_t size : {10, 1000, 5000, 100000}) {
+    for (int i = 0; i < 3; i++) {
+      td::StringBuilder sb;
+      td::string expected;
+      while (expected.size() < size) {
+        sb << expected.size() << ' ';
+        expected += td::to_string(expected.size()) + ' ';
+      }
+      ASSERT_STREQ(expected, sb.as_cslice());
+      auto moved_sb = std::move(sb);
+      ASSERT_STREQ(expected, moved_sb.as_cslice());
+    }
+  }
+  td::string str(10000, 'a');
+  for (int i = 0; i < 10; i++) {
+    ASSERT_EQ(str.size() + 1, (PSLICE() << str << i).size());
+  }
 }
 
 static void test_idn_to_ascii_one(const td::string &host, const td::string &result) {
@@ -585,6 +730,108 @@ TEST(Misc, to_wstring) {
 }
 #endif
 
+TEST(Misc, utf8) {
+  td::Random::Xorshift128plus rnd(123);
+  auto gen_character = [&](td::string &str) {
+    switch (rnd.fast(0, 4)) {
+      case 0:
+        // any byte
+        str += static_cast<char>(rnd.fast(0, 255));
+        break;
+      case 1:
+        td::append_utf8_character(str, rnd.fast(0x80, 0x7FF));
+        break;
+      case 2:
+        td::append_utf8_character(str, rnd.fast(0x800, 0xFFFF));
+        break;
+      case 3:
+        td::append_utf8_character(str, rnd.fast(0x10000, 0x10FFFF));
+        break;
+      default:
+        str += static_cast<char>(rnd.fast(0, 127));
+        break;
+    }
+  };
+  for (int i = 0; i < 10000; i++) {
+    td::string str;
+    auto length = rnd.fast(0, 200);
+    bool is_ascii = rnd.fast(0, 3) == 0;
+    for (int j = 0; j < length; j++) {
+      if (is_ascii && rnd.fast(0, 100) != 0) {
+        str += static_cast<char>(rnd.fast(1, 127));
+      } else {
+        gen_character(str);
+      }
+    }
+    ASSERT_EQ(td::check_utf8_scalar(str), td::check_utf8(str));
+    ASSERT_EQ(td::utf8_length_scalar(str), td::utf8_length(str));
+    ASSERT_EQ(td::utf8_utf16_length_scalar(str), td::utf8_utf16_length(str));
+  }
+
+  td::string str(100000, 'a');
+  ASSERT_TRUE(td::check_utf8(str));
+  str[99999] = '\xC0';
+  ASSERT_TRUE(!td::check_utf8(str));
+  str.clear();
+  for (int i = 0; i < 20000; i++) {
+    td::append_utf8_character(str, 0x1F600);
+  }
+  ASSERT_TRUE(td::check_utf8(str));
+  ASSERT_EQ(20000u, td::utf8_length(str));
+  ASSERT_EQ(40000u, td::utf8_utf16_length(str));
+}
+
+TEST(Misc, TlBufferParser_fetch_string) {
+  td::vector<std::pair<td::string, td::string>> tests{{"", ""},
+                                                      {"abc", "abc"},
+                                                      {td::string("a\0b\0", 4), "a b "},
+                                                      {"\xd0\xb0\xd0\xb1\xd0\xb2", "\xd0\xb0\xd0\xb1\xd0\xb2"},
+                                                      {"abc\xd0", "abc"},
+                                                      {td::string(1000, 'a') + "\xff", td::string(1000, 'a')}};
+  td::TlStorerCalcLength calc_length;
+  for (auto &test : tests) {
+    calc_length.store_string(test.first);
+  }
+  td::BufferSlice buffer(calc_length.get_length());
+  td::TlStorerUnsafe storer(buffer.as_slice().ubegin());
+  for (auto &test : tests) {
+    storer.store_string(test.first);
+  }
+
+  td::TlBufferParser parser(&buffer);
+  for (auto &test : tests) {
+    ASSERT_EQ(test.second, parser.fetch_string<td::string>());
+  }
+  parser.fetch_end();
+  ASSERT_TRUE(parser.get_error() == nullptr);
+}
+
+TEST(Misc, TlParser_fetch_binary_array) {
+  td::vector<td::int64> values{0, 1, -1, 1234567890123456789, std::numeric_limits<td::int64>::min()};
+  td::TlStorerCalcLength calc_length;
+  calc_length.store_binary_array(values.data(), values.size());
+  calc_length.store_binary_array(values.data(), 0);
+  ASSERT_EQ(values.size() * sizeof(td::int64), calc_length.get_length());
+
+  td::string buffer(calc_length.get_length(), '\0');
+  td::TlStorerUnsafe storer(td::MutableSlice(buffer).ubegin());
+  storer.store_binary_array(values.data(), values.size());
+  storer.store_binary_array(values.data(), 0);
+
+  td::TlParser parser(buffer);
+  td::vector<td::int64> fetched_values(values.size() - 1);
+  parser.fetch_binary_array(fetched_values.data(), fetched_values.size());
+  ASSERT_EQ(td::vector<td::int64>(values.begin(), values.end() - 1), fetched_values);
+  ASSERT_EQ(values.back(), parser.fetch_long());
+  parser.fetch_binary_array(fetched_values.data(), 0);
+  parser.fetch_end();
+  ASSERT_TRUE(parser.get_error() == nullptr);
+
+  td::TlParser short_parser(td::Slice(buffer).remove_suffix(1));
+  short_parser.fetch_binary_array(fetched_values.data(), values.size());
+  ASSERT_TRUE(short_parser.get_error() != nullptr);
+}
+
 static void test_translit(const td::string &word, const td::vector<td::string> &result, bool allow_partial = true) {
   ASSERT_EQ(result, td::get_word_transliterations(word, allow_partial));
 }
@@ -621,6 +868,19 @@ TEST(Misc, unicode) {
   test_unicode(td::prepare_search_character);
   test_unicode(td::unicode_to_lower);
   test_unicode(td::remove_diacritics);
+
+  ASSERT_EQ(0x436u, td::unicode_to_lower(0x416));
+  ASSERT_EQ(0x10428u, td::unicode_to_lower(0x10400));
+  ASSERT_EQ(0x10FFFFu, td::unicode_to_lower(0x10FFFF));
+  ASSERT_EQ(0u, td::unicode_to_lower(0x110000));
+  ASSERT_EQ(0x3B1u, td::prepare_search_character(0x391));
+  ASSERT_EQ(0x435u, td::remove_diacritics(0x451));
+
+  ASSERT_STREQ("", td::utf8_to_lower(""));
+  ASSERT_STREQ("hello, world! привет, мир! ἀθῆναι", td::utf8_to_lower("HeLLo, World! Привет, Мир! ἈΘῆΝΑΙ"));
+  td::string long_ascii(1000, 'A');
+  long_ascii += "Ё";
+  ASSERT_STREQ(td::string(1000, 'a') + "ё", td::utf8_to_lower(long_ascii));
 }
 
 TEST(BigNum, from_decimal) {
@@ -971,6 +1231,32 @@ TEST(Misc, Time) {
 }
 #endif
 
+TEST(Misc, cached_time) {
+  auto now = td::Time::now();
+  ASSERT_TRUE(now <= td::Time::now_cached());
+  {
+    td::Time::CachedNowGuard guard;
+    auto cached_now = td::Time::now_cached();
+    ASSERT_TRUE(now <= cached_now);
+    td::usleep_for(1000);
+    ASSERT_EQ(cached_now, td::Time::now_cached());
+    ASSERT_TRUE(cached_now < td::Time::now());
+
+    td::Time::update_cached_now();
+    ASSERT_TRUE(cached_now < td::Time::now_cached());
+    cached_now = td::Time::now_cached();
+    {
+      td::Time::CachedNowGuard nested_guard;
+      ASSERT_TRUE(cached_now <= td::Time::now_cached());
+      cached_now = td::Time::now_cached();
+    }
+    ASSERT_TRUE(cached_now <= td::Time::now_cached());
+    now = td::Time::now_cached();
+  }
+  td::usleep_for(1000);
+  ASSERT_TRUE(now < td::Time::now_cached());
+}
+
 TEST(Misc, uint128) {
   td::vector<td::uint64> parts = {0,
                                   1,
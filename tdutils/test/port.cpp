@@ -11,20 +11,28 @@
 #include "td/utils/port/EventFd.h"
 #include "td/utils/port/FileFd.h"
 #include "td/utils/port/IoSlice.h"
+#include "td/utils/port/IPAddress.h"
 #include "td/utils/port/path.h"
+#include "td/utils/port/Poll.h"
+#include "td/utils/port/PollFlags.h"
 #include "td/utils/port/signals.h"
 #include "td/utils/port/sleep.h"
+#include "td/utils/port/Stat.h"
 #include "td/utils/port/thread.h"
 #include "td/utils/port/thread_local.h"
+#include "td/utils/port/UdpSocketFd.h"
 #include "td/utils/Random.h"
 #include "td/utils/ScopeGuard.h"
 #include "td/utils/Slice.h"
 #include "td/utils/SliceBuilder.h"
+#include "td/utils/Span.h"
+#include "td/utils/Status.h"
 #include "td/utils/tests.h"
 #include "td/utils/Time.h"
 
 #if TD_PORT_POSIX && !TD_THREAD_UNSUPPORTED
 #include <algorithm>
+#include <array>
 #include <atomic>
 #include <mutex>
 
@@ -122,6 +130,26 @@ TEST(Port, SparseFiles) {
   td::unlink(path).ensure();
 }
 
+TEST(Port, HardLinks) {
+  td::CSlice path = "hard_link.txt";
+  td::CSlice link_path = "hard_link2.txt";
+  td::unlink(path).ignore();
+  td::unlink(link_path).ignore();
+  auto fd = td::FileFd::open(path, td::FileFd::Write | td::FileFd::CreateNew).move_as_ok();
+  fd.write("Hello").ensure();
+  fd.close();
+  ASSERT_EQ(1, td::stat(path).move_as_ok().link_count_);
+
+  td::link(path, link_path).ensure();
+  ASSERT_TRUE(td::link(path, link_path).is_error());
+  ASSERT_EQ(2, td::stat(path).move_as_ok().link_count_);
+  ASSERT_EQ(5, td::stat(link_path).move_as_ok().size_);
+
+  td::unlink(path).ensure();
+  ASSERT_EQ(1, td::stat(link_path).move_as_ok().link_count_);
+  td::unlink(link_path).ensure();
+}
+
 TEST(Port, Writev) {
   td::vector<td::IoSlice> vec;
   td::CSlice test_file_path = "test.txt";
@@ -145,6 +173,124 @@ TEST(Port, Writev) {
   ASSERT_EQ(expected_content, content);
 }
 
+#if TD_PORT_POSIX
+TEST(Port, UdpSocketFdBatches) {
+  auto port = td::Random::fast(20000, 60000);
+  td::IPAddress receiver_address;
+  receiver_address.init_ipv4_port("127.0.0.1", port).ensure();
+  td::IPAddress sender_address;
+  sender_address.init_ipv4_port("127.0.0.1", port + 1).ensure();
+  auto r_receiver = td::UdpSocketFd::open(receiver_address);
+  auto r_sender = td::UdpSocketFd::open(sender_address);
+  if (r_receiver.is_error() || r_sender.is_error()) {
+    LOG(ERROR) << "Can't open UDP sockets";
+    return;
+  }
+  auto receiver = r_receiver.move_as_ok();
+  auto sender = r_sender.move_as_ok();
+
+  // messages of equal size can be sent as segments of one datagram
+  td::vector<td::string> datas;
+  for (int i = 0; i < 100; i++) {
+    datas.push_back(td::rand_string('a', 'z', i % 10 == 9 ? 100 + i : 1000));
+  }
+  datas.push_back(td::rand_string('a', 'z', 1500));
+  datas.push_back(td::rand_string('a', 'z', 1000));
+
+  td::vector<td::UdpSocketFd::OutboundMessage> outbound_messages;
+  for (auto &data : datas) {
+    outbound_messages.push_back(td::UdpSocketFd::OutboundMessage{&receiver_address, data});
+  }
+  size_t sent_count = 0;
+  while (sent_count < outbound_messages.size()) {
+    size_t count = 0;
+    sender
+        .send_messages(td::Span<td::UdpSocketFd::OutboundMessage>(outbound_messages.data() + sent_count,
+                                                                  outbound_messages.size() - sent_count),
+                       count)
+        .ensure();
+    sent_count += count;
+  }
+
+  td::vector<td::string> received_datas;
+  std::array<td::string, 16> buffers;
+  std::array<td::IPAddress, 16> from;
+  std::array<td::Status, 16> errors;
+  std::array<td::UdpSocketFd::InboundMessage, 16> inbound_messages;
+  auto end_time = td::Time::now() + 5.0;
+  while (received_datas.size() < datas.size() && td::Time::now() < end_time) {
+    for (size_t i = 0; i < inbound_messages.size(); i++) {
+      buffers[i].assign(2048, '\0');
+      inbound_messages[i] = td::UdpSocketFd::InboundMessage{&from[i], td::MutableSlice(buffers[i]), &errors[i]};
+    }
+    size_t count = 0;
+    receiver.receive_messages(inbound_messages, count).ensure();
+    for (size_t i = 0; i < count; i++) {
+      ASSERT_TRUE(errors[i].is_ok());
+      ASSERT_EQ(sender_address.get_port(), from[i].get_port());
+      received_datas.push_back(inbound_messages[i].data.str());
+    }
+    if (count == 0) {
+      td::usleep_for(1000);
+    }
+  }
+  ASSERT_TRUE(datas == received_datas);
+}
+#endif
+
+#if TD_PORT_POSIX && !TD_EVENTFD_UNSUPPORTED
+TEST(Port, PollRunPrecise) {
+  td::Poll poll;
+  poll.init();
+  td::vector<td::EventFd> event_fds(10);
+  for (auto &event_fd : event_fds) {
+    event_fd.init();
+    poll.subscribe(event_fd.get_poll_info().extract_pollable_fd(nullptr), td::PollFlags::Read());
+  }
+
+  for (int i = 0; i < 10; i++) {
+    auto start_time = td::Time::now();
+    poll.run_precise(0.0002);
+    ASSERT_TRUE(td::Time::now() - start_time < 0.5);
+  }
+  for (auto &event_fd : event_fds) {
+    ASSERT_TRUE(!event_fd.get_poll_info().get_flags_local().can_read());
+  }
+
+  for (size_t i = 0; i < event_fds.size(); i += 2) {
+    event_fds[i].release();
+  }
+  poll.run_precise(0.1);
+  for (size_t i = 0; i < event_fds.size(); i++) {
+    event_fds[i].get_poll_info().sync_with_poll();
+    ASSERT_EQ(i % 2 == 0, event_fds[i].get_poll_info().get_flags_local().can_read());
+  }
+
+  for (auto &event_fd : event_fds) {
+    poll.unsubscribe(event_fd.get_poll_info().get_pollable_fd_ref());
+    event_fd.close();
+  }
+  poll.clear();
+}
+#endif
+
+TEST(Port, FileAdvise) {
+  td::CSlice test_file_path = "test.txt";
+  td::unlink(test_file_path).ignore();
+  auto fd = td::FileFd::open(test_file_path, td::FileFd::Write | td::FileFd::CreateNew).move_as_ok();
+  ASSERT_EQ(9u, fd.write("abcdefghi").move_as_ok());
+  fd.close();
+  fd = td::FileFd::open(test_file_path, td::FileFd::Read).move_as_ok();
+  fd.advise(td::FileFd::Advice::Sequential, 0, 0).ensure();
+  fd.advise(td::FileFd::Advice::WillNeed, 4, 100).ensure();
+  ASSERT_TRUE(fd.advise(td::FileFd::Advice::WillNeed, -1, 1).is_error());
+  td::string content(5, '\0');
+  ASSERT_EQ(content.size(), fd.pread(content, 4).move_as_ok());
+  ASSERT_EQ("efghi", content);
+  fd.close();
+  td::unlink(test_file_path).ignore();
+}
+
 #if TD_PORT_POSIX && !TD_THREAD_UNSUPPORTED
 
 static std::mutex m;
@@ -260,3 +406,22 @@ TEST(Port, EventFdAndSignals) {
 }
 #endif
 #endif
+
+#if TD_LINUX && !TD_THREAD_UNSUPPORTED
+TEST(Port, ThreadAffinityMask) {
+  auto thread_id = td::this_thread::get_id();
+  auto old_mask = td::thread::get_affinity_mask(thread_id);
+  LOG(INFO) << "Initial thread affinity mask: " << old_mask;
+  if (old_mask == 0) {
+    return;
+  }
+  auto new_mask = old_mask & ~(old_mask - 1);
+  td::thread::set_affinity_mask(thread_id, new_mask).ensure();
+  ASSERT_EQ(new_mask, td::thread::get_affinity_mask(thread_id));
+  td::thread::set_affinity_mask(thread_id, old_mask).ensure();
+  ASSERT_EQ(old_mask, td::thread::get_affinity_mask(thread_id));
+
+  td::thread thread([&] { ASSERT_EQ(old_mask, td::thread::get_affinity_mask(td::this_thread::get_id())); });
+  thread.join();
+}
+#endif
@@ -10,24 +10,31 @@
 #include "td/db/binlog/ConcurrentBinlog.h"
 #include "td/db/BinlogKeyValue.h"
 #include "td/db/DbKey.h"
+#include "td/db/DerivedKeyCache.h"
 #include "td/db/SeqKeyValue.h"
 #include "td/db/SqliteConnectionSafe.h"
 #include "td/db/SqliteDb.h"
 #include "td/db/SqliteKeyValue.h"
+#include "td/db/SqliteKeyValueAsync.h"
 #include "td/db/SqliteKeyValueSafe.h"
 #include "td/db/TsSeqKeyValue.h"
+#include "td/db/WriteBatchPolicy.h"
 
 #include "td/actor/actor.h"
 #include "td/actor/ConcurrentScheduler.h"
 
 #include "td/utils/base64.h"
 #include "td/utils/common.h"
+#include "td/utils/crypto.h"
 #include "td/utils/filesystem.h"
 #include "td/utils/logging.h"
+#include "td/utils/misc.h"
 #include "td/utils/port/FileFd.h"
+#include "td/utils/port/Stat.h"
 #include "td/utils/port/thread.h"
 #include "td/utils/Random.h"
 #include "td/utils/Slice.h"
+#include "td/utils/SliceBuilder.h"
 #include "td/utils/Status.h"
 #include "td/utils/tests.h"
 
@@ -133,6 +140,192 @@ TEST(DB, binlog_encryption) {
   }
 }
 
+TEST(DB, binlog_big_replay) {
+  td::CSlice binlog_name = "test_binlog";
+  for (auto key : {td::DbKey::empty(), td::DbKey::raw_key(td::string(32, 'A'))}) {
+    td::Binlog::destroy(binlog_name).ignore();
+
+    td::vector<td::string> expected;
+    auto add_event = [&](td::Binlog &binlog) {
+      auto data = PSTRING() << td::string(1000, 'a') << td::lpad0(td::to_string(expected.size()), 8);
+      binlog.add_raw_event(td::BinlogEvent::create_raw(binlog.next_id(), 1, 0, td::create_storer(data)),
+                           td::BinlogDebugInfo{__FILE__, __LINE__});
+      expected.push_back(std::move(data));
+    };
+    auto check = [&](td::Binlog &binlog) {
+      td::vector<td::string> v;
+      binlog.init(binlog_name.str(), [&](const td::BinlogEvent &x) { v.push_back(x.data_.str()); }, key)
+          .ensure();
+      ASSERT_TRUE(v == expected);
+    };
+
+    {
+      td::Binlog binlog;
+      check(binlog);
+      for (int i = 0; i < 3000; i++) {
+        add_event(binlog);
+      }
+      binlog.close().ensure();
+    }
+    {
+      td::Binlog binlog;
+      check(binlog);
+      add_event(binlog);
+      binlog.close().ensure();
+    }
+    {
+      td::Binlog binlog;
+      check(binlog);
+      binlog.close().ensure();
+    }
+  }
+  td::Binlog::destroy(binlog_name).ignore();
+}
+
+TEST(DB, binlog_incremental_compaction) {
+  td::CSlice binlog_name = "test_binlog";
+  for (auto db_key : {td::DbKey::empty(), td::DbKey::raw_key(td::string(32, 'A'))}) {
+    td::Binlog::destroy(binlog_name).ignore();
+    std::map<td::uint64, td::string> expected;
+    bool was_compacted = false;
+    {
+      td::Binlog binlog;
+      binlog.init(binlog_name.str(), [](const td::BinlogEvent &x) {}, db_key).ensure();
+      td::Binlog::CompactionOptions options;
+      options.min_size = 10000;
+      options.max_dead_to_live_ratio = 1.0;
+      options.incremental_min_size = 0;
+      binlog.set_compaction_options(options);
+
+      for (int i = 0; i < 20000; i++) {
+        if (expected.empty() || td::Random::fast(0, 2) == 0) {
+          auto value = td::rand_string('a', 'z', 4 * td::Random::fast(1, 25));
+          expected[binlog.add(1, td::create_storer(value))] = value;
+        } else {
+          auto it = expected.lower_bound(static_cast<td::uint64>(td::Random::fast(0, i)));
+          if (it == expected.end()) {
+            it = expected.begin();
+          }
+          if (td::Random::fast(0, 1) == 0) {
+            binlog.erase(it->first);
+            expected.erase(it);
+          } else {
+            it->second = td::rand_string('a', 'z', 4 * td::Random::fast(1, 25));
+            binlog.rewrite(it->first, 1, td::create_storer(it->second));
+          }
+        }
+        if (binlog.is_compaction_in_progress()) {
+          was_compacted = true;
+          if (td::Random::fast(0, 10) == 0) {
+            binlog.compaction_step();
+          }
+        }
+      }
+      binlog.close().ensure();
+    }
+    ASSERT_TRUE(was_compacted);
+
+    std::map<td::uint64, td::string> loaded;
+    td::Binlog binlog;
+    binlog.init(binlog_name.str(), [&](const td::BinlogEvent &x) { loaded[x.id_] = x.data_.str(); }, db_key).ensure();
+    ASSERT_TRUE(expected == loaded);
+    binlog.close().ensure();
+  }
+  td::Binlog::destroy(binlog_name).ignore();
+}
+
+TEST(DB, binlog_compaction_on_close) {
+  td::CSlice binlog_name = "test_binlog";
+  for (auto db_key : {td::DbKey::empty(), td::DbKey::raw_key(td::string(32, 'A'))}) {
+    td::Binlog::destroy(binlog_name).ignore();
+    std::map<td::uint64, td::string> expected;
+    {
+      td::Binlog binlog;
+      binlog.init(binlog_name.str(), [](const td::BinlogEvent &x) {}, db_key).ensure();
+      td::Binlog::CompactionOptions options;
+      options.min_size = 1 << 30;
+      binlog.set_compaction_options(options);
+
+      for (int i = 0; i < 100; i++) {
+        auto value = td::rand_string('a', 'z', 100);
+        expected[binlog.add(1, td::create_storer(value))] = value;
+      }
+      for (int i = 0; i < 20000; i++) {
+        auto it = expected.lower_bound(static_cast<td::uint64>(td::Random::fast(0, 100)));
+        if (it == expected.end()) {
+          it = expected.begin();
+        }
+        it->second = td::rand_string('a', 'z', 100);
+        binlog.rewrite(it->first, 1, td::create_storer(it->second));
+      }
+      binlog.close().ensure();
+    }
+    ASSERT_TRUE(td::stat(binlog_name).ok().size_ < 100000);
+
+    std::map<td::uint64, td::string> loaded;
+    td::Binlog binlog;
+    binlog.init(binlog_name.str(), [&](const td::BinlogEvent &x) { loaded[x.id_] = x.data_.str(); }, db_key).ensure();
+    ASSERT_TRUE(expected == loaded);
+    binlog.close().ensure();
+  }
+  td::Binlog::destroy(binlog_name).ignore();
+}
+
+TEST(DB, binlog_group_commit) {
+  td::CSlice binlog_name = "test_binlog";
+  td::Binlog::destroy(binlog_name).ignore();
+
+  class Main final : public td::Actor {
+   public:
+    explicit Main(td::string binlog_name) : binlog_name_(std::move(binlog_name)) {
+    }
+
+    void start_up() final {
+      binlog_.init(binlog_name_, [](const td::BinlogEvent &x) {}).ensure();
+      for (int i = 0; i < REQUEST_COUNT; i++) {
+        binlog_.add(1, td::create_storer("AAAA"));
+        binlog_.force_sync(td::PromiseCreator::lambda([actor_id = actor_id(this)](td::Unit) {
+          send_closure(actor_id, &Main::on_synced);
+        }));
+      }
+    }
+
+    void on_synced() {
+      if (++synced_count_ != REQUEST_COUNT) {
+        return;
+      }
+      binlog_.get_info(td::PromiseCreator::lambda([actor_id = actor_id(this)](td::BinlogInfo info) {
+        send_closure(actor_id, &Main::on_get_info, std::move(info));
+      }));
+    }
+
+    void on_get_info(td::BinlogInfo info) {
+      ASSERT_EQ(static_cast<td::uint64>(REQUEST_COUNT), info.synced_request_count);
+      ASSERT_TRUE(info.sync_count >= 1);
+      ASSERT_TRUE(info.sync_count < static_cast<td::uint64>(REQUEST_COUNT));
+      ASSERT_TRUE(info.max_sync_batch_size > 1);
+      ASSERT_TRUE(info.max_sync_latency >= info.max_sync_time);
+      binlog_.close(td::PromiseCreator::lambda([](td::Unit) { td::Scheduler::instance()->finish(); }));
+    }
+
+   private:
+    enum : int { REQUEST_COUNT = 100 };
+    td::string binlog_name_;
+    td::ConcurrentBinlog binlog_;
+    int synced_count_ = 0;
+  };
+
+  td::ConcurrentScheduler sched;
+  sched.init(0);
+  sched.create_actor_unsafe<Main>(0, "Main", binlog_name.str()).release();
+  sched.start();
+  while (sched.run_main(10)) {
+    // empty
+  }
+  sched.finish();
+  td::Binlog::destroy(binlog_name).ignore();
+}
+
 TEST(DB, sqlite_lfs) {
   td::string path = "test_sqlite_db";
   td::SqliteDb::destroy(path).ignore();
@@ -142,6 +335,81 @@ TEST(DB, sqlite_lfs) {
   td::SqliteDb::destroy(path).ignore();
 }
 
+TEST(DB, sqlite_performance_profile) {
+  td::string path = "test_sqlite_db";
+  td::SqliteDb::destroy(path).ignore();
+  td::SqliteDb::PerformanceProfile profile;
+  profile.cache_size = -4096;
+  profile.wal_autocheckpoint = 5000;
+  profile.synchronous = 1;
+  profile.temp_store = 2;
+  profile.mmap_size = 1 << 20;
+  {
+    auto db = td::SqliteDb::open_with_key(path, true, td::DbKey::empty(), {}, profile).move_as_ok();
+    ASSERT_EQ("-4096", db.get_pragma_string("cache_size").ok());
+    ASSERT_EQ("5000", db.get_pragma_string("wal_autocheckpoint").ok());
+    ASSERT_EQ("1", db.get_pragma_string("synchronous").ok());
+    ASSERT_EQ("2", db.get_pragma_string("temp_store").ok());
+  }
+  {
+    auto db = td::SqliteDb::open_with_key(path, false, td::DbKey::empty()).move_as_ok();
+    td::SqliteDb::PerformanceProfile wrong_profile;
+    wrong_profile.synchronous = 4;
+    ASSERT_TRUE(db.set_performance_profile(wrong_profile).is_error());
+  }
+  td::SqliteDb::destroy(path).ignore();
+}
+
+TEST(DB, sqlite_statement_cache) {
+  td::string path = "test_sqlite_db";
+  td::SqliteDb::destroy(path).ignore();
+  auto db = td::SqliteDb::open_with_key(path, true, td::DbKey::empty()).move_as_ok();
+  db.exec("CREATE TABLE t (k INT4, v INT4)").ensure();
+
+  auto select = [&](td::int32 key) {
+    auto stmt = db.get_statement("SELECT v FROM t WHERE k = ?1").move_as_ok();
+    stmt.bind_int32(1, key).ensure();
+    stmt.step().ensure();
+    auto result = stmt.has_row() ? stmt.view_int32(0) : -1;
+    return result;
+  };
+  auto stats = db.get_statement_cache_stats();
+  for (td::int32 i = 0; i < 10; i++) {
+    auto insert = db.get_statement("INSERT INTO t VALUES (?1, ?2)").move_as_ok();
+    insert.bind_int32(1, i).ensure();
+    insert.bind_int32(2, i * i).ensure();
+    insert.step().ensure();
+  }
+  for (td::int32 i = 0; i < 10; i++) {
+    ASSERT_EQ(i * i, select(i));
+  }
+  ASSERT_EQ(-1, select(10));
+  auto new_stats = db.get_statement_cache_stats();
+  ASSERT_EQ(stats.miss_count + 2, new_stats.miss_count);
+  ASSERT_EQ(stats.hit_count + 19, new_stats.hit_count);
+  ASSERT_TRUE(new_stats.size >= 2);
+
+  {
+    // simultaneously used statements with the same query must be different
+    auto stmt1 = db.get_statement("SELECT v FROM t WHERE k = ?1").move_as_ok();
+    auto stmt2 = db.get_statement("SELECT v FROM t WHERE k = ?1").move_as_ok();
+    stmt1.bind_int32(1, 2).ensure();
+    stmt2.bind_int32(1, 3).ensure();
+    stmt1.step().ensure();
+    stmt2.step().ensure();
+    ASSERT_EQ(4, stmt1.view_int32(0));
+    ASSERT_EQ(9, stmt2.view_int32(0));
+  }
+
+  db.exec("DROP TABLE t").ensure();
+  ASSERT_EQ(0u, db.get_statement_cache_stats().size);
+  db.exec("CREATE TABLE t (k INT4, v INT4)").ensure();
+  ASSERT_EQ(-1, select(2));
+
+  db.close();
+  td::SqliteDb::destroy(path).ignore();
+}
+
 TEST(DB, sqlite_encryption) {
   td::string path = "test_sqlite_db";
   td::SqliteDb::destroy(path).ignore();
@@ -262,6 +530,39 @@ TEST(DB, sqlite_encryption_migrate_v4) {
   td::SqliteDb::destroy(path).ignore();
 }
 
+TEST(DB, derived_key_cache) {
+  td::string password = "cucu'\"mb er";
+  td::string salt = "0123456789abcdef";
+  td::string expected_sha256(32, '\0');
+  td::pbkdf2_sha256(password, salt, 1000, expected_sha256);
+  td::string expected_sha512(64, '\0');
+  td::pbkdf2_sha512(password, salt, 1000, expected_sha512);
+  for (int i = 0; i < 2; i++) {
+    td::string key(32, '\0');
+    td::DerivedKeyCache::pbkdf2(td::DerivedKeyCache::Hash::Sha256, password, salt, 1000, key);
+    ASSERT_EQ(expected_sha256, key);
+    td::DerivedKeyCache::pbkdf2(td::DerivedKeyCache::Hash::Sha512, password, salt, 1000, key);
+    ASSERT_EQ(expected_sha512.substr(0, 32), key);
+    td::DerivedKeyCache::pbkdf2(td::DerivedKeyCache::Hash::Sha512, password, salt, 999, key);
+    ASSERT_TRUE(expected_sha512.substr(0, 32) != key);
+  }
+
+  // opening of an encrypted database must succeed with a cached derived key and fail with a wrong password
+  td::string path = "test_sqlite_db";
+  td::SqliteDb::destroy(path).ignore();
+  auto cucumber = td::DbKey::password(password);
+  {
+    auto db = td::SqliteDb::change_key(path, true, cucumber, td::DbKey::empty()).move_as_ok();
+    db.set_user_version(123).ensure();
+  }
+  for (int i = 0; i < 2; i++) {
+    auto db = td::SqliteDb::open_with_key(path, false, cucumber).move_as_ok();
+    ASSERT_EQ(123, db.user_version().ok());
+  }
+  ASSERT_TRUE(td::SqliteDb::open_with_key(path, false, td::DbKey::password("wrong")).is_error());
+  td::SqliteDb::destroy(path).ignore();
+}
+
 using SeqNo = td::uint64;
 struct DbQuery {
   enum class Type { Get, Set, Erase } type = Type::Get;
@@ -366,6 +667,161 @@ class BaselineKV {
   SeqNo current_tid_ = 0;
 };
 
+TEST(DB, sqlite_key_value_async) {
+  td::string path = "test_sqlite_kv_async";
+  td::SqliteDb::destroy(path).ignore();
+
+  class Main final : public td::Actor {
+   public:
+    explicit Main(td::string path) : path_(std::move(path)) {
+    }
+
+    void start_up() final {
+      auto sql_connection = std::make_shared<td::SqliteConnectionSafe>(path_, td::DbKey::empty());
+      sql_connection->set(td::SqliteDb::open_with_key(path_, true, td::DbKey::empty()).move_as_ok());
+      td::SqliteKeyValue::init(sql_connection->get(), "kv").ensure();
+      kv_safe_ = std::make_shared<td::SqliteKeyValueSafe>("kv", sql_connection);
+      kv_ = td::create_sqlite_key_value_async(kv_safe_, 0);
+
+      td::Random::Xorshift128plus rnd(123);
+      auto gen_key = [&] {
+        return td::rand_string('a', 'c', rnd.fast(1, 3));
+      };
+      for (int i = 0; i < 3000; i++) {
+        auto key = gen_key();
+        switch (rnd.fast(0, 9)) {
+          case 0:
+            kv_->erase(key, td::Promise<td::Unit>());
+            reference_.erase(key);
+            break;
+          case 1:
+            if (rnd.fast(0, 20) == 0) {
+              kv_->erase_by_prefix(key, td::Promise<td::Unit>());
+              for (auto it = reference_.lower_bound(key); it != reference_.end() && td::begins_with(it->first, key);) {
+                it = reference_.erase(it);
+              }
+            }
+            break;
+          case 2:
+            if (rnd.fast(0, 20) == 0) {
+              std::unordered_map<td::string, td::string> key_values;
+              key_values[key] = td::to_string(i);
+              key_values[gen_key()] = td::to_string(i + 1);
+              for (auto &key_value : key_values) {
+                reference_[key_value.first] = key_value.second;
+              }
+              kv_->set_all(std::move(key_values), td::Promise<td::Unit>());
+            }
+            break;
+          case 3:
+          case 4:
+          case 5: {
+            auto value = td::to_string(i);
+            kv_->set(key, value, td::Promise<td::Unit>());
+            reference_[key] = std::move(value);
+            break;
+          }
+          default: {
+            auto it = reference_.find(key);
+            auto expected = it == reference_.end() ? td::string() : it->second;
+            pending_get_count_++;
+            kv_->get(key, td::PromiseCreator::lambda([actor_id = actor_id(this), expected](td::string value) {
+              ASSERT_EQ(expected, value);
+              send_closure(actor_id, &Main::on_get);
+            }));
+            break;
+          }
+        }
+      }
+      kv_->close(td::PromiseCreator::lambda([actor_id = actor_id(this)](td::Unit) {
+        send_closure(actor_id, &Main::on_closed);
+      }));
+    }
+
+    void on_get() {
+      pending_get_count_--;
+    }
+
+    void on_closed() {
+      ASSERT_EQ(0, pending_get_count_);
+      std::map<td::string, td::string> values;
+      kv_safe_->get().get_by_prefix("", [&](td::Slice key, td::Slice value) {
+        values[key.str()] = value.str();
+        return true;
+      });
+      ASSERT_TRUE(values == reference_);
+      kv_safe_->close();
+      td::Scheduler::instance()->finish();
+    }
+
+   private:
+    td::string path_;
+    std::shared_ptr<td::SqliteKeyValueSafe> kv_safe_;
+    td::unique_ptr<td::SqliteKeyValueAsyncInterface> kv_;
+    std::map<td::string, td::string> reference_;
+    int pending_get_count_ = 0;
+  };
+
+  td::ConcurrentScheduler sched;
+  sched.init(0);
+  sched.create_actor_unsafe<Main>(0, "Main", path).release();
+  sched.start();
+  while (sched.run_main(10)) {
+    // empty
+  }
+  sched.finish();
+  td::SqliteDb::destroy(path).ignore();
+}
+
+TEST(DB, write_batch_policy) {
+  td::WriteBatchPolicy policy;
+  td::size_t initial_limit = policy.get_stats().batch_size_limit;
+  ASSERT_TRUE(initial_limit > 0);
+
+  // sparse queries must be committed almost immediately
+  double now = 1.0;
+  for (int i = 0; i < 100; i++) {
+    now += 1.0;
+    policy.on_query(now);
+  }
+  ASSERT_TRUE(policy.get_flush_delay() < 0.005);
+
+  // the limit grows while full batches are committed fast
+  auto run_full_batches = [&](double commit_time) {
+    for (int i = 0; i < 20; i++) {
+      td::size_t batch_size = 0;
+      do {
+        now += 0.00001;
+        policy.on_query(now);
+        batch_size++;
+      } while (!policy.is_full(batch_size));
+      policy.on_commit(batch_size, commit_time);
+    }
+  };
+  run_full_batches(0.001);
+  auto stats = policy.get_stats();
+  ASSERT_TRUE(stats.batch_size_limit > initial_limit);
+  ASSERT_EQ(20u, stats.batch_count);
+  ASSERT_TRUE(stats.max_batch_size > initial_limit);
+  ASSERT_TRUE(policy.get_flush_delay() >= 0.001);
+  ASSERT_TRUE(policy.get_flush_delay() <= 0.01);
+
+  // and shrinks back if commits become too slow
+  run_full_batches(1.0);
+  ASSERT_EQ(initial_limit, policy.get_stats().batch_size_limit);
+
+  // small batches shrink the limit too
+  run_full_batches(0.001);
+  ASSERT_TRUE(policy.get_stats().batch_size_limit > initial_limit);
+  for (int i = 0; i < 20; i++) {
+    policy.on_commit(1, 0.001);
+  }
+  stats = policy.get_stats();
+  ASSERT_EQ(initial_limit, stats.batch_size_limit);
+  ASSERT_EQ(80u, stats.batch_count);
+  ASSERT_TRUE(stats.max_commit_time >= 1.0);
+}
+
 TEST(DB, key_value) {
   td::vector<td::string> keys;
   td::vector<td::string> values;
@@ -474,6 +930,38 @@ TEST(DB, key_value_set_all) {
   td::SqliteDb::destroy(sqlite_kv_name).ignore();
 }
 
+TEST(DB, binlog_key_value_erase_by_prefix) {
+  td::CSlice path = "test_binlog_kv";
+  td::Binlog::destroy(path).ignore();
+  {
+    td::BinlogKeyValue<td::Binlog> kv;
+    kv.init(path.str()).ensure();
+    for (int i = 0; i < 1000; i++) {
+      kv.set(PSTRING() << (i % 2 == 0 ? "even" : "odd") << i, "value");
+    }
+  }
+  {
+    td::BinlogKeyValue<td::Binlog> kv;
+    kv.init(path.str()).ensure();
+    ASSERT_EQ(1000u, kv.get_all().size());
+    ASSERT_EQ("value", kv.get("odd999"));
+    ASSERT_EQ(500u, kv.prefix_get("odd").size());
+    kv.erase_by_prefix("odd");
+    ASSERT_TRUE(kv.prefix_get("odd").empty());
+    ASSERT_EQ(500u, kv.prefix_get("even").size());
+  }
+  td::BinlogKeyValue<td::Binlog> kv;
+  kv.init(path.str()).ensure();
+  ASSERT_TRUE(kv.prefix_get("odd").empty());
+  auto all = kv.get_all();
+  ASSERT_EQ(500u, all.size());
+  for (auto &it : all) {
+    ASSERT_TRUE(td::begins_with(it.first, "even"));
+  }
+  kv.close();
+  td::Binlog::destroy(path).ignore();
+}
+
 #if !TD_THREAD_UNSUPPORTED
 TEST(DB, thread_key_value) {
   td::vector<td::string> keys;
@@ -23,6 +23,7 @@
 #include "td/utils/ByteFlow.h"
 #include "td/utils/common.h"
 #include "td/utils/crypto.h"
+#include "td/utils/find_boundary.h"
 #include "td/utils/format.h"
 #include "td/utils/Gzip.h"
 #include "td/utils/GzipByteFlow.h"
@@ -211,6 +212,42 @@ TEST(Http, reader) {
   ASSERT_EQ(start_size, td::BufferAllocator::get_buffer_slice_size());
 }
 
+TEST(Http, find_boundary) {
+  for (auto boundary : {td::string("\r\n\r\n"), td::string("\r\n--abacaba"), td::string("a")}) {
+    for (int i = 0; i < 1000; i++) {
+      auto str = td::rand_string('a', 'c', td::Random::fast(0, 100));
+      for (int j = td::Random::fast(0, 3); j > 0; j--) {
+        auto pos = td::Random::fast(0, static_cast<int>(str.size()));
+        auto part = boundary.substr(0, td::Random::fast(1, static_cast<int>(boundary.size())));
+        str.insert(pos, td::Random::fast_bool() ? part : td::string("\r\n"));
+      }
+      // the default chunk size is 4096, so boundaries crossing chunk borders are tested too
+      str = td::string(td::Random::fast(3990, 4096), 'c') + str;
+      auto expected_pos = str.find(boundary);
+
+      td::ChainBufferWriter writer;
+      auto reader = writer.extract_reader();
+      size_t already_read = 0;
+      bool is_found = false;
+      for (auto &part : td::rand_split(str)) {
+        writer.append(part);
+        reader.sync_with_writer();
+        is_found = td::find_boundary(reader.clone(), boundary, already_read);
+        if (is_found) {
+          break;
+        }
+        ASSERT_TRUE(already_read <= reader.size());
+      }
+      if (expected_pos == td::string::npos) {
+        ASSERT_TRUE(!is_found);
+      } else {
+        ASSERT_TRUE(is_found);
+        ASSERT_EQ(expected_pos, already_read);
+      }
+    }
+  }
+}
+
 TEST(Http, gzip_bomb) {
 #if TD_ANDROID || TD_TIZEN || TD_EMSCRIPTEN  // the test must be disabled on low-memory systems
   return;
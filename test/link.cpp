@@ -197,6 +197,10 @@ TEST(Link, parse_internal_link) {
   parse_internal_link("t.dog/levlam/1", nullptr);
   parse_internal_link("t.m/levlam/1", nullptr);
   parse_internal_link("t.men/levlam/1", nullptr);
+  parse_internal_link("WWW.T.ME/levlam/1", message("tg:resolve?domain=levlam&post=1"));
+  parse_internal_link("https://google.com/t.me/levlam/1", nullptr);
+  parse_internal_link("https://t.me.google.com/levlam/1", nullptr);
+  parse_internal_link("https://user@t.me/levlam/1", nullptr);
 
   parse_internal_link("tg:resolve?domain=username&post=12345&single",
                       message("tg:resolve?domain=username&post=12345&single"));
@@ -9,6 +9,7 @@
 #include "td/utils/buffer.h"
 #include "td/utils/filesystem.h"
 #include "td/utils/port/path.h"
+#include "td/utils/Random.h"
 #include "td/utils/SliceBuilder.h"
 #include "td/utils/tests.h"
 
@@ -61,10 +62,20 @@ TEST(SecureStorage, simple) {
     td::unlink(value_path).ignore();
     td::unlink(encrypted_path).ignore();
     td::unlink(decrypted_path).ignore();
-    td::string file_value(100000, 'a');
-    td::write_file(value_path, file_value).ensure();
-    auto hash = td::secure_storage::encrypt_file(value_secret, value_path, encrypted_path).move_as_ok();
-    td::secure_storage::decrypt_file(value_secret, hash, encrypted_path, decrypted_path).ensure();
-    ASSERT_TRUE(td::read_file(decrypted_path).move_as_ok().as_slice() == file_value);
+    for (auto file_size : {0, 100000, 131072, 400000}) {
+      td::string file_value = td::rand_string('a', 'z', file_size);
+      td::write_file(value_path, file_value).ensure();
+      auto hash = td::secure_storage::encrypt_file(value_secret, value_path, encrypted_path).move_as_ok();
+      td::secure_storage::decrypt_file(value_secret, hash, encrypted_path, decrypted_path).ensure();
+      ASSERT_TRUE(td::read_file(decrypted_path).move_as_ok().as_slice() == file_value);
+
+      auto encrypted_value = td::read_file(encrypted_path).move_as_ok();
+      auto decrypted_value =
+          td::secure_storage::decrypt_value(value_secret, hash, encrypted_value.as_slice()).move_as_ok();
+      ASSERT_TRUE(decrypted_value.as_slice() == file_value);
+    }
+    td::unlink(value_path).ignore();
+    td::unlink(encrypted_path).ignore();
+    td::unlink(decrypted_path).ignore();
   }
 }
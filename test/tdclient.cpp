@@ -1192,3 +1192,25 @@ TEST(PartsManager, hands) {
     pm.init(1, 100000, true, 10, {0, 1, 2}, false, true).ensure_error();
   }
 }
+
+TEST(PartsManager, preferred_part_size) {
+  {
+    td::PartsManager pm;
+    pm.set_preferred_part_size(256 << 10);
+    pm.init(1 << 20, 1 << 20, true, 0, {}, true, true).ensure();
+    ASSERT_EQ(static_cast<size_t>(256 << 10), pm.get_part_size());
+    ASSERT_EQ(4, pm.get_part_count());
+  }
+  {
+    td::PartsManager pm;
+    pm.set_preferred_part_size(32 << 10);
+    pm.init(1500 << 20, 1500 << 20, true, 0, {}, true, true).ensure();
+    ASSERT_EQ(static_cast<size_t>(512 << 10), pm.get_part_size());
+  }
+  {
+    td::PartsManager pm;
+    pm.set_preferred_part_size(256 << 10);
+    pm.init(1 << 20, 1 << 20, true, 128 << 10, {}, true, true).ensure();
+    ASSERT_EQ(static_cast<size_t>(128 << 10), pm.get_part_size());
+  }
+}
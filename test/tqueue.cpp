@@ -42,6 +42,57 @@ TEST(TQueue, hands) {
   ASSERT_EQ(0u, tqueue->get(qid, head, true, 0, events_span).move_as_ok());
 }
 
+TEST(TQueue, max_total_event_length) {
+  td::TQueue::Event events[100];
+  auto events_span = td::MutableSpan<td::TQueue::Event>(events, 100);
+
+  auto tqueue = td::TQueue::create();
+  auto qid = 12;
+  tqueue->set_max_total_event_length(qid, 10);
+  ASSERT_TRUE(tqueue->push(qid, td::string(11, 'a'), 1, 0, td::TQueue::EventId()).is_error());
+  auto first_id = tqueue->push(qid, "aaaa", 1, 0, td::TQueue::EventId()).move_as_ok();
+  tqueue->push(qid, "bbbb", 1, 0, td::TQueue::EventId()).ensure();
+  ASSERT_EQ(2u, tqueue->get_size(qid));
+  tqueue->push(qid, "cccc", 1, 0, td::TQueue::EventId()).ensure();
+  ASSERT_EQ(2u, tqueue->get(qid, first_id, false, 0, events_span).move_as_ok());
+  ASSERT_EQ(2u, events_span.size());
+  ASSERT_EQ("bbbb", events_span[0].data);
+  ASSERT_EQ("cccc", events_span[1].data);
+
+  tqueue->push(qid, td::string(10, 'd'), 1, 0, td::TQueue::EventId()).ensure();
+  events_span = td::MutableSpan<td::TQueue::Event>(events, 100);
+  ASSERT_EQ(1u, tqueue->get(qid, first_id, false, 0, events_span).move_as_ok());
+  ASSERT_EQ(td::string(10, 'd'), events_span[0].data);
+
+  tqueue->set_max_total_event_length(qid, 0);
+  tqueue->push(qid, td::string(100, 'e'), 1, 0, td::TQueue::EventId()).ensure();
+  ASSERT_EQ(2u, tqueue->get_size(qid));
+}
+
+TEST(TQueue, incremental_gc) {
+  auto tqueue = td::TQueue::create();
+  for (td::TQueue::QueueId qid = 1; qid <= 10; qid++) {
+    for (int i = 0; i < 10; i++) {
+      tqueue->push(qid, "a", i < 7 ? 10 : 100, 0, td::TQueue::EventId()).ensure();
+    }
+  }
+  td::int64 deleted_events = 0;
+  while (true) {
+    auto deleted = tqueue->run_gc(50, 3);
+    ASSERT_TRUE(deleted <= 3);
+    if (deleted == 0) {
+      break;
+    }
+    deleted_events += deleted;
+  }
+  ASSERT_EQ(70, deleted_events);
+  for (td::TQueue::QueueId qid = 1; qid <= 10; qid++) {
+    ASSERT_EQ(3u, tqueue->get_size(qid));
+  }
+  ASSERT_EQ(0, tqueue->run_gc(50));
+  ASSERT_EQ(30, tqueue->run_gc(200));
+}
+
 class TestTQueue {
  public:
   using EventId = td::TQueue::EventId;